@@ -0,0 +1,50 @@
+/*
+ * Shared driver for the KAT tests of the products with n=1024
+ * (kat_mul1024_<backend>.c)
+ *
+ * KAT_PRODUCT_TEST(type) defines
+ *   static void test_mul_from_KAT_values(const char *name, void (*f)(type *, type *, type *))
+ * which converts the KAT inputs in data_poly1024 to arrays of type,
+ * computes their product with f and compares it with the expected
+ * result. The products must return coefficients in [0, Q-1].
+ *
+ * KAT(f) runs the test on function f.
+ */
+
+#ifndef __KAT_HARNESS_H
+#define __KAT_HARNESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "data_poly1024.h"
+
+#define KAT_PRODUCT_TEST(type)						\
+static void test_mul_from_KAT_values(const char *name, void (*f)(type *, type *, type *)) { \
+  type ua[1024], ub[1024], uc[1024];					\
+  int i, j;								\
+									\
+  printf("Testing %s (KAT values)\n", name);				\
+  for (i = 0; i < REPETITIONS; i++) {					\
+    for (j = 0; j < 1024; j++) {					\
+      ua[j] = (type) a[i][j];						\
+      ub[j] = (type) b[i][j];						\
+    }									\
+    f(uc, ua, ub);							\
+									\
+    for (j = 0; j < 1024; j++) {					\
+      if ((int32_t) uc[j] != c[i][j]) {					\
+	printf("\t Failure at round %d on coeff %d: %"PRIi32" != %"PRIi32".\n", i, j, (int32_t) uc[j], c[i][j]); \
+	exit(EXIT_FAILURE);						\
+      }									\
+    }									\
+  }									\
+									\
+  printf("\t Success after %d tests\n\n", REPETITIONS);			\
+}
+
+#define KAT(f) test_mul_from_KAT_values(#f, f)
+
+#endif /* __KAT_HARNESS_H */
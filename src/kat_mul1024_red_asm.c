@@ -63,6 +63,11 @@ int main(void){
 
   printf("\nTesting ntt_red1024_product5_asm (KAT values)\n");
   test_mul_from_KAT_values(ntt_red1024_product5_asm);
+  printf("\nTesting ntt_red1024_product6_asm (KAT values)\n");
+  test_mul_from_KAT_values(ntt_red1024_product6_asm);
+
+  printf("\nTesting ntt_red1024_product_mulld_asm (KAT values)\n");
+  test_mul_from_KAT_values(ntt_red1024_product_mulld_asm);
 
   return 0;
 }
@@ -0,0 +1,27 @@
+/*
+ * Check the products with 16-bit coefficients against known values
+ * - the KAT values in data_poly1024 are 32bit integers in [0, Q-1].
+ */
+
+#include "ntt_short1024.h"
+#include "ntt_short_asm1024.h"
+#include "kat_harness.h"
+
+KAT_PRODUCT_TEST(int16_t)
+
+int main(void){
+  build_kat();
+
+  KAT(ntt_short1024_product1);
+  KAT(ntt_short1024_product2);
+  KAT(ntt_short1024_product3);
+  KAT(ntt_short1024_product4);
+  KAT(ntt_short1024_product5);
+  KAT(ntt_short1024_product1_asm);
+  KAT(ntt_short1024_product2_asm);
+  KAT(ntt_short1024_product3_asm);
+  KAT(ntt_short1024_product4_asm);
+  KAT(ntt_short1024_product5_asm);
+
+  return 0;
+}
@@ -0,0 +1,497 @@
+/*
+ * Build lazy-reduction products for ntt_red<size> (Q=12289)
+ *
+ * The products of ntt_red<size> and ntt_red_asm<size> reduce the
+ * coefficients at fixed places:
+ * - once after each forward NTT
+ * - twice after the pointwise product
+ * This program uses the bounds of red_bounds.c to find the smallest
+ * number of reductions that keep all coefficients in 32 bits and all
+ * products w * x small enough for mul_red. It searches:
+ * - the number of reductions after the forward NTT of a and of b (0 to 2)
+ * - the number of reductions after the pointwise product (0 to 2)
+ * - the rounds of the forward and inverse NTTs that must be reduced
+ *   (ntt_ct_lazy_schedule and ntt_gs_lazy_schedule).
+ *
+ * The C product can reduce inside the NTTs (mulntt_red_ct_std2rev_lazy
+ * and nttmul_red_gs_rev2std_lazy). The assembly product can only reduce
+ * between stages so it gets its own schedule.
+ *
+ * Input: n = 16, 256, 512, or 1024
+ * Output: files ntt_red<n>_lazy.h and ntt_red<n>_lazy.c
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "red_bounds.h"
+#include "ntt_red16_tables.h"
+#include "ntt_red256_tables.h"
+#include "ntt_red512_tables.h"
+#include "ntt_red1024_tables.h"
+
+#define Q 12289
+
+/*
+ * The inputs to the products are in [0, Q-1]
+ */
+#define INPUT_BOUND (Q-1)
+
+/*
+ * Parameters for size n
+ * - fwd = table for the forward NTT (mixed_powers_rev)
+ * - inv = table for the inverse NTT (inv_mixed_powers_rev)
+ */
+typedef struct parameters_s {
+  uint32_t n;
+  uint32_t inv_n;
+  uint32_t inv_k;
+  const int16_t *fwd;
+  const int16_t *inv;
+} parameters_t;
+
+/*
+ * Schedule
+ * - fwd_rounds[i] = rounds to reduce in the forward NTT of operand i
+ *   (i=0 for a, i=1 for b)
+ * - fwd_reductions[i] = number of reductions after that NTT
+ * - pointwise_reductions = number of reductions after the pointwise product
+ * - inv_rounds = rounds to reduce in the inverse NTT
+ * - reductions = total number of reductions (not counting the
+ *   ones in mul_red and the final scaling)
+ * - layers = number of reductions in the NTT rounds
+ * - bounds on the coefficients after each stage
+ */
+typedef struct schedule_s {
+  uint32_t fwd_rounds[2];
+  uint32_t fwd_reductions[2];
+  uint32_t pointwise_reductions;
+  uint32_t inv_rounds;
+  uint32_t reductions;
+  uint32_t layers;
+  int64_t fwd_bound[2];
+  int64_t pointwise_bound;
+  int64_t inv_bound;
+} schedule_t;
+
+
+/*
+ * x^k modulo q
+ */
+static uint32_t power(uint32_t x, uint32_t k, uint32_t q) {
+  uint32_t y;
+
+  assert(q > 0);
+
+  y = 1;
+  while (k != 0) {
+    if ((k & 1) != 0) {
+      y = (y * x) % q;
+    }
+    k >>= 1;
+    x = (x * x) % q;
+  }
+  return y;
+}
+
+/*
+ * Number of bits set in x
+ */
+static uint32_t popcount(uint32_t x) {
+  uint32_t c;
+
+  c = 0;
+  while (x != 0) {
+    c += x & 1;
+    x >>= 1;
+  }
+  return c;
+}
+
+/*
+ * Bound after r reductions
+ */
+static int64_t reduce_bound(int64_t b, uint32_t r) {
+  while (r > 0) {
+    b = abs_red_bound(b);
+    r --;
+  }
+  return b;
+}
+
+/*
+ * Rescaling constant: inv_k^e * inv_n where e is the number
+ * of reductions (including mul_red in the pointwise product and
+ * the three reductions of the final step).
+ * - the result is in [-(Q-1)/2, (Q-1)/2]
+ */
+static int32_t rescale_factor(const parameters_t *p, const schedule_t *s) {
+  uint32_t e, c;
+
+  e = s->reductions + 1 + 3;
+  c = (power(p->inv_k, e, Q) * p->inv_n) % Q;
+  return (c > (Q-1)/2) ? (int32_t) c - Q : (int32_t) c;
+}
+
+/*
+ * Check the final step for |a[i]| <= b and rescaling constant c:
+ *   a[i] = correct(red(red(mul_red(a[i], c))))
+ * - the product must not overflow and correct requires its input
+ *   to be in [-Q, 2*Q-1]
+ */
+static bool check_final_step(int64_t b, int64_t c) {
+  int64_t lo, hi, x, m;
+  uint32_t i;
+
+  if (b * (c < 0 ? -c : c) > MAX_MUL_RED) return false;
+
+  lo = min_red_mul(-b, b, c, &m);
+  hi = max_red_mul(-b, b, c, &m);
+  for (i=0; i<2; i++) {
+    x = min_red(lo, hi, &m);
+    hi = max_red(lo, hi, &m);
+    lo = x;
+  }
+
+  return -Q <= lo && hi <= 2*Q - 1;
+}
+
+/*
+ * Check a candidate schedule and complete it.
+ * - s->fwd_reductions and s->pointwise_reductions must be set
+ * - if layers is false, no reduction is allowed in the NTT rounds
+ * Return false if the schedule is not safe.
+ */
+static bool check_schedule(const parameters_t *p, schedule_t *s, bool layers) {
+  uint32_t i;
+  int64_t b;
+
+  s->layers = 0;
+  for (i=0; i<2; i++) {
+    b = ntt_ct_lazy_schedule(INPUT_BOUND, p->n, p->fwd, &s->fwd_rounds[i]);
+    if (b < 0 || (!layers && s->fwd_rounds[i] != 0)) return false;
+    s->layers += popcount(s->fwd_rounds[i]);
+    s->fwd_bound[i] = reduce_bound(b, s->fwd_reductions[i]);
+  }
+
+  // pointwise product: mul_red(a[i], b[i])
+  if (s->fwd_bound[0] * s->fwd_bound[1] > MAX_MUL_RED) return false;
+  b = abs_mul_red_bound(s->fwd_bound[0], s->fwd_bound[1]);
+  s->pointwise_bound = reduce_bound(b, s->pointwise_reductions);
+
+  b = ntt_gs_lazy_schedule(s->pointwise_bound, p->n, p->inv, &s->inv_rounds);
+  if (b < 0 || (!layers && s->inv_rounds != 0)) return false;
+  s->layers += popcount(s->inv_rounds);
+  s->inv_bound = b;
+
+  s->reductions = s->fwd_reductions[0] + s->fwd_reductions[1] + s->pointwise_reductions + s->layers;
+
+  // final step: the rescaling constant depends on the number of reductions
+  return check_final_step(b, rescale_factor(p, s));
+}
+
+/*
+ * Search for the schedule with fewest reductions
+ * - if there's a tie, we prefer the schedule with fewest reductions in NTT rounds
+ * - the two operands are symmetric so we only consider schedules where
+ *   a is reduced at least as many times as b.
+ */
+static bool best_schedule(const parameters_t *p, schedule_t *best, bool layers) {
+  schedule_t s;
+  uint32_t ra, rb, r2;
+  bool found;
+
+  found = false;
+  for (ra=0; ra<=2; ra++) {
+    for (rb=0; rb<=ra; rb++) {
+      for (r2=0; r2<=2; r2++) {
+	s.fwd_reductions[0] = ra;
+	s.fwd_reductions[1] = rb;
+	s.pointwise_reductions = r2;
+	if (check_schedule(p, &s, layers) &&
+	    (!found || s.reductions < best->reductions ||
+	     (s.reductions == best->reductions && s.layers < best->layers))) {
+	  *best = s;
+	  found = true;
+	}
+      }
+    }
+  }
+
+  return found;
+}
+
+
+/*
+ * Print a list of rounds
+ */
+static void print_rounds(FILE *f, uint32_t rounds) {
+  uint32_t k;
+  bool first;
+
+  if (rounds == 0) {
+    fprintf(f, "none");
+    return;
+  }
+  first = true;
+  for (k=1; k<32; k++) {
+    if (rounds & ((uint32_t) 1 << k)) {
+      fprintf(f, first ? "%"PRIu32 : ", %"PRIu32, k);
+      first = false;
+    }
+  }
+}
+
+static void print_schedule_comment(FILE *f, const char *what, const schedule_t *s) {
+  fprintf(f, " * %s: %"PRIu32" reductions\n", what, s->reductions);
+  fprintf(f, " * - forward NTT of a: reduced rounds = ");
+  print_rounds(f, s->fwd_rounds[0]);
+  fprintf(f, ", then %"PRIu32" reductions: |a[i]| <= %"PRId64"\n", s->fwd_reductions[0], s->fwd_bound[0]);
+  fprintf(f, " * - forward NTT of b: reduced rounds = ");
+  print_rounds(f, s->fwd_rounds[1]);
+  fprintf(f, ", then %"PRIu32" reductions: |b[i]| <= %"PRId64"\n", s->fwd_reductions[1], s->fwd_bound[1]);
+  fprintf(f, " * - pointwise product, then %"PRIu32" reductions: |c[i]| <= %"PRId64"\n",
+	  s->pointwise_reductions, s->pointwise_bound);
+  fprintf(f, " * - inverse NTT: reduced rounds = ");
+  print_rounds(f, s->inv_rounds);
+  fprintf(f, ": |c[i]| <= %"PRId64"\n", s->inv_bound);
+  fprintf(f, " *\n");
+}
+
+static void print_param_defs(FILE *f, const parameters_t *p, const char *prefix, const schedule_t *s) {
+  uint32_t n;
+
+  n = p->n;
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%sfwd_a_rounds = 0x%"PRIx32";\n", n, prefix, s->fwd_rounds[0]);
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%sfwd_a_reductions = %"PRIu32";\n", n, prefix, s->fwd_reductions[0]);
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%sfwd_b_rounds = 0x%"PRIx32";\n", n, prefix, s->fwd_rounds[1]);
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%sfwd_b_reductions = %"PRIu32";\n", n, prefix, s->fwd_reductions[1]);
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%spointwise_reductions = %"PRIu32";\n", n, prefix, s->pointwise_reductions);
+  fprintf(f, "static const uint32_t ntt_red%"PRIu32"_%sinv_rounds = 0x%"PRIx32";\n", n, prefix, s->inv_rounds);
+  fprintf(f, "static const int32_t ntt_red%"PRIu32"_%srescale = %"PRId32";\n", n, prefix, rescale_factor(p, s));
+}
+
+static void print_header(FILE *f, const parameters_t *p, const schedule_t *c, const schedule_t *a) {
+  fprintf(f, "/*\n");
+  fprintf(f, " * Generated by make_lazy_schedule: do not edit.\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * Lazy-reduction products for n = %"PRIu32". The inputs are in [0, %"PRIu32"].\n", p->n, Q-1);
+  fprintf(f, " * The products ntt_red%"PRIu32"_product5 and ntt_red%"PRIu32"_product5_asm use 4 reductions.\n", p->n, p->n);
+  fprintf(f, " *\n");
+  print_schedule_comment(f, "C schedule", c);
+  print_schedule_comment(f, "AVX2 schedule", a);
+  fprintf(f, " */\n\n");
+}
+
+/*
+ * Declarations
+ */
+static void print_declarations(FILE *f, const parameters_t *p, const schedule_t *c, const schedule_t *a) {
+  uint32_t n;
+
+  n = p->n;
+  print_header(f, p, c, a);
+
+  fprintf(f, "#ifndef __NTT_RED%"PRIu32"_LAZY_H\n", n);
+  fprintf(f, "#define __NTT_RED%"PRIu32"_LAZY_H\n\n", n);
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  fprintf(f, "/*\n");
+  fprintf(f, " * SCHEDULES\n");
+  fprintf(f, " * - *_rounds: bit k is set if round k of the NTT is reduced\n");
+  fprintf(f, " * - *_reductions: number of reductions after the stage\n");
+  fprintf(f, " * - rescale: constant for the final step\n");
+  fprintf(f, " */\n");
+  print_param_defs(f, p, "lazy_", c);
+  fprintf(f, "\n");
+  print_param_defs(f, p, "lazy_asm_", a);
+  fprintf(f, "\n");
+
+  fprintf(f, "/*\n");
+  fprintf(f, " * PRODUCTS\n");
+  fprintf(f, " * - input: a and b must contain integers in [0, %"PRIu32"]\n", Q-1);
+  fprintf(f, " * - the product is stored in c, in standard order, with coefficients in [0, %"PRIu32"]\n", Q-1);
+  fprintf(f, " * - a and b are modified\n");
+  fprintf(f, " * - the _asm variant requires AVX2\n");
+  fprintf(f, " */\n");
+  fprintf(f, "extern void ntt_red%"PRIu32"_lazy_product(int32_t *c, int32_t *a, int32_t *b);\n", n);
+  fprintf(f, "extern void ntt_red%"PRIu32"_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b);\n\n", n);
+
+  fprintf(f, "#endif /* __NTT_RED%"PRIu32"_LAZY_H */\n", n);
+}
+
+/*
+ * Reductions of an array x after a stage
+ */
+static void print_reductions(FILE *f, uint32_t n, const char *x, uint32_t r, const char *suffix) {
+  switch (r) {
+  case 0:
+    break;
+  case 1:
+    fprintf(f, "  reduce_array%s(%s, %"PRIu32");\n", suffix, x, n);
+    break;
+  default:
+    assert(r == 2);
+    fprintf(f, "  reduce_array_twice%s(%s, %"PRIu32");\n", suffix, x, n);
+    break;
+  }
+}
+
+static void print_c_forward(FILE *f, uint32_t n, const char *x, uint32_t rounds, uint32_t r) {
+  if (rounds == 0) {
+    fprintf(f, "  mulntt_red%"PRIu32"_ct_std2rev(%s);\n", n, x);
+  } else {
+    fprintf(f, "  mulntt_red_ct_std2rev_lazy(%s, %"PRIu32", ntt_red%"PRIu32"_mixed_powers_rev, 0x%"PRIx32");\n",
+	    x, n, n, rounds);
+  }
+  print_reductions(f, n, x, r, "");
+}
+
+// the fused NTT includes one reduction
+static void print_asm_forward(FILE *f, uint32_t n, const char *x, uint32_t r) {
+  if (r == 0) {
+    fprintf(f, "  mulntt_red%"PRIu32"_ct_std2rev_asm(%s);\n", n, x);
+  } else {
+    fprintf(f, "  mulntt_red%"PRIu32"_ct_std2rev_fused_asm(%s);\n", n, x);
+    print_reductions(f, n, x, r - 1, "_asm");
+  }
+}
+
+/*
+ * Product functions
+ */
+static void print_products(FILE *f, const parameters_t *p, const schedule_t *c, const schedule_t *a) {
+  uint32_t n;
+
+  n = p->n;
+  print_header(f, p, c, a);
+
+  fprintf(f, "#include \"ntt_red.h\"\n");
+  fprintf(f, "#include \"ntt_red%"PRIu32".h\"\n", n);
+  fprintf(f, "#include \"ntt_asm.h\"\n");
+  fprintf(f, "#include \"ntt_red_asm%"PRIu32".h\"\n", n);
+  fprintf(f, "#include \"ntt_red%"PRIu32"_lazy.h\"\n\n", n);
+
+  fprintf(f, "void ntt_red%"PRIu32"_lazy_product(int32_t *c, int32_t *a, int32_t *b) {\n", n);
+  print_c_forward(f, n, "a", c->fwd_rounds[0], c->fwd_reductions[0]);
+  print_c_forward(f, n, "b", c->fwd_rounds[1], c->fwd_reductions[1]);
+  fprintf(f, "  mul_reduce_array(c, %"PRIu32", a, b);\n", n);
+  print_reductions(f, n, "c", c->pointwise_reductions, "");
+  if (c->inv_rounds == 0) {
+    fprintf(f, "  inttmul_red%"PRIu32"_gs_rev2std(c);\n", n);
+  } else {
+    fprintf(f, "  nttmul_red_gs_rev2std_lazy(c, %"PRIu32", ntt_red%"PRIu32"_inv_mixed_powers_rev, 0x%"PRIx32");\n",
+	    n, n, c->inv_rounds);
+  }
+  fprintf(f, "  scalar_mul_reduce_finalize(c, %"PRIu32", ntt_red%"PRIu32"_lazy_rescale);\n", n, n);
+  fprintf(f, "}\n\n");
+
+  assert(a->layers == 0);
+  fprintf(f, "void ntt_red%"PRIu32"_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b) {\n", n);
+  print_asm_forward(f, n, "a", a->fwd_reductions[0]);
+  print_asm_forward(f, n, "b", a->fwd_reductions[1]);
+  fprintf(f, "  mul_reduce_array_asm(c, %"PRIu32", a, b);\n", n);
+  print_reductions(f, n, "c", a->pointwise_reductions, "_asm");
+  fprintf(f, "  inttmul_red%"PRIu32"_gs_rev2std_asm(c);\n", n);
+  fprintf(f, "  scalar_mul_reduce_finalize_asm(c, %"PRIu32", ntt_red%"PRIu32"_lazy_asm_rescale);\n", n, n);
+  fprintf(f, "}\n");
+}
+
+
+/*
+ * Open file: name is "ntt_red<size>_lazy.h" or "ntt_red<size>_lazy.c"
+ * - return NULL if we can't create the file
+ */
+#define BUFFER_SIZE 100
+
+static FILE *open_file(uint32_t n, const char *suffix) {
+  char filename[BUFFER_SIZE];
+  int len;
+  FILE *f;
+
+  f = NULL;
+  len = snprintf(filename, BUFFER_SIZE, "ntt_red%"PRIu32"_lazy.%s", n, suffix);
+  if (len < BUFFER_SIZE) {
+    f = fopen(filename, "w");
+  }
+  return f;
+}
+
+int main(int argc, char *argv[]) {
+  parameters_t params;
+  schedule_t c_schedule, asm_schedule;
+  long x;
+  FILE *f;
+
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <size>\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  x = atol(argv[1]);
+  switch (x) {
+  case 16:
+    params.inv_n = ntt_red16_inv_n;
+    params.inv_k = ntt_red16_inv_k;
+    params.fwd = ntt_red16_mixed_powers_rev;
+    params.inv = ntt_red16_inv_mixed_powers_rev;
+    break;
+
+  case 256:
+    params.inv_n = ntt_red256_inv_n;
+    params.inv_k = ntt_red256_inv_k;
+    params.fwd = ntt_red256_mixed_powers_rev;
+    params.inv = ntt_red256_inv_mixed_powers_rev;
+    break;
+
+  case 512:
+    params.inv_n = ntt_red512_inv_n;
+    params.inv_k = ntt_red512_inv_k;
+    params.fwd = ntt_red512_mixed_powers_rev;
+    params.inv = ntt_red512_inv_mixed_powers_rev;
+    break;
+
+  case 1024:
+    params.inv_n = ntt_red1024_inv_n;
+    params.inv_k = ntt_red1024_inv_k;
+    params.fwd = ntt_red1024_mixed_powers_rev;
+    params.inv = ntt_red1024_inv_mixed_powers_rev;
+    break;
+
+  default:
+    fprintf(stderr, "Invalid size %ld: must be 16, 256, 512, or 1024\n", x);
+    exit(EXIT_FAILURE);
+  }
+  params.n = (uint32_t) x;
+
+  if (!best_schedule(&params, &c_schedule, true)) {
+    fprintf(stderr, "No safe schedule for n = %"PRIu32"\n", params.n);
+    exit(EXIT_FAILURE);
+  }
+  if (!best_schedule(&params, &asm_schedule, false)) {
+    fprintf(stderr, "No safe schedule for n = %"PRIu32" without reductions in the NTT rounds\n", params.n);
+    exit(EXIT_FAILURE);
+  }
+
+  f = open_file(params.n, "h");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_lazy.h'\n", params.n);
+    exit(EXIT_FAILURE);
+  }
+  print_declarations(f, &params, &c_schedule, &asm_schedule);
+  fclose(f);
+
+  f = open_file(params.n, "c");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_lazy.c'\n", params.n);
+    exit(EXIT_FAILURE);
+  }
+  print_products(f, &params, &c_schedule, &asm_schedule);
+  fclose(f);
+
+  return 0;
+}
@@ -0,0 +1,536 @@
+/*
+ * Build tables and lazy-reduction schedules for the multi-modulus
+ * Longa-Naehrig backend (ntt_ln.h)
+ *
+ * Input: q, n, and psi such that
+ * - q = k * 2^m + 1 is prime with k odd
+ * - n is a power of two and psi^n = -1 modulo q
+ *
+ * Output: files ntt_ln<q>_tables.h and ntt_ln<q>_tables.c
+ *
+ * The schedule is computed as in make_lazy_schedule, using the bounds
+ * of red_bounds.c for this q: the rounds of the NTTs that must be
+ * reduced, the number of reductions after each stage, and the number
+ * of reductions needed before the final correction. The AVX2 and C
+ * versions use the same schedule.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "red_bounds.h"
+
+typedef struct parameters_s {
+  uint32_t q;        // modulus
+  uint32_t k;        // q is (k * 2^m + 1)
+  uint32_t m;
+  uint32_t inv_k;    // inverse of k modulo q
+  uint32_t n;        // size
+  uint32_t inv_n;    // inverse of n
+  uint32_t psi;      // psi^n = -1
+  uint32_t phi;      // psi^2: primitive n-th root of 1
+  uint32_t inv_psi;  // inverse of psi
+  uint32_t inv_phi;  // inverse of phi
+  int32_t *fwd;      // table for the forward NTT (mixed_powers_rev)
+  int32_t *inv;      // table for the inverse NTT (inv_mixed_powers_rev)
+  red_param_t red;   // parameters for red_bounds
+} parameters_t;
+
+/*
+ * Schedule: same as in make_lazy_schedule +
+ * - final_reductions = number of reductions between the final
+ *   rescaling and the correction
+ */
+typedef struct schedule_s {
+  uint32_t fwd_rounds[2];
+  uint32_t fwd_reductions[2];
+  uint32_t pointwise_reductions;
+  uint32_t inv_rounds;
+  uint32_t final_reductions;
+  uint32_t reductions;
+  uint32_t layers;
+  int64_t fwd_bound[2];
+  int64_t pointwise_bound;
+  int64_t inv_bound;
+} schedule_t;
+
+
+/*
+ * x^k modulo q (q < 2^31)
+ */
+static uint32_t power(uint32_t x, uint32_t k, uint32_t q) {
+  uint64_t y, z;
+
+  assert(q > 0);
+
+  y = 1;
+  z = x % q;
+  while (k != 0) {
+    if ((k & 1) != 0) {
+      y = (y * z) % q;
+    }
+    k >>= 1;
+    z = (z * z) % q;
+  }
+  return (uint32_t) y;
+}
+
+/*
+ * Inverse of x modulo q (q prime)
+ */
+static uint32_t inverse(uint32_t x, uint32_t q) {
+  assert(x % q != 0);
+  return power(x, q - 2, q);
+}
+
+static uint32_t mulmod(uint32_t x, uint32_t y, uint32_t q) {
+  return (uint32_t) (((uint64_t) x * y) % q);
+}
+
+static bool logtwo(uint32_t n, uint32_t *k) {
+  uint32_t i;
+
+  for (i=0; i<32; i++) {
+    if (n == ((uint32_t) 1 << i)) {
+      *k = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Reverse the k low-order bits of i
+ */
+static uint32_t reverse(uint32_t i, uint32_t k) {
+  uint32_t j;
+
+  j = 0;
+  while (k > 0) {
+    j = (j << 1) | (i & 1);
+    i >>= 1;
+    k --;
+  }
+  return j;
+}
+
+/*
+ * Convert from [0 .. q-1] to [-(q-1)/2, +(q-1)/2]
+ */
+static int32_t shift(uint32_t x, uint32_t q) {
+  assert(x < q);
+  return (x <= q/2) ? (int32_t) x : (int32_t) x - (int32_t) q;
+}
+
+/*
+ * Store  a[t + j] = x^(n/2t) * y^(n/2t)^ bitrev(j) * inverse(k)
+ * for t=1, 2, ..., n/2 and j=0, ..., t-1 (shifted to [-(q-1)/2, (q-1)/2])
+ *
+ * a[0] is unused. It's set to 0.
+ */
+static void build_rev_table(int32_t *a, uint32_t n, uint32_t q, uint32_t x, uint32_t y, uint32_t inv_k) {
+  uint32_t t, j, i, k;
+  uint32_t b, c;
+
+  a[0] = 0;
+  for (t=1, k=0; t<n; t <<= 1, k++) {
+    b = mulmod(power(x, n/(2*t), q), inv_k, q);
+    c = power(y, n/(2*t), q);
+    for (j=0; j<t; j++) {
+      i = t + reverse(j, k);
+      a[i] = shift(b, q);
+      b = mulmod(b, c, q);
+    }
+  }
+}
+
+
+/*
+ * SCHEDULE
+ */
+
+/*
+ * Number of bits set in x
+ */
+static uint32_t popcount(uint32_t x) {
+  uint32_t c;
+
+  c = 0;
+  while (x != 0) {
+    c += x & 1;
+    x >>= 1;
+  }
+  return c;
+}
+
+/*
+ * Bound after r reductions
+ */
+static int64_t reduce_bound(const red_param_t *rp, int64_t b, uint32_t r) {
+  while (r > 0) {
+    b = abs_red_bound_q(rp, b);
+    r --;
+  }
+  return b;
+}
+
+/*
+ * Rescaling constant: inv_k^e * inv_n where e is the number of
+ * reductions, including mul_red in the pointwise product, mul_red in
+ * the final step, and the final reductions.
+ */
+static int32_t rescale_factor(const parameters_t *p, const schedule_t *s) {
+  uint32_t e;
+
+  e = s->reductions + 2 + s->final_reductions;
+  return shift(mulmod(power(p->inv_k, e, p->q), p->inv_n, p->q), p->q);
+}
+
+/*
+ * Check the final step for |a[i]| <= b and rescaling constant c:
+ *   a[i] = correct(red^r(mul_red(a[i], c)))
+ * - the product must not overflow and correct requires its input
+ *   to be in [-q, 2*q-1]
+ */
+static bool check_final_step(const red_param_t *rp, int64_t b, int64_t c, uint32_t r) {
+  int64_t lo, hi, x, m;
+  uint32_t i;
+
+  if (b * (c < 0 ? -c : c) > max_mul_red_q(rp)) return false;
+
+  lo = min_red_mul_q(rp, -b, b, c, &m);
+  hi = max_red_mul_q(rp, -b, b, c, &m);
+  for (i=0; i<r; i++) {
+    x = min_red_q(rp, lo, hi, &m);
+    hi = max_red_q(rp, lo, hi, &m);
+    lo = x;
+  }
+
+  return -rp->q <= lo && hi <= 2*rp->q - 1;
+}
+
+/*
+ * Check a candidate schedule and complete it.
+ * - s->fwd_reductions and s->pointwise_reductions must be set
+ * Return false if the schedule is not safe.
+ */
+static bool check_schedule(const parameters_t *p, schedule_t *s) {
+  uint32_t i, r;
+  int64_t b;
+
+  s->layers = 0;
+  for (i=0; i<2; i++) {
+    b = ntt_ct_lazy_schedule32(&p->red, p->q - 1, p->n, p->fwd, &s->fwd_rounds[i]);
+    if (b < 0) return false;
+    s->layers += popcount(s->fwd_rounds[i]);
+    s->fwd_bound[i] = reduce_bound(&p->red, b, s->fwd_reductions[i]);
+  }
+
+  // pointwise product: mul_red(a[i], b[i])
+  if (s->fwd_bound[0] * s->fwd_bound[1] > max_mul_red_q(&p->red)) return false;
+  b = abs_mul_red_bound_q(&p->red, s->fwd_bound[0], s->fwd_bound[1]);
+  s->pointwise_bound = reduce_bound(&p->red, b, s->pointwise_reductions);
+
+  b = ntt_gs_lazy_schedule32(&p->red, s->pointwise_bound, p->n, p->inv, &s->inv_rounds);
+  if (b < 0) return false;
+  s->layers += popcount(s->inv_rounds);
+  s->inv_bound = b;
+
+  s->reductions = s->fwd_reductions[0] + s->fwd_reductions[1] + s->pointwise_reductions + s->layers;
+
+  // final step: fewest reductions that bring the result into [-q, 2q-1]
+  for (r=0; r<=3; r++) {
+    s->final_reductions = r;
+    if (check_final_step(&p->red, b, rescale_factor(p, s), r)) return true;
+  }
+  return false;
+}
+
+/*
+ * Search for the schedule with fewest reductions
+ * - the two operands are symmetric so we only consider schedules where
+ *   a is reduced at least as many times as b.
+ */
+static bool best_schedule(const parameters_t *p, schedule_t *best) {
+  schedule_t s;
+  uint32_t ra, rb, r2;
+  bool found;
+
+  found = false;
+  for (ra=0; ra<=2; ra++) {
+    for (rb=0; rb<=ra; rb++) {
+      for (r2=0; r2<=2; r2++) {
+	s.fwd_reductions[0] = ra;
+	s.fwd_reductions[1] = rb;
+	s.pointwise_reductions = r2;
+	if (check_schedule(p, &s) &&
+	    (!found ||
+	     s.reductions + s.final_reductions < best->reductions + best->final_reductions ||
+	     (s.reductions + s.final_reductions == best->reductions + best->final_reductions &&
+	      s.layers < best->layers))) {
+	  *best = s;
+	  found = true;
+	}
+      }
+    }
+  }
+
+  return found;
+}
+
+
+/*
+ * OUTPUT
+ */
+
+/*
+ * Print a list of rounds
+ */
+static void print_rounds(FILE *f, uint32_t rounds) {
+  uint32_t k;
+  bool first;
+
+  if (rounds == 0) {
+    fprintf(f, "none");
+    return;
+  }
+  first = true;
+  for (k=1; k<32; k++) {
+    if (rounds & ((uint32_t) 1 << k)) {
+      fprintf(f, first ? "%"PRIu32 : ", %"PRIu32, k);
+      first = false;
+    }
+  }
+}
+
+static void print_header(FILE *f, const parameters_t *p, const schedule_t *s) {
+  fprintf(f, "/*\n");
+  fprintf(f, " * Generated by make_ln_tables: do not edit.\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * Parameters:\n");
+  fprintf(f, " * - q = %"PRIu32" = %"PRIu32" * 2^%"PRIu32" + 1\n", p->q, p->k, p->m);
+  fprintf(f, " * - n = %"PRIu32"\n", p->n);
+  fprintf(f, " * - psi = %"PRIu32"\n", p->psi);
+  fprintf(f, " * - omega = psi^2 = %"PRIu32"\n", p->phi);
+  fprintf(f, " * - inverse of psi = %"PRIu32"\n", p->inv_psi);
+  fprintf(f, " * - inverse of omega = %"PRIu32"\n", p->inv_phi);
+  fprintf(f, " * - inverse of n = %"PRIu32"\n", p->inv_n);
+  fprintf(f, " * - inverse of k = %"PRIu32"\n", p->inv_k);
+  fprintf(f, " *\n");
+  fprintf(f, " * Lazy-reduction schedule (inputs in [0, %"PRIu32"]): %"PRIu32" reductions\n",
+	  p->q - 1, s->reductions + s->final_reductions);
+  fprintf(f, " * - forward NTT of a: reduced rounds = ");
+  print_rounds(f, s->fwd_rounds[0]);
+  fprintf(f, ", then %"PRIu32" reductions: |a[i]| <= %"PRId64"\n", s->fwd_reductions[0], s->fwd_bound[0]);
+  fprintf(f, " * - forward NTT of b: reduced rounds = ");
+  print_rounds(f, s->fwd_rounds[1]);
+  fprintf(f, ", then %"PRIu32" reductions: |b[i]| <= %"PRId64"\n", s->fwd_reductions[1], s->fwd_bound[1]);
+  fprintf(f, " * - pointwise product, then %"PRIu32" reductions: |c[i]| <= %"PRId64"\n",
+	  s->pointwise_reductions, s->pointwise_bound);
+  fprintf(f, " * - inverse NTT: reduced rounds = ");
+  print_rounds(f, s->inv_rounds);
+  fprintf(f, ": |c[i]| <= %"PRId64"\n", s->inv_bound);
+  fprintf(f, " * - final step: rescale, then %"PRIu32" reductions\n", s->final_reductions);
+  fprintf(f, " * - max |z| for mul_red(z) = %"PRId64"\n", max_mul_red_q(&p->red));
+  fprintf(f, " */\n\n");
+}
+
+static void print_table(FILE *f, const parameters_t *p, const char *name, const int32_t *a) {
+  uint32_t i, k;
+
+  k = 0;
+  fprintf(f, "const int32_t ntt_ln%"PRIu32"_%s[%"PRIu32"] = {\n", p->q, name, p->n);
+  for (i=0; i<p->n; i++) {
+    if (k == 0) fprintf(f, "   ");
+    fprintf(f, " %7"PRId32",", a[i]);
+    k ++;
+    if (k == 8) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "};\n\n");
+}
+
+static void print_param_def(FILE *f, uint32_t q, const char *name, uint32_t val) {
+  fprintf(f, "static const uint32_t ntt_ln%"PRIu32"_%s = %"PRIu32";\n", q, name, val);
+}
+
+static void print_rounds_def(FILE *f, uint32_t q, const char *name, uint32_t val) {
+  fprintf(f, "static const uint32_t ntt_ln%"PRIu32"_%s = 0x%"PRIx32";\n", q, name, val);
+}
+
+static void print_declarations(FILE *f, const parameters_t *p, const schedule_t *s) {
+  uint32_t q;
+
+  q = p->q;
+  print_header(f, p, s);
+
+  fprintf(f, "#ifndef __NTT_LN%"PRIu32"_TABLES_H\n", q);
+  fprintf(f, "#define __NTT_LN%"PRIu32"_TABLES_H\n\n", q);
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  fprintf(f, "/*\n * PARAMETERS\n */\n");
+  print_param_def(f, q, "q", q);
+  print_param_def(f, q, "k", p->k);
+  print_param_def(f, q, "m", p->m);
+  print_param_def(f, q, "n", p->n);
+  print_param_def(f, q, "psi", p->psi);
+  print_param_def(f, q, "inv_k", p->inv_k);
+  print_param_def(f, q, "inv_n", p->inv_n);
+  fprintf(f, "\n");
+
+  fprintf(f, "/*\n");
+  fprintf(f, " * SCHEDULE\n");
+  fprintf(f, " * - *_rounds: bit k is set if round k of the NTT is reduced\n");
+  fprintf(f, " * - *_reductions: number of reductions after the stage\n");
+  fprintf(f, " * - rescale: constant for the final step\n");
+  fprintf(f, " */\n");
+  print_rounds_def(f, q, "fwd_a_rounds", s->fwd_rounds[0]);
+  print_param_def(f, q, "fwd_a_reductions", s->fwd_reductions[0]);
+  print_rounds_def(f, q, "fwd_b_rounds", s->fwd_rounds[1]);
+  print_param_def(f, q, "fwd_b_reductions", s->fwd_reductions[1]);
+  print_param_def(f, q, "pointwise_reductions", s->pointwise_reductions);
+  print_rounds_def(f, q, "inv_rounds", s->inv_rounds);
+  print_param_def(f, q, "final_reductions", s->final_reductions);
+  fprintf(f, "static const int32_t ntt_ln%"PRIu32"_rescale = %"PRId32";\n\n", q, rescale_factor(p, s));
+
+  fprintf(f, "/*\n * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev\n */\n");
+  fprintf(f, "extern const int32_t ntt_ln%"PRIu32"_mixed_powers_rev[%"PRIu32"];\n", q, p->n);
+  fprintf(f, "extern const int32_t ntt_ln%"PRIu32"_inv_mixed_powers_rev[%"PRIu32"];\n\n", q, p->n);
+
+  fprintf(f, "#endif /* __NTT_LN%"PRIu32"_TABLES_H */\n", q);
+}
+
+static void print_tables(FILE *f, const parameters_t *p, const schedule_t *s) {
+  print_header(f, p, s);
+  fprintf(f, "#include \"ntt_ln%"PRIu32"_tables.h\"\n\n", p->q);
+  print_table(f, p, "mixed_powers_rev", p->fwd);
+  print_table(f, p, "inv_mixed_powers_rev", p->inv);
+}
+
+
+/*
+ * Open file: name is "ntt_ln<q>_tables.h" or "ntt_ln<q>_tables.c"
+ * - return NULL if we can't create the file
+ */
+#define BUFFER_SIZE 100
+
+static FILE *open_file(uint32_t q, const char *suffix) {
+  char filename[BUFFER_SIZE];
+  int len;
+  FILE *f;
+
+  f = NULL;
+  len = snprintf(filename, BUFFER_SIZE, "ntt_ln%"PRIu32"_tables.%s", q, suffix);
+  if (len < BUFFER_SIZE) {
+    f = fopen(filename, "w");
+  }
+  return f;
+}
+
+int main(int argc, char *argv[]) {
+  parameters_t params;
+  schedule_t schedule;
+  uint32_t q, n, log_n, psi, i;
+  long x;
+  FILE *f;
+
+  if (argc != 4) {
+    fprintf(stderr, "Usage: %s <q> <size> <psi>\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  // q: the reduction needs k * 2^m + 1 with m <= 30
+  x = atol(argv[1]);
+  if (x < 3 || x >= ((long) 1 << 30) || (x & 1) == 0) {
+    fprintf(stderr, "Invalid modulus %ld: must be odd and between 3 and 2^30\n", x);
+    exit(EXIT_FAILURE);
+  }
+  q = (uint32_t) x;
+  for (i=2; i*i <= q; i++) {
+    if (q % i == 0) {
+      fprintf(stderr, "Invalid modulus %"PRIu32": not prime\n", q);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (!red_param_init(&params.red, q)) {
+    fprintf(stderr, "Invalid modulus %"PRIu32"\n", q);
+    exit(EXIT_FAILURE);
+  }
+
+  // size
+  x = atol(argv[2]);
+  if (x <= 1 || x >= 100000) {
+    fprintf(stderr, "Invalid size %ld: must be between 2 and 100000\n", x);
+    exit(EXIT_FAILURE);
+  }
+  n = (uint32_t) x;
+  if (!logtwo(n, &log_n)) {
+    fprintf(stderr, "Invalid size: %"PRIu32" is not a power of two\n", n);
+    exit(EXIT_FAILURE);
+  }
+
+  // psi
+  x = atol(argv[3]);
+  if (x <= 1 || x >= q) {
+    fprintf(stderr, "psi must be between 2 and %"PRIu32"\n", q-1);
+    exit(EXIT_FAILURE);
+  }
+  psi = (uint32_t) x;
+  if (power(psi, n, q) != q-1) {
+    fprintf(stderr, "invalid psi: %"PRIu32" is not an n-th root of -1\n", psi);
+    exit(EXIT_FAILURE);
+  }
+
+  params.q = q;
+  params.k = (uint32_t) params.red.k;
+  params.m = (uint32_t) params.red.m;
+  params.inv_k = inverse(params.k, q);
+  params.n = n;
+  params.inv_n = inverse(n, q);
+  params.psi = psi;
+  params.phi = mulmod(psi, psi, q);
+  params.inv_psi = inverse(psi, q);
+  params.inv_phi = inverse(params.phi, q);
+
+  params.fwd = (int32_t *) malloc(n * sizeof(int32_t));
+  params.inv = (int32_t *) malloc(n * sizeof(int32_t));
+  if (params.fwd == NULL || params.inv == NULL) {
+    fprintf(stderr, "failed to allocate tables of size %"PRIu32"\n", n);
+    exit(EXIT_FAILURE);
+  }
+  build_rev_table(params.fwd, n, q, params.psi, params.phi, params.inv_k);
+  build_rev_table(params.inv, n, q, params.inv_psi, params.inv_phi, params.inv_k);
+
+  if (!best_schedule(&params, &schedule)) {
+    fprintf(stderr, "No safe schedule for q = %"PRIu32" and n = %"PRIu32"\n", q, n);
+    exit(EXIT_FAILURE);
+  }
+
+  f = open_file(q, "h");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt_ln%"PRIu32"_tables.h'\n", q);
+    exit(EXIT_FAILURE);
+  }
+  print_declarations(f, &params, &schedule);
+  fclose(f);
+
+  f = open_file(q, "c");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt_ln%"PRIu32"_tables.c'\n", q);
+    exit(EXIT_FAILURE);
+  }
+  print_tables(f, &params, &schedule);
+  fclose(f);
+
+  free(params.fwd);
+  free(params.inv);
+
+  return 0;
+}
@@ -4,6 +4,13 @@
  * Input: n and psi such that
  * - psi^n = -1 modulo Q
  * - n is a power of two
+ *
+ * With a third argument 'shared', build the compact tables shared by
+ * all sizes up to n (ntt_red_shared_tables.h and ntt_red_shared_tables.c)
+ * instead of ntt_red<n>_tables.h and ntt_red<n>_tables.c.
+ *
+ * With a third argument 'mont', build the tables for the Montgomery
+ * backend (ntt_mont<n>_tables.h and ntt_mont<n>_tables.c).
  */
 
 #include <assert.h>
@@ -11,6 +18,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include <inttypes.h>
 
 typedef struct parameters_s {
@@ -227,6 +235,301 @@ static void build_rev_table(uint32_t *a, uint32_t n, uint32_t q, uint32_t x, uin
   }
 }
 
+/*
+ * RADIX-4 TABLES
+ *
+ * The radix-4 NTTs combine two rounds per pass. They read their
+ * coefficients sequentially. For each pass and each group j, the table
+ * stores the three coefficients (w1, w2, w3) used by the group:
+ * - CT: w1 is used by the two butterflies of the first round,
+ *   w2 and w3 by the two butterflies of the second round.
+ * - GS: w1 and w2 are used by the first round, w3 by the two
+ *   butterflies of the second round.
+ * If log2(n) is odd, the last round is a radix-2 round. It uses one
+ * coefficient per group.
+ *
+ * Each table is a permutation of the radix-2 table p it's built from.
+ * a[0] is unused. It's set to 0.
+ */
+
+/*
+ * For ntt_red_ct_rev2std_r4: p is indexed by t + j
+ * - passes for t=1, 4, 16, ... combine rounds t and 2t
+ */
+static void build_ct_rev2std_r4_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, j, i;
+
+  a[0] = 0;
+  i = 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    for (j=0; j<t; j++) {
+      a[i ++] = p[t + j];
+      a[i ++] = p[2*t + j];
+      a[i ++] = p[3*t + j];
+    }
+  }
+  if (t < n) {
+    assert(2*t == n);
+    for (j=0; j<t; j++) {
+      a[i ++] = p[t + j];
+    }
+  }
+  assert(i == n);
+}
+
+/*
+ * For ntt_red_ct_std2rev_r4: same rounds as above
+ * - in round 2t, group j of round t is split into groups 2j and 2j+1
+ */
+static void build_ct_std2rev_r4_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, j, i;
+
+  a[0] = 0;
+  i = 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    for (j=0; j<t; j++) {
+      a[i ++] = p[t + j];
+      a[i ++] = p[2*t + 2*j];
+      a[i ++] = p[2*t + 2*j + 1];
+    }
+  }
+  if (t < n) {
+    assert(2*t == n);
+    for (j=0; j<t; j++) {
+      a[i ++] = p[t + j];
+    }
+  }
+  assert(i == n);
+}
+
+/*
+ * For ntt_red_gs_std2rev_r4: rounds t = n/2, n/4, ..., 1
+ * - passes for t = n/2, n/8, ... combine rounds t and t/2
+ */
+static void build_gs_std2rev_r4_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, h, j, i;
+
+  a[0] = 0;
+  i = 1;
+  for (t=n/2; t>=2; t >>= 2) {
+    h = t/2;
+    for (j=0; j<h; j++) {
+      a[i ++] = p[t + j];
+      a[i ++] = p[t + h + j];
+      a[i ++] = p[h + j];
+    }
+  }
+  if (t == 1) {
+    a[i ++] = p[1];
+  }
+  assert(i == n);
+}
+
+/*
+ * For ntt_red_gs_rev2std_r4: same rounds as above
+ * - groups 2j and 2j+1 of round t are merged into group j of round t/2
+ */
+static void build_gs_rev2std_r4_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, h, j, i;
+
+  a[0] = 0;
+  i = 1;
+  for (t=n/2; t>=2; t >>= 2) {
+    h = t/2;
+    for (j=0; j<h; j++) {
+      a[i ++] = p[t + 2*j];
+      a[i ++] = p[t + 2*j + 1];
+      a[i ++] = p[h + j];
+    }
+  }
+  if (t == 1) {
+    a[i ++] = p[1];
+  }
+  assert(i == n);
+}
+
+
+/*
+ * CONSTANT-GEOMETRY TABLES
+ *
+ * The constant-geometry NTTs do log2(n) rounds of n/2 butterflies.
+ * Round k uses the coefficients a[k * n/2 + i] for i=0 ... n/2-1
+ * (one per butterfly) so the table has n/2 * log2(n) elements.
+ * Each coefficient is an element of the radix-2 table p.
+ */
+
+/*
+ * For ntt_red_ct_std2rev_cg: round k uses p[t + (i & (t-1))] with t = 2^k
+ */
+static void build_ct_std2rev_cg_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, i, h;
+
+  h = n/2;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      a[i] = p[t + (i & (t-1))];
+    }
+    a += h;
+  }
+}
+
+/*
+ * For ntt_red_gs_std2rev_cg: round k uses p[t + (i >> k)] with t = n/2^(k+1)
+ */
+static void build_gs_std2rev_cg_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, k, i, h;
+
+  h = n/2;
+  for (t=h, k=0; t>0; t >>= 1, k++) {
+    for (i=0; i<h; i++) {
+      a[i] = p[t + (i >> k)];
+    }
+    a += h;
+  }
+}
+
+/*
+ * For ntt_red_ct_rev2std_cg: round k uses p[t + i/(n/2t)] with t = 2^k
+ */
+static void build_ct_rev2std_cg_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, i, h;
+
+  h = n/2;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      a[i] = p[t + i/(h/t)];
+    }
+    a += h;
+  }
+}
+
+/*
+ * For ntt_red_gs_rev2std_cg: round k uses p[t + (i & (t-1))] with t = n/2^(k+1)
+ */
+static void build_gs_rev2std_cg_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t t, i, h;
+
+  h = n/2;
+  for (t=h; t>0; t >>= 1) {
+    for (i=0; i<h; i++) {
+      a[i] = p[t + (i & (t-1))];
+    }
+    a += h;
+  }
+}
+
+
+/*
+ * FOUR-STEP TABLES
+ *
+ * The four-step NTTs view an array of size n = n1 * n2 as an n2 x n1
+ * matrix (after transposition). Row x2 is the column NTT of size n1
+ * of input column x2, in bit-reverse order. Before the row NTTs, element
+ * i of row x2 is multiplied by omega^(x2 * bitrev(i)) (and by psi^x2
+ * for the mixed tables), then reduced.
+ *
+ * Store a[x2 * n1 + i] = x^x2 * y^(x2 * bitrev(i)) * inverse(k)^2
+ * for x2 = 0 ... n2-1 and i = 0 ... n1-1.
+ */
+static void build_4step_table(uint32_t *a, uint32_t n, uint32_t n1, uint32_t q, uint32_t x, uint32_t y, uint32_t inv_k) {
+  uint32_t x2, i, k, n2, b, c;
+
+  k = 0;
+  while ((1u << k) < n1) k ++;
+  n2 = n/n1;
+  b = (inv_k * inv_k) % q;
+  for (x2=0; x2<n2; x2++) {
+    c = power(y, x2, q);
+    for (i=0; i<n1; i++) {
+      a[x2 * n1 + i] = (b * power(c, reverse(i, k), q)) % q;
+    }
+    b = (b * x) % q;
+  }
+}
+
+/*
+ * Number of rows used by the four-step NTTs: n1 = 2^floor(log2(n)/2)
+ */
+static uint32_t four_step_n1(uint32_t log_n) {
+  return 1u << (log_n/2);
+}
+
+
+/*
+ * SIMD layout of a table p for mulntt_red_ct_std2rev_simd_asm
+ * (see ntt_asm.h). The result has ct_simd_size(n) elements.
+ * - a[0 ... b-1] = p[0 ... b-1] with b = max(n/8, 8) (padded with 0)
+ * - then n/16 vectors of 8 elements for each of rounds t = n/8, n/4, n/2:
+ *   [U U U U V V V V], [U U W W V V X X], [U0 U4 U1 U5 U2 U6 U3 U7]
+ */
+static uint32_t ct_simd_size(uint32_t n) {
+  return (n/8 < 8 ? 8 : n/8) + 3 * (n/16) * 8;
+}
+
+static void build_ct_std2rev_simd_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t b, g, i, j;
+  const uint32_t *u;
+
+  assert(n >= 16);
+  b = (n/8 < 8) ? 8 : n/8;
+  for (i=0; i<b; i++) {
+    a[i] = (i < n/8) ? p[i] : 0;
+  }
+  // t = n/8: U = p[n/8 + 2g], V = p[n/8 + 2g + 1]
+  for (g=0; g<n/16; g++) {
+    u = p + n/8 + 2*g;
+    for (j=0; j<8; j++) {
+      a[i ++] = u[j/4];
+    }
+  }
+  // t = n/4: U, V, W, X = p[n/4 + 4g ... n/4 + 4g + 3]
+  for (g=0; g<n/16; g++) {
+    u = p + n/4 + 4*g;
+    a[i ++] = u[0]; a[i ++] = u[0];
+    a[i ++] = u[2]; a[i ++] = u[2];
+    a[i ++] = u[1]; a[i ++] = u[1];
+    a[i ++] = u[3]; a[i ++] = u[3];
+  }
+  // t = n/2: U0 ... U7 = p[n/2 + 8g ... n/2 + 8g + 7]
+  for (g=0; g<n/16; g++) {
+    u = p + n/2 + 8*g;
+    for (j=0; j<4; j++) {
+      a[i ++] = u[j];
+      a[i ++] = u[j + 4];
+    }
+  }
+  assert(i == ct_simd_size(n));
+}
+
+/*
+ * SIMD layout of a table p for nttmul_red_gs_rev2std_simd_asm
+ * (see ntt_asm.h). The result has gs_simd_size(n) elements.
+ * - a[0 ... b-1] = p[0 ... b-1] with b = max(n/4, 8) (padded with 0)
+ * - then n/8 vectors [w0 U w1 U w2 V w3 V] where
+ *   w0 ... w3 = p[n/2 + 4g ... n/2 + 4g + 3] and U, V = p[n/4 + 2g], p[n/4 + 2g + 1]
+ */
+static uint32_t gs_simd_size(uint32_t n) {
+  return (n/4 < 8 ? 8 : n/4) + (n/8) * 8;
+}
+
+static void build_gs_rev2std_simd_table(uint32_t *a, const uint32_t *p, uint32_t n) {
+  uint32_t b, g, i, j;
+
+  assert(n >= 16);
+  b = (n/4 < 8) ? 8 : n/4;
+  for (i=0; i<b; i++) {
+    a[i] = (i < n/4) ? p[i] : 0;
+  }
+  for (g=0; g<n/8; g++) {
+    for (j=0; j<4; j++) {
+      a[i ++] = p[n/2 + 4*g + j];
+      a[i ++] = p[n/4 + 2*g + j/2];
+    }
+  }
+  assert(i == gs_simd_size(n));
+}
+
+
 /*
  * Convert from [0 .. q-1] to [-(q-1)/2, +(q-1)/2]
  */
@@ -237,15 +540,39 @@ static int32_t shift(uint32_t x, uint32_t q) {
 
 
 /*
- * Print table a:
+ * Print table a of the given size:
  * - name = string to use for the array + we add the prefix ntt_red<n>
  */
+static void print_table_size(FILE *f, const char* name, uint32_t *a, uint32_t n, uint32_t size, uint32_t q) {
+  uint32_t i, k;
+
+  k = 0;
+  fprintf(f, "const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"] = {\n", n, name, size);
+  for (i=0; i<size; i++) {
+    if (k == 0) fprintf(f, "   ");
+    fprintf(f, " %5"PRId32",", shift(a[i], q));
+    k ++;
+    if (k == 8) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "};\n\n");
+}
+
+// table of size n
 static void print_table(FILE *f, const char* name, uint32_t *a, uint32_t n, uint32_t q) {
+  print_table_size(f, name, a, n, n, q);
+}
+
+// table of 32bit integers, aligned for vmovdqa
+static void print_simd_table(FILE *f, const char* name, uint32_t *a, uint32_t n, uint32_t size, uint32_t q) {
   uint32_t i, k;
 
   k = 0;
-  fprintf(f, "const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"] = {\n", n, name, n);
-  for (i=0; i<n; i++) {
+  fprintf(f, "const int32_t ntt_red%"PRIu32"_%s[%"PRIu32"] __attribute__ ((aligned(32))) = {\n", n, name, size);
+  for (i=0; i<size; i++) {
     if (k == 0) fprintf(f, "   ");
     fprintf(f, " %5"PRId32",", shift(a[i], q));
     k ++;
@@ -291,12 +618,20 @@ static void print_param_def(FILE *f, const char *name, uint32_t n, uint32_t val)
   fprintf(f, "static const int32_t ntt_red%"PRIu32"_%s = %"PRIu32";\n", n, name, val);
 }
 
+static void print_table_decl_size(FILE *f, const char *name, uint32_t n, uint32_t size) {
+  fprintf(f, "extern const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"];\n", n, name, size);
+}
+
 static void print_table_decl(FILE *f, const char *name, uint32_t n) {
-  fprintf(f, "extern const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"];\n", n, name, n);
+  print_table_decl_size(f, name, n, n);
+}
+
+static void print_simd_table_decl(FILE *f, const char *name, uint32_t n, uint32_t size) {
+  fprintf(f, "extern const int32_t ntt_red%"PRIu32"_%s[%"PRIu32"];\n", n, name, size);
 }
 
 static void print_declarations(FILE *f, parameters_t *p) {
-  uint32_t n;
+  uint32_t n, m;
 
   print_header(f, p);
   n = p->n;
@@ -334,6 +669,52 @@ static void print_declarations(FILE *f, parameters_t *p) {
   print_table_decl(f, "inv_mixed_powers_rev", n);
   fprintf(f, "\n");
 
+  print_comment(f, "TABLES FOR RADIX-4 NTT COMPUTATION");
+  print_table_decl(f, "omega_powers_ct_r4", n);
+  print_table_decl(f, "omega_powers_rev_ct_r4", n);
+  print_table_decl(f, "omega_powers_gs_r4", n);
+  print_table_decl(f, "omega_powers_rev_gs_r4", n);
+  print_table_decl(f, "inv_omega_powers_ct_r4", n);
+  print_table_decl(f, "inv_omega_powers_rev_ct_r4", n);
+  print_table_decl(f, "inv_omega_powers_gs_r4", n);
+  print_table_decl(f, "inv_omega_powers_rev_gs_r4", n);
+  print_table_decl(f, "mixed_powers_ct_r4", n);
+  print_table_decl(f, "mixed_powers_rev_ct_r4", n);
+  print_table_decl(f, "inv_mixed_powers_gs_r4", n);
+  print_table_decl(f, "inv_mixed_powers_rev_gs_r4", n);
+  fprintf(f, "\n");
+
+  m = (n/2) * p->log_n;
+  print_comment(f, "TABLES FOR CONSTANT-GEOMETRY NTT COMPUTATION");
+  print_table_decl_size(f, "omega_powers_ct_cg", n, m);
+  print_table_decl_size(f, "omega_powers_rev_ct_cg", n, m);
+  print_table_decl_size(f, "omega_powers_gs_cg", n, m);
+  print_table_decl_size(f, "omega_powers_rev_gs_cg", n, m);
+  print_table_decl_size(f, "inv_omega_powers_ct_cg", n, m);
+  print_table_decl_size(f, "inv_omega_powers_rev_ct_cg", n, m);
+  print_table_decl_size(f, "inv_omega_powers_gs_cg", n, m);
+  print_table_decl_size(f, "inv_omega_powers_rev_gs_cg", n, m);
+  print_table_decl_size(f, "mixed_powers_ct_cg", n, m);
+  print_table_decl_size(f, "mixed_powers_rev_ct_cg", n, m);
+  print_table_decl_size(f, "inv_mixed_powers_gs_cg", n, m);
+  print_table_decl_size(f, "inv_mixed_powers_rev_gs_cg", n, m);
+  fprintf(f, "\n");
+
+  print_comment(f, "TABLES FOR FOUR-STEP NTT COMPUTATION");
+  print_param_def(f, "n1_4step", n, four_step_n1(p->log_n));
+  print_table_decl(f, "twiddles_4step", n);
+  print_table_decl(f, "inv_twiddles_4step", n);
+  print_table_decl(f, "mixed_twiddles_4step", n);
+  print_table_decl(f, "inv_mixed_twiddles_4step", n);
+  fprintf(f, "\n");
+
+  if (n >= 16) {
+    print_comment(f, "TABLES IN SIMD LAYOUT (32bit, aligned)");
+    print_simd_table_decl(f, "mixed_powers_rev_simd", n, ct_simd_size(n));
+    print_simd_table_decl(f, "inv_mixed_powers_rev_simd", n, gs_simd_size(n));
+    fprintf(f, "\n");
+  }
+
   fprintf(f, "#endif /* __NTT_RED%"PRIu32"_TABLES_H */\n", n);
 }
 
@@ -341,15 +722,18 @@ static void print_declarations(FILE *f, parameters_t *p) {
  * Print table definitions in file f
  */
 static void print_tables(FILE *f, parameters_t *p) {
-  uint32_t *table;
-  uint32_t n, q, s;
+  uint32_t *table, *table4, *table_cg, *simd;
+  uint32_t n, q, s, m;
 
   n = p->n;
   q = p->q;
+  m = (n/2) * p->log_n;
 
-  // allocate the table
+  // allocate the tables
   table = (uint32_t *) malloc(n * sizeof(uint32_t));
-  if (table == NULL) {
+  table4 = (uint32_t *) malloc(n * sizeof(uint32_t));
+  table_cg = (uint32_t *) malloc(m * sizeof(uint32_t));
+  if (table == NULL || table4 == NULL || table_cg == NULL) {
     fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", n);
     exit(EXIT_FAILURE);
   }
@@ -394,6 +778,402 @@ static void print_tables(FILE *f, parameters_t *p) {
   build_rev_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
   print_table(f, "inv_mixed_powers_rev", table, n, q);
 
+  // radix-4 NTT tables
+  build_table(table, n, q, 1, p->phi, p->inv_k);
+  build_ct_rev2std_r4_table(table4, table, n);
+  print_table(f, "omega_powers_ct_r4", table4, n, q);
+  build_gs_std2rev_r4_table(table4, table, n);
+  print_table(f, "omega_powers_gs_r4", table4, n, q);
+  build_rev_table(table, n, q, 1, p->phi, p->inv_k);
+  build_ct_std2rev_r4_table(table4, table, n);
+  print_table(f, "omega_powers_rev_ct_r4", table4, n, q);
+  build_gs_rev2std_r4_table(table4, table, n);
+  print_table(f, "omega_powers_rev_gs_r4", table4, n, q);
+  build_table(table, n, q, 1, p->inv_phi, p->inv_k);
+  build_ct_rev2std_r4_table(table4, table, n);
+  print_table(f, "inv_omega_powers_ct_r4", table4, n, q);
+  build_gs_std2rev_r4_table(table4, table, n);
+  print_table(f, "inv_omega_powers_gs_r4", table4, n, q);
+  build_rev_table(table, n, q, 1, p->inv_phi, p->inv_k);
+  build_ct_std2rev_r4_table(table4, table, n);
+  print_table(f, "inv_omega_powers_rev_ct_r4", table4, n, q);
+  build_gs_rev2std_r4_table(table4, table, n);
+  print_table(f, "inv_omega_powers_rev_gs_r4", table4, n, q);
+
+  build_table(table, n, q, p->psi, p->phi, p->inv_k);
+  build_ct_rev2std_r4_table(table4, table, n);
+  print_table(f, "mixed_powers_ct_r4", table4, n, q);
+  build_rev_table(table, n, q, p->psi, p->phi, p->inv_k);
+  build_ct_std2rev_r4_table(table4, table, n);
+  print_table(f, "mixed_powers_rev_ct_r4", table4, n, q);
+  build_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+  build_gs_std2rev_r4_table(table4, table, n);
+  print_table(f, "inv_mixed_powers_gs_r4", table4, n, q);
+  build_rev_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+  build_gs_rev2std_r4_table(table4, table, n);
+  print_table(f, "inv_mixed_powers_rev_gs_r4", table4, n, q);
+
+  // constant-geometry NTT tables
+  build_table(table, n, q, 1, p->phi, p->inv_k);
+  build_ct_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "omega_powers_ct_cg", table_cg, n, m, q);
+  build_gs_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "omega_powers_gs_cg", table_cg, n, m, q);
+  build_rev_table(table, n, q, 1, p->phi, p->inv_k);
+  build_ct_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "omega_powers_rev_ct_cg", table_cg, n, m, q);
+  build_gs_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "omega_powers_rev_gs_cg", table_cg, n, m, q);
+  build_table(table, n, q, 1, p->inv_phi, p->inv_k);
+  build_ct_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_omega_powers_ct_cg", table_cg, n, m, q);
+  build_gs_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_omega_powers_gs_cg", table_cg, n, m, q);
+  build_rev_table(table, n, q, 1, p->inv_phi, p->inv_k);
+  build_ct_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_omega_powers_rev_ct_cg", table_cg, n, m, q);
+  build_gs_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_omega_powers_rev_gs_cg", table_cg, n, m, q);
+
+  build_table(table, n, q, p->psi, p->phi, p->inv_k);
+  build_ct_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "mixed_powers_ct_cg", table_cg, n, m, q);
+  build_rev_table(table, n, q, p->psi, p->phi, p->inv_k);
+  build_ct_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "mixed_powers_rev_ct_cg", table_cg, n, m, q);
+  build_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+  build_gs_std2rev_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_mixed_powers_gs_cg", table_cg, n, m, q);
+  build_rev_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+  build_gs_rev2std_cg_table(table_cg, table, n);
+  print_table_size(f, "inv_mixed_powers_rev_gs_cg", table_cg, n, m, q);
+
+  // four-step NTT tables
+  s = four_step_n1(p->log_n);
+  build_4step_table(table, n, s, q, 1, p->phi, p->inv_k);
+  print_table(f, "twiddles_4step", table, n, q);
+  build_4step_table(table, n, s, q, 1, p->inv_phi, p->inv_k);
+  print_table(f, "inv_twiddles_4step", table, n, q);
+  build_4step_table(table, n, s, q, p->psi, p->phi, p->inv_k);
+  print_table(f, "mixed_twiddles_4step", table, n, q);
+  build_4step_table(table, n, s, q, p->inv_psi, p->inv_phi, p->inv_k);
+  print_table(f, "inv_mixed_twiddles_4step", table, n, q);
+
+  // SIMD layouts of mixed_powers_rev and inv_mixed_powers_rev
+  if (n >= 16) {
+    simd = (uint32_t *) malloc(ct_simd_size(n) * sizeof(uint32_t));
+    if (simd == NULL) {
+      fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", ct_simd_size(n));
+      exit(EXIT_FAILURE);
+    }
+    build_rev_table(table, n, q, p->psi, p->phi, p->inv_k);
+    build_ct_std2rev_simd_table(simd, table, n);
+    print_simd_table(f, "mixed_powers_rev_simd", simd, n, ct_simd_size(n), q);
+    build_rev_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+    build_gs_rev2std_simd_table(simd, table, n);
+    print_simd_table(f, "inv_mixed_powers_rev_simd", simd, n, gs_simd_size(n), q);
+    free(simd);
+  }
+
+  free(table);
+  free(table4);
+  free(table_cg);
+}
+
+/*
+ * SHARED TABLES
+ *
+ * In the bit-reversed tables, entry a[t + j] depends only on t and j:
+ *   a[t + j] = psi^(n/2t) * omega^(n/2t * bitrev(j)) * inverse(k)
+ * where psi^(n/2t) is a primitive 4t-th root of unity. If the root for
+ * size m < n is psi^(n/m), the table for size m is then the prefix
+ * a[0 ... m-1] of the table for size n. So the four tables used by the
+ * products (omega_powers_rev, inv_omega_powers_rev, mixed_powers_rev,
+ * inv_mixed_powers_rev) built for the largest n serve all sizes.
+ *
+ * The only size-dependent constant used by the products is rescale8.
+ * The shared file has it for all n = 2^i (as an array indexed by i).
+ */
+static void print_shared_table(FILE *f, const char *name, uint32_t *a, uint32_t n, uint32_t q) {
+  uint32_t i, k;
+
+  k = 0;
+  fprintf(f, "const int16_t ntt_red_shared_%s[%"PRIu32"] = {\n", name, n);
+  for (i=0; i<n; i++) {
+    if (k == 0) fprintf(f, "   ");
+    fprintf(f, " %5"PRId32",", shift(a[i], q));
+    k ++;
+    if (k == 8) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "};\n\n");
+}
+
+static void print_shared_declarations(FILE *f, parameters_t *p) {
+  uint32_t n;
+
+  print_header(f, p);
+  n = p->n;
+
+  fprintf(f, "#ifndef __NTT_RED_SHARED_TABLES_H\n");
+  fprintf(f, "#define __NTT_RED_SHARED_TABLES_H\n\n");
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  print_comment(f, "PARAMETERS: the root for size m <= max_n is psi^(max_n/m)");
+  fprintf(f, "static const int32_t ntt_red_shared_max_n = %"PRIu32";\n", n);
+  fprintf(f, "static const int32_t ntt_red_shared_log_max_n = %"PRIu32";\n", p->log_n);
+  fprintf(f, "static const int32_t ntt_red_shared_psi = %"PRIu32";\n", p->psi);
+  fprintf(f, "static const int32_t ntt_red_shared_omega = %"PRIu32";\n", p->phi);
+  fprintf(f, "static const int32_t ntt_red_shared_inv_psi = %"PRIu32";\n", p->inv_psi);
+  fprintf(f, "static const int32_t ntt_red_shared_inv_omega = %"PRIu32";\n", p->inv_phi);
+  fprintf(f, "static const int32_t ntt_red_shared_inv_k = %"PRIu32";\n", p->inv_k);
+  fprintf(f, "\n");
+
+  print_comment(f, "RESCALING FACTORS: rescale8[i] is for size 2^i");
+  fprintf(f, "extern const int32_t ntt_red_shared_rescale8[%"PRIu32"];\n\n", p->log_n + 1);
+
+  print_comment(f, "TABLES FOR NTT COMPUTATION: size m uses the first m elements");
+  fprintf(f, "extern const int16_t ntt_red_shared_omega_powers_rev[%"PRIu32"];\n", n);
+  fprintf(f, "extern const int16_t ntt_red_shared_inv_omega_powers_rev[%"PRIu32"];\n", n);
+  fprintf(f, "extern const int16_t ntt_red_shared_mixed_powers_rev[%"PRIu32"];\n", n);
+  fprintf(f, "extern const int16_t ntt_red_shared_inv_mixed_powers_rev[%"PRIu32"];\n", n);
+  fprintf(f, "\n");
+
+  fprintf(f, "#endif /* __NTT_RED_SHARED_TABLES_H */\n");
+}
+
+static void print_shared_tables(FILE *f, parameters_t *p) {
+  uint32_t *table;
+  uint32_t n, q, i, inv_m;
+
+  n = p->n;
+  q = p->q;
+
+  table = (uint32_t *) malloc(n * sizeof(uint32_t));
+  if (table == NULL) {
+    fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", n);
+    exit(EXIT_FAILURE);
+  }
+
+  print_header(f, p);
+
+  fprintf(f, "#include \"ntt_red_shared_tables.h\"\n\n");
+
+  fprintf(f, "const int32_t ntt_red_shared_rescale8[%"PRIu32"] = {\n", p->log_n + 1);
+  for (i=0; i<=p->log_n; i++) {
+    if (!inverse(1u << i, q, &inv_m)) {
+      fprintf(stderr, "BUG: failed to compute the inverse of %"PRIu32" modulo %"PRIu32"\n", 1u << i, q);
+      exit(EXIT_FAILURE);
+    }
+    fprintf(f, "    %5"PRIu32", // n = %"PRIu32"\n", rescale_factor8(inv_m, p->inv_k, q), 1u << i);
+  }
+  fprintf(f, "};\n\n");
+
+  build_rev_table(table, n, q, 1, p->phi, p->inv_k);
+  print_shared_table(f, "omega_powers_rev", table, n, q);
+  build_rev_table(table, n, q, 1, p->inv_phi, p->inv_k);
+  print_shared_table(f, "inv_omega_powers_rev", table, n, q);
+  build_rev_table(table, n, q, p->psi, p->phi, p->inv_k);
+  print_shared_table(f, "mixed_powers_rev", table, n, q);
+  build_rev_table(table, n, q, p->inv_psi, p->inv_phi, p->inv_k);
+  print_shared_table(f, "inv_mixed_powers_rev", table, n, q);
+
+  free(table);
+}
+
+/*
+ * MONTGOMERY TABLES
+ *
+ * The Montgomery backend (ntt_mont.h) multiplies by a constant w using
+ *   mul_montc(x, w, w') = (x * w - Q * ((x * w') mod 2^16))/2^16
+ * where w' = w * Q^-1 mod 2^16. This computes x * w * 2^-16 modulo Q
+ * so all constants are stored in Montgomery form: w = c * 2^16 mod Q.
+ * There's no scaling by inverse(k) and the products need no extra
+ * fix-up pass:
+ * - twiddle factors and powers of psi are pre-multiplied by 2^16,
+ * - the pointwise product mul_mont(a, b) = a * b * 2^-16 is compensated
+ *   by one more factor 2^16 in the final scaling constants.
+ *
+ * Each table has 2n entries:
+ * - the first n entries are the constants c * 2^16 mod Q, in [-(Q-1)/2, (Q-1)/2]
+ * - entry n+i is the Montgomery companion of entry i
+ */
+
+/*
+ * Montgomery factor: 2^16 modulo q
+ */
+static uint32_t montgomery_factor(uint32_t q) {
+  return ((uint32_t) 1 << 16) % q;
+}
+
+/*
+ * Inverse of q modulo 2^16, as a signed 16-bit integer
+ */
+static int32_t inverse_mod_2_16(uint32_t q) {
+  uint32_t x;
+  uint32_t i;
+
+  // Newton iteration: each step doubles the number of correct bits
+  x = q;
+  for (i=0; i<4; i++) {
+    x = (x * (2 - q * x)) & 0xFFFF;
+  }
+  assert(((x * q) & 0xFFFF) == 1);
+  return (x >= 0x8000) ? (int32_t) x - 0x10000 : (int32_t) x;
+}
+
+/*
+ * Montgomery companion of w: w * q^-1 mod 2^16 (signed)
+ */
+static int32_t montgomery_companion(int32_t w, uint32_t q) {
+  uint32_t x;
+
+  x = ((uint32_t) w * (uint32_t) inverse_mod_2_16(q)) & 0xFFFF;
+  return (x >= 0x8000) ? (int32_t) x - 0x10000 : (int32_t) x;
+}
+
+/*
+ * Factor for final scaling: inv_n * 2^16 in Montgomery form
+ * (i.e., inv_n * 2^32 modulo q)
+ */
+static uint32_t mont_rescale_factor(uint32_t inv_n, uint32_t q) {
+  uint32_t r;
+
+  r = montgomery_factor(q);
+  return (((inv_n * r) % q) * r) % q;
+}
+
+static void print_mont_table(FILE *f, const char *name, uint32_t *a, uint32_t n, uint32_t q) {
+  uint32_t i, k;
+  int32_t w;
+
+  k = 0;
+  fprintf(f, "const int16_t ntt_mont%"PRIu32"_%s[%"PRIu32"] = {\n", n, name, 2 * n);
+  for (i=0; i<n; i++) {
+    if (k == 0) fprintf(f, "   ");
+    fprintf(f, " %5"PRId32",", shift(a[i], q));
+    k ++;
+    if (k == 8) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "    // Montgomery companions\n");
+  k = 0;
+  for (i=0; i<n; i++) {
+    if (k == 0) fprintf(f, "   ");
+    w = montgomery_companion(shift(a[i], q), q);
+    fprintf(f, " %6"PRId32",", w);
+    k ++;
+    if (k == 8) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "};\n\n");
+}
+
+static void print_mont_param_def(FILE *f, const char *name, uint32_t n, int32_t val) {
+  fprintf(f, "static const int16_t ntt_mont%"PRIu32"_%s = %"PRId32";\n", n, name, val);
+}
+
+static void print_mont_table_decl(FILE *f, const char *name, uint32_t n) {
+  fprintf(f, "extern const int16_t ntt_mont%"PRIu32"_%s[%"PRIu32"];\n", n, name, 2 * n);
+}
+
+static void print_mont_declarations(FILE *f, parameters_t *p) {
+  uint32_t n;
+  int32_t s;
+
+  print_header(f, p);
+  n = p->n;
+
+  fprintf(f, "#ifndef __NTT_MONT%"PRIu32"_TABLES_H\n", n);
+  fprintf(f, "#define __NTT_MONT%"PRIu32"_TABLES_H\n\n", n);
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  print_comment(f, "PARAMETERS");
+  print_mont_param_def(f, "psi", n, shift(p->psi, p->q));
+  print_mont_param_def(f, "omega", n, shift(p->phi, p->q));
+  print_mont_param_def(f, "inv_psi", n, shift(p->inv_psi, p->q));
+  print_mont_param_def(f, "inv_omega", n, shift(p->inv_phi, p->q));
+  print_mont_param_def(f, "inv_n", n, shift(p->inv_n, p->q));
+  s = shift(mont_rescale_factor(p->inv_n, p->q), p->q);
+  print_mont_param_def(f, "rescale", n, s);
+  print_mont_param_def(f, "rescale_mont", n, montgomery_companion(s, p->q));
+  print_mont_param_def(f, "qinv", n, inverse_mod_2_16(p->q));
+  fprintf(f, "\n");
+
+  print_comment(f, "POWERS OF PSI (MONTGOMERY FORM)");
+  print_mont_table_decl(f, "psi_powers", n);
+  print_mont_table_decl(f, "scaled_inv_psi_powers", n);
+  fprintf(f, "\n");
+
+  print_comment(f, "TABLES FOR NTT COMPUTATION (MONTGOMERY FORM)");
+  print_mont_table_decl(f, "omega_powers", n);
+  print_mont_table_decl(f, "omega_powers_rev", n);
+  print_mont_table_decl(f, "inv_omega_powers", n);
+  print_mont_table_decl(f, "inv_omega_powers_rev", n);
+  print_mont_table_decl(f, "mixed_powers", n);
+  print_mont_table_decl(f, "mixed_powers_rev", n);
+  print_mont_table_decl(f, "inv_mixed_powers", n);
+  print_mont_table_decl(f, "inv_mixed_powers_rev", n);
+  fprintf(f, "\n");
+
+  fprintf(f, "#endif /* __NTT_MONT%"PRIu32"_TABLES_H */\n", n);
+}
+
+static void print_mont_tables(FILE *f, parameters_t *p) {
+  uint32_t *table;
+  uint32_t n, q, r, s;
+
+  n = p->n;
+  q = p->q;
+  r = montgomery_factor(q);
+
+  table = (uint32_t *) malloc(n * sizeof(uint32_t));
+  if (table == NULL) {
+    fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", n);
+    exit(EXIT_FAILURE);
+  }
+
+  print_header(f, p);
+
+  fprintf(f, "#include \"ntt_mont%"PRIu32"_tables.h\"\n\n", n);
+
+  // powers of psi * 2^16
+  build_power_table(table, n, q, r, p->psi);
+  print_mont_table(f, "psi_powers", table, n, q);
+
+  // powers of inv_psi * inverse(n) * 2^32
+  s = mont_rescale_factor(p->inv_n, q);
+  build_power_table(table, n, q, s, p->inv_psi);
+  print_mont_table(f, "scaled_inv_psi_powers", table, n, q);
+
+  // NTT tables: the last argument of build_table is a scaling factor
+  build_table(table, n, q, 1, p->phi, r);
+  print_mont_table(f, "omega_powers", table, n, q);
+  build_rev_table(table, n, q, 1, p->phi, r);
+  print_mont_table(f, "omega_powers_rev", table, n, q);
+  build_table(table, n, q, 1, p->inv_phi, r);
+  print_mont_table(f, "inv_omega_powers", table, n, q);
+  build_rev_table(table, n, q, 1, p->inv_phi, r);
+  print_mont_table(f, "inv_omega_powers_rev", table, n, q);
+
+  build_table(table, n, q, p->psi, p->phi, r);
+  print_mont_table(f, "mixed_powers", table, n, q);
+  build_rev_table(table, n, q, p->psi, p->phi, r);
+  print_mont_table(f, "mixed_powers_rev", table, n, q);
+  build_table(table, n, q, p->inv_psi, p->inv_phi, r);
+  print_mont_table(f, "inv_mixed_powers", table, n, q);
+  build_rev_table(table, n, q, p->inv_psi, p->inv_phi, r);
+  print_mont_table(f, "inv_mixed_powers_rev", table, n, q);
+
   free(table);
 }
 
@@ -403,13 +1183,19 @@ static void print_tables(FILE *f, parameters_t *p) {
  */
 #define BUFFER_SIZE 100
 
-static FILE *open_file(uint32_t n, const char *suffix) {
+static FILE *open_file(uint32_t n, bool shared, bool mont, const char *suffix) {
   char filename[BUFFER_SIZE];
   int len;
   FILE *f;
 
   f = NULL;
-  len = snprintf(filename, BUFFER_SIZE, "ntt_red%"PRIu32"_tables.%s", n, suffix);
+  if (shared) {
+    len = snprintf(filename, BUFFER_SIZE, "ntt_red_shared_tables.%s", suffix);
+  } else if (mont) {
+    len = snprintf(filename, BUFFER_SIZE, "ntt_mont%"PRIu32"_tables.%s", n, suffix);
+  } else {
+    len = snprintf(filename, BUFFER_SIZE, "ntt_red%"PRIu32"_tables.%s", n, suffix);
+  }
   if (len < BUFFER_SIZE) {
     f = fopen(filename, "w");
   }
@@ -420,10 +1206,13 @@ int main(int argc, char *argv[]) {
   uint32_t q, k, inv_k, psi, phi, n, log_n, i, inv_n, inv_psi, inv_phi;
   long x;
   parameters_t params;
+  bool shared, mont;
   FILE *f;
 
-  if (argc != 3) {
-    fprintf(stderr, "Usage: %s <size> <psi>\n", argv[0]);
+  shared = (argc == 4 && strcmp(argv[3], "shared") == 0);
+  mont = (argc == 4 && strcmp(argv[3], "mont") == 0);
+  if (argc != 3 && !shared && !mont) {
+    fprintf(stderr, "Usage: %s <size> <psi> [shared|mont]\n", argv[0]);
     exit(EXIT_FAILURE);
   }
   q = 12289;
@@ -494,20 +1283,32 @@ int main(int argc, char *argv[]) {
   params.inv_psi = inv_psi;
   params.inv_phi = inv_phi;
 
-  f = open_file(n, "h");
+  f = open_file(n, shared, mont, "h");
   if (f == NULL) {
-    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_tables.h'\n", n);
+    fprintf(stderr, "failed to open the header file\n");
     exit(EXIT_FAILURE);
   }
-  print_declarations(f, &params);
+  if (shared) {
+    print_shared_declarations(f, &params);
+  } else if (mont) {
+    print_mont_declarations(f, &params);
+  } else {
+    print_declarations(f, &params);
+  }
   fclose(f);
 
-  f = open_file(n, "c");
+  f = open_file(n, shared, mont, "c");
   if (f == NULL) {
-    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_tables.h'\n", n);
+    fprintf(stderr, "failed to open the source file\n");
     exit(EXIT_FAILURE);
   }
-  print_tables(f, &params);
+  if (shared) {
+    print_shared_tables(f, &params);
+  } else if (mont) {
+    print_mont_tables(f, &params);
+  } else {
+    print_tables(f, &params);
+  }
   fclose(f);
   
   return 0;
@@ -0,0 +1,619 @@
+/*
+ * Build tables for the 64bit backend (ntt64.h)
+ *
+ * Input: bits and n
+ * - n is a power of two
+ * - 2n + 1 < 2^bits and bits <= 62
+ *
+ * The modulus q is the largest prime less than 2^bits such that
+ * q = 1 modulo 2n. psi is x^((q-1)/2n) for the smallest x = 2, 3, ...
+ * such that psi^n = -1 modulo q.
+ *
+ * Output: files ntt64_<n>_tables.h and ntt64_<n>_tables.c
+ *
+ * Each table has 2n entries: p[i] is a power of psi or omega (as in
+ * make_tables) and p[n + i] = floor(p[i] * 2^64 / q) is its Shoup
+ * quotient.
+ *
+ * With a third argument '4step', only the tables for the four-step
+ * NTTs (ntt64_ct_std2rev_4step and ntt64_gs_rev2std_4step) are built.
+ * This is meant for large n where the full tables are not needed.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+typedef unsigned __int128 uint128_t;
+
+typedef struct parameters_s {
+  uint64_t q;          // modulus
+  uint32_t bits;       // q < 2^bits
+  uint32_t n;          // size
+  uint64_t inv_n;      // inverse of n
+  uint64_t psi;        // psi^n = -1
+  uint64_t phi;        // psi^2: primitive n-th root of 1
+  uint64_t inv_psi;    // inverse of psi
+  uint64_t inv_phi;    // inverse of phi
+  uint64_t qinv;       // inverse of q modulo 2^64
+  uint64_t rescale;    // inv_n * 2^64 modulo q
+  uint32_t n1;         // rows of the four-step NTTs (0 if not used)
+} parameters_t;
+
+
+/*
+ * x * y modulo q
+ */
+static uint64_t mulmod(uint64_t x, uint64_t y, uint64_t q) {
+  return (uint64_t) (((uint128_t) x * y) % q);
+}
+
+/*
+ * x^k modulo q
+ */
+static uint64_t power(uint64_t x, uint64_t k, uint64_t q) {
+  uint64_t y;
+
+  assert(q > 0);
+
+  y = 1;
+  x %= q;
+  while (k != 0) {
+    if ((k & 1) != 0) {
+      y = mulmod(y, x, q);
+    }
+    k >>= 1;
+    x = mulmod(x, x, q);
+  }
+  return y;
+}
+
+/*
+ * Inverse of x modulo q (q prime)
+ */
+static uint64_t inverse(uint64_t x, uint64_t q) {
+  assert(x % q != 0);
+  return power(x, q - 2, q);
+}
+
+/*
+ * Shoup quotient: floor(w * 2^64 / q) for w < q
+ */
+static uint64_t shoup(uint64_t w, uint64_t q) {
+  assert(w < q);
+  return (uint64_t) (((uint128_t) w << 64) / q);
+}
+
+/*
+ * Inverse of odd q modulo 2^64 (Newton iteration)
+ */
+static uint64_t inverse_pow64(uint64_t q) {
+  uint64_t x;
+  uint32_t i;
+
+  assert((q & 1) == 1);
+  x = q; // correct modulo 2^3
+  for (i=0; i<5; i++) {
+    x *= 2 - q * x;
+  }
+  assert(q * x == 1);
+  return x;
+}
+
+/*
+ * Miller-Rabin test: the bases 2, 3, ..., 37 are enough for q < 2^64
+ */
+static bool is_prime(uint64_t q) {
+  static const uint64_t base[12] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+  uint64_t d, x;
+  uint32_t i, j, s;
+
+  if (q < 2) return false;
+  for (i=0; i<12; i++) {
+    if (q % base[i] == 0) return q == base[i];
+  }
+
+  d = q - 1;
+  s = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    s ++;
+  }
+  for (i=0; i<12; i++) {
+    x = power(base[i], d, q);
+    if (x == 1 || x == q - 1) continue;
+    for (j=1; j<s; j++) {
+      x = mulmod(x, x, q);
+      if (x == q - 1) break;
+    }
+    if (j == s) return false;
+  }
+  return true;
+}
+
+/*
+ * Largest prime q < 2^bits with q = 1 modulo 2n (0 if there's none)
+ */
+static uint64_t find_prime(uint32_t bits, uint32_t n) {
+  uint64_t q, step;
+
+  step = 2 * (uint64_t) n;
+  q = (((uint64_t) 1 << bits) - 1) / step * step + 1;
+  if (q >= ((uint64_t) 1 << bits)) q -= step;
+  while (q > step) {
+    if (is_prime(q)) return q;
+    q -= step;
+  }
+  return 0;
+}
+
+/*
+ * psi = x^((q-1)/2n) for the smallest x such that psi^n = -1
+ */
+static uint64_t find_psi(uint64_t q, uint32_t n) {
+  uint64_t x, psi;
+
+  for (x=2; x<q; x++) {
+    psi = power(x, (q - 1)/(2 * n), q);
+    if (power(psi, n, q) == q - 1) return psi;
+  }
+  return 0;
+}
+
+static bool logtwo(uint32_t n, uint32_t *k) {
+  uint32_t i;
+
+  for (i=0; i<32; i++) {
+    if (n == ((uint32_t) 1 << i)) {
+      *k = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Reverse the k low-order bits of i
+ */
+static uint32_t reverse(uint32_t i, uint32_t k) {
+  uint32_t j;
+
+  j = 0;
+  while (k > 0) {
+    j = (j << 1) | (i & 1);
+    i >>= 1;
+    k --;
+  }
+  return j;
+}
+
+
+/*
+ * TABLES: a[0 ... n-1] as in make_tables, then a[n + i] = shoup(a[i])
+ */
+static void add_shoup(uint64_t *a, uint32_t n, uint64_t q) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[n + i] = shoup(a[i], q);
+  }
+}
+
+/*
+ * a[i] = x * y^i
+ */
+static void build_power_table(uint64_t *a, uint32_t n, uint64_t q, uint64_t x, uint64_t y) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = x;
+    x = mulmod(x, y, q);
+  }
+  add_shoup(a, n, q);
+}
+
+/*
+ * a[t + j] = x^(n/2t) * y^(n/2t)^j for t=1, 2, ..., n/2 and j=0, ..., t-1
+ * a[0] = 0 (unused)
+ */
+static void build_table(uint64_t *a, uint32_t n, uint64_t q, uint64_t x, uint64_t y) {
+  uint32_t t, j;
+  uint64_t b, c;
+
+  a[0] = 0;
+  for (t=1; t<n; t <<= 1) {
+    b = power(x, n/(2*t), q);
+    c = power(y, n/(2*t), q);
+    for (j=0; j<t; j++) {
+      a[t + j] = b;
+      b = mulmod(b, c, q);
+    }
+  }
+  add_shoup(a, n, q);
+}
+
+/*
+ * a[t + j] = x^(n/2t) * y^(n/2t)^bitrev(j)
+ */
+static void build_rev_table(uint64_t *a, uint32_t n, uint64_t q, uint64_t x, uint64_t y) {
+  uint32_t t, j, k;
+  uint64_t b, c;
+
+  a[0] = 0;
+  for (t=1, k=0; t<n; t <<= 1, k++) {
+    b = power(x, n/(2*t), q);
+    c = power(y, n/(2*t), q);
+    for (j=0; j<t; j++) {
+      a[t + reverse(j, k)] = b;
+      b = mulmod(b, c, q);
+    }
+  }
+  add_shoup(a, n, q);
+}
+
+/*
+ * FOUR-STEP TABLES
+ *
+ * The four-step NTTs see the input as a matrix of n1 rows and n2 columns.
+ * After the column NTTs and transposition, element j of row x2 is the
+ * output of index bitrev(j) of the NTT of column x2. It's multiplied
+ * by psi^(x2 * (2 * bitrev(j) + 1)) before the row NTTs.
+ *
+ * Store a[x2 * n1 + j] = z * x^x2 * y^(x2 * bitrev(j))
+ * for x2 = 0 ... n2-1 and j = 0 ... n1-1.
+ */
+static void build_4step_table(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q, uint64_t x, uint64_t y, uint64_t z) {
+  uint32_t x2, j, k, n2;
+  uint64_t c;
+
+  k = 0;
+  while ((1u << k) < n1) k ++;
+  n2 = n/n1;
+  for (x2=0; x2<n2; x2++) {
+    c = power(y, x2, q);
+    for (j=0; j<n1; j++) {
+      a[x2 * n1 + j] = mulmod(z, power(c, reverse(j, k), q), q);
+    }
+    z = mulmod(z, x, q);
+  }
+  add_shoup(a, n, q);
+}
+
+/*
+ * Number of rows used by the four-step NTTs: n1 = 2^floor(log2(n)/2)
+ */
+static uint32_t four_step_n1(uint32_t log_n) {
+  return 1u << (log_n/2);
+}
+
+
+/*
+ * OUTPUT
+ */
+static void print_header(FILE *f, const parameters_t *p) {
+  fprintf(f,
+	  "/*\n"
+	  " * Generated by make_tables64: do not edit.\n"
+	  " *\n"
+	  " * Parameters:\n"
+	  " * - q = %"PRIu64" (largest prime < 2^%"PRIu32" equal to 1 modulo 2n)\n"
+	  " * - n = %"PRIu32"\n"
+	  " * - psi = %"PRIu64"\n"
+	  " * - omega = psi^2 = %"PRIu64"\n"
+	  " * - inverse of psi = %"PRIu64"\n"
+	  " * - inverse of omega = %"PRIu64"\n"
+	  " * - inverse of n = %"PRIu64"\n"
+	  " *\n"
+	  " * Each table has 2n elements: p[i] for i < n as in make_tables,\n"
+	  " * p[n + i] = floor(p[i] * 2^64 / q).\n"
+	  " */\n\n",
+	  p->q, p->bits, p->n, p->psi, p->phi, p->inv_psi, p->inv_phi, p->inv_n);
+}
+
+static void print_comment(FILE *f, const char *what) {
+  fprintf(f, "/*\n * %s\n */\n", what);
+}
+
+static void print_param_def(FILE *f, uint32_t n, const char *name, uint64_t val) {
+  fprintf(f, "static const uint64_t ntt64_%"PRIu32"_%s = UINT64_C(%"PRIu64");\n", n, name, val);
+}
+
+/*
+ * Table of m powers (2m elements) for size n
+ */
+static void print_table_decl(FILE *f, uint32_t n, const char *name, uint32_t m) {
+  fprintf(f, "extern const uint64_t ntt64_%"PRIu32"_%s[%"PRIu32"];\n", n, name, 2*m);
+}
+
+static void print_table(FILE *f, uint32_t n, const char *name, const uint64_t *a, uint32_t m) {
+  uint32_t i, k;
+
+  k = 0;
+  fprintf(f, "const uint64_t ntt64_%"PRIu32"_%s[%"PRIu32"] = {\n", n, name, 2*m);
+  for (i=0; i<2*m; i++) {
+    if (k == 0) fprintf(f, "   ");
+    fprintf(f, " UINT64_C(%20"PRIu64"),", a[i]);
+    k ++;
+    if (k == 3) {
+      fprintf(f, "\n");
+      k = 0;
+    }
+  }
+  if (k > 0) fprintf(f, "\n");
+  fprintf(f, "};\n\n");
+}
+
+static const char * const table_name[10] = {
+  "psi_powers", "scaled_inv_psi_powers",
+  "omega_powers", "omega_powers_rev", "inv_omega_powers", "inv_omega_powers_rev",
+  "mixed_powers", "mixed_powers_rev", "inv_mixed_powers", "inv_mixed_powers_rev",
+};
+
+static void print_declarations(FILE *f, const parameters_t *p) {
+  uint32_t i, n;
+
+  n = p->n;
+  print_header(f, p);
+  fprintf(f, "#ifndef __NTT64_%"PRIu32"_TABLES_H\n", n);
+  fprintf(f, "#define __NTT64_%"PRIu32"_TABLES_H\n\n", n);
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  print_comment(f, "PARAMETERS\n"
+		" * - qinv = inverse of q modulo 2^64 (for ntt64_mul_array)\n"
+		" * - rescale = inverse of n * 2^64 modulo q, rescale_shoup = its Shoup quotient");
+  print_param_def(f, n, "q", p->q);
+  print_param_def(f, n, "psi", p->psi);
+  print_param_def(f, n, "omega", p->phi);
+  print_param_def(f, n, "inv_psi", p->inv_psi);
+  print_param_def(f, n, "inv_omega", p->inv_phi);
+  print_param_def(f, n, "inv_n", p->inv_n);
+  print_param_def(f, n, "qinv", p->qinv);
+  print_param_def(f, n, "rescale", p->rescale);
+  print_param_def(f, n, "rescale_shoup", shoup(p->rescale, p->q));
+  fprintf(f, "\n");
+
+  print_comment(f, "POWERS OF PSI\n"
+		" * - scaled_inv_psi_powers[i] = inverse of n * 2^64 * psi^-i");
+  for (i=0; i<2; i++) {
+    print_table_decl(f, n, table_name[i], n);
+  }
+  fprintf(f, "\n");
+
+  print_comment(f, "TABLES FOR NTT COMPUTATION");
+  for (i=2; i<10; i++) {
+    print_table_decl(f, n, table_name[i], n);
+  }
+  fprintf(f, "\n");
+
+  fprintf(f, "#endif /* __NTT64_%"PRIu32"_TABLES_H */\n", n);
+}
+
+static void print_tables(FILE *f, const parameters_t *p) {
+  uint64_t *table;
+  uint32_t n;
+  uint64_t q;
+
+  n = p->n;
+  q = p->q;
+  table = (uint64_t *) malloc(2 * n * sizeof(uint64_t));
+  if (table == NULL) {
+    fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", 2*n);
+    exit(EXIT_FAILURE);
+  }
+
+  print_header(f, p);
+  fprintf(f, "#include \"ntt64_%"PRIu32"_tables.h\"\n\n", n);
+
+  build_power_table(table, n, q, 1, p->psi);
+  print_table(f, n, table_name[0], table, n);
+  build_power_table(table, n, q, p->rescale, p->inv_psi);
+  print_table(f, n, table_name[1], table, n);
+
+  build_table(table, n, q, 1, p->phi);
+  print_table(f, n, table_name[2], table, n);
+  build_rev_table(table, n, q, 1, p->phi);
+  print_table(f, n, table_name[3], table, n);
+  build_table(table, n, q, 1, p->inv_phi);
+  print_table(f, n, table_name[4], table, n);
+  build_rev_table(table, n, q, 1, p->inv_phi);
+  print_table(f, n, table_name[5], table, n);
+
+  build_table(table, n, q, p->psi, p->phi);
+  print_table(f, n, table_name[6], table, n);
+  build_rev_table(table, n, q, p->psi, p->phi);
+  print_table(f, n, table_name[7], table, n);
+  build_table(table, n, q, p->inv_psi, p->inv_phi);
+  print_table(f, n, table_name[8], table, n);
+  build_rev_table(table, n, q, p->inv_psi, p->inv_phi);
+  print_table(f, n, table_name[9], table, n);
+
+  free(table);
+}
+
+static const char * const table_name_4step[6] = {
+  "col_mixed_powers_rev", "col_inv_mixed_powers_rev",
+  "row_omega_powers_rev", "row_inv_omega_powers_rev",
+  "mixed_twiddles_4step", "inv_mixed_twiddles_4step",
+};
+
+static void print_declarations_4step(FILE *f, const parameters_t *p) {
+  uint32_t n, n1, n2;
+
+  n = p->n;
+  n1 = p->n1;
+  n2 = n/n1;
+  print_header(f, p);
+  fprintf(f, "#ifndef __NTT64_%"PRIu32"_TABLES_H\n", n);
+  fprintf(f, "#define __NTT64_%"PRIu32"_TABLES_H\n\n", n);
+  fprintf(f, "#include <stdint.h>\n\n");
+
+  print_comment(f, "PARAMETERS\n"
+		" * - qinv = inverse of q modulo 2^64 (for ntt64_mul_array)\n"
+		" * - rescale = inverse of n * 2^64 modulo q, rescale_shoup = its Shoup quotient\n"
+		" * - n1_4step = number of rows for the four-step NTTs");
+  print_param_def(f, n, "q", p->q);
+  print_param_def(f, n, "psi", p->psi);
+  print_param_def(f, n, "omega", p->phi);
+  print_param_def(f, n, "inv_psi", p->inv_psi);
+  print_param_def(f, n, "inv_omega", p->inv_phi);
+  print_param_def(f, n, "inv_n", p->inv_n);
+  print_param_def(f, n, "qinv", p->qinv);
+  print_param_def(f, n, "rescale", p->rescale);
+  print_param_def(f, n, "rescale_shoup", shoup(p->rescale, p->q));
+  print_param_def(f, n, "n1_4step", n1);
+  fprintf(f, "\n");
+
+  print_comment(f, "TABLES FOR FOUR-STEP NTT COMPUTATION\n"
+		" * - col tables: NTTs of size n1 with psi1 = psi^(n/n1) (2 * n1 elements)\n"
+		" * - row tables: NTTs of size n2 = n/n1 with omega2 = omega^n1 (2 * n2 elements)\n"
+		" * - mixed_twiddles_4step[x2 * n1 + j] = psi^(x2 * (2 * bitrev(j) + 1))\n"
+		" * - inv_mixed_twiddles_4step[x2 * n1 + j] = rescale * psi^-(x2 * (2 * bitrev(j) + 1))");
+  print_table_decl(f, n, table_name_4step[0], n1);
+  print_table_decl(f, n, table_name_4step[1], n1);
+  print_table_decl(f, n, table_name_4step[2], n2);
+  print_table_decl(f, n, table_name_4step[3], n2);
+  print_table_decl(f, n, table_name_4step[4], n);
+  print_table_decl(f, n, table_name_4step[5], n);
+  fprintf(f, "\n");
+
+  fprintf(f, "#endif /* __NTT64_%"PRIu32"_TABLES_H */\n", n);
+}
+
+static void print_tables_4step(FILE *f, const parameters_t *p) {
+  uint64_t *table;
+  uint64_t q, psi1, inv_psi1, omega2, inv_omega2;
+  uint32_t n, n1, n2;
+
+  n = p->n;
+  n1 = p->n1;
+  n2 = n/n1;
+  q = p->q;
+  table = (uint64_t *) malloc(2 * n * sizeof(uint64_t));
+  if (table == NULL) {
+    fprintf(stderr, "failed to allocate table of size %"PRIu32"\n", 2*n);
+    exit(EXIT_FAILURE);
+  }
+
+  print_header(f, p);
+  fprintf(f, "#include \"ntt64_%"PRIu32"_tables.h\"\n\n", n);
+
+  psi1 = power(p->psi, n2, q);
+  inv_psi1 = power(p->inv_psi, n2, q);
+  build_rev_table(table, n1, q, psi1, mulmod(psi1, psi1, q));
+  print_table(f, n, table_name_4step[0], table, n1);
+  build_rev_table(table, n1, q, inv_psi1, mulmod(inv_psi1, inv_psi1, q));
+  print_table(f, n, table_name_4step[1], table, n1);
+
+  omega2 = power(p->phi, n1, q);
+  inv_omega2 = power(p->inv_phi, n1, q);
+  build_rev_table(table, n2, q, 1, omega2);
+  print_table(f, n, table_name_4step[2], table, n2);
+  build_rev_table(table, n2, q, 1, inv_omega2);
+  print_table(f, n, table_name_4step[3], table, n2);
+
+  build_4step_table(table, n, n1, q, p->psi, p->phi, 1);
+  print_table(f, n, table_name_4step[4], table, n);
+  build_4step_table(table, n, n1, q, p->inv_psi, p->inv_phi, p->rescale);
+  print_table(f, n, table_name_4step[5], table, n);
+
+  free(table);
+}
+
+/*
+ * Open file: name is "ntt64_<size>_tables.h" or "ntt64_<size>_tables.c"
+ */
+#define BUFFER_SIZE 100
+
+static FILE *open_file(uint32_t n, const char *suffix) {
+  char filename[BUFFER_SIZE];
+  int len;
+  FILE *f;
+
+  f = NULL;
+  len = snprintf(filename, BUFFER_SIZE, "ntt64_%"PRIu32"_tables.%s", n, suffix);
+  if (len < BUFFER_SIZE) {
+    f = fopen(filename, "w");
+  }
+  return f;
+}
+
+int main(int argc, char *argv[]) {
+  parameters_t params;
+  uint32_t bits, n, log_n;
+  uint64_t two64_mod_q;
+  bool four_step;
+  long x;
+  FILE *f;
+
+  four_step = (argc == 4 && strcmp(argv[3], "4step") == 0);
+  if (argc != 3 && !four_step) {
+    fprintf(stderr, "Usage: %s <bits> <size> [4step]\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  x = atol(argv[1]);
+  if (x < 3 || x > 62) {
+    fprintf(stderr, "Invalid number of bits %ld: must be between 3 and 62\n", x);
+    exit(EXIT_FAILURE);
+  }
+  bits = (uint32_t) x;
+
+  x = atol(argv[2]);
+  if (x <= 1 || x >= 100000) {
+    fprintf(stderr, "Invalid size %ld: must be between 2 and 100000\n", x);
+    exit(EXIT_FAILURE);
+  }
+  n = (uint32_t) x;
+  if (!logtwo(n, &log_n)) {
+    fprintf(stderr, "Invalid size: %"PRIu32" is not a power of two\n", n);
+    exit(EXIT_FAILURE);
+  }
+
+  params.bits = bits;
+  params.n = n;
+  params.q = find_prime(bits, n);
+  if (params.q == 0) {
+    fprintf(stderr, "No prime less than 2^%"PRIu32" is 1 modulo %"PRIu32"\n", bits, 2*n);
+    exit(EXIT_FAILURE);
+  }
+  params.psi = find_psi(params.q, n);
+  assert(params.psi != 0);
+  params.phi = mulmod(params.psi, params.psi, params.q);
+  params.inv_psi = inverse(params.psi, params.q);
+  params.inv_phi = inverse(params.phi, params.q);
+  params.inv_n = inverse(n, params.q);
+  params.qinv = inverse_pow64(params.q);
+  two64_mod_q = (uint64_t) (((uint128_t) 1 << 64) % params.q);
+  params.rescale = mulmod(params.inv_n, two64_mod_q, params.q);
+  params.n1 = four_step ? four_step_n1(log_n) : 0;
+
+  f = open_file(n, "h");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt64_%"PRIu32"_tables.h'\n", n);
+    exit(EXIT_FAILURE);
+  }
+  if (four_step) {
+    print_declarations_4step(f, &params);
+  } else {
+    print_declarations(f, &params);
+  }
+  fclose(f);
+
+  f = open_file(n, "c");
+  if (f == NULL) {
+    fprintf(stderr, "failed to open file 'ntt64_%"PRIu32"_tables.c'\n", n);
+    exit(EXIT_FAILURE);
+  }
+  if (four_step) {
+    print_tables_4step(f, &params);
+  } else {
+    print_tables(f, &params);
+  }
+  fclose(f);
+
+  return 0;
+}
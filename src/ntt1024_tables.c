@@ -0,0 +1,1585 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#include "ntt1024_tables.h"
+
+const uint16_t ntt1024_psi_powers[1024] = {
+        1,  1014,  8209,  4273,  7094,  4251,  9364,  7988,
+     1381, 11677,  6171,  2293,  2481,  8778,  3656,  8195,
+     2366,  2769,  5874,  8360,  9919,  5464, 10446, 11415,
+    10861,  2110,  1254,  5789,  8193,   338, 10929,  9617,
+     6461,  1417, 11314,  6759,  8653, 12085,  2057,  8957,
+      827,  2926,  5315,  6828,  4885,   923,  1958,  6883,
+    11499, 10014,  3482,  3805, 11813,  8896,   418,  6026,
+     2731,  4209,  3643,  7302,  6250,  8665, 11964,  2253,
+    11077, 12221,  4782,  7082,  4372,  9168,  5868,  2276,
+     9821,  4404,  4749, 10487,  3833,  3338,  5257,  9461,
+     8034, 11158,  8332,  6105,  9103,  1403,  9407,  2434,
+    10276, 11081,  3988,   751, 11885,  8170,  1594,  6457,
+     9650,  3056,  1956,  4855,  7370,  1468,  1583,  7592,
+     5374,  5209,  9945,  7250,  2678, 11912, 10970,  2035,
+    11227,  4564,  7232,  9004, 11618,  7790,  9522,  8443,
+     8058, 10916,  8724, 10345,  7313,  5115,   652,  9811,
+     6553,  8682,  4624,  6627,  9984,  9929,  3315,  6513,
+     4989,  8067,  7753,  8871, 11935,  9714,  6507, 11194,
+     7969,  6693,  3174, 11007,  2686,  7735,  2908, 11641,
+     6534,  1705,  8410, 11463, 10377,  2894,  9734,  2209,
+     3328,  7406,  1105,  2171,  1663,  2689, 10777,  2957,
+    12171,  3238,  2169, 11924, 10849,  2231,  1058,  3669,
+     9088, 10771,  9162, 12073,  2178,  8761, 10996,  3821,
+     3459,  5061,  7341,  8929,  9302,  6565,  8561,  4820,
+     8747,  9089, 11785,  5082,  4057,  9272,   723,  8071,
+    11809,  4840,  4449,  1223, 11222, 11783,  3054, 12217,
+      726, 11113, 11858,  5370,  1153,  1687,  2447, 11169,
+     7197, 10381,  6950,  5703,  7012,  7126, 12121,  1694,
+     9545,  7187,   241, 10883, 12129,  9806,  1483,  4504,
+     7837,  8024,  1018, 12265,   242, 11897,  8049,  1790,
+     8577,  8755,  4912,  3723,  2399, 11653,  6413,  1901,
+    10530, 10568, 12233,  4661,  7278,  6492,  8273,  7724,
+     4043,  7365,  8687,  9694, 10805,  6771,  8532, 12281,
+     4177,  8062,  2683,  4693,  2859, 11111,  9830,  1241,
+     4896, 12077,  6234,  4730,  3510,  7619,  8174,  5650,
+     2426,  2164,  6854,  6671,  5444,  2455,  6992, 11424,
+     7698,  2257,  2844,  8190,  9585, 10880,  9087,  9757,
+      953,  7800,  7373,  4510,  1632,  8122,  2078,  5673,
+     1170,  6636,  6821, 10076,  4905,  8914,  6381,  6320,
+     5911,  9011,  6427,  3808,  2566,  8945,   948,  2730,
+     3195,  7723,  3029, 11445,  4414,  2600,  6554,  9696,
+      544, 10900,  4789,  1891,   390,  2212,  6370,  7455,
+     1635, 11164,  2127,  6203, 10163,  7100, 10335,  9462,
+     9048,  7078,   316,   910,  1065, 10767,  5106,  3815,
+     9664,  4963,  6281,  3232,  8374, 11826,  9789,  8823,
+      130,  8930, 10316,  2485,   545, 11914,   709,  6164,
+     7484,  6463,  3445,  3154,  3016, 10552,  8298,  8496,
+      355,  3589,  1702,  5368, 11414,  9847,  6190,  9270,
+    10984,  3942,  3263,  2941,  8236,  7073,  7535,  9021,
+     4278, 12164,  8429,  6151,  6591, 10347,  9341,  9244,
+     9198, 11710,  2766,  2832,  8311,  9389,  8760,  9982,
+     7901, 11475, 10256,  3090, 11854,  1314,  5184,  9173,
+    10938,  6454,  6608,  3007,  1426,  8151,  6906, 10243,
+     2197,  3449,  7210, 11274,  3066, 12096,   922,   944,
+    10963,  7226,  2920, 11520,  6730,  3825,  7515,  1030,
+    12144,   438,  1728,  7154,  3646, 10344,  6299,  9195,
+     8668,  2717,  2302, 11607,  8925,  5246, 10596,  3758,
+     1022,  4032,  8500,  4411, 11847,  6505,  9166,  3840,
+    10436,  1275,  2505,  8536,  4048,   146,   576,  6481,
+     9408,  3448,  6196,  3065, 11082,  5002,  8960,  3869,
+     2975,  5845,  3532,  5349,  4437,  1344, 11026,  9663,
+     3949, 10361, 11248,  1280,  7575,   425,   835, 11038,
+     9542,  4145,   192, 10353,  3136,  9342, 10258,  5118,
+     3694,  9860,  7083,  5386,  5088, 10141,  9370,  1783,
+     1479,   448, 11868,  3221,  9509,  7550, 11942,  4523,
+     2525,  4238,  8471, 11872,  7277,  5478,    64,  3451,
+     9238,  3114, 11612,  1706,  9424,  7383,  2361,  9988,
+     1696, 11573, 11316,  8787,   493,  8342,  3956,  5170,
+     7266,  6613,  8077,  5604,  4938,  5509,  6920, 12150,
+     6522,  1826,  8214,  9343, 11272,  1038,  7967,  4665,
+    11334,  2461,   787, 11522,  8758,  7954,  3772,  2929,
+     8357,  6877,  5415,  9916,  2422, 10397, 10885,  1868,
+     1646, 10029,  6403,  4050,  2174,  4705,  2738, 11307,
+    11950,   346,  6752,  1555,  3778,  9013,  8455,  7937,
+    11112, 10844,  9450,  9169,  6882, 10485,  1805, 11498,
+     9000,  7562, 11821,  4719,  4645,  3343, 10327,  1350,
+     4821,  9761,  5009,  3769, 12176,  8308,  6347,  8711,
+     9452, 11197, 11011,  6742,  3704,  7711,  3150, 11249,
+     2294,  3495,  4698,  7929,  3000,  6617, 12133,  1573,
+     9741,  9307, 11635,   450,  1607,  7350,  5766,  9449,
+     8155, 10962,  6212,  7000,  7247, 11925, 11863, 10440,
+     5331, 10763,  1050,  7846,  4861,  1165,  1566,  2643,
+     1000,  6302, 12237,  8717,  3247, 11295, 12071,   150,
+     4632,  2450,  1922,  7246, 10911,  3654,  6167, 10526,
+     6512,  3975, 12147,  3480,  1777,  7684,   350, 10808,
+     9813,  8581,   522,   881,  8526,  6197,  4079,  7002,
+     9275,  3765,  8120,    50,  1544,  4913,  4737, 10608,
+     3637,  1218,  6152,  7605,  6267,  1325,  4049,  1160,
+     8785, 10754,  4213,  7699,  3271, 11053,   174,  4390,
+     2842,  6162,  5456,  2334,  7188,  1255,  6803,  4113,
+     4611,  5734,  1579,  3536,  9405,   406,  6147,  2535,
+     2089,  4538,  5446,  4483, 11121,  7681,  9597, 10759,
+     9283, 11877,    58,  9656,  9140,  2054,  5915,   778,
+     2396,  8611,  6364,  1371,  1537, 10104,  8719,  5275,
+     3135,  8328,  2049,   845,  8889,  5609, 10008,  9687,
+     3707, 10753,  3199, 11779, 11287,  3959,  8212,  7315,
+     7143,  4781,  6068,  8452,  4895, 11063, 10314,   457,
+     8705,  3368, 11099,  9951,  1045,  2776,   683,  4378,
+     2963,  5966,  3336,  3229,  5332, 11777,  9259, 12119,
+    11955,  5416, 10930, 10631,  2381,  5690,  6119, 11010,
+     5728,  7784,  3438,  8345,  6998,  5219,  7796,  3317,
+     8541,  9118,  4324,  9652,  5084,  6085,  1112,  9269,
+     9970,  8022, 11279,  8136,  3985,  9998, 11836,  7640,
+     4890,  5993,  6136,  3670, 10102,  6691,  1146,  6878,
+     6429,  5836,  6695,  5202,  2847, 11232,  9634, 11410,
+     5791, 10221,  4467,  7186, 11516,  2674,  7856,  2712,
+     9521,  7429, 12138,  6643,  1630,  6094, 10238,  9416,
+    11560, 10423,   382,  6389,  2143, 10138,  6328,  1734,
+      949,  3744, 11404, 11996, 10123,  3407,  1489, 10588,
+     7935,  9084,  6715,   904,  7270, 10669,  4046, 10407,
+     8736, 10224,  7509,  7235, 12046, 11667,  8320,  6226,
+     8907, 11572, 10302,   578,  8509,  1248, 11994,  8095,
+    11567,  5232,  8689, 11722,  2645,  3028, 10431,  8494,
+    10616, 11749,  5445,  3469,  2912,  3408,  2503,  6508,
+    12208,  3889, 10966, 10268,  2969, 12050,  3434,  4289,
+    11029,   416,  3998, 10891,  7952,  1744, 11089, 12100,
+     4978,  9202,  3477, 11024,  7635, 12109,  1815,  9349,
+     5067,  1136,  9027, 10362, 12262,  9489, 11848,  7519,
+     5086,  8113,  5241,  5526, 11869,  4235,  5429, 11823,
+     6747,  8774, 11889, 12226,  9852, 11260,  1159,  7771,
+     2545, 12229,   605, 11309,  1689,  4475,  3009,  3454,
+    12280,  3163, 12142, 10699,  9888, 10897,  1747,  1842,
+    12149,  5508,  5906,  3941,  2249,  7021,  3963, 12268,
+     3284, 11946,  8579, 10783,  9041, 12269,  4298,  7866,
+      563,  5588,  1003,  9344, 12286,  9247, 12240, 11759,
+     3296, 11825,  8775,   614,  8146,  1836,  6065,  5410,
+     4846, 10533,  1321, 12282,  5191,  3982,  6956, 11787,
+     7110,  8186,  5529,  2622,  4284,  5959,  8527,  7211,
+};
+
+const uint16_t ntt1024_inv_psi_powers[1024] = {
+        1,  5078,  3762,  6330,  8005,  9667,  6760,  4103,
+     5179,   502,  5333,  8307,  7098,     7, 10968,  1756,
+     7443,  6879,  6224, 10453,  4143, 11675,  3514,   464,
+     8993,   530,    49,  3042,     3,  2945, 11286,  6701,
+    11726,  4423,  7991,    20,  3248,  1506,  3710,   343,
+     9005,    21,  8326,  5268, 10040,  8348,  6383,  6781,
+      140, 10447, 10542,  1392,  2401,  1590,   147,  9126,
+        9,  8835,  9280,  7814, 10600,   980, 11684,    60,
+     9744,  4518, 11130,  1029,  2437,    63,   400,  3515,
+     5542,   466,  6860,  8054,   420,  6763,  7048,  4176,
+     7203,  4770,   441,  2800,    27,  1927,  3262, 11153,
+     7222,  2940, 10474,   180,  4654,  1265,  8812,  3087,
+     7311,   189,  1200, 10545,  4337,  1398,  8291, 11873,
+     1260,  8000,  8855,   239,  9320,  2021,  1323,  8400,
+       81,  5781,  9786,  8881,  9377,  8820,  6844,   540,
+     1673,  3795,  1858,  9261,  9644,   567,  3600,  7057,
+      722,  4194,   295, 11041,  3780, 11711,  1987,   717,
+     3382,  6063,  3969,   622,   243,  5054,  4780,  2065,
+     3553,  1882,  8243,  1620,  5019, 11385,  5574,  3205,
+     4354,  1701, 10800,  8882,  2166,   293,   885,  8545,
+    11340, 10555,  5961,  2151, 10146,  5900, 11907,  1866,
+      729,  2873,  2051,  6195, 10659,  5646,   151,  4860,
+     2768,  9577,  4433,  9615,   773,  5103,  7822,  2068,
+     6498,   879,  2655,  1057,  9442,  7087,  5594,  6453,
+     5860,  5411, 11143,  5598,  2187,  8619,  6153,  6296,
+     7399,  4649,   453,  2291,  8304,  4153,  1010,  4267,
+     2319,  3020, 11177,  6204,  7205,  2637,  7965,  3171,
+     3748,  8972,  4493,  7070,  5291,  3944,  8851,  4505,
+     6561,  1279,  6170,  6599,  9908,  1658,  1359,  6873,
+      334,   170,  3030,   512,  6957,  9060,  8953,  6323,
+     9326,  7911, 11606,  9513, 11244,  2338,  1190,  8921,
+     3584, 11832,  1975,  1226,  7394,  3837,  6221,  7508,
+     5146,  4974,  4077,  8330,  1002,   510,  9090,  1536,
+     8582,  2602,  2281,  6680,  3400, 11444, 10240,  3961,
+     9154,  7014,  3570,  2185, 10752, 10918,  5925,  3678,
+     9893, 11511,  6374, 10235,  3149,  2633, 12231,   412,
+     3006,  1530,  2692,  4608,  1168,  7806,  6843,  7751,
+    10200,  9754,  6142, 11883,  2884,  8753, 10710,  6555,
+     7678,  8176,  5486, 11034,  5101,  9955,  6833,  6127,
+     9447,  7899, 12115,  1236,  9018,  4590,  8076,  1535,
+     3504, 11129,  8240, 10964,  6022,  4684,  6137, 11071,
+     8652,  1681,  7552,  7376, 10745, 12239,  4169,  8524,
+     3014,  5287,  8210,  6092,  3763, 11408, 11767,  3708,
+     2476,  1481, 11939,  4605, 10512,  8809,   142,  8314,
+     5777,  1763,  6122,  8635,  1378,  5043, 10367,  9839,
+     7657, 12139,   218,   994,  9042,  3572,    52,  5987,
+    11289,  9646, 10723, 11124,  7428,  4443, 11239,  1526,
+     6958,  1849,   426,   364,  5042,  5289,  6077,  1327,
+     4134,  2840,  6523,  4939, 10682, 11839,   654,  2982,
+     2548, 10716,   156,  5672,  9289,  4360,  7591,  8794,
+     9995,  1040,  9139,  4578,  8585,  5547,  1278,  1092,
+     2837,  3578,  5942,  3981,   113,  8520,  7280,  2528,
+     7468, 10939,  1962,  8946,  7644,  7570,   468,  4727,
+     3289,   791, 10484,  1804,  5407,  3120,  2839,  1445,
+     1177,  4352,  3834,  3276,  8511, 10734,  5537, 11943,
+      339,   982,  9551,  7584, 10115,  8239,  5886,  2260,
+    10643, 10421,  1404,  1892,  9867,  2373,  6874,  5412,
+     3932,  9360,  8517,  4335,  3531,   767, 11502,  9828,
+      955,  7624,  4322, 11251,  1017,  2946,  4075, 10463,
+     5767,   139,  5369,  6780,  7351,  6685,  4212,  5676,
+     5023,  7119,  8333,  3947, 11796,  3502,   973,   716,
+    10593,  2301,  9928,  4906,  2865, 10583,   677,  9175,
+     3051,  8838, 12225,  6811,  5012,   417,  3818,  8051,
+     9764,  7766,   347,  4739,  2780,  9068,   421, 11841,
+    10810, 10506,  2919,  2148,  7201,  6903,  5206,  2429,
+     8595,  7171,  2031,  2947,  9153,  1936, 12097,  8144,
+     2747,  1251, 11454, 11864,  4714, 11009,  1041,  1928,
+     8340,  2626,  1263, 10945,  7852,  6940,  8757,  6444,
+     9314,  8420,  3329,  7287,  1207,  9224,  6093,  8841,
+     2881,  5808, 11713, 12143,  8241,  3753,  9784, 11014,
+     1853,  8449,  3123,  5784,   442,  7878,  3789,  8257,
+    11267,  8531,  1693,  7043,  3364,   682,  9987,  9572,
+     3621,  3094,  5990,  1945,  8643,  5135, 10561, 11851,
+      145, 11259,  4774,  8464,  5559,   769,  9369,  5063,
+     1326, 11345, 11367,   193,  9223,  1015,  5079,  8840,
+    10092,  2046,  5383,  4138, 10863,  9282,  5681,  5835,
+     1351,  3116,  7105, 10975,   435,  9199,  2033,   814,
+     4388,  2307,  3529,  2900,  3978,  9457,  9523,   579,
+     3091,  3045,  2948,  1942,  5698,  6138,  3860,   125,
+     8011,  3268,  4754,  5216,  4053,  9348,  9026,  8347,
+     1305,  3019,  6099,  2442,   875,  6921, 10587,  8700,
+    11934,  3793,  3991,  1737,  9273,  9135,  8844,  5826,
+     4805,  6125, 11580,   375, 11744,  9804,  1973,  3359,
+    12159,  3466,  2500,   463,  3915,  9057,  6008,  7326,
+     2625,  8474,  7183,  1522, 11224, 11379, 11973,  5211,
+     3241,  2827,  1954,  5189,  2126,  6086, 10162,  1125,
+    10654,  4834,  5919, 10077, 11899, 10398,  7500,  1389,
+    11745,  2593,  5735,  9689,  7875,   844,  9260,  4566,
+     9094,  9559, 11341,  3344,  9723,  8481,  5862,  3278,
+     6378,  5969,  5908,  3375,  7384,  2213,  5468,  5653,
+    11119,  6616, 10211,  4167, 10657,  7779,  4916,  4489,
+    11336,  2532,  3202,  1409,  2704,  4099,  9445, 10032,
+     4591,   865,  5297,  9834,  6845,  5618,  5435, 10125,
+     9863,  6639,  4115,  4670,  8779,  7559,  6055,   212,
+     7393, 11048,  2459,  1178,  9430,  7596,  9606,  4227,
+     8112,     8,  3757,  5518,  1484,  2595,  3602,  4924,
+     8246,  4565,  4016,  5797,  5011,  7628,    56,  1721,
+     1759, 10388,  5876,   636,  9890,  8566,  7377,  3534,
+     3712, 10499,  4240,   392, 12047,    24, 11271,  4265,
+     4452,  7785, 10806,  2483,   160,  1406, 12048,  5102,
+     2744, 10595,   168,  5163,  5277,  6586,  5339,  1908,
+     5092,  1120,  9842, 10602, 11136,  6919,   431,  1176,
+    11563,    72,  9235,   506,  1067, 11066,  7840,  7449,
+      480,  4218, 11566,  3017,  8232,  7207,   504,  3200,
+     3542,  7469,  3728,  5724,  2987,  3360,  4948,  7228,
+     8830,  8468,  1293,  3528, 10111,   216,  3127,  1518,
+     3201,  8620, 11231, 10058,  1440,   365, 10120,  9051,
+      118,  9332,  1512,  9600, 10626, 10118, 11184,  4883,
+     8961, 10080,  2555,  9395,  1912,   826,  3879, 10584,
+     5755,   648,  9381,  4554,  9603,  1282,  9115,  5596,
+     4320,  1095,  5782,  2575,   354,  3418,  4536,  4222,
+     7300,  5776,  8974,  2360,  2305,  5662,  7665,  3607,
+     5736,  2478, 11637,  7174,  4976,  1944,  3565,  1373,
+     4231,  3846,  2767,  4499,   671,  3285,  5057,  7725,
+     1062, 10254,  1319,   377,  9611,  5039,  2344,  7080,
+     6915,  4697, 10706, 10821,  4919,  7434, 10333,  9233,
+     2639,  5832, 10695,  4119,   404, 11538,  8301,  1208,
+     2013,  9855,  2882, 10886,  3186,  6184,  3957,  1131,
+     4255,  2828,  7032,  8951,  8456,  1802,  7540,  7885,
+     2468, 10013,  6421,  3121,  7917,  5207,  7507,    68,
+     1212, 10036,   325,  3624,  6039,  4987,  8646,  8080,
+     9558,  6263, 11871,  3393,   476,  8484,  8807,  2275,
+      790,  5406, 10331, 11366,  7404,  5461,  6974,  9363,
+    11462,  3332, 10232,   204,  3636,  5530,   975, 10872,
+     5828,  2672,  1360, 11951,  4096,  6500, 11035, 10179,
+     1428,   874,  1843,  6825,  2370,  3929,  6415,  9520,
+     9923,  4094,  8633,  3511,  9808,  9996,  6118,   612,
+    10908,  4301,  2925,  8038,  5195,  8016,  4080, 11275,
+};
+
+const uint16_t ntt1024_inv_psi_powers_rev[1024] = {
+        0,     1,     1,  5146,     1,  5146,   722,  4134,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+     7443,  9154,  3553,  9995,  7203,  3014,  2319,   955,
+      140,  7678,  2768,  1177,    81, 11289,  9326,  3051,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+     7443,  9154,  3553,  9995,  7203,  3014,  2319,   955,
+      140,  7678,  2768,  1177,    81, 11289,  9326,  3051,
+     5179,  8582,  3382,  2548,  5542,  8652,  7399,  3932,
+     9005, 10200,   729,  3289,  1260,  7657,   334, 10593,
+     8993,  9893,  4354,  2837,  7222,  2476,  3748,  5767,
+        9,  9447,  6498,   339,  1673,  6958,  3584,  9764,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+     7443,  9154,  3553,  9995,  7203,  3014,  2319,   955,
+      140,  7678,  2768,  1177,    81, 11289,  9326,  3051,
+     5179,  8582,  3382,  2548,  5542,  8652,  7399,  3932,
+     9005, 10200,   729,  3289,  1260,  7657,   334, 10593,
+     8993,  9893,  4354,  2837,  7222,  2476,  3748,  5767,
+        9,  9447,  6498,   339,  1673,  6958,  3584,  9764,
+     8005,  1002,  3780, 10682,  2437,  6022,  2187,  9867,
+     3248,  1168, 10146,  7644,  4337,  1378,  9908, 11796,
+     4143, 10752,  5019,  8585,    27,  3763,  7205,  1017,
+     2401,  5101,   773,  8511,  9377,  7428, 11244,  5012,
+     7098,  3400,   243,  9289,   420, 10745,  8304,  3531,
+    10040,  2884, 10659,  5407,  9320,  9042,  6957,  2865,
+        3,  3149,  2166,   113,  4654, 10512,  5291,  7351,
+    10600,  9018,  9442, 10115,  9644,  5042,  7394,  2780,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+     7443,  9154,  3553,  9995,  7203,  3014,  2319,   955,
+      140,  7678,  2768,  1177,    81, 11289,  9326,  3051,
+     5179,  8582,  3382,  2548,  5542,  8652,  7399,  3932,
+     9005, 10200,   729,  3289,  1260,  7657,   334, 10593,
+     8993,  9893,  4354,  2837,  7222,  2476,  3748,  5767,
+        9,  9447,  6498,   339,  1673,  6958,  3584,  9764,
+     8005,  1002,  3780, 10682,  2437,  6022,  2187,  9867,
+     3248,  1168, 10146,  7644,  4337,  1378,  9908, 11796,
+     4143, 10752,  5019,  8585,    27,  3763,  7205,  1017,
+     2401,  5101,   773,  8511,  9377,  7428, 11244,  5012,
+     7098,  3400,   243,  9289,   420, 10745,  8304,  3531,
+    10040,  2884, 10659,  5407,  9320,  9042,  6957,  2865,
+        3,  3149,  2166,   113,  4654, 10512,  5291,  7351,
+    10600,  9018,  9442, 10115,  9644,  5042,  7394,  2780,
+     3762,  4077,   295,  6523, 11130,  8240, 11143,  1404,
+     7991,  2692,  5961,  1962,  1200,  6122,  6170,  8333,
+     6224,  3570,  8243,  9139,   441,  8210, 11177,  4322,
+    10542,  5486,  4433,  3834,  9786, 10723, 11606, 12225,
+     5333,  2281,  3969,   156,  6860,  7552,   453,  8517,
+     8326,  6142,  2051, 10484,  8855,   218,  3030,  9928,
+       49,  6374, 10800,  5942, 10474, 11939,  4493,  5369,
+     9280, 12115,  2655,  9551,  1858,   426,  1975,   347,
+     6760,  9090,  1987,   654,   400,  6137,  6153,  6874,
+     3710,  6843, 11907,   468,  8291, 10367,  1359,   973,
+     3514,  5925,  5574,  1278,  3262, 11767,  7965,  4075,
+      147,  6833,  7822,  5537,  6844, 11239,  1190,  3818,
+    10968, 10240,  4780,  7591,  7048,  4169,  1010, 11502,
+     6383, 10710,   151,  2839,  1323,    52,  8953,   677,
+    11286, 12231,   885,  7280,  8812,   142,  8851,  4212,
+    11684,  8076,  5594,  5886,  3600,  6077,  6221,   421,
+        1,  5146,   722,  4134,  9744,  3504,  5860, 10643,
+    11726,  3006, 11340,  7468,  7311,  5777,  6561,  5023,
+     7443,  9154,  3553,  9995,  7203,  3014,  2319,   955,
+      140,  7678,  2768,  1177,    81, 11289,  9326,  3051,
+     5179,  8582,  3382,  2548,  5542,  8652,  7399,  3932,
+     9005, 10200,   729,  3289,  1260,  7657,   334, 10593,
+     8993,  9893,  4354,  2837,  7222,  2476,  3748,  5767,
+        9,  9447,  6498,   339,  1673,  6958,  3584,  9764,
+     8005,  1002,  3780, 10682,  2437,  6022,  2187,  9867,
+     3248,  1168, 10146,  7644,  4337,  1378,  9908, 11796,
+     4143, 10752,  5019,  8585,    27,  3763,  7205,  1017,
+     2401,  5101,   773,  8511,  9377,  7428, 11244,  5012,
+     7098,  3400,   243,  9289,   420, 10745,  8304,  3531,
+    10040,  2884, 10659,  5407,  9320,  9042,  6957,  2865,
+        3,  3149,  2166,   113,  4654, 10512,  5291,  7351,
+    10600,  9018,  9442, 10115,  9644,  5042,  7394,  2780,
+     3762,  4077,   295,  6523, 11130,  8240, 11143,  1404,
+     7991,  2692,  5961,  1962,  1200,  6122,  6170,  8333,
+     6224,  3570,  8243,  9139,   441,  8210, 11177,  4322,
+    10542,  5486,  4433,  3834,  9786, 10723, 11606, 12225,
+     5333,  2281,  3969,   156,  6860,  7552,   453,  8517,
+     8326,  6142,  2051, 10484,  8855,   218,  3030,  9928,
+       49,  6374, 10800,  5942, 10474, 11939,  4493,  5369,
+     9280, 12115,  2655,  9551,  1858,   426,  1975,   347,
+     6760,  9090,  1987,   654,   400,  6137,  6153,  6874,
+     3710,  6843, 11907,   468,  8291, 10367,  1359,   973,
+     3514,  5925,  5574,  1278,  3262, 11767,  7965,  4075,
+      147,  6833,  7822,  5537,  6844, 11239,  1190,  3818,
+    10968, 10240,  4780,  7591,  7048,  4169,  1010, 11502,
+     6383, 10710,   151,  2839,  1323,    52,  8953,   677,
+    11286, 12231,   885,  7280,  8812,   142,  8851,  4212,
+    11684,  8076,  5594,  5886,  3600,  6077,  6221,   421,
+     5078,  4974,  4194,  2840,  4518, 11129,  5411, 10421,
+     4423,  1530, 10555, 10939,   189,  1763,  1279,  7119,
+     6879,  7014,  1882,  1040,  4770,  5287,  3020,  7624,
+    10447,  8176,  9577,  4352,  5781,  9646,  7911,  8838,
+      502,  2602,  6063, 10716,   466,  1681,  4649,  9360,
+       21,  9754,  2873,   791,  8000, 12139,   170,  2301,
+      530, 11511,  1701,  3578,  2940,  1481,  8972,   139,
+     8835,  7899,   879,   982,  3795,  1849, 11832,  7766,
+     9667,   510, 11711, 11839,    63,  4684,  8619,  2373,
+     1506,  7806,  5900,  7570,  1398,  5043,  1658,  3502,
+    11675, 10918, 11385,  5547,  1927, 11408,  2637,  2946,
+     1590,  9955,  5103, 10734,  8820,  4443,  2338,   417,
+        7, 11444,  5054,  4360,  6763, 12239,  4153,   767,
+     8348,  8753,  5646,  3120,  2021,  3572,  9060, 10583,
+     2945,  2633,   293,  8520,  1265,  8809,  3944,  6685,
+      980,  4590,  7087,  8239,   567,  5289,  3837,  9068,
+     6330,  8330, 11041,  4939,  1029, 10964,  5598,  1892,
+       20,  4608,  2151,  8946, 10545,  8635,  6599,  3947,
+    10453,  2185,  1620,  4578,  2800,  6092,  6204, 11251,
+     1392, 11034,  9615,  3276,  8881, 11124,  9513,  6811,
+     8307,  6680,   622,  5672,  8054,  7376,  2291,  4335,
+     5268, 11883,  6195,  1804,   239,   994,   512,  4906,
+     3042, 10235,  8882,  3981,   180,  4605,  7070,  6780,
+     7814,  1236,  1057,  7584,  9261,   364,  1226,  4739,
+     4103,  1536,   717,  2982,  3515, 11071,  6296,  5412,
+      343,  7751,  1866,  4727, 11873,  9839,  6873,   716,
+      464,  3678,  3205,  1092, 11153,  3708,  3171, 10463,
+     9126,  6127,  2068, 11943,   540,  1526,  8921,  8051,
+     1756,  3961,  2065,  8794,  4176,  8524,  4267,  9828,
+     6781,  6555,  4860,  1445,  8400,  5987,  6323,  9175,
+     6701,   412,  8545,  2528,  3087,  8314,  4505,  5676,
+       60,  1535,  6453,  2260,  7057,  1327,  7508, 11841,
+};
+
+const uint16_t ntt1024_scaled_inv_psi_powers[1024] = {
+    12277,   509,  4012, 10063,  2252,  6886,  4903, 12209,
+    11586,  6265,  9738, 10917,   847, 12205,  3563,  3506,
+     8996,  3475, 11335,  9743, 11729,  7368,  6988,  6721,
+     2685,  5929, 11701,   363, 12253,  1527, 12036,  5611,
+     6756,  8369,  2420, 12049, 10180,  6506,  4636,  8173,
+     2541, 12037, 10689, 10518,  2410, 10425,  9427,  4651,
+    10609,  9815,  8675,  7874,  8055,  5498, 10525,  1089,
+    12181,  4581, 11530,  4544,  7979,   529,  7260, 11569,
+     5962,  7229,  1619, 12230,  7623, 11533,  7489,  6976,
+     7230,  6697,  3703,  1664,  7249,  4867,  1447, 11333,
+    11876,  4205,  6997,  3267, 11965,  1454, 10012,  1343,
+    11648,  1587,  9491, 10129,  5597,  9398,  4857, 12112,
+    10580, 10021, 10178,  8639,  9401,  7802, 11109,  4992,
+     9458,  2312,  4341,  9421, 11050,   326,  8702,  9801,
+    11317,  4362,  5458,  4029, 10366,  4761,  3895,  5809,
+     4502,  3616,  2282, 11758,  7162,  5485,  5956,  1339,
+     3625, 11117,  8749,  2687,  3796,  6936,   734,  3685,
+     8572,   978,  1528,  4825,  9373,   797,  4085, 12087,
+     6520,  1994, 11685,  5138,  1217, 10848,  6846, 10696,
+     9197,  4166,  5579,  4017, 10875,  8773,  1669,  8061,
+    11388,  8519,  2202, 11055,  1138,  2934,  4584,  2186,
+     3541,  2391, 12255, 11683,  7271,  5982, 10477,  3125,
+     3651,  7966,  8249,  7510,  3013,   209,  4448, 12051,
+     8047,  1741,  5007, 11894,  9586,   979,  6606,  8587,
+     3414,  8802,  1463,  6558, 10623,  7173, 12187, 10471,
+     9524,  5657,  6853,  9375, 10953, 11609,   169, 10241,
+     9039,   627,  1055, 11575, 11852,  5223,  2732, 11104,
+     4180,  2937,  7529,  1183, 10242,  1828,  4389,  7385,
+     7291,  9230, 11983,  6835,  3994,  4682,  8270,  3547,
+     8281, 10249,   507,  6145,  2539,  1881,  3165, 10147,
+    10978,  3380,  8196,  8734,   251,  8811, 10298,  3549,
+     6148,  5484,   878,  9866,  9584,  3112, 11371,  8216,
+    11982,  1757,   232, 10641,   265,  6169,  1521,  6146,
+     7617,  5643,  9495,  5863,  8356, 10140,    10,  1624,
+      753,  1855,  6316, 10647,  6155,  4163,  2634,  5020,
+     4174,  9336,  9535,    70, 11368,  5271,   696,  7345,
+      795,  6218,  4563,  6149, 10562,  4640,  3907,  5300,
+      490,  5842,    30,  4872,  2259,  5565,  6659,  7363,
+     6176,   200,  7902,  2771,   233,  3430,  4027,   210,
+     9526,  3524,  2088,  9746,  2385,  6365,  1400,  6158,
+     7108,  1631, 11721,  3611,  1470,  5237,    90,  2327,
+     6777,  4406,  7688,  9800,  6239,   600, 11417,  8313,
+      699, 10290, 12081,   630,  4000, 10572,  6264,  4660,
+     7155,  6806,  4200,  6185,  9035,  4893, 10585, 10833,
+     4410,  3422,   270,  6981,  8042,   929, 10775,  4822,
+     6428,  1800,  9673,   361,  2097,  6292, 11665,  1890,
+    12000,  7138,  6503,  1691,  9176,  8129,   311,  6266,
+     2527,  2390,  7177,  7921,   941, 10266,   810,  8654,
+    11837,  2787,  7747,  2177,  6995,  5400,  4441,  1083,
+     6291,  6587, 10417,  5670, 11422,  9125,  7220,  5073,
+     2950, 12098,   933,  6509,  7581,  7170,  9242, 11474,
+     2823,  6220,  2430,  1384, 10933,  8361, 10952,  6531,
+     8696,  3911,  1034,  3249,  6584,  7472,  6673,  4721,
+     9688,  2797,  9371,  2930,  8850, 11716,  2799,  7238,
+    10454,  9221,  3148,  9844,  8469,  6371,  7290,  4152,
+     8221,   505,  8278,  7304,  1510, 11733,  3102,  9747,
+     7463, 10127,  7730,  1874,  4486,  8391,  3535,  8790,
+     1972, 10570,  8397,  9425,  6784,  3085,  9444,  4954,
+      829,  6824,  9581,   167,    85,  1515,   256,  9623,
+     4530, 10621,  9306,  4663, 10100,  5803, 10901,  5622,
+     1169,   595, 10605,  1792,  5916,  7132,   613,  3697,
+     8063,  9255,  3754,  2573,  2487,  8183,  4165,   501,
+      255,  4545,   768,  4291,  1301,  7285,  3340,  1700,
+     5722,  5120,  8125,  4577,  3507,  1785,  7237,  5376,
+     5459,  9107,  1839, 11091, 11900,  3187, 11262,  7719,
+     7461, 12260,   206,  1503,   765,  1346,  2304,   584,
+     3903,  9566, 10020,  5100,  4877,  3071, 12086,  1442,
+    10521,  5355,  9422,  3839,  4088,  2743,  5517,  8695,
+    11122,  9561,  9208, 10868, 10094, 12202,   618,  4509,
+     2295,  4038,  6912,  1752, 11709,  4120,  5482,  3011,
+     2342,  9213, 11680,  4326,  6985,  3776,  3688, 11517,
+    12264,  8229,  4262,  1507,  8788,  4105,  3046,  8026,
+     5704, 12028,  1854,  1238,  6885, 12114,  8447,  5256,
+    10549,    71,  4157,  9033,  7026,  3061, 10462,   689,
+     8666, 11328, 11064,  9973, 12214,   109,   497,  4521,
+     1786,    26,  9138, 11789,  4823, 11506,  5562,  3714,
+     8366, 11764,   763,  3479,  7069,   213,   182,  2521,
+     8789,  9183,  6808,  2067,  1420,  9406,  8614,  5341,
+    12064,   327,  1491,  1274,  5358,    78,  2836, 10789,
+     2180,  9940,  4397, 11142,   520, 10714,  2289, 10437,
+     8918,   639,   546,  7563,  1789,  2971,  8135,  6201,
+     4260,  3640,  1264,  3734, 11614,   981,  4473,  3822,
+     3785,   234,  8508,  7789,  6540,  5242,   902,  8848,
+     1560,  7564,  6867,  6733,  2176,  1917,  1638, 10400,
+     5367,  8913, 12116,  6314,   491, 10920,  3792, 11202,
+    10264,  2943,  1130, 11466, 11355,   702,   946, 11078,
+     7331,  3437,  2706,  1966,  4680, 10403,  8312,  7910,
+     6528,  5751,  4914,  6622,  3812,  2161, 11770,  6653,
+     1473,  8182, 11376,  9028,  6214,  8829,  3390,  9820,
+     9487,  2106,  2838,  8656,  9704, 10311,  8118,  5898,
+     1751,  6631,   358, 11441,  7295,  4964,  2453,  7577,
+    11436,  6483, 10732,  7670,  4419, 12257,  9550,  2506,
+     6353,  1909, 10170,  4882,  3883,  6318,  8514,  1390,
+     4534,  6355, 12065,  5405,  5253,  7604,  1074,  9745,
+     9596,  2603,  7359, 10442,  9730,  7160,  7618, 10721,
+      968, 12193,  4072,  7518,  6770,  5727,  5932,  2357,
+    11649,  6665,   964,  4170,  1313,  6776, 11617,  3926,
+     3470, 10523,  3222,  4657,  4210,  7809,  9788,  6748,
+     4612,  9191, 10565,  7585,  2904, 12001, 12216, 10265,
+     8021,  4892,  5507,  7071, 10369,  7706,  2892,   221,
+     3939,  8039, 10273, 11778, 10410,  6991,  9666,  1682,
+      341, 11138,  4786,  7955,  1547,  2995,  7117, 10466,
+     8712, 11425, 12070,  6217, 11774,  2387,  4232,  8924,
+     6529, 10829,  8676,   663, 11817, 11828,  6241, 10756,
+     6652,  8684,  4420,  5046,  1023,  8836,  2069, 11576,
+     4641,  8985,  9062,  6820,  1558,  9697, 11632,  6362,
+    10744,  7161,   407,  2194,  7298,  7909,  1450,  1989,
+    10873, 10906,  6434,  7690,  7667,  1474,   971,  2849,
+     3069,  1930,  6207, 10150,  1634,  2377,  2608,  8171,
+     4674,  4513, 10318,  6797,  7654,  9194,  1221,  6582,
+     9605, 11438,  4350,  5967,  8041,  8140,  7013, 10781,
+    10712,  4422,  2913,  8547,  9207,  5790,  6332,  5872,
+     4902,  7131,  7824, 12224,  1733,  1250,  6376,  8102,
+    10673,  3004,  3663,  7457,  4237,  9736,   761,  5612,
+    11834, 12131,  8750,  7765,  7558,   977,  8739,  1063,
+     3043,  5081,  6707,  5327,  2417,  9104, 11183, 12094,
+     5199,  3750,  6839, 12017,  7441,  9012, 10989, 10082,
+      422,  4630,  2283,  4547, 10924, 11815,  1672, 11006,
+    10385,  2931,  1639,  3189,  9129,  2954,  7832,  3692,
+     7251,  2734,  8971, 11704,  3308, 11250,  8228, 11473,
+    10034,  2458,  8389,  5668,  1266,  1601,  6849,  1352,
+     8194, 10867,  5016,  8440,  6577,  8793,  4917,  9567,
+     2809,  8862, 11207, 11076,  9464,  8202,  2335, 10534,
+     9924,  9172,   106,  9841,  5524,  7374,   589,  4715,
+     3798,  4803,  8258,  4056,     4,  8023,  2759,   742,
+     7442,  1801,  2462,  4123,  8427,  2008,  9043,  8650,
+     3814,    28,  7005,  7024,  5194,  2938,   318,  4945,
+     4283,  9833,  1767,  1856, 11394,  2120,   196, 12168,
+};
+
+const uint16_t ntt1024_omega_powers[1024] = {
+        0,     1,     1,  1479,     1,  4043,  1479,  7143,
+        1,  6553,  4043, 10984,  1479,  8155,  7143, 11567,
+        1, 11077,  6553,  8747,  4043,  3195, 10984,  8668,
+     1479,  1646,  8155,  8785,  7143,  6429, 11567,  2545,
+        1,  6461, 11077,  9650,  6553,  3328,  8747,  9545,
+     4043,  7698,  3195,  9664, 10984, 10938,  8668,  2975,
+     1479,  7266,  1646,  4821,  8155,  6512,  8785,  9283,
+     7143,  5728,  6429,   949, 11567,  4978,  2545,   563,
+        1,  2366,  6461, 11499, 11077,  8034,  9650, 11227,
+     6553,  7969,  3328,  9088,  8747,   726,  9545,  8577,
+     4043,  4896,  7698,  1170,  3195,  1635,  9664,  7484,
+    10984,  9198, 10938, 10963,  8668, 10436,  2975,  9542,
+     1479,  9238,  7266, 11334,  1646, 11112,  4821,  2294,
+     8155,  1000,  6512,  9275,  8785,  4611,  9283,  3135,
+     7143,  2963,  5728,  9970,  6429,  9521,   949,  8736,
+    11567, 12208,  4978,  5086,  2545, 12149,   563,  4846,
+        1,  1381,  2366, 10861,  6461,   827, 11499,  2731,
+    11077,  9821,  8034, 10276,  9650,  5374, 11227,  8058,
+     6553,  4989,  7969,  6534,  3328, 12171,  9088,  3459,
+     8747, 11809,   726,  7197,  9545,  7837,  8577, 10530,
+     4043,  4177,  4896,  2426,  7698,   953,  1170,  5911,
+     3195,   544,  1635,  9048,  9664,   130,  7484,   355,
+    10984,  4278,  9198,  7901, 10938,  2197, 10963, 12144,
+     8668,  1022, 10436,  9408,  2975,  3949,  9542,  3694,
+     1479,  2525,  9238,  1696,  7266,  6522, 11334,  8357,
+     1646, 11950, 11112,  9000,  4821,  9452,  2294,  9741,
+     8155,  5331,  1000,  4632,  6512,  9813,  9275,  3637,
+     8785,  2842,  4611,  2089,  9283,  2396,  3135,  3707,
+     7143,  8705,  2963, 11955,  5728,  8541,  9970,  4890,
+     6429,  5791,  9521, 11560,   949,  7935,  8736,  8907,
+    11567, 10616, 12208, 11029,  4978,  5067,  5086,  6747,
+     2545, 12280, 12149,  3284,   563,  3296,  4846,  7110,
+        1,  7094,  1381,  2481,  2366,  9919, 10861,  8193,
+     6461,  8653,   827,  4885, 11499, 11813,  2731,  6250,
+    11077,  4372,  9821,  3833,  8034,  9103, 10276, 11885,
+     9650,  7370,  5374,  2678, 11227, 11618,  8058,  7313,
+     6553,  9984,  4989, 11935,  7969,  2686,  6534, 10377,
+     3328,  1663, 12171, 10849,  9088,  2178,  3459,  9302,
+     8747,  4057, 11809, 11222,   726,  1153,  7197,  7012,
+     9545, 12129,  7837,   242,  8577,  2399, 10530,  7278,
+     4043, 10805,  4177,  2859,  4896,  3510,  2426,  5444,
+     7698,  9585,   953,  1632,  1170,  4905,  5911,  2566,
+     3195,  4414,   544,   390,  1635, 10163,  9048,  1065,
+     9664,  8374,   130,   545,  7484,  3016,   355, 11414,
+    10984,  8236,  4278,  6591,  9198,  8311,  7901, 11854,
+    10938,  1426,  2197,  3066, 10963,  6730, 12144,  3646,
+     8668,  8925,  1022, 11847, 10436,  4048,  9408, 11082,
+     2975,  4437,  3949,  7575,  9542,  3136,  3694,  5088,
+     1479,  9509,  2525,  7277,  9238,  9424,  1696,   493,
+     7266,  4938,  6522, 11272, 11334,  8758,  8357,  2422,
+     1646,  2174, 11950,  3778, 11112,  6882,  9000,  4645,
+     4821, 12176,  9452,  3704,  2294,  3000,  9741,  1607,
+     8155,  7247,  5331,  4861,  1000,  3247,  4632, 10911,
+     6512,  1777,  9813,  8526,  9275,  1544,  3637,  6267,
+     8785,  3271,  2842,  7188,  4611,  9405,  2089, 11121,
+     9283,  9140,  2396,  1537,  3135,  8889,  3707, 11287,
+     7143,  4895,  8705,  1045,  2963,  5332, 11955,  2381,
+     5728,  6998,  8541,  5084,  9970,  3985,  4890, 10102,
+     6429,  2847,  5791, 11516,  9521,  1630, 11560,  2143,
+      949, 10123,  7935,  7270,  8736, 12046,  8907,  8509,
+    11567,  2645, 10616,  2912, 12208,  2969, 11029,  7952,
+     4978,  7635,  5067, 12262,  5086, 11869,  6747,  9852,
+     2545,  1689, 12280,  9888, 12149,  2249,  3284,  9041,
+      563, 12286,  3296,  8146,  4846,  5191,  7110,  4284,
+        1,  8209,  7094,  9364,  1381,  6171,  2481,  3656,
+     2366,  5874,  9919, 10446, 10861,  1254,  8193, 10929,
+     6461, 11314,  8653,  2057,   827,  5315,  4885,  1958,
+    11499,  3482, 11813,   418,  2731,  3643,  6250, 11964,
+    11077,  4782,  4372,  5868,  9821,  4749,  3833,  5257,
+     8034,  8332,  9103,  9407, 10276,  3988, 11885,  1594,
+     9650,  1956,  7370,  1583,  5374,  9945,  2678, 10970,
+    11227,  7232, 11618,  9522,  8058,  8724,  7313,   652,
+     6553,  4624,  9984,  3315,  4989,  7753, 11935,  6507,
+     7969,  3174,  2686,  2908,  6534,  8410, 10377,  9734,
+     3328,  1105,  1663, 10777, 12171,  2169, 10849,  1058,
+     9088,  9162,  2178, 10996,  3459,  7341,  9302,  8561,
+     8747, 11785,  4057,   723, 11809,  4449, 11222,  3054,
+      726, 11858,  1153,  2447,  7197,  6950,  7012, 12121,
+     9545,   241, 12129,  1483,  7837,  1018,   242,  8049,
+     8577,  4912,  2399,  6413, 10530, 12233,  7278,  8273,
+     4043,  8687, 10805,  8532,  4177,  2683,  2859,  9830,
+     4896,  6234,  3510,  8174,  2426,  6854,  5444,  6992,
+     7698,  2844,  9585,  9087,   953,  7373,  1632,  2078,
+     1170,  6821,  4905,  6381,  5911,  6427,  2566,   948,
+     3195,  3029,  4414,  6554,   544,  4789,   390,  6370,
+     1635,  2127, 10163, 10335,  9048,   316,  1065,  5106,
+     9664,  6281,  8374,  9789,   130, 10316,   545,   709,
+     7484,  3445,  3016,  8298,   355,  1702, 11414,  6190,
+    10984,  3263,  8236,  7535,  4278,  8429,  6591,  9341,
+     9198,  2766,  8311,  8760,  7901, 10256, 11854,  5184,
+    10938,  6608,  1426,  6906,  2197,  7210,  3066,   922,
+    10963,  2920,  6730,  7515, 12144,  1728,  3646,  6299,
+     8668,  2302,  8925, 10596,  1022,  8500, 11847,  9166,
+    10436,  2505,  4048,   576,  9408,  6196, 11082,  8960,
+     2975,  3532,  4437, 11026,  3949, 11248,  7575,   835,
+     9542,   192,  3136, 10258,  3694,  7083,  5088,  9370,
+     1479, 11868,  9509, 11942,  2525,  8471,  7277,    64,
+     9238, 11612,  9424,  2361,  1696, 11316,   493,  3956,
+     7266,  8077,  4938,  6920,  6522,  8214, 11272,  7967,
+    11334,   787,  8758,  3772,  8357,  5415,  2422, 10885,
+     1646,  6403,  2174,  2738, 11950,  6752,  3778,  8455,
+    11112,  9450,  6882,  1805,  9000, 11821,  4645, 10327,
+     4821,  5009, 12176,  6347,  9452, 11011,  3704,  3150,
+     2294,  4698,  3000, 12133,  9741, 11635,  1607,  5766,
+     8155,  6212,  7247, 11863,  5331,  1050,  4861,  1566,
+     1000, 12237,  3247, 12071,  4632,  1922, 10911,  6167,
+     6512, 12147,  1777,   350,  9813,   522,  8526,  4079,
+     9275,  8120,  1544,  4737,  3637,  6152,  6267,  4049,
+     8785,  4213,  3271,   174,  2842,  5456,  7188,  6803,
+     4611,  1579,  9405,  6147,  2089,  5446, 11121,  9597,
+     9283,    58,  9140,  5915,  2396,  6364,  1537,  8719,
+     3135,  2049,  8889, 10008,  3707,  3199, 11287,  8212,
+     7143,  6068,  4895, 10314,  8705, 11099,  1045,   683,
+     2963,  3336,  5332,  9259, 11955, 10930,  2381,  6119,
+     5728,  3438,  6998,  7796,  8541,  4324,  5084,  1112,
+     9970, 11279,  3985, 11836,  4890,  6136, 10102,  1146,
+     6429,  6695,  2847,  9634,  5791,  4467, 11516,  7856,
+     9521, 12138,  1630, 10238, 11560,   382,  2143,  6328,
+      949, 11404, 10123,  1489,  7935,  6715,  7270,  4046,
+     8736,  7509, 12046,  8320,  8907, 10302,  8509, 11994,
+    11567,  8689,  2645, 10431, 10616,  5445,  2912,  2503,
+    12208, 10966,  2969,  3434, 11029,  3998,  7952, 11089,
+     4978,  3477,  7635,  1815,  5067,  9027, 12262, 11848,
+     5086,  5241, 11869,  5429,  6747, 11889,  9852,  1159,
+     2545,   605,  1689,  3009, 12280, 12142,  9888,  1747,
+    12149,  5906,  2249,  3963,  3284,  8579,  9041,  4298,
+      563,  1003, 12286, 12240,  3296,  8775,  8146,  6065,
+     4846,  1321,  5191,  6956,  7110,  5529,  4284,  8527,
+};
+
+const uint16_t ntt1024_omega_powers_rev[1024] = {
+        0,     1,     1,  1479,     1,  1479,  4043,  7143,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+     8209, 11868,  8687,  6068,  4624,  6212,  3263,  8689,
+     4782,  6403,  3029,  6695, 11785,  4213,  2302,   605,
+    11314,  8077,  2844,  3438,  1105, 12147,  6608,  3477,
+     1956,  5009,  6281, 11404,   241,    58,  3532,  1003,
+     5874, 11612,  6234,  3336,  3174, 12237,  2766, 10966,
+     8332,  9450,  2127, 12138, 11858,  1579,  2505,  5906,
+     3482,   787,  6821, 11279,  9162,  8120,  2920,  5241,
+     7232,  4698,  3445,  7509,  4912,  2049,   192,  1321,
+     6171,  8471,  2683, 11099,  7753,  1050,  8429,  5445,
+     4749,  6752,  4789,  4467,  4449,  5456,  8500, 12142,
+     5315,  8214,  7373,  4324,  2169,   522,  7210,  9027,
+     9945, 11011, 10316,  6715,  1018,  6364, 11248,  8775,
+     1254, 11316,  6854, 10930,  8410,  1922, 10256,  3998,
+     3988, 11821,   316,   382,  6950,  5446,  6196,  8579,
+     3643,  5415,  6427,  6136,  7341,  6152,  1728, 11889,
+     8724, 11635,  1702, 10302, 12233,  3199,  7083,  5529,
+     9364, 11942,  8532, 10314,  3315, 11863,  7535, 10431,
+     5868,  2738,  6554,  9634,   723,   174, 10596,  3009,
+     2057,  6920,  9087,  7796, 10777,   350,  6906,  1815,
+     1583,  6347,  9789,  1489,  1483,  5915, 11026, 12240,
+    10446,  2361,  8174,  9259,  2908, 12071,  8760,  3434,
+     9407,  1805, 10335, 10238,  2447,  6147,   576,  3963,
+      418,  3772,  6381, 11836, 10996,  4737,  7515,  5429,
+     9522, 12133,  8298,  8320,  6413, 10008, 10258,  6956,
+     3656,    64,  9830,   683,  6507,  1566,  9341,  2503,
+     5257,  8455,  6370,  7856,  3054,  6803,  9166,  1747,
+     1958,  7967,  2078,  1112,  1058,  4079,   922, 11848,
+    10970,  3150,   709,  4046,  8049,  8719,   835,  6065,
+    10929,  3956,  6992,  6119,  9734,  6167,  5184, 11089,
+     1594, 10327,  5106,  6328, 12121,  9597,  8960,  4298,
+    11964, 10885,   948,  1146,  8561,  4049,  6299,  1159,
+      652,  5766,  6190, 11994,  8273,  8212,  9370,  8527,
+};
+
+const uint16_t ntt1024_inv_omega_powers[1024] = {
+        0,     1,     1, 10810,     1,  5146, 10810,  8246,
+        1,   722,  5146,  4134, 10810,  1305,  8246,  5736,
+        1,  9744,   722,  5860,  5146,  3504,  4134, 10643,
+    10810,  3621,  1305,  9094,  8246,  3542,  5736,  1212,
+        1, 11726,  9744,  7311,   722, 11340,  5860,  6561,
+     5146,  3006,  3504,  5777,  4134,  7468, 10643,  5023,
+    10810,  9314,  3621,  1351,  1305,  2625,  9094,  4591,
+     8246,  2744,  3542,  8961,  5736,  2639,  1212,  5828,
+        1,  7443, 11726,   140,  9744,  7203,  7311,    81,
+      722,  3553, 11340,  2768,  5860,  2319,  6561,  9326,
+     5146,  9154,  3006,  7678,  3504,  3014,  5777, 11289,
+     4134,  9995,  7468,  1177, 10643,   955,  5023,  3051,
+    10810,  2747,  9314,  1853,  3621,  1326,  1351,  3091,
+     1305,  4805,  2625, 10654,  9094, 11119,  4591,  7393,
+     8246,  3712,  2744, 11563,  3542,  3201,  8961,  4320,
+     5736,  1062,  2639,  4255,  1212,   790,  5828,  9923,
+        1,  5179,  7443,  8993, 11726,  9005,   140,     9,
+     9744,  5542,  7203,  7222,  7311,  1260,    81,  1673,
+      722,  3382,  3553,  4354, 11340,   729,  2768,  6498,
+     5860,  7399,  2319,  3748,  6561,   334,  9326,  3584,
+     5146,  8582,  9154,  9893,  3006, 10200,  7678,  9447,
+     3504,  8652,  3014,  2476,  5777,  7657, 11289,  6958,
+     4134,  2548,  9995,  2837,  7468,  3289,  1177,   339,
+    10643,  3932,   955,  5767,  5023, 10593,  3051,  9764,
+    10810,  8595,  2747,  8340,  9314,  2881,  1853, 11267,
+     3621,   145,  1326, 10092,  1351,  4388,  3091,  8011,
+     1305, 11934,  4805, 12159,  2625,  3241, 10654, 11745,
+     9094,  6378, 11119, 11336,  4591,  9863,  7393,  8112,
+     8246,  1759,  3712,  4452,  2744,  5092, 11563,   480,
+     3542,  8830,  3201,   118,  8961,  5755,  4320,  7300,
+     5736,  4231,  1062,  6915,  2639,  2013,  4255,  2468,
+     1212,  9558,   790, 11462,  5828,  1428,  9923, 10908,
+        1,  8005,  5179,  7098,  7443,  4143,  8993,     3,
+    11726,  3248,  9005, 10040,   140,  2401,     9, 10600,
+     9744,  2437,  5542,   420,  7203,    27,  7222,  4654,
+     7311,  4337,  1260,  9320,    81,  9377,  1673,  9644,
+      722,  3780,  3382,   243,  3553,  5019,  4354,  2166,
+    11340, 10146,   729, 10659,  2768,   773,  6498,  9442,
+     5860,  2187,  7399,  8304,  2319,  7205,  3748,  5291,
+     6561,  9908,   334,  6957,  9326, 11244,  3584,  7394,
+     5146,  1002,  8582,  3400,  9154, 10752,  9893,  3149,
+     3006,  1168, 10200,  2884,  7678,  5101,  9447,  9018,
+     3504,  6022,  8652, 10745,  3014,  3763,  2476, 10512,
+     5777,  1378,  7657,  9042, 11289,  7428,  6958,  5042,
+     4134, 10682,  2548,  9289,  9995,  8585,  2837,   113,
+     7468,  7644,  3289,  5407,  1177,  8511,   339, 10115,
+    10643,  9867,  3932,  3531,   955,  1017,  5767,  7351,
+     5023, 11796, 10593,  2865,  3051,  5012,  9764,  2780,
+    10810,  7201,  8595,  9153,  2747,  4714,  8340,  7852,
+     9314,  1207,  2881,  8241,  1853,   442, 11267,  3364,
+     3621,  8643,   145,  5559,  1326,  9223, 10092, 10863,
+     1351,   435,  4388,  3978,  3091,  5698,  8011,  4053,
+     1305,   875, 11934,  9273,  4805, 11744, 12159,  3915,
+     2625, 11224,  3241,  2126, 10654, 11899, 11745,  7875,
+     9094,  9723,  6378,  7384, 11119, 10657, 11336,  2704,
+     4591,  6845,  9863,  8779,  7393,  9430,  8112,  1484,
+     8246,  5011,  1759,  9890,  3712, 12047,  4452,   160,
+     2744,  5277,  5092, 11136, 11563,  1067,   480,  8232,
+     3542,  2987,  8830, 10111,  3201,  1440,   118, 10626,
+     8961,  1912,  5755,  9603,  4320,   354,  7300,  2305,
+     5736,  4976,  4231,   671,  1062,  9611,  6915,  4919,
+     2639,   404,  2013,  3186,  4255,  8456,  2468,  7917,
+     1212,  6039,  9558,   476,   790,  7404, 11462,  3636,
+     5828,  4096,  1428,  2370,  9923,  9808, 10908,  5195,
+        1,  3762,  8005,  6760,  5179,  5333,  7098, 10968,
+     7443,  6224,  4143,  3514,  8993,    49,     3, 11286,
+    11726,  7991,  3248,  3710,  9005,  8326, 10040,  6383,
+      140, 10542,  2401,   147,     9,  9280, 10600, 11684,
+     9744, 11130,  2437,   400,  5542,  6860,   420,  7048,
+     7203,   441,    27,  3262,  7222, 10474,  4654,  8812,
+     7311,  1200,  4337,  8291,  1260,  8855,  9320,  1323,
+       81,  9786,  9377,  6844,  1673,  1858,  9644,  3600,
+      722,   295,  3780,  1987,  3382,  3969,   243,  4780,
+     3553,  8243,  5019,  5574,  4354, 10800,  2166,   885,
+    11340,  5961, 10146, 11907,   729,  2051, 10659,   151,
+     2768,  4433,   773,  7822,  6498,  2655,  9442,  5594,
+     5860, 11143,  2187,  6153,  7399,   453,  8304,  1010,
+     2319, 11177,  7205,  7965,  3748,  4493,  5291,  8851,
+     6561,  6170,  9908,  1359,   334,  3030,  6957,  8953,
+     9326, 11606, 11244,  1190,  3584,  1975,  7394,  6221,
+     5146,  4077,  1002,  9090,  8582,  2281,  3400, 10240,
+     9154,  3570, 10752,  5925,  9893,  6374,  3149, 12231,
+     3006,  2692,  1168,  6843, 10200,  6142,  2884, 10710,
+     7678,  5486,  5101,  6833,  9447, 12115,  9018,  8076,
+     3504,  8240,  6022,  6137,  8652,  7552, 10745,  4169,
+     3014,  8210,  3763, 11767,  2476, 11939, 10512,   142,
+     5777,  6122,  1378, 10367,  7657,   218,  9042,    52,
+    11289, 10723,  7428, 11239,  6958,   426,  5042,  6077,
+     4134,  6523, 10682,   654,  2548,   156,  9289,  7591,
+     9995,  9139,  8585,  1278,  2837,  5942,   113,  7280,
+     7468,  1962,  7644,   468,  3289, 10484,  5407,  2839,
+     1177,  3834,  8511,  5537,   339,  9551, 10115,  5886,
+    10643,  1404,  9867,  6874,  3932,  8517,  3531, 11502,
+      955,  4322,  1017,  4075,  5767,  5369,  7351,  4212,
+     5023,  8333, 11796,   973, 10593,  9928,  2865,   677,
+     3051, 12225,  5012,  3818,  9764,   347,  2780,   421,
+    10810,  2919,  7201,  5206,  8595,  2031,  9153, 12097,
+     2747, 11454,  4714,  1041,  8340,  1263,  7852,  8757,
+     9314,  3329,  1207,  6093,  2881, 11713,  8241,  9784,
+     1853,  3123,   442,  3789, 11267,  1693,  3364,  9987,
+     3621,  5990,  8643, 10561,   145,  4774,  5559,  9369,
+     1326, 11367,  9223,  5079, 10092,  5383, 10863,  5681,
+     1351,  7105,   435,  2033,  4388,  3529,  3978,  9523,
+     3091,  2948,  5698,  3860,  8011,  4754,  4053,  9026,
+     1305,  6099,   875, 10587, 11934,  3991,  9273,  8844,
+     4805, 11580, 11744,  1973, 12159,  2500,  3915,  6008,
+     2625,  7183, 11224, 11973,  3241,  1954,  2126, 10162,
+    10654,  5919, 11899,  7500, 11745,  5735,  7875,  9260,
+     9094, 11341,  9723,  5862,  6378,  5908,  7384,  5468,
+    11119, 10211, 10657,  4916, 11336,  3202,  2704,  9445,
+     4591,  5297,  6845,  5435,  9863,  4115,  8779,  6055,
+     7393,  2459,  9430,  9606,  8112,  3757,  1484,  3602,
+     8246,  4016,  5011,    56,  1759,  5876,  9890,  7377,
+     3712,  4240, 12047, 11271,  4452, 10806,   160, 12048,
+     2744,   168,  5277,  5339,  5092,  9842, 11136,   431,
+    11563,  9235,  1067,  7840,   480, 11566,  8232,   504,
+     3542,  3728,  2987,  4948,  8830,  1293, 10111,  3127,
+     3201, 11231,  1440, 10120,   118,  1512, 10626, 11184,
+     8961,  2555,  1912,  3879,  5755,  9381,  9603,  9115,
+     4320,  5782,   354,  4536,  7300,  8974,  2305,  7665,
+     5736, 11637,  4976,  3565,  4231,  2767,   671,  5057,
+     1062,  1319,  9611,  2344,  6915, 10706,  4919, 10333,
+     2639, 10695,   404,  8301,  2013,  2882,  3186,  3957,
+     4255,  7032,  8456,  7540,  2468,  6421,  7917,  7507,
+     1212,   325,  6039,  8646,  9558, 11871,   476,  8807,
+      790, 10331,  7404,  6974, 11462, 10232,  3636,   975,
+     5828,  1360,  4096, 11035,  1428,  1843,  2370,  6415,
+     9923,  8633,  9808,  6118, 10908,  2925,  5195,  4080,
+};
+
+const uint16_t ntt1024_inv_omega_powers_rev[1024] = {
+        0,     1,     1, 10810,     1, 10810,  5146,  8246,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099,  6523, 11637,
+    11130,  5990,  8240,  3728, 11143, 11341,  1404,   325,
+     7991,  3329,  2692,   168,  5961,  7183,  1962, 10695,
+     1200,  7105,  6122,  2555,  6170,  5297,  8333,  1360,
+     6224, 11454,  3570,  4240,  8243, 11580,  9139,  1319,
+      441, 11367,  8210, 11231, 11177, 10211,  4322, 10331,
+    10542,  3123,  5486,  9235,  4433,  5919,  3834,  7032,
+     9786,  2948, 10723,  5782, 11606,  2459, 12225,  8633,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+     6860,  4774,  7552,  1293,   453,  5908,  8517, 11871,
+     8326, 11713,  6142,  9842,  2051,  1954, 10484,  2882,
+     8855,  3529,   218,  9381,  3030,  4115,  9928,  1843,
+       49,  1263,  6374, 10806, 10800,  2500,  5942, 10706,
+    10474,  5383, 11939,  1512,  4493,  3202,  5369, 10232,
+     9280,  1693, 12115, 11566,  2655,  5735,  9551,  6421,
+     1858,  4754,   426,  8974,  1975,  3757,   347,  2925,
+     6760,  5206,  9090,    56,  1987, 10587,   654,  3565,
+      400, 10561,  6137,  4948,  6153,  5862,  6874,  8646,
+     3710,  6093,  6843,  5339, 11907, 11973,   468,  8301,
+     8291,  2033, 10367,  3879,  1359,  5435,   973, 11035,
+     3514,  1041,  5925, 11271,  5574,  1973,  1278,  2344,
+     3262,  5079, 11767, 10120,  7965,  4916,  4075,  6974,
+      147,  3789,  6833,  7840,  7822,  7500,  5537,  7540,
+     6844,  3860, 11239,  4536,  1190,  9606,  3818,  6118,
+    10968, 12097, 10240,  7377,  4780,  8844,  7591,  5057,
+     7048,  9369,  4169,  3127,  1010,  5468, 11502,  8807,
+     6383,  9784, 10710,   431,   151, 10162,  2839,  3957,
+     1323,  9523,    52,  9115,  8953,  6055,   677,  6415,
+    11286,  8757, 12231, 12048,   885,  6008,  7280, 10333,
+     8812,  5681,   142, 11184,  8851,  9445,  4212,   975,
+    11684,  9987,  8076,   504,  5594,  9260,  5886,  7507,
+     3600,  9026,  6077,  7665,  6221,  3602,   421,  4080,
+};
+
+const uint16_t ntt1024_mixed_powers[1024] = {
+        0,  1479,  4043,  7143,  6553, 10984,  8155, 11567,
+    11077,  8747,  3195,  8668,  1646,  8785,  6429,  2545,
+     6461,  9650,  3328,  9545,  7698,  9664, 10938,  2975,
+     7266,  4821,  6512,  9283,  5728,   949,  4978,   563,
+     2366, 11499,  8034, 11227,  7969,  9088,   726,  8577,
+     4896,  1170,  1635,  7484,  9198, 10963, 10436,  9542,
+     9238, 11334, 11112,  2294,  1000,  9275,  4611,  3135,
+     2963,  9970,  9521,  8736, 12208,  5086, 12149,  4846,
+     1381, 10861,   827,  2731,  9821, 10276,  5374,  8058,
+     4989,  6534, 12171,  3459, 11809,  7197,  7837, 10530,
+     4177,  2426,   953,  5911,   544,  9048,   130,   355,
+     4278,  7901,  2197, 12144,  1022,  9408,  3949,  3694,
+     2525,  1696,  6522,  8357, 11950,  9000,  9452,  9741,
+     5331,  4632,  9813,  3637,  2842,  2089,  2396,  3707,
+     8705, 11955,  8541,  4890,  5791, 11560,  7935,  8907,
+    10616, 11029,  5067,  6747, 12280,  3284,  3296,  7110,
+     7094,  2481,  9919,  8193,  8653,  4885, 11813,  6250,
+     4372,  3833,  9103, 11885,  7370,  2678, 11618,  7313,
+     9984, 11935,  2686, 10377,  1663, 10849,  2178,  9302,
+     4057, 11222,  1153,  7012, 12129,   242,  2399,  7278,
+    10805,  2859,  3510,  5444,  9585,  1632,  4905,  2566,
+     4414,   390, 10163,  1065,  8374,   545,  3016, 11414,
+     8236,  6591,  8311, 11854,  1426,  3066,  6730,  3646,
+     8925, 11847,  4048, 11082,  4437,  7575,  3136,  5088,
+     9509,  7277,  9424,   493,  4938, 11272,  8758,  2422,
+     2174,  3778,  6882,  4645, 12176,  3704,  3000,  1607,
+     7247,  4861,  3247, 10911,  1777,  8526,  1544,  6267,
+     3271,  7188,  9405, 11121,  9140,  1537,  8889, 11287,
+     4895,  1045,  5332,  2381,  6998,  5084,  3985, 10102,
+     2847, 11516,  1630,  2143, 10123,  7270, 12046,  8509,
+     2645,  2912,  2969,  7952,  7635, 12262, 11869,  9852,
+     1689,  9888,  2249,  9041, 12286,  8146,  5191,  4284,
+     8209,  9364,  6171,  3656,  5874, 10446,  1254, 10929,
+    11314,  2057,  5315,  1958,  3482,   418,  3643, 11964,
+     4782,  5868,  4749,  5257,  8332,  9407,  3988,  1594,
+     1956,  1583,  9945, 10970,  7232,  9522,  8724,   652,
+     4624,  3315,  7753,  6507,  3174,  2908,  8410,  9734,
+     1105, 10777,  2169,  1058,  9162, 10996,  7341,  8561,
+    11785,   723,  4449,  3054, 11858,  2447,  6950, 12121,
+      241,  1483,  1018,  8049,  4912,  6413, 12233,  8273,
+     8687,  8532,  2683,  9830,  6234,  8174,  6854,  6992,
+     2844,  9087,  7373,  2078,  6821,  6381,  6427,   948,
+     3029,  6554,  4789,  6370,  2127, 10335,   316,  5106,
+     6281,  9789, 10316,   709,  3445,  8298,  1702,  6190,
+     3263,  7535,  8429,  9341,  2766,  8760, 10256,  5184,
+     6608,  6906,  7210,   922,  2920,  7515,  1728,  6299,
+     2302, 10596,  8500,  9166,  2505,   576,  6196,  8960,
+     3532, 11026, 11248,   835,   192, 10258,  7083,  9370,
+    11868, 11942,  8471,    64, 11612,  2361, 11316,  3956,
+     8077,  6920,  8214,  7967,   787,  3772,  5415, 10885,
+     6403,  2738,  6752,  8455,  9450,  1805, 11821, 10327,
+     5009,  6347, 11011,  3150,  4698, 12133, 11635,  5766,
+     6212, 11863,  1050,  1566, 12237, 12071,  1922,  6167,
+    12147,   350,   522,  4079,  8120,  4737,  6152,  4049,
+     4213,   174,  5456,  6803,  1579,  6147,  5446,  9597,
+       58,  5915,  6364,  8719,  2049, 10008,  3199,  8212,
+     6068, 10314, 11099,   683,  3336,  9259, 10930,  6119,
+     3438,  7796,  4324,  1112, 11279, 11836,  6136,  1146,
+     6695,  9634,  4467,  7856, 12138, 10238,   382,  6328,
+    11404,  1489,  6715,  4046,  7509,  8320, 10302, 11994,
+     8689, 10431,  5445,  2503, 10966,  3434,  3998, 11089,
+     3477,  1815,  9027, 11848,  5241,  5429, 11889,  1159,
+      605,  3009, 12142,  1747,  5906,  3963,  8579,  4298,
+     1003, 12240,  8775,  6065,  1321,  6956,  5529,  8527,
+     1014,  4273,  4251,  7988, 11677,  2293,  8778,  8195,
+     2769,  8360,  5464, 11415,  2110,  5789,   338,  9617,
+     1417,  6759, 12085,  8957,  2926,  6828,   923,  6883,
+    10014,  3805,  8896,  6026,  4209,  7302,  8665,  2253,
+    12221,  7082,  9168,  2276,  4404, 10487,  3338,  9461,
+    11158,  6105,  1403,  2434, 11081,   751,  8170,  6457,
+     3056,  4855,  1468,  7592,  5209,  7250, 11912,  2035,
+     4564,  9004,  7790,  8443, 10916, 10345,  5115,  9811,
+     8682,  6627,  9929,  6513,  8067,  8871,  9714, 11194,
+     6693, 11007,  7735, 11641,  1705, 11463,  2894,  2209,
+     7406,  2171,  2689,  2957,  3238, 11924,  2231,  3669,
+    10771, 12073,  8761,  3821,  5061,  8929,  6565,  4820,
+     9089,  5082,  9272,  8071,  4840,  1223, 11783, 12217,
+    11113,  5370,  1687, 11169, 10381,  5703,  7126,  1694,
+     7187, 10883,  9806,  4504,  8024, 12265, 11897,  1790,
+     8755,  3723, 11653,  1901, 10568,  4661,  6492,  7724,
+     7365,  9694,  6771, 12281,  8062,  4693, 11111,  1241,
+    12077,  4730,  7619,  5650,  2164,  6671,  2455, 11424,
+     2257,  8190, 10880,  9757,  7800,  4510,  8122,  5673,
+     6636, 10076,  8914,  6320,  9011,  3808,  8945,  2730,
+     7723, 11445,  2600,  9696, 10900,  1891,  2212,  7455,
+    11164,  6203,  7100,  9462,  7078,   910, 10767,  3815,
+     4963,  3232, 11826,  8823,  8930,  2485, 11914,  6164,
+     6463,  3154, 10552,  8496,  3589,  5368,  9847,  9270,
+     3942,  2941,  7073,  9021, 12164,  6151, 10347,  9244,
+    11710,  2832,  9389,  9982, 11475,  3090,  1314,  9173,
+     6454,  3007,  8151, 10243,  3449, 11274, 12096,   944,
+     7226, 11520,  3825,  1030,   438,  7154, 10344,  9195,
+     2717, 11607,  5246,  3758,  4032,  4411,  6505,  3840,
+     1275,  8536,   146,  6481,  3448,  3065,  5002,  3869,
+     5845,  5349,  1344,  9663, 10361,  1280,   425, 11038,
+     4145, 10353,  9342,  5118,  9860,  5386, 10141,  1783,
+      448,  3221,  7550,  4523,  4238, 11872,  5478,  3451,
+     3114,  1706,  7383,  9988, 11573,  8787,  8342,  5170,
+     6613,  5604,  5509, 12150,  1826,  9343,  1038,  4665,
+     2461, 11522,  7954,  2929,  6877,  9916, 10397,  1868,
+    10029,  4050,  4705, 11307,   346,  1555,  9013,  7937,
+    10844,  9169, 10485, 11498,  7562,  4719,  3343,  1350,
+     9761,  3769,  8308,  8711, 11197,  6742,  7711, 11249,
+     3495,  7929,  6617,  1573,  9307,   450,  7350,  9449,
+    10962,  7000, 11925, 10440, 10763,  7846,  1165,  2643,
+     6302,  8717, 11295,   150,  2450,  7246,  3654, 10526,
+     3975,  3480,  7684, 10808,  8581,   881,  6197,  7002,
+     3765,    50,  4913, 10608,  1218,  7605,  1325,  1160,
+    10754,  7699, 11053,  4390,  6162,  2334,  1255,  4113,
+     5734,  3536,   406,  2535,  4538,  4483,  7681, 10759,
+    11877,  9656,  2054,   778,  8611,  1371, 10104,  5275,
+     8328,   845,  5609,  9687, 10753, 11779,  3959,  7315,
+     4781,  8452, 11063,   457,  3368,  9951,  2776,  4378,
+     5966,  3229, 11777, 12119,  5416, 10631,  5690, 11010,
+     7784,  8345,  5219,  3317,  9118,  9652,  6085,  9269,
+     8022,  8136,  9998,  7640,  5993,  3670,  6691,  6878,
+     5836,  5202, 11232, 11410, 10221,  7186,  2674,  2712,
+     7429,  6643,  6094,  9416, 10423,  6389, 10138,  1734,
+     3744, 11996,  3407, 10588,  9084,   904, 10669, 10407,
+    10224,  7235, 11667,  6226, 11572,   578,  1248,  8095,
+     5232, 11722,  3028,  8494, 11749,  3469,  3408,  6508,
+     3889, 10268, 12050,  4289,   416, 10891,  1744, 12100,
+     9202, 11024, 12109,  9349,  1136, 10362,  9489,  7519,
+     8113,  5526,  4235, 11823,  8774, 12226, 11260,  7771,
+    12229, 11309,  4475,  3454,  3163, 10699, 10897,  1842,
+     5508,  3941,  7021, 12268, 11946, 10783, 12269,  7866,
+     5588,  9344,  9247, 11759, 11825,   614,  1836,  5410,
+    10533, 12282,  3982, 11787,  8186,  2622,  5959,  7211,
+};
+
+const uint16_t ntt1024_mixed_powers_rev[1024] = {
+        0,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+     8209, 11868,  8687,  6068,  4624,  6212,  3263,  8689,
+     4782,  6403,  3029,  6695, 11785,  4213,  2302,   605,
+    11314,  8077,  2844,  3438,  1105, 12147,  6608,  3477,
+     1956,  5009,  6281, 11404,   241,    58,  3532,  1003,
+     5874, 11612,  6234,  3336,  3174, 12237,  2766, 10966,
+     8332,  9450,  2127, 12138, 11858,  1579,  2505,  5906,
+     3482,   787,  6821, 11279,  9162,  8120,  2920,  5241,
+     7232,  4698,  3445,  7509,  4912,  2049,   192,  1321,
+     6171,  8471,  2683, 11099,  7753,  1050,  8429,  5445,
+     4749,  6752,  4789,  4467,  4449,  5456,  8500, 12142,
+     5315,  8214,  7373,  4324,  2169,   522,  7210,  9027,
+     9945, 11011, 10316,  6715,  1018,  6364, 11248,  8775,
+     1254, 11316,  6854, 10930,  8410,  1922, 10256,  3998,
+     3988, 11821,   316,   382,  6950,  5446,  6196,  8579,
+     3643,  5415,  6427,  6136,  7341,  6152,  1728, 11889,
+     8724, 11635,  1702, 10302, 12233,  3199,  7083,  5529,
+     9364, 11942,  8532, 10314,  3315, 11863,  7535, 10431,
+     5868,  2738,  6554,  9634,   723,   174, 10596,  3009,
+     2057,  6920,  9087,  7796, 10777,   350,  6906,  1815,
+     1583,  6347,  9789,  1489,  1483,  5915, 11026, 12240,
+    10446,  2361,  8174,  9259,  2908, 12071,  8760,  3434,
+     9407,  1805, 10335, 10238,  2447,  6147,   576,  3963,
+      418,  3772,  6381, 11836, 10996,  4737,  7515,  5429,
+     9522, 12133,  8298,  8320,  6413, 10008, 10258,  6956,
+     3656,    64,  9830,   683,  6507,  1566,  9341,  2503,
+     5257,  8455,  6370,  7856,  3054,  6803,  9166,  1747,
+     1958,  7967,  2078,  1112,  1058,  4079,   922, 11848,
+    10970,  3150,   709,  4046,  8049,  8719,   835,  6065,
+    10929,  3956,  6992,  6119,  9734,  6167,  5184, 11089,
+     1594, 10327,  5106,  6328, 12121,  9597,  8960,  4298,
+    11964, 10885,   948,  1146,  8561,  4049,  6299,  1159,
+      652,  5766,  6190, 11994,  8273,  8212,  9370,  8527,
+     1014,   448,  7365,  4781,  8682, 10962,  3942,  5232,
+    12221, 10029,  7723,  5836,  9089, 10754,  2717, 12229,
+     1417,  6613,  2257,  7784,  7406,  3975,  6454,  9202,
+     3056,  9761,  4963,  3744,  7187, 11877,  5845,  5588,
+     2769,  3114, 12077,  5966,  6693,  6302, 11710,  3889,
+    11158, 10844, 11164,  7429, 11113,  5734,  1275,  5508,
+    10014,  2461,  6636,  8022, 10771,  3765,  7226,  8113,
+     4564,  3495,  6463, 10224,  8755,  8328,  4145, 10533,
+    11677,  4238,  8062,  3368,  8067, 10763, 12164, 11749,
+     4404,   346, 10900, 10221,  4840,  6162,  4032,  3163,
+     2926,  1826,  7800,  9118,  3238,  8581,  3449,  1136,
+     5209, 11197,  8930,  9084,  8024,  8611, 10361, 11825,
+     2110, 11573,  2164,  5416,  1705,  2450, 11475,   416,
+    11081,  7562,  7078, 10423, 10381,  4538,  3448, 11946,
+     4209,  6877,  9011,  5993,  5061,  1218,   438,  8774,
+    10916,  9307,  3589, 11572, 10568, 10753,  9860,  8186,
+     4251,  7550,  6771, 11063,  9929, 11925,  7073,  3028,
+     9168,  4705,  2600, 11232,  9272, 11053,  5246,  4475,
+    12085,  5509, 10880,  5219,  2689,  7684,  8151, 12109,
+     1468,  8308, 11826,  3407,  9806,  2054,  1344,  9247,
+     5464,  7383,  7619, 11777,  7735, 11295,  9389, 12050,
+     1403, 10485,  7100,  6094,  1687,   406,   146,  7021,
+     8896,  7954,  8914,  9998,  8761,  4913,  3825,  4235,
+     7790,  6617, 10552, 11667, 11653,  5609,  9342,  3982,
+     8778,  5478, 11111,  2776,  9714,  1165, 10347,  3408,
+     3338,  9013,  2212,  2674, 11783,  1255,  6505, 10897,
+      923,  1038,  8122,  6085,  2231,  6197, 12096,  9489,
+    11912,  7711, 11914, 10669, 11897, 10104,   425,  1836,
+      338,  8342,  2455,  5690,  2894,  3654,  1314,  1744,
+     8170,  3343, 10767, 10138,  7126,  7681,  5002, 12269,
+     8665, 10397,  8945,  6691,  6565,  1325, 10344, 11260,
+     5115,  7350,  9847,  1248,  6492,  3959, 10141,  5959,
+     4273,  3221,  9694,  8452,  6627,  7000,  2941, 11722,
+     7082,  4050, 11445,  5202,  5082,  7699, 11607, 11309,
+     6759,  5604,  8190,  8345,  2171,  3480,  3007, 11024,
+     4855,  3769,  3232, 11996, 10883,  9656,  5349,  9344,
+     8360,  1706,  4730,  3229, 11007,  8717,  2832, 10268,
+     6105,  9169,  6203,  6643,  5370,  3536,  8536,  3941,
+     3805, 11522, 10076,  8136, 12073,    50, 11520,  5526,
+     9004,  7929,  3154,  7235,  3723,   845, 10353, 12282,
+     2293, 11872,  4693,  9951,  8871,  7846,  6151,  3469,
+    10487,  1555,  1891,  7186,  1223,  2334,  4411, 10699,
+     6828,  9343,  4510,  9652, 11924,   881, 11274, 10362,
+     7250,  6742,  2485,   904, 12265,  1371,  1280,   614,
+     5789,  8787,  6671, 10631, 11463,  7246,  3090, 10891,
+      751,  4719,   910,  6389,  5703,  4483,  3065, 10783,
+     7302,  9916,  3808,  3670,  8929,  7605,  7154, 12226,
+    10345,   450,  5368,   578,  4661, 11779,  5386,  2622,
+     7988,  4523, 12281,   457,  6513, 10440,  9021,  8494,
+     2276, 11307,  9696, 11410,  8071,  4390,  3758,  3454,
+     8957, 12150,  9757,  3317,  2957, 10808, 10243,  9349,
+     7592,  8711,  8823, 10588,  4504,   778,  9663, 11759,
+    11415,  9988,  5650, 12119, 11641,   150,  9982,  4289,
+     2434, 11498,  9462,  9416, 11169,  2535,  6481, 12268,
+     6026,  2929,  6320,  7640,  3821, 10608,  1030, 11823,
+     8443,  1573,  8496,  6226,  1901,  9687,  5118, 11787,
+     8195,  3451,  1241,  4378, 11194,  2643,  9244,  6508,
+     9461,  7937,  7455,  2712, 12217,  4113,  3840,  1842,
+     6883,  4665,  5673,  9269,  3669,  7002,   944,  7519,
+     2035, 11249,  6164, 10407,  1790,  5275, 11038,  5410,
+     9617,  5170, 11424, 11010,  2209, 10526,  9173, 12100,
+     6457,  1350,  3815,  1734,  1694, 10759,  3869,  7866,
+     2253,  1868,  2730,  6878,  4820,  1160,  9195,  7771,
+     9811,  9449,  9270,  8095,  7724,  7315,  1783,  7211,
+};
+
+const uint16_t ntt1024_inv_mixed_powers[1024] = {
+        0, 10810,  5146,  8246,   722,  4134,  1305,  5736,
+     9744,  5860,  3504, 10643,  3621,  9094,  3542,  1212,
+    11726,  7311, 11340,  6561,  3006,  5777,  7468,  5023,
+     9314,  1351,  2625,  4591,  2744,  8961,  2639,  5828,
+     7443,   140,  7203,    81,  3553,  2768,  2319,  9326,
+     9154,  7678,  3014, 11289,  9995,  1177,   955,  3051,
+     2747,  1853,  1326,  3091,  4805, 10654, 11119,  7393,
+     3712, 11563,  3201,  4320,  1062,  4255,   790,  9923,
+     5179,  8993,  9005,     9,  5542,  7222,  1260,  1673,
+     3382,  4354,   729,  6498,  7399,  3748,   334,  3584,
+     8582,  9893, 10200,  9447,  8652,  2476,  7657,  6958,
+     2548,  2837,  3289,   339,  3932,  5767, 10593,  9764,
+     8595,  8340,  2881, 11267,   145, 10092,  4388,  8011,
+    11934, 12159,  3241, 11745,  6378, 11336,  9863,  8112,
+     1759,  4452,  5092,   480,  8830,   118,  5755,  7300,
+     4231,  6915,  2013,  2468,  9558, 11462,  1428, 10908,
+     8005,  7098,  4143,     3,  3248, 10040,  2401, 10600,
+     2437,   420,    27,  4654,  4337,  9320,  9377,  9644,
+     3780,   243,  5019,  2166, 10146, 10659,   773,  9442,
+     2187,  8304,  7205,  5291,  9908,  6957, 11244,  7394,
+     1002,  3400, 10752,  3149,  1168,  2884,  5101,  9018,
+     6022, 10745,  3763, 10512,  1378,  9042,  7428,  5042,
+    10682,  9289,  8585,   113,  7644,  5407,  8511, 10115,
+     9867,  3531,  1017,  7351, 11796,  2865,  5012,  2780,
+     7201,  9153,  4714,  7852,  1207,  8241,   442,  3364,
+     8643,  5559,  9223, 10863,   435,  3978,  5698,  4053,
+      875,  9273, 11744,  3915, 11224,  2126, 11899,  7875,
+     9723,  7384, 10657,  2704,  6845,  8779,  9430,  1484,
+     5011,  9890, 12047,   160,  5277, 11136,  1067,  8232,
+     2987, 10111,  1440, 10626,  1912,  9603,   354,  2305,
+     4976,   671,  9611,  4919,   404,  3186,  8456,  7917,
+     6039,   476,  7404,  3636,  4096,  2370,  9808,  5195,
+     3762,  6760,  5333, 10968,  6224,  3514,    49, 11286,
+     7991,  3710,  8326,  6383, 10542,   147,  9280, 11684,
+    11130,   400,  6860,  7048,   441,  3262, 10474,  8812,
+     1200,  8291,  8855,  1323,  9786,  6844,  1858,  3600,
+      295,  1987,  3969,  4780,  8243,  5574, 10800,   885,
+     5961, 11907,  2051,   151,  4433,  7822,  2655,  5594,
+    11143,  6153,   453,  1010, 11177,  7965,  4493,  8851,
+     6170,  1359,  3030,  8953, 11606,  1190,  1975,  6221,
+     4077,  9090,  2281, 10240,  3570,  5925,  6374, 12231,
+     2692,  6843,  6142, 10710,  5486,  6833, 12115,  8076,
+     8240,  6137,  7552,  4169,  8210, 11767, 11939,   142,
+     6122, 10367,   218,    52, 10723, 11239,   426,  6077,
+     6523,   654,   156,  7591,  9139,  1278,  5942,  7280,
+     1962,   468, 10484,  2839,  3834,  5537,  9551,  5886,
+     1404,  6874,  8517, 11502,  4322,  4075,  5369,  4212,
+     8333,   973,  9928,   677, 12225,  3818,   347,   421,
+     2919,  5206,  2031, 12097, 11454,  1041,  1263,  8757,
+     3329,  6093, 11713,  9784,  3123,  3789,  1693,  9987,
+     5990, 10561,  4774,  9369, 11367,  5079,  5383,  5681,
+     7105,  2033,  3529,  9523,  2948,  3860,  4754,  9026,
+     6099, 10587,  3991,  8844, 11580,  1973,  2500,  6008,
+     7183, 11973,  1954, 10162,  5919,  7500,  5735,  9260,
+    11341,  5862,  5908,  5468, 10211,  4916,  3202,  9445,
+     5297,  5435,  4115,  6055,  2459,  9606,  3757,  3602,
+     4016,    56,  5876,  7377,  4240, 11271, 10806, 12048,
+      168,  5339,  9842,   431,  9235,  7840, 11566,   504,
+     3728,  4948,  1293,  3127, 11231, 10120,  1512, 11184,
+     2555,  3879,  9381,  9115,  5782,  4536,  8974,  7665,
+    11637,  3565,  2767,  5057,  1319,  2344, 10706, 10333,
+    10695,  8301,  2882,  3957,  7032,  7540,  6421,  7507,
+      325,  8646, 11871,  8807, 10331,  6974, 10232,   975,
+     1360, 11035,  1843,  6415,  8633,  6118,  2925,  4080,
+     5078,  6330,  9667,  4103,   502,  8307,     7,  1756,
+     6879, 10453, 11675,   464,   530,  3042,  2945,  6701,
+     4423,    20,  1506,   343,    21,  5268,  8348,  6781,
+    10447,  1392,  1590,  9126,  8835,  7814,   980,    60,
+     4518,  1029,    63,  3515,   466,  8054,  6763,  4176,
+     4770,  2800,  1927, 11153,  2940,   180,  1265,  3087,
+      189, 10545,  1398, 11873,  8000,   239,  2021,  8400,
+     5781,  8881,  8820,   540,  3795,  9261,   567,  7057,
+     4194, 11041, 11711,   717,  6063,   622,  5054,  2065,
+     1882,  1620, 11385,  3205,  1701,  8882,   293,  8545,
+    10555,  2151,  5900,  1866,  2873,  6195,  5646,  4860,
+     9577,  9615,  5103,  2068,   879,  1057,  7087,  6453,
+     5411,  5598,  8619,  6296,  4649,  2291,  4153,  4267,
+     3020,  6204,  2637,  3171,  8972,  7070,  3944,  4505,
+     1279,  6599,  1658,  6873,   170,   512,  9060,  6323,
+     7911,  9513,  2338,  8921, 11832,  1226,  3837,  7508,
+     4974,  8330,   510,  1536,  2602,  6680, 11444,  3961,
+     7014,  2185, 10918,  3678, 11511, 10235,  2633,   412,
+     1530,  4608,  7806,  7751,  9754, 11883,  8753,  6555,
+     8176, 11034,  9955,  6127,  7899,  1236,  4590,  1535,
+    11129, 10964,  4684, 11071,  1681,  7376, 12239,  8524,
+     5287,  6092, 11408,  3708,  1481,  4605,  8809,  8314,
+     1763,  8635,  5043,  9839, 12139,   994,  3572,  5987,
+     9646, 11124,  4443,  1526,  1849,   364,  5289,  1327,
+     2840,  4939, 11839,  2982, 10716,  5672,  4360,  8794,
+     1040,  4578,  5547,  1092,  3578,  3981,  8520,  2528,
+    10939,  8946,  7570,  4727,   791,  1804,  3120,  1445,
+     4352,  3276, 10734, 11943,   982,  7584,  8239,  2260,
+    10421,  1892,  2373,  5412,  9360,  4335,   767,  9828,
+     7624, 11251,  2946, 10463,   139,  6780,  6685,  5676,
+     7119,  3947,  3502,   716,  2301,  4906, 10583,  9175,
+     8838,  6811,   417,  8051,  7766,  4739,  9068, 11841,
+    10506,  2148,  6903,  2429,  7171,  2947,  1936,  8144,
+     1251, 11864, 11009,  1928,  2626, 10945,  6940,  6444,
+     8420,  7287,  9224,  8841,  5808, 12143,  3753, 11014,
+     8449,  5784,  7878,  8257,  8531,  7043,   682,  9572,
+     3094,  1945,  5135, 11851, 11259,  8464,   769,  5063,
+    11345,   193,  1015,  8840,  2046,  4138,  9282,  5835,
+     3116, 10975,  9199,   814,  2307,  2900,  9457,   579,
+     3045,  1942,  6138,   125,  3268,  5216,  9348,  8347,
+     3019,  2442,  6921,  8700,  3793,  1737,  9135,  5826,
+     6125,   375,  9804,  3359,  3466,   463,  9057,  7326,
+     8474,  1522, 11379,  5211,  2827,  5189,  6086,  1125,
+     4834, 10077, 10398,  1389,  2593,  9689,   844,  4566,
+     9559,  3344,  8481,  3278,  5969,  3375,  2213,  5653,
+     6616,  4167,  7779,  4489,  2532,  1409,  4099, 10032,
+      865,  9834,  5618, 10125,  6639,  4670,  7559,   212,
+    11048,  1178,  7596,  4227,     8,  5518,  2595,  4924,
+     4565,  5797,  7628,  1721, 10388,   636,  8566,  3534,
+    10499,   392,    24,  4265,  7785,  2483,  1406,  5102,
+    10595,  5163,  6586,  1908,  1120, 10602,  6919,  1176,
+       72,   506, 11066,  7449,  4218,  3017,  7207,  3200,
+     7469,  5724,  3360,  7228,  8468,  3528,   216,  1518,
+     8620, 10058,   365,  9051,  9332,  9600, 10118,  4883,
+    10080,  9395,   826, 10584,   648,  4554,  1282,  5596,
+     1095,  2575,  3418,  4222,  5776,  2360,  5662,  3607,
+     2478,  7174,  1944,  1373,  3846,  4499,  3285,  7725,
+    10254,   377,  5039,  7080,  4697, 10821,  7434,  9233,
+     5832,  4119, 11538,  1208,  9855, 10886,  6184,  1131,
+     2828,  8951,  1802,  7885, 10013,  3121,  5207,    68,
+    10036,  3624,  4987,  8080,  6263,  3393,  8484,  2275,
+     5406, 11366,  5461,  9363,  3332,   204,  5530, 10872,
+     2672, 11951,  6500, 10179,   874,  6825,  3929,  9520,
+     4094,  3511,  9996,   612,  4301,  8038,  8016, 11275,
+};
+
+const uint16_t ntt1024_inv_mixed_powers_rev[1024] = {
+        0, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099,  6523, 11637,
+    11130,  5990,  8240,  3728, 11143, 11341,  1404,   325,
+     7991,  3329,  2692,   168,  5961,  7183,  1962, 10695,
+     1200,  7105,  6122,  2555,  6170,  5297,  8333,  1360,
+     6224, 11454,  3570,  4240,  8243, 11580,  9139,  1319,
+      441, 11367,  8210, 11231, 11177, 10211,  4322, 10331,
+    10542,  3123,  5486,  9235,  4433,  5919,  3834,  7032,
+     9786,  2948, 10723,  5782, 11606,  2459, 12225,  8633,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+     6860,  4774,  7552,  1293,   453,  5908,  8517, 11871,
+     8326, 11713,  6142,  9842,  2051,  1954, 10484,  2882,
+     8855,  3529,   218,  9381,  3030,  4115,  9928,  1843,
+       49,  1263,  6374, 10806, 10800,  2500,  5942, 10706,
+    10474,  5383, 11939,  1512,  4493,  3202,  5369, 10232,
+     9280,  1693, 12115, 11566,  2655,  5735,  9551,  6421,
+     1858,  4754,   426,  8974,  1975,  3757,   347,  2925,
+     6760,  5206,  9090,    56,  1987, 10587,   654,  3565,
+      400, 10561,  6137,  4948,  6153,  5862,  6874,  8646,
+     3710,  6093,  6843,  5339, 11907, 11973,   468,  8301,
+     8291,  2033, 10367,  3879,  1359,  5435,   973, 11035,
+     3514,  1041,  5925, 11271,  5574,  1973,  1278,  2344,
+     3262,  5079, 11767, 10120,  7965,  4916,  4075,  6974,
+      147,  3789,  6833,  7840,  7822,  7500,  5537,  7540,
+     6844,  3860, 11239,  4536,  1190,  9606,  3818,  6118,
+    10968, 12097, 10240,  7377,  4780,  8844,  7591,  5057,
+     7048,  9369,  4169,  3127,  1010,  5468, 11502,  8807,
+     6383,  9784, 10710,   431,   151, 10162,  2839,  3957,
+     1323,  9523,    52,  9115,  8953,  6055,   677,  6415,
+    11286,  8757, 12231, 12048,   885,  6008,  7280, 10333,
+     8812,  5681,   142, 11184,  8851,  9445,  4212,   975,
+    11684,  9987,  8076,   504,  5594,  9260,  5886,  7507,
+     3600,  9026,  6077,  7665,  6221,  3602,   421,  4080,
+     5078, 10506,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, 11129,  7469,  5411,  9559, 10421, 10036,
+     4423,  8420,  1530, 10595, 10555,  8474, 10939,  5832,
+      189,  3116,  1763, 10080,  1279,   865,  7119,  2672,
+     6879,  1251,  7014, 10499,  1882,  6125,  1040, 10254,
+     4770, 11345,  5287,  8620,  3020,  6616,  7624,  5406,
+    10447,  8449,  8176,    72,  9577,  4834,  4352,  2828,
+     5781,  3045,  9646,  1095,  7911, 11048,  8838,  4094,
+      502,  7171,  2602, 10388,  6063,  3793, 10716,  3846,
+      466, 11259,  1681,  8468,  4649,  5969,  9360,  6263,
+       21,  5808,  9754,  1120,  2873,  2827,   791,  9855,
+     8000,  2307, 12139,   648,   170,  6639,  2301,   874,
+      530,  2626, 11511,  7785,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481,  9332,  8972,  2532,   139,  3332,
+     8835,  8531,  7899,  4218,   879,  2593,   982, 10013,
+     3795,  3268,  1849,  5776, 11832,     8,  7766,  4301,
+     9667,  6903,   510,  7628, 11711,  6921, 11839,  1944,
+       63,  5135,  4684,  3360,  8619,  8481,  2373,  4987,
+     1506,  9224,  7806,  6586,  5900, 11379,  7570, 11538,
+     1398,  9199,  5043,   826,  1658,  5618,  3502,  6500,
+    11675, 11009, 10918,    24, 11385,  9804,  5547,  5039,
+     1927,  1015, 11408,   365,  2637,  7779,  2946,  5461,
+     1590,  7878,  9955, 11066,  5103, 10398, 10734,  1802,
+     8820,  6138,  4443,  3418,  2338,  7596,   417,  9996,
+        7,  1936, 11444,  8566,  5054,  9135,  4360,  3285,
+     6763,   769, 12239,   216,  4153,  2213,   767,  8484,
+     8348,  3753,  8753,  6919,  5646,  6086,  3120,  6184,
+     2021,  9457,  3572,  1282,  9060,  7559, 10583,  3929,
+     2945,  6940,  2633,  1406,   293,  9057,  8520,  7434,
+     1265,  9282,  8809, 10118,  3944,  4099,  6685,  5530,
+      980,   682,  4590,  7207,  7087,   844,  8239,  5207,
+      567,  9348,  5289,  5662,  3837,  2595,  9068,  8016,
+     6330,  2148,  8330,  5797, 11041,  2442,  4939,  7174,
+     1029,  1945, 10964,  5724,  5598,  3344,  1892,  3624,
+       20,  7287,  4608,  5163,  2151,  1522,  8946,  4119,
+    10545, 10975,  8635,  9395,  6599,  9834,  3947, 11951,
+    10453, 11864,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, 10058,  6204,  4167, 11251, 11366,
+     1392,  5784, 11034,   506,  9615, 10077,  3276,  8951,
+     8881,  1942, 11124,  2575,  9513,  1178,  6811,  3511,
+     8307,  2947,  6680,   636,   622,  1737,  5672,  4499,
+     8054,  8464,  7376,  3528,  2291,  3375,  4335,  3393,
+     5268, 12143, 11883, 10602,  6195,  5189,  1804, 10886,
+      239,  2900,   994,  4554,   512,  4670,  4906,  6825,
+     3042, 10945, 10235,  2483,  8882,   463,  3981, 10821,
+      180,  4138,  4605,  9600,  7070,  1409,  6780,   204,
+     7814,  7043,  1236,  3017,  1057,  9689,  7584,  3121,
+     9261,  5216,   364,  2360,  1226,  5518,  4739,  8038,
+     4103,  2429,  1536,  1721,   717,  8700,  2982,  1373,
+     3515, 11851, 11071,  7228,  6296,  3278,  5412,  8080,
+      343,  8841,  7751,  1908,  1866,  5211,  4727,  1208,
+    11873,   814,  9839, 10584,  6873, 10125,   716, 10179,
+      464,  1928,  3678,  4265,  3205,  3359,  1092,  7080,
+    11153,  8840,  3708,  9051,  3171,  4489, 10463,  9363,
+     9126,  8257,  6127,  7449,  2068,  1389, 11943,  7885,
+      540,   125,  1526,  4222,  8921,  4227,  8051,   612,
+     1756,  8144,  3961,  3534,  2065,  5826,  8794,  7725,
+     4176,  5063,  8524,  1518,  4267,  5653,  9828,  2275,
+     6781, 11014,  6555,  1176,  4860,  1125,  1445,  1131,
+     8400,   579,  5987,  5596,  6323,   212,  9175,  9520,
+     6701,  6444,   412,  5102,  8545,  7326,  2528,  9233,
+     3087,  5835,  8314,  4883,  4505, 10032,  5676, 10872,
+       60,  9572,  1535,  3200,  6453,  4566,  2260,    68,
+     7057,  8347,  1327,  3607,  7508,  4924, 11841, 11275,
+};
+
@@ -0,0 +1,45 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#ifndef __NTT1024_TABLES_H
+#define __NTT1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt1024_psi = 1014;
+static const int32_t ntt1024_omega = 8209;
+static const int32_t ntt1024_inv_psi = 5078;
+static const int32_t ntt1024_inv_omega = 3762;
+static const int32_t ntt1024_inv_n = 12277;
+
+/*
+ * POWERS OF PSI
+ */
+extern const uint16_t ntt1024_psi_powers[1024];
+extern const uint16_t ntt1024_inv_psi_powers[1024];
+extern const uint16_t ntt1024_scaled_inv_psi_powers[1024];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint16_t ntt1024_omega_powers[1024];
+extern const uint16_t ntt1024_omega_powers_rev[1024];
+extern const uint16_t ntt1024_inv_omega_powers[1024];
+extern const uint16_t ntt1024_inv_omega_powers_rev[1024];
+extern const uint16_t ntt1024_mixed_powers[1024];
+extern const uint16_t ntt1024_mixed_powers_rev[1024];
+extern const uint16_t ntt1024_inv_mixed_powers[1024];
+extern const uint16_t ntt1024_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT1024_TABLES_H */
@@ -0,0 +1,73 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 16
+ * - psi = 1212
+ * - omega = psi^2 = 6553
+ * - inverse of psi = 2545
+ * - inverse of omega = 722
+ * - inverse of n = 11521
+ */
+
+#include "ntt16_tables.h"
+
+const uint16_t ntt16_psi_powers[16] = {
+        1,  1212,  6553,  3542,  4043,  9094, 10984,  3621,
+     1479, 10643,  8155,  3504,  7143,  5860, 11567,  9744,
+};
+
+const uint16_t ntt16_inv_psi_powers[16] = {
+        1,  2545,   722,  6429,  5146,  8785,  4134,  1646,
+    10810,  8668,  1305,  3195,  8246,  8747,  5736, 11077,
+};
+
+const uint16_t ntt16_inv_psi_powers_rev[16] = {
+        0,     1,     1,  5146,     1,  5146,   722,  4134,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+};
+
+const uint16_t ntt16_scaled_inv_psi_powers[16] = {
+    11521, 11680, 10798,  2706,  4930, 12070,  7939,  1639,
+     5284,  3614,  5458,  4040,  8196,  4387,  6503,  9141,
+};
+
+const uint16_t ntt16_omega_powers[16] = {
+        0,     1,     1,  1479,     1,  4043,  1479,  7143,
+        1,  6553,  4043, 10984,  1479,  8155,  7143, 11567,
+};
+
+const uint16_t ntt16_omega_powers_rev[16] = {
+        0,     1,     1,  1479,     1,  1479,  4043,  7143,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+};
+
+const uint16_t ntt16_inv_omega_powers[16] = {
+        0,     1,     1, 10810,     1,  5146, 10810,  8246,
+        1,   722,  5146,  4134, 10810,  1305,  8246,  5736,
+};
+
+const uint16_t ntt16_inv_omega_powers_rev[16] = {
+        0,     1,     1, 10810,     1, 10810,  5146,  8246,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+};
+
+const uint16_t ntt16_mixed_powers[16] = {
+        0,  1479,  4043,  7143,  6553, 10984,  8155, 11567,
+     1212,  3542,  9094,  3621, 10643,  3504,  5860,  9744,
+};
+
+const uint16_t ntt16_mixed_powers_rev[16] = {
+        0,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+};
+
+const uint16_t ntt16_inv_mixed_powers[16] = {
+        0, 10810,  5146,  8246,   722,  4134,  1305,  5736,
+     2545,  6429,  8785,  1646,  8668,  3195,  8747, 11077,
+};
+
+const uint16_t ntt16_inv_mixed_powers_rev[16] = {
+        0, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+};
+
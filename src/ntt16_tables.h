@@ -0,0 +1,45 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 16
+ * - psi = 1212
+ * - omega = psi^2 = 6553
+ * - inverse of psi = 2545
+ * - inverse of omega = 722
+ * - inverse of n = 11521
+ */
+
+#ifndef __NTT16_TABLES_H
+#define __NTT16_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt16_psi = 1212;
+static const int32_t ntt16_omega = 6553;
+static const int32_t ntt16_inv_psi = 2545;
+static const int32_t ntt16_inv_omega = 722;
+static const int32_t ntt16_inv_n = 11521;
+
+/*
+ * POWERS OF PSI
+ */
+extern const uint16_t ntt16_psi_powers[16];
+extern const uint16_t ntt16_inv_psi_powers[16];
+extern const uint16_t ntt16_scaled_inv_psi_powers[16];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint16_t ntt16_omega_powers[16];
+extern const uint16_t ntt16_omega_powers_rev[16];
+extern const uint16_t ntt16_inv_omega_powers[16];
+extern const uint16_t ntt16_inv_omega_powers_rev[16];
+extern const uint16_t ntt16_mixed_powers[16];
+extern const uint16_t ntt16_mixed_powers_rev[16];
+extern const uint16_t ntt16_inv_mixed_powers[16];
+extern const uint16_t ntt16_inv_mixed_powers_rev[16];
+
+#endif /* __NTT16_TABLES_H */
@@ -0,0 +1,433 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 256
+ * - psi = 1002
+ * - omega = psi^2 = 8595
+ * - inverse of psi = 10805
+ * - inverse of omega = 2525
+ * - inverse of n = 12241
+ */
+
+#include "ntt256_tables.h"
+
+const uint16_t ntt256_psi_powers[256] = {
+        1,  1002,  8595,  9890,  4846,  1537,  3949, 12129,
+    11726,  1168,  2881, 11136, 12149,  7188,  1022,  4057,
+     9744,  6022,   145, 10111,  5086,  8526,  2197,  1663,
+     7311,  1378,  4388,  9603, 12208,  4861,  4278,  9984,
+      722, 10682, 11934,   671,  8736,  3704,   130,  7370,
+    11340,  7644,  3241,  3186,  9521,  3778,   544,  4372,
+     5860,  9867,  6378,   476,  9970, 11272,   953,  8653,
+     6561, 11796,  9863,  2370,  2963,  7277,  4177,  7094,
+     5146,  7201,  1759,  5191,  3135,  7575,  7837,     3,
+     3006,  1207,  5092,  2249,  4611, 11847, 11809, 10600,
+     3504,  8643,  8830, 11869,  9275,  3066, 12171,  4654,
+     5777,   435,  5755,  2969,  1000,  6591,  4989,  9644,
+     4134,   875,  4231, 12046,  2294,   545,  5374,  2166,
+     7468, 11224,  2013,  1630, 11112,   390,  9821,  9442,
+    10643,  9723,  9558,  3985, 11334,  1632,   827,  5291,
+     5023,  6845,  1428,  5332,  9238,  2859,  1381,  7394,
+    10810,  5011,  7110,  8889,  9542,   242,  8993,  3149,
+     9314,  5277,  3284,  9405, 10436, 11222,     9,  9018,
+     3621,  2987,  6747,  1544, 10963, 10849,  7222, 10512,
+     1351,  1912, 11029,  3247,  9198, 11935,  1673,  5042,
+     1305,  4976,  8907,  3000,  7484,  2678,  4354,   113,
+     2625,   404, 11560,  6882,  1635,  3833,  6498, 10115,
+     9094,  6039,  4890,  8758,  1170,  4885,  3748,  7351,
+     4591,  4096, 11955,  9424,  4896,  2481,  3584,  2780,
+     8246,  4284,  3707,  3136,  8577,  4143,  9893,  7852,
+     2744,  9041,  2089,  4048,   726,  2401,  9447,  3364,
+     3542,  9852,  3637,  6730,  9088,    27,  2476, 10863,
+     8961,  7952,  4632,  8311,  7969,  9377,  6958,  4053,
+     5736,  8509,  9741,  3016, 11227,  5019,  2837,  3915,
+     2639,  2143,  9000, 10163,  8034,   773,   339,  7875,
+     1212, 10102,  8357,  4905, 11499,  7205,  5767,  2704,
+     5828,  2381,  1696,  3510,  2366, 11244,  9764,  1484,
+};
+
+const uint16_t ntt256_inv_psi_powers[256] = {
+        1, 10805,  2525,  1045,  9923,  8779, 10593,  9908,
+     6461,  9585,  6522,  5084,   790,  7384,  3932,  2187,
+    11077,  4414, 11950, 11516,  4255,  2126,  3289, 10146,
+     9650,  8374,  9452,  7270,  1062,  9273,  2548,  3780,
+     6553,  8236,  5331,  2912,  4320,  3978,  7657,  4337,
+     3328,  1426,  9813, 12262,  3201,  5559,  8652,  2437,
+     8747,  8925,  2842,  9888, 11563,  8241, 10200,  3248,
+     9545,  4437,  2396,  8146,  3712,  9153,  8582,  8005,
+     4043,  9509,  8705,  9808,  7393,  2865,   334,  8193,
+     7698,  4938,  8541,  7404, 11119,  3531,  7399,  6250,
+     3195,  2174,  5791,  8456, 10654,  5407,   729, 11885,
+     9664, 12176,  7935,  9611,  4805,  9289,  3382,  7313,
+    10984,  7247, 10616,   354,  3091,  9042,  1260, 10377,
+    10938,  1777,  5067,  1440,  1326, 10745,  5542,  9302,
+     8668,  3271, 12280,  1067,  1853,  2884,  9005,  7012,
+     2975,  9140,  3296, 12047,  2747,  3400,  5179,  7278,
+     1479,  4895, 10908,  9430,  3051,  6957, 10861,  5444,
+     7266,  6998, 11462, 10657,   955,  8304,  2731,  2566,
+     1646,  2847,  2468, 11899,  1177, 10659, 10276,  1065,
+     4821, 10123,  6915, 11744,  9995,   243,  8058, 11414,
+     8155,  2645,  7300,  5698, 11289,  9320,  6534, 11854,
+     6512,  7635,   118,  9223,  3014,   420,  3459,  3646,
+     8785,  1689,   480,   442,  7678, 10040,  7197, 11082,
+     9283, 12286,  4452,  4714,  9154,  7098, 10530,  5088,
+     7143,  5195,  8112,  5012,  9326,  9919,  2426,   493,
+     5728,  3636, 11336,  1017,  2319, 11813,  5911,  2422,
+     6429,  7917, 11745,  8511,  2768,  9103,  9048,  4645,
+      949,  4919, 12159,  8585,  3553, 11618,   355,  1607,
+    11567,  2305,  8011,  7428,    81,  2686,  7901, 10911,
+     4978, 10626, 10092,  3763,  7203,  2178, 12144,  6267,
+     2545,  8232, 11267,  5101,   140,  1153,  9408, 11121,
+      563,   160,  8340, 10752,  7443,  2399,  3694, 11287,
+};
+
+const uint16_t ntt256_inv_psi_powers_rev[256] = {
+        0,     1,     1,  4043,     1,  4043,  6553, 10984,
+        1,  4043,  6553, 10984, 11077,  3195,  8747,  8668,
+        1,  4043,  6553, 10984, 11077,  3195,  8747,  8668,
+     6461,  7698,  3328, 10938,  9650,  9664,  9545,  2975,
+        1,  4043,  6553, 10984, 11077,  3195,  8747,  8668,
+     6461,  7698,  3328, 10938,  9650,  9664,  9545,  2975,
+     9923,  7393,  4320,  3091,  4255, 10654, 11563,  1853,
+      790, 11119,  3201,  1326,  1062,  4805,  3712,  2747,
+        1,  4043,  6553, 10984, 11077,  3195,  8747,  8668,
+     6461,  7698,  3328, 10938,  9650,  9664,  9545,  2975,
+     9923,  7393,  4320,  3091,  4255, 10654, 11563,  1853,
+      790, 11119,  3201,  1326,  1062,  4805,  3712,  2747,
+     2525,  8705,  5331, 10616, 11950,  5791,  2842, 12280,
+     6522,  8541,  9813,  5067,  9452,  7935,  2396,  3296,
+    10593,   334,  7657,  1260,  3289,   729, 10200,  9005,
+     3932,  7399,  8652,  5542,  2548,  3382,  8582,  5179,
+        1,  4043,  6553, 10984, 11077,  3195,  8747,  8668,
+     6461,  7698,  3328, 10938,  9650,  9664,  9545,  2975,
+     9923,  7393,  4320,  3091,  4255, 10654, 11563,  1853,
+      790, 11119,  3201,  1326,  1062,  4805,  3712,  2747,
+     2525,  8705,  5331, 10616, 11950,  5791,  2842, 12280,
+     6522,  8541,  9813,  5067,  9452,  7935,  2396,  3296,
+    10593,   334,  7657,  1260,  3289,   729, 10200,  9005,
+     3932,  7399,  8652,  5542,  2548,  3382,  8582,  5179,
+    10805,  9509,  8236,  7247,  4414,  2174,  8925,  3271,
+     9585,  4938,  1426,  1777,  8374, 12176,  4437,  9140,
+     8779,  2865,  3978,  9042,  2126,  5407,  8241,  2884,
+     7384,  3531,  5559, 10745,  9273,  9289,  9153,  3400,
+     1045,  9808,  2912,   354, 11516,  8456,  9888,  1067,
+     5084,  7404, 12262,  1440,  7270,  9611,  8146, 12047,
+     9908,  8193,  4337, 10377, 10146, 11885,  3248,  7012,
+     2187,  6250,  2437,  9302,  3780,  7313,  8005,  7278,
+};
+
+const uint16_t ntt256_scaled_inv_psi_powers[256] = {
+    12241,  9787,  1690, 11285,  2967,  8723,  7674,  3687,
+     9386,  6902,  6458,  1748, 11236,  1949,  7888,  5625,
+     9020,  9330,  3983,   237,  4673,  8553,  1885,  4552,
+     3782,  3585,   997,  7421, 10469,  9589,   586,  2895,
+     4970, 10209,  2181,  7692,  1553,  5680,  1134,   737,
+       13,  5286,  8247,  1296,  6109,  3526,  2530,  5914,
+    10259,  1715, 11052,  4647, 10270,  9969,  1960,  3853,
+     8822,  8226,  7882,  2240,  6159,  3060,  5890,  9008,
+     2560, 10550, 12275,  8487,  1517,  9948,  8546, 12273,
+    11455,  8756,  7858,   989,  7004,  2558,  1229,  7225,
+     6397,  6249,  4679, 11938,  4746, 10822,  1875,  7103,
+     3110,  5424,    79,  5654,  2851,  8821,  9710,  5357,
+     1195,  8525,  6570,  7586, 11389,  8388,   965,  5753,
+     3403,   727,  2564,  4614, 10086,   378,  4342,  8197,
+     1762,  2749,   432, 10229,  9368,  9036, 10164,  7516,
+     4668,  3684,  1549, 11616,  3323,  8846,  9477,  7037,
+     2742, 10820,  4843,  2053,  1020, 10156,  7099,  9046,
+     7613,  8188,  2829,  4602,  3316,  6945,  4091, 12011,
+     7015, 10812,  4426,  6431,  4949,  4506, 10601, 10325,
+     2083,  5656, 12172,  1582, 11800,   625,  6464,  5133,
+     1808,  8219,  5981,  9143, 11133,  7333,  5882,  8591,
+     6938,  2190,  6625, 11989,  2796,  4418,  6014,  9327,
+     8435,  4951,  1538,  3362,   126,  9640, 10925,  8780,
+     9109,   144,  7506,  7219,  3012,  3388, 10698,  1556,
+     1228,  8709,  3872,  5204,  7045,  3159,  6442,   914,
+     7703,  9807,  8877,   340, 11578, 10559, 11208,  6634,
+    10922,   943,  1534,  9298,  2315,  5460,  8100, 10531,
+     3604,  9668,  6240,  5746,  1502,  7630,  7538,  8887,
+    10078, 12250,  8720, 12126,  8401,  6251,  1711,  4699,
+     6836,  6090,  7144,  3711, 10637,  6057,  6960,  6409,
+      730, 10401, 12189,   932,  5569,  6101,  3109,  6908,
+     9843,  4609,  5217,    42, 11406,  7738,  7023, 11229,
+};
+
+const uint16_t ntt256_omega_powers[256] = {
+        0,     1,     1, 10810,     1,  5146, 10810,  8246,
+        1,   722,  5146,  4134, 10810,  1305,  8246,  5736,
+        1,  9744,   722,  5860,  5146,  3504,  4134, 10643,
+    10810,  3621,  1305,  9094,  8246,  3542,  5736,  1212,
+        1, 11726,  9744,  7311,   722, 11340,  5860,  6561,
+     5146,  3006,  3504,  5777,  4134,  7468, 10643,  5023,
+    10810,  9314,  3621,  1351,  1305,  2625,  9094,  4591,
+     8246,  2744,  3542,  8961,  5736,  2639,  1212,  5828,
+        1,  4846, 11726, 12149,  9744,  5086,  7311, 12208,
+      722,  8736, 11340,  9521,  5860,  9970,  6561,  2963,
+     5146,  3135,  3006,  4611,  3504,  9275,  5777,  1000,
+     4134,  2294,  7468, 11112, 10643, 11334,  5023,  9238,
+    10810,  9542,  9314, 10436,  3621, 10963,  1351,  9198,
+     1305,  7484,  2625,  1635,  9094,  1170,  4591,  4896,
+     8246,  8577,  2744,   726,  3542,  9088,  8961,  7969,
+     5736, 11227,  2639,  8034,  1212, 11499,  5828,  2366,
+        1,  8595,  4846,  3949, 11726,  2881, 12149,  1022,
+     9744,   145,  5086,  2197,  7311,  4388, 12208,  4278,
+      722, 11934,  8736,   130, 11340,  3241,  9521,   544,
+     5860,  6378,  9970,   953,  6561,  9863,  2963,  4177,
+     5146,  1759,  3135,  7837,  3006,  5092,  4611, 11809,
+     3504,  8830,  9275, 12171,  5777,  5755,  1000,  4989,
+     4134,  4231,  2294,  5374,  7468,  2013, 11112,  9821,
+    10643,  9558, 11334,   827,  5023,  1428,  9238,  1381,
+    10810,  7110,  9542,  8993,  9314,  3284, 10436,     9,
+     3621,  6747, 10963,  7222,  1351, 11029,  9198,  1673,
+     1305,  8907,  7484,  4354,  2625, 11560,  1635,  6498,
+     9094,  4890,  1170,  3748,  4591, 11955,  4896,  3584,
+     8246,  3707,  8577,  9893,  2744,  2089,   726,  9447,
+     3542,  3637,  9088,  2476,  8961,  4632,  7969,  6958,
+     5736,  9741, 11227,  2837,  2639,  9000,  8034,   339,
+     1212,  8357, 11499,  5767,  5828,  1696,  2366,  9764,
+};
+
+const uint16_t ntt256_omega_powers_rev[256] = {
+        0,     1,     1, 10810,     1, 10810,  5146,  8246,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     4846,  9542,  3135,  8577,  8736,  7484,  2294, 11227,
+     5086, 10963,  9275,  9088,  9970,  1170, 11334, 11499,
+    12149, 10436,  4611,   726,  9521,  1635, 11112,  8034,
+    12208,  9198,  1000,  7969,  2963,  4896,  9238,  2366,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     4846,  9542,  3135,  8577,  8736,  7484,  2294, 11227,
+     5086, 10963,  9275,  9088,  9970,  1170, 11334, 11499,
+    12149, 10436,  4611,   726,  9521,  1635, 11112,  8034,
+    12208,  9198,  1000,  7969,  2963,  4896,  9238,  2366,
+     8595,  7110,  1759,  3707, 11934,  8907,  4231,  9741,
+      145,  6747,  8830,  3637,  6378,  4890,  9558,  8357,
+     2881,  3284,  5092,  2089,  3241, 11560,  2013,  9000,
+     4388, 11029,  5755,  4632,  9863, 11955,  1428,  1696,
+     3949,  8993,  7837,  9893,   130,  4354,  5374,  2837,
+     2197,  7222, 12171,  2476,   953,  3748,   827,  5767,
+     1022,     9, 11809,  9447,   544,  6498,  9821,   339,
+     4278,  1673,  4989,  6958,  4177,  3584,  1381,  9764,
+};
+
+const uint16_t ntt256_inv_omega_powers[256] = {
+        0,     1,     1,  1479,     1,  4043,  1479,  7143,
+        1,  6553,  4043, 10984,  1479,  8155,  7143, 11567,
+        1, 11077,  6553,  8747,  4043,  3195, 10984,  8668,
+     1479,  1646,  8155,  8785,  7143,  6429, 11567,  2545,
+        1,  6461, 11077,  9650,  6553,  3328,  8747,  9545,
+     4043,  7698,  3195,  9664, 10984, 10938,  8668,  2975,
+     1479,  7266,  1646,  4821,  8155,  6512,  8785,  9283,
+     7143,  5728,  6429,   949, 11567,  4978,  2545,   563,
+        1,  9923,  6461,   790, 11077,  4255,  9650,  1062,
+     6553,  4320,  3328,  3201,  8747, 11563,  9545,  3712,
+     4043,  7393,  7698, 11119,  3195, 10654,  9664,  4805,
+    10984,  3091, 10938,  1326,  8668,  1853,  2975,  2747,
+     1479,  3051,  7266,   955,  1646,  1177,  4821,  9995,
+     8155, 11289,  6512,  3014,  8785,  7678,  9283,  9154,
+     7143,  9326,  5728,  2319,  6429,  2768,   949,  3553,
+    11567,    81,  4978,  7203,  2545,   140,   563,  7443,
+        1,  2525,  9923, 10593,  6461,  6522,   790,  3932,
+    11077, 11950,  4255,  3289,  9650,  9452,  1062,  2548,
+     6553,  5331,  4320,  7657,  3328,  9813,  3201,  8652,
+     8747,  2842, 11563, 10200,  9545,  2396,  3712,  8582,
+     4043,  8705,  7393,   334,  7698,  8541, 11119,  7399,
+     3195,  5791, 10654,   729,  9664,  7935,  4805,  3382,
+    10984, 10616,  3091,  1260, 10938,  5067,  1326,  5542,
+     8668, 12280,  1853,  9005,  2975,  3296,  2747,  5179,
+     1479, 10908,  3051, 10861,  7266, 11462,   955,  2731,
+     1646,  2468,  1177, 10276,  4821,  6915,  9995,  8058,
+     8155,  7300, 11289,  6534,  6512,   118,  3014,  3459,
+     8785,   480,  7678,  7197,  9283,  4452,  9154, 10530,
+     7143,  8112,  9326,  2426,  5728, 11336,  2319,  5911,
+     6429, 11745,  2768,  9048,   949, 12159,  3553,   355,
+    11567,  8011,    81,  7901,  4978, 10092,  7203, 12144,
+     2545, 11267,   140,  9408,   563,  8340,  7443,  3694,
+};
+
+const uint16_t ntt256_inv_omega_powers_rev[256] = {
+        0,     1,     1,  1479,     1,  1479,  4043,  7143,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     9923,  3051,  7393,  9326,  4320, 11289,  3091,    81,
+     4255,  1177, 10654,  2768, 11563,  7678,  1853,   140,
+      790,   955, 11119,  2319,  3201,  3014,  1326,  7203,
+     1062,  9995,  4805,  3553,  3712,  9154,  2747,  7443,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     9923,  3051,  7393,  9326,  4320, 11289,  3091,    81,
+     4255,  1177, 10654,  2768, 11563,  7678,  1853,   140,
+      790,   955, 11119,  2319,  3201,  3014,  1326,  7203,
+     1062,  9995,  4805,  3553,  3712,  9154,  2747,  7443,
+     2525, 10908,  8705,  8112,  5331,  7300, 10616,  8011,
+    11950,  2468,  5791, 11745,  2842,   480, 12280, 11267,
+     6522, 11462,  8541, 11336,  9813,   118,  5067, 10092,
+     9452,  6915,  7935, 12159,  2396,  4452,  3296,  8340,
+    10593, 10861,   334,  2426,  7657,  6534,  1260,  7901,
+     3289, 10276,   729,  9048, 10200,  7197,  9005,  9408,
+     3932,  2731,  7399,  5911,  8652,  3459,  5542, 12144,
+     2548,  8058,  3382,   355,  8582, 10530,  5179,  3694,
+};
+
+const uint16_t ntt256_mixed_powers[256] = {
+        0, 10810,  5146,  8246,   722,  4134,  1305,  5736,
+     9744,  5860,  3504, 10643,  3621,  9094,  3542,  1212,
+    11726,  7311, 11340,  6561,  3006,  5777,  7468,  5023,
+     9314,  1351,  2625,  4591,  2744,  8961,  2639,  5828,
+     4846, 12149,  5086, 12208,  8736,  9521,  9970,  2963,
+     3135,  4611,  9275,  1000,  2294, 11112, 11334,  9238,
+     9542, 10436, 10963,  9198,  7484,  1635,  1170,  4896,
+     8577,   726,  9088,  7969, 11227,  8034, 11499,  2366,
+     8595,  3949,  2881,  1022,   145,  2197,  4388,  4278,
+    11934,   130,  3241,   544,  6378,   953,  9863,  4177,
+     1759,  7837,  5092, 11809,  8830, 12171,  5755,  4989,
+     4231,  5374,  2013,  9821,  9558,   827,  1428,  1381,
+     7110,  8993,  3284,     9,  6747,  7222, 11029,  1673,
+     8907,  4354, 11560,  6498,  4890,  3748, 11955,  3584,
+     3707,  9893,  2089,  9447,  3637,  2476,  4632,  6958,
+     9741,  2837,  9000,   339,  8357,  5767,  1696,  9764,
+     1002,  9890,  1537, 12129,  1168, 11136,  7188,  4057,
+     6022, 10111,  8526,  1663,  1378,  9603,  4861,  9984,
+    10682,   671,  3704,  7370,  7644,  3186,  3778,  4372,
+     9867,   476, 11272,  8653, 11796,  2370,  7277,  7094,
+     7201,  5191,  7575,     3,  1207,  2249, 11847, 10600,
+     8643, 11869,  3066,  4654,   435,  2969,  6591,  9644,
+      875, 12046,   545,  2166, 11224,  1630,   390,  9442,
+     9723,  3985,  1632,  5291,  6845,  5332,  2859,  7394,
+     5011,  8889,   242,  3149,  5277,  9405, 11222,  9018,
+     2987,  1544, 10849, 10512,  1912,  3247, 11935,  5042,
+     4976,  3000,  2678,   113,   404,  6882,  3833, 10115,
+     6039,  8758,  4885,  7351,  4096,  9424,  2481,  2780,
+     4284,  3136,  4143,  7852,  9041,  4048,  2401,  3364,
+     9852,  6730,    27, 10863,  7952,  8311,  9377,  4053,
+     8509,  3016,  5019,  3915,  2143, 10163,   773,  7875,
+    10102,  4905,  7205,  2704,  2381,  3510, 11244,  1484,
+};
+
+const uint16_t ntt256_mixed_powers_rev[256] = {
+        0, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     4846,  9542,  3135,  8577,  8736,  7484,  2294, 11227,
+     5086, 10963,  9275,  9088,  9970,  1170, 11334, 11499,
+    12149, 10436,  4611,   726,  9521,  1635, 11112,  8034,
+    12208,  9198,  1000,  7969,  2963,  4896,  9238,  2366,
+     8595,  7110,  1759,  3707, 11934,  8907,  4231,  9741,
+      145,  6747,  8830,  3637,  6378,  4890,  9558,  8357,
+     2881,  3284,  5092,  2089,  3241, 11560,  2013,  9000,
+     4388, 11029,  5755,  4632,  9863, 11955,  1428,  1696,
+     3949,  8993,  7837,  9893,   130,  4354,  5374,  2837,
+     2197,  7222, 12171,  2476,   953,  3748,   827,  5767,
+     1022,     9, 11809,  9447,   544,  6498,  9821,   339,
+     4278,  1673,  4989,  6958,  4177,  3584,  1381,  9764,
+     1002,  5011,  7201,  4284, 10682,  4976,   875,  8509,
+     6022,  2987,  8643,  9852,  9867,  6039,  9723, 10102,
+     1168,  5277,  1207,  9041,  7644,   404, 11224,  2143,
+     1378,  1912,   435,  7952, 11796,  4096,  6845,  2381,
+     1537,   242,  7575,  4143,  3704,  2678,   545,  5019,
+     8526, 10849,  3066,    27, 11272,  4885,  1632,  7205,
+     7188, 11222, 11847,  2401,  3778,  3833,   390,   773,
+     4861, 11935,  6591,  9377,  7277,  2481,  2859, 11244,
+     9890,  8889,  5191,  3136,   671,  3000, 12046,  3016,
+    10111,  1544, 11869,  6730,   476,  8758,  3985,  4905,
+    11136,  9405,  2249,  4048,  3186,  6882,  1630, 10163,
+     9603,  3247,  2969,  8311,  2370,  9424,  5332,  3510,
+    12129,  3149,     3,  7852,  7370,   113,  2166,  3915,
+     1663, 10512,  4654, 10863,  8653,  7351,  5291,  2704,
+     4057,  9018, 10600,  3364,  4372, 10115,  9442,  7875,
+     9984,  5042,  9644,  4053,  7094,  2780,  7394,  1484,
+};
+
+const uint16_t ntt256_inv_mixed_powers[256] = {
+        0,  1479,  4043,  7143,  6553, 10984,  8155, 11567,
+    11077,  8747,  3195,  8668,  1646,  8785,  6429,  2545,
+     6461,  9650,  3328,  9545,  7698,  9664, 10938,  2975,
+     7266,  4821,  6512,  9283,  5728,   949,  4978,   563,
+     9923,   790,  4255,  1062,  4320,  3201, 11563,  3712,
+     7393, 11119, 10654,  4805,  3091,  1326,  1853,  2747,
+     3051,   955,  1177,  9995, 11289,  3014,  7678,  9154,
+     9326,  2319,  2768,  3553,    81,  7203,   140,  7443,
+     2525, 10593,  6522,  3932, 11950,  3289,  9452,  2548,
+     5331,  7657,  9813,  8652,  2842, 10200,  2396,  8582,
+     8705,   334,  8541,  7399,  5791,   729,  7935,  3382,
+    10616,  1260,  5067,  5542, 12280,  9005,  3296,  5179,
+    10908, 10861, 11462,  2731,  2468, 10276,  6915,  8058,
+     7300,  6534,   118,  3459,   480,  7197,  4452, 10530,
+     8112,  2426, 11336,  5911, 11745,  9048, 12159,   355,
+     8011,  7901, 10092, 12144, 11267,  9408,  8340,  3694,
+    10805,  1045,  8779,  9908,  9585,  5084,  7384,  2187,
+     4414, 11516,  2126, 10146,  8374,  7270,  9273,  3780,
+     8236,  2912,  3978,  4337,  1426, 12262,  5559,  2437,
+     8925,  9888,  8241,  3248,  4437,  8146,  9153,  8005,
+     9509,  9808,  2865,  8193,  4938,  7404,  3531,  6250,
+     2174,  8456,  5407, 11885, 12176,  9611,  9289,  7313,
+     7247,   354,  9042, 10377,  1777,  1440, 10745,  9302,
+     3271,  1067,  2884,  7012,  9140, 12047,  3400,  7278,
+     4895,  9430,  6957,  5444,  6998, 10657,  8304,  2566,
+     2847, 11899, 10659,  1065, 10123, 11744,   243, 11414,
+     2645,  5698,  9320, 11854,  7635,  9223,   420,  3646,
+     1689,   442, 10040, 11082, 12286,  4714,  7098,  5088,
+     5195,  5012,  9919,   493,  3636,  1017, 11813,  2422,
+     7917,  8511,  9103,  4645,  4919,  8585, 11618,  1607,
+     2305,  7428,  2686, 10911, 10626,  3763,  2178,  6267,
+     8232,  5101,  1153, 11121,   160, 10752,  2399, 11287,
+};
+
+const uint16_t ntt256_inv_mixed_powers_rev[256] = {
+        0,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     9923,  3051,  7393,  9326,  4320, 11289,  3091,    81,
+     4255,  1177, 10654,  2768, 11563,  7678,  1853,   140,
+      790,   955, 11119,  2319,  3201,  3014,  1326,  7203,
+     1062,  9995,  4805,  3553,  3712,  9154,  2747,  7443,
+     2525, 10908,  8705,  8112,  5331,  7300, 10616,  8011,
+    11950,  2468,  5791, 11745,  2842,   480, 12280, 11267,
+     6522, 11462,  8541, 11336,  9813,   118,  5067, 10092,
+     9452,  6915,  7935, 12159,  2396,  4452,  3296,  8340,
+    10593, 10861,   334,  2426,  7657,  6534,  1260,  7901,
+     3289, 10276,   729,  9048, 10200,  7197,  9005,  9408,
+     3932,  2731,  7399,  5911,  8652,  3459,  5542, 12144,
+     2548,  8058,  3382,   355,  8582, 10530,  5179,  3694,
+    10805,  4895,  9509,  5195,  8236,  2645,  7247,  2305,
+     4414,  2847,  2174,  7917,  8925,  1689,  3271,  8232,
+     9585,  6998,  4938,  3636,  1426,  7635,  1777, 10626,
+     8374, 10123, 12176,  4919,  4437, 12286,  9140,   160,
+     8779,  6957,  2865,  9919,  3978,  9320,  9042,  2686,
+     2126, 10659,  5407,  9103,  8241, 10040,  2884,  1153,
+     7384,  8304,  3531, 11813,  5559,   420, 10745,  2178,
+     9273,   243,  9289, 11618,  9153,  7098,  3400,  2399,
+     1045,  9430,  9808,  5012,  2912,  5698,   354,  7428,
+    11516, 11899,  8456,  8511,  9888,   442,  1067,  5101,
+     5084, 10657,  7404,  1017, 12262,  9223,  1440,  3763,
+     7270, 11744,  9611,  8585,  8146,  4714, 12047, 10752,
+     9908,  5444,  8193,   493,  4337, 11854, 10377, 10911,
+    10146,  1065, 11885,  4645,  3248, 11082,  7012, 11121,
+     2187,  2566,  6250,  2422,  2437,  3646,  9302,  6267,
+     3780, 11414,  7313,  1607,  8005,  5088,  7278, 11287,
+};
+
@@ -0,0 +1,817 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 512
+ * - psi = 1003
+ * - omega = psi^2 = 10600
+ * - inverse of psi = 1360
+ * - inverse of omega = 6250
+ * - inverse of n = 12265
+ */
+
+#include "ntt512_tables.h"
+
+const uint16_t ntt512_psi_powers[512] = {
+        1,  1003, 10600,  1815,  1673,  6715,   773,  1112,
+     9326,  2049,  2884,  4737,  7657, 11635,  7644, 10885,
+     5023, 11868,  7852, 10596, 10092,  8429, 11744,  6370,
+    11119,  6234,  9890,  2447,  8830,  8410,  4976,  1594,
+     1212, 11314,  5195,    49, 12280,  3262,  2912,  8243,
+     9521,  1010,  5332,  2281,  2089,  6137, 10911,  6523,
+     4821,  5886,  4938,   347,  3949,  3789,  3066,  2948,
+     7484, 10162,  4905,  4115, 10530,  5339,  9302,  2555,
+     6553, 10333,  4372, 10232,  1381,  8775,  2401, 11848,
+       81,  7509, 10659, 11836,   334,  3199,  1168,  4049,
+     5777,  6212,   113,  2738,  5767,  8471,  4714,  9166,
+     1326,  2766,  9273, 10335,  6378,  6854,  5011, 12121,
+     3542,  1105,  2305,  1583,  2468,  5315,  9808,  6224,
+    12149,  7048,  2969,  3969, 11560,  6153,  2381,  4077,
+     9283,  8076,  1777,   426,  9452,  5537, 11272, 12225,
+     9542,  9784,  6730,  3529,   355, 11973,  2566,  5297,
+     4043, 12048,  4057,  1512,  4989,  2344,  3833, 10331,
+     2366,  1321, 10040,  5429,  1260, 10302, 10146,  1146,
+     6561,  6068,  3149,   174,  2476,  1050,  8585,  8455,
+      955, 11612,  9153,   576,   145, 10256,   875,  5106,
+     9094,  2844,  1484,  1483,   480,  2169,   354, 10970,
+     4255,  3482,  2370,  5333,  3284,   400,  7952,   295,
+      949,  5594,  6998,  1975,  2396,  6833,  8526, 10723,
+     2294,  2839,  8758,  9928,  3694,  6093,  3646,  7105,
+    10984,  6008,  4414,  3202,  4177, 11271, 11222, 11231,
+     7969,  5057,  9103, 11871, 10861,  5529,  3248,  1159,
+     7311,  8689,  2166,  9634,  3748, 11099, 10752,  6803,
+     3014, 12237,  9289,  1805,  3932, 11316,  7201,  8960,
+     3621,  6608,  4053,  9789, 11745,  7373,  9430,  8049,
+    11563,  9162,  9603,  9522,  2013,  3643,  4096,  3762,
+      563, 11684,  7635,  1858,  7935,  7822,  5084, 11606,
+     3135, 10710,  1544,   218,  9741,   468,  2422,  8333,
+     1479,  8757,  8925,  5383,  4278,  1973,   390, 10211,
+     4896,  7377,  1153,  1293,  6534,  3565, 11885,   325,
+     6461,  4080,     3,  3009,  7222,  5445,  5019,  7856,
+     2319,  3336,  3400,  6147,  8652,  1922, 10682, 10327,
+    10643,  8077,  2780, 11026, 11267,  7210,  5698,   709,
+    10654,  6821,  8779,  6413,  5092,  7341,  1912,   652,
+     2639,  4782,  3636,  9364,  3296,   147, 12262,  9786,
+     8736,   151,  3985,  3030,  3707,  6843,  6267,  6122,
+     8155,  7280,  2174,  5369,  2525,  1041, 11847, 11367,
+     9198,  8844, 10163,  5908,  2426,    56,  7012,  3728,
+     3328,  7665,  7370,  6421,   827,  6118,  4143,  1747,
+     7203, 10966,   243, 10238,  7399, 10930,  1002,  9597,
+     3504, 12147,  5042,  6347,   339,  8214,  5012,   835,
+     1853,  2920,  3978,  8298,  3241,  6427,  6845,  8273,
+     2744, 11785, 10626,  3315,  6915,  4749,  7404,  3656,
+     4846,  6383, 11869,  8855,  8907, 11907, 10102,  6170,
+     7143, 12231,  3271, 11939,  5331,  1278,  3778,  4322,
+     9238, 12097,  4048,  4774,  7901, 10587,  1065, 11341,
+     7698,  3602, 12129, 11566, 12171,  4536,  2678,  7032,
+    11499,  6415,  7098,  3963,  5542,  3998,  3780,  6328,
+     5860,  3438,  7394,  5915,  9447,   522,  7428,  3150,
+     1177,   787,  2865, 10258,  2881,  1728,   435,  6190,
+     2625,  3029,  2704,  8532,  4452,  4449,  1440,  6507,
+     1062,  8332,   476, 10446,  7110,  3710,  9852,  1200,
+    11567,   885,  2847,  4493,  8705,  5925,  7188,  8210,
+     1000,  7591,  6882,  8517,  1696,  5206, 11082,  5990,
+    10938,  9026,  8374,  5735,   953,  9606,   242,  9235,
+     9088,  9115, 11618,  2882,  2731, 11035,  8005,  4298,
+     9744,  3477,  9644,  1489,  6498,  4324, 11244,  8719,
+     7678,  8120,  9042, 12133,  3289,  5415, 11796,  9370,
+     9314,  2302, 10863,  7535, 12159,  4789, 10657,  9830,
+     3712, 11858, 10111,  2908,  4231,  3988,  6039, 10929,
+};
+
+const uint16_t ntt512_inv_psi_powers[512] = {
+        1,  1360,  6250,  8301,  8058,  9381,  2178,   431,
+     8577,  2459,  1632,  7500,   130,  4754,  1426,  9987,
+     2975,  2919,   493,  6874,  9000,   156,  3247,  4169,
+     4611,  3570,  1045,  7965,  5791, 10800,  2645,  8812,
+     2545,  7991,  4284,  1254,  9558,  9407,   671,  3174,
+     3201,  3054, 12047,  2683, 11336,  6554,  3915,  3263,
+     1351,  6299,  1207,  7083, 10593,  3772,  5407,  4698,
+    11289,  4079,  5101,  6364,  3584,  7796,  9442, 11404,
+      722, 11089,  2437,  8579,  5179,  1843, 11813,  3957,
+    11227,  5782, 10849,  7840,  7837,  3757,  9585,  9260,
+     9664,  6099, 11854, 10561,  9408,  2031,  9424, 11502,
+    11112,  9139,  4861, 11767,  2842,  6374,  4895,  8851,
+     6429,  5961,  8509,  8291,  6747,  8326,  5191,  5874,
+      790,  5257,  9611,  7753,   118,   723,   160,  8687,
+     4591,   948, 11224,  1702,  4388,  7515,  8241,   192,
+     3051,  7967,  8511, 11011,  6958,   350,  9018,    58,
+     5146,  6119,  2187,   382,  3382,  3434,   420,  5906,
+     7443,  8633,  4885,  7540,  5374,  8974,  1663,   504,
+     9545,  4016,  5444,  5862,  9048,  3991,  8311,  9369,
+    10436, 11454,  7277,  4075, 11950,  5942,  7247,   142,
+     8785,  2692, 11287,  1359,  4890,  2051, 12046,  1323,
+     5086, 10542,  8146,  6171, 11462,  5868,  4919,  4624,
+     8961,  8561,  5277, 12233,  9863,  6381,  2126,  3445,
+     3091,   922,   442, 11248,  9764,  6920, 10115,  5009,
+     4134,  6167,  6022,  5446,  8582,  9259,  8304, 12138,
+     3553,  2503,    27, 12142,  8993,  2925,  8653,  7507,
+     9650, 11637, 10377,  4948,  7197,  5876,  3510,  5468,
+     1635, 11580,  6591,  5079,  1022,  1263,  9509,  4212,
+     1646,  1962,  1607, 10367,  3637,  6142,  8889,  8953,
+     9970,  4433,  7270,  6844,  5067,  9280, 12286,  8209,
+     5828, 11964,   404,  8724,  5755, 10996, 11136,  4912,
+     7393,  2078, 11899, 10316,  8011,  6906,  3364,  3532,
+    10810,  3956,  9867, 11821,  2548, 12071, 10745,  1579,
+     9154,   683,  7205,  4467,  4354, 10431,  4654,   605,
+    11726,  8527,  8193,  8646, 10276,  2767,  2686,  3127,
+      726,  4240,  2859,  4916,   544,  2500,  8236,  5681,
+     8668,  3329,  5088,   973,  8357, 10484,  3000,    52,
+     9275,  5486,  1537,  1190,  8541,  2655, 10123,  3600,
+     4978, 11130,  9041,  6760,  1428,   418,  3186,  7232,
+     4320,  1058,  1067,  1018,  8112,  9087,  7875,  6281,
+     1305,  5184,  8643,  6196,  8595,  2361,  3531,  9450,
+     9995,  1566,  3763,  5456,  9893, 10314,  5291,  6695,
+    11340, 11994,  4337, 11889,  9005,  6956,  9919,  8807,
+     8034,  1319, 11935, 10120, 11809, 10806, 10805,  9445,
+     3195,  7183, 11414,  2033, 12144, 11713,  3136,   677,
+    11334,  3834,  3704, 11239,  9813, 12115,  9140,  6221,
+     5728, 11143,  2143,  1987, 11029,  6860,  2249, 10968,
+     9923,  1958,  8456,  9945,  7300, 10777,  8232,   241,
+     8246,  6992,  9723,   316, 11934,  8760,  5559,  2505,
+     2747,    64,  1017,  6752,  2837, 11863, 10512,  4213,
+     3006,  8212,  9908,  6136,   729,  8320,  9320,  5241,
+      140,  6065,  2481,  6974,  9821, 10706,  9984, 11184,
+     8747,   168,  7278,  5435,  5911,  1954,  3016,  9523,
+    10963,  3123,  7575,  3818,  6522,  9551, 12176,  6077,
+     6512,  8240, 11121,  9090, 11955,   453,  1630,  4780,
+    12208,   441,  9888,  3514, 10908,  2057,  7917,  1956,
+     5736,  9734,  2987,  6950,  1759,  8174,  7384,  2127,
+     4805,  9341,  9223,  8500,  8340, 11942,  7351,  6403,
+     7468,  5766,  1378,  6152, 10200, 10008,  6957, 11279,
+     2768,  4046,  9377,  9027,     9, 12240,  7094,   975,
+    11077, 10695,  7313,  3879,  3459,  9842,  2399,  6055,
+     1170,  5919,   545,  3860,  2197,  1693,  4437,   421,
+     7266,  1404,  4645,   654,  4632,  7552,  9405, 10240,
+     2963, 11177, 11516,  5574, 10616, 10474,  1689, 11286,
+};
+
+const uint16_t ntt512_inv_psi_powers_rev[512] = {
+        0,     1,     1,  5146,     1,  5146,   722,  4134,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+     2975,  9545,  9664,  9650,  1351,  8961,  4591,  5828,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+     2975,  9545,  9664,  9650,  1351,  8961,  4591,  5828,
+     8577,  7443, 11227,  3553,  3201,  5086,   790,  9970,
+     4611, 10436, 11112,  1635, 11289,  3091,  3051,  7393,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+     2975,  9545,  9664,  9650,  1351,  8961,  4591,  5828,
+     8577,  7443, 11227,  3553,  3201,  5086,   790,  9970,
+     4611, 10436, 11112,  1635, 11289,  3091,  3051,  7393,
+     8058,  3382,  5179,  8582,  9558,  4890,  6747,  3637,
+     9000,  9048,  9408,  7197, 10593,  9863,  4388,  5755,
+      130,  5374,  7837,  8993, 11336, 11462,   118,  5067,
+     5791, 11950,  2842,  1022,  3584,  9764,  6958,  8011,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+     2975,  9545,  9664,  9650,  1351,  8961,  4591,  5828,
+     8577,  7443, 11227,  3553,  3201,  5086,   790,  9970,
+     4611, 10436, 11112,  1635, 11289,  3091,  3051,  7393,
+     8058,  3382,  5179,  8582,  9558,  4890,  6747,  3637,
+     9000,  9048,  9408,  7197, 10593,  9863,  4388,  5755,
+      130,  5374,  7837,  8993, 11336, 11462,   118,  5067,
+     5791, 11950,  2842,  1022,  3584,  9764,  6958,  8011,
+     6250,  2187,  2437,  6022,  4284, 11287,  8509,  1607,
+      493,  5444, 11854, 10377,  1207,  5277, 11224,   404,
+     1632,  4885, 10849,    27, 12047,  8146,  9611,  7270,
+     1045,  7277,  4861,  6591,  5101,   442,  8511, 11899,
+     2178,   420, 11813,  8304,   671, 12046,  5191,  8889,
+     3247,  8311,  9424,  3510,  5407,  2126,  8241, 11136,
+     1426,  1663,  9585,  8653,  3915,  4919,   160, 12286,
+     2645,  7247,  4895,  9509,  9442, 10115,  9018,  3364,
+        1,  5146,   722,  4134,  2545,  8785,  6429,  1646,
+     2975,  9545,  9664,  9650,  1351,  8961,  4591,  5828,
+     8577,  7443, 11227,  3553,  3201,  5086,   790,  9970,
+     4611, 10436, 11112,  1635, 11289,  3091,  3051,  7393,
+     8058,  3382,  5179,  8582,  9558,  4890,  6747,  3637,
+     9000,  9048,  9408,  7197, 10593,  9863,  4388,  5755,
+      130,  5374,  7837,  8993, 11336, 11462,   118,  5067,
+     5791, 11950,  2842,  1022,  3584,  9764,  6958,  8011,
+     6250,  2187,  2437,  6022,  4284, 11287,  8509,  1607,
+      493,  5444, 11854, 10377,  1207,  5277, 11224,   404,
+     1632,  4885, 10849,    27, 12047,  8146,  9611,  7270,
+     1045,  7277,  4861,  6591,  5101,   442,  8511, 11899,
+     2178,   420, 11813,  8304,   671, 12046,  5191,  8889,
+     3247,  8311,  9424,  3510,  5407,  2126,  8241, 11136,
+     1426,  1663,  9585,  8653,  3915,  4919,   160, 12286,
+     2645,  7247,  4895,  9509,  9442, 10115,  9018,  3364,
+     1360,  6119, 11089,  6167,  7991,  2692,  5961,  1962,
+     2919,  4016,  6099, 11637,  6299,  8561,   948, 11964,
+     2459,  8633,  5782,  2503,  3054, 10542,  5257,  4433,
+     3570, 11454,  9139, 11580,  4079,   922,  7967,  2078,
+     9381,  3434,  1843,  9259,  9407,  2051,  8326,  6142,
+      156,  3991,  2031,  5876,  3772,  6381,  7515, 10996,
+     4754,  8974,  3757,  2925,  6554,  5868,   723,  9280,
+    10800,  5942,  6374,  1263,  7796,  6920,   350,  6906,
+     8301,   382,  8579,  5446,  1254,  1359,  8291, 10367,
+     6874,  5862, 10561,  4948,  7083, 12233,  1702,  8724,
+     7500,  7540,  7840, 12142,  2683,  6171,  7753,  6844,
+     7965,  4075, 11767,  5079,  6364, 11248, 11011, 10316,
+      431,  5906,  3957, 12138,  3174,  1323,  5874,  8953,
+     4169,  9369, 11502,  5468,  4698,  3445,   192,  4912,
+     9987,   504,  9260,  7507,  3263,  4624,  8687,  8209,
+     8812,   142,  8851,  4212, 11404,  5009,    58,  3532,
+};
+
+const uint16_t ntt512_scaled_inv_psi_powers[512] = {
+    12265,  4227,  9757,  9689,  3232,  8347,  9173,  1945,
+     3065,  2429,  9988,  4335,  9169,  8794,  2643,  6092,
+     2334,  3678,   457,  7070,  5202,  8545,  8095, 10545,
+    12226,   343, 11787,  5464,  8484, 11158, 10254,  9714,
+      365,  4840,  7785,  6771,  4099,  7723,  8474,  9847,
+     9199,   438,  5808,  9342, 10583,  2461,  4352,  7711,
+     4443,  8581,  7899,  2054,  3837,  7784,  5411, 10138,
+    11711,   416,   466,  7021,     7,  9520,  6883,  8951,
+     7250,  4222,  2957,  3017, 10883,  4924, 11424,  3344,
+      910,  8700,  9982,  8464,  8536,  8144,  3451, 11251,
+     1555,  1092, 10440,  4605,  7699,   412,  7315,  6599,
+     3670,  1866,  6226,   239,  5526,  6781,  5410,  8778,
+     5461,  4404,  4697,  9929, 10118,  9089, 10595,  6492,
+     5618,  9011,  2827, 10552,  9457,  7226,  8449,   425,
+      417,  1826,   982,  8308,  5289,  3975, 11129,  7681,
+      510,  5416,  4649,  6094,  5054,  3889,  4770, 10897,
+    11675,   612,  8957,  3121,  4855,  3607,  2209,  5724,
+     5703,  1721,  5650,  3375,  6203,  5826,  9244,   193,
+     4411,  1928,  4523,  6780,  4050,  2528,  9449,  8635,
+     7605,  7751,  9687,   512,  8136,  4860, 10407,  8881,
+    10362,  9126, 11759,  4251,  5530, 12221,  5832,  5115,
+      826,  5061,  1120, 11653,  7559,  6636,  4834, 11914,
+     6138,  3449,  8531,  1344,  9068,  6613, 10421,  3343,
+    11839,  2450,  1681,   406, 11444,  5966,  3020,  2674,
+    11385, 11749,  2940,  4475,  2945, 11275,  9617,  3624,
+      751,  1373, 11641,  3528,  5370,  3534,  1241,  4167,
+     1891,  3359,  9021,  4138, 11607,  6444,  1783,  3947,
+     9916,  4727,  1573,   994,    50,  6555,  5275,  9513,
+     9652,  2068, 10588,  9261, 11024,    60,  7866,  6330,
+     6500,  4209,  9855,  7790,  1282, 10771,    72, 11897,
+     7596,  7800,  2593, 11826,  9348,  6454,  3094,  5002,
+     6903, 11573,  9360, 10485,  4360,  6302,  5287,  1255,
+    10918,  3368,  8972, 11232,   293,  5232,   189, 11260,
+     1506,  8186, 11415,  3393,  6105,  7725, 11194, 10058,
+     1223,  4265, 12281,  1409, 11445,  7326,  9270, 10975,
+     7154,  8841,  5118,  4906, 11522,  1445, 11249, 11124,
+      881,  6127,   778,  1226,  8345,  6453,  1734, 11041,
+    10891,  3515, 12268,  8307,  3929, 10014,  2828, 11912,
+     3418,  3238,  4218,  9806,  2595,  2257,  9559, 10767,
+     6921, 11475, 11259,   146,  1936,  3114,  7624,  9013,
+     5547, 10763,  1481, 11053,  2633,  4781,  1279,  6691,
+     5900, 11572,  8000,  4235,  8348, 10533,  8195, 11366,
+    10487,  7080,  6513,  9600,  5082,  5102,  7724,  9834,
+     3808,  5211,  8496,  2900, 11520, 11014, 11038,  6811,
+     9343, 11943,  8711,   364,  3480,  1535, 10759,  8330,
+    10631,  6296,  9416,   622, 10268,  4176,  1842, 10453,
+     9996,  2926, 10013,  1468,  5662,  7406,  7469,  7126,
+     7628,  2164,  5969,  7100,  9135, 11710, 11345,  6505,
+    11009,  4238,   139,  4705,  8520, 10962,  1763,  1325,
+     7806, 10753,   170,  9998,  5646, 10224,  5781,  9489,
+     1590, 11825,  7988,   204,  7082,  9233,  9811,  9395,
+     8929,  1908,  1901,  4670, 10076,  1125,  6164,  1942,
+    11274,  8257,  9663,  4739,  5604,  2260,  1350,  4939,
+     7246, 11071,  2535,  6680,  3229,  4267,  2712,  1620,
+     3469, 11153,  3454,  3042,  8016,  1417, 10036,  8170,
+     1944,  1705,  8468,  1687,  8566, 12077,  6616,  2212,
+     9804, 12164,  2046,  5246,  6940,   448,  7119, 10397,
+     7570,  9307, 12139,  4913,  8753,  8328,  7911,  6085,
+     5103,  9084,  3795, 12109,   980,  5588,  5078, 11951,
+     7302,  1208,  8443,  4554, 12073,  1176,  1790,  1178,
+     4510,  1389,  8823,  5216,  3007,  9572,  3869,  2148,
+     8787,  5412, 11498,  5672,  8717,  8524,  4113,  2185,
+     9951,  3171, 11410,  8882, 11722,  3087,  7771,    20,
+     2622,  2110,  6263,  1403,  3285,  6693,  8620, 11783,
+};
+
+const uint16_t ntt512_omega_powers[512] = {
+        0,     1,     1,  1479,     1,  4043,  1479,  7143,
+        1,  6553,  4043, 10984,  1479,  8155,  7143, 11567,
+        1,  1212,  6553,  3542,  4043,  9094, 10984,  3621,
+     1479, 10643,  8155,  3504,  7143,  5860, 11567,  9744,
+        1,  5023,  1212,  4821,  6553,  5777,  3542,  9283,
+     4043,  6561,  9094,   949, 10984,  7311,  3621,   563,
+     1479,  6461, 10643,  2639,  8155,  3328,  3504,  2744,
+     7143,  7698,  5860,  2625, 11567, 10938,  9744,  9314,
+        1,  9326,  5023, 11119,  1212,  9521,  4821,  7484,
+     6553,    81,  5777,  1326,  3542, 12149,  9283,  9542,
+     4043,  2366,  6561,   955,  9094,  4255,   949,  2294,
+    10984,  7969,  7311,  3014,  3621, 11563,   563,  3135,
+     1479,  4896,  6461,  2319, 10643, 10654,  2639,  8736,
+     8155,  9198,  3328,  7203,  3504,  1853,  2744,  4846,
+     7143,  9238,  7698, 11499,  5860,  1177,  2625,  1062,
+    11567,  1000, 10938,  9088,  9744,  7678,  9314,  3712,
+        1,  1673,  9326,  7657,  5023, 10092, 11119,  8830,
+     1212, 12280,  9521,  2089,  4821,  3949,  7484, 10530,
+     6553,  1381,    81,   334,  5777,  5767,  1326,  6378,
+     3542,  2468, 12149, 11560,  9283,  9452,  9542,   355,
+     4043,  4989,  2366,  1260,  6561,  2476,   955,   145,
+     9094,   480,  4255,  3284,   949,  2396,  2294,  3694,
+    10984,  4177,  7969, 10861,  7311,  3748,  3014,  3932,
+     3621, 11745, 11563,  2013,   563,  7935,  3135,  9741,
+     1479,  4278,  4896,  6534,  6461,  7222,  2319,  8652,
+    10643, 11267, 10654,  5092,  2639,  3296,  8736,  3707,
+     8155,  2525,  9198,  2426,  3328,   827,  7203,  7399,
+     3504,   339,  1853,  3241,  2744,  6915,  4846,  8907,
+     7143,  5331,  9238,  7901,  7698, 12171, 11499,  5542,
+     5860,  9447,  1177,  2881,  2625,  4452,  1062,  7110,
+    11567,  8705,  1000,  1696, 10938,   953,  9088,  2731,
+     9744,  6498,  7678,  3289,  9314, 12159,  3712,  4231,
+        1, 10600,  1673,   773,  9326,  2884,  7657,  7644,
+     5023,  7852, 10092, 11744, 11119,  9890,  8830,  4976,
+     1212,  5195, 12280,  2912,  9521,  5332,  2089, 10911,
+     4821,  4938,  3949,  3066,  7484,  4905, 10530,  9302,
+     6553,  4372,  1381,  2401,    81, 10659,   334,  1168,
+     5777,   113,  5767,  4714,  1326,  9273,  6378,  5011,
+     3542,  2305,  2468,  9808, 12149,  2969, 11560,  2381,
+     9283,  1777,  9452, 11272,  9542,  6730,   355,  2566,
+     4043,  4057,  4989,  3833,  2366, 10040,  1260, 10146,
+     6561,  3149,  2476,  8585,   955,  9153,   145,   875,
+     9094,  1484,   480,   354,  4255,  2370,  3284,  7952,
+      949,  6998,  2396,  8526,  2294,  8758,  3694,  3646,
+    10984,  4414,  4177, 11222,  7969,  9103, 10861,  3248,
+     7311,  2166,  3748, 10752,  3014,  9289,  3932,  7201,
+     3621,  4053, 11745,  9430, 11563,  9603,  2013,  4096,
+      563,  7635,  7935,  5084,  3135,  1544,  9741,  2422,
+     1479,  8925,  4278,   390,  4896,  1153,  6534, 11885,
+     6461,     3,  7222,  5019,  2319,  3400,  8652, 10682,
+    10643,  2780, 11267,  5698, 10654,  8779,  5092,  1912,
+     2639,  3636,  3296, 12262,  8736,  3985,  3707,  6267,
+     8155,  2174,  2525, 11847,  9198, 10163,  2426,  7012,
+     3328,  7370,   827,  4143,  7203,   243,  7399,  1002,
+     3504,  5042,   339,  5012,  1853,  3978,  3241,  6845,
+     2744, 10626,  6915,  7404,  4846, 11869,  8907, 10102,
+     7143,  3271,  5331,  3778,  9238,  4048,  7901,  1065,
+     7698, 12129, 12171,  2678, 11499,  7098,  5542,  3780,
+     5860,  7394,  9447,  7428,  1177,  2865,  2881,   435,
+     2625,  2704,  4452,  1440,  1062,   476,  7110,  9852,
+    11567,  2847,  8705,  7188,  1000,  6882,  1696, 11082,
+    10938,  8374,   953,   242,  9088, 11618,  2731,  8005,
+     9744,  9644,  6498, 11244,  7678,  9042,  3289, 11796,
+     9314, 10863, 12159, 10657,  3712, 10111,  4231,  6039,
+};
+
+const uint16_t ntt512_omega_powers_rev[512] = {
+        0,     1,     1,  1479,     1,  1479,  4043,  7143,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+     5023,  6461,  6561,  7698,  5777,  3328,  7311, 10938,
+     4821,  2639,   949,  2625,  9283,  2744,   563,  9314,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+     5023,  6461,  6561,  7698,  5777,  3328,  7311, 10938,
+     4821,  2639,   949,  2625,  9283,  2744,   563,  9314,
+     9326,  4896,  2366,  9238,    81,  9198,  7969,  1000,
+     9521, 10654,  4255,  1177, 12149,  1853, 11563,  7678,
+    11119,  2319,   955, 11499,  1326,  7203,  3014,  9088,
+     7484,  8736,  2294,  1062,  9542,  4846,  3135,  3712,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+     5023,  6461,  6561,  7698,  5777,  3328,  7311, 10938,
+     4821,  2639,   949,  2625,  9283,  2744,   563,  9314,
+     9326,  4896,  2366,  9238,    81,  9198,  7969,  1000,
+     9521, 10654,  4255,  1177, 12149,  1853, 11563,  7678,
+    11119,  2319,   955, 11499,  1326,  7203,  3014,  9088,
+     7484,  8736,  2294,  1062,  9542,  4846,  3135,  3712,
+     1673,  4278,  4989,  5331,  1381,  2525,  4177,  8705,
+    12280, 11267,   480,  9447,  2468,   339, 11745,  6498,
+    10092,  7222,  2476, 12171,  5767,   827,  3748,   953,
+     3949,  3296,  2396,  4452,  9452,  6915,  7935, 12159,
+     7657,  6534,  1260,  7901,   334,  2426, 10861,  1696,
+     2089,  5092,  3284,  2881, 11560,  3241,  2013,  3289,
+     8830,  8652,   145,  5542,  6378,  7399,  3932,  2731,
+    10530,  3707,  3694,  7110,   355,  8907,  9741,  4231,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+     5023,  6461,  6561,  7698,  5777,  3328,  7311, 10938,
+     4821,  2639,   949,  2625,  9283,  2744,   563,  9314,
+     9326,  4896,  2366,  9238,    81,  9198,  7969,  1000,
+     9521, 10654,  4255,  1177, 12149,  1853, 11563,  7678,
+    11119,  2319,   955, 11499,  1326,  7203,  3014,  9088,
+     7484,  8736,  2294,  1062,  9542,  4846,  3135,  3712,
+     1673,  4278,  4989,  5331,  1381,  2525,  4177,  8705,
+    12280, 11267,   480,  9447,  2468,   339, 11745,  6498,
+    10092,  7222,  2476, 12171,  5767,   827,  3748,   953,
+     3949,  3296,  2396,  4452,  9452,  6915,  7935, 12159,
+     7657,  6534,  1260,  7901,   334,  2426, 10861,  1696,
+     2089,  5092,  3284,  2881, 11560,  3241,  2013,  3289,
+     8830,  8652,   145,  5542,  6378,  7399,  3932,  2731,
+    10530,  3707,  3694,  7110,   355,  8907,  9741,  4231,
+    10600,  8925,  4057,  3271,  4372,  2174,  4414,  2847,
+     5195,  2780,  1484,  7394,  2305,  5042,  4053,  9644,
+     7852,     3,  3149, 12129,   113,  7370,  2166,  8374,
+     4938,  3636,  6998,  2704,  1777, 10626,  7635, 10863,
+     2884,  1153, 10040,  4048, 10659, 10163,  9103,  6882,
+     5332,  8779,  2370,  2865,  2969,  3978,  9603,  9042,
+     9890,  3400,  9153,  7098,  9273,   243,  9289, 11618,
+     4905,  3985,  8758,   476,  6730, 11869,  1544, 10111,
+      773,   390,  3833,  3778,  2401, 11847, 11222,  7188,
+     2912,  5698,   354,  7428,  9808,  5012,  9430, 11244,
+    11744,  5019,  8585,  2678,  4714,  4143, 10752,   242,
+     3066, 12262,  8526,  1440, 11272,  7404,  5084, 10657,
+     7644, 11885, 10146,  1065,  1168,  7012,  3248, 11082,
+    10911,  1912,  7952,   435,  2381,  6845,  4096, 11796,
+     4976, 10682,   875,  3780,  5011,  1002,  7201,  8005,
+     9302,  6267,  3646,  9852,  2566, 10102,  2422,  6039,
+};
+
+const uint16_t ntt512_inv_omega_powers[512] = {
+        0,     1,     1, 10810,     1,  5146, 10810,  8246,
+        1,   722,  5146,  4134, 10810,  1305,  8246,  5736,
+        1,  2545,   722,  6429,  5146,  8785,  4134,  1646,
+    10810,  8668,  1305,  3195,  8246,  8747,  5736, 11077,
+        1,  2975,  2545,  1351,   722,  9664,  6429,  4591,
+     5146,  9545,  8785,  8961,  4134,  9650,  1646,  5828,
+    10810, 11726,  8668,  4978,  1305, 11340,  3195,  5728,
+     8246,  3006,  8747,  6512,  5736,  7468, 11077,  7266,
+        1,  8577,  2975,  4611,  2545,  3201,  1351, 11289,
+      722, 11227,  9664, 11112,  6429,   790,  4591,  3051,
+     5146,  7443,  9545, 10436,  8785,  5086,  8961,  3091,
+     4134,  3553,  9650,  1635,  1646,  9970,  5828,  7393,
+    10810,  9154, 11726,   726,  8668,  9275,  4978,  4320,
+     1305,  9995, 11340,  8034,  3195, 11334,  5728,  9923,
+     8246,  2747,  3006,   140,  8747, 10963,  6512, 12208,
+     5736,  4805,  7468,  2768, 11077,  1170,  7266,  2963,
+        1,  8058,  8577,   130,  2975,  9000,  4611,  5791,
+     2545,  9558,  3201, 11336,  1351, 10593, 11289,  3584,
+      722,  5179, 11227,  7837,  9664,  9408, 11112,  2842,
+     6429,  6747,   790,   118,  4591,  4388,  3051,  6958,
+     5146,  3382,  7443,  5374,  9545,  9048, 10436, 11950,
+     8785,  4890,  5086, 11462,  8961,  9863,  3091,  9764,
+     4134,  8582,  3553,  8993,  9650,  7197,  1635,  1022,
+     1646,  3637,  9970,  5067,  5828,  5755,  7393,  8011,
+    10810,  2548,  9154,  4354, 11726, 10276,   726,   544,
+     8668,  8357,  9275,  8541,  4978,  1428,  4320,  8112,
+     1305,  8595,  9995,  9893, 11340,  9005,  8034, 11809,
+     3195, 12144, 11334,  9813,  5728, 11029,  9923,  7300,
+     8246, 11934,  2747,  2837,  3006,   729,   140,  9821,
+     8747,  5911, 10963,  6522,  6512, 11955, 12208, 10908,
+     5736,  1759,  4805,  8340,  7468, 10200,  2768,     9,
+    11077,  3459,  1170,  2197,  7266,  4632,  2963, 10616,
+        1,  6250,  8058,  2178,  8577,  1632,   130,  1426,
+     2975,   493,  9000,  3247,  4611,  1045,  5791,  2645,
+     2545,  4284,  9558,   671,  3201, 12047, 11336,  3915,
+     1351,  1207, 10593,  5407, 11289,  5101,  3584,  9442,
+      722,  2437,  5179, 11813, 11227, 10849,  7837,  9585,
+     9664, 11854,  9408,  9424, 11112,  4861,  2842,  4895,
+     6429,  8509,  6747,  5191,   790,  9611,   118,   160,
+     4591, 11224,  4388,  8241,  3051,  8511,  6958,  9018,
+     5146,  2187,  3382,   420,  7443,  4885,  5374,  1663,
+     9545,  5444,  9048,  8311, 10436,  7277, 11950,  7247,
+     8785, 11287,  4890, 12046,  5086,  8146, 11462,  4919,
+     8961,  5277,  9863,  2126,  3091,   442,  9764, 10115,
+     4134,  6022,  8582,  8304,  3553,    27,  8993,  8653,
+     9650, 10377,  7197,  3510,  1635,  6591,  1022,  9509,
+     1646,  1607,  3637,  8889,  9970,  7270,  5067, 12286,
+     5828,   404,  5755, 11136,  7393, 11899,  8011,  3364,
+    10810,  9867,  2548, 10745,  9154,  7205,  4354,  4654,
+    11726,  8193, 10276,  2686,   726,  2859,   544,  8236,
+     8668,  5088,  8357,  3000,  9275,  1537,  8541, 10123,
+     4978,  9041,  1428,  3186,  4320,  1067,  8112,  7875,
+     1305,  8643,  8595,  3531,  9995,  3763,  9893,  5291,
+    11340,  4337,  9005,  9919,  8034, 11935, 11809, 10805,
+     3195, 11414, 12144,  3136, 11334,  3704,  9813,  9140,
+     5728,  2143, 11029,  2249,  9923,  8456,  7300,  8232,
+     8246,  9723, 11934,  5559,  2747,  1017,  2837, 10512,
+     3006,  9908,   729,  9320,   140,  2481,  9821,  9984,
+     8747,  7278,  5911,  3016, 10963,  7575,  6522, 12176,
+     6512, 11121, 11955,  1630, 12208,  9888, 10908,  7917,
+     5736,  2987,  1759,  7384,  4805,  9223,  8340,  7351,
+     7468,  1378, 10200,  6957,  2768,  9377,     9,  7094,
+    11077,  7313,  3459,  2399,  1170,   545,  2197,  4437,
+     7266,  4645,  4632,  9405,  2963, 11516, 10616,  1689,
+};
+
+const uint16_t ntt512_inv_omega_powers_rev[512] = {
+        0,     1,     1, 10810,     1, 10810,  5146,  8246,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+     2975, 11726,  9545,  3006,  9664, 11340,  9650,  7468,
+     1351,  4978,  8961,  6512,  4591,  5728,  5828,  7266,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+     2975, 11726,  9545,  3006,  9664, 11340,  9650,  7468,
+     1351,  4978,  8961,  6512,  4591,  5728,  5828,  7266,
+     8577,  9154,  7443,  2747, 11227,  9995,  3553,  4805,
+     3201,  9275,  5086, 10963,   790, 11334,  9970,  1170,
+     4611,   726, 10436,   140, 11112,  8034,  1635,  2768,
+    11289,  4320,  3091, 12208,  3051,  9923,  7393,  2963,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+     2975, 11726,  9545,  3006,  9664, 11340,  9650,  7468,
+     1351,  4978,  8961,  6512,  4591,  5728,  5828,  7266,
+     8577,  9154,  7443,  2747, 11227,  9995,  3553,  4805,
+     3201,  9275,  5086, 10963,   790, 11334,  9970,  1170,
+     4611,   726, 10436,   140, 11112,  8034,  1635,  2768,
+    11289,  4320,  3091, 12208,  3051,  9923,  7393,  2963,
+     8058,  2548,  3382, 11934,  5179,  8595,  8582,  1759,
+     9558,  8357,  4890,  5911,  6747, 12144,  3637,  3459,
+     9000, 10276,  9048,   729,  9408,  9005,  7197, 10200,
+    10593,  1428,  9863, 11955,  4388, 11029,  5755,  4632,
+      130,  4354,  5374,  2837,  7837,  9893,  8993,  8340,
+    11336,  8541, 11462,  6522,   118,  9813,  5067,  2197,
+     5791,   544, 11950,  9821,  2842, 11809,  1022,     9,
+     3584,  8112,  9764, 10908,  6958,  7300,  8011, 10616,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+     2975, 11726,  9545,  3006,  9664, 11340,  9650,  7468,
+     1351,  4978,  8961,  6512,  4591,  5728,  5828,  7266,
+     8577,  9154,  7443,  2747, 11227,  9995,  3553,  4805,
+     3201,  9275,  5086, 10963,   790, 11334,  9970,  1170,
+     4611,   726, 10436,   140, 11112,  8034,  1635,  2768,
+    11289,  4320,  3091, 12208,  3051,  9923,  7393,  2963,
+     8058,  2548,  3382, 11934,  5179,  8595,  8582,  1759,
+     9558,  8357,  4890,  5911,  6747, 12144,  3637,  3459,
+     9000, 10276,  9048,   729,  9408,  9005,  7197, 10200,
+    10593,  1428,  9863, 11955,  4388, 11029,  5755,  4632,
+      130,  4354,  5374,  2837,  7837,  9893,  8993,  8340,
+    11336,  8541, 11462,  6522,   118,  9813,  5067,  2197,
+     5791,   544, 11950,  9821,  2842, 11809,  1022,     9,
+     3584,  8112,  9764, 10908,  6958,  7300,  8011, 10616,
+     6250,  9867,  2187,  9723,  2437,  8643,  6022,  2987,
+     4284,  5088, 11287,  7278,  8509, 11414,  1607,  7313,
+      493,  8193,  5444,  9908, 11854,  4337, 10377,  1378,
+     1207,  9041,  5277, 11121, 11224,  2143,   404,  4645,
+     1632,  7205,  4885,  1017, 10849,  3763,    27,  9223,
+    12047,  1537,  8146,  7575,  9611,  3704,  7270,   545,
+     1045,  2859,  7277,  2481,  4861, 11935,  6591,  9377,
+     5101,  1067,   442,  9888,  8511,  8456, 11899, 11516,
+     2178, 10745,   420,  5559, 11813,  3531,  8304,  7384,
+      671,  3000, 12046,  3016,  5191,  3136,  8889,  2399,
+     3247,  2686,  8311,  9320,  9424,  9919,  3510,  6957,
+     5407,  3186,  2126,  1630,  8241,  2249, 11136,  9405,
+     1426,  4654,  1663, 10512,  9585,  5291,  8653,  7351,
+     3915, 10123,  4919, 12176,   160,  9140, 12286,  4437,
+     2645,  8236,  7247,  9984,  4895, 10805,  9509,  7094,
+     9442,  7875, 10115,  7917,  9018,  8232,  3364,  1689,
+};
+
+const uint16_t ntt512_mixed_powers[512] = {
+        0,  1479,  4043,  7143,  6553, 10984,  8155, 11567,
+     1212,  3542,  9094,  3621, 10643,  3504,  5860,  9744,
+     5023,  4821,  5777,  9283,  6561,   949,  7311,   563,
+     6461,  2639,  3328,  2744,  7698,  2625, 10938,  9314,
+     9326, 11119,  9521,  7484,    81,  1326, 12149,  9542,
+     2366,   955,  4255,  2294,  7969,  3014, 11563,  3135,
+     4896,  2319, 10654,  8736,  9198,  7203,  1853,  4846,
+     9238, 11499,  1177,  1062,  1000,  9088,  7678,  3712,
+     1673,  7657, 10092,  8830, 12280,  2089,  3949, 10530,
+     1381,   334,  5767,  6378,  2468, 11560,  9452,   355,
+     4989,  1260,  2476,   145,   480,  3284,  2396,  3694,
+     4177, 10861,  3748,  3932, 11745,  2013,  7935,  9741,
+     4278,  6534,  7222,  8652, 11267,  5092,  3296,  3707,
+     2525,  2426,   827,  7399,   339,  3241,  6915,  8907,
+     5331,  7901, 12171,  5542,  9447,  2881,  4452,  7110,
+     8705,  1696,   953,  2731,  6498,  3289, 12159,  4231,
+    10600,   773,  2884,  7644,  7852, 11744,  9890,  4976,
+     5195,  2912,  5332, 10911,  4938,  3066,  4905,  9302,
+     4372,  2401, 10659,  1168,   113,  4714,  9273,  5011,
+     2305,  9808,  2969,  2381,  1777, 11272,  6730,  2566,
+     4057,  3833, 10040, 10146,  3149,  8585,  9153,   875,
+     1484,   354,  2370,  7952,  6998,  8526,  8758,  3646,
+     4414, 11222,  9103,  3248,  2166, 10752,  9289,  7201,
+     4053,  9430,  9603,  4096,  7635,  5084,  1544,  2422,
+     8925,   390,  1153, 11885,     3,  5019,  3400, 10682,
+     2780,  5698,  8779,  1912,  3636, 12262,  3985,  6267,
+     2174, 11847, 10163,  7012,  7370,  4143,   243,  1002,
+     5042,  5012,  3978,  6845, 10626,  7404, 11869, 10102,
+     3271,  3778,  4048,  1065, 12129,  2678,  7098,  3780,
+     7394,  7428,  2865,   435,  2704,  1440,   476,  9852,
+     2847,  7188,  6882, 11082,  8374,   242, 11618,  8005,
+     9644, 11244,  9042, 11796, 10863, 10657, 10111,  6039,
+     1003,  1815,  6715,  1112,  2049,  4737, 11635, 10885,
+    11868, 10596,  8429,  6370,  6234,  2447,  8410,  1594,
+    11314,    49,  3262,  8243,  1010,  2281,  6137,  6523,
+     5886,   347,  3789,  2948, 10162,  4115,  5339,  2555,
+    10333, 10232,  8775, 11848,  7509, 11836,  3199,  4049,
+     6212,  2738,  8471,  9166,  2766, 10335,  6854, 12121,
+     1105,  1583,  5315,  6224,  7048,  3969,  6153,  4077,
+     8076,   426,  5537, 12225,  9784,  3529, 11973,  5297,
+    12048,  1512,  2344, 10331,  1321,  5429, 10302,  1146,
+     6068,   174,  1050,  8455, 11612,   576, 10256,  5106,
+     2844,  1483,  2169, 10970,  3482,  5333,   400,   295,
+     5594,  1975,  6833, 10723,  2839,  9928,  6093,  7105,
+     6008,  3202, 11271, 11231,  5057, 11871,  5529,  1159,
+     8689,  9634, 11099,  6803, 12237,  1805, 11316,  8960,
+     6608,  9789,  7373,  8049,  9162,  9522,  3643,  3762,
+    11684,  1858,  7822, 11606, 10710,   218,   468,  8333,
+     8757,  5383,  1973, 10211,  7377,  1293,  3565,   325,
+     4080,  3009,  5445,  7856,  3336,  6147,  1922, 10327,
+     8077, 11026,  7210,   709,  6821,  6413,  7341,   652,
+     4782,  9364,   147,  9786,   151,  3030,  6843,  6122,
+     7280,  5369,  1041, 11367,  8844,  5908,    56,  3728,
+     7665,  6421,  6118,  1747, 10966, 10238, 10930,  9597,
+    12147,  6347,  8214,   835,  2920,  8298,  6427,  8273,
+    11785,  3315,  4749,  3656,  6383,  8855, 11907,  6170,
+    12231, 11939,  1278,  4322, 12097,  4774, 10587, 11341,
+     3602, 11566,  4536,  7032,  6415,  3963,  3998,  6328,
+     3438,  5915,   522,  3150,   787, 10258,  1728,  6190,
+     3029,  8532,  4449,  6507,  8332, 10446,  3710,  1200,
+      885,  4493,  5925,  8210,  7591,  8517,  5206,  5990,
+     9026,  5735,  9606,  9235,  9115,  2882, 11035,  4298,
+     3477,  1489,  4324,  8719,  8120, 12133,  5415,  9370,
+     2302,  7535,  4789,  9830, 11858,  2908,  3988, 10929,
+};
+
+const uint16_t ntt512_mixed_powers_rev[512] = {
+        0,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+     1212, 10643,  9094,  5860,  3542,  3504,  3621,  9744,
+     5023,  6461,  6561,  7698,  5777,  3328,  7311, 10938,
+     4821,  2639,   949,  2625,  9283,  2744,   563,  9314,
+     9326,  4896,  2366,  9238,    81,  9198,  7969,  1000,
+     9521, 10654,  4255,  1177, 12149,  1853, 11563,  7678,
+    11119,  2319,   955, 11499,  1326,  7203,  3014,  9088,
+     7484,  8736,  2294,  1062,  9542,  4846,  3135,  3712,
+     1673,  4278,  4989,  5331,  1381,  2525,  4177,  8705,
+    12280, 11267,   480,  9447,  2468,   339, 11745,  6498,
+    10092,  7222,  2476, 12171,  5767,   827,  3748,   953,
+     3949,  3296,  2396,  4452,  9452,  6915,  7935, 12159,
+     7657,  6534,  1260,  7901,   334,  2426, 10861,  1696,
+     2089,  5092,  3284,  2881, 11560,  3241,  2013,  3289,
+     8830,  8652,   145,  5542,  6378,  7399,  3932,  2731,
+    10530,  3707,  3694,  7110,   355,  8907,  9741,  4231,
+    10600,  8925,  4057,  3271,  4372,  2174,  4414,  2847,
+     5195,  2780,  1484,  7394,  2305,  5042,  4053,  9644,
+     7852,     3,  3149, 12129,   113,  7370,  2166,  8374,
+     4938,  3636,  6998,  2704,  1777, 10626,  7635, 10863,
+     2884,  1153, 10040,  4048, 10659, 10163,  9103,  6882,
+     5332,  8779,  2370,  2865,  2969,  3978,  9603,  9042,
+     9890,  3400,  9153,  7098,  9273,   243,  9289, 11618,
+     4905,  3985,  8758,   476,  6730, 11869,  1544, 10111,
+      773,   390,  3833,  3778,  2401, 11847, 11222,  7188,
+     2912,  5698,   354,  7428,  9808,  5012,  9430, 11244,
+    11744,  5019,  8585,  2678,  4714,  4143, 10752,   242,
+     3066, 12262,  8526,  1440, 11272,  7404,  5084, 10657,
+     7644, 11885, 10146,  1065,  1168,  7012,  3248, 11082,
+    10911,  1912,  7952,   435,  2381,  6845,  4096, 11796,
+     4976, 10682,   875,  3780,  5011,  1002,  7201,  8005,
+     9302,  6267,  3646,  9852,  2566, 10102,  2422,  6039,
+     1003,  8757, 12048, 12231, 10333,  7280,  6008,   885,
+    11314,  8077,  2844,  3438,  1105, 12147,  6608,  3477,
+    11868,  4080,  6068,  3602,  6212,  7665,  8689,  9026,
+     5886,  4782,  5594,  3029,  8076, 11785, 11684,  2302,
+     2049,  7377,  1321, 12097,  7509,  8844,  5057,  7591,
+     1010,  6821,  3482,   787,  7048,  2920,  9162,  8120,
+     6234,  3336, 11612,  6415,  2766, 10966, 12237,  9115,
+    10162,   151,  2839,  8332,  9784,  6383, 10710, 11858,
+     6715,  1973,  2344,  1278,  8775,  1041, 11271,  5925,
+     3262,  7210,  2169,   522,  5315,  8214,  7373,  4324,
+     8429,  5445,  1050,  4536,  8471,  6118, 11099,  9606,
+     3789,   147,  6833,  4449,  5537,  4749,  7822,  4789,
+    11635,  3565, 10302, 10587,  3199,    56,  5529,  5206,
+     6137,  7341,   400,  1728,  6153,  6427,  3643,  5415,
+     8410,  1922, 10256,  3998,  6854, 10930, 11316, 11035,
+     5339,  6843,  6093,  3710, 11973, 11907,   468,  3988,
+     1815,  5383,  1512, 11939, 10232,  5369,  3202,  4493,
+       49, 11026,  1483,  5915,  1583,  6347,  9789,  1489,
+    10596,  3009,   174, 11566,  2738,  6421,  9634,  5735,
+      347,  9364,  1975,  8532,   426,  3315,  1858,  7535,
+     4737,  1293,  5429,  4774, 11836,  5908, 11871,  8517,
+     2281,  6413,  5333, 10258,  3969,  8298,  9522, 12133,
+     2447,  6147,   576,  3963, 10335, 10238,  1805,  2882,
+     4115,  3030,  9928, 10446,  3529,  8855,   218,  2908,
+     1112, 10211, 10331,  4322, 11848, 11367, 11231,  8210,
+     8243,   709, 10970,  3150,  6224,   835,  8049,  8719,
+     6370,  7856,  8455,  7032,  9166,  1747,  6803,  9235,
+     2948,  9786, 10723,  6507, 12225,  3656, 11606,  9830,
+    10885,   325,  1146, 11341,  4049,  3728,  1159,  5990,
+     6523,   652,   295,  6190,  4077,  8273,  3762,  9370,
+     1594, 10327,  5106,  6328, 12121,  9597,  8960,  4298,
+     2555,  6122,  7105,  1200,  5297,  6170,  8333, 10929,
+};
+
+const uint16_t ntt512_inv_mixed_powers[512] = {
+        0, 10810,  5146,  8246,   722,  4134,  1305,  5736,
+     2545,  6429,  8785,  1646,  8668,  3195,  8747, 11077,
+     2975,  1351,  9664,  4591,  9545,  8961,  9650,  5828,
+    11726,  4978, 11340,  5728,  3006,  6512,  7468,  7266,
+     8577,  4611,  3201, 11289, 11227, 11112,   790,  3051,
+     7443, 10436,  5086,  3091,  3553,  1635,  9970,  7393,
+     9154,   726,  9275,  4320,  9995,  8034, 11334,  9923,
+     2747,   140, 10963, 12208,  4805,  2768,  1170,  2963,
+     8058,   130,  9000,  5791,  9558, 11336, 10593,  3584,
+     5179,  7837,  9408,  2842,  6747,   118,  4388,  6958,
+     3382,  5374,  9048, 11950,  4890, 11462,  9863,  9764,
+     8582,  8993,  7197,  1022,  3637,  5067,  5755,  8011,
+     2548,  4354, 10276,   544,  8357,  8541,  1428,  8112,
+     8595,  9893,  9005, 11809, 12144,  9813, 11029,  7300,
+    11934,  2837,   729,  9821,  5911,  6522, 11955, 10908,
+     1759,  8340, 10200,     9,  3459,  2197,  4632, 10616,
+     6250,  2178,  1632,  1426,   493,  3247,  1045,  2645,
+     4284,   671, 12047,  3915,  1207,  5407,  5101,  9442,
+     2437, 11813, 10849,  9585, 11854,  9424,  4861,  4895,
+     8509,  5191,  9611,   160, 11224,  8241,  8511,  9018,
+     2187,   420,  4885,  1663,  5444,  8311,  7277,  7247,
+    11287, 12046,  8146,  4919,  5277,  2126,   442, 10115,
+     6022,  8304,    27,  8653, 10377,  3510,  6591,  9509,
+     1607,  8889,  7270, 12286,   404, 11136, 11899,  3364,
+     9867, 10745,  7205,  4654,  8193,  2686,  2859,  8236,
+     5088,  3000,  1537, 10123,  9041,  3186,  1067,  7875,
+     8643,  3531,  3763,  5291,  4337,  9919, 11935, 10805,
+    11414,  3136,  3704,  9140,  2143,  2249,  8456,  8232,
+     9723,  5559,  1017, 10512,  9908,  9320,  2481,  9984,
+     7278,  3016,  7575, 12176, 11121,  1630,  9888,  7917,
+     2987,  7384,  9223,  7351,  1378,  6957,  9377,  7094,
+     7313,  2399,   545,  4437,  4645,  9405, 11516,  1689,
+     1360,  8301,  9381,   431,  2459,  7500,  4754,  9987,
+     2919,  6874,   156,  4169,  3570,  7965, 10800,  8812,
+     7991,  1254,  9407,  3174,  3054,  2683,  6554,  3263,
+     6299,  7083,  3772,  4698,  4079,  6364,  7796, 11404,
+    11089,  8579,  1843,  3957,  5782,  7840,  3757,  9260,
+     6099, 10561,  2031, 11502,  9139, 11767,  6374,  8851,
+     5961,  8291,  8326,  5874,  5257,  7753,   723,  8687,
+      948,  1702,  7515,   192,  7967, 11011,   350,    58,
+     6119,   382,  3434,  5906,  8633,  7540,  8974,   504,
+     4016,  5862,  3991,  9369, 11454,  4075,  5942,   142,
+     2692,  1359,  2051,  1323, 10542,  6171,  5868,  4624,
+     8561, 12233,  6381,  3445,   922, 11248,  6920,  5009,
+     6167,  5446,  9259, 12138,  2503, 12142,  2925,  7507,
+    11637,  4948,  5876,  5468, 11580,  5079,  1263,  4212,
+     1962, 10367,  6142,  8953,  4433,  6844,  9280,  8209,
+    11964,  8724, 10996,  4912,  2078, 10316,  6906,  3532,
+     3956, 11821, 12071,  1579,   683,  4467, 10431,   605,
+     8527,  8646,  2767,  3127,  4240,  4916,  2500,  5681,
+     3329,   973, 10484,    52,  5486,  1190,  2655,  3600,
+    11130,  6760,   418,  7232,  1058,  1018,  9087,  6281,
+     5184,  6196,  2361,  9450,  1566,  5456, 10314,  6695,
+    11994, 11889,  6956,  8807,  1319, 10120, 10806,  9445,
+     7183,  2033, 11713,   677,  3834, 11239, 12115,  6221,
+    11143,  1987,  6860, 10968,  1958,  9945, 10777,   241,
+     6992,   316,  8760,  2505,    64,  6752, 11863,  4213,
+     8212,  6136,  8320,  5241,  6065,  6974, 10706, 11184,
+      168,  5435,  1954,  9523,  3123,  3818,  9551,  6077,
+     8240,  9090,   453,  4780,   441,  3514,  2057,  1956,
+     9734,  6950,  8174,  2127,  9341,  8500, 11942,  6403,
+     5766,  6152, 10008, 11279,  4046,  9027, 12240,   975,
+    10695,  3879,  9842,  6055,  5919,  3860,  1693,   421,
+     1404,   654,  7552, 10240, 11177,  5574, 10474, 11286,
+};
+
+const uint16_t ntt512_inv_mixed_powers_rev[512] = {
+        0, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     2545,  8668,  8785,  8747,  6429,  3195,  1646, 11077,
+     2975, 11726,  9545,  3006,  9664, 11340,  9650,  7468,
+     1351,  4978,  8961,  6512,  4591,  5728,  5828,  7266,
+     8577,  9154,  7443,  2747, 11227,  9995,  3553,  4805,
+     3201,  9275,  5086, 10963,   790, 11334,  9970,  1170,
+     4611,   726, 10436,   140, 11112,  8034,  1635,  2768,
+    11289,  4320,  3091, 12208,  3051,  9923,  7393,  2963,
+     8058,  2548,  3382, 11934,  5179,  8595,  8582,  1759,
+     9558,  8357,  4890,  5911,  6747, 12144,  3637,  3459,
+     9000, 10276,  9048,   729,  9408,  9005,  7197, 10200,
+    10593,  1428,  9863, 11955,  4388, 11029,  5755,  4632,
+      130,  4354,  5374,  2837,  7837,  9893,  8993,  8340,
+    11336,  8541, 11462,  6522,   118,  9813,  5067,  2197,
+     5791,   544, 11950,  9821,  2842, 11809,  1022,     9,
+     3584,  8112,  9764, 10908,  6958,  7300,  8011, 10616,
+     6250,  9867,  2187,  9723,  2437,  8643,  6022,  2987,
+     4284,  5088, 11287,  7278,  8509, 11414,  1607,  7313,
+      493,  8193,  5444,  9908, 11854,  4337, 10377,  1378,
+     1207,  9041,  5277, 11121, 11224,  2143,   404,  4645,
+     1632,  7205,  4885,  1017, 10849,  3763,    27,  9223,
+    12047,  1537,  8146,  7575,  9611,  3704,  7270,   545,
+     1045,  2859,  7277,  2481,  4861, 11935,  6591,  9377,
+     5101,  1067,   442,  9888,  8511,  8456, 11899, 11516,
+     2178, 10745,   420,  5559, 11813,  3531,  8304,  7384,
+      671,  3000, 12046,  3016,  5191,  3136,  8889,  2399,
+     3247,  2686,  8311,  9320,  9424,  9919,  3510,  6957,
+     5407,  3186,  2126,  1630,  8241,  2249, 11136,  9405,
+     1426,  4654,  1663, 10512,  9585,  5291,  8653,  7351,
+     3915, 10123,  4919, 12176,   160,  9140, 12286,  4437,
+     2645,  8236,  7247,  9984,  4895, 10805,  9509,  7094,
+     9442,  7875, 10115,  7917,  9018,  8232,  3364,  1689,
+     1360,  3956,  6119,  6992, 11089,  5184,  6167,  9734,
+     7991,  3329,  2692,   168,  5961,  7183,  1962, 10695,
+     2919,  8527,  4016,  8212,  6099, 11994, 11637,  5766,
+     6299, 11130,  8561,  8240,   948, 11143, 11964,  1404,
+     2459,   683,  8633,    64,  5782,  1566,  2503,  9341,
+     3054,  5486, 10542,  3123,  5257,  3834,  4433,  5919,
+     3570,  4240, 11454,  6065,  9139,  1319, 11580,  4046,
+     4079,  1058,   922,   441,  7967,  1958,  2078, 11177,
+     9381, 12071,  3434,  8760,  1843,  2361,  9259,  8174,
+     9407, 10484,  2051,  1954,  8326, 11713,  6142,  9842,
+      156,  2767,  3991,  8320,  2031,  6956,  5876, 10008,
+     3772,   418,  6381,   453,  7515,  6860, 10996,  7552,
+     4754, 10431,  8974, 11863,  3757, 10314,  2925, 11942,
+     6554,  2655,  5868,  9551,   723, 12115,  9280,  1693,
+    10800,  2500,  5942, 10706,  6374, 10806,  1263, 12240,
+     7796,  9087,  6920,  2057,   350, 10777,  6906, 10474,
+     8301, 11821,   382,   316,  8579,  6196,  5446,  6950,
+     1254,   973,  1359,  5435,  8291,  2033, 10367,  3879,
+     6874,  8646,  5862,  6136, 10561, 11889,  4948,  6152,
+     7083,  6760, 12233,  9090,  1702,  1987,  8724,   654,
+     7500,  4467,  7540,  6752,  7840,  5456, 12142,  8500,
+     2683,  1190,  6171,  3818,  7753, 11239,  6844,  3860,
+     7965,  4916,  4075,  6974, 11767, 10120,  5079,  9027,
+     6364,  1018, 11248,  3514, 11011,  9945, 10316,  5574,
+      431,  1579,  5906,  2505,  3957,  9450, 12138,  2127,
+     3174,    52,  1323,  9523,  5874,   677,  8953,  6055,
+     4169,  3127,  9369,  5241, 11502,  8807,  5468, 11279,
+     4698,  7232,  3445,  4780,   192, 10968,  4912, 10240,
+     9987,   605,   504,  4213,  9260,  6695,  7507,  6403,
+     3263,  3600,  4624,  6077,  8687,  6221,  8209,   421,
+     8812,  5681,   142, 11184,  8851,  9445,  4212,   975,
+    11404,  6281,  5009,  1956,    58,   241,  3532, 11286,
+};
+
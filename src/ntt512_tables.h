@@ -0,0 +1,45 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 512
+ * - psi = 1003
+ * - omega = psi^2 = 10600
+ * - inverse of psi = 1360
+ * - inverse of omega = 6250
+ * - inverse of n = 12265
+ */
+
+#ifndef __NTT512_TABLES_H
+#define __NTT512_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt512_psi = 1003;
+static const int32_t ntt512_omega = 10600;
+static const int32_t ntt512_inv_psi = 1360;
+static const int32_t ntt512_inv_omega = 6250;
+static const int32_t ntt512_inv_n = 12265;
+
+/*
+ * POWERS OF PSI
+ */
+extern const uint16_t ntt512_psi_powers[512];
+extern const uint16_t ntt512_inv_psi_powers[512];
+extern const uint16_t ntt512_scaled_inv_psi_powers[512];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint16_t ntt512_omega_powers[512];
+extern const uint16_t ntt512_omega_powers_rev[512];
+extern const uint16_t ntt512_inv_omega_powers[512];
+extern const uint16_t ntt512_inv_omega_powers_rev[512];
+extern const uint16_t ntt512_mixed_powers[512];
+extern const uint16_t ntt512_mixed_powers_rev[512];
+extern const uint16_t ntt512_inv_mixed_powers[512];
+extern const uint16_t ntt512_inv_mixed_powers_rev[512];
+
+#endif /* __NTT512_TABLES_H */
@@ -0,0 +1,369 @@
+/*
+ * BD: NTT variants for 64bit primes (Shoup multiplication and
+ * Harvey's lazy butterflies).
+ */
+
+#include <assert.h>
+
+#include "ntt64.h"
+
+typedef unsigned __int128 uint128_t;
+
+/*
+ * High-order 64 bits of x * y
+ */
+static inline uint64_t mulhi(uint64_t x, uint64_t y) {
+  return (uint64_t) (((uint128_t) x * y) >> 64);
+}
+
+/*
+ * x * w modulo q, in [0, 2q-1]
+ * - w must be in [0, q-1] and wq = floor(w * 2^64 / q)
+ */
+static inline uint64_t shoup_mul(uint64_t x, uint64_t w, uint64_t wq, uint64_t q) {
+  return x * w - mulhi(x, wq) * q;
+}
+
+/*
+ * x - b if x >= b
+ */
+static inline uint64_t csub(uint64_t x, uint64_t b) {
+  return x >= b ? x - b : x;
+}
+
+/*
+ * Montgomery: x * y / 2^64 modulo q, in [0, q-1]
+ * - qinv = inverse of q modulo 2^64
+ * - x * y must be less than q * 2^64
+ *
+ * With m = lo(x * y) * qinv, lo(m * q) = lo(x * y) so
+ * x * y - m * q = (hi(x * y) - hi(m * q)) * 2^64, and both high
+ * parts are in [0, q-1].
+ */
+static inline uint64_t mont_mul(uint64_t x, uint64_t y, uint64_t q, uint64_t qinv) {
+  uint128_t z;
+  uint64_t m, r;
+
+  z = (uint128_t) x * y;
+  m = (uint64_t) z * qinv;
+  r = (uint64_t) (z >> 64) - mulhi(m, q);
+  return ((int64_t) r < 0) ? r + q : r;
+}
+
+/*
+ * Butterflies
+ */
+static inline void ct_butterfly(uint64_t *x, uint64_t *y, uint64_t w, uint64_t wq, uint64_t q) {
+  uint64_t u, v;
+
+  u = csub(*x, 2 * q);
+  v = shoup_mul(*y, w, wq, q);
+  *x = u + v;
+  *y = u - v + 2 * q;
+}
+
+static inline void gs_butterfly(uint64_t *x, uint64_t *y, uint64_t w, uint64_t wq, uint64_t q) {
+  uint64_t u, v;
+
+  u = *x;
+  v = *y;
+  *x = csub(u + v, 2 * q);
+  *y = shoup_mul(u - v + 2 * q, w, wq, q);
+}
+
+
+/*
+ * UTILITIES
+ */
+void ntt64_correct(uint64_t *a, uint32_t n, uint64_t q) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = csub(csub(a[i], 2 * q), q);
+  }
+}
+
+void ntt64_mul_powers(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = shoup_mul(a[i], p[i], p[n + i], q);
+  }
+}
+
+void ntt64_scalar_mul_array(uint64_t *a, uint32_t n, uint64_t q, uint64_t c, uint64_t c_shoup) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = shoup_mul(a[i], c, c_shoup, q);
+  }
+}
+
+void ntt64_mul_array(uint64_t *c, uint32_t n, uint64_t q, uint64_t qinv, const uint64_t *a, const uint64_t *b) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    c[i] = mont_mul(a[i], b[i], q, qinv);
+  }
+}
+
+
+/*
+ * ROUNDS
+ *
+ * The loops are the same as in ntt.c (without the special case for
+ * j=0). The AVX2 versions call the assembly kernels for the rounds
+ * with at least four consecutive butterflies and these functions
+ * for the others.
+ */
+
+/*
+ * Cooley-Tukey, bit-reverse to standard order: rounds t0 <= t < t1
+ */
+static void ct_rev2std_rounds(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p, uint32_t t0, uint32_t t1) {
+  uint32_t j, s, t;
+
+  for (t=t0; t<n && t<t1; t <<= 1) {
+    for (j=0; j<t; j++) {
+      for (s=j; s<n; s += t + t) {
+        ct_butterfly(a + s, a + s + t, p[t + j], p[n + t + j], q);
+      }
+    }
+  }
+}
+
+/*
+ * Cooley-Tukey, standard to bit-reverse order: rounds t >= t0
+ */
+static void ct_std2rev_rounds(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p, uint32_t t0) {
+  uint32_t j, s, t, u, d;
+
+  d = n;
+  for (t=1; t<n; t <<= 1) {
+    d >>= 1;
+    if (t < t0) continue;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      for (s=u; s<u+d; s++) {
+        ct_butterfly(a + s, a + s + d, p[t + j], p[n + t + j], q);
+      }
+    }
+  }
+}
+
+/*
+ * Gentleman-Sande, bit-reverse to standard order: rounds d < d1
+ */
+static void gs_rev2std_rounds(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p, uint32_t d1) {
+  uint32_t j, s, t, u, d;
+
+  t = n;
+  for (d=1; d<n && d<d1; d<<=1) {
+    t >>= 1;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      for (s=u; s<u+d; s++) {
+        gs_butterfly(a + s, a + s + d, p[t + j], p[n + t + j], q);
+      }
+    }
+  }
+}
+
+/*
+ * Gentleman-Sande, standard to bit-reverse order: rounds t < t1
+ */
+static void gs_std2rev_rounds(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p, uint32_t t1) {
+  uint32_t j, s, t;
+
+  for (t = n>>1; t > 0; t >>= 1) {
+    if (t >= t1) continue;
+    for (j=0; j<t; j++) {
+      for (s=j; s<n; s += t + t) {
+        gs_butterfly(a + s, a + s + t, p[t + j], p[n + t + j], q);
+      }
+    }
+  }
+}
+
+
+/*
+ * NTT VARIANTS
+ */
+void ntt64_ct_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_rev2std_rounds(a, n, q, p, 1, n);
+}
+
+void mulntt64_ct_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_rev2std_rounds(a, n, q, p, 1, n);
+}
+
+void ntt64_ct_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_std2rev_rounds(a, n, q, p, 1);
+}
+
+void mulntt64_ct_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_std2rev_rounds(a, n, q, p, 1);
+}
+
+void ntt64_gs_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_rev2std_rounds(a, n, q, p, n);
+}
+
+void nttmul64_gs_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_rev2std_rounds(a, n, q, p, n);
+}
+
+void ntt64_gs_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_std2rev_rounds(a, n, q, p, n);
+}
+
+void nttmul64_gs_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_std2rev_rounds(a, n, q, p, n);
+}
+
+
+/*
+ * FOUR-STEP VARIANTS
+ */
+
+/*
+ * Transpose by blocks of 8 x 8
+ */
+void ntt64_transpose(uint64_t *b, const uint64_t *a, uint32_t rows, uint32_t cols) {
+  uint32_t i, j, k, l, i_end, j_end;
+
+  for (i=0; i<rows; i += 8) {
+    i_end = (i + 8 < rows) ? i + 8 : rows;
+    for (j=0; j<cols; j += 8) {
+      j_end = (j + 8 < cols) ? j + 8 : cols;
+      for (k=i; k<i_end; k++) {
+        for (l=j; l<j_end; l++) {
+          b[l * rows + k] = a[k * cols + l];
+        }
+      }
+    }
+  }
+}
+
+/*
+ * n = n1 * n2:
+ * 1) transpose a (n1 x n2) into tmp (n2 x n1)
+ * 2) n2 NTTs of size n1 on the rows of tmp (table p1)
+ * 3) multiply by the twiddle factors tw
+ * 4) transpose tmp into a (n1 x n2)
+ * 5) n1 NTTs of size n2 on the rows of a (table p2)
+ */
+void ntt64_ct_std2rev_4step(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                            const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  ntt64_transpose(tmp, a, n1, n2);
+  for (i=0; i<n; i += n1) {
+    mulntt64_ct_std2rev(tmp + i, n1, q, p1);
+  }
+  ntt64_mul_powers(tmp, n, q, tw);
+  ntt64_transpose(a, tmp, n2, n1);
+  for (i=0; i<n; i += n2) {
+    ntt64_ct_std2rev(a + i, n2, q, p2);
+  }
+}
+
+/*
+ * Inverse of the above:
+ * 1) n1 NTTs of size n2 on the rows of a (table p2)
+ * 2) transpose a (n1 x n2) into tmp (n2 x n1)
+ * 3) multiply by the twiddle factors tw
+ * 4) n2 NTTs of size n1 on the rows of tmp (table p1)
+ * 5) transpose tmp into a
+ */
+void ntt64_gs_rev2std_4step(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                            const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  for (i=0; i<n; i += n2) {
+    ntt64_gs_rev2std(a + i, n2, q, p2);
+  }
+  ntt64_transpose(tmp, a, n1, n2);
+  ntt64_mul_powers(tmp, n, q, tw);
+  for (i=0; i<n; i += n1) {
+    nttmul64_gs_rev2std(tmp + i, n1, q, p1);
+  }
+  ntt64_transpose(a, tmp, n2, n1);
+}
+
+
+/*
+ * AVX2 VERSIONS: the kernels do the rounds with four or more
+ * consecutive butterflies, the two remaining rounds are done here.
+ */
+void ntt64_ct_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_rev2std_rounds(a, n, q, p, 1, 4);
+  ntt64_ct_rev2std_rounds_asm(a, n, q, p);
+}
+
+void mulntt64_ct_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ct_rev2std_rounds(a, n, q, p, 1, 4);
+  ntt64_ct_rev2std_rounds_asm(a, n, q, p);
+}
+
+void ntt64_ct_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ntt64_ct_std2rev_rounds_asm(a, n, q, p);
+  ct_std2rev_rounds(a, n, q, p, n/4);
+}
+
+void mulntt64_ct_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ntt64_ct_std2rev_rounds_asm(a, n, q, p);
+  ct_std2rev_rounds(a, n, q, p, n/4);
+}
+
+void ntt64_gs_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_rev2std_rounds(a, n, q, p, 4);
+  ntt64_gs_rev2std_rounds_asm(a, n, q, p);
+}
+
+void nttmul64_gs_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  gs_rev2std_rounds(a, n, q, p, 4);
+  ntt64_gs_rev2std_rounds_asm(a, n, q, p);
+}
+
+void ntt64_gs_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ntt64_gs_std2rev_rounds_asm(a, n, q, p);
+  gs_std2rev_rounds(a, n, q, p, 4);
+}
+
+void nttmul64_gs_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p) {
+  ntt64_gs_std2rev_rounds_asm(a, n, q, p);
+  gs_std2rev_rounds(a, n, q, p, 4);
+}
+
+void ntt64_ct_std2rev_4step_asm(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  ntt64_transpose_asm(tmp, a, n1, n2);
+  for (i=0; i<n; i += n1) {
+    mulntt64_ct_std2rev_asm(tmp + i, n1, q, p1);
+  }
+  ntt64_mul_powers_asm(tmp, n, q, tw);
+  ntt64_transpose_asm(a, tmp, n2, n1);
+  for (i=0; i<n; i += n2) {
+    ntt64_ct_std2rev_asm(a + i, n2, q, p2);
+  }
+}
+
+void ntt64_gs_rev2std_4step_asm(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  for (i=0; i<n; i += n2) {
+    ntt64_gs_rev2std_asm(a + i, n2, q, p2);
+  }
+  ntt64_transpose_asm(tmp, a, n1, n2);
+  ntt64_mul_powers_asm(tmp, n, q, tw);
+  for (i=0; i<n; i += n1) {
+    nttmul64_gs_rev2std_asm(tmp + i, n1, q, p1);
+  }
+  ntt64_transpose_asm(a, tmp, n2, n1);
+}
@@ -0,0 +1,204 @@
+/*
+ * BD: NTT variants for 64bit primes.
+ *
+ * Same variants as in ntt.h for a prime modulus q < 2^62 given at
+ * runtime. The coefficients are 64bit unsigned integers.
+ *
+ * Multiplication by a constant w uses Shoup's precomputed quotient
+ * w' = floor(w * 2^64 / q):
+ *
+ *    shoup(x, w) = x * w - hi(x * w') * q   (modulo 2^64)
+ *
+ * is congruent to x * w modulo q and in [0, 2q-1] for any 64bit x.
+ * hi(z) denotes the high-order 64 bits of the 128bit product z.
+ *
+ * The butterflies are Harvey's lazy butterflies:
+ * - Cooley-Tukey: inputs and outputs in [0, 4q-1]
+ *     x := x - 2q if x >= 2q
+ *     y := shoup(y, w)
+ *     (x, y) := (x + y, x - y + 2q)
+ * - Gentleman-Sande: inputs and outputs in [0, 2q-1]
+ *     (x, y) := (x + y, shoup(x - y + 2q, w))
+ *     x := x - 2q if x >= 2q
+ *
+ * Since 4q < 2^64, nothing overflows. The final results are reduced to
+ * [0, q-1] by ntt64_correct.
+ *
+ * Tables: p is an array of 2n elements. p[0 ... n-1] are the same
+ * powers of omega or psi as for ntt.h (see make_tables64.c) and
+ * p[n + i] is the Shoup quotient of p[i].
+ *
+ * Element-wise products of two arrays use Montgomery multiplication:
+ *    c[i] = a[i] * b[i] / 2^64 modulo q.
+ * The factor 2^-64 is compensated in the final scaling of a product
+ * (ntt64_<n>_rescale and ntt64_<n>_scaled_inv_psi_powers include 2^64).
+ *
+ * In all functions, n must be a power of two.
+ */
+
+#ifndef __NTT64_H
+#define __NTT64_H
+
+#include <stdint.h>
+
+
+/*************
+ * UTILITIES *
+ ************/
+
+/*
+ * Reduce a[i] from [0, 4q-1] to [0, q-1]
+ */
+extern void ntt64_correct(uint64_t *a, uint32_t n, uint64_t q);
+
+/*
+ * In-place product by a table: a[i] = a[i] * p[i] modulo q
+ * - p is a table of 2n elements (with Shoup quotients)
+ * - a[i] can be any 64bit integer
+ * - the result is in [0, 2q-1]
+ */
+extern void ntt64_mul_powers(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+/*
+ * Product by a scalar: a[i] = a[i] * c modulo q
+ * - c must be in [0, q-1] and c_shoup = floor(c * 2^64 / q)
+ * - the result is in [0, 2q-1]
+ */
+extern void ntt64_scalar_mul_array(uint64_t *a, uint32_t n, uint64_t q, uint64_t c, uint64_t c_shoup);
+
+/*
+ * Montgomery product: c[i] = a[i] * b[i] / 2^64 modulo q
+ * - qinv = inverse of q modulo 2^64
+ * - a[i] * b[i] must be less than q * 2^64 (e.g., a[i] in [0, 4q-1]
+ *   and b[i] in [0, q-1])
+ * - the result is in [0, q-1]
+ */
+extern void ntt64_mul_array(uint64_t *c, uint32_t n, uint64_t q, uint64_t qinv, const uint64_t *a, const uint64_t *b);
+
+
+/****************
+ * NTT VARIANTS *
+ ***************/
+
+/*
+ * Cooley-Tukey variants: input and output in [0, 4q-1]
+ * Gentleman-Sande variants: input and output in [0, 2q-1]
+ *
+ * The tables are the same as for the corresponding functions of ntt.h.
+ * The ntt64_ and mul/nttmul versions are the same code with different
+ * tables.
+ */
+// bit-reverse to standard order: p[t+j] = omega^(n/2t)^j
+extern void ntt64_ct_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+// p[t+j] = psi^(n/2t) * omega^(n/2t)^j
+extern void mulntt64_ct_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+// standard to bit-reverse order: p[t+j] = omega^(n/2t)^bitrev(j)
+extern void ntt64_ct_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+// p[t+j] = psi^(n/2t) * omega^(n/2t)^bitrev(j)
+extern void mulntt64_ct_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+// bit-reverse to standard order: p[t+j] = omega^(n/2t)^bitrev(j)
+extern void ntt64_gs_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+// p[t+j] = psi^(n/2t) * omega^(n/2t)^bitrev(j)
+extern void nttmul64_gs_rev2std(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+// standard to bit-reverse order: p[t+j] = omega^(n/2t)^j
+extern void ntt64_gs_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+// p[t+j] = psi^(n/2t) * omega^(n/2t)^j
+extern void nttmul64_gs_std2rev(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+
+/**********************
+ * FOUR-STEP VARIANTS *
+ *********************/
+
+/*
+ * Transpose: a is a matrix with rows x cols elements (stored row
+ * by row). It's copied into b as a matrix of cols x rows elements.
+ * a and b must be distinct.
+ */
+extern void ntt64_transpose(uint64_t *b, const uint64_t *a, uint32_t rows, uint32_t cols);
+
+/*
+ * Four-step versions of mulntt64_ct_std2rev and nttmul64_gs_rev2std
+ * (same structure as ntt_red_ct_std2rev_4step in ntt_red.h):
+ * - n = n1 * n2: the array is seen as a matrix with n1 rows and n2 columns
+ * - the NTT is computed as n2 negacyclic NTTs of size n1 (on the columns),
+ *   a multiplication by twiddle factors, and n1 cyclic NTTs of size n2
+ *   (on the rows). The transpositions make all the small NTTs operate
+ *   on contiguous blocks.
+ *
+ * - p1 = table for the column NTTs (2 * n1 elements)
+ * - p2 = table for the row NTTs (2 * n2 elements)
+ * - tw = twiddle factors (2 * n elements)
+ *   These tables are generated by 'make_tables64 <bits> <n> 4step':
+ *     ct_std2rev: p1 = col_mixed_powers_rev, p2 = row_omega_powers_rev,
+ *                 tw = mixed_twiddles_4step
+ *     gs_rev2std: p1 = col_inv_mixed_powers_rev, p2 = row_inv_omega_powers_rev,
+ *                 tw = inv_mixed_twiddles_4step
+ * - tmp = scratch array of size n
+ *
+ * ct_std2rev gives the same result as mulntt64_ct_std2rev modulo q
+ * (bit-reverse order, in [0, 4q-1]). gs_rev2std gives the same result
+ * as nttmul64_gs_rev2std multiplied by rescale = inverse of n * 2^64
+ * (in [0, 2q-1]): inv_mixed_twiddles_4step includes this factor so a
+ * product needs no final scalar multiplication.
+ */
+extern void ntt64_ct_std2rev_4step(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                   const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp);
+extern void ntt64_gs_rev2std_4step(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                   const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp);
+
+
+/*****************
+ * AVX2 VERSIONS *
+ ****************/
+
+/*
+ * Same functions in assembly (ntt64_asm.S). They give the same results
+ * as the C versions.
+ * - the 64x64 -> 128 bit products are computed with four vpmuludq
+ *   (32x32 -> 64 bit)
+ * - the element-wise functions require n to be a multiple of 4
+ * - the NTTs do the rounds with four or more consecutive butterflies
+ *   in assembly and the others (two rounds) in C
+ */
+extern void ntt64_correct_asm(uint64_t *a, uint32_t n, uint64_t q);
+extern void ntt64_mul_powers_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_scalar_mul_array_asm(uint64_t *a, uint32_t n, uint64_t q, uint64_t c, uint64_t c_shoup);
+extern void ntt64_mul_array_asm(uint64_t *c, uint32_t n, uint64_t q, uint64_t qinv, const uint64_t *a, const uint64_t *b);
+
+extern void ntt64_ct_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void mulntt64_ct_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_ct_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void mulntt64_ct_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_gs_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void nttmul64_gs_rev2std_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_gs_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void nttmul64_gs_std2rev_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+/*
+ * Four-step variants with the AVX2 kernels (n1 and n2 must be
+ * at least 16). The transpositions are done by ntt64_transpose_asm
+ * (rows and cols must be multiples of 4).
+ */
+extern void ntt64_transpose_asm(uint64_t *b, const uint64_t *a, uint32_t rows, uint32_t cols);
+extern void ntt64_ct_std2rev_4step_asm(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                       const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp);
+extern void ntt64_gs_rev2std_4step_asm(uint64_t *a, uint32_t n, uint32_t n1, uint64_t q,
+                                       const uint64_t *p1, const uint64_t *p2, const uint64_t *tw, uint64_t *tmp);
+
+/*
+ * Assembly kernels: rounds with at least four consecutive butterflies
+ * - ct_rev2std: rounds t = 4, 8, ..., n/2
+ * - ct_std2rev: rounds t = 1, 2, ..., n/8
+ * - gs_rev2std: rounds d = 4, 8, ..., n/2
+ * - gs_std2rev: rounds t = n/2, ..., 4
+ */
+extern void ntt64_ct_rev2std_rounds_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_ct_std2rev_rounds_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_gs_rev2std_rounds_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+extern void ntt64_gs_std2rev_rounds_asm(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+
+#endif /* __NTT64_H */
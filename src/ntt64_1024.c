@@ -0,0 +1,83 @@
+/*
+ * NTT for a 62bit prime q and n=1024.
+ *
+ * The element-wise products are Montgomery products: they divide by
+ * 2^64 and this is compensated by the final scaling
+ * (scaled_inv_psi_powers and rescale include the factor 2^64).
+ */
+
+#include "ntt64_1024.h"
+
+/*
+ * Product of two polynomials
+ */
+void ntt64_1024_product1(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_ct_std2rev(a);
+  ntt64_mul_powers(b, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_ct_std2rev(b);
+  ntt64_correct(b, 1024, ntt64_1024_q);
+  ntt64_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  intt64_1024_ct_rev2std(c);
+  ntt64_mul_powers(c, 1024, ntt64_1024_q, ntt64_1024_scaled_inv_psi_powers);
+  ntt64_correct(c, 1024, ntt64_1024_q);
+}
+
+void ntt64_1024_product2(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_gs_std2rev(a);
+  ntt64_mul_powers(b, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_gs_std2rev(b);
+  ntt64_correct(b, 1024, ntt64_1024_q);
+  ntt64_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  intt64_1024_ct_rev2std(c);
+  ntt64_mul_powers(c, 1024, ntt64_1024_q, ntt64_1024_scaled_inv_psi_powers);
+  ntt64_correct(c, 1024, ntt64_1024_q);
+}
+
+void ntt64_1024_product3(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_ct_std2rev(a);
+  ntt64_mul_powers(b, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_ct_std2rev(b);
+  ntt64_correct(b, 1024, ntt64_1024_q);
+  ntt64_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  intt64_1024_gs_rev2std(c);
+  ntt64_mul_powers(c, 1024, ntt64_1024_q, ntt64_1024_scaled_inv_psi_powers);
+  ntt64_correct(c, 1024, ntt64_1024_q);
+}
+
+void ntt64_1024_product4(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_gs_std2rev(a);
+  ntt64_mul_powers(b, 1024, ntt64_1024_q, ntt64_1024_psi_powers);
+  ntt64_1024_gs_std2rev(b);
+  ntt64_correct(b, 1024, ntt64_1024_q);
+  ntt64_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  intt64_1024_gs_rev2std(c);
+  ntt64_mul_powers(c, 1024, ntt64_1024_q, ntt64_1024_scaled_inv_psi_powers);
+  ntt64_correct(c, 1024, ntt64_1024_q);
+}
+
+/*
+ * Use combined mulntt then inttmul
+ */
+void ntt64_1024_product5(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_1024_ct_std2rev(a);
+  mulntt64_1024_ct_std2rev(b);
+  ntt64_correct(b, 1024, ntt64_1024_q);
+  ntt64_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  inttmul64_1024_gs_rev2std(c);
+  ntt64_scalar_mul_array(c, 1024, ntt64_1024_q, ntt64_1024_rescale, ntt64_1024_rescale_shoup); // divide by n
+  ntt64_correct(c, 1024, ntt64_1024_q);
+}
+
+void ntt64_1024_product5_asm(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_ct_std2rev_asm(a, 1024, ntt64_1024_q, ntt64_1024_mixed_powers_rev);
+  mulntt64_ct_std2rev_asm(b, 1024, ntt64_1024_q, ntt64_1024_mixed_powers_rev);
+  ntt64_correct_asm(b, 1024, ntt64_1024_q);
+  ntt64_mul_array_asm(c, 1024, ntt64_1024_q, ntt64_1024_qinv, a, b);
+  nttmul64_gs_rev2std_asm(c, 1024, ntt64_1024_q, ntt64_1024_inv_mixed_powers_rev);
+  ntt64_scalar_mul_array_asm(c, 1024, ntt64_1024_q, ntt64_1024_rescale, ntt64_1024_rescale_shoup); // divide by n
+  ntt64_correct_asm(c, 1024, ntt64_1024_q);
+}
@@ -0,0 +1,96 @@
+/*
+ * NTT for a 62bit prime q and n=1024 (see ntt64_1024_tables.h)
+ */
+
+#ifndef __NTT64_1024_H
+#define __NTT64_1024_H
+
+#include "ntt64_1024_tables.h"
+#include "ntt64.h"
+
+
+/*
+ * NTT VARIANTS
+ *
+ * - the input a is an array of n integers:
+ *   in [0, 4q-1] for the ct variants, in [0, 2q-1] for the gs variants
+ * - the result is stored in place, in the same range as the input
+ * - the inverse transforms return a result scaled by n:
+ *    we have intt(ntt(a)) = n * a modulo q
+ */
+// forward
+static inline void ntt64_1024_ct_rev2std(uint64_t *a) {
+  ntt64_ct_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_omega_powers);
+}
+
+static inline void ntt64_1024_gs_rev2std(uint64_t *a) {
+  ntt64_gs_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_omega_powers_rev);
+}
+
+static inline void ntt64_1024_ct_std2rev(uint64_t *a) {
+  ntt64_ct_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_omega_powers_rev);
+}
+
+static inline void ntt64_1024_gs_std2rev(uint64_t *a) {
+  ntt64_gs_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_omega_powers);
+}
+
+// inverse
+static inline void intt64_1024_ct_rev2std(uint64_t *a) {
+  ntt64_ct_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_inv_omega_powers);
+}
+
+static inline void intt64_1024_gs_rev2std(uint64_t *a) {
+  ntt64_gs_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_inv_omega_powers_rev);
+}
+
+static inline void intt64_1024_ct_std2rev(uint64_t *a) {
+  ntt64_ct_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_inv_omega_powers_rev);
+}
+
+static inline void intt64_1024_gs_std2rev(uint64_t *a) {
+  ntt64_gs_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_inv_omega_powers);
+}
+
+// multiplication by powers of psi then forward ntt
+static inline void mulntt64_1024_ct_rev2std(uint64_t *a) {
+  mulntt64_ct_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_mixed_powers);
+}
+
+static inline void mulntt64_1024_ct_std2rev(uint64_t *a) {
+  mulntt64_ct_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_mixed_powers_rev);
+}
+
+// inverse ntt then multiplication by powers of psi^-1
+static inline void inttmul64_1024_gs_rev2std(uint64_t *a) {
+  nttmul64_gs_rev2std(a, 1024, ntt64_1024_q, ntt64_1024_inv_mixed_powers_rev);
+}
+
+static inline void inttmul64_1024_gs_std2rev(uint64_t *a) {
+  nttmul64_gs_std2rev(a, 1024, ntt64_1024_q, ntt64_1024_inv_mixed_powers);
+}
+
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Input: two arrays a and b in standard order
+ * Result:
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0 .. q-1]
+ * The result is also in that range.
+ *
+ * product5_asm is product5 with the AVX2 functions.
+ */
+extern void ntt64_1024_product1(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_1024_product2(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_1024_product3(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_1024_product4(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_1024_product5(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_1024_product5_asm(uint64_t *c, uint64_t *a, uint64_t *b);
+
+#endif /* __NTT64_1024_H */
@@ -0,0 +1,6878 @@
+/*
+ * Generated by make_tables64: do not edit.
+ *
+ * Parameters:
+ * - q = 4611686018427365377 (largest prime < 2^62 equal to 1 modulo 2n)
+ * - n = 1024
+ * - psi = 1482597879546526807
+ * - omega = psi^2 = 2400711739119850254
+ * - inverse of psi = 3388564417695871207
+ * - inverse of omega = 1136970171935060389
+ * - inverse of n = 4607182418799994903
+ *
+ * Each table has 2n elements: p[i] for i < n as in make_tables,
+ * p[n + i] = floor(p[i] * 2^64 / q).
+ */
+
+#include "ntt64_1024_tables.h"
+
+const uint64_t ntt64_1024_psi_powers[2048] = {
+    UINT64_C(                   1), UINT64_C( 1482597879546526807), UINT64_C( 2400711739119850254),
+    UINT64_C(  432759921836399365), UINT64_C( 4397928510362249185), UINT64_C( 2236207476109945826),
+    UINT64_C( 4160528321702267484), UINT64_C(  921226844134805204), UINT64_C( 4045238714599002096),
+    UINT64_C( 3173209563656975690), UINT64_C( 1594215662391375664), UINT64_C( 2681256057857921695),
+    UINT64_C( 2492007486818252281), UINT64_C( 1125019699564870663), UINT64_C( 4478754074506901161),
+    UINT64_C( 2022607847542890165), UINT64_C( 4590796782851154790), UINT64_C( 3475048544167223743),
+    UINT64_C( 3617524138862625915), UINT64_C( 2252006044808091691), UINT64_C( 1635941343942511081),
+    UINT64_C( 1743176440286758037), UINT64_C( 3966103377340790787), UINT64_C( 3681764954359946174),
+    UINT64_C( 1768360373935249815), UINT64_C(  981071095532084396), UINT64_C( 2686804368448370058),
+    UINT64_C(   89618295979655699), UINT64_C(  659920490112473771), UINT64_C( 1826920447323762417),
+    UINT64_C( 2726324361822022698), UINT64_C( 2645472977297382970), UINT64_C( 2068168528663844559),
+    UINT64_C( 2152356314284504037), UINT64_C(  984850724769212231), UINT64_C(  877056375854364479),
+    UINT64_C( 1242290418832802340), UINT64_C( 3360262105595798472), UINT64_C( 3486308177735248782),
+    UINT64_C( 3272137543606808733), UINT64_C( 1132986281500898181), UINT64_C( 1472513635096154189),
+    UINT64_C( 2168778472999814742), UINT64_C( 1997781625949192316), UINT64_C( 1651868321264097245),
+    UINT64_C( 1614534579931394013), UINT64_C(  777039139634899335), UINT64_C( 4368306431450818971),
+    UINT64_C( 3551072131483919237), UINT64_C(  378982153573495126), UINT64_C( 4592083484607426410),
+    UINT64_C( 3547866881446932766), UINT64_C( 1480033111175595923), UINT64_C( 1534399510701327249),
+    UINT64_C( 3427619522903392612), UINT64_C( 1062980916795007280), UINT64_C( 1145423232612195378),
+    UINT64_C(  612332860768801085), UINT64_C( 3100376025612258997), UINT64_C( 3939883140197502805),
+    UINT64_C( 2829232655383784435), UINT64_C( 3260187915165642297), UINT64_C(  917794389549713133),
+    UINT64_C( 2457181420698271427), UINT64_C( 3705877877490448158), UINT64_C( 4413418788999735102),
+    UINT64_C(  901859847614317342), UINT64_C( 3941619879789496384), UINT64_C( 4348036025405146823),
+    UINT64_C( 1389764208159740173), UINT64_C( 1446321208517112901), UINT64_C( 3774394374542281825),
+    UINT64_C( 3173250686850103875), UINT64_C( 2127246246226089471), UINT64_C( 3775631158123672134),
+    UINT64_C( 1297676028477784910), UINT64_C( 1737698881978754060), UINT64_C( 2805704277397565552),
+    UINT64_C( 3016203424819720057), UINT64_C(  547552626336967870), UINT64_C( 2437169274265949282),
+    UINT64_C( 1675399405844500639), UINT64_C(  471899825039116811), UINT64_C( 4578118999158733141),
+    UINT64_C( 2592879749429526478), UINT64_C( 2722813743701629808), UINT64_C( 2366867205507320441),
+    UINT64_C(  671848929723272354), UINT64_C( 3915428745381234437), UINT64_C( 4248030908068247876),
+    UINT64_C( 1140983863867013629), UINT64_C( 1463487423932645335), UINT64_C( 2655618324572464349),
+    UINT64_C( 2421780860294367016), UINT64_C(  981623966646819835), UINT64_C( 1431800154381700758),
+    UINT64_C( 1659243688065142127), UINT64_C(  206013519460792176), UINT64_C(  823057021263900120),
+    UINT64_C( 2282986705892302649), UINT64_C( 4559114692349893132), UINT64_C(  996814958304332801),
+    UINT64_C( 3616980239419837533), UINT64_C( 1858831409963639856), UINT64_C(  387408563325795131),
+    UINT64_C( 2595168663386929050), UINT64_C(  565404122626278415), UINT64_C( 1126572836870937755),
+    UINT64_C( 2005797565407588331), UINT64_C( 1956709891719793324), UINT64_C( 3956136616881939299),
+    UINT64_C( 1864394216060531723), UINT64_C( 1255736397875211236), UINT64_C( 2553324353274824928),
+    UINT64_C( 1834221755513644804), UINT64_C(  133184145821685010), UINT64_C( 2737280191719927095),
+    UINT64_C(  323018046560510768), UINT64_C( 1063378126852311450), UINT64_C( 3801013888712089268),
+    UINT64_C(  198757123458518136), UINT64_C( 3976646043879445814), UINT64_C( 3969109923860126202),
+    UINT64_C( 4506337479441810504), UINT64_C(   80314588454367303), UINT64_C( 1759667293271595718),
+    UINT64_C( 3187602538680359448), UINT64_C(  809983963243927422), UINT64_C( 4023896290304178588),
+    UINT64_C( 4179895444431398167), UINT64_C( 2322728151565602801), UINT64_C( 1909512407465233379),
+    UINT64_C( 2891450918264212504), UINT64_C(  149946119270052318), UINT64_C(   19378975449324817),
+    UINT64_C( 1429696784014473483), UINT64_C(  326342301997994306), UINT64_C( 3184917978475901740),
+    UINT64_C( 4605570564545716782), UINT64_C( 2047279311257772405), UINT64_C(  992691344949810376),
+    UINT64_C( 1449569256746130422), UINT64_C( 1538093989941999103), UINT64_C( 1640823708549587678),
+    UINT64_C( 3869672860422254369), UINT64_C( 3837830294890745113), UINT64_C( 2212359946370916543),
+    UINT64_C( 4156289026366138793), UINT64_C(  129810917144576916), UINT64_C( 1662449655873154725),
+    UINT64_C( 1950096095932331642), UINT64_C( 3363438344182436711), UINT64_C(  966634132866666046),
+    UINT64_C( 1547985558326977229), UINT64_C( 2202021348140264508), UINT64_C( 1734312021333489165),
+    UINT64_C(  695772663740341648), UINT64_C( 4441815589208536264), UINT64_C( 2736718066033403274),
+    UINT64_C( 2122521268732846276), UINT64_C( 3017514245864863805), UINT64_C( 4006347857954613253),
+    UINT64_C( 1628183582686043495), UINT64_C( 1332465128049927577), UINT64_C( 2141122488594596993),
+    UINT64_C( 3502872730561864502), UINT64_C( 3149013359125955277), UINT64_C( 3410557048115571723),
+    UINT64_C( 4330212126516253940), UINT64_C( 2037633380302720167), UINT64_C( 4049514128221477506),
+    UINT64_C( 3831284048061919385), UINT64_C( 1829823592218854829), UINT64_C( 3154681298805182640),
+    UINT64_C( 3145022340754381981), UINT64_C( 2924482324866602752), UINT64_C( 3363683680248536206),
+    UINT64_C(  618406896923799255), UINT64_C( 2819589298549003725), UINT64_C( 1093274855949974417),
+    UINT64_C( 2687779657998904699), UINT64_C( 1539849053772316455), UINT64_C( 3668473313572806821),
+    UINT64_C( 1834229959573024403), UINT64_C( 2720549446495872479), UINT64_C( 2678799719038285260),
+    UINT64_C( 4240106447481798977), UINT64_C( 2833295645362765934), UINT64_C(  634297698006902227),
+    UINT64_C(  120984652424765095), UINT64_C( 2742465433268612203), UINT64_C( 4590347174107331982),
+    UINT64_C( 2709464080653393840), UINT64_C( 1231292546388298006), UINT64_C( 1496519828866501509),
+    UINT64_C( 3776358726451765212), UINT64_C( 4006039401931595717), UINT64_C(  405715598774631321),
+    UINT64_C( 2454359905175880704), UINT64_C(  771581980824854236), UINT64_C(  594522224732039591),
+    UINT64_C( 3127284970748758296), UINT64_C( 3704149725588216635), UINT64_C( 4052911345250588131),
+    UINT64_C( 3765859310675874347), UINT64_C( 3778979863626164434), UINT64_C( 1781176816738160749),
+    UINT64_C(  665248401952498592), UINT64_C( 3242539539891929736), UINT64_C(  227931364734691067),
+    UINT64_C(  387899278134293157), UINT64_C( 3052187898684828202), UINT64_C( 2741242456929995325),
+    UINT64_C( 3842262695106735884), UINT64_C(  543664783405561633), UINT64_C( 1915098747908485984),
+    UINT64_C( 2594209754045336797), UINT64_C( 2441693564009293879), UINT64_C( 3537347188712899438),
+    UINT64_C( 2570888489570115752), UINT64_C( 2972182093805958694), UINT64_C( 2501290997749770042),
+    UINT64_C( 1579237328548817598), UINT64_C( 3845846568153344738), UINT64_C( 1161469406911059214),
+    UINT64_C( 4089323814216956058), UINT64_C(  607337418735800506), UINT64_C( 4465598112306431653),
+    UINT64_C( 1552522174097316013), UINT64_C( 2111054285050781485), UINT64_C( 1240193826751170286),
+    UINT64_C( 1160323589628636843), UINT64_C( 4371207996495634843), UINT64_C(  944274310408114028),
+    UINT64_C( 1237155887585272454), UINT64_C( 2361358369003975692), UINT64_C( 1053896098414277608),
+    UINT64_C( 1850810078856814141), UINT64_C( 2035178193471487090), UINT64_C( 2684094663179899115),
+    UINT64_C( 2467608254404987505), UINT64_C( 4235567419415590436), UINT64_C( 3592350538474428510),
+    UINT64_C( 4098536546087430514), UINT64_C(  951927524121511628), UINT64_C(  202536063555335267),
+    UINT64_C(  184443339613017823), UINT64_C( 1799169842388507721), UINT64_C( 3624590898131699178),
+    UINT64_C( 3449561237629491717), UINT64_C( 1930320082969866003), UINT64_C(   52752168786994182),
+    UINT64_C( 3884862316935299801), UINT64_C( 1674715692560252183), UINT64_C( 2093264054356944664),
+    UINT64_C( 2083803552561725751), UINT64_C( 1900964676350475249), UINT64_C( 2953819124445283744),
+    UINT64_C( 3529489814044241211), UINT64_C( 2307982508531578249), UINT64_C( 4265936606843995371),
+    UINT64_C( 1870086954996130132), UINT64_C(  765058418352087786), UINT64_C( 1877152863679867689),
+    UINT64_C(  924826167830191412), UINT64_C(  610322076670062182), UINT64_C( 4331139294641859496),
+    UINT64_C( 4542711586168647568), UINT64_C( 2836277682389490544), UINT64_C( 4316407904723576692),
+    UINT64_C( 3369742126303465728), UINT64_C(  752670247881376625), UINT64_C( 3830807687839579289),
+    UINT64_C( 3535464716239159675), UINT64_C( 1585988977946312062), UINT64_C( 2055493099061855374),
+    UINT64_C(  797297974165473708), UINT64_C( 1818964933693720657), UINT64_C(  979224835709439631),
+    UINT64_C( 4391484029099455865), UINT64_C( 3215445710127520461), UINT64_C( 3237294127365214371),
+    UINT64_C( 2965734562744674556), UINT64_C( 3501847443227543094), UINT64_C( 2948358908520598479),
+    UINT64_C( 2669237607306606438), UINT64_C( 1432751804325404159), UINT64_C( 1518481817467565289),
+    UINT64_C(  131131197477940099), UINT64_C(  813085348019976937), UINT64_C(  241509748437302878),
+    UINT64_C( 2818183610269625575), UINT64_C( 3537332191015376133), UINT64_C( 1120534607174351876),
+    UINT64_C( 3487906013475575565), UINT64_C( 4568954096219192478), UINT64_C(  532893738964097199),
+    UINT64_C( 1039155171907682344), UINT64_C( 2535061422550748591), UINT64_C( 3892929271204224101),
+    UINT64_C( 4428544272741454476), UINT64_C( 3557012870941004489), UINT64_C( 2315378645606089562),
+    UINT64_C( 4188177932392580727), UINT64_C( 3377243792771223918), UINT64_C( 3704224761560595246),
+    UINT64_C( 4295875587876333751), UINT64_C( 2348389025506101277), UINT64_C( 2344837507844879919),
+    UINT64_C( 1026577720042490999), UINT64_C(  155787413762905631), UINT64_C( 3941366512545953573),
+    UINT64_C(  256494620928290829), UINT64_C( 1880435472699480520), UINT64_C( 4579018523369296072),
+    UINT64_C( 1788055398028417530), UINT64_C(  290341413826395897), UINT64_C( 4401571916414383242),
+    UINT64_C( 2676859808255949069), UINT64_C(  507530730249025784), UINT64_C(  881956512167215261),
+    UINT64_C(  259327643525957150), UINT64_C(  582088543124655278), UINT64_C( 3536008120361596082),
+    UINT64_C( 1619019368883669872), UINT64_C( 2925678656572254158), UINT64_C( 1492270058063349872),
+    UINT64_C( 2841671314611570319), UINT64_C( 3838265690580697662), UINT64_C( 2893763264795340899),
+    UINT64_C( 1717910164398452271), UINT64_C(   14862659715892847), UINT64_C(  367710248663569074),
+    UINT64_C( 4115719751317650066), UINT64_C( 1733457760798908697), UINT64_C( 1709175379494813859),
+    UINT64_C( 4252178254449178011), UINT64_C(  744505676817952400), UINT64_C( 3000885903703217293),
+    UINT64_C(  487536162258042406), UINT64_C( 4382760348511593332), UINT64_C( 3396117487884430813),
+    UINT64_C(  136771232223207871), UINT64_C( 4568552542522180308), UINT64_C( 2063059596773417233),
+    UINT64_C( 3159161751295827278), UINT64_C(  871015248634303721), UINT64_C( 3037559455667103634),
+    UINT64_C( 4289953542452418782), UINT64_C(  899421310882257990), UINT64_C( 3133051207374189676),
+    UINT64_C( 1552311879008992123), UINT64_C( 3671267046320851570), UINT64_C( 3153503871610633059),
+    UINT64_C( 1091914032667124918), UINT64_C( 3319733127703385917), UINT64_C(  816778863552099543),
+    UINT64_C(  788254606771569727), UINT64_C( 1988371081652311567), UINT64_C( 2469680779103036387),
+    UINT64_C( 1610063896412036330), UINT64_C( 2866786148838575743), UINT64_C( 1676540994076128771),
+    UINT64_C( 1502961173160971999), UINT64_C( 2059382345563661484), UINT64_C( 4388115202674869049),
+    UINT64_C( 1844890970564863646), UINT64_C( 4502812500628729457), UINT64_C(  692980835930194811),
+    UINT64_C( 1607612296199291842), UINT64_C( 1614547761626343100), UINT64_C( 2906059885642254267),
+    UINT64_C( 1586033836836413089), UINT64_C( 1212552879500681810), UINT64_C( 4345836121639019118),
+    UINT64_C( 1045683455419311943), UINT64_C( 1105253435398927209), UINT64_C( 2146714260958358013),
+    UINT64_C( 1609551556682479035), UINT64_C( 1794227012515706185), UINT64_C( 4035126618246567356),
+    UINT64_C( 4246301933867698670), UINT64_C( 1032376268464898917), UINT64_C(  511292005236633552),
+    UINT64_C( 1261214714195877578), UINT64_C( 3551780402730960870), UINT64_C(   31368178978924605),
+    UINT64_C( 2505715927855778269), UINT64_C( 3537615089318938312), UINT64_C( 2738577070207858881),
+    UINT64_C( 1863841901798123565), UINT64_C( 4177258725177141741), UINT64_C(  274152638443289083),
+    UINT64_C( 1499098552694454435), UINT64_C( 3461620215034767531), UINT64_C( 3509579422672274182),
+    UINT64_C( 3597579810358573200), UINT64_C( 4328208303007256859), UINT64_C(  848976462686658613),
+    UINT64_C( 4164661300876465054), UINT64_C( 3886273357699266640), UINT64_C( 3178848264264571879),
+    UINT64_C( 3302637486092235475), UINT64_C( 3210241415051035167), UINT64_C( 1917507912125205273),
+    UINT64_C( 2777183115828711728), UINT64_C( 3959152801982309405), UINT64_C(  637214865877033498),
+    UINT64_C( 1636465293549385213), UINT64_C( 3933473744863235147), UINT64_C( 3279913815230309282),
+    UINT64_C(  731466979127336005), UINT64_C( 4270566713751658911), UINT64_C(  835732570074862627),
+    UINT64_C(  938436529988435272), UINT64_C( 3083464026109839675), UINT64_C( 3989582554169606578),
+    UINT64_C( 3966446232552011524), UINT64_C( 4238833680404291401), UINT64_C( 2698729730287738495),
+    UINT64_C( 2319624932896978552), UINT64_C(  369349941221336572), UINT64_C(  962154417381372913),
+    UINT64_C(   98765666151030067), UINT64_C( 2718205553781153588), UINT64_C( 1200363821550028156),
+    UINT64_C( 3111929951370134147), UINT64_C(  303146497757706651), UINT64_C( 1098585534659563516),
+    UINT64_C(  995508446755282879), UINT64_C( 4083502248124438865), UINT64_C(  482975691298792303),
+    UINT64_C( 1860452777895420591), UINT64_C( 1600016754229369899), UINT64_C( 4048254277868242691),
+    UINT64_C(  305228142147624168), UINT64_C(  204896358553094317), UINT64_C(  655224787992504468),
+    UINT64_C( 4382204278396839813), UINT64_C( 3611222229326003382), UINT64_C( 2945859800615284769),
+    UINT64_C( 1618902895626951218), UINT64_C( 2372127282591449080), UINT64_C( 1918893989377236774),
+    UINT64_C(  941475936506272623), UINT64_C(  572543380914258662), UINT64_C( 3720690912893558875),
+    UINT64_C(  410816958896292181), UINT64_C( 2390554822009554201), UINT64_C( 1635283302410543817),
+    UINT64_C( 1465721990478548967), UINT64_C( 1979321519280662612), UINT64_C( 2834330732008186913),
+    UINT64_C( 1849662150559110766), UINT64_C( 1478805904657277363), UINT64_C( 1088301009622075512),
+    UINT64_C(  596256239724183802), UINT64_C( 2469931559767792320), UINT64_C(  978263020579853024),
+    UINT64_C( 1584925295045449115), UINT64_C( 3270168765958856210), UINT64_C( 1912940964913510876),
+    UINT64_C( 1244340859032719234), UINT64_C( 3532777341412930755), UINT64_C( 2122017383951756192),
+    UINT64_C(  686613727850228388), UINT64_C( 3395731570131024519), UINT64_C( 2165637453730303815),
+    UINT64_C(  945384935947669134), UINT64_C( 3749546850355899325), UINT64_C(  510806555556130508),
+    UINT64_C( 1740988286653475439), UINT64_C( 4342379187862950981), UINT64_C(  877659710947385032),
+    UINT64_C(  610860530465122481), UINT64_C( 2312762693832998475), UINT64_C( 1872862200816238025),
+    UINT64_C( 2673041227939448278), UINT64_C( 3824291739522788076), UINT64_C( 1788302603633971284),
+    UINT64_C( 1879648051492049201), UINT64_C( 1071264481991730475), UINT64_C( 1317921105431250529),
+    UINT64_C( 1743176398981010717), UINT64_C( 4207773561490883035), UINT64_C( 1823932930819020382),
+    UINT64_C(  245017491998479862), UINT64_C(  170960108567310191), UINT64_C(  820752269393906697),
+    UINT64_C( 2667817646748497844), UINT64_C( 4281658139135845856), UINT64_C( 3333736386213689291),
+    UINT64_C( 3664032263547523615), UINT64_C( 2471483719592924014), UINT64_C( 4190969131542904529),
+    UINT64_C(  871412714462055863), UINT64_C( 1870026971131305276), UINT64_C( 2577589352817978075),
+    UINT64_C( 2382342543941134407), UINT64_C( 4185475023036704482), UINT64_C(  234041685233257305),
+    UINT64_C( 1954246705168153798), UINT64_C( 3525498332217669253), UINT64_C( 2361640686087155182),
+    UINT64_C(  197193362320839916), UINT64_C(  357836038710603099), UINT64_C( 3802414016400156201),
+    UINT64_C(  804140010002609685), UINT64_C( 2077598463836100093), UINT64_C(  685616363032565509),
+    UINT64_C( 4476297656530001513), UINT64_C( 1551229684457282409), UINT64_C( 3014237273200044542),
+    UINT64_C( 2082714474522091146), UINT64_C( 1416979586047913860), UINT64_C( 3004297030405799437),
+    UINT64_C( 2621792368599966030), UINT64_C( 4260827143220789024), UINT64_C( 2255234229238542731),
+    UINT64_C( 4155143971580064724), UINT64_C( 4009884568549198952), UINT64_C( 1950378339134182809),
+    UINT64_C( 2000858215069317061), UINT64_C( 3604766816394897546), UINT64_C(  992635524216815278),
+    UINT64_C( 2450854228554719789), UINT64_C(  626297590503189450), UINT64_C( 1566147706912213219),
+    UINT64_C( 2690008220850828513), UINT64_C( 1477937435921982440), UINT64_C( 2759501200185376495),
+    UINT64_C( 3910033764475168842), UINT64_C(  388752746045964085), UINT64_C(  319898891197576156),
+    UINT64_C( 1675895396083821476), UINT64_C( 2359172028487141714), UINT64_C(  264983591297565602),
+    UINT64_C( 3024198903909839870), UINT64_C( 2494884684187073661), UINT64_C( 3488513518549110364),
+    UINT64_C( 4103017788438389522), UINT64_C( 2249103973839990936), UINT64_C( 3085814807638355138),
+    UINT64_C(  260943941076539171), UINT64_C( 2325064455222905641), UINT64_C( 3001760515997345126),
+    UINT64_C( 3644518137698018793), UINT64_C( 1852163044422187905), UINT64_C(  793244537377917469),
+    UINT64_C(   72303868944738220), UINT64_C( 4095553468289470494), UINT64_C( 2414901465620074863),
+    UINT64_C( 3227187218431474260), UINT64_C( 1781021219997870157), UINT64_C( 4073169274230856126),
+    UINT64_C( 1446311743528964143), UINT64_C( 3249967743082457984), UINT64_C( 2822382757641299168),
+    UINT64_C( 3531384543848349920), UINT64_C( 4297381624151009309), UINT64_C(  848194068593451947),
+    UINT64_C( 2555440386528230587), UINT64_C( 1642493526309612238), UINT64_C( 4607422217046930184),
+    UINT64_C( 2538778187029876446), UINT64_C( 2523507258974137450), UINT64_C( 4163483892177191812),
+    UINT64_C(  586576035178648987), UINT64_C( 1876288299092947845), UINT64_C( 4516913466356350528),
+    UINT64_C( 1362051703778680179), UINT64_C( 3953798807530909336), UINT64_C( 3730675882714140168),
+    UINT64_C(  311287007747775527), UINT64_C(  251588547665158640), UINT64_C( 2178364526979483139),
+    UINT64_C( 1700436953662611386), UINT64_C( 2436557758325670652), UINT64_C( 1215685474672827343),
+    UINT64_C(  732788375174647496), UINT64_C( 1478167556514048989), UINT64_C( 4050021673706031143),
+    UINT64_C( 2014042211893684604), UINT64_C( 2046188506347020487), UINT64_C( 3259777318488657740),
+    UINT64_C( 1824532051640333034), UINT64_C( 1508734581979171756), UINT64_C( 1810013073888913648),
+    UINT64_C( 4544171960220366710), UINT64_C( 2510248918026118005), UINT64_C( 4035136138076832337),
+    UINT64_C( 3814193870696449291), UINT64_C( 4055857690192455640), UINT64_C( 2551547626852230511),
+    UINT64_C( 4430465930968651663), UINT64_C( 3228466835010095449), UINT64_C(  767039058199565051),
+    UINT64_C( 2760266801100815101), UINT64_C( 3507617405319098454), UINT64_C(  237420505140017849),
+    UINT64_C(   77912590505156175), UINT64_C( 4455859642848635784), UINT64_C(  208179820468705139),
+    UINT64_C( 1194264381024739471), UINT64_C(  619989834785333684), UINT64_C( 3847442746631182846),
+    UINT64_C(  680976407834139869), UINT64_C(  261103275488158652), UINT64_C( 1850907503786542147),
+    UINT64_C( 4075036490232647886), UINT64_C( 2326411855819986390), UINT64_C( 3364693870687963252),
+    UINT64_C( 2200782996640600919), UINT64_C( 1599336588606069042), UINT64_C(  565417953593608565),
+    UINT64_C( 2141353050767097805), UINT64_C( 2881615329919645789), UINT64_C( 4364180315313213868),
+    UINT64_C( 1799833330256075521), UINT64_C( 2279548975956651339), UINT64_C( 3785652056625193400),
+    UINT64_C( 4181165216863241543), UINT64_C( 1874612785324683517), UINT64_C(  822496120599602391),
+    UINT64_C( 1482370635763389549), UINT64_C( 3216398166667142492), UINT64_C(  973277973631779119),
+    UINT64_C( 1414996654632579535), UINT64_C( 1632747171034126038), UINT64_C(  399153121717845652),
+    UINT64_C( 1231208399773997533), UINT64_C( 4548081846662005896), UINT64_C( 4325996936041739018),
+    UINT64_C( 2793081084263874275), UINT64_C( 4394225446772396019), UINT64_C( 3561942386313880563),
+    UINT64_C( 3086222030444894558), UINT64_C( 3424152817620763650), UINT64_C( 3165220293337291917),
+    UINT64_C(  476664612668647004), UINT64_C(  233753965118447345), UINT64_C( 1492741357398842352),
+    UINT64_C( 2369067053942932304), UINT64_C( 4034837027261059818), UINT64_C( 1583352588619711861),
+    UINT64_C( 3653542849105545164), UINT64_C( 3903703857980723923), UINT64_C( 1199393192324884232),
+    UINT64_C( 1488036762640350778), UINT64_C( 3103372325270731626), UINT64_C( 1330347273031060688),
+    UINT64_C( 2031093248427668510), UINT64_C(  902190690149567071), UINT64_C( 4003544480710139205),
+    UINT64_C(  479588466945915912), UINT64_C( 4139305653044751572), UINT64_C( 2499763353882675499),
+    UINT64_C( 1871210569584502341), UINT64_C( 1132640057676710068), UINT64_C( 1447511463968469566),
+    UINT64_C( 3695237642805590966), UINT64_C( 4342773087883220453), UINT64_C(  289100196167847331),
+    UINT64_C(  714011629040165201), UINT64_C( 1729303117196723516), UINT64_C( 1483381452456830948),
+    UINT64_C( 1593017396740558622), UINT64_C(  604863364789061001), UINT64_C( 3638761761840292763),
+    UINT64_C( 2553771298592132344), UINT64_C( 3354922308083637135), UINT64_C( 1182808904748102976),
+    UINT64_C( 3901669560572161329), UINT64_C( 3012628992752949016), UINT64_C( 3114759228713443323),
+    UINT64_C( 1570260593000772468), UINT64_C(  218152164207231001), UINT64_C( 2924973712386175354),
+    UINT64_C( 3381901547434642051), UINT64_C( 2179966804895415034), UINT64_C( 2718306078420364749),
+    UINT64_C( 1951044379988462048), UINT64_C(  439107495671692173), UINT64_C( 2106276727505387662),
+    UINT64_C( 2903757481865333581), UINT64_C( 4165508039368450800), UINT64_C( 2073600855859389402),
+    UINT64_C( 1676974938564726196), UINT64_C( 3112335350052062119), UINT64_C( 1409836371636540326),
+    UINT64_C(  947438932901172815), UINT64_C( 2045101705001264320), UINT64_C( 4135729112038515174),
+    UINT64_C( 1664777915431904754), UINT64_C( 3469651375707344324), UINT64_C(  437025389401016125),
+    UINT64_C( 3879920586239417728), UINT64_C(  668319108584396841), UINT64_C( 3518353274126681257),
+    UINT64_C( 4068847243005682054), UINT64_C(  150331248495044976), UINT64_C( 1539912810649586905),
+    UINT64_C(  485491135282793681), UINT64_C( 1362452282111165124), UINT64_C( 2046698563331994104),
+    UINT64_C( 1395180116325533233), UINT64_C( 3058646478612644251), UINT64_C(  539515275914945526),
+    UINT64_C(  959698465116575210), UINT64_C(   32816406908475677), UINT64_C(  504362620832676715),
+    UINT64_C( 1498631754262487511), UINT64_C( 2279697959882368399), UINT64_C( 4139024412514936773),
+    UINT64_C( 4424436587380937918), UINT64_C( 1499519613120740162), UINT64_C( 4111152270751917141),
+    UINT64_C( 3622207101292713045), UINT64_C( 2914509569038348340), UINT64_C(  584328307393442377),
+    UINT64_C(  770504662971353748), UINT64_C( 4448611583831429864), UINT64_C( 2672210800821325956),
+    UINT64_C( 1038796876384025326), UINT64_C( 1529567590237338722), UINT64_C( 1735423832482929377),
+    UINT64_C(  483306483213340640), UINT64_C( 1025542599384871972), UINT64_C( 3490871534733890590),
+    UINT64_C(  357180834850210256), UINT64_C( 4483213694720406842), UINT64_C( 3599913488343922077),
+    UINT64_C( 3593013623125881141), UINT64_C( 2645862174562073893), UINT64_C(  877353902278191427),
+    UINT64_C( 2653290719935361111), UINT64_C( 1407276508446451314), UINT64_C( 2391061745240172347),
+    UINT64_C( 1467247101221685025), UINT64_C( 4298553952213081265), UINT64_C(  872899714386228416),
+    UINT64_C( 4393558504980386242), UINT64_C( 4266426457572698799), UINT64_C(  913007192269542546),
+    UINT64_C( 1118943180714764533), UINT64_C( 3729200025137926407), UINT64_C( 3941826338290054710),
+    UINT64_C( 2553634168717201491), UINT64_C( 2221612477457659753), UINT64_C( 4102631858503059747),
+    UINT64_C( 2462317921121052758), UINT64_C( 2695874774151910019), UINT64_C( 2492189391122621180),
+    UINT64_C( 2747616796397379828), UINT64_C( 2020727104038103695), UINT64_C(  610903046880562634),
+    UINT64_C( 2312131158625254196), UINT64_C( 3826124913679203723), UINT64_C(  277094405141672246),
+    UINT64_C( 4536483755510381051), UINT64_C(  952627208103550231), UINT64_C( 1070997145059444159),
+    UINT64_C( 1225662781222001375), UINT64_C( 1731016064480004168), UINT64_C( 2939975394522410060),
+    UINT64_C(  312851574268946147), UINT64_C( 3781699484200797783), UINT64_C( 2746805877370733560),
+    UINT64_C( 3849828598800407797), UINT64_C( 2995300680710204974), UINT64_C( 1135687142661087418),
+    UINT64_C( 3276766684535628901), UINT64_C(  925716047777857124), UINT64_C(  558822624855705108),
+    UINT64_C(  166469110154211230), UINT64_C( 4057677698319368500), UINT64_C( 1123876638625291197),
+    UINT64_C( 3637705240106523576), UINT64_C(  332574684972234384), UINT64_C( 2890764471011131908),
+    UINT64_C( 4108077938980496914), UINT64_C(  894318522492477872), UINT64_C( 1697744173972396808),
+    UINT64_C( 2270834688869068665), UINT64_C( 3371486293635211942), UINT64_C( 1961524677183397552),
+    UINT64_C(  184527297125777774), UINT64_C(   13662800517217680), UINT64_C( 2224528769235092197),
+    UINT64_C( 1134397934346836952), UINT64_C( 3624585512076324057), UINT64_C( 1839325932449358448),
+    UINT64_C( 2801663570676650426), UINT64_C( 2345038417847300195), UINT64_C( 3446233119576757455),
+    UINT64_C( 2894353089791485731), UINT64_C( 4222131386577963441), UINT64_C(  659129734563606006),
+    UINT64_C( 3078632193023835316), UINT64_C( 4097512091411382626), UINT64_C( 3425108868614144548),
+    UINT64_C( 1974174183043521424), UINT64_C(  383304783933611976), UINT64_C( 3206158260706639828),
+    UINT64_C(  274336233037238077), UINT64_C( 3146184221526737553), UINT64_C( 4389322720306063027),
+    UINT64_C( 3856733760376929266), UINT64_C(  685400175851316156), UINT64_C( 3923461195195202147),
+    UINT64_C( 2370049507009080760), UINT64_C( 3793143894297619789), UINT64_C( 3172066150783512600),
+    UINT64_C(  110431127623859296), UINT64_C( 1361761461888066093), UINT64_C( 2759042918974896475),
+    UINT64_C( 1044401146706852566), UINT64_C(   59959457052448080), UINT64_C( 3097597748165930130),
+    UINT64_C( 3354000371513030063), UINT64_C( 2596801024432302985), UINT64_C( 3521841953642697951),
+    UINT64_C( 1030215965054952744), UINT64_C(  393025094498857442), UINT64_C(  385770757908462315),
+    UINT64_C( 3057359436851267693), UINT64_C(   89901937259524008), UINT64_C( 2929679524939121891),
+    UINT64_C(   49318483776098116), UINT64_C( 4043198658093728562), UINT64_C( 2734815492851336383),
+    UINT64_C(  104240754812533046), UINT64_C(  942511766632210723), UINT64_C( 1357545964148577825),
+    UINT64_C( 3487492969372016186), UINT64_C( 2787605343977851515), UINT64_C( 2214213433730165795),
+    UINT64_C( 2448680636743494489), UINT64_C( 1365972863225878166), UINT64_C( 2327651778635346672),
+    UINT64_C(  213534333928675936), UINT64_C( 3048365156366483007), UINT64_C( 1217067112109024256),
+    UINT64_C( 2865265359655330130), UINT64_C( 3370615483927805111), UINT64_C( 1890999184460584081),
+    UINT64_C(  331008071283198498), UINT64_C(   53053828199897781), UINT64_C( 1218769917950358612),
+    UINT64_C( 3755635344528493813), UINT64_C( 4154352184849207477), UINT64_C( 2767313409789611653),
+    UINT64_C( 2308342209152691040), UINT64_C(  302670398992826200), UINT64_C(  490079728691177042),
+    UINT64_C(  102044630754792870), UINT64_C(  869173883498632863), UINT64_C(  237972493562463015),
+    UINT64_C( 1373290829529926976), UINT64_C(  795344975299056214), UINT64_C(  447428903215342719),
+    UINT64_C( 3001382115563549860), UINT64_C( 1334108140963731887), UINT64_C( 3118579606097479139),
+    UINT64_C(  234809061531476887), UINT64_C( 1938499773309054930), UINT64_C( 2296950020239488805),
+    UINT64_C( 2861318728846860930), UINT64_C( 2419031109686561638), UINT64_C( 3267071253054243662),
+    UINT64_C( 4037114839065063084), UINT64_C(  884312128561024297), UINT64_C( 2950161371412402896),
+    UINT64_C( 3156002396298853836), UINT64_C( 2298087391389824104), UINT64_C(  590947254348965378),
+    UINT64_C( 3682127656795400699), UINT64_C(  570670718702250248), UINT64_C(  706144719799758441),
+    UINT64_C( 2213462601823254413), UINT64_C( 4443047538019427593), UINT64_C(  352984643773498719),
+    UINT64_C( 1084738989767016719), UINT64_C( 3611847407109459101), UINT64_C( 3721389930257549409),
+    UINT64_C(   22433228726183226), UINT64_C( 1688292499388007393), UINT64_C( 1241315471063433917),
+    UINT64_C( 1300210680856899347), UINT64_C( 2852974886317606458), UINT64_C(  227921074365688802),
+    UINT64_C( 2402010846586661785), UINT64_C( 1842615612368354497), UINT64_C( 4052690531269210339),
+    UINT64_C( 3988225595075851037), UINT64_C(  503343524324188877), UINT64_C( 2676210263234941926),
+    UINT64_C( 2071352341820874413), UINT64_C( 3436014263075695111), UINT64_C( 1133257745966048282),
+    UINT64_C(  263637743407343746), UINT64_C( 2768028438003859349), UINT64_C( 1359394696637062210),
+    UINT64_C(   30238743627571808), UINT64_C( 4391989867934207415), UINT64_C( 4307555974418011194),
+    UINT64_C( 4354964862091784544), UINT64_C(  144886118722786874), UINT64_C( 2622864515154075147),
+    UINT64_C( 1553962591877364639), UINT64_C( 1854522643282304425), UINT64_C( 3923524735499515412),
+    UINT64_C( 2657438284789770960), UINT64_C( 3539197463387207563), UINT64_C(   47240480759893108),
+    UINT64_C( 2036943936725808288), UINT64_C(   86969233091873012), UINT64_C( 2611298768820915691),
+    UINT64_C( 3346221758441642400), UINT64_C( 2340815835249833713), UINT64_C( 2418254001624659624),
+    UINT64_C( 1166973459441709726), UINT64_C( 3286818059444468376), UINT64_C( 1949948367453176090),
+    UINT64_C( 4541955249605003808), UINT64_C( 2241272674007387627), UINT64_C( 2091943141357137645),
+    UINT64_C( 1709817511219879384), UINT64_C(  915969065129314377), UINT64_C( 3002206030065622091),
+    UINT64_C(  688026410288222148), UINT64_C( 3094814899163519183), UINT64_C( 4022767753782152272),
+    UINT64_C( 1863881746643431039), UINT64_C(  266453965578522078), UINT64_C( 2258851540068175314),
+    UINT64_C( 1970705841300989217), UINT64_C(  639322136243055088), UINT64_C( 1179317760430472932),
+    UINT64_C( 4468524568903294928), UINT64_C( 4359325251833636030), UINT64_C( 1832182905397381471),
+    UINT64_C( 3041380130487857690), UINT64_C( 2073889272417520864), UINT64_C(  139490077637179889),
+    UINT64_C(  834185947168345360), UINT64_C( 3613343733206840369), UINT64_C( 2128476962744011646),
+    UINT64_C( 3716165778433263976), UINT64_C( 4547976843320098925), UINT64_C( 4523373017153855388),
+    UINT64_C( 3841984086170630355), UINT64_C( 2074581773178369824), UINT64_C( 1101758762118523168),
+    UINT64_C( 4519016613408284383), UINT64_C( 3895923827948357863), UINT64_C( 3766314570829488647),
+    UINT64_C( 4587689110676858377), UINT64_C( 1459176627240636952), UINT64_C( 4443473892469001069),
+    UINT64_C( 3454435399983609484), UINT64_C( 1184901126125065503), UINT64_C( 2107651826156979027),
+    UINT64_C( 3421884282926540642), UINT64_C(  125165356278636575), UINT64_C( 2188961466126034081),
+    UINT64_C( 2678229115631223377), UINT64_C( 1954954601816045362), UINT64_C( 2062182020421627244),
+    UINT64_C( 2605643716960091225), UINT64_C( 3481615102258042497), UINT64_C( 3664872022312435044),
+    UINT64_C( 1849160754478801782), UINT64_C(  300727895868192748), UINT64_C( 1302547591645079863),
+    UINT64_C( 1040247579802031329), UINT64_C( 1347513035217080243), UINT64_C(  259157089942080629),
+    UINT64_C( 4396745417903152580), UINT64_C( 1735821994432452524), UINT64_C( 2973329062899545170),
+    UINT64_C( 1071827969325616041), UINT64_C( 3132167013330314154), UINT64_C(  300325005450496587),
+    UINT64_C( 1006352626196175146), UINT64_C( 1678022887017005273), UINT64_C(  696315246081945734),
+    UINT64_C( 3390501777138496659), UINT64_C( 1051719673050458959), UINT64_C( 3800355942214640753),
+    UINT64_C( 2137443489648467722), UINT64_C( 1643252510097770258), UINT64_C( 3972631746810885831),
+    UINT64_C(  698190819141775972), UINT64_C( 1166840412541945381), UINT64_C( 3829725965221175714),
+    UINT64_C( 4557284773527364931), UINT64_C( 2005784150611880513), UINT64_C(  260966410467664596),
+    UINT64_C( 1475819125669281104), UINT64_C(   13256803360230936), UINT64_C( 1732426745547169256),
+    UINT64_C( 3540619593564635243), UINT64_C( 2322921443405794831), UINT64_C( 4136767868326397556),
+    UINT64_C( 3340179081683457083), UINT64_C( 1276609820644503207), UINT64_C( 3028216316706702180),
+    UINT64_C( 2093542254857539782), UINT64_C(  285905407408422553), UINT64_C( 1309825015972462495),
+    UINT64_C( 1660319910205323660), UINT64_C( 1158366700570832516), UINT64_C( 2896550676561137784),
+    UINT64_C( 3648113786199744239), UINT64_C( 2257676497704087716), UINT64_C(  115292498941482581),
+    UINT64_C( 1985703776908265144), UINT64_C( 4129446904813725372), UINT64_C( 1815552859295327999),
+    UINT64_C( 4351756900966242687), UINT64_C( 1353543003314858370), UINT64_C( 3474715846492304988),
+    UINT64_C( 1223121600731494170), UINT64_C(                   4), UINT64_C( 5930391518186136196),
+    UINT64_C( 9602846956479447923), UINT64_C( 1731039687345605915), UINT64_C(17591714041449082671),
+    UINT64_C( 8944829904439826997), UINT64_C(16642113286809151228), UINT64_C( 3684907376539238815),
+    UINT64_C(16180954858396087424), UINT64_C(12692838254627964761), UINT64_C( 6376862649565533805),
+    UINT64_C(10725024231431739169), UINT64_C( 9968029947273057815), UINT64_C( 4500078798259504633),
+    UINT64_C(17915016298027692154), UINT64_C( 8090431390171600179), UINT64_C(18363187131404708859),
+    UINT64_C(13900194176668962871), UINT64_C(14470096555450574343), UINT64_C( 9008024179232410766),
+    UINT64_C( 6543765375770076288), UINT64_C( 6972705761147066208), UINT64_C(15864413509363240641),
+    UINT64_C(14727059817439856634), UINT64_C( 7073441495741033812), UINT64_C( 3924284382128356753),
+    UINT64_C(10747217473793532729), UINT64_C(  358473183918624547), UINT64_C( 2639681960449907978),
+    UINT64_C( 7307681789295085364), UINT64_C(10905297447288144061), UINT64_C(10581891909189583570),
+    UINT64_C( 8272674114655418646), UINT64_C( 8609425257138058203), UINT64_C( 3939402899076868167),
+    UINT64_C( 3508225503417475052), UINT64_C( 4969161675331233633), UINT64_C(13441048422383259544),
+    UINT64_C(13945232710941063247), UINT64_C(13088550174427298866), UINT64_C( 4531945126003614861),
+    UINT64_C( 5890054540384645527), UINT64_C( 8675113891999301343), UINT64_C( 7991126503796808298),
+    UINT64_C( 6607473285056421255), UINT64_C( 6458138319725607598), UINT64_C( 3108156558539612522),
+    UINT64_C(17473225725803361236), UINT64_C(14204288525935746332), UINT64_C( 1515928614293987908),
+    UINT64_C(18368333938429795364), UINT64_C(14191467525787800385), UINT64_C( 5920132444702412610),
+    UINT64_C( 6137598042805338976), UINT64_C(13710478091613637420), UINT64_C( 4251923667180049889),
+    UINT64_C( 4581692930448803892), UINT64_C( 2449331443075216304), UINT64_C(12401504102449096566),
+    UINT64_C(15759532560790088201), UINT64_C(11316930621535193020), UINT64_C(13040751660662632889),
+    UINT64_C( 3671177558198870464), UINT64_C( 9828725682793133719), UINT64_C(14823511509961865041),
+    UINT64_C(17653675155999026642), UINT64_C( 3607439390457286989), UINT64_C(15766479519158062551),
+    UINT64_C(17392144101620672248), UINT64_C( 5559056832638987846), UINT64_C( 5785284834068479863),
+    UINT64_C(15097577498169201048), UINT64_C(12693002747400477502), UINT64_C( 8508984984904399448),
+    UINT64_C(15102524632494762308), UINT64_C( 5190704113911164995), UINT64_C( 6950795527915050192),
+    UINT64_C(11222817109590317028), UINT64_C(12064813699278939161), UINT64_C( 2190210505347882178),
+    UINT64_C( 9748677097063844747), UINT64_C( 6701597623378035291), UINT64_C( 1887599300156476464),
+    UINT64_C(18312475996635022016), UINT64_C(10371518997718156574), UINT64_C(10891254974806572433),
+    UINT64_C( 9467468822029328010), UINT64_C( 2687395718893102543), UINT64_C(15661714981525014251),
+    UINT64_C(16992123632273074506), UINT64_C( 4563935455468076809), UINT64_C( 5853949695730609935),
+    UINT64_C(10622473298289909284), UINT64_C( 9687123441177515383), UINT64_C( 3926495866587298520),
+    UINT64_C( 5727200617526831008), UINT64_C( 6636974752260600928), UINT64_C(  824054077843172729),
+    UINT64_C( 3292228085055616561), UINT64_C( 9131946823569255203), UINT64_C(18236458769399661608),
+    UINT64_C( 3987259833217350680), UINT64_C(14467920957679420804), UINT64_C( 7435325639854595743),
+    UINT64_C( 1549634253303188093), UINT64_C(10380674653547766907), UINT64_C( 2261616490505124707),
+    UINT64_C( 4506291347483773032), UINT64_C( 8023190261630392515), UINT64_C( 7826839566879211528),
+    UINT64_C(15824546467527834495), UINT64_C( 7457576864242163320), UINT64_C( 5022945591500869479),
+    UINT64_C(10213297413099349601), UINT64_C( 7336887022054615054), UINT64_C(  532736583286742642),
+    UINT64_C(10949120766879761863), UINT64_C( 1292072186242049383), UINT64_C( 4253512507409266577),
+    UINT64_C(15204055554848431340), UINT64_C(  795028493834076427), UINT64_C(15906584175517860955),
+    UINT64_C(15876439695440582360), UINT64_C(18025349917767330065), UINT64_C(  321258353817470781),
+    UINT64_C( 7038669173086417254), UINT64_C(12750410154721500074), UINT64_C( 3239935852975725514),
+    UINT64_C(16095585161216792975), UINT64_C(16719581777725674339), UINT64_C( 9290912606262456587),
+    UINT64_C( 7638049629860970826), UINT64_C(11565803673056906512), UINT64_C(  599784477080212201),
+    UINT64_C(   77515901797299646), UINT64_C( 5718787136057921866), UINT64_C( 1305369207991983600),
+    UINT64_C(12739671913903669190), UINT64_C(18422282258182957116), UINT64_C( 8189117245031129621),
+    UINT64_C( 3970765379799260900), UINT64_C( 5798277026984550011), UINT64_C( 6152375959768026464),
+    UINT64_C( 6563294834198382772), UINT64_C(15478691441689093085), UINT64_C(15351321179563055439),
+    UINT64_C( 8849439785483709399), UINT64_C(16625156105464636381), UINT64_C(  519243668578310200),
+    UINT64_C( 6649798623492651382), UINT64_C( 7800384383729364671), UINT64_C(13453753376729812562),
+    UINT64_C( 3866536531466683071), UINT64_C( 6191942233307939162), UINT64_C( 8808085392561101057),
+    UINT64_C( 6937248085333990546), UINT64_C( 2783090654961380186), UINT64_C(17767262356834231844),
+    UINT64_C(10946872264133666568), UINT64_C( 8490085074931426576), UINT64_C(12070056983459514179),
+    UINT64_C(16025391431818531292), UINT64_C( 6512734330744205793), UINT64_C( 5329860512199736343),
+    UINT64_C( 8564489954378429807), UINT64_C(14011490922247526450), UINT64_C(12596053436503882636),
+    UINT64_C(13642228192462353531), UINT64_C(17320848506065100368), UINT64_C( 8150533521210920481),
+    UINT64_C(16198056512885989147), UINT64_C(15325136192247752399), UINT64_C( 7319294368875455069),
+    UINT64_C(12618725195220792199), UINT64_C(12580089363017589374), UINT64_C(11697929299466468149),
+    UINT64_C(13454734720994210547), UINT64_C( 2473627587695209103), UINT64_C(11278357194196069992),
+    UINT64_C( 4373099423799919029), UINT64_C(10751118631995671312), UINT64_C( 6159396215089295907),
+    UINT64_C(14673893254291298962), UINT64_C( 7336919838292133451), UINT64_C(10882197785983543072),
+    UINT64_C(10715198876153193381), UINT64_C(16960425789927278755), UINT64_C(11333182581451119095),
+    UINT64_C( 2537190792027621301), UINT64_C(  483938609699062743), UINT64_C(10969861733074502397),
+    UINT64_C(18361388696429417619), UINT64_C(10837856322613628300), UINT64_C( 4925170185553216082),
+    UINT64_C( 5986079315466035276), UINT64_C(15105434905807134634), UINT64_C(16024157607726461142),
+    UINT64_C( 1622862395098533211), UINT64_C( 9817439620703570771), UINT64_C( 3086327923299432019),
+    UINT64_C( 2378088898928169980), UINT64_C(12509139882995094288), UINT64_C(14816598902352938915),
+    UINT64_C(16211645381002431714), UINT64_C(15063437242703570969), UINT64_C(15115919454504731573),
+    UINT64_C( 7124707266952677798), UINT64_C( 2660993607810007366), UINT64_C(12970158159567782300),
+    UINT64_C(  911725458938768721), UINT64_C( 1551597112537180207), UINT64_C(12208751594739372444),
+    UINT64_C(10964969827720034861), UINT64_C(15369050780427018610), UINT64_C( 2174659133622257154),
+    UINT64_C( 7660394991633981355), UINT64_C(10376839016181397876), UINT64_C( 9766774256037223224),
+    UINT64_C(14149388754851666868), UINT64_C(10283553958280513240), UINT64_C(11888728375223892849),
+    UINT64_C(10005163990999129040), UINT64_C( 6316949314195301248), UINT64_C(15383386272613454096),
+    UINT64_C( 4645877627644259550), UINT64_C(16357295256867904133), UINT64_C( 2429349674943213890),
+    UINT64_C(17862392449225813865), UINT64_C( 6210088696389294386), UINT64_C( 8444217140203167188),
+    UINT64_C( 4960775307004705376), UINT64_C( 4641294358514570043), UINT64_C(17484831985982624781),
+    UINT64_C( 3777097241632474562), UINT64_C( 4948623550341113988), UINT64_C( 9445433476015948906),
+    UINT64_C( 4215584393657131024), UINT64_C( 7403240315427292727), UINT64_C( 8140712773885988125),
+    UINT64_C(10736378652719648904), UINT64_C( 9870433017619998234), UINT64_C(16942269677662444502),
+    UINT64_C(14369402153897784231), UINT64_C(16394146184349802137), UINT64_C( 3807710096486065111),
+    UINT64_C(  810144254221345025), UINT64_C(  737773358452074895), UINT64_C( 7196679369554066038),
+    UINT64_C(14498363592526867533), UINT64_C(13798244950518034269), UINT64_C( 7721280331879501728),
+    UINT64_C(  211008675147977758), UINT64_C(15539449267741275110), UINT64_C( 6698862770241041454),
+    UINT64_C( 8373056217427819556), UINT64_C( 8335214210246943719), UINT64_C( 7603858705401938139),
+    UINT64_C(11815276497781192690), UINT64_C(14117959256177033806), UINT64_C( 9231930034126358091),
+    UINT64_C(17063746427376064836), UINT64_C( 7480347819984557067), UINT64_C( 3060233673408366092),
+    UINT64_C( 7508611454719507433), UINT64_C( 3699304671320783718), UINT64_C( 2441288306680260653),
+    UINT64_C(17324557178567522610), UINT64_C(18170846344674679032), UINT64_C(11345110729558017594),
+    UINT64_C(17265631618894391106), UINT64_C(13478968505213928753), UINT64_C( 3010680991525521206),
+    UINT64_C(15323230751358392006), UINT64_C(14141858864956707779), UINT64_C( 6343955911785279236),
+    UINT64_C( 8221972396247461658), UINT64_C( 3189191896661910410), UINT64_C( 7275859734774918168),
+    UINT64_C( 3916899342837777657), UINT64_C(17565936116397909265), UINT64_C(12861782840510144670),
+    UINT64_C(12949176509460920737), UINT64_C(11862938250978756171), UINT64_C(14007389772910240798),
+    UINT64_C(11793435634082451524), UINT64_C(10676950429226477906), UINT64_C( 5731007217301644630),
+    UINT64_C( 6073927269870290825), UINT64_C(  524524789911762958), UINT64_C( 3252341392079923634),
+    UINT64_C(  966038993749216230), UINT64_C(11272734441078557364), UINT64_C(14149328764061573648),
+    UINT64_C( 4482138428697429398), UINT64_C(13951624053902370410), UINT64_C(18275816384876859185),
+    UINT64_C( 2131574955856399208), UINT64_C( 4156620687630749680), UINT64_C(10140245690203043896),
+    UINT64_C(15571717084816972468), UINT64_C(17714177090965904433), UINT64_C(14228051483764087456),
+    UINT64_C( 9261514582424403488), UINT64_C(16752711729570404741), UINT64_C(13508975171084961660),
+    UINT64_C(14816899046242453361), UINT64_C(17183502351505418941), UINT64_C( 9393556102024450993),
+    UINT64_C( 9379350031379565491), UINT64_C( 4106310880169984054), UINT64_C(  623149655051625567),
+    UINT64_C(15765466050183891302), UINT64_C( 1025978483713168327), UINT64_C( 7521741890797958821),
+    UINT64_C(18316074093477273757), UINT64_C( 7152221592113705056), UINT64_C( 1161365655305589260),
+    UINT64_C(17606287665657618970), UINT64_C(10707439233023848579), UINT64_C( 2030122920996113052),
+    UINT64_C( 3527826048668878276), UINT64_C( 1037310574103833667), UINT64_C( 2328354172498632485),
+    UINT64_C(14144032481446453418), UINT64_C( 6476077475534711122), UINT64_C(11702714626289073797),
+    UINT64_C( 5969080232253428645), UINT64_C(11366685258446336799), UINT64_C(15353062762322865644),
+    UINT64_C(11575053059181420137), UINT64_C( 6871640657593842650), UINT64_C(   59450638863571678),
+    UINT64_C( 1470840994654283480), UINT64_C(16462879005270680681), UINT64_C( 6933831043195668658),
+    UINT64_C( 6836701517979288831), UINT64_C(17008713017796795127), UINT64_C( 2978022707271824146),
+    UINT64_C(12003543614812927806), UINT64_C( 1950144649032179149), UINT64_C(17531041394046458963),
+    UINT64_C(13584469951537789608), UINT64_C(  547084928892834156), UINT64_C(18274210170088810497),
+    UINT64_C( 8252238387093709242), UINT64_C(12636647005183370839), UINT64_C( 3484060994537231902),
+    UINT64_C(12150237822668473887), UINT64_C(17159814169809758949), UINT64_C( 3597685243529049533),
+    UINT64_C(12532204829496819920), UINT64_C( 6209247516035998822), UINT64_C(14685068185283478013),
+    UINT64_C(12614015486442593852), UINT64_C( 4367656130668521006), UINT64_C(13278932510813608532),
+    UINT64_C( 3267115454208414131), UINT64_C( 3153018427086294309), UINT64_C( 7953484326609285118),
+    UINT64_C( 9878723116412193803), UINT64_C( 6440255585648176779), UINT64_C(11467144595354358986),
+    UINT64_C( 6706163976304547842), UINT64_C( 6011844692643917362), UINT64_C( 8237529382254686174),
+    UINT64_C(17552460810699561935), UINT64_C( 7379563882259490631), UINT64_C(18011250002515005808),
+    UINT64_C( 2771923343720792784), UINT64_C( 6430449184797198779), UINT64_C( 6458191046505403946),
+    UINT64_C(11624239542569073849), UINT64_C( 6344135347345683345), UINT64_C( 4850211518002750932),
+    UINT64_C(17383344486556161385), UINT64_C( 4182733821677268203), UINT64_C( 4421013741595730431),
+    UINT64_C( 8586857043833473996), UINT64_C( 6438206226729947589), UINT64_C( 7176908050062859797),
+    UINT64_C(16140506472986348266), UINT64_C(16985207735470877648), UINT64_C( 4129505073859615839),
+    UINT64_C( 2045168020946544198), UINT64_C( 5044858856783534954), UINT64_C(14207121610923912878),
+    UINT64_C(  125472715915699032), UINT64_C(10022863711423162035), UINT64_C(14150460357275822369),
+    UINT64_C(10954308280831489033), UINT64_C( 7455367607192530677), UINT64_C(16709034900708648583),
+    UINT64_C( 1096610553773161688), UINT64_C( 5996394210777847030), UINT64_C(13846480860139137760),
+    UINT64_C(14038317690689165301), UINT64_C(14390319241434363093), UINT64_C(17312833212029112005),
+    UINT64_C( 3395905850746651040), UINT64_C(16658645203505941589), UINT64_C(15545093430797142494),
+    UINT64_C(12715393057058349627), UINT64_C(13210549944369006430), UINT64_C(12840965660204203393),
+    UINT64_C( 7670031648500858558), UINT64_C(11108732463314901175), UINT64_C(15836611207929314978),
+    UINT64_C( 2548859463508146442), UINT64_C( 6545861174197572826), UINT64_C(15733894979453017444),
+    UINT64_C(13119655260921301214), UINT64_C( 2925867916509358312), UINT64_C(17082266855006719086),
+    UINT64_C( 3342930280299466837), UINT64_C( 3753746119953759424), UINT64_C(12333856104439418947),
+    UINT64_C(15958330216678504264), UINT64_C(15865784930208123596), UINT64_C(16955334721617248426),
+    UINT64_C(10794918921151006710), UINT64_C( 9278499731587959531), UINT64_C( 1477399764885353504),
+    UINT64_C( 3848617669525510451), UINT64_C(  395062664604122197), UINT64_C(10872822215124667463),
+    UINT64_C( 4801455286200136077), UINT64_C(12447719805480597392), UINT64_C( 1212585991030832527),
+    UINT64_C( 4394342138638275529), UINT64_C( 3982033787021150967), UINT64_C(16334008992497835247),
+    UINT64_C( 1931902765195178648), UINT64_C( 7441811111581718715), UINT64_C( 6400067016917510858),
+    UINT64_C(16193017111473049863), UINT64_C( 1220912568590502635), UINT64_C(  819585434212381271),
+    UINT64_C( 2620899151970030674), UINT64_C(17528817113587444876), UINT64_C(14444888917304084087),
+    UINT64_C(11783439202461196635), UINT64_C( 6475611582507836503), UINT64_C( 9488509130365842669),
+    UINT64_C( 7675575957508984589), UINT64_C( 3765903746025108887), UINT64_C( 2290173523657045834),
+    UINT64_C(14882763651574308198), UINT64_C( 1643267835585176750), UINT64_C( 9562219288038263513),
+    UINT64_C( 6541133209642207219), UINT64_C( 5862887961914224506), UINT64_C( 7917286077122689122),
+    UINT64_C(11337322928032803032), UINT64_C( 7398648602236479204), UINT64_C( 5915223618629138346),
+    UINT64_C( 4353204038488323312), UINT64_C( 2385024958896746858), UINT64_C( 9879726239071217540),
+    UINT64_C( 3913052082319431210), UINT64_C( 6339701180181827427), UINT64_C(13080675063835488736),
+    UINT64_C( 7651763859654080881), UINT64_C( 4977363436130901249), UINT64_C(14131109365651792047),
+    UINT64_C( 8488069535807066230), UINT64_C( 2746454911400926967), UINT64_C(13582926280524164425),
+    UINT64_C( 8662549814921257574), UINT64_C( 3781539743790695007), UINT64_C(14998187401423670562),
+    UINT64_C( 2043226222224532012), UINT64_C( 6963953146613935773), UINT64_C(17369516751451888769),
+    UINT64_C( 3510638843789557276), UINT64_C( 2443442121860501859), UINT64_C( 9251050775332039089),
+    UINT64_C( 7491448803264988693), UINT64_C(10692164911757845340), UINT64_C(15297166958091227027),
+    UINT64_C( 7153210414535920077), UINT64_C( 7518592205968233530), UINT64_C( 4285057927966942831),
+    UINT64_C( 5271684421725027866), UINT64_C( 6972705595924076928), UINT64_C(16831094245963614355),
+    UINT64_C( 7295731723276117165), UINT64_C(  980069967993924235), UINT64_C(  683840434269244104),
+    UINT64_C( 3283009077575642824), UINT64_C(10671270586994043502), UINT64_C(17126632556543467083),
+    UINT64_C(13334945544854822302), UINT64_C(14656129054190166051), UINT64_C( 9885934878371744346),
+    UINT64_C(16763876526171700003), UINT64_C( 3485650857848240478), UINT64_C( 7480107884525257642),
+    UINT64_C(10310357411271962663), UINT64_C( 9529370175764584176), UINT64_C(16741900092146899708),
+    UINT64_C(  936166740933033792), UINT64_C( 7816986820672653376), UINT64_C(14101993328870745896),
+    UINT64_C( 9446562744348666872), UINT64_C(  788773449283363516), UINT64_C( 1431344154842419387),
+    UINT64_C(15209656065600699099), UINT64_C( 3216560040010454452), UINT64_C( 8310393855344440966),
+    UINT64_C( 2742465452130275432), UINT64_C(17905190626120093514), UINT64_C( 6204918737829159945),
+    UINT64_C(12056949092800237063), UINT64_C( 8330857898088405278), UINT64_C( 5667918344191683126),
+    UINT64_C(12017188121623256449), UINT64_C(10487169474399915347), UINT64_C(17043308572883239348),
+    UINT64_C( 9020936916954214989), UINT64_C(16620575886320340083), UINT64_C(16039538274196874157),
+    UINT64_C( 7801513356536769344), UINT64_C( 8003432860277307338), UINT64_C(14419067265579660617),
+    UINT64_C( 3970542096867280507), UINT64_C( 9803416914218927043), UINT64_C( 2505190362012770037),
+    UINT64_C( 6264590827648883477), UINT64_C(10760032883403366612), UINT64_C( 5911749743687958637),
+    UINT64_C(11038004800741559898), UINT64_C(15640135057900751766), UINT64_C( 1555010984183863935),
+    UINT64_C( 1279595564790310874), UINT64_C( 6703581584335318649), UINT64_C( 9436688113948612951),
+    UINT64_C( 1059934365190267585), UINT64_C(12096795615639418569), UINT64_C( 9979538736748343391),
+    UINT64_C(13954054074196509618), UINT64_C(16412071153753638257), UINT64_C( 8996415895360007689),
+    UINT64_C(12343259230553480845), UINT64_C( 1043775764306161782), UINT64_C( 9300257820891667993),
+    UINT64_C(12007042063989439155), UINT64_C(14578072550792146382), UINT64_C( 7408652177688787809),
+    UINT64_C( 3172978149511685375), UINT64_C(  289215475778954292), UINT64_C(16382213873157961999),
+    UINT64_C( 9659605862480346636), UINT64_C(12908748873725960096), UINT64_C( 7124084879991515427),
+    UINT64_C(16292677096923504089), UINT64_C( 5785246974115884831), UINT64_C(12999870972329895437),
+    UINT64_C(11289531030565251818), UINT64_C(14125538175393468679), UINT64_C(17189526496604121202),
+    UINT64_C( 3392776274373824360), UINT64_C(10221761546112972278), UINT64_C( 6569974105238481044),
+    UINT64_C(18429688868187810760), UINT64_C(10155112748119555389), UINT64_C(10094029035896599106),
+    UINT64_C(16653935568708848598), UINT64_C( 2346304140714607409), UINT64_C( 7505153196371828040),
+    UINT64_C(18067653865425490368), UINT64_C( 5448206815114747329), UINT64_C(15815195230123714597),
+    UINT64_C(14922703530856633565), UINT64_C( 1245148030991108190), UINT64_C( 1006354190660639475),
+    UINT64_C( 8713458107917975119), UINT64_C( 6801747814650478768), UINT64_C( 9746231033302730216),
+    UINT64_C( 4862741898691333125), UINT64_C( 2931153500698604301), UINT64_C( 5912670226056224838),
+    UINT64_C(16200086694824203705), UINT64_C( 8056168847574777768), UINT64_C( 8184754025388121928),
+    UINT64_C(13039109273954694652), UINT64_C( 7298128206561367785), UINT64_C( 6034938327916716503),
+    UINT64_C( 7240052295555689957), UINT64_C(18176687840881555628), UINT64_C(10040995672104521067),
+    UINT64_C(16140544552307408190), UINT64_C(15256775482785871689), UINT64_C(16223430760769901807),
+    UINT64_C(10206190507408971898), UINT64_C(17721863723874693219), UINT64_C(12913867340040444877),
+    UINT64_C( 3068156232798275191), UINT64_C(11041067204403314337), UINT64_C(14030469621276462351),
+    UINT64_C(  949682020560076034), UINT64_C(  311650362020626222), UINT64_C(17823438571394630199),
+    UINT64_C(  832719281874824623), UINT64_C( 4777057524098981218), UINT64_C( 2479959339141346850),
+    UINT64_C(15389770986524806559), UINT64_C( 2723905631336572781), UINT64_C( 1044413101952639709),
+    UINT64_C( 7403630015146204752), UINT64_C(16300145960930671166), UINT64_C( 9305647423279991015),
+    UINT64_C(13458775482751918750), UINT64_C( 8803131986562446677), UINT64_C( 6397346354424307417),
+    UINT64_C( 2261671814374445307), UINT64_C( 8565412203068433060), UINT64_C(11526461319678639460),
+    UINT64_C(17456721261252940743), UINT64_C( 7199333321024337251), UINT64_C( 9118195903826649896),
+    UINT64_C(15142608226500847568), UINT64_C(16724660867453047868), UINT64_C( 7498451141298770696),
+    UINT64_C( 3289984482398425634), UINT64_C( 5929482543053587160), UINT64_C(12865592666668632813),
+    UINT64_C( 3893111894527135492), UINT64_C( 5659986618530345787), UINT64_C( 6530988684136536054),
+    UINT64_C( 1596612486871390407), UINT64_C( 4924833599096014188), UINT64_C(18192327386648112449),
+    UINT64_C(17303987744167040597), UINT64_C(11172324337055551674), UINT64_C(17576901787089669935),
+    UINT64_C(14247769545255591848), UINT64_C(12344888121779638533), UINT64_C(13696611270483121504),
+    UINT64_C(12660881173349229513), UINT64_C( 1906658450674597329), UINT64_C(  935015860473793947),
+    UINT64_C( 5970965429595398574), UINT64_C( 9476268215771775505), UINT64_C(16139348109044318108),
+    UINT64_C( 6333410354478878381), UINT64_C(14614171396422252042), UINT64_C(15614815431922971966),
+    UINT64_C( 4797572769299560363), UINT64_C( 5952147050561432186), UINT64_C(12413489301082987140),
+    UINT64_C( 5321389092124268745), UINT64_C( 8124372993710713725), UINT64_C( 3608762760598285911),
+    UINT64_C(16014177922840635045), UINT64_C( 1918353867783673018), UINT64_C(16557222612179087166),
+    UINT64_C( 9999053415530750839), UINT64_C( 7484842278338045925), UINT64_C( 4530560230706862402),
+    UINT64_C( 5790045855873906547), UINT64_C(14780950571222436065), UINT64_C(17371092351532966665),
+    UINT64_C( 1156400784671394972), UINT64_C( 2856046516160674755), UINT64_C( 6917212468786927852),
+    UINT64_C( 5933525809827352775), UINT64_C( 6372069586962265614), UINT64_C( 2419453459156255822),
+    UINT64_C(14555047047361242149), UINT64_C(10215085194368579274), UINT64_C(13419689232334614092),
+    UINT64_C( 4731235618992435014), UINT64_C(15606678242288721550), UINT64_C(12050515971011854927),
+    UINT64_C(12459036914853834151), UINT64_C( 6281042372003120553), UINT64_C(  872608656828928266),
+    UINT64_C(11699894849544758567), UINT64_C(13527606189738634283), UINT64_C( 8719867219581702730),
+    UINT64_C(10873224313681512109), UINT64_C( 7804177519953886313), UINT64_C( 1756429982686777271),
+    UINT64_C( 8425106910021591802), UINT64_C(11615029927461391060), UINT64_C(16662032157473884590),
+    UINT64_C( 8294403423437598124), UINT64_C( 6707899754258937550), UINT64_C(12449341400208309288),
+    UINT64_C( 5639345486546188850), UINT64_C( 3789755731604709772), UINT64_C( 8180406820005097239),
+    UINT64_C(16542916448154141504), UINT64_C( 6659111661727651544), UINT64_C(13878605502829445089),
+    UINT64_C( 1748101557604073039), UINT64_C(15519682344957746721), UINT64_C( 2673276434337600422),
+    UINT64_C(14073413096506793773), UINT64_C(16275388972022807717), UINT64_C(  601324993980182841),
+    UINT64_C( 6159651242598377708), UINT64_C( 1941964541131184210), UINT64_C( 5449809128444687117),
+    UINT64_C( 8186794253328016406), UINT64_C( 5580720465302160192), UINT64_C(12234585914450636767),
+    UINT64_C( 2158061103659792645), UINT64_C( 3838793860466319591), UINT64_C(  131265627633903349),
+    UINT64_C( 2017450483330716714), UINT64_C( 5994527017049979325), UINT64_C( 9118791839529518139),
+    UINT64_C(16556097650059827964), UINT64_C(17697746349523838121), UINT64_C( 5998078452482989947),
+    UINT64_C(16444609083007748892), UINT64_C(14488828405170922954), UINT64_C(11658038276153450306),
+    UINT64_C( 2337313229573780925), UINT64_C( 3082018651885430046), UINT64_C(17794446335325806377),
+    UINT64_C(10688843203285356036), UINT64_C( 4155187505536121601), UINT64_C( 6118270360949384774),
+    UINT64_C( 6941695329931751416), UINT64_C( 1933225932853372003), UINT64_C( 4102170397539507926),
+    UINT64_C(13963486138935630568), UINT64_C( 1428723339400848002), UINT64_C(17932854778881714965),
+    UINT64_C(14399653953375758646), UINT64_C(14372054492503594768), UINT64_C(10583448698248347269),
+    UINT64_C( 3509415609112782850), UINT64_C(10613162879741496286), UINT64_C( 5629106033785832752),
+    UINT64_C( 9564246980960736107), UINT64_C( 5868988404886768768), UINT64_C(17194215808852409049),
+    UINT64_C( 3491598857544930719), UINT64_C(17574234019921630813), UINT64_C(17065705830290878557),
+    UINT64_C( 3652028769078188023), UINT64_C( 4475772722859079995), UINT64_C(14916800100551778493),
+    UINT64_C(15767305353160295859), UINT64_C(10214536674868855859), UINT64_C( 8886449909830682420),
+    UINT64_C(16410527434012319149), UINT64_C( 9849271684484259143), UINT64_C(10783499096607692750),
+    UINT64_C( 9968757564490533415), UINT64_C(10990467185589572997), UINT64_C( 8082908416152454263),
+    UINT64_C( 2443612187522262472), UINT64_C( 9248524634501061960), UINT64_C(15304499654716889650),
+    UINT64_C( 1108377620566694398), UINT64_C(18145935022041612842), UINT64_C( 3810508832414219537),
+    UINT64_C( 4283988580237797562), UINT64_C( 4902651124888029448), UINT64_C( 6924064257920050494),
+    UINT64_C(11759901578089697684), UINT64_C( 1251406297075790700), UINT64_C(15126797936803265022),
+    UINT64_C(10987223509482987909), UINT64_C(15399314395201706410), UINT64_C(11981202722840878421),
+    UINT64_C( 4542748570644371862), UINT64_C(13107066738142579628), UINT64_C( 3702864191111446583),
+    UINT64_C( 2235290499422831350), UINT64_C(  665876440616848172), UINT64_C(16230710793277553283),
+    UINT64_C( 4495506554501186747), UINT64_C(14550820960426165381), UINT64_C( 1330298739888944034),
+    UINT64_C(11563057884044584114), UINT64_C(16432311755922067923), UINT64_C( 3577274089969928962),
+    UINT64_C( 6790976695889620404), UINT64_C( 9083338755476319029), UINT64_C(13485945174540913643),
+    UINT64_C( 7846098708733628534), UINT64_C(  738109188503114701), UINT64_C(   54651202068870986),
+    UINT64_C( 8898115076940412253), UINT64_C( 4537591737387369973), UINT64_C(14498342048305367048),
+    UINT64_C( 7357303729797469730), UINT64_C(11206654282706656445), UINT64_C( 9380153671389246599),
+    UINT64_C(13784932478307097156), UINT64_C(11577412359165999476), UINT64_C(16888525546311936260),
+    UINT64_C( 2636518938254436902), UINT64_C(12314528772095401417), UINT64_C(16390048365645610565),
+    UINT64_C(13700435474456645115), UINT64_C( 7896696732174124269), UINT64_C( 1533219135734455393),
+    UINT64_C(12824633042826621957), UINT64_C( 1097344932148957668), UINT64_C(12584736886107011685),
+    UINT64_C(17557290881224337871), UINT64_C(15426935041507792420), UINT64_C( 2741600703405278016),
+    UINT64_C(15693844780780885248), UINT64_C( 9480198028036369348), UINT64_C(15172575577190553270),
+    UINT64_C(12688264603134112379), UINT64_C(  441724510495439341), UINT64_C( 5447045847552290979),
+    UINT64_C(11036171675899639809), UINT64_C( 4177604586827430670), UINT64_C(  239837828209793491),
+    UINT64_C(12390390992663781044), UINT64_C(13416001486052185786), UINT64_C(10387204097729262679),
+    UINT64_C(14087367814570860617), UINT64_C( 4120863860219831105), UINT64_C( 1572100377995437447),
+    UINT64_C( 1543083031633856797), UINT64_C(12229437747405130509), UINT64_C(  359607749038097788),
+    UINT64_C(11718718099756544807), UINT64_C(  197273935104393427), UINT64_C(16172794632374993248),
+    UINT64_C(10939261971405398967), UINT64_C(  416963019250134220), UINT64_C( 3770047066528861307),
+    UINT64_C( 5430183856594337825), UINT64_C(13949971877488132886), UINT64_C(11150421375911460527),
+    UINT64_C( 8856853734920706443), UINT64_C( 9794722546974025800), UINT64_C( 5463891452903539353),
+    UINT64_C( 9310607114541432168), UINT64_C(  854137335714707916), UINT64_C(12193460625465991590),
+    UINT64_C( 4868268448436120804), UINT64_C(11461061438621376504), UINT64_C(13482461935711286302),
+    UINT64_C( 7563996737842373272), UINT64_C( 1324032285132800459), UINT64_C(  212215312799592160),
+    UINT64_C( 4875079671801458261), UINT64_C(15022541378114048633), UINT64_C(16617408739396911080),
+    UINT64_C(11069253639158500682), UINT64_C( 9233368836610809262), UINT64_C( 1210681595971310713),
+    UINT64_C( 1960318914764717743), UINT64_C(  408178523019173473), UINT64_C( 3476695533994548434),
+    UINT64_C(  951889974249856709), UINT64_C( 5493163318119734736), UINT64_C( 3181379901196240396),
+    UINT64_C( 1789715612861379618), UINT64_C(12005528462254258084), UINT64_C( 5336432563854953615),
+    UINT64_C(12474318424389977490), UINT64_C(  939236246125912135), UINT64_C( 7753999093236257596),
+    UINT64_C( 9187800080958000100), UINT64_C(11445274915387499627), UINT64_C( 9676124438746293817),
+    UINT64_C(13068285012217038483), UINT64_C(16148459356260331217), UINT64_C( 3537248514244114466),
+    UINT64_C(11800645485649669227), UINT64_C(12624009585195477009), UINT64_C( 9192349565559341318),
+    UINT64_C( 2363789017395873058), UINT64_C(14728510627181674741), UINT64_C( 2282682874809012142),
+    UINT64_C( 2824578879199047561), UINT64_C( 8853850407293060900), UINT64_C(17772190152077797184),
+    UINT64_C( 1411938575094001772), UINT64_C( 4338955959068088070), UINT64_C(14447389628437906976),
+    UINT64_C(14885559721030270348), UINT64_C(   89732914904733342), UINT64_C( 6753169997552062559),
+    UINT64_C( 4965261884253759922), UINT64_C( 5200842723427622792), UINT64_C(11411899545270481576),
+    UINT64_C(  911684297462759661), UINT64_C( 9608043386346694073), UINT64_C( 7370462449473453990),
+    UINT64_C(16210762125076920541), UINT64_C(15952902380303482074), UINT64_C( 2013374097296765342),
+    UINT64_C(10704841052939819994), UINT64_C( 8285409367283538124), UINT64_C(13744057052302847580),
+    UINT64_C( 4533030983864215270), UINT64_C( 1054550973629380135), UINT64_C(11072113752015491480),
+    UINT64_C( 5437578786548275401), UINT64_C(  120954974510287822), UINT64_C(17567959471736915475),
+    UINT64_C(17230223897672128941), UINT64_C(17419859448367223267), UINT64_C(  579544474891150326),
+    UINT64_C(10491458060616351836), UINT64_C( 6215850367509488918), UINT64_C( 7418090573129253935),
+    UINT64_C(15694098941998138309), UINT64_C(10629753139159135763), UINT64_C(14156789853548899404),
+    UINT64_C(  188961923039573355), UINT64_C( 8147775746903272951), UINT64_C(  347876932367493747),
+    UINT64_C(10445195075283713786), UINT64_C(13384887033766634982), UINT64_C( 9363263340999380589),
+    UINT64_C( 9673016006498685746), UINT64_C( 4667893837766861705), UINT64_C(13147272237777937725),
+    UINT64_C( 7799793469812742460), UINT64_C(18167820998420103977), UINT64_C( 8965090696029594300),
+    UINT64_C( 8367772565428591454), UINT64_C( 6839270044879550944), UINT64_C( 3663876260517275405),
+    UINT64_C(12008824120262547024), UINT64_C( 2752105641152902035), UINT64_C(12379259596654137201),
+    UINT64_C(16091071015128687689), UINT64_C( 7455526986573760574), UINT64_C( 1065815862314093518),
+    UINT64_C( 9035406160272745391), UINT64_C( 7882823365203995373), UINT64_C( 2557288544972232843),
+    UINT64_C( 4717271041721914770), UINT64_C(17874098275613267022), UINT64_C(17437301007334629297),
+    UINT64_C( 7328731621589561683), UINT64_C(12165520521951490185), UINT64_C( 8295557089670123977),
+    UINT64_C(  557960310548722281), UINT64_C( 3336743788673397739), UINT64_C(14453374932827432077),
+    UINT64_C( 8513907850976088172), UINT64_C(14864663113733128514), UINT64_C(18191907373280484563),
+    UINT64_C(18093492068615509934), UINT64_C(15367936344682596488), UINT64_C( 8298327092713519831),
+    UINT64_C( 4407035048474114199), UINT64_C(18076066453633225829), UINT64_C(15583695311793507574),
+    UINT64_C(15065258283318028178), UINT64_C(18350756442707523147), UINT64_C( 5836706508962576318),
+    UINT64_C(17773895569876091097), UINT64_C(13817741599934505432), UINT64_C( 4739604504500285163),
+    UINT64_C( 8430607304627957289), UINT64_C(13687537131706229428), UINT64_C(  500661425114548745),
+    UINT64_C( 8755845864504179094), UINT64_C(10712916462524945838), UINT64_C( 7819818407264219645),
+    UINT64_C( 8248728081686549269), UINT64_C(10422574867840415811), UINT64_C(13926460409032238015),
+    UINT64_C(14659488089249811784), UINT64_C( 7396643017915243258), UINT64_C( 1202911583472776867),
+    UINT64_C( 5210190366580344902), UINT64_C( 4160990319208145641), UINT64_C( 5390052140868347301),
+    UINT64_C( 1036628359768327579), UINT64_C(17586981671612696228), UINT64_C( 6943287977729844012),
+    UINT64_C(11893316251598238776), UINT64_C( 4287311877302485106), UINT64_C(12528668053321317815),
+    UINT64_C( 1201300021801992216), UINT64_C( 4025410504784720247), UINT64_C( 6712091548068053878),
+    UINT64_C( 2785260984327796541), UINT64_C(13562007108554052883), UINT64_C( 4206878692201856385),
+    UINT64_C(15201423768858637267), UINT64_C( 8549773958593912651), UINT64_C( 6573010040391113139),
+    UINT64_C(15890526987243620945), UINT64_C( 2792763276567117529), UINT64_C( 4667361650167804322),
+    UINT64_C(15318903860884777685), UINT64_C(18229139094109548769), UINT64_C( 8023136602447561243),
+    UINT64_C( 1043865641870663483), UINT64_C( 5903276502677153252), UINT64_C(   53027213440924003),
+    UINT64_C( 6929706982188710873), UINT64_C(14162478374258610152), UINT64_C( 9291685773623224711),
+    UINT64_C(16547071473305671052), UINT64_C(13360716326733893595), UINT64_C( 5106439282578037771),
+    UINT64_C(12112865266826867888), UINT64_C( 8374169019430200033), UINT64_C( 1143621629633695798),
+    UINT64_C( 5239300063889875572), UINT64_C( 6641279640821327081), UINT64_C( 4633466802283352697),
+    UINT64_C(11586202706244607731), UINT64_C(14592455144799048236), UINT64_C( 9030705990816394976),
+    UINT64_C(  461169995765932576), UINT64_C( 7942815107633099374), UINT64_C(16517787619254982173),
+    UINT64_C( 7262211437181347470), UINT64_C(17407027603865055777), UINT64_C( 5414172013259459926),
+    UINT64_C(13898863385969287844), UINT64_C( 4892486402926000578),
+};
+
+const uint64_t ntt64_1024_scaled_inv_psi_powers[2048] = {
+    UINT64_C(   18014398509481984), UINT64_C( 2582167035391610191), UINT64_C( 1564217189213667449),
+    UINT64_C( 3067153676955380804), UINT64_C( 2156188702559533805), UINT64_C( 1665465428835028554),
+    UINT64_C( 2172977582770729590), UINT64_C( 1806929680373796077), UINT64_C( 2158544636449658009),
+    UINT64_C( 1293110706108483228), UINT64_C( 2104503323476618341), UINT64_C( 1207544324494825544),
+    UINT64_C( 1759133040268636805), UINT64_C( 3561956343356349466), UINT64_C( 1780062214495821209),
+    UINT64_C( 4367040123097332037), UINT64_C( 1288735322614101497), UINT64_C( 3816828336063711358),
+    UINT64_C( 4558754468423633544), UINT64_C(  162344053685554964), UINT64_C( 2825798083851995286),
+    UINT64_C( 2847641743767572283), UINT64_C(  106414924145743236), UINT64_C(  171197856154522047),
+    UINT64_C( 3012793542887603407), UINT64_C( 2431424513197952730), UINT64_C(  887038905440435176),
+    UINT64_C( 2183648656043768977), UINT64_C( 3598146744711343485), UINT64_C( 1345507732677153131),
+    UINT64_C( 2724847345648871965), UINT64_C( 1324099630445912704), UINT64_C( 1938882488923263619),
+    UINT64_C( 2649891483018804647), UINT64_C(  812305069993441288), UINT64_C(  200974539137107949),
+    UINT64_C( 2875045956258068096), UINT64_C( 3372248394691517430), UINT64_C(  876653183931324222),
+    UINT64_C(  617054850951432161), UINT64_C( 2922015590831733869), UINT64_C( 4503294905689256785),
+    UINT64_C( 2631937231785541664), UINT64_C( 4095984584650564449), UINT64_C( 4359265422501652782),
+    UINT64_C(  953293127509466361), UINT64_C( 1566067469778862578), UINT64_C( 2757619902434301330),
+    UINT64_C( 2715061788032361130), UINT64_C( 1254443166871091049), UINT64_C( 4293944572852831171),
+    UINT64_C( 1567523962696103486), UINT64_C( 1176074529328915847), UINT64_C( 3133845400237626244),
+    UINT64_C(  290576887195771417), UINT64_C( 4306236675733093039), UINT64_C( 1057923299484644821),
+    UINT64_C( 2314980356367141597), UINT64_C( 2674806335890243318), UINT64_C( 2782122243986181647),
+    UINT64_C( 2262549276141102179), UINT64_C( 1493416000221494377), UINT64_C( 2118803992366754412),
+    UINT64_C( 1243661491053626668), UINT64_C( 2484126133029566201), UINT64_C( 3633082929840258721),
+    UINT64_C(  293019663262772014), UINT64_C( 1967518956047860414), UINT64_C(  494322470501235626),
+    UINT64_C( 3500732937786882004), UINT64_C( 4155349182710790774), UINT64_C( 3930164331833104319),
+    UINT64_C( 1335887780146127903), UINT64_C( 3995821463872856003), UINT64_C(  367281352010595126),
+    UINT64_C( 3660603506450140248), UINT64_C( 3159823652228965009), UINT64_C( 4123340203417320885),
+    UINT64_C( 3975181864706850234), UINT64_C(   93641106727870365), UINT64_C( 1830692083968264573),
+    UINT64_C( 2549746646626580661), UINT64_C( 3991529634171269421), UINT64_C( 3084390094489012525),
+    UINT64_C(  355296284002135928), UINT64_C( 4256981823815878262), UINT64_C( 2797825374214960278),
+    UINT64_C( 3982297978413311927), UINT64_C( 1235177584632512651), UINT64_C(  361049236641842105),
+    UINT64_C(  224011506352309587), UINT64_C( 4330241154559212627), UINT64_C( 4282509160284759322),
+    UINT64_C(  640558608489339540), UINT64_C(  489145647926303005), UINT64_C( 1944305902106249494),
+    UINT64_C( 1093597513281394586), UINT64_C( 2448952535786150143), UINT64_C(  726889522242584663),
+    UINT64_C( 1457560819808561209), UINT64_C(  965902898330801569), UINT64_C( 3187854988924223079),
+    UINT64_C( 3182566507841623802), UINT64_C(  533397518536752393), UINT64_C(  925918078217013605),
+    UINT64_C( 1813437116744748324), UINT64_C( 2422843872141027610), UINT64_C( 1178512019642514560),
+    UINT64_C( 1786592030450453579), UINT64_C( 2342027355959217564), UINT64_C( 2976724036012205646),
+    UINT64_C( 4266782090687318204), UINT64_C( 2216489625050880798), UINT64_C(  261312956403454081),
+    UINT64_C( 4397200953942610626), UINT64_C( 3355339289407137946), UINT64_C( 4195996787145041041),
+    UINT64_C(   40810455528162137), UINT64_C( 2432347008403935813), UINT64_C( 2677005057661461607),
+    UINT64_C( 2218724471302235554), UINT64_C(  221412442383079459), UINT64_C( 3705149027385324087),
+    UINT64_C( 2771209683911257717), UINT64_C( 2129152719420481070), UINT64_C( 1266463187213440058),
+    UINT64_C( 1889343206693711276), UINT64_C( 3691720953229901895), UINT64_C(  168312082708035527),
+    UINT64_C( 2743330553370500653), UINT64_C( 3629132501688032832), UINT64_C( 3612991064806734911),
+    UINT64_C(  400941579875765792), UINT64_C( 2625468249378684698), UINT64_C( 3542697819937410161),
+    UINT64_C( 1547250337155455613), UINT64_C(  536415921568933128), UINT64_C( 2656516577368712923),
+    UINT64_C( 4180939908328080037), UINT64_C( 1592814406773003174), UINT64_C( 2826219488101283792),
+    UINT64_C( 2161297677228539154), UINT64_C( 1122396571513750614), UINT64_C( 4120850483214995853),
+    UINT64_C(  860354288476480186), UINT64_C(  986405980381747618), UINT64_C(  534115449920491196),
+    UINT64_C(  367636951322072820), UINT64_C( 3506928814054446769), UINT64_C( 3303153429112768114),
+    UINT64_C( 3429659845813420129), UINT64_C( 4533713106623751419), UINT64_C( 4128117562380582348),
+    UINT64_C( 4455745023685872415), UINT64_C( 1362697035818159804), UINT64_C( 1641587805493231746),
+    UINT64_C( 2046485905973808314), UINT64_C( 4127674113460610842), UINT64_C(  125022745894792099),
+    UINT64_C(  880637226791340821), UINT64_C( 4287661743759067241), UINT64_C( 2800755277425051650),
+    UINT64_C( 3966697713496766900), UINT64_C(  413525692528693358), UINT64_C( 4457035859772478638),
+    UINT64_C( 2250487013015218082), UINT64_C( 2518372411601301224), UINT64_C( 1415218696823265992),
+    UINT64_C( 3662152431287679912), UINT64_C( 1865139008125214744), UINT64_C( 1514577755612758512),
+    UINT64_C( 4062722255034510918), UINT64_C( 2671391128638871128), UINT64_C( 3122359749837803396),
+    UINT64_C(  107511015464816224), UINT64_C( 1758311842431716885), UINT64_C( 1920263007820725516),
+    UINT64_C( 1294236266563908700), UINT64_C( 2541895307026155345), UINT64_C( 1619753380970544057),
+    UINT64_C( 4473646170058171134), UINT64_C(   33391128869682456), UINT64_C( 3583312745069310396),
+    UINT64_C( 2710341897258749753), UINT64_C( 2538860567994991391), UINT64_C( 2989837075232939488),
+    UINT64_C( 1613086588736278257), UINT64_C( 4283316542479413595), UINT64_C( 2829861947515763351),
+    UINT64_C( 1516892791735437312), UINT64_C( 1052369835757715361), UINT64_C( 4462305415573569393),
+    UINT64_C( 4054176625241939252), UINT64_C( 3689501302715652156), UINT64_C(  325528363440671673),
+    UINT64_C( 3025101344370469777), UINT64_C( 3658559016240578001), UINT64_C(  976480454709003133),
+    UINT64_C( 2897619806293444914), UINT64_C( 1090218017069673859), UINT64_C( 3325470737196439043),
+    UINT64_C( 2849247041079311162), UINT64_C(  858163784445686137), UINT64_C( 4280789678447745305),
+    UINT64_C( 4219667947955640478), UINT64_C( 1468140329423994934), UINT64_C( 1494557075859487528),
+    UINT64_C( 2506022152109859159), UINT64_C( 1087103887721845007), UINT64_C( 4606735372326233711),
+    UINT64_C( 3875185299172863933), UINT64_C( 2388167939064496767), UINT64_C( 1751071174294111789),
+    UINT64_C( 1484124930114125174), UINT64_C(  267808911001785819), UINT64_C( 3455452791157003270),
+    UINT64_C(  864359207721616305), UINT64_C( 2139461395839481414), UINT64_C( 2525480638071446843),
+    UINT64_C( 1848837627956847231), UINT64_C( 2430720920119147541), UINT64_C( 4587763790435437246),
+    UINT64_C( 4172970762104295976), UINT64_C( 3542064843374485122), UINT64_C( 2326557763338070404),
+    UINT64_C( 1992726264238043600), UINT64_C( 2550962294841672888), UINT64_C( 2131220308578879419),
+    UINT64_C( 3438635656733702683), UINT64_C( 2932147249206848415), UINT64_C( 1998930068539418455),
+    UINT64_C( 3999910930977398494), UINT64_C( 3756602669519181256), UINT64_C( 2149586841703268102),
+    UINT64_C( 4571216306225401459), UINT64_C( 2355081365190704690), UINT64_C( 3039045424949433646),
+    UINT64_C(  815339557861336894), UINT64_C(  227478900352406405), UINT64_C( 4078711194629699077),
+    UINT64_C(   91577073640616419), UINT64_C(  909860418682119451), UINT64_C( 2646667923635862844),
+    UINT64_C( 1143277646414196595), UINT64_C( 2504124831756604789), UINT64_C( 3806378037629812858),
+    UINT64_C(  422455585932711613), UINT64_C( 4011206639318364322), UINT64_C( 3767303049631330034),
+    UINT64_C( 1714973566246072847), UINT64_C(  951837685602273587), UINT64_C( 1194050146087674321),
+    UINT64_C( 4361198373031957905), UINT64_C(  374096542192471267), UINT64_C( 2782068024791098103),
+    UINT64_C( 3074367228137011176), UINT64_C( 2693045445757516711), UINT64_C( 2855286666560146297),
+    UINT64_C( 2311044328812702031), UINT64_C(  662817208133894381), UINT64_C( 2790658324551970277),
+    UINT64_C( 3177636041109234538), UINT64_C( 3421402590772699059), UINT64_C( 3772777107457798619),
+    UINT64_C( 3380230071321092720), UINT64_C( 2113905750484627217), UINT64_C( 2314113338605096887),
+    UINT64_C( 2076717367481186119), UINT64_C( 3130611910054394024), UINT64_C( 2555927955177772314),
+    UINT64_C( 4075290060135727634), UINT64_C( 2855986553905650134), UINT64_C( 2130055174569874579),
+    UINT64_C(  221337388949320454), UINT64_C( 3137331983424831448), UINT64_C( 2677113865358018264),
+    UINT64_C(  917767106347122850), UINT64_C( 4379274131439091842), UINT64_C( 2650039870576877314),
+    UINT64_C( 3760257512664605081), UINT64_C( 3192621757906727295), UINT64_C(   39179663933278822),
+    UINT64_C( 4188557252264393533), UINT64_C( 1882532155122659558), UINT64_C( 2739818716393273350),
+    UINT64_C( 1325434424917711727), UINT64_C( 4032405910061558372), UINT64_C(  670613839406553365),
+    UINT64_C( 3238731516458697730), UINT64_C(  149515332033679011), UINT64_C( 4599667394757218363),
+    UINT64_C( 1703918232601684592), UINT64_C( 1080408524873465590), UINT64_C( 3211435911725619387),
+    UINT64_C( 1054869889302671947), UINT64_C( 1715975028264319753), UINT64_C( 1259472439699205719),
+    UINT64_C( 1341459302116072904), UINT64_C( 4164238329753150234), UINT64_C(   33566702744847484),
+    UINT64_C( 1989196431405292570), UINT64_C( 1147912220222128079), UINT64_C( 2285660206135413508),
+    UINT64_C(  965215142387136040), UINT64_C( 3319444757795127450), UINT64_C( 2606572611764032574),
+    UINT64_C(  852211037068804648), UINT64_C( 2546721749340291930), UINT64_C( 1026630944844819891),
+    UINT64_C(  598075776631409432), UINT64_C( 3849125133848782186), UINT64_C( 1168064730618247095),
+    UINT64_C( 4345296442882902226), UINT64_C( 2603744528473540543), UINT64_C( 4419065095398532998),
+    UINT64_C( 1201552842796017050), UINT64_C( 3568635009199287017), UINT64_C( 3433453388827174575),
+    UINT64_C(  148301038139249916), UINT64_C(  862416656256724385), UINT64_C( 4510077268218004698),
+    UINT64_C( 1094221643124879389), UINT64_C( 4242213459080657367), UINT64_C( 3546830041943707563),
+    UINT64_C( 3200568804522965037), UINT64_C( 3866602605534260912), UINT64_C(  948871349287511944),
+    UINT64_C(  403856966757977957), UINT64_C( 2152752723559958248), UINT64_C( 1949768719905821456),
+    UINT64_C(  136373390215084944), UINT64_C( 1332200649532976134), UINT64_C(  863563149462959217),
+    UINT64_C( 1047714861697992076), UINT64_C( 2827971705899309865), UINT64_C( 2076724832703392367),
+    UINT64_C( 4431089328365485760), UINT64_C( 1375802966054179374), UINT64_C( 2683212568171860492),
+    UINT64_C( 2674675901696053107), UINT64_C( 1347992745216536451), UINT64_C( 1176957790168254889),
+    UINT64_C(  325399620555397380), UINT64_C( 4136245280667974704), UINT64_C( 1526090764333307938),
+    UINT64_C( 1970335829541336933), UINT64_C( 4417265390135152588), UINT64_C( 3282085420783612522),
+    UINT64_C( 3411531836054885893), UINT64_C( 2695797990521858834), UINT64_C( 2704587999643481564),
+    UINT64_C( 1945860224303054161), UINT64_C( 1662065421458578424), UINT64_C(  833293648673672716),
+    UINT64_C( 1963474264828722204), UINT64_C( 1394831484044237886), UINT64_C( 4440654410559673386),
+    UINT64_C( 4258332289838069330), UINT64_C( 2242526427000728878), UINT64_C( 3711524335256625093),
+    UINT64_C( 3544541492951389351), UINT64_C(  274203731106482159), UINT64_C( 3905767206816724116),
+    UINT64_C( 1109260512878481449), UINT64_C( 3596294753194806403), UINT64_C(  634961320809158030),
+    UINT64_C( 3158285991797476055), UINT64_C(  118482459082136202), UINT64_C(  616899307531476857),
+    UINT64_C(  873100684948135932), UINT64_C( 3770833297406205830), UINT64_C( 1560554464888407146),
+    UINT64_C( 1909723922513291164), UINT64_C(  587050859749634523), UINT64_C( 3703164249868567847),
+    UINT64_C( 1706992787958047351), UINT64_C( 1752636952096841371), UINT64_C(  382747440821255166),
+    UINT64_C( 3176408655870620574), UINT64_C( 2257270942874979086), UINT64_C( 1525739118153596836),
+    UINT64_C(  446242869280210272), UINT64_C( 2227758388101677489), UINT64_C( 2671716480374518521),
+    UINT64_C( 2759210240781932900), UINT64_C( 2514911577703619888), UINT64_C(  245795262321500761),
+    UINT64_C( 3023176065503780998), UINT64_C( 3432324521406328661), UINT64_C(  391820275509159336),
+    UINT64_C(  941138355702561316), UINT64_C( 3773237609617174901), UINT64_C( 1918963598234886790),
+    UINT64_C( 3164974862775619932), UINT64_C( 2969438617788469682), UINT64_C( 3715127667154260743),
+    UINT64_C(   43498176280327030), UINT64_C(  884049747518637517), UINT64_C( 1130697807662229716),
+    UINT64_C( 1236733868254323171), UINT64_C( 1332499659977739697), UINT64_C( 2149120896432685557),
+    UINT64_C( 1116137456534124309), UINT64_C( 4341338791106497174), UINT64_C(  215836739782176618),
+    UINT64_C(  971699526594947225), UINT64_C( 3012693782859973246), UINT64_C(  252328836061677413),
+    UINT64_C( 3008185247504313968), UINT64_C( 1567157272355509289), UINT64_C( 3477976343162674005),
+    UINT64_C( 1326174256989398648), UINT64_C( 3074939226259532734), UINT64_C( 1590003685570458249),
+    UINT64_C( 3567319800782676099), UINT64_C( 2024936333625551519), UINT64_C( 1941101737470823784),
+    UINT64_C( 1307340882493510057), UINT64_C(  659158362076409898), UINT64_C( 2740861530328939300),
+    UINT64_C( 2152642882031774638), UINT64_C( 3013805020462162360), UINT64_C( 2667763264724062492),
+    UINT64_C( 2056796518513813057), UINT64_C(  944230936208578336), UINT64_C( 3445375357836673984),
+    UINT64_C( 3388780943654266356), UINT64_C( 1580705967498881840), UINT64_C( 1768921393717257698),
+    UINT64_C(  228781392838623303), UINT64_C( 4165243180199011245), UINT64_C( 4058478506736884951),
+    UINT64_C( 3532451834879993206), UINT64_C(  820759535113242062), UINT64_C( 3176125257844582800),
+    UINT64_C( 2972831150869176724), UINT64_C( 3833288769816629775), UINT64_C( 2423160882454976076),
+    UINT64_C( 2489354289483816809), UINT64_C( 1253633946143802966), UINT64_C( 2319454352351859854),
+    UINT64_C(  825979799022832968), UINT64_C(  394122009237459152), UINT64_C( 2622861006496879062),
+    UINT64_C( 4296427601006784265), UINT64_C( 1089896013735647773), UINT64_C( 4587596969398016500),
+    UINT64_C( 2413735531208542578), UINT64_C( 3814836913307232769), UINT64_C( 1949200440659897520),
+    UINT64_C( 1207851041518893927), UINT64_C( 4187199870191532067), UINT64_C( 3612373412516969302),
+    UINT64_C( 4442784309337781883), UINT64_C( 2588637250892476856), UINT64_C( 2593021252443054485),
+    UINT64_C( 3130426611040348248), UINT64_C(  931600669074996385), UINT64_C(  186661968298557587),
+    UINT64_C( 2004307321442094621), UINT64_C( 3182541095927246144), UINT64_C(  249097076437781387),
+    UINT64_C( 3941658190241056843), UINT64_C( 2346836574620738542), UINT64_C(  680435390000479028),
+    UINT64_C( 4094725694376871995), UINT64_C( 3423064617583880965), UINT64_C( 1248848007593860571),
+    UINT64_C( 2245909946950449322), UINT64_C( 1010748010719896876), UINT64_C( 2477474424122429736),
+    UINT64_C( 3298991714055725067), UINT64_C(  431454645802437176), UINT64_C( 2247748865817172736),
+    UINT64_C( 3390056546739510175), UINT64_C( 4374123481502312042), UINT64_C( 3462138060280266266),
+    UINT64_C(  713726358401727519), UINT64_C( 2528992737183389100), UINT64_C( 1497120640069282015),
+    UINT64_C( 2190690713755202296), UINT64_C( 4077564660266709085), UINT64_C( 1666718686719519976),
+    UINT64_C( 2263632101841438492), UINT64_C( 2949398313249000178), UINT64_C(  350075945371266257),
+    UINT64_C( 4180708524090790061), UINT64_C( 1396127598708644910), UINT64_C( 1434262609995858249),
+    UINT64_C( 3062453178749098935), UINT64_C( 1759028863562689036), UINT64_C(  168781636562579322),
+    UINT64_C( 1730001939785785095), UINT64_C(  475688187928366003), UINT64_C( 1900277436561649780),
+    UINT64_C( 4118518930595776961), UINT64_C( 3655903721756727785), UINT64_C( 1058117665801298855),
+    UINT64_C( 1201268251322638392), UINT64_C(  272996469674437841), UINT64_C( 1751166379334185106),
+    UINT64_C( 3126635573232633262), UINT64_C(  239211138602029342), UINT64_C(  862190549868309947),
+    UINT64_C(  372147553187404377), UINT64_C( 4091076540699722500), UINT64_C( 1958380753702295773),
+    UINT64_C( 2645648011339312337), UINT64_C( 3083376795698879316), UINT64_C( 2877198747728599416),
+    UINT64_C( 2060639417006200267), UINT64_C( 3322401606685559879), UINT64_C( 2272712188550673636),
+    UINT64_C( 4568601986466786874), UINT64_C(  816777504338510516), UINT64_C( 4141970507488036965),
+    UINT64_C( 1700934734045612350), UINT64_C( 2647494217823146630), UINT64_C( 1316908742846732207),
+    UINT64_C( 3766004273549211061), UINT64_C( 1454786446236752601), UINT64_C(   34974785662488027),
+    UINT64_C(  968652494005084474), UINT64_C( 4322827535184363171), UINT64_C(  860394549599237712),
+    UINT64_C( 1169860914052429751), UINT64_C( 1221696712228034966), UINT64_C( 4433039326646473629),
+    UINT64_C(  384764086117357185), UINT64_C( 3032798487712341279), UINT64_C(  992645601529370191),
+    UINT64_C( 1898431957572876163), UINT64_C( 4450734388396407385), UINT64_C( 2746888721307914232),
+    UINT64_C( 1965523246498945656), UINT64_C( 1807549475331059371), UINT64_C( 1401853065141039580),
+    UINT64_C( 1403324098157765299), UINT64_C( 1677991880943537051), UINT64_C( 3828370029431073530),
+    UINT64_C( 3945463441744292371), UINT64_C( 2882193242235024311), UINT64_C( 2184530675059800160),
+    UINT64_C( 1803697462677449786), UINT64_C( 4347990998748717174), UINT64_C( 2532157607417281139),
+    UINT64_C(  490632876989470644), UINT64_C(  735405185819063865), UINT64_C( 2206930777549650082),
+    UINT64_C( 2660708112989219115), UINT64_C( 3010029196393805365), UINT64_C( 2176842424672202992),
+    UINT64_C( 4026225937507344168), UINT64_C( 1597557901966833868), UINT64_C( 2104627355934868793),
+    UINT64_C( 3302881862970656308), UINT64_C( 1873808308284674721), UINT64_C( 1844154072813029497),
+    UINT64_C( 3128219822341725564), UINT64_C( 1189916936482401144), UINT64_C( 4079268355083759125),
+    UINT64_C( 3822921429291229113), UINT64_C( 3453143766052791912), UINT64_C( 2949568541409103519),
+    UINT64_C( 2449882680116024925), UINT64_C(  702799952712881972), UINT64_C( 2115170631320436774),
+    UINT64_C(  557835281282632842), UINT64_C( 2980098642393523917), UINT64_C( 3529126913340401950),
+    UINT64_C(  385174176920996094), UINT64_C( 1276068820916019130), UINT64_C( 3638223050393651803),
+    UINT64_C( 4169983271857150671), UINT64_C(  599758793116275692), UINT64_C(   54515702542016258),
+    UINT64_C( 1327710652854465075), UINT64_C( 3823662663412303946), UINT64_C( 2995816676652764072),
+    UINT64_C(  815339541074482510), UINT64_C( 2776231343392438510), UINT64_C( 1092660152901375620),
+    UINT64_C( 3543737289884766318), UINT64_C( 4216101688465932858), UINT64_C( 3047472710248017705),
+    UINT64_C( 1765950917334878402), UINT64_C( 3980538051105548988), UINT64_C( 4240251407067497206),
+    UINT64_C( 1911859973724757005), UINT64_C( 1243577463231095139), UINT64_C( 3426903282673619733),
+    UINT64_C( 1392423128602262523), UINT64_C( 3767285881519829127), UINT64_C( 1617287739221576557),
+    UINT64_C( 3531782522199947176), UINT64_C( 1192115643641509875), UINT64_C(  246228280715775013),
+    UINT64_C( 2813862723350544512), UINT64_C(  503595156700528894), UINT64_C( 2819351651856466013),
+    UINT64_C( 4291139511860248276), UINT64_C( 4225330913391276000), UINT64_C( 3226420013894250247),
+    UINT64_C( 4464193687187128110), UINT64_C( 1246209948053630691), UINT64_C(   42169995206747730),
+    UINT64_C( 3842396488338218481), UINT64_C( 1384305272460733251), UINT64_C(  825580024146202702),
+    UINT64_C( 4305522077268590917), UINT64_C( 3746248786150209040), UINT64_C( 4226956779197288805),
+    UINT64_C( 4112461257543313076), UINT64_C( 3566059908937877547), UINT64_C( 3609969043888843555),
+    UINT64_C( 3006733096119805528), UINT64_C( 3625442395411166294), UINT64_C( 3411124801700104943),
+    UINT64_C( 1575738709894309424), UINT64_C( 3785088045242173191), UINT64_C( 1448816717339146608),
+    UINT64_C( 2877382269739163008), UINT64_C(  727669245414030066), UINT64_C( 2036977207556293529),
+    UINT64_C( 2458424779061900035), UINT64_C( 4226366259196079908), UINT64_C( 2737286790144082737),
+    UINT64_C( 1418127168760333604), UINT64_C( 3650977639129954942), UINT64_C(   45596943036274438),
+    UINT64_C( 1293444120417512875), UINT64_C( 3499416812384884694), UINT64_C( 3635826828846081536),
+    UINT64_C( 1694704647176136186), UINT64_C( 1199242004652493452), UINT64_C( 4570181471136642350),
+    UINT64_C( 3307146518467912459), UINT64_C( 1498219133880103418), UINT64_C(  752530491152740905),
+    UINT64_C( 1520222316180986188), UINT64_C(  671273732508892215), UINT64_C( 1989852086300487802),
+    UINT64_C( 4180873232404587736), UINT64_C(  212843602358957403), UINT64_C( 1249422325206501283),
+    UINT64_C( 2208991151651104984), UINT64_C( 2571010391112713365), UINT64_C(  230700589296789587),
+    UINT64_C( 2307595643032871881), UINT64_C( 3550324716899739004), UINT64_C( 2983438929972153142),
+    UINT64_C( 2503366903104803834), UINT64_C(  497166214292531837), UINT64_C( 3775492388996626496),
+    UINT64_C( 2113349473968755718), UINT64_C( 2615556948830550627), UINT64_C( 1368226635850051025),
+    UINT64_C( 2951145627611722309), UINT64_C(  831222894532782154), UINT64_C(  217808072480195991),
+    UINT64_C(  151362246148876428), UINT64_C( 2078657389123622636), UINT64_C( 4602536922133389783),
+    UINT64_C( 3700605706827495622), UINT64_C( 1679249766293090876), UINT64_C( 4561085070764682260),
+    UINT64_C(    4964611731942332), UINT64_C( 3288742912400052052), UINT64_C( 2652217183577594373),
+    UINT64_C( 1925479339905119127), UINT64_C( 2094302291159446394), UINT64_C( 2033399344393350136),
+    UINT64_C( 2318906688926758289), UINT64_C( 4149113920068125530), UINT64_C( 3671024317395357169),
+    UINT64_C( 2603778442885774766), UINT64_C( 1271588955578697323), UINT64_C( 2166006272748780258),
+    UINT64_C( 2167054002479545318), UINT64_C( 1913830401887898970), UINT64_C( 2620010272922602505),
+    UINT64_C( 4606225322442716763), UINT64_C( 2970659785381998629), UINT64_C( 1545022295717752879),
+    UINT64_C( 4237850827817317304), UINT64_C( 2531035200339430472), UINT64_C(  871521563628463438),
+    UINT64_C( 1067625556365346557), UINT64_C( 1190945421853044167), UINT64_C( 3460220740267405794),
+    UINT64_C( 3809453032867530819), UINT64_C( 4137518206130252106), UINT64_C( 1329859698495909082),
+    UINT64_C( 1304231786140819591), UINT64_C(  169577997673289935), UINT64_C( 1831128040256861096),
+    UINT64_C( 2395485110289596940), UINT64_C( 1010696619403697981), UINT64_C(  407345971671144805),
+    UINT64_C( 1706843611300425376), UINT64_C( 3088959789260472811), UINT64_C( 3844870276700140793),
+    UINT64_C(  984208868880450840), UINT64_C( 4309864523603029452), UINT64_C( 2573359837614629330),
+    UINT64_C( 1600253652350275203), UINT64_C( 4020279134702216685), UINT64_C( 2186189567850323785),
+    UINT64_C( 2247306629555485957), UINT64_C( 4175206600912485437), UINT64_C( 3901432672747996329),
+    UINT64_C( 1558526833427086334), UINT64_C(  253718201936970421), UINT64_C( 2996747514524656707),
+    UINT64_C( 4179613853364838554), UINT64_C( 4366863669826035361), UINT64_C(  342652930451379043),
+    UINT64_C(  354392422550437813), UINT64_C( 1453033633133911163), UINT64_C(  643735587549238978),
+    UINT64_C(  593745956433548754), UINT64_C( 2859556089489554455), UINT64_C( 2160298597876588656),
+    UINT64_C( 1582203109801068183), UINT64_C( 4388384793243359400), UINT64_C( 1494428021588652391),
+    UINT64_C( 4356278581424899903), UINT64_C(   71548500182249812), UINT64_C(  683459050868962339),
+    UINT64_C(  931981666759431764), UINT64_C( 1826671501024704858), UINT64_C( 2782366468330420434),
+    UINT64_C( 2233162155031490265), UINT64_C( 1492255783815342883), UINT64_C(  113162167217708611),
+    UINT64_C( 2652972949438662219), UINT64_C( 4547824722148752623), UINT64_C(  532757332565416786),
+    UINT64_C( 3068660820575792570), UINT64_C( 3087721576678021099), UINT64_C( 4304741654498181829),
+    UINT64_C( 4472975821100138570), UINT64_C( 1965104023502114530), UINT64_C( 2730634675924625423),
+    UINT64_C( 3896605310063615129), UINT64_C( 3380129020415301258), UINT64_C( 3489700936275198882),
+    UINT64_C( 4499721550841943276), UINT64_C(  529392469856857497), UINT64_C( 1034032701223123308),
+    UINT64_C( 1131617569223249116), UINT64_C(  271793616396330245), UINT64_C( 1412449954321953734),
+    UINT64_C(  907621549433670034), UINT64_C( 3235447138254638354), UINT64_C(  853234655074503930),
+    UINT64_C( 2043761539864789458), UINT64_C( 3493421620535245447), UINT64_C( 3231867182691792255),
+    UINT64_C( 4408490915235116923), UINT64_C(  692509442360760623), UINT64_C(   99986949041788687),
+    UINT64_C( 2249454738082045042), UINT64_C( 4558826194524541702), UINT64_C( 3150798292341972439),
+    UINT64_C( 1964453039327487778), UINT64_C( 1950483174694297521), UINT64_C(   59254693612618046),
+    UINT64_C( 3625132783879919521), UINT64_C(  110076051268438953), UINT64_C( 4447721220595616336),
+    UINT64_C( 4402868355256845214), UINT64_C(  114618258613977869), UINT64_C( 4473300855701675558),
+    UINT64_C(  429482121608255700), UINT64_C(  733291160847924508), UINT64_C( 4264497579730477388),
+    UINT64_C( 1774041430773760447), UINT64_C( 2810925820372159003), UINT64_C( 3452622203326878713),
+    UINT64_C(  181193398383711769), UINT64_C( 1614347878370197432), UINT64_C(  400167045138119645),
+    UINT64_C(  184661422935381063), UINT64_C( 2185414560046952890), UINT64_C( 3996129711869043781),
+    UINT64_C( 3326068196341063012), UINT64_C( 2057761141777647938), UINT64_C( 4539012072380239689),
+    UINT64_C( 4131071649324085474), UINT64_C( 4013335593095464379), UINT64_C( 2584028566706894626),
+    UINT64_C( 4551851136976808054), UINT64_C(  884372905409944133), UINT64_C( 1872511368460204767),
+    UINT64_C( 2503948043927504072), UINT64_C( 3229888848286717175), UINT64_C(  677431690349121116),
+    UINT64_C( 3157919679833609437), UINT64_C( 1704456355358804679), UINT64_C( 3611806026394192620),
+    UINT64_C( 3385722159572006837), UINT64_C(  572814837965461641), UINT64_C(  212256636943784471),
+    UINT64_C(  641141738379078895), UINT64_C( 1329737422767507410), UINT64_C(  340330572738596295),
+    UINT64_C(  898955180731218391), UINT64_C( 2934480145062236671), UINT64_C(  381791463439507864),
+    UINT64_C( 2293693802758870850), UINT64_C( 2944484250771258041), UINT64_C( 2101852436079763519),
+    UINT64_C( 2752257874530673445), UINT64_C( 4399177167519189819), UINT64_C( 3091432344924917356),
+    UINT64_C( 2755447623222366977), UINT64_C( 3142039751216262769), UINT64_C( 2708839056406499059),
+    UINT64_C(  334589299196293873), UINT64_C( 4497551257745336091), UINT64_C( 3593560297000103972),
+    UINT64_C(  416151279386024994), UINT64_C( 1079954072440614405), UINT64_C(   16194246065783413),
+    UINT64_C( 1927608302277253230), UINT64_C(  775158553988264051), UINT64_C( 3047583328285715460),
+    UINT64_C( 3646854152399938093), UINT64_C(  385095146631518952), UINT64_C( 4266766391389246121),
+    UINT64_C( 1935213329387272097), UINT64_C( 2826569585547945684), UINT64_C( 3949390773892731670),
+    UINT64_C( 1165572964096633761), UINT64_C(  180476687117825377), UINT64_C(  335160454830513330),
+    UINT64_C( 2342197946653383287), UINT64_C( 3874513145339803475), UINT64_C(  408824448322083241),
+    UINT64_C( 1004423963674498522), UINT64_C( 1967508600844749522), UINT64_C( 1646009933752572455),
+    UINT64_C( 2147317314353617437), UINT64_C( 1077791176942171105), UINT64_C( 2641087902835469265),
+    UINT64_C( 1836935067446436300), UINT64_C( 1661431282663916411), UINT64_C( 1210522136937104989),
+    UINT64_C(  911396202752929103), UINT64_C( 1734905815213587801), UINT64_C(  542681665367859725),
+    UINT64_C( 1886877354392665513), UINT64_C( 1370532115538143802), UINT64_C( 1028212762175197544),
+    UINT64_C( 2155258224763571252), UINT64_C( 1944360069273966440), UINT64_C( 4057421086900703854),
+    UINT64_C(  519020659975520703), UINT64_C( 4382754540708504359), UINT64_C( 2956540129622718510),
+    UINT64_C( 4507593199100953344), UINT64_C( 2444674358947096573), UINT64_C( 2466789722673893493),
+    UINT64_C(  849444288623690994), UINT64_C( 3386410116306409610), UINT64_C( 1112872476347818202),
+    UINT64_C( 2139696874651197834), UINT64_C(  744254325435392939), UINT64_C( 3950454224893445592),
+    UINT64_C( 3452357891355693655), UINT64_C( 3052632562617756609), UINT64_C( 1445113864846962977),
+    UINT64_C( 1934672294279646292), UINT64_C( 1445473202912644188), UINT64_C( 2924187081169183311),
+    UINT64_C( 4357759459478468295), UINT64_C(  153249309875818681), UINT64_C(  182715427465524683),
+    UINT64_C( 3100330975091837527), UINT64_C(  154194405264775289), UINT64_C( 3800365254245882691),
+    UINT64_C( 3022332016082733076), UINT64_C( 1750920287310736952), UINT64_C( 1277880011633825448),
+    UINT64_C( 2207173905610862281), UINT64_C( 4339174138594031227), UINT64_C(  259872569626152944),
+    UINT64_C( 2376004026159433240), UINT64_C( 3121317892150819733), UINT64_C( 2600167103348438174),
+    UINT64_C( 1252874835868275253), UINT64_C( 3385685390603664836), UINT64_C( 3125167414488617649),
+    UINT64_C( 3405082625942677053), UINT64_C(  706078915087918005), UINT64_C( 2814108067971608583),
+    UINT64_C(  241737317033935591), UINT64_C(  383929728386811223), UINT64_C( 2998311632544291773),
+    UINT64_C(  876979687558343346), UINT64_C( 3379551600397836507), UINT64_C( 1330054827485632870),
+    UINT64_C( 4197727811612784098), UINT64_C( 3406851801662913233), UINT64_C( 3547799135757222632),
+    UINT64_C(  498067674319070174), UINT64_C( 2992784692455856042), UINT64_C( 2558602688024182306),
+    UINT64_C( 1791114300372757080), UINT64_C( 4544289512878958411), UINT64_C( 1866506490314710266),
+    UINT64_C(  684969807807873412), UINT64_C( 1763130056360547544), UINT64_C(  580143321090097711),
+    UINT64_C( 4574451101709081521), UINT64_C( 3731706478238469783), UINT64_C( 4142537685361214451),
+    UINT64_C(  704976043800299087), UINT64_C( 4057064568877021034), UINT64_C( 1740198377390011011),
+    UINT64_C( 1586102518324885704), UINT64_C( 2862549988648290898), UINT64_C( 4499883447687415456),
+    UINT64_C( 4427912954470766578), UINT64_C(  993451894060867211), UINT64_C( 2081749430483223422),
+    UINT64_C( 2912432486835536764), UINT64_C( 4179077244474564270), UINT64_C(  432228123307332970),
+    UINT64_C( 1333031746366920303), UINT64_C( 2921411301288124342), UINT64_C( 2142451834330999064),
+    UINT64_C( 1084622296531935708), UINT64_C( 1109012548851515152), UINT64_C( 3123148373128020491),
+    UINT64_C( 1243944439493008786), UINT64_C( 2525190293680812506), UINT64_C( 1682746118388812088),
+    UINT64_C( 2804772889031304016), UINT64_C( 3321731333565242674), UINT64_C( 1440557099674139409),
+    UINT64_C( 4393360555918632596), UINT64_C( 1892746059708459825), UINT64_C(  522455869231011459),
+    UINT64_C( 3735004264120280504), UINT64_C( 4495613528060084842), UINT64_C(  122415733363573670),
+    UINT64_C( 3670438116544012294), UINT64_C( 4308291936313081181), UINT64_C( 3151278093862212603),
+    UINT64_C( 1907781041784909567), UINT64_C(  872217491620368183), UINT64_C( 2773721458082683797),
+    UINT64_C(  613598361526814416), UINT64_C( 1987513765296589292), UINT64_C( 1186574524583112794),
+    UINT64_C( 2488063427052673236), UINT64_C( 3109772676377937237), UINT64_C( 2512805343906020732),
+    UINT64_C(  786498219357994046), UINT64_C( 1625754518641285422), UINT64_C( 2590300757332155673),
+    UINT64_C( 2625597020350644333), UINT64_C(  303810191988057634), UINT64_C( 2262587358309957147),
+    UINT64_C(  619575565396955594), UINT64_C(  358454089632871517), UINT64_C( 4375288337984506995),
+    UINT64_C( 2442546849765131766), UINT64_C(  952708488520716803), UINT64_C(  717329575317965537),
+    UINT64_C(  853645549387845668), UINT64_C(  855790585451957429), UINT64_C( 4445120578688661256),
+    UINT64_C( 1995300760173305337), UINT64_C( 3329944074655835048), UINT64_C(  195491508254783101),
+    UINT64_C( 2978623517325847417), UINT64_C( 1520034260820376911), UINT64_C( 2846496876896938744),
+    UINT64_C( 1824990054438934823), UINT64_C( 1297540669060361008), UINT64_C( 2776337967089015661),
+    UINT64_C( 3974496377651384458), UINT64_C( 4384322563243272048), UINT64_C( 4255103415331801903),
+    UINT64_C(  466772227302088356), UINT64_C(  715241935577380506), UINT64_C(   86220133451958920),
+    UINT64_C( 4291681367827046331), UINT64_C(  166567500094310237), UINT64_C( 3359394524955999935),
+    UINT64_C( 1359863702893550801), UINT64_C( 3756860103452495201), UINT64_C(  917363666106282386),
+    UINT64_C( 3412716797378521064), UINT64_C(  995038490433543748), UINT64_C(  893396870022184297),
+    UINT64_C( 2804819727059916784), UINT64_C( 3080031221434722748), UINT64_C(   26037502219086754),
+    UINT64_C( 1432489590279471172), UINT64_C(  720461786352783206), UINT64_C( 4031835884327575978),
+    UINT64_C( 3971830630396817860), UINT64_C( 2274257007005654794), UINT64_C( 4363201659409767333),
+    UINT64_C(   18716882672390587), UINT64_C( 3225244835008521798), UINT64_C( 4059386831574587789),
+    UINT64_C( 2333652662328471954), UINT64_C( 2200105238319094438), UINT64_C( 1003324160194276486),
+    UINT64_C( 1812824557283353558), UINT64_C(  749735382411802034), UINT64_C( 4034534642502927646),
+    UINT64_C( 2738618124606823841), UINT64_C( 1167316565274006618), UINT64_C( 2065408035439489879),
+    UINT64_C(  939542398058304700), UINT64_C( 3333919520140408228), UINT64_C(  632100006210175361),
+    UINT64_C( 1708819861941290585), UINT64_C(   72057594037928287), UINT64_C(10328668141566491217),
+    UINT64_C( 6256868756854700359), UINT64_C(12268614707821583145), UINT64_C( 8624754810238177349),
+    UINT64_C( 6661861715340146757), UINT64_C( 8691910331082960817), UINT64_C( 7227718721495219613),
+    UINT64_C( 8634178545798674211), UINT64_C( 5172442824433958178), UINT64_C( 8418013293906514484),
+    UINT64_C( 4830177297979325770), UINT64_C( 7036532161074581591), UINT64_C(14247825373425467461),
+    UINT64_C( 7120248857983319616), UINT64_C(17468160492389413475), UINT64_C( 5154941290456431168),
+    UINT64_C(15267313344254920009), UINT64_C(18235017873694623249), UINT64_C(  649376214742223028),
+    UINT64_C(11303192335408036357), UINT64_C(11390566975070344772), UINT64_C(  425659696582975023),
+    UINT64_C(  684791424618091533), UINT64_C(12051174171550472495), UINT64_C( 9725698052791858427),
+    UINT64_C( 3548155621761758035), UINT64_C( 8734594624175118574), UINT64_C(14392586978845444244),
+    UINT64_C( 5382030930708638813), UINT64_C(10899389382595541100), UINT64_C( 5296398521783676687),
+    UINT64_C( 7755529955693092359), UINT64_C(10599565932075270364), UINT64_C( 3249220279973781023),
+    UINT64_C(  803898156548435722), UINT64_C(11500183825032328559), UINT64_C(13488993578766135610),
+    UINT64_C( 3506612735725314016), UINT64_C( 2468219403805740700), UINT64_C(11688062363326992569),
+    UINT64_C(18013179622757115130), UINT64_C(10527748927142218081), UINT64_C(16383938338602337827),
+    UINT64_C(17437061690006696303), UINT64_C( 3813172510037884070), UINT64_C( 6264269879115480911),
+    UINT64_C(11030479609737259201), UINT64_C(10860247152129497569), UINT64_C( 5017772667484388706),
+    UINT64_C(17175778291411408583), UINT64_C( 6270095850784444571), UINT64_C( 4704298117315686367),
+    UINT64_C(12535381600950566208), UINT64_C( 1162307548783091345), UINT64_C(17224946702932456295),
+    UINT64_C( 4231693197938599954), UINT64_C( 9259921425468611620), UINT64_C(10699225343561025535),
+    UINT64_C(11128488975944780948), UINT64_C( 9050197104564452924), UINT64_C( 5973664000886006687),
+    UINT64_C( 8475215969467059047), UINT64_C( 4974645964214530971), UINT64_C( 9936504532118313341),
+    UINT64_C(14532331719361105871), UINT64_C( 1172078653051093781), UINT64_C( 7870075824191480099),
+    UINT64_C( 1977289882004952162), UINT64_C(14002931751147596417), UINT64_C(16621396730843244287),
+    UINT64_C(15720657327332494067), UINT64_C( 5343551120584537713), UINT64_C(15983285855491502086),
+    UINT64_C( 1469125408042387680), UINT64_C(14642414025800632516), UINT64_C(12639294608915921775),
+    UINT64_C(16493360813669364106), UINT64_C(15900727458827478607), UINT64_C(  374564426911483289),
+    UINT64_C( 7322768335873094061), UINT64_C(10198986586506372463), UINT64_C(15966118536685155674),
+    UINT64_C(12337560377956110366), UINT64_C( 1421185136008550654), UINT64_C(17027927295263596225),
+    UINT64_C(11191301496859895778), UINT64_C(15929191913653325518), UINT64_C( 4940710338530074738),
+    UINT64_C( 1444196946567375474), UINT64_C(  896046025409242724), UINT64_C(17320964618236935116),
+    UINT64_C(17130036641139120964), UINT64_C( 2562234433957370675), UINT64_C( 1956582591705221577),
+    UINT64_C( 7777223608425035965), UINT64_C( 4374390053125599711), UINT64_C( 9795810143144648422),
+    UINT64_C( 2907558088970352854), UINT64_C( 5830243279234273315), UINT64_C( 3863611593323225148),
+    UINT64_C(12751419955696954603), UINT64_C(12730266031366557392), UINT64_C( 2133590074147019994),
+    UINT64_C( 3703672312868072511), UINT64_C( 7253748466979028728), UINT64_C( 9691375488564157780),
+    UINT64_C( 4714048078570081267), UINT64_C( 7146368121801849224), UINT64_C( 9368109423836916017),
+    UINT64_C(11906896144048880746), UINT64_C(17067128362749356184), UINT64_C( 8865958500203566500),
+    UINT64_C( 1045251825613821429), UINT64_C(17588803815770528421), UINT64_C(13421357157628617344),
+    UINT64_C(16783987148580246149), UINT64_C(  163241822112649345), UINT64_C( 9729388033615790777),
+    UINT64_C(10708020230645898734), UINT64_C( 8874897885208985567), UINT64_C(  885649769532322162),
+    UINT64_C(14820596109541368743), UINT64_C(11084838735645085014), UINT64_C( 8516610877681965881),
+    UINT64_C( 5065852748853784977), UINT64_C( 7557372826774882019), UINT64_C(14766883812919679712),
+    UINT64_C(  673248330832145396), UINT64_C(10973322213482056214), UINT64_C(14516530006752202237),
+    UINT64_C(14451964259227010238), UINT64_C( 1603766319503071002), UINT64_C(10501872997514790091),
+    UINT64_C(14170791279749709864), UINT64_C( 6189001348621852683), UINT64_C( 2145663686275742993),
+    UINT64_C(10626066309474903597), UINT64_C(16723759633312401839), UINT64_C( 6371257627092043818),
+    UINT64_C(11304877952405190389), UINT64_C( 8645190708914198845), UINT64_C( 4489586286055024386),
+    UINT64_C(16483401932860063929), UINT64_C( 3441417153905937554), UINT64_C( 3945623921527009745),
+    UINT64_C( 2136461799681975220), UINT64_C( 1470547805288298463), UINT64_C(14027715256217855598),
+    UINT64_C(13212613716451136996), UINT64_C(13718639383253747528), UINT64_C(18134852426495094260),
+    UINT64_C(16512470249522410051), UINT64_C(17822980094743576721), UINT64_C( 5450788143272665841),
+    UINT64_C( 6566351221972959059), UINT64_C( 8185943623895273242), UINT64_C(16510696453842524018),
+    UINT64_C(  500090983579170838), UINT64_C( 3522548907165380490), UINT64_C(17150646975036352740),
+    UINT64_C(11203021109700261324), UINT64_C(15866790853987145105), UINT64_C( 1654102770114781511),
+    UINT64_C(17828143439090001638), UINT64_C( 9001948052060916300), UINT64_C(10073489646405254102),
+    UINT64_C( 5660874787293091620), UINT64_C(14648609725150791203), UINT64_C( 7460556032500895419),
+    UINT64_C( 6058311022451063641), UINT64_C(16250889020138123053), UINT64_C(10685564514555536708),
+    UINT64_C(12489438999351274591), UINT64_C(  430044061859266996), UINT64_C( 7033247369726901895),
+    UINT64_C( 7681052031282939584), UINT64_C( 5176945066255660088), UINT64_C(10167581228104671046),
+    UINT64_C( 6479013523882207876), UINT64_C(17894584680232771946), UINT64_C(  133564515478730476),
+    UINT64_C(14333250980277311598), UINT64_C(10841367589035051969), UINT64_C(10155442271980015170),
+    UINT64_C(11959348300931816370), UINT64_C( 6452346354945144546), UINT64_C(17133266169917738071),
+    UINT64_C(11319447790063108696), UINT64_C( 6067571166941778886), UINT64_C( 4209479343030882006),
+    UINT64_C(17849221662294364761), UINT64_C(16216706500967836222), UINT64_C(14758005210862680713),
+    UINT64_C( 1302113453762693052), UINT64_C(12100405377481938215), UINT64_C(14634236064962383488),
+    UINT64_C( 3905921818836031611), UINT64_C(11590479225173836272), UINT64_C( 4360872068278716737),
+    UINT64_C(13301882948785821148), UINT64_C(11396988164317300319), UINT64_C( 3432655137782761315),
+    UINT64_C(17123158713791064862), UINT64_C(16878671791822644360), UINT64_C( 5872561317696008422),
+    UINT64_C( 5978228303437979314), UINT64_C(10024088608439485601), UINT64_C( 4348415550887401268),
+    UINT64_C(18426941489305024855), UINT64_C(15500741196691531449), UINT64_C( 9552671756258033730),
+    UINT64_C( 7004284697176481370), UINT64_C( 5936499720456529694), UINT64_C( 1071235644007148508),
+    UINT64_C(13821811164628080596), UINT64_C( 3457436830886482108), UINT64_C( 8557845583357967459),
+    UINT64_C(10101922552285836717), UINT64_C( 7395350511827425048), UINT64_C( 9722883680476637657),
+    UINT64_C(18351055161741838624), UINT64_C(16691883048417265439), UINT64_C(14168259373498009696),
+    UINT64_C( 9306231053352327074), UINT64_C( 7970905056952213335), UINT64_C(10203849179366741395),
+    UINT64_C( 8524881234315559318), UINT64_C(13754542626934877919), UINT64_C(11728588996827450951),
+    UINT64_C( 7995720274157712877), UINT64_C(15999643723909672130), UINT64_C(15026410678076798424),
+    UINT64_C( 8598347366813114408), UINT64_C(18284865224901695153), UINT64_C( 9420325460762864776),
+    UINT64_C(12156181699797793964), UINT64_C( 3261358231445363506), UINT64_C(  909915601409630064),
+    UINT64_C(16314844778518876002), UINT64_C(  366308294562467465), UINT64_C( 3639441674728495581),
+    UINT64_C(10586671694543503089), UINT64_C( 4573110585656808718), UINT64_C(10016499327026468084),
+    UINT64_C(15225512150519325805), UINT64_C( 1689822343730854706), UINT64_C(16044826557273535663),
+    UINT64_C(15069212198525393745), UINT64_C( 6859894264984324896), UINT64_C( 3807350742409112946),
+    UINT64_C( 4776200584350720614), UINT64_C(17444793492127916833), UINT64_C( 1496386168769892377),
+    UINT64_C(11128272099164446770), UINT64_C(12297468912548104774), UINT64_C(10772181783030119463),
+    UINT64_C(11421146666240640977), UINT64_C( 9244177315250853279), UINT64_C( 2651268832535590474),
+    UINT64_C(11162633298207935634), UINT64_C(12710544164437000240), UINT64_C(13685610363090863086),
+    UINT64_C(15091108429831268192), UINT64_C(13520920285284436926), UINT64_C( 8455623001938550171),
+    UINT64_C( 9256453354420432763), UINT64_C( 8306869469924785053), UINT64_C(12522447640217637265),
+    UINT64_C(10223711820711139196), UINT64_C(16301160240542990163), UINT64_C(11423946215622656339),
+    UINT64_C( 8520220698279539935), UINT64_C(  885349555797286140), UINT64_C(12549327933699387092),
+    UINT64_C(10708455461432125364), UINT64_C( 3671068425388509332), UINT64_C(17517096525756452934),
+    UINT64_C(10600159482307561035), UINT64_C(15041030050658493795), UINT64_C(12770487031626971560),
+    UINT64_C(  156718655733116053), UINT64_C(16754229009057655972), UINT64_C( 7530128620490675014),
+    UINT64_C(10959274865573146933), UINT64_C( 5301737699670872805), UINT64_C(16129623640246312277),
+    UINT64_C( 2682455357626226563), UINT64_C(12954926065834854201), UINT64_C(  598061328134718965),
+    UINT64_C(18398669579028963325), UINT64_C( 6815672930406771660), UINT64_C( 4321634099493883470),
+    UINT64_C(12845743646902540296), UINT64_C( 4219479557210708399), UINT64_C( 6863900113057312540),
+    UINT64_C( 5037889758796847484), UINT64_C( 5365837208464317826), UINT64_C(16656953319012682301),
+    UINT64_C(  134266810979390591), UINT64_C( 7956785725621209147), UINT64_C( 4591648880888534745),
+    UINT64_C( 9142640824541698691), UINT64_C( 3860860569548563019), UINT64_C(13277779031180574658),
+    UINT64_C(10426290447056181225), UINT64_C( 3408844148275235243), UINT64_C(10186886997361217480),
+    UINT64_C( 4106523779379299623), UINT64_C( 2392303106525649413), UINT64_C(15396500535395203952),
+    UINT64_C( 4672258922473011202), UINT64_C(17381185771531693806), UINT64_C(10414978113894213046),
+    UINT64_C(17676260381594218336), UINT64_C( 4806211371184091677), UINT64_C(14274540036797217795),
+    UINT64_C(13733813555308765386), UINT64_C(  593204152557002561), UINT64_C( 3449666625026914390),
+    UINT64_C(18040309072872106914), UINT64_C( 4376886572499538936), UINT64_C(16968853836322712356),
+    UINT64_C(14187320167774899553), UINT64_C(12802275218091922684), UINT64_C(15466410422137119197),
+    UINT64_C( 3795485397150066316), UINT64_C( 1615427867031919718), UINT64_C( 8611010894239875054),
+    UINT64_C( 7799074879623323920), UINT64_C(  545493560860342440), UINT64_C( 5328802598131930565),
+    UINT64_C( 3454252597851853741), UINT64_C( 4190859446791988775), UINT64_C(11311886823597294715),
+    UINT64_C( 8306899330813610045), UINT64_C(17724357313462029619), UINT64_C( 5503211864216744377),
+    UINT64_C(10732850272687494395), UINT64_C(10698703606784264688), UINT64_C( 5391970980866172142),
+    UINT64_C( 4707831160673042552), UINT64_C( 1301598482221595878), UINT64_C(16544981122671979634),
+    UINT64_C( 6104363057333261570), UINT64_C( 7881343318165386230), UINT64_C(17669061560540696661),
+    UINT64_C(13128341683134514216), UINT64_C(13646127344219610230), UINT64_C(10783191962087488009),
+    UINT64_C(10818351998573979101), UINT64_C( 7783440897212254664), UINT64_C( 6648261685834346171),
+    UINT64_C( 3333174594694707145), UINT64_C( 7853897059314927180), UINT64_C( 5579325936176978797),
+    UINT64_C(17762617642238780310), UINT64_C(17033329159352360523), UINT64_C( 8970105708002959328),
+    UINT64_C(14846097341026572891), UINT64_C(14178165971805626661), UINT64_C( 1096814924425933993),
+    UINT64_C(15623068827266972779), UINT64_C( 4437042051513947469), UINT64_C(14385179012779295880),
+    UINT64_C( 2539845283236644526), UINT64_C(12633143967189965929), UINT64_C(  473929836328547123),
+    UINT64_C( 2467597230125919481), UINT64_C( 3492402739792560787), UINT64_C(15083333189624896998),
+    UINT64_C( 6242217859553659075), UINT64_C( 7638895690053201970), UINT64_C( 2348203438998549562),
+    UINT64_C(14812656999474343744), UINT64_C( 6827971151832222757), UINT64_C( 7010547808387399728),
+    UINT64_C( 1530989763285028142), UINT64_C(12705634623482544360), UINT64_C( 9029083771499960448),
+    UINT64_C( 6102956472614417155), UINT64_C( 1784971477120849807), UINT64_C( 8911033552406753484),
+    UINT64_C(10686865921498126286), UINT64_C(11036840963127785512), UINT64_C(10059646310814528691),
+    UINT64_C(  983181049286007846), UINT64_C(12092704262015183062), UINT64_C(13729298085625381708),
+    UINT64_C( 1567281102036644999), UINT64_C( 3764553422810263652), UINT64_C(15092950438468773329),
+    UINT64_C( 7675854392939584654), UINT64_C(12659899451102541568), UINT64_C(11877754471153936748),
+    UINT64_C(14860510668617115562), UINT64_C(  173992705121308969), UINT64_C( 3536198990074567341),
+    UINT64_C( 4522791230648940956), UINT64_C( 4946935473017316848), UINT64_C( 5329998639910984823),
+    UINT64_C( 8596483585730784219), UINT64_C( 4464549826136519044), UINT64_C(17365355164426073521),
+    UINT64_C(  863346959128710689), UINT64_C( 3886798106379807886), UINT64_C(12050775131439951849),
+    UINT64_C( 1009315344246714582), UINT64_C(12032740990017314649), UINT64_C( 6268629089422067776),
+    UINT64_C(13911905372650763976), UINT64_C( 5304697027957620504), UINT64_C(12299756905038191017),
+    UINT64_C( 6360014742281864063), UINT64_C(14269279203130774098), UINT64_C( 8099745334502245641),
+    UINT64_C( 7764406949883333063), UINT64_C( 5229363529974065772), UINT64_C( 2636633448305652471),
+    UINT64_C(10963446121315810753), UINT64_C( 8610571528127140612), UINT64_C(12055220081848708326),
+    UINT64_C(10671053058896302093), UINT64_C( 8227186074055292415), UINT64_C( 3776923744834331793),
+    UINT64_C(13781501431346763255), UINT64_C(13555123774617131637), UINT64_C( 6322823869995558245),
+    UINT64_C( 7075685574869065355), UINT64_C(  915125571354497682), UINT64_C(16660972720796126364),
+    UINT64_C(16233914026947619102), UINT64_C(14129807339520041844), UINT64_C( 3283038140452984284),
+    UINT64_C(12704501031378393258), UINT64_C(11891324603476764982), UINT64_C(15333155079266593998),
+    UINT64_C( 9692643529819951650), UINT64_C( 9957417157935315875), UINT64_C( 5014535784575236358),
+    UINT64_C( 9277817409407484735), UINT64_C( 3303919196091348010), UINT64_C( 1576488036949844308),
+    UINT64_C(10491444025987567496), UINT64_C(17185710404027221008), UINT64_C( 4359584054942612387),
+    UINT64_C(18350387877592155637), UINT64_C( 9654942124834217474), UINT64_C(15259347653229005614),
+    UINT64_C( 7796801762639628165), UINT64_C( 4831404166075599308), UINT64_C(16748799480766210081),
+    UINT64_C(14449493650067947790), UINT64_C(17771137237351214339), UINT64_C(10354549003569958003),
+    UINT64_C(10372085009772268605), UINT64_C(12521706444161454157), UINT64_C( 3726402676300003742),
+    UINT64_C(  746647873194233995), UINT64_C( 8017229285768417646), UINT64_C(12730164383709046759),
+    UINT64_C(  996388305751130415), UINT64_C(15766632760964304388), UINT64_C( 9387346298483000022),
+    UINT64_C( 2721741560001929407), UINT64_C(16378902777507567987), UINT64_C(13692258470335590743),
+    UINT64_C( 4995392030375466685), UINT64_C( 8983639787801841170), UINT64_C( 4042992042879607253),
+    UINT64_C( 9909897696489767351), UINT64_C(13195966856222964727), UINT64_C( 1725818583209757134),
+    UINT64_C( 8990995463268734862), UINT64_C(13560226186958106938), UINT64_C(17496493926009333634),
+    UINT64_C(13848552241121132710), UINT64_C( 2854905433606924021), UINT64_C(10115970948733605814),
+    UINT64_C( 5988482560277157312), UINT64_C( 8762762855020851988), UINT64_C(16310258641066916011),
+    UINT64_C( 6666874746878112470), UINT64_C( 9054528407365798197), UINT64_C(11797593252996058340),
+    UINT64_C( 1400303781485071868), UINT64_C(16722834096363241931), UINT64_C( 5584510394834606919),
+    UINT64_C( 5737050439983461020), UINT64_C(12249812714996455577), UINT64_C( 7036115454250790513),
+    UINT64_C(  675126546250320585), UINT64_C( 6920007759143174182), UINT64_C( 1902752751713473306),
+    UINT64_C( 7601109746246636249), UINT64_C(16474075722383188315), UINT64_C(14623614887026982572),
+    UINT64_C( 4232470663205216094), UINT64_C( 4805073005290577039), UINT64_C( 1091985878697756698),
+    UINT64_C( 7004665517336774640), UINT64_C(12506542292930594139), UINT64_C(  956844554408122041),
+    UINT64_C( 3448762199473256634), UINT64_C( 1488590212749624779), UINT64_C(16364306162798969935),
+    UINT64_C( 7833523014809221356), UINT64_C(10582592045357301041), UINT64_C(12333507182795577510),
+    UINT64_C(11508794990914453881), UINT64_C( 8242557668024841330), UINT64_C(13289606426742304432),
+    UINT64_C( 9090848754202738950), UINT64_C(18274407945867236762), UINT64_C( 3267110017354058023),
+    UINT64_C(16567882029952228790), UINT64_C( 6803738936182482634), UINT64_C(10589976871292638249),
+    UINT64_C( 5267634971386954559), UINT64_C(15064017094196917828), UINT64_C( 5819145784947038829),
+    UINT64_C(  139899142649952791), UINT64_C( 3874609976020356822), UINT64_C(17291310140737537147),
+    UINT64_C( 3441578198396967659), UINT64_C( 4679443656209741861), UINT64_C( 4886786848912163734),
+    UINT64_C(17732157306585981133), UINT64_C( 1539056344469436257), UINT64_C(12131193950849424374),
+    UINT64_C( 3970582406117500159), UINT64_C( 7593727830291541745), UINT64_C(17802937553585716503),
+    UINT64_C(10987554885231710599), UINT64_C( 7862092985995821028), UINT64_C( 7230197901324272801),
+    UINT64_C( 5607412260564185710), UINT64_C( 5613296392631088615), UINT64_C( 6711967523774180990),
+    UINT64_C(15313480117724368922), UINT64_C(15781853766977246574), UINT64_C(11528772968940153559),
+    UINT64_C( 8738122700239243323), UINT64_C( 7214789850709834386), UINT64_C(17391963994994953651),
+    UINT64_C(10128630429669174031), UINT64_C( 1962531507957892162), UINT64_C( 2941620743276269829),
+    UINT64_C( 8827723110198643449), UINT64_C(10642832451956928447), UINT64_C(12040116785575280273),
+    UINT64_C( 8707369698688854501), UINT64_C(16104903750029455340), UINT64_C( 6390231607867366686),
+    UINT64_C( 8418509423739516294), UINT64_C(13211527451882689767), UINT64_C( 7495233233138735496),
+    UINT64_C( 7376616291252154021), UINT64_C(12512879289366963378), UINT64_C( 4759667745929627825),
+    UINT64_C(16317073420335116205), UINT64_C(15291685717164991148), UINT64_C(13812575064211235119),
+    UINT64_C(11798274165636471707), UINT64_C( 9799530720464147568), UINT64_C( 2811199810851541620),
+    UINT64_C( 8460682525281788424), UINT64_C( 2231341125130542267), UINT64_C(11920394569574153896),
+    UINT64_C(14116507653361676755), UINT64_C( 1540696707683991901), UINT64_C( 5104275283664101453),
+    UINT64_C(14552892201574678299), UINT64_C(16679933087428684161), UINT64_C( 2399035172465114486),
+    UINT64_C(  218062810168066097), UINT64_C( 5310842611417886242), UINT64_C(15294650653649290494),
+    UINT64_C(11983266706611114823), UINT64_C( 3261358164297945970), UINT64_C(11104925373569808284),
+    UINT64_C( 4370640611605523829), UINT64_C(14174949159539134513), UINT64_C(16864406753863813810),
+    UINT64_C(12189890840992130364), UINT64_C( 7063803669339548113), UINT64_C(15922152204422273727),
+    UINT64_C(16961005628270071674), UINT64_C( 7647439894899065375), UINT64_C( 4974309852924404854),
+    UINT64_C(13707613130694545890), UINT64_C( 5569692514409077298), UINT64_C(15069143526079390117),
+    UINT64_C( 6469150956886337828), UINT64_C(14127130088799857711), UINT64_C( 4768462574566062792),
+    UINT64_C(  984913122863104863), UINT64_C(11255450893402233028), UINT64_C( 2014380626802125415),
+    UINT64_C(11277406607425919139), UINT64_C(17164558047441076948), UINT64_C(16901323653565186558),
+    UINT64_C(12905680055577064029), UINT64_C(17856774748748599666), UINT64_C( 4984839792214547113),
+    UINT64_C(  168679980826991743), UINT64_C(15369585953352949000), UINT64_C( 5537221089842960052),
+    UINT64_C( 3302320096584826939), UINT64_C(17222088309074447793), UINT64_C(14984995144600909358),
+    UINT64_C(16907827116789237810), UINT64_C(16449845030173332657), UINT64_C(14264239635751579865),
+    UINT64_C(14439876175555444755), UINT64_C(12026932384479280860), UINT64_C(14501769581644736013),
+    UINT64_C(13644499206800486422), UINT64_C( 6302954839577268484), UINT64_C(15140352180968766721),
+    UINT64_C( 5795266869356614740), UINT64_C(11509529078956708253), UINT64_C( 2910676981656134481),
+    UINT64_C( 8147908830225213916), UINT64_C( 9833699116247648175), UINT64_C(16905465036784402211),
+    UINT64_C(10949147160576384432), UINT64_C( 5672508675041362124), UINT64_C(14603910556519891104),
+    UINT64_C(  182387772145098642), UINT64_C( 5173776481670076772), UINT64_C(13997667249539607151),
+    UINT64_C(14543307315384397184), UINT64_C( 6778818588704577856), UINT64_C( 4796968018609997240),
+    UINT64_C(18280725884546658697), UINT64_C(13228586073871714454), UINT64_C( 5992876535520442945),
+    UINT64_C( 3010121964610978323), UINT64_C( 6080889264723974455), UINT64_C( 2685094930035581976),
+    UINT64_C( 7959408345201990087), UINT64_C(16723492929618432634), UINT64_C(  851374409435833770),
+    UINT64_C( 4997689300826029544), UINT64_C( 8835964606604463097), UINT64_C(10284041564450903695),
+    UINT64_C(  922802357187162855), UINT64_C( 9230382572131532612), UINT64_C(14201298867599025386),
+    UINT64_C(11933755719888670861), UINT64_C(10013467612419264249), UINT64_C( 1988664857170137062),
+    UINT64_C(15101969555986579753), UINT64_C( 8453397895875064164), UINT64_C(10462227795322253613),
+    UINT64_C( 5472906543400230833), UINT64_C(11804582510446946898), UINT64_C( 3324891578131144857),
+    UINT64_C(  871232289920788219), UINT64_C(  605448984595508669), UINT64_C( 8314629556494531159),
+    UINT64_C(18410147688533649061), UINT64_C(14802422827310054794), UINT64_C( 6716999065172396314),
+    UINT64_C(18244340283058818159), UINT64_C(   19858446927769425), UINT64_C(13154971649600272466),
+    UINT64_C(10608868734310429313), UINT64_C( 7701917359620514130), UINT64_C( 8377209164637826496),
+    UINT64_C( 8133597377573440274), UINT64_C( 9275626755707078465), UINT64_C(16596455680272583189),
+    UINT64_C(14684097269581500404), UINT64_C(10415113771543149939), UINT64_C( 5086355822314814137),
+    UINT64_C( 8664025090995163353), UINT64_C( 8668216009918223614), UINT64_C( 7655321607551633274),
+    UINT64_C(10480041091690461212), UINT64_C(18424901289770957053), UINT64_C(11882639141528052559),
+    UINT64_C( 6180089182871041704), UINT64_C(16951403311269352019), UINT64_C(10124140801357771342),
+    UINT64_C( 3486086254513870780), UINT64_C( 4270502225461407088), UINT64_C( 4763781687412199937),
+    UINT64_C(13840882961069690785), UINT64_C(15237812131470197709), UINT64_C(16550072824521089267),
+    UINT64_C( 5319438793983662312), UINT64_C( 5216927144563303847), UINT64_C(  678311990693163053),
+    UINT64_C( 7324512161027480162), UINT64_C( 9581940441158434565), UINT64_C( 4042786477614811672),
+    UINT64_C( 1629383886684587179), UINT64_C( 6827374445201734854), UINT64_C(12355839157041951599),
+    UINT64_C(15379481106800638297), UINT64_C( 3936835475521822590), UINT64_C(17239458094412202018),
+    UINT64_C(10293439350458567601), UINT64_C( 6401014609401132079), UINT64_C(16081116538808945292),
+    UINT64_C( 8744758271401337856), UINT64_C( 8989226518221987738), UINT64_C(16700826403650023327),
+    UINT64_C(15605730690992061546), UINT64_C( 6234107333708375788), UINT64_C( 1014872807747886641),
+    UINT64_C(11986990058098685381), UINT64_C(16718455413459435881), UINT64_C(17467454679304226768),
+    UINT64_C( 1370611721805522867), UINT64_C( 1417569690201758176), UINT64_C( 5812134532535673042),
+    UINT64_C( 2574942350196968489), UINT64_C( 2374983825734206617), UINT64_C(11438224357958273693),
+    UINT64_C( 8641194391506396834), UINT64_C( 6328812439204303646), UINT64_C(17553539172973523344),
+    UINT64_C( 5977712086354638763), UINT64_C(17425114325699684729), UINT64_C(  286194000729000645),
+    UINT64_C( 2733836203475862710), UINT64_C( 3727926667037745266), UINT64_C( 7306686004098855123),
+    UINT64_C(11129465873321736100), UINT64_C( 8932648620126004693), UINT64_C( 5969023135261400689),
+    UINT64_C(  452648668870836655), UINT64_C(10611891797754700712), UINT64_C(18191298888595099352),
+    UINT64_C( 2131029330261677553), UINT64_C(12274643282303230238), UINT64_C(12350886306712144727),
+    UINT64_C(17218966617992811426), UINT64_C(17891903284400641677), UINT64_C( 7860416094008496516),
+    UINT64_C(10922538703698555046), UINT64_C(15586421240254536651), UINT64_C(13520516081661271076),
+    UINT64_C(13958803745100863713), UINT64_C(17998886203367861024), UINT64_C( 2117569879427440331),
+    UINT64_C( 4136130804892513436), UINT64_C( 4526470276893018574), UINT64_C( 1087174465585326290),
+    UINT64_C( 5649799817287842533), UINT64_C( 3630486197734697870), UINT64_C(12941788553018616633),
+    UINT64_C( 3412938620298032391), UINT64_C( 8175046159459197765), UINT64_C(13973686482141050046),
+    UINT64_C(12927468730767232167), UINT64_C(17633963660940553829), UINT64_C( 2770037769443056022),
+    UINT64_C(  399947796167156701), UINT64_C( 8997818952328224120), UINT64_C(18235304778098255883),
+    UINT64_C(12603193169367951319), UINT64_C( 7857812157309989495), UINT64_C( 7801932698777228194),
+    UINT64_C(  237018774450473341), UINT64_C(14500531135519748915), UINT64_C(  440304205073757962),
+    UINT64_C(17790884882382552248), UINT64_C(17611473421027466883), UINT64_C(  458473034455913715),
+    UINT64_C(17893203422806789636), UINT64_C( 1717928486433031191), UINT64_C( 2933164643391712359),
+    UINT64_C(17057990318921992876), UINT64_C( 7096165723095076451), UINT64_C(11243703281488690934),
+    UINT64_C(13810488813307582312), UINT64_C(  724773593534850616), UINT64_C( 6457391513480821270),
+    UINT64_C( 1600668180552486398), UINT64_C(  738645691741527860), UINT64_C( 8741658240187854260),
+    UINT64_C(15984518847476253204), UINT64_C(13304272785364317036), UINT64_C( 8231044567110631958),
+    UINT64_C(18156048289521047444), UINT64_C(16524286597296422613), UINT64_C(16053342372381935932),
+    UINT64_C(10336114266827628993), UINT64_C(18207404547907321154), UINT64_C( 3537491621639793811),
+    UINT64_C( 7490045473840855655), UINT64_C(10015792175710065212), UINT64_C(12919555393146931808),
+    UINT64_C( 2709726761396497700), UINT64_C(12631678719334499450), UINT64_C( 6817825421435252019),
+    UINT64_C(14447224105576841051), UINT64_C(13542888638288093501), UINT64_C( 2291259351861857756),
+    UINT64_C(  849026547775142031), UINT64_C( 2564566953516328107), UINT64_C( 5318949691070055621),
+    UINT64_C( 1361322290954391829), UINT64_C( 3595820722924891128), UINT64_C(11737920580249004020),
+    UINT64_C( 1527165853758038915), UINT64_C( 9174775211035528216), UINT64_C(11777937003085089696),
+    UINT64_C( 8407409744319095144), UINT64_C(11009031498122747556), UINT64_C(17596708670076845231),
+    UINT64_C(12365729379699729827), UINT64_C(11021790492889521746), UINT64_C(12568159004865112468),
+    UINT64_C(10835356225626049164), UINT64_C( 1338357196785182029), UINT64_C(17990205030981432241),
+    UINT64_C(14374241188000486102), UINT64_C( 1664605117544108107), UINT64_C( 4319816289762478721),
+    UINT64_C(   64776984263133968), UINT64_C( 7710433209109050583), UINT64_C( 3100634215953071349),
+    UINT64_C(12190333313142921386), UINT64_C(14587416609599823628), UINT64_C( 1540380586526083332),
+    UINT64_C(17067065565557067852), UINT64_C( 7740853317549126200), UINT64_C(11306278342191837964),
+    UINT64_C(15797563095571003847), UINT64_C( 4662291856386557818), UINT64_C(  721906748471305034),
+    UINT64_C( 1340641819322059868), UINT64_C( 9368791786613578912), UINT64_C(15498052581359289604),
+    UINT64_C( 1635297793288340952), UINT64_C( 4017695854698013713), UINT64_C( 7870034403379036531),
+    UINT64_C( 6584039735010321981), UINT64_C( 8589269257414511704), UINT64_C( 4311164707768705479),
+    UINT64_C(10564351611341928664), UINT64_C( 7347740269785781091), UINT64_C( 6645725130655698106),
+    UINT64_C( 4842088547748443608), UINT64_C( 3645584811011734219), UINT64_C( 6939623260854385102),
+    UINT64_C( 2170726661471449503), UINT64_C( 7547509417570698919), UINT64_C( 5482128462152601986),
+    UINT64_C( 4112851048700810266), UINT64_C( 8621032899054327119), UINT64_C( 7777440277095903750),
+    UINT64_C(16229684347602894694), UINT64_C( 2076082639902092953), UINT64_C(17531018162834103070),
+    UINT64_C(11826160518490931808), UINT64_C(18030372796403901450), UINT64_C( 9778697435788434058),
+    UINT64_C( 9867158890695622170), UINT64_C( 3397777154494780573), UINT64_C(13545640465225704607),
+    UINT64_C( 4451489905391294552), UINT64_C( 8558787498604833143), UINT64_C( 2977017301741586298),
+    UINT64_C(15801816899573859556), UINT64_C(13809431565422842075), UINT64_C(12210530250471086081),
+    UINT64_C( 5780455459387880144), UINT64_C( 7738689177118622969), UINT64_C( 5781892811650604995),
+    UINT64_C(11696748324676790379), UINT64_C(17431037837913958326), UINT64_C(  612997239503277718),
+    UINT64_C(  730861709862102302), UINT64_C(12401323900367410685), UINT64_C(  616777621059104168),
+    UINT64_C(15201461016983605019), UINT64_C(12089328064330991357), UINT64_C( 7003681149242982019),
+    UINT64_C( 5111520046535326760), UINT64_C( 8828695622443492250), UINT64_C(17356696554376209691),
+    UINT64_C( 1039490278504616853), UINT64_C( 9504016104637779384), UINT64_C(12485271568603339919),
+    UINT64_C(10400668413393803500), UINT64_C( 5011499343473125491), UINT64_C(13542741562414725497),
+    UINT64_C(12500669657954531658), UINT64_C(13620330503770774744), UINT64_C( 2824315660351685816),
+    UINT64_C(11256432271886489317), UINT64_C(  966949268135747087), UINT64_C( 1535718913547252393),
+    UINT64_C(11993246530177225676), UINT64_C( 3507918750233390519), UINT64_C(13518206401591412061),
+    UINT64_C( 5320219309942557468), UINT64_C(16790911246451218411), UINT64_C(13627407206651719498),
+    UINT64_C(14191196543028959848), UINT64_C( 1992270697276290427), UINT64_C(11971138769823482644),
+    UINT64_C(10234410752096779216), UINT64_C( 7164457201491063316), UINT64_C(18177158051515922435),
+    UINT64_C( 7466025961258877533), UINT64_C( 2739879231231507031), UINT64_C( 7052520225442224625),
+    UINT64_C( 2320573284360402179), UINT64_C(18297804406836415464), UINT64_C(14926825912953952046),
+    UINT64_C(16570150741444938745), UINT64_C( 2819904175201210122), UINT64_C(16228258275508163407),
+    UINT64_C( 6960793509560078045), UINT64_C( 6344410073299573806), UINT64_C(11450199954593219523),
+    UINT64_C(17999533790749749747), UINT64_C(17711651817883152829), UINT64_C( 3973807576243488255),
+    UINT64_C( 8326997721932934363), UINT64_C(11649729947342203962), UINT64_C(16716308977898338735),
+    UINT64_C( 1728912493229340325), UINT64_C( 5332126985467707258), UINT64_C(11685645205152554449),
+    UINT64_C( 8569807337324038117), UINT64_C( 4338489186127764024), UINT64_C( 4436050195406082277),
+    UINT64_C(12492593492512142987), UINT64_C( 4975777757972059449), UINT64_C(10100761174723299363),
+    UINT64_C( 6730984473555281231), UINT64_C(11219091556125270866), UINT64_C(13286925334261035599),
+    UINT64_C( 5762228398696585783), UINT64_C(17573442223674616226), UINT64_C( 7570984238833876282),
+    UINT64_C( 2089823476924056044), UINT64_C(14940017056481194994), UINT64_C(17982454112240427208),
+    UINT64_C(  489662933454297071), UINT64_C(14681752466176120892), UINT64_C(17233167745252408903),
+    UINT64_C(12605112375448911985), UINT64_C( 7631124167139675544), UINT64_C( 3488869966481489774),
+    UINT64_C(11094885832330789383), UINT64_C( 2454393446107269653), UINT64_C( 7950055061186396002),
+    UINT64_C( 4746298098332474360), UINT64_C( 9952253708210741558), UINT64_C(12439090705511809710),
+    UINT64_C(10051221375624132025), UINT64_C( 3145992877431991551), UINT64_C( 6503018074565173453),
+    UINT64_C(10361203029328673304), UINT64_C(10502388081402628633), UINT64_C( 1215240767952236472),
+    UINT64_C( 9050349433239872796), UINT64_C( 2478302261587834481), UINT64_C( 1433816358531493071),
+    UINT64_C(17501153351938113469), UINT64_C( 9770187399060574789), UINT64_C( 3810833954082885827),
+    UINT64_C( 2869318301271876163), UINT64_C( 3414582197551399351), UINT64_C( 3423162341807846437),
+    UINT64_C(17780482314754731877), UINT64_C( 7981203040693260334), UINT64_C(13319776298623405255),
+    UINT64_C(  781966033019136223), UINT64_C(11914494069303447867), UINT64_C( 6080137043281537344),
+    UINT64_C(11385987507587810593), UINT64_C( 7299960217755774950), UINT64_C( 5190162676241469384),
+    UINT64_C(11105351868356116891), UINT64_C(15897985510605615489), UINT64_C(17537290252973173857),
+    UINT64_C(17020413661327290752), UINT64_C( 1867088909208362544), UINT64_C( 2860967742309535999),
+    UINT64_C(  344880533807837364), UINT64_C(17166725471308269179), UINT64_C(  666270000377244202),
+    UINT64_C(13437578099824065379), UINT64_C( 5439454811574229774), UINT64_C(15027440413810054209),
+    UINT64_C( 3669454664425147468), UINT64_C(13650867189514150937), UINT64_C( 3980153961734194434),
+    UINT64_C( 3573587480088754644), UINT64_C(11219278908239721939), UINT64_C(12320124885738951172),
+    UINT64_C(  104150008876347524), UINT64_C( 5729958361117912677), UINT64_C( 2881847145411146901),
+    UINT64_C(16127343537310382690), UINT64_C(15887322521587349045), UINT64_C( 9097028028022663612),
+    UINT64_C(17452806637639154584), UINT64_C(   74867530689562713), UINT64_C(12900979340034150210),
+    UINT64_C(16237547326298430472), UINT64_C( 9334610649313933413), UINT64_C( 8800420953276420739),
+    UINT64_C( 4013296640777125548), UINT64_C( 7251298229133449652), UINT64_C( 2998941529647222785),
+    UINT64_C(16138138570011789415), UINT64_C(10954472498427348874), UINT64_C( 4669266261096049280),
+    UINT64_C( 8261632141757999872), UINT64_C( 3758169592233237157), UINT64_C(13335678080561698053),
+    UINT64_C( 2528400024840713794), UINT64_C( 6835279447765195728),
+};
+
+const uint64_t ntt64_1024_omega_powers[2048] = {
+    UINT64_C(                   0), UINT64_C(                   1), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C(                   1), UINT64_C( 1900964676350475249),
+    UINT64_C( 3014237273200044542), UINT64_C( 3849828598800407797), UINT64_C(                   1),
+    UINT64_C( 4023896290304178588), UINT64_C( 1900964676350475249), UINT64_C( 1261214714195877578),
+    UINT64_C( 3014237273200044542), UINT64_C(  233753965118447345), UINT64_C( 3849828598800407797),
+    UINT64_C( 2676210263234941926), UINT64_C(                   1), UINT64_C( 3705877877490448158),
+    UINT64_C( 4023896290304178588), UINT64_C( 2709464080653393840), UINT64_C( 1900964676350475249),
+    UINT64_C(  881956512167215261), UINT64_C( 1261214714195877578), UINT64_C( 2390554822009554201),
+    UINT64_C( 3014237273200044542), UINT64_C( 1700436953662611386), UINT64_C(  233753965118447345),
+    UINT64_C( 2046698563331994104), UINT64_C( 3849828598800407797), UINT64_C(  942511766632210723),
+    UINT64_C( 2676210263234941926), UINT64_C( 3454435399983609484), UINT64_C(                   1),
+    UINT64_C( 2068168528663844559), UINT64_C( 3705877877490448158), UINT64_C( 1659243688065142127),
+    UINT64_C( 4023896290304178588), UINT64_C( 3017514245864863805), UINT64_C( 2709464080653393840),
+    UINT64_C( 1161469406911059214), UINT64_C( 1900964676350475249), UINT64_C(  131131197477940099),
+    UINT64_C(  881956512167215261), UINT64_C( 3671267046320851570), UINT64_C( 1261214714195877578),
+    UINT64_C( 3989582554169606578), UINT64_C( 2390554822009554201), UINT64_C( 1879648051492049201),
+    UINT64_C( 3014237273200044542), UINT64_C( 2325064455222905641), UINT64_C( 1700436953662611386),
+    UINT64_C( 1850907503786542147), UINT64_C(  233753965118447345), UINT64_C( 3901669560572161329),
+    UINT64_C( 2046698563331994104), UINT64_C( 1407276508446451314), UINT64_C( 3849828598800407797),
+    UINT64_C( 3425108868614144548), UINT64_C(  942511766632210723), UINT64_C(  234809061531476887),
+    UINT64_C( 2676210263234941926), UINT64_C(  915969065129314377), UINT64_C( 3454435399983609484),
+    UINT64_C( 3972631746810885831), UINT64_C(                   1), UINT64_C( 4590796782851154790),
+    UINT64_C( 2068168528663844559), UINT64_C( 3551072131483919237), UINT64_C( 3705877877490448158),
+    UINT64_C( 2437169274265949282), UINT64_C( 1659243688065142127), UINT64_C( 1255736397875211236),
+    UINT64_C( 4023896290304178588), UINT64_C( 3869672860422254369), UINT64_C( 3017514245864863805),
+    UINT64_C( 3363683680248536206), UINT64_C( 2709464080653393840), UINT64_C( 3242539539891929736),
+    UINT64_C( 1161469406911059214), UINT64_C( 2467608254404987505), UINT64_C( 1900964676350475249),
+    UINT64_C( 3830807687839579289), UINT64_C(  131131197477940099), UINT64_C( 3377243792771223918),
+    UINT64_C(  881956512167215261), UINT64_C( 4252178254449178011), UINT64_C( 3671267046320851570),
+    UINT64_C(  692980835930194811), UINT64_C( 1261214714195877578), UINT64_C( 3886273357699266640),
+    UINT64_C( 3989582554169606578), UINT64_C( 1860452777895420591), UINT64_C( 2390554822009554201),
+    UINT64_C( 2122017383951756192), UINT64_C( 1879648051492049201), UINT64_C( 1870026971131305276),
+    UINT64_C( 3014237273200044542), UINT64_C( 2690008220850828513), UINT64_C( 2325064455222905641),
+    UINT64_C(  848194068593451947), UINT64_C( 1700436953662611386), UINT64_C( 4055857690192455640),
+    UINT64_C( 1850907503786542147), UINT64_C( 1482370635763389549), UINT64_C(  233753965118447345),
+    UINT64_C( 2499763353882675499), UINT64_C( 3901669560572161329), UINT64_C( 3112335350052062119),
+    UINT64_C( 2046698563331994104), UINT64_C(  770504662971353748), UINT64_C( 1407276508446451314),
+    UINT64_C( 2492189391122621180), UINT64_C( 3849828598800407797), UINT64_C( 3371486293635211942),
+    UINT64_C( 3425108868614144548), UINT64_C( 1044401146706852566), UINT64_C(  942511766632210723),
+    UINT64_C( 1218769917950358612), UINT64_C(  234809061531476887), UINT64_C( 4443047538019427593),
+    UINT64_C( 2676210263234941926), UINT64_C( 2657438284789770960), UINT64_C(  915969065129314377),
+    UINT64_C(  139490077637179889), UINT64_C( 3454435399983609484), UINT64_C( 1347513035217080243),
+    UINT64_C( 3972631746810885831), UINT64_C( 2093542254857539782), UINT64_C(                   1),
+    UINT64_C( 4045238714599002096), UINT64_C( 4590796782851154790), UINT64_C( 1768360373935249815),
+    UINT64_C( 2068168528663844559), UINT64_C( 1132986281500898181), UINT64_C( 3551072131483919237),
+    UINT64_C( 1145423232612195378), UINT64_C( 3705877877490448158), UINT64_C( 3173250686850103875),
+    UINT64_C( 2437169274265949282), UINT64_C( 3915428745381234437), UINT64_C( 1659243688065142127),
+    UINT64_C(  387408563325795131), UINT64_C( 1255736397875211236), UINT64_C(  198757123458518136),
+    UINT64_C( 4023896290304178588), UINT64_C(  326342301997994306), UINT64_C( 3869672860422254369),
+    UINT64_C(  966634132866666046), UINT64_C( 3017514245864863805), UINT64_C( 4330212126516253940),
+    UINT64_C( 3363683680248536206), UINT64_C( 2720549446495872479), UINT64_C( 2709464080653393840),
+    UINT64_C(  594522224732039591), UINT64_C( 3242539539891929736), UINT64_C( 2594209754045336797),
+    UINT64_C( 1161469406911059214), UINT64_C( 4371207996495634843), UINT64_C( 2467608254404987505),
+    UINT64_C( 3624590898131699178), UINT64_C( 1900964676350475249), UINT64_C(  924826167830191412),
+    UINT64_C( 3830807687839579289), UINT64_C( 3215445710127520461), UINT64_C(  131131197477940099),
+    UINT64_C(  532893738964097199), UINT64_C( 3377243792771223918), UINT64_C(  256494620928290829),
+    UINT64_C(  881956512167215261), UINT64_C( 3838265690580697662), UINT64_C( 4252178254449178011),
+    UINT64_C( 2063059596773417233), UINT64_C( 3671267046320851570), UINT64_C( 1610063896412036330),
+    UINT64_C(  692980835930194811), UINT64_C( 1105253435398927209), UINT64_C( 1261214714195877578),
+    UINT64_C(  274152638443289083), UINT64_C( 3886273357699266640), UINT64_C( 1636465293549385213),
+    UINT64_C( 3989582554169606578), UINT64_C( 2718205553781153588), UINT64_C( 1860452777895420591),
+    UINT64_C( 2945859800615284769), UINT64_C( 2390554822009554201), UINT64_C(  596256239724183802),
+    UINT64_C( 2122017383951756192), UINT64_C( 4342379187862950981), UINT64_C( 1879648051492049201),
+    UINT64_C(  820752269393906697), UINT64_C( 1870026971131305276), UINT64_C(  197193362320839916),
+    UINT64_C( 3014237273200044542), UINT64_C( 4009884568549198952), UINT64_C( 2690008220850828513),
+    UINT64_C(  264983591297565602), UINT64_C( 2325064455222905641), UINT64_C( 3227187218431474260),
+    UINT64_C(  848194068593451947), UINT64_C( 1876288299092947845), UINT64_C( 1700436953662611386),
+    UINT64_C( 3259777318488657740), UINT64_C( 4055857690192455640), UINT64_C(   77912590505156175),
+    UINT64_C( 1850907503786542147), UINT64_C( 2881615329919645789), UINT64_C( 1482370635763389549),
+    UINT64_C( 4325996936041739018), UINT64_C(  233753965118447345), UINT64_C( 1488036762640350778),
+    UINT64_C( 2499763353882675499), UINT64_C( 1729303117196723516), UINT64_C( 3901669560572161329),
+    UINT64_C( 2718306078420364749), UINT64_C( 3112335350052062119), UINT64_C( 3879920586239417728),
+    UINT64_C( 2046698563331994104), UINT64_C( 2279697959882368399), UINT64_C(  770504662971353748),
+    UINT64_C( 3490871534733890590), UINT64_C( 1407276508446451314), UINT64_C( 1118943180714764533),
+    UINT64_C( 2492189391122621180), UINT64_C(  952627208103550231), UINT64_C( 3849828598800407797),
+    UINT64_C( 1123876638625291197), UINT64_C( 3371486293635211942), UINT64_C( 2801663570676650426),
+    UINT64_C( 3425108868614144548), UINT64_C(  685400175851316156), UINT64_C( 1044401146706852566),
+    UINT64_C(  385770757908462315), UINT64_C(  942511766632210723), UINT64_C(  213534333928675936),
+    UINT64_C( 1218769917950358612), UINT64_C(  869173883498632863), UINT64_C(  234809061531476887),
+    UINT64_C( 2950161371412402896), UINT64_C( 4443047538019427593), UINT64_C( 1300210680856899347),
+    UINT64_C( 2676210263234941926), UINT64_C( 4391989867934207415), UINT64_C( 2657438284789770960),
+    UINT64_C( 2418254001624659624), UINT64_C(  915969065129314377), UINT64_C( 1970705841300989217),
+    UINT64_C(  139490077637179889), UINT64_C( 2074581773178369824), UINT64_C( 3454435399983609484),
+    UINT64_C( 2062182020421627244), UINT64_C( 1347513035217080243), UINT64_C( 1006352626196175146),
+    UINT64_C( 3972631746810885831), UINT64_C(   13256803360230936), UINT64_C( 2093542254857539782),
+    UINT64_C(  115292498941482581), UINT64_C(                   1), UINT64_C( 4397928510362249185),
+    UINT64_C( 4045238714599002096), UINT64_C( 2492007486818252281), UINT64_C( 4590796782851154790),
+    UINT64_C( 1635941343942511081), UINT64_C( 1768360373935249815), UINT64_C(  659920490112473771),
+    UINT64_C( 2068168528663844559), UINT64_C( 1242290418832802340), UINT64_C( 1132986281500898181),
+    UINT64_C( 1651868321264097245), UINT64_C( 3551072131483919237), UINT64_C( 1480033111175595923),
+    UINT64_C( 1145423232612195378), UINT64_C( 2829232655383784435), UINT64_C( 3705877877490448158),
+    UINT64_C( 4348036025405146823), UINT64_C( 3173250686850103875), UINT64_C( 1737698881978754060),
+    UINT64_C( 2437169274265949282), UINT64_C( 2592879749429526478), UINT64_C( 3915428745381234437),
+    UINT64_C( 2655618324572464349), UINT64_C( 1659243688065142127), UINT64_C( 4559114692349893132),
+    UINT64_C(  387408563325795131), UINT64_C( 2005797565407588331), UINT64_C( 1255736397875211236),
+    UINT64_C( 2737280191719927095), UINT64_C(  198757123458518136), UINT64_C(   80314588454367303),
+    UINT64_C( 4023896290304178588), UINT64_C( 2891450918264212504), UINT64_C(  326342301997994306),
+    UINT64_C(  992691344949810376), UINT64_C( 3869672860422254369), UINT64_C(  129810917144576916),
+    UINT64_C(  966634132866666046), UINT64_C(  695772663740341648), UINT64_C( 3017514245864863805),
+    UINT64_C( 2141122488594596993), UINT64_C( 4330212126516253940), UINT64_C( 1829823592218854829),
+    UINT64_C( 3363683680248536206), UINT64_C( 2687779657998904699), UINT64_C( 2720549446495872479),
+    UINT64_C(  634297698006902227), UINT64_C( 2709464080653393840), UINT64_C( 4006039401931595717),
+    UINT64_C(  594522224732039591), UINT64_C( 3765859310675874347), UINT64_C( 3242539539891929736),
+    UINT64_C( 2741242456929995325), UINT64_C( 2594209754045336797), UINT64_C( 2972182093805958694),
+    UINT64_C( 1161469406911059214), UINT64_C( 1552522174097316013), UINT64_C( 4371207996495634843),
+    UINT64_C( 1053896098414277608), UINT64_C( 2467608254404987505), UINT64_C(  951927524121511628),
+    UINT64_C( 3624590898131699178), UINT64_C( 3884862316935299801), UINT64_C( 1900964676350475249),
+    UINT64_C( 4265936606843995371), UINT64_C(  924826167830191412), UINT64_C( 2836277682389490544),
+    UINT64_C( 3830807687839579289), UINT64_C(  797297974165473708), UINT64_C( 3215445710127520461),
+    UINT64_C( 2948358908520598479), UINT64_C(  131131197477940099), UINT64_C( 3537332191015376133),
+    UINT64_C(  532893738964097199), UINT64_C( 4428544272741454476), UINT64_C( 3377243792771223918),
+    UINT64_C( 2344837507844879919), UINT64_C(  256494620928290829), UINT64_C(  290341413826395897),
+    UINT64_C(  881956512167215261), UINT64_C( 1619019368883669872), UINT64_C( 3838265690580697662),
+    UINT64_C(  367710248663569074), UINT64_C( 4252178254449178011), UINT64_C( 4382760348511593332),
+    UINT64_C( 2063059596773417233), UINT64_C( 4289953542452418782), UINT64_C( 3671267046320851570),
+    UINT64_C(  816778863552099543), UINT64_C( 1610063896412036330), UINT64_C( 2059382345563661484),
+    UINT64_C(  692980835930194811), UINT64_C( 1586033836836413089), UINT64_C( 1105253435398927209),
+    UINT64_C( 4035126618246567356), UINT64_C( 1261214714195877578), UINT64_C( 3537615089318938312),
+    UINT64_C(  274152638443289083), UINT64_C( 3597579810358573200), UINT64_C( 3886273357699266640),
+    UINT64_C( 1917507912125205273), UINT64_C( 1636465293549385213), UINT64_C( 4270566713751658911),
+    UINT64_C( 3989582554169606578), UINT64_C( 2319624932896978552), UINT64_C( 2718205553781153588),
+    UINT64_C( 1098585534659563516), UINT64_C( 1860452777895420591), UINT64_C(  204896358553094317),
+    UINT64_C( 2945859800615284769), UINT64_C(  941475936506272623), UINT64_C( 2390554822009554201),
+    UINT64_C( 2834330732008186913), UINT64_C(  596256239724183802), UINT64_C( 3270168765958856210),
+    UINT64_C( 2122017383951756192), UINT64_C(  945384935947669134), UINT64_C( 4342379187862950981),
+    UINT64_C( 1872862200816238025), UINT64_C( 1879648051492049201), UINT64_C( 4207773561490883035),
+    UINT64_C(  820752269393906697), UINT64_C( 3664032263547523615), UINT64_C( 1870026971131305276),
+    UINT64_C(  234041685233257305), UINT64_C(  197193362320839916), UINT64_C( 2077598463836100093),
+    UINT64_C( 3014237273200044542), UINT64_C( 2621792368599966030), UINT64_C( 4009884568549198952),
+    UINT64_C(  992635524216815278), UINT64_C( 2690008220850828513), UINT64_C(  388752746045964085),
+    UINT64_C(  264983591297565602), UINT64_C( 4103017788438389522), UINT64_C( 2325064455222905641),
+    UINT64_C(  793244537377917469), UINT64_C( 3227187218431474260), UINT64_C( 3249967743082457984),
+    UINT64_C(  848194068593451947), UINT64_C( 2538778187029876446), UINT64_C( 1876288299092947845),
+    UINT64_C( 3730675882714140168), UINT64_C( 1700436953662611386), UINT64_C( 1478167556514048989),
+    UINT64_C( 3259777318488657740), UINT64_C( 4544171960220366710), UINT64_C( 4055857690192455640),
+    UINT64_C(  767039058199565051), UINT64_C(   77912590505156175), UINT64_C(  619989834785333684),
+    UINT64_C( 1850907503786542147), UINT64_C( 2200782996640600919), UINT64_C( 2881615329919645789),
+    UINT64_C( 3785652056625193400), UINT64_C( 1482370635763389549), UINT64_C( 1632747171034126038),
+    UINT64_C( 4325996936041739018), UINT64_C( 3086222030444894558), UINT64_C(  233753965118447345),
+    UINT64_C( 1583352588619711861), UINT64_C( 1488036762640350778), UINT64_C(  902190690149567071),
+    UINT64_C( 2499763353882675499), UINT64_C( 3695237642805590966), UINT64_C( 1729303117196723516),
+    UINT64_C( 3638761761840292763), UINT64_C( 3901669560572161329), UINT64_C(  218152164207231001),
+    UINT64_C( 2718306078420364749), UINT64_C( 2903757481865333581), UINT64_C( 3112335350052062119),
+    UINT64_C( 4135729112038515174), UINT64_C( 3879920586239417728), UINT64_C(  150331248495044976),
+    UINT64_C( 2046698563331994104), UINT64_C(  959698465116575210), UINT64_C( 2279697959882368399),
+    UINT64_C( 4111152270751917141), UINT64_C(  770504662971353748), UINT64_C( 1529567590237338722),
+    UINT64_C( 3490871534733890590), UINT64_C( 3593013623125881141), UINT64_C( 1407276508446451314),
+    UINT64_C(  872899714386228416), UINT64_C( 1118943180714764533), UINT64_C( 2221612477457659753),
+    UINT64_C( 2492189391122621180), UINT64_C( 2312131158625254196), UINT64_C(  952627208103550231),
+    UINT64_C( 2939975394522410060), UINT64_C( 3849828598800407797), UINT64_C(  925716047777857124),
+    UINT64_C( 1123876638625291197), UINT64_C( 4108077938980496914), UINT64_C( 3371486293635211942),
+    UINT64_C( 2224528769235092197), UINT64_C( 2801663570676650426), UINT64_C( 4222131386577963441),
+    UINT64_C( 3425108868614144548), UINT64_C(  274336233037238077), UINT64_C(  685400175851316156),
+    UINT64_C( 3172066150783512600), UINT64_C( 1044401146706852566), UINT64_C( 2596801024432302985),
+    UINT64_C(  385770757908462315), UINT64_C(   49318483776098116), UINT64_C(  942511766632210723),
+    UINT64_C( 2214213433730165795), UINT64_C(  213534333928675936), UINT64_C( 3370615483927805111),
+    UINT64_C( 1218769917950358612), UINT64_C( 2308342209152691040), UINT64_C(  869173883498632863),
+    UINT64_C(  447428903215342719), UINT64_C(  234809061531476887), UINT64_C( 2419031109686561638),
+    UINT64_C( 2950161371412402896), UINT64_C( 3682127656795400699), UINT64_C( 4443047538019427593),
+    UINT64_C( 3721389930257549409), UINT64_C( 1300210680856899347), UINT64_C( 1842615612368354497),
+    UINT64_C( 2676210263234941926), UINT64_C(  263637743407343746), UINT64_C( 4391989867934207415),
+    UINT64_C( 2622864515154075147), UINT64_C( 2657438284789770960), UINT64_C(   86969233091873012),
+    UINT64_C( 2418254001624659624), UINT64_C( 4541955249605003808), UINT64_C(  915969065129314377),
+    UINT64_C( 4022767753782152272), UINT64_C( 1970705841300989217), UINT64_C( 4359325251833636030),
+    UINT64_C(  139490077637179889), UINT64_C( 3716165778433263976), UINT64_C( 2074581773178369824),
+    UINT64_C( 3766314570829488647), UINT64_C( 3454435399983609484), UINT64_C(  125165356278636575),
+    UINT64_C( 2062182020421627244), UINT64_C( 1849160754478801782), UINT64_C( 1347513035217080243),
+    UINT64_C( 2973329062899545170), UINT64_C( 1006352626196175146), UINT64_C( 1051719673050458959),
+    UINT64_C( 3972631746810885831), UINT64_C( 4557284773527364931), UINT64_C(   13256803360230936),
+    UINT64_C( 4136767868326397556), UINT64_C( 2093542254857539782), UINT64_C( 1158366700570832516),
+    UINT64_C(  115292498941482581), UINT64_C( 4351756900966242687), UINT64_C(                   1),
+    UINT64_C( 2400711739119850254), UINT64_C( 4397928510362249185), UINT64_C( 4160528321702267484),
+    UINT64_C( 4045238714599002096), UINT64_C( 1594215662391375664), UINT64_C( 2492007486818252281),
+    UINT64_C( 4478754074506901161), UINT64_C( 4590796782851154790), UINT64_C( 3617524138862625915),
+    UINT64_C( 1635941343942511081), UINT64_C( 3966103377340790787), UINT64_C( 1768360373935249815),
+    UINT64_C( 2686804368448370058), UINT64_C(  659920490112473771), UINT64_C( 2726324361822022698),
+    UINT64_C( 2068168528663844559), UINT64_C(  984850724769212231), UINT64_C( 1242290418832802340),
+    UINT64_C( 3486308177735248782), UINT64_C( 1132986281500898181), UINT64_C( 2168778472999814742),
+    UINT64_C( 1651868321264097245), UINT64_C(  777039139634899335), UINT64_C( 3551072131483919237),
+    UINT64_C( 4592083484607426410), UINT64_C( 1480033111175595923), UINT64_C( 3427619522903392612),
+    UINT64_C( 1145423232612195378), UINT64_C( 3100376025612258997), UINT64_C( 2829232655383784435),
+    UINT64_C(  917794389549713133), UINT64_C( 3705877877490448158), UINT64_C(  901859847614317342),
+    UINT64_C( 4348036025405146823), UINT64_C( 1446321208517112901), UINT64_C( 3173250686850103875),
+    UINT64_C( 3775631158123672134), UINT64_C( 1737698881978754060), UINT64_C( 3016203424819720057),
+    UINT64_C( 2437169274265949282), UINT64_C(  471899825039116811), UINT64_C( 2592879749429526478),
+    UINT64_C( 2366867205507320441), UINT64_C( 3915428745381234437), UINT64_C( 1140983863867013629),
+    UINT64_C( 2655618324572464349), UINT64_C(  981623966646819835), UINT64_C( 1659243688065142127),
+    UINT64_C(  823057021263900120), UINT64_C( 4559114692349893132), UINT64_C( 3616980239419837533),
+    UINT64_C(  387408563325795131), UINT64_C(  565404122626278415), UINT64_C( 2005797565407588331),
+    UINT64_C( 3956136616881939299), UINT64_C( 1255736397875211236), UINT64_C( 1834221755513644804),
+    UINT64_C( 2737280191719927095), UINT64_C( 1063378126852311450), UINT64_C(  198757123458518136),
+    UINT64_C( 3969109923860126202), UINT64_C(   80314588454367303), UINT64_C( 3187602538680359448),
+    UINT64_C( 4023896290304178588), UINT64_C( 2322728151565602801), UINT64_C( 2891450918264212504),
+    UINT64_C(   19378975449324817), UINT64_C(  326342301997994306), UINT64_C( 4605570564545716782),
+    UINT64_C(  992691344949810376), UINT64_C( 1538093989941999103), UINT64_C( 3869672860422254369),
+    UINT64_C( 2212359946370916543), UINT64_C(  129810917144576916), UINT64_C( 1950096095932331642),
+    UINT64_C(  966634132866666046), UINT64_C( 2202021348140264508), UINT64_C(  695772663740341648),
+    UINT64_C( 2736718066033403274), UINT64_C( 3017514245864863805), UINT64_C( 1628183582686043495),
+    UINT64_C( 2141122488594596993), UINT64_C( 3149013359125955277), UINT64_C( 4330212126516253940),
+    UINT64_C( 4049514128221477506), UINT64_C( 1829823592218854829), UINT64_C( 3145022340754381981),
+    UINT64_C( 3363683680248536206), UINT64_C( 2819589298549003725), UINT64_C( 2687779657998904699),
+    UINT64_C( 3668473313572806821), UINT64_C( 2720549446495872479), UINT64_C( 4240106447481798977),
+    UINT64_C(  634297698006902227), UINT64_C( 2742465433268612203), UINT64_C( 2709464080653393840),
+    UINT64_C( 1496519828866501509), UINT64_C( 4006039401931595717), UINT64_C( 2454359905175880704),
+    UINT64_C(  594522224732039591), UINT64_C( 3704149725588216635), UINT64_C( 3765859310675874347),
+    UINT64_C( 1781176816738160749), UINT64_C( 3242539539891929736), UINT64_C(  387899278134293157),
+    UINT64_C( 2741242456929995325), UINT64_C(  543664783405561633), UINT64_C( 2594209754045336797),
+    UINT64_C( 3537347188712899438), UINT64_C( 2972182093805958694), UINT64_C( 1579237328548817598),
+    UINT64_C( 1161469406911059214), UINT64_C(  607337418735800506), UINT64_C( 1552522174097316013),
+    UINT64_C( 1240193826751170286), UINT64_C( 4371207996495634843), UINT64_C( 1237155887585272454),
+    UINT64_C( 1053896098414277608), UINT64_C( 2035178193471487090), UINT64_C( 2467608254404987505),
+    UINT64_C( 3592350538474428510), UINT64_C(  951927524121511628), UINT64_C(  184443339613017823),
+    UINT64_C( 3624590898131699178), UINT64_C( 1930320082969866003), UINT64_C( 3884862316935299801),
+    UINT64_C( 2093264054356944664), UINT64_C( 1900964676350475249), UINT64_C( 3529489814044241211),
+    UINT64_C( 4265936606843995371), UINT64_C(  765058418352087786), UINT64_C(  924826167830191412),
+    UINT64_C( 4331139294641859496), UINT64_C( 2836277682389490544), UINT64_C( 3369742126303465728),
+    UINT64_C( 3830807687839579289), UINT64_C( 1585988977946312062), UINT64_C(  797297974165473708),
+    UINT64_C(  979224835709439631), UINT64_C( 3215445710127520461), UINT64_C( 2965734562744674556),
+    UINT64_C( 2948358908520598479), UINT64_C( 1432751804325404159), UINT64_C(  131131197477940099),
+    UINT64_C(  241509748437302878), UINT64_C( 3537332191015376133), UINT64_C( 3487906013475575565),
+    UINT64_C(  532893738964097199), UINT64_C( 2535061422550748591), UINT64_C( 4428544272741454476),
+    UINT64_C( 2315378645606089562), UINT64_C( 3377243792771223918), UINT64_C( 4295875587876333751),
+    UINT64_C( 2344837507844879919), UINT64_C(  155787413762905631), UINT64_C(  256494620928290829),
+    UINT64_C( 4579018523369296072), UINT64_C(  290341413826395897), UINT64_C( 2676859808255949069),
+    UINT64_C(  881956512167215261), UINT64_C(  582088543124655278), UINT64_C( 1619019368883669872),
+    UINT64_C( 1492270058063349872), UINT64_C( 3838265690580697662), UINT64_C( 1717910164398452271),
+    UINT64_C(  367710248663569074), UINT64_C( 1733457760798908697), UINT64_C( 4252178254449178011),
+    UINT64_C( 3000885903703217293), UINT64_C( 4382760348511593332), UINT64_C(  136771232223207871),
+    UINT64_C( 2063059596773417233), UINT64_C(  871015248634303721), UINT64_C( 4289953542452418782),
+    UINT64_C( 3133051207374189676), UINT64_C( 3671267046320851570), UINT64_C( 1091914032667124918),
+    UINT64_C(  816778863552099543), UINT64_C( 1988371081652311567), UINT64_C( 1610063896412036330),
+    UINT64_C( 1676540994076128771), UINT64_C( 2059382345563661484), UINT64_C( 1844890970564863646),
+    UINT64_C(  692980835930194811), UINT64_C( 1614547761626343100), UINT64_C( 1586033836836413089),
+    UINT64_C( 4345836121639019118), UINT64_C( 1105253435398927209), UINT64_C( 1609551556682479035),
+    UINT64_C( 4035126618246567356), UINT64_C( 1032376268464898917), UINT64_C( 1261214714195877578),
+    UINT64_C(   31368178978924605), UINT64_C( 3537615089318938312), UINT64_C( 1863841901798123565),
+    UINT64_C(  274152638443289083), UINT64_C( 3461620215034767531), UINT64_C( 3597579810358573200),
+    UINT64_C(  848976462686658613), UINT64_C( 3886273357699266640), UINT64_C( 3302637486092235475),
+    UINT64_C( 1917507912125205273), UINT64_C( 3959152801982309405), UINT64_C( 1636465293549385213),
+    UINT64_C( 3279913815230309282), UINT64_C( 4270566713751658911), UINT64_C(  938436529988435272),
+    UINT64_C( 3989582554169606578), UINT64_C( 4238833680404291401), UINT64_C( 2319624932896978552),
+    UINT64_C(  962154417381372913), UINT64_C( 2718205553781153588), UINT64_C( 3111929951370134147),
+    UINT64_C( 1098585534659563516), UINT64_C( 4083502248124438865), UINT64_C( 1860452777895420591),
+    UINT64_C( 4048254277868242691), UINT64_C(  204896358553094317), UINT64_C( 4382204278396839813),
+    UINT64_C( 2945859800615284769), UINT64_C( 2372127282591449080), UINT64_C(  941475936506272623),
+    UINT64_C( 3720690912893558875), UINT64_C( 2390554822009554201), UINT64_C( 1465721990478548967),
+    UINT64_C( 2834330732008186913), UINT64_C( 1478805904657277363), UINT64_C(  596256239724183802),
+    UINT64_C(  978263020579853024), UINT64_C( 3270168765958856210), UINT64_C( 1244340859032719234),
+    UINT64_C( 2122017383951756192), UINT64_C( 3395731570131024519), UINT64_C(  945384935947669134),
+    UINT64_C(  510806555556130508), UINT64_C( 4342379187862950981), UINT64_C(  610860530465122481),
+    UINT64_C( 1872862200816238025), UINT64_C( 3824291739522788076), UINT64_C( 1879648051492049201),
+    UINT64_C( 1317921105431250529), UINT64_C( 4207773561490883035), UINT64_C(  245017491998479862),
+    UINT64_C(  820752269393906697), UINT64_C( 4281658139135845856), UINT64_C( 3664032263547523615),
+    UINT64_C( 4190969131542904529), UINT64_C( 1870026971131305276), UINT64_C( 2382342543941134407),
+    UINT64_C(  234041685233257305), UINT64_C( 3525498332217669253), UINT64_C(  197193362320839916),
+    UINT64_C( 3802414016400156201), UINT64_C( 2077598463836100093), UINT64_C( 4476297656530001513),
+    UINT64_C( 3014237273200044542), UINT64_C( 1416979586047913860), UINT64_C( 2621792368599966030),
+    UINT64_C( 2255234229238542731), UINT64_C( 4009884568549198952), UINT64_C( 2000858215069317061),
+    UINT64_C(  992635524216815278), UINT64_C(  626297590503189450), UINT64_C( 2690008220850828513),
+    UINT64_C( 2759501200185376495), UINT64_C(  388752746045964085), UINT64_C( 1675895396083821476),
+    UINT64_C(  264983591297565602), UINT64_C( 2494884684187073661), UINT64_C( 4103017788438389522),
+    UINT64_C( 3085814807638355138), UINT64_C( 2325064455222905641), UINT64_C( 3644518137698018793),
+    UINT64_C(  793244537377917469), UINT64_C( 4095553468289470494), UINT64_C( 3227187218431474260),
+    UINT64_C( 4073169274230856126), UINT64_C( 3249967743082457984), UINT64_C( 3531384543848349920),
+    UINT64_C(  848194068593451947), UINT64_C( 1642493526309612238), UINT64_C( 2538778187029876446),
+    UINT64_C( 4163483892177191812), UINT64_C( 1876288299092947845), UINT64_C( 1362051703778680179),
+    UINT64_C( 3730675882714140168), UINT64_C(  251588547665158640), UINT64_C( 1700436953662611386),
+    UINT64_C( 1215685474672827343), UINT64_C( 1478167556514048989), UINT64_C( 2014042211893684604),
+    UINT64_C( 3259777318488657740), UINT64_C( 1508734581979171756), UINT64_C( 4544171960220366710),
+    UINT64_C( 4035136138076832337), UINT64_C( 4055857690192455640), UINT64_C( 4430465930968651663),
+    UINT64_C(  767039058199565051), UINT64_C( 3507617405319098454), UINT64_C(   77912590505156175),
+    UINT64_C(  208179820468705139), UINT64_C(  619989834785333684), UINT64_C(  680976407834139869),
+    UINT64_C( 1850907503786542147), UINT64_C( 2326411855819986390), UINT64_C( 2200782996640600919),
+    UINT64_C(  565417953593608565), UINT64_C( 2881615329919645789), UINT64_C( 1799833330256075521),
+    UINT64_C( 3785652056625193400), UINT64_C( 1874612785324683517), UINT64_C( 1482370635763389549),
+    UINT64_C(  973277973631779119), UINT64_C( 1632747171034126038), UINT64_C( 1231208399773997533),
+    UINT64_C( 4325996936041739018), UINT64_C( 4394225446772396019), UINT64_C( 3086222030444894558),
+    UINT64_C( 3165220293337291917), UINT64_C(  233753965118447345), UINT64_C( 2369067053942932304),
+    UINT64_C( 1583352588619711861), UINT64_C( 3903703857980723923), UINT64_C( 1488036762640350778),
+    UINT64_C( 1330347273031060688), UINT64_C(  902190690149567071), UINT64_C(  479588466945915912),
+    UINT64_C( 2499763353882675499), UINT64_C( 1132640057676710068), UINT64_C( 3695237642805590966),
+    UINT64_C(  289100196167847331), UINT64_C( 1729303117196723516), UINT64_C( 1593017396740558622),
+    UINT64_C( 3638761761840292763), UINT64_C( 3354922308083637135), UINT64_C( 3901669560572161329),
+    UINT64_C( 3114759228713443323), UINT64_C(  218152164207231001), UINT64_C( 3381901547434642051),
+    UINT64_C( 2718306078420364749), UINT64_C(  439107495671692173), UINT64_C( 2903757481865333581),
+    UINT64_C( 2073600855859389402), UINT64_C( 3112335350052062119), UINT64_C(  947438932901172815),
+    UINT64_C( 4135729112038515174), UINT64_C( 3469651375707344324), UINT64_C( 3879920586239417728),
+    UINT64_C( 3518353274126681257), UINT64_C(  150331248495044976), UINT64_C(  485491135282793681),
+    UINT64_C( 2046698563331994104), UINT64_C( 3058646478612644251), UINT64_C(  959698465116575210),
+    UINT64_C(  504362620832676715), UINT64_C( 2279697959882368399), UINT64_C( 4424436587380937918),
+    UINT64_C( 4111152270751917141), UINT64_C( 2914509569038348340), UINT64_C(  770504662971353748),
+    UINT64_C( 2672210800821325956), UINT64_C( 1529567590237338722), UINT64_C(  483306483213340640),
+    UINT64_C( 3490871534733890590), UINT64_C( 4483213694720406842), UINT64_C( 3593013623125881141),
+    UINT64_C(  877353902278191427), UINT64_C( 1407276508446451314), UINT64_C( 1467247101221685025),
+    UINT64_C(  872899714386228416), UINT64_C( 4266426457572698799), UINT64_C( 1118943180714764533),
+    UINT64_C( 3941826338290054710), UINT64_C( 2221612477457659753), UINT64_C( 2462317921121052758),
+    UINT64_C( 2492189391122621180), UINT64_C( 2020727104038103695), UINT64_C( 2312131158625254196),
+    UINT64_C(  277094405141672246), UINT64_C(  952627208103550231), UINT64_C( 1225662781222001375),
+    UINT64_C( 2939975394522410060), UINT64_C( 3781699484200797783), UINT64_C( 3849828598800407797),
+    UINT64_C( 1135687142661087418), UINT64_C(  925716047777857124), UINT64_C(  166469110154211230),
+    UINT64_C( 1123876638625291197), UINT64_C(  332574684972234384), UINT64_C( 4108077938980496914),
+    UINT64_C( 1697744173972396808), UINT64_C( 3371486293635211942), UINT64_C(  184527297125777774),
+    UINT64_C( 2224528769235092197), UINT64_C( 3624585512076324057), UINT64_C( 2801663570676650426),
+    UINT64_C( 3446233119576757455), UINT64_C( 4222131386577963441), UINT64_C( 3078632193023835316),
+    UINT64_C( 3425108868614144548), UINT64_C(  383304783933611976), UINT64_C(  274336233037238077),
+    UINT64_C( 4389322720306063027), UINT64_C(  685400175851316156), UINT64_C( 2370049507009080760),
+    UINT64_C( 3172066150783512600), UINT64_C( 1361761461888066093), UINT64_C( 1044401146706852566),
+    UINT64_C( 3097597748165930130), UINT64_C( 2596801024432302985), UINT64_C( 1030215965054952744),
+    UINT64_C(  385770757908462315), UINT64_C(   89901937259524008), UINT64_C(   49318483776098116),
+    UINT64_C( 2734815492851336383), UINT64_C(  942511766632210723), UINT64_C( 3487492969372016186),
+    UINT64_C( 2214213433730165795), UINT64_C( 1365972863225878166), UINT64_C(  213534333928675936),
+    UINT64_C( 1217067112109024256), UINT64_C( 3370615483927805111), UINT64_C(  331008071283198498),
+    UINT64_C( 1218769917950358612), UINT64_C( 4154352184849207477), UINT64_C( 2308342209152691040),
+    UINT64_C(  490079728691177042), UINT64_C(  869173883498632863), UINT64_C( 1373290829529926976),
+    UINT64_C(  447428903215342719), UINT64_C( 1334108140963731887), UINT64_C(  234809061531476887),
+    UINT64_C( 2296950020239488805), UINT64_C( 2419031109686561638), UINT64_C( 4037114839065063084),
+    UINT64_C( 2950161371412402896), UINT64_C( 2298087391389824104), UINT64_C( 3682127656795400699),
+    UINT64_C(  706144719799758441), UINT64_C( 4443047538019427593), UINT64_C( 1084738989767016719),
+    UINT64_C( 3721389930257549409), UINT64_C( 1688292499388007393), UINT64_C( 1300210680856899347),
+    UINT64_C(  227921074365688802), UINT64_C( 1842615612368354497), UINT64_C( 3988225595075851037),
+    UINT64_C( 2676210263234941926), UINT64_C( 3436014263075695111), UINT64_C(  263637743407343746),
+    UINT64_C( 1359394696637062210), UINT64_C( 4391989867934207415), UINT64_C( 4354964862091784544),
+    UINT64_C( 2622864515154075147), UINT64_C( 1854522643282304425), UINT64_C( 2657438284789770960),
+    UINT64_C(   47240480759893108), UINT64_C(   86969233091873012), UINT64_C( 3346221758441642400),
+    UINT64_C( 2418254001624659624), UINT64_C( 3286818059444468376), UINT64_C( 4541955249605003808),
+    UINT64_C( 2091943141357137645), UINT64_C(  915969065129314377), UINT64_C(  688026410288222148),
+    UINT64_C( 4022767753782152272), UINT64_C(  266453965578522078), UINT64_C( 1970705841300989217),
+    UINT64_C( 1179317760430472932), UINT64_C( 4359325251833636030), UINT64_C( 3041380130487857690),
+    UINT64_C(  139490077637179889), UINT64_C( 3613343733206840369), UINT64_C( 3716165778433263976),
+    UINT64_C( 4523373017153855388), UINT64_C( 2074581773178369824), UINT64_C( 4519016613408284383),
+    UINT64_C( 3766314570829488647), UINT64_C( 1459176627240636952), UINT64_C( 3454435399983609484),
+    UINT64_C( 2107651826156979027), UINT64_C(  125165356278636575), UINT64_C( 2678229115631223377),
+    UINT64_C( 2062182020421627244), UINT64_C( 3481615102258042497), UINT64_C( 1849160754478801782),
+    UINT64_C( 1302547591645079863), UINT64_C( 1347513035217080243), UINT64_C( 4396745417903152580),
+    UINT64_C( 2973329062899545170), UINT64_C( 3132167013330314154), UINT64_C( 1006352626196175146),
+    UINT64_C(  696315246081945734), UINT64_C( 1051719673050458959), UINT64_C( 2137443489648467722),
+    UINT64_C( 3972631746810885831), UINT64_C( 1166840412541945381), UINT64_C( 4557284773527364931),
+    UINT64_C(  260966410467664596), UINT64_C(   13256803360230936), UINT64_C( 3540619593564635243),
+    UINT64_C( 4136767868326397556), UINT64_C( 1276609820644503207), UINT64_C( 2093542254857539782),
+    UINT64_C( 1309825015972462495), UINT64_C( 1158366700570832516), UINT64_C( 3648113786199744239),
+    UINT64_C(  115292498941482581), UINT64_C( 4129446904813725372), UINT64_C( 4351756900966242687),
+    UINT64_C( 3474715846492304988), UINT64_C(                   0), UINT64_C(                   4),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C(                   4),
+    UINT64_C( 7603858705401938139), UINT64_C(12056949092800237063), UINT64_C(15399314395201706410),
+    UINT64_C(                   4), UINT64_C(16095585161216792975), UINT64_C( 7603858705401938139),
+    UINT64_C( 5044858856783534954), UINT64_C(12056949092800237063), UINT64_C(  935015860473793947),
+    UINT64_C(15399314395201706410), UINT64_C(10704841052939819994), UINT64_C(                   4),
+    UINT64_C(14823511509961865041), UINT64_C(16095585161216792975), UINT64_C(10837856322613628300),
+    UINT64_C( 7603858705401938139), UINT64_C( 3527826048668878276), UINT64_C( 5044858856783534954),
+    UINT64_C( 9562219288038263513), UINT64_C(12056949092800237063), UINT64_C( 6801747814650478768),
+    UINT64_C(  935015860473793947), UINT64_C( 8186794253328016406), UINT64_C(15399314395201706410),
+    UINT64_C( 3770047066528861307), UINT64_C(10704841052939819994), UINT64_C(13817741599934505432),
+    UINT64_C(                   4), UINT64_C( 8272674114655418646), UINT64_C(14823511509961865041),
+    UINT64_C( 6636974752260600928), UINT64_C(16095585161216792975), UINT64_C(12070056983459514179),
+    UINT64_C(10837856322613628300), UINT64_C( 4645877627644259550), UINT64_C( 7603858705401938139),
+    UINT64_C(  524524789911762958), UINT64_C( 3527826048668878276), UINT64_C(14685068185283478013),
+    UINT64_C( 5044858856783534954), UINT64_C(15958330216678504264), UINT64_C( 9562219288038263513),
+    UINT64_C( 7518592205968233530), UINT64_C(12056949092800237063), UINT64_C( 9300257820891667993),
+    UINT64_C( 6801747814650478768), UINT64_C( 7403630015146204752), UINT64_C(  935015860473793947),
+    UINT64_C(15606678242288721550), UINT64_C( 8186794253328016406), UINT64_C( 5629106033785832752),
+    UINT64_C(15399314395201706410), UINT64_C(13700435474456645115), UINT64_C( 3770047066528861307),
+    UINT64_C(  939236246125912135), UINT64_C(10704841052939819994), UINT64_C( 3663876260517275405),
+    UINT64_C(13817741599934505432), UINT64_C(15890526987243620945), UINT64_C(                   4),
+    UINT64_C(18363187131404708859), UINT64_C( 8272674114655418646), UINT64_C(14204288525935746332),
+    UINT64_C(14823511509961865041), UINT64_C( 9748677097063844747), UINT64_C( 6636974752260600928),
+    UINT64_C( 5022945591500869479), UINT64_C(16095585161216792975), UINT64_C(15478691441689093085),
+    UINT64_C(12070056983459514179), UINT64_C(13454734720994210547), UINT64_C(10837856322613628300),
+    UINT64_C(12970158159567782300), UINT64_C( 4645877627644259550), UINT64_C( 9870433017619998234),
+    UINT64_C( 7603858705401938139), UINT64_C(15323230751358392006), UINT64_C(  524524789911762958),
+    UINT64_C(13508975171084961660), UINT64_C( 3527826048668878276), UINT64_C(17008713017796795127),
+    UINT64_C(14685068185283478013), UINT64_C( 2771923343720792784), UINT64_C( 5044858856783534954),
+    UINT64_C(15545093430797142494), UINT64_C(15958330216678504264), UINT64_C( 7441811111581718715),
+    UINT64_C( 9562219288038263513), UINT64_C( 8488069535807066230), UINT64_C( 7518592205968233530),
+    UINT64_C( 7480107884525257642), UINT64_C(12056949092800237063), UINT64_C(10760032883403366612),
+    UINT64_C( 9300257820891667993), UINT64_C( 3392776274373824360), UINT64_C( 6801747814650478768),
+    UINT64_C(16223430760769901807), UINT64_C( 7403630015146204752), UINT64_C( 5929482543053587160),
+    UINT64_C(  935015860473793947), UINT64_C( 9999053415530750839), UINT64_C(15606678242288721550),
+    UINT64_C(12449341400208309288), UINT64_C( 8186794253328016406), UINT64_C( 3082018651885430046),
+    UINT64_C( 5629106033785832752), UINT64_C( 9968757564490533415), UINT64_C(15399314395201706410),
+    UINT64_C(13485945174540913643), UINT64_C(13700435474456645115), UINT64_C( 4177604586827430670),
+    UINT64_C( 3770047066528861307), UINT64_C( 4875079671801458261), UINT64_C(  939236246125912135),
+    UINT64_C(17772190152077797184), UINT64_C(10704841052939819994), UINT64_C(10629753139159135763),
+    UINT64_C( 3663876260517275405), UINT64_C(  557960310548722281), UINT64_C(13817741599934505432),
+    UINT64_C( 5390052140868347301), UINT64_C(15890526987243620945), UINT64_C( 8374169019430200033),
+    UINT64_C(                   4), UINT64_C(16180954858396087424), UINT64_C(18363187131404708859),
+    UINT64_C( 7073441495741033812), UINT64_C( 8272674114655418646), UINT64_C( 4531945126003614861),
+    UINT64_C(14204288525935746332), UINT64_C( 4581692930448803892), UINT64_C(14823511509961865041),
+    UINT64_C(12693002747400477502), UINT64_C( 9748677097063844747), UINT64_C(15661714981525014251),
+    UINT64_C( 6636974752260600928), UINT64_C( 1549634253303188093), UINT64_C( 5022945591500869479),
+    UINT64_C(  795028493834076427), UINT64_C(16095585161216792975), UINT64_C( 1305369207991983600),
+    UINT64_C(15478691441689093085), UINT64_C( 3866536531466683071), UINT64_C(12070056983459514179),
+    UINT64_C(17320848506065100368), UINT64_C(13454734720994210547), UINT64_C(10882197785983543072),
+    UINT64_C(10837856322613628300), UINT64_C( 2378088898928169980), UINT64_C(12970158159567782300),
+    UINT64_C(10376839016181397876), UINT64_C( 4645877627644259550), UINT64_C(17484831985982624781),
+    UINT64_C( 9870433017619998234), UINT64_C(14498363592526867533), UINT64_C( 7603858705401938139),
+    UINT64_C( 3699304671320783718), UINT64_C(15323230751358392006), UINT64_C(12861782840510144670),
+    UINT64_C(  524524789911762958), UINT64_C( 2131574955856399208), UINT64_C(13508975171084961660),
+    UINT64_C( 1025978483713168327), UINT64_C( 3527826048668878276), UINT64_C(15353062762322865644),
+    UINT64_C(17008713017796795127), UINT64_C( 8252238387093709242), UINT64_C(14685068185283478013),
+    UINT64_C( 6440255585648176779), UINT64_C( 2771923343720792784), UINT64_C( 4421013741595730431),
+    UINT64_C( 5044858856783534954), UINT64_C( 1096610553773161688), UINT64_C(15545093430797142494),
+    UINT64_C( 6545861174197572826), UINT64_C(15958330216678504264), UINT64_C(10872822215124667463),
+    UINT64_C( 7441811111581718715), UINT64_C(11783439202461196635), UINT64_C( 9562219288038263513),
+    UINT64_C( 2385024958896746858), UINT64_C( 8488069535807066230), UINT64_C(17369516751451888769),
+    UINT64_C( 7518592205968233530), UINT64_C( 3283009077575642824), UINT64_C( 7480107884525257642),
+    UINT64_C(  788773449283363516), UINT64_C(12056949092800237063), UINT64_C(16039538274196874157),
+    UINT64_C(10760032883403366612), UINT64_C( 1059934365190267585), UINT64_C( 9300257820891667993),
+    UINT64_C(12908748873725960096), UINT64_C( 3392776274373824360), UINT64_C( 7505153196371828040),
+    UINT64_C( 6801747814650478768), UINT64_C(13039109273954694652), UINT64_C(16223430760769901807),
+    UINT64_C(  311650362020626222), UINT64_C( 7403630015146204752), UINT64_C(11526461319678639460),
+    UINT64_C( 5929482543053587160), UINT64_C(17303987744167040597), UINT64_C(  935015860473793947),
+    UINT64_C( 5952147050561432186), UINT64_C( 9999053415530750839), UINT64_C( 6917212468786927852),
+    UINT64_C(15606678242288721550), UINT64_C(10873224313681512109), UINT64_C(12449341400208309288),
+    UINT64_C(15519682344957746721), UINT64_C( 8186794253328016406), UINT64_C( 9118791839529518139),
+    UINT64_C( 3082018651885430046), UINT64_C(13963486138935630568), UINT64_C( 5629106033785832752),
+    UINT64_C( 4475772722859079995), UINT64_C( 9968757564490533415), UINT64_C( 3810508832414219537),
+    UINT64_C(15399314395201706410), UINT64_C( 4495506554501186747), UINT64_C(13485945174540913643),
+    UINT64_C(11206654282706656445), UINT64_C(13700435474456645115), UINT64_C( 2741600703405278016),
+    UINT64_C( 4177604586827430670), UINT64_C( 1543083031633856797), UINT64_C( 3770047066528861307),
+    UINT64_C(  854137335714707916), UINT64_C( 4875079671801458261), UINT64_C( 3476695533994548434),
+    UINT64_C(  939236246125912135), UINT64_C(11800645485649669227), UINT64_C(17772190152077797184),
+    UINT64_C( 5200842723427622792), UINT64_C(10704841052939819994), UINT64_C(17567959471736915475),
+    UINT64_C(10629753139159135763), UINT64_C( 9673016006498685746), UINT64_C( 3663876260517275405),
+    UINT64_C( 7882823365203995373), UINT64_C(  557960310548722281), UINT64_C( 8298327092713519831),
+    UINT64_C(13817741599934505432), UINT64_C( 8248728081686549269), UINT64_C( 5390052140868347301),
+    UINT64_C( 4025410504784720247), UINT64_C(15890526987243620945), UINT64_C(   53027213440924003),
+    UINT64_C( 8374169019430200033), UINT64_C(  461169995765932576), UINT64_C(                   4),
+    UINT64_C(17591714041449082671), UINT64_C(16180954858396087424), UINT64_C( 9968029947273057815),
+    UINT64_C(18363187131404708859), UINT64_C( 6543765375770076288), UINT64_C( 7073441495741033812),
+    UINT64_C( 2639681960449907978), UINT64_C( 8272674114655418646), UINT64_C( 4969161675331233633),
+    UINT64_C( 4531945126003614861), UINT64_C( 6607473285056421255), UINT64_C(14204288525935746332),
+    UINT64_C( 5920132444702412610), UINT64_C( 4581692930448803892), UINT64_C(11316930621535193020),
+    UINT64_C(14823511509961865041), UINT64_C(17392144101620672248), UINT64_C(12693002747400477502),
+    UINT64_C( 6950795527915050192), UINT64_C( 9748677097063844747), UINT64_C(10371518997718156574),
+    UINT64_C(15661714981525014251), UINT64_C(10622473298289909284), UINT64_C( 6636974752260600928),
+    UINT64_C(18236458769399661608), UINT64_C( 1549634253303188093), UINT64_C( 8023190261630392515),
+    UINT64_C( 5022945591500869479), UINT64_C(10949120766879761863), UINT64_C(  795028493834076427),
+    UINT64_C(  321258353817470781), UINT64_C(16095585161216792975), UINT64_C(11565803673056906512),
+    UINT64_C( 1305369207991983600), UINT64_C( 3970765379799260900), UINT64_C(15478691441689093085),
+    UINT64_C(  519243668578310200), UINT64_C( 3866536531466683071), UINT64_C( 2783090654961380186),
+    UINT64_C(12070056983459514179), UINT64_C( 8564489954378429807), UINT64_C(17320848506065100368),
+    UINT64_C( 7319294368875455069), UINT64_C(13454734720994210547), UINT64_C(10751118631995671312),
+    UINT64_C(10882197785983543072), UINT64_C( 2537190792027621301), UINT64_C(10837856322613628300),
+    UINT64_C(16024157607726461142), UINT64_C( 2378088898928169980), UINT64_C(15063437242703570969),
+    UINT64_C(12970158159567782300), UINT64_C(10964969827720034861), UINT64_C(10376839016181397876),
+    UINT64_C(11888728375223892849), UINT64_C( 4645877627644259550), UINT64_C( 6210088696389294386),
+    UINT64_C(17484831985982624781), UINT64_C( 4215584393657131024), UINT64_C( 9870433017619998234),
+    UINT64_C( 3807710096486065111), UINT64_C(14498363592526867533), UINT64_C(15539449267741275110),
+    UINT64_C( 7603858705401938139), UINT64_C(17063746427376064836), UINT64_C( 3699304671320783718),
+    UINT64_C(11345110729558017594), UINT64_C(15323230751358392006), UINT64_C( 3189191896661910410),
+    UINT64_C(12861782840510144670), UINT64_C(11793435634082451524), UINT64_C(  524524789911762958),
+    UINT64_C(14149328764061573648), UINT64_C( 2131574955856399208), UINT64_C(17714177090965904433),
+    UINT64_C(13508975171084961660), UINT64_C( 9379350031379565491), UINT64_C( 1025978483713168327),
+    UINT64_C( 1161365655305589260), UINT64_C( 3527826048668878276), UINT64_C( 6476077475534711122),
+    UINT64_C(15353062762322865644), UINT64_C( 1470840994654283480), UINT64_C(17008713017796795127),
+    UINT64_C(17531041394046458963), UINT64_C( 8252238387093709242), UINT64_C(17159814169809758949),
+    UINT64_C(14685068185283478013), UINT64_C( 3267115454208414131), UINT64_C( 6440255585648176779),
+    UINT64_C( 8237529382254686174), UINT64_C( 2771923343720792784), UINT64_C( 6344135347345683345),
+    UINT64_C( 4421013741595730431), UINT64_C(16140506472986348266), UINT64_C( 5044858856783534954),
+    UINT64_C(14150460357275822369), UINT64_C( 1096610553773161688), UINT64_C(14390319241434363093),
+    UINT64_C(15545093430797142494), UINT64_C( 7670031648500858558), UINT64_C( 6545861174197572826),
+    UINT64_C(17082266855006719086), UINT64_C(15958330216678504264), UINT64_C( 9278499731587959531),
+    UINT64_C(10872822215124667463), UINT64_C( 4394342138638275529), UINT64_C( 7441811111581718715),
+    UINT64_C(  819585434212381271), UINT64_C(11783439202461196635), UINT64_C( 3765903746025108887),
+    UINT64_C( 9562219288038263513), UINT64_C(11337322928032803032), UINT64_C( 2385024958896746858),
+    UINT64_C(13080675063835488736), UINT64_C( 8488069535807066230), UINT64_C( 3781539743790695007),
+    UINT64_C(17369516751451888769), UINT64_C( 7491448803264988693), UINT64_C( 7518592205968233530),
+    UINT64_C(16831094245963614355), UINT64_C( 3283009077575642824), UINT64_C(14656129054190166051),
+    UINT64_C( 7480107884525257642), UINT64_C(  936166740933033792), UINT64_C(  788773449283363516),
+    UINT64_C( 8310393855344440966), UINT64_C(12056949092800237063), UINT64_C(10487169474399915347),
+    UINT64_C(16039538274196874157), UINT64_C( 3970542096867280507), UINT64_C(10760032883403366612),
+    UINT64_C( 1555010984183863935), UINT64_C( 1059934365190267585), UINT64_C(16412071153753638257),
+    UINT64_C( 9300257820891667993), UINT64_C( 3172978149511685375), UINT64_C(12908748873725960096),
+    UINT64_C(12999870972329895437), UINT64_C( 3392776274373824360), UINT64_C(10155112748119555389),
+    UINT64_C( 7505153196371828040), UINT64_C(14922703530856633565), UINT64_C( 6801747814650478768),
+    UINT64_C( 5912670226056224838), UINT64_C(13039109273954694652), UINT64_C(18176687840881555628),
+    UINT64_C(16223430760769901807), UINT64_C( 3068156232798275191), UINT64_C(  311650362020626222),
+    UINT64_C( 2479959339141346850), UINT64_C( 7403630015146204752), UINT64_C( 8803131986562446677),
+    UINT64_C(11526461319678639460), UINT64_C(15142608226500847568), UINT64_C( 5929482543053587160),
+    UINT64_C( 6530988684136536054), UINT64_C(17303987744167040597), UINT64_C(12344888121779638533),
+    UINT64_C(  935015860473793947), UINT64_C( 6333410354478878381), UINT64_C( 5952147050561432186),
+    UINT64_C( 3608762760598285911), UINT64_C( 9999053415530750839), UINT64_C(14780950571222436065),
+    UINT64_C( 6917212468786927852), UINT64_C(14555047047361242149), UINT64_C(15606678242288721550),
+    UINT64_C(  872608656828928266), UINT64_C(10873224313681512109), UINT64_C(11615029927461391060),
+    UINT64_C(12449341400208309288), UINT64_C(16542916448154141504), UINT64_C(15519682344957746721),
+    UINT64_C(  601324993980182841), UINT64_C( 8186794253328016406), UINT64_C( 3838793860466319591),
+    UINT64_C( 9118791839529518139), UINT64_C(16444609083007748892), UINT64_C( 3082018651885430046),
+    UINT64_C( 6118270360949384774), UINT64_C(13963486138935630568), UINT64_C(14372054492503594768),
+    UINT64_C( 5629106033785832752), UINT64_C( 3491598857544930719), UINT64_C( 4475772722859079995),
+    UINT64_C( 8886449909830682420), UINT64_C( 9968757564490533415), UINT64_C( 9248524634501061960),
+    UINT64_C( 3810508832414219537), UINT64_C(11759901578089697684), UINT64_C(15399314395201706410),
+    UINT64_C( 3702864191111446583), UINT64_C( 4495506554501186747), UINT64_C(16432311755922067923),
+    UINT64_C(13485945174540913643), UINT64_C( 8898115076940412253), UINT64_C(11206654282706656445),
+    UINT64_C(16888525546311936260), UINT64_C(13700435474456645115), UINT64_C( 1097344932148957668),
+    UINT64_C( 2741600703405278016), UINT64_C(12688264603134112379), UINT64_C( 4177604586827430670),
+    UINT64_C(10387204097729262679), UINT64_C( 1543083031633856797), UINT64_C(  197273935104393427),
+    UINT64_C( 3770047066528861307), UINT64_C( 8856853734920706443), UINT64_C(  854137335714707916),
+    UINT64_C(13482461935711286302), UINT64_C( 4875079671801458261), UINT64_C( 9233368836610809262),
+    UINT64_C( 3476695533994548434), UINT64_C( 1789715612861379618), UINT64_C(  939236246125912135),
+    UINT64_C( 9676124438746293817), UINT64_C(11800645485649669227), UINT64_C(14728510627181674741),
+    UINT64_C(17772190152077797184), UINT64_C(14885559721030270348), UINT64_C( 5200842723427622792),
+    UINT64_C( 7370462449473453990), UINT64_C(10704841052939819994), UINT64_C( 1054550973629380135),
+    UINT64_C(17567959471736915475), UINT64_C(10491458060616351836), UINT64_C(10629753139159135763),
+    UINT64_C(  347876932367493747), UINT64_C( 9673016006498685746), UINT64_C(18167820998420103977),
+    UINT64_C( 3663876260517275405), UINT64_C(16091071015128687689), UINT64_C( 7882823365203995373),
+    UINT64_C(17437301007334629297), UINT64_C(  557960310548722281), UINT64_C(14864663113733128514),
+    UINT64_C( 8298327092713519831), UINT64_C(15065258283318028178), UINT64_C(13817741599934505432),
+    UINT64_C(  500661425114548745), UINT64_C( 8248728081686549269), UINT64_C( 7396643017915243258),
+    UINT64_C( 5390052140868347301), UINT64_C(11893316251598238776), UINT64_C( 4025410504784720247),
+    UINT64_C( 4206878692201856385), UINT64_C(15890526987243620945), UINT64_C(18229139094109548769),
+    UINT64_C(   53027213440924003), UINT64_C(16547071473305671052), UINT64_C( 8374169019430200033),
+    UINT64_C( 4633466802283352697), UINT64_C(  461169995765932576), UINT64_C(17407027603865055777),
+    UINT64_C(                   4), UINT64_C( 9602846956479447923), UINT64_C(17591714041449082671),
+    UINT64_C(16642113286809151228), UINT64_C(16180954858396087424), UINT64_C( 6376862649565533805),
+    UINT64_C( 9968029947273057815), UINT64_C(17915016298027692154), UINT64_C(18363187131404708859),
+    UINT64_C(14470096555450574343), UINT64_C( 6543765375770076288), UINT64_C(15864413509363240641),
+    UINT64_C( 7073441495741033812), UINT64_C(10747217473793532729), UINT64_C( 2639681960449907978),
+    UINT64_C(10905297447288144061), UINT64_C( 8272674114655418646), UINT64_C( 3939402899076868167),
+    UINT64_C( 4969161675331233633), UINT64_C(13945232710941063247), UINT64_C( 4531945126003614861),
+    UINT64_C( 8675113891999301343), UINT64_C( 6607473285056421255), UINT64_C( 3108156558539612522),
+    UINT64_C(14204288525935746332), UINT64_C(18368333938429795364), UINT64_C( 5920132444702412610),
+    UINT64_C(13710478091613637420), UINT64_C( 4581692930448803892), UINT64_C(12401504102449096566),
+    UINT64_C(11316930621535193020), UINT64_C( 3671177558198870464), UINT64_C(14823511509961865041),
+    UINT64_C( 3607439390457286989), UINT64_C(17392144101620672248), UINT64_C( 5785284834068479863),
+    UINT64_C(12693002747400477502), UINT64_C(15102524632494762308), UINT64_C( 6950795527915050192),
+    UINT64_C(12064813699278939161), UINT64_C( 9748677097063844747), UINT64_C( 1887599300156476464),
+    UINT64_C(10371518997718156574), UINT64_C( 9467468822029328010), UINT64_C(15661714981525014251),
+    UINT64_C( 4563935455468076809), UINT64_C(10622473298289909284), UINT64_C( 3926495866587298520),
+    UINT64_C( 6636974752260600928), UINT64_C( 3292228085055616561), UINT64_C(18236458769399661608),
+    UINT64_C(14467920957679420804), UINT64_C( 1549634253303188093), UINT64_C( 2261616490505124707),
+    UINT64_C( 8023190261630392515), UINT64_C(15824546467527834495), UINT64_C( 5022945591500869479),
+    UINT64_C( 7336887022054615054), UINT64_C(10949120766879761863), UINT64_C( 4253512507409266577),
+    UINT64_C(  795028493834076427), UINT64_C(15876439695440582360), UINT64_C(  321258353817470781),
+    UINT64_C(12750410154721500074), UINT64_C(16095585161216792975), UINT64_C( 9290912606262456587),
+    UINT64_C(11565803673056906512), UINT64_C(   77515901797299646), UINT64_C( 1305369207991983600),
+    UINT64_C(18422282258182957116), UINT64_C( 3970765379799260900), UINT64_C( 6152375959768026464),
+    UINT64_C(15478691441689093085), UINT64_C( 8849439785483709399), UINT64_C(  519243668578310200),
+    UINT64_C( 7800384383729364671), UINT64_C( 3866536531466683071), UINT64_C( 8808085392561101057),
+    UINT64_C( 2783090654961380186), UINT64_C(10946872264133666568), UINT64_C(12070056983459514179),
+    UINT64_C( 6512734330744205793), UINT64_C( 8564489954378429807), UINT64_C(12596053436503882636),
+    UINT64_C(17320848506065100368), UINT64_C(16198056512885989147), UINT64_C( 7319294368875455069),
+    UINT64_C(12580089363017589374), UINT64_C(13454734720994210547), UINT64_C(11278357194196069992),
+    UINT64_C(10751118631995671312), UINT64_C(14673893254291298962), UINT64_C(10882197785983543072),
+    UINT64_C(16960425789927278755), UINT64_C( 2537190792027621301), UINT64_C(10969861733074502397),
+    UINT64_C(10837856322613628300), UINT64_C( 5986079315466035276), UINT64_C(16024157607726461142),
+    UINT64_C( 9817439620703570771), UINT64_C( 2378088898928169980), UINT64_C(14816598902352938915),
+    UINT64_C(15063437242703570969), UINT64_C( 7124707266952677798), UINT64_C(12970158159567782300),
+    UINT64_C( 1551597112537180207), UINT64_C(10964969827720034861), UINT64_C( 2174659133622257154),
+    UINT64_C(10376839016181397876), UINT64_C(14149388754851666868), UINT64_C(11888728375223892849),
+    UINT64_C( 6316949314195301248), UINT64_C( 4645877627644259550), UINT64_C( 2429349674943213890),
+    UINT64_C( 6210088696389294386), UINT64_C( 4960775307004705376), UINT64_C(17484831985982624781),
+    UINT64_C( 4948623550341113988), UINT64_C( 4215584393657131024), UINT64_C( 8140712773885988125),
+    UINT64_C( 9870433017619998234), UINT64_C(14369402153897784231), UINT64_C( 3807710096486065111),
+    UINT64_C(  737773358452074895), UINT64_C(14498363592526867533), UINT64_C( 7721280331879501728),
+    UINT64_C(15539449267741275110), UINT64_C( 8373056217427819556), UINT64_C( 7603858705401938139),
+    UINT64_C(14117959256177033806), UINT64_C(17063746427376064836), UINT64_C( 3060233673408366092),
+    UINT64_C( 3699304671320783718), UINT64_C(17324557178567522610), UINT64_C(11345110729558017594),
+    UINT64_C(13478968505213928753), UINT64_C(15323230751358392006), UINT64_C( 6343955911785279236),
+    UINT64_C( 3189191896661910410), UINT64_C( 3916899342837777657), UINT64_C(12861782840510144670),
+    UINT64_C(11862938250978756171), UINT64_C(11793435634082451524), UINT64_C( 5731007217301644630),
+    UINT64_C(  524524789911762958), UINT64_C(  966038993749216230), UINT64_C(14149328764061573648),
+    UINT64_C(13951624053902370410), UINT64_C( 2131574955856399208), UINT64_C(10140245690203043896),
+    UINT64_C(17714177090965904433), UINT64_C( 9261514582424403488), UINT64_C(13508975171084961660),
+    UINT64_C(17183502351505418941), UINT64_C( 9379350031379565491), UINT64_C(  623149655051625567),
+    UINT64_C( 1025978483713168327), UINT64_C(18316074093477273757), UINT64_C( 1161365655305589260),
+    UINT64_C(10707439233023848579), UINT64_C( 3527826048668878276), UINT64_C( 2328354172498632485),
+    UINT64_C( 6476077475534711122), UINT64_C( 5969080232253428645), UINT64_C(15353062762322865644),
+    UINT64_C( 6871640657593842650), UINT64_C( 1470840994654283480), UINT64_C( 6933831043195668658),
+    UINT64_C(17008713017796795127), UINT64_C(12003543614812927806), UINT64_C(17531041394046458963),
+    UINT64_C(  547084928892834156), UINT64_C( 8252238387093709242), UINT64_C( 3484060994537231902),
+    UINT64_C(17159814169809758949), UINT64_C(12532204829496819920), UINT64_C(14685068185283478013),
+    UINT64_C( 4367656130668521006), UINT64_C( 3267115454208414131), UINT64_C( 7953484326609285118),
+    UINT64_C( 6440255585648176779), UINT64_C( 6706163976304547842), UINT64_C( 8237529382254686174),
+    UINT64_C( 7379563882259490631), UINT64_C( 2771923343720792784), UINT64_C( 6458191046505403946),
+    UINT64_C( 6344135347345683345), UINT64_C(17383344486556161385), UINT64_C( 4421013741595730431),
+    UINT64_C( 6438206226729947589), UINT64_C(16140506472986348266), UINT64_C( 4129505073859615839),
+    UINT64_C( 5044858856783534954), UINT64_C(  125472715915699032), UINT64_C(14150460357275822369),
+    UINT64_C( 7455367607192530677), UINT64_C( 1096610553773161688), UINT64_C(13846480860139137760),
+    UINT64_C(14390319241434363093), UINT64_C( 3395905850746651040), UINT64_C(15545093430797142494),
+    UINT64_C(13210549944369006430), UINT64_C( 7670031648500858558), UINT64_C(15836611207929314978),
+    UINT64_C( 6545861174197572826), UINT64_C(13119655260921301214), UINT64_C(17082266855006719086),
+    UINT64_C( 3753746119953759424), UINT64_C(15958330216678504264), UINT64_C(16955334721617248426),
+    UINT64_C( 9278499731587959531), UINT64_C( 3848617669525510451), UINT64_C(10872822215124667463),
+    UINT64_C(12447719805480597392), UINT64_C( 4394342138638275529), UINT64_C(16334008992497835247),
+    UINT64_C( 7441811111581718715), UINT64_C(16193017111473049863), UINT64_C(  819585434212381271),
+    UINT64_C(17528817113587444876), UINT64_C(11783439202461196635), UINT64_C( 9488509130365842669),
+    UINT64_C( 3765903746025108887), UINT64_C(14882763651574308198), UINT64_C( 9562219288038263513),
+    UINT64_C( 5862887961914224506), UINT64_C(11337322928032803032), UINT64_C( 5915223618629138346),
+    UINT64_C( 2385024958896746858), UINT64_C( 3913052082319431210), UINT64_C(13080675063835488736),
+    UINT64_C( 4977363436130901249), UINT64_C( 8488069535807066230), UINT64_C(13582926280524164425),
+    UINT64_C( 3781539743790695007), UINT64_C( 2043226222224532012), UINT64_C(17369516751451888769),
+    UINT64_C( 2443442121860501859), UINT64_C( 7491448803264988693), UINT64_C(15297166958091227027),
+    UINT64_C( 7518592205968233530), UINT64_C( 5271684421725027866), UINT64_C(16831094245963614355),
+    UINT64_C(  980069967993924235), UINT64_C( 3283009077575642824), UINT64_C(17126632556543467083),
+    UINT64_C(14656129054190166051), UINT64_C(16763876526171700003), UINT64_C( 7480107884525257642),
+    UINT64_C( 9529370175764584176), UINT64_C(  936166740933033792), UINT64_C(14101993328870745896),
+    UINT64_C(  788773449283363516), UINT64_C(15209656065600699099), UINT64_C( 8310393855344440966),
+    UINT64_C(17905190626120093514), UINT64_C(12056949092800237063), UINT64_C( 5667918344191683126),
+    UINT64_C(10487169474399915347), UINT64_C( 9020936916954214989), UINT64_C(16039538274196874157),
+    UINT64_C( 8003432860277307338), UINT64_C( 3970542096867280507), UINT64_C( 2505190362012770037),
+    UINT64_C(10760032883403366612), UINT64_C(11038004800741559898), UINT64_C( 1555010984183863935),
+    UINT64_C( 6703581584335318649), UINT64_C( 1059934365190267585), UINT64_C( 9979538736748343391),
+    UINT64_C(16412071153753638257), UINT64_C(12343259230553480845), UINT64_C( 9300257820891667993),
+    UINT64_C(14578072550792146382), UINT64_C( 3172978149511685375), UINT64_C(16382213873157961999),
+    UINT64_C(12908748873725960096), UINT64_C(16292677096923504089), UINT64_C(12999870972329895437),
+    UINT64_C(14125538175393468679), UINT64_C( 3392776274373824360), UINT64_C( 6569974105238481044),
+    UINT64_C(10155112748119555389), UINT64_C(16653935568708848598), UINT64_C( 7505153196371828040),
+    UINT64_C( 5448206815114747329), UINT64_C(14922703530856633565), UINT64_C( 1006354190660639475),
+    UINT64_C( 6801747814650478768), UINT64_C( 4862741898691333125), UINT64_C( 5912670226056224838),
+    UINT64_C( 8056168847574777768), UINT64_C(13039109273954694652), UINT64_C( 6034938327916716503),
+    UINT64_C(18176687840881555628), UINT64_C(16140544552307408190), UINT64_C(16223430760769901807),
+    UINT64_C(17721863723874693219), UINT64_C( 3068156232798275191), UINT64_C(14030469621276462351),
+    UINT64_C(  311650362020626222), UINT64_C(  832719281874824623), UINT64_C( 2479959339141346850),
+    UINT64_C( 2723905631336572781), UINT64_C( 7403630015146204752), UINT64_C( 9305647423279991015),
+    UINT64_C( 8803131986562446677), UINT64_C( 2261671814374445307), UINT64_C(11526461319678639460),
+    UINT64_C( 7199333321024337251), UINT64_C(15142608226500847568), UINT64_C( 7498451141298770696),
+    UINT64_C( 5929482543053587160), UINT64_C( 3893111894527135492), UINT64_C( 6530988684136536054),
+    UINT64_C( 4924833599096014188), UINT64_C(17303987744167040597), UINT64_C(17576901787089669935),
+    UINT64_C(12344888121779638533), UINT64_C(12660881173349229513), UINT64_C(  935015860473793947),
+    UINT64_C( 9476268215771775505), UINT64_C( 6333410354478878381), UINT64_C(15614815431922971966),
+    UINT64_C( 5952147050561432186), UINT64_C( 5321389092124268745), UINT64_C( 3608762760598285911),
+    UINT64_C( 1918353867783673018), UINT64_C( 9999053415530750839), UINT64_C( 4530560230706862402),
+    UINT64_C(14780950571222436065), UINT64_C( 1156400784671394972), UINT64_C( 6917212468786927852),
+    UINT64_C( 6372069586962265614), UINT64_C(14555047047361242149), UINT64_C(13419689232334614092),
+    UINT64_C(15606678242288721550), UINT64_C(12459036914853834151), UINT64_C(  872608656828928266),
+    UINT64_C(13527606189738634283), UINT64_C(10873224313681512109), UINT64_C( 1756429982686777271),
+    UINT64_C(11615029927461391060), UINT64_C( 8294403423437598124), UINT64_C(12449341400208309288),
+    UINT64_C( 3789755731604709772), UINT64_C(16542916448154141504), UINT64_C(13878605502829445089),
+    UINT64_C(15519682344957746721), UINT64_C(14073413096506793773), UINT64_C(  601324993980182841),
+    UINT64_C( 1941964541131184210), UINT64_C( 8186794253328016406), UINT64_C(12234585914450636767),
+    UINT64_C( 3838793860466319591), UINT64_C( 2017450483330716714), UINT64_C( 9118791839529518139),
+    UINT64_C(17697746349523838121), UINT64_C(16444609083007748892), UINT64_C(11658038276153450306),
+    UINT64_C( 3082018651885430046), UINT64_C(10688843203285356036), UINT64_C( 6118270360949384774),
+    UINT64_C( 1933225932853372003), UINT64_C(13963486138935630568), UINT64_C(17932854778881714965),
+    UINT64_C(14372054492503594768), UINT64_C( 3509415609112782850), UINT64_C( 5629106033785832752),
+    UINT64_C( 5868988404886768768), UINT64_C( 3491598857544930719), UINT64_C(17065705830290878557),
+    UINT64_C( 4475772722859079995), UINT64_C(15767305353160295859), UINT64_C( 8886449909830682420),
+    UINT64_C( 9849271684484259143), UINT64_C( 9968757564490533415), UINT64_C( 8082908416152454263),
+    UINT64_C( 9248524634501061960), UINT64_C( 1108377620566694398), UINT64_C( 3810508832414219537),
+    UINT64_C( 4902651124888029448), UINT64_C(11759901578089697684), UINT64_C(15126797936803265022),
+    UINT64_C(15399314395201706410), UINT64_C( 4542748570644371862), UINT64_C( 3702864191111446583),
+    UINT64_C(  665876440616848172), UINT64_C( 4495506554501186747), UINT64_C( 1330298739888944034),
+    UINT64_C(16432311755922067923), UINT64_C( 6790976695889620404), UINT64_C(13485945174540913643),
+    UINT64_C(  738109188503114701), UINT64_C( 8898115076940412253), UINT64_C(14498342048305367048),
+    UINT64_C(11206654282706656445), UINT64_C(13784932478307097156), UINT64_C(16888525546311936260),
+    UINT64_C(12314528772095401417), UINT64_C(13700435474456645115), UINT64_C( 1533219135734455393),
+    UINT64_C( 1097344932148957668), UINT64_C(17557290881224337871), UINT64_C( 2741600703405278016),
+    UINT64_C( 9480198028036369348), UINT64_C(12688264603134112379), UINT64_C( 5447045847552290979),
+    UINT64_C( 4177604586827430670), UINT64_C(12390390992663781044), UINT64_C(10387204097729262679),
+    UINT64_C( 4120863860219831105), UINT64_C( 1543083031633856797), UINT64_C(  359607749038097788),
+    UINT64_C(  197273935104393427), UINT64_C(10939261971405398967), UINT64_C( 3770047066528861307),
+    UINT64_C(13949971877488132886), UINT64_C( 8856853734920706443), UINT64_C( 5463891452903539353),
+    UINT64_C(  854137335714707916), UINT64_C( 4868268448436120804), UINT64_C(13482461935711286302),
+    UINT64_C( 1324032285132800459), UINT64_C( 4875079671801458261), UINT64_C(16617408739396911080),
+    UINT64_C( 9233368836610809262), UINT64_C( 1960318914764717743), UINT64_C( 3476695533994548434),
+    UINT64_C( 5493163318119734736), UINT64_C( 1789715612861379618), UINT64_C( 5336432563854953615),
+    UINT64_C(  939236246125912135), UINT64_C( 9187800080958000100), UINT64_C( 9676124438746293817),
+    UINT64_C(16148459356260331217), UINT64_C(11800645485649669227), UINT64_C( 9192349565559341318),
+    UINT64_C(14728510627181674741), UINT64_C( 2824578879199047561), UINT64_C(17772190152077797184),
+    UINT64_C( 4338955959068088070), UINT64_C(14885559721030270348), UINT64_C( 6753169997552062559),
+    UINT64_C( 5200842723427622792), UINT64_C(  911684297462759661), UINT64_C( 7370462449473453990),
+    UINT64_C(15952902380303482074), UINT64_C(10704841052939819994), UINT64_C(13744057052302847580),
+    UINT64_C( 1054550973629380135), UINT64_C( 5437578786548275401), UINT64_C(17567959471736915475),
+    UINT64_C(17419859448367223267), UINT64_C(10491458060616351836), UINT64_C( 7418090573129253935),
+    UINT64_C(10629753139159135763), UINT64_C(  188961923039573355), UINT64_C(  347876932367493747),
+    UINT64_C(13384887033766634982), UINT64_C( 9673016006498685746), UINT64_C(13147272237777937725),
+    UINT64_C(18167820998420103977), UINT64_C( 8367772565428591454), UINT64_C( 3663876260517275405),
+    UINT64_C( 2752105641152902035), UINT64_C(16091071015128687689), UINT64_C( 1065815862314093518),
+    UINT64_C( 7882823365203995373), UINT64_C( 4717271041721914770), UINT64_C(17437301007334629297),
+    UINT64_C(12165520521951490185), UINT64_C(  557960310548722281), UINT64_C(14453374932827432077),
+    UINT64_C(14864663113733128514), UINT64_C(18093492068615509934), UINT64_C( 8298327092713519831),
+    UINT64_C(18076066453633225829), UINT64_C(15065258283318028178), UINT64_C( 5836706508962576318),
+    UINT64_C(13817741599934505432), UINT64_C( 8430607304627957289), UINT64_C(  500661425114548745),
+    UINT64_C(10712916462524945838), UINT64_C( 8248728081686549269), UINT64_C(13926460409032238015),
+    UINT64_C( 7396643017915243258), UINT64_C( 5210190366580344902), UINT64_C( 5390052140868347301),
+    UINT64_C(17586981671612696228), UINT64_C(11893316251598238776), UINT64_C(12528668053321317815),
+    UINT64_C( 4025410504784720247), UINT64_C( 2785260984327796541), UINT64_C( 4206878692201856385),
+    UINT64_C( 8549773958593912651), UINT64_C(15890526987243620945), UINT64_C( 4667361650167804322),
+    UINT64_C(18229139094109548769), UINT64_C( 1043865641870663483), UINT64_C(   53027213440924003),
+    UINT64_C(14162478374258610152), UINT64_C(16547071473305671052), UINT64_C( 5106439282578037771),
+    UINT64_C( 8374169019430200033), UINT64_C( 5239300063889875572), UINT64_C( 4633466802283352697),
+    UINT64_C(14592455144799048236), UINT64_C(  461169995765932576), UINT64_C(16517787619254982173),
+    UINT64_C(17407027603865055777), UINT64_C(13898863385969287844),
+};
+
+const uint64_t ntt64_1024_omega_powers_rev[2048] = {
+    UINT64_C(                   0), UINT64_C(                   1), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C(                   1), UINT64_C( 3014237273200044542),
+    UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797),
+    UINT64_C( 4023896290304178588), UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578),
+    UINT64_C( 2676210263234941926), UINT64_C(                   1), UINT64_C( 3014237273200044542),
+    UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797), UINT64_C( 4023896290304178588),
+    UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578), UINT64_C( 2676210263234941926),
+    UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386), UINT64_C(  881956512167215261),
+    UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840), UINT64_C( 2046698563331994104),
+    UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797),
+    UINT64_C( 4023896290304178588), UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578),
+    UINT64_C( 2676210263234941926), UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386),
+    UINT64_C(  881956512167215261), UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840),
+    UINT64_C( 2046698563331994104), UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484),
+    UINT64_C( 2068168528663844559), UINT64_C( 2325064455222905641), UINT64_C(  131131197477940099),
+    UINT64_C( 3425108868614144548), UINT64_C( 3017514245864863805), UINT64_C( 3901669560572161329),
+    UINT64_C( 3989582554169606578), UINT64_C(  915969065129314377), UINT64_C( 1659243688065142127),
+    UINT64_C( 1850907503786542147), UINT64_C( 3671267046320851570), UINT64_C(  234809061531476887),
+    UINT64_C( 1161469406911059214), UINT64_C( 1407276508446451314), UINT64_C( 1879648051492049201),
+    UINT64_C( 3972631746810885831), UINT64_C(                   1), UINT64_C( 3014237273200044542),
+    UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797), UINT64_C( 4023896290304178588),
+    UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578), UINT64_C( 2676210263234941926),
+    UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386), UINT64_C(  881956512167215261),
+    UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840), UINT64_C( 2046698563331994104),
+    UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484), UINT64_C( 2068168528663844559),
+    UINT64_C( 2325064455222905641), UINT64_C(  131131197477940099), UINT64_C( 3425108868614144548),
+    UINT64_C( 3017514245864863805), UINT64_C( 3901669560572161329), UINT64_C( 3989582554169606578),
+    UINT64_C(  915969065129314377), UINT64_C( 1659243688065142127), UINT64_C( 1850907503786542147),
+    UINT64_C( 3671267046320851570), UINT64_C(  234809061531476887), UINT64_C( 1161469406911059214),
+    UINT64_C( 1407276508446451314), UINT64_C( 1879648051492049201), UINT64_C( 3972631746810885831),
+    UINT64_C( 4590796782851154790), UINT64_C( 2690008220850828513), UINT64_C( 3830807687839579289),
+    UINT64_C( 3371486293635211942), UINT64_C( 3869672860422254369), UINT64_C( 2499763353882675499),
+    UINT64_C( 3886273357699266640), UINT64_C( 2657438284789770960), UINT64_C( 2437169274265949282),
+    UINT64_C( 4055857690192455640), UINT64_C( 4252178254449178011), UINT64_C( 1218769917950358612),
+    UINT64_C( 3242539539891929736), UINT64_C(  770504662971353748), UINT64_C( 2122017383951756192),
+    UINT64_C( 1347513035217080243), UINT64_C( 3551072131483919237), UINT64_C(  848194068593451947),
+    UINT64_C( 3377243792771223918), UINT64_C( 1044401146706852566), UINT64_C( 3363683680248536206),
+    UINT64_C( 3112335350052062119), UINT64_C( 1860452777895420591), UINT64_C(  139490077637179889),
+    UINT64_C( 1255736397875211236), UINT64_C( 1482370635763389549), UINT64_C(  692980835930194811),
+    UINT64_C( 4443047538019427593), UINT64_C( 2467608254404987505), UINT64_C( 2492189391122621180),
+    UINT64_C( 1870026971131305276), UINT64_C( 2093542254857539782), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797),
+    UINT64_C( 4023896290304178588), UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578),
+    UINT64_C( 2676210263234941926), UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386),
+    UINT64_C(  881956512167215261), UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840),
+    UINT64_C( 2046698563331994104), UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484),
+    UINT64_C( 2068168528663844559), UINT64_C( 2325064455222905641), UINT64_C(  131131197477940099),
+    UINT64_C( 3425108868614144548), UINT64_C( 3017514245864863805), UINT64_C( 3901669560572161329),
+    UINT64_C( 3989582554169606578), UINT64_C(  915969065129314377), UINT64_C( 1659243688065142127),
+    UINT64_C( 1850907503786542147), UINT64_C( 3671267046320851570), UINT64_C(  234809061531476887),
+    UINT64_C( 1161469406911059214), UINT64_C( 1407276508446451314), UINT64_C( 1879648051492049201),
+    UINT64_C( 3972631746810885831), UINT64_C( 4590796782851154790), UINT64_C( 2690008220850828513),
+    UINT64_C( 3830807687839579289), UINT64_C( 3371486293635211942), UINT64_C( 3869672860422254369),
+    UINT64_C( 2499763353882675499), UINT64_C( 3886273357699266640), UINT64_C( 2657438284789770960),
+    UINT64_C( 2437169274265949282), UINT64_C( 4055857690192455640), UINT64_C( 4252178254449178011),
+    UINT64_C( 1218769917950358612), UINT64_C( 3242539539891929736), UINT64_C(  770504662971353748),
+    UINT64_C( 2122017383951756192), UINT64_C( 1347513035217080243), UINT64_C( 3551072131483919237),
+    UINT64_C(  848194068593451947), UINT64_C( 3377243792771223918), UINT64_C( 1044401146706852566),
+    UINT64_C( 3363683680248536206), UINT64_C( 3112335350052062119), UINT64_C( 1860452777895420591),
+    UINT64_C(  139490077637179889), UINT64_C( 1255736397875211236), UINT64_C( 1482370635763389549),
+    UINT64_C(  692980835930194811), UINT64_C( 4443047538019427593), UINT64_C( 2467608254404987505),
+    UINT64_C( 2492189391122621180), UINT64_C( 1870026971131305276), UINT64_C( 2093542254857539782),
+    UINT64_C( 4045238714599002096), UINT64_C( 4009884568549198952), UINT64_C(  924826167830191412),
+    UINT64_C( 1123876638625291197), UINT64_C(  326342301997994306), UINT64_C( 1488036762640350778),
+    UINT64_C(  274152638443289083), UINT64_C( 4391989867934207415), UINT64_C( 3173250686850103875),
+    UINT64_C( 3259777318488657740), UINT64_C( 3838265690580697662), UINT64_C(  213534333928675936),
+    UINT64_C(  594522224732039591), UINT64_C( 2279697959882368399), UINT64_C(  596256239724183802),
+    UINT64_C( 2062182020421627244), UINT64_C( 1132986281500898181), UINT64_C( 3227187218431474260),
+    UINT64_C(  532893738964097199), UINT64_C(  685400175851316156), UINT64_C( 4330212126516253940),
+    UINT64_C( 2718306078420364749), UINT64_C( 2718205553781153588), UINT64_C( 1970705841300989217),
+    UINT64_C(  387408563325795131), UINT64_C( 2881615329919645789), UINT64_C( 1610063896412036330),
+    UINT64_C( 2950161371412402896), UINT64_C( 4371207996495634843), UINT64_C( 1118943180714764533),
+    UINT64_C(  820752269393906697), UINT64_C(   13256803360230936), UINT64_C( 1768360373935249815),
+    UINT64_C(  264983591297565602), UINT64_C( 3215445710127520461), UINT64_C( 2801663570676650426),
+    UINT64_C(  966634132866666046), UINT64_C( 1729303117196723516), UINT64_C( 1636465293549385213),
+    UINT64_C( 2418254001624659624), UINT64_C( 3915428745381234437), UINT64_C(   77912590505156175),
+    UINT64_C( 2063059596773417233), UINT64_C(  869173883498632863), UINT64_C( 2594209754045336797),
+    UINT64_C( 3490871534733890590), UINT64_C( 4342379187862950981), UINT64_C( 1006352626196175146),
+    UINT64_C( 1145423232612195378), UINT64_C( 1876288299092947845), UINT64_C(  256494620928290829),
+    UINT64_C(  385770757908462315), UINT64_C( 2720549446495872479), UINT64_C( 3879920586239417728),
+    UINT64_C( 2945859800615284769), UINT64_C( 2074581773178369824), UINT64_C(  198757123458518136),
+    UINT64_C( 4325996936041739018), UINT64_C( 1105253435398927209), UINT64_C( 1300210680856899347),
+    UINT64_C( 3624590898131699178), UINT64_C(  952627208103550231), UINT64_C(  197193362320839916),
+    UINT64_C(  115292498941482581), UINT64_C(                   1), UINT64_C( 3014237273200044542),
+    UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797), UINT64_C( 4023896290304178588),
+    UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578), UINT64_C( 2676210263234941926),
+    UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386), UINT64_C(  881956512167215261),
+    UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840), UINT64_C( 2046698563331994104),
+    UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484), UINT64_C( 2068168528663844559),
+    UINT64_C( 2325064455222905641), UINT64_C(  131131197477940099), UINT64_C( 3425108868614144548),
+    UINT64_C( 3017514245864863805), UINT64_C( 3901669560572161329), UINT64_C( 3989582554169606578),
+    UINT64_C(  915969065129314377), UINT64_C( 1659243688065142127), UINT64_C( 1850907503786542147),
+    UINT64_C( 3671267046320851570), UINT64_C(  234809061531476887), UINT64_C( 1161469406911059214),
+    UINT64_C( 1407276508446451314), UINT64_C( 1879648051492049201), UINT64_C( 3972631746810885831),
+    UINT64_C( 4590796782851154790), UINT64_C( 2690008220850828513), UINT64_C( 3830807687839579289),
+    UINT64_C( 3371486293635211942), UINT64_C( 3869672860422254369), UINT64_C( 2499763353882675499),
+    UINT64_C( 3886273357699266640), UINT64_C( 2657438284789770960), UINT64_C( 2437169274265949282),
+    UINT64_C( 4055857690192455640), UINT64_C( 4252178254449178011), UINT64_C( 1218769917950358612),
+    UINT64_C( 3242539539891929736), UINT64_C(  770504662971353748), UINT64_C( 2122017383951756192),
+    UINT64_C( 1347513035217080243), UINT64_C( 3551072131483919237), UINT64_C(  848194068593451947),
+    UINT64_C( 3377243792771223918), UINT64_C( 1044401146706852566), UINT64_C( 3363683680248536206),
+    UINT64_C( 3112335350052062119), UINT64_C( 1860452777895420591), UINT64_C(  139490077637179889),
+    UINT64_C( 1255736397875211236), UINT64_C( 1482370635763389549), UINT64_C(  692980835930194811),
+    UINT64_C( 4443047538019427593), UINT64_C( 2467608254404987505), UINT64_C( 2492189391122621180),
+    UINT64_C( 1870026971131305276), UINT64_C( 2093542254857539782), UINT64_C( 4045238714599002096),
+    UINT64_C( 4009884568549198952), UINT64_C(  924826167830191412), UINT64_C( 1123876638625291197),
+    UINT64_C(  326342301997994306), UINT64_C( 1488036762640350778), UINT64_C(  274152638443289083),
+    UINT64_C( 4391989867934207415), UINT64_C( 3173250686850103875), UINT64_C( 3259777318488657740),
+    UINT64_C( 3838265690580697662), UINT64_C(  213534333928675936), UINT64_C(  594522224732039591),
+    UINT64_C( 2279697959882368399), UINT64_C(  596256239724183802), UINT64_C( 2062182020421627244),
+    UINT64_C( 1132986281500898181), UINT64_C( 3227187218431474260), UINT64_C(  532893738964097199),
+    UINT64_C(  685400175851316156), UINT64_C( 4330212126516253940), UINT64_C( 2718306078420364749),
+    UINT64_C( 2718205553781153588), UINT64_C( 1970705841300989217), UINT64_C(  387408563325795131),
+    UINT64_C( 2881615329919645789), UINT64_C( 1610063896412036330), UINT64_C( 2950161371412402896),
+    UINT64_C( 4371207996495634843), UINT64_C( 1118943180714764533), UINT64_C(  820752269393906697),
+    UINT64_C(   13256803360230936), UINT64_C( 1768360373935249815), UINT64_C(  264983591297565602),
+    UINT64_C( 3215445710127520461), UINT64_C( 2801663570676650426), UINT64_C(  966634132866666046),
+    UINT64_C( 1729303117196723516), UINT64_C( 1636465293549385213), UINT64_C( 2418254001624659624),
+    UINT64_C( 3915428745381234437), UINT64_C(   77912590505156175), UINT64_C( 2063059596773417233),
+    UINT64_C(  869173883498632863), UINT64_C( 2594209754045336797), UINT64_C( 3490871534733890590),
+    UINT64_C( 4342379187862950981), UINT64_C( 1006352626196175146), UINT64_C( 1145423232612195378),
+    UINT64_C( 1876288299092947845), UINT64_C(  256494620928290829), UINT64_C(  385770757908462315),
+    UINT64_C( 2720549446495872479), UINT64_C( 3879920586239417728), UINT64_C( 2945859800615284769),
+    UINT64_C( 2074581773178369824), UINT64_C(  198757123458518136), UINT64_C( 4325996936041739018),
+    UINT64_C( 1105253435398927209), UINT64_C( 1300210680856899347), UINT64_C( 3624590898131699178),
+    UINT64_C(  952627208103550231), UINT64_C(  197193362320839916), UINT64_C(  115292498941482581),
+    UINT64_C( 4397928510362249185), UINT64_C( 2621792368599966030), UINT64_C( 4265936606843995371),
+    UINT64_C(  925716047777857124), UINT64_C( 2891450918264212504), UINT64_C( 1583352588619711861),
+    UINT64_C( 3537615089318938312), UINT64_C(  263637743407343746), UINT64_C( 4348036025405146823),
+    UINT64_C( 1478167556514048989), UINT64_C( 1619019368883669872), UINT64_C( 2214213433730165795),
+    UINT64_C( 4006039401931595717), UINT64_C(  959698465116575210), UINT64_C( 2834330732008186913),
+    UINT64_C(  125165356278636575), UINT64_C( 1242290418832802340), UINT64_C(  793244537377917469),
+    UINT64_C( 3537332191015376133), UINT64_C(  274336233037238077), UINT64_C( 2141122488594596993),
+    UINT64_C(  218152164207231001), UINT64_C( 2319624932896978552), UINT64_C( 4022767753782152272),
+    UINT64_C( 4559114692349893132), UINT64_C( 2200782996640600919), UINT64_C(  816778863552099543),
+    UINT64_C( 2419031109686561638), UINT64_C( 1552522174097316013), UINT64_C(  872899714386228416),
+    UINT64_C( 4207773561490883035), UINT64_C( 4557284773527364931), UINT64_C( 1635941343942511081),
+    UINT64_C(  388752746045964085), UINT64_C(  797297974165473708), UINT64_C( 2224528769235092197),
+    UINT64_C(  129810917144576916), UINT64_C( 3695237642805590966), UINT64_C( 1917507912125205273),
+    UINT64_C(   86969233091873012), UINT64_C( 2592879749429526478), UINT64_C(  767039058199565051),
+    UINT64_C( 4382760348511593332), UINT64_C( 2308342209152691040), UINT64_C( 2741242456929995325),
+    UINT64_C( 1529567590237338722), UINT64_C(  945384935947669134), UINT64_C( 2973329062899545170),
+    UINT64_C( 1480033111175595923), UINT64_C( 2538778187029876446), UINT64_C( 2344837507844879919),
+    UINT64_C( 2596801024432302985), UINT64_C( 2687779657998904699), UINT64_C( 4135729112038515174),
+    UINT64_C(  204896358553094317), UINT64_C( 3716165778433263976), UINT64_C( 2737280191719927095),
+    UINT64_C( 1632747171034126038), UINT64_C( 1586033836836413089), UINT64_C( 3721389930257549409),
+    UINT64_C(  951927524121511628), UINT64_C( 2312131158625254196), UINT64_C(  234041685233257305),
+    UINT64_C( 1158366700570832516), UINT64_C( 2492007486818252281), UINT64_C(  992635524216815278),
+    UINT64_C( 2836277682389490544), UINT64_C( 4108077938980496914), UINT64_C(  992691344949810376),
+    UINT64_C(  902190690149567071), UINT64_C( 3597579810358573200), UINT64_C( 2622864515154075147),
+    UINT64_C( 1737698881978754060), UINT64_C( 4544171960220366710), UINT64_C(  367710248663569074),
+    UINT64_C( 3370615483927805111), UINT64_C( 3765859310675874347), UINT64_C( 4111152270751917141),
+    UINT64_C( 3270168765958856210), UINT64_C( 1849160754478801782), UINT64_C( 1651868321264097245),
+    UINT64_C( 3249967743082457984), UINT64_C( 4428544272741454476), UINT64_C( 3172066150783512600),
+    UINT64_C( 1829823592218854829), UINT64_C( 2903757481865333581), UINT64_C( 1098585534659563516),
+    UINT64_C( 4359325251833636030), UINT64_C( 2005797565407588331), UINT64_C( 3785652056625193400),
+    UINT64_C( 2059382345563661484), UINT64_C( 3682127656795400699), UINT64_C( 1053896098414277608),
+    UINT64_C( 2221612477457659753), UINT64_C( 3664032263547523615), UINT64_C( 4136767868326397556),
+    UINT64_C(  659920490112473771), UINT64_C( 4103017788438389522), UINT64_C( 2948358908520598479),
+    UINT64_C( 4222131386577963441), UINT64_C(  695772663740341648), UINT64_C( 3638761761840292763),
+    UINT64_C( 4270566713751658911), UINT64_C( 4541955249605003808), UINT64_C( 2655618324572464349),
+    UINT64_C(  619989834785333684), UINT64_C( 4289953542452418782), UINT64_C(  447428903215342719),
+    UINT64_C( 2972182093805958694), UINT64_C( 3593013623125881141), UINT64_C( 1872862200816238025),
+    UINT64_C( 1051719673050458959), UINT64_C( 2829232655383784435), UINT64_C( 3730675882714140168),
+    UINT64_C(  290341413826395897), UINT64_C(   49318483776098116), UINT64_C(  634297698006902227),
+    UINT64_C(  150331248495044976), UINT64_C(  941475936506272623), UINT64_C( 3766314570829488647),
+    UINT64_C(   80314588454367303), UINT64_C( 3086222030444894558), UINT64_C( 4035126618246567356),
+    UINT64_C( 1842615612368354497), UINT64_C( 3884862316935299801), UINT64_C( 2939975394522410060),
+    UINT64_C( 2077598463836100093), UINT64_C( 4351756900966242687), UINT64_C(                   1),
+    UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249), UINT64_C( 3849828598800407797),
+    UINT64_C( 4023896290304178588), UINT64_C(  233753965118447345), UINT64_C( 1261214714195877578),
+    UINT64_C( 2676210263234941926), UINT64_C( 3705877877490448158), UINT64_C( 1700436953662611386),
+    UINT64_C(  881956512167215261), UINT64_C(  942511766632210723), UINT64_C( 2709464080653393840),
+    UINT64_C( 2046698563331994104), UINT64_C( 2390554822009554201), UINT64_C( 3454435399983609484),
+    UINT64_C( 2068168528663844559), UINT64_C( 2325064455222905641), UINT64_C(  131131197477940099),
+    UINT64_C( 3425108868614144548), UINT64_C( 3017514245864863805), UINT64_C( 3901669560572161329),
+    UINT64_C( 3989582554169606578), UINT64_C(  915969065129314377), UINT64_C( 1659243688065142127),
+    UINT64_C( 1850907503786542147), UINT64_C( 3671267046320851570), UINT64_C(  234809061531476887),
+    UINT64_C( 1161469406911059214), UINT64_C( 1407276508446451314), UINT64_C( 1879648051492049201),
+    UINT64_C( 3972631746810885831), UINT64_C( 4590796782851154790), UINT64_C( 2690008220850828513),
+    UINT64_C( 3830807687839579289), UINT64_C( 3371486293635211942), UINT64_C( 3869672860422254369),
+    UINT64_C( 2499763353882675499), UINT64_C( 3886273357699266640), UINT64_C( 2657438284789770960),
+    UINT64_C( 2437169274265949282), UINT64_C( 4055857690192455640), UINT64_C( 4252178254449178011),
+    UINT64_C( 1218769917950358612), UINT64_C( 3242539539891929736), UINT64_C(  770504662971353748),
+    UINT64_C( 2122017383951756192), UINT64_C( 1347513035217080243), UINT64_C( 3551072131483919237),
+    UINT64_C(  848194068593451947), UINT64_C( 3377243792771223918), UINT64_C( 1044401146706852566),
+    UINT64_C( 3363683680248536206), UINT64_C( 3112335350052062119), UINT64_C( 1860452777895420591),
+    UINT64_C(  139490077637179889), UINT64_C( 1255736397875211236), UINT64_C( 1482370635763389549),
+    UINT64_C(  692980835930194811), UINT64_C( 4443047538019427593), UINT64_C( 2467608254404987505),
+    UINT64_C( 2492189391122621180), UINT64_C( 1870026971131305276), UINT64_C( 2093542254857539782),
+    UINT64_C( 4045238714599002096), UINT64_C( 4009884568549198952), UINT64_C(  924826167830191412),
+    UINT64_C( 1123876638625291197), UINT64_C(  326342301997994306), UINT64_C( 1488036762640350778),
+    UINT64_C(  274152638443289083), UINT64_C( 4391989867934207415), UINT64_C( 3173250686850103875),
+    UINT64_C( 3259777318488657740), UINT64_C( 3838265690580697662), UINT64_C(  213534333928675936),
+    UINT64_C(  594522224732039591), UINT64_C( 2279697959882368399), UINT64_C(  596256239724183802),
+    UINT64_C( 2062182020421627244), UINT64_C( 1132986281500898181), UINT64_C( 3227187218431474260),
+    UINT64_C(  532893738964097199), UINT64_C(  685400175851316156), UINT64_C( 4330212126516253940),
+    UINT64_C( 2718306078420364749), UINT64_C( 2718205553781153588), UINT64_C( 1970705841300989217),
+    UINT64_C(  387408563325795131), UINT64_C( 2881615329919645789), UINT64_C( 1610063896412036330),
+    UINT64_C( 2950161371412402896), UINT64_C( 4371207996495634843), UINT64_C( 1118943180714764533),
+    UINT64_C(  820752269393906697), UINT64_C(   13256803360230936), UINT64_C( 1768360373935249815),
+    UINT64_C(  264983591297565602), UINT64_C( 3215445710127520461), UINT64_C( 2801663570676650426),
+    UINT64_C(  966634132866666046), UINT64_C( 1729303117196723516), UINT64_C( 1636465293549385213),
+    UINT64_C( 2418254001624659624), UINT64_C( 3915428745381234437), UINT64_C(   77912590505156175),
+    UINT64_C( 2063059596773417233), UINT64_C(  869173883498632863), UINT64_C( 2594209754045336797),
+    UINT64_C( 3490871534733890590), UINT64_C( 4342379187862950981), UINT64_C( 1006352626196175146),
+    UINT64_C( 1145423232612195378), UINT64_C( 1876288299092947845), UINT64_C(  256494620928290829),
+    UINT64_C(  385770757908462315), UINT64_C( 2720549446495872479), UINT64_C( 3879920586239417728),
+    UINT64_C( 2945859800615284769), UINT64_C( 2074581773178369824), UINT64_C(  198757123458518136),
+    UINT64_C( 4325996936041739018), UINT64_C( 1105253435398927209), UINT64_C( 1300210680856899347),
+    UINT64_C( 3624590898131699178), UINT64_C(  952627208103550231), UINT64_C(  197193362320839916),
+    UINT64_C(  115292498941482581), UINT64_C( 4397928510362249185), UINT64_C( 2621792368599966030),
+    UINT64_C( 4265936606843995371), UINT64_C(  925716047777857124), UINT64_C( 2891450918264212504),
+    UINT64_C( 1583352588619711861), UINT64_C( 3537615089318938312), UINT64_C(  263637743407343746),
+    UINT64_C( 4348036025405146823), UINT64_C( 1478167556514048989), UINT64_C( 1619019368883669872),
+    UINT64_C( 2214213433730165795), UINT64_C( 4006039401931595717), UINT64_C(  959698465116575210),
+    UINT64_C( 2834330732008186913), UINT64_C(  125165356278636575), UINT64_C( 1242290418832802340),
+    UINT64_C(  793244537377917469), UINT64_C( 3537332191015376133), UINT64_C(  274336233037238077),
+    UINT64_C( 2141122488594596993), UINT64_C(  218152164207231001), UINT64_C( 2319624932896978552),
+    UINT64_C( 4022767753782152272), UINT64_C( 4559114692349893132), UINT64_C( 2200782996640600919),
+    UINT64_C(  816778863552099543), UINT64_C( 2419031109686561638), UINT64_C( 1552522174097316013),
+    UINT64_C(  872899714386228416), UINT64_C( 4207773561490883035), UINT64_C( 4557284773527364931),
+    UINT64_C( 1635941343942511081), UINT64_C(  388752746045964085), UINT64_C(  797297974165473708),
+    UINT64_C( 2224528769235092197), UINT64_C(  129810917144576916), UINT64_C( 3695237642805590966),
+    UINT64_C( 1917507912125205273), UINT64_C(   86969233091873012), UINT64_C( 2592879749429526478),
+    UINT64_C(  767039058199565051), UINT64_C( 4382760348511593332), UINT64_C( 2308342209152691040),
+    UINT64_C( 2741242456929995325), UINT64_C( 1529567590237338722), UINT64_C(  945384935947669134),
+    UINT64_C( 2973329062899545170), UINT64_C( 1480033111175595923), UINT64_C( 2538778187029876446),
+    UINT64_C( 2344837507844879919), UINT64_C( 2596801024432302985), UINT64_C( 2687779657998904699),
+    UINT64_C( 4135729112038515174), UINT64_C(  204896358553094317), UINT64_C( 3716165778433263976),
+    UINT64_C( 2737280191719927095), UINT64_C( 1632747171034126038), UINT64_C( 1586033836836413089),
+    UINT64_C( 3721389930257549409), UINT64_C(  951927524121511628), UINT64_C( 2312131158625254196),
+    UINT64_C(  234041685233257305), UINT64_C( 1158366700570832516), UINT64_C( 2492007486818252281),
+    UINT64_C(  992635524216815278), UINT64_C( 2836277682389490544), UINT64_C( 4108077938980496914),
+    UINT64_C(  992691344949810376), UINT64_C(  902190690149567071), UINT64_C( 3597579810358573200),
+    UINT64_C( 2622864515154075147), UINT64_C( 1737698881978754060), UINT64_C( 4544171960220366710),
+    UINT64_C(  367710248663569074), UINT64_C( 3370615483927805111), UINT64_C( 3765859310675874347),
+    UINT64_C( 4111152270751917141), UINT64_C( 3270168765958856210), UINT64_C( 1849160754478801782),
+    UINT64_C( 1651868321264097245), UINT64_C( 3249967743082457984), UINT64_C( 4428544272741454476),
+    UINT64_C( 3172066150783512600), UINT64_C( 1829823592218854829), UINT64_C( 2903757481865333581),
+    UINT64_C( 1098585534659563516), UINT64_C( 4359325251833636030), UINT64_C( 2005797565407588331),
+    UINT64_C( 3785652056625193400), UINT64_C( 2059382345563661484), UINT64_C( 3682127656795400699),
+    UINT64_C( 1053896098414277608), UINT64_C( 2221612477457659753), UINT64_C( 3664032263547523615),
+    UINT64_C( 4136767868326397556), UINT64_C(  659920490112473771), UINT64_C( 4103017788438389522),
+    UINT64_C( 2948358908520598479), UINT64_C( 4222131386577963441), UINT64_C(  695772663740341648),
+    UINT64_C( 3638761761840292763), UINT64_C( 4270566713751658911), UINT64_C( 4541955249605003808),
+    UINT64_C( 2655618324572464349), UINT64_C(  619989834785333684), UINT64_C( 4289953542452418782),
+    UINT64_C(  447428903215342719), UINT64_C( 2972182093805958694), UINT64_C( 3593013623125881141),
+    UINT64_C( 1872862200816238025), UINT64_C( 1051719673050458959), UINT64_C( 2829232655383784435),
+    UINT64_C( 3730675882714140168), UINT64_C(  290341413826395897), UINT64_C(   49318483776098116),
+    UINT64_C(  634297698006902227), UINT64_C(  150331248495044976), UINT64_C(  941475936506272623),
+    UINT64_C( 3766314570829488647), UINT64_C(   80314588454367303), UINT64_C( 3086222030444894558),
+    UINT64_C( 4035126618246567356), UINT64_C( 1842615612368354497), UINT64_C( 3884862316935299801),
+    UINT64_C( 2939975394522410060), UINT64_C( 2077598463836100093), UINT64_C( 4351756900966242687),
+    UINT64_C( 2400711739119850254), UINT64_C( 1416979586047913860), UINT64_C( 3529489814044241211),
+    UINT64_C( 1135687142661087418), UINT64_C( 2322728151565602801), UINT64_C( 2369067053942932304),
+    UINT64_C(   31368178978924605), UINT64_C( 3436014263075695111), UINT64_C(  901859847614317342),
+    UINT64_C( 1215685474672827343), UINT64_C(  582088543124655278), UINT64_C( 3487492969372016186),
+    UINT64_C( 1496519828866501509), UINT64_C( 3058646478612644251), UINT64_C( 1465721990478548967),
+    UINT64_C( 2107651826156979027), UINT64_C(  984850724769212231), UINT64_C( 3644518137698018793),
+    UINT64_C(  241509748437302878), UINT64_C(  383304783933611976), UINT64_C( 1628183582686043495),
+    UINT64_C( 3114759228713443323), UINT64_C( 4238833680404291401), UINT64_C(  688026410288222148),
+    UINT64_C(  823057021263900120), UINT64_C( 2326411855819986390), UINT64_C( 1091914032667124918),
+    UINT64_C( 2296950020239488805), UINT64_C(  607337418735800506), UINT64_C( 1467247101221685025),
+    UINT64_C( 1317921105431250529), UINT64_C( 1166840412541945381), UINT64_C( 3617524138862625915),
+    UINT64_C( 2759501200185376495), UINT64_C( 1585988977946312062), UINT64_C(  184527297125777774),
+    UINT64_C( 2212359946370916543), UINT64_C( 1132640057676710068), UINT64_C( 3302637486092235475),
+    UINT64_C(   47240480759893108), UINT64_C(  471899825039116811), UINT64_C( 4430465930968651663),
+    UINT64_C( 3000885903703217293), UINT64_C( 4154352184849207477), UINT64_C(  387899278134293157),
+    UINT64_C( 2672210800821325956), UINT64_C( 3395731570131024519), UINT64_C( 4396745417903152580),
+    UINT64_C( 4592083484607426410), UINT64_C( 1642493526309612238), UINT64_C( 4295875587876333751),
+    UINT64_C( 3097597748165930130), UINT64_C( 2819589298549003725), UINT64_C(  947438932901172815),
+    UINT64_C( 4048254277868242691), UINT64_C( 3613343733206840369), UINT64_C( 1834221755513644804),
+    UINT64_C(  973277973631779119), UINT64_C( 1614547761626343100), UINT64_C( 1084738989767016719),
+    UINT64_C( 3592350538474428510), UINT64_C( 2020727104038103695), UINT64_C( 2382342543941134407),
+    UINT64_C( 1309825015972462495), UINT64_C( 1594215662391375664), UINT64_C( 2000858215069317061),
+    UINT64_C( 4331139294641859496), UINT64_C(  332574684972234384), UINT64_C( 4605570564545716782),
+    UINT64_C( 1330347273031060688), UINT64_C( 3461620215034767531), UINT64_C( 4354964862091784544),
+    UINT64_C( 3775631158123672134), UINT64_C( 1508734581979171756), UINT64_C( 1717910164398452271),
+    UINT64_C( 1217067112109024256), UINT64_C( 3704149725588216635), UINT64_C( 4424436587380937918),
+    UINT64_C(  978263020579853024), UINT64_C( 3481615102258042497), UINT64_C( 2168778472999814742),
+    UINT64_C( 4073169274230856126), UINT64_C( 2535061422550748591), UINT64_C( 2370049507009080760),
+    UINT64_C( 4049514128221477506), UINT64_C(  439107495671692173), UINT64_C( 3111929951370134147),
+    UINT64_C( 1179317760430472932), UINT64_C(  565404122626278415), UINT64_C( 1799833330256075521),
+    UINT64_C( 1676540994076128771), UINT64_C( 2298087391389824104), UINT64_C( 1237155887585272454),
+    UINT64_C( 3941826338290054710), UINT64_C( 4281658139135845856), UINT64_C( 3540619593564635243),
+    UINT64_C( 2686804368448370058), UINT64_C( 2494884684187073661), UINT64_C( 2965734562744674556),
+    UINT64_C( 3446233119576757455), UINT64_C( 2202021348140264508), UINT64_C( 1593017396740558622),
+    UINT64_C( 3279913815230309282), UINT64_C( 3286818059444468376), UINT64_C( 1140983863867013629),
+    UINT64_C(  208179820468705139), UINT64_C(  871015248634303721), UINT64_C( 1373290829529926976),
+    UINT64_C( 3537347188712899438), UINT64_C( 4483213694720406842), UINT64_C(  610860530465122481),
+    UINT64_C(  696315246081945734), UINT64_C( 3100376025612258997), UINT64_C( 1362051703778680179),
+    UINT64_C( 4579018523369296072), UINT64_C(   89901937259524008), UINT64_C( 4240106447481798977),
+    UINT64_C( 3518353274126681257), UINT64_C( 2372127282591449080), UINT64_C( 4519016613408284383),
+    UINT64_C( 3969109923860126202), UINT64_C( 4394225446772396019), UINT64_C( 1609551556682479035),
+    UINT64_C(  227921074365688802), UINT64_C( 1930320082969866003), UINT64_C( 1225662781222001375),
+    UINT64_C( 3802414016400156201), UINT64_C( 4129446904813725372), UINT64_C( 4160528321702267484),
+    UINT64_C( 2255234229238542731), UINT64_C(  765058418352087786), UINT64_C(  166469110154211230),
+    UINT64_C(   19378975449324817), UINT64_C( 3903703857980723923), UINT64_C( 1863841901798123565),
+    UINT64_C( 1359394696637062210), UINT64_C( 1446321208517112901), UINT64_C( 2014042211893684604),
+    UINT64_C( 1492270058063349872), UINT64_C( 1365972863225878166), UINT64_C( 2454359905175880704),
+    UINT64_C(  504362620832676715), UINT64_C( 1478805904657277363), UINT64_C( 2678229115631223377),
+    UINT64_C( 3486308177735248782), UINT64_C( 4095553468289470494), UINT64_C( 3487906013475575565),
+    UINT64_C( 4389322720306063027), UINT64_C( 3149013359125955277), UINT64_C( 3381901547434642051),
+    UINT64_C(  962154417381372913), UINT64_C(  266453965578522078), UINT64_C( 3616980239419837533),
+    UINT64_C(  565417953593608565), UINT64_C( 1988371081652311567), UINT64_C( 4037114839065063084),
+    UINT64_C( 1240193826751170286), UINT64_C( 4266426457572698799), UINT64_C(  245017491998479862),
+    UINT64_C(  260966410467664596), UINT64_C( 3966103377340790787), UINT64_C( 1675895396083821476),
+    UINT64_C(  979224835709439631), UINT64_C( 3624585512076324057), UINT64_C( 1950096095932331642),
+    UINT64_C(  289100196167847331), UINT64_C( 3959152801982309405), UINT64_C( 3346221758441642400),
+    UINT64_C( 2366867205507320441), UINT64_C( 3507617405319098454), UINT64_C(  136771232223207871),
+    UINT64_C(  490079728691177042), UINT64_C(  543664783405561633), UINT64_C(  483306483213340640),
+    UINT64_C(  510806555556130508), UINT64_C( 3132167013330314154), UINT64_C( 3427619522903392612),
+    UINT64_C( 4163483892177191812), UINT64_C(  155787413762905631), UINT64_C( 1030215965054952744),
+    UINT64_C( 3668473313572806821), UINT64_C( 3469651375707344324), UINT64_C( 4382204278396839813),
+    UINT64_C( 4523373017153855388), UINT64_C( 1063378126852311450), UINT64_C( 1231208399773997533),
+    UINT64_C( 4345836121639019118), UINT64_C( 1688292499388007393), UINT64_C(  184443339613017823),
+    UINT64_C(  277094405141672246), UINT64_C( 3525498332217669253), UINT64_C( 3648113786199744239),
+    UINT64_C( 4478754074506901161), UINT64_C(  626297590503189450), UINT64_C( 3369742126303465728),
+    UINT64_C( 1697744173972396808), UINT64_C( 1538093989941999103), UINT64_C(  479588466945915912),
+    UINT64_C(  848976462686658613), UINT64_C( 1854522643282304425), UINT64_C( 3016203424819720057),
+    UINT64_C( 4035136138076832337), UINT64_C( 1733457760798908697), UINT64_C(  331008071283198498),
+    UINT64_C( 1781176816738160749), UINT64_C( 2914509569038348340), UINT64_C( 1244340859032719234),
+    UINT64_C( 1302547591645079863), UINT64_C(  777039139634899335), UINT64_C( 3531384543848349920),
+    UINT64_C( 2315378645606089562), UINT64_C( 1361761461888066093), UINT64_C( 3145022340754381981),
+    UINT64_C( 2073600855859389402), UINT64_C( 4083502248124438865), UINT64_C( 3041380130487857690),
+    UINT64_C( 3956136616881939299), UINT64_C( 1874612785324683517), UINT64_C( 1844890970564863646),
+    UINT64_C(  706144719799758441), UINT64_C( 2035178193471487090), UINT64_C( 2462317921121052758),
+    UINT64_C( 4190969131542904529), UINT64_C( 1276609820644503207), UINT64_C( 2726324361822022698),
+    UINT64_C( 3085814807638355138), UINT64_C( 1432751804325404159), UINT64_C( 3078632193023835316),
+    UINT64_C( 2736718066033403274), UINT64_C( 3354922308083637135), UINT64_C(  938436529988435272),
+    UINT64_C( 2091943141357137645), UINT64_C(  981623966646819835), UINT64_C(  680976407834139869),
+    UINT64_C( 3133051207374189676), UINT64_C( 1334108140963731887), UINT64_C( 1579237328548817598),
+    UINT64_C(  877353902278191427), UINT64_C( 3824291739522788076), UINT64_C( 2137443489648467722),
+    UINT64_C(  917794389549713133), UINT64_C(  251588547665158640), UINT64_C( 2676859808255949069),
+    UINT64_C( 2734815492851336383), UINT64_C( 2742465433268612203), UINT64_C(  485491135282793681),
+    UINT64_C( 3720690912893558875), UINT64_C( 1459176627240636952), UINT64_C( 3187602538680359448),
+    UINT64_C( 3165220293337291917), UINT64_C( 1032376268464898917), UINT64_C( 3988225595075851037),
+    UINT64_C( 2093264054356944664), UINT64_C( 3781699484200797783), UINT64_C( 4476297656530001513),
+    UINT64_C( 3474715846492304988), UINT64_C(                   0), UINT64_C(                   4),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C(                   4),
+    UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139),
+    UINT64_C(15399314395201706410), UINT64_C(16095585161216792975), UINT64_C(  935015860473793947),
+    UINT64_C( 5044858856783534954), UINT64_C(10704841052939819994), UINT64_C(                   4),
+    UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410),
+    UINT64_C(16095585161216792975), UINT64_C(  935015860473793947), UINT64_C( 5044858856783534954),
+    UINT64_C(10704841052939819994), UINT64_C(14823511509961865041), UINT64_C( 6801747814650478768),
+    UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307), UINT64_C(10837856322613628300),
+    UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513), UINT64_C(13817741599934505432),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139),
+    UINT64_C(15399314395201706410), UINT64_C(16095585161216792975), UINT64_C(  935015860473793947),
+    UINT64_C( 5044858856783534954), UINT64_C(10704841052939819994), UINT64_C(14823511509961865041),
+    UINT64_C( 6801747814650478768), UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307),
+    UINT64_C(10837856322613628300), UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513),
+    UINT64_C(13817741599934505432), UINT64_C( 8272674114655418646), UINT64_C( 9300257820891667993),
+    UINT64_C(  524524789911762958), UINT64_C(13700435474456645115), UINT64_C(12070056983459514179),
+    UINT64_C(15606678242288721550), UINT64_C(15958330216678504264), UINT64_C( 3663876260517275405),
+    UINT64_C( 6636974752260600928), UINT64_C( 7403630015146204752), UINT64_C(14685068185283478013),
+    UINT64_C(  939236246125912135), UINT64_C( 4645877627644259550), UINT64_C( 5629106033785832752),
+    UINT64_C( 7518592205968233530), UINT64_C(15890526987243620945), UINT64_C(                   4),
+    UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410),
+    UINT64_C(16095585161216792975), UINT64_C(  935015860473793947), UINT64_C( 5044858856783534954),
+    UINT64_C(10704841052939819994), UINT64_C(14823511509961865041), UINT64_C( 6801747814650478768),
+    UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307), UINT64_C(10837856322613628300),
+    UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513), UINT64_C(13817741599934505432),
+    UINT64_C( 8272674114655418646), UINT64_C( 9300257820891667993), UINT64_C(  524524789911762958),
+    UINT64_C(13700435474456645115), UINT64_C(12070056983459514179), UINT64_C(15606678242288721550),
+    UINT64_C(15958330216678504264), UINT64_C( 3663876260517275405), UINT64_C( 6636974752260600928),
+    UINT64_C( 7403630015146204752), UINT64_C(14685068185283478013), UINT64_C(  939236246125912135),
+    UINT64_C( 4645877627644259550), UINT64_C( 5629106033785832752), UINT64_C( 7518592205968233530),
+    UINT64_C(15890526987243620945), UINT64_C(18363187131404708859), UINT64_C(10760032883403366612),
+    UINT64_C(15323230751358392006), UINT64_C(13485945174540913643), UINT64_C(15478691441689093085),
+    UINT64_C( 9999053415530750839), UINT64_C(15545093430797142494), UINT64_C(10629753139159135763),
+    UINT64_C( 9748677097063844747), UINT64_C(16223430760769901807), UINT64_C(17008713017796795127),
+    UINT64_C( 4875079671801458261), UINT64_C(12970158159567782300), UINT64_C( 3082018651885430046),
+    UINT64_C( 8488069535807066230), UINT64_C( 5390052140868347301), UINT64_C(14204288525935746332),
+    UINT64_C( 3392776274373824360), UINT64_C(13508975171084961660), UINT64_C( 4177604586827430670),
+    UINT64_C(13454734720994210547), UINT64_C(12449341400208309288), UINT64_C( 7441811111581718715),
+    UINT64_C(  557960310548722281), UINT64_C( 5022945591500869479), UINT64_C( 5929482543053587160),
+    UINT64_C( 2771923343720792784), UINT64_C(17772190152077797184), UINT64_C( 9870433017619998234),
+    UINT64_C( 9968757564490533415), UINT64_C( 7480107884525257642), UINT64_C( 8374169019430200033),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139),
+    UINT64_C(15399314395201706410), UINT64_C(16095585161216792975), UINT64_C(  935015860473793947),
+    UINT64_C( 5044858856783534954), UINT64_C(10704841052939819994), UINT64_C(14823511509961865041),
+    UINT64_C( 6801747814650478768), UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307),
+    UINT64_C(10837856322613628300), UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513),
+    UINT64_C(13817741599934505432), UINT64_C( 8272674114655418646), UINT64_C( 9300257820891667993),
+    UINT64_C(  524524789911762958), UINT64_C(13700435474456645115), UINT64_C(12070056983459514179),
+    UINT64_C(15606678242288721550), UINT64_C(15958330216678504264), UINT64_C( 3663876260517275405),
+    UINT64_C( 6636974752260600928), UINT64_C( 7403630015146204752), UINT64_C(14685068185283478013),
+    UINT64_C(  939236246125912135), UINT64_C( 4645877627644259550), UINT64_C( 5629106033785832752),
+    UINT64_C( 7518592205968233530), UINT64_C(15890526987243620945), UINT64_C(18363187131404708859),
+    UINT64_C(10760032883403366612), UINT64_C(15323230751358392006), UINT64_C(13485945174540913643),
+    UINT64_C(15478691441689093085), UINT64_C( 9999053415530750839), UINT64_C(15545093430797142494),
+    UINT64_C(10629753139159135763), UINT64_C( 9748677097063844747), UINT64_C(16223430760769901807),
+    UINT64_C(17008713017796795127), UINT64_C( 4875079671801458261), UINT64_C(12970158159567782300),
+    UINT64_C( 3082018651885430046), UINT64_C( 8488069535807066230), UINT64_C( 5390052140868347301),
+    UINT64_C(14204288525935746332), UINT64_C( 3392776274373824360), UINT64_C(13508975171084961660),
+    UINT64_C( 4177604586827430670), UINT64_C(13454734720994210547), UINT64_C(12449341400208309288),
+    UINT64_C( 7441811111581718715), UINT64_C(  557960310548722281), UINT64_C( 5022945591500869479),
+    UINT64_C( 5929482543053587160), UINT64_C( 2771923343720792784), UINT64_C(17772190152077797184),
+    UINT64_C( 9870433017619998234), UINT64_C( 9968757564490533415), UINT64_C( 7480107884525257642),
+    UINT64_C( 8374169019430200033), UINT64_C(16180954858396087424), UINT64_C(16039538274196874157),
+    UINT64_C( 3699304671320783718), UINT64_C( 4495506554501186747), UINT64_C( 1305369207991983600),
+    UINT64_C( 5952147050561432186), UINT64_C( 1096610553773161688), UINT64_C(17567959471736915475),
+    UINT64_C(12693002747400477502), UINT64_C(13039109273954694652), UINT64_C(15353062762322865644),
+    UINT64_C(  854137335714707916), UINT64_C( 2378088898928169980), UINT64_C( 9118791839529518139),
+    UINT64_C( 2385024958896746858), UINT64_C( 8248728081686549269), UINT64_C( 4531945126003614861),
+    UINT64_C(12908748873725960096), UINT64_C( 2131574955856399208), UINT64_C( 2741600703405278016),
+    UINT64_C(17320848506065100368), UINT64_C(10873224313681512109), UINT64_C(10872822215124667463),
+    UINT64_C( 7882823365203995373), UINT64_C( 1549634253303188093), UINT64_C(11526461319678639460),
+    UINT64_C( 6440255585648176779), UINT64_C(11800645485649669227), UINT64_C(17484831985982624781),
+    UINT64_C( 4475772722859079995), UINT64_C( 3283009077575642824), UINT64_C(   53027213440924003),
+    UINT64_C( 7073441495741033812), UINT64_C( 1059934365190267585), UINT64_C(12861782840510144670),
+    UINT64_C(11206654282706656445), UINT64_C( 3866536531466683071), UINT64_C( 6917212468786927852),
+    UINT64_C( 6545861174197572826), UINT64_C( 9673016006498685746), UINT64_C(15661714981525014251),
+    UINT64_C(  311650362020626222), UINT64_C( 8252238387093709242), UINT64_C( 3476695533994548434),
+    UINT64_C(10376839016181397876), UINT64_C(13963486138935630568), UINT64_C(17369516751451888769),
+    UINT64_C( 4025410504784720247), UINT64_C( 4581692930448803892), UINT64_C( 7505153196371828040),
+    UINT64_C( 1025978483713168327), UINT64_C( 1543083031633856797), UINT64_C(10882197785983543072),
+    UINT64_C(15519682344957746721), UINT64_C(11783439202461196635), UINT64_C( 8298327092713519831),
+    UINT64_C(  795028493834076427), UINT64_C(17303987744167040597), UINT64_C( 4421013741595730431),
+    UINT64_C( 5200842723427622792), UINT64_C(14498363592526867533), UINT64_C( 3810508832414219537),
+    UINT64_C(  788773449283363516), UINT64_C(  461169995765932576), UINT64_C(                   4),
+    UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410),
+    UINT64_C(16095585161216792975), UINT64_C(  935015860473793947), UINT64_C( 5044858856783534954),
+    UINT64_C(10704841052939819994), UINT64_C(14823511509961865041), UINT64_C( 6801747814650478768),
+    UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307), UINT64_C(10837856322613628300),
+    UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513), UINT64_C(13817741599934505432),
+    UINT64_C( 8272674114655418646), UINT64_C( 9300257820891667993), UINT64_C(  524524789911762958),
+    UINT64_C(13700435474456645115), UINT64_C(12070056983459514179), UINT64_C(15606678242288721550),
+    UINT64_C(15958330216678504264), UINT64_C( 3663876260517275405), UINT64_C( 6636974752260600928),
+    UINT64_C( 7403630015146204752), UINT64_C(14685068185283478013), UINT64_C(  939236246125912135),
+    UINT64_C( 4645877627644259550), UINT64_C( 5629106033785832752), UINT64_C( 7518592205968233530),
+    UINT64_C(15890526987243620945), UINT64_C(18363187131404708859), UINT64_C(10760032883403366612),
+    UINT64_C(15323230751358392006), UINT64_C(13485945174540913643), UINT64_C(15478691441689093085),
+    UINT64_C( 9999053415530750839), UINT64_C(15545093430797142494), UINT64_C(10629753139159135763),
+    UINT64_C( 9748677097063844747), UINT64_C(16223430760769901807), UINT64_C(17008713017796795127),
+    UINT64_C( 4875079671801458261), UINT64_C(12970158159567782300), UINT64_C( 3082018651885430046),
+    UINT64_C( 8488069535807066230), UINT64_C( 5390052140868347301), UINT64_C(14204288525935746332),
+    UINT64_C( 3392776274373824360), UINT64_C(13508975171084961660), UINT64_C( 4177604586827430670),
+    UINT64_C(13454734720994210547), UINT64_C(12449341400208309288), UINT64_C( 7441811111581718715),
+    UINT64_C(  557960310548722281), UINT64_C( 5022945591500869479), UINT64_C( 5929482543053587160),
+    UINT64_C( 2771923343720792784), UINT64_C(17772190152077797184), UINT64_C( 9870433017619998234),
+    UINT64_C( 9968757564490533415), UINT64_C( 7480107884525257642), UINT64_C( 8374169019430200033),
+    UINT64_C(16180954858396087424), UINT64_C(16039538274196874157), UINT64_C( 3699304671320783718),
+    UINT64_C( 4495506554501186747), UINT64_C( 1305369207991983600), UINT64_C( 5952147050561432186),
+    UINT64_C( 1096610553773161688), UINT64_C(17567959471736915475), UINT64_C(12693002747400477502),
+    UINT64_C(13039109273954694652), UINT64_C(15353062762322865644), UINT64_C(  854137335714707916),
+    UINT64_C( 2378088898928169980), UINT64_C( 9118791839529518139), UINT64_C( 2385024958896746858),
+    UINT64_C( 8248728081686549269), UINT64_C( 4531945126003614861), UINT64_C(12908748873725960096),
+    UINT64_C( 2131574955856399208), UINT64_C( 2741600703405278016), UINT64_C(17320848506065100368),
+    UINT64_C(10873224313681512109), UINT64_C(10872822215124667463), UINT64_C( 7882823365203995373),
+    UINT64_C( 1549634253303188093), UINT64_C(11526461319678639460), UINT64_C( 6440255585648176779),
+    UINT64_C(11800645485649669227), UINT64_C(17484831985982624781), UINT64_C( 4475772722859079995),
+    UINT64_C( 3283009077575642824), UINT64_C(   53027213440924003), UINT64_C( 7073441495741033812),
+    UINT64_C( 1059934365190267585), UINT64_C(12861782840510144670), UINT64_C(11206654282706656445),
+    UINT64_C( 3866536531466683071), UINT64_C( 6917212468786927852), UINT64_C( 6545861174197572826),
+    UINT64_C( 9673016006498685746), UINT64_C(15661714981525014251), UINT64_C(  311650362020626222),
+    UINT64_C( 8252238387093709242), UINT64_C( 3476695533994548434), UINT64_C(10376839016181397876),
+    UINT64_C(13963486138935630568), UINT64_C(17369516751451888769), UINT64_C( 4025410504784720247),
+    UINT64_C( 4581692930448803892), UINT64_C( 7505153196371828040), UINT64_C( 1025978483713168327),
+    UINT64_C( 1543083031633856797), UINT64_C(10882197785983543072), UINT64_C(15519682344957746721),
+    UINT64_C(11783439202461196635), UINT64_C( 8298327092713519831), UINT64_C(  795028493834076427),
+    UINT64_C(17303987744167040597), UINT64_C( 4421013741595730431), UINT64_C( 5200842723427622792),
+    UINT64_C(14498363592526867533), UINT64_C( 3810508832414219537), UINT64_C(  788773449283363516),
+    UINT64_C(  461169995765932576), UINT64_C(17591714041449082671), UINT64_C(10487169474399915347),
+    UINT64_C(17063746427376064836), UINT64_C( 3702864191111446583), UINT64_C(11565803673056906512),
+    UINT64_C( 6333410354478878381), UINT64_C(14150460357275822369), UINT64_C( 1054550973629380135),
+    UINT64_C(17392144101620672248), UINT64_C( 5912670226056224838), UINT64_C( 6476077475534711122),
+    UINT64_C( 8856853734920706443), UINT64_C(16024157607726461142), UINT64_C( 3838793860466319591),
+    UINT64_C(11337322928032803032), UINT64_C(  500661425114548745), UINT64_C( 4969161675331233633),
+    UINT64_C( 3172978149511685375), UINT64_C(14149328764061573648), UINT64_C( 1097344932148957668),
+    UINT64_C( 8564489954378429807), UINT64_C(  872608656828928266), UINT64_C( 9278499731587959531),
+    UINT64_C(16091071015128687689), UINT64_C(18236458769399661608), UINT64_C( 8803131986562446677),
+    UINT64_C( 3267115454208414131), UINT64_C( 9676124438746293817), UINT64_C( 6210088696389294386),
+    UINT64_C( 3491598857544930719), UINT64_C(16831094245963614355), UINT64_C(18229139094109548769),
+    UINT64_C( 6543765375770076288), UINT64_C( 1555010984183863935), UINT64_C( 3189191896661910410),
+    UINT64_C( 8898115076940412253), UINT64_C(  519243668578310200), UINT64_C(14780950571222436065),
+    UINT64_C( 7670031648500858558), UINT64_C(  347876932367493747), UINT64_C(10371518997718156574),
+    UINT64_C( 3068156232798275191), UINT64_C(17531041394046458963), UINT64_C( 9233368836610809262),
+    UINT64_C(10964969827720034861), UINT64_C( 6118270360949384774), UINT64_C( 3781539743790695007),
+    UINT64_C(11893316251598238776), UINT64_C( 5920132444702412610), UINT64_C(10155112748119555389),
+    UINT64_C( 9379350031379565491), UINT64_C(10387204097729262679), UINT64_C(10751118631995671312),
+    UINT64_C(16542916448154141504), UINT64_C(  819585434212381271), UINT64_C(14864663113733128514),
+    UINT64_C(10949120766879761863), UINT64_C( 6530988684136536054), UINT64_C( 6344135347345683345),
+    UINT64_C(14885559721030270348), UINT64_C( 3807710096486065111), UINT64_C( 9248524634501061960),
+    UINT64_C(  936166740933033792), UINT64_C( 4633466802283352697), UINT64_C( 9968029947273057815),
+    UINT64_C( 3970542096867280507), UINT64_C(11345110729558017594), UINT64_C(16432311755922067923),
+    UINT64_C( 3970765379799260900), UINT64_C( 3608762760598285911), UINT64_C(14390319241434363093),
+    UINT64_C(10491458060616351836), UINT64_C( 6950795527915050192), UINT64_C(18176687840881555628),
+    UINT64_C( 1470840994654283480), UINT64_C(13482461935711286302), UINT64_C(15063437242703570969),
+    UINT64_C(16444609083007748892), UINT64_C(13080675063835488736), UINT64_C( 7396643017915243258),
+    UINT64_C( 6607473285056421255), UINT64_C(12999870972329895437), UINT64_C(17714177090965904433),
+    UINT64_C(12688264603134112379), UINT64_C( 7319294368875455069), UINT64_C(11615029927461391060),
+    UINT64_C( 4394342138638275529), UINT64_C(17437301007334629297), UINT64_C( 8023190261630392515),
+    UINT64_C(15142608226500847568), UINT64_C( 8237529382254686174), UINT64_C(14728510627181674741),
+    UINT64_C( 4215584393657131024), UINT64_C( 8886449909830682420), UINT64_C(14656129054190166051),
+    UINT64_C(16547071473305671052), UINT64_C( 2639681960449907978), UINT64_C(16412071153753638257),
+    UINT64_C(11793435634082451524), UINT64_C(16888525546311936260), UINT64_C( 2783090654961380186),
+    UINT64_C(14555047047361242149), UINT64_C(17082266855006719086), UINT64_C(18167820998420103977),
+    UINT64_C(10622473298289909284), UINT64_C( 2479959339141346850), UINT64_C(17159814169809758949),
+    UINT64_C( 1789715612861379618), UINT64_C(11888728375223892849), UINT64_C(14372054492503594768),
+    UINT64_C( 7491448803264988693), UINT64_C( 4206878692201856385), UINT64_C(11316930621535193020),
+    UINT64_C(14922703530856633565), UINT64_C( 1161365655305589260), UINT64_C(  197273935104393427),
+    UINT64_C( 2537190792027621301), UINT64_C(  601324993980182841), UINT64_C( 3765903746025108887),
+    UINT64_C(15065258283318028178), UINT64_C(  321258353817470781), UINT64_C(12344888121779638533),
+    UINT64_C(16140506472986348266), UINT64_C( 7370462449473453990), UINT64_C(15539449267741275110),
+    UINT64_C(11759901578089697684), UINT64_C( 8310393855344440966), UINT64_C(17407027603865055777),
+    UINT64_C(                   4), UINT64_C(12056949092800237063), UINT64_C( 7603858705401938139),
+    UINT64_C(15399314395201706410), UINT64_C(16095585161216792975), UINT64_C(  935015860473793947),
+    UINT64_C( 5044858856783534954), UINT64_C(10704841052939819994), UINT64_C(14823511509961865041),
+    UINT64_C( 6801747814650478768), UINT64_C( 3527826048668878276), UINT64_C( 3770047066528861307),
+    UINT64_C(10837856322613628300), UINT64_C( 8186794253328016406), UINT64_C( 9562219288038263513),
+    UINT64_C(13817741599934505432), UINT64_C( 8272674114655418646), UINT64_C( 9300257820891667993),
+    UINT64_C(  524524789911762958), UINT64_C(13700435474456645115), UINT64_C(12070056983459514179),
+    UINT64_C(15606678242288721550), UINT64_C(15958330216678504264), UINT64_C( 3663876260517275405),
+    UINT64_C( 6636974752260600928), UINT64_C( 7403630015146204752), UINT64_C(14685068185283478013),
+    UINT64_C(  939236246125912135), UINT64_C( 4645877627644259550), UINT64_C( 5629106033785832752),
+    UINT64_C( 7518592205968233530), UINT64_C(15890526987243620945), UINT64_C(18363187131404708859),
+    UINT64_C(10760032883403366612), UINT64_C(15323230751358392006), UINT64_C(13485945174540913643),
+    UINT64_C(15478691441689093085), UINT64_C( 9999053415530750839), UINT64_C(15545093430797142494),
+    UINT64_C(10629753139159135763), UINT64_C( 9748677097063844747), UINT64_C(16223430760769901807),
+    UINT64_C(17008713017796795127), UINT64_C( 4875079671801458261), UINT64_C(12970158159567782300),
+    UINT64_C( 3082018651885430046), UINT64_C( 8488069535807066230), UINT64_C( 5390052140868347301),
+    UINT64_C(14204288525935746332), UINT64_C( 3392776274373824360), UINT64_C(13508975171084961660),
+    UINT64_C( 4177604586827430670), UINT64_C(13454734720994210547), UINT64_C(12449341400208309288),
+    UINT64_C( 7441811111581718715), UINT64_C(  557960310548722281), UINT64_C( 5022945591500869479),
+    UINT64_C( 5929482543053587160), UINT64_C( 2771923343720792784), UINT64_C(17772190152077797184),
+    UINT64_C( 9870433017619998234), UINT64_C( 9968757564490533415), UINT64_C( 7480107884525257642),
+    UINT64_C( 8374169019430200033), UINT64_C(16180954858396087424), UINT64_C(16039538274196874157),
+    UINT64_C( 3699304671320783718), UINT64_C( 4495506554501186747), UINT64_C( 1305369207991983600),
+    UINT64_C( 5952147050561432186), UINT64_C( 1096610553773161688), UINT64_C(17567959471736915475),
+    UINT64_C(12693002747400477502), UINT64_C(13039109273954694652), UINT64_C(15353062762322865644),
+    UINT64_C(  854137335714707916), UINT64_C( 2378088898928169980), UINT64_C( 9118791839529518139),
+    UINT64_C( 2385024958896746858), UINT64_C( 8248728081686549269), UINT64_C( 4531945126003614861),
+    UINT64_C(12908748873725960096), UINT64_C( 2131574955856399208), UINT64_C( 2741600703405278016),
+    UINT64_C(17320848506065100368), UINT64_C(10873224313681512109), UINT64_C(10872822215124667463),
+    UINT64_C( 7882823365203995373), UINT64_C( 1549634253303188093), UINT64_C(11526461319678639460),
+    UINT64_C( 6440255585648176779), UINT64_C(11800645485649669227), UINT64_C(17484831985982624781),
+    UINT64_C( 4475772722859079995), UINT64_C( 3283009077575642824), UINT64_C(   53027213440924003),
+    UINT64_C( 7073441495741033812), UINT64_C( 1059934365190267585), UINT64_C(12861782840510144670),
+    UINT64_C(11206654282706656445), UINT64_C( 3866536531466683071), UINT64_C( 6917212468786927852),
+    UINT64_C( 6545861174197572826), UINT64_C( 9673016006498685746), UINT64_C(15661714981525014251),
+    UINT64_C(  311650362020626222), UINT64_C( 8252238387093709242), UINT64_C( 3476695533994548434),
+    UINT64_C(10376839016181397876), UINT64_C(13963486138935630568), UINT64_C(17369516751451888769),
+    UINT64_C( 4025410504784720247), UINT64_C( 4581692930448803892), UINT64_C( 7505153196371828040),
+    UINT64_C( 1025978483713168327), UINT64_C( 1543083031633856797), UINT64_C(10882197785983543072),
+    UINT64_C(15519682344957746721), UINT64_C(11783439202461196635), UINT64_C( 8298327092713519831),
+    UINT64_C(  795028493834076427), UINT64_C(17303987744167040597), UINT64_C( 4421013741595730431),
+    UINT64_C( 5200842723427622792), UINT64_C(14498363592526867533), UINT64_C( 3810508832414219537),
+    UINT64_C(  788773449283363516), UINT64_C(  461169995765932576), UINT64_C(17591714041449082671),
+    UINT64_C(10487169474399915347), UINT64_C(17063746427376064836), UINT64_C( 3702864191111446583),
+    UINT64_C(11565803673056906512), UINT64_C( 6333410354478878381), UINT64_C(14150460357275822369),
+    UINT64_C( 1054550973629380135), UINT64_C(17392144101620672248), UINT64_C( 5912670226056224838),
+    UINT64_C( 6476077475534711122), UINT64_C( 8856853734920706443), UINT64_C(16024157607726461142),
+    UINT64_C( 3838793860466319591), UINT64_C(11337322928032803032), UINT64_C(  500661425114548745),
+    UINT64_C( 4969161675331233633), UINT64_C( 3172978149511685375), UINT64_C(14149328764061573648),
+    UINT64_C( 1097344932148957668), UINT64_C( 8564489954378429807), UINT64_C(  872608656828928266),
+    UINT64_C( 9278499731587959531), UINT64_C(16091071015128687689), UINT64_C(18236458769399661608),
+    UINT64_C( 8803131986562446677), UINT64_C( 3267115454208414131), UINT64_C( 9676124438746293817),
+    UINT64_C( 6210088696389294386), UINT64_C( 3491598857544930719), UINT64_C(16831094245963614355),
+    UINT64_C(18229139094109548769), UINT64_C( 6543765375770076288), UINT64_C( 1555010984183863935),
+    UINT64_C( 3189191896661910410), UINT64_C( 8898115076940412253), UINT64_C(  519243668578310200),
+    UINT64_C(14780950571222436065), UINT64_C( 7670031648500858558), UINT64_C(  347876932367493747),
+    UINT64_C(10371518997718156574), UINT64_C( 3068156232798275191), UINT64_C(17531041394046458963),
+    UINT64_C( 9233368836610809262), UINT64_C(10964969827720034861), UINT64_C( 6118270360949384774),
+    UINT64_C( 3781539743790695007), UINT64_C(11893316251598238776), UINT64_C( 5920132444702412610),
+    UINT64_C(10155112748119555389), UINT64_C( 9379350031379565491), UINT64_C(10387204097729262679),
+    UINT64_C(10751118631995671312), UINT64_C(16542916448154141504), UINT64_C(  819585434212381271),
+    UINT64_C(14864663113733128514), UINT64_C(10949120766879761863), UINT64_C( 6530988684136536054),
+    UINT64_C( 6344135347345683345), UINT64_C(14885559721030270348), UINT64_C( 3807710096486065111),
+    UINT64_C( 9248524634501061960), UINT64_C(  936166740933033792), UINT64_C( 4633466802283352697),
+    UINT64_C( 9968029947273057815), UINT64_C( 3970542096867280507), UINT64_C(11345110729558017594),
+    UINT64_C(16432311755922067923), UINT64_C( 3970765379799260900), UINT64_C( 3608762760598285911),
+    UINT64_C(14390319241434363093), UINT64_C(10491458060616351836), UINT64_C( 6950795527915050192),
+    UINT64_C(18176687840881555628), UINT64_C( 1470840994654283480), UINT64_C(13482461935711286302),
+    UINT64_C(15063437242703570969), UINT64_C(16444609083007748892), UINT64_C(13080675063835488736),
+    UINT64_C( 7396643017915243258), UINT64_C( 6607473285056421255), UINT64_C(12999870972329895437),
+    UINT64_C(17714177090965904433), UINT64_C(12688264603134112379), UINT64_C( 7319294368875455069),
+    UINT64_C(11615029927461391060), UINT64_C( 4394342138638275529), UINT64_C(17437301007334629297),
+    UINT64_C( 8023190261630392515), UINT64_C(15142608226500847568), UINT64_C( 8237529382254686174),
+    UINT64_C(14728510627181674741), UINT64_C( 4215584393657131024), UINT64_C( 8886449909830682420),
+    UINT64_C(14656129054190166051), UINT64_C(16547071473305671052), UINT64_C( 2639681960449907978),
+    UINT64_C(16412071153753638257), UINT64_C(11793435634082451524), UINT64_C(16888525546311936260),
+    UINT64_C( 2783090654961380186), UINT64_C(14555047047361242149), UINT64_C(17082266855006719086),
+    UINT64_C(18167820998420103977), UINT64_C(10622473298289909284), UINT64_C( 2479959339141346850),
+    UINT64_C(17159814169809758949), UINT64_C( 1789715612861379618), UINT64_C(11888728375223892849),
+    UINT64_C(14372054492503594768), UINT64_C( 7491448803264988693), UINT64_C( 4206878692201856385),
+    UINT64_C(11316930621535193020), UINT64_C(14922703530856633565), UINT64_C( 1161365655305589260),
+    UINT64_C(  197273935104393427), UINT64_C( 2537190792027621301), UINT64_C(  601324993980182841),
+    UINT64_C( 3765903746025108887), UINT64_C(15065258283318028178), UINT64_C(  321258353817470781),
+    UINT64_C(12344888121779638533), UINT64_C(16140506472986348266), UINT64_C( 7370462449473453990),
+    UINT64_C(15539449267741275110), UINT64_C(11759901578089697684), UINT64_C( 8310393855344440966),
+    UINT64_C(17407027603865055777), UINT64_C( 9602846956479447923), UINT64_C( 5667918344191683126),
+    UINT64_C(14117959256177033806), UINT64_C( 4542748570644371862), UINT64_C( 9290912606262456587),
+    UINT64_C( 9476268215771775505), UINT64_C(  125472715915699032), UINT64_C(13744057052302847580),
+    UINT64_C( 3607439390457286989), UINT64_C( 4862741898691333125), UINT64_C( 2328354172498632485),
+    UINT64_C(13949971877488132886), UINT64_C( 5986079315466035276), UINT64_C(12234585914450636767),
+    UINT64_C( 5862887961914224506), UINT64_C( 8430607304627957289), UINT64_C( 3939402899076868167),
+    UINT64_C(14578072550792146382), UINT64_C(  966038993749216230), UINT64_C( 1533219135734455393),
+    UINT64_C( 6512734330744205793), UINT64_C(12459036914853834151), UINT64_C(16955334721617248426),
+    UINT64_C( 2752105641152902035), UINT64_C( 3292228085055616561), UINT64_C( 9305647423279991015),
+    UINT64_C( 4367656130668521006), UINT64_C( 9187800080958000100), UINT64_C( 2429349674943213890),
+    UINT64_C( 5868988404886768768), UINT64_C( 5271684421725027866), UINT64_C( 4667361650167804322),
+    UINT64_C(14470096555450574343), UINT64_C(11038004800741559898), UINT64_C( 6343955911785279236),
+    UINT64_C(  738109188503114701), UINT64_C( 8849439785483709399), UINT64_C( 4530560230706862402),
+    UINT64_C(13210549944369006430), UINT64_C(  188961923039573355), UINT64_C( 1887599300156476464),
+    UINT64_C(17721863723874693219), UINT64_C(12003543614812927806), UINT64_C(16617408739396911080),
+    UINT64_C( 1551597112537180207), UINT64_C(10688843203285356036), UINT64_C(13582926280524164425),
+    UINT64_C(17586981671612696228), UINT64_C(18368333938429795364), UINT64_C( 6569974105238481044),
+    UINT64_C(17183502351505418941), UINT64_C(12390390992663781044), UINT64_C(11278357194196069992),
+    UINT64_C( 3789755731604709772), UINT64_C(16193017111473049863), UINT64_C(14453374932827432077),
+    UINT64_C( 7336887022054615054), UINT64_C( 3893111894527135492), UINT64_C( 6458191046505403946),
+    UINT64_C( 4338955959068088070), UINT64_C(14369402153897784231), UINT64_C( 8082908416152454263),
+    UINT64_C( 9529370175764584176), UINT64_C( 5239300063889875572), UINT64_C( 6376862649565533805),
+    UINT64_C( 8003432860277307338), UINT64_C(17324557178567522610), UINT64_C( 1330298739888944034),
+    UINT64_C(18422282258182957116), UINT64_C( 5321389092124268745), UINT64_C(13846480860139137760),
+    UINT64_C(17419859448367223267), UINT64_C(15102524632494762308), UINT64_C( 6034938327916716503),
+    UINT64_C( 6871640657593842650), UINT64_C( 4868268448436120804), UINT64_C(14816598902352938915),
+    UINT64_C(17697746349523838121), UINT64_C( 3913052082319431210), UINT64_C(13926460409032238015),
+    UINT64_C( 8675113891999301343), UINT64_C(16292677096923504089), UINT64_C(10140245690203043896),
+    UINT64_C( 9480198028036369348), UINT64_C(16198056512885989147), UINT64_C( 1756429982686777271),
+    UINT64_C(12447719805480597392), UINT64_C( 4717271041721914770), UINT64_C( 2261616490505124707),
+    UINT64_C( 7199333321024337251), UINT64_C( 6706163976304547842), UINT64_C( 9192349565559341318),
+    UINT64_C( 4948623550341113988), UINT64_C(15767305353160295859), UINT64_C(17126632556543467083),
+    UINT64_C(14162478374258610152), UINT64_C(10747217473793532729), UINT64_C( 9979538736748343391),
+    UINT64_C(11862938250978756171), UINT64_C(13784932478307097156), UINT64_C( 8808085392561101057),
+    UINT64_C( 6372069586962265614), UINT64_C(13119655260921301214), UINT64_C(13147272237777937725),
+    UINT64_C( 4563935455468076809), UINT64_C(  832719281874824623), UINT64_C( 3484060994537231902),
+    UINT64_C( 5493163318119734736), UINT64_C(14149388754851666868), UINT64_C(17932854778881714965),
+    UINT64_C( 2443442121860501859), UINT64_C( 2785260984327796541), UINT64_C(12401504102449096566),
+    UINT64_C( 5448206815114747329), UINT64_C(18316074093477273757), UINT64_C(  359607749038097788),
+    UINT64_C(16960425789927278755), UINT64_C(14073413096506793773), UINT64_C( 9488509130365842669),
+    UINT64_C(18076066453633225829), UINT64_C(15876439695440582360), UINT64_C(17576901787089669935),
+    UINT64_C( 6438206226729947589), UINT64_C(  911684297462759661), UINT64_C( 7721280331879501728),
+    UINT64_C( 4902651124888029448), UINT64_C(15209656065600699099), UINT64_C(16517787619254982173),
+    UINT64_C(16642113286809151228), UINT64_C( 9020936916954214989), UINT64_C( 3060233673408366092),
+    UINT64_C(  665876440616848172), UINT64_C(   77515901797299646), UINT64_C(15614815431922971966),
+    UINT64_C( 7455367607192530677), UINT64_C( 5437578786548275401), UINT64_C( 5785284834068479863),
+    UINT64_C( 8056168847574777768), UINT64_C( 5969080232253428645), UINT64_C( 5463891452903539353),
+    UINT64_C( 9817439620703570771), UINT64_C( 2017450483330716714), UINT64_C( 5915223618629138346),
+    UINT64_C(10712916462524945838), UINT64_C(13945232710941063247), UINT64_C(16382213873157961999),
+    UINT64_C(13951624053902370410), UINT64_C(17557290881224337871), UINT64_C(12596053436503882636),
+    UINT64_C(13527606189738634283), UINT64_C( 3848617669525510451), UINT64_C( 1065815862314093518),
+    UINT64_C(14467920957679420804), UINT64_C( 2261671814374445307), UINT64_C( 7953484326609285118),
+    UINT64_C(16148459356260331217), UINT64_C( 4960775307004705376), UINT64_C(17065705830290878557),
+    UINT64_C(  980069967993924235), UINT64_C( 1043865641870663483), UINT64_C(15864413509363240641),
+    UINT64_C( 6703581584335318649), UINT64_C( 3916899342837777657), UINT64_C(14498342048305367048),
+    UINT64_C( 7800384383729364671), UINT64_C( 1156400784671394972), UINT64_C(15836611207929314978),
+    UINT64_C(13384887033766634982), UINT64_C( 9467468822029328010), UINT64_C(14030469621276462351),
+    UINT64_C(  547084928892834156), UINT64_C( 1960318914764717743), UINT64_C( 2174659133622257154),
+    UINT64_C( 1933225932853372003), UINT64_C( 2043226222224532012), UINT64_C(12528668053321317815),
+    UINT64_C(13710478091613637420), UINT64_C(16653935568708848598), UINT64_C(  623149655051625567),
+    UINT64_C( 4120863860219831105), UINT64_C(14673893254291298962), UINT64_C(13878605502829445089),
+    UINT64_C(17528817113587444876), UINT64_C(18093492068615509934), UINT64_C( 4253512507409266577),
+    UINT64_C( 4924833599096014188), UINT64_C(17383344486556161385), UINT64_C( 6753169997552062559),
+    UINT64_C(  737773358452074895), UINT64_C( 1108377620566694398), UINT64_C(14101993328870745896),
+    UINT64_C(14592455144799048236), UINT64_C(17915016298027692154), UINT64_C( 2505190362012770037),
+    UINT64_C(13478968505213928753), UINT64_C( 6790976695889620404), UINT64_C( 6152375959768026464),
+    UINT64_C( 1918353867783673018), UINT64_C( 3395905850746651040), UINT64_C( 7418090573129253935),
+    UINT64_C(12064813699278939161), UINT64_C(16140544552307408190), UINT64_C( 6933831043195668658),
+    UINT64_C( 1324032285132800459), UINT64_C( 7124707266952677798), UINT64_C(11658038276153450306),
+    UINT64_C( 4977363436130901249), UINT64_C( 5210190366580344902), UINT64_C( 3108156558539612522),
+    UINT64_C(14125538175393468679), UINT64_C( 9261514582424403488), UINT64_C( 5447045847552290979),
+    UINT64_C(12580089363017589374), UINT64_C( 8294403423437598124), UINT64_C(16334008992497835247),
+    UINT64_C(12165520521951490185), UINT64_C(15824546467527834495), UINT64_C( 7498451141298770696),
+    UINT64_C( 7379563882259490631), UINT64_C( 2824578879199047561), UINT64_C( 8140712773885988125),
+    UINT64_C( 9849271684484259143), UINT64_C(16763876526171700003), UINT64_C( 5106439282578037771),
+    UINT64_C(10905297447288144061), UINT64_C(12343259230553480845), UINT64_C( 5731007217301644630),
+    UINT64_C(12314528772095401417), UINT64_C(10946872264133666568), UINT64_C(13419689232334614092),
+    UINT64_C( 3753746119953759424), UINT64_C( 8367772565428591454), UINT64_C( 3926495866587298520),
+    UINT64_C( 2723905631336572781), UINT64_C(12532204829496819920), UINT64_C( 5336432563854953615),
+    UINT64_C( 6316949314195301248), UINT64_C( 3509415609112782850), UINT64_C(15297166958091227027),
+    UINT64_C( 8549773958593912651), UINT64_C( 3671177558198870464), UINT64_C( 1006354190660639475),
+    UINT64_C(10707439233023848579), UINT64_C(10939261971405398967), UINT64_C(10969861733074502397),
+    UINT64_C( 1941964541131184210), UINT64_C(14882763651574308198), UINT64_C( 5836706508962576318),
+    UINT64_C(12750410154721500074), UINT64_C(12660881173349229513), UINT64_C( 4129505073859615839),
+    UINT64_C(15952902380303482074), UINT64_C( 8373056217427819556), UINT64_C(15126797936803265022),
+    UINT64_C(17905190626120093514), UINT64_C(13898863385969287844),
+};
+
+const uint64_t ntt64_1024_inv_omega_powers[2048] = {
+    UINT64_C(                   0), UINT64_C(                   1), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(                   1), UINT64_C(  761857419626957580),
+    UINT64_C( 1597448745227320835), UINT64_C( 2710721342076890128), UINT64_C(                   1),
+    UINT64_C( 1935475755192423451), UINT64_C(  761857419626957580), UINT64_C( 4377932053308918032),
+    UINT64_C( 1597448745227320835), UINT64_C( 3350471304231487799), UINT64_C( 2710721342076890128),
+    UINT64_C(  587789728123186789), UINT64_C(                   1), UINT64_C( 1157250618443755893),
+    UINT64_C( 1935475755192423451), UINT64_C( 3669174251795154654), UINT64_C(  761857419626957580),
+    UINT64_C( 2564987455095371273), UINT64_C( 4377932053308918032), UINT64_C( 2911249064764753991),
+    UINT64_C( 1597448745227320835), UINT64_C( 2221131196417811176), UINT64_C( 3350471304231487799),
+    UINT64_C( 3729729506260150116), UINT64_C( 2710721342076890128), UINT64_C( 1902221937773971537),
+    UINT64_C(  587789728123186789), UINT64_C(  905808140936917219), UINT64_C(                   1),
+    UINT64_C(  639054271616479546), UINT64_C( 1157250618443755893), UINT64_C( 3695716953298051000),
+    UINT64_C( 1935475755192423451), UINT64_C( 4376876956895888490), UINT64_C( 3669174251795154654),
+    UINT64_C( 1186577149813220829), UINT64_C(  761857419626957580), UINT64_C( 3204409509980914063),
+    UINT64_C( 2564987455095371273), UINT64_C(  710016457855204048), UINT64_C( 4377932053308918032),
+    UINT64_C( 2760778514640823230), UINT64_C( 2911249064764753991), UINT64_C( 2286621563204459736),
+    UINT64_C( 1597448745227320835), UINT64_C( 2732037966935316176), UINT64_C( 2221131196417811176),
+    UINT64_C(  622103464257758799), UINT64_C( 3350471304231487799), UINT64_C(  940418972106513807),
+    UINT64_C( 3729729506260150116), UINT64_C( 4480554820949425278), UINT64_C( 2710721342076890128),
+    UINT64_C( 3450216611516306163), UINT64_C( 1902221937773971537), UINT64_C( 1594171772562501572),
+    UINT64_C(  587789728123186789), UINT64_C( 2952442330362223250), UINT64_C(  905808140936917219),
+    UINT64_C( 2543517489763520818), UINT64_C(                   1), UINT64_C( 2518143763569825595),
+    UINT64_C(  639054271616479546), UINT64_C( 3264172983210285134), UINT64_C( 1157250618443755893),
+    UINT64_C( 4472195940790185488), UINT64_C( 3695716953298051000), UINT64_C( 1954247733637594417),
+    UINT64_C( 1935475755192423451), UINT64_C(  168638480407937784), UINT64_C( 4376876956895888490),
+    UINT64_C( 3392916100477006765), UINT64_C( 3669174251795154654), UINT64_C( 3567284871720512811),
+    UINT64_C( 1186577149813220829), UINT64_C( 1240199724792153435), UINT64_C(  761857419626957580),
+    UINT64_C( 2119496627304744197), UINT64_C( 3204409509980914063), UINT64_C( 3841181355456011629),
+    UINT64_C( 2564987455095371273), UINT64_C( 1499350668375303258), UINT64_C(  710016457855204048),
+    UINT64_C( 2111922664544689878), UINT64_C( 4377932053308918032), UINT64_C( 3129315382663975828),
+    UINT64_C( 2760778514640823230), UINT64_C(  555828328234909737), UINT64_C( 2911249064764753991),
+    UINT64_C( 3763491949833913430), UINT64_C( 2286621563204459736), UINT64_C( 1921677797576536864),
+    UINT64_C( 1597448745227320835), UINT64_C( 2741659047296060101), UINT64_C( 2732037966935316176),
+    UINT64_C( 2489668634475609185), UINT64_C( 2221131196417811176), UINT64_C( 2751233240531944786),
+    UINT64_C(  622103464257758799), UINT64_C(  725412660728098737), UINT64_C( 3350471304231487799),
+    UINT64_C( 3918705182497170566), UINT64_C(  940418972106513807), UINT64_C(  359507763978187366),
+    UINT64_C( 3729729506260150116), UINT64_C( 1234442225656141459), UINT64_C( 4480554820949425278),
+    UINT64_C(  780878330587786088), UINT64_C( 2710721342076890128), UINT64_C( 2144077764022377872),
+    UINT64_C( 3450216611516306163), UINT64_C( 1369146478535435641), UINT64_C( 1902221937773971537),
+    UINT64_C( 1248002338178829171), UINT64_C( 1594171772562501572), UINT64_C(  742013158005111008),
+    UINT64_C(  587789728123186789), UINT64_C( 3355949620552154141), UINT64_C( 2952442330362223250),
+    UINT64_C( 2174516744161416095), UINT64_C(  905808140936917219), UINT64_C( 1060613886943446140),
+    UINT64_C( 2543517489763520818), UINT64_C(   20889235576210587), UINT64_C(                   1),
+    UINT64_C( 4496393519485882796), UINT64_C( 2518143763569825595), UINT64_C( 4598429215067134441),
+    UINT64_C(  639054271616479546), UINT64_C( 3605333392231190231), UINT64_C( 3264172983210285134),
+    UINT64_C( 2549503998005738133), UINT64_C( 1157250618443755893), UINT64_C( 2537104245248995553),
+    UINT64_C( 4472195940790185488), UINT64_C( 2640980177126376160), UINT64_C( 3695716953298051000),
+    UINT64_C( 2193432016802705753), UINT64_C( 1954247733637594417), UINT64_C(  219696150493157962),
+    UINT64_C( 1935475755192423451), UINT64_C( 3311475337570466030), UINT64_C(  168638480407937784),
+    UINT64_C( 1661524647014962481), UINT64_C( 4376876956895888490), UINT64_C( 3742512134928732514),
+    UINT64_C( 3392916100477006765), UINT64_C( 4398151684498689441), UINT64_C( 3669174251795154654),
+    UINT64_C( 4225915260518903062), UINT64_C( 3567284871720512811), UINT64_C( 3926285842576049221),
+    UINT64_C( 1186577149813220829), UINT64_C( 1810022447750714951), UINT64_C( 1240199724792153435),
+    UINT64_C( 3487809379802074180), UINT64_C(  761857419626957580), UINT64_C( 3659058810323815146),
+    UINT64_C( 2119496627304744197), UINT64_C( 3492742837712600844), UINT64_C( 3204409509980914063),
+    UINT64_C( 1120814483693474787), UINT64_C( 3841181355456011629), UINT64_C( 2331988058544996978),
+    UINT64_C( 2564987455095371273), UINT64_C(  731765432187947649), UINT64_C( 1499350668375303258),
+    UINT64_C( 1893379940007000628), UINT64_C(  710016457855204048), UINT64_C( 2882382901230641861),
+    UINT64_C( 2111922664544689878), UINT64_C( 3123649255787014599), UINT64_C( 4377932053308918032),
+    UINT64_C(  285689082385626359), UINT64_C( 3129315382663975828), UINT64_C( 1730070688507719588),
+    UINT64_C( 2760778514640823230), UINT64_C( 4533773427922209202), UINT64_C(  555828328234909737),
+    UINT64_C( 1351908699938707637), UINT64_C( 2911249064764753991), UINT64_C( 2735397719334417532),
+    UINT64_C( 3763491949833913430), UINT64_C( 1384498799995891117), UINT64_C( 2286621563204459736),
+    UINT64_C( 4346702427129799775), UINT64_C( 1921677797576536864), UINT64_C(  601801449878166425),
+    UINT64_C( 1597448745227320835), UINT64_C( 4414492656106525461), UINT64_C( 2741659047296060101),
+    UINT64_C( 3790933749033458680), UINT64_C( 2732037966935316176), UINT64_C(  269306830564414396),
+    UINT64_C( 2489668634475609185), UINT64_C( 4015429778703181575), UINT64_C( 2221131196417811176),
+    UINT64_C( 1665826217812080608), UINT64_C( 2751233240531944786), UINT64_C( 1893480464646211789),
+    UINT64_C(  622103464257758799), UINT64_C( 2975220724877980164), UINT64_C(  725412660728098737),
+    UINT64_C( 4337533379984076294), UINT64_C( 3350471304231487799), UINT64_C( 3506432583028438168),
+    UINT64_C( 3918705182497170566), UINT64_C( 3001622122015329047), UINT64_C(  940418972106513807),
+    UINT64_C( 2548626421653948144), UINT64_C(  359507763978187366), UINT64_C(  773420327846667715),
+    UINT64_C( 3729729506260150116), UINT64_C( 4355191397499074548), UINT64_C( 1234442225656141459),
+    UINT64_C( 4078792279463268178), UINT64_C( 4480554820949425278), UINT64_C( 1396240308299844916),
+    UINT64_C(  780878330587786088), UINT64_C( 3686859850597173965), UINT64_C( 2710721342076890128),
+    UINT64_C(  987095120295666199), UINT64_C( 2144077764022377872), UINT64_C(  240478021931730534),
+    UINT64_C( 3450216611516306163), UINT64_C( 2017476264382028580), UINT64_C( 1369146478535435641),
+    UINT64_C( 4017163793695325786), UINT64_C( 1902221937773971537), UINT64_C( 1891136571931492898),
+    UINT64_C( 1248002338178829171), UINT64_C(  281473891911111437), UINT64_C( 1594171772562501572),
+    UINT64_C( 3645051885560699331), UINT64_C(  742013158005111008), UINT64_C( 4285343716429371071),
+    UINT64_C(  587789728123186789), UINT64_C( 4412928894968847241), UINT64_C( 3355949620552154141),
+    UINT64_C( 4224277455101570246), UINT64_C( 2952442330362223250), UINT64_C(  696257273046130940),
+    UINT64_C( 2174516744161416095), UINT64_C( 1438435331577261502), UINT64_C(  905808140936917219),
+    UINT64_C( 3466262785815169999), UINT64_C( 1060613886943446140), UINT64_C( 3478699736926467196),
+    UINT64_C( 2543517489763520818), UINT64_C( 2843325644492115562), UINT64_C(   20889235576210587),
+    UINT64_C(  566447303828363281), UINT64_C(                   1), UINT64_C(  259929117461122690),
+    UINT64_C( 4496393519485882796), UINT64_C( 3453319317856532861), UINT64_C( 2518143763569825595),
+    UINT64_C(  474918150100967821), UINT64_C( 4598429215067134441), UINT64_C(   54401244900000446),
+    UINT64_C(  639054271616479546), UINT64_C( 3559966345376906418), UINT64_C( 3605333392231190231),
+    UINT64_C( 1638356955527820207), UINT64_C( 3264172983210285134), UINT64_C( 2762525263948563595),
+    UINT64_C( 2549503998005738133), UINT64_C( 4486520662148728802), UINT64_C( 1157250618443755893),
+    UINT64_C(  845371447597876730), UINT64_C( 2537104245248995553), UINT64_C(  895520239994101401),
+    UINT64_C( 4472195940790185488), UINT64_C(  252360766593729347), UINT64_C( 2640980177126376160),
+    UINT64_C(  588918264645213105), UINT64_C( 3695716953298051000), UINT64_C(   69730768822361569),
+    UINT64_C( 2193432016802705753), UINT64_C( 4524716785335492365), UINT64_C( 1954247733637594417),
+    UINT64_C( 1988821503273290230), UINT64_C(  219696150493157962), UINT64_C( 4348048275020021631),
+    UINT64_C( 1935475755192423451), UINT64_C( 2769070406059010880), UINT64_C( 3311475337570466030),
+    UINT64_C(  890296088169815968), UINT64_C(  168638480407937784), UINT64_C(  929558361631964678),
+    UINT64_C( 1661524647014962481), UINT64_C( 2192654908740803739), UINT64_C( 4376876956895888490),
+    UINT64_C( 4164257115212022658), UINT64_C( 3742512134928732514), UINT64_C( 2303343809274674337),
+    UINT64_C( 3392916100477006765), UINT64_C( 1241070534499560266), UINT64_C( 4398151684498689441),
+    UINT64_C( 2397472584697199582), UINT64_C( 3669174251795154654), UINT64_C( 4562367534651267261),
+    UINT64_C( 4225915260518903062), UINT64_C( 2014884993995062392), UINT64_C( 3567284871720512811),
+    UINT64_C( 1439619867643852777), UINT64_C( 3926285842576049221), UINT64_C( 4337349785390127300),
+    UINT64_C( 1186577149813220829), UINT64_C(  389554631849401936), UINT64_C( 1810022447750714951),
+    UINT64_C( 2387157249192273180), UINT64_C( 1240199724792153435), UINT64_C(  503608079446868463),
+    UINT64_C( 3487809379802074180), UINT64_C( 3685969970649508253), UINT64_C(  761857419626957580),
+    UINT64_C( 1671710623904955317), UINT64_C( 3659058810323815146), UINT64_C( 2299554859802111181),
+    UINT64_C( 2119496627304744197), UINT64_C( 2390073540969705624), UINT64_C( 3492742837712600844),
+    UINT64_C( 3738786304041136961), UINT64_C( 3204409509980914063), UINT64_C( 1018672395301484236),
+    UINT64_C( 1120814483693474787), UINT64_C( 3082118428190026655), UINT64_C( 3841181355456011629),
+    UINT64_C(  500533747675448236), UINT64_C( 2331988058544996978), UINT64_C( 3651987553310790167),
+    UINT64_C( 2564987455095371273), UINT64_C( 4461354769932320401), UINT64_C(  731765432187947649),
+    UINT64_C(  475956906388850203), UINT64_C( 1499350668375303258), UINT64_C( 1707928536562031796),
+    UINT64_C( 1893379940007000628), UINT64_C( 4393533854220134376), UINT64_C(  710016457855204048),
+    UINT64_C(  972924256587072614), UINT64_C( 2882382901230641861), UINT64_C(  916448375621774411),
+    UINT64_C( 2111922664544689878), UINT64_C( 3709495328277798306), UINT64_C( 3123649255787014599),
+    UINT64_C( 3028333429807653516), UINT64_C( 4377932053308918032), UINT64_C( 1525463987982470819),
+    UINT64_C(  285689082385626359), UINT64_C( 2978938847393239339), UINT64_C( 3129315382663975828),
+    UINT64_C(  826033961802171977), UINT64_C( 1730070688507719588), UINT64_C( 2410903021786764458),
+    UINT64_C( 2760778514640823230), UINT64_C( 3991696183642031693), UINT64_C( 4533773427922209202),
+    UINT64_C( 3844646960227800326), UINT64_C(  555828328234909737), UINT64_C(   67514058206998667),
+    UINT64_C( 1351908699938707637), UINT64_C( 3133518461913316388), UINT64_C( 2911249064764753991),
+    UINT64_C(  881010135713225209), UINT64_C( 2735397719334417532), UINT64_C( 2072907831397488931),
+    UINT64_C( 3763491949833913430), UINT64_C( 1361718275344907393), UINT64_C( 1384498799995891117),
+    UINT64_C( 3818441481049447908), UINT64_C( 2286621563204459736), UINT64_C(  508668229988975855),
+    UINT64_C( 4346702427129799775), UINT64_C( 4222933272381401292), UINT64_C( 1921677797576536864),
+    UINT64_C( 3619050494210550099), UINT64_C(  601801449878166425), UINT64_C( 1989893649827399347),
+    UINT64_C( 1597448745227320835), UINT64_C( 2534087554591265284), UINT64_C( 4414492656106525461),
+    UINT64_C( 4377644333194108072), UINT64_C( 2741659047296060101), UINT64_C(  947653754879841762),
+    UINT64_C( 3790933749033458680), UINT64_C(  403912456936482342), UINT64_C( 2732037966935316176),
+    UINT64_C( 2738823817611127352), UINT64_C(  269306830564414396), UINT64_C( 3666301082479696243),
+    UINT64_C( 2489668634475609185), UINT64_C( 1341517252468509167), UINT64_C( 4015429778703181575),
+    UINT64_C( 1777355286419178464), UINT64_C( 2221131196417811176), UINT64_C( 3670210081921092754),
+    UINT64_C( 1665826217812080608), UINT64_C( 4406789659874271060), UINT64_C( 2751233240531944786),
+    UINT64_C( 3513100483767801861), UINT64_C( 1893480464646211789), UINT64_C( 2292061085530386825),
+    UINT64_C(  622103464257758799), UINT64_C(  341119304675706466), UINT64_C( 2975220724877980164),
+    UINT64_C( 2694178106302160104), UINT64_C(  725412660728098737), UINT64_C( 1014106208068792177),
+    UINT64_C( 4337533379984076294), UINT64_C( 1074070929108427065), UINT64_C( 3350471304231487799),
+    UINT64_C(  576559400180798021), UINT64_C( 3506432583028438168), UINT64_C( 3025652181590952288),
+    UINT64_C( 3918705182497170566), UINT64_C( 2552303672863703893), UINT64_C( 3001622122015329047),
+    UINT64_C( 3794907154875265834), UINT64_C(  940418972106513807), UINT64_C(  321732475974946595),
+    UINT64_C( 2548626421653948144), UINT64_C(  228925669915772045), UINT64_C(  359507763978187366),
+    UINT64_C( 4243975769763796303), UINT64_C(  773420327846667715), UINT64_C( 2992666649543695505),
+    UINT64_C( 3729729506260150116), UINT64_C( 4321344604600969480), UINT64_C( 4355191397499074548),
+    UINT64_C( 2266848510582485458), UINT64_C( 1234442225656141459), UINT64_C(  183141745685910901),
+    UINT64_C( 4078792279463268178), UINT64_C( 1074353827411989244), UINT64_C( 4480554820949425278),
+    UINT64_C( 1663327109906766898), UINT64_C( 1396240308299844916), UINT64_C( 3814388044261891669),
+    UINT64_C(  780878330587786088), UINT64_C( 1775408336037874833), UINT64_C( 3686859850597173965),
+    UINT64_C(  345749411583370006), UINT64_C( 2710721342076890128), UINT64_C(  726823701492065576),
+    UINT64_C(  987095120295666199), UINT64_C( 3659758494305853749), UINT64_C( 2144077764022377872),
+    UINT64_C( 3557789920013087769), UINT64_C(  240478021931730534), UINT64_C( 3059163844330049364),
+    UINT64_C( 3450216611516306163), UINT64_C( 1639503924621406683), UINT64_C( 2017476264382028580),
+    UINT64_C( 1870443561497370052), UINT64_C( 1369146478535435641), UINT64_C(  845826707751491030),
+    UINT64_C( 4017163793695325786), UINT64_C(  605646616495769660), UINT64_C( 1902221937773971537),
+    UINT64_C( 3977388320420463150), UINT64_C( 1891136571931492898), UINT64_C( 1923906360428460678),
+    UINT64_C( 1248002338178829171), UINT64_C( 2781862426208510548), UINT64_C(  281473891911111437),
+    UINT64_C( 2470563529832768384), UINT64_C( 1594171772562501572), UINT64_C( 3915913354687023729),
+    UINT64_C( 3645051885560699331), UINT64_C( 4481875101282788461), UINT64_C(  742013158005111008),
+    UINT64_C( 3618994673477555001), UINT64_C( 4285343716429371071), UINT64_C( 1720235100163152873),
+    UINT64_C(  587789728123186789), UINT64_C( 4531371429972998074), UINT64_C( 4412928894968847241),
+    UINT64_C( 1874405826707438282), UINT64_C( 3355949620552154141), UINT64_C( 2605888453019777046),
+    UINT64_C( 4224277455101570246), UINT64_C(   52571326077472245), UINT64_C( 2952442330362223250),
+    UINT64_C( 1956067693854901028), UINT64_C(  696257273046130940), UINT64_C( 2018806268997838899),
+    UINT64_C( 2174516744161416095), UINT64_C( 2873987136448611317), UINT64_C( 1438435331577261502),
+    UINT64_C(  263649993022218554), UINT64_C(  905808140936917219), UINT64_C( 1782453363043580942),
+    UINT64_C( 3466262785815169999), UINT64_C( 3131652907251769454), UINT64_C( 1060613886943446140),
+    UINT64_C( 2959817697163268132), UINT64_C( 3478699736926467196), UINT64_C( 3369395599594563037),
+    UINT64_C( 2543517489763520818), UINT64_C( 3951765528314891606), UINT64_C( 2843325644492115562),
+    UINT64_C( 2975744674484854296), UINT64_C(   20889235576210587), UINT64_C( 2119678531609113096),
+    UINT64_C(  566447303828363281), UINT64_C(  213757508065116192), UINT64_C(                   1),
+    UINT64_C( 1136970171935060389), UINT64_C(  259929117461122690), UINT64_C(  482239113613640005),
+    UINT64_C( 4496393519485882796), UINT64_C(  963572232227621138), UINT64_C( 3453319317856532861),
+    UINT64_C( 3301861002454902882), UINT64_C( 2518143763569825595), UINT64_C( 3335076197782862170),
+    UINT64_C(  474918150100967821), UINT64_C( 1071066424862730134), UINT64_C( 4598429215067134441),
+    UINT64_C( 4350719607959700781), UINT64_C(   54401244900000446), UINT64_C( 3444845605885419996),
+    UINT64_C(  639054271616479546), UINT64_C( 2474242528778897655), UINT64_C( 3559966345376906418),
+    UINT64_C( 3915370772345419643), UINT64_C( 3605333392231190231), UINT64_C( 1479519005097051223),
+    UINT64_C( 1638356955527820207), UINT64_C(  214940600524212797), UINT64_C( 3264172983210285134),
+    UINT64_C( 3309138426782285514), UINT64_C( 2762525263948563595), UINT64_C( 1130070916169322880),
+    UINT64_C( 2549503998005738133), UINT64_C( 1933456902796142000), UINT64_C( 4486520662148728802),
+    UINT64_C( 2504034192270386350), UINT64_C( 1157250618443755893), UINT64_C( 3152509391186728425),
+    UINT64_C(  845371447597876730), UINT64_C(   92669405019080994), UINT64_C( 2537104245248995553),
+    UINT64_C(   88313001273509989), UINT64_C(  895520239994101401), UINT64_C(  998342285220525008),
+    UINT64_C( 4472195940790185488), UINT64_C( 1570305887939507687), UINT64_C(  252360766593729347),
+    UINT64_C( 3432368257996892445), UINT64_C( 2640980177126376160), UINT64_C( 4345232052848843299),
+    UINT64_C(  588918264645213105), UINT64_C( 3923659608139143229), UINT64_C( 3695716953298051000),
+    UINT64_C( 2519742877070227732), UINT64_C(   69730768822361569), UINT64_C( 1324867958982897001),
+    UINT64_C( 2193432016802705753), UINT64_C( 1265464259985722977), UINT64_C( 4524716785335492365),
+    UINT64_C( 4564445537667472269), UINT64_C( 1954247733637594417), UINT64_C( 2757163375145060952),
+    UINT64_C( 1988821503273290230), UINT64_C(  256721156335580833), UINT64_C(  219696150493157962),
+    UINT64_C( 3252291321790303167), UINT64_C( 4348048275020021631), UINT64_C( 1175671755351670266),
+    UINT64_C( 1935475755192423451), UINT64_C(  623460423351514340), UINT64_C( 2769070406059010880),
+    UINT64_C( 4383764944061676575), UINT64_C( 3311475337570466030), UINT64_C( 2923393519039357984),
+    UINT64_C(  890296088169815968), UINT64_C( 3526947028660348658), UINT64_C(  168638480407937784),
+    UINT64_C( 3905541298627606936), UINT64_C(  929558361631964678), UINT64_C( 2313598627037541273),
+    UINT64_C( 1661524647014962481), UINT64_C(  574571179362302293), UINT64_C( 2192654908740803739),
+    UINT64_C( 2314735998187876572), UINT64_C( 4376876956895888490), UINT64_C( 3277577877463633490),
+    UINT64_C( 4164257115212022658), UINT64_C( 3238395188897438401), UINT64_C( 3742512134928732514),
+    UINT64_C( 4121606289736188335), UINT64_C( 2303343809274674337), UINT64_C(  457333833578157900),
+    UINT64_C( 3392916100477006765), UINT64_C( 4280677947144166879), UINT64_C( 1241070534499560266),
+    UINT64_C( 3394618906318341121), UINT64_C( 4398151684498689441), UINT64_C( 3245713155201487211),
+    UINT64_C( 2397472584697199582), UINT64_C( 1124193049055349191), UINT64_C( 3669174251795154654),
+    UINT64_C( 1876870525576028994), UINT64_C( 4562367534651267261), UINT64_C( 4521784081167841369),
+    UINT64_C( 4225915260518903062), UINT64_C( 3581470053372412633), UINT64_C( 2014884993995062392),
+    UINT64_C( 1514088270261435247), UINT64_C( 3567284871720512811), UINT64_C( 3249924556539299284),
+    UINT64_C( 1439619867643852777), UINT64_C( 2241636511418284617), UINT64_C( 3926285842576049221),
+    UINT64_C(  222363298121302350), UINT64_C( 4337349785390127300), UINT64_C( 4228381234493753401),
+    UINT64_C( 1186577149813220829), UINT64_C( 1533053825403530061), UINT64_C(  389554631849401936),
+    UINT64_C( 1165452898850607922), UINT64_C( 1810022447750714951), UINT64_C(  987100506351041320),
+    UINT64_C( 2387157249192273180), UINT64_C( 4427158721301587603), UINT64_C( 1240199724792153435),
+    UINT64_C( 2913941844454968569), UINT64_C(  503608079446868463), UINT64_C( 4279111333455130993),
+    UINT64_C( 3487809379802074180), UINT64_C( 4445216908273154147), UINT64_C( 3685969970649508253),
+    UINT64_C( 3475998875766277959), UINT64_C(  761857419626957580), UINT64_C(  829986534226567594),
+    UINT64_C( 1671710623904955317), UINT64_C( 3386023237205364002), UINT64_C( 3659058810323815146),
+    UINT64_C( 4334591613285693131), UINT64_C( 2299554859802111181), UINT64_C( 2590958914389261682),
+    UINT64_C( 2119496627304744197), UINT64_C( 2149368097306312619), UINT64_C( 2390073540969705624),
+    UINT64_C(  669859680137310667), UINT64_C( 3492742837712600844), UINT64_C(  345259560854666578),
+    UINT64_C( 3738786304041136961), UINT64_C( 3144438917205680352), UINT64_C( 3204409509980914063),
+    UINT64_C( 3734332116149173950), UINT64_C( 1018672395301484236), UINT64_C(  128472323706958535),
+    UINT64_C( 1120814483693474787), UINT64_C( 4128379535214024737), UINT64_C( 3082118428190026655),
+    UINT64_C( 1939475217606039421), UINT64_C( 3841181355456011629), UINT64_C( 1697176449389017037),
+    UINT64_C(  500533747675448236), UINT64_C(  187249431046427459), UINT64_C( 2331988058544996978),
+    UINT64_C( 4107323397594688662), UINT64_C( 3651987553310790167), UINT64_C( 1553039539814721126),
+    UINT64_C( 2564987455095371273), UINT64_C( 4126194883144571696), UINT64_C( 4461354769932320401),
+    UINT64_C( 1093332744300684120), UINT64_C(  731765432187947649), UINT64_C( 1142034642720021053),
+    UINT64_C(  475956906388850203), UINT64_C( 3664247085526192562), UINT64_C( 1499350668375303258),
+    UINT64_C( 2538085162567975975), UINT64_C( 1707928536562031796), UINT64_C( 4172578522755673204),
+    UINT64_C( 1893379940007000628), UINT64_C( 1229784470992723326), UINT64_C( 4393533854220134376),
+    UINT64_C( 1496926789713922054), UINT64_C(  710016457855204048), UINT64_C( 1256763710343728242),
+    UINT64_C(  972924256587072614), UINT64_C( 3018668621686806755), UINT64_C( 2882382901230641861),
+    UINT64_C( 4322585822259518046), UINT64_C(  916448375621774411), UINT64_C( 3479045960750655309),
+    UINT64_C( 2111922664544689878), UINT64_C( 4132097551481449465), UINT64_C( 3709495328277798306),
+    UINT64_C( 3281338745396304689), UINT64_C( 3123649255787014599), UINT64_C(  707982160446641454),
+    UINT64_C( 3028333429807653516), UINT64_C( 2242618964484433073), UINT64_C( 4377932053308918032),
+    UINT64_C( 1446465725090073460), UINT64_C( 1525463987982470819), UINT64_C(  217460571654969358),
+    UINT64_C(  285689082385626359), UINT64_C( 3380477618653367844), UINT64_C( 2978938847393239339),
+    UINT64_C( 3638408044795586258), UINT64_C( 3129315382663975828), UINT64_C( 2737073233102681860),
+    UINT64_C(  826033961802171977), UINT64_C( 2811852688171289856), UINT64_C( 1730070688507719588),
+    UINT64_C( 4046268064833756812), UINT64_C( 2410903021786764458), UINT64_C( 2285274162607378987),
+    UINT64_C( 2760778514640823230), UINT64_C( 3930709610593225508), UINT64_C( 3991696183642031693),
+    UINT64_C( 4403506197958660238), UINT64_C( 4533773427922209202), UINT64_C( 1104068613108266923),
+    UINT64_C( 3844646960227800326), UINT64_C(  181220087458713714), UINT64_C(  555828328234909737),
+    UINT64_C(  576549880350533040), UINT64_C(   67514058206998667), UINT64_C( 3102951436448193621),
+    UINT64_C( 1351908699938707637), UINT64_C( 2597643806533680773), UINT64_C( 3133518461913316388),
+    UINT64_C( 3396000543754538034), UINT64_C( 2911249064764753991), UINT64_C( 4360097470762206737),
+    UINT64_C(  881010135713225209), UINT64_C( 3249634314648685198), UINT64_C( 2735397719334417532),
+    UINT64_C(  448202126250173565), UINT64_C( 2072907831397488931), UINT64_C( 2969192492117753139),
+    UINT64_C( 3763491949833913430), UINT64_C( 1080301474579015457), UINT64_C( 1361718275344907393),
+    UINT64_C(  538516744196509251), UINT64_C( 1384498799995891117), UINT64_C(  516132550137894883),
+    UINT64_C( 3818441481049447908), UINT64_C(  967167880729346584), UINT64_C( 2286621563204459736),
+    UINT64_C( 1525871210789010239), UINT64_C(  508668229988975855), UINT64_C( 2116801334240291716),
+    UINT64_C( 4346702427129799775), UINT64_C( 2935790622343543901), UINT64_C( 4222933272381401292),
+    UINT64_C( 1852184818241988882), UINT64_C( 1921677797576536864), UINT64_C( 3985388427924175927),
+    UINT64_C( 3619050494210550099), UINT64_C( 2610827803358048316), UINT64_C(  601801449878166425),
+    UINT64_C( 2356451789188822646), UINT64_C( 1989893649827399347), UINT64_C( 3194706432379451517),
+    UINT64_C( 1597448745227320835), UINT64_C(  135388361897363864), UINT64_C( 2534087554591265284),
+    UINT64_C(  809272002027209176), UINT64_C( 4414492656106525461), UINT64_C( 1086187686209696124),
+    UINT64_C( 4377644333194108072), UINT64_C( 2229343474486230970), UINT64_C( 2741659047296060101),
+    UINT64_C(  420716886884460848), UINT64_C(  947653754879841762), UINT64_C(  330027879291519521),
+    UINT64_C( 3790933749033458680), UINT64_C( 4366668526428885515), UINT64_C(  403912456936482342),
+    UINT64_C( 3293764912996114848), UINT64_C( 2732037966935316176), UINT64_C(  787394278904577301),
+    UINT64_C( 2738823817611127352), UINT64_C( 4000825487962242896), UINT64_C(  269306830564414396),
+    UINT64_C( 4100879462871234869), UINT64_C( 3666301082479696243), UINT64_C( 1215954448296340858),
+    UINT64_C( 2489668634475609185), UINT64_C( 3367345159394646143), UINT64_C( 1341517252468509167),
+    UINT64_C( 3633422997847512353), UINT64_C( 4015429778703181575), UINT64_C( 3132880113770088014),
+    UINT64_C( 1777355286419178464), UINT64_C( 3145964027948816410), UINT64_C( 2221131196417811176),
+    UINT64_C(  890995105533806502), UINT64_C( 3670210081921092754), UINT64_C( 2239558735835916297),
+    UINT64_C( 1665826217812080608), UINT64_C(  229481740030525564), UINT64_C( 4406789659874271060),
+    UINT64_C(  563431740559122686), UINT64_C( 2751233240531944786), UINT64_C(  528183770302926512),
+    UINT64_C( 3513100483767801861), UINT64_C( 1499756067057231230), UINT64_C( 1893480464646211789),
+    UINT64_C( 3649531601045992464), UINT64_C( 2292061085530386825), UINT64_C(  372852338023073976),
+    UINT64_C(  622103464257758799), UINT64_C( 3673249488438930105), UINT64_C(  341119304675706466),
+    UINT64_C( 1331772203197056095), UINT64_C( 2975220724877980164), UINT64_C(  652533216445055972),
+    UINT64_C( 2694178106302160104), UINT64_C( 1309048532335129902), UINT64_C(  725412660728098737),
+    UINT64_C( 3762709555740706764), UINT64_C( 1014106208068792177), UINT64_C( 1150065803392597846),
+    UINT64_C( 4337533379984076294), UINT64_C( 2747844116629241812), UINT64_C( 1074070929108427065),
+    UINT64_C( 4580317839448440772), UINT64_C( 3350471304231487799), UINT64_C( 3579309749962466460),
+    UINT64_C(  576559400180798021), UINT64_C( 3002134461744886342), UINT64_C( 3506432583028438168),
+    UINT64_C(  265849896788346259), UINT64_C( 3025652181590952288), UINT64_C( 2997138256801022277),
+    UINT64_C( 3918705182497170566), UINT64_C( 2766795047862501731), UINT64_C( 2552303672863703893),
+    UINT64_C( 2935145024351236606), UINT64_C( 3001622122015329047), UINT64_C( 2623314936775053810),
+    UINT64_C( 3794907154875265834), UINT64_C( 3519771985760240459), UINT64_C(  940418972106513807),
+    UINT64_C( 1478634811053175701), UINT64_C(  321732475974946595), UINT64_C( 3740670769793061656),
+    UINT64_C( 2548626421653948144), UINT64_C( 4474914786204157506), UINT64_C(  228925669915772045),
+    UINT64_C( 1610800114724148084), UINT64_C(  359507763978187366), UINT64_C( 2878228257628456680),
+    UINT64_C( 4243975769763796303), UINT64_C( 2893775854028913106), UINT64_C(  773420327846667715),
+    UINT64_C( 3119415960364015505), UINT64_C( 2992666649543695505), UINT64_C( 4029597475302710099),
+    UINT64_C( 3729729506260150116), UINT64_C( 1934826210171416308), UINT64_C( 4321344604600969480),
+    UINT64_C(   32667495058069305), UINT64_C( 4355191397499074548), UINT64_C( 4455898604664459746),
+    UINT64_C( 2266848510582485458), UINT64_C(  315810430551031626), UINT64_C( 1234442225656141459),
+    UINT64_C( 2296307372821275815), UINT64_C(  183141745685910901), UINT64_C( 2076624595876616786),
+    UINT64_C( 4078792279463268178), UINT64_C( 1123780004951789812), UINT64_C( 1074353827411989244),
+    UINT64_C( 4370176269990062499), UINT64_C( 4480554820949425278), UINT64_C( 3178934214101961218),
+    UINT64_C( 1663327109906766898), UINT64_C( 1645951455682690821), UINT64_C( 1396240308299844916),
+    UINT64_C( 3632461182717925746), UINT64_C( 3814388044261891669), UINT64_C( 3025697040481053315),
+    UINT64_C(  780878330587786088), UINT64_C( 1241943892123899649), UINT64_C( 1775408336037874833),
+    UINT64_C(  280546723785505881), UINT64_C( 3686859850597173965), UINT64_C( 3846627600075277591),
+    UINT64_C(  345749411583370006), UINT64_C( 1082196204383124166), UINT64_C( 2710721342076890128),
+    UINT64_C( 2518421964070420713), UINT64_C(  726823701492065576), UINT64_C( 2681365935457499374),
+    UINT64_C(  987095120295666199), UINT64_C( 4427242678814347554), UINT64_C( 3659758494305853749),
+    UINT64_C( 1019335479952936867), UINT64_C( 2144077764022377872), UINT64_C( 2576507824955878287),
+    UINT64_C( 3557789920013087769), UINT64_C( 3374530130842092923), UINT64_C(  240478021931730534),
+    UINT64_C( 3371492191676195091), UINT64_C( 3059163844330049364), UINT64_C( 4004348599691564871),
+    UINT64_C( 3450216611516306163), UINT64_C( 3032448689878547779), UINT64_C( 1639503924621406683),
+    UINT64_C( 1074338829714465939), UINT64_C( 2017476264382028580), UINT64_C( 4068021235021803744),
+    UINT64_C( 1870443561497370052), UINT64_C( 4223786740293072220), UINT64_C( 1369146478535435641),
+    UINT64_C( 2830509201689204628), UINT64_C(  845826707751491030), UINT64_C(  907536292839148742),
+    UINT64_C( 4017163793695325786), UINT64_C( 2157326113251484673), UINT64_C(  605646616495769660),
+    UINT64_C( 3115166189560863868), UINT64_C( 1902221937773971537), UINT64_C( 1869220585158753174),
+    UINT64_C( 3977388320420463150), UINT64_C(  371579570945566400), UINT64_C( 1891136571931492898),
+    UINT64_C(  943212704854558556), UINT64_C( 1923906360428460678), UINT64_C( 1792096719878361652),
+    UINT64_C( 1248002338178829171), UINT64_C( 1466663677672983396), UINT64_C( 2781862426208510548),
+    UINT64_C(  562171890205887871), UINT64_C(  281473891911111437), UINT64_C( 1462672659301410100),
+    UINT64_C( 2470563529832768384), UINT64_C( 2983502435741321882), UINT64_C( 1594171772562501572),
+    UINT64_C( 1874967952393962103), UINT64_C( 3915913354687023729), UINT64_C( 2409664670287100869),
+    UINT64_C( 3645051885560699331), UINT64_C( 2661589922495033735), UINT64_C( 4481875101282788461),
+    UINT64_C( 2399326072056448834), UINT64_C(  742013158005111008), UINT64_C( 3073592028485366274),
+    UINT64_C( 3618994673477555001), UINT64_C(    6115453881648595), UINT64_C( 4285343716429371071),
+    UINT64_C( 4592307042978040560), UINT64_C( 1720235100163152873), UINT64_C( 2288957866861762576),
+    UINT64_C(  587789728123186789), UINT64_C( 1424083479747005929), UINT64_C( 4531371429972998074),
+    UINT64_C(  642576094567239175), UINT64_C( 4412928894968847241), UINT64_C( 3548307891575053927),
+    UINT64_C( 1874405826707438282), UINT64_C( 2777464262913720573), UINT64_C( 3355949620552154141),
+    UINT64_C(  655549401545426078), UINT64_C( 2605888453019777046), UINT64_C( 4046281895801086962),
+    UINT64_C( 4224277455101570246), UINT64_C(  994705779007527844), UINT64_C(   52571326077472245),
+    UINT64_C( 3788628997163465257), UINT64_C( 2952442330362223250), UINT64_C( 3630062051780545542),
+    UINT64_C( 1956067693854901028), UINT64_C( 3470702154560351748), UINT64_C(  696257273046130940),
+    UINT64_C( 2244818812920044936), UINT64_C( 2018806268997838899), UINT64_C( 4139786193388248566),
+    UINT64_C( 2174516744161416095), UINT64_C( 1595482593607645320), UINT64_C( 2873987136448611317),
+    UINT64_C(  836054860303693243), UINT64_C( 1438435331577261502), UINT64_C( 3165364809910252476),
+    UINT64_C(  263649993022218554), UINT64_C( 3709826170813048035), UINT64_C(  905808140936917219),
+    UINT64_C( 3693891628877652244), UINT64_C( 1782453363043580942), UINT64_C( 1511309992815106380),
+    UINT64_C( 3466262785815169999), UINT64_C( 1184066495523972765), UINT64_C( 3131652907251769454),
+    UINT64_C(   19602533819938967), UINT64_C( 1060613886943446140), UINT64_C( 3834646878792466042),
+    UINT64_C( 2959817697163268132), UINT64_C( 2442907545427550635), UINT64_C( 3478699736926467196),
+    UINT64_C( 1125377840692116595), UINT64_C( 3369395599594563037), UINT64_C( 3626835293658153146),
+    UINT64_C( 2543517489763520818), UINT64_C( 1885361656605342679), UINT64_C( 3951765528314891606),
+    UINT64_C( 1924881649978995319), UINT64_C( 2843325644492115562), UINT64_C(  645582641086574590),
+    UINT64_C( 2975744674484854296), UINT64_C(  994161879564739462), UINT64_C(   20889235576210587),
+    UINT64_C(  132931943920464216), UINT64_C( 2119678531609113096), UINT64_C( 3017470356035989713),
+    UINT64_C(  566447303828363281), UINT64_C(  451157696725097893), UINT64_C(  213757508065116192),
+    UINT64_C( 2210974279307515123), UINT64_C(                   0), UINT64_C(                   4),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C(                   4),
+    UINT64_C( 3047429678507845205), UINT64_C( 6389794980909314552), UINT64_C(10842885368307613476),
+    UINT64_C(                   4), UINT64_C( 7741903020769731621), UINT64_C( 3047429678507845205),
+    UINT64_C(17511728213235757668), UINT64_C( 6389794980909314552), UINT64_C(13401885216926016661),
+    UINT64_C(10842885368307613476), UINT64_C( 2351158912492758640), UINT64_C(                   4),
+    UINT64_C( 4629002473775046183), UINT64_C( 7741903020769731621), UINT64_C(14676697007180690308),
+    UINT64_C( 3047429678507845205), UINT64_C(10259949820381535209), UINT64_C(17511728213235757668),
+    UINT64_C(11644996259059072847), UINT64_C( 6389794980909314552), UINT64_C( 8884524785671288102),
+    UINT64_C(13401885216926016661), UINT64_C(14918918025040673339), UINT64_C(10842885368307613476),
+    UINT64_C( 7608887751095923315), UINT64_C( 2351158912492758640), UINT64_C( 3623232563747686574),
+    UINT64_C(                   4), UINT64_C( 2556217086465930670), UINT64_C( 4629002473775046183),
+    UINT64_C(14782867813192276210), UINT64_C( 7741903020769731621), UINT64_C(17507507827583639480),
+    UINT64_C(14676697007180690308), UINT64_C( 4746308599252906500), UINT64_C( 3047429678507845205),
+    UINT64_C(12817638039923718863), UINT64_C(10259949820381535209), UINT64_C( 2840065831420830065),
+    UINT64_C(17511728213235757668), UINT64_C(11043114058563346863), UINT64_C(11644996259059072847),
+    UINT64_C( 9146486252817883622), UINT64_C( 6389794980909314552), UINT64_C(10928151867741318085),
+    UINT64_C( 8884524785671288102), UINT64_C( 2488413857031047351), UINT64_C(13401885216926016661),
+    UINT64_C( 3761675888426073602), UINT64_C(14918918025040673339), UINT64_C(17922219283797788657),
+    UINT64_C(10842885368307613476), UINT64_C(13800866446065292065), UINT64_C( 7608887751095923315),
+    UINT64_C( 6376687090250037436), UINT64_C( 2351158912492758640), UINT64_C(11809769321448950687),
+    UINT64_C( 3623232563747686574), UINT64_C(10174069959054132969), UINT64_C(                   4),
+    UINT64_C(10072575054279351582), UINT64_C( 2556217086465930670), UINT64_C(13056691932841204314),
+    UINT64_C( 4629002473775046183), UINT64_C(17888783763160829334), UINT64_C(14782867813192276210),
+    UINT64_C( 7816990934550415852), UINT64_C( 7741903020769731621), UINT64_C(  674553921631754431),
+    UINT64_C(17507507827583639480), UINT64_C(13571664401908093354), UINT64_C(14676697007180690308),
+    UINT64_C(14269139486882120945), UINT64_C( 4746308599252906500), UINT64_C( 4960798899168637972),
+    UINT64_C( 3047429678507845205), UINT64_C( 8477986509219018200), UINT64_C(12817638039923718863),
+    UINT64_C(15364725421824121569), UINT64_C(10259949820381535209), UINT64_C( 5997402673501242327),
+    UINT64_C( 2840065831420830065), UINT64_C( 8447690658178800776), UINT64_C(17511728213235757668),
+    UINT64_C(12517261530655964455), UINT64_C(11043114058563346863), UINT64_C( 2223313312939649808),
+    UINT64_C(11644996259059072847), UINT64_C(15053967799335727255), UINT64_C( 9146486252817883622),
+    UINT64_C( 7686711190306185003), UINT64_C( 6389794980909314552), UINT64_C(10966636189184293973),
+    UINT64_C(10928151867741318085), UINT64_C( 9958674537902485385), UINT64_C( 8884524785671288102),
+    UINT64_C(11004932962127832900), UINT64_C( 2488413857031047351), UINT64_C( 2901650642912409121),
+    UINT64_C(13401885216926016661), UINT64_C(15674820729988758831), UINT64_C( 3761675888426073602),
+    UINT64_C( 1438031055912756488), UINT64_C(14918918025040673339), UINT64_C( 4937768902624589955),
+    UINT64_C(17922219283797788657), UINT64_C( 3123513322351159609), UINT64_C(10842885368307613476),
+    UINT64_C( 8576311056089553381), UINT64_C(13800866446065292065), UINT64_C( 5476585914141769315),
+    UINT64_C( 7608887751095923315), UINT64_C( 4992009352715341068), UINT64_C( 6376687090250037436),
+    UINT64_C( 2968052632020458530), UINT64_C( 2351158912492758640), UINT64_C(13423798482208682136),
+    UINT64_C(11809769321448950687), UINT64_C( 8698066976645706868), UINT64_C( 3623232563747686574),
+    UINT64_C( 4242455547773805283), UINT64_C(10174069959054132969), UINT64_C(   83556942304842756),
+    UINT64_C(                   4), UINT64_C(17985574077943619039), UINT64_C(10072575054279351582),
+    UINT64_C(18393716860268627612), UINT64_C( 2556217086465930670), UINT64_C(14421333568924831368),
+    UINT64_C(13056691932841204314), UINT64_C(10198015992023002346), UINT64_C( 4629002473775046183),
+    UINT64_C(10148416980996031784), UINT64_C(17888783763160829334), UINT64_C(10563920708505556242),
+    UINT64_C(14782867813192276210), UINT64_C( 8773728067210865869), UINT64_C( 7816990934550415852),
+    UINT64_C(  878784601972636140), UINT64_C( 7741903020769731621), UINT64_C(13245901350281928823),
+    UINT64_C(  674553921631754431), UINT64_C( 6646098588059882388), UINT64_C(17507507827583639480),
+    UINT64_C(14970048539715003181), UINT64_C(13571664401908093354), UINT64_C(17592606737994843699),
+    UINT64_C(14676697007180690308), UINT64_C(16903661042075694818), UINT64_C(14269139486882120945),
+    UINT64_C(15705143370304273599), UINT64_C( 4746308599252906500), UINT64_C( 7240089791002895170),
+    UINT64_C( 4960798899168637972), UINT64_C(13951237519208364868), UINT64_C( 3047429678507845205),
+    UINT64_C(14636235241295332078), UINT64_C( 8477986509219018200), UINT64_C(13970971350850471620),
+    UINT64_C(12817638039923718863), UINT64_C( 4483257934773921047), UINT64_C(15364725421824121569),
+    UINT64_C( 9327952234180033476), UINT64_C(10259949820381535209), UINT64_C( 2927061728751804894),
+    UINT64_C( 5997402673501242327), UINT64_C( 7573519760028039506), UINT64_C( 2840065831420830065),
+    UINT64_C(11529531604922623763), UINT64_C( 8447690658178800776), UINT64_C(12494597023148119429),
+    UINT64_C(17511728213235757668), UINT64_C( 1142756329542511018), UINT64_C(12517261530655964455),
+    UINT64_C( 6920282754030912155), UINT64_C(11043114058563346863), UINT64_C(18135093711688925393),
+    UINT64_C( 2223313312939649808), UINT64_C( 5407634799754856963), UINT64_C(11644996259059072847),
+    UINT64_C(10941590877337723575), UINT64_C(15053967799335727255), UINT64_C( 5537995199983591519),
+    UINT64_C( 9146486252817883622), UINT64_C(17386809708519284030), UINT64_C( 7686711190306185003),
+    UINT64_C( 2407205799512677458), UINT64_C( 6389794980909314552), UINT64_C(17657970624426188099),
+    UINT64_C(10966636189184293973), UINT64_C(15163734996133908791), UINT64_C(10928151867741318085),
+    UINT64_C( 1077227322257662846), UINT64_C( 9958674537902485385), UINT64_C(16061719114812804757),
+    UINT64_C( 8884524785671288102), UINT64_C( 6663304871248354980), UINT64_C(11004932962127832900),
+    UINT64_C( 7573921858584884152), UINT64_C( 2488413857031047351), UINT64_C(11900882899511978789),
+    UINT64_C( 2901650642912409121), UINT64_C(17350133519936389927), UINT64_C(13401885216926016661),
+    UINT64_C(14025730332113821184), UINT64_C(15674820729988758831), UINT64_C(12006488488061374836),
+    UINT64_C( 3761675888426073602), UINT64_C(10194505686615842373), UINT64_C( 1438031055912756488),
+    UINT64_C( 3093681311386685971), UINT64_C(14918918025040673339), UINT64_C(17420765589996383288),
+    UINT64_C( 4937768902624589955), UINT64_C(16315169117853152407), UINT64_C(17922219283797788657),
+    UINT64_C( 5584961233199406945), UINT64_C( 3123513322351159609), UINT64_C(14747439402388767897),
+    UINT64_C(10842885368307613476), UINT64_C( 3948380481182684082), UINT64_C( 8576311056089553381),
+    UINT64_C(  961912087726926834), UINT64_C(13800866446065292065), UINT64_C( 8069905057528153739),
+    UINT64_C( 5476585914141769315), UINT64_C(16068655174781381635), UINT64_C( 7608887751095923315),
+    UINT64_C( 7564546287726008543), UINT64_C( 4992009352715341068), UINT64_C( 1125895567644451247),
+    UINT64_C( 6376687090250037436), UINT64_C(14580207542242868544), UINT64_C( 2968052632020458530),
+    UINT64_C(17141374865717568015), UINT64_C( 2351158912492758640), UINT64_C(17651715579875475188),
+    UINT64_C(13423798482208682136), UINT64_C(16897109820406363522), UINT64_C(11809769321448950687),
+    UINT64_C( 2785029092184537364), UINT64_C( 8698066976645706868), UINT64_C( 5753741326309074113),
+    UINT64_C( 3623232563747686574), UINT64_C(13865051143260747723), UINT64_C( 4242455547773805283),
+    UINT64_C(13914798947705936754), UINT64_C(10174069959054132969), UINT64_C(11373302577968517803),
+    UINT64_C(   83556942304842756), UINT64_C( 2265789215313464191), UINT64_C(                   4),
+    UINT64_C( 1039716469844495838), UINT64_C(17985574077943619039), UINT64_C(13813277271426198918),
+    UINT64_C(10072575054279351582), UINT64_C( 1899672600403880563), UINT64_C(18393716860268627612),
+    UINT64_C(  217604979600002846), UINT64_C( 2556217086465930670), UINT64_C(14239865381507695230),
+    UINT64_C(14421333568924831368), UINT64_C( 6553427822111312839), UINT64_C(13056691932841204314),
+    UINT64_C(11050101055794308357), UINT64_C(10198015992023002346), UINT64_C(17946082648595002870),
+    UINT64_C( 4629002473775046183), UINT64_C( 3381485790391523437), UINT64_C(10148416980996031784),
+    UINT64_C( 3582080959976423101), UINT64_C(17888783763160829334), UINT64_C( 1009443066374922318),
+    UINT64_C(10563920708505556242), UINT64_C( 2355673058580863926), UINT64_C(14782867813192276210),
+    UINT64_C(  278923075289447638), UINT64_C( 8773728067210865869), UINT64_C(18098867141342057868),
+    UINT64_C( 7816990934550415852), UINT64_C( 7955286013093199779), UINT64_C(  878784601972636140),
+    UINT64_C(17392193100080171480), UINT64_C( 7741903020769731621), UINT64_C(11076281624236097625),
+    UINT64_C(13245901350281928823), UINT64_C( 3561184352679281267), UINT64_C(  674553921631754431),
+    UINT64_C( 3718233446527876874), UINT64_C( 6646098588059882388), UINT64_C( 8770619634963257798),
+    UINT64_C(17507507827583639480), UINT64_C(16657028460848171997), UINT64_C(14970048539715003181),
+    UINT64_C( 9213375237098742353), UINT64_C(13571664401908093354), UINT64_C( 4964282137998265313),
+    UINT64_C(17592606737994843699), UINT64_C( 9589890338788845172), UINT64_C(14676697007180690308),
+    UINT64_C(18249470138605158188), UINT64_C(16903661042075694818), UINT64_C( 8059539975980288936),
+    UINT64_C(14269139486882120945), UINT64_C( 5758479470575439236), UINT64_C(15705143370304273599),
+    UINT64_C(17349399141560593947), UINT64_C( 4746308599252906500), UINT64_C( 1558218527397615355),
+    UINT64_C( 7240089791002895170), UINT64_C( 9548628996769139362), UINT64_C( 4960798899168637972),
+    UINT64_C( 2014432317787483692), UINT64_C(13951237519208364868), UINT64_C(14743879882598105032),
+    UINT64_C( 3047429678507845205), UINT64_C( 6686842495619853931), UINT64_C(14636235241295332078),
+    UINT64_C( 9198219439208489655), UINT64_C( 8477986509219018200), UINT64_C( 9560294163878869195),
+    UINT64_C(13970971350850471620), UINT64_C(14955145216164620896), UINT64_C(12817638039923718863),
+    UINT64_C( 4074689581205956847), UINT64_C( 4483257934773921047), UINT64_C(12328473712760166841),
+    UINT64_C(15364725421824121569), UINT64_C( 2002134990701802723), UINT64_C( 9327952234180033476),
+    UINT64_C(14607950213243232024), UINT64_C(10259949820381535209), UINT64_C(17845419079729368774),
+    UINT64_C( 2927061728751804894), UINT64_C( 1903827625555410111), UINT64_C( 5997402673501242327),
+    UINT64_C( 6831714146248160555), UINT64_C( 7573519760028039506), UINT64_C(17574135416880623349),
+    UINT64_C( 2840065831420830065), UINT64_C( 3891697026348309466), UINT64_C(11529531604922623763),
+    UINT64_C( 3665793502487115550), UINT64_C( 8447690658178800776), UINT64_C(14837981313111265704),
+    UINT64_C(12494597023148119429), UINT64_C(12113333719230673234), UINT64_C(17511728213235757668),
+    UINT64_C( 6101855951929913082), UINT64_C( 1142756329542511018), UINT64_C(11915755389573015561),
+    UINT64_C(12517261530655964455), UINT64_C( 3304135847208704047), UINT64_C( 6920282754030912155),
+    UINT64_C( 9643612087147104938), UINT64_C(11043114058563346863), UINT64_C(15966784734568204765),
+    UINT64_C(18135093711688925393), UINT64_C(15378587840911276424), UINT64_C( 2223313312939649808),
+    UINT64_C(  270056232827995987), UINT64_C( 5407634799754856963), UINT64_C(12534073847653326777),
+    UINT64_C(11644996259059072847), UINT64_C( 3524040542852918050), UINT64_C(10941590877337723575),
+    UINT64_C( 8291631325589996226), UINT64_C(15053967799335727255), UINT64_C( 5446873101379656178),
+    UINT64_C( 5537995199983591519), UINT64_C(15273765924197866240), UINT64_C( 9146486252817883622),
+    UINT64_C( 2034672919955913358), UINT64_C(17386809708519284030), UINT64_C(16891733089525687680),
+    UINT64_C( 7686711190306185003), UINT64_C(14476201976842271108), UINT64_C( 2407205799512677458),
+    UINT64_C( 7959574599309636268), UINT64_C( 6389794980909314552), UINT64_C(10136350218365110649),
+    UINT64_C(17657970624426188099), UINT64_C(17510577332776517823), UINT64_C(10966636189184293973),
+    UINT64_C( 3790615019519385564), UINT64_C(15163734996133908791), UINT64_C( 1615649827745937260),
+    UINT64_C(10928151867741318085), UINT64_C(10955295270444562922), UINT64_C( 1077227322257662846),
+    UINT64_C(14665204329918856608), UINT64_C( 9958674537902485385), UINT64_C( 5366069009874062879),
+    UINT64_C(16061719114812804757), UINT64_C( 7109421145676748583), UINT64_C( 8884524785671288102),
+    UINT64_C(14680840327684442728), UINT64_C( 6663304871248354980), UINT64_C(17627158639497170344),
+    UINT64_C(11004932962127832900), UINT64_C(14052401935071276086), UINT64_C( 7573921858584884152),
+    UINT64_C( 9168244342121592084), UINT64_C( 2488413857031047351), UINT64_C( 1364477218702832529),
+    UINT64_C(11900882899511978789), UINT64_C(10776712425208693057), UINT64_C( 2901650642912409121),
+    UINT64_C( 4056424832275188522), UINT64_C(17350133519936389927), UINT64_C( 4296283716433729246),
+    UINT64_C(13401885216926016661), UINT64_C( 2306237600723203349), UINT64_C(14025730332113821184),
+    UINT64_C(12102608726363868270), UINT64_C(15674820729988758831), UINT64_C(10209214691454865441),
+    UINT64_C(12006488488061374836), UINT64_C(15179628619501137484), UINT64_C( 3761675888426073602),
+    UINT64_C( 1286929903899792666), UINT64_C(10194505686615842373), UINT64_C(  915702679663092652),
+    UINT64_C( 1438031055912756488), UINT64_C(16975903079055268135), UINT64_C( 3093681311386685971),
+    UINT64_C(11970666598174840493), UINT64_C(14918918025040673339), UINT64_C(17285378418403962355),
+    UINT64_C(17420765589996383288), UINT64_C( 9067394042329986124), UINT64_C( 4937768902624589955),
+    UINT64_C(  732566982743647182), UINT64_C(16315169117853152407), UINT64_C( 4297415309647977967),
+    UINT64_C(17922219283797788657), UINT64_C( 6653308439627100091), UINT64_C( 5584961233199406945),
+    UINT64_C(15257552177047641205), UINT64_C( 3123513322351159609), UINT64_C( 7101633344151534021),
+    UINT64_C(14747439402388767897), UINT64_C( 1382997646333486779), UINT64_C(10842885368307613476),
+    UINT64_C( 2907294805968276505), UINT64_C( 3948380481182684082), UINT64_C(14639033977223486504),
+    UINT64_C( 8576311056089553381), UINT64_C(14231159680052420591), UINT64_C(  961912087726926834),
+    UINT64_C(12236655377320257229), UINT64_C(13800866446065292065), UINT64_C( 6558015698485658766),
+    UINT64_C( 8069905057528153739), UINT64_C( 7481774245989516754), UINT64_C( 5476585914141769315),
+    UINT64_C( 3383306831005980646), UINT64_C(16068655174781381635), UINT64_C( 2422586465983090473),
+    UINT64_C( 7608887751095923315), UINT64_C(15909553281681930314), UINT64_C( 7564546287726008543),
+    UINT64_C( 7695625441713880303), UINT64_C( 4992009352715341068), UINT64_C(11127449704834096546),
+    UINT64_C( 1125895567644451247), UINT64_C( 9882254119331121808), UINT64_C( 6376687090250037436),
+    UINT64_C(15663653418748171429), UINT64_C(14580207542242868544), UINT64_C(17927500405131241415),
+    UINT64_C( 2968052632020458530), UINT64_C(14475978693910290715), UINT64_C(17141374865717568015),
+    UINT64_C( 6880940400652645103), UINT64_C( 2351158912492758640), UINT64_C(18125485719892080834),
+    UINT64_C(17651715579875475188), UINT64_C( 7497623306829789752), UINT64_C(13423798482208682136),
+    UINT64_C(10423553812079159100), UINT64_C(16897109820406363522), UINT64_C(  210285304309890007),
+    UINT64_C(11809769321448950687), UINT64_C( 7824270775419642331), UINT64_C( 2785029092184537364),
+    UINT64_C( 8075225075991395041), UINT64_C( 8698066976645706868), UINT64_C(11495948545794501423),
+    UINT64_C( 5753741326309074113), UINT64_C( 1054599972088879367), UINT64_C( 3623232563747686574),
+    UINT64_C( 7129813452174358595), UINT64_C(13865051143260747723), UINT64_C(12526611629007139005),
+    UINT64_C( 4242455547773805283), UINT64_C(11839270788653130360), UINT64_C(13914798947705936754),
+    UINT64_C(13477582398378317982), UINT64_C(10174069959054132969), UINT64_C(15807062113259643637),
+    UINT64_C(11373302577968517803), UINT64_C(11902978697939475327), UINT64_C(   83556942304842756),
+    UINT64_C( 8478714126436493800), UINT64_C( 2265789215313464191), UINT64_C(  855030032260468944),
+    UINT64_C(                   4), UINT64_C( 4547880687740263771), UINT64_C( 1039716469844495838),
+    UINT64_C( 1928956454454569442), UINT64_C(17985574077943619039), UINT64_C( 3854288928910503379),
+    UINT64_C(13813277271426198918), UINT64_C(13207444009819676043), UINT64_C(10072575054279351582),
+    UINT64_C(13340304791131513844), UINT64_C( 1899672600403880563), UINT64_C( 4284265699450941463),
+    UINT64_C(18393716860268627612), UINT64_C(17402878431838888132), UINT64_C(  217604979600002846),
+    UINT64_C(13779382423541747293), UINT64_C( 2556217086465930670), UINT64_C( 9896970115115638964),
+    UINT64_C(14239865381507695230), UINT64_C(15661483089381755074), UINT64_C(14421333568924831368),
+    UINT64_C( 5918076020388233800), UINT64_C( 6553427822111312839), UINT64_C(  859762402096855387),
+    UINT64_C(13056691932841204314), UINT64_C(13236553707129206713), UINT64_C(11050101055794308357),
+    UINT64_C( 4520283664677313600), UINT64_C(10198015992023002346), UINT64_C( 7733827611184605777),
+    UINT64_C(17946082648595002870), UINT64_C(10016136769081594326), UINT64_C( 4629002473775046183),
+    UINT64_C(12610037564746975297), UINT64_C( 3381485790391523437), UINT64_C(  370677620076325786),
+    UINT64_C(10148416980996031784), UINT64_C(  353252005094041681), UINT64_C( 3582080959976423101),
+    UINT64_C( 3993369140882119538), UINT64_C(17888783763160829334), UINT64_C( 6281223551758061430),
+    UINT64_C( 1009443066374922318), UINT64_C(13729473031987636845), UINT64_C(10563920708505556242),
+    UINT64_C(17380928211395458097), UINT64_C( 2355673058580863926), UINT64_C(15694638432556649580),
+    UINT64_C(14782867813192276210), UINT64_C(10078971508280960161), UINT64_C(  278923075289447638),
+    UINT64_C( 5299471835931613890), UINT64_C( 8773728067210865869), UINT64_C( 5061857039942916633),
+    UINT64_C(18098867141342057868), UINT64_C(18257782150669978260), UINT64_C( 7816990934550415852),
+    UINT64_C(11028653500580297680), UINT64_C( 7955286013093199779), UINT64_C( 1026884625342328348),
+    UINT64_C(  878784601972636140), UINT64_C(13009165287161276214), UINT64_C(17392193100080171480),
+    UINT64_C( 4702687021406704035), UINT64_C( 7741903020769731621), UINT64_C( 2493841693406069541),
+    UINT64_C(11076281624236097625), UINT64_C(17535059776246791954), UINT64_C(13245901350281928823),
+    UINT64_C(11693574076157489056), UINT64_C( 3561184352679281267), UINT64_C(14107788114641463545),
+    UINT64_C(  674553921631754431), UINT64_C(15622165194510504054), UINT64_C( 3718233446527876874),
+    UINT64_C( 9254394508150210297), UINT64_C( 6646098588059882388), UINT64_C( 2298284717449220398),
+    UINT64_C( 8770619634963257798), UINT64_C( 9258943992751551515), UINT64_C(17507507827583639480),
+    UINT64_C(13110311509854598000), UINT64_C(16657028460848171997), UINT64_C(12953580755589816879),
+    UINT64_C(14970048539715003181), UINT64_C(16486425158944833872), UINT64_C( 9213375237098742353),
+    UINT64_C( 1829335334312640535), UINT64_C(13571664401908093354), UINT64_C(17122711788576751156),
+    UINT64_C( 4964282137998265313), UINT64_C(13578475625273430811), UINT64_C(17592606737994843699),
+    UINT64_C(12982852620806012262), UINT64_C( 9589890338788845172), UINT64_C( 4496772196221418729),
+    UINT64_C(14676697007180690308), UINT64_C( 7507482102304152648), UINT64_C(18249470138605158188),
+    UINT64_C(18087136324671453827), UINT64_C(16903661042075694818), UINT64_C(14325880213489720510),
+    UINT64_C( 8059539975980288936), UINT64_C( 6056353081045770571), UINT64_C(14269139486882120945),
+    UINT64_C(12999698226157260636), UINT64_C( 5758479470575439236), UINT64_C( 8966546045673182267),
+    UINT64_C(15705143370304273599), UINT64_C(  889453192485213744), UINT64_C(17349399141560593947),
+    UINT64_C(16913524937975096222), UINT64_C( 4746308599252906500), UINT64_C( 6132215301614150198),
+    UINT64_C( 1558218527397615355), UINT64_C( 4661811595402454459), UINT64_C( 7240089791002895170),
+    UINT64_C( 3948402025404184567), UINT64_C( 9548628996769139362), UINT64_C(17708634885206436914),
+    UINT64_C( 4960798899168637972), UINT64_C(11655767377819931211), UINT64_C( 2014432317787483692),
+    UINT64_C(17116445333820607581), UINT64_C(13951237519208364868), UINT64_C(17780867633092703443),
+    UINT64_C(14743879882598105032), UINT64_C(13903995503065179753), UINT64_C( 3047429678507845205),
+    UINT64_C( 3319946136906286593), UINT64_C( 6686842495619853931), UINT64_C(13544092948821522167),
+    UINT64_C(14636235241295332078), UINT64_C(17338366453142857217), UINT64_C( 9198219439208489655),
+    UINT64_C(10363835657557097352), UINT64_C( 8477986509219018200), UINT64_C( 8597472389225292472),
+    UINT64_C( 9560294163878869195), UINT64_C( 2679438720549255756), UINT64_C(13970971350850471620),
+    UINT64_C( 1381038243418673058), UINT64_C(14955145216164620896), UINT64_C(12577755668822782847),
+    UINT64_C(12817638039923718863), UINT64_C(14937328464596768765), UINT64_C( 4074689581205956847),
+    UINT64_C(  513889294827836650), UINT64_C( 4483257934773921047), UINT64_C(16513518140856179612),
+    UINT64_C(12328473712760166841), UINT64_C( 7757900870424195579), UINT64_C(15364725421824121569),
+    UINT64_C( 6788705797556101309), UINT64_C( 2002134990701802723), UINT64_C(  748997724185713494),
+    UINT64_C( 9327952234180033476), UINT64_C(16429293590378834901), UINT64_C(14607950213243232024),
+    UINT64_C( 6212158159258914848), UINT64_C(10259949820381535209), UINT64_C(16504779532578367405),
+    UINT64_C(17845419079729368774), UINT64_C( 4373330977202757842), UINT64_C( 2927061728751804894),
+    UINT64_C( 4568138570880106526), UINT64_C( 1903827625555410111), UINT64_C(14656988342104841843),
+    UINT64_C( 5997402673501242327), UINT64_C(10152340650271953491), UINT64_C( 6831714146248160555),
+    UINT64_C(16690314091022774344), UINT64_C( 7573519760028039506), UINT64_C( 4919137883970917332),
+    UINT64_C(17574135416880623349), UINT64_C( 5987707158855717464), UINT64_C( 2840065831420830065),
+    UINT64_C( 5027054841374937523), UINT64_C( 3891697026348309466), UINT64_C(12074674486747286001),
+    UINT64_C(11529531604922623763), UINT64_C(17290343289038156643), UINT64_C( 3665793502487115550),
+    UINT64_C(13916183843002689213), UINT64_C( 8447690658178800776), UINT64_C(16528390205925878597),
+    UINT64_C(14837981313111265704), UINT64_C(13125354981585282870), UINT64_C(12494597023148119429),
+    UINT64_C( 2831928641786579649), UINT64_C(12113333719230673234), UINT64_C( 8970475857937776110),
+    UINT64_C(17511728213235757668), UINT64_C( 5785862900360322102), UINT64_C( 6101855951929913082),
+    UINT64_C(  869842286619881680), UINT64_C( 1142756329542511018), UINT64_C(13521910474613537427),
+    UINT64_C(11915755389573015561), UINT64_C(14553632179182416123), UINT64_C(12517261530655964455),
+    UINT64_C(10948292932410780919), UINT64_C( 3304135847208704047), UINT64_C(11247410752685214364),
+    UINT64_C( 6920282754030912155), UINT64_C(16185072259335106308), UINT64_C( 9643612087147104938),
+    UINT64_C( 9141096650429560600), UINT64_C(11043114058563346863), UINT64_C(15722838442372978834),
+    UINT64_C(15966784734568204765), UINT64_C(17614024791834726992), UINT64_C(18135093711688925393),
+    UINT64_C( 4416274452433089264), UINT64_C(15378587840911276424), UINT64_C(  724880349834858396),
+    UINT64_C( 2223313312939649808), UINT64_C( 2306199521402143425), UINT64_C(  270056232827995987),
+    UINT64_C(12411805745792835112), UINT64_C( 5407634799754856963), UINT64_C(10390575226134773847),
+    UINT64_C(12534073847653326777), UINT64_C(13584002175018218490), UINT64_C(11644996259059072847),
+    UINT64_C(17440389883048912140), UINT64_C( 3524040542852918050), UINT64_C(12998537258594804286),
+    UINT64_C(10941590877337723575), UINT64_C( 1792808505000703017), UINT64_C( 8291631325589996226),
+    UINT64_C(11876769968471070571), UINT64_C(15053967799335727255), UINT64_C( 4321205898316082936),
+    UINT64_C( 5446873101379656178), UINT64_C( 2154066976786047526), UINT64_C( 5537995199983591519),
+    UINT64_C( 2064530200551589616), UINT64_C(15273765924197866240), UINT64_C( 3868671522917405233),
+    UINT64_C( 9146486252817883622), UINT64_C( 6103484843156070770), UINT64_C( 2034672919955913358),
+    UINT64_C( 8467205336961208224), UINT64_C(17386809708519284030), UINT64_C(11743162489374232966),
+    UINT64_C(16891733089525687680), UINT64_C( 7408739272967991717), UINT64_C( 7686711190306185003),
+    UINT64_C(15941553711696781578), UINT64_C(14476201976842271108), UINT64_C(10443311213432244277),
+    UINT64_C( 2407205799512677458), UINT64_C( 9425807156755336626), UINT64_C( 7959574599309636268),
+    UINT64_C(12778825729517868489), UINT64_C( 6389794980909314552), UINT64_C(  541553447589458101),
+    UINT64_C(10136350218365110649), UINT64_C( 3237088008108852516), UINT64_C(17657970624426188099),
+    UINT64_C( 4344750744838805719), UINT64_C(17510577332776517823), UINT64_C( 8917373897944967439),
+    UINT64_C(10966636189184293973), UINT64_C( 1682867547537851612), UINT64_C( 3790615019519385564),
+    UINT64_C( 1320111517166084532), UINT64_C(15163734996133908791), UINT64_C(17466674105715627380),
+    UINT64_C( 1615649827745937260), UINT64_C(13175059651984523749), UINT64_C(10928151867741318085),
+    UINT64_C( 3149577115618324588), UINT64_C(10955295270444562922), UINT64_C(16003301951849049756),
+    UINT64_C( 1077227322257662846), UINT64_C(16403517851485019603), UINT64_C(14665204329918856608),
+    UINT64_C( 4863817793185387190), UINT64_C( 9958674537902485385), UINT64_C(13469380637578650366),
+    UINT64_C( 5366069009874062879), UINT64_C(14533691991390120405), UINT64_C(16061719114812804757),
+    UINT64_C(12531520455080413269), UINT64_C( 7109421145676748583), UINT64_C(12583856111795327109),
+    UINT64_C( 8884524785671288102), UINT64_C( 3563980422135243417), UINT64_C(14680840327684442728),
+    UINT64_C( 8958234943343708946), UINT64_C( 6663304871248354980), UINT64_C(  917926960122106739),
+    UINT64_C(17627158639497170344), UINT64_C( 2253726962236501752), UINT64_C(11004932962127832900),
+    UINT64_C( 2112735081211716368), UINT64_C(14052401935071276086), UINT64_C( 5999024268228954223),
+    UINT64_C( 7573921858584884152), UINT64_C(14598126404184041164), UINT64_C( 9168244342121592084),
+    UINT64_C( 1491409352092303189), UINT64_C( 2488413857031047351), UINT64_C(14692997953755792191),
+    UINT64_C( 1364477218702832529), UINT64_C( 5327088812788250401), UINT64_C(11900882899511978789),
+    UINT64_C( 2610132865780236637), UINT64_C(10776712425208693057), UINT64_C( 5236194129340545185),
+    UINT64_C( 2901650642912409121), UINT64_C(15050838222962900575), UINT64_C( 4056424832275188522),
+    UINT64_C( 4600263213570413855), UINT64_C(17350133519936389927), UINT64_C(10991376466517020938),
+    UINT64_C( 4296283716433729246), UINT64_C(18321271357793852583), UINT64_C(13401885216926016661),
+    UINT64_C(14317238999849935776), UINT64_C( 2306237600723203349), UINT64_C(12008537846979604026),
+    UINT64_C(14025730332113821184), UINT64_C( 1063399587153390230), UINT64_C(12102608726363868270),
+    UINT64_C(11988553027204147669), UINT64_C(15674820729988758831), UINT64_C(11067180191450060984),
+    UINT64_C(10209214691454865441), UINT64_C(11740580097405003773), UINT64_C(12006488488061374836),
+    UINT64_C(10493259747100266497), UINT64_C(15179628619501137484), UINT64_C(14079087943041030609),
+    UINT64_C( 3761675888426073602), UINT64_C( 5914539244212731695), UINT64_C( 1286929903899792666),
+    UINT64_C(14962683079172319713), UINT64_C(10194505686615842373), UINT64_C(17899659144816717459),
+    UINT64_C(  915702679663092652), UINT64_C( 6443200458896623809), UINT64_C( 1438031055912756488),
+    UINT64_C(11512913030513882957), UINT64_C(16975903079055268135), UINT64_C(11575103416115708965),
+    UINT64_C( 3093681311386685971), UINT64_C(12477663841456122970), UINT64_C(11970666598174840493),
+    UINT64_C(16118389901210919130), UINT64_C(14918918025040673339), UINT64_C( 7739304840685703036),
+    UINT64_C(17285378418403962355), UINT64_C(  130669980232277858), UINT64_C(17420765589996383288),
+    UINT64_C(17823594418657926048), UINT64_C( 9067394042329986124), UINT64_C( 1263241722204132674),
+    UINT64_C( 4937768902624589955), UINT64_C( 9185229491285148127), UINT64_C(  732566982743647182),
+    UINT64_C( 8306498383506507719), UINT64_C(16315169117853152407), UINT64_C( 4495120019807181205),
+    UINT64_C( 4297415309647977967), UINT64_C(17480705079960335385), UINT64_C(17922219283797788657),
+    UINT64_C(12715736856407906985), UINT64_C( 6653308439627100091), UINT64_C( 6583805822730795444),
+    UINT64_C( 5584961233199406945), UINT64_C(14529844730871773958), UINT64_C(15257552177047641205),
+    UINT64_C(12102788161924272379), UINT64_C( 3123513322351159609), UINT64_C( 4967775568495622862),
+    UINT64_C( 7101633344151534021), UINT64_C( 1122186895142029005), UINT64_C(14747439402388767897),
+    UINT64_C(15386510400301185523), UINT64_C( 1382997646333486779), UINT64_C( 4328784817532517809),
+    UINT64_C(10842885368307613476), UINT64_C(10073687856281732059), UINT64_C( 2907294805968276505),
+    UINT64_C(10725463741830049887), UINT64_C( 3948380481182684082), UINT64_C(17708970715257476720),
+    UINT64_C(14639033977223486504), UINT64_C( 4077341919811767384), UINT64_C( 8576311056089553381),
+    UINT64_C(10306031299823563490), UINT64_C(14231159680052420591), UINT64_C(13498120523368437627),
+    UINT64_C(  961912087726926834), UINT64_C(13485968766704846239), UINT64_C(12236655377320257229),
+    UINT64_C(16017394398766337725), UINT64_C(13800866446065292065), UINT64_C(12129794759514250367),
+    UINT64_C( 6558015698485658766), UINT64_C( 4297355318857884747), UINT64_C( 8069905057528153739),
+    UINT64_C(16272084940087294461), UINT64_C( 7481774245989516754), UINT64_C(16895146961172371408),
+    UINT64_C( 5476585914141769315), UINT64_C(11322036806756873817), UINT64_C( 3383306831005980646),
+    UINT64_C( 3630145171356612700), UINT64_C(16068655174781381635), UINT64_C( 8629304453005980844),
+    UINT64_C( 2422586465983090473), UINT64_C(12460664758243516339), UINT64_C( 7608887751095923315),
+    UINT64_C( 7476882340635049218), UINT64_C(15909553281681930314), UINT64_C( 1486318283782272860),
+    UINT64_C( 7564546287726008543), UINT64_C( 3772850819418252653), UINT64_C( 7695625441713880303),
+    UINT64_C( 7168386879513481623), UINT64_C( 4992009352715341068), UINT64_C( 5866654710691962241),
+    UINT64_C(11127449704834096546), UINT64_C( 2248687560823562468), UINT64_C( 1125895567644451247),
+    UINT64_C( 5850690637205668979), UINT64_C( 9882254119331121808), UINT64_C(11934009742965345822),
+    UINT64_C( 6376687090250037436), UINT64_C( 7499871809575885047), UINT64_C(15663653418748171429),
+    UINT64_C( 9638658681148450558), UINT64_C(14580207542242868544), UINT64_C(10646359689980186944),
+    UINT64_C(17927500405131241415), UINT64_C( 9597304288225842216), UINT64_C( 2968052632020458530),
+    UINT64_C(12294368113941525151), UINT64_C(14475978693910290715), UINT64_C(   24461815526594499),
+    UINT64_C(17141374865717568015), UINT64_C(18369228171912251969), UINT64_C( 6880940400652645103),
+    UINT64_C( 9155831467447095028), UINT64_C( 2351158912492758640), UINT64_C( 5696333918988051541),
+    UINT64_C(18125485719892080834), UINT64_C( 2570304378268969255), UINT64_C(17651715579875475188),
+    UINT64_C(14193231566300285038), UINT64_C( 7497623306829789752), UINT64_C(11109857051654936561),
+    UINT64_C(13423798482208682136), UINT64_C( 2622197606181717120), UINT64_C(10423553812079159100),
+    UINT64_C(16185127583204426908), UINT64_C(16897109820406363522), UINT64_C( 3978823116030130811),
+    UINT64_C(  210285304309890007), UINT64_C(15154515988653935054), UINT64_C(11809769321448950687),
+    UINT64_C(14520248207122253095), UINT64_C( 7824270775419642331), UINT64_C(13882808618241474806),
+    UINT64_C( 2785029092184537364), UINT64_C( 8979275251680223605), UINT64_C( 8075225075991395041),
+    UINT64_C(16559144773553075151), UINT64_C( 8698066976645706868), UINT64_C( 6381930374430612454),
+    UINT64_C(11495948545794501423), UINT64_C( 3344219441214789307), UINT64_C( 5753741326309074113),
+    UINT64_C(12661459239641071752), UINT64_C( 1054599972088879367), UINT64_C(14839304683252264626),
+    UINT64_C( 3623232563747686574), UINT64_C(14775566515510681151), UINT64_C( 7129813452174358595),
+    UINT64_C( 6045239971260455049), UINT64_C(13865051143260747723), UINT64_C( 4736265982095914195),
+    UINT64_C(12526611629007139005), UINT64_C(   78410135279756251), UINT64_C( 4242455547773805283),
+    UINT64_C(15338587515169939093), UINT64_C(11839270788653130360), UINT64_C( 9771630181710250272),
+    UINT64_C(13914798947705936754), UINT64_C( 4501511362768488368), UINT64_C(13477582398378317982),
+    UINT64_C(14507341174632683448), UINT64_C(10174069959054132969), UINT64_C( 7541446626421407554),
+    UINT64_C(15807062113259643637), UINT64_C( 7699526599916018886), UINT64_C(11373302577968517803),
+    UINT64_C( 2582330564346310974), UINT64_C(11902978697939475327), UINT64_C( 3976647518258977272),
+    UINT64_C(   83556942304842756), UINT64_C(  531727775681859461), UINT64_C( 8478714126436493800),
+    UINT64_C(12069881424144017810), UINT64_C( 2265789215313464191), UINT64_C( 1804630786900400387),
+    UINT64_C(  855030032260468944), UINT64_C( 8843897117230103692),
+};
+
+const uint64_t ntt64_1024_inv_omega_powers_rev[2048] = {
+    UINT64_C(                   0), UINT64_C(                   1), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(                   1), UINT64_C( 1597448745227320835),
+    UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128),
+    UINT64_C( 1935475755192423451), UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032),
+    UINT64_C(  587789728123186789), UINT64_C(                   1), UINT64_C( 1597448745227320835),
+    UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128), UINT64_C( 1935475755192423451),
+    UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032), UINT64_C(  587789728123186789),
+    UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176), UINT64_C( 2564987455095371273),
+    UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654), UINT64_C( 3729729506260150116),
+    UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128),
+    UINT64_C( 1935475755192423451), UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032),
+    UINT64_C(  587789728123186789), UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176),
+    UINT64_C( 2564987455095371273), UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654),
+    UINT64_C( 3729729506260150116), UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219),
+    UINT64_C(  639054271616479546), UINT64_C( 2732037966935316176), UINT64_C( 3204409509980914063),
+    UINT64_C( 3450216611516306163), UINT64_C( 4376876956895888490), UINT64_C(  940418972106513807),
+    UINT64_C( 2760778514640823230), UINT64_C( 2952442330362223250), UINT64_C( 3695716953298051000),
+    UINT64_C(  622103464257758799), UINT64_C(  710016457855204048), UINT64_C( 1594171772562501572),
+    UINT64_C( 1186577149813220829), UINT64_C( 4480554820949425278), UINT64_C( 2286621563204459736),
+    UINT64_C( 2543517489763520818), UINT64_C(                   1), UINT64_C( 1597448745227320835),
+    UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128), UINT64_C( 1935475755192423451),
+    UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032), UINT64_C(  587789728123186789),
+    UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176), UINT64_C( 2564987455095371273),
+    UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654), UINT64_C( 3729729506260150116),
+    UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219), UINT64_C(  639054271616479546),
+    UINT64_C( 2732037966935316176), UINT64_C( 3204409509980914063), UINT64_C( 3450216611516306163),
+    UINT64_C( 4376876956895888490), UINT64_C(  940418972106513807), UINT64_C( 2760778514640823230),
+    UINT64_C( 2952442330362223250), UINT64_C( 3695716953298051000), UINT64_C(  622103464257758799),
+    UINT64_C(  710016457855204048), UINT64_C( 1594171772562501572), UINT64_C( 1186577149813220829),
+    UINT64_C( 4480554820949425278), UINT64_C( 2286621563204459736), UINT64_C( 2543517489763520818),
+    UINT64_C( 2518143763569825595), UINT64_C( 2741659047296060101), UINT64_C( 2119496627304744197),
+    UINT64_C( 2144077764022377872), UINT64_C(  168638480407937784), UINT64_C( 3918705182497170566),
+    UINT64_C( 3129315382663975828), UINT64_C( 3355949620552154141), UINT64_C( 4472195940790185488),
+    UINT64_C( 2751233240531944786), UINT64_C( 1499350668375303258), UINT64_C( 1248002338178829171),
+    UINT64_C( 3567284871720512811), UINT64_C( 1234442225656141459), UINT64_C( 3763491949833913430),
+    UINT64_C( 1060613886943446140), UINT64_C( 3264172983210285134), UINT64_C( 2489668634475609185),
+    UINT64_C( 3841181355456011629), UINT64_C( 1369146478535435641), UINT64_C( 3392916100477006765),
+    UINT64_C(  359507763978187366), UINT64_C(  555828328234909737), UINT64_C( 2174516744161416095),
+    UINT64_C( 1954247733637594417), UINT64_C(  725412660728098737), UINT64_C( 2111922664544689878),
+    UINT64_C(  742013158005111008), UINT64_C( 1240199724792153435), UINT64_C(  780878330587786088),
+    UINT64_C( 1921677797576536864), UINT64_C(   20889235576210587), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128),
+    UINT64_C( 1935475755192423451), UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032),
+    UINT64_C(  587789728123186789), UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176),
+    UINT64_C( 2564987455095371273), UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654),
+    UINT64_C( 3729729506260150116), UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219),
+    UINT64_C(  639054271616479546), UINT64_C( 2732037966935316176), UINT64_C( 3204409509980914063),
+    UINT64_C( 3450216611516306163), UINT64_C( 4376876956895888490), UINT64_C(  940418972106513807),
+    UINT64_C( 2760778514640823230), UINT64_C( 2952442330362223250), UINT64_C( 3695716953298051000),
+    UINT64_C(  622103464257758799), UINT64_C(  710016457855204048), UINT64_C( 1594171772562501572),
+    UINT64_C( 1186577149813220829), UINT64_C( 4480554820949425278), UINT64_C( 2286621563204459736),
+    UINT64_C( 2543517489763520818), UINT64_C( 2518143763569825595), UINT64_C( 2741659047296060101),
+    UINT64_C( 2119496627304744197), UINT64_C( 2144077764022377872), UINT64_C(  168638480407937784),
+    UINT64_C( 3918705182497170566), UINT64_C( 3129315382663975828), UINT64_C( 3355949620552154141),
+    UINT64_C( 4472195940790185488), UINT64_C( 2751233240531944786), UINT64_C( 1499350668375303258),
+    UINT64_C( 1248002338178829171), UINT64_C( 3567284871720512811), UINT64_C( 1234442225656141459),
+    UINT64_C( 3763491949833913430), UINT64_C( 1060613886943446140), UINT64_C( 3264172983210285134),
+    UINT64_C( 2489668634475609185), UINT64_C( 3841181355456011629), UINT64_C( 1369146478535435641),
+    UINT64_C( 3392916100477006765), UINT64_C(  359507763978187366), UINT64_C(  555828328234909737),
+    UINT64_C( 2174516744161416095), UINT64_C( 1954247733637594417), UINT64_C(  725412660728098737),
+    UINT64_C( 2111922664544689878), UINT64_C(  742013158005111008), UINT64_C( 1240199724792153435),
+    UINT64_C(  780878330587786088), UINT64_C( 1921677797576536864), UINT64_C(   20889235576210587),
+    UINT64_C( 4496393519485882796), UINT64_C( 4414492656106525461), UINT64_C( 3659058810323815146),
+    UINT64_C(  987095120295666199), UINT64_C( 3311475337570466030), UINT64_C( 3506432583028438168),
+    UINT64_C(  285689082385626359), UINT64_C( 4412928894968847241), UINT64_C( 2537104245248995553),
+    UINT64_C( 1665826217812080608), UINT64_C(  731765432187947649), UINT64_C( 1891136571931492898),
+    UINT64_C( 4225915260518903062), UINT64_C( 4355191397499074548), UINT64_C( 2735397719334417532),
+    UINT64_C( 3466262785815169999), UINT64_C( 3605333392231190231), UINT64_C(  269306830564414396),
+    UINT64_C( 1120814483693474787), UINT64_C( 2017476264382028580), UINT64_C( 3742512134928732514),
+    UINT64_C( 2548626421653948144), UINT64_C( 4533773427922209202), UINT64_C(  696257273046130940),
+    UINT64_C( 2193432016802705753), UINT64_C( 2975220724877980164), UINT64_C( 2882382901230641861),
+    UINT64_C( 3645051885560699331), UINT64_C( 1810022447750714951), UINT64_C( 1396240308299844916),
+    UINT64_C( 4346702427129799775), UINT64_C( 2843325644492115562), UINT64_C( 4598429215067134441),
+    UINT64_C( 3790933749033458680), UINT64_C( 3492742837712600844), UINT64_C(  240478021931730534),
+    UINT64_C( 1661524647014962481), UINT64_C( 3001622122015329047), UINT64_C( 1730070688507719588),
+    UINT64_C( 4224277455101570246), UINT64_C( 2640980177126376160), UINT64_C( 1893480464646211789),
+    UINT64_C( 1893379940007000628), UINT64_C(  281473891911111437), UINT64_C( 3926285842576049221),
+    UINT64_C( 4078792279463268178), UINT64_C( 1384498799995891117), UINT64_C( 3478699736926467196),
+    UINT64_C( 2549503998005738133), UINT64_C( 4015429778703181575), UINT64_C( 2331988058544996978),
+    UINT64_C( 4017163793695325786), UINT64_C( 4398151684498689441), UINT64_C(  773420327846667715),
+    UINT64_C( 1351908699938707637), UINT64_C( 1438435331577261502), UINT64_C(  219696150493157962),
+    UINT64_C( 4337533379984076294), UINT64_C( 3123649255787014599), UINT64_C( 4285343716429371071),
+    UINT64_C( 3487809379802074180), UINT64_C( 3686859850597173965), UINT64_C(  601801449878166425),
+    UINT64_C(  566447303828363281), UINT64_C(                   1), UINT64_C( 1597448745227320835),
+    UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128), UINT64_C( 1935475755192423451),
+    UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032), UINT64_C(  587789728123186789),
+    UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176), UINT64_C( 2564987455095371273),
+    UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654), UINT64_C( 3729729506260150116),
+    UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219), UINT64_C(  639054271616479546),
+    UINT64_C( 2732037966935316176), UINT64_C( 3204409509980914063), UINT64_C( 3450216611516306163),
+    UINT64_C( 4376876956895888490), UINT64_C(  940418972106513807), UINT64_C( 2760778514640823230),
+    UINT64_C( 2952442330362223250), UINT64_C( 3695716953298051000), UINT64_C(  622103464257758799),
+    UINT64_C(  710016457855204048), UINT64_C( 1594171772562501572), UINT64_C( 1186577149813220829),
+    UINT64_C( 4480554820949425278), UINT64_C( 2286621563204459736), UINT64_C( 2543517489763520818),
+    UINT64_C( 2518143763569825595), UINT64_C( 2741659047296060101), UINT64_C( 2119496627304744197),
+    UINT64_C( 2144077764022377872), UINT64_C(  168638480407937784), UINT64_C( 3918705182497170566),
+    UINT64_C( 3129315382663975828), UINT64_C( 3355949620552154141), UINT64_C( 4472195940790185488),
+    UINT64_C( 2751233240531944786), UINT64_C( 1499350668375303258), UINT64_C( 1248002338178829171),
+    UINT64_C( 3567284871720512811), UINT64_C( 1234442225656141459), UINT64_C( 3763491949833913430),
+    UINT64_C( 1060613886943446140), UINT64_C( 3264172983210285134), UINT64_C( 2489668634475609185),
+    UINT64_C( 3841181355456011629), UINT64_C( 1369146478535435641), UINT64_C( 3392916100477006765),
+    UINT64_C(  359507763978187366), UINT64_C(  555828328234909737), UINT64_C( 2174516744161416095),
+    UINT64_C( 1954247733637594417), UINT64_C(  725412660728098737), UINT64_C( 2111922664544689878),
+    UINT64_C(  742013158005111008), UINT64_C( 1240199724792153435), UINT64_C(  780878330587786088),
+    UINT64_C( 1921677797576536864), UINT64_C(   20889235576210587), UINT64_C( 4496393519485882796),
+    UINT64_C( 4414492656106525461), UINT64_C( 3659058810323815146), UINT64_C(  987095120295666199),
+    UINT64_C( 3311475337570466030), UINT64_C( 3506432583028438168), UINT64_C(  285689082385626359),
+    UINT64_C( 4412928894968847241), UINT64_C( 2537104245248995553), UINT64_C( 1665826217812080608),
+    UINT64_C(  731765432187947649), UINT64_C( 1891136571931492898), UINT64_C( 4225915260518903062),
+    UINT64_C( 4355191397499074548), UINT64_C( 2735397719334417532), UINT64_C( 3466262785815169999),
+    UINT64_C( 3605333392231190231), UINT64_C(  269306830564414396), UINT64_C( 1120814483693474787),
+    UINT64_C( 2017476264382028580), UINT64_C( 3742512134928732514), UINT64_C( 2548626421653948144),
+    UINT64_C( 4533773427922209202), UINT64_C(  696257273046130940), UINT64_C( 2193432016802705753),
+    UINT64_C( 2975220724877980164), UINT64_C( 2882382901230641861), UINT64_C( 3645051885560699331),
+    UINT64_C( 1810022447750714951), UINT64_C( 1396240308299844916), UINT64_C( 4346702427129799775),
+    UINT64_C( 2843325644492115562), UINT64_C( 4598429215067134441), UINT64_C( 3790933749033458680),
+    UINT64_C( 3492742837712600844), UINT64_C(  240478021931730534), UINT64_C( 1661524647014962481),
+    UINT64_C( 3001622122015329047), UINT64_C( 1730070688507719588), UINT64_C( 4224277455101570246),
+    UINT64_C( 2640980177126376160), UINT64_C( 1893480464646211789), UINT64_C( 1893379940007000628),
+    UINT64_C(  281473891911111437), UINT64_C( 3926285842576049221), UINT64_C( 4078792279463268178),
+    UINT64_C( 1384498799995891117), UINT64_C( 3478699736926467196), UINT64_C( 2549503998005738133),
+    UINT64_C( 4015429778703181575), UINT64_C( 2331988058544996978), UINT64_C( 4017163793695325786),
+    UINT64_C( 4398151684498689441), UINT64_C(  773420327846667715), UINT64_C( 1351908699938707637),
+    UINT64_C( 1438435331577261502), UINT64_C(  219696150493157962), UINT64_C( 4337533379984076294),
+    UINT64_C( 3123649255787014599), UINT64_C( 4285343716429371071), UINT64_C( 3487809379802074180),
+    UINT64_C( 3686859850597173965), UINT64_C(  601801449878166425), UINT64_C(  566447303828363281),
+    UINT64_C(  259929117461122690), UINT64_C( 2534087554591265284), UINT64_C( 1671710623904955317),
+    UINT64_C(  726823701492065576), UINT64_C( 2769070406059010880), UINT64_C(  576559400180798021),
+    UINT64_C( 1525463987982470819), UINT64_C( 4531371429972998074), UINT64_C(  845371447597876730),
+    UINT64_C( 3670210081921092754), UINT64_C( 4461354769932320401), UINT64_C( 3977388320420463150),
+    UINT64_C( 4562367534651267261), UINT64_C( 4321344604600969480), UINT64_C(  881010135713225209),
+    UINT64_C( 1782453363043580942), UINT64_C( 3559966345376906418), UINT64_C( 2738823817611127352),
+    UINT64_C( 1018672395301484236), UINT64_C( 1639503924621406683), UINT64_C( 4164257115212022658),
+    UINT64_C(  321732475974946595), UINT64_C( 3991696183642031693), UINT64_C( 1956067693854901028),
+    UINT64_C(   69730768822361569), UINT64_C(  341119304675706466), UINT64_C(  972924256587072614),
+    UINT64_C( 3915913354687023729), UINT64_C(  389554631849401936), UINT64_C( 1663327109906766898),
+    UINT64_C(  508668229988975855), UINT64_C( 3951765528314891606), UINT64_C(  474918150100967821),
+    UINT64_C(  947653754879841762), UINT64_C( 2390073540969705624), UINT64_C( 3557789920013087769),
+    UINT64_C(  929558361631964678), UINT64_C( 2552303672863703893), UINT64_C(  826033961802171977),
+    UINT64_C( 2605888453019777046), UINT64_C(  252360766593729347), UINT64_C( 3513100483767801861),
+    UINT64_C( 1707928536562031796), UINT64_C( 2781862426208510548), UINT64_C( 1439619867643852777),
+    UINT64_C(  183141745685910901), UINT64_C( 1361718275344907393), UINT64_C( 2959817697163268132),
+    UINT64_C( 2762525263948563595), UINT64_C( 1341517252468509167), UINT64_C(  500533747675448236),
+    UINT64_C(  845826707751491030), UINT64_C( 1241070534499560266), UINT64_C( 4243975769763796303),
+    UINT64_C(   67514058206998667), UINT64_C( 2873987136448611317), UINT64_C( 1988821503273290230),
+    UINT64_C( 1014106208068792177), UINT64_C( 3709495328277798306), UINT64_C( 3618994673477555001),
+    UINT64_C(  503608079446868463), UINT64_C( 1775408336037874833), UINT64_C( 3619050494210550099),
+    UINT64_C( 2119678531609113096), UINT64_C( 3453319317856532861), UINT64_C( 4377644333194108072),
+    UINT64_C( 2299554859802111181), UINT64_C( 3659758494305853749), UINT64_C(  890296088169815968),
+    UINT64_C( 3025652181590952288), UINT64_C( 2978938847393239339), UINT64_C( 1874405826707438282),
+    UINT64_C(  895520239994101401), UINT64_C( 4406789659874271060), UINT64_C(  475956906388850203),
+    UINT64_C( 1923906360428460678), UINT64_C( 2014884993995062392), UINT64_C( 2266848510582485458),
+    UINT64_C( 2072907831397488931), UINT64_C( 3131652907251769454), UINT64_C( 1638356955527820207),
+    UINT64_C( 3666301082479696243), UINT64_C( 3082118428190026655), UINT64_C( 1870443561497370052),
+    UINT64_C( 2303343809274674337), UINT64_C(  228925669915772045), UINT64_C( 3844646960227800326),
+    UINT64_C( 2018806268997838899), UINT64_C( 4524716785335492365), UINT64_C( 2694178106302160104),
+    UINT64_C(  916448375621774411), UINT64_C( 4481875101282788461), UINT64_C( 2387157249192273180),
+    UINT64_C( 3814388044261891669), UINT64_C( 4222933272381401292), UINT64_C( 2975744674484854296),
+    UINT64_C(   54401244900000446), UINT64_C(  403912456936482342), UINT64_C( 3738786304041136961),
+    UINT64_C( 3059163844330049364), UINT64_C( 2192654908740803739), UINT64_C( 3794907154875265834),
+    UINT64_C( 2410903021786764458), UINT64_C(   52571326077472245), UINT64_C(  588918264645213105),
+    UINT64_C( 2292061085530386825), UINT64_C( 4393533854220134376), UINT64_C( 2470563529832768384),
+    UINT64_C( 4337349785390127300), UINT64_C( 1074353827411989244), UINT64_C( 3818441481049447908),
+    UINT64_C( 3369395599594563037), UINT64_C( 4486520662148728802), UINT64_C( 1777355286419178464),
+    UINT64_C( 3651987553310790167), UINT64_C(  605646616495769660), UINT64_C( 2397472584697199582),
+    UINT64_C( 2992666649543695505), UINT64_C( 3133518461913316388), UINT64_C(  263649993022218554),
+    UINT64_C( 4348048275020021631), UINT64_C( 1074070929108427065), UINT64_C( 3028333429807653516),
+    UINT64_C( 1720235100163152873), UINT64_C( 3685969970649508253), UINT64_C(  345749411583370006),
+    UINT64_C( 1989893649827399347), UINT64_C(  213757508065116192), UINT64_C(                   1),
+    UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580), UINT64_C( 2710721342076890128),
+    UINT64_C( 1935475755192423451), UINT64_C( 3350471304231487799), UINT64_C( 4377932053308918032),
+    UINT64_C(  587789728123186789), UINT64_C( 1157250618443755893), UINT64_C( 2221131196417811176),
+    UINT64_C( 2564987455095371273), UINT64_C( 1902221937773971537), UINT64_C( 3669174251795154654),
+    UINT64_C( 3729729506260150116), UINT64_C( 2911249064764753991), UINT64_C(  905808140936917219),
+    UINT64_C(  639054271616479546), UINT64_C( 2732037966935316176), UINT64_C( 3204409509980914063),
+    UINT64_C( 3450216611516306163), UINT64_C( 4376876956895888490), UINT64_C(  940418972106513807),
+    UINT64_C( 2760778514640823230), UINT64_C( 2952442330362223250), UINT64_C( 3695716953298051000),
+    UINT64_C(  622103464257758799), UINT64_C(  710016457855204048), UINT64_C( 1594171772562501572),
+    UINT64_C( 1186577149813220829), UINT64_C( 4480554820949425278), UINT64_C( 2286621563204459736),
+    UINT64_C( 2543517489763520818), UINT64_C( 2518143763569825595), UINT64_C( 2741659047296060101),
+    UINT64_C( 2119496627304744197), UINT64_C( 2144077764022377872), UINT64_C(  168638480407937784),
+    UINT64_C( 3918705182497170566), UINT64_C( 3129315382663975828), UINT64_C( 3355949620552154141),
+    UINT64_C( 4472195940790185488), UINT64_C( 2751233240531944786), UINT64_C( 1499350668375303258),
+    UINT64_C( 1248002338178829171), UINT64_C( 3567284871720512811), UINT64_C( 1234442225656141459),
+    UINT64_C( 3763491949833913430), UINT64_C( 1060613886943446140), UINT64_C( 3264172983210285134),
+    UINT64_C( 2489668634475609185), UINT64_C( 3841181355456011629), UINT64_C( 1369146478535435641),
+    UINT64_C( 3392916100477006765), UINT64_C(  359507763978187366), UINT64_C(  555828328234909737),
+    UINT64_C( 2174516744161416095), UINT64_C( 1954247733637594417), UINT64_C(  725412660728098737),
+    UINT64_C( 2111922664544689878), UINT64_C(  742013158005111008), UINT64_C( 1240199724792153435),
+    UINT64_C(  780878330587786088), UINT64_C( 1921677797576536864), UINT64_C(   20889235576210587),
+    UINT64_C( 4496393519485882796), UINT64_C( 4414492656106525461), UINT64_C( 3659058810323815146),
+    UINT64_C(  987095120295666199), UINT64_C( 3311475337570466030), UINT64_C( 3506432583028438168),
+    UINT64_C(  285689082385626359), UINT64_C( 4412928894968847241), UINT64_C( 2537104245248995553),
+    UINT64_C( 1665826217812080608), UINT64_C(  731765432187947649), UINT64_C( 1891136571931492898),
+    UINT64_C( 4225915260518903062), UINT64_C( 4355191397499074548), UINT64_C( 2735397719334417532),
+    UINT64_C( 3466262785815169999), UINT64_C( 3605333392231190231), UINT64_C(  269306830564414396),
+    UINT64_C( 1120814483693474787), UINT64_C( 2017476264382028580), UINT64_C( 3742512134928732514),
+    UINT64_C( 2548626421653948144), UINT64_C( 4533773427922209202), UINT64_C(  696257273046130940),
+    UINT64_C( 2193432016802705753), UINT64_C( 2975220724877980164), UINT64_C( 2882382901230641861),
+    UINT64_C( 3645051885560699331), UINT64_C( 1810022447750714951), UINT64_C( 1396240308299844916),
+    UINT64_C( 4346702427129799775), UINT64_C( 2843325644492115562), UINT64_C( 4598429215067134441),
+    UINT64_C( 3790933749033458680), UINT64_C( 3492742837712600844), UINT64_C(  240478021931730534),
+    UINT64_C( 1661524647014962481), UINT64_C( 3001622122015329047), UINT64_C( 1730070688507719588),
+    UINT64_C( 4224277455101570246), UINT64_C( 2640980177126376160), UINT64_C( 1893480464646211789),
+    UINT64_C( 1893379940007000628), UINT64_C(  281473891911111437), UINT64_C( 3926285842576049221),
+    UINT64_C( 4078792279463268178), UINT64_C( 1384498799995891117), UINT64_C( 3478699736926467196),
+    UINT64_C( 2549503998005738133), UINT64_C( 4015429778703181575), UINT64_C( 2331988058544996978),
+    UINT64_C( 4017163793695325786), UINT64_C( 4398151684498689441), UINT64_C(  773420327846667715),
+    UINT64_C( 1351908699938707637), UINT64_C( 1438435331577261502), UINT64_C(  219696150493157962),
+    UINT64_C( 4337533379984076294), UINT64_C( 3123649255787014599), UINT64_C( 4285343716429371071),
+    UINT64_C( 3487809379802074180), UINT64_C( 3686859850597173965), UINT64_C(  601801449878166425),
+    UINT64_C(  566447303828363281), UINT64_C(  259929117461122690), UINT64_C( 2534087554591265284),
+    UINT64_C( 1671710623904955317), UINT64_C(  726823701492065576), UINT64_C( 2769070406059010880),
+    UINT64_C(  576559400180798021), UINT64_C( 1525463987982470819), UINT64_C( 4531371429972998074),
+    UINT64_C(  845371447597876730), UINT64_C( 3670210081921092754), UINT64_C( 4461354769932320401),
+    UINT64_C( 3977388320420463150), UINT64_C( 4562367534651267261), UINT64_C( 4321344604600969480),
+    UINT64_C(  881010135713225209), UINT64_C( 1782453363043580942), UINT64_C( 3559966345376906418),
+    UINT64_C( 2738823817611127352), UINT64_C( 1018672395301484236), UINT64_C( 1639503924621406683),
+    UINT64_C( 4164257115212022658), UINT64_C(  321732475974946595), UINT64_C( 3991696183642031693),
+    UINT64_C( 1956067693854901028), UINT64_C(   69730768822361569), UINT64_C(  341119304675706466),
+    UINT64_C(  972924256587072614), UINT64_C( 3915913354687023729), UINT64_C(  389554631849401936),
+    UINT64_C( 1663327109906766898), UINT64_C(  508668229988975855), UINT64_C( 3951765528314891606),
+    UINT64_C(  474918150100967821), UINT64_C(  947653754879841762), UINT64_C( 2390073540969705624),
+    UINT64_C( 3557789920013087769), UINT64_C(  929558361631964678), UINT64_C( 2552303672863703893),
+    UINT64_C(  826033961802171977), UINT64_C( 2605888453019777046), UINT64_C(  252360766593729347),
+    UINT64_C( 3513100483767801861), UINT64_C( 1707928536562031796), UINT64_C( 2781862426208510548),
+    UINT64_C( 1439619867643852777), UINT64_C(  183141745685910901), UINT64_C( 1361718275344907393),
+    UINT64_C( 2959817697163268132), UINT64_C( 2762525263948563595), UINT64_C( 1341517252468509167),
+    UINT64_C(  500533747675448236), UINT64_C(  845826707751491030), UINT64_C( 1241070534499560266),
+    UINT64_C( 4243975769763796303), UINT64_C(   67514058206998667), UINT64_C( 2873987136448611317),
+    UINT64_C( 1988821503273290230), UINT64_C( 1014106208068792177), UINT64_C( 3709495328277798306),
+    UINT64_C( 3618994673477555001), UINT64_C(  503608079446868463), UINT64_C( 1775408336037874833),
+    UINT64_C( 3619050494210550099), UINT64_C( 2119678531609113096), UINT64_C( 3453319317856532861),
+    UINT64_C( 4377644333194108072), UINT64_C( 2299554859802111181), UINT64_C( 3659758494305853749),
+    UINT64_C(  890296088169815968), UINT64_C( 3025652181590952288), UINT64_C( 2978938847393239339),
+    UINT64_C( 1874405826707438282), UINT64_C(  895520239994101401), UINT64_C( 4406789659874271060),
+    UINT64_C(  475956906388850203), UINT64_C( 1923906360428460678), UINT64_C( 2014884993995062392),
+    UINT64_C( 2266848510582485458), UINT64_C( 2072907831397488931), UINT64_C( 3131652907251769454),
+    UINT64_C( 1638356955527820207), UINT64_C( 3666301082479696243), UINT64_C( 3082118428190026655),
+    UINT64_C( 1870443561497370052), UINT64_C( 2303343809274674337), UINT64_C(  228925669915772045),
+    UINT64_C( 3844646960227800326), UINT64_C( 2018806268997838899), UINT64_C( 4524716785335492365),
+    UINT64_C( 2694178106302160104), UINT64_C(  916448375621774411), UINT64_C( 4481875101282788461),
+    UINT64_C( 2387157249192273180), UINT64_C( 3814388044261891669), UINT64_C( 4222933272381401292),
+    UINT64_C( 2975744674484854296), UINT64_C(   54401244900000446), UINT64_C(  403912456936482342),
+    UINT64_C( 3738786304041136961), UINT64_C( 3059163844330049364), UINT64_C( 2192654908740803739),
+    UINT64_C( 3794907154875265834), UINT64_C( 2410903021786764458), UINT64_C(   52571326077472245),
+    UINT64_C(  588918264645213105), UINT64_C( 2292061085530386825), UINT64_C( 4393533854220134376),
+    UINT64_C( 2470563529832768384), UINT64_C( 4337349785390127300), UINT64_C( 1074353827411989244),
+    UINT64_C( 3818441481049447908), UINT64_C( 3369395599594563037), UINT64_C( 4486520662148728802),
+    UINT64_C( 1777355286419178464), UINT64_C( 3651987553310790167), UINT64_C(  605646616495769660),
+    UINT64_C( 2397472584697199582), UINT64_C( 2992666649543695505), UINT64_C( 3133518461913316388),
+    UINT64_C(  263649993022218554), UINT64_C( 4348048275020021631), UINT64_C( 1074070929108427065),
+    UINT64_C( 3028333429807653516), UINT64_C( 1720235100163152873), UINT64_C( 3685969970649508253),
+    UINT64_C(  345749411583370006), UINT64_C( 1989893649827399347), UINT64_C(  213757508065116192),
+    UINT64_C( 1136970171935060389), UINT64_C(  135388361897363864), UINT64_C(  829986534226567594),
+    UINT64_C( 2518421964070420713), UINT64_C(  623460423351514340), UINT64_C( 3579309749962466460),
+    UINT64_C( 1446465725090073460), UINT64_C( 1424083479747005929), UINT64_C( 3152509391186728425),
+    UINT64_C(  890995105533806502), UINT64_C( 4126194883144571696), UINT64_C( 1869220585158753174),
+    UINT64_C( 1876870525576028994), UINT64_C( 1934826210171416308), UINT64_C( 4360097470762206737),
+    UINT64_C( 3693891628877652244), UINT64_C( 2474242528778897655), UINT64_C(  787394278904577301),
+    UINT64_C( 3734332116149173950), UINT64_C( 3032448689878547779), UINT64_C( 3277577877463633490),
+    UINT64_C( 1478634811053175701), UINT64_C( 3930709610593225508), UINT64_C( 3630062051780545542),
+    UINT64_C( 2519742877070227732), UINT64_C( 3673249488438930105), UINT64_C( 1256763710343728242),
+    UINT64_C( 1874967952393962103), UINT64_C( 1533053825403530061), UINT64_C( 3178934214101961218),
+    UINT64_C( 1525871210789010239), UINT64_C( 1885361656605342679), UINT64_C( 3335076197782862170),
+    UINT64_C(  420716886884460848), UINT64_C( 2149368097306312619), UINT64_C( 2576507824955878287),
+    UINT64_C( 3905541298627606936), UINT64_C( 2766795047862501731), UINT64_C( 2737073233102681860),
+    UINT64_C(  655549401545426078), UINT64_C( 1570305887939507687), UINT64_C(  528183770302926512),
+    UINT64_C( 2538085162567975975), UINT64_C( 1466663677672983396), UINT64_C( 3249924556539299284),
+    UINT64_C( 2296307372821275815), UINT64_C( 1080301474579015457), UINT64_C( 3834646878792466042),
+    UINT64_C( 3309138426782285514), UINT64_C( 3367345159394646143), UINT64_C( 1697176449389017037),
+    UINT64_C( 2830509201689204628), UINT64_C( 4280677947144166879), UINT64_C( 2878228257628456680),
+    UINT64_C(  576549880350533040), UINT64_C( 1595482593607645320), UINT64_C( 2757163375145060952),
+    UINT64_C( 3762709555740706764), UINT64_C( 4132097551481449465), UINT64_C( 3073592028485366274),
+    UINT64_C( 2913941844454968569), UINT64_C( 1241943892123899649), UINT64_C( 3985388427924175927),
+    UINT64_C(  132931943920464216), UINT64_C(  963572232227621138), UINT64_C( 1086187686209696124),
+    UINT64_C( 4334591613285693131), UINT64_C( 4427242678814347554), UINT64_C( 2923393519039357984),
+    UINT64_C(  265849896788346259), UINT64_C( 3380477618653367844), UINT64_C( 3548307891575053927),
+    UINT64_C(   88313001273509989), UINT64_C(  229481740030525564), UINT64_C( 1142034642720021053),
+    UINT64_C(  943212704854558556), UINT64_C( 3581470053372412633), UINT64_C( 4455898604664459746),
+    UINT64_C(  448202126250173565), UINT64_C( 1184066495523972765), UINT64_C( 1479519005097051223),
+    UINT64_C( 4100879462871234869), UINT64_C( 4128379535214024737), UINT64_C( 4068021235021803744),
+    UINT64_C( 4121606289736188335), UINT64_C( 4474914786204157506), UINT64_C( 1104068613108266923),
+    UINT64_C( 2244818812920044936), UINT64_C( 1265464259985722977), UINT64_C(  652533216445055972),
+    UINT64_C( 4322585822259518046), UINT64_C( 2661589922495033735), UINT64_C(  987100506351041320),
+    UINT64_C( 3632461182717925746), UINT64_C( 2935790622343543901), UINT64_C(  645582641086574590),
+    UINT64_C( 4350719607959700781), UINT64_C( 4366668526428885515), UINT64_C(  345259560854666578),
+    UINT64_C( 3371492191676195091), UINT64_C(  574571179362302293), UINT64_C( 2623314936775053810),
+    UINT64_C( 4046268064833756812), UINT64_C(  994705779007527844), UINT64_C( 4345232052848843299),
+    UINT64_C( 3649531601045992464), UINT64_C( 1229784470992723326), UINT64_C( 1462672659301410100),
+    UINT64_C(  222363298121302350), UINT64_C( 1123780004951789812), UINT64_C(  516132550137894883),
+    UINT64_C( 1125377840692116595), UINT64_C( 1933456902796142000), UINT64_C( 3132880113770088014),
+    UINT64_C( 4107323397594688662), UINT64_C( 2157326113251484673), UINT64_C( 3245713155201487211),
+    UINT64_C( 3119415960364015505), UINT64_C( 2597643806533680773), UINT64_C( 3165364809910252476),
+    UINT64_C( 3252291321790303167), UINT64_C( 2747844116629241812), UINT64_C(  707982160446641454),
+    UINT64_C( 4592307042978040560), UINT64_C( 4445216908273154147), UINT64_C( 3846627600075277591),
+    UINT64_C( 2356451789188822646), UINT64_C(  451157696725097893), UINT64_C(  482239113613640005),
+    UINT64_C(  809272002027209176), UINT64_C( 3386023237205364002), UINT64_C( 2681365935457499374),
+    UINT64_C( 4383764944061676575), UINT64_C( 3002134461744886342), UINT64_C(  217460571654969358),
+    UINT64_C(  642576094567239175), UINT64_C(   92669405019080994), UINT64_C( 2239558735835916297),
+    UINT64_C( 1093332744300684120), UINT64_C(  371579570945566400), UINT64_C( 4521784081167841369),
+    UINT64_C(   32667495058069305), UINT64_C( 3249634314648685198), UINT64_C( 1511309992815106380),
+    UINT64_C( 3915370772345419643), UINT64_C( 4000825487962242896), UINT64_C(  128472323706958535),
+    UINT64_C( 1074338829714465939), UINT64_C( 3238395188897438401), UINT64_C( 3740670769793061656),
+    UINT64_C( 4403506197958660238), UINT64_C( 3470702154560351748), UINT64_C( 1324867958982897001),
+    UINT64_C( 1331772203197056095), UINT64_C( 3018668621686806755), UINT64_C( 2409664670287100869),
+    UINT64_C( 1165452898850607922), UINT64_C( 1645951455682690821), UINT64_C( 2116801334240291716),
+    UINT64_C( 1924881649978995319), UINT64_C( 1071066424862730134), UINT64_C(  330027879291519521),
+    UINT64_C(  669859680137310667), UINT64_C( 3374530130842092923), UINT64_C( 2313598627037541273),
+    UINT64_C( 2935145024351236606), UINT64_C( 2811852688171289856), UINT64_C( 4046281895801086962),
+    UINT64_C( 3432368257996892445), UINT64_C( 1499756067057231230), UINT64_C( 4172578522755673204),
+    UINT64_C(  562171890205887871), UINT64_C( 2241636511418284617), UINT64_C( 2076624595876616786),
+    UINT64_C(  538516744196509251), UINT64_C( 2442907545427550635), UINT64_C( 1130070916169322880),
+    UINT64_C( 3633422997847512353), UINT64_C(  187249431046427459), UINT64_C(  907536292839148742),
+    UINT64_C( 3394618906318341121), UINT64_C( 2893775854028913106), UINT64_C( 3102951436448193621),
+    UINT64_C(  836054860303693243), UINT64_C(  256721156335580833), UINT64_C( 1150065803392597846),
+    UINT64_C( 3281338745396304689), UINT64_C(    6115453881648595), UINT64_C( 4279111333455130993),
+    UINT64_C(  280546723785505881), UINT64_C( 2610827803358048316), UINT64_C( 3017470356035989713),
+    UINT64_C( 3301861002454902882), UINT64_C( 2229343474486230970), UINT64_C( 2590958914389261682),
+    UINT64_C( 1019335479952936867), UINT64_C( 3526947028660348658), UINT64_C( 2997138256801022277),
+    UINT64_C( 3638408044795586258), UINT64_C( 2777464262913720573), UINT64_C(  998342285220525008),
+    UINT64_C(  563431740559122686), UINT64_C( 3664247085526192562), UINT64_C( 1792096719878361652),
+    UINT64_C( 1514088270261435247), UINT64_C(  315810430551031626), UINT64_C( 2969192492117753139),
+    UINT64_C(   19602533819938967), UINT64_C(  214940600524212797), UINT64_C( 1215954448296340858),
+    UINT64_C( 1939475217606039421), UINT64_C( 4223786740293072220), UINT64_C(  457333833578157900),
+    UINT64_C( 1610800114724148084), UINT64_C(  181220087458713714), UINT64_C( 4139786193388248566),
+    UINT64_C( 4564445537667472269), UINT64_C( 1309048532335129902), UINT64_C( 3479045960750655309),
+    UINT64_C( 2399326072056448834), UINT64_C( 4427158721301587603), UINT64_C( 3025697040481053315),
+    UINT64_C( 1852184818241988882), UINT64_C(  994161879564739462), UINT64_C( 3444845605885419996),
+    UINT64_C( 3293764912996114848), UINT64_C( 3144438917205680352), UINT64_C( 4004348599691564871),
+    UINT64_C( 2314735998187876572), UINT64_C( 3519771985760240459), UINT64_C( 2285274162607378987),
+    UINT64_C( 3788628997163465257), UINT64_C( 3923659608139143229), UINT64_C(  372852338023073976),
+    UINT64_C( 1496926789713922054), UINT64_C( 2983502435741321882), UINT64_C( 4228381234493753401),
+    UINT64_C( 4370176269990062499), UINT64_C(  967167880729346584), UINT64_C( 3626835293658153146),
+    UINT64_C( 2504034192270386350), UINT64_C( 3145964027948816410), UINT64_C( 1553039539814721126),
+    UINT64_C( 3115166189560863868), UINT64_C( 1124193049055349191), UINT64_C( 4029597475302710099),
+    UINT64_C( 3396000543754538034), UINT64_C( 3709826170813048035), UINT64_C( 1175671755351670266),
+    UINT64_C( 4580317839448440772), UINT64_C( 2242618964484433073), UINT64_C( 2288957866861762576),
+    UINT64_C( 3475998875766277959), UINT64_C( 1082196204383124166), UINT64_C( 3194706432379451517),
+    UINT64_C( 2210974279307515123), UINT64_C(                   0), UINT64_C(                   4),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C(                   4),
+    UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205),
+    UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661),
+    UINT64_C(17511728213235757668), UINT64_C( 2351158912492758640), UINT64_C(                   4),
+    UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476),
+    UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661), UINT64_C(17511728213235757668),
+    UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183), UINT64_C( 8884524785671288102),
+    UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315), UINT64_C(14676697007180690308),
+    UINT64_C(14918918025040673339), UINT64_C(11644996259059072847), UINT64_C( 3623232563747686574),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205),
+    UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661),
+    UINT64_C(17511728213235757668), UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183),
+    UINT64_C( 8884524785671288102), UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315),
+    UINT64_C(14676697007180690308), UINT64_C(14918918025040673339), UINT64_C(11644996259059072847),
+    UINT64_C( 3623232563747686574), UINT64_C( 2556217086465930670), UINT64_C(10928151867741318085),
+    UINT64_C(12817638039923718863), UINT64_C(13800866446065292065), UINT64_C(17507507827583639480),
+    UINT64_C( 3761675888426073602), UINT64_C(11043114058563346863), UINT64_C(11809769321448950687),
+    UINT64_C(14782867813192276210), UINT64_C( 2488413857031047351), UINT64_C( 2840065831420830065),
+    UINT64_C( 6376687090250037436), UINT64_C( 4746308599252906500), UINT64_C(17922219283797788657),
+    UINT64_C( 9146486252817883622), UINT64_C(10174069959054132969), UINT64_C(                   4),
+    UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476),
+    UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661), UINT64_C(17511728213235757668),
+    UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183), UINT64_C( 8884524785671288102),
+    UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315), UINT64_C(14676697007180690308),
+    UINT64_C(14918918025040673339), UINT64_C(11644996259059072847), UINT64_C( 3623232563747686574),
+    UINT64_C( 2556217086465930670), UINT64_C(10928151867741318085), UINT64_C(12817638039923718863),
+    UINT64_C(13800866446065292065), UINT64_C(17507507827583639480), UINT64_C( 3761675888426073602),
+    UINT64_C(11043114058563346863), UINT64_C(11809769321448950687), UINT64_C(14782867813192276210),
+    UINT64_C( 2488413857031047351), UINT64_C( 2840065831420830065), UINT64_C( 6376687090250037436),
+    UINT64_C( 4746308599252906500), UINT64_C(17922219283797788657), UINT64_C( 9146486252817883622),
+    UINT64_C(10174069959054132969), UINT64_C(10072575054279351582), UINT64_C(10966636189184293973),
+    UINT64_C( 8477986509219018200), UINT64_C( 8576311056089553381), UINT64_C(  674553921631754431),
+    UINT64_C(15674820729988758831), UINT64_C(12517261530655964455), UINT64_C(13423798482208682136),
+    UINT64_C(17888783763160829334), UINT64_C(11004932962127832900), UINT64_C( 5997402673501242327),
+    UINT64_C( 4992009352715341068), UINT64_C(14269139486882120945), UINT64_C( 4937768902624589955),
+    UINT64_C(15053967799335727255), UINT64_C( 4242455547773805283), UINT64_C(13056691932841204314),
+    UINT64_C( 9958674537902485385), UINT64_C(15364725421824121569), UINT64_C( 5476585914141769315),
+    UINT64_C(13571664401908093354), UINT64_C( 1438031055912756488), UINT64_C( 2223313312939649808),
+    UINT64_C( 8698066976645706868), UINT64_C( 7816990934550415852), UINT64_C( 2901650642912409121),
+    UINT64_C( 8447690658178800776), UINT64_C( 2968052632020458530), UINT64_C( 4960798899168637972),
+    UINT64_C( 3123513322351159609), UINT64_C( 7686711190306185003), UINT64_C(   83556942304842756),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205),
+    UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661),
+    UINT64_C(17511728213235757668), UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183),
+    UINT64_C( 8884524785671288102), UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315),
+    UINT64_C(14676697007180690308), UINT64_C(14918918025040673339), UINT64_C(11644996259059072847),
+    UINT64_C( 3623232563747686574), UINT64_C( 2556217086465930670), UINT64_C(10928151867741318085),
+    UINT64_C(12817638039923718863), UINT64_C(13800866446065292065), UINT64_C(17507507827583639480),
+    UINT64_C( 3761675888426073602), UINT64_C(11043114058563346863), UINT64_C(11809769321448950687),
+    UINT64_C(14782867813192276210), UINT64_C( 2488413857031047351), UINT64_C( 2840065831420830065),
+    UINT64_C( 6376687090250037436), UINT64_C( 4746308599252906500), UINT64_C(17922219283797788657),
+    UINT64_C( 9146486252817883622), UINT64_C(10174069959054132969), UINT64_C(10072575054279351582),
+    UINT64_C(10966636189184293973), UINT64_C( 8477986509219018200), UINT64_C( 8576311056089553381),
+    UINT64_C(  674553921631754431), UINT64_C(15674820729988758831), UINT64_C(12517261530655964455),
+    UINT64_C(13423798482208682136), UINT64_C(17888783763160829334), UINT64_C(11004932962127832900),
+    UINT64_C( 5997402673501242327), UINT64_C( 4992009352715341068), UINT64_C(14269139486882120945),
+    UINT64_C( 4937768902624589955), UINT64_C(15053967799335727255), UINT64_C( 4242455547773805283),
+    UINT64_C(13056691932841204314), UINT64_C( 9958674537902485385), UINT64_C(15364725421824121569),
+    UINT64_C( 5476585914141769315), UINT64_C(13571664401908093354), UINT64_C( 1438031055912756488),
+    UINT64_C( 2223313312939649808), UINT64_C( 8698066976645706868), UINT64_C( 7816990934550415852),
+    UINT64_C( 2901650642912409121), UINT64_C( 8447690658178800776), UINT64_C( 2968052632020458530),
+    UINT64_C( 4960798899168637972), UINT64_C( 3123513322351159609), UINT64_C( 7686711190306185003),
+    UINT64_C(   83556942304842756), UINT64_C(17985574077943619039), UINT64_C(17657970624426188099),
+    UINT64_C(14636235241295332078), UINT64_C( 3948380481182684082), UINT64_C(13245901350281928823),
+    UINT64_C(14025730332113821184), UINT64_C( 1142756329542511018), UINT64_C(17651715579875475188),
+    UINT64_C(10148416980996031784), UINT64_C( 6663304871248354980), UINT64_C( 2927061728751804894),
+    UINT64_C( 7564546287726008543), UINT64_C(16903661042075694818), UINT64_C(17420765589996383288),
+    UINT64_C(10941590877337723575), UINT64_C(13865051143260747723), UINT64_C(14421333568924831368),
+    UINT64_C( 1077227322257662846), UINT64_C( 4483257934773921047), UINT64_C( 8069905057528153739),
+    UINT64_C(14970048539715003181), UINT64_C(10194505686615842373), UINT64_C(18135093711688925393),
+    UINT64_C( 2785029092184537364), UINT64_C( 8773728067210865869), UINT64_C(11900882899511978789),
+    UINT64_C(11529531604922623763), UINT64_C(14580207542242868544), UINT64_C( 7240089791002895170),
+    UINT64_C( 5584961233199406945), UINT64_C(17386809708519284030), UINT64_C(11373302577968517803),
+    UINT64_C(18393716860268627612), UINT64_C(15163734996133908791), UINT64_C(13970971350850471620),
+    UINT64_C(  961912087726926834), UINT64_C( 6646098588059882388), UINT64_C(12006488488061374836),
+    UINT64_C( 6920282754030912155), UINT64_C(16897109820406363522), UINT64_C(10563920708505556242),
+    UINT64_C( 7573921858584884152), UINT64_C( 7573519760028039506), UINT64_C( 1125895567644451247),
+    UINT64_C(15705143370304273599), UINT64_C(16315169117853152407), UINT64_C( 5537995199983591519),
+    UINT64_C(13914798947705936754), UINT64_C(10198015992023002346), UINT64_C(16061719114812804757),
+    UINT64_C( 9327952234180033476), UINT64_C(16068655174781381635), UINT64_C(17592606737994843699),
+    UINT64_C( 3093681311386685971), UINT64_C( 5407634799754856963), UINT64_C( 5753741326309074113),
+    UINT64_C(  878784601972636140), UINT64_C(17350133519936389927), UINT64_C(12494597023148119429),
+    UINT64_C(17141374865717568015), UINT64_C(13951237519208364868), UINT64_C(14747439402388767897),
+    UINT64_C( 2407205799512677458), UINT64_C( 2265789215313464191), UINT64_C(                   4),
+    UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476),
+    UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661), UINT64_C(17511728213235757668),
+    UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183), UINT64_C( 8884524785671288102),
+    UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315), UINT64_C(14676697007180690308),
+    UINT64_C(14918918025040673339), UINT64_C(11644996259059072847), UINT64_C( 3623232563747686574),
+    UINT64_C( 2556217086465930670), UINT64_C(10928151867741318085), UINT64_C(12817638039923718863),
+    UINT64_C(13800866446065292065), UINT64_C(17507507827583639480), UINT64_C( 3761675888426073602),
+    UINT64_C(11043114058563346863), UINT64_C(11809769321448950687), UINT64_C(14782867813192276210),
+    UINT64_C( 2488413857031047351), UINT64_C( 2840065831420830065), UINT64_C( 6376687090250037436),
+    UINT64_C( 4746308599252906500), UINT64_C(17922219283797788657), UINT64_C( 9146486252817883622),
+    UINT64_C(10174069959054132969), UINT64_C(10072575054279351582), UINT64_C(10966636189184293973),
+    UINT64_C( 8477986509219018200), UINT64_C( 8576311056089553381), UINT64_C(  674553921631754431),
+    UINT64_C(15674820729988758831), UINT64_C(12517261530655964455), UINT64_C(13423798482208682136),
+    UINT64_C(17888783763160829334), UINT64_C(11004932962127832900), UINT64_C( 5997402673501242327),
+    UINT64_C( 4992009352715341068), UINT64_C(14269139486882120945), UINT64_C( 4937768902624589955),
+    UINT64_C(15053967799335727255), UINT64_C( 4242455547773805283), UINT64_C(13056691932841204314),
+    UINT64_C( 9958674537902485385), UINT64_C(15364725421824121569), UINT64_C( 5476585914141769315),
+    UINT64_C(13571664401908093354), UINT64_C( 1438031055912756488), UINT64_C( 2223313312939649808),
+    UINT64_C( 8698066976645706868), UINT64_C( 7816990934550415852), UINT64_C( 2901650642912409121),
+    UINT64_C( 8447690658178800776), UINT64_C( 2968052632020458530), UINT64_C( 4960798899168637972),
+    UINT64_C( 3123513322351159609), UINT64_C( 7686711190306185003), UINT64_C(   83556942304842756),
+    UINT64_C(17985574077943619039), UINT64_C(17657970624426188099), UINT64_C(14636235241295332078),
+    UINT64_C( 3948380481182684082), UINT64_C(13245901350281928823), UINT64_C(14025730332113821184),
+    UINT64_C( 1142756329542511018), UINT64_C(17651715579875475188), UINT64_C(10148416980996031784),
+    UINT64_C( 6663304871248354980), UINT64_C( 2927061728751804894), UINT64_C( 7564546287726008543),
+    UINT64_C(16903661042075694818), UINT64_C(17420765589996383288), UINT64_C(10941590877337723575),
+    UINT64_C(13865051143260747723), UINT64_C(14421333568924831368), UINT64_C( 1077227322257662846),
+    UINT64_C( 4483257934773921047), UINT64_C( 8069905057528153739), UINT64_C(14970048539715003181),
+    UINT64_C(10194505686615842373), UINT64_C(18135093711688925393), UINT64_C( 2785029092184537364),
+    UINT64_C( 8773728067210865869), UINT64_C(11900882899511978789), UINT64_C(11529531604922623763),
+    UINT64_C(14580207542242868544), UINT64_C( 7240089791002895170), UINT64_C( 5584961233199406945),
+    UINT64_C(17386809708519284030), UINT64_C(11373302577968517803), UINT64_C(18393716860268627612),
+    UINT64_C(15163734996133908791), UINT64_C(13970971350850471620), UINT64_C(  961912087726926834),
+    UINT64_C( 6646098588059882388), UINT64_C(12006488488061374836), UINT64_C( 6920282754030912155),
+    UINT64_C(16897109820406363522), UINT64_C(10563920708505556242), UINT64_C( 7573921858584884152),
+    UINT64_C( 7573519760028039506), UINT64_C( 1125895567644451247), UINT64_C(15705143370304273599),
+    UINT64_C(16315169117853152407), UINT64_C( 5537995199983591519), UINT64_C(13914798947705936754),
+    UINT64_C(10198015992023002346), UINT64_C(16061719114812804757), UINT64_C( 9327952234180033476),
+    UINT64_C(16068655174781381635), UINT64_C(17592606737994843699), UINT64_C( 3093681311386685971),
+    UINT64_C( 5407634799754856963), UINT64_C( 5753741326309074113), UINT64_C(  878784601972636140),
+    UINT64_C(17350133519936389927), UINT64_C(12494597023148119429), UINT64_C(17141374865717568015),
+    UINT64_C(13951237519208364868), UINT64_C(14747439402388767897), UINT64_C( 2407205799512677458),
+    UINT64_C( 2265789215313464191), UINT64_C( 1039716469844495838), UINT64_C(10136350218365110649),
+    UINT64_C( 6686842495619853931), UINT64_C( 2907294805968276505), UINT64_C(11076281624236097625),
+    UINT64_C( 2306237600723203349), UINT64_C( 6101855951929913082), UINT64_C(18125485719892080834),
+    UINT64_C( 3381485790391523437), UINT64_C(14680840327684442728), UINT64_C(17845419079729368774),
+    UINT64_C(15909553281681930314), UINT64_C(18249470138605158188), UINT64_C(17285378418403962355),
+    UINT64_C( 3524040542852918050), UINT64_C( 7129813452174358595), UINT64_C(14239865381507695230),
+    UINT64_C(10955295270444562922), UINT64_C( 4074689581205956847), UINT64_C( 6558015698485658766),
+    UINT64_C(16657028460848171997), UINT64_C( 1286929903899792666), UINT64_C(15966784734568204765),
+    UINT64_C( 7824270775419642331), UINT64_C(  278923075289447638), UINT64_C( 1364477218702832529),
+    UINT64_C( 3891697026348309466), UINT64_C(15663653418748171429), UINT64_C( 1558218527397615355),
+    UINT64_C( 6653308439627100091), UINT64_C( 2034672919955913358), UINT64_C(15807062113259643637),
+    UINT64_C( 1899672600403880563), UINT64_C( 3790615019519385564), UINT64_C( 9560294163878869195),
+    UINT64_C(14231159680052420591), UINT64_C( 3718233446527876874), UINT64_C(10209214691454865441),
+    UINT64_C( 3304135847208704047), UINT64_C(10423553812079159100), UINT64_C( 1009443066374922318),
+    UINT64_C(14052401935071276086), UINT64_C( 6831714146248160555), UINT64_C(11127449704834096546),
+    UINT64_C( 5758479470575439236), UINT64_C(  732566982743647182), UINT64_C( 5446873101379656178),
+    UINT64_C(11839270788653130360), UINT64_C(11050101055794308357), UINT64_C( 5366069009874062879),
+    UINT64_C( 2002134990701802723), UINT64_C( 3383306831005980646), UINT64_C( 4964282137998265313),
+    UINT64_C(16975903079055268135), UINT64_C(  270056232827995987), UINT64_C(11495948545794501423),
+    UINT64_C( 7955286013093199779), UINT64_C( 4056424832275188522), UINT64_C(14837981313111265704),
+    UINT64_C(14475978693910290715), UINT64_C( 2014432317787483692), UINT64_C( 7101633344151534021),
+    UINT64_C(14476201976842271108), UINT64_C( 8478714126436493800), UINT64_C(13813277271426198918),
+    UINT64_C(17510577332776517823), UINT64_C( 9198219439208489655), UINT64_C(14639033977223486504),
+    UINT64_C( 3561184352679281267), UINT64_C(12102608726363868270), UINT64_C(11915755389573015561),
+    UINT64_C( 7497623306829789752), UINT64_C( 3582080959976423101), UINT64_C(17627158639497170344),
+    UINT64_C( 1903827625555410111), UINT64_C( 7695625441713880303), UINT64_C( 8059539975980288936),
+    UINT64_C( 9067394042329986124), UINT64_C( 8291631325589996226), UINT64_C(12526611629007139005),
+    UINT64_C( 6553427822111312839), UINT64_C(14665204329918856608), UINT64_C(12328473712760166841),
+    UINT64_C( 7481774245989516754), UINT64_C( 9213375237098742353), UINT64_C(  915702679663092652),
+    UINT64_C(15378587840911276424), UINT64_C( 8075225075991395041), UINT64_C(18098867141342057868),
+    UINT64_C(10776712425208693057), UINT64_C( 3665793502487115550), UINT64_C(17927500405131241415),
+    UINT64_C( 9548628996769139362), UINT64_C(15257552177047641205), UINT64_C(16891733089525687680),
+    UINT64_C(11902978697939475327), UINT64_C(  217604979600002846), UINT64_C( 1615649827745937260),
+    UINT64_C(14955145216164620896), UINT64_C(12236655377320257229), UINT64_C( 8770619634963257798),
+    UINT64_C(15179628619501137484), UINT64_C( 9643612087147104938), UINT64_C(  210285304309890007),
+    UINT64_C( 2355673058580863926), UINT64_C( 9168244342121592084), UINT64_C(17574135416880623349),
+    UINT64_C( 9882254119331121808), UINT64_C(17349399141560593947), UINT64_C( 4297415309647977967),
+    UINT64_C(15273765924197866240), UINT64_C(13477582398378317982), UINT64_C(17946082648595002870),
+    UINT64_C( 7109421145676748583), UINT64_C(14607950213243232024), UINT64_C( 2422586465983090473),
+    UINT64_C( 9589890338788845172), UINT64_C(11970666598174840493), UINT64_C(12534073847653326777),
+    UINT64_C( 1054599972088879367), UINT64_C(17392193100080171480), UINT64_C( 4296283716433729246),
+    UINT64_C(12113333719230673234), UINT64_C( 6880940400652645103), UINT64_C(14743879882598105032),
+    UINT64_C( 1382997646333486779), UINT64_C( 7959574599309636268), UINT64_C(  855030032260468944),
+    UINT64_C(                   4), UINT64_C( 6389794980909314552), UINT64_C( 3047429678507845205),
+    UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621), UINT64_C(13401885216926016661),
+    UINT64_C(17511728213235757668), UINT64_C( 2351158912492758640), UINT64_C( 4629002473775046183),
+    UINT64_C( 8884524785671288102), UINT64_C(10259949820381535209), UINT64_C( 7608887751095923315),
+    UINT64_C(14676697007180690308), UINT64_C(14918918025040673339), UINT64_C(11644996259059072847),
+    UINT64_C( 3623232563747686574), UINT64_C( 2556217086465930670), UINT64_C(10928151867741318085),
+    UINT64_C(12817638039923718863), UINT64_C(13800866446065292065), UINT64_C(17507507827583639480),
+    UINT64_C( 3761675888426073602), UINT64_C(11043114058563346863), UINT64_C(11809769321448950687),
+    UINT64_C(14782867813192276210), UINT64_C( 2488413857031047351), UINT64_C( 2840065831420830065),
+    UINT64_C( 6376687090250037436), UINT64_C( 4746308599252906500), UINT64_C(17922219283797788657),
+    UINT64_C( 9146486252817883622), UINT64_C(10174069959054132969), UINT64_C(10072575054279351582),
+    UINT64_C(10966636189184293973), UINT64_C( 8477986509219018200), UINT64_C( 8576311056089553381),
+    UINT64_C(  674553921631754431), UINT64_C(15674820729988758831), UINT64_C(12517261530655964455),
+    UINT64_C(13423798482208682136), UINT64_C(17888783763160829334), UINT64_C(11004932962127832900),
+    UINT64_C( 5997402673501242327), UINT64_C( 4992009352715341068), UINT64_C(14269139486882120945),
+    UINT64_C( 4937768902624589955), UINT64_C(15053967799335727255), UINT64_C( 4242455547773805283),
+    UINT64_C(13056691932841204314), UINT64_C( 9958674537902485385), UINT64_C(15364725421824121569),
+    UINT64_C( 5476585914141769315), UINT64_C(13571664401908093354), UINT64_C( 1438031055912756488),
+    UINT64_C( 2223313312939649808), UINT64_C( 8698066976645706868), UINT64_C( 7816990934550415852),
+    UINT64_C( 2901650642912409121), UINT64_C( 8447690658178800776), UINT64_C( 2968052632020458530),
+    UINT64_C( 4960798899168637972), UINT64_C( 3123513322351159609), UINT64_C( 7686711190306185003),
+    UINT64_C(   83556942304842756), UINT64_C(17985574077943619039), UINT64_C(17657970624426188099),
+    UINT64_C(14636235241295332078), UINT64_C( 3948380481182684082), UINT64_C(13245901350281928823),
+    UINT64_C(14025730332113821184), UINT64_C( 1142756329542511018), UINT64_C(17651715579875475188),
+    UINT64_C(10148416980996031784), UINT64_C( 6663304871248354980), UINT64_C( 2927061728751804894),
+    UINT64_C( 7564546287726008543), UINT64_C(16903661042075694818), UINT64_C(17420765589996383288),
+    UINT64_C(10941590877337723575), UINT64_C(13865051143260747723), UINT64_C(14421333568924831368),
+    UINT64_C( 1077227322257662846), UINT64_C( 4483257934773921047), UINT64_C( 8069905057528153739),
+    UINT64_C(14970048539715003181), UINT64_C(10194505686615842373), UINT64_C(18135093711688925393),
+    UINT64_C( 2785029092184537364), UINT64_C( 8773728067210865869), UINT64_C(11900882899511978789),
+    UINT64_C(11529531604922623763), UINT64_C(14580207542242868544), UINT64_C( 7240089791002895170),
+    UINT64_C( 5584961233199406945), UINT64_C(17386809708519284030), UINT64_C(11373302577968517803),
+    UINT64_C(18393716860268627612), UINT64_C(15163734996133908791), UINT64_C(13970971350850471620),
+    UINT64_C(  961912087726926834), UINT64_C( 6646098588059882388), UINT64_C(12006488488061374836),
+    UINT64_C( 6920282754030912155), UINT64_C(16897109820406363522), UINT64_C(10563920708505556242),
+    UINT64_C( 7573921858584884152), UINT64_C( 7573519760028039506), UINT64_C( 1125895567644451247),
+    UINT64_C(15705143370304273599), UINT64_C(16315169117853152407), UINT64_C( 5537995199983591519),
+    UINT64_C(13914798947705936754), UINT64_C(10198015992023002346), UINT64_C(16061719114812804757),
+    UINT64_C( 9327952234180033476), UINT64_C(16068655174781381635), UINT64_C(17592606737994843699),
+    UINT64_C( 3093681311386685971), UINT64_C( 5407634799754856963), UINT64_C( 5753741326309074113),
+    UINT64_C(  878784601972636140), UINT64_C(17350133519936389927), UINT64_C(12494597023148119429),
+    UINT64_C(17141374865717568015), UINT64_C(13951237519208364868), UINT64_C(14747439402388767897),
+    UINT64_C( 2407205799512677458), UINT64_C( 2265789215313464191), UINT64_C( 1039716469844495838),
+    UINT64_C(10136350218365110649), UINT64_C( 6686842495619853931), UINT64_C( 2907294805968276505),
+    UINT64_C(11076281624236097625), UINT64_C( 2306237600723203349), UINT64_C( 6101855951929913082),
+    UINT64_C(18125485719892080834), UINT64_C( 3381485790391523437), UINT64_C(14680840327684442728),
+    UINT64_C(17845419079729368774), UINT64_C(15909553281681930314), UINT64_C(18249470138605158188),
+    UINT64_C(17285378418403962355), UINT64_C( 3524040542852918050), UINT64_C( 7129813452174358595),
+    UINT64_C(14239865381507695230), UINT64_C(10955295270444562922), UINT64_C( 4074689581205956847),
+    UINT64_C( 6558015698485658766), UINT64_C(16657028460848171997), UINT64_C( 1286929903899792666),
+    UINT64_C(15966784734568204765), UINT64_C( 7824270775419642331), UINT64_C(  278923075289447638),
+    UINT64_C( 1364477218702832529), UINT64_C( 3891697026348309466), UINT64_C(15663653418748171429),
+    UINT64_C( 1558218527397615355), UINT64_C( 6653308439627100091), UINT64_C( 2034672919955913358),
+    UINT64_C(15807062113259643637), UINT64_C( 1899672600403880563), UINT64_C( 3790615019519385564),
+    UINT64_C( 9560294163878869195), UINT64_C(14231159680052420591), UINT64_C( 3718233446527876874),
+    UINT64_C(10209214691454865441), UINT64_C( 3304135847208704047), UINT64_C(10423553812079159100),
+    UINT64_C( 1009443066374922318), UINT64_C(14052401935071276086), UINT64_C( 6831714146248160555),
+    UINT64_C(11127449704834096546), UINT64_C( 5758479470575439236), UINT64_C(  732566982743647182),
+    UINT64_C( 5446873101379656178), UINT64_C(11839270788653130360), UINT64_C(11050101055794308357),
+    UINT64_C( 5366069009874062879), UINT64_C( 2002134990701802723), UINT64_C( 3383306831005980646),
+    UINT64_C( 4964282137998265313), UINT64_C(16975903079055268135), UINT64_C(  270056232827995987),
+    UINT64_C(11495948545794501423), UINT64_C( 7955286013093199779), UINT64_C( 4056424832275188522),
+    UINT64_C(14837981313111265704), UINT64_C(14475978693910290715), UINT64_C( 2014432317787483692),
+    UINT64_C( 7101633344151534021), UINT64_C(14476201976842271108), UINT64_C( 8478714126436493800),
+    UINT64_C(13813277271426198918), UINT64_C(17510577332776517823), UINT64_C( 9198219439208489655),
+    UINT64_C(14639033977223486504), UINT64_C( 3561184352679281267), UINT64_C(12102608726363868270),
+    UINT64_C(11915755389573015561), UINT64_C( 7497623306829789752), UINT64_C( 3582080959976423101),
+    UINT64_C(17627158639497170344), UINT64_C( 1903827625555410111), UINT64_C( 7695625441713880303),
+    UINT64_C( 8059539975980288936), UINT64_C( 9067394042329986124), UINT64_C( 8291631325589996226),
+    UINT64_C(12526611629007139005), UINT64_C( 6553427822111312839), UINT64_C(14665204329918856608),
+    UINT64_C(12328473712760166841), UINT64_C( 7481774245989516754), UINT64_C( 9213375237098742353),
+    UINT64_C(  915702679663092652), UINT64_C(15378587840911276424), UINT64_C( 8075225075991395041),
+    UINT64_C(18098867141342057868), UINT64_C(10776712425208693057), UINT64_C( 3665793502487115550),
+    UINT64_C(17927500405131241415), UINT64_C( 9548628996769139362), UINT64_C(15257552177047641205),
+    UINT64_C(16891733089525687680), UINT64_C(11902978697939475327), UINT64_C(  217604979600002846),
+    UINT64_C( 1615649827745937260), UINT64_C(14955145216164620896), UINT64_C(12236655377320257229),
+    UINT64_C( 8770619634963257798), UINT64_C(15179628619501137484), UINT64_C( 9643612087147104938),
+    UINT64_C(  210285304309890007), UINT64_C( 2355673058580863926), UINT64_C( 9168244342121592084),
+    UINT64_C(17574135416880623349), UINT64_C( 9882254119331121808), UINT64_C(17349399141560593947),
+    UINT64_C( 4297415309647977967), UINT64_C(15273765924197866240), UINT64_C(13477582398378317982),
+    UINT64_C(17946082648595002870), UINT64_C( 7109421145676748583), UINT64_C(14607950213243232024),
+    UINT64_C( 2422586465983090473), UINT64_C( 9589890338788845172), UINT64_C(11970666598174840493),
+    UINT64_C(12534073847653326777), UINT64_C( 1054599972088879367), UINT64_C(17392193100080171480),
+    UINT64_C( 4296283716433729246), UINT64_C(12113333719230673234), UINT64_C( 6880940400652645103),
+    UINT64_C(14743879882598105032), UINT64_C( 1382997646333486779), UINT64_C( 7959574599309636268),
+    UINT64_C(  855030032260468944), UINT64_C( 4547880687740263771), UINT64_C(  541553447589458101),
+    UINT64_C( 3319946136906286593), UINT64_C(10073687856281732059), UINT64_C( 2493841693406069541),
+    UINT64_C(14317238999849935776), UINT64_C( 5785862900360322102), UINT64_C( 5696333918988051541),
+    UINT64_C(12610037564746975297), UINT64_C( 3563980422135243417), UINT64_C(16504779532578367405),
+    UINT64_C( 7476882340635049218), UINT64_C( 7507482102304152648), UINT64_C( 7739304840685703036),
+    UINT64_C(17440389883048912140), UINT64_C(14775566515510681151), UINT64_C( 9896970115115638964),
+    UINT64_C( 3149577115618324588), UINT64_C(14937328464596768765), UINT64_C(12129794759514250367),
+    UINT64_C(13110311509854598000), UINT64_C( 5914539244212731695), UINT64_C(15722838442372978834),
+    UINT64_C(14520248207122253095), UINT64_C(10078971508280960161), UINT64_C(14692997953755792191),
+    UINT64_C( 5027054841374937523), UINT64_C( 7499871809575885047), UINT64_C( 6132215301614150198),
+    UINT64_C(12715736856407906985), UINT64_C( 6103484843156070770), UINT64_C( 7541446626421407554),
+    UINT64_C(13340304791131513844), UINT64_C( 1682867547537851612), UINT64_C( 8597472389225292472),
+    UINT64_C(10306031299823563490), UINT64_C(15622165194510504054), UINT64_C(11067180191450060984),
+    UINT64_C(10948292932410780919), UINT64_C( 2622197606181717120), UINT64_C( 6281223551758061430),
+    UINT64_C( 2112735081211716368), UINT64_C(10152340650271953491), UINT64_C( 5866654710691962241),
+    UINT64_C(12999698226157260636), UINT64_C( 9185229491285148127), UINT64_C( 4321205898316082936),
+    UINT64_C(15338587515169939093), UINT64_C(13236553707129206713), UINT64_C(13469380637578650366),
+    UINT64_C( 6788705797556101309), UINT64_C(11322036806756873817), UINT64_C(17122711788576751156),
+    UINT64_C(11512913030513882957), UINT64_C( 2306199521402143425), UINT64_C( 6381930374430612454),
+    UINT64_C(11028653500580297680), UINT64_C(15050838222962900575), UINT64_C(16528390205925878597),
+    UINT64_C(12294368113941525151), UINT64_C(11655767377819931211), UINT64_C( 4967775568495622862),
+    UINT64_C(15941553711696781578), UINT64_C(  531727775681859461), UINT64_C( 3854288928910503379),
+    UINT64_C( 4344750744838805719), UINT64_C(17338366453142857217), UINT64_C(17708970715257476720),
+    UINT64_C(11693574076157489056), UINT64_C( 1063399587153390230), UINT64_C(13521910474613537427),
+    UINT64_C(14193231566300285038), UINT64_C(  353252005094041681), UINT64_C(  917926960122106739),
+    UINT64_C( 4568138570880106526), UINT64_C( 3772850819418252653), UINT64_C(14325880213489720510),
+    UINT64_C(17823594418657926048), UINT64_C( 1792808505000703017), UINT64_C( 4736265982095914195),
+    UINT64_C( 5918076020388233800), UINT64_C(16403517851485019603), UINT64_C(16513518140856179612),
+    UINT64_C(16272084940087294461), UINT64_C(16486425158944833872), UINT64_C(17899659144816717459),
+    UINT64_C( 4416274452433089264), UINT64_C( 8979275251680223605), UINT64_C( 5061857039942916633),
+    UINT64_C( 2610132865780236637), UINT64_C(17290343289038156643), UINT64_C(10646359689980186944),
+    UINT64_C( 3948402025404184567), UINT64_C(14529844730871773958), UINT64_C(11743162489374232966),
+    UINT64_C( 2582330564346310974), UINT64_C(17402878431838888132), UINT64_C(17466674105715627380),
+    UINT64_C( 1381038243418673058), UINT64_C(13485968766704846239), UINT64_C( 2298284717449220398),
+    UINT64_C(10493259747100266497), UINT64_C(16185072259335106308), UINT64_C( 3978823116030130811),
+    UINT64_C(17380928211395458097), UINT64_C(14598126404184041164), UINT64_C( 4919137883970917332),
+    UINT64_C( 5850690637205668979), UINT64_C(  889453192485213744), UINT64_C( 4495120019807181205),
+    UINT64_C( 2064530200551589616), UINT64_C( 4501511362768488368), UINT64_C( 7733827611184605777),
+    UINT64_C(12531520455080413269), UINT64_C(16429293590378834901), UINT64_C( 8629304453005980844),
+    UINT64_C(12982852620806012262), UINT64_C(12477663841456122970), UINT64_C(10390575226134773847),
+    UINT64_C(12661459239641071752), UINT64_C(13009165287161276214), UINT64_C(10991376466517020938),
+    UINT64_C( 2831928641786579649), UINT64_C(18369228171912251969), UINT64_C(17780867633092703443),
+    UINT64_C(15386510400301185523), UINT64_C( 9425807156755336626), UINT64_C( 1804630786900400387),
+    UINT64_C( 1928956454454569442), UINT64_C( 3237088008108852516), UINT64_C(13544092948821522167),
+    UINT64_C(10725463741830049887), UINT64_C(17535059776246791954), UINT64_C(12008537846979604026),
+    UINT64_C(  869842286619881680), UINT64_C( 2570304378268969255), UINT64_C(  370677620076325786),
+    UINT64_C( 8958234943343708946), UINT64_C( 4373330977202757842), UINT64_C( 1486318283782272860),
+    UINT64_C(18087136324671453827), UINT64_C(  130669980232277858), UINT64_C(12998537258594804286),
+    UINT64_C( 6045239971260455049), UINT64_C(15661483089381755074), UINT64_C(16003301951849049756),
+    UINT64_C(  513889294827836650), UINT64_C( 4297355318857884747), UINT64_C(12953580755589816879),
+    UINT64_C(14962683079172319713), UINT64_C(17614024791834726992), UINT64_C(13882808618241474806),
+    UINT64_C( 5299471835931613890), UINT64_C( 5327088812788250401), UINT64_C(12074674486747286001),
+    UINT64_C( 9638658681148450558), UINT64_C( 4661811595402454459), UINT64_C( 6583805822730795444),
+    UINT64_C( 8467205336961208224), UINT64_C( 7699526599916018886), UINT64_C( 4284265699450941463),
+    UINT64_C( 1320111517166084532), UINT64_C( 2679438720549255756), UINT64_C(13498120523368437627),
+    UINT64_C( 9254394508150210297), UINT64_C(11740580097405003773), UINT64_C(11247410752685214364),
+    UINT64_C(16185127583204426908), UINT64_C(13729473031987636845), UINT64_C( 5999024268228954223),
+    UINT64_C(16690314091022774344), UINT64_C( 2248687560823562468), UINT64_C( 8966546045673182267),
+    UINT64_C( 8306498383506507719), UINT64_C( 2154066976786047526), UINT64_C( 9771630181710250272),
+    UINT64_C( 4520283664677313600), UINT64_C(14533691991390120405), UINT64_C(  748997724185713494),
+    UINT64_C( 3630145171356612700), UINT64_C(13578475625273430811), UINT64_C(11575103416115708965),
+    UINT64_C(12411805745792835112), UINT64_C( 3344219441214789307), UINT64_C( 1026884625342328348),
+    UINT64_C( 4600263213570413855), UINT64_C(13125354981585282870), UINT64_C(   24461815526594499),
+    UINT64_C(17116445333820607581), UINT64_C( 1122186895142029005), UINT64_C(10443311213432244277),
+    UINT64_C(12069881424144017810), UINT64_C(13207444009819676043), UINT64_C( 8917373897944967439),
+    UINT64_C(10363835657557097352), UINT64_C( 4077341919811767384), UINT64_C(14107788114641463545),
+    UINT64_C(11988553027204147669), UINT64_C(14553632179182416123), UINT64_C(11109857051654936561),
+    UINT64_C( 3993369140882119538), UINT64_C( 2253726962236501752), UINT64_C(14656988342104841843),
+    UINT64_C( 7168386879513481623), UINT64_C( 6056353081045770571), UINT64_C( 1263241722204132674),
+    UINT64_C(11876769968471070571), UINT64_C(   78410135279756251), UINT64_C(  859762402096855387),
+    UINT64_C( 4863817793185387190), UINT64_C( 7757900870424195579), UINT64_C(16895146961172371408),
+    UINT64_C( 1829335334312640535), UINT64_C( 6443200458896623809), UINT64_C(  724880349834858396),
+    UINT64_C(16559144773553075151), UINT64_C(18257782150669978260), UINT64_C( 5236194129340545185),
+    UINT64_C(13916183843002689213), UINT64_C( 9597304288225842216), UINT64_C(17708634885206436914),
+    UINT64_C(12102788161924272379), UINT64_C( 7408739272967991717), UINT64_C( 3976647518258977272),
+    UINT64_C(13779382423541747293), UINT64_C(13175059651984523749), UINT64_C(12577755668822782847),
+    UINT64_C(16017394398766337725), UINT64_C( 9258943992751551515), UINT64_C(14079087943041030609),
+    UINT64_C( 9141096650429560600), UINT64_C(15154515988653935054), UINT64_C(15694638432556649580),
+    UINT64_C( 1491409352092303189), UINT64_C( 5987707158855717464), UINT64_C(11934009742965345822),
+    UINT64_C(16913524937975096222), UINT64_C(17480705079960335385), UINT64_C( 3868671522917405233),
+    UINT64_C(14507341174632683448), UINT64_C(10016136769081594326), UINT64_C(12583856111795327109),
+    UINT64_C( 6212158159258914848), UINT64_C(12460664758243516339), UINT64_C( 4496772196221418729),
+    UINT64_C(16118389901210919130), UINT64_C(13584002175018218490), UINT64_C(14839304683252264626),
+    UINT64_C( 4702687021406704035), UINT64_C(18321271357793852583), UINT64_C( 8970475857937776110),
+    UINT64_C( 9155831467447095028), UINT64_C(13903995503065179753), UINT64_C( 4328784817532517809),
+    UINT64_C(12778825729517868489), UINT64_C( 8843897117230103692),
+};
+
+const uint64_t ntt64_1024_mixed_powers[2048] = {
+    UINT64_C(                   0), UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249),
+    UINT64_C( 3849828598800407797), UINT64_C( 4023896290304178588), UINT64_C( 1261214714195877578),
+    UINT64_C(  233753965118447345), UINT64_C( 2676210263234941926), UINT64_C( 3705877877490448158),
+    UINT64_C( 2709464080653393840), UINT64_C(  881956512167215261), UINT64_C( 2390554822009554201),
+    UINT64_C( 1700436953662611386), UINT64_C( 2046698563331994104), UINT64_C(  942511766632210723),
+    UINT64_C( 3454435399983609484), UINT64_C( 2068168528663844559), UINT64_C( 1659243688065142127),
+    UINT64_C( 3017514245864863805), UINT64_C( 1161469406911059214), UINT64_C(  131131197477940099),
+    UINT64_C( 3671267046320851570), UINT64_C( 3989582554169606578), UINT64_C( 1879648051492049201),
+    UINT64_C( 2325064455222905641), UINT64_C( 1850907503786542147), UINT64_C( 3901669560572161329),
+    UINT64_C( 1407276508446451314), UINT64_C( 3425108868614144548), UINT64_C(  234809061531476887),
+    UINT64_C(  915969065129314377), UINT64_C( 3972631746810885831), UINT64_C( 4590796782851154790),
+    UINT64_C( 3551072131483919237), UINT64_C( 2437169274265949282), UINT64_C( 1255736397875211236),
+    UINT64_C( 3869672860422254369), UINT64_C( 3363683680248536206), UINT64_C( 3242539539891929736),
+    UINT64_C( 2467608254404987505), UINT64_C( 3830807687839579289), UINT64_C( 3377243792771223918),
+    UINT64_C( 4252178254449178011), UINT64_C(  692980835930194811), UINT64_C( 3886273357699266640),
+    UINT64_C( 1860452777895420591), UINT64_C( 2122017383951756192), UINT64_C( 1870026971131305276),
+    UINT64_C( 2690008220850828513), UINT64_C(  848194068593451947), UINT64_C( 4055857690192455640),
+    UINT64_C( 1482370635763389549), UINT64_C( 2499763353882675499), UINT64_C( 3112335350052062119),
+    UINT64_C(  770504662971353748), UINT64_C( 2492189391122621180), UINT64_C( 3371486293635211942),
+    UINT64_C( 1044401146706852566), UINT64_C( 1218769917950358612), UINT64_C( 4443047538019427593),
+    UINT64_C( 2657438284789770960), UINT64_C(  139490077637179889), UINT64_C( 1347513035217080243),
+    UINT64_C( 2093542254857539782), UINT64_C( 4045238714599002096), UINT64_C( 1768360373935249815),
+    UINT64_C( 1132986281500898181), UINT64_C( 1145423232612195378), UINT64_C( 3173250686850103875),
+    UINT64_C( 3915428745381234437), UINT64_C(  387408563325795131), UINT64_C(  198757123458518136),
+    UINT64_C(  326342301997994306), UINT64_C(  966634132866666046), UINT64_C( 4330212126516253940),
+    UINT64_C( 2720549446495872479), UINT64_C(  594522224732039591), UINT64_C( 2594209754045336797),
+    UINT64_C( 4371207996495634843), UINT64_C( 3624590898131699178), UINT64_C(  924826167830191412),
+    UINT64_C( 3215445710127520461), UINT64_C(  532893738964097199), UINT64_C(  256494620928290829),
+    UINT64_C( 3838265690580697662), UINT64_C( 2063059596773417233), UINT64_C( 1610063896412036330),
+    UINT64_C( 1105253435398927209), UINT64_C(  274152638443289083), UINT64_C( 1636465293549385213),
+    UINT64_C( 2718205553781153588), UINT64_C( 2945859800615284769), UINT64_C(  596256239724183802),
+    UINT64_C( 4342379187862950981), UINT64_C(  820752269393906697), UINT64_C(  197193362320839916),
+    UINT64_C( 4009884568549198952), UINT64_C(  264983591297565602), UINT64_C( 3227187218431474260),
+    UINT64_C( 1876288299092947845), UINT64_C( 3259777318488657740), UINT64_C(   77912590505156175),
+    UINT64_C( 2881615329919645789), UINT64_C( 4325996936041739018), UINT64_C( 1488036762640350778),
+    UINT64_C( 1729303117196723516), UINT64_C( 2718306078420364749), UINT64_C( 3879920586239417728),
+    UINT64_C( 2279697959882368399), UINT64_C( 3490871534733890590), UINT64_C( 1118943180714764533),
+    UINT64_C(  952627208103550231), UINT64_C( 1123876638625291197), UINT64_C( 2801663570676650426),
+    UINT64_C(  685400175851316156), UINT64_C(  385770757908462315), UINT64_C(  213534333928675936),
+    UINT64_C(  869173883498632863), UINT64_C( 2950161371412402896), UINT64_C( 1300210680856899347),
+    UINT64_C( 4391989867934207415), UINT64_C( 2418254001624659624), UINT64_C( 1970705841300989217),
+    UINT64_C( 2074581773178369824), UINT64_C( 2062182020421627244), UINT64_C( 1006352626196175146),
+    UINT64_C(   13256803360230936), UINT64_C(  115292498941482581), UINT64_C( 4397928510362249185),
+    UINT64_C( 2492007486818252281), UINT64_C( 1635941343942511081), UINT64_C(  659920490112473771),
+    UINT64_C( 1242290418832802340), UINT64_C( 1651868321264097245), UINT64_C( 1480033111175595923),
+    UINT64_C( 2829232655383784435), UINT64_C( 4348036025405146823), UINT64_C( 1737698881978754060),
+    UINT64_C( 2592879749429526478), UINT64_C( 2655618324572464349), UINT64_C( 4559114692349893132),
+    UINT64_C( 2005797565407588331), UINT64_C( 2737280191719927095), UINT64_C(   80314588454367303),
+    UINT64_C( 2891450918264212504), UINT64_C(  992691344949810376), UINT64_C(  129810917144576916),
+    UINT64_C(  695772663740341648), UINT64_C( 2141122488594596993), UINT64_C( 1829823592218854829),
+    UINT64_C( 2687779657998904699), UINT64_C(  634297698006902227), UINT64_C( 4006039401931595717),
+    UINT64_C( 3765859310675874347), UINT64_C( 2741242456929995325), UINT64_C( 2972182093805958694),
+    UINT64_C( 1552522174097316013), UINT64_C( 1053896098414277608), UINT64_C(  951927524121511628),
+    UINT64_C( 3884862316935299801), UINT64_C( 4265936606843995371), UINT64_C( 2836277682389490544),
+    UINT64_C(  797297974165473708), UINT64_C( 2948358908520598479), UINT64_C( 3537332191015376133),
+    UINT64_C( 4428544272741454476), UINT64_C( 2344837507844879919), UINT64_C(  290341413826395897),
+    UINT64_C( 1619019368883669872), UINT64_C(  367710248663569074), UINT64_C( 4382760348511593332),
+    UINT64_C( 4289953542452418782), UINT64_C(  816778863552099543), UINT64_C( 2059382345563661484),
+    UINT64_C( 1586033836836413089), UINT64_C( 4035126618246567356), UINT64_C( 3537615089318938312),
+    UINT64_C( 3597579810358573200), UINT64_C( 1917507912125205273), UINT64_C( 4270566713751658911),
+    UINT64_C( 2319624932896978552), UINT64_C( 1098585534659563516), UINT64_C(  204896358553094317),
+    UINT64_C(  941475936506272623), UINT64_C( 2834330732008186913), UINT64_C( 3270168765958856210),
+    UINT64_C(  945384935947669134), UINT64_C( 1872862200816238025), UINT64_C( 4207773561490883035),
+    UINT64_C( 3664032263547523615), UINT64_C(  234041685233257305), UINT64_C( 2077598463836100093),
+    UINT64_C( 2621792368599966030), UINT64_C(  992635524216815278), UINT64_C(  388752746045964085),
+    UINT64_C( 4103017788438389522), UINT64_C(  793244537377917469), UINT64_C( 3249967743082457984),
+    UINT64_C( 2538778187029876446), UINT64_C( 3730675882714140168), UINT64_C( 1478167556514048989),
+    UINT64_C( 4544171960220366710), UINT64_C(  767039058199565051), UINT64_C(  619989834785333684),
+    UINT64_C( 2200782996640600919), UINT64_C( 3785652056625193400), UINT64_C( 1632747171034126038),
+    UINT64_C( 3086222030444894558), UINT64_C( 1583352588619711861), UINT64_C(  902190690149567071),
+    UINT64_C( 3695237642805590966), UINT64_C( 3638761761840292763), UINT64_C(  218152164207231001),
+    UINT64_C( 2903757481865333581), UINT64_C( 4135729112038515174), UINT64_C(  150331248495044976),
+    UINT64_C(  959698465116575210), UINT64_C( 4111152270751917141), UINT64_C( 1529567590237338722),
+    UINT64_C( 3593013623125881141), UINT64_C(  872899714386228416), UINT64_C( 2221612477457659753),
+    UINT64_C( 2312131158625254196), UINT64_C( 2939975394522410060), UINT64_C(  925716047777857124),
+    UINT64_C( 4108077938980496914), UINT64_C( 2224528769235092197), UINT64_C( 4222131386577963441),
+    UINT64_C(  274336233037238077), UINT64_C( 3172066150783512600), UINT64_C( 2596801024432302985),
+    UINT64_C(   49318483776098116), UINT64_C( 2214213433730165795), UINT64_C( 3370615483927805111),
+    UINT64_C( 2308342209152691040), UINT64_C(  447428903215342719), UINT64_C( 2419031109686561638),
+    UINT64_C( 3682127656795400699), UINT64_C( 3721389930257549409), UINT64_C( 1842615612368354497),
+    UINT64_C(  263637743407343746), UINT64_C( 2622864515154075147), UINT64_C(   86969233091873012),
+    UINT64_C( 4541955249605003808), UINT64_C( 4022767753782152272), UINT64_C( 4359325251833636030),
+    UINT64_C( 3716165778433263976), UINT64_C( 3766314570829488647), UINT64_C(  125165356278636575),
+    UINT64_C( 1849160754478801782), UINT64_C( 2973329062899545170), UINT64_C( 1051719673050458959),
+    UINT64_C( 4557284773527364931), UINT64_C( 4136767868326397556), UINT64_C( 1158366700570832516),
+    UINT64_C( 4351756900966242687), UINT64_C( 2400711739119850254), UINT64_C( 4160528321702267484),
+    UINT64_C( 1594215662391375664), UINT64_C( 4478754074506901161), UINT64_C( 3617524138862625915),
+    UINT64_C( 3966103377340790787), UINT64_C( 2686804368448370058), UINT64_C( 2726324361822022698),
+    UINT64_C(  984850724769212231), UINT64_C( 3486308177735248782), UINT64_C( 2168778472999814742),
+    UINT64_C(  777039139634899335), UINT64_C( 4592083484607426410), UINT64_C( 3427619522903392612),
+    UINT64_C( 3100376025612258997), UINT64_C(  917794389549713133), UINT64_C(  901859847614317342),
+    UINT64_C( 1446321208517112901), UINT64_C( 3775631158123672134), UINT64_C( 3016203424819720057),
+    UINT64_C(  471899825039116811), UINT64_C( 2366867205507320441), UINT64_C( 1140983863867013629),
+    UINT64_C(  981623966646819835), UINT64_C(  823057021263900120), UINT64_C( 3616980239419837533),
+    UINT64_C(  565404122626278415), UINT64_C( 3956136616881939299), UINT64_C( 1834221755513644804),
+    UINT64_C( 1063378126852311450), UINT64_C( 3969109923860126202), UINT64_C( 3187602538680359448),
+    UINT64_C( 2322728151565602801), UINT64_C(   19378975449324817), UINT64_C( 4605570564545716782),
+    UINT64_C( 1538093989941999103), UINT64_C( 2212359946370916543), UINT64_C( 1950096095932331642),
+    UINT64_C( 2202021348140264508), UINT64_C( 2736718066033403274), UINT64_C( 1628183582686043495),
+    UINT64_C( 3149013359125955277), UINT64_C( 4049514128221477506), UINT64_C( 3145022340754381981),
+    UINT64_C( 2819589298549003725), UINT64_C( 3668473313572806821), UINT64_C( 4240106447481798977),
+    UINT64_C( 2742465433268612203), UINT64_C( 1496519828866501509), UINT64_C( 2454359905175880704),
+    UINT64_C( 3704149725588216635), UINT64_C( 1781176816738160749), UINT64_C(  387899278134293157),
+    UINT64_C(  543664783405561633), UINT64_C( 3537347188712899438), UINT64_C( 1579237328548817598),
+    UINT64_C(  607337418735800506), UINT64_C( 1240193826751170286), UINT64_C( 1237155887585272454),
+    UINT64_C( 2035178193471487090), UINT64_C( 3592350538474428510), UINT64_C(  184443339613017823),
+    UINT64_C( 1930320082969866003), UINT64_C( 2093264054356944664), UINT64_C( 3529489814044241211),
+    UINT64_C(  765058418352087786), UINT64_C( 4331139294641859496), UINT64_C( 3369742126303465728),
+    UINT64_C( 1585988977946312062), UINT64_C(  979224835709439631), UINT64_C( 2965734562744674556),
+    UINT64_C( 1432751804325404159), UINT64_C(  241509748437302878), UINT64_C( 3487906013475575565),
+    UINT64_C( 2535061422550748591), UINT64_C( 2315378645606089562), UINT64_C( 4295875587876333751),
+    UINT64_C(  155787413762905631), UINT64_C( 4579018523369296072), UINT64_C( 2676859808255949069),
+    UINT64_C(  582088543124655278), UINT64_C( 1492270058063349872), UINT64_C( 1717910164398452271),
+    UINT64_C( 1733457760798908697), UINT64_C( 3000885903703217293), UINT64_C(  136771232223207871),
+    UINT64_C(  871015248634303721), UINT64_C( 3133051207374189676), UINT64_C( 1091914032667124918),
+    UINT64_C( 1988371081652311567), UINT64_C( 1676540994076128771), UINT64_C( 1844890970564863646),
+    UINT64_C( 1614547761626343100), UINT64_C( 4345836121639019118), UINT64_C( 1609551556682479035),
+    UINT64_C( 1032376268464898917), UINT64_C(   31368178978924605), UINT64_C( 1863841901798123565),
+    UINT64_C( 3461620215034767531), UINT64_C(  848976462686658613), UINT64_C( 3302637486092235475),
+    UINT64_C( 3959152801982309405), UINT64_C( 3279913815230309282), UINT64_C(  938436529988435272),
+    UINT64_C( 4238833680404291401), UINT64_C(  962154417381372913), UINT64_C( 3111929951370134147),
+    UINT64_C( 4083502248124438865), UINT64_C( 4048254277868242691), UINT64_C( 4382204278396839813),
+    UINT64_C( 2372127282591449080), UINT64_C( 3720690912893558875), UINT64_C( 1465721990478548967),
+    UINT64_C( 1478805904657277363), UINT64_C(  978263020579853024), UINT64_C( 1244340859032719234),
+    UINT64_C( 3395731570131024519), UINT64_C(  510806555556130508), UINT64_C(  610860530465122481),
+    UINT64_C( 3824291739522788076), UINT64_C( 1317921105431250529), UINT64_C(  245017491998479862),
+    UINT64_C( 4281658139135845856), UINT64_C( 4190969131542904529), UINT64_C( 2382342543941134407),
+    UINT64_C( 3525498332217669253), UINT64_C( 3802414016400156201), UINT64_C( 4476297656530001513),
+    UINT64_C( 1416979586047913860), UINT64_C( 2255234229238542731), UINT64_C( 2000858215069317061),
+    UINT64_C(  626297590503189450), UINT64_C( 2759501200185376495), UINT64_C( 1675895396083821476),
+    UINT64_C( 2494884684187073661), UINT64_C( 3085814807638355138), UINT64_C( 3644518137698018793),
+    UINT64_C( 4095553468289470494), UINT64_C( 4073169274230856126), UINT64_C( 3531384543848349920),
+    UINT64_C( 1642493526309612238), UINT64_C( 4163483892177191812), UINT64_C( 1362051703778680179),
+    UINT64_C(  251588547665158640), UINT64_C( 1215685474672827343), UINT64_C( 2014042211893684604),
+    UINT64_C( 1508734581979171756), UINT64_C( 4035136138076832337), UINT64_C( 4430465930968651663),
+    UINT64_C( 3507617405319098454), UINT64_C(  208179820468705139), UINT64_C(  680976407834139869),
+    UINT64_C( 2326411855819986390), UINT64_C(  565417953593608565), UINT64_C( 1799833330256075521),
+    UINT64_C( 1874612785324683517), UINT64_C(  973277973631779119), UINT64_C( 1231208399773997533),
+    UINT64_C( 4394225446772396019), UINT64_C( 3165220293337291917), UINT64_C( 2369067053942932304),
+    UINT64_C( 3903703857980723923), UINT64_C( 1330347273031060688), UINT64_C(  479588466945915912),
+    UINT64_C( 1132640057676710068), UINT64_C(  289100196167847331), UINT64_C( 1593017396740558622),
+    UINT64_C( 3354922308083637135), UINT64_C( 3114759228713443323), UINT64_C( 3381901547434642051),
+    UINT64_C(  439107495671692173), UINT64_C( 2073600855859389402), UINT64_C(  947438932901172815),
+    UINT64_C( 3469651375707344324), UINT64_C( 3518353274126681257), UINT64_C(  485491135282793681),
+    UINT64_C( 3058646478612644251), UINT64_C(  504362620832676715), UINT64_C( 4424436587380937918),
+    UINT64_C( 2914509569038348340), UINT64_C( 2672210800821325956), UINT64_C(  483306483213340640),
+    UINT64_C( 4483213694720406842), UINT64_C(  877353902278191427), UINT64_C( 1467247101221685025),
+    UINT64_C( 4266426457572698799), UINT64_C( 3941826338290054710), UINT64_C( 2462317921121052758),
+    UINT64_C( 2020727104038103695), UINT64_C(  277094405141672246), UINT64_C( 1225662781222001375),
+    UINT64_C( 3781699484200797783), UINT64_C( 1135687142661087418), UINT64_C(  166469110154211230),
+    UINT64_C(  332574684972234384), UINT64_C( 1697744173972396808), UINT64_C(  184527297125777774),
+    UINT64_C( 3624585512076324057), UINT64_C( 3446233119576757455), UINT64_C( 3078632193023835316),
+    UINT64_C(  383304783933611976), UINT64_C( 4389322720306063027), UINT64_C( 2370049507009080760),
+    UINT64_C( 1361761461888066093), UINT64_C( 3097597748165930130), UINT64_C( 1030215965054952744),
+    UINT64_C(   89901937259524008), UINT64_C( 2734815492851336383), UINT64_C( 3487492969372016186),
+    UINT64_C( 1365972863225878166), UINT64_C( 1217067112109024256), UINT64_C(  331008071283198498),
+    UINT64_C( 4154352184849207477), UINT64_C(  490079728691177042), UINT64_C( 1373290829529926976),
+    UINT64_C( 1334108140963731887), UINT64_C( 2296950020239488805), UINT64_C( 4037114839065063084),
+    UINT64_C( 2298087391389824104), UINT64_C(  706144719799758441), UINT64_C( 1084738989767016719),
+    UINT64_C( 1688292499388007393), UINT64_C(  227921074365688802), UINT64_C( 3988225595075851037),
+    UINT64_C( 3436014263075695111), UINT64_C( 1359394696637062210), UINT64_C( 4354964862091784544),
+    UINT64_C( 1854522643282304425), UINT64_C(   47240480759893108), UINT64_C( 3346221758441642400),
+    UINT64_C( 3286818059444468376), UINT64_C( 2091943141357137645), UINT64_C(  688026410288222148),
+    UINT64_C(  266453965578522078), UINT64_C( 1179317760430472932), UINT64_C( 3041380130487857690),
+    UINT64_C( 3613343733206840369), UINT64_C( 4523373017153855388), UINT64_C( 4519016613408284383),
+    UINT64_C( 1459176627240636952), UINT64_C( 2107651826156979027), UINT64_C( 2678229115631223377),
+    UINT64_C( 3481615102258042497), UINT64_C( 1302547591645079863), UINT64_C( 4396745417903152580),
+    UINT64_C( 3132167013330314154), UINT64_C(  696315246081945734), UINT64_C( 2137443489648467722),
+    UINT64_C( 1166840412541945381), UINT64_C(  260966410467664596), UINT64_C( 3540619593564635243),
+    UINT64_C( 1276609820644503207), UINT64_C( 1309825015972462495), UINT64_C( 3648113786199744239),
+    UINT64_C( 4129446904813725372), UINT64_C( 3474715846492304988), UINT64_C( 1482597879546526807),
+    UINT64_C(  432759921836399365), UINT64_C( 2236207476109945826), UINT64_C(  921226844134805204),
+    UINT64_C( 3173209563656975690), UINT64_C( 2681256057857921695), UINT64_C( 1125019699564870663),
+    UINT64_C( 2022607847542890165), UINT64_C( 3475048544167223743), UINT64_C( 2252006044808091691),
+    UINT64_C( 1743176440286758037), UINT64_C( 3681764954359946174), UINT64_C(  981071095532084396),
+    UINT64_C(   89618295979655699), UINT64_C( 1826920447323762417), UINT64_C( 2645472977297382970),
+    UINT64_C( 2152356314284504037), UINT64_C(  877056375854364479), UINT64_C( 3360262105595798472),
+    UINT64_C( 3272137543606808733), UINT64_C( 1472513635096154189), UINT64_C( 1997781625949192316),
+    UINT64_C( 1614534579931394013), UINT64_C( 4368306431450818971), UINT64_C(  378982153573495126),
+    UINT64_C( 3547866881446932766), UINT64_C( 1534399510701327249), UINT64_C( 1062980916795007280),
+    UINT64_C(  612332860768801085), UINT64_C( 3939883140197502805), UINT64_C( 3260187915165642297),
+    UINT64_C( 2457181420698271427), UINT64_C( 4413418788999735102), UINT64_C( 3941619879789496384),
+    UINT64_C( 1389764208159740173), UINT64_C( 3774394374542281825), UINT64_C( 2127246246226089471),
+    UINT64_C( 1297676028477784910), UINT64_C( 2805704277397565552), UINT64_C(  547552626336967870),
+    UINT64_C( 1675399405844500639), UINT64_C( 4578118999158733141), UINT64_C( 2722813743701629808),
+    UINT64_C(  671848929723272354), UINT64_C( 4248030908068247876), UINT64_C( 1463487423932645335),
+    UINT64_C( 2421780860294367016), UINT64_C( 1431800154381700758), UINT64_C(  206013519460792176),
+    UINT64_C( 2282986705892302649), UINT64_C(  996814958304332801), UINT64_C( 1858831409963639856),
+    UINT64_C( 2595168663386929050), UINT64_C( 1126572836870937755), UINT64_C( 1956709891719793324),
+    UINT64_C( 1864394216060531723), UINT64_C( 2553324353274824928), UINT64_C(  133184145821685010),
+    UINT64_C(  323018046560510768), UINT64_C( 3801013888712089268), UINT64_C( 3976646043879445814),
+    UINT64_C( 4506337479441810504), UINT64_C( 1759667293271595718), UINT64_C(  809983963243927422),
+    UINT64_C( 4179895444431398167), UINT64_C( 1909512407465233379), UINT64_C(  149946119270052318),
+    UINT64_C( 1429696784014473483), UINT64_C( 3184917978475901740), UINT64_C( 2047279311257772405),
+    UINT64_C( 1449569256746130422), UINT64_C( 1640823708549587678), UINT64_C( 3837830294890745113),
+    UINT64_C( 4156289026366138793), UINT64_C( 1662449655873154725), UINT64_C( 3363438344182436711),
+    UINT64_C( 1547985558326977229), UINT64_C( 1734312021333489165), UINT64_C( 4441815589208536264),
+    UINT64_C( 2122521268732846276), UINT64_C( 4006347857954613253), UINT64_C( 1332465128049927577),
+    UINT64_C( 3502872730561864502), UINT64_C( 3410557048115571723), UINT64_C( 2037633380302720167),
+    UINT64_C( 3831284048061919385), UINT64_C( 3154681298805182640), UINT64_C( 2924482324866602752),
+    UINT64_C(  618406896923799255), UINT64_C( 1093274855949974417), UINT64_C( 1539849053772316455),
+    UINT64_C( 1834229959573024403), UINT64_C( 2678799719038285260), UINT64_C( 2833295645362765934),
+    UINT64_C(  120984652424765095), UINT64_C( 4590347174107331982), UINT64_C( 1231292546388298006),
+    UINT64_C( 3776358726451765212), UINT64_C(  405715598774631321), UINT64_C(  771581980824854236),
+    UINT64_C( 3127284970748758296), UINT64_C( 4052911345250588131), UINT64_C( 3778979863626164434),
+    UINT64_C(  665248401952498592), UINT64_C(  227931364734691067), UINT64_C( 3052187898684828202),
+    UINT64_C( 3842262695106735884), UINT64_C( 1915098747908485984), UINT64_C( 2441693564009293879),
+    UINT64_C( 2570888489570115752), UINT64_C( 2501290997749770042), UINT64_C( 3845846568153344738),
+    UINT64_C( 4089323814216956058), UINT64_C( 4465598112306431653), UINT64_C( 2111054285050781485),
+    UINT64_C( 1160323589628636843), UINT64_C(  944274310408114028), UINT64_C( 2361358369003975692),
+    UINT64_C( 1850810078856814141), UINT64_C( 2684094663179899115), UINT64_C( 4235567419415590436),
+    UINT64_C( 4098536546087430514), UINT64_C(  202536063555335267), UINT64_C( 1799169842388507721),
+    UINT64_C( 3449561237629491717), UINT64_C(   52752168786994182), UINT64_C( 1674715692560252183),
+    UINT64_C( 2083803552561725751), UINT64_C( 2953819124445283744), UINT64_C( 2307982508531578249),
+    UINT64_C( 1870086954996130132), UINT64_C( 1877152863679867689), UINT64_C(  610322076670062182),
+    UINT64_C( 4542711586168647568), UINT64_C( 4316407904723576692), UINT64_C(  752670247881376625),
+    UINT64_C( 3535464716239159675), UINT64_C( 2055493099061855374), UINT64_C( 1818964933693720657),
+    UINT64_C( 4391484029099455865), UINT64_C( 3237294127365214371), UINT64_C( 3501847443227543094),
+    UINT64_C( 2669237607306606438), UINT64_C( 1518481817467565289), UINT64_C(  813085348019976937),
+    UINT64_C( 2818183610269625575), UINT64_C( 1120534607174351876), UINT64_C( 4568954096219192478),
+    UINT64_C( 1039155171907682344), UINT64_C( 3892929271204224101), UINT64_C( 3557012870941004489),
+    UINT64_C( 4188177932392580727), UINT64_C( 3704224761560595246), UINT64_C( 2348389025506101277),
+    UINT64_C( 1026577720042490999), UINT64_C( 3941366512545953573), UINT64_C( 1880435472699480520),
+    UINT64_C( 1788055398028417530), UINT64_C( 4401571916414383242), UINT64_C(  507530730249025784),
+    UINT64_C(  259327643525957150), UINT64_C( 3536008120361596082), UINT64_C( 2925678656572254158),
+    UINT64_C( 2841671314611570319), UINT64_C( 2893763264795340899), UINT64_C(   14862659715892847),
+    UINT64_C( 4115719751317650066), UINT64_C( 1709175379494813859), UINT64_C(  744505676817952400),
+    UINT64_C(  487536162258042406), UINT64_C( 3396117487884430813), UINT64_C( 4568552542522180308),
+    UINT64_C( 3159161751295827278), UINT64_C( 3037559455667103634), UINT64_C(  899421310882257990),
+    UINT64_C( 1552311879008992123), UINT64_C( 3153503871610633059), UINT64_C( 3319733127703385917),
+    UINT64_C(  788254606771569727), UINT64_C( 2469680779103036387), UINT64_C( 2866786148838575743),
+    UINT64_C( 1502961173160971999), UINT64_C( 4388115202674869049), UINT64_C( 4502812500628729457),
+    UINT64_C( 1607612296199291842), UINT64_C( 2906059885642254267), UINT64_C( 1212552879500681810),
+    UINT64_C( 1045683455419311943), UINT64_C( 2146714260958358013), UINT64_C( 1794227012515706185),
+    UINT64_C( 4246301933867698670), UINT64_C(  511292005236633552), UINT64_C( 3551780402730960870),
+    UINT64_C( 2505715927855778269), UINT64_C( 2738577070207858881), UINT64_C( 4177258725177141741),
+    UINT64_C( 1499098552694454435), UINT64_C( 3509579422672274182), UINT64_C( 4328208303007256859),
+    UINT64_C( 4164661300876465054), UINT64_C( 3178848264264571879), UINT64_C( 3210241415051035167),
+    UINT64_C( 2777183115828711728), UINT64_C(  637214865877033498), UINT64_C( 3933473744863235147),
+    UINT64_C(  731466979127336005), UINT64_C(  835732570074862627), UINT64_C( 3083464026109839675),
+    UINT64_C( 3966446232552011524), UINT64_C( 2698729730287738495), UINT64_C(  369349941221336572),
+    UINT64_C(   98765666151030067), UINT64_C( 1200363821550028156), UINT64_C(  303146497757706651),
+    UINT64_C(  995508446755282879), UINT64_C(  482975691298792303), UINT64_C( 1600016754229369899),
+    UINT64_C(  305228142147624168), UINT64_C(  655224787992504468), UINT64_C( 3611222229326003382),
+    UINT64_C( 1618902895626951218), UINT64_C( 1918893989377236774), UINT64_C(  572543380914258662),
+    UINT64_C(  410816958896292181), UINT64_C( 1635283302410543817), UINT64_C( 1979321519280662612),
+    UINT64_C( 1849662150559110766), UINT64_C( 1088301009622075512), UINT64_C( 2469931559767792320),
+    UINT64_C( 1584925295045449115), UINT64_C( 1912940964913510876), UINT64_C( 3532777341412930755),
+    UINT64_C(  686613727850228388), UINT64_C( 2165637453730303815), UINT64_C( 3749546850355899325),
+    UINT64_C( 1740988286653475439), UINT64_C(  877659710947385032), UINT64_C( 2312762693832998475),
+    UINT64_C( 2673041227939448278), UINT64_C( 1788302603633971284), UINT64_C( 1071264481991730475),
+    UINT64_C( 1743176398981010717), UINT64_C( 1823932930819020382), UINT64_C(  170960108567310191),
+    UINT64_C( 2667817646748497844), UINT64_C( 3333736386213689291), UINT64_C( 2471483719592924014),
+    UINT64_C(  871412714462055863), UINT64_C( 2577589352817978075), UINT64_C( 4185475023036704482),
+    UINT64_C( 1954246705168153798), UINT64_C( 2361640686087155182), UINT64_C(  357836038710603099),
+    UINT64_C(  804140010002609685), UINT64_C(  685616363032565509), UINT64_C( 1551229684457282409),
+    UINT64_C( 2082714474522091146), UINT64_C( 3004297030405799437), UINT64_C( 4260827143220789024),
+    UINT64_C( 4155143971580064724), UINT64_C( 1950378339134182809), UINT64_C( 3604766816394897546),
+    UINT64_C( 2450854228554719789), UINT64_C( 1566147706912213219), UINT64_C( 1477937435921982440),
+    UINT64_C( 3910033764475168842), UINT64_C(  319898891197576156), UINT64_C( 2359172028487141714),
+    UINT64_C( 3024198903909839870), UINT64_C( 3488513518549110364), UINT64_C( 2249103973839990936),
+    UINT64_C(  260943941076539171), UINT64_C( 3001760515997345126), UINT64_C( 1852163044422187905),
+    UINT64_C(   72303868944738220), UINT64_C( 2414901465620074863), UINT64_C( 1781021219997870157),
+    UINT64_C( 1446311743528964143), UINT64_C( 2822382757641299168), UINT64_C( 4297381624151009309),
+    UINT64_C( 2555440386528230587), UINT64_C( 4607422217046930184), UINT64_C( 2523507258974137450),
+    UINT64_C(  586576035178648987), UINT64_C( 4516913466356350528), UINT64_C( 3953798807530909336),
+    UINT64_C(  311287007747775527), UINT64_C( 2178364526979483139), UINT64_C( 2436557758325670652),
+    UINT64_C(  732788375174647496), UINT64_C( 4050021673706031143), UINT64_C( 2046188506347020487),
+    UINT64_C( 1824532051640333034), UINT64_C( 1810013073888913648), UINT64_C( 2510248918026118005),
+    UINT64_C( 3814193870696449291), UINT64_C( 2551547626852230511), UINT64_C( 3228466835010095449),
+    UINT64_C( 2760266801100815101), UINT64_C(  237420505140017849), UINT64_C( 4455859642848635784),
+    UINT64_C( 1194264381024739471), UINT64_C( 3847442746631182846), UINT64_C(  261103275488158652),
+    UINT64_C( 4075036490232647886), UINT64_C( 3364693870687963252), UINT64_C( 1599336588606069042),
+    UINT64_C( 2141353050767097805), UINT64_C( 4364180315313213868), UINT64_C( 2279548975956651339),
+    UINT64_C( 4181165216863241543), UINT64_C(  822496120599602391), UINT64_C( 3216398166667142492),
+    UINT64_C( 1414996654632579535), UINT64_C(  399153121717845652), UINT64_C( 4548081846662005896),
+    UINT64_C( 2793081084263874275), UINT64_C( 3561942386313880563), UINT64_C( 3424152817620763650),
+    UINT64_C(  476664612668647004), UINT64_C( 1492741357398842352), UINT64_C( 4034837027261059818),
+    UINT64_C( 3653542849105545164), UINT64_C( 1199393192324884232), UINT64_C( 3103372325270731626),
+    UINT64_C( 2031093248427668510), UINT64_C( 4003544480710139205), UINT64_C( 4139305653044751572),
+    UINT64_C( 1871210569584502341), UINT64_C( 1447511463968469566), UINT64_C( 4342773087883220453),
+    UINT64_C(  714011629040165201), UINT64_C( 1483381452456830948), UINT64_C(  604863364789061001),
+    UINT64_C( 2553771298592132344), UINT64_C( 1182808904748102976), UINT64_C( 3012628992752949016),
+    UINT64_C( 1570260593000772468), UINT64_C( 2924973712386175354), UINT64_C( 2179966804895415034),
+    UINT64_C( 1951044379988462048), UINT64_C( 2106276727505387662), UINT64_C( 4165508039368450800),
+    UINT64_C( 1676974938564726196), UINT64_C( 1409836371636540326), UINT64_C( 2045101705001264320),
+    UINT64_C( 1664777915431904754), UINT64_C(  437025389401016125), UINT64_C(  668319108584396841),
+    UINT64_C( 4068847243005682054), UINT64_C( 1539912810649586905), UINT64_C( 1362452282111165124),
+    UINT64_C( 1395180116325533233), UINT64_C(  539515275914945526), UINT64_C(   32816406908475677),
+    UINT64_C( 1498631754262487511), UINT64_C( 4139024412514936773), UINT64_C( 1499519613120740162),
+    UINT64_C( 3622207101292713045), UINT64_C(  584328307393442377), UINT64_C( 4448611583831429864),
+    UINT64_C( 1038796876384025326), UINT64_C( 1735423832482929377), UINT64_C( 1025542599384871972),
+    UINT64_C(  357180834850210256), UINT64_C( 3599913488343922077), UINT64_C( 2645862174562073893),
+    UINT64_C( 2653290719935361111), UINT64_C( 2391061745240172347), UINT64_C( 4298553952213081265),
+    UINT64_C( 4393558504980386242), UINT64_C(  913007192269542546), UINT64_C( 3729200025137926407),
+    UINT64_C( 2553634168717201491), UINT64_C( 4102631858503059747), UINT64_C( 2695874774151910019),
+    UINT64_C( 2747616796397379828), UINT64_C(  610903046880562634), UINT64_C( 3826124913679203723),
+    UINT64_C( 4536483755510381051), UINT64_C( 1070997145059444159), UINT64_C( 1731016064480004168),
+    UINT64_C(  312851574268946147), UINT64_C( 2746805877370733560), UINT64_C( 2995300680710204974),
+    UINT64_C( 3276766684535628901), UINT64_C(  558822624855705108), UINT64_C( 4057677698319368500),
+    UINT64_C( 3637705240106523576), UINT64_C( 2890764471011131908), UINT64_C(  894318522492477872),
+    UINT64_C( 2270834688869068665), UINT64_C( 1961524677183397552), UINT64_C(   13662800517217680),
+    UINT64_C( 1134397934346836952), UINT64_C( 1839325932449358448), UINT64_C( 2345038417847300195),
+    UINT64_C( 2894353089791485731), UINT64_C(  659129734563606006), UINT64_C( 4097512091411382626),
+    UINT64_C( 1974174183043521424), UINT64_C( 3206158260706639828), UINT64_C( 3146184221526737553),
+    UINT64_C( 3856733760376929266), UINT64_C( 3923461195195202147), UINT64_C( 3793143894297619789),
+    UINT64_C(  110431127623859296), UINT64_C( 2759042918974896475), UINT64_C(   59959457052448080),
+    UINT64_C( 3354000371513030063), UINT64_C( 3521841953642697951), UINT64_C(  393025094498857442),
+    UINT64_C( 3057359436851267693), UINT64_C( 2929679524939121891), UINT64_C( 4043198658093728562),
+    UINT64_C(  104240754812533046), UINT64_C( 1357545964148577825), UINT64_C( 2787605343977851515),
+    UINT64_C( 2448680636743494489), UINT64_C( 2327651778635346672), UINT64_C( 3048365156366483007),
+    UINT64_C( 2865265359655330130), UINT64_C( 1890999184460584081), UINT64_C(   53053828199897781),
+    UINT64_C( 3755635344528493813), UINT64_C( 2767313409789611653), UINT64_C(  302670398992826200),
+    UINT64_C(  102044630754792870), UINT64_C(  237972493562463015), UINT64_C(  795344975299056214),
+    UINT64_C( 3001382115563549860), UINT64_C( 3118579606097479139), UINT64_C( 1938499773309054930),
+    UINT64_C( 2861318728846860930), UINT64_C( 3267071253054243662), UINT64_C(  884312128561024297),
+    UINT64_C( 3156002396298853836), UINT64_C(  590947254348965378), UINT64_C(  570670718702250248),
+    UINT64_C( 2213462601823254413), UINT64_C(  352984643773498719), UINT64_C( 3611847407109459101),
+    UINT64_C(   22433228726183226), UINT64_C( 1241315471063433917), UINT64_C( 2852974886317606458),
+    UINT64_C( 2402010846586661785), UINT64_C( 4052690531269210339), UINT64_C(  503343524324188877),
+    UINT64_C( 2071352341820874413), UINT64_C( 1133257745966048282), UINT64_C( 2768028438003859349),
+    UINT64_C(   30238743627571808), UINT64_C( 4307555974418011194), UINT64_C(  144886118722786874),
+    UINT64_C( 1553962591877364639), UINT64_C( 3923524735499515412), UINT64_C( 3539197463387207563),
+    UINT64_C( 2036943936725808288), UINT64_C( 2611298768820915691), UINT64_C( 2340815835249833713),
+    UINT64_C( 1166973459441709726), UINT64_C( 1949948367453176090), UINT64_C( 2241272674007387627),
+    UINT64_C( 1709817511219879384), UINT64_C( 3002206030065622091), UINT64_C( 3094814899163519183),
+    UINT64_C( 1863881746643431039), UINT64_C( 2258851540068175314), UINT64_C(  639322136243055088),
+    UINT64_C( 4468524568903294928), UINT64_C( 1832182905397381471), UINT64_C( 2073889272417520864),
+    UINT64_C(  834185947168345360), UINT64_C( 2128476962744011646), UINT64_C( 4547976843320098925),
+    UINT64_C( 3841984086170630355), UINT64_C( 1101758762118523168), UINT64_C( 3895923827948357863),
+    UINT64_C( 4587689110676858377), UINT64_C( 4443473892469001069), UINT64_C( 1184901126125065503),
+    UINT64_C( 3421884282926540642), UINT64_C( 2188961466126034081), UINT64_C( 1954954601816045362),
+    UINT64_C( 2605643716960091225), UINT64_C( 3664872022312435044), UINT64_C(  300727895868192748),
+    UINT64_C( 1040247579802031329), UINT64_C(  259157089942080629), UINT64_C( 1735821994432452524),
+    UINT64_C( 1071827969325616041), UINT64_C(  300325005450496587), UINT64_C( 1678022887017005273),
+    UINT64_C( 3390501777138496659), UINT64_C( 3800355942214640753), UINT64_C( 1643252510097770258),
+    UINT64_C(  698190819141775972), UINT64_C( 3829725965221175714), UINT64_C( 2005784150611880513),
+    UINT64_C( 1475819125669281104), UINT64_C( 1732426745547169256), UINT64_C( 2322921443405794831),
+    UINT64_C( 3340179081683457083), UINT64_C( 3028216316706702180), UINT64_C(  285905407408422553),
+    UINT64_C( 1660319910205323660), UINT64_C( 2896550676561137784), UINT64_C( 2257676497704087716),
+    UINT64_C( 1985703776908265144), UINT64_C( 1815552859295327999), UINT64_C( 1353543003314858370),
+    UINT64_C( 1223121600731494170), UINT64_C(                   0), UINT64_C(12056949092800237063),
+    UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410), UINT64_C(16095585161216792975),
+    UINT64_C( 5044858856783534954), UINT64_C(  935015860473793947), UINT64_C(10704841052939819994),
+    UINT64_C(14823511509961865041), UINT64_C(10837856322613628300), UINT64_C( 3527826048668878276),
+    UINT64_C( 9562219288038263513), UINT64_C( 6801747814650478768), UINT64_C( 8186794253328016406),
+    UINT64_C( 3770047066528861307), UINT64_C(13817741599934505432), UINT64_C( 8272674114655418646),
+    UINT64_C( 6636974752260600928), UINT64_C(12070056983459514179), UINT64_C( 4645877627644259550),
+    UINT64_C(  524524789911762958), UINT64_C(14685068185283478013), UINT64_C(15958330216678504264),
+    UINT64_C( 7518592205968233530), UINT64_C( 9300257820891667993), UINT64_C( 7403630015146204752),
+    UINT64_C(15606678242288721550), UINT64_C( 5629106033785832752), UINT64_C(13700435474456645115),
+    UINT64_C(  939236246125912135), UINT64_C( 3663876260517275405), UINT64_C(15890526987243620945),
+    UINT64_C(18363187131404708859), UINT64_C(14204288525935746332), UINT64_C( 9748677097063844747),
+    UINT64_C( 5022945591500869479), UINT64_C(15478691441689093085), UINT64_C(13454734720994210547),
+    UINT64_C(12970158159567782300), UINT64_C( 9870433017619998234), UINT64_C(15323230751358392006),
+    UINT64_C(13508975171084961660), UINT64_C(17008713017796795127), UINT64_C( 2771923343720792784),
+    UINT64_C(15545093430797142494), UINT64_C( 7441811111581718715), UINT64_C( 8488069535807066230),
+    UINT64_C( 7480107884525257642), UINT64_C(10760032883403366612), UINT64_C( 3392776274373824360),
+    UINT64_C(16223430760769901807), UINT64_C( 5929482543053587160), UINT64_C( 9999053415530750839),
+    UINT64_C(12449341400208309288), UINT64_C( 3082018651885430046), UINT64_C( 9968757564490533415),
+    UINT64_C(13485945174540913643), UINT64_C( 4177604586827430670), UINT64_C( 4875079671801458261),
+    UINT64_C(17772190152077797184), UINT64_C(10629753139159135763), UINT64_C(  557960310548722281),
+    UINT64_C( 5390052140868347301), UINT64_C( 8374169019430200033), UINT64_C(16180954858396087424),
+    UINT64_C( 7073441495741033812), UINT64_C( 4531945126003614861), UINT64_C( 4581692930448803892),
+    UINT64_C(12693002747400477502), UINT64_C(15661714981525014251), UINT64_C( 1549634253303188093),
+    UINT64_C(  795028493834076427), UINT64_C( 1305369207991983600), UINT64_C( 3866536531466683071),
+    UINT64_C(17320848506065100368), UINT64_C(10882197785983543072), UINT64_C( 2378088898928169980),
+    UINT64_C(10376839016181397876), UINT64_C(17484831985982624781), UINT64_C(14498363592526867533),
+    UINT64_C( 3699304671320783718), UINT64_C(12861782840510144670), UINT64_C( 2131574955856399208),
+    UINT64_C( 1025978483713168327), UINT64_C(15353062762322865644), UINT64_C( 8252238387093709242),
+    UINT64_C( 6440255585648176779), UINT64_C( 4421013741595730431), UINT64_C( 1096610553773161688),
+    UINT64_C( 6545861174197572826), UINT64_C(10872822215124667463), UINT64_C(11783439202461196635),
+    UINT64_C( 2385024958896746858), UINT64_C(17369516751451888769), UINT64_C( 3283009077575642824),
+    UINT64_C(  788773449283363516), UINT64_C(16039538274196874157), UINT64_C( 1059934365190267585),
+    UINT64_C(12908748873725960096), UINT64_C( 7505153196371828040), UINT64_C(13039109273954694652),
+    UINT64_C(  311650362020626222), UINT64_C(11526461319678639460), UINT64_C(17303987744167040597),
+    UINT64_C( 5952147050561432186), UINT64_C( 6917212468786927852), UINT64_C(10873224313681512109),
+    UINT64_C(15519682344957746721), UINT64_C( 9118791839529518139), UINT64_C(13963486138935630568),
+    UINT64_C( 4475772722859079995), UINT64_C( 3810508832414219537), UINT64_C( 4495506554501186747),
+    UINT64_C(11206654282706656445), UINT64_C( 2741600703405278016), UINT64_C( 1543083031633856797),
+    UINT64_C(  854137335714707916), UINT64_C( 3476695533994548434), UINT64_C(11800645485649669227),
+    UINT64_C( 5200842723427622792), UINT64_C(17567959471736915475), UINT64_C( 9673016006498685746),
+    UINT64_C( 7882823365203995373), UINT64_C( 8298327092713519831), UINT64_C( 8248728081686549269),
+    UINT64_C( 4025410504784720247), UINT64_C(   53027213440924003), UINT64_C(  461169995765932576),
+    UINT64_C(17591714041449082671), UINT64_C( 9968029947273057815), UINT64_C( 6543765375770076288),
+    UINT64_C( 2639681960449907978), UINT64_C( 4969161675331233633), UINT64_C( 6607473285056421255),
+    UINT64_C( 5920132444702412610), UINT64_C(11316930621535193020), UINT64_C(17392144101620672248),
+    UINT64_C( 6950795527915050192), UINT64_C(10371518997718156574), UINT64_C(10622473298289909284),
+    UINT64_C(18236458769399661608), UINT64_C( 8023190261630392515), UINT64_C(10949120766879761863),
+    UINT64_C(  321258353817470781), UINT64_C(11565803673056906512), UINT64_C( 3970765379799260900),
+    UINT64_C(  519243668578310200), UINT64_C( 2783090654961380186), UINT64_C( 8564489954378429807),
+    UINT64_C( 7319294368875455069), UINT64_C(10751118631995671312), UINT64_C( 2537190792027621301),
+    UINT64_C(16024157607726461142), UINT64_C(15063437242703570969), UINT64_C(10964969827720034861),
+    UINT64_C(11888728375223892849), UINT64_C( 6210088696389294386), UINT64_C( 4215584393657131024),
+    UINT64_C( 3807710096486065111), UINT64_C(15539449267741275110), UINT64_C(17063746427376064836),
+    UINT64_C(11345110729558017594), UINT64_C( 3189191896661910410), UINT64_C(11793435634082451524),
+    UINT64_C(14149328764061573648), UINT64_C(17714177090965904433), UINT64_C( 9379350031379565491),
+    UINT64_C( 1161365655305589260), UINT64_C( 6476077475534711122), UINT64_C( 1470840994654283480),
+    UINT64_C(17531041394046458963), UINT64_C(17159814169809758949), UINT64_C( 3267115454208414131),
+    UINT64_C( 8237529382254686174), UINT64_C( 6344135347345683345), UINT64_C(16140506472986348266),
+    UINT64_C(14150460357275822369), UINT64_C(14390319241434363093), UINT64_C( 7670031648500858558),
+    UINT64_C(17082266855006719086), UINT64_C( 9278499731587959531), UINT64_C( 4394342138638275529),
+    UINT64_C(  819585434212381271), UINT64_C( 3765903746025108887), UINT64_C(11337322928032803032),
+    UINT64_C(13080675063835488736), UINT64_C( 3781539743790695007), UINT64_C( 7491448803264988693),
+    UINT64_C(16831094245963614355), UINT64_C(14656129054190166051), UINT64_C(  936166740933033792),
+    UINT64_C( 8310393855344440966), UINT64_C(10487169474399915347), UINT64_C( 3970542096867280507),
+    UINT64_C( 1555010984183863935), UINT64_C(16412071153753638257), UINT64_C( 3172978149511685375),
+    UINT64_C(12999870972329895437), UINT64_C(10155112748119555389), UINT64_C(14922703530856633565),
+    UINT64_C( 5912670226056224838), UINT64_C(18176687840881555628), UINT64_C( 3068156232798275191),
+    UINT64_C( 2479959339141346850), UINT64_C( 8803131986562446677), UINT64_C(15142608226500847568),
+    UINT64_C( 6530988684136536054), UINT64_C(12344888121779638533), UINT64_C( 6333410354478878381),
+    UINT64_C( 3608762760598285911), UINT64_C(14780950571222436065), UINT64_C(14555047047361242149),
+    UINT64_C(  872608656828928266), UINT64_C(11615029927461391060), UINT64_C(16542916448154141504),
+    UINT64_C(  601324993980182841), UINT64_C( 3838793860466319591), UINT64_C(16444609083007748892),
+    UINT64_C( 6118270360949384774), UINT64_C(14372054492503594768), UINT64_C( 3491598857544930719),
+    UINT64_C( 8886449909830682420), UINT64_C( 9248524634501061960), UINT64_C(11759901578089697684),
+    UINT64_C( 3702864191111446583), UINT64_C(16432311755922067923), UINT64_C( 8898115076940412253),
+    UINT64_C(16888525546311936260), UINT64_C( 1097344932148957668), UINT64_C(12688264603134112379),
+    UINT64_C(10387204097729262679), UINT64_C(  197273935104393427), UINT64_C( 8856853734920706443),
+    UINT64_C(13482461935711286302), UINT64_C( 9233368836610809262), UINT64_C( 1789715612861379618),
+    UINT64_C( 9676124438746293817), UINT64_C(14728510627181674741), UINT64_C(14885559721030270348),
+    UINT64_C( 7370462449473453990), UINT64_C( 1054550973629380135), UINT64_C(10491458060616351836),
+    UINT64_C(  347876932367493747), UINT64_C(18167820998420103977), UINT64_C(16091071015128687689),
+    UINT64_C(17437301007334629297), UINT64_C(14864663113733128514), UINT64_C(15065258283318028178),
+    UINT64_C(  500661425114548745), UINT64_C( 7396643017915243258), UINT64_C(11893316251598238776),
+    UINT64_C( 4206878692201856385), UINT64_C(18229139094109548769), UINT64_C(16547071473305671052),
+    UINT64_C( 4633466802283352697), UINT64_C(17407027603865055777), UINT64_C( 9602846956479447923),
+    UINT64_C(16642113286809151228), UINT64_C( 6376862649565533805), UINT64_C(17915016298027692154),
+    UINT64_C(14470096555450574343), UINT64_C(15864413509363240641), UINT64_C(10747217473793532729),
+    UINT64_C(10905297447288144061), UINT64_C( 3939402899076868167), UINT64_C(13945232710941063247),
+    UINT64_C( 8675113891999301343), UINT64_C( 3108156558539612522), UINT64_C(18368333938429795364),
+    UINT64_C(13710478091613637420), UINT64_C(12401504102449096566), UINT64_C( 3671177558198870464),
+    UINT64_C( 3607439390457286989), UINT64_C( 5785284834068479863), UINT64_C(15102524632494762308),
+    UINT64_C(12064813699278939161), UINT64_C( 1887599300156476464), UINT64_C( 9467468822029328010),
+    UINT64_C( 4563935455468076809), UINT64_C( 3926495866587298520), UINT64_C( 3292228085055616561),
+    UINT64_C(14467920957679420804), UINT64_C( 2261616490505124707), UINT64_C(15824546467527834495),
+    UINT64_C( 7336887022054615054), UINT64_C( 4253512507409266577), UINT64_C(15876439695440582360),
+    UINT64_C(12750410154721500074), UINT64_C( 9290912606262456587), UINT64_C(   77515901797299646),
+    UINT64_C(18422282258182957116), UINT64_C( 6152375959768026464), UINT64_C( 8849439785483709399),
+    UINT64_C( 7800384383729364671), UINT64_C( 8808085392561101057), UINT64_C(10946872264133666568),
+    UINT64_C( 6512734330744205793), UINT64_C(12596053436503882636), UINT64_C(16198056512885989147),
+    UINT64_C(12580089363017589374), UINT64_C(11278357194196069992), UINT64_C(14673893254291298962),
+    UINT64_C(16960425789927278755), UINT64_C(10969861733074502397), UINT64_C( 5986079315466035276),
+    UINT64_C( 9817439620703570771), UINT64_C(14816598902352938915), UINT64_C( 7124707266952677798),
+    UINT64_C( 1551597112537180207), UINT64_C( 2174659133622257154), UINT64_C(14149388754851666868),
+    UINT64_C( 6316949314195301248), UINT64_C( 2429349674943213890), UINT64_C( 4960775307004705376),
+    UINT64_C( 4948623550341113988), UINT64_C( 8140712773885988125), UINT64_C(14369402153897784231),
+    UINT64_C(  737773358452074895), UINT64_C( 7721280331879501728), UINT64_C( 8373056217427819556),
+    UINT64_C(14117959256177033806), UINT64_C( 3060233673408366092), UINT64_C(17324557178567522610),
+    UINT64_C(13478968505213928753), UINT64_C( 6343955911785279236), UINT64_C( 3916899342837777657),
+    UINT64_C(11862938250978756171), UINT64_C( 5731007217301644630), UINT64_C(  966038993749216230),
+    UINT64_C(13951624053902370410), UINT64_C(10140245690203043896), UINT64_C( 9261514582424403488),
+    UINT64_C(17183502351505418941), UINT64_C(  623149655051625567), UINT64_C(18316074093477273757),
+    UINT64_C(10707439233023848579), UINT64_C( 2328354172498632485), UINT64_C( 5969080232253428645),
+    UINT64_C( 6871640657593842650), UINT64_C( 6933831043195668658), UINT64_C(12003543614812927806),
+    UINT64_C(  547084928892834156), UINT64_C( 3484060994537231902), UINT64_C(12532204829496819920),
+    UINT64_C( 4367656130668521006), UINT64_C( 7953484326609285118), UINT64_C( 6706163976304547842),
+    UINT64_C( 7379563882259490631), UINT64_C( 6458191046505403946), UINT64_C(17383344486556161385),
+    UINT64_C( 6438206226729947589), UINT64_C( 4129505073859615839), UINT64_C(  125472715915699032),
+    UINT64_C( 7455367607192530677), UINT64_C(13846480860139137760), UINT64_C( 3395905850746651040),
+    UINT64_C(13210549944369006430), UINT64_C(15836611207929314978), UINT64_C(13119655260921301214),
+    UINT64_C( 3753746119953759424), UINT64_C(16955334721617248426), UINT64_C( 3848617669525510451),
+    UINT64_C(12447719805480597392), UINT64_C(16334008992497835247), UINT64_C(16193017111473049863),
+    UINT64_C(17528817113587444876), UINT64_C( 9488509130365842669), UINT64_C(14882763651574308198),
+    UINT64_C( 5862887961914224506), UINT64_C( 5915223618629138346), UINT64_C( 3913052082319431210),
+    UINT64_C( 4977363436130901249), UINT64_C(13582926280524164425), UINT64_C( 2043226222224532012),
+    UINT64_C( 2443442121860501859), UINT64_C(15297166958091227027), UINT64_C( 5271684421725027866),
+    UINT64_C(  980069967993924235), UINT64_C(17126632556543467083), UINT64_C(16763876526171700003),
+    UINT64_C( 9529370175764584176), UINT64_C(14101993328870745896), UINT64_C(15209656065600699099),
+    UINT64_C(17905190626120093514), UINT64_C( 5667918344191683126), UINT64_C( 9020936916954214989),
+    UINT64_C( 8003432860277307338), UINT64_C( 2505190362012770037), UINT64_C(11038004800741559898),
+    UINT64_C( 6703581584335318649), UINT64_C( 9979538736748343391), UINT64_C(12343259230553480845),
+    UINT64_C(14578072550792146382), UINT64_C(16382213873157961999), UINT64_C(16292677096923504089),
+    UINT64_C(14125538175393468679), UINT64_C( 6569974105238481044), UINT64_C(16653935568708848598),
+    UINT64_C( 5448206815114747329), UINT64_C( 1006354190660639475), UINT64_C( 4862741898691333125),
+    UINT64_C( 8056168847574777768), UINT64_C( 6034938327916716503), UINT64_C(16140544552307408190),
+    UINT64_C(17721863723874693219), UINT64_C(14030469621276462351), UINT64_C(  832719281874824623),
+    UINT64_C( 2723905631336572781), UINT64_C( 9305647423279991015), UINT64_C( 2261671814374445307),
+    UINT64_C( 7199333321024337251), UINT64_C( 7498451141298770696), UINT64_C( 3893111894527135492),
+    UINT64_C( 4924833599096014188), UINT64_C(17576901787089669935), UINT64_C(12660881173349229513),
+    UINT64_C( 9476268215771775505), UINT64_C(15614815431922971966), UINT64_C( 5321389092124268745),
+    UINT64_C( 1918353867783673018), UINT64_C( 4530560230706862402), UINT64_C( 1156400784671394972),
+    UINT64_C( 6372069586962265614), UINT64_C(13419689232334614092), UINT64_C(12459036914853834151),
+    UINT64_C(13527606189738634283), UINT64_C( 1756429982686777271), UINT64_C( 8294403423437598124),
+    UINT64_C( 3789755731604709772), UINT64_C(13878605502829445089), UINT64_C(14073413096506793773),
+    UINT64_C( 1941964541131184210), UINT64_C(12234585914450636767), UINT64_C( 2017450483330716714),
+    UINT64_C(17697746349523838121), UINT64_C(11658038276153450306), UINT64_C(10688843203285356036),
+    UINT64_C( 1933225932853372003), UINT64_C(17932854778881714965), UINT64_C( 3509415609112782850),
+    UINT64_C( 5868988404886768768), UINT64_C(17065705830290878557), UINT64_C(15767305353160295859),
+    UINT64_C( 9849271684484259143), UINT64_C( 8082908416152454263), UINT64_C( 1108377620566694398),
+    UINT64_C( 4902651124888029448), UINT64_C(15126797936803265022), UINT64_C( 4542748570644371862),
+    UINT64_C(  665876440616848172), UINT64_C( 1330298739888944034), UINT64_C( 6790976695889620404),
+    UINT64_C(  738109188503114701), UINT64_C(14498342048305367048), UINT64_C(13784932478307097156),
+    UINT64_C(12314528772095401417), UINT64_C( 1533219135734455393), UINT64_C(17557290881224337871),
+    UINT64_C( 9480198028036369348), UINT64_C( 5447045847552290979), UINT64_C(12390390992663781044),
+    UINT64_C( 4120863860219831105), UINT64_C(  359607749038097788), UINT64_C(10939261971405398967),
+    UINT64_C(13949971877488132886), UINT64_C( 5463891452903539353), UINT64_C( 4868268448436120804),
+    UINT64_C( 1324032285132800459), UINT64_C(16617408739396911080), UINT64_C( 1960318914764717743),
+    UINT64_C( 5493163318119734736), UINT64_C( 5336432563854953615), UINT64_C( 9187800080958000100),
+    UINT64_C(16148459356260331217), UINT64_C( 9192349565559341318), UINT64_C( 2824578879199047561),
+    UINT64_C( 4338955959068088070), UINT64_C( 6753169997552062559), UINT64_C(  911684297462759661),
+    UINT64_C(15952902380303482074), UINT64_C(13744057052302847580), UINT64_C( 5437578786548275401),
+    UINT64_C(17419859448367223267), UINT64_C( 7418090573129253935), UINT64_C(  188961923039573355),
+    UINT64_C(13384887033766634982), UINT64_C(13147272237777937725), UINT64_C( 8367772565428591454),
+    UINT64_C( 2752105641152902035), UINT64_C( 1065815862314093518), UINT64_C( 4717271041721914770),
+    UINT64_C(12165520521951490185), UINT64_C(14453374932827432077), UINT64_C(18093492068615509934),
+    UINT64_C(18076066453633225829), UINT64_C( 5836706508962576318), UINT64_C( 8430607304627957289),
+    UINT64_C(10712916462524945838), UINT64_C(13926460409032238015), UINT64_C( 5210190366580344902),
+    UINT64_C(17586981671612696228), UINT64_C(12528668053321317815), UINT64_C( 2785260984327796541),
+    UINT64_C( 8549773958593912651), UINT64_C( 4667361650167804322), UINT64_C( 1043865641870663483),
+    UINT64_C(14162478374258610152), UINT64_C( 5106439282578037771), UINT64_C( 5239300063889875572),
+    UINT64_C(14592455144799048236), UINT64_C(16517787619254982173), UINT64_C(13898863385969287844),
+    UINT64_C( 5930391518186136196), UINT64_C( 1731039687345605915), UINT64_C( 8944829904439826997),
+    UINT64_C( 3684907376539238815), UINT64_C(12692838254627964761), UINT64_C(10725024231431739169),
+    UINT64_C( 4500078798259504633), UINT64_C( 8090431390171600179), UINT64_C(13900194176668962871),
+    UINT64_C( 9008024179232410766), UINT64_C( 6972705761147066208), UINT64_C(14727059817439856634),
+    UINT64_C( 3924284382128356753), UINT64_C(  358473183918624547), UINT64_C( 7307681789295085364),
+    UINT64_C(10581891909189583570), UINT64_C( 8609425257138058203), UINT64_C( 3508225503417475052),
+    UINT64_C(13441048422383259544), UINT64_C(13088550174427298866), UINT64_C( 5890054540384645527),
+    UINT64_C( 7991126503796808298), UINT64_C( 6458138319725607598), UINT64_C(17473225725803361236),
+    UINT64_C( 1515928614293987908), UINT64_C(14191467525787800385), UINT64_C( 6137598042805338976),
+    UINT64_C( 4251923667180049889), UINT64_C( 2449331443075216304), UINT64_C(15759532560790088201),
+    UINT64_C(13040751660662632889), UINT64_C( 9828725682793133719), UINT64_C(17653675155999026642),
+    UINT64_C(15766479519158062551), UINT64_C( 5559056832638987846), UINT64_C(15097577498169201048),
+    UINT64_C( 8508984984904399448), UINT64_C( 5190704113911164995), UINT64_C(11222817109590317028),
+    UINT64_C( 2190210505347882178), UINT64_C( 6701597623378035291), UINT64_C(18312475996635022016),
+    UINT64_C(10891254974806572433), UINT64_C( 2687395718893102543), UINT64_C(16992123632273074506),
+    UINT64_C( 5853949695730609935), UINT64_C( 9687123441177515383), UINT64_C( 5727200617526831008),
+    UINT64_C(  824054077843172729), UINT64_C( 9131946823569255203), UINT64_C( 3987259833217350680),
+    UINT64_C( 7435325639854595743), UINT64_C(10380674653547766907), UINT64_C( 4506291347483773032),
+    UINT64_C( 7826839566879211528), UINT64_C( 7457576864242163320), UINT64_C(10213297413099349601),
+    UINT64_C(  532736583286742642), UINT64_C( 1292072186242049383), UINT64_C(15204055554848431340),
+    UINT64_C(15906584175517860955), UINT64_C(18025349917767330065), UINT64_C( 7038669173086417254),
+    UINT64_C( 3239935852975725514), UINT64_C(16719581777725674339), UINT64_C( 7638049629860970826),
+    UINT64_C(  599784477080212201), UINT64_C( 5718787136057921866), UINT64_C(12739671913903669190),
+    UINT64_C( 8189117245031129621), UINT64_C( 5798277026984550011), UINT64_C( 6563294834198382772),
+    UINT64_C(15351321179563055439), UINT64_C(16625156105464636381), UINT64_C( 6649798623492651382),
+    UINT64_C(13453753376729812562), UINT64_C( 6191942233307939162), UINT64_C( 6937248085333990546),
+    UINT64_C(17767262356834231844), UINT64_C( 8490085074931426576), UINT64_C(16025391431818531292),
+    UINT64_C( 5329860512199736343), UINT64_C(14011490922247526450), UINT64_C(13642228192462353531),
+    UINT64_C( 8150533521210920481), UINT64_C(15325136192247752399), UINT64_C(12618725195220792199),
+    UINT64_C(11697929299466468149), UINT64_C( 2473627587695209103), UINT64_C( 4373099423799919029),
+    UINT64_C( 6159396215089295907), UINT64_C( 7336919838292133451), UINT64_C(10715198876153193381),
+    UINT64_C(11333182581451119095), UINT64_C(  483938609699062743), UINT64_C(18361388696429417619),
+    UINT64_C( 4925170185553216082), UINT64_C(15105434905807134634), UINT64_C( 1622862395098533211),
+    UINT64_C( 3086327923299432019), UINT64_C(12509139882995094288), UINT64_C(16211645381002431714),
+    UINT64_C(15115919454504731573), UINT64_C( 2660993607810007366), UINT64_C(  911725458938768721),
+    UINT64_C(12208751594739372444), UINT64_C(15369050780427018610), UINT64_C( 7660394991633981355),
+    UINT64_C( 9766774256037223224), UINT64_C(10283553958280513240), UINT64_C(10005163990999129040),
+    UINT64_C(15383386272613454096), UINT64_C(16357295256867904133), UINT64_C(17862392449225813865),
+    UINT64_C( 8444217140203167188), UINT64_C( 4641294358514570043), UINT64_C( 3777097241632474562),
+    UINT64_C( 9445433476015948906), UINT64_C( 7403240315427292727), UINT64_C(10736378652719648904),
+    UINT64_C(16942269677662444502), UINT64_C(16394146184349802137), UINT64_C(  810144254221345025),
+    UINT64_C( 7196679369554066038), UINT64_C(13798244950518034269), UINT64_C(  211008675147977758),
+    UINT64_C( 6698862770241041454), UINT64_C( 8335214210246943719), UINT64_C(11815276497781192690),
+    UINT64_C( 9231930034126358091), UINT64_C( 7480347819984557067), UINT64_C( 7508611454719507433),
+    UINT64_C( 2441288306680260653), UINT64_C(18170846344674679032), UINT64_C(17265631618894391106),
+    UINT64_C( 3010680991525521206), UINT64_C(14141858864956707779), UINT64_C( 8221972396247461658),
+    UINT64_C( 7275859734774918168), UINT64_C(17565936116397909265), UINT64_C(12949176509460920737),
+    UINT64_C(14007389772910240798), UINT64_C(10676950429226477906), UINT64_C( 6073927269870290825),
+    UINT64_C( 3252341392079923634), UINT64_C(11272734441078557364), UINT64_C( 4482138428697429398),
+    UINT64_C(18275816384876859185), UINT64_C( 4156620687630749680), UINT64_C(15571717084816972468),
+    UINT64_C(14228051483764087456), UINT64_C(16752711729570404741), UINT64_C(14816899046242453361),
+    UINT64_C( 9393556102024450993), UINT64_C( 4106310880169984054), UINT64_C(15765466050183891302),
+    UINT64_C( 7521741890797958821), UINT64_C( 7152221592113705056), UINT64_C(17606287665657618970),
+    UINT64_C( 2030122920996113052), UINT64_C( 1037310574103833667), UINT64_C(14144032481446453418),
+    UINT64_C(11702714626289073797), UINT64_C(11366685258446336799), UINT64_C(11575053059181420137),
+    UINT64_C(   59450638863571678), UINT64_C(16462879005270680681), UINT64_C( 6836701517979288831),
+    UINT64_C( 2978022707271824146), UINT64_C( 1950144649032179149), UINT64_C(13584469951537789608),
+    UINT64_C(18274210170088810497), UINT64_C(12636647005183370839), UINT64_C(12150237822668473887),
+    UINT64_C( 3597685243529049533), UINT64_C( 6209247516035998822), UINT64_C(12614015486442593852),
+    UINT64_C(13278932510813608532), UINT64_C( 3153018427086294309), UINT64_C( 9878723116412193803),
+    UINT64_C(11467144595354358986), UINT64_C( 6011844692643917362), UINT64_C(17552460810699561935),
+    UINT64_C(18011250002515005808), UINT64_C( 6430449184797198779), UINT64_C(11624239542569073849),
+    UINT64_C( 4850211518002750932), UINT64_C( 4182733821677268203), UINT64_C( 8586857043833473996),
+    UINT64_C( 7176908050062859797), UINT64_C(16985207735470877648), UINT64_C( 2045168020946544198),
+    UINT64_C(14207121610923912878), UINT64_C(10022863711423162035), UINT64_C(10954308280831489033),
+    UINT64_C(16709034900708648583), UINT64_C( 5996394210777847030), UINT64_C(14038317690689165301),
+    UINT64_C(17312833212029112005), UINT64_C(16658645203505941589), UINT64_C(12715393057058349627),
+    UINT64_C(12840965660204203393), UINT64_C(11108732463314901175), UINT64_C( 2548859463508146442),
+    UINT64_C(15733894979453017444), UINT64_C( 2925867916509358312), UINT64_C( 3342930280299466837),
+    UINT64_C(12333856104439418947), UINT64_C(15865784930208123596), UINT64_C(10794918921151006710),
+    UINT64_C( 1477399764885353504), UINT64_C(  395062664604122197), UINT64_C( 4801455286200136077),
+    UINT64_C( 1212585991030832527), UINT64_C( 3982033787021150967), UINT64_C( 1931902765195178648),
+    UINT64_C( 6400067016917510858), UINT64_C( 1220912568590502635), UINT64_C( 2620899151970030674),
+    UINT64_C(14444888917304084087), UINT64_C( 6475611582507836503), UINT64_C( 7675575957508984589),
+    UINT64_C( 2290173523657045834), UINT64_C( 1643267835585176750), UINT64_C( 6541133209642207219),
+    UINT64_C( 7917286077122689122), UINT64_C( 7398648602236479204), UINT64_C( 4353204038488323312),
+    UINT64_C( 9879726239071217540), UINT64_C( 6339701180181827427), UINT64_C( 7651763859654080881),
+    UINT64_C(14131109365651792047), UINT64_C( 2746454911400926967), UINT64_C( 8662549814921257574),
+    UINT64_C(14998187401423670562), UINT64_C( 6963953146613935773), UINT64_C( 3510638843789557276),
+    UINT64_C( 9251050775332039089), UINT64_C(10692164911757845340), UINT64_C( 7153210414535920077),
+    UINT64_C( 4285057927966942831), UINT64_C( 6972705595924076928), UINT64_C( 7295731723276117165),
+    UINT64_C(  683840434269244104), UINT64_C(10671270586994043502), UINT64_C(13334945544854822302),
+    UINT64_C( 9885934878371744346), UINT64_C( 3485650857848240478), UINT64_C(10310357411271962663),
+    UINT64_C(16741900092146899708), UINT64_C( 7816986820672653376), UINT64_C( 9446562744348666872),
+    UINT64_C( 1431344154842419387), UINT64_C( 3216560040010454452), UINT64_C( 2742465452130275432),
+    UINT64_C( 6204918737829159945), UINT64_C( 8330857898088405278), UINT64_C(12017188121623256449),
+    UINT64_C(17043308572883239348), UINT64_C(16620575886320340083), UINT64_C( 7801513356536769344),
+    UINT64_C(14419067265579660617), UINT64_C( 9803416914218927043), UINT64_C( 6264590827648883477),
+    UINT64_C( 5911749743687958637), UINT64_C(15640135057900751766), UINT64_C( 1279595564790310874),
+    UINT64_C( 9436688113948612951), UINT64_C(12096795615639418569), UINT64_C(13954054074196509618),
+    UINT64_C( 8996415895360007689), UINT64_C( 1043775764306161782), UINT64_C(12007042063989439155),
+    UINT64_C( 7408652177688787809), UINT64_C(  289215475778954292), UINT64_C( 9659605862480346636),
+    UINT64_C( 7124084879991515427), UINT64_C( 5785246974115884831), UINT64_C(11289531030565251818),
+    UINT64_C(17189526496604121202), UINT64_C(10221761546112972278), UINT64_C(18429688868187810760),
+    UINT64_C(10094029035896599106), UINT64_C( 2346304140714607409), UINT64_C(18067653865425490368),
+    UINT64_C(15815195230123714597), UINT64_C( 1245148030991108190), UINT64_C( 8713458107917975119),
+    UINT64_C( 9746231033302730216), UINT64_C( 2931153500698604301), UINT64_C(16200086694824203705),
+    UINT64_C( 8184754025388121928), UINT64_C( 7298128206561367785), UINT64_C( 7240052295555689957),
+    UINT64_C(10040995672104521067), UINT64_C(15256775482785871689), UINT64_C(10206190507408971898),
+    UINT64_C(12913867340040444877), UINT64_C(11041067204403314337), UINT64_C(  949682020560076034),
+    UINT64_C(17823438571394630199), UINT64_C( 4777057524098981218), UINT64_C(15389770986524806559),
+    UINT64_C( 1044413101952639709), UINT64_C(16300145960930671166), UINT64_C(13458775482751918750),
+    UINT64_C( 6397346354424307417), UINT64_C( 8565412203068433060), UINT64_C(17456721261252940743),
+    UINT64_C( 9118195903826649896), UINT64_C(16724660867453047868), UINT64_C( 3289984482398425634),
+    UINT64_C(12865592666668632813), UINT64_C( 5659986618530345787), UINT64_C( 1596612486871390407),
+    UINT64_C(18192327386648112449), UINT64_C(11172324337055551674), UINT64_C(14247769545255591848),
+    UINT64_C(13696611270483121504), UINT64_C( 1906658450674597329), UINT64_C( 5970965429595398574),
+    UINT64_C(16139348109044318108), UINT64_C(14614171396422252042), UINT64_C( 4797572769299560363),
+    UINT64_C(12413489301082987140), UINT64_C( 8124372993710713725), UINT64_C(16014177922840635045),
+    UINT64_C(16557222612179087166), UINT64_C( 7484842278338045925), UINT64_C( 5790045855873906547),
+    UINT64_C(17371092351532966665), UINT64_C( 2856046516160674755), UINT64_C( 5933525809827352775),
+    UINT64_C( 2419453459156255822), UINT64_C(10215085194368579274), UINT64_C( 4731235618992435014),
+    UINT64_C(12050515971011854927), UINT64_C( 6281042372003120553), UINT64_C(11699894849544758567),
+    UINT64_C( 8719867219581702730), UINT64_C( 7804177519953886313), UINT64_C( 8425106910021591802),
+    UINT64_C(16662032157473884590), UINT64_C( 6707899754258937550), UINT64_C( 5639345486546188850),
+    UINT64_C( 8180406820005097239), UINT64_C( 6659111661727651544), UINT64_C( 1748101557604073039),
+    UINT64_C( 2673276434337600422), UINT64_C(16275388972022807717), UINT64_C( 6159651242598377708),
+    UINT64_C( 5449809128444687117), UINT64_C( 5580720465302160192), UINT64_C( 2158061103659792645),
+    UINT64_C(  131265627633903349), UINT64_C( 5994527017049979325), UINT64_C(16556097650059827964),
+    UINT64_C( 5998078452482989947), UINT64_C(14488828405170922954), UINT64_C( 2337313229573780925),
+    UINT64_C(17794446335325806377), UINT64_C( 4155187505536121601), UINT64_C( 6941695329931751416),
+    UINT64_C( 4102170397539507926), UINT64_C( 1428723339400848002), UINT64_C(14399653953375758646),
+    UINT64_C(10583448698248347269), UINT64_C(10613162879741496286), UINT64_C( 9564246980960736107),
+    UINT64_C(17194215808852409049), UINT64_C(17574234019921630813), UINT64_C( 3652028769078188023),
+    UINT64_C(14916800100551778493), UINT64_C(10214536674868855859), UINT64_C(16410527434012319149),
+    UINT64_C(10783499096607692750), UINT64_C(10990467185589572997), UINT64_C( 2443612187522262472),
+    UINT64_C(15304499654716889650), UINT64_C(18145935022041612842), UINT64_C( 4283988580237797562),
+    UINT64_C( 6924064257920050494), UINT64_C( 1251406297075790700), UINT64_C(10987223509482987909),
+    UINT64_C(11981202722840878421), UINT64_C(13107066738142579628), UINT64_C( 2235290499422831350),
+    UINT64_C(16230710793277553283), UINT64_C(14550820960426165381), UINT64_C(11563057884044584114),
+    UINT64_C( 3577274089969928962), UINT64_C( 9083338755476319029), UINT64_C( 7846098708733628534),
+    UINT64_C(   54651202068870986), UINT64_C( 4537591737387369973), UINT64_C( 7357303729797469730),
+    UINT64_C( 9380153671389246599), UINT64_C(11577412359165999476), UINT64_C( 2636518938254436902),
+    UINT64_C(16390048365645610565), UINT64_C( 7896696732174124269), UINT64_C(12824633042826621957),
+    UINT64_C(12584736886107011685), UINT64_C(15426935041507792420), UINT64_C(15693844780780885248),
+    UINT64_C(15172575577190553270), UINT64_C(  441724510495439341), UINT64_C(11036171675899639809),
+    UINT64_C(  239837828209793491), UINT64_C(13416001486052185786), UINT64_C(14087367814570860617),
+    UINT64_C( 1572100377995437447), UINT64_C(12229437747405130509), UINT64_C(11718718099756544807),
+    UINT64_C(16172794632374993248), UINT64_C(  416963019250134220), UINT64_C( 5430183856594337825),
+    UINT64_C(11150421375911460527), UINT64_C( 9794722546974025800), UINT64_C( 9310607114541432168),
+    UINT64_C(12193460625465991590), UINT64_C(11461061438621376504), UINT64_C( 7563996737842373272),
+    UINT64_C(  212215312799592160), UINT64_C(15022541378114048633), UINT64_C(11069253639158500682),
+    UINT64_C( 1210681595971310713), UINT64_C(  408178523019173473), UINT64_C(  951889974249856709),
+    UINT64_C( 3181379901196240396), UINT64_C(12005528462254258084), UINT64_C(12474318424389977490),
+    UINT64_C( 7753999093236257596), UINT64_C(11445274915387499627), UINT64_C(13068285012217038483),
+    UINT64_C( 3537248514244114466), UINT64_C(12624009585195477009), UINT64_C( 2363789017395873058),
+    UINT64_C( 2282682874809012142), UINT64_C( 8853850407293060900), UINT64_C( 1411938575094001772),
+    UINT64_C(14447389628437906976), UINT64_C(   89732914904733342), UINT64_C( 4965261884253759922),
+    UINT64_C(11411899545270481576), UINT64_C( 9608043386346694073), UINT64_C(16210762125076920541),
+    UINT64_C( 2013374097296765342), UINT64_C( 8285409367283538124), UINT64_C( 4533030983864215270),
+    UINT64_C(11072113752015491480), UINT64_C(  120954974510287822), UINT64_C(17230223897672128941),
+    UINT64_C(  579544474891150326), UINT64_C( 6215850367509488918), UINT64_C(15694098941998138309),
+    UINT64_C(14156789853548899404), UINT64_C( 8147775746903272951), UINT64_C(10445195075283713786),
+    UINT64_C( 9363263340999380589), UINT64_C( 4667893837766861705), UINT64_C( 7799793469812742460),
+    UINT64_C( 8965090696029594300), UINT64_C( 6839270044879550944), UINT64_C(12008824120262547024),
+    UINT64_C(12379259596654137201), UINT64_C( 7455526986573760574), UINT64_C( 9035406160272745391),
+    UINT64_C( 2557288544972232843), UINT64_C(17874098275613267022), UINT64_C( 7328731621589561683),
+    UINT64_C( 8295557089670123977), UINT64_C( 3336743788673397739), UINT64_C( 8513907850976088172),
+    UINT64_C(18191907373280484563), UINT64_C(15367936344682596488), UINT64_C( 4407035048474114199),
+    UINT64_C(15583695311793507574), UINT64_C(18350756442707523147), UINT64_C(17773895569876091097),
+    UINT64_C( 4739604504500285163), UINT64_C(13687537131706229428), UINT64_C( 8755845864504179094),
+    UINT64_C( 7819818407264219645), UINT64_C(10422574867840415811), UINT64_C(14659488089249811784),
+    UINT64_C( 1202911583472776867), UINT64_C( 4160990319208145641), UINT64_C( 1036628359768327579),
+    UINT64_C( 6943287977729844012), UINT64_C( 4287311877302485106), UINT64_C( 1201300021801992216),
+    UINT64_C( 6712091548068053878), UINT64_C(13562007108554052883), UINT64_C(15201423768858637267),
+    UINT64_C( 6573010040391113139), UINT64_C( 2792763276567117529), UINT64_C(15318903860884777685),
+    UINT64_C( 8023136602447561243), UINT64_C( 5903276502677153252), UINT64_C( 6929706982188710873),
+    UINT64_C( 9291685773623224711), UINT64_C(13360716326733893595), UINT64_C(12112865266826867888),
+    UINT64_C( 1143621629633695798), UINT64_C( 6641279640821327081), UINT64_C(11586202706244607731),
+    UINT64_C( 9030705990816394976), UINT64_C( 7942815107633099374), UINT64_C( 7262211437181347470),
+    UINT64_C( 5414172013259459926), UINT64_C( 4892486402926000578),
+};
+
+const uint64_t ntt64_1024_mixed_powers_rev[2048] = {
+    UINT64_C(                   0), UINT64_C( 3014237273200044542), UINT64_C( 1900964676350475249),
+    UINT64_C( 3849828598800407797), UINT64_C( 4023896290304178588), UINT64_C(  233753965118447345),
+    UINT64_C( 1261214714195877578), UINT64_C( 2676210263234941926), UINT64_C( 3705877877490448158),
+    UINT64_C( 1700436953662611386), UINT64_C(  881956512167215261), UINT64_C(  942511766632210723),
+    UINT64_C( 2709464080653393840), UINT64_C( 2046698563331994104), UINT64_C( 2390554822009554201),
+    UINT64_C( 3454435399983609484), UINT64_C( 2068168528663844559), UINT64_C( 2325064455222905641),
+    UINT64_C(  131131197477940099), UINT64_C( 3425108868614144548), UINT64_C( 3017514245864863805),
+    UINT64_C( 3901669560572161329), UINT64_C( 3989582554169606578), UINT64_C(  915969065129314377),
+    UINT64_C( 1659243688065142127), UINT64_C( 1850907503786542147), UINT64_C( 3671267046320851570),
+    UINT64_C(  234809061531476887), UINT64_C( 1161469406911059214), UINT64_C( 1407276508446451314),
+    UINT64_C( 1879648051492049201), UINT64_C( 3972631746810885831), UINT64_C( 4590796782851154790),
+    UINT64_C( 2690008220850828513), UINT64_C( 3830807687839579289), UINT64_C( 3371486293635211942),
+    UINT64_C( 3869672860422254369), UINT64_C( 2499763353882675499), UINT64_C( 3886273357699266640),
+    UINT64_C( 2657438284789770960), UINT64_C( 2437169274265949282), UINT64_C( 4055857690192455640),
+    UINT64_C( 4252178254449178011), UINT64_C( 1218769917950358612), UINT64_C( 3242539539891929736),
+    UINT64_C(  770504662971353748), UINT64_C( 2122017383951756192), UINT64_C( 1347513035217080243),
+    UINT64_C( 3551072131483919237), UINT64_C(  848194068593451947), UINT64_C( 3377243792771223918),
+    UINT64_C( 1044401146706852566), UINT64_C( 3363683680248536206), UINT64_C( 3112335350052062119),
+    UINT64_C( 1860452777895420591), UINT64_C(  139490077637179889), UINT64_C( 1255736397875211236),
+    UINT64_C( 1482370635763389549), UINT64_C(  692980835930194811), UINT64_C( 4443047538019427593),
+    UINT64_C( 2467608254404987505), UINT64_C( 2492189391122621180), UINT64_C( 1870026971131305276),
+    UINT64_C( 2093542254857539782), UINT64_C( 4045238714599002096), UINT64_C( 4009884568549198952),
+    UINT64_C(  924826167830191412), UINT64_C( 1123876638625291197), UINT64_C(  326342301997994306),
+    UINT64_C( 1488036762640350778), UINT64_C(  274152638443289083), UINT64_C( 4391989867934207415),
+    UINT64_C( 3173250686850103875), UINT64_C( 3259777318488657740), UINT64_C( 3838265690580697662),
+    UINT64_C(  213534333928675936), UINT64_C(  594522224732039591), UINT64_C( 2279697959882368399),
+    UINT64_C(  596256239724183802), UINT64_C( 2062182020421627244), UINT64_C( 1132986281500898181),
+    UINT64_C( 3227187218431474260), UINT64_C(  532893738964097199), UINT64_C(  685400175851316156),
+    UINT64_C( 4330212126516253940), UINT64_C( 2718306078420364749), UINT64_C( 2718205553781153588),
+    UINT64_C( 1970705841300989217), UINT64_C(  387408563325795131), UINT64_C( 2881615329919645789),
+    UINT64_C( 1610063896412036330), UINT64_C( 2950161371412402896), UINT64_C( 4371207996495634843),
+    UINT64_C( 1118943180714764533), UINT64_C(  820752269393906697), UINT64_C(   13256803360230936),
+    UINT64_C( 1768360373935249815), UINT64_C(  264983591297565602), UINT64_C( 3215445710127520461),
+    UINT64_C( 2801663570676650426), UINT64_C(  966634132866666046), UINT64_C( 1729303117196723516),
+    UINT64_C( 1636465293549385213), UINT64_C( 2418254001624659624), UINT64_C( 3915428745381234437),
+    UINT64_C(   77912590505156175), UINT64_C( 2063059596773417233), UINT64_C(  869173883498632863),
+    UINT64_C( 2594209754045336797), UINT64_C( 3490871534733890590), UINT64_C( 4342379187862950981),
+    UINT64_C( 1006352626196175146), UINT64_C( 1145423232612195378), UINT64_C( 1876288299092947845),
+    UINT64_C(  256494620928290829), UINT64_C(  385770757908462315), UINT64_C( 2720549446495872479),
+    UINT64_C( 3879920586239417728), UINT64_C( 2945859800615284769), UINT64_C( 2074581773178369824),
+    UINT64_C(  198757123458518136), UINT64_C( 4325996936041739018), UINT64_C( 1105253435398927209),
+    UINT64_C( 1300210680856899347), UINT64_C( 3624590898131699178), UINT64_C(  952627208103550231),
+    UINT64_C(  197193362320839916), UINT64_C(  115292498941482581), UINT64_C( 4397928510362249185),
+    UINT64_C( 2621792368599966030), UINT64_C( 4265936606843995371), UINT64_C(  925716047777857124),
+    UINT64_C( 2891450918264212504), UINT64_C( 1583352588619711861), UINT64_C( 3537615089318938312),
+    UINT64_C(  263637743407343746), UINT64_C( 4348036025405146823), UINT64_C( 1478167556514048989),
+    UINT64_C( 1619019368883669872), UINT64_C( 2214213433730165795), UINT64_C( 4006039401931595717),
+    UINT64_C(  959698465116575210), UINT64_C( 2834330732008186913), UINT64_C(  125165356278636575),
+    UINT64_C( 1242290418832802340), UINT64_C(  793244537377917469), UINT64_C( 3537332191015376133),
+    UINT64_C(  274336233037238077), UINT64_C( 2141122488594596993), UINT64_C(  218152164207231001),
+    UINT64_C( 2319624932896978552), UINT64_C( 4022767753782152272), UINT64_C( 4559114692349893132),
+    UINT64_C( 2200782996640600919), UINT64_C(  816778863552099543), UINT64_C( 2419031109686561638),
+    UINT64_C( 1552522174097316013), UINT64_C(  872899714386228416), UINT64_C( 4207773561490883035),
+    UINT64_C( 4557284773527364931), UINT64_C( 1635941343942511081), UINT64_C(  388752746045964085),
+    UINT64_C(  797297974165473708), UINT64_C( 2224528769235092197), UINT64_C(  129810917144576916),
+    UINT64_C( 3695237642805590966), UINT64_C( 1917507912125205273), UINT64_C(   86969233091873012),
+    UINT64_C( 2592879749429526478), UINT64_C(  767039058199565051), UINT64_C( 4382760348511593332),
+    UINT64_C( 2308342209152691040), UINT64_C( 2741242456929995325), UINT64_C( 1529567590237338722),
+    UINT64_C(  945384935947669134), UINT64_C( 2973329062899545170), UINT64_C( 1480033111175595923),
+    UINT64_C( 2538778187029876446), UINT64_C( 2344837507844879919), UINT64_C( 2596801024432302985),
+    UINT64_C( 2687779657998904699), UINT64_C( 4135729112038515174), UINT64_C(  204896358553094317),
+    UINT64_C( 3716165778433263976), UINT64_C( 2737280191719927095), UINT64_C( 1632747171034126038),
+    UINT64_C( 1586033836836413089), UINT64_C( 3721389930257549409), UINT64_C(  951927524121511628),
+    UINT64_C( 2312131158625254196), UINT64_C(  234041685233257305), UINT64_C( 1158366700570832516),
+    UINT64_C( 2492007486818252281), UINT64_C(  992635524216815278), UINT64_C( 2836277682389490544),
+    UINT64_C( 4108077938980496914), UINT64_C(  992691344949810376), UINT64_C(  902190690149567071),
+    UINT64_C( 3597579810358573200), UINT64_C( 2622864515154075147), UINT64_C( 1737698881978754060),
+    UINT64_C( 4544171960220366710), UINT64_C(  367710248663569074), UINT64_C( 3370615483927805111),
+    UINT64_C( 3765859310675874347), UINT64_C( 4111152270751917141), UINT64_C( 3270168765958856210),
+    UINT64_C( 1849160754478801782), UINT64_C( 1651868321264097245), UINT64_C( 3249967743082457984),
+    UINT64_C( 4428544272741454476), UINT64_C( 3172066150783512600), UINT64_C( 1829823592218854829),
+    UINT64_C( 2903757481865333581), UINT64_C( 1098585534659563516), UINT64_C( 4359325251833636030),
+    UINT64_C( 2005797565407588331), UINT64_C( 3785652056625193400), UINT64_C( 2059382345563661484),
+    UINT64_C( 3682127656795400699), UINT64_C( 1053896098414277608), UINT64_C( 2221612477457659753),
+    UINT64_C( 3664032263547523615), UINT64_C( 4136767868326397556), UINT64_C(  659920490112473771),
+    UINT64_C( 4103017788438389522), UINT64_C( 2948358908520598479), UINT64_C( 4222131386577963441),
+    UINT64_C(  695772663740341648), UINT64_C( 3638761761840292763), UINT64_C( 4270566713751658911),
+    UINT64_C( 4541955249605003808), UINT64_C( 2655618324572464349), UINT64_C(  619989834785333684),
+    UINT64_C( 4289953542452418782), UINT64_C(  447428903215342719), UINT64_C( 2972182093805958694),
+    UINT64_C( 3593013623125881141), UINT64_C( 1872862200816238025), UINT64_C( 1051719673050458959),
+    UINT64_C( 2829232655383784435), UINT64_C( 3730675882714140168), UINT64_C(  290341413826395897),
+    UINT64_C(   49318483776098116), UINT64_C(  634297698006902227), UINT64_C(  150331248495044976),
+    UINT64_C(  941475936506272623), UINT64_C( 3766314570829488647), UINT64_C(   80314588454367303),
+    UINT64_C( 3086222030444894558), UINT64_C( 4035126618246567356), UINT64_C( 1842615612368354497),
+    UINT64_C( 3884862316935299801), UINT64_C( 2939975394522410060), UINT64_C( 2077598463836100093),
+    UINT64_C( 4351756900966242687), UINT64_C( 2400711739119850254), UINT64_C( 1416979586047913860),
+    UINT64_C( 3529489814044241211), UINT64_C( 1135687142661087418), UINT64_C( 2322728151565602801),
+    UINT64_C( 2369067053942932304), UINT64_C(   31368178978924605), UINT64_C( 3436014263075695111),
+    UINT64_C(  901859847614317342), UINT64_C( 1215685474672827343), UINT64_C(  582088543124655278),
+    UINT64_C( 3487492969372016186), UINT64_C( 1496519828866501509), UINT64_C( 3058646478612644251),
+    UINT64_C( 1465721990478548967), UINT64_C( 2107651826156979027), UINT64_C(  984850724769212231),
+    UINT64_C( 3644518137698018793), UINT64_C(  241509748437302878), UINT64_C(  383304783933611976),
+    UINT64_C( 1628183582686043495), UINT64_C( 3114759228713443323), UINT64_C( 4238833680404291401),
+    UINT64_C(  688026410288222148), UINT64_C(  823057021263900120), UINT64_C( 2326411855819986390),
+    UINT64_C( 1091914032667124918), UINT64_C( 2296950020239488805), UINT64_C(  607337418735800506),
+    UINT64_C( 1467247101221685025), UINT64_C( 1317921105431250529), UINT64_C( 1166840412541945381),
+    UINT64_C( 3617524138862625915), UINT64_C( 2759501200185376495), UINT64_C( 1585988977946312062),
+    UINT64_C(  184527297125777774), UINT64_C( 2212359946370916543), UINT64_C( 1132640057676710068),
+    UINT64_C( 3302637486092235475), UINT64_C(   47240480759893108), UINT64_C(  471899825039116811),
+    UINT64_C( 4430465930968651663), UINT64_C( 3000885903703217293), UINT64_C( 4154352184849207477),
+    UINT64_C(  387899278134293157), UINT64_C( 2672210800821325956), UINT64_C( 3395731570131024519),
+    UINT64_C( 4396745417903152580), UINT64_C( 4592083484607426410), UINT64_C( 1642493526309612238),
+    UINT64_C( 4295875587876333751), UINT64_C( 3097597748165930130), UINT64_C( 2819589298549003725),
+    UINT64_C(  947438932901172815), UINT64_C( 4048254277868242691), UINT64_C( 3613343733206840369),
+    UINT64_C( 1834221755513644804), UINT64_C(  973277973631779119), UINT64_C( 1614547761626343100),
+    UINT64_C( 1084738989767016719), UINT64_C( 3592350538474428510), UINT64_C( 2020727104038103695),
+    UINT64_C( 2382342543941134407), UINT64_C( 1309825015972462495), UINT64_C( 1594215662391375664),
+    UINT64_C( 2000858215069317061), UINT64_C( 4331139294641859496), UINT64_C(  332574684972234384),
+    UINT64_C( 4605570564545716782), UINT64_C( 1330347273031060688), UINT64_C( 3461620215034767531),
+    UINT64_C( 4354964862091784544), UINT64_C( 3775631158123672134), UINT64_C( 1508734581979171756),
+    UINT64_C( 1717910164398452271), UINT64_C( 1217067112109024256), UINT64_C( 3704149725588216635),
+    UINT64_C( 4424436587380937918), UINT64_C(  978263020579853024), UINT64_C( 3481615102258042497),
+    UINT64_C( 2168778472999814742), UINT64_C( 4073169274230856126), UINT64_C( 2535061422550748591),
+    UINT64_C( 2370049507009080760), UINT64_C( 4049514128221477506), UINT64_C(  439107495671692173),
+    UINT64_C( 3111929951370134147), UINT64_C( 1179317760430472932), UINT64_C(  565404122626278415),
+    UINT64_C( 1799833330256075521), UINT64_C( 1676540994076128771), UINT64_C( 2298087391389824104),
+    UINT64_C( 1237155887585272454), UINT64_C( 3941826338290054710), UINT64_C( 4281658139135845856),
+    UINT64_C( 3540619593564635243), UINT64_C( 2686804368448370058), UINT64_C( 2494884684187073661),
+    UINT64_C( 2965734562744674556), UINT64_C( 3446233119576757455), UINT64_C( 2202021348140264508),
+    UINT64_C( 1593017396740558622), UINT64_C( 3279913815230309282), UINT64_C( 3286818059444468376),
+    UINT64_C( 1140983863867013629), UINT64_C(  208179820468705139), UINT64_C(  871015248634303721),
+    UINT64_C( 1373290829529926976), UINT64_C( 3537347188712899438), UINT64_C( 4483213694720406842),
+    UINT64_C(  610860530465122481), UINT64_C(  696315246081945734), UINT64_C( 3100376025612258997),
+    UINT64_C( 1362051703778680179), UINT64_C( 4579018523369296072), UINT64_C(   89901937259524008),
+    UINT64_C( 4240106447481798977), UINT64_C( 3518353274126681257), UINT64_C( 2372127282591449080),
+    UINT64_C( 4519016613408284383), UINT64_C( 3969109923860126202), UINT64_C( 4394225446772396019),
+    UINT64_C( 1609551556682479035), UINT64_C(  227921074365688802), UINT64_C( 1930320082969866003),
+    UINT64_C( 1225662781222001375), UINT64_C( 3802414016400156201), UINT64_C( 4129446904813725372),
+    UINT64_C( 4160528321702267484), UINT64_C( 2255234229238542731), UINT64_C(  765058418352087786),
+    UINT64_C(  166469110154211230), UINT64_C(   19378975449324817), UINT64_C( 3903703857980723923),
+    UINT64_C( 1863841901798123565), UINT64_C( 1359394696637062210), UINT64_C( 1446321208517112901),
+    UINT64_C( 2014042211893684604), UINT64_C( 1492270058063349872), UINT64_C( 1365972863225878166),
+    UINT64_C( 2454359905175880704), UINT64_C(  504362620832676715), UINT64_C( 1478805904657277363),
+    UINT64_C( 2678229115631223377), UINT64_C( 3486308177735248782), UINT64_C( 4095553468289470494),
+    UINT64_C( 3487906013475575565), UINT64_C( 4389322720306063027), UINT64_C( 3149013359125955277),
+    UINT64_C( 3381901547434642051), UINT64_C(  962154417381372913), UINT64_C(  266453965578522078),
+    UINT64_C( 3616980239419837533), UINT64_C(  565417953593608565), UINT64_C( 1988371081652311567),
+    UINT64_C( 4037114839065063084), UINT64_C( 1240193826751170286), UINT64_C( 4266426457572698799),
+    UINT64_C(  245017491998479862), UINT64_C(  260966410467664596), UINT64_C( 3966103377340790787),
+    UINT64_C( 1675895396083821476), UINT64_C(  979224835709439631), UINT64_C( 3624585512076324057),
+    UINT64_C( 1950096095932331642), UINT64_C(  289100196167847331), UINT64_C( 3959152801982309405),
+    UINT64_C( 3346221758441642400), UINT64_C( 2366867205507320441), UINT64_C( 3507617405319098454),
+    UINT64_C(  136771232223207871), UINT64_C(  490079728691177042), UINT64_C(  543664783405561633),
+    UINT64_C(  483306483213340640), UINT64_C(  510806555556130508), UINT64_C( 3132167013330314154),
+    UINT64_C( 3427619522903392612), UINT64_C( 4163483892177191812), UINT64_C(  155787413762905631),
+    UINT64_C( 1030215965054952744), UINT64_C( 3668473313572806821), UINT64_C( 3469651375707344324),
+    UINT64_C( 4382204278396839813), UINT64_C( 4523373017153855388), UINT64_C( 1063378126852311450),
+    UINT64_C( 1231208399773997533), UINT64_C( 4345836121639019118), UINT64_C( 1688292499388007393),
+    UINT64_C(  184443339613017823), UINT64_C(  277094405141672246), UINT64_C( 3525498332217669253),
+    UINT64_C( 3648113786199744239), UINT64_C( 4478754074506901161), UINT64_C(  626297590503189450),
+    UINT64_C( 3369742126303465728), UINT64_C( 1697744173972396808), UINT64_C( 1538093989941999103),
+    UINT64_C(  479588466945915912), UINT64_C(  848976462686658613), UINT64_C( 1854522643282304425),
+    UINT64_C( 3016203424819720057), UINT64_C( 4035136138076832337), UINT64_C( 1733457760798908697),
+    UINT64_C(  331008071283198498), UINT64_C( 1781176816738160749), UINT64_C( 2914509569038348340),
+    UINT64_C( 1244340859032719234), UINT64_C( 1302547591645079863), UINT64_C(  777039139634899335),
+    UINT64_C( 3531384543848349920), UINT64_C( 2315378645606089562), UINT64_C( 1361761461888066093),
+    UINT64_C( 3145022340754381981), UINT64_C( 2073600855859389402), UINT64_C( 4083502248124438865),
+    UINT64_C( 3041380130487857690), UINT64_C( 3956136616881939299), UINT64_C( 1874612785324683517),
+    UINT64_C( 1844890970564863646), UINT64_C(  706144719799758441), UINT64_C( 2035178193471487090),
+    UINT64_C( 2462317921121052758), UINT64_C( 4190969131542904529), UINT64_C( 1276609820644503207),
+    UINT64_C( 2726324361822022698), UINT64_C( 3085814807638355138), UINT64_C( 1432751804325404159),
+    UINT64_C( 3078632193023835316), UINT64_C( 2736718066033403274), UINT64_C( 3354922308083637135),
+    UINT64_C(  938436529988435272), UINT64_C( 2091943141357137645), UINT64_C(  981623966646819835),
+    UINT64_C(  680976407834139869), UINT64_C( 3133051207374189676), UINT64_C( 1334108140963731887),
+    UINT64_C( 1579237328548817598), UINT64_C(  877353902278191427), UINT64_C( 3824291739522788076),
+    UINT64_C( 2137443489648467722), UINT64_C(  917794389549713133), UINT64_C(  251588547665158640),
+    UINT64_C( 2676859808255949069), UINT64_C( 2734815492851336383), UINT64_C( 2742465433268612203),
+    UINT64_C(  485491135282793681), UINT64_C( 3720690912893558875), UINT64_C( 1459176627240636952),
+    UINT64_C( 3187602538680359448), UINT64_C( 3165220293337291917), UINT64_C( 1032376268464898917),
+    UINT64_C( 3988225595075851037), UINT64_C( 2093264054356944664), UINT64_C( 3781699484200797783),
+    UINT64_C( 4476297656530001513), UINT64_C( 3474715846492304988), UINT64_C( 1482597879546526807),
+    UINT64_C( 2082714474522091146), UINT64_C( 2953819124445283744), UINT64_C( 2995300680710204974),
+    UINT64_C( 4179895444431398167), UINT64_C( 1492741357398842352), UINT64_C( 3551780402730960870),
+    UINT64_C( 2071352341820874413), UINT64_C( 4413418788999735102), UINT64_C( 2436557758325670652),
+    UINT64_C(  259327643525957150), UINT64_C( 1357545964148577825), UINT64_C( 1231292546388298006),
+    UINT64_C( 1395180116325533233), UINT64_C( 1635283302410543817), UINT64_C( 1184901126125065503),
+    UINT64_C( 2152356314284504037), UINT64_C( 3001760515997345126), UINT64_C(  813085348019976937),
+    UINT64_C( 1974174183043521424), UINT64_C( 4006347857954613253), UINT64_C( 3012628992752949016),
+    UINT64_C( 3966446232552011524), UINT64_C( 3002206030065622091), UINT64_C(  206013519460792176),
+    UINT64_C( 4075036490232647886), UINT64_C( 3153503871610633059), UINT64_C( 1938499773309054930),
+    UINT64_C( 4089323814216956058), UINT64_C( 2391061745240172347), UINT64_C( 1071264481991730475),
+    UINT64_C(  698190819141775972), UINT64_C( 3475048544167223743), UINT64_C( 1477937435921982440),
+    UINT64_C( 3535464716239159675), UINT64_C( 1961524677183397552), UINT64_C( 3837830294890745113),
+    UINT64_C( 1871210569584502341), UINT64_C( 3178848264264571879), UINT64_C( 3539197463387207563),
+    UINT64_C( 1675399405844500639), UINT64_C( 2551547626852230511), UINT64_C(  744505676817952400),
+    UINT64_C( 3755635344528493813), UINT64_C(  227931364734691067), UINT64_C( 4448611583831429864),
+    UINT64_C(  686613727850228388), UINT64_C(  259157089942080629), UINT64_C(  378982153573495126),
+    UINT64_C( 2555440386528230587), UINT64_C( 3704224761560595246), UINT64_C(   59959457052448080),
+    UINT64_C(  618406896923799255), UINT64_C( 1409836371636540326), UINT64_C( 1600016754229369899),
+    UINT64_C(  834185947168345360), UINT64_C( 2553324353274824928), UINT64_C( 3216398166667142492),
+    UINT64_C( 1607612296199291842), UINT64_C(  352984643773498719), UINT64_C( 4235567419415590436),
+    UINT64_C( 2747616796397379828), UINT64_C( 2577589352817978075), UINT64_C(  285905407408422553),
+    UINT64_C( 3173209563656975690), UINT64_C( 1950378339134182809), UINT64_C(  610322076670062182),
+    UINT64_C( 3637705240106523576), UINT64_C( 3184917978475901740), UINT64_C( 3103372325270731626),
+    UINT64_C( 1499098552694454435), UINT64_C( 4307555974418011194), UINT64_C( 2127246246226089471),
+    UINT64_C( 1824532051640333034), UINT64_C( 2893763264795340899), UINT64_C( 3048365156366483007),
+    UINT64_C( 3127284970748758296), UINT64_C( 4139024412514936773), UINT64_C( 2469931559767792320),
+    UINT64_C( 2605643716960091225), UINT64_C( 1472513635096154189), UINT64_C( 1781021219997870157),
+    UINT64_C( 1039155171907682344), UINT64_C( 3923461195195202147), UINT64_C( 2037633380302720167),
+    UINT64_C( 1951044379988462048), UINT64_C( 1200363821550028156), UINT64_C(  639322136243055088),
+    UINT64_C( 2595168663386929050), UINT64_C( 4364180315313213868), UINT64_C( 2866786148838575743),
+    UINT64_C( 3156002396298853836), UINT64_C(  944274310408114028), UINT64_C( 3729200025137926407),
+    UINT64_C( 2667817646748497844), UINT64_C( 1732426745547169256), UINT64_C(  981071095532084396),
+    UINT64_C( 3024198903909839870), UINT64_C( 3237294127365214371), UINT64_C( 2345038417847300195),
+    UINT64_C( 1547985558326977229), UINT64_C( 1483381452456830948), UINT64_C( 3933473744863235147),
+    UINT64_C( 1166973459441709726), UINT64_C( 4248030908068247876), UINT64_C( 4455859642848635784),
+    UINT64_C( 3159161751295827278), UINT64_C(  237972493562463015), UINT64_C( 2441693564009293879),
+    UINT64_C(  357180834850210256), UINT64_C(  877659710947385032), UINT64_C( 1678022887017005273),
+    UINT64_C(  612332860768801085), UINT64_C( 4516913466356350528), UINT64_C( 1880435472699480520),
+    UINT64_C( 3057359436851267693), UINT64_C( 2678799719038285260), UINT64_C(  668319108584396841),
+    UINT64_C( 1618902895626951218), UINT64_C( 1101758762118523168), UINT64_C( 3976646043879445814),
+    UINT64_C( 2793081084263874275), UINT64_C( 2146714260958358013), UINT64_C( 2852974886317606458),
+    UINT64_C( 3449561237629491717), UINT64_C( 1070997145059444159), UINT64_C(  357836038710603099),
+    UINT64_C( 1985703776908265144), UINT64_C( 2236207476109945826), UINT64_C( 4260827143220789024),
+    UINT64_C( 1870086954996130132), UINT64_C(  558822624855705108), UINT64_C(  149946119270052318),
+    UINT64_C( 3653542849105545164), UINT64_C( 2738577070207858881), UINT64_C( 2768028438003859349),
+    UINT64_C( 1389764208159740173), UINT64_C( 4050021673706031143), UINT64_C( 2925678656572254158),
+    UINT64_C( 2448680636743494489), UINT64_C(  405715598774631321), UINT64_C(   32816406908475677),
+    UINT64_C( 1849662150559110766), UINT64_C( 2188961466126034081), UINT64_C( 3360262105595798472),
+    UINT64_C(   72303868944738220), UINT64_C( 1120534607174351876), UINT64_C( 3146184221526737553),
+    UINT64_C( 3502872730561864502), UINT64_C( 2924973712386175354), UINT64_C(  369349941221336572),
+    UINT64_C( 1863881746643431039), UINT64_C(  996814958304332801), UINT64_C( 1599336588606069042),
+    UINT64_C(  788254606771569727), UINT64_C( 3267071253054243662), UINT64_C( 2111054285050781485),
+    UINT64_C( 4393558504980386242), UINT64_C( 1823932930819020382), UINT64_C( 2005784150611880513),
+    UINT64_C( 1743176440286758037), UINT64_C(  319898891197576156), UINT64_C( 1818964933693720657),
+    UINT64_C( 1134397934346836952), UINT64_C( 1662449655873154725), UINT64_C( 4342773087883220453),
+    UINT64_C( 2777183115828711728), UINT64_C( 2611298768820915691), UINT64_C( 2722813743701629808),
+    UINT64_C( 2760266801100815101), UINT64_C( 3396117487884430813), UINT64_C(  302670398992826200),
+    UINT64_C( 3842262695106735884), UINT64_C( 1735423832482929377), UINT64_C( 3749546850355899325),
+    UINT64_C( 1071827969325616041), UINT64_C( 1534399510701327249), UINT64_C( 2523507258974137450),
+    UINT64_C( 1026577720042490999), UINT64_C( 3521841953642697951), UINT64_C( 1539849053772316455),
+    UINT64_C( 1664777915431904754), UINT64_C(  655224787992504468), UINT64_C( 4547976843320098925),
+    UINT64_C(  323018046560510768), UINT64_C(  399153121717845652), UINT64_C( 1212552879500681810),
+    UINT64_C(   22433228726183226), UINT64_C(  202536063555335267), UINT64_C( 3826124913679203723),
+    UINT64_C( 1954246705168153798), UINT64_C( 2896550676561137784), UINT64_C( 1125019699564870663),
+    UINT64_C( 2450854228554719789), UINT64_C( 4316407904723576692), UINT64_C(  894318522492477872),
+    UINT64_C( 1449569256746130422), UINT64_C( 4003544480710139205), UINT64_C( 4328208303007256859),
+    UINT64_C( 1553962591877364639), UINT64_C( 2805704277397565552), UINT64_C( 2510248918026118005),
+    UINT64_C( 4115719751317650066), UINT64_C( 1890999184460584081), UINT64_C( 3778979863626164434),
+    UINT64_C( 3622207101292713045), UINT64_C( 1912940964913510876), UINT64_C(  300727895868192748),
+    UINT64_C( 1614534579931394013), UINT64_C( 2822382757641299168), UINT64_C( 3557012870941004489),
+    UINT64_C(  110431127623859296), UINT64_C( 3154681298805182640), UINT64_C( 4165508039368450800),
+    UINT64_C(  995508446755282879), UINT64_C( 1832182905397381471), UINT64_C( 1956709891719793324),
+    UINT64_C( 4181165216863241543), UINT64_C( 4388115202674869049), UINT64_C(  570670718702250248),
+    UINT64_C( 1850810078856814141), UINT64_C( 4102631858503059747), UINT64_C( 2471483719592924014),
+    UINT64_C( 3340179081683457083), UINT64_C( 1826920447323762417), UINT64_C( 2249103973839990936),
+    UINT64_C( 2669237607306606438), UINT64_C(  659129734563606006), UINT64_C( 4441815589208536264),
+    UINT64_C( 2553771298592132344), UINT64_C(  835732570074862627), UINT64_C( 2241272674007387627),
+    UINT64_C( 2421780860294367016), UINT64_C( 3847442746631182846), UINT64_C(  899421310882257990),
+    UINT64_C( 3001382115563549860), UINT64_C( 2501290997749770042), UINT64_C( 2645862174562073893),
+    UINT64_C( 2673041227939448278), UINT64_C( 3800355942214640753), UINT64_C( 3260187915165642297),
+    UINT64_C(  311287007747775527), UINT64_C( 4401571916414383242), UINT64_C( 4043198658093728562),
+    UINT64_C(  120984652424765095), UINT64_C( 1539912810649586905), UINT64_C(  572543380914258662),
+    UINT64_C( 4587689110676858377), UINT64_C( 1759667293271595718), UINT64_C( 3424152817620763650),
+    UINT64_C( 4246301933867698670), UINT64_C( 4052690531269210339), UINT64_C( 1674715692560252183),
+    UINT64_C(  312851574268946147), UINT64_C(  685616363032565509), UINT64_C( 1353543003314858370),
+    UINT64_C(  432759921836399365), UINT64_C( 3004297030405799437), UINT64_C( 2307982508531578249),
+    UINT64_C( 3276766684535628901), UINT64_C( 1909512407465233379), UINT64_C( 4034837027261059818),
+    UINT64_C( 2505715927855778269), UINT64_C( 1133257745966048282), UINT64_C( 3941619879789496384),
+    UINT64_C(  732788375174647496), UINT64_C( 3536008120361596082), UINT64_C( 2787605343977851515),
+    UINT64_C( 3776358726451765212), UINT64_C(  539515275914945526), UINT64_C( 1979321519280662612),
+    UINT64_C( 3421884282926540642), UINT64_C(  877056375854364479), UINT64_C( 1852163044422187905),
+    UINT64_C( 2818183610269625575), UINT64_C( 3206158260706639828), UINT64_C( 1332465128049927577),
+    UINT64_C( 1570260593000772468), UINT64_C( 2698729730287738495), UINT64_C( 3094814899163519183),
+    UINT64_C( 2282986705892302649), UINT64_C( 3364693870687963252), UINT64_C( 3319733127703385917),
+    UINT64_C( 2861318728846860930), UINT64_C( 4465598112306431653), UINT64_C( 4298553952213081265),
+    UINT64_C( 1743176398981010717), UINT64_C( 3829725965221175714), UINT64_C( 2252006044808091691),
+    UINT64_C( 3910033764475168842), UINT64_C( 2055493099061855374), UINT64_C(   13662800517217680),
+    UINT64_C( 4156289026366138793), UINT64_C( 1447511463968469566), UINT64_C( 3210241415051035167),
+    UINT64_C( 2036943936725808288), UINT64_C( 4578118999158733141), UINT64_C( 3228466835010095449),
+    UINT64_C(  487536162258042406), UINT64_C( 2767313409789611653), UINT64_C( 3052187898684828202),
+    UINT64_C( 1038796876384025326), UINT64_C( 2165637453730303815), UINT64_C( 1735821994432452524),
+    UINT64_C( 3547866881446932766), UINT64_C( 4607422217046930184), UINT64_C( 2348389025506101277),
+    UINT64_C( 3354000371513030063), UINT64_C( 1093274855949974417), UINT64_C( 2045101705001264320),
+    UINT64_C(  305228142147624168), UINT64_C( 2128476962744011646), UINT64_C(  133184145821685010),
+    UINT64_C( 1414996654632579535), UINT64_C( 2906059885642254267), UINT64_C( 3611847407109459101),
+    UINT64_C( 4098536546087430514), UINT64_C(  610903046880562634), UINT64_C( 4185475023036704482),
+    UINT64_C( 1660319910205323660), UINT64_C( 2681256057857921695), UINT64_C( 3604766816394897546),
+    UINT64_C( 4542711586168647568), UINT64_C( 2890764471011131908), UINT64_C( 2047279311257772405),
+    UINT64_C( 2031093248427668510), UINT64_C( 3509579422672274182), UINT64_C(  144886118722786874),
+    UINT64_C( 1297676028477784910), UINT64_C( 1810013073888913648), UINT64_C(   14862659715892847),
+    UINT64_C( 2865265359655330130), UINT64_C( 4052911345250588131), UINT64_C( 1499519613120740162),
+    UINT64_C( 1584925295045449115), UINT64_C( 3664872022312435044), UINT64_C( 1997781625949192316),
+    UINT64_C( 1446311743528964143), UINT64_C( 3892929271204224101), UINT64_C( 3793143894297619789),
+    UINT64_C( 3831284048061919385), UINT64_C( 2106276727505387662), UINT64_C(  303146497757706651),
+    UINT64_C( 4468524568903294928), UINT64_C( 1126572836870937755), UINT64_C( 2279548975956651339),
+    UINT64_C( 1502961173160971999), UINT64_C(  590947254348965378), UINT64_C( 2361358369003975692),
+    UINT64_C( 2553634168717201491), UINT64_C( 3333736386213689291), UINT64_C( 2322921443405794831),
+    UINT64_C(   89618295979655699), UINT64_C( 3488513518549110364), UINT64_C( 3501847443227543094),
+    UINT64_C( 2894353089791485731), UINT64_C( 1734312021333489165), UINT64_C(  604863364789061001),
+    UINT64_C(  731466979127336005), UINT64_C( 1949948367453176090), UINT64_C( 1463487423932645335),
+    UINT64_C( 1194264381024739471), UINT64_C( 3037559455667103634), UINT64_C(  795344975299056214),
+    UINT64_C( 2570888489570115752), UINT64_C( 3599913488343922077), UINT64_C( 2312762693832998475),
+    UINT64_C( 3390501777138496659), UINT64_C( 3939883140197502805), UINT64_C( 3953798807530909336),
+    UINT64_C( 1788055398028417530), UINT64_C( 2929679524939121891), UINT64_C( 2833295645362765934),
+    UINT64_C( 4068847243005682054), UINT64_C( 1918893989377236774), UINT64_C( 3895923827948357863),
+    UINT64_C( 4506337479441810504), UINT64_C( 3561942386313880563), UINT64_C( 1794227012515706185),
+    UINT64_C( 2402010846586661785), UINT64_C(   52752168786994182), UINT64_C( 1731016064480004168),
+    UINT64_C(  804140010002609685), UINT64_C( 1815552859295327999), UINT64_C(  921226844134805204),
+    UINT64_C( 4155143971580064724), UINT64_C( 1877152863679867689), UINT64_C( 4057677698319368500),
+    UINT64_C( 1429696784014473483), UINT64_C( 1199393192324884232), UINT64_C( 4177258725177141741),
+    UINT64_C(   30238743627571808), UINT64_C( 3774394374542281825), UINT64_C( 2046188506347020487),
+    UINT64_C( 2841671314611570319), UINT64_C( 2327651778635346672), UINT64_C(  771581980824854236),
+    UINT64_C( 1498631754262487511), UINT64_C( 1088301009622075512), UINT64_C( 1954954601816045362),
+    UINT64_C( 3272137543606808733), UINT64_C( 2414901465620074863), UINT64_C( 4568954096219192478),
+    UINT64_C( 3856733760376929266), UINT64_C( 3410557048115571723), UINT64_C( 2179966804895415034),
+    UINT64_C(   98765666151030067), UINT64_C( 2258851540068175314), UINT64_C( 1858831409963639856),
+    UINT64_C( 2141353050767097805), UINT64_C( 2469680779103036387), UINT64_C(  884312128561024297),
+    UINT64_C( 1160323589628636843), UINT64_C(  913007192269542546), UINT64_C(  170960108567310191),
+    UINT64_C( 1475819125669281104), UINT64_C( 3681764954359946174), UINT64_C( 2359172028487141714),
+    UINT64_C( 4391484029099455865), UINT64_C( 1839325932449358448), UINT64_C( 3363438344182436711),
+    UINT64_C(  714011629040165201), UINT64_C(  637214865877033498), UINT64_C( 2340815835249833713),
+    UINT64_C(  671848929723272354), UINT64_C(  237420505140017849), UINT64_C( 4568552542522180308),
+    UINT64_C(  102044630754792870), UINT64_C( 1915098747908485984), UINT64_C( 1025542599384871972),
+    UINT64_C( 1740988286653475439), UINT64_C(  300325005450496587), UINT64_C( 1062980916795007280),
+    UINT64_C(  586576035178648987), UINT64_C( 3941366512545953573), UINT64_C(  393025094498857442),
+    UINT64_C( 1834229959573024403), UINT64_C(  437025389401016125), UINT64_C( 3611222229326003382),
+    UINT64_C( 3841984086170630355), UINT64_C( 3801013888712089268), UINT64_C( 4548081846662005896),
+    UINT64_C( 1045683455419311943), UINT64_C( 1241315471063433917), UINT64_C( 1799169842388507721),
+    UINT64_C( 4536483755510381051), UINT64_C( 2361640686087155182), UINT64_C( 2257676497704087716),
+    UINT64_C( 2022607847542890165), UINT64_C( 1566147706912213219), UINT64_C(  752670247881376625),
+    UINT64_C( 2270834688869068665), UINT64_C( 1640823708549587678), UINT64_C( 4139305653044751572),
+    UINT64_C( 4164661300876465054), UINT64_C( 3923524735499515412), UINT64_C(  547552626336967870),
+    UINT64_C( 3814193870696449291), UINT64_C( 1709175379494813859), UINT64_C(   53053828199897781),
+    UINT64_C(  665248401952498592), UINT64_C(  584328307393442377), UINT64_C( 3532777341412930755),
+    UINT64_C( 1040247579802031329), UINT64_C( 4368306431450818971), UINT64_C( 4297381624151009309),
+    UINT64_C( 4188177932392580727), UINT64_C( 2759042918974896475), UINT64_C( 2924482324866602752),
+    UINT64_C( 1676974938564726196), UINT64_C(  482975691298792303), UINT64_C( 2073889272417520864),
+    UINT64_C( 1864394216060531723), UINT64_C(  822496120599602391), UINT64_C( 4502812500628729457),
+    UINT64_C( 2213462601823254413), UINT64_C( 2684094663179899115), UINT64_C( 2695874774151910019),
+    UINT64_C(  871412714462055863), UINT64_C( 3028216316706702180), UINT64_C( 2645472977297382970),
+    UINT64_C(  260943941076539171), UINT64_C( 1518481817467565289), UINT64_C( 4097512091411382626),
+    UINT64_C( 2122521268732846276), UINT64_C( 1182808904748102976), UINT64_C( 3083464026109839675),
+    UINT64_C( 1709817511219879384), UINT64_C( 1431800154381700758), UINT64_C(  261103275488158652),
+    UINT64_C( 1552311879008992123), UINT64_C( 3118579606097479139), UINT64_C( 3845846568153344738),
+    UINT64_C( 2653290719935361111), UINT64_C( 1788302603633971284), UINT64_C( 1643252510097770258),
+    UINT64_C( 2457181420698271427), UINT64_C( 2178364526979483139), UINT64_C(  507530730249025784),
+    UINT64_C(  104240754812533046), UINT64_C( 4590347174107331982), UINT64_C( 1362452282111165124),
+    UINT64_C(  410816958896292181), UINT64_C( 4443473892469001069), UINT64_C(  809983963243927422),
+    UINT64_C(  476664612668647004), UINT64_C(  511292005236633552), UINT64_C(  503343524324188877),
+    UINT64_C( 2083803552561725751), UINT64_C( 2746805877370733560), UINT64_C( 1551229684457282409),
+    UINT64_C( 1223121600731494170), UINT64_C(                   0), UINT64_C(12056949092800237063),
+    UINT64_C( 7603858705401938139), UINT64_C(15399314395201706410), UINT64_C(16095585161216792975),
+    UINT64_C(  935015860473793947), UINT64_C( 5044858856783534954), UINT64_C(10704841052939819994),
+    UINT64_C(14823511509961865041), UINT64_C( 6801747814650478768), UINT64_C( 3527826048668878276),
+    UINT64_C( 3770047066528861307), UINT64_C(10837856322613628300), UINT64_C( 8186794253328016406),
+    UINT64_C( 9562219288038263513), UINT64_C(13817741599934505432), UINT64_C( 8272674114655418646),
+    UINT64_C( 9300257820891667993), UINT64_C(  524524789911762958), UINT64_C(13700435474456645115),
+    UINT64_C(12070056983459514179), UINT64_C(15606678242288721550), UINT64_C(15958330216678504264),
+    UINT64_C( 3663876260517275405), UINT64_C( 6636974752260600928), UINT64_C( 7403630015146204752),
+    UINT64_C(14685068185283478013), UINT64_C(  939236246125912135), UINT64_C( 4645877627644259550),
+    UINT64_C( 5629106033785832752), UINT64_C( 7518592205968233530), UINT64_C(15890526987243620945),
+    UINT64_C(18363187131404708859), UINT64_C(10760032883403366612), UINT64_C(15323230751358392006),
+    UINT64_C(13485945174540913643), UINT64_C(15478691441689093085), UINT64_C( 9999053415530750839),
+    UINT64_C(15545093430797142494), UINT64_C(10629753139159135763), UINT64_C( 9748677097063844747),
+    UINT64_C(16223430760769901807), UINT64_C(17008713017796795127), UINT64_C( 4875079671801458261),
+    UINT64_C(12970158159567782300), UINT64_C( 3082018651885430046), UINT64_C( 8488069535807066230),
+    UINT64_C( 5390052140868347301), UINT64_C(14204288525935746332), UINT64_C( 3392776274373824360),
+    UINT64_C(13508975171084961660), UINT64_C( 4177604586827430670), UINT64_C(13454734720994210547),
+    UINT64_C(12449341400208309288), UINT64_C( 7441811111581718715), UINT64_C(  557960310548722281),
+    UINT64_C( 5022945591500869479), UINT64_C( 5929482543053587160), UINT64_C( 2771923343720792784),
+    UINT64_C(17772190152077797184), UINT64_C( 9870433017619998234), UINT64_C( 9968757564490533415),
+    UINT64_C( 7480107884525257642), UINT64_C( 8374169019430200033), UINT64_C(16180954858396087424),
+    UINT64_C(16039538274196874157), UINT64_C( 3699304671320783718), UINT64_C( 4495506554501186747),
+    UINT64_C( 1305369207991983600), UINT64_C( 5952147050561432186), UINT64_C( 1096610553773161688),
+    UINT64_C(17567959471736915475), UINT64_C(12693002747400477502), UINT64_C(13039109273954694652),
+    UINT64_C(15353062762322865644), UINT64_C(  854137335714707916), UINT64_C( 2378088898928169980),
+    UINT64_C( 9118791839529518139), UINT64_C( 2385024958896746858), UINT64_C( 8248728081686549269),
+    UINT64_C( 4531945126003614861), UINT64_C(12908748873725960096), UINT64_C( 2131574955856399208),
+    UINT64_C( 2741600703405278016), UINT64_C(17320848506065100368), UINT64_C(10873224313681512109),
+    UINT64_C(10872822215124667463), UINT64_C( 7882823365203995373), UINT64_C( 1549634253303188093),
+    UINT64_C(11526461319678639460), UINT64_C( 6440255585648176779), UINT64_C(11800645485649669227),
+    UINT64_C(17484831985982624781), UINT64_C( 4475772722859079995), UINT64_C( 3283009077575642824),
+    UINT64_C(   53027213440924003), UINT64_C( 7073441495741033812), UINT64_C( 1059934365190267585),
+    UINT64_C(12861782840510144670), UINT64_C(11206654282706656445), UINT64_C( 3866536531466683071),
+    UINT64_C( 6917212468786927852), UINT64_C( 6545861174197572826), UINT64_C( 9673016006498685746),
+    UINT64_C(15661714981525014251), UINT64_C(  311650362020626222), UINT64_C( 8252238387093709242),
+    UINT64_C( 3476695533994548434), UINT64_C(10376839016181397876), UINT64_C(13963486138935630568),
+    UINT64_C(17369516751451888769), UINT64_C( 4025410504784720247), UINT64_C( 4581692930448803892),
+    UINT64_C( 7505153196371828040), UINT64_C( 1025978483713168327), UINT64_C( 1543083031633856797),
+    UINT64_C(10882197785983543072), UINT64_C(15519682344957746721), UINT64_C(11783439202461196635),
+    UINT64_C( 8298327092713519831), UINT64_C(  795028493834076427), UINT64_C(17303987744167040597),
+    UINT64_C( 4421013741595730431), UINT64_C( 5200842723427622792), UINT64_C(14498363592526867533),
+    UINT64_C( 3810508832414219537), UINT64_C(  788773449283363516), UINT64_C(  461169995765932576),
+    UINT64_C(17591714041449082671), UINT64_C(10487169474399915347), UINT64_C(17063746427376064836),
+    UINT64_C( 3702864191111446583), UINT64_C(11565803673056906512), UINT64_C( 6333410354478878381),
+    UINT64_C(14150460357275822369), UINT64_C( 1054550973629380135), UINT64_C(17392144101620672248),
+    UINT64_C( 5912670226056224838), UINT64_C( 6476077475534711122), UINT64_C( 8856853734920706443),
+    UINT64_C(16024157607726461142), UINT64_C( 3838793860466319591), UINT64_C(11337322928032803032),
+    UINT64_C(  500661425114548745), UINT64_C( 4969161675331233633), UINT64_C( 3172978149511685375),
+    UINT64_C(14149328764061573648), UINT64_C( 1097344932148957668), UINT64_C( 8564489954378429807),
+    UINT64_C(  872608656828928266), UINT64_C( 9278499731587959531), UINT64_C(16091071015128687689),
+    UINT64_C(18236458769399661608), UINT64_C( 8803131986562446677), UINT64_C( 3267115454208414131),
+    UINT64_C( 9676124438746293817), UINT64_C( 6210088696389294386), UINT64_C( 3491598857544930719),
+    UINT64_C(16831094245963614355), UINT64_C(18229139094109548769), UINT64_C( 6543765375770076288),
+    UINT64_C( 1555010984183863935), UINT64_C( 3189191896661910410), UINT64_C( 8898115076940412253),
+    UINT64_C(  519243668578310200), UINT64_C(14780950571222436065), UINT64_C( 7670031648500858558),
+    UINT64_C(  347876932367493747), UINT64_C(10371518997718156574), UINT64_C( 3068156232798275191),
+    UINT64_C(17531041394046458963), UINT64_C( 9233368836610809262), UINT64_C(10964969827720034861),
+    UINT64_C( 6118270360949384774), UINT64_C( 3781539743790695007), UINT64_C(11893316251598238776),
+    UINT64_C( 5920132444702412610), UINT64_C(10155112748119555389), UINT64_C( 9379350031379565491),
+    UINT64_C(10387204097729262679), UINT64_C(10751118631995671312), UINT64_C(16542916448154141504),
+    UINT64_C(  819585434212381271), UINT64_C(14864663113733128514), UINT64_C(10949120766879761863),
+    UINT64_C( 6530988684136536054), UINT64_C( 6344135347345683345), UINT64_C(14885559721030270348),
+    UINT64_C( 3807710096486065111), UINT64_C( 9248524634501061960), UINT64_C(  936166740933033792),
+    UINT64_C( 4633466802283352697), UINT64_C( 9968029947273057815), UINT64_C( 3970542096867280507),
+    UINT64_C(11345110729558017594), UINT64_C(16432311755922067923), UINT64_C( 3970765379799260900),
+    UINT64_C( 3608762760598285911), UINT64_C(14390319241434363093), UINT64_C(10491458060616351836),
+    UINT64_C( 6950795527915050192), UINT64_C(18176687840881555628), UINT64_C( 1470840994654283480),
+    UINT64_C(13482461935711286302), UINT64_C(15063437242703570969), UINT64_C(16444609083007748892),
+    UINT64_C(13080675063835488736), UINT64_C( 7396643017915243258), UINT64_C( 6607473285056421255),
+    UINT64_C(12999870972329895437), UINT64_C(17714177090965904433), UINT64_C(12688264603134112379),
+    UINT64_C( 7319294368875455069), UINT64_C(11615029927461391060), UINT64_C( 4394342138638275529),
+    UINT64_C(17437301007334629297), UINT64_C( 8023190261630392515), UINT64_C(15142608226500847568),
+    UINT64_C( 8237529382254686174), UINT64_C(14728510627181674741), UINT64_C( 4215584393657131024),
+    UINT64_C( 8886449909830682420), UINT64_C(14656129054190166051), UINT64_C(16547071473305671052),
+    UINT64_C( 2639681960449907978), UINT64_C(16412071153753638257), UINT64_C(11793435634082451524),
+    UINT64_C(16888525546311936260), UINT64_C( 2783090654961380186), UINT64_C(14555047047361242149),
+    UINT64_C(17082266855006719086), UINT64_C(18167820998420103977), UINT64_C(10622473298289909284),
+    UINT64_C( 2479959339141346850), UINT64_C(17159814169809758949), UINT64_C( 1789715612861379618),
+    UINT64_C(11888728375223892849), UINT64_C(14372054492503594768), UINT64_C( 7491448803264988693),
+    UINT64_C( 4206878692201856385), UINT64_C(11316930621535193020), UINT64_C(14922703530856633565),
+    UINT64_C( 1161365655305589260), UINT64_C(  197273935104393427), UINT64_C( 2537190792027621301),
+    UINT64_C(  601324993980182841), UINT64_C( 3765903746025108887), UINT64_C(15065258283318028178),
+    UINT64_C(  321258353817470781), UINT64_C(12344888121779638533), UINT64_C(16140506472986348266),
+    UINT64_C( 7370462449473453990), UINT64_C(15539449267741275110), UINT64_C(11759901578089697684),
+    UINT64_C( 8310393855344440966), UINT64_C(17407027603865055777), UINT64_C( 9602846956479447923),
+    UINT64_C( 5667918344191683126), UINT64_C(14117959256177033806), UINT64_C( 4542748570644371862),
+    UINT64_C( 9290912606262456587), UINT64_C( 9476268215771775505), UINT64_C(  125472715915699032),
+    UINT64_C(13744057052302847580), UINT64_C( 3607439390457286989), UINT64_C( 4862741898691333125),
+    UINT64_C( 2328354172498632485), UINT64_C(13949971877488132886), UINT64_C( 5986079315466035276),
+    UINT64_C(12234585914450636767), UINT64_C( 5862887961914224506), UINT64_C( 8430607304627957289),
+    UINT64_C( 3939402899076868167), UINT64_C(14578072550792146382), UINT64_C(  966038993749216230),
+    UINT64_C( 1533219135734455393), UINT64_C( 6512734330744205793), UINT64_C(12459036914853834151),
+    UINT64_C(16955334721617248426), UINT64_C( 2752105641152902035), UINT64_C( 3292228085055616561),
+    UINT64_C( 9305647423279991015), UINT64_C( 4367656130668521006), UINT64_C( 9187800080958000100),
+    UINT64_C( 2429349674943213890), UINT64_C( 5868988404886768768), UINT64_C( 5271684421725027866),
+    UINT64_C( 4667361650167804322), UINT64_C(14470096555450574343), UINT64_C(11038004800741559898),
+    UINT64_C( 6343955911785279236), UINT64_C(  738109188503114701), UINT64_C( 8849439785483709399),
+    UINT64_C( 4530560230706862402), UINT64_C(13210549944369006430), UINT64_C(  188961923039573355),
+    UINT64_C( 1887599300156476464), UINT64_C(17721863723874693219), UINT64_C(12003543614812927806),
+    UINT64_C(16617408739396911080), UINT64_C( 1551597112537180207), UINT64_C(10688843203285356036),
+    UINT64_C(13582926280524164425), UINT64_C(17586981671612696228), UINT64_C(18368333938429795364),
+    UINT64_C( 6569974105238481044), UINT64_C(17183502351505418941), UINT64_C(12390390992663781044),
+    UINT64_C(11278357194196069992), UINT64_C( 3789755731604709772), UINT64_C(16193017111473049863),
+    UINT64_C(14453374932827432077), UINT64_C( 7336887022054615054), UINT64_C( 3893111894527135492),
+    UINT64_C( 6458191046505403946), UINT64_C( 4338955959068088070), UINT64_C(14369402153897784231),
+    UINT64_C( 8082908416152454263), UINT64_C( 9529370175764584176), UINT64_C( 5239300063889875572),
+    UINT64_C( 6376862649565533805), UINT64_C( 8003432860277307338), UINT64_C(17324557178567522610),
+    UINT64_C( 1330298739888944034), UINT64_C(18422282258182957116), UINT64_C( 5321389092124268745),
+    UINT64_C(13846480860139137760), UINT64_C(17419859448367223267), UINT64_C(15102524632494762308),
+    UINT64_C( 6034938327916716503), UINT64_C( 6871640657593842650), UINT64_C( 4868268448436120804),
+    UINT64_C(14816598902352938915), UINT64_C(17697746349523838121), UINT64_C( 3913052082319431210),
+    UINT64_C(13926460409032238015), UINT64_C( 8675113891999301343), UINT64_C(16292677096923504089),
+    UINT64_C(10140245690203043896), UINT64_C( 9480198028036369348), UINT64_C(16198056512885989147),
+    UINT64_C( 1756429982686777271), UINT64_C(12447719805480597392), UINT64_C( 4717271041721914770),
+    UINT64_C( 2261616490505124707), UINT64_C( 7199333321024337251), UINT64_C( 6706163976304547842),
+    UINT64_C( 9192349565559341318), UINT64_C( 4948623550341113988), UINT64_C(15767305353160295859),
+    UINT64_C(17126632556543467083), UINT64_C(14162478374258610152), UINT64_C(10747217473793532729),
+    UINT64_C( 9979538736748343391), UINT64_C(11862938250978756171), UINT64_C(13784932478307097156),
+    UINT64_C( 8808085392561101057), UINT64_C( 6372069586962265614), UINT64_C(13119655260921301214),
+    UINT64_C(13147272237777937725), UINT64_C( 4563935455468076809), UINT64_C(  832719281874824623),
+    UINT64_C( 3484060994537231902), UINT64_C( 5493163318119734736), UINT64_C(14149388754851666868),
+    UINT64_C(17932854778881714965), UINT64_C( 2443442121860501859), UINT64_C( 2785260984327796541),
+    UINT64_C(12401504102449096566), UINT64_C( 5448206815114747329), UINT64_C(18316074093477273757),
+    UINT64_C(  359607749038097788), UINT64_C(16960425789927278755), UINT64_C(14073413096506793773),
+    UINT64_C( 9488509130365842669), UINT64_C(18076066453633225829), UINT64_C(15876439695440582360),
+    UINT64_C(17576901787089669935), UINT64_C( 6438206226729947589), UINT64_C(  911684297462759661),
+    UINT64_C( 7721280331879501728), UINT64_C( 4902651124888029448), UINT64_C(15209656065600699099),
+    UINT64_C(16517787619254982173), UINT64_C(16642113286809151228), UINT64_C( 9020936916954214989),
+    UINT64_C( 3060233673408366092), UINT64_C(  665876440616848172), UINT64_C(   77515901797299646),
+    UINT64_C(15614815431922971966), UINT64_C( 7455367607192530677), UINT64_C( 5437578786548275401),
+    UINT64_C( 5785284834068479863), UINT64_C( 8056168847574777768), UINT64_C( 5969080232253428645),
+    UINT64_C( 5463891452903539353), UINT64_C( 9817439620703570771), UINT64_C( 2017450483330716714),
+    UINT64_C( 5915223618629138346), UINT64_C(10712916462524945838), UINT64_C(13945232710941063247),
+    UINT64_C(16382213873157961999), UINT64_C(13951624053902370410), UINT64_C(17557290881224337871),
+    UINT64_C(12596053436503882636), UINT64_C(13527606189738634283), UINT64_C( 3848617669525510451),
+    UINT64_C( 1065815862314093518), UINT64_C(14467920957679420804), UINT64_C( 2261671814374445307),
+    UINT64_C( 7953484326609285118), UINT64_C(16148459356260331217), UINT64_C( 4960775307004705376),
+    UINT64_C(17065705830290878557), UINT64_C(  980069967993924235), UINT64_C( 1043865641870663483),
+    UINT64_C(15864413509363240641), UINT64_C( 6703581584335318649), UINT64_C( 3916899342837777657),
+    UINT64_C(14498342048305367048), UINT64_C( 7800384383729364671), UINT64_C( 1156400784671394972),
+    UINT64_C(15836611207929314978), UINT64_C(13384887033766634982), UINT64_C( 9467468822029328010),
+    UINT64_C(14030469621276462351), UINT64_C(  547084928892834156), UINT64_C( 1960318914764717743),
+    UINT64_C( 2174659133622257154), UINT64_C( 1933225932853372003), UINT64_C( 2043226222224532012),
+    UINT64_C(12528668053321317815), UINT64_C(13710478091613637420), UINT64_C(16653935568708848598),
+    UINT64_C(  623149655051625567), UINT64_C( 4120863860219831105), UINT64_C(14673893254291298962),
+    UINT64_C(13878605502829445089), UINT64_C(17528817113587444876), UINT64_C(18093492068615509934),
+    UINT64_C( 4253512507409266577), UINT64_C( 4924833599096014188), UINT64_C(17383344486556161385),
+    UINT64_C( 6753169997552062559), UINT64_C(  737773358452074895), UINT64_C( 1108377620566694398),
+    UINT64_C(14101993328870745896), UINT64_C(14592455144799048236), UINT64_C(17915016298027692154),
+    UINT64_C( 2505190362012770037), UINT64_C(13478968505213928753), UINT64_C( 6790976695889620404),
+    UINT64_C( 6152375959768026464), UINT64_C( 1918353867783673018), UINT64_C( 3395905850746651040),
+    UINT64_C( 7418090573129253935), UINT64_C(12064813699278939161), UINT64_C(16140544552307408190),
+    UINT64_C( 6933831043195668658), UINT64_C( 1324032285132800459), UINT64_C( 7124707266952677798),
+    UINT64_C(11658038276153450306), UINT64_C( 4977363436130901249), UINT64_C( 5210190366580344902),
+    UINT64_C( 3108156558539612522), UINT64_C(14125538175393468679), UINT64_C( 9261514582424403488),
+    UINT64_C( 5447045847552290979), UINT64_C(12580089363017589374), UINT64_C( 8294403423437598124),
+    UINT64_C(16334008992497835247), UINT64_C(12165520521951490185), UINT64_C(15824546467527834495),
+    UINT64_C( 7498451141298770696), UINT64_C( 7379563882259490631), UINT64_C( 2824578879199047561),
+    UINT64_C( 8140712773885988125), UINT64_C( 9849271684484259143), UINT64_C(16763876526171700003),
+    UINT64_C( 5106439282578037771), UINT64_C(10905297447288144061), UINT64_C(12343259230553480845),
+    UINT64_C( 5731007217301644630), UINT64_C(12314528772095401417), UINT64_C(10946872264133666568),
+    UINT64_C(13419689232334614092), UINT64_C( 3753746119953759424), UINT64_C( 8367772565428591454),
+    UINT64_C( 3926495866587298520), UINT64_C( 2723905631336572781), UINT64_C(12532204829496819920),
+    UINT64_C( 5336432563854953615), UINT64_C( 6316949314195301248), UINT64_C( 3509415609112782850),
+    UINT64_C(15297166958091227027), UINT64_C( 8549773958593912651), UINT64_C( 3671177558198870464),
+    UINT64_C( 1006354190660639475), UINT64_C(10707439233023848579), UINT64_C(10939261971405398967),
+    UINT64_C(10969861733074502397), UINT64_C( 1941964541131184210), UINT64_C(14882763651574308198),
+    UINT64_C( 5836706508962576318), UINT64_C(12750410154721500074), UINT64_C(12660881173349229513),
+    UINT64_C( 4129505073859615839), UINT64_C(15952902380303482074), UINT64_C( 8373056217427819556),
+    UINT64_C(15126797936803265022), UINT64_C(17905190626120093514), UINT64_C(13898863385969287844),
+    UINT64_C( 5930391518186136196), UINT64_C( 8330857898088405278), UINT64_C(11815276497781192690),
+    UINT64_C(11981202722840878421), UINT64_C(16719581777725674339), UINT64_C( 5970965429595398574),
+    UINT64_C(14207121610923912878), UINT64_C( 8285409367283538124), UINT64_C(17653675155999026642),
+    UINT64_C( 9746231033302730216), UINT64_C( 1037310574103833667), UINT64_C( 5430183856594337825),
+    UINT64_C( 4925170185553216082), UINT64_C( 5580720465302160192), UINT64_C( 6541133209642207219),
+    UINT64_C( 4739604504500285163), UINT64_C( 8609425257138058203), UINT64_C(12007042063989439155),
+    UINT64_C( 3252341392079923634), UINT64_C( 7896696732174124269), UINT64_C(16025391431818531292),
+    UINT64_C(12050515971011854927), UINT64_C(15865784930208123596), UINT64_C(12008824120262547024),
+    UINT64_C(  824054077843172729), UINT64_C(16300145960930671166), UINT64_C(12614015486442593852),
+    UINT64_C( 7753999093236257596), UINT64_C(16357295256867904133), UINT64_C( 9564246980960736107),
+    UINT64_C( 4285057927966942831), UINT64_C( 2792763276567117529), UINT64_C(13900194176668962871),
+    UINT64_C( 5911749743687958637), UINT64_C(14141858864956707779), UINT64_C( 7846098708733628534),
+    UINT64_C(15351321179563055439), UINT64_C( 7484842278338045925), UINT64_C(12715393057058349627),
+    UINT64_C(14156789853548899404), UINT64_C( 6701597623378035291), UINT64_C(10206190507408971898),
+    UINT64_C( 2978022707271824146), UINT64_C(15022541378114048633), UINT64_C(  911725458938768721),
+    UINT64_C(17794446335325806377), UINT64_C( 2746454911400926967), UINT64_C( 1036628359768327579),
+    UINT64_C( 1515928614293987908), UINT64_C(10221761546112972278), UINT64_C(14816899046242453361),
+    UINT64_C(  239837828209793491), UINT64_C( 2473627587695209103), UINT64_C( 5639345486546188850),
+    UINT64_C( 6400067016917510858), UINT64_C( 3336743788673397739), UINT64_C(10213297413099349601),
+    UINT64_C(12865592666668632813), UINT64_C( 6430449184797198779), UINT64_C( 1411938575094001772),
+    UINT64_C(16942269677662444502), UINT64_C(10990467185589572997), UINT64_C(10310357411271962663),
+    UINT64_C( 1143621629633695798), UINT64_C(12692838254627964761), UINT64_C( 7801513356536769344),
+    UINT64_C( 2441288306680260653), UINT64_C(14550820960426165381), UINT64_C(12739671913903669190),
+    UINT64_C(12413489301082987140), UINT64_C( 5996394210777847030), UINT64_C(17230223897672128941),
+    UINT64_C( 8508984984904399448), UINT64_C( 7298128206561367785), UINT64_C(11575053059181420137),
+    UINT64_C(12193460625465991590), UINT64_C(12509139882995094288), UINT64_C(16556097650059827964),
+    UINT64_C( 9879726239071217540), UINT64_C(10422574867840415811), UINT64_C( 5890054540384645527),
+    UINT64_C( 7124084879991515427), UINT64_C( 4156620687630749680), UINT64_C(15693844780780885248),
+    UINT64_C( 8150533521210920481), UINT64_C( 7804177519953886313), UINT64_C( 4801455286200136077),
+    UINT64_C( 2557288544972232843), UINT64_C(10380674653547766907), UINT64_C(17456721261252940743),
+    UINT64_C(11467144595354358986), UINT64_C(12624009585195477009), UINT64_C( 3777097241632474562),
+    UINT64_C(14916800100551778493), UINT64_C(10671270586994043502), UINT64_C( 6929706982188710873),
+    UINT64_C( 3924284382128356753), UINT64_C(12096795615639418569), UINT64_C(12949176509460920737),
+    UINT64_C( 9380153671389246599), UINT64_C( 6191942233307939162), UINT64_C( 5933525809827352775),
+    UINT64_C(15733894979453017444), UINT64_C( 4667893837766861705), UINT64_C(16992123632273074506),
+    UINT64_C(17823438571394630199), UINT64_C(12636647005183370839), UINT64_C(  951889974249856709),
+    UINT64_C( 9766774256037223224), UINT64_C( 1428723339400848002), UINT64_C( 3510638843789557276),
+    UINT64_C( 6712091548068053878), UINT64_C( 2449331443075216304), UINT64_C(18067653865425490368),
+    UINT64_C( 7521741890797958821), UINT64_C(12229437747405130509), UINT64_C(10715198876153193381),
+    UINT64_C( 2673276434337600422), UINT64_C( 6475611582507836503), UINT64_C( 4407035048474114199),
+    UINT64_C(15906584175517860955), UINT64_C(11172324337055551674), UINT64_C( 8586857043833473996),
+    UINT64_C(11411899545270481576), UINT64_C(13798244950518034269), UINT64_C( 4283988580237797562),
+    UINT64_C( 1431344154842419387), UINT64_C( 7942815107633099374), UINT64_C( 8944829904439826997),
+    UINT64_C(17043308572883239348), UINT64_C( 7480347819984557067), UINT64_C( 2235290499422831350),
+    UINT64_C(  599784477080212201), UINT64_C(14614171396422252042), UINT64_C(10954308280831489033),
+    UINT64_C(11072113752015491480), UINT64_C( 5559056832638987846), UINT64_C(16200086694824203705),
+    UINT64_C(11702714626289073797), UINT64_C( 9794722546974025800), UINT64_C( 1622862395098533211),
+    UINT64_C(  131265627633903349), UINT64_C( 7398648602236479204), UINT64_C( 8755845864504179094),
+    UINT64_C(13441048422383259544), UINT64_C(  289215475778954292), UINT64_C( 4482138428697429398),
+    UINT64_C(12584736886107011685), UINT64_C(14011490922247526450), UINT64_C(11699894849544758567),
+    UINT64_C( 1477399764885353504), UINT64_C( 7455526986573760574), UINT64_C( 3987259833217350680),
+    UINT64_C( 6397346354424307417), UINT64_C( 3153018427086294309), UINT64_C(13068285012217038483),
+    UINT64_C( 8444217140203167188), UINT64_C(17574234019921630813), UINT64_C( 7295731723276117165),
+    UINT64_C( 8023136602447561243), UINT64_C( 6972705761147066208), UINT64_C( 1279595564790310874),
+    UINT64_C( 7275859734774918168), UINT64_C( 4537591737387369973), UINT64_C( 6649798623492651382),
+    UINT64_C(17371092351532966665), UINT64_C(11108732463314901175), UINT64_C(10445195075283713786),
+    UINT64_C(10891254974806572433), UINT64_C(11041067204403314337), UINT64_C(13584469951537789608),
+    UINT64_C( 1210681595971310713), UINT64_C(15369050780427018610), UINT64_C( 6941695329931751416),
+    UINT64_C(14998187401423670562), UINT64_C( 4287311877302485106), UINT64_C( 6137598042805338976),
+    UINT64_C(10094029035896599106), UINT64_C( 4106310880169984054), UINT64_C(14087367814570860617),
+    UINT64_C( 6159396215089295907), UINT64_C( 6659111661727651544), UINT64_C( 2620899151970030674),
+    UINT64_C(18191907373280484563), UINT64_C( 1292072186242049383), UINT64_C( 1596612486871390407),
+    UINT64_C( 4850211518002750932), UINT64_C(   89732914904733342), UINT64_C(  810144254221345025),
+    UINT64_C(15304499654716889650), UINT64_C( 7816986820672653376), UINT64_C(11586202706244607731),
+    UINT64_C( 4500078798259504633), UINT64_C( 9803416914218927043), UINT64_C(17265631618894391106),
+    UINT64_C( 3577274089969928962), UINT64_C( 5798277026984550011), UINT64_C(16014177922840635045),
+    UINT64_C(17312833212029112005), UINT64_C( 6215850367509488918), UINT64_C(11222817109590317028),
+    UINT64_C(10040995672104521067), UINT64_C(16462879005270680681), UINT64_C( 7563996737842373272),
+    UINT64_C(15115919454504731573), UINT64_C(14488828405170922954), UINT64_C( 7651763859654080881),
+    UINT64_C( 1202911583472776867), UINT64_C( 6458138319725607598), UINT64_C(11289531030565251818),
+    UINT64_C(14228051483764087456), UINT64_C(  441724510495439341), UINT64_C(12618725195220792199),
+    UINT64_C(16662032157473884590), UINT64_C( 3982033787021150967), UINT64_C( 7328731621589561683),
+    UINT64_C( 7826839566879211528), UINT64_C(16724660867453047868), UINT64_C(17552460810699561935),
+    UINT64_C( 2282682874809012142), UINT64_C( 7403240315427292727), UINT64_C(16410527434012319149),
+    UINT64_C( 9885934878371744346), UINT64_C(13360716326733893595), UINT64_C( 7307681789295085364),
+    UINT64_C( 8996415895360007689), UINT64_C(10676950429226477906), UINT64_C( 2636518938254436902),
+    UINT64_C(17767262356834231844), UINT64_C(10215085194368579274), UINT64_C( 3342930280299466837),
+    UINT64_C( 8965090696029594300), UINT64_C( 9687123441177515383), UINT64_C(15389770986524806559),
+    UINT64_C( 3597685243529049533), UINT64_C(12005528462254258084), UINT64_C(10005163990999129040),
+    UINT64_C(10583448698248347269), UINT64_C(10692164911757845340), UINT64_C(15201423768858637267),
+    UINT64_C(13040751660662632889), UINT64_C( 1245148030991108190), UINT64_C(17606287665657618970),
+    UINT64_C(16172794632374993248), UINT64_C(  483938609699062743), UINT64_C( 6159651242598377708),
+    UINT64_C( 2290173523657045834), UINT64_C(18350756442707523147), UINT64_C( 7038669173086417254),
+    UINT64_C(13696611270483121504), UINT64_C(16985207735470877648), UINT64_C(16210762125076920541),
+    UINT64_C( 6698862770241041454), UINT64_C( 1251406297075790700), UINT64_C( 2742465452130275432),
+    UINT64_C( 5414172013259459926), UINT64_C( 1731039687345605915), UINT64_C(12017188121623256449),
+    UINT64_C( 9231930034126358091), UINT64_C(13107066738142579628), UINT64_C( 7638049629860970826),
+    UINT64_C(16139348109044318108), UINT64_C(10022863711423162035), UINT64_C( 4533030983864215270),
+    UINT64_C(15766479519158062551), UINT64_C( 2931153500698604301), UINT64_C(14144032481446453418),
+    UINT64_C(11150421375911460527), UINT64_C(15105434905807134634), UINT64_C( 2158061103659792645),
+    UINT64_C( 7917286077122689122), UINT64_C(13687537131706229428), UINT64_C( 3508225503417475052),
+    UINT64_C( 7408652177688787809), UINT64_C(11272734441078557364), UINT64_C(12824633042826621957),
+    UINT64_C( 5329860512199736343), UINT64_C( 6281042372003120553), UINT64_C(10794918921151006710),
+    UINT64_C(12379259596654137201), UINT64_C( 9131946823569255203), UINT64_C(13458775482751918750),
+    UINT64_C(13278932510813608532), UINT64_C(11445274915387499627), UINT64_C(17862392449225813865),
+    UINT64_C(17194215808852409049), UINT64_C( 6972705595924076928), UINT64_C(15318903860884777685),
+    UINT64_C( 9008024179232410766), UINT64_C(15640135057900751766), UINT64_C( 8221972396247461658),
+    UINT64_C(   54651202068870986), UINT64_C(16625156105464636381), UINT64_C( 5790045855873906547),
+    UINT64_C(12840965660204203393), UINT64_C( 8147775746903272951), UINT64_C(18312475996635022016),
+    UINT64_C(12913867340040444877), UINT64_C( 1950144649032179149), UINT64_C(11069253639158500682),
+    UINT64_C(12208751594739372444), UINT64_C( 4155187505536121601), UINT64_C( 8662549814921257574),
+    UINT64_C( 6943287977729844012), UINT64_C(14191467525787800385), UINT64_C(18429688868187810760),
+    UINT64_C( 9393556102024450993), UINT64_C(13416001486052185786), UINT64_C( 4373099423799919029),
+    UINT64_C( 8180406820005097239), UINT64_C( 1220912568590502635), UINT64_C( 8513907850976088172),
+    UINT64_C(  532736583286742642), UINT64_C( 5659986618530345787), UINT64_C(11624239542569073849),
+    UINT64_C(14447389628437906976), UINT64_C(16394146184349802137), UINT64_C( 2443612187522262472),
+    UINT64_C(16741900092146899708), UINT64_C( 6641279640821327081), UINT64_C(10725024231431739169),
+    UINT64_C(14419067265579660617), UINT64_C(18170846344674679032), UINT64_C(11563057884044584114),
+    UINT64_C( 8189117245031129621), UINT64_C( 8124372993710713725), UINT64_C(14038317690689165301),
+    UINT64_C(  579544474891150326), UINT64_C( 5190704113911164995), UINT64_C( 7240052295555689957),
+    UINT64_C(   59450638863571678), UINT64_C(11461061438621376504), UINT64_C(16211645381002431714),
+    UINT64_C( 5998078452482989947), UINT64_C( 6339701180181827427), UINT64_C(14659488089249811784),
+    UINT64_C( 7991126503796808298), UINT64_C( 5785246974115884831), UINT64_C(15571717084816972468),
+    UINT64_C(15172575577190553270), UINT64_C(15325136192247752399), UINT64_C( 8425106910021591802),
+    UINT64_C( 1212585991030832527), UINT64_C(17874098275613267022), UINT64_C( 4506291347483773032),
+    UINT64_C( 9118195903826649896), UINT64_C( 6011844692643917362), UINT64_C( 2363789017395873058),
+    UINT64_C( 9445433476015948906), UINT64_C(10214536674868855859), UINT64_C(13334945544854822302),
+    UINT64_C( 9291685773623224711), UINT64_C(  358473183918624547), UINT64_C(13954054074196509618),
+    UINT64_C(14007389772910240798), UINT64_C(11577412359165999476), UINT64_C( 6937248085333990546),
+    UINT64_C( 2419453459156255822), UINT64_C( 2925867916509358312), UINT64_C( 7799793469812742460),
+    UINT64_C( 5853949695730609935), UINT64_C( 4777057524098981218), UINT64_C(12150237822668473887),
+    UINT64_C( 3181379901196240396), UINT64_C(10283553958280513240), UINT64_C(14399653953375758646),
+    UINT64_C( 9251050775332039089), UINT64_C(13562007108554052883), UINT64_C(15759532560790088201),
+    UINT64_C(15815195230123714597), UINT64_C( 7152221592113705056), UINT64_C(11718718099756544807),
+    UINT64_C(11333182581451119095), UINT64_C(16275388972022807717), UINT64_C( 7675575957508984589),
+    UINT64_C(15583695311793507574), UINT64_C(18025349917767330065), UINT64_C(14247769545255591848),
+    UINT64_C( 7176908050062859797), UINT64_C( 9608043386346694073), UINT64_C(  211008675147977758),
+    UINT64_C( 6924064257920050494), UINT64_C( 3216560040010454452), UINT64_C( 7262211437181347470),
+    UINT64_C( 3684907376539238815), UINT64_C(16620575886320340083), UINT64_C( 7508611454719507433),
+    UINT64_C(16230710793277553283), UINT64_C( 5718787136057921866), UINT64_C( 4797572769299560363),
+    UINT64_C(16709034900708648583), UINT64_C(  120954974510287822), UINT64_C(15097577498169201048),
+    UINT64_C( 8184754025388121928), UINT64_C(11366685258446336799), UINT64_C( 9310607114541432168),
+    UINT64_C( 3086327923299432019), UINT64_C( 5994527017049979325), UINT64_C( 4353204038488323312),
+    UINT64_C( 7819818407264219645), UINT64_C(13088550174427298866), UINT64_C( 9659605862480346636),
+    UINT64_C(18275816384876859185), UINT64_C(15426935041507792420), UINT64_C(13642228192462353531),
+    UINT64_C( 8719867219581702730), UINT64_C(  395062664604122197), UINT64_C( 9035406160272745391),
+    UINT64_C( 7435325639854595743), UINT64_C( 8565412203068433060), UINT64_C( 9878723116412193803),
+    UINT64_C( 3537248514244114466), UINT64_C( 4641294358514570043), UINT64_C( 3652028769078188023),
+    UINT64_C(  683840434269244104), UINT64_C( 5903276502677153252), UINT64_C(14727059817439856634),
+    UINT64_C( 9436688113948612951), UINT64_C(17565936116397909265), UINT64_C( 7357303729797469730),
+    UINT64_C(13453753376729812562), UINT64_C( 2856046516160674755), UINT64_C( 2548859463508146442),
+    UINT64_C( 9363263340999380589), UINT64_C( 2687395718893102543), UINT64_C(  949682020560076034),
+    UINT64_C(18274210170088810497), UINT64_C(  408178523019173473), UINT64_C( 7660394991633981355),
+    UINT64_C( 4102170397539507926), UINT64_C( 6963953146613935773), UINT64_C( 1201300021801992216),
+    UINT64_C( 4251923667180049889), UINT64_C( 2346304140714607409), UINT64_C(15765466050183891302),
+    UINT64_C( 1572100377995437447), UINT64_C( 7336919838292133451), UINT64_C( 1748101557604073039),
+    UINT64_C(14444888917304084087), UINT64_C(15367936344682596488), UINT64_C(15204055554848431340),
+    UINT64_C(18192327386648112449), UINT64_C( 4182733821677268203), UINT64_C( 4965261884253759922),
+    UINT64_C( 7196679369554066038), UINT64_C(18145935022041612842), UINT64_C( 9446562744348666872),
+    UINT64_C( 9030705990816394976), UINT64_C( 8090431390171600179), UINT64_C( 6264590827648883477),
+    UINT64_C( 3010680991525521206), UINT64_C( 9083338755476319029), UINT64_C( 6563294834198382772),
+    UINT64_C(16557222612179087166), UINT64_C(16658645203505941589), UINT64_C(15694098941998138309),
+    UINT64_C( 2190210505347882178), UINT64_C(15256775482785871689), UINT64_C( 6836701517979288831),
+    UINT64_C(  212215312799592160), UINT64_C( 2660993607810007366), UINT64_C( 2337313229573780925),
+    UINT64_C(14131109365651792047), UINT64_C( 4160990319208145641), UINT64_C(17473225725803361236),
+    UINT64_C(17189526496604121202), UINT64_C(16752711729570404741), UINT64_C(11036171675899639809),
+    UINT64_C(11697929299466468149), UINT64_C( 6707899754258937550), UINT64_C( 1931902765195178648),
+    UINT64_C( 8295557089670123977), UINT64_C( 7457576864242163320), UINT64_C( 3289984482398425634),
+    UINT64_C(18011250002515005808), UINT64_C( 8853850407293060900), UINT64_C(10736378652719648904),
+    UINT64_C(10783499096607692750), UINT64_C( 3485650857848240478), UINT64_C(12112865266826867888),
+    UINT64_C(10581891909189583570), UINT64_C( 1043775764306161782), UINT64_C( 6073927269870290825),
+    UINT64_C(16390048365645610565), UINT64_C( 8490085074931426576), UINT64_C( 4731235618992435014),
+    UINT64_C(12333856104439418947), UINT64_C( 6839270044879550944), UINT64_C( 5727200617526831008),
+    UINT64_C( 1044413101952639709), UINT64_C( 6209247516035998822), UINT64_C(12474318424389977490),
+    UINT64_C(15383386272613454096), UINT64_C(10613162879741496286), UINT64_C( 7153210414535920077),
+    UINT64_C( 6573010040391113139), UINT64_C( 9828725682793133719), UINT64_C( 8713458107917975119),
+    UINT64_C( 2030122920996113052), UINT64_C(  416963019250134220), UINT64_C(18361388696429417619),
+    UINT64_C( 5449809128444687117), UINT64_C( 1643267835585176750), UINT64_C(17773895569876091097),
+    UINT64_C( 3239935852975725514), UINT64_C( 1906658450674597329), UINT64_C( 2045168020946544198),
+    UINT64_C( 2013374097296765342), UINT64_C( 8335214210246943719), UINT64_C(10987223509482987909),
+    UINT64_C( 6204918737829159945), UINT64_C( 4892486402926000578),
+};
+
+const uint64_t ntt64_1024_inv_mixed_powers[2048] = {
+    UINT64_C(                   0), UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580),
+    UINT64_C( 2710721342076890128), UINT64_C( 1935475755192423451), UINT64_C( 4377932053308918032),
+    UINT64_C( 3350471304231487799), UINT64_C(  587789728123186789), UINT64_C( 1157250618443755893),
+    UINT64_C( 3669174251795154654), UINT64_C( 2564987455095371273), UINT64_C( 2911249064764753991),
+    UINT64_C( 2221131196417811176), UINT64_C( 3729729506260150116), UINT64_C( 1902221937773971537),
+    UINT64_C(  905808140936917219), UINT64_C(  639054271616479546), UINT64_C( 3695716953298051000),
+    UINT64_C( 4376876956895888490), UINT64_C( 1186577149813220829), UINT64_C( 3204409509980914063),
+    UINT64_C(  710016457855204048), UINT64_C( 2760778514640823230), UINT64_C( 2286621563204459736),
+    UINT64_C( 2732037966935316176), UINT64_C(  622103464257758799), UINT64_C(  940418972106513807),
+    UINT64_C( 4480554820949425278), UINT64_C( 3450216611516306163), UINT64_C( 1594171772562501572),
+    UINT64_C( 2952442330362223250), UINT64_C( 2543517489763520818), UINT64_C( 2518143763569825595),
+    UINT64_C( 3264172983210285134), UINT64_C( 4472195940790185488), UINT64_C( 1954247733637594417),
+    UINT64_C(  168638480407937784), UINT64_C( 3392916100477006765), UINT64_C( 3567284871720512811),
+    UINT64_C( 1240199724792153435), UINT64_C( 2119496627304744197), UINT64_C( 3841181355456011629),
+    UINT64_C( 1499350668375303258), UINT64_C( 2111922664544689878), UINT64_C( 3129315382663975828),
+    UINT64_C(  555828328234909737), UINT64_C( 3763491949833913430), UINT64_C( 1921677797576536864),
+    UINT64_C( 2741659047296060101), UINT64_C( 2489668634475609185), UINT64_C( 2751233240531944786),
+    UINT64_C(  725412660728098737), UINT64_C( 3918705182497170566), UINT64_C(  359507763978187366),
+    UINT64_C( 1234442225656141459), UINT64_C(  780878330587786088), UINT64_C( 2144077764022377872),
+    UINT64_C( 1369146478535435641), UINT64_C( 1248002338178829171), UINT64_C(  742013158005111008),
+    UINT64_C( 3355949620552154141), UINT64_C( 2174516744161416095), UINT64_C( 1060613886943446140),
+    UINT64_C(   20889235576210587), UINT64_C( 4496393519485882796), UINT64_C( 4598429215067134441),
+    UINT64_C( 3605333392231190231), UINT64_C( 2549503998005738133), UINT64_C( 2537104245248995553),
+    UINT64_C( 2640980177126376160), UINT64_C( 2193432016802705753), UINT64_C(  219696150493157962),
+    UINT64_C( 3311475337570466030), UINT64_C( 1661524647014962481), UINT64_C( 3742512134928732514),
+    UINT64_C( 4398151684498689441), UINT64_C( 4225915260518903062), UINT64_C( 3926285842576049221),
+    UINT64_C( 1810022447750714951), UINT64_C( 3487809379802074180), UINT64_C( 3659058810323815146),
+    UINT64_C( 3492742837712600844), UINT64_C( 1120814483693474787), UINT64_C( 2331988058544996978),
+    UINT64_C(  731765432187947649), UINT64_C( 1893379940007000628), UINT64_C( 2882382901230641861),
+    UINT64_C( 3123649255787014599), UINT64_C(  285689082385626359), UINT64_C( 1730070688507719588),
+    UINT64_C( 4533773427922209202), UINT64_C( 1351908699938707637), UINT64_C( 2735397719334417532),
+    UINT64_C( 1384498799995891117), UINT64_C( 4346702427129799775), UINT64_C(  601801449878166425),
+    UINT64_C( 4414492656106525461), UINT64_C( 3790933749033458680), UINT64_C(  269306830564414396),
+    UINT64_C( 4015429778703181575), UINT64_C( 1665826217812080608), UINT64_C( 1893480464646211789),
+    UINT64_C( 2975220724877980164), UINT64_C( 4337533379984076294), UINT64_C( 3506432583028438168),
+    UINT64_C( 3001622122015329047), UINT64_C( 2548626421653948144), UINT64_C(  773420327846667715),
+    UINT64_C( 4355191397499074548), UINT64_C( 4078792279463268178), UINT64_C( 1396240308299844916),
+    UINT64_C( 3686859850597173965), UINT64_C(  987095120295666199), UINT64_C(  240478021931730534),
+    UINT64_C( 2017476264382028580), UINT64_C( 4017163793695325786), UINT64_C( 1891136571931492898),
+    UINT64_C(  281473891911111437), UINT64_C( 3645051885560699331), UINT64_C( 4285343716429371071),
+    UINT64_C( 4412928894968847241), UINT64_C( 4224277455101570246), UINT64_C(  696257273046130940),
+    UINT64_C( 1438435331577261502), UINT64_C( 3466262785815169999), UINT64_C( 3478699736926467196),
+    UINT64_C( 2843325644492115562), UINT64_C(  566447303828363281), UINT64_C(  259929117461122690),
+    UINT64_C( 3453319317856532861), UINT64_C(  474918150100967821), UINT64_C(   54401244900000446),
+    UINT64_C( 3559966345376906418), UINT64_C( 1638356955527820207), UINT64_C( 2762525263948563595),
+    UINT64_C( 4486520662148728802), UINT64_C(  845371447597876730), UINT64_C(  895520239994101401),
+    UINT64_C(  252360766593729347), UINT64_C(  588918264645213105), UINT64_C(   69730768822361569),
+    UINT64_C( 4524716785335492365), UINT64_C( 1988821503273290230), UINT64_C( 4348048275020021631),
+    UINT64_C( 2769070406059010880), UINT64_C(  890296088169815968), UINT64_C(  929558361631964678),
+    UINT64_C( 2192654908740803739), UINT64_C( 4164257115212022658), UINT64_C( 2303343809274674337),
+    UINT64_C( 1241070534499560266), UINT64_C( 2397472584697199582), UINT64_C( 4562367534651267261),
+    UINT64_C( 2014884993995062392), UINT64_C( 1439619867643852777), UINT64_C( 4337349785390127300),
+    UINT64_C(  389554631849401936), UINT64_C( 2387157249192273180), UINT64_C(  503608079446868463),
+    UINT64_C( 3685969970649508253), UINT64_C( 1671710623904955317), UINT64_C( 2299554859802111181),
+    UINT64_C( 2390073540969705624), UINT64_C( 3738786304041136961), UINT64_C( 1018672395301484236),
+    UINT64_C( 3082118428190026655), UINT64_C(  500533747675448236), UINT64_C( 3651987553310790167),
+    UINT64_C( 4461354769932320401), UINT64_C(  475956906388850203), UINT64_C( 1707928536562031796),
+    UINT64_C( 4393533854220134376), UINT64_C(  972924256587072614), UINT64_C(  916448375621774411),
+    UINT64_C( 3709495328277798306), UINT64_C( 3028333429807653516), UINT64_C( 1525463987982470819),
+    UINT64_C( 2978938847393239339), UINT64_C(  826033961802171977), UINT64_C( 2410903021786764458),
+    UINT64_C( 3991696183642031693), UINT64_C( 3844646960227800326), UINT64_C(   67514058206998667),
+    UINT64_C( 3133518461913316388), UINT64_C(  881010135713225209), UINT64_C( 2072907831397488931),
+    UINT64_C( 1361718275344907393), UINT64_C( 3818441481049447908), UINT64_C(  508668229988975855),
+    UINT64_C( 4222933272381401292), UINT64_C( 3619050494210550099), UINT64_C( 1989893649827399347),
+    UINT64_C( 2534087554591265284), UINT64_C( 4377644333194108072), UINT64_C(  947653754879841762),
+    UINT64_C(  403912456936482342), UINT64_C( 2738823817611127352), UINT64_C( 3666301082479696243),
+    UINT64_C( 1341517252468509167), UINT64_C( 1777355286419178464), UINT64_C( 3670210081921092754),
+    UINT64_C( 4406789659874271060), UINT64_C( 3513100483767801861), UINT64_C( 2292061085530386825),
+    UINT64_C(  341119304675706466), UINT64_C( 2694178106302160104), UINT64_C( 1014106208068792177),
+    UINT64_C( 1074070929108427065), UINT64_C(  576559400180798021), UINT64_C( 3025652181590952288),
+    UINT64_C( 2552303672863703893), UINT64_C( 3794907154875265834), UINT64_C(  321732475974946595),
+    UINT64_C(  228925669915772045), UINT64_C( 4243975769763796303), UINT64_C( 2992666649543695505),
+    UINT64_C( 4321344604600969480), UINT64_C( 2266848510582485458), UINT64_C(  183141745685910901),
+    UINT64_C( 1074353827411989244), UINT64_C( 1663327109906766898), UINT64_C( 3814388044261891669),
+    UINT64_C( 1775408336037874833), UINT64_C(  345749411583370006), UINT64_C(  726823701492065576),
+    UINT64_C( 3659758494305853749), UINT64_C( 3557789920013087769), UINT64_C( 3059163844330049364),
+    UINT64_C( 1639503924621406683), UINT64_C( 1870443561497370052), UINT64_C(  845826707751491030),
+    UINT64_C(  605646616495769660), UINT64_C( 3977388320420463150), UINT64_C( 1923906360428460678),
+    UINT64_C( 2781862426208510548), UINT64_C( 2470563529832768384), UINT64_C( 3915913354687023729),
+    UINT64_C( 4481875101282788461), UINT64_C( 3618994673477555001), UINT64_C( 1720235100163152873),
+    UINT64_C( 4531371429972998074), UINT64_C( 1874405826707438282), UINT64_C( 2605888453019777046),
+    UINT64_C(   52571326077472245), UINT64_C( 1956067693854901028), UINT64_C( 2018806268997838899),
+    UINT64_C( 2873987136448611317), UINT64_C(  263649993022218554), UINT64_C( 1782453363043580942),
+    UINT64_C( 3131652907251769454), UINT64_C( 2959817697163268132), UINT64_C( 3369395599594563037),
+    UINT64_C( 3951765528314891606), UINT64_C( 2975744674484854296), UINT64_C( 2119678531609113096),
+    UINT64_C(  213757508065116192), UINT64_C( 1136970171935060389), UINT64_C(  482239113613640005),
+    UINT64_C(  963572232227621138), UINT64_C( 3301861002454902882), UINT64_C( 3335076197782862170),
+    UINT64_C( 1071066424862730134), UINT64_C( 4350719607959700781), UINT64_C( 3444845605885419996),
+    UINT64_C( 2474242528778897655), UINT64_C( 3915370772345419643), UINT64_C( 1479519005097051223),
+    UINT64_C(  214940600524212797), UINT64_C( 3309138426782285514), UINT64_C( 1130070916169322880),
+    UINT64_C( 1933456902796142000), UINT64_C( 2504034192270386350), UINT64_C( 3152509391186728425),
+    UINT64_C(   92669405019080994), UINT64_C(   88313001273509989), UINT64_C(  998342285220525008),
+    UINT64_C( 1570305887939507687), UINT64_C( 3432368257996892445), UINT64_C( 4345232052848843299),
+    UINT64_C( 3923659608139143229), UINT64_C( 2519742877070227732), UINT64_C( 1324867958982897001),
+    UINT64_C( 1265464259985722977), UINT64_C( 4564445537667472269), UINT64_C( 2757163375145060952),
+    UINT64_C(  256721156335580833), UINT64_C( 3252291321790303167), UINT64_C( 1175671755351670266),
+    UINT64_C(  623460423351514340), UINT64_C( 4383764944061676575), UINT64_C( 2923393519039357984),
+    UINT64_C( 3526947028660348658), UINT64_C( 3905541298627606936), UINT64_C( 2313598627037541273),
+    UINT64_C(  574571179362302293), UINT64_C( 2314735998187876572), UINT64_C( 3277577877463633490),
+    UINT64_C( 3238395188897438401), UINT64_C( 4121606289736188335), UINT64_C(  457333833578157900),
+    UINT64_C( 4280677947144166879), UINT64_C( 3394618906318341121), UINT64_C( 3245713155201487211),
+    UINT64_C( 1124193049055349191), UINT64_C( 1876870525576028994), UINT64_C( 4521784081167841369),
+    UINT64_C( 3581470053372412633), UINT64_C( 1514088270261435247), UINT64_C( 3249924556539299284),
+    UINT64_C( 2241636511418284617), UINT64_C(  222363298121302350), UINT64_C( 4228381234493753401),
+    UINT64_C( 1533053825403530061), UINT64_C( 1165452898850607922), UINT64_C(  987100506351041320),
+    UINT64_C( 4427158721301587603), UINT64_C( 2913941844454968569), UINT64_C( 4279111333455130993),
+    UINT64_C( 4445216908273154147), UINT64_C( 3475998875766277959), UINT64_C(  829986534226567594),
+    UINT64_C( 3386023237205364002), UINT64_C( 4334591613285693131), UINT64_C( 2590958914389261682),
+    UINT64_C( 2149368097306312619), UINT64_C(  669859680137310667), UINT64_C(  345259560854666578),
+    UINT64_C( 3144438917205680352), UINT64_C( 3734332116149173950), UINT64_C(  128472323706958535),
+    UINT64_C( 4128379535214024737), UINT64_C( 1939475217606039421), UINT64_C( 1697176449389017037),
+    UINT64_C(  187249431046427459), UINT64_C( 4107323397594688662), UINT64_C( 1553039539814721126),
+    UINT64_C( 4126194883144571696), UINT64_C( 1093332744300684120), UINT64_C( 1142034642720021053),
+    UINT64_C( 3664247085526192562), UINT64_C( 2538085162567975975), UINT64_C( 4172578522755673204),
+    UINT64_C( 1229784470992723326), UINT64_C( 1496926789713922054), UINT64_C( 1256763710343728242),
+    UINT64_C( 3018668621686806755), UINT64_C( 4322585822259518046), UINT64_C( 3479045960750655309),
+    UINT64_C( 4132097551481449465), UINT64_C( 3281338745396304689), UINT64_C(  707982160446641454),
+    UINT64_C( 2242618964484433073), UINT64_C( 1446465725090073460), UINT64_C(  217460571654969358),
+    UINT64_C( 3380477618653367844), UINT64_C( 3638408044795586258), UINT64_C( 2737073233102681860),
+    UINT64_C( 2811852688171289856), UINT64_C( 4046268064833756812), UINT64_C( 2285274162607378987),
+    UINT64_C( 3930709610593225508), UINT64_C( 4403506197958660238), UINT64_C( 1104068613108266923),
+    UINT64_C(  181220087458713714), UINT64_C(  576549880350533040), UINT64_C( 3102951436448193621),
+    UINT64_C( 2597643806533680773), UINT64_C( 3396000543754538034), UINT64_C( 4360097470762206737),
+    UINT64_C( 3249634314648685198), UINT64_C(  448202126250173565), UINT64_C( 2969192492117753139),
+    UINT64_C( 1080301474579015457), UINT64_C(  538516744196509251), UINT64_C(  516132550137894883),
+    UINT64_C(  967167880729346584), UINT64_C( 1525871210789010239), UINT64_C( 2116801334240291716),
+    UINT64_C( 2935790622343543901), UINT64_C( 1852184818241988882), UINT64_C( 3985388427924175927),
+    UINT64_C( 2610827803358048316), UINT64_C( 2356451789188822646), UINT64_C( 3194706432379451517),
+    UINT64_C(  135388361897363864), UINT64_C(  809272002027209176), UINT64_C( 1086187686209696124),
+    UINT64_C( 2229343474486230970), UINT64_C(  420716886884460848), UINT64_C(  330027879291519521),
+    UINT64_C( 4366668526428885515), UINT64_C( 3293764912996114848), UINT64_C(  787394278904577301),
+    UINT64_C( 4000825487962242896), UINT64_C( 4100879462871234869), UINT64_C( 1215954448296340858),
+    UINT64_C( 3367345159394646143), UINT64_C( 3633422997847512353), UINT64_C( 3132880113770088014),
+    UINT64_C( 3145964027948816410), UINT64_C(  890995105533806502), UINT64_C( 2239558735835916297),
+    UINT64_C(  229481740030525564), UINT64_C(  563431740559122686), UINT64_C(  528183770302926512),
+    UINT64_C( 1499756067057231230), UINT64_C( 3649531601045992464), UINT64_C(  372852338023073976),
+    UINT64_C( 3673249488438930105), UINT64_C( 1331772203197056095), UINT64_C(  652533216445055972),
+    UINT64_C( 1309048532335129902), UINT64_C( 3762709555740706764), UINT64_C( 1150065803392597846),
+    UINT64_C( 2747844116629241812), UINT64_C( 4580317839448440772), UINT64_C( 3579309749962466460),
+    UINT64_C( 3002134461744886342), UINT64_C(  265849896788346259), UINT64_C( 2997138256801022277),
+    UINT64_C( 2766795047862501731), UINT64_C( 2935145024351236606), UINT64_C( 2623314936775053810),
+    UINT64_C( 3519771985760240459), UINT64_C( 1478634811053175701), UINT64_C( 3740670769793061656),
+    UINT64_C( 4474914786204157506), UINT64_C( 1610800114724148084), UINT64_C( 2878228257628456680),
+    UINT64_C( 2893775854028913106), UINT64_C( 3119415960364015505), UINT64_C( 4029597475302710099),
+    UINT64_C( 1934826210171416308), UINT64_C(   32667495058069305), UINT64_C( 4455898604664459746),
+    UINT64_C(  315810430551031626), UINT64_C( 2296307372821275815), UINT64_C( 2076624595876616786),
+    UINT64_C( 1123780004951789812), UINT64_C( 4370176269990062499), UINT64_C( 3178934214101961218),
+    UINT64_C( 1645951455682690821), UINT64_C( 3632461182717925746), UINT64_C( 3025697040481053315),
+    UINT64_C( 1241943892123899649), UINT64_C(  280546723785505881), UINT64_C( 3846627600075277591),
+    UINT64_C( 1082196204383124166), UINT64_C( 2518421964070420713), UINT64_C( 2681365935457499374),
+    UINT64_C( 4427242678814347554), UINT64_C( 1019335479952936867), UINT64_C( 2576507824955878287),
+    UINT64_C( 3374530130842092923), UINT64_C( 3371492191676195091), UINT64_C( 4004348599691564871),
+    UINT64_C( 3032448689878547779), UINT64_C( 1074338829714465939), UINT64_C( 4068021235021803744),
+    UINT64_C( 4223786740293072220), UINT64_C( 2830509201689204628), UINT64_C(  907536292839148742),
+    UINT64_C( 2157326113251484673), UINT64_C( 3115166189560863868), UINT64_C( 1869220585158753174),
+    UINT64_C(  371579570945566400), UINT64_C(  943212704854558556), UINT64_C( 1792096719878361652),
+    UINT64_C( 1466663677672983396), UINT64_C(  562171890205887871), UINT64_C( 1462672659301410100),
+    UINT64_C( 2983502435741321882), UINT64_C( 1874967952393962103), UINT64_C( 2409664670287100869),
+    UINT64_C( 2661589922495033735), UINT64_C( 2399326072056448834), UINT64_C( 3073592028485366274),
+    UINT64_C(    6115453881648595), UINT64_C( 4592307042978040560), UINT64_C( 2288957866861762576),
+    UINT64_C( 1424083479747005929), UINT64_C(  642576094567239175), UINT64_C( 3548307891575053927),
+    UINT64_C( 2777464262913720573), UINT64_C(  655549401545426078), UINT64_C( 4046281895801086962),
+    UINT64_C(  994705779007527844), UINT64_C( 3788628997163465257), UINT64_C( 3630062051780545542),
+    UINT64_C( 3470702154560351748), UINT64_C( 2244818812920044936), UINT64_C( 4139786193388248566),
+    UINT64_C( 1595482593607645320), UINT64_C(  836054860303693243), UINT64_C( 3165364809910252476),
+    UINT64_C( 3709826170813048035), UINT64_C( 3693891628877652244), UINT64_C( 1511309992815106380),
+    UINT64_C( 1184066495523972765), UINT64_C(   19602533819938967), UINT64_C( 3834646878792466042),
+    UINT64_C( 2442907545427550635), UINT64_C( 1125377840692116595), UINT64_C( 3626835293658153146),
+    UINT64_C( 1885361656605342679), UINT64_C( 1924881649978995319), UINT64_C(  645582641086574590),
+    UINT64_C(  994161879564739462), UINT64_C(  132931943920464216), UINT64_C( 3017470356035989713),
+    UINT64_C(  451157696725097893), UINT64_C( 2210974279307515123), UINT64_C( 3388564417695871207),
+    UINT64_C( 3258143015112507007), UINT64_C( 2796133159132037378), UINT64_C( 2625982241519100233),
+    UINT64_C( 2354009520723277661), UINT64_C( 1715135341866227593), UINT64_C( 2951366108222041717),
+    UINT64_C( 4325780611018942824), UINT64_C( 1583469701720663197), UINT64_C( 1271506936743908294),
+    UINT64_C( 2288764575021570546), UINT64_C( 2879259272880196121), UINT64_C( 3135866892758084273),
+    UINT64_C( 2605901867815484864), UINT64_C(  781960053206189663), UINT64_C( 3913495199285589405),
+    UINT64_C( 2968433508329595119), UINT64_C(  811330076212724624), UINT64_C( 1221184241288868718),
+    UINT64_C( 2933663131410360104), UINT64_C( 4311361012976868790), UINT64_C( 3539858049101749336),
+    UINT64_C( 2875864023994912853), UINT64_C( 4352528928485284748), UINT64_C( 3571438438625334048),
+    UINT64_C( 4310958122559172629), UINT64_C(  946813996114930333), UINT64_C( 2006042301467274152),
+    UINT64_C( 2656731416611320015), UINT64_C( 2422724552301331296), UINT64_C( 1189801735500824735),
+    UINT64_C( 3426784892302299874), UINT64_C(  168212125958364308), UINT64_C(   23996907750507000),
+    UINT64_C(  715762190479007514), UINT64_C( 3509927256308842209), UINT64_C(  769701932256735022),
+    UINT64_C(   63709175107266452), UINT64_C( 2483209055683353731), UINT64_C( 3777500071259020017),
+    UINT64_C( 2537796746009844513), UINT64_C( 2779503113029983906), UINT64_C(  143161449524070449),
+    UINT64_C( 3972363882184310289), UINT64_C( 2352834478359190063), UINT64_C( 2747804271783934338),
+    UINT64_C( 1516871119263846194), UINT64_C( 1609479988361743286), UINT64_C( 2901868507207485993),
+    UINT64_C( 2370413344419977750), UINT64_C( 2661737650974189287), UINT64_C( 3444712558985655651),
+    UINT64_C( 2270870183177531664), UINT64_C( 2000387249606449686), UINT64_C( 2574742081701557089),
+    UINT64_C( 1072488555040157814), UINT64_C(  688161282927849965), UINT64_C( 3057723426550000738),
+    UINT64_C( 4466799899704578503), UINT64_C(  304130044009354183), UINT64_C( 4581447274799793569),
+    UINT64_C( 1843657580423506028), UINT64_C( 3478428272461317095), UINT64_C( 2540333676606490964),
+    UINT64_C( 4108342494103176500), UINT64_C(  558995487158155038), UINT64_C( 2209675171840703592),
+    UINT64_C( 1758711132109758919), UINT64_C( 3370370547363931460), UINT64_C( 4589252789701182151),
+    UINT64_C(  999838611317906276), UINT64_C( 4258701374653866658), UINT64_C( 2398223416604110964),
+    UINT64_C( 4041015299725115129), UINT64_C( 4020738764078399999), UINT64_C( 1455683622128511541),
+    UINT64_C( 3727373889866341080), UINT64_C( 1344614765373121715), UINT64_C( 1750367289580504447),
+    UINT64_C( 2673186245118310447), UINT64_C( 1493106412329886238), UINT64_C( 1610303902863815517),
+    UINT64_C( 3816341043128309163), UINT64_C( 4373713524864902362), UINT64_C( 4509641387672572507),
+    UINT64_C( 4309015619434539177), UINT64_C( 1844372608637753724), UINT64_C(  856050673898871564),
+    UINT64_C( 4558632190227467596), UINT64_C( 2720686833966781296), UINT64_C( 1746420658772035247),
+    UINT64_C( 1563320862060882370), UINT64_C( 2284034239792018705), UINT64_C( 2163005381683870888),
+    UINT64_C( 1824080674449513862), UINT64_C( 3254140054278787552), UINT64_C( 4507445263614832331),
+    UINT64_C(  568487360333636815), UINT64_C( 1682006493488243486), UINT64_C( 1554326581576097684),
+    UINT64_C( 4218660923928507935), UINT64_C( 1089844064784667426), UINT64_C( 1257685646914335314),
+    UINT64_C( 4551726561374917297), UINT64_C( 1852643099452468902), UINT64_C( 4501254890803506081),
+    UINT64_C(  818542124129745588), UINT64_C(  688224823232163230), UINT64_C(  754952258050436111),
+    UINT64_C( 1465501796900627824), UINT64_C( 1405527757720725549), UINT64_C( 2637511835383843953),
+    UINT64_C(  514173927015982751), UINT64_C( 3952556283863759371), UINT64_C( 1717332928635879646),
+    UINT64_C( 2266647600580065182), UINT64_C( 2772360085978006929), UINT64_C( 3477288084080528425),
+    UINT64_C( 4598023217910147697), UINT64_C( 2650161341243967825), UINT64_C( 2340851329558296712),
+    UINT64_C( 3717367495934887505), UINT64_C( 1720921547416233469), UINT64_C(  973980778320841801),
+    UINT64_C(  554008320107996877), UINT64_C( 4052863393571660269), UINT64_C( 1334919333891736476),
+    UINT64_C( 1616385337717160403), UINT64_C( 1864880141056631817), UINT64_C( 4298834444158419230),
+    UINT64_C( 2880669953947361209), UINT64_C( 3540688873367921218), UINT64_C(   75202262916984326),
+    UINT64_C(  785561104748161654), UINT64_C( 4000782971546802743), UINT64_C( 1864069222029985549),
+    UINT64_C( 1915811244275455358), UINT64_C(  509054159924305630), UINT64_C( 2058051849710163886),
+    UINT64_C(  882485993289438970), UINT64_C( 3698678826157822831), UINT64_C(  218127513446979135),
+    UINT64_C(  313132066214284112), UINT64_C( 2220624273187193030), UINT64_C( 1958395298492004266),
+    UINT64_C( 1965823843865291484), UINT64_C( 1011772530083443300), UINT64_C( 4254505183577155121),
+    UINT64_C( 3586143419042493405), UINT64_C( 2876262185944436000), UINT64_C( 3572889142043340051),
+    UINT64_C(  163074434595935513), UINT64_C( 4027357711033923000), UINT64_C(  989478917134652332),
+    UINT64_C( 3112166405306625215), UINT64_C(  472661605912428604), UINT64_C( 3113054264164877866),
+    UINT64_C( 4578869611518889700), UINT64_C( 4072170742512419851), UINT64_C( 3216505902101832144),
+    UINT64_C( 3249233736316200253), UINT64_C( 3071773207777778472), UINT64_C(  542838775421683323),
+    UINT64_C( 3943366909842968536), UINT64_C( 4174660629026349252), UINT64_C( 2946908102995460623),
+    UINT64_C( 2566584313426101057), UINT64_C( 3201849646790825051), UINT64_C( 2934711079862639181),
+    UINT64_C(  446177979058914577), UINT64_C( 2505409290921977715), UINT64_C( 2660641638438903329),
+    UINT64_C( 2431719213531950343), UINT64_C( 1686712306041190023), UINT64_C( 3041425425426592909),
+    UINT64_C( 1599057025674416361), UINT64_C( 3428877113679262401), UINT64_C( 2057914719835233033),
+    UINT64_C( 4006822653638304376), UINT64_C( 3128304565970534429), UINT64_C( 3897674389387200176),
+    UINT64_C(  268912930544144924), UINT64_C( 3164174554458895811), UINT64_C( 2740475448842863036),
+    UINT64_C(  472380365382613805), UINT64_C(  608141537717226172), UINT64_C( 2580592769999696867),
+    UINT64_C( 1508313693156633751), UINT64_C( 3412292826102481145), UINT64_C(  958143169321820213),
+    UINT64_C(  576848991166305559), UINT64_C( 3118944661028523025), UINT64_C( 4135021405758718373),
+    UINT64_C( 1187533200806601727), UINT64_C( 1049743632113484814), UINT64_C( 1818604934163491102),
+    UINT64_C(   63604171765359481), UINT64_C( 4212532896709519725), UINT64_C( 3196689363794785842),
+    UINT64_C( 1395287851760222885), UINT64_C( 3789189897827762986), UINT64_C(  430520801564123834),
+    UINT64_C( 2332137042470714038), UINT64_C(  247505703114151509), UINT64_C( 2470332967660267572),
+    UINT64_C( 3012349429821296335), UINT64_C( 1246992147739402125), UINT64_C(  536649528194717491),
+    UINT64_C( 4350582742939206725), UINT64_C(  764243271796182531), UINT64_C( 3417421637402625906),
+    UINT64_C(  155826375578729593), UINT64_C( 4374265513287347528), UINT64_C( 1851419217326550276),
+    UINT64_C( 1383219183417269928), UINT64_C( 2060138391575134866), UINT64_C(  797492147730916086),
+    UINT64_C( 2101437100401247372), UINT64_C( 2801672944538451729), UINT64_C( 2787153966787032343),
+    UINT64_C( 2565497512080344890), UINT64_C(  561664344721334234), UINT64_C( 3878897643252717881),
+    UINT64_C( 2175128260101694725), UINT64_C( 2433321491447882238), UINT64_C( 4300399010679589850),
+    UINT64_C(  657887210896456041), UINT64_C(   94772552071014849), UINT64_C( 4025109983248716390),
+    UINT64_C( 2088178759453227927), UINT64_C(    4263801380435193), UINT64_C( 2056245631899134790),
+    UINT64_C(  314304394276356068), UINT64_C( 1789303260786066209), UINT64_C( 3165374274898401234),
+    UINT64_C( 2830664798429495220), UINT64_C( 2196784552807290514), UINT64_C( 4539382149482627157),
+    UINT64_C( 2759522974005177472), UINT64_C( 1609925502430020251), UINT64_C( 4350742077350826206),
+    UINT64_C( 2362582044587374441), UINT64_C( 1123172499878255013), UINT64_C( 1587487114517525507),
+    UINT64_C( 2252513989940223663), UINT64_C( 4291787127229789221), UINT64_C(  701652253952196535),
+    UINT64_C( 3133748582505382937), UINT64_C( 3045538311515152158), UINT64_C( 2160831789872645588),
+    UINT64_C( 1006919202032467831), UINT64_C( 2661307679293182568), UINT64_C(  456542046847300653),
+    UINT64_C(  350858875206576353), UINT64_C( 1607388988021565940), UINT64_C( 2528971543905274231),
+    UINT64_C( 3060456333970082968), UINT64_C( 3926069655394799868), UINT64_C( 3807546008424755692),
+    UINT64_C( 4253849979716762278), UINT64_C( 2250045332340210195), UINT64_C( 2657439313259211579),
+    UINT64_C(  426210995390660895), UINT64_C( 2034096665609387302), UINT64_C( 3740273303965309514),
+    UINT64_C( 2140202298834441363), UINT64_C( 1277949632213676086), UINT64_C( 1943868371678867533),
+    UINT64_C( 4440725909860055186), UINT64_C( 2787753087608344995), UINT64_C( 2868509619446354660),
+    UINT64_C( 3540421536435634902), UINT64_C( 2823383414793394093), UINT64_C( 1938644790487917099),
+    UINT64_C( 2298923324594366902), UINT64_C( 3734026307479980345), UINT64_C( 2870697731773889938),
+    UINT64_C(  862139168071466052), UINT64_C( 2446048564697061562), UINT64_C( 3925072290577136989),
+    UINT64_C( 1078908677014434622), UINT64_C( 2698745053513854501), UINT64_C( 3026760723381916262),
+    UINT64_C( 2141754458659573057), UINT64_C( 3523385008805289865), UINT64_C( 2762023867868254611),
+    UINT64_C( 2632364499146702765), UINT64_C( 2976402716016821560), UINT64_C( 4200869059531073196),
+    UINT64_C( 4039142637513106715), UINT64_C( 2692792029050128603), UINT64_C( 2992783122800414159),
+    UINT64_C( 1000463789101361995), UINT64_C( 3956461230434860909), UINT64_C( 4306457876279741209),
+    UINT64_C( 3011669264197995478), UINT64_C( 4128710327128573074), UINT64_C( 3616177571672082498),
+    UINT64_C( 4308539520669658726), UINT64_C( 3411322196877337221), UINT64_C( 4512920352276335310),
+    UINT64_C( 4242336077206028805), UINT64_C( 1912956288139626882), UINT64_C(  645239785875353853),
+    UINT64_C( 1528221992317525702), UINT64_C( 3775953448352502750), UINT64_C( 3880219039300029372),
+    UINT64_C(  678212273564130230), UINT64_C( 3974471152550331879), UINT64_C( 1834502902598653649),
+    UINT64_C( 1401444603376330210), UINT64_C( 1432837754162793498), UINT64_C(  447024717550900323),
+    UINT64_C(  283477715420108518), UINT64_C( 1102106595755091195), UINT64_C( 3112587465732910942),
+    UINT64_C(  434427293250223636), UINT64_C( 1873108948219506496), UINT64_C( 2105970090571587108),
+    UINT64_C( 1059905615696404507), UINT64_C( 4100394013190731825), UINT64_C(  365384084559666707),
+    UINT64_C( 2817459005911659192), UINT64_C( 2464971757469007364), UINT64_C( 3566002563008053434),
+    UINT64_C( 3399133138926683567), UINT64_C( 1705626132785111110), UINT64_C( 3004073722228073535),
+    UINT64_C(  108873517798635920), UINT64_C(  223570815752496328), UINT64_C( 3108724845266393378),
+    UINT64_C( 1744899869588789634), UINT64_C( 2142005239324328990), UINT64_C( 3823431411655795650),
+    UINT64_C( 1291952890723979460), UINT64_C( 1458182146816732318), UINT64_C( 3059374139418373254),
+    UINT64_C( 3712264707545107387), UINT64_C( 1574126562760261743), UINT64_C( 1452524267131538099),
+    UINT64_C(   43133475905185069), UINT64_C( 1215568530542934564), UINT64_C( 4124149856169322971),
+    UINT64_C( 3867180341609412977), UINT64_C( 2902510638932551518), UINT64_C(  495966267109715311),
+    UINT64_C( 4596823358711472530), UINT64_C( 1717922753632024478), UINT64_C( 1770014703815795058),
+    UINT64_C( 1686007361855111219), UINT64_C( 1075677898065769295), UINT64_C( 4352358374901408227),
+    UINT64_C( 4104155288178339593), UINT64_C(  210114102012982135), UINT64_C( 2823630620398947847),
+    UINT64_C( 2731250545727884857), UINT64_C(  670319505881411804), UINT64_C( 3585108298384874378),
+    UINT64_C( 2263296992921264100), UINT64_C(  907461256866770131), UINT64_C(  423508086034784650),
+    UINT64_C( 1054673147486360888), UINT64_C(  718756747223141276), UINT64_C( 3572530846519683033),
+    UINT64_C(   42731922208172899), UINT64_C( 3491151411253013501), UINT64_C( 1793502408157739802),
+    UINT64_C( 3798600670407388440), UINT64_C( 3093204200959800088), UINT64_C( 1942448411120758939),
+    UINT64_C( 1109838575199822283), UINT64_C( 1374391891062151006), UINT64_C(  220201989327909512),
+    UINT64_C( 2792721084733644720), UINT64_C( 2556192919365510003), UINT64_C( 1076221302188205702),
+    UINT64_C( 3859015770545988752), UINT64_C(  295278113703788685), UINT64_C(   68974432258717809),
+    UINT64_C( 4001363941757303195), UINT64_C( 2734533154747497688), UINT64_C( 2741599063431235245),
+    UINT64_C( 2303703509895787128), UINT64_C( 1657866893982081633), UINT64_C( 2527882465865639626),
+    UINT64_C( 2936970325867113194), UINT64_C( 4558933849640371195), UINT64_C( 1162124780797873660),
+    UINT64_C( 2812516176038857656), UINT64_C( 4409149954872030110), UINT64_C(  513149472339934863),
+    UINT64_C(  376118599011774941), UINT64_C( 1927591355247466262), UINT64_C( 2760875939570551236),
+    UINT64_C( 2250327649423389685), UINT64_C( 3667411708019251349), UINT64_C( 3451362428798728534),
+    UINT64_C( 2500631733376583892), UINT64_C(  146087906120933724), UINT64_C(  522362204210409319),
+    UINT64_C(  765839450274020639), UINT64_C( 2110395020677595335), UINT64_C( 2040797528857249625),
+    UINT64_C( 2169992454418071498), UINT64_C( 2696587270518879393), UINT64_C(  769423323320629493),
+    UINT64_C( 1559498119742537175), UINT64_C( 4383754653692674310), UINT64_C( 3946437616474866785),
+    UINT64_C(  832706154801200943), UINT64_C(  558774673176777246), UINT64_C( 1484401047678607081),
+    UINT64_C( 3840104037602511141), UINT64_C( 4205970419652734056), UINT64_C(  835327291975600165),
+    UINT64_C( 3380393472039067371), UINT64_C(   21338844320033395), UINT64_C( 4490701366002600282),
+    UINT64_C( 1778390373064599443), UINT64_C( 1932886299389080117), UINT64_C( 2777456058854340974),
+    UINT64_C( 3071836964655048922), UINT64_C( 3518411162477390960), UINT64_C( 3993279121503566122),
+    UINT64_C( 1687203693560762625), UINT64_C( 1457004719622182737), UINT64_C(  780401970365445992),
+    UINT64_C( 2574052638124645210), UINT64_C( 1201128970311793654), UINT64_C( 1108813287865500875),
+    UINT64_C( 3279220890377437800), UINT64_C(  605338160472752124), UINT64_C( 2489164749694519101),
+    UINT64_C(  169870429218829113), UINT64_C( 2877373997093876212), UINT64_C( 3063700460100388148),
+    UINT64_C( 1248247674244928666), UINT64_C( 2949236362554210652), UINT64_C(  455396992061226584),
+    UINT64_C(  773855723536620264), UINT64_C( 2970862309877777699), UINT64_C( 3162116761681234955),
+    UINT64_C( 2564406707169592972), UINT64_C( 1426768039951463637), UINT64_C( 3181989234412891894),
+    UINT64_C( 4461739899157313059), UINT64_C( 2702173610962131998), UINT64_C(  431790573995967210),
+    UINT64_C( 3801702055183437955), UINT64_C( 2852018725155769659), UINT64_C(  105348538985554873),
+    UINT64_C(  635039974547919563), UINT64_C(  810672129715276109), UINT64_C( 4288667971866854609),
+    UINT64_C( 4478501872605680367), UINT64_C( 2058361665152540449), UINT64_C( 2747291802366833654),
+    UINT64_C( 2654976126707572053), UINT64_C( 3485113181556427622), UINT64_C( 2016517355040436327),
+    UINT64_C( 2752854608463725521), UINT64_C( 3614871060123032576), UINT64_C( 2328699312535062728),
+    UINT64_C( 4405672498966573201), UINT64_C( 3179885864045664619), UINT64_C( 2189905158132998361),
+    UINT64_C( 3148198594494720042), UINT64_C(  363655110359117501), UINT64_C( 3939837088704093023),
+    UINT64_C( 1888872274725735569), UINT64_C(   33567019268632236), UINT64_C( 2936286612582864738),
+    UINT64_C( 4064133392090397507), UINT64_C( 1805981741029799825), UINT64_C( 3314009989949580467),
+    UINT64_C( 2484439772201275906), UINT64_C(  837291643885083552), UINT64_C( 3221921810267625204),
+    UINT64_C(  670066138637868993), UINT64_C(  198267229427630275), UINT64_C( 2154504597729093950),
+    UINT64_C( 1351498103261723080), UINT64_C(  671802878229862572), UINT64_C( 3999353157658564292),
+    UINT64_C( 3548705101632358097), UINT64_C( 3077286507726038128), UINT64_C( 1063819136980432611),
+    UINT64_C( 4232703864853870251), UINT64_C(  243379586976546406), UINT64_C( 2997151438495971364),
+    UINT64_C( 2613904392478173061), UINT64_C( 3139172383331211188), UINT64_C( 1339548474820556644),
+    UINT64_C( 1251423912831566905), UINT64_C( 3734629642573000898), UINT64_C( 2459329704142861340),
+    UINT64_C( 1966213041129982407), UINT64_C( 2784765571103602960), UINT64_C( 4522067722447709678),
+    UINT64_C( 3630614922895280981), UINT64_C(  929921064067419203), UINT64_C( 2868509578140607340),
+    UINT64_C( 2359679973619273686), UINT64_C( 1136637474260141634), UINT64_C( 2589078170884475212),
+    UINT64_C( 3486666318862494714), UINT64_C( 1930429960569443682), UINT64_C( 1438476454770389687),
+    UINT64_C( 3690459174292560173), UINT64_C( 2375478542317419551), UINT64_C( 4178926096590966012),
+    UINT64_C( 3129088138880838570), UINT64_C(                   0), UINT64_C( 6389794980909314552),
+    UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621),
+    UINT64_C(17511728213235757668), UINT64_C(13401885216926016661), UINT64_C( 2351158912492758640),
+    UINT64_C( 4629002473775046183), UINT64_C(14676697007180690308), UINT64_C(10259949820381535209),
+    UINT64_C(11644996259059072847), UINT64_C( 8884524785671288102), UINT64_C(14918918025040673339),
+    UINT64_C( 7608887751095923315), UINT64_C( 3623232563747686574), UINT64_C( 2556217086465930670),
+    UINT64_C(14782867813192276210), UINT64_C(17507507827583639480), UINT64_C( 4746308599252906500),
+    UINT64_C(12817638039923718863), UINT64_C( 2840065831420830065), UINT64_C(11043114058563346863),
+    UINT64_C( 9146486252817883622), UINT64_C(10928151867741318085), UINT64_C( 2488413857031047351),
+    UINT64_C( 3761675888426073602), UINT64_C(17922219283797788657), UINT64_C(13800866446065292065),
+    UINT64_C( 6376687090250037436), UINT64_C(11809769321448950687), UINT64_C(10174069959054132969),
+    UINT64_C(10072575054279351582), UINT64_C(13056691932841204314), UINT64_C(17888783763160829334),
+    UINT64_C( 7816990934550415852), UINT64_C(  674553921631754431), UINT64_C(13571664401908093354),
+    UINT64_C(14269139486882120945), UINT64_C( 4960798899168637972), UINT64_C( 8477986509219018200),
+    UINT64_C(15364725421824121569), UINT64_C( 5997402673501242327), UINT64_C( 8447690658178800776),
+    UINT64_C(12517261530655964455), UINT64_C( 2223313312939649808), UINT64_C(15053967799335727255),
+    UINT64_C( 7686711190306185003), UINT64_C(10966636189184293973), UINT64_C( 9958674537902485385),
+    UINT64_C(11004932962127832900), UINT64_C( 2901650642912409121), UINT64_C(15674820729988758831),
+    UINT64_C( 1438031055912756488), UINT64_C( 4937768902624589955), UINT64_C( 3123513322351159609),
+    UINT64_C( 8576311056089553381), UINT64_C( 5476585914141769315), UINT64_C( 4992009352715341068),
+    UINT64_C( 2968052632020458530), UINT64_C(13423798482208682136), UINT64_C( 8698066976645706868),
+    UINT64_C( 4242455547773805283), UINT64_C(   83556942304842756), UINT64_C(17985574077943619039),
+    UINT64_C(18393716860268627612), UINT64_C(14421333568924831368), UINT64_C(10198015992023002346),
+    UINT64_C(10148416980996031784), UINT64_C(10563920708505556242), UINT64_C( 8773728067210865869),
+    UINT64_C(  878784601972636140), UINT64_C(13245901350281928823), UINT64_C( 6646098588059882388),
+    UINT64_C(14970048539715003181), UINT64_C(17592606737994843699), UINT64_C(16903661042075694818),
+    UINT64_C(15705143370304273599), UINT64_C( 7240089791002895170), UINT64_C(13951237519208364868),
+    UINT64_C(14636235241295332078), UINT64_C(13970971350850471620), UINT64_C( 4483257934773921047),
+    UINT64_C( 9327952234180033476), UINT64_C( 2927061728751804894), UINT64_C( 7573519760028039506),
+    UINT64_C(11529531604922623763), UINT64_C(12494597023148119429), UINT64_C( 1142756329542511018),
+    UINT64_C( 6920282754030912155), UINT64_C(18135093711688925393), UINT64_C( 5407634799754856963),
+    UINT64_C(10941590877337723575), UINT64_C( 5537995199983591519), UINT64_C(17386809708519284030),
+    UINT64_C( 2407205799512677458), UINT64_C(17657970624426188099), UINT64_C(15163734996133908791),
+    UINT64_C( 1077227322257662846), UINT64_C(16061719114812804757), UINT64_C( 6663304871248354980),
+    UINT64_C( 7573921858584884152), UINT64_C(11900882899511978789), UINT64_C(17350133519936389927),
+    UINT64_C(14025730332113821184), UINT64_C(12006488488061374836), UINT64_C(10194505686615842373),
+    UINT64_C( 3093681311386685971), UINT64_C(17420765589996383288), UINT64_C(16315169117853152407),
+    UINT64_C( 5584961233199406945), UINT64_C(14747439402388767897), UINT64_C( 3948380481182684082),
+    UINT64_C(  961912087726926834), UINT64_C( 8069905057528153739), UINT64_C(16068655174781381635),
+    UINT64_C( 7564546287726008543), UINT64_C( 1125895567644451247), UINT64_C(14580207542242868544),
+    UINT64_C(17141374865717568015), UINT64_C(17651715579875475188), UINT64_C(16897109820406363522),
+    UINT64_C( 2785029092184537364), UINT64_C( 5753741326309074113), UINT64_C(13865051143260747723),
+    UINT64_C(13914798947705936754), UINT64_C(11373302577968517803), UINT64_C( 2265789215313464191),
+    UINT64_C( 1039716469844495838), UINT64_C(13813277271426198918), UINT64_C( 1899672600403880563),
+    UINT64_C(  217604979600002846), UINT64_C(14239865381507695230), UINT64_C( 6553427822111312839),
+    UINT64_C(11050101055794308357), UINT64_C(17946082648595002870), UINT64_C( 3381485790391523437),
+    UINT64_C( 3582080959976423101), UINT64_C( 1009443066374922318), UINT64_C( 2355673058580863926),
+    UINT64_C(  278923075289447638), UINT64_C(18098867141342057868), UINT64_C( 7955286013093199779),
+    UINT64_C(17392193100080171480), UINT64_C(11076281624236097625), UINT64_C( 3561184352679281267),
+    UINT64_C( 3718233446527876874), UINT64_C( 8770619634963257798), UINT64_C(16657028460848171997),
+    UINT64_C( 9213375237098742353), UINT64_C( 4964282137998265313), UINT64_C( 9589890338788845172),
+    UINT64_C(18249470138605158188), UINT64_C( 8059539975980288936), UINT64_C( 5758479470575439236),
+    UINT64_C(17349399141560593947), UINT64_C( 1558218527397615355), UINT64_C( 9548628996769139362),
+    UINT64_C( 2014432317787483692), UINT64_C(14743879882598105032), UINT64_C( 6686842495619853931),
+    UINT64_C( 9198219439208489655), UINT64_C( 9560294163878869195), UINT64_C(14955145216164620896),
+    UINT64_C( 4074689581205956847), UINT64_C(12328473712760166841), UINT64_C( 2002134990701802723),
+    UINT64_C(14607950213243232024), UINT64_C(17845419079729368774), UINT64_C( 1903827625555410111),
+    UINT64_C( 6831714146248160555), UINT64_C(17574135416880623349), UINT64_C( 3891697026348309466),
+    UINT64_C( 3665793502487115550), UINT64_C(14837981313111265704), UINT64_C(12113333719230673234),
+    UINT64_C( 6101855951929913082), UINT64_C(11915755389573015561), UINT64_C( 3304135847208704047),
+    UINT64_C( 9643612087147104938), UINT64_C(15966784734568204765), UINT64_C(15378587840911276424),
+    UINT64_C(  270056232827995987), UINT64_C(12534073847653326777), UINT64_C( 3524040542852918050),
+    UINT64_C( 8291631325589996226), UINT64_C( 5446873101379656178), UINT64_C(15273765924197866240),
+    UINT64_C( 2034672919955913358), UINT64_C(16891733089525687680), UINT64_C(14476201976842271108),
+    UINT64_C( 7959574599309636268), UINT64_C(10136350218365110649), UINT64_C(17510577332776517823),
+    UINT64_C( 3790615019519385564), UINT64_C( 1615649827745937260), UINT64_C(10955295270444562922),
+    UINT64_C(14665204329918856608), UINT64_C( 5366069009874062879), UINT64_C( 7109421145676748583),
+    UINT64_C(14680840327684442728), UINT64_C(17627158639497170344), UINT64_C(14052401935071276086),
+    UINT64_C( 9168244342121592084), UINT64_C( 1364477218702832529), UINT64_C(10776712425208693057),
+    UINT64_C( 4056424832275188522), UINT64_C( 4296283716433729246), UINT64_C( 2306237600723203349),
+    UINT64_C(12102608726363868270), UINT64_C(10209214691454865441), UINT64_C(15179628619501137484),
+    UINT64_C( 1286929903899792666), UINT64_C(  915702679663092652), UINT64_C(16975903079055268135),
+    UINT64_C(11970666598174840493), UINT64_C(17285378418403962355), UINT64_C( 9067394042329986124),
+    UINT64_C(  732566982743647182), UINT64_C( 4297415309647977967), UINT64_C( 6653308439627100091),
+    UINT64_C(15257552177047641205), UINT64_C( 7101633344151534021), UINT64_C( 1382997646333486779),
+    UINT64_C( 2907294805968276505), UINT64_C(14639033977223486504), UINT64_C(14231159680052420591),
+    UINT64_C(12236655377320257229), UINT64_C( 6558015698485658766), UINT64_C( 7481774245989516754),
+    UINT64_C( 3383306831005980646), UINT64_C( 2422586465983090473), UINT64_C(15909553281681930314),
+    UINT64_C( 7695625441713880303), UINT64_C(11127449704834096546), UINT64_C( 9882254119331121808),
+    UINT64_C(15663653418748171429), UINT64_C(17927500405131241415), UINT64_C(14475978693910290715),
+    UINT64_C( 6880940400652645103), UINT64_C(18125485719892080834), UINT64_C( 7497623306829789752),
+    UINT64_C(10423553812079159100), UINT64_C(  210285304309890007), UINT64_C( 7824270775419642331),
+    UINT64_C( 8075225075991395041), UINT64_C(11495948545794501423), UINT64_C( 1054599972088879367),
+    UINT64_C( 7129813452174358595), UINT64_C(12526611629007139005), UINT64_C(11839270788653130360),
+    UINT64_C(13477582398378317982), UINT64_C(15807062113259643637), UINT64_C(11902978697939475327),
+    UINT64_C( 8478714126436493800), UINT64_C(  855030032260468944), UINT64_C( 4547880687740263771),
+    UINT64_C( 1928956454454569442), UINT64_C( 3854288928910503379), UINT64_C(13207444009819676043),
+    UINT64_C(13340304791131513844), UINT64_C( 4284265699450941463), UINT64_C(17402878431838888132),
+    UINT64_C(13779382423541747293), UINT64_C( 9896970115115638964), UINT64_C(15661483089381755074),
+    UINT64_C( 5918076020388233800), UINT64_C(  859762402096855387), UINT64_C(13236553707129206713),
+    UINT64_C( 4520283664677313600), UINT64_C( 7733827611184605777), UINT64_C(10016136769081594326),
+    UINT64_C(12610037564746975297), UINT64_C(  370677620076325786), UINT64_C(  353252005094041681),
+    UINT64_C( 3993369140882119538), UINT64_C( 6281223551758061430), UINT64_C(13729473031987636845),
+    UINT64_C(17380928211395458097), UINT64_C(15694638432556649580), UINT64_C(10078971508280960161),
+    UINT64_C( 5299471835931613890), UINT64_C( 5061857039942916633), UINT64_C(18257782150669978260),
+    UINT64_C(11028653500580297680), UINT64_C( 1026884625342328348), UINT64_C(13009165287161276214),
+    UINT64_C( 4702687021406704035), UINT64_C( 2493841693406069541), UINT64_C(17535059776246791954),
+    UINT64_C(11693574076157489056), UINT64_C(14107788114641463545), UINT64_C(15622165194510504054),
+    UINT64_C( 9254394508150210297), UINT64_C( 2298284717449220398), UINT64_C( 9258943992751551515),
+    UINT64_C(13110311509854598000), UINT64_C(12953580755589816879), UINT64_C(16486425158944833872),
+    UINT64_C( 1829335334312640535), UINT64_C(17122711788576751156), UINT64_C(13578475625273430811),
+    UINT64_C(12982852620806012262), UINT64_C( 4496772196221418729), UINT64_C( 7507482102304152648),
+    UINT64_C(18087136324671453827), UINT64_C(14325880213489720510), UINT64_C( 6056353081045770571),
+    UINT64_C(12999698226157260636), UINT64_C( 8966546045673182267), UINT64_C(  889453192485213744),
+    UINT64_C(16913524937975096222), UINT64_C( 6132215301614150198), UINT64_C( 4661811595402454459),
+    UINT64_C( 3948402025404184567), UINT64_C(17708634885206436914), UINT64_C(11655767377819931211),
+    UINT64_C(17116445333820607581), UINT64_C(17780867633092703443), UINT64_C(13903995503065179753),
+    UINT64_C( 3319946136906286593), UINT64_C(13544092948821522167), UINT64_C(17338366453142857217),
+    UINT64_C(10363835657557097352), UINT64_C( 8597472389225292472), UINT64_C( 2679438720549255756),
+    UINT64_C( 1381038243418673058), UINT64_C(12577755668822782847), UINT64_C(14937328464596768765),
+    UINT64_C(  513889294827836650), UINT64_C(16513518140856179612), UINT64_C( 7757900870424195579),
+    UINT64_C( 6788705797556101309), UINT64_C(  748997724185713494), UINT64_C(16429293590378834901),
+    UINT64_C( 6212158159258914848), UINT64_C(16504779532578367405), UINT64_C( 4373330977202757842),
+    UINT64_C( 4568138570880106526), UINT64_C(14656988342104841843), UINT64_C(10152340650271953491),
+    UINT64_C(16690314091022774344), UINT64_C( 4919137883970917332), UINT64_C( 5987707158855717464),
+    UINT64_C( 5027054841374937523), UINT64_C(12074674486747286001), UINT64_C(17290343289038156643),
+    UINT64_C(13916183843002689213), UINT64_C(16528390205925878597), UINT64_C(13125354981585282870),
+    UINT64_C( 2831928641786579649), UINT64_C( 8970475857937776110), UINT64_C( 5785862900360322102),
+    UINT64_C(  869842286619881680), UINT64_C(13521910474613537427), UINT64_C(14553632179182416123),
+    UINT64_C(10948292932410780919), UINT64_C(11247410752685214364), UINT64_C(16185072259335106308),
+    UINT64_C( 9141096650429560600), UINT64_C(15722838442372978834), UINT64_C(17614024791834726992),
+    UINT64_C( 4416274452433089264), UINT64_C(  724880349834858396), UINT64_C( 2306199521402143425),
+    UINT64_C(12411805745792835112), UINT64_C(10390575226134773847), UINT64_C(13584002175018218490),
+    UINT64_C(17440389883048912140), UINT64_C(12998537258594804286), UINT64_C( 1792808505000703017),
+    UINT64_C(11876769968471070571), UINT64_C( 4321205898316082936), UINT64_C( 2154066976786047526),
+    UINT64_C( 2064530200551589616), UINT64_C( 3868671522917405233), UINT64_C( 6103484843156070770),
+    UINT64_C( 8467205336961208224), UINT64_C(11743162489374232966), UINT64_C( 7408739272967991717),
+    UINT64_C(15941553711696781578), UINT64_C(10443311213432244277), UINT64_C( 9425807156755336626),
+    UINT64_C(12778825729517868489), UINT64_C(  541553447589458101), UINT64_C( 3237088008108852516),
+    UINT64_C( 4344750744838805719), UINT64_C( 8917373897944967439), UINT64_C( 1682867547537851612),
+    UINT64_C( 1320111517166084532), UINT64_C(17466674105715627380), UINT64_C(13175059651984523749),
+    UINT64_C( 3149577115618324588), UINT64_C(16003301951849049756), UINT64_C(16403517851485019603),
+    UINT64_C( 4863817793185387190), UINT64_C(13469380637578650366), UINT64_C(14533691991390120405),
+    UINT64_C(12531520455080413269), UINT64_C(12583856111795327109), UINT64_C( 3563980422135243417),
+    UINT64_C( 8958234943343708946), UINT64_C(  917926960122106739), UINT64_C( 2253726962236501752),
+    UINT64_C( 2112735081211716368), UINT64_C( 5999024268228954223), UINT64_C(14598126404184041164),
+    UINT64_C( 1491409352092303189), UINT64_C(14692997953755792191), UINT64_C( 5327088812788250401),
+    UINT64_C( 2610132865780236637), UINT64_C( 5236194129340545185), UINT64_C(15050838222962900575),
+    UINT64_C( 4600263213570413855), UINT64_C(10991376466517020938), UINT64_C(18321271357793852583),
+    UINT64_C(14317238999849935776), UINT64_C(12008537846979604026), UINT64_C( 1063399587153390230),
+    UINT64_C(11988553027204147669), UINT64_C(11067180191450060984), UINT64_C(11740580097405003773),
+    UINT64_C(10493259747100266497), UINT64_C(14079087943041030609), UINT64_C( 5914539244212731695),
+    UINT64_C(14962683079172319713), UINT64_C(17899659144816717459), UINT64_C( 6443200458896623809),
+    UINT64_C(11512913030513882957), UINT64_C(11575103416115708965), UINT64_C(12477663841456122970),
+    UINT64_C(16118389901210919130), UINT64_C( 7739304840685703036), UINT64_C(  130669980232277858),
+    UINT64_C(17823594418657926048), UINT64_C( 1263241722204132674), UINT64_C( 9185229491285148127),
+    UINT64_C( 8306498383506507719), UINT64_C( 4495120019807181205), UINT64_C(17480705079960335385),
+    UINT64_C(12715736856407906985), UINT64_C( 6583805822730795444), UINT64_C(14529844730871773958),
+    UINT64_C(12102788161924272379), UINT64_C( 4967775568495622862), UINT64_C( 1122186895142029005),
+    UINT64_C(15386510400301185523), UINT64_C( 4328784817532517809), UINT64_C(10073687856281732059),
+    UINT64_C(10725463741830049887), UINT64_C(17708970715257476720), UINT64_C( 4077341919811767384),
+    UINT64_C(10306031299823563490), UINT64_C(13498120523368437627), UINT64_C(13485968766704846239),
+    UINT64_C(16017394398766337725), UINT64_C(12129794759514250367), UINT64_C( 4297355318857884747),
+    UINT64_C(16272084940087294461), UINT64_C(16895146961172371408), UINT64_C(11322036806756873817),
+    UINT64_C( 3630145171356612700), UINT64_C( 8629304453005980844), UINT64_C(12460664758243516339),
+    UINT64_C( 7476882340635049218), UINT64_C( 1486318283782272860), UINT64_C( 3772850819418252653),
+    UINT64_C( 7168386879513481623), UINT64_C( 5866654710691962241), UINT64_C( 2248687560823562468),
+    UINT64_C( 5850690637205668979), UINT64_C(11934009742965345822), UINT64_C( 7499871809575885047),
+    UINT64_C( 9638658681148450558), UINT64_C(10646359689980186944), UINT64_C( 9597304288225842216),
+    UINT64_C(12294368113941525151), UINT64_C(   24461815526594499), UINT64_C(18369228171912251969),
+    UINT64_C( 9155831467447095028), UINT64_C( 5696333918988051541), UINT64_C( 2570304378268969255),
+    UINT64_C(14193231566300285038), UINT64_C(11109857051654936561), UINT64_C( 2622197606181717120),
+    UINT64_C(16185127583204426908), UINT64_C( 3978823116030130811), UINT64_C(15154515988653935054),
+    UINT64_C(14520248207122253095), UINT64_C(13882808618241474806), UINT64_C( 8979275251680223605),
+    UINT64_C(16559144773553075151), UINT64_C( 6381930374430612454), UINT64_C( 3344219441214789307),
+    UINT64_C(12661459239641071752), UINT64_C(14839304683252264626), UINT64_C(14775566515510681151),
+    UINT64_C( 6045239971260455049), UINT64_C( 4736265982095914195), UINT64_C(   78410135279756251),
+    UINT64_C(15338587515169939093), UINT64_C( 9771630181710250272), UINT64_C( 4501511362768488368),
+    UINT64_C(14507341174632683448), UINT64_C( 7541446626421407554), UINT64_C( 7699526599916018886),
+    UINT64_C( 2582330564346310974), UINT64_C( 3976647518258977272), UINT64_C(  531727775681859461),
+    UINT64_C(12069881424144017810), UINT64_C( 1804630786900400387), UINT64_C( 8843897117230103692),
+    UINT64_C(13554257670783551037), UINT64_C(13032572060450091689), UINT64_C(11184532636528204145),
+    UINT64_C(10503928966076452241), UINT64_C( 9416038082893156639), UINT64_C( 6860541367464943884),
+    UINT64_C(11805464432888224534), UINT64_C(17303122444075855817), UINT64_C( 6333878806882683727),
+    UINT64_C( 5086027746975658020), UINT64_C( 9155058300086326904), UINT64_C(11517037091520840742),
+    UINT64_C(12543467571032398363), UINT64_C(10423607471261990372), UINT64_C( 3127840212824773930),
+    UINT64_C(15653980797142434086), UINT64_C(11873734033318438476), UINT64_C( 3245320304850914348),
+    UINT64_C( 4884736965155498732), UINT64_C(11734652525641497737), UINT64_C(17245444051907559399),
+    UINT64_C(14159432196407066509), UINT64_C(11503456095979707603), UINT64_C(17410115713941224036),
+    UINT64_C(14285753754501405974), UINT64_C(17243832490236774748), UINT64_C( 3787255984459739831),
+    UINT64_C( 8024169205869135804), UINT64_C(10626925666445331970), UINT64_C( 9690898209205372521),
+    UINT64_C( 4759206942003322187), UINT64_C(13707139569209266452), UINT64_C(  672848503833460518),
+    UINT64_C(   95987631002028468), UINT64_C( 2863048761916044041), UINT64_C(14039709025235437416),
+    UINT64_C( 3078807729026955127), UINT64_C(  254836700429067052), UINT64_C( 9932836222733463443),
+    UINT64_C(15110000285036153876), UINT64_C(10151186984039427638), UINT64_C(11118012452119989932),
+    UINT64_C(  572645798096284593), UINT64_C(15889455528737318772), UINT64_C( 9411337913436806224),
+    UINT64_C(10991217087135791041), UINT64_C( 6067484477055414414), UINT64_C( 6437919953447004591),
+    UINT64_C(11607474028830000671), UINT64_C( 9481653377679957315), UINT64_C(10646950603896809155),
+    UINT64_C(13778850235942689910), UINT64_C( 9083480732710171026), UINT64_C( 8001548998425837829),
+    UINT64_C(10298968326806278664), UINT64_C( 4289954220160652211), UINT64_C( 2752645131711413306),
+    UINT64_C(12230893706200062697), UINT64_C(17867199598818401289), UINT64_C( 1216520176037422674),
+    UINT64_C(18325789099199263793), UINT64_C( 7374630321694060135), UINT64_C(13913713089845336345),
+    UINT64_C(10161334706426013491), UINT64_C(16433369976412786273), UINT64_C( 2235981948632631074),
+    UINT64_C( 8838700687362857542), UINT64_C( 7034844528439070039), UINT64_C(13481482189455791693),
+    UINT64_C(18357011158804818273), UINT64_C( 3999354445271644639), UINT64_C(17034805498615549843),
+    UINT64_C( 9592893666416490715), UINT64_C(16164061198900539473), UINT64_C(16082955056313678557),
+    UINT64_C( 5822734488514074606), UINT64_C(14909495559465437149), UINT64_C( 5378459061492513132),
+    UINT64_C( 7001469158322051988), UINT64_C(10692744980473294019), UINT64_C( 5972425649319574125),
+    UINT64_C( 6441215611455293531), UINT64_C(15265364172513311219), UINT64_C(17494854099459694906),
+    UINT64_C(18038565550690378142), UINT64_C(17236062477738240902), UINT64_C( 7377490434551050933),
+    UINT64_C( 3424202695595502982), UINT64_C(18234528760909959455), UINT64_C(10882747335867178343),
+    UINT64_C( 6985682635088175111), UINT64_C( 6253283448243560025), UINT64_C( 9136136959168119447),
+    UINT64_C( 8652021526735525815), UINT64_C( 7296322697798091088), UINT64_C(13016560217115213790),
+    UINT64_C(18029781054459417395), UINT64_C( 2273949441334558367), UINT64_C( 6728025973953006808),
+    UINT64_C( 6217306326304421106), UINT64_C(16874643695714114168), UINT64_C( 4359376259138690998),
+    UINT64_C( 5030742587657365829), UINT64_C(18206906245499758124), UINT64_C( 7410572397809911806),
+    UINT64_C(18005019563214112274), UINT64_C( 3274168496518998345), UINT64_C( 2752899292928666367),
+    UINT64_C( 3019809032201759195), UINT64_C( 5862007187602539930), UINT64_C( 5622111030882929658),
+    UINT64_C(10550047341535427346), UINT64_C( 2056695708063941050), UINT64_C(15810225135455114713),
+    UINT64_C( 6869331714543552139), UINT64_C( 9066590402320305016), UINT64_C(11089440343912081885),
+    UINT64_C(13909152336322181642), UINT64_C(18392092871640680629), UINT64_C(10600645364975923081),
+    UINT64_C( 9363405318233232586), UINT64_C(14869469983739622653), UINT64_C( 6883686189664967501),
+    UINT64_C( 3895923113283386234), UINT64_C( 2216033280431998332), UINT64_C(16211453574286720265),
+    UINT64_C( 5339677335566971987), UINT64_C( 6465541350868673194), UINT64_C( 7459520564226563706),
+    UINT64_C(17195337776633760915), UINT64_C(11522679815789501121), UINT64_C(14162755493471754053),
+    UINT64_C(  300809051667938773), UINT64_C( 3142244418992661965), UINT64_C(16003131886187289143),
+    UINT64_C( 7456276888119978618), UINT64_C( 7663244977101858865), UINT64_C( 2036216639697232466),
+    UINT64_C( 8232207398840695756), UINT64_C( 3529943973157773122), UINT64_C(14794715304631363592),
+    UINT64_C(  872510053787920802), UINT64_C( 1252528264857142566), UINT64_C( 8882497092748815508),
+    UINT64_C( 7833581193968055329), UINT64_C( 7863295375461204346), UINT64_C( 4047090120333792969),
+    UINT64_C(17018020734308703613), UINT64_C(14344573676170043689), UINT64_C(11505048743777800199),
+    UINT64_C(14291556568173430014), UINT64_C(  652297738383745238), UINT64_C(16109430844135770690),
+    UINT64_C( 3957915668538628661), UINT64_C(12448665621226561668), UINT64_C( 1890646423649723651),
+    UINT64_C(12452217056659572290), UINT64_C(18315478446075648266), UINT64_C(16288682970049758970),
+    UINT64_C(12866023608407391423), UINT64_C(12996934945264864498), UINT64_C(12287092831111173907),
+    UINT64_C( 2171355101686743898), UINT64_C(15773467639371951193), UINT64_C(16698642516105478576),
+    UINT64_C(11787632411981900071), UINT64_C(10266337253704454376), UINT64_C(12807398587163362765),
+    UINT64_C(11738844319450614065), UINT64_C( 1784711916235667025), UINT64_C(10021637163687959813),
+    UINT64_C(10642566553755665302), UINT64_C( 9726876854127848885), UINT64_C( 6746849224164793048),
+    UINT64_C(12165701701706431062), UINT64_C( 6396228102697696688), UINT64_C(13715508454717116601),
+    UINT64_C( 8231658879340972341), UINT64_C(16027290614553295793), UINT64_C(12513218263882198840),
+    UINT64_C(15590697557548876860), UINT64_C( 1075651722176584950), UINT64_C(12656698217835645068),
+    UINT64_C(10961901795371505690), UINT64_C( 1889521461530464449), UINT64_C( 2432566150868916570),
+    UINT64_C(10322371079998837890), UINT64_C( 6033254772626564475), UINT64_C(13649171304409991252),
+    UINT64_C( 3832572677287299573), UINT64_C( 2307395964665233507), UINT64_C(12475778644114153041),
+    UINT64_C(16540085623034954286), UINT64_C( 4750132803226430111), UINT64_C( 4198974528453959767),
+    UINT64_C( 7274419736653999941), UINT64_C(  254416687061439166), UINT64_C(16850131586838161208),
+    UINT64_C(12786757455179205828), UINT64_C( 5581151407040918802), UINT64_C(15156759591311125981),
+    UINT64_C( 1722083206256503747), UINT64_C( 9328548169882901719), UINT64_C(  990022812456610872),
+    UINT64_C( 9881331870641118555), UINT64_C(12049397719285244198), UINT64_C( 4987968590957632865),
+    UINT64_C( 2146598112778880449), UINT64_C(17402330971756911906), UINT64_C( 3056973087184745056),
+    UINT64_C(13669686549610570397), UINT64_C(  623305502314921416), UINT64_C(17497062053149475581),
+    UINT64_C( 7405676869306237278), UINT64_C( 5532876733669106738), UINT64_C( 8240553566300579717),
+    UINT64_C( 3189968590923679926), UINT64_C( 8405748401605030548), UINT64_C(11206691778153861658),
+    UINT64_C(11148615867148183830), UINT64_C(10261990048321429687), UINT64_C( 2246657378885347910),
+    UINT64_C(15515590573010947314), UINT64_C( 8700513040406821399), UINT64_C( 9733285965791576496),
+    UINT64_C(17201596042718443425), UINT64_C( 2631548843585837018), UINT64_C(  379090208284061247),
+    UINT64_C(16100439932994944206), UINT64_C( 8352715037812952509), UINT64_C(   17055205521740855),
+    UINT64_C( 8224982527596579337), UINT64_C( 1257217577105430413), UINT64_C( 7157213043144299797),
+    UINT64_C(12661497099593666784), UINT64_C(11322659193718036188), UINT64_C( 8787138211229204979),
+    UINT64_C(18157528597930597323), UINT64_C(11038091896020763806), UINT64_C( 6439702009720112460),
+    UINT64_C(17402968309403389833), UINT64_C( 9450328178349543926), UINT64_C( 4492689999513041997),
+    UINT64_C( 6349948458070133046), UINT64_C( 9010055959760938664), UINT64_C(17167148508919240741),
+    UINT64_C( 2806609015808799849), UINT64_C(12534994330021592978), UINT64_C(12182153246060668138),
+    UINT64_C( 8643327159490624572), UINT64_C( 4027676808129890998), UINT64_C(10645230717172782271),
+    UINT64_C( 1826168187389211532), UINT64_C( 1403435500826312267), UINT64_C( 6429555952086295166),
+    UINT64_C(10115886175621146337), UINT64_C(12241825335880391670), UINT64_C(15704278621579276183),
+    UINT64_C(15230184033699097163), UINT64_C(17015399918867132228), UINT64_C( 9000181329360884743),
+    UINT64_C(10629757253036898239), UINT64_C( 1704843981562651907), UINT64_C( 8136386662437588952),
+    UINT64_C(14961093215861311137), UINT64_C( 8560809195337807269), UINT64_C( 5111798528854729313),
+    UINT64_C( 7775473486715508113), UINT64_C(17762903639440307511), UINT64_C(11151012350433434450),
+    UINT64_C(11474038477785474687), UINT64_C(14161686145742608784), UINT64_C(11293533659173631538),
+    UINT64_C( 7754579161951706275), UINT64_C( 9195693298377512526), UINT64_C(14936105229919994339),
+    UINT64_C(11482790927095615842), UINT64_C( 3448556672285881053), UINT64_C( 9784194258788294041),
+    UINT64_C(15700289162308624648), UINT64_C( 4315634708057759568), UINT64_C(10794980214055470734),
+    UINT64_C(12107042893527724188), UINT64_C( 8567017834638334075), UINT64_C(14093540035221228303),
+    UINT64_C(11048095471473072411), UINT64_C(10529457996586862493), UINT64_C(11905610864067344396),
+    UINT64_C(16803476238124374865), UINT64_C(16156570550052505781), UINT64_C(10771168116200567026),
+    UINT64_C(11971132491201715112), UINT64_C( 4001855156405467528), UINT64_C(15825844921739520941),
+    UINT64_C(17225831505119048980), UINT64_C(12046677056792040757), UINT64_C(16514841308514372967),
+    UINT64_C(14464710286688400648), UINT64_C(17234158082678719088), UINT64_C(13645288787509415538),
+    UINT64_C(18051681409105429418), UINT64_C(16969344308824198111), UINT64_C( 7651825152558544905),
+    UINT64_C( 2580959143501428019), UINT64_C( 6112887969270132668), UINT64_C(15103813793410084778),
+    UINT64_C(15520876157200193303), UINT64_C( 2712849094256534171), UINT64_C(15897884610201405173),
+    UINT64_C( 7338011610394650440), UINT64_C( 5605778413505348222), UINT64_C( 5731351016651201988),
+    UINT64_C( 1788098870203610026), UINT64_C( 1133910861680439610), UINT64_C( 4408426383020386314),
+    UINT64_C(12450349862931704585), UINT64_C( 1737709173000903032), UINT64_C( 7492435792878062582),
+    UINT64_C( 8423880362286389580), UINT64_C( 4239622462785638737), UINT64_C(16401576052763007417),
+    UINT64_C( 1461536338238673967), UINT64_C(11269836023646691818), UINT64_C( 9859887029876077619),
+    UINT64_C(14264010252032283412), UINT64_C(13596532555706800683), UINT64_C( 6822504531140477766),
+    UINT64_C(12016294888912352836), UINT64_C(  435494071194545807), UINT64_C(  894283263009989680),
+    UINT64_C(12434899381065634253), UINT64_C( 6979599478355192629), UINT64_C( 8568020957297357812),
+    UINT64_C(15293725646623257306), UINT64_C( 5167811562895943083), UINT64_C( 5832728587266957763),
+    UINT64_C(12237496557673552793), UINT64_C(14849058830180502082), UINT64_C( 6296506251041077728),
+    UINT64_C( 5810097068526180776), UINT64_C(  172533903620741118), UINT64_C( 4862274122171762007),
+    UINT64_C(16496599424677372466), UINT64_C(15468721366437727469), UINT64_C(11610042555730262784),
+    UINT64_C( 1983865068438870934), UINT64_C(18387293434845979937), UINT64_C( 6871691014528131478),
+    UINT64_C( 7080058815263214816), UINT64_C( 6744029447420477818), UINT64_C( 4302711592263098197),
+    UINT64_C(17409433499605717948), UINT64_C(16416621152713438563), UINT64_C(  840456408051932645),
+    UINT64_C(11294522481595846559), UINT64_C(10925002182911592794), UINT64_C( 2681278023525660313),
+    UINT64_C(14340433193539567561), UINT64_C( 9053187971685100622), UINT64_C( 3629845027467098254),
+    UINT64_C( 1694032344139146874), UINT64_C( 4218692589945464159), UINT64_C( 2875026988892579147),
+    UINT64_C(14290123386078801935), UINT64_C(  170927688832692430), UINT64_C(13964605645012122217),
+    UINT64_C( 7174009632630994251), UINT64_C(15194402681629627981), UINT64_C(12372816803839260790),
+    UINT64_C( 7769793644483073709), UINT64_C( 4439354300799310817), UINT64_C( 5497567564248630878),
+    UINT64_C(  880807957311642350), UINT64_C(11170884338934633447), UINT64_C(10224771677462089957),
+    UINT64_C( 4304885208752843836), UINT64_C(15436063082184030409), UINT64_C( 1181112454815160509),
+    UINT64_C(  275897729034872583), UINT64_C(16005455767029290962), UINT64_C(10938132618990044182),
+    UINT64_C(10966396253724994548), UINT64_C( 9214814039583193524), UINT64_C( 6631467575928358925),
+    UINT64_C(10111529863462607896), UINT64_C(11747881303468510161), UINT64_C(18235735398561573857),
+    UINT64_C( 4648499123191517346), UINT64_C(11250064704155485577), UINT64_C(17636599819488206590),
+    UINT64_C( 2052597889359749478), UINT64_C( 1504474396047107113), UINT64_C( 7710365420989902711),
+    UINT64_C(11043503758282258888), UINT64_C( 9001310597693602709), UINT64_C(14669646832077077053),
+    UINT64_C(13805449715194981572), UINT64_C(10002526933506384427), UINT64_C(  584351624483737750),
+    UINT64_C( 2089448816841647482), UINT64_C( 3063357801096097519), UINT64_C( 8441580082710422575),
+    UINT64_C( 8163190115429038375), UINT64_C( 8679969817672328391), UINT64_C(10786349082075570260),
+    UINT64_C( 3077693293282533005), UINT64_C( 6237992478970179171), UINT64_C(17535018614770782894),
+    UINT64_C(15785750465899544249), UINT64_C( 3330824619204820042), UINT64_C( 2235098692707119901),
+    UINT64_C( 5937604190714457327), UINT64_C(15360416150410119596), UINT64_C(16823881678611018404),
+    UINT64_C( 3341309167902416981), UINT64_C(13521573888156335533), UINT64_C(   85355377280133996),
+    UINT64_C(17962805464010488872), UINT64_C( 7113561492258432520), UINT64_C( 7731545197556358234),
+    UINT64_C(11109824235417418164), UINT64_C(12287347858620255708), UINT64_C(14073644649909632586),
+    UINT64_C(15973116486014342512), UINT64_C( 6748814774243083466), UINT64_C( 5828018878488759416),
+    UINT64_C( 3121607881461799216), UINT64_C(10296210552498631134), UINT64_C( 4804515881247198084),
+    UINT64_C( 4435253151462025165), UINT64_C(13116883561509815272), UINT64_C( 2421352641891020323),
+    UINT64_C( 9956658998778125039), UINT64_C(  679481716875319771), UINT64_C(11509495988375561069),
+    UINT64_C(12254801840401612453), UINT64_C( 4992990696979739053), UINT64_C(11796945450216900233),
+    UINT64_C( 1821587968244915234), UINT64_C( 3095422894146496176), UINT64_C(11883449239511168843),
+    UINT64_C(12648467046725001604), UINT64_C(10257626828678421994), UINT64_C( 5707072159805882425),
+    UINT64_C(12727956937651629749), UINT64_C(17846959596629339414), UINT64_C(10808694443848580789),
+    UINT64_C( 1727162295983877276), UINT64_C(15206808220733826101), UINT64_C(11408074900623134361),
+    UINT64_C(  421394155942221550), UINT64_C( 2540159898191690660), UINT64_C( 3242688518861120275),
+    UINT64_C(17154671887467502232), UINT64_C(17914007490422808973), UINT64_C( 8233446660610202014),
+    UINT64_C(10989167209467388295), UINT64_C(10619904506830340087), UINT64_C(13940452726225778583),
+    UINT64_C( 8066069420161784708), UINT64_C(11011418433854955872), UINT64_C(14459484240492200935),
+    UINT64_C( 9314797250140296412), UINT64_C(17622689995866378886), UINT64_C(12719543456182720607),
+    UINT64_C( 8759620632532036232), UINT64_C(12592794377978941680), UINT64_C( 1454620441436477109),
+    UINT64_C(15759348354816449072), UINT64_C( 7555489098902979182), UINT64_C(  134268077074529599),
+    UINT64_C(11745146450331516324), UINT64_C(16256533568361669437), UINT64_C( 7223926964119234587),
+    UINT64_C(13256039959798386620), UINT64_C( 9937759088805152167), UINT64_C( 3349166575540350567),
+    UINT64_C(12887687241070563769), UINT64_C( 2680264554551489064), UINT64_C(  793068917710524973),
+    UINT64_C( 8618018390916417896), UINT64_C( 5405992413046918726), UINT64_C( 2687211512919463414),
+    UINT64_C(15997412630634335311), UINT64_C(14194820406529501726), UINT64_C(12309146030904212639),
+    UINT64_C( 4255276547921751230), UINT64_C(16930815459415563707), UINT64_C(  973518347906190379),
+    UINT64_C(11988605753983944017), UINT64_C(10455617569912743317), UINT64_C(12556689533324906088),
+    UINT64_C( 5358193899282252749), UINT64_C( 5005695651326292071), UINT64_C(14938518570292076563),
+    UINT64_C( 9837318816571493412), UINT64_C( 7864852164519968045), UINT64_C(11139062284414466251),
+    UINT64_C(18088270889790927068), UINT64_C(14522459691581194862), UINT64_C( 3719684256269694981),
+    UINT64_C(11474038312562485407), UINT64_C( 9438719894477140849), UINT64_C( 4546549897040588744),
+    UINT64_C(10356312683537951436), UINT64_C(13946665275450046982), UINT64_C( 7721719842277812446),
+    UINT64_C( 5753905819081586854), UINT64_C(14761836697170312800), UINT64_C( 9501914169269724618),
+    UINT64_C(16715704386363945700), UINT64_C(12516352555523415419),
+};
+
+const uint64_t ntt64_1024_inv_mixed_powers_rev[2048] = {
+    UINT64_C(                   0), UINT64_C( 1597448745227320835), UINT64_C(  761857419626957580),
+    UINT64_C( 2710721342076890128), UINT64_C( 1935475755192423451), UINT64_C( 3350471304231487799),
+    UINT64_C( 4377932053308918032), UINT64_C(  587789728123186789), UINT64_C( 1157250618443755893),
+    UINT64_C( 2221131196417811176), UINT64_C( 2564987455095371273), UINT64_C( 1902221937773971537),
+    UINT64_C( 3669174251795154654), UINT64_C( 3729729506260150116), UINT64_C( 2911249064764753991),
+    UINT64_C(  905808140936917219), UINT64_C(  639054271616479546), UINT64_C( 2732037966935316176),
+    UINT64_C( 3204409509980914063), UINT64_C( 3450216611516306163), UINT64_C( 4376876956895888490),
+    UINT64_C(  940418972106513807), UINT64_C( 2760778514640823230), UINT64_C( 2952442330362223250),
+    UINT64_C( 3695716953298051000), UINT64_C(  622103464257758799), UINT64_C(  710016457855204048),
+    UINT64_C( 1594171772562501572), UINT64_C( 1186577149813220829), UINT64_C( 4480554820949425278),
+    UINT64_C( 2286621563204459736), UINT64_C( 2543517489763520818), UINT64_C( 2518143763569825595),
+    UINT64_C( 2741659047296060101), UINT64_C( 2119496627304744197), UINT64_C( 2144077764022377872),
+    UINT64_C(  168638480407937784), UINT64_C( 3918705182497170566), UINT64_C( 3129315382663975828),
+    UINT64_C( 3355949620552154141), UINT64_C( 4472195940790185488), UINT64_C( 2751233240531944786),
+    UINT64_C( 1499350668375303258), UINT64_C( 1248002338178829171), UINT64_C( 3567284871720512811),
+    UINT64_C( 1234442225656141459), UINT64_C( 3763491949833913430), UINT64_C( 1060613886943446140),
+    UINT64_C( 3264172983210285134), UINT64_C( 2489668634475609185), UINT64_C( 3841181355456011629),
+    UINT64_C( 1369146478535435641), UINT64_C( 3392916100477006765), UINT64_C(  359507763978187366),
+    UINT64_C(  555828328234909737), UINT64_C( 2174516744161416095), UINT64_C( 1954247733637594417),
+    UINT64_C(  725412660728098737), UINT64_C( 2111922664544689878), UINT64_C(  742013158005111008),
+    UINT64_C( 1240199724792153435), UINT64_C(  780878330587786088), UINT64_C( 1921677797576536864),
+    UINT64_C(   20889235576210587), UINT64_C( 4496393519485882796), UINT64_C( 4414492656106525461),
+    UINT64_C( 3659058810323815146), UINT64_C(  987095120295666199), UINT64_C( 3311475337570466030),
+    UINT64_C( 3506432583028438168), UINT64_C(  285689082385626359), UINT64_C( 4412928894968847241),
+    UINT64_C( 2537104245248995553), UINT64_C( 1665826217812080608), UINT64_C(  731765432187947649),
+    UINT64_C( 1891136571931492898), UINT64_C( 4225915260518903062), UINT64_C( 4355191397499074548),
+    UINT64_C( 2735397719334417532), UINT64_C( 3466262785815169999), UINT64_C( 3605333392231190231),
+    UINT64_C(  269306830564414396), UINT64_C( 1120814483693474787), UINT64_C( 2017476264382028580),
+    UINT64_C( 3742512134928732514), UINT64_C( 2548626421653948144), UINT64_C( 4533773427922209202),
+    UINT64_C(  696257273046130940), UINT64_C( 2193432016802705753), UINT64_C( 2975220724877980164),
+    UINT64_C( 2882382901230641861), UINT64_C( 3645051885560699331), UINT64_C( 1810022447750714951),
+    UINT64_C( 1396240308299844916), UINT64_C( 4346702427129799775), UINT64_C( 2843325644492115562),
+    UINT64_C( 4598429215067134441), UINT64_C( 3790933749033458680), UINT64_C( 3492742837712600844),
+    UINT64_C(  240478021931730534), UINT64_C( 1661524647014962481), UINT64_C( 3001622122015329047),
+    UINT64_C( 1730070688507719588), UINT64_C( 4224277455101570246), UINT64_C( 2640980177126376160),
+    UINT64_C( 1893480464646211789), UINT64_C( 1893379940007000628), UINT64_C(  281473891911111437),
+    UINT64_C( 3926285842576049221), UINT64_C( 4078792279463268178), UINT64_C( 1384498799995891117),
+    UINT64_C( 3478699736926467196), UINT64_C( 2549503998005738133), UINT64_C( 4015429778703181575),
+    UINT64_C( 2331988058544996978), UINT64_C( 4017163793695325786), UINT64_C( 4398151684498689441),
+    UINT64_C(  773420327846667715), UINT64_C( 1351908699938707637), UINT64_C( 1438435331577261502),
+    UINT64_C(  219696150493157962), UINT64_C( 4337533379984076294), UINT64_C( 3123649255787014599),
+    UINT64_C( 4285343716429371071), UINT64_C( 3487809379802074180), UINT64_C( 3686859850597173965),
+    UINT64_C(  601801449878166425), UINT64_C(  566447303828363281), UINT64_C(  259929117461122690),
+    UINT64_C( 2534087554591265284), UINT64_C( 1671710623904955317), UINT64_C(  726823701492065576),
+    UINT64_C( 2769070406059010880), UINT64_C(  576559400180798021), UINT64_C( 1525463987982470819),
+    UINT64_C( 4531371429972998074), UINT64_C(  845371447597876730), UINT64_C( 3670210081921092754),
+    UINT64_C( 4461354769932320401), UINT64_C( 3977388320420463150), UINT64_C( 4562367534651267261),
+    UINT64_C( 4321344604600969480), UINT64_C(  881010135713225209), UINT64_C( 1782453363043580942),
+    UINT64_C( 3559966345376906418), UINT64_C( 2738823817611127352), UINT64_C( 1018672395301484236),
+    UINT64_C( 1639503924621406683), UINT64_C( 4164257115212022658), UINT64_C(  321732475974946595),
+    UINT64_C( 3991696183642031693), UINT64_C( 1956067693854901028), UINT64_C(   69730768822361569),
+    UINT64_C(  341119304675706466), UINT64_C(  972924256587072614), UINT64_C( 3915913354687023729),
+    UINT64_C(  389554631849401936), UINT64_C( 1663327109906766898), UINT64_C(  508668229988975855),
+    UINT64_C( 3951765528314891606), UINT64_C(  474918150100967821), UINT64_C(  947653754879841762),
+    UINT64_C( 2390073540969705624), UINT64_C( 3557789920013087769), UINT64_C(  929558361631964678),
+    UINT64_C( 2552303672863703893), UINT64_C(  826033961802171977), UINT64_C( 2605888453019777046),
+    UINT64_C(  252360766593729347), UINT64_C( 3513100483767801861), UINT64_C( 1707928536562031796),
+    UINT64_C( 2781862426208510548), UINT64_C( 1439619867643852777), UINT64_C(  183141745685910901),
+    UINT64_C( 1361718275344907393), UINT64_C( 2959817697163268132), UINT64_C( 2762525263948563595),
+    UINT64_C( 1341517252468509167), UINT64_C(  500533747675448236), UINT64_C(  845826707751491030),
+    UINT64_C( 1241070534499560266), UINT64_C( 4243975769763796303), UINT64_C(   67514058206998667),
+    UINT64_C( 2873987136448611317), UINT64_C( 1988821503273290230), UINT64_C( 1014106208068792177),
+    UINT64_C( 3709495328277798306), UINT64_C( 3618994673477555001), UINT64_C(  503608079446868463),
+    UINT64_C( 1775408336037874833), UINT64_C( 3619050494210550099), UINT64_C( 2119678531609113096),
+    UINT64_C( 3453319317856532861), UINT64_C( 4377644333194108072), UINT64_C( 2299554859802111181),
+    UINT64_C( 3659758494305853749), UINT64_C(  890296088169815968), UINT64_C( 3025652181590952288),
+    UINT64_C( 2978938847393239339), UINT64_C( 1874405826707438282), UINT64_C(  895520239994101401),
+    UINT64_C( 4406789659874271060), UINT64_C(  475956906388850203), UINT64_C( 1923906360428460678),
+    UINT64_C( 2014884993995062392), UINT64_C( 2266848510582485458), UINT64_C( 2072907831397488931),
+    UINT64_C( 3131652907251769454), UINT64_C( 1638356955527820207), UINT64_C( 3666301082479696243),
+    UINT64_C( 3082118428190026655), UINT64_C( 1870443561497370052), UINT64_C( 2303343809274674337),
+    UINT64_C(  228925669915772045), UINT64_C( 3844646960227800326), UINT64_C( 2018806268997838899),
+    UINT64_C( 4524716785335492365), UINT64_C( 2694178106302160104), UINT64_C(  916448375621774411),
+    UINT64_C( 4481875101282788461), UINT64_C( 2387157249192273180), UINT64_C( 3814388044261891669),
+    UINT64_C( 4222933272381401292), UINT64_C( 2975744674484854296), UINT64_C(   54401244900000446),
+    UINT64_C(  403912456936482342), UINT64_C( 3738786304041136961), UINT64_C( 3059163844330049364),
+    UINT64_C( 2192654908740803739), UINT64_C( 3794907154875265834), UINT64_C( 2410903021786764458),
+    UINT64_C(   52571326077472245), UINT64_C(  588918264645213105), UINT64_C( 2292061085530386825),
+    UINT64_C( 4393533854220134376), UINT64_C( 2470563529832768384), UINT64_C( 4337349785390127300),
+    UINT64_C( 1074353827411989244), UINT64_C( 3818441481049447908), UINT64_C( 3369395599594563037),
+    UINT64_C( 4486520662148728802), UINT64_C( 1777355286419178464), UINT64_C( 3651987553310790167),
+    UINT64_C(  605646616495769660), UINT64_C( 2397472584697199582), UINT64_C( 2992666649543695505),
+    UINT64_C( 3133518461913316388), UINT64_C(  263649993022218554), UINT64_C( 4348048275020021631),
+    UINT64_C( 1074070929108427065), UINT64_C( 3028333429807653516), UINT64_C( 1720235100163152873),
+    UINT64_C( 3685969970649508253), UINT64_C(  345749411583370006), UINT64_C( 1989893649827399347),
+    UINT64_C(  213757508065116192), UINT64_C( 1136970171935060389), UINT64_C(  135388361897363864),
+    UINT64_C(  829986534226567594), UINT64_C( 2518421964070420713), UINT64_C(  623460423351514340),
+    UINT64_C( 3579309749962466460), UINT64_C( 1446465725090073460), UINT64_C( 1424083479747005929),
+    UINT64_C( 3152509391186728425), UINT64_C(  890995105533806502), UINT64_C( 4126194883144571696),
+    UINT64_C( 1869220585158753174), UINT64_C( 1876870525576028994), UINT64_C( 1934826210171416308),
+    UINT64_C( 4360097470762206737), UINT64_C( 3693891628877652244), UINT64_C( 2474242528778897655),
+    UINT64_C(  787394278904577301), UINT64_C( 3734332116149173950), UINT64_C( 3032448689878547779),
+    UINT64_C( 3277577877463633490), UINT64_C( 1478634811053175701), UINT64_C( 3930709610593225508),
+    UINT64_C( 3630062051780545542), UINT64_C( 2519742877070227732), UINT64_C( 3673249488438930105),
+    UINT64_C( 1256763710343728242), UINT64_C( 1874967952393962103), UINT64_C( 1533053825403530061),
+    UINT64_C( 3178934214101961218), UINT64_C( 1525871210789010239), UINT64_C( 1885361656605342679),
+    UINT64_C( 3335076197782862170), UINT64_C(  420716886884460848), UINT64_C( 2149368097306312619),
+    UINT64_C( 2576507824955878287), UINT64_C( 3905541298627606936), UINT64_C( 2766795047862501731),
+    UINT64_C( 2737073233102681860), UINT64_C(  655549401545426078), UINT64_C( 1570305887939507687),
+    UINT64_C(  528183770302926512), UINT64_C( 2538085162567975975), UINT64_C( 1466663677672983396),
+    UINT64_C( 3249924556539299284), UINT64_C( 2296307372821275815), UINT64_C( 1080301474579015457),
+    UINT64_C( 3834646878792466042), UINT64_C( 3309138426782285514), UINT64_C( 3367345159394646143),
+    UINT64_C( 1697176449389017037), UINT64_C( 2830509201689204628), UINT64_C( 4280677947144166879),
+    UINT64_C( 2878228257628456680), UINT64_C(  576549880350533040), UINT64_C( 1595482593607645320),
+    UINT64_C( 2757163375145060952), UINT64_C( 3762709555740706764), UINT64_C( 4132097551481449465),
+    UINT64_C( 3073592028485366274), UINT64_C( 2913941844454968569), UINT64_C( 1241943892123899649),
+    UINT64_C( 3985388427924175927), UINT64_C(  132931943920464216), UINT64_C(  963572232227621138),
+    UINT64_C( 1086187686209696124), UINT64_C( 4334591613285693131), UINT64_C( 4427242678814347554),
+    UINT64_C( 2923393519039357984), UINT64_C(  265849896788346259), UINT64_C( 3380477618653367844),
+    UINT64_C( 3548307891575053927), UINT64_C(   88313001273509989), UINT64_C(  229481740030525564),
+    UINT64_C( 1142034642720021053), UINT64_C(  943212704854558556), UINT64_C( 3581470053372412633),
+    UINT64_C( 4455898604664459746), UINT64_C(  448202126250173565), UINT64_C( 1184066495523972765),
+    UINT64_C( 1479519005097051223), UINT64_C( 4100879462871234869), UINT64_C( 4128379535214024737),
+    UINT64_C( 4068021235021803744), UINT64_C( 4121606289736188335), UINT64_C( 4474914786204157506),
+    UINT64_C( 1104068613108266923), UINT64_C( 2244818812920044936), UINT64_C( 1265464259985722977),
+    UINT64_C(  652533216445055972), UINT64_C( 4322585822259518046), UINT64_C( 2661589922495033735),
+    UINT64_C(  987100506351041320), UINT64_C( 3632461182717925746), UINT64_C( 2935790622343543901),
+    UINT64_C(  645582641086574590), UINT64_C( 4350719607959700781), UINT64_C( 4366668526428885515),
+    UINT64_C(  345259560854666578), UINT64_C( 3371492191676195091), UINT64_C(  574571179362302293),
+    UINT64_C( 2623314936775053810), UINT64_C( 4046268064833756812), UINT64_C(  994705779007527844),
+    UINT64_C( 4345232052848843299), UINT64_C( 3649531601045992464), UINT64_C( 1229784470992723326),
+    UINT64_C( 1462672659301410100), UINT64_C(  222363298121302350), UINT64_C( 1123780004951789812),
+    UINT64_C(  516132550137894883), UINT64_C( 1125377840692116595), UINT64_C( 1933456902796142000),
+    UINT64_C( 3132880113770088014), UINT64_C( 4107323397594688662), UINT64_C( 2157326113251484673),
+    UINT64_C( 3245713155201487211), UINT64_C( 3119415960364015505), UINT64_C( 2597643806533680773),
+    UINT64_C( 3165364809910252476), UINT64_C( 3252291321790303167), UINT64_C( 2747844116629241812),
+    UINT64_C(  707982160446641454), UINT64_C( 4592307042978040560), UINT64_C( 4445216908273154147),
+    UINT64_C( 3846627600075277591), UINT64_C( 2356451789188822646), UINT64_C(  451157696725097893),
+    UINT64_C(  482239113613640005), UINT64_C(  809272002027209176), UINT64_C( 3386023237205364002),
+    UINT64_C( 2681365935457499374), UINT64_C( 4383764944061676575), UINT64_C( 3002134461744886342),
+    UINT64_C(  217460571654969358), UINT64_C(  642576094567239175), UINT64_C(   92669405019080994),
+    UINT64_C( 2239558735835916297), UINT64_C( 1093332744300684120), UINT64_C(  371579570945566400),
+    UINT64_C( 4521784081167841369), UINT64_C(   32667495058069305), UINT64_C( 3249634314648685198),
+    UINT64_C( 1511309992815106380), UINT64_C( 3915370772345419643), UINT64_C( 4000825487962242896),
+    UINT64_C(  128472323706958535), UINT64_C( 1074338829714465939), UINT64_C( 3238395188897438401),
+    UINT64_C( 3740670769793061656), UINT64_C( 4403506197958660238), UINT64_C( 3470702154560351748),
+    UINT64_C( 1324867958982897001), UINT64_C( 1331772203197056095), UINT64_C( 3018668621686806755),
+    UINT64_C( 2409664670287100869), UINT64_C( 1165452898850607922), UINT64_C( 1645951455682690821),
+    UINT64_C( 2116801334240291716), UINT64_C( 1924881649978995319), UINT64_C( 1071066424862730134),
+    UINT64_C(  330027879291519521), UINT64_C(  669859680137310667), UINT64_C( 3374530130842092923),
+    UINT64_C( 2313598627037541273), UINT64_C( 2935145024351236606), UINT64_C( 2811852688171289856),
+    UINT64_C( 4046281895801086962), UINT64_C( 3432368257996892445), UINT64_C( 1499756067057231230),
+    UINT64_C( 4172578522755673204), UINT64_C(  562171890205887871), UINT64_C( 2241636511418284617),
+    UINT64_C( 2076624595876616786), UINT64_C(  538516744196509251), UINT64_C( 2442907545427550635),
+    UINT64_C( 1130070916169322880), UINT64_C( 3633422997847512353), UINT64_C(  187249431046427459),
+    UINT64_C(  907536292839148742), UINT64_C( 3394618906318341121), UINT64_C( 2893775854028913106),
+    UINT64_C( 3102951436448193621), UINT64_C(  836054860303693243), UINT64_C(  256721156335580833),
+    UINT64_C( 1150065803392597846), UINT64_C( 3281338745396304689), UINT64_C(    6115453881648595),
+    UINT64_C( 4279111333455130993), UINT64_C(  280546723785505881), UINT64_C( 2610827803358048316),
+    UINT64_C( 3017470356035989713), UINT64_C( 3301861002454902882), UINT64_C( 2229343474486230970),
+    UINT64_C( 2590958914389261682), UINT64_C( 1019335479952936867), UINT64_C( 3526947028660348658),
+    UINT64_C( 2997138256801022277), UINT64_C( 3638408044795586258), UINT64_C( 2777464262913720573),
+    UINT64_C(  998342285220525008), UINT64_C(  563431740559122686), UINT64_C( 3664247085526192562),
+    UINT64_C( 1792096719878361652), UINT64_C( 1514088270261435247), UINT64_C(  315810430551031626),
+    UINT64_C( 2969192492117753139), UINT64_C(   19602533819938967), UINT64_C(  214940600524212797),
+    UINT64_C( 1215954448296340858), UINT64_C( 1939475217606039421), UINT64_C( 4223786740293072220),
+    UINT64_C(  457333833578157900), UINT64_C( 1610800114724148084), UINT64_C(  181220087458713714),
+    UINT64_C( 4139786193388248566), UINT64_C( 4564445537667472269), UINT64_C( 1309048532335129902),
+    UINT64_C( 3479045960750655309), UINT64_C( 2399326072056448834), UINT64_C( 4427158721301587603),
+    UINT64_C( 3025697040481053315), UINT64_C( 1852184818241988882), UINT64_C(  994161879564739462),
+    UINT64_C( 3444845605885419996), UINT64_C( 3293764912996114848), UINT64_C( 3144438917205680352),
+    UINT64_C( 4004348599691564871), UINT64_C( 2314735998187876572), UINT64_C( 3519771985760240459),
+    UINT64_C( 2285274162607378987), UINT64_C( 3788628997163465257), UINT64_C( 3923659608139143229),
+    UINT64_C(  372852338023073976), UINT64_C( 1496926789713922054), UINT64_C( 2983502435741321882),
+    UINT64_C( 4228381234493753401), UINT64_C( 4370176269990062499), UINT64_C(  967167880729346584),
+    UINT64_C( 3626835293658153146), UINT64_C( 2504034192270386350), UINT64_C( 3145964027948816410),
+    UINT64_C( 1553039539814721126), UINT64_C( 3115166189560863868), UINT64_C( 1124193049055349191),
+    UINT64_C( 4029597475302710099), UINT64_C( 3396000543754538034), UINT64_C( 3709826170813048035),
+    UINT64_C( 1175671755351670266), UINT64_C( 4580317839448440772), UINT64_C( 2242618964484433073),
+    UINT64_C( 2288957866861762576), UINT64_C( 3475998875766277959), UINT64_C( 1082196204383124166),
+    UINT64_C( 3194706432379451517), UINT64_C( 2210974279307515123), UINT64_C( 3388564417695871207),
+    UINT64_C( 3060456333970082968), UINT64_C( 1864880141056631817), UINT64_C( 2527882465865639626),
+    UINT64_C( 4108342494103176500), UINT64_C( 4100394013190731825), UINT64_C( 4135021405758718373),
+    UINT64_C( 3801702055183437955), UINT64_C(  168212125958364308), UINT64_C( 4200869059531073196),
+    UINT64_C( 3249233736316200253), UINT64_C(   21338844320033395), UINT64_C( 4507445263614832331),
+    UINT64_C( 4104155288178339593), UINT64_C( 2433321491447882238), UINT64_C( 2154504597729093950),
+    UINT64_C( 2968433508329595119), UINT64_C( 2823383414793394093), UINT64_C( 1958395298492004266),
+    UINT64_C(  765839450274020639), UINT64_C( 1493106412329886238), UINT64_C( 3059374139418373254),
+    UINT64_C( 4350582742939206725), UINT64_C( 3179885864045664619), UINT64_C( 2901868507207485993),
+    UINT64_C( 1528221992317525702), UINT64_C( 3428877113679262401), UINT64_C( 2489164749694519101),
+    UINT64_C(  514173927015982751), UINT64_C( 3093204200959800088), UINT64_C( 4350742077350826206),
+    UINT64_C( 1966213041129982407), UINT64_C( 1583469701720663197), UINT64_C( 3740273303965309514),
+    UINT64_C( 1915811244275455358), UINT64_C( 1927591355247466262), UINT64_C( 2398223416604110964),
+    UINT64_C(  108873517798635920), UINT64_C( 3789189897827762986), UINT64_C( 2747291802366833654),
+    UINT64_C( 2537796746009844513), UINT64_C( 4128710327128573074), UINT64_C( 2934711079862639181),
+    UINT64_C( 1687203693560762625), UINT64_C( 1852643099452468902), UINT64_C(  423508086034784650),
+    UINT64_C(  314304394276356068), UINT64_C(  243379586976546406), UINT64_C( 3571438438625334048),
+    UINT64_C( 1078908677014434622), UINT64_C( 4027357711033923000), UINT64_C( 3946437616474866785),
+    UINT64_C( 4558632190227467596), UINT64_C( 2902510638932551518), UINT64_C(  797492147730916086),
+    UINT64_C( 4064133392090397507), UINT64_C(  688161282927849965), UINT64_C(  447024717550900323),
+    UINT64_C(  472380365382613805), UINT64_C( 2970862309877777699), UINT64_C( 2340851329558296712),
+    UINT64_C( 3859015770545988752), UINT64_C( 3045538311515152158), UINT64_C( 2589078170884475212),
+    UINT64_C( 2354009520723277661), UINT64_C( 2250045332340210195), UINT64_C(   75202262916984326),
+    UINT64_C( 2812516176038857656), UINT64_C( 3370370547363931460), UINT64_C( 3566002563008053434),
+    UINT64_C(   63604171765359481), UINT64_C(  810672129715276109), UINT64_C(  769701932256735022),
+    UINT64_C( 1000463789101361995), UINT64_C( 4174660629026349252), UINT64_C( 2777456058854340974),
+    UINT64_C( 4218660923928507935), UINT64_C(  670319505881411804), UINT64_C( 4025109983248716390),
+    UINT64_C( 3548705101632358097), UINT64_C( 4311361012976868790), UINT64_C( 2870697731773889938),
+    UINT64_C( 3586143419042493405), UINT64_C( 2696587270518879393), UINT64_C( 4509641387672572507),
+    UINT64_C(   43133475905185069), UINT64_C( 4374265513287347528), UINT64_C( 3939837088704093023),
+    UINT64_C( 2270870183177531664), UINT64_C( 3974471152550331879), UINT64_C( 3897674389387200176),
+    UINT64_C( 1248247674244928666), UINT64_C( 2772360085978006929), UINT64_C(  220201989327909512),
+    UINT64_C( 2252513989940223663), UINT64_C(  929921064067419203), UINT64_C( 3135866892758084273),
+    UINT64_C( 4440725909860055186), UINT64_C( 3698678826157822831), UINT64_C( 3451362428798728534),
+    UINT64_C( 3727373889866341080), UINT64_C( 2142005239324328990), UINT64_C( 2470332967660267572),
+    UINT64_C( 2752854608463725521), UINT64_C( 2352834478359190063), UINT64_C( 4512920352276335310),
+    UINT64_C( 2431719213531950343), UINT64_C( 1201128970311793654), UINT64_C(  754952258050436111),
+    UINT64_C(   42731922208172899), UINT64_C( 2196784552807290514), UINT64_C( 1339548474820556644),
+    UINT64_C( 2656731416611320015), UINT64_C( 3523385008805289865), UINT64_C( 3113054264164877866),
+    UINT64_C( 3840104037602511141), UINT64_C( 2284034239792018705), UINT64_C( 1770014703815795058),
+    UINT64_C( 2565497512080344890), UINT64_C(  837291643885083552), UINT64_C( 4581447274799793569),
+    UINT64_C(  434427293250223636), UINT64_C( 3412292826102481145), UINT64_C( 3181989234412891894),
+    UINT64_C(  554008320107996877), UINT64_C( 2734533154747497688), UINT64_C(  456542046847300653),
+    UINT64_C( 3690459174292560173), UINT64_C( 2796133159132037378), UINT64_C( 3807546008424755692),
+    UINT64_C( 2880669953947361209), UINT64_C( 4558933849640371195), UINT64_C( 2209675171840703592),
+    UINT64_C( 2817459005911659192), UINT64_C( 1049743632113484814), UINT64_C(  105348538985554873),
+    UINT64_C(  715762190479007514), UINT64_C( 2692792029050128603), UINT64_C(  542838775421683323),
+    UINT64_C( 1778390373064599443), UINT64_C( 1682006493488243486), UINT64_C( 2823630620398947847),
+    UINT64_C(  657887210896456041), UINT64_C(  671802878229862572), UINT64_C( 1221184241288868718),
+    UINT64_C( 2298923324594366902), UINT64_C( 1011772530083443300), UINT64_C( 2040797528857249625),
+    UINT64_C( 3816341043128309163), UINT64_C( 1574126562760261743), UINT64_C( 3417421637402625906),
+    UINT64_C( 3148198594494720042), UINT64_C( 2661737650974189287), UINT64_C( 3880219039300029372),
+    UINT64_C( 4006822653638304376), UINT64_C( 2877373997093876212), UINT64_C( 1717332928635879646),
+    UINT64_C( 1109838575199822283), UINT64_C( 1123172499878255013), UINT64_C( 4522067722447709678),
+    UINT64_C( 2288764575021570546), UINT64_C( 1277949632213676086), UINT64_C( 2058051849710163886),
+    UINT64_C( 2250327649423389685), UINT64_C( 4020738764078399999), UINT64_C( 3108724845266393378),
+    UINT64_C( 2332137042470714038), UINT64_C( 3485113181556427622), UINT64_C(  143161449524070449),
+    UINT64_C( 4308539520669658726), UINT64_C( 2505409290921977715), UINT64_C(  780401970365445992),
+    UINT64_C(  818542124129745588), UINT64_C(  718756747223141276), UINT64_C( 3165374274898401234),
+    UINT64_C( 2613904392478173061), UINT64_C(  946813996114930333), UINT64_C( 3026760723381916262),
+    UINT64_C( 3112166405306625215), UINT64_C(  558774673176777246), UINT64_C( 1746420658772035247),
+    UINT64_C( 4596823358711472530), UINT64_C( 2801672944538451729), UINT64_C( 3314009989949580467),
+    UINT64_C( 4466799899704578503), UINT64_C( 1102106595755091195), UINT64_C( 2580592769999696867),
+    UINT64_C( 2564406707169592972), UINT64_C( 1720921547416233469), UINT64_C(   68974432258717809),
+    UINT64_C( 1006919202032467831), UINT64_C( 1930429960569443682), UINT64_C( 2951366108222041717),
+    UINT64_C(  426210995390660895), UINT64_C( 4000782971546802743), UINT64_C(  513149472339934863),
+    UINT64_C(  999838611317906276), UINT64_C( 1705626132785111110), UINT64_C( 3196689363794785842),
+    UINT64_C( 4478501872605680367), UINT64_C( 2483209055683353731), UINT64_C( 4306457876279741209),
+    UINT64_C( 2566584313426101057), UINT64_C( 3518411162477390960), UINT64_C( 1257685646914335314),
+    UINT64_C( 2263296992921264100), UINT64_C(    4263801380435193), UINT64_C( 1063819136980432611),
+    UINT64_C( 2875864023994912853), UINT64_C( 2446048564697061562), UINT64_C( 3572889142043340051),
+    UINT64_C( 1559498119742537175), UINT64_C( 1844372608637753724), UINT64_C( 4124149856169322971),
+    UINT64_C( 1383219183417269928), UINT64_C(   33567019268632236), UINT64_C( 2574742081701557089),
+    UINT64_C( 1401444603376330210), UINT64_C( 3164174554458895811), UINT64_C(  455396992061226584),
+    UINT64_C( 4598023217910147697), UINT64_C( 2556192919365510003), UINT64_C(  701652253952196535),
+    UINT64_C( 2359679973619273686), UINT64_C(  781960053206189663), UINT64_C( 2868509619446354660),
+    UINT64_C(  313132066214284112), UINT64_C(  146087906120933724), UINT64_C( 1750367289580504447),
+    UINT64_C( 1291952890723979460), UINT64_C( 1246992147739402125), UINT64_C( 2328699312535062728),
+    UINT64_C( 1516871119263846194), UINT64_C( 1912956288139626882), UINT64_C( 3041425425426592909),
+    UINT64_C( 3279220890377437800), UINT64_C( 1405527757720725549), UINT64_C( 1793502408157739802),
+    UINT64_C( 2759522974005177472), UINT64_C( 3734629642573000898), UINT64_C( 1189801735500824735),
+    UINT64_C( 2632364499146702765), UINT64_C( 4072170742512419851), UINT64_C(  835327291975600165),
+    UINT64_C( 1824080674449513862), UINT64_C( 1075677898065769295), UINT64_C( 3878897643252717881),
+    UINT64_C(  670066138637868993), UINT64_C( 3478428272461317095), UINT64_C( 2105970090571587108),
+    UINT64_C(  576848991166305559), UINT64_C( 2702173610962131998), UINT64_C( 1334919333891736476),
+    UINT64_C( 2303703509895787128), UINT64_C( 1607388988021565940), UINT64_C( 4178926096590966012),
+    UINT64_C( 3258143015112507007), UINT64_C( 3926069655394799868), UINT64_C( 4298834444158419230),
+    UINT64_C( 2936970325867113194), UINT64_C(  558995487158155038), UINT64_C(  365384084559666707),
+    UINT64_C( 1187533200806601727), UINT64_C( 2852018725155769659), UINT64_C(   23996907750507000),
+    UINT64_C( 4039142637513106715), UINT64_C( 3071773207777778472), UINT64_C( 4490701366002600282),
+    UINT64_C(  568487360333636815), UINT64_C(  210114102012982135), UINT64_C( 4300399010679589850),
+    UINT64_C( 1351498103261723080), UINT64_C(  811330076212724624), UINT64_C( 1938644790487917099),
+    UINT64_C( 1965823843865291484), UINT64_C( 2110395020677595335), UINT64_C( 1610303902863815517),
+    UINT64_C( 3712264707545107387), UINT64_C(  764243271796182531), UINT64_C( 2189905158132998361),
+    UINT64_C( 2370413344419977750), UINT64_C( 3775953448352502750), UINT64_C( 2057914719835233033),
+    UINT64_C(  169870429218829113), UINT64_C( 3952556283863759371), UINT64_C( 1942448411120758939),
+    UINT64_C( 2362582044587374441), UINT64_C( 2784765571103602960), UINT64_C( 1271506936743908294),
+    UINT64_C( 2140202298834441363), UINT64_C(  509054159924305630), UINT64_C( 2760875939570551236),
+    UINT64_C( 4041015299725115129), UINT64_C(  223570815752496328), UINT64_C(  430520801564123834),
+    UINT64_C( 2654976126707572053), UINT64_C( 2779503113029983906), UINT64_C( 3616177571672082498),
+    UINT64_C(  446177979058914577), UINT64_C( 1457004719622182737), UINT64_C( 4501254890803506081),
+    UINT64_C( 1054673147486360888), UINT64_C( 1789303260786066209), UINT64_C( 2997151438495971364),
+    UINT64_C( 4310958122559172629), UINT64_C( 2698745053513854501), UINT64_C(  989478917134652332),
+    UINT64_C(  832706154801200943), UINT64_C( 2720686833966781296), UINT64_C(  495966267109715311),
+    UINT64_C( 2101437100401247372), UINT64_C( 1805981741029799825), UINT64_C( 3057723426550000738),
+    UINT64_C(  283477715420108518), UINT64_C(  608141537717226172), UINT64_C( 3162116761681234955),
+    UINT64_C( 3717367495934887505), UINT64_C(  295278113703788685), UINT64_C( 2160831789872645588),
+    UINT64_C( 3486666318862494714), UINT64_C( 1715135341866227593), UINT64_C( 2657439313259211579),
+    UINT64_C(  785561104748161654), UINT64_C( 4409149954872030110), UINT64_C( 4589252789701182151),
+    UINT64_C( 3399133138926683567), UINT64_C( 4212532896709519725), UINT64_C( 4288667971866854609),
+    UINT64_C(   63709175107266452), UINT64_C( 3956461230434860909), UINT64_C( 2946908102995460623),
+    UINT64_C( 3071836964655048922), UINT64_C( 1089844064784667426), UINT64_C( 3585108298384874378),
+    UINT64_C( 2088178759453227927), UINT64_C( 3077286507726038128), UINT64_C( 3539858049101749336),
+    UINT64_C(  862139168071466052), UINT64_C( 2876262185944436000), UINT64_C(  769423323320629493),
+    UINT64_C( 4309015619434539177), UINT64_C( 1215568530542934564), UINT64_C( 1851419217326550276),
+    UINT64_C( 1888872274725735569), UINT64_C( 2000387249606449686), UINT64_C( 1834502902598653649),
+    UINT64_C(  268912930544144924), UINT64_C( 2949236362554210652), UINT64_C( 3477288084080528425),
+    UINT64_C( 2792721084733644720), UINT64_C( 4291787127229789221), UINT64_C( 2868509578140607340),
+    UINT64_C( 2605901867815484864), UINT64_C( 2787753087608344995), UINT64_C(  218127513446979135),
+    UINT64_C( 2500631733376583892), UINT64_C( 1344614765373121715), UINT64_C( 3823431411655795650),
+    UINT64_C( 3012349429821296335), UINT64_C( 3614871060123032576), UINT64_C( 2747804271783934338),
+    UINT64_C( 4242336077206028805), UINT64_C( 1686712306041190023), UINT64_C( 1108813287865500875),
+    UINT64_C( 1465501796900627824), UINT64_C( 3491151411253013501), UINT64_C( 4539382149482627157),
+    UINT64_C( 1251423912831566905), UINT64_C( 2422724552301331296), UINT64_C( 2762023867868254611),
+    UINT64_C( 4578869611518889700), UINT64_C( 4205970419652734056), UINT64_C( 2163005381683870888),
+    UINT64_C( 1686007361855111219), UINT64_C(  561664344721334234), UINT64_C( 3221921810267625204),
+    UINT64_C( 1843657580423506028), UINT64_C( 1873108948219506496), UINT64_C(  958143169321820213),
+    UINT64_C( 4461739899157313059), UINT64_C( 4052863393571660269), UINT64_C( 2741599063431235245),
+    UINT64_C(  350858875206576353), UINT64_C( 2375478542317419551), UINT64_C( 2625982241519100233),
+    UINT64_C( 4253849979716762278), UINT64_C( 3540688873367921218), UINT64_C( 1162124780797873660),
+    UINT64_C( 1758711132109758919), UINT64_C( 2464971757469007364), UINT64_C( 1818604934163491102),
+    UINT64_C(  635039974547919563), UINT64_C( 3509927256308842209), UINT64_C( 2992783122800414159),
+    UINT64_C( 3943366909842968536), UINT64_C( 1932886299389080117), UINT64_C( 1554326581576097684),
+    UINT64_C( 2731250545727884857), UINT64_C(   94772552071014849), UINT64_C( 3999353157658564292),
+    UINT64_C( 2933663131410360104), UINT64_C( 3734026307479980345), UINT64_C( 4254505183577155121),
+    UINT64_C( 2169992454418071498), UINT64_C( 4373713524864902362), UINT64_C( 1452524267131538099),
+    UINT64_C(  155826375578729593), UINT64_C(  363655110359117501), UINT64_C( 3444712558985655651),
+    UINT64_C(  678212273564130230), UINT64_C( 3128304565970534429), UINT64_C( 3063700460100388148),
+    UINT64_C( 2266647600580065182), UINT64_C( 1374391891062151006), UINT64_C( 1587487114517525507),
+    UINT64_C( 3630614922895280981), UINT64_C( 2879259272880196121), UINT64_C( 1943868371678867533),
+    UINT64_C(  882485993289438970), UINT64_C( 3667411708019251349), UINT64_C( 1455683622128511541),
+    UINT64_C( 1744899869588789634), UINT64_C(  247505703114151509), UINT64_C( 2016517355040436327),
+    UINT64_C( 3972363882184310289), UINT64_C( 3411322196877337221), UINT64_C( 2660641638438903329),
+    UINT64_C( 2574052638124645210), UINT64_C(  688224823232163230), UINT64_C( 3572530846519683033),
+    UINT64_C( 2830664798429495220), UINT64_C( 3139172383331211188), UINT64_C( 2006042301467274152),
+    UINT64_C( 2141754458659573057), UINT64_C(  472661605912428604), UINT64_C( 1484401047678607081),
+    UINT64_C( 1563320862060882370), UINT64_C( 1717922753632024478), UINT64_C( 2787153966787032343),
+    UINT64_C( 2484439772201275906), UINT64_C(  304130044009354183), UINT64_C( 3112587465732910942),
+    UINT64_C( 1508313693156633751), UINT64_C( 1426768039951463637), UINT64_C(  973980778320841801),
+    UINT64_C( 4001363941757303195), UINT64_C( 2661307679293182568), UINT64_C( 1438476454770389687),
+    UINT64_C( 4325780611018942824), UINT64_C( 2034096665609387302), UINT64_C( 1864069222029985549),
+    UINT64_C(  376118599011774941), UINT64_C( 4258701374653866658), UINT64_C( 3004073722228073535),
+    UINT64_C( 1395287851760222885), UINT64_C( 2058361665152540449), UINT64_C( 3777500071259020017),
+    UINT64_C( 3011669264197995478), UINT64_C( 3201849646790825051), UINT64_C( 3993279121503566122),
+    UINT64_C( 4551726561374917297), UINT64_C(  907461256866770131), UINT64_C( 2056245631899134790),
+    UINT64_C( 4232703864853870251), UINT64_C( 4352528928485284748), UINT64_C( 3925072290577136989),
+    UINT64_C(  163074434595935513), UINT64_C( 4383754653692674310), UINT64_C(  856050673898871564),
+    UINT64_C( 3867180341609412977), UINT64_C( 2060138391575134866), UINT64_C( 2936286612582864738),
+    UINT64_C( 1072488555040157814), UINT64_C( 1432837754162793498), UINT64_C( 2740475448842863036),
+    UINT64_C(  773855723536620264), UINT64_C( 2650161341243967825), UINT64_C( 1076221302188205702),
+    UINT64_C( 3133748582505382937), UINT64_C( 1136637474260141634), UINT64_C( 3913495199285589405),
+    UINT64_C( 3540421536435634902), UINT64_C( 2220624273187193030), UINT64_C(  522362204210409319),
+    UINT64_C( 2673186245118310447), UINT64_C( 1458182146816732318), UINT64_C(  536649528194717491),
+    UINT64_C( 4405672498966573201), UINT64_C( 1609479988361743286), UINT64_C(  645239785875353853),
+    UINT64_C( 1599057025674416361), UINT64_C(  605338160472752124), UINT64_C( 2637511835383843953),
+    UINT64_C( 3798600670407388440), UINT64_C( 1609925502430020251), UINT64_C( 2459329704142861340),
+    UINT64_C( 3426784892302299874), UINT64_C( 2976402716016821560), UINT64_C( 3216505902101832144),
+    UINT64_C( 3380393472039067371), UINT64_C( 3254140054278787552), UINT64_C( 4352358374901408227),
+    UINT64_C( 2175128260101694725), UINT64_C(  198267229427630275), UINT64_C( 2540333676606490964),
+    UINT64_C( 1059905615696404507), UINT64_C( 3118944661028523025), UINT64_C(  431790573995967210),
+    UINT64_C( 1616385337717160403), UINT64_C( 1657866893982081633), UINT64_C( 2528971543905274231),
+    UINT64_C( 3129088138880838570), UINT64_C(                   0), UINT64_C( 6389794980909314552),
+    UINT64_C( 3047429678507845205), UINT64_C(10842885368307613476), UINT64_C( 7741903020769731621),
+    UINT64_C(13401885216926016661), UINT64_C(17511728213235757668), UINT64_C( 2351158912492758640),
+    UINT64_C( 4629002473775046183), UINT64_C( 8884524785671288102), UINT64_C(10259949820381535209),
+    UINT64_C( 7608887751095923315), UINT64_C(14676697007180690308), UINT64_C(14918918025040673339),
+    UINT64_C(11644996259059072847), UINT64_C( 3623232563747686574), UINT64_C( 2556217086465930670),
+    UINT64_C(10928151867741318085), UINT64_C(12817638039923718863), UINT64_C(13800866446065292065),
+    UINT64_C(17507507827583639480), UINT64_C( 3761675888426073602), UINT64_C(11043114058563346863),
+    UINT64_C(11809769321448950687), UINT64_C(14782867813192276210), UINT64_C( 2488413857031047351),
+    UINT64_C( 2840065831420830065), UINT64_C( 6376687090250037436), UINT64_C( 4746308599252906500),
+    UINT64_C(17922219283797788657), UINT64_C( 9146486252817883622), UINT64_C(10174069959054132969),
+    UINT64_C(10072575054279351582), UINT64_C(10966636189184293973), UINT64_C( 8477986509219018200),
+    UINT64_C( 8576311056089553381), UINT64_C(  674553921631754431), UINT64_C(15674820729988758831),
+    UINT64_C(12517261530655964455), UINT64_C(13423798482208682136), UINT64_C(17888783763160829334),
+    UINT64_C(11004932962127832900), UINT64_C( 5997402673501242327), UINT64_C( 4992009352715341068),
+    UINT64_C(14269139486882120945), UINT64_C( 4937768902624589955), UINT64_C(15053967799335727255),
+    UINT64_C( 4242455547773805283), UINT64_C(13056691932841204314), UINT64_C( 9958674537902485385),
+    UINT64_C(15364725421824121569), UINT64_C( 5476585914141769315), UINT64_C(13571664401908093354),
+    UINT64_C( 1438031055912756488), UINT64_C( 2223313312939649808), UINT64_C( 8698066976645706868),
+    UINT64_C( 7816990934550415852), UINT64_C( 2901650642912409121), UINT64_C( 8447690658178800776),
+    UINT64_C( 2968052632020458530), UINT64_C( 4960798899168637972), UINT64_C( 3123513322351159609),
+    UINT64_C( 7686711190306185003), UINT64_C(   83556942304842756), UINT64_C(17985574077943619039),
+    UINT64_C(17657970624426188099), UINT64_C(14636235241295332078), UINT64_C( 3948380481182684082),
+    UINT64_C(13245901350281928823), UINT64_C(14025730332113821184), UINT64_C( 1142756329542511018),
+    UINT64_C(17651715579875475188), UINT64_C(10148416980996031784), UINT64_C( 6663304871248354980),
+    UINT64_C( 2927061728751804894), UINT64_C( 7564546287726008543), UINT64_C(16903661042075694818),
+    UINT64_C(17420765589996383288), UINT64_C(10941590877337723575), UINT64_C(13865051143260747723),
+    UINT64_C(14421333568924831368), UINT64_C( 1077227322257662846), UINT64_C( 4483257934773921047),
+    UINT64_C( 8069905057528153739), UINT64_C(14970048539715003181), UINT64_C(10194505686615842373),
+    UINT64_C(18135093711688925393), UINT64_C( 2785029092184537364), UINT64_C( 8773728067210865869),
+    UINT64_C(11900882899511978789), UINT64_C(11529531604922623763), UINT64_C(14580207542242868544),
+    UINT64_C( 7240089791002895170), UINT64_C( 5584961233199406945), UINT64_C(17386809708519284030),
+    UINT64_C(11373302577968517803), UINT64_C(18393716860268627612), UINT64_C(15163734996133908791),
+    UINT64_C(13970971350850471620), UINT64_C(  961912087726926834), UINT64_C( 6646098588059882388),
+    UINT64_C(12006488488061374836), UINT64_C( 6920282754030912155), UINT64_C(16897109820406363522),
+    UINT64_C(10563920708505556242), UINT64_C( 7573921858584884152), UINT64_C( 7573519760028039506),
+    UINT64_C( 1125895567644451247), UINT64_C(15705143370304273599), UINT64_C(16315169117853152407),
+    UINT64_C( 5537995199983591519), UINT64_C(13914798947705936754), UINT64_C(10198015992023002346),
+    UINT64_C(16061719114812804757), UINT64_C( 9327952234180033476), UINT64_C(16068655174781381635),
+    UINT64_C(17592606737994843699), UINT64_C( 3093681311386685971), UINT64_C( 5407634799754856963),
+    UINT64_C( 5753741326309074113), UINT64_C(  878784601972636140), UINT64_C(17350133519936389927),
+    UINT64_C(12494597023148119429), UINT64_C(17141374865717568015), UINT64_C(13951237519208364868),
+    UINT64_C(14747439402388767897), UINT64_C( 2407205799512677458), UINT64_C( 2265789215313464191),
+    UINT64_C( 1039716469844495838), UINT64_C(10136350218365110649), UINT64_C( 6686842495619853931),
+    UINT64_C( 2907294805968276505), UINT64_C(11076281624236097625), UINT64_C( 2306237600723203349),
+    UINT64_C( 6101855951929913082), UINT64_C(18125485719892080834), UINT64_C( 3381485790391523437),
+    UINT64_C(14680840327684442728), UINT64_C(17845419079729368774), UINT64_C(15909553281681930314),
+    UINT64_C(18249470138605158188), UINT64_C(17285378418403962355), UINT64_C( 3524040542852918050),
+    UINT64_C( 7129813452174358595), UINT64_C(14239865381507695230), UINT64_C(10955295270444562922),
+    UINT64_C( 4074689581205956847), UINT64_C( 6558015698485658766), UINT64_C(16657028460848171997),
+    UINT64_C( 1286929903899792666), UINT64_C(15966784734568204765), UINT64_C( 7824270775419642331),
+    UINT64_C(  278923075289447638), UINT64_C( 1364477218702832529), UINT64_C( 3891697026348309466),
+    UINT64_C(15663653418748171429), UINT64_C( 1558218527397615355), UINT64_C( 6653308439627100091),
+    UINT64_C( 2034672919955913358), UINT64_C(15807062113259643637), UINT64_C( 1899672600403880563),
+    UINT64_C( 3790615019519385564), UINT64_C( 9560294163878869195), UINT64_C(14231159680052420591),
+    UINT64_C( 3718233446527876874), UINT64_C(10209214691454865441), UINT64_C( 3304135847208704047),
+    UINT64_C(10423553812079159100), UINT64_C( 1009443066374922318), UINT64_C(14052401935071276086),
+    UINT64_C( 6831714146248160555), UINT64_C(11127449704834096546), UINT64_C( 5758479470575439236),
+    UINT64_C(  732566982743647182), UINT64_C( 5446873101379656178), UINT64_C(11839270788653130360),
+    UINT64_C(11050101055794308357), UINT64_C( 5366069009874062879), UINT64_C( 2002134990701802723),
+    UINT64_C( 3383306831005980646), UINT64_C( 4964282137998265313), UINT64_C(16975903079055268135),
+    UINT64_C(  270056232827995987), UINT64_C(11495948545794501423), UINT64_C( 7955286013093199779),
+    UINT64_C( 4056424832275188522), UINT64_C(14837981313111265704), UINT64_C(14475978693910290715),
+    UINT64_C( 2014432317787483692), UINT64_C( 7101633344151534021), UINT64_C(14476201976842271108),
+    UINT64_C( 8478714126436493800), UINT64_C(13813277271426198918), UINT64_C(17510577332776517823),
+    UINT64_C( 9198219439208489655), UINT64_C(14639033977223486504), UINT64_C( 3561184352679281267),
+    UINT64_C(12102608726363868270), UINT64_C(11915755389573015561), UINT64_C( 7497623306829789752),
+    UINT64_C( 3582080959976423101), UINT64_C(17627158639497170344), UINT64_C( 1903827625555410111),
+    UINT64_C( 7695625441713880303), UINT64_C( 8059539975980288936), UINT64_C( 9067394042329986124),
+    UINT64_C( 8291631325589996226), UINT64_C(12526611629007139005), UINT64_C( 6553427822111312839),
+    UINT64_C(14665204329918856608), UINT64_C(12328473712760166841), UINT64_C( 7481774245989516754),
+    UINT64_C( 9213375237098742353), UINT64_C(  915702679663092652), UINT64_C(15378587840911276424),
+    UINT64_C( 8075225075991395041), UINT64_C(18098867141342057868), UINT64_C(10776712425208693057),
+    UINT64_C( 3665793502487115550), UINT64_C(17927500405131241415), UINT64_C( 9548628996769139362),
+    UINT64_C(15257552177047641205), UINT64_C(16891733089525687680), UINT64_C(11902978697939475327),
+    UINT64_C(  217604979600002846), UINT64_C( 1615649827745937260), UINT64_C(14955145216164620896),
+    UINT64_C(12236655377320257229), UINT64_C( 8770619634963257798), UINT64_C(15179628619501137484),
+    UINT64_C( 9643612087147104938), UINT64_C(  210285304309890007), UINT64_C( 2355673058580863926),
+    UINT64_C( 9168244342121592084), UINT64_C(17574135416880623349), UINT64_C( 9882254119331121808),
+    UINT64_C(17349399141560593947), UINT64_C( 4297415309647977967), UINT64_C(15273765924197866240),
+    UINT64_C(13477582398378317982), UINT64_C(17946082648595002870), UINT64_C( 7109421145676748583),
+    UINT64_C(14607950213243232024), UINT64_C( 2422586465983090473), UINT64_C( 9589890338788845172),
+    UINT64_C(11970666598174840493), UINT64_C(12534073847653326777), UINT64_C( 1054599972088879367),
+    UINT64_C(17392193100080171480), UINT64_C( 4296283716433729246), UINT64_C(12113333719230673234),
+    UINT64_C( 6880940400652645103), UINT64_C(14743879882598105032), UINT64_C( 1382997646333486779),
+    UINT64_C( 7959574599309636268), UINT64_C(  855030032260468944), UINT64_C( 4547880687740263771),
+    UINT64_C(  541553447589458101), UINT64_C( 3319946136906286593), UINT64_C(10073687856281732059),
+    UINT64_C( 2493841693406069541), UINT64_C(14317238999849935776), UINT64_C( 5785862900360322102),
+    UINT64_C( 5696333918988051541), UINT64_C(12610037564746975297), UINT64_C( 3563980422135243417),
+    UINT64_C(16504779532578367405), UINT64_C( 7476882340635049218), UINT64_C( 7507482102304152648),
+    UINT64_C( 7739304840685703036), UINT64_C(17440389883048912140), UINT64_C(14775566515510681151),
+    UINT64_C( 9896970115115638964), UINT64_C( 3149577115618324588), UINT64_C(14937328464596768765),
+    UINT64_C(12129794759514250367), UINT64_C(13110311509854598000), UINT64_C( 5914539244212731695),
+    UINT64_C(15722838442372978834), UINT64_C(14520248207122253095), UINT64_C(10078971508280960161),
+    UINT64_C(14692997953755792191), UINT64_C( 5027054841374937523), UINT64_C( 7499871809575885047),
+    UINT64_C( 6132215301614150198), UINT64_C(12715736856407906985), UINT64_C( 6103484843156070770),
+    UINT64_C( 7541446626421407554), UINT64_C(13340304791131513844), UINT64_C( 1682867547537851612),
+    UINT64_C( 8597472389225292472), UINT64_C(10306031299823563490), UINT64_C(15622165194510504054),
+    UINT64_C(11067180191450060984), UINT64_C(10948292932410780919), UINT64_C( 2622197606181717120),
+    UINT64_C( 6281223551758061430), UINT64_C( 2112735081211716368), UINT64_C(10152340650271953491),
+    UINT64_C( 5866654710691962241), UINT64_C(12999698226157260636), UINT64_C( 9185229491285148127),
+    UINT64_C( 4321205898316082936), UINT64_C(15338587515169939093), UINT64_C(13236553707129206713),
+    UINT64_C(13469380637578650366), UINT64_C( 6788705797556101309), UINT64_C(11322036806756873817),
+    UINT64_C(17122711788576751156), UINT64_C(11512913030513882957), UINT64_C( 2306199521402143425),
+    UINT64_C( 6381930374430612454), UINT64_C(11028653500580297680), UINT64_C(15050838222962900575),
+    UINT64_C(16528390205925878597), UINT64_C(12294368113941525151), UINT64_C(11655767377819931211),
+    UINT64_C( 4967775568495622862), UINT64_C(15941553711696781578), UINT64_C(  531727775681859461),
+    UINT64_C( 3854288928910503379), UINT64_C( 4344750744838805719), UINT64_C(17338366453142857217),
+    UINT64_C(17708970715257476720), UINT64_C(11693574076157489056), UINT64_C( 1063399587153390230),
+    UINT64_C(13521910474613537427), UINT64_C(14193231566300285038), UINT64_C(  353252005094041681),
+    UINT64_C(  917926960122106739), UINT64_C( 4568138570880106526), UINT64_C( 3772850819418252653),
+    UINT64_C(14325880213489720510), UINT64_C(17823594418657926048), UINT64_C( 1792808505000703017),
+    UINT64_C( 4736265982095914195), UINT64_C( 5918076020388233800), UINT64_C(16403517851485019603),
+    UINT64_C(16513518140856179612), UINT64_C(16272084940087294461), UINT64_C(16486425158944833872),
+    UINT64_C(17899659144816717459), UINT64_C( 4416274452433089264), UINT64_C( 8979275251680223605),
+    UINT64_C( 5061857039942916633), UINT64_C( 2610132865780236637), UINT64_C(17290343289038156643),
+    UINT64_C(10646359689980186944), UINT64_C( 3948402025404184567), UINT64_C(14529844730871773958),
+    UINT64_C(11743162489374232966), UINT64_C( 2582330564346310974), UINT64_C(17402878431838888132),
+    UINT64_C(17466674105715627380), UINT64_C( 1381038243418673058), UINT64_C(13485968766704846239),
+    UINT64_C( 2298284717449220398), UINT64_C(10493259747100266497), UINT64_C(16185072259335106308),
+    UINT64_C( 3978823116030130811), UINT64_C(17380928211395458097), UINT64_C(14598126404184041164),
+    UINT64_C( 4919137883970917332), UINT64_C( 5850690637205668979), UINT64_C(  889453192485213744),
+    UINT64_C( 4495120019807181205), UINT64_C( 2064530200551589616), UINT64_C( 4501511362768488368),
+    UINT64_C( 7733827611184605777), UINT64_C(12531520455080413269), UINT64_C(16429293590378834901),
+    UINT64_C( 8629304453005980844), UINT64_C(12982852620806012262), UINT64_C(12477663841456122970),
+    UINT64_C(10390575226134773847), UINT64_C(12661459239641071752), UINT64_C(13009165287161276214),
+    UINT64_C(10991376466517020938), UINT64_C( 2831928641786579649), UINT64_C(18369228171912251969),
+    UINT64_C(17780867633092703443), UINT64_C(15386510400301185523), UINT64_C( 9425807156755336626),
+    UINT64_C( 1804630786900400387), UINT64_C( 1928956454454569442), UINT64_C( 3237088008108852516),
+    UINT64_C(13544092948821522167), UINT64_C(10725463741830049887), UINT64_C(17535059776246791954),
+    UINT64_C(12008537846979604026), UINT64_C(  869842286619881680), UINT64_C( 2570304378268969255),
+    UINT64_C(  370677620076325786), UINT64_C( 8958234943343708946), UINT64_C( 4373330977202757842),
+    UINT64_C( 1486318283782272860), UINT64_C(18087136324671453827), UINT64_C(  130669980232277858),
+    UINT64_C(12998537258594804286), UINT64_C( 6045239971260455049), UINT64_C(15661483089381755074),
+    UINT64_C(16003301951849049756), UINT64_C(  513889294827836650), UINT64_C( 4297355318857884747),
+    UINT64_C(12953580755589816879), UINT64_C(14962683079172319713), UINT64_C(17614024791834726992),
+    UINT64_C(13882808618241474806), UINT64_C( 5299471835931613890), UINT64_C( 5327088812788250401),
+    UINT64_C(12074674486747286001), UINT64_C( 9638658681148450558), UINT64_C( 4661811595402454459),
+    UINT64_C( 6583805822730795444), UINT64_C( 8467205336961208224), UINT64_C( 7699526599916018886),
+    UINT64_C( 4284265699450941463), UINT64_C( 1320111517166084532), UINT64_C( 2679438720549255756),
+    UINT64_C(13498120523368437627), UINT64_C( 9254394508150210297), UINT64_C(11740580097405003773),
+    UINT64_C(11247410752685214364), UINT64_C(16185127583204426908), UINT64_C(13729473031987636845),
+    UINT64_C( 5999024268228954223), UINT64_C(16690314091022774344), UINT64_C( 2248687560823562468),
+    UINT64_C( 8966546045673182267), UINT64_C( 8306498383506507719), UINT64_C( 2154066976786047526),
+    UINT64_C( 9771630181710250272), UINT64_C( 4520283664677313600), UINT64_C(14533691991390120405),
+    UINT64_C(  748997724185713494), UINT64_C( 3630145171356612700), UINT64_C(13578475625273430811),
+    UINT64_C(11575103416115708965), UINT64_C(12411805745792835112), UINT64_C( 3344219441214789307),
+    UINT64_C( 1026884625342328348), UINT64_C( 4600263213570413855), UINT64_C(13125354981585282870),
+    UINT64_C(   24461815526594499), UINT64_C(17116445333820607581), UINT64_C( 1122186895142029005),
+    UINT64_C(10443311213432244277), UINT64_C(12069881424144017810), UINT64_C(13207444009819676043),
+    UINT64_C( 8917373897944967439), UINT64_C(10363835657557097352), UINT64_C( 4077341919811767384),
+    UINT64_C(14107788114641463545), UINT64_C(11988553027204147669), UINT64_C(14553632179182416123),
+    UINT64_C(11109857051654936561), UINT64_C( 3993369140882119538), UINT64_C( 2253726962236501752),
+    UINT64_C(14656988342104841843), UINT64_C( 7168386879513481623), UINT64_C( 6056353081045770571),
+    UINT64_C( 1263241722204132674), UINT64_C(11876769968471070571), UINT64_C(   78410135279756251),
+    UINT64_C(  859762402096855387), UINT64_C( 4863817793185387190), UINT64_C( 7757900870424195579),
+    UINT64_C(16895146961172371408), UINT64_C( 1829335334312640535), UINT64_C( 6443200458896623809),
+    UINT64_C(  724880349834858396), UINT64_C(16559144773553075151), UINT64_C(18257782150669978260),
+    UINT64_C( 5236194129340545185), UINT64_C(13916183843002689213), UINT64_C( 9597304288225842216),
+    UINT64_C(17708634885206436914), UINT64_C(12102788161924272379), UINT64_C( 7408739272967991717),
+    UINT64_C( 3976647518258977272), UINT64_C(13779382423541747293), UINT64_C(13175059651984523749),
+    UINT64_C(12577755668822782847), UINT64_C(16017394398766337725), UINT64_C( 9258943992751551515),
+    UINT64_C(14079087943041030609), UINT64_C( 9141096650429560600), UINT64_C(15154515988653935054),
+    UINT64_C(15694638432556649580), UINT64_C( 1491409352092303189), UINT64_C( 5987707158855717464),
+    UINT64_C(11934009742965345822), UINT64_C(16913524937975096222), UINT64_C(17480705079960335385),
+    UINT64_C( 3868671522917405233), UINT64_C(14507341174632683448), UINT64_C(10016136769081594326),
+    UINT64_C(12583856111795327109), UINT64_C( 6212158159258914848), UINT64_C(12460664758243516339),
+    UINT64_C( 4496772196221418729), UINT64_C(16118389901210919130), UINT64_C(13584002175018218490),
+    UINT64_C(14839304683252264626), UINT64_C( 4702687021406704035), UINT64_C(18321271357793852583),
+    UINT64_C( 8970475857937776110), UINT64_C( 9155831467447095028), UINT64_C(13903995503065179753),
+    UINT64_C( 4328784817532517809), UINT64_C(12778825729517868489), UINT64_C( 8843897117230103692),
+    UINT64_C(13554257670783551037), UINT64_C(12241825335880391670), UINT64_C( 7459520564226563706),
+    UINT64_C(10111529863462607896), UINT64_C(16433369976412786273), UINT64_C(16401576052763007417),
+    UINT64_C(16540085623034954286), UINT64_C(15206808220733826101), UINT64_C(  672848503833460518),
+    UINT64_C(16803476238124374865), UINT64_C(12996934945264864498), UINT64_C(   85355377280133996),
+    UINT64_C(18029781054459417395), UINT64_C(16416621152713438563), UINT64_C( 9733285965791576496),
+    UINT64_C( 8618018390916417896), UINT64_C(11873734033318438476), UINT64_C(11293533659173631538),
+    UINT64_C( 7833581193968055329), UINT64_C( 3063357801096097519), UINT64_C( 5972425649319574125),
+    UINT64_C(12237496557673552793), UINT64_C(17402330971756911906), UINT64_C(12719543456182720607),
+    UINT64_C(11607474028830000671), UINT64_C( 6112887969270132668), UINT64_C(13715508454717116601),
+    UINT64_C( 9956658998778125039), UINT64_C( 2056695708063941050), UINT64_C(12372816803839260790),
+    UINT64_C(17402968309403389833), UINT64_C( 7864852164519968045), UINT64_C( 6333878806882683727),
+    UINT64_C(14961093215861311137), UINT64_C( 7663244977101858865), UINT64_C( 7710365420989902711),
+    UINT64_C( 9592893666416490715), UINT64_C(  435494071194545807), UINT64_C(15156759591311125981),
+    UINT64_C(10989167209467388295), UINT64_C(10151186984039427638), UINT64_C(16514841308514372967),
+    UINT64_C(11738844319450614065), UINT64_C( 6748814774243083466), UINT64_C( 7410572397809911806),
+    UINT64_C( 1694032344139146874), UINT64_C( 1257217577105430413), UINT64_C(  973518347906190379),
+    UINT64_C(14285753754501405974), UINT64_C( 4315634708057759568), UINT64_C(16109430844135770690),
+    UINT64_C(15785750465899544249), UINT64_C(18234528760909959455), UINT64_C(11610042555730262784),
+    UINT64_C( 3189968590923679926), UINT64_C(16256533568361669437), UINT64_C( 2752645131711413306),
+    UINT64_C( 1788098870203610026), UINT64_C( 1889521461530464449), UINT64_C(11883449239511168843),
+    UINT64_C( 9363405318233232586), UINT64_C(15436063082184030409), UINT64_C(12182153246060668138),
+    UINT64_C(10356312683537951436), UINT64_C( 9416038082893156639), UINT64_C( 9000181329360884743),
+    UINT64_C(  300809051667938773), UINT64_C(11250064704155485577), UINT64_C(13481482189455791693),
+    UINT64_C(14264010252032283412), UINT64_C(  254416687061439166), UINT64_C( 3242688518861120275),
+    UINT64_C( 3078807729026955127), UINT64_C( 4001855156405467528), UINT64_C(16698642516105478576),
+    UINT64_C(11109824235417418164), UINT64_C(16874643695714114168), UINT64_C( 2681278023525660313),
+    UINT64_C(16100439932994944206), UINT64_C(14194820406529501726), UINT64_C(17245444051907559399),
+    UINT64_C(11482790927095615842), UINT64_C(14344573676170043689), UINT64_C(10786349082075570260),
+    UINT64_C(18038565550690378142), UINT64_C(  172533903620741118), UINT64_C(17497062053149475581),
+    UINT64_C(15759348354816449072), UINT64_C( 9083480732710171026), UINT64_C(15897884610201405173),
+    UINT64_C(15590697557548876860), UINT64_C( 4992990696979739053), UINT64_C(11089440343912081885),
+    UINT64_C(  880807957311642350), UINT64_C( 9010055959760938664), UINT64_C( 3719684256269694981),
+    UINT64_C(12543467571032398363), UINT64_C(17762903639440307511), UINT64_C(14794715304631363592),
+    UINT64_C(13805449715194981572), UINT64_C(14909495559465437149), UINT64_C( 8568020957297357812),
+    UINT64_C( 9881331870641118555), UINT64_C(11011418433854955872), UINT64_C( 9411337913436806224),
+    UINT64_C(18051681409105429418), UINT64_C( 9726876854127848885), UINT64_C( 4804515881247198084),
+    UINT64_C( 3019809032201759195), UINT64_C(  170927688832692430), UINT64_C( 8787138211229204979),
+    UINT64_C( 5358193899282252749), UINT64_C(10626925666445331970), UINT64_C(14093540035221228303),
+    UINT64_C(12452217056659572290), UINT64_C(15360416150410119596), UINT64_C( 9136136959168119447),
+    UINT64_C( 7080058815263214816), UINT64_C(10261990048321429687), UINT64_C( 3349166575540350567),
+    UINT64_C(18325789099199263793), UINT64_C( 1737709173000903032), UINT64_C(13649171304409991252),
+    UINT64_C(12727956937651629749), UINT64_C( 2216033280431998332), UINT64_C(10938132618990044182),
+    UINT64_C( 1826168187389211532), UINT64_C(14761836697170312800), UINT64_C(11184532636528204145),
+    UINT64_C(15230184033699097163), UINT64_C(11522679815789501121), UINT64_C(18235735398561573857),
+    UINT64_C( 8838700687362857542), UINT64_C(11269836023646691818), UINT64_C( 4198974528453959767),
+    UINT64_C(  421394155942221550), UINT64_C( 2863048761916044041), UINT64_C(10771168116200567026),
+    UINT64_C( 2171355101686743898), UINT64_C( 7113561492258432520), UINT64_C( 6728025973953006808),
+    UINT64_C(11294522481595846559), UINT64_C( 2631548843585837018), UINT64_C( 2687211512919463414),
+    UINT64_C( 4884736965155498732), UINT64_C( 9195693298377512526), UINT64_C( 4047090120333792969),
+    UINT64_C( 8163190115429038375), UINT64_C(15265364172513311219), UINT64_C( 6296506251041077728),
+    UINT64_C(13669686549610570397), UINT64_C(12592794377978941680), UINT64_C(10646950603896809155),
+    UINT64_C(15520876157200193303), UINT64_C(16027290614553295793), UINT64_C(11509495988375561069),
+    UINT64_C( 6869331714543552139), UINT64_C( 4439354300799310817), UINT64_C( 4492689999513041997),
+    UINT64_C(18088270889790927068), UINT64_C( 9155058300086326904), UINT64_C( 5111798528854729313),
+    UINT64_C( 8232207398840695756), UINT64_C( 9001310597693602709), UINT64_C(16082955056313678557),
+    UINT64_C(12434899381065634253), UINT64_C( 9328548169882901719), UINT64_C(13940452726225778583),
+    UINT64_C(  572645798096284593), UINT64_C(17234158082678719088), UINT64_C(10021637163687959813),
+    UINT64_C( 3121607881461799216), UINT64_C( 3274168496518998345), UINT64_C( 2875026988892579147),
+    UINT64_C(12661497099593666784), UINT64_C(10455617569912743317), UINT64_C( 3787255984459739831),
+    UINT64_C(12107042893527724188), UINT64_C(12448665621226561668), UINT64_C( 2235098692707119901),
+    UINT64_C( 6985682635088175111), UINT64_C(18387293434845979937), UINT64_C(11206691778153861658),
+    UINT64_C(13256039959798386620), UINT64_C(17867199598818401289), UINT64_C( 4408426383020386314),
+    UINT64_C(10322371079998837890), UINT64_C(10257626828678421994), UINT64_C( 6883686189664967501),
+    UINT64_C(  275897729034872583), UINT64_C( 4027676808129890998), UINT64_C( 7721719842277812446),
+    UINT64_C(11805464432888224534), UINT64_C( 1704843981562651907), UINT64_C(16003131886187289143),
+    UINT64_C( 2052597889359749478), UINT64_C( 3999354445271644639), UINT64_C( 6822504531140477766),
+    UINT64_C(12786757455179205828), UINT64_C(17914007490422808973), UINT64_C( 9932836222733463443),
+    UINT64_C(17225831505119048980), UINT64_C(10266337253704454376), UINT64_C(14073644649909632586),
+    UINT64_C( 5030742587657365829), UINT64_C( 9053187971685100622), UINT64_C(   17055205521740855),
+    UINT64_C( 4255276547921751230), UINT64_C(11503456095979707603), UINT64_C( 9784194258788294041),
+    UINT64_C(14291556568173430014), UINT64_C( 6237992478970179171), UINT64_C( 7377490434551050933),
+    UINT64_C(16496599424677372466), UINT64_C( 5532876733669106738), UINT64_C(  134268077074529599),
+    UINT64_C(10298968326806278664), UINT64_C( 5605778413505348222), UINT64_C(12656698217835645068),
+    UINT64_C( 1821587968244915234), UINT64_C(18392092871640680629), UINT64_C(10224771677462089957),
+    UINT64_C( 2806609015808799849), UINT64_C( 9438719894477140849), UINT64_C( 3127840212824773930),
+    UINT64_C(11474038477785474687), UINT64_C( 1252528264857142566), UINT64_C(  584351624483737750),
+    UINT64_C( 7001469158322051988), UINT64_C( 5167811562895943083), UINT64_C( 4987968590957632865),
+    UINT64_C( 9314797250140296412), UINT64_C( 6067484477055414414), UINT64_C( 7651825152558544905),
+    UINT64_C(12165701701706431062), UINT64_C(13116883561509815272), UINT64_C( 5622111030882929658),
+    UINT64_C( 7174009632630994251), UINT64_C(11038091896020763806), UINT64_C(14938518570292076563),
+    UINT64_C( 4759206942003322187), UINT64_C(10529457996586862493), UINT64_C(16288682970049758970),
+    UINT64_C( 3341309167902416981), UINT64_C( 7296322697798091088), UINT64_C( 4302711592263098197),
+    UINT64_C(15515590573010947314), UINT64_C( 2680264554551489064), UINT64_C(13913713089845336345),
+    UINT64_C( 8423880362286389580), UINT64_C( 2307395964665233507), UINT64_C(10808694443848580789),
+    UINT64_C( 5339677335566971987), UINT64_C( 9214814039583193524), UINT64_C( 6429555952086295166),
+    UINT64_C(16715704386363945700), UINT64_C(13032572060450091689), UINT64_C(15704278621579276183),
+    UINT64_C(17195337776633760915), UINT64_C(11747881303468510161), UINT64_C( 2235981948632631074),
+    UINT64_C( 1461536338238673967), UINT64_C( 4750132803226430111), UINT64_C(11408074900623134361),
+    UINT64_C(   95987631002028468), UINT64_C(16156570550052505781), UINT64_C(12287092831111173907),
+    UINT64_C(17962805464010488872), UINT64_C( 2273949441334558367), UINT64_C(  840456408051932645),
+    UINT64_C(17201596042718443425), UINT64_C( 5405992413046918726), UINT64_C( 3245320304850914348),
+    UINT64_C( 7754579161951706275), UINT64_C( 7863295375461204346), UINT64_C( 8441580082710422575),
+    UINT64_C( 6441215611455293531), UINT64_C(14849058830180502082), UINT64_C( 3056973087184745056),
+    UINT64_C( 8759620632532036232), UINT64_C( 9481653377679957315), UINT64_C(15103813793410084778),
+    UINT64_C( 8231658879340972341), UINT64_C(  679481716875319771), UINT64_C(15810225135455114713),
+    UINT64_C( 7769793644483073709), UINT64_C( 9450328178349543926), UINT64_C(11139062284414466251),
+    UINT64_C( 5086027746975658020), UINT64_C( 8560809195337807269), UINT64_C( 2036216639697232466),
+    UINT64_C(11043503758282258888), UINT64_C(16164061198900539473), UINT64_C(  894283263009989680),
+    UINT64_C( 1722083206256503747), UINT64_C(10619904506830340087), UINT64_C(11118012452119989932),
+    UINT64_C(14464710286688400648), UINT64_C( 1784711916235667025), UINT64_C( 5828018878488759416),
+    UINT64_C(18005019563214112274), UINT64_C( 4218692589945464159), UINT64_C( 7157213043144299797),
+    UINT64_C(11988605753983944017), UINT64_C(17243832490236774748), UINT64_C(10794980214055470734),
+    UINT64_C( 3957915668538628661), UINT64_C( 3330824619204820042), UINT64_C(10882747335867178343),
+    UINT64_C( 1983865068438870934), UINT64_C( 8405748401605030548), UINT64_C( 7223926964119234587),
+    UINT64_C(12230893706200062697), UINT64_C( 1133910861680439610), UINT64_C( 2432566150868916570),
+    UINT64_C(12648467046725001604), UINT64_C(14869469983739622653), UINT64_C( 1181112454815160509),
+    UINT64_C( 8643327159490624572), UINT64_C(13946665275450046982), UINT64_C( 6860541367464943884),
+    UINT64_C(10629757253036898239), UINT64_C( 3142244418992661965), UINT64_C(17636599819488206590),
+    UINT64_C(18357011158804818273), UINT64_C(13596532555706800683), UINT64_C(16850131586838161208),
+    UINT64_C(17154671887467502232), UINT64_C(  254836700429067052), UINT64_C(15825844921739520941),
+    UINT64_C(11787632411981900071), UINT64_C(12287347858620255708), UINT64_C( 4359376259138690998),
+    UINT64_C(14340433193539567561), UINT64_C( 8352715037812952509), UINT64_C(12309146030904212639),
+    UINT64_C(14159432196407066509), UINT64_C( 3448556672285881053), UINT64_C(11505048743777800199),
+    UINT64_C( 3077693293282533005), UINT64_C(17236062477738240902), UINT64_C( 4862274122171762007),
+    UINT64_C( 7405676869306237278), UINT64_C( 7555489098902979182), UINT64_C( 8001548998425837829),
+    UINT64_C( 7338011610394650440), UINT64_C( 1075651722176584950), UINT64_C(11796945450216900233),
+    UINT64_C(13909152336322181642), UINT64_C(11170884338934633447), UINT64_C(17167148508919240741),
+    UINT64_C(11474038312562485407), UINT64_C(10423607471261990372), UINT64_C(11151012350433434450),
+    UINT64_C(  872510053787920802), UINT64_C(10002526933506384427), UINT64_C( 5378459061492513132),
+    UINT64_C(15293725646623257306), UINT64_C(12049397719285244198), UINT64_C(14459484240492200935),
+    UINT64_C(10991217087135791041), UINT64_C(16969344308824198111), UINT64_C( 6746849224164793048),
+    UINT64_C( 4435253151462025165), UINT64_C( 5862007187602539930), UINT64_C(13964605645012122217),
+    UINT64_C(18157528597930597323), UINT64_C( 5005695651326292071), UINT64_C( 9690898209205372521),
+    UINT64_C(11048095471473072411), UINT64_C(18315478446075648266), UINT64_C(16823881678611018404),
+    UINT64_C( 8652021526735525815), UINT64_C( 6744029447420477818), UINT64_C( 2246657378885347910),
+    UINT64_C(12887687241070563769), UINT64_C( 7374630321694060135), UINT64_C( 7492435792878062582),
+    UINT64_C( 3832572677287299573), UINT64_C(17846959596629339414), UINT64_C(16211453574286720265),
+    UINT64_C(10966396253724994548), UINT64_C( 1403435500826312267), UINT64_C( 9501914169269724618),
+    UINT64_C(10503928966076452241), UINT64_C(17015399918867132228), UINT64_C(14162755493471754053),
+    UINT64_C( 4648499123191517346), UINT64_C( 7034844528439070039), UINT64_C( 9859887029876077619),
+    UINT64_C( 7274419736653999941), UINT64_C( 2540159898191690660), UINT64_C(14039709025235437416),
+    UINT64_C(11971132491201715112), UINT64_C(15773467639371951193), UINT64_C( 7731545197556358234),
+    UINT64_C( 6217306326304421106), UINT64_C(10925002182911592794), UINT64_C(  379090208284061247),
+    UINT64_C(15997412630634335311), UINT64_C(11734652525641497737), UINT64_C(14936105229919994339),
+    UINT64_C(17018020734308703613), UINT64_C( 8679969817672328391), UINT64_C(17494854099459694906),
+    UINT64_C( 5810097068526180776), UINT64_C(  623305502314921416), UINT64_C( 1454620441436477109),
+    UINT64_C(13778850235942689910), UINT64_C( 2712849094256534171), UINT64_C(12513218263882198840),
+    UINT64_C(12254801840401612453), UINT64_C( 9066590402320305016), UINT64_C( 5497567564248630878),
+    UINT64_C( 6349948458070133046), UINT64_C(14522459691581194862), UINT64_C(11517037091520840742),
+    UINT64_C( 7775473486715508113), UINT64_C( 3529943973157773122), UINT64_C(14669646832077077053),
+    UINT64_C( 5822734488514074606), UINT64_C( 6979599478355192629), UINT64_C(  990022812456610872),
+    UINT64_C( 8066069420161784708), UINT64_C(15889455528737318772), UINT64_C(13645288787509415538),
+    UINT64_C(10642566553755665302), UINT64_C(10296210552498631134), UINT64_C( 2752899292928666367),
+    UINT64_C(14290123386078801935), UINT64_C(11322659193718036188), UINT64_C(12556689533324906088),
+    UINT64_C( 8024169205869135804), UINT64_C( 8567017834638334075), UINT64_C( 1890646423649723651),
+    UINT64_C( 5937604190714457327), UINT64_C( 6253283448243560025), UINT64_C( 6871691014528131478),
+    UINT64_C(11148615867148183830), UINT64_C( 9937759088805152167), UINT64_C( 1216520176037422674),
+    UINT64_C(12450349862931704585), UINT64_C( 6033254772626564475), UINT64_C( 5707072159805882425),
+    UINT64_C( 3895923113283386234), UINT64_C(16005455767029290962), UINT64_C(10645230717172782271),
+    UINT64_C( 5753905819081586854), UINT64_C(17303122444075855817), UINT64_C( 8136386662437588952),
+    UINT64_C( 7456276888119978618), UINT64_C( 1504474396047107113), UINT64_C(17034805498615549843),
+    UINT64_C(12016294888912352836), UINT64_C( 5581151407040918802), UINT64_C( 8233446660610202014),
+    UINT64_C(15110000285036153876), UINT64_C(12046677056792040757), UINT64_C(12807398587163362765),
+    UINT64_C(15973116486014342512), UINT64_C(18206906245499758124), UINT64_C( 3629845027467098254),
+    UINT64_C( 8224982527596579337), UINT64_C(16930815459415563707), UINT64_C(17410115713941224036),
+    UINT64_C(15700289162308624648), UINT64_C(  652297738383745238), UINT64_C(17535018614770782894),
+    UINT64_C( 3424202695595502982), UINT64_C(15468721366437727469), UINT64_C( 8240553566300579717),
+    UINT64_C(11745146450331516324), UINT64_C( 4289954220160652211), UINT64_C( 5731351016651201988),
+    UINT64_C(10961901795371505690), UINT64_C( 3095422894146496176), UINT64_C(10600645364975923081),
+    UINT64_C( 4304885208752843836), UINT64_C(12534994330021592978), UINT64_C( 4546549897040588744),
+    UINT64_C(15653980797142434086), UINT64_C(14161686145742608784), UINT64_C( 8882497092748815508),
+    UINT64_C( 2089448816841647482), UINT64_C(10692744980473294019), UINT64_C( 5832728587266957763),
+    UINT64_C( 2146598112778880449), UINT64_C(17622689995866378886), UINT64_C( 6437919953447004591),
+    UINT64_C( 2580959143501428019), UINT64_C( 6396228102697696688), UINT64_C( 2421352641891020323),
+    UINT64_C(10550047341535427346), UINT64_C(15194402681629627981), UINT64_C( 6439702009720112460),
+    UINT64_C( 9837318816571493412), UINT64_C(13707139569209266452), UINT64_C(11905610864067344396),
+    UINT64_C(12866023608407391423), UINT64_C(13521573888156335533), UINT64_C(13016560217115213790),
+    UINT64_C(17409433499605717948), UINT64_C( 8700513040406821399), UINT64_C(  793068917710524973),
+    UINT64_C(10161334706426013491), UINT64_C( 4239622462785638737), UINT64_C(12475778644114153041),
+    UINT64_C( 1727162295983877276), UINT64_C( 6465541350868673194), UINT64_C( 6631467575928358925),
+    UINT64_C(10115886175621146337), UINT64_C(12516352555523415419),
+};
+
@@ -0,0 +1,56 @@
+/*
+ * Generated by make_tables64: do not edit.
+ *
+ * Parameters:
+ * - q = 4611686018427365377 (largest prime < 2^62 equal to 1 modulo 2n)
+ * - n = 1024
+ * - psi = 1482597879546526807
+ * - omega = psi^2 = 2400711739119850254
+ * - inverse of psi = 3388564417695871207
+ * - inverse of omega = 1136970171935060389
+ * - inverse of n = 4607182418799994903
+ *
+ * Each table has 2n elements: p[i] for i < n as in make_tables,
+ * p[n + i] = floor(p[i] * 2^64 / q).
+ */
+
+#ifndef __NTT64_1024_TABLES_H
+#define __NTT64_1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ * - qinv = inverse of q modulo 2^64 (for ntt64_mul_array)
+ * - rescale = inverse of n * 2^64 modulo q, rescale_shoup = its Shoup quotient
+ */
+static const uint64_t ntt64_1024_q = UINT64_C(4611686018427365377);
+static const uint64_t ntt64_1024_psi = UINT64_C(1482597879546526807);
+static const uint64_t ntt64_1024_omega = UINT64_C(2400711739119850254);
+static const uint64_t ntt64_1024_inv_psi = UINT64_C(3388564417695871207);
+static const uint64_t ntt64_1024_inv_omega = UINT64_C(1136970171935060389);
+static const uint64_t ntt64_1024_inv_n = UINT64_C(4607182418799994903);
+static const uint64_t ntt64_1024_qinv = UINT64_C(5842042167526184961);
+static const uint64_t ntt64_1024_rescale = UINT64_C(18014398509481984);
+static const uint64_t ntt64_1024_rescale_shoup = UINT64_C(72057594037928287);
+
+/*
+ * POWERS OF PSI
+ * - scaled_inv_psi_powers[i] = inverse of n * 2^64 * psi^-i
+ */
+extern const uint64_t ntt64_1024_psi_powers[2048];
+extern const uint64_t ntt64_1024_scaled_inv_psi_powers[2048];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint64_t ntt64_1024_omega_powers[2048];
+extern const uint64_t ntt64_1024_omega_powers_rev[2048];
+extern const uint64_t ntt64_1024_inv_omega_powers[2048];
+extern const uint64_t ntt64_1024_inv_omega_powers_rev[2048];
+extern const uint64_t ntt64_1024_mixed_powers[2048];
+extern const uint64_t ntt64_1024_mixed_powers_rev[2048];
+extern const uint64_t ntt64_1024_inv_mixed_powers[2048];
+extern const uint64_t ntt64_1024_inv_mixed_powers_rev[2048];
+
+#endif /* __NTT64_1024_TABLES_H */
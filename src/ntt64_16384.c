@@ -0,0 +1,31 @@
+/*
+ * Four-step NTT for a 50bit prime q and n=16384.
+ *
+ * The element-wise products are Montgomery products: they divide by
+ * 2^64. This and the division by n are compensated by the twiddle
+ * factors of the inverse NTT (inv_mixed_twiddles_4step includes
+ * rescale = inverse of n * 2^64).
+ */
+
+#include "ntt64_16384.h"
+
+/*
+ * Product of two polynomials
+ */
+void ntt64_16384_product_4step(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_16384_ct_std2rev_4step(a, c); // c is used as scratch
+  mulntt64_16384_ct_std2rev_4step(b, c);
+  ntt64_correct(b, 16384, ntt64_16384_q);
+  ntt64_mul_array(c, 16384, ntt64_16384_q, ntt64_16384_qinv, a, b);
+  inttmul64_16384_gs_rev2std_4step(c, a); // a is used as scratch
+  ntt64_correct(c, 16384, ntt64_16384_q);
+}
+
+void ntt64_16384_product_4step_asm(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_16384_ct_std2rev_4step_asm(a, c); // c is used as scratch
+  mulntt64_16384_ct_std2rev_4step_asm(b, c);
+  ntt64_correct_asm(b, 16384, ntt64_16384_q);
+  ntt64_mul_array_asm(c, 16384, ntt64_16384_q, ntt64_16384_qinv, a, b);
+  inttmul64_16384_gs_rev2std_4step_asm(c, a); // a is used as scratch
+  ntt64_correct_asm(c, 16384, ntt64_16384_q);
+}
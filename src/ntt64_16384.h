@@ -0,0 +1,67 @@
+/*
+ * Four-step NTT for a 50bit prime q and n=16384 (see ntt64_16384_tables.h)
+ *
+ * Only the four-step tables are generated at this size (the ten tables
+ * for the direct NTTs would take 256 KB each): the array is seen as a
+ * matrix of 128 rows and 128 columns.
+ */
+
+#ifndef __NTT64_16384_H
+#define __NTT64_16384_H
+
+#include "ntt64_16384_tables.h"
+#include "ntt64.h"
+
+
+/*
+ * NTT VARIANTS
+ *
+ * - the input a is an array of n integers:
+ *   in [0, 4q-1] for mulntt, in [0, 2q-1] for inttmul
+ * - tmp is a scratch array of n integers
+ * - mulntt64_16384_ct_std2rev_4step is the same as mulntt64_ct_std2rev
+ *   for n = 16384: the result is in bit-reverse order, in [0, 4q-1]
+ * - inttmul64_16384_gs_rev2std_4step is the same as nttmul64_gs_rev2std
+ *   followed by a multiplication by rescale = inverse of n * 2^64:
+ *   the result is in standard order, in [0, 2q-1]
+ */
+static inline void mulntt64_16384_ct_std2rev_4step(uint64_t *a, uint64_t *tmp) {
+  ntt64_ct_std2rev_4step(a, 16384, ntt64_16384_n1_4step, ntt64_16384_q, ntt64_16384_col_mixed_powers_rev,
+                         ntt64_16384_row_omega_powers_rev, ntt64_16384_mixed_twiddles_4step, tmp);
+}
+
+static inline void inttmul64_16384_gs_rev2std_4step(uint64_t *a, uint64_t *tmp) {
+  ntt64_gs_rev2std_4step(a, 16384, ntt64_16384_n1_4step, ntt64_16384_q, ntt64_16384_col_inv_mixed_powers_rev,
+                         ntt64_16384_row_inv_omega_powers_rev, ntt64_16384_inv_mixed_twiddles_4step, tmp);
+}
+
+static inline void mulntt64_16384_ct_std2rev_4step_asm(uint64_t *a, uint64_t *tmp) {
+  ntt64_ct_std2rev_4step_asm(a, 16384, ntt64_16384_n1_4step, ntt64_16384_q, ntt64_16384_col_mixed_powers_rev,
+                             ntt64_16384_row_omega_powers_rev, ntt64_16384_mixed_twiddles_4step, tmp);
+}
+
+static inline void inttmul64_16384_gs_rev2std_4step_asm(uint64_t *a, uint64_t *tmp) {
+  ntt64_gs_rev2std_4step_asm(a, 16384, ntt64_16384_n1_4step, ntt64_16384_q, ntt64_16384_col_inv_mixed_powers_rev,
+                             ntt64_16384_row_inv_omega_powers_rev, ntt64_16384_inv_mixed_twiddles_4step, tmp);
+}
+
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Input: two arrays a and b in standard order
+ * Result:
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0 .. q-1]
+ * The result is also in that range.
+ *
+ * product_4step_asm is product_4step with the AVX2 functions.
+ */
+extern void ntt64_16384_product_4step(uint64_t *c, uint64_t *a, uint64_t *b);
+extern void ntt64_16384_product_4step_asm(uint64_t *c, uint64_t *a, uint64_t *b);
+
+#endif /* __NTT64_16384_H */
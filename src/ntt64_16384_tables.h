@@ -0,0 +1,53 @@
+/*
+ * Generated by make_tables64: do not edit.
+ *
+ * Parameters:
+ * - q = 1125899904679937 (largest prime < 2^50 equal to 1 modulo 2n)
+ * - n = 16384
+ * - psi = 974161070679573
+ * - omega = psi^2 = 951222983339009
+ * - inverse of psi = 554854690871660
+ * - inverse of omega = 231911610869927
+ * - inverse of n = 1125831185203333
+ *
+ * Each table has 2n elements: p[i] for i < n as in make_tables,
+ * p[n + i] = floor(p[i] * 2^64 / q).
+ */
+
+#ifndef __NTT64_16384_TABLES_H
+#define __NTT64_16384_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ * - qinv = inverse of q modulo 2^64 (for ntt64_mul_array)
+ * - rescale = inverse of n * 2^64 modulo q, rescale_shoup = its Shoup quotient
+ * - n1_4step = number of rows for the four-step NTTs
+ */
+static const uint64_t ntt64_16384_q = UINT64_C(1125899904679937);
+static const uint64_t ntt64_16384_psi = UINT64_C(974161070679573);
+static const uint64_t ntt64_16384_omega = UINT64_C(951222983339009);
+static const uint64_t ntt64_16384_inv_psi = UINT64_C(554854690871660);
+static const uint64_t ntt64_16384_inv_omega = UINT64_C(231911610869927);
+static const uint64_t ntt64_16384_inv_n = UINT64_C(1125831185203333);
+static const uint64_t ntt64_16384_qinv = UINT64_C(10114245015365550081);
+static const uint64_t ntt64_16384_rescale = UINT64_C(2162687);
+static const uint64_t ntt64_16384_rescale_shoup = UINT64_C(35433463876);
+static const uint64_t ntt64_16384_n1_4step = UINT64_C(128);
+
+/*
+ * TABLES FOR FOUR-STEP NTT COMPUTATION
+ * - col tables: NTTs of size n1 with psi1 = psi^(n/n1) (2 * n1 elements)
+ * - row tables: NTTs of size n2 = n/n1 with omega2 = omega^n1 (2 * n2 elements)
+ * - mixed_twiddles_4step[x2 * n1 + j] = psi^(x2 * (2 * bitrev(j) + 1))
+ * - inv_mixed_twiddles_4step[x2 * n1 + j] = rescale * psi^-(x2 * (2 * bitrev(j) + 1))
+ */
+extern const uint64_t ntt64_16384_col_mixed_powers_rev[256];
+extern const uint64_t ntt64_16384_col_inv_mixed_powers_rev[256];
+extern const uint64_t ntt64_16384_row_omega_powers_rev[256];
+extern const uint64_t ntt64_16384_row_inv_omega_powers_rev[256];
+extern const uint64_t ntt64_16384_mixed_twiddles_4step[32768];
+extern const uint64_t ntt64_16384_inv_mixed_twiddles_4step[32768];
+
+#endif /* __NTT64_16384_TABLES_H */
@@ -0,0 +1,83 @@
+/*
+ * NTT for a 50bit prime q and n=4096.
+ *
+ * The element-wise products are Montgomery products: they divide by
+ * 2^64 and this is compensated by the final scaling
+ * (scaled_inv_psi_powers and rescale include the factor 2^64).
+ */
+
+#include "ntt64_4096.h"
+
+/*
+ * Product of two polynomials
+ */
+void ntt64_4096_product1(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_ct_std2rev(a);
+  ntt64_mul_powers(b, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_ct_std2rev(b);
+  ntt64_correct(b, 4096, ntt64_4096_q);
+  ntt64_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  intt64_4096_ct_rev2std(c);
+  ntt64_mul_powers(c, 4096, ntt64_4096_q, ntt64_4096_scaled_inv_psi_powers);
+  ntt64_correct(c, 4096, ntt64_4096_q);
+}
+
+void ntt64_4096_product2(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_gs_std2rev(a);
+  ntt64_mul_powers(b, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_gs_std2rev(b);
+  ntt64_correct(b, 4096, ntt64_4096_q);
+  ntt64_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  intt64_4096_ct_rev2std(c);
+  ntt64_mul_powers(c, 4096, ntt64_4096_q, ntt64_4096_scaled_inv_psi_powers);
+  ntt64_correct(c, 4096, ntt64_4096_q);
+}
+
+void ntt64_4096_product3(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_ct_std2rev(a);
+  ntt64_mul_powers(b, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_ct_std2rev(b);
+  ntt64_correct(b, 4096, ntt64_4096_q);
+  ntt64_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  intt64_4096_gs_rev2std(c);
+  ntt64_mul_powers(c, 4096, ntt64_4096_q, ntt64_4096_scaled_inv_psi_powers);
+  ntt64_correct(c, 4096, ntt64_4096_q);
+}
+
+void ntt64_4096_product4(uint64_t *c, uint64_t *a, uint64_t *b) {
+  ntt64_mul_powers(a, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_gs_std2rev(a);
+  ntt64_mul_powers(b, 4096, ntt64_4096_q, ntt64_4096_psi_powers);
+  ntt64_4096_gs_std2rev(b);
+  ntt64_correct(b, 4096, ntt64_4096_q);
+  ntt64_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  intt64_4096_gs_rev2std(c);
+  ntt64_mul_powers(c, 4096, ntt64_4096_q, ntt64_4096_scaled_inv_psi_powers);
+  ntt64_correct(c, 4096, ntt64_4096_q);
+}
+
+/*
+ * Use combined mulntt then inttmul
+ */
+void ntt64_4096_product5(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_4096_ct_std2rev(a);
+  mulntt64_4096_ct_std2rev(b);
+  ntt64_correct(b, 4096, ntt64_4096_q);
+  ntt64_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  inttmul64_4096_gs_rev2std(c);
+  ntt64_scalar_mul_array(c, 4096, ntt64_4096_q, ntt64_4096_rescale, ntt64_4096_rescale_shoup); // divide by n
+  ntt64_correct(c, 4096, ntt64_4096_q);
+}
+
+void ntt64_4096_product5_asm(uint64_t *c, uint64_t *a, uint64_t *b) {
+  mulntt64_ct_std2rev_asm(a, 4096, ntt64_4096_q, ntt64_4096_mixed_powers_rev);
+  mulntt64_ct_std2rev_asm(b, 4096, ntt64_4096_q, ntt64_4096_mixed_powers_rev);
+  ntt64_correct_asm(b, 4096, ntt64_4096_q);
+  ntt64_mul_array_asm(c, 4096, ntt64_4096_q, ntt64_4096_qinv, a, b);
+  nttmul64_gs_rev2std_asm(c, 4096, ntt64_4096_q, ntt64_4096_inv_mixed_powers_rev);
+  ntt64_scalar_mul_array_asm(c, 4096, ntt64_4096_q, ntt64_4096_rescale, ntt64_4096_rescale_shoup); // divide by n
+  ntt64_correct_asm(c, 4096, ntt64_4096_q);
+}
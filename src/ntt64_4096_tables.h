@@ -0,0 +1,56 @@
+/*
+ * Generated by make_tables64: do not edit.
+ *
+ * Parameters:
+ * - q = 1125899906826241 (largest prime < 2^50 equal to 1 modulo 2n)
+ * - n = 4096
+ * - psi = 1094367314627419
+ * - omega = psi^2 = 765727830662934
+ * - inverse of psi = 595722224416665
+ * - inverse of omega = 720760365837893
+ * - inverse of n = 1125625028919301
+ *
+ * Each table has 2n elements: p[i] for i < n as in make_tables,
+ * p[n + i] = floor(p[i] * 2^64 / q).
+ */
+
+#ifndef __NTT64_4096_TABLES_H
+#define __NTT64_4096_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ * - qinv = inverse of q modulo 2^64 (for ntt64_mul_array)
+ * - rescale = inverse of n * 2^64 modulo q, rescale_shoup = its Shoup quotient
+ */
+static const uint64_t ntt64_4096_q = UINT64_C(1125899906826241);
+static const uint64_t ntt64_4096_psi = UINT64_C(1094367314627419);
+static const uint64_t ntt64_4096_omega = UINT64_C(765727830662934);
+static const uint64_t ntt64_4096_inv_psi = UINT64_C(595722224416665);
+static const uint64_t ntt64_4096_inv_omega = UINT64_C(720760365837893);
+static const uint64_t ntt64_4096_inv_n = UINT64_C(1125625028919301);
+static const uint64_t ntt64_4096_qinv = UINT64_C(70936092446048257);
+static const uint64_t ntt64_4096_rescale = UINT64_C(65532);
+static const uint64_t ntt64_4096_rescale_shoup = UINT64_C(1073676288);
+
+/*
+ * POWERS OF PSI
+ * - scaled_inv_psi_powers[i] = inverse of n * 2^64 * psi^-i
+ */
+extern const uint64_t ntt64_4096_psi_powers[8192];
+extern const uint64_t ntt64_4096_scaled_inv_psi_powers[8192];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint64_t ntt64_4096_omega_powers[8192];
+extern const uint64_t ntt64_4096_omega_powers_rev[8192];
+extern const uint64_t ntt64_4096_inv_omega_powers[8192];
+extern const uint64_t ntt64_4096_inv_omega_powers_rev[8192];
+extern const uint64_t ntt64_4096_mixed_powers[8192];
+extern const uint64_t ntt64_4096_mixed_powers_rev[8192];
+extern const uint64_t ntt64_4096_inv_mixed_powers[8192];
+extern const uint64_t ntt64_4096_inv_mixed_powers_rev[8192];
+
+#endif /* __NTT64_4096_TABLES_H */
@@ -0,0 +1,39 @@
+/*
+ * Four-step NTT for Q=12289 using the AVX2 kernels.
+ */
+
+#include "ntt_4step_asm.h"
+
+void ntt_red_ct_std2rev_4step_asm(int32_t *a, uint32_t n, uint32_t n1,
+                                  const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  transpose_asm(tmp, a, n1, n2);
+  for (i=0; i<n; i += n1) {
+    mulntt_red_ct_std2rev_asm(tmp + i, n1, p1);
+  }
+  mul_reduce_array16_asm(tmp, n, tw);
+  reduce_array_asm(tmp, n);
+  transpose_asm(a, tmp, n2, n1);
+  for (i=0; i<n; i += n2) {
+    mulntt_red_ct_std2rev_asm(a + i, n2, p2);
+  }
+}
+
+void ntt_red_gs_rev2std_4step_asm(int32_t *a, uint32_t n, uint32_t n1,
+                                  const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  for (i=0; i<n; i += n2) {
+    nttmul_red_gs_rev2std_asm(a + i, n2, p2);
+  }
+  transpose_asm(tmp, a, n1, n2);
+  mul_reduce_array16_asm(tmp, n, tw);
+  reduce_array_asm(tmp, n);
+  for (i=0; i<n; i += n1) {
+    nttmul_red_gs_rev2std_asm(tmp + i, n1, p1);
+  }
+  transpose_asm(a, tmp, n2, n1);
+}
@@ -0,0 +1,30 @@
+/*
+ * Four-step NTT for Q=12289 using the AVX2 kernels.
+ */
+
+#ifndef __NTT_4STEP_ASM_H
+#define __NTT_4STEP_ASM_H
+
+#include <stdint.h>
+
+#include "ntt_asm.h"
+
+/*
+ * Same as ntt_red_ct_std2rev_4step and ntt_red_gs_rev2std_4step
+ * (in ntt_red.h) with the AVX2 kernels:
+ * - the small NTTs are done by mulntt_red_ct_std2rev_asm and
+ *   nttmul_red_gs_rev2std_asm
+ * - the transpositions by transpose_asm.
+ *
+ * - n = n1 * n2 where n1 and n2 must be multiples of 16
+ * - p1, p2, tw: tables as in ntt_red.h
+ * - tmp = scratch array of size n
+ *
+ * The results are the same as the C versions (bit for bit).
+ */
+extern void ntt_red_ct_std2rev_4step_asm(int32_t *a, uint32_t n, uint32_t n1,
+                                         const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp);
+extern void ntt_red_gs_rev2std_4step_asm(int32_t *a, uint32_t n, uint32_t n1,
+                                         const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp);
+
+#endif /* __NTT_4STEP_ASM_H */
@@ -82,6 +82,26 @@ extern void mul_reduce_array_asm(int32_t *a, uint32_t n, const int32_t *b, const
  */
 extern void scalar_mul_reduce_array_asm(int32_t *a, uint32_t n, int32_t c);
 
+/*
+ * Final step of the product functions: multiplication by p[i] or by
+ * a scalar c, double reduction, then conversion to [0, Q-1].
+ *
+ * mul_reduce_finalize_asm(a, n, p) is equivalent to
+ *    mul_reduce_array16_asm(a, n, p);
+ *    reduce_array_twice_asm(a, n);
+ *    correct_asm(a, n);
+ *
+ * scalar_mul_reduce_finalize_asm(a, n, c) is equivalent to
+ *    scalar_mul_reduce_array_asm(a, n, c);
+ *    reduce_array_twice_asm(a, n);
+ *    correct_asm(a, n);
+ *
+ * - n must be positive and a multiple of 16
+ * - the result is stored in place, in the range [0, Q-1]
+ */
+extern void mul_reduce_finalize_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void scalar_mul_reduce_finalize_asm(int32_t *a, uint32_t n, int32_t c);
+
 
 
 /******************
@@ -156,6 +176,24 @@ extern void ntt_red_ct_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
  */
 extern void mulntt_red_ct_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
 
+/*
+ * Register-resident versions of versions 3 and 4
+ * - n must be a power of two, at least 16
+ * - blocks of 64 coefficients (or the whole array if n <= 64) are
+ *   kept in registers for all the rounds with d < 64 (fully unrolled)
+ *
+ * Both compute the same thing as mulntt_red_ct_std2rev_asm(a, n, p).
+ * With a table of omega powers (where p[t] = -4096 = inverse(3) for all t),
+ * that's also the same as ntt_red_ct_std2rev_asm(a, n, p).
+ *
+ * mulntt_red_ct_std2rev_reg_fused_asm(a, n, p) is equivalent to
+ *    mulntt_red_ct_std2rev_reg_asm(a, n, p);
+ *    reduce_array_asm(a, n);
+ */
+extern void ntt_red_ct_std2rev_reg_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_std2rev_reg_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_std2rev_reg_fused_asm(int32_t *a, uint32_t n, const int16_t *p);
+
 
 /*
  * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
@@ -219,4 +257,174 @@ extern void ntt_red_gs_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
 extern void nttmul_red_gs_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
 
 
+/*********************
+ *  FUSED TRANSFORMS *
+ ********************/
+
+/*
+ * These combine the forward NTT with the array operations that
+ * surround it in the product functions. They save passes over a.
+ *
+ * ntt_red_ct_std2rev_fused_asm(a, n, p, s) is equivalent to
+ *    mul_reduce_array16_asm(a, n, s);
+ *    ntt_red_ct_std2rev_asm(a, n, p);
+ *    reduce_array_asm(a, n);
+ *
+ * ntt_red_gs_std2rev_fused_asm(a, n, p, s) is equivalent to
+ *    mul_reduce_array16_asm(a, n, s);
+ *    ntt_red_gs_std2rev_asm(a, n, p);
+ *    reduce_array_asm(a, n);
+ *
+ * mulntt_red_ct_std2rev_fused_asm(a, n, p) is equivalent to
+ *    mulntt_red_ct_std2rev_asm(a, n, p);
+ *    reduce_array_asm(a, n);
+ *
+ * mulntt_red_ct_std2rev_fused2_asm(a, b, n, p) is equivalent to
+ *    mulntt_red_ct_std2rev_fused_asm(a, n, p);
+ *    mulntt_red_ct_std2rev_fused_asm(b, n, p);
+ * The two arrays are processed in lockstep: each constant of p is loaded
+ * once and the butterflies on a and b are interleaved (two independent
+ * dependency chains). a and b must not overlap.
+ *
+ * - input: a[0 ... n-1] in standard order
+ * - p: as in the corresponding NTT function
+ * - s: array of n signed 16bit constants (typically powers of psi)
+ * - n must be a positive multiple of 16
+ *
+ * The results are the same as the unfused sequences (bit for bit).
+ */
+extern void ntt_red_ct_std2rev_fused_asm(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s);
+extern void ntt_red_gs_std2rev_fused_asm(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s);
+extern void mulntt_red_ct_std2rev_fused_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_std2rev_fused2_asm(int32_t *a, int32_t *b, uint32_t n, const int16_t *p);
+
+
+/*
+ * Variants that read their constants from tables in SIMD layout.
+ *
+ * The 16bit tables are read with vpmovsxwq/vpbroadcastw then permuted
+ * (perm2020, perm0426, ...) to put each constant in the lanes where it's
+ * used. The SIMD layout stores the constants sign-extended to 32bits,
+ * in the order and lanes the loops use them, so each load is a vmovdqa
+ * or a vpbroadcastd from memory (which doesn't use the shuffle unit).
+ * make_red_tables builds the tables from p (ntt_red<n>_mixed_powers_rev_simd
+ * and ntt_red<n>_inv_mixed_powers_rev_simd). They must be 32-byte aligned.
+ *
+ * mulntt_red_ct_std2rev_simd_asm(a, n, w): same as mulntt_red_ct_std2rev_asm(a, n, p)
+ * - w[0 ... b-1] = p[0 ... b-1] with b = max(n/8, 8) (rounds with d >= 8)
+ * - then n/16 vectors of 8 constants for each of the rounds d = 4, 2, 1:
+ *    d = 4: [U U U U V V V V]            (U, V = p[n/8 + 2g ...])
+ *    d = 2: [U U W W V V X X]            (U, V, W, X = p[n/4 + 4g ...])
+ *    d = 1: [U0 U4 U1 U5 U2 U6 U3 U7]    (U0 ... U7 = p[n/2 + 8g ...])
+ *
+ * mulntt_red_ct_std2rev_simd_fused_asm(a, n, w): same as
+ *    mulntt_red_ct_std2rev_simd_asm(a, n, w);
+ *    reduce_array_asm(a, n);
+ *
+ * nttmul_red_gs_rev2std_simd_asm(a, n, w): same as nttmul_red_gs_rev2std_asm(a, n, p)
+ * - w[0 ... b-1] = p[0 ... b-1] with b = max(n/4, 8) (rounds with d >= 4)
+ * - then n/8 vectors [w0 U w1 U w2 V w3 V] for the first two rounds
+ *   (w0 ... w3 = p[n/2 + 4g ...], U, V = p[n/4 + 2g ...])
+ *
+ * n must be a positive multiple of 16.
+ * The results are the same as the 16bit versions (bit for bit).
+ */
+extern void mulntt_red_ct_std2rev_simd_asm(int32_t *a, uint32_t n, const int32_t *w);
+extern void mulntt_red_ct_std2rev_simd_fused_asm(int32_t *a, uint32_t n, const int32_t *w);
+extern void nttmul_red_gs_rev2std_simd_asm(int32_t *a, uint32_t n, const int32_t *w);
+
+
+/*
+ * Pointwise product followed by an inverse NTT.
+ *
+ * pointwise_ntt_red_ct_rev2std_asm(c, n, a, b, p) is equivalent to
+ *    mul_reduce_array_asm(c, n, a, b);
+ *    reduce_array_twice_asm(c, n);
+ *    ntt_red_ct_rev2std_asm(c, n, p);
+ *
+ * pointwise_ntt_red_gs_rev2std_asm(c, n, a, b, p) is equivalent to
+ *    mul_reduce_array_asm(c, n, a, b);
+ *    reduce_array_twice_asm(c, n);
+ *    ntt_red_gs_rev2std_asm(c, n, p);
+ *
+ * pointwise_nttmul_red_gs_rev2std_asm(c, n, a, b, p) is equivalent to
+ *    mul_reduce_array_asm(c, n, a, b);
+ *    reduce_array_twice_asm(c, n);
+ *    nttmul_red_gs_rev2std_asm(c, n, p);
+ *
+ * - a and b: input arrays in bit-reverse order (not modified)
+ * - c: output array in standard order
+ * - n must be a positive multiple of 16
+ *
+ * The products a[i] * b[i] are not stored in c. They are kept in
+ * registers and used as input to the first three NTT rounds.
+ * This saves memory traffic but not arithmetic: when the loops are
+ * limited by vector ALU throughput, the separate passes can be faster.
+ * speed_mul1024_red_asm compares the two.
+ */
+extern void pointwise_ntt_red_ct_rev2std_asm(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p);
+extern void pointwise_ntt_red_gs_rev2std_asm(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p);
+extern void pointwise_nttmul_red_gs_rev2std_asm(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p);
+
+
+/*********************
+ *  VPMULLD VARIANTS *
+ ********************/
+
+/*
+ * Same as ntt_red_ct_rev2std_asm and ntt_red_ct_std2rev_asm but
+ * the products are computed with vpmulld (eight 32bit products per
+ * instruction). This requires |w * x| < 2^31 for all products so
+ * the result of the rounds with step size 8, 128, 2048, ... is reduced.
+ *
+ * - input/output order and p: same as ntt_red_ct_rev2std_asm and
+ *   ntt_red_ct_std2rev_asm
+ * - n must be a positive multiple of 16
+ * - output: 3^k * NTT(a) where k = number of rounds with step
+ *   size 8 * 16^i (i.e., k = 1 for n=16 to 128, k = 2 for n=256 to 2048).
+ *
+ * Precondition: no product overflows. For input bound b0 (|a[i]| <= b0)
+ * and table p, this holds if
+ *   ntt_ct_mulld_bounds(b0, n, p, std2rev, bound, prod) < 2^31
+ * (see red_bounds.h; std2rev is true for ntt_red_ct_std2rev_mulld_asm).
+ * This depends on the actual table, not only on b0. For all the omega
+ * tables with |p[i]| <= 6144, the condition holds with b0 = 21499.
+ *
+ * Only these two Cooley-Tukey transforms have vpmulld versions: there
+ * are no mulntt/nttmul variants (the first round has no multiplications)
+ * and no Gentleman-Sande variants. Callers must cancel the 3^k factor.
+ * ntt_red1024_product_mulld_asm (ntt_red_asm1024.h) shows how to do that
+ * and is checked by kat_mul1024_red_asm.
+ */
+extern void ntt_red_ct_rev2std_mulld_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_red_ct_std2rev_mulld_asm(int32_t *a, uint32_t n, const int16_t *p);
+
+
+/*
+ * Transpose: same as transpose in ntt_red.h
+ * - a is a matrix of rows x cols elements, stored in b as a matrix
+ *   of cols x rows elements
+ * - rows and cols must be multiples of 8
+ * - a and b must be distinct
+ */
+extern void transpose_asm(int32_t *b, const int32_t *a, uint32_t rows, uint32_t cols);
+
+/*
+ * Bit-reverse kernel for an 8x8 tile of 32bit integers:
+ *   dst[rev(l) * dstride + rev(h)] = src[h * sstride + l]
+ * for h, l in 0 ... 7, where rev reverses 3 bits.
+ * - dst may be equal to src (all loads are done before the stores)
+ * - strides are in number of integers
+ * See ntt_bitrev.h.
+ */
+extern void bitrev_tile_asm(int32_t *dst, const int32_t *src, uint32_t dstride, uint32_t sstride);
+
+/*
+ * Swap of two distinct tiles x and y (with the same row stride) with the
+ * same permutation: same as bitrev_tile_asm(y, x, stride, stride) and
+ * bitrev_tile_asm(x, y, stride, stride) at the same time.
+ */
+extern void bitrev_swap_tiles_asm(int32_t *x, int32_t *y, uint32_t stride);
+
+
 #endif
@@ -0,0 +1,105 @@
+/*
+ * BD: batched NTT
+ *
+ * All variants are specialized to Q=12289.
+ * - omega denotes a primitive n-th root of unity (mod Q).
+ * - psi denotes a square root of omega (mod Q).
+ *
+ * These functions work on a batch of independent polynomials stored
+ * in structure-of-arrays (SoA) layout: coefficient i of polynomial k
+ * is at index L * i + k, where L is the batch size.
+ *
+ * - batch8: L = 8 polynomials with 32-bit coefficients. The arithmetic
+ *   is the same as in ntt_red.h/ntt_asm.h (Longa-Naehrig reduction).
+ * - batch16: L = 16 polynomials with 16-bit coefficients. The arithmetic
+ *   is the same as in ntt_short.h/ntt_short_asm.h.
+ *
+ * Each row of L coefficients is one AVX2 register so the butterflies
+ * don't need any shuffles. For each polynomial in the batch, the NTT
+ * functions compute exactly the same result as the corresponding
+ * single-polynomial function, and the same bounds apply.
+ *
+ * The element-wise functions of ntt_asm.h and ntt_short_asm.h
+ * (reduce_array_asm, mul_reduce_array_asm, short_mul_array_asm, ...)
+ * can be applied directly to SoA arrays of L * n elements, except the
+ * ones that take a table of per-coefficient constants.
+ */
+
+#ifndef __NTT_BATCH_ASM_H
+#define __NTT_BATCH_ASM_H
+
+#include <stdint.h>
+
+
+/************************************
+ *  32-BIT COEFFICIENTS: BATCH OF 8 *
+ ***********************************/
+
+/*
+ * Conversion to and from SoA layout
+ * - pack: b[8 * i + k] = a[k][i] for k=0 ... 7 and i=0 ... n-1
+ * - unpack: a[k][i] = b[8 * i + k]
+ * - n must be positive and a multiple of 8
+ */
+extern void ntt_red_batch8_pack_asm(int32_t *b, int32_t * const *a, uint32_t n);
+extern void ntt_red_batch8_unpack_asm(int32_t * const *a, const int32_t *b, uint32_t n);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - a: array of 8n elements in SoA layout
+ * - n must be a power of two and n >= 2
+ * - p: as in ntt_red_ct_std2rev and mulntt_red_ct_std2rev
+ *   p[t + j] = omega^(n/2t)^bitrev(j) * inverse(3)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) * inverse(3)
+ */
+extern void ntt_red_batch8_ct_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_batch8_ct_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - a: array of 8n elements in SoA layout
+ * - n must be a power of two and n >= 2
+ * - p: as in ntt_red_gs_rev2std and nttmul_red_gs_rev2std
+ *   p[t + j] = omega^(n/2t)^bitrev(j) * inverse(3)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) * inverse(3)
+ */
+extern void ntt_red_batch8_gs_rev2std_asm(int32_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_red_batch8_gs_rev2std_asm(int32_t *a, uint32_t n, const int16_t *p);
+
+
+/*************************************
+ *  16-BIT COEFFICIENTS: BATCH OF 16 *
+ ************************************/
+
+/*
+ * Conversion to and from SoA layout
+ * - pack: b[16 * i + k] = a[k][i] for k=0 ... 15 and i=0 ... n-1
+ * - unpack: a[k][i] = b[16 * i + k]
+ * - n must be positive and a multiple of 16
+ */
+extern void ntt_short_batch16_pack_asm(int16_t *b, int16_t * const *a, uint32_t n);
+extern void ntt_short_batch16_unpack_asm(int16_t * const *a, const int16_t *b, uint32_t n);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - a: array of 16n elements in SoA layout
+ * - n must be a power of two and n >= 2
+ * - p: table of 2n constants as in ntt_short_ct_std2rev
+ *
+ * Input must be in [-12289, 12289], output is in [-13442, 13442].
+ */
+extern void ntt_short_batch16_ct_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_short_batch16_ct_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - a: array of 16n elements in SoA layout
+ * - n must be a power of two and n >= 2
+ * - p: table of 2n constants as in ntt_short_gs_rev2std
+ *
+ * Input must be in [-16383, 16383], output is in [-12288, 12288].
+ */
+extern void ntt_short_batch16_gs_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_short_batch16_gs_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+#endif /* __NTT_BATCH_ASM_H */
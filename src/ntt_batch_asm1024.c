@@ -0,0 +1,44 @@
+/*
+ * Batched NTT for Q=12289, n=1024.
+ * AVX implementation.
+ */
+
+#include "ntt_batch_asm1024.h"
+
+/*
+ * Input: two arrays a and b of 8 * 1024 elements in SoA layout
+ *
+ * Result:
+ * - the products are stored in array c (SoA layout, standard order).
+ * - arrays a and b are modified
+ *
+ * Same steps as ntt_red1024_product5_asm. The element-wise steps
+ * are applied to the whole SoA array.
+ */
+void ntt_red1024_batch8_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_batch8_ct_std2rev_asm(a);
+  reduce_array_asm(a, 8 * 1024);
+
+  mulntt_red1024_batch8_ct_std2rev_asm(b);
+  reduce_array_asm(b, 8 * 1024);
+
+  mul_reduce_array_asm(c, 8 * 1024, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice_asm(c, 8 * 1024);     // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_batch8_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 8 * 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+/*
+ * Same thing for 16 polynomials with 16-bit coefficients:
+ * same steps as ntt_short1024_product5_asm.
+ */
+void ntt_short1024_batch16_product5_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mulntt_short1024_batch16_ct_std2rev_asm(a);
+  mulntt_short1024_batch16_ct_std2rev_asm(b);
+
+  short_mul_array_asm(c, 16 * 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  inttmul_short1024_batch16_gs_rev2std_asm(c);
+  short_scalar_mul_finalize_asm(c, 16 * 1024, ntt_short1024_rescale, ntt_short1024_rescale_bar); // rescale, convert to [0, Q-1]
+}
@@ -0,0 +1,121 @@
+/*
+ * Batched NTT for Q=12289, n=1024.
+ * AVX implementation.
+ */
+
+#ifndef __NTT_BATCH_ASM1024_H
+#define __NTT_BATCH_ASM1024_H
+
+#include "ntt_red1024_tables.h"
+#include "ntt_short1024_tables.h"
+#include "ntt_asm.h"
+#include "ntt_short_asm.h"
+#include "ntt_batch_asm.h"
+
+/*
+ * 32-BIT COEFFICIENTS: BATCH OF 8 POLYNOMIALS
+ *
+ * Each function processes an array a of 8 * 1024 elements in SoA
+ * layout, using the tables from ntt_red1024_tables.h.
+ */
+// pack/unpack
+static inline void ntt_red1024_batch8_pack_asm(int32_t *b, int32_t * const *a) {
+  ntt_red_batch8_pack_asm(b, a, 1024);
+}
+
+static inline void ntt_red1024_batch8_unpack_asm(int32_t * const *a, const int32_t *b) {
+  ntt_red_batch8_unpack_asm(a, b, 1024);
+}
+
+// forward ntt
+static inline void ntt_red1024_batch8_ct_std2rev_asm(int32_t *a) {
+  ntt_red_batch8_ct_std2rev_asm(a, 1024, ntt_red1024_omega_powers_rev);
+}
+
+static inline void ntt_red1024_batch8_gs_rev2std_asm(int32_t *a) {
+  ntt_red_batch8_gs_rev2std_asm(a, 1024, ntt_red1024_omega_powers_rev);
+}
+
+// inverse
+static inline void intt_red1024_batch8_ct_std2rev_asm(int32_t *a) {
+  ntt_red_batch8_ct_std2rev_asm(a, 1024, ntt_red1024_inv_omega_powers_rev);
+}
+
+static inline void intt_red1024_batch8_gs_rev2std_asm(int32_t *a) {
+  ntt_red_batch8_gs_rev2std_asm(a, 1024, ntt_red1024_inv_omega_powers_rev);
+}
+
+// multiplication by powers of psi then forward ntt
+static inline void mulntt_red1024_batch8_ct_std2rev_asm(int32_t *a) {
+  mulntt_red_batch8_ct_std2rev_asm(a, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+// inverse ntt then multiplication by powers of psi^-1
+static inline void inttmul_red1024_batch8_gs_rev2std_asm(int32_t *a) {
+  nttmul_red_batch8_gs_rev2std_asm(a, 1024, ntt_red1024_inv_mixed_powers_rev);
+}
+
+
+/*
+ * 16-BIT COEFFICIENTS: BATCH OF 16 POLYNOMIALS
+ *
+ * Each function processes an array a of 16 * 1024 elements in SoA
+ * layout, using the tables from ntt_short1024_tables.h.
+ */
+// pack/unpack
+static inline void ntt_short1024_batch16_pack_asm(int16_t *b, int16_t * const *a) {
+  ntt_short_batch16_pack_asm(b, a, 1024);
+}
+
+static inline void ntt_short1024_batch16_unpack_asm(int16_t * const *a, const int16_t *b) {
+  ntt_short_batch16_unpack_asm(a, b, 1024);
+}
+
+// forward ntt
+static inline void ntt_short1024_batch16_ct_std2rev_asm(int16_t *a) {
+  ntt_short_batch16_ct_std2rev_asm(a, 1024, ntt_short1024_omega_powers_rev);
+}
+
+static inline void ntt_short1024_batch16_gs_rev2std_asm(int16_t *a) {
+  ntt_short_batch16_gs_rev2std_asm(a, 1024, ntt_short1024_omega_powers_rev);
+}
+
+// inverse
+static inline void intt_short1024_batch16_ct_std2rev_asm(int16_t *a) {
+  ntt_short_batch16_ct_std2rev_asm(a, 1024, ntt_short1024_inv_omega_powers_rev);
+}
+
+static inline void intt_short1024_batch16_gs_rev2std_asm(int16_t *a) {
+  ntt_short_batch16_gs_rev2std_asm(a, 1024, ntt_short1024_inv_omega_powers_rev);
+}
+
+// multiplication by powers of psi then forward ntt
+static inline void mulntt_short1024_batch16_ct_std2rev_asm(int16_t *a) {
+  mulntt_short_batch16_ct_std2rev_asm(a, 1024, ntt_short1024_mixed_powers_rev);
+}
+
+// inverse ntt then multiplication by powers of psi^-1
+static inline void inttmul_short1024_batch16_gs_rev2std_asm(int16_t *a) {
+  nttmul_short_batch16_gs_rev2std_asm(a, 1024, ntt_short1024_inv_mixed_powers_rev);
+}
+
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Input: two arrays a and b in SoA layout (8 or 16 polynomials)
+ *
+ * Result:
+ * - the products are stored in array c, in SoA layout and standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1].
+ * The result is also in that range. For each polynomial, the result
+ * is the same as ntt_red1024_product5_asm or ntt_short1024_product5_asm.
+ */
+extern void ntt_red1024_batch8_product5_asm(int32_t *c, int32_t *a, int32_t *b);
+extern void ntt_short1024_batch16_product5_asm(int16_t *c, int16_t *a, int16_t *b);
+
+#endif /* __NTT_BATCH_ASM1024_H */
@@ -0,0 +1,236 @@
+/*
+ * BD: blocked bit-reverse permutation (COBRA-style).
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "ntt_bitrev.h"
+#include "ntt_asm.h"
+
+/*
+ * Tile kernels:
+ * - tile: dst[rev(l) * dstride + rev(h)] = src[h * sstride + l]
+ * - swap: tile(y, x) and tile(x, y) for two distinct tiles x and y
+ */
+typedef void (*tile_fun_t)(int32_t *dst, const int32_t *src, uint32_t dstride, uint32_t sstride);
+typedef void (*swap_fun_t)(int32_t *x, int32_t *y, uint32_t stride);
+
+typedef struct tile_ops_s {
+  tile_fun_t tile;
+  swap_fun_t swap;
+} tile_ops_t;
+
+static const uint8_t rev3[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+
+/*
+ * Portable version of bitrev_tile_asm
+ */
+static void bitrev_tile(int32_t *dst, const int32_t *src, uint32_t dstride, uint32_t sstride) {
+  int32_t tmp[64];
+  uint32_t h, l;
+
+  for (h=0; h<8; h++) {
+    for (l=0; l<8; l++) {
+      tmp[rev3[l] * 8 + rev3[h]] = src[h * sstride + l];
+    }
+  }
+  for (l=0; l<8; l++) {
+    memcpy(dst + l * dstride, tmp + l * 8, 8 * sizeof(int32_t));
+  }
+}
+
+static void bitrev_swap_tiles(int32_t *x, int32_t *y, uint32_t stride) {
+  int32_t buffer[64];
+  uint32_t l;
+
+  bitrev_tile(buffer, x, 8, stride);
+  bitrev_tile(x, y, stride, stride);
+  for (l=0; l<8; l++) {
+    memcpy(y + l * stride, buffer + 8 * l, 8 * sizeof(int32_t));
+  }
+}
+
+static const tile_ops_t c_ops = { bitrev_tile, bitrev_swap_tiles };
+static const tile_ops_t asm_ops = { bitrev_tile_asm, bitrev_swap_tiles_asm };
+
+/*
+ * Reverse the k low-order bits of i
+ */
+static uint32_t bitrev(uint32_t i, uint32_t k) {
+  uint32_t j;
+
+  j = 0;
+  while (k > 0) {
+    j = (j << 1) | (i & 1);
+    i >>= 1;
+    k --;
+  }
+  return j;
+}
+
+static uint32_t log2_size(uint32_t n) {
+  uint32_t k;
+
+  assert(n > 0 && (n & (n - 1)) == 0); // n must be a power of 2
+  k = 0;
+  while ((((uint32_t) 1) << k) < n) k ++;
+  return k;
+}
+
+/*
+ * SMALL ARRAYS (n < 64)
+ */
+static void small_shuffle(int32_t *a, uint32_t n, uint32_t k) {
+  uint32_t i, j;
+  int32_t x;
+
+  for (i=0; i<n; i++) {
+    j = bitrev(i, k);
+    if (i < j) {
+      x = a[i]; a[i] = a[j]; a[j] = x;
+    }
+  }
+}
+
+static void small_copy(int32_t *b, const int32_t *a, uint32_t n, uint32_t k) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    b[bitrev(i, k)] = a[i];
+  }
+}
+
+
+/*
+ * TILE LEVEL
+ */
+
+/*
+ * Out-of-place: tile m of a to tile r = rev'(m) of b (s = n/8)
+ */
+static inline void copy_tile(const tile_ops_t *f, int32_t *b, const int32_t *a, uint32_t s, uint32_t m, uint32_t r) {
+  f->tile(b + 8 * r, a + 8 * m, s, s);
+}
+
+/*
+ * In-place: swap tiles m and r = rev'(m), or permute tile m if m = r.
+ */
+static inline void swap_tiles(const tile_ops_t *f, int32_t *a, uint32_t s, uint32_t m, uint32_t r) {
+  if (m == r) {
+    f->tile(a + 8 * m, a + 8 * m, s, s);
+  } else {
+    f->swap(a + 8 * m, a + 8 * r, s);
+  }
+}
+
+/*
+ * k = log2(n) >= 6: the tile index m has rk = k-6 bits.
+ *
+ * For rk > 5 (i.e., n > 2048), m = (t << (rk - c)) | (x << c) | u with
+ * t and u on c bits: block x is the set of tiles with middle part x.
+ * Tile m goes to tile rev'(m) = (rev(u) << (rk - c)) | (rev(x) << c) | rev(t)
+ * so block x is mapped to block rev(x).
+ */
+static void cobra_copy(const tile_ops_t *f, int32_t *b, const int32_t *a, uint32_t n, uint32_t k) {
+  uint32_t s, rk, c, m, x, t, u, xr;
+
+  s = n >> 3;
+  rk = k - 6;
+  if (rk <= 5) {
+    for (m=0; m<(n >> 6); m++) {
+      copy_tile(f, b, a, s, m, bitrev(m, rk));
+    }
+  } else {
+    c = BITREV_BLOCK_BITS;
+    for (x=0; x<(((uint32_t) 1) << (rk - 2 * c)); x++) {
+      xr = bitrev(x, rk - 2 * c) << c;
+      for (t=0; t<(((uint32_t) 1) << c); t++) {
+        for (u=0; u<(((uint32_t) 1) << c); u++) {
+          m = (t << (rk - c)) | (x << c) | u;
+          copy_tile(f, b, a, s, m, (bitrev(u, c) << (rk - c)) | xr | bitrev(t, c));
+        }
+      }
+    }
+  }
+}
+
+static void cobra_shuffle(const tile_ops_t *f, int32_t *a, uint32_t n, uint32_t k) {
+  uint32_t s, rk, c, m, r, x, t, u, xr;
+
+  s = n >> 3;
+  rk = k - 6;
+  if (rk <= 5) {
+    for (m=0; m<(n >> 6); m++) {
+      r = bitrev(m, rk);
+      if (m <= r) {
+        swap_tiles(f, a, s, m, r);
+      }
+    }
+  } else {
+    // blocks x and rev(x) are swapped when x < rev(x). If x = rev(x),
+    // the tiles of block x are swapped with each other.
+    c = BITREV_BLOCK_BITS;
+    for (x=0; x<(((uint32_t) 1) << (rk - 2 * c)); x++) {
+      xr = bitrev(x, rk - 2 * c);
+      if (x > xr) continue;
+      for (t=0; t<(((uint32_t) 1) << c); t++) {
+        for (u=0; u<(((uint32_t) 1) << c); u++) {
+          m = (t << (rk - c)) | (x << c) | u;
+          r = (bitrev(u, c) << (rk - c)) | (xr << c) | bitrev(t, c);
+          if (x < xr || m <= r) {
+            swap_tiles(f, a, s, m, r);
+          }
+        }
+      }
+    }
+  }
+}
+
+
+/*
+ * API
+ */
+void bitrev_shuffle_cobra(int32_t *a, uint32_t n) {
+  uint32_t k;
+
+  k = log2_size(n);
+  if (k < 6) {
+    small_shuffle(a, n, k);
+  } else {
+    cobra_shuffle(&c_ops, a, n, k);
+  }
+}
+
+void bitrev_copy_cobra(int32_t *b, const int32_t *a, uint32_t n) {
+  uint32_t k;
+
+  k = log2_size(n);
+  if (k < 6) {
+    small_copy(b, a, n, k);
+  } else {
+    cobra_copy(&c_ops, b, a, n, k);
+  }
+}
+
+void bitrev_shuffle_cobra_asm(int32_t *a, uint32_t n) {
+  uint32_t k;
+
+  k = log2_size(n);
+  if (k < 6) {
+    small_shuffle(a, n, k);
+  } else {
+    cobra_shuffle(&asm_ops, a, n, k);
+  }
+}
+
+void bitrev_copy_cobra_asm(int32_t *b, const int32_t *a, uint32_t n) {
+  uint32_t k;
+
+  k = log2_size(n);
+  if (k < 6) {
+    small_copy(b, a, n, k);
+  } else {
+    cobra_copy(&asm_ops, b, a, n, k);
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * BD: blocked bit-reverse permutation (COBRA-style).
+ *
+ * bitrev_shuffle (in ntt.c) and shuffle_with_table do one scalar swap
+ * per pair with random accesses. Here, the permutation is done by 8x8
+ * tiles: for n = 2^k with k >= 6, write index i as
+ *
+ *    i = h * n/8 + m * 8 + l   (h, l in 0 ... 7, m in 0 ... n/64 - 1)
+ *
+ * then bitrev(i) = rev(l) * n/8 + rev'(m) * 8 + rev(h), where rev and
+ * rev' reverse 3 and k-6 bits, respectively. So tile m (eight rows of
+ * 8 contiguous integers) goes to tile rev'(m), transposed and with the
+ * rows and columns permuted by rev. In the AVX2 versions, each tile is
+ * loaded into eight ymm registers and transposed in registers
+ * (bitrev_tile_asm).
+ *
+ * Order of the tiles:
+ * - n <= 2048: tiles m = 0 ... n/64-1 in sequence.
+ * - n > 2048: m is split into c top bits, a middle part, and c bottom bits
+ *   (c = BITREV_BLOCK_BITS). For each value of the middle part, the 2^2c
+ *   tiles that share it are processed together. The reads form 2^c runs
+ *   of 2^c consecutive tiles and so do the writes, and each cache line of
+ *   the source and destination is used by a single block.
+ *
+ * In-place versions swap tiles m and rev'(m) through a 256-byte buffer
+ * (or permute tile m in place if m = rev'(m)).
+ *
+ * For n < 64, all functions fall back to scalar swaps.
+ * The results are the same as bitrev_shuffle.
+ */
+
+#ifndef __NTT_BITREV_H
+#define __NTT_BITREV_H
+
+#include <stdint.h>
+
+/*
+ * Number of top and bottom bits of the tile index in a block (for n > 2048)
+ * - a block is 2^(2c) tiles of 256 bytes
+ */
+#ifndef BITREV_BLOCK_BITS
+#define BITREV_BLOCK_BITS 2
+#endif
+
+/*
+ * In-place: same as bitrev_shuffle(a, n)
+ * - n must be a power of two
+ */
+extern void bitrev_shuffle_cobra(int32_t *a, uint32_t n);
+
+/*
+ * Out-of-place: b[bitrev(i)] = a[i] for i=0 ... n-1
+ * - n must be a power of two
+ * - a and b must not overlap
+ */
+extern void bitrev_copy_cobra(int32_t *b, const int32_t *a, uint32_t n);
+
+/*
+ * AVX2 versions (using bitrev_tile_asm)
+ */
+extern void bitrev_shuffle_cobra_asm(int32_t *a, uint32_t n);
+extern void bitrev_copy_cobra_asm(int32_t *b, const int32_t *a, uint32_t n);
+
+#endif /* __NTT_BITREV_H */
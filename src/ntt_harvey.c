@@ -0,0 +1,199 @@
+/*
+ * BD: NTT variants with Shoup multiplication and Harvey's butterflies.
+ *
+ * All variants are specialized to Q=12289.
+ * These functions are reference implementations for ntt_harvey_asm.S:
+ * they perform the same 32-bit operations.
+ */
+
+#include <assert.h>
+
+#include "ntt_harvey.h"
+
+#define Q 12289
+
+// floor(2^32/Q): Shoup companion of 1
+#define SHOUP_ONE 349496
+
+
+/*
+ * Shoup multiplication by w where w_shoup = floor(w * 2^32/Q)
+ * - result in [0, 2Q-1]
+ */
+static inline uint32_t mul_shoup(uint32_t x, uint32_t w, uint32_t w_shoup) {
+  uint32_t t;
+
+  t = (uint32_t) (((uint64_t) x * w_shoup) >> 32);
+  return x * w - t * Q;
+}
+
+/*
+ * Reduction of a 32-bit integer: result in [0, 2Q-1]
+ */
+static inline uint32_t red_shoup(uint32_t z) {
+  return mul_shoup(z, 1, SHOUP_ONE);
+}
+
+/*
+ * x - b if x >= b
+ */
+static inline uint32_t csub(uint32_t x, uint32_t b) {
+  return x >= b ? x - b : x;
+}
+
+/*
+ * Butterflies
+ */
+static inline void ct_butterfly(uint32_t *x, uint32_t *y, uint32_t w, uint32_t w_shoup) {
+  uint32_t u, v;
+
+  assert(*x < 4 * Q && *y < 4 * Q);
+  u = csub(*x, 2 * Q);
+  v = mul_shoup(*y, w, w_shoup);
+  *x = u + v;
+  *y = u - v + 2 * Q;
+}
+
+static inline void gs_butterfly(uint32_t *x, uint32_t *y, uint32_t w, uint32_t w_shoup) {
+  uint32_t u, v;
+
+  assert(*x < 2 * Q && *y < 2 * Q);
+  u = *x;
+  v = *y;
+  *x = csub(u + v, 2 * Q);
+  *y = mul_shoup(u - v + 2 * Q, w, w_shoup);
+}
+
+
+/*
+ * NORMALIZATION
+ */
+void harvey_correct(uint32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = csub(csub(a[i], 2 * Q), Q);
+  }
+}
+
+
+/*
+ * PRODUCTS
+ */
+void harvey_mul_array32(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = mul_shoup(a[i], p[i], p[n + i]);
+  }
+}
+
+void harvey_mul_array(uint32_t *c, uint32_t n, const uint32_t *a, const uint32_t *b) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    assert(a[i] < 4 * Q && b[i] < 4 * Q);
+    c[i] = red_shoup(a[i] * b[i]);
+  }
+}
+
+void harvey_mul_finalize(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = csub(mul_shoup(a[i], p[i], p[n + i]), Q);
+  }
+}
+
+void harvey_scalar_mul_finalize(uint32_t *a, uint32_t n, uint32_t c, uint32_t c_shoup) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = csub(mul_shoup(a[i], c, c_shoup), Q);
+  }
+}
+
+
+/*
+ * NTT VARIANTS
+ */
+
+/*
+ * Cooley-Tukey, bit-reverse to standard order
+ */
+void ntt_harvey_ct_rev2std(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t j, s, t;
+
+  for (t=1; t<n; t <<= 1) {
+    for (j=0; j<t; j++) {
+      for (s=j; s<n; s += t + t) {
+	ct_butterfly(a + s, a + s + t, p[t + j], p[n + t + j]);
+      }
+    }
+  }
+}
+
+void mulntt_harvey_ct_rev2std(uint32_t *a, uint32_t n, const uint32_t *p) {
+  ntt_harvey_ct_rev2std(a, n, p);
+}
+
+/*
+ * Cooley-Tukey, standard to bit-reverse order
+ */
+void ntt_harvey_ct_std2rev(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t j, s, t, u, d;
+
+  d = n;
+  for (t=1; t<n; t <<= 1) {
+    d >>= 1;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      for (s=u; s<u+d; s++) {
+	ct_butterfly(a + s, a + s + d, p[t + j], p[n + t + j]);
+      }
+    }
+  }
+}
+
+void mulntt_harvey_ct_std2rev(uint32_t *a, uint32_t n, const uint32_t *p) {
+  ntt_harvey_ct_std2rev(a, n, p);
+}
+
+/*
+ * Gentleman-Sande, bit-reverse to standard order
+ */
+void ntt_harvey_gs_rev2std(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t j, s, t, u, d;
+
+  t = n;
+  for (d=1; d<n; d<<=1) {
+    t >>= 1;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      for (s=u; s<u+d; s++) {
+	gs_butterfly(a + s, a + s + d, p[t + j], p[n + t + j]);
+      }
+    }
+  }
+}
+
+void nttmul_harvey_gs_rev2std(uint32_t *a, uint32_t n, const uint32_t *p) {
+  ntt_harvey_gs_rev2std(a, n, p);
+}
+
+/*
+ * Gentleman-Sande, standard to bit-reverse order
+ */
+void ntt_harvey_gs_std2rev(uint32_t *a, uint32_t n, const uint32_t *p) {
+  uint32_t j, s, t;
+
+  for (t=n>>1; t>0; t >>= 1) {
+    for (j=0; j<t; j++) {
+      for (s=j; s<n; s += t + t) {
+	gs_butterfly(a + s, a + s + t, p[t + j], p[n + t + j]);
+      }
+    }
+  }
+}
+
+void nttmul_harvey_gs_std2rev(uint32_t *a, uint32_t n, const uint32_t *p) {
+  ntt_harvey_gs_std2rev(a, n, p);
+}
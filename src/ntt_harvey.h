@@ -0,0 +1,156 @@
+/*
+ * BD: NTT variants with Shoup multiplication and Harvey's lazy butterflies
+ *
+ * All variants are specialized to Q=12289.
+ * - omega denotes a primitive n-th root of unity (mod Q).
+ * - psi denotes a square root of omega (mod Q).
+ *
+ * Coefficients are stored as uint32_t and are kept in [0, 2Q-1] or
+ * [0, 4Q-1] rather than fully reduced. The C functions compute exactly
+ * the same values as the assembly code in ntt_harvey_asm.S so they can
+ * be used to test it.
+ *
+ * Two kinds of modular operations are used:
+ *
+ * 1) Shoup multiplication by a constant w in [0, Q-1], given
+ *    w' = floor(w * 2^32/Q):
+ *
+ *      mul_shoup(x, w, w') = x * w - Q * floor(x * w'/2^32)
+ *
+ *    This is computed modulo 2^32. The result is congruent to x * w
+ *    modulo Q and in [0, 2Q-1] for any 32-bit x. All the products
+ *    x * w in this file fit in 32 bits (x < 2^16 and w < 2^14).
+ *
+ * 2) Reduction of a 32-bit product z (for pointwise products):
+ *
+ *      red_shoup(z) = z - Q * floor(z * floor(2^32/Q)/2^32)
+ *
+ *    This is mul_shoup(z, 1, floor(2^32/Q)). It's in [0, 2Q-1].
+ *
+ * Butterflies (Harvey, 2014) use one conditional subtraction each:
+ * - Cooley-Tukey: inputs and outputs in [0, 4Q-1]
+ *     x := x - 2Q if x >= 2Q
+ *     y := mul_shoup(y, w, w')
+ *     (x, y) := (x + y, x - y + 2Q)
+ * - Gentleman-Sande: inputs and outputs in [0, 2Q-1]
+ *     (x, y) := (x + y, mul_shoup(x - y + 2Q, w, w'))
+ *     x := x - 2Q if x >= 2Q
+ *
+ * The tables are generated by make_harvey_tables. Each table of
+ * constants has 2n elements: p[i] for i=0 ... n-1 is the constant (in
+ * the range [0, Q-1]) and p[n + i] is its Shoup companion.
+ */
+
+#ifndef __NTT_HARVEY_H
+#define __NTT_HARVEY_H
+
+#include <stdint.h>
+
+
+/*****************
+ * NORMALIZATION *
+ ****************/
+
+/*
+ * Reduce all coefficients from [0, 4Q-1] to [0, Q-1]
+ */
+extern void harvey_correct(uint32_t *a, uint32_t n);
+
+
+/**************
+ * PRODUCTS   *
+ *************/
+
+/*
+ * Multiply a[i] by the constant p[i] (Shoup multiplication)
+ * - p must be a table of 2n constants (i.e., p[n+i] is the Shoup
+ *   companion of p[i]).
+ * - the result satisfies a'[i] == a[i] * p[i] modulo Q and
+ *   0 <= a'[i] <= 2Q-1
+ */
+extern void harvey_mul_array32(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * Pointwise product: c[i] = red_shoup(a[i] * b[i])
+ * - a[i] and b[i] must be in [0, 4Q-1] (so that a[i] * b[i] < 2^32)
+ * - the result satisfies c[i] == a[i] * b[i] modulo Q and
+ *   0 <= c[i] <= 2Q-1
+ */
+extern void harvey_mul_array(uint32_t *c, uint32_t n, const uint32_t *a, const uint32_t *b);
+
+/*
+ * Final step of the product functions: multiply by a constant and
+ * convert to [0, Q-1] in a single pass.
+ * - harvey_mul_finalize(a, n, p): a[i] = mul_shoup(a[i], p[i], p[n+i]) converted to [0, Q-1]
+ * - harvey_scalar_mul_finalize(a, n, c, c_shoup): a[i] = mul_shoup(a[i], c, c_shoup) converted to [0, Q-1]
+ */
+extern void harvey_mul_finalize(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void harvey_scalar_mul_finalize(uint32_t *a, uint32_t n, uint32_t c, uint32_t c_shoup);
+
+
+/****************
+ * NTT VARIANTS *
+ ***************/
+
+/*
+ * The eight variants are the same as in ntt.h. All products by
+ * twiddle factors are Shoup multiplications (including products by 1,
+ * so that the assembly code does not need special cases for j=0).
+ * The plain and combined versions (e.g., ntt_harvey_ct_rev2std and
+ * mulntt_harvey_ct_rev2std) are the same function applied to different
+ * tables.
+ *
+ * Bounds:
+ * - Cooley-Tukey: input and output in [0, 4Q-1]
+ * - Gentleman-Sande: input and output in [0, 2Q-1]
+ *
+ * In all cases, the result is NTT(a) (or NTT(a') for the combined
+ * versions), not fully reduced modulo Q.
+ */
+
+/*
+ * COOLEY-TUKEY: BIT-REVERSE TO STANDARD ORDER
+ * - input: a[0 ... n-1] in bit-reverse order
+ * - p: table of 2n constants such that
+ *   p[t + j] = omega^(n/2t)^j (for ntt_harvey_ct_rev2std)
+ *   p[t + j] = psi^(n/2t) * omega^(n/2t)^j (for mulntt_harvey_ct_rev2std)
+ *   for t=1, 2, 4, .., n/2 and j=0, ..., t-1.
+ * - output: NTT(a) or NTT(a') in standard order, where a'[i] = a[i] * psi^i.
+ */
+extern void ntt_harvey_ct_rev2std(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void mulntt_harvey_ct_rev2std(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - input: a[0 ... n-1] in standard order
+ * - p: table of 2n constants such that
+ *   p[t + j] = omega^(n/2t)^bitrev(j) (for ntt_harvey_ct_std2rev)
+ *   p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) (for mulntt_harvey_ct_std2rev)
+ * - output: NTT(a) or NTT(a') in bit-reverse order.
+ */
+extern void ntt_harvey_ct_std2rev(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void mulntt_harvey_ct_std2rev(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - input: a[0 ... n-1] in bit-reverse order
+ * - p: table of 2n constants such that
+ *   p[t + j] = omega^(n/2t)^bitrev(j) (for ntt_harvey_gs_rev2std)
+ *   p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) (for nttmul_harvey_gs_rev2std)
+ * - output: NTT(a) or a' in standard order, where a'[i] = NTT(a)[i] * psi^i.
+ */
+extern void ntt_harvey_gs_rev2std(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void nttmul_harvey_gs_rev2std(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * GENTLEMAN-SANDE: STANDARD TO BIT-REVERSE ORDER
+ * - input: a[0 ... n-1] in standard order
+ * - p: table of 2n constants such that
+ *   p[t + j] = omega^(n/2t)^j (for ntt_harvey_gs_std2rev)
+ *   p[t + j] = psi^(n/2t) * omega^(n/2t)^j (for nttmul_harvey_gs_std2rev)
+ * - output: NTT(a) or a' in bit-reverse order, where a'[i] = NTT(a)[i] * psi^i.
+ */
+extern void ntt_harvey_gs_std2rev(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void nttmul_harvey_gs_std2rev(uint32_t *a, uint32_t n, const uint32_t *p);
+
+#endif /* __NTT_HARVEY_H */
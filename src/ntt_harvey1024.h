@@ -0,0 +1,95 @@
+/*
+ * NTT for Q=12289, n=1024, with Shoup multiplication and Harvey butterflies.
+ */
+
+#ifndef __NTT_HARVEY1024_H
+#define __NTT_HARVEY1024_H
+
+#include "ntt_harvey1024_tables.h"
+#include "ntt_harvey.h"
+
+/*
+ * NTT Variants: as in ntt_harvey.h
+ * using tables from ntt_harvey1024_tables.h
+ *
+ * Input: a[i] for i=0 .. 1023 is expected to satisfy
+ *   0 <= a[i] < 4Q (Cooley-Tukey)
+ *   0 <= a[i] < 2Q (Gentleman-Sande)
+ *
+ * The result is stored in a, it is not reduced modulo Q (it is in the
+ * same range as the input).
+ */
+// forward NTTs
+static inline void ntt_harvey1024_ct_rev2std(uint32_t *a) {
+  ntt_harvey_ct_rev2std(a, 1024, ntt_harvey1024_omega_powers);
+}
+
+static inline void ntt_harvey1024_gs_rev2std(uint32_t *a) {
+  ntt_harvey_gs_rev2std(a, 1024, ntt_harvey1024_omega_powers_rev);
+}
+
+static inline void ntt_harvey1024_ct_std2rev(uint32_t *a) {
+  ntt_harvey_ct_std2rev(a, 1024, ntt_harvey1024_omega_powers_rev);
+}
+
+static inline void ntt_harvey1024_gs_std2rev(uint32_t *a) {
+  ntt_harvey_gs_std2rev(a, 1024, ntt_harvey1024_omega_powers);
+}
+
+// inverse
+static inline void intt_harvey1024_ct_rev2std(uint32_t *a) {
+  ntt_harvey_ct_rev2std(a, 1024, ntt_harvey1024_inv_omega_powers);
+}
+
+static inline void intt_harvey1024_gs_rev2std(uint32_t *a) {
+  ntt_harvey_gs_rev2std(a, 1024, ntt_harvey1024_inv_omega_powers_rev);
+}
+
+static inline void intt_harvey1024_ct_std2rev(uint32_t *a) {
+  ntt_harvey_ct_std2rev(a, 1024, ntt_harvey1024_inv_omega_powers_rev);
+}
+
+static inline void intt_harvey1024_gs_std2rev(uint32_t *a) {
+  ntt_harvey_gs_std2rev(a, 1024, ntt_harvey1024_inv_omega_powers);
+}
+
+// multiplication by powers of psi then forward ntt
+static inline void mulntt_harvey1024_ct_rev2std(uint32_t *a) {
+  mulntt_harvey_ct_rev2std(a, 1024, ntt_harvey1024_mixed_powers);
+}
+
+static inline void mulntt_harvey1024_ct_std2rev(uint32_t *a) {
+  mulntt_harvey_ct_std2rev(a, 1024, ntt_harvey1024_mixed_powers_rev);
+}
+
+// inverse ntt then multiplication by powers of psi^-1
+static inline void inttmul_harvey1024_gs_rev2std(uint32_t *a) {
+  nttmul_harvey_gs_rev2std(a, 1024, ntt_harvey1024_inv_mixed_powers_rev);
+}
+
+static inline void inttmul_harvey1024_gs_std2rev(uint32_t *a) {
+  nttmul_harvey_gs_std2rev(a, 1024, ntt_harvey1024_inv_mixed_powers);
+}
+
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Input: two arrays a and b in standard order
+ *
+ * Result: 
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1]
+ * The result is also in that range.
+ */
+extern void ntt_harvey1024_product1(uint32_t *c, uint32_t *a, uint32_t *b);
+extern void ntt_harvey1024_product2(uint32_t *c, uint32_t *a, uint32_t *b);
+extern void ntt_harvey1024_product3(uint32_t *c, uint32_t *a, uint32_t *b);
+extern void ntt_harvey1024_product4(uint32_t *c, uint32_t *a, uint32_t *b);
+extern void ntt_harvey1024_product5(uint32_t *c, uint32_t *a, uint32_t *b);
+
+#endif /* __NTT_HARVEY1024_H */
@@ -0,0 +1,2613 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#include "ntt_harvey1024_tables.h"
+
+const uint32_t ntt_harvey1024_psi_powers[2048] = {
+        1,  1014,  8209,  4273,  7094,  4251,  9364,  7988,
+     1381, 11677,  6171,  2293,  2481,  8778,  3656,  8195,
+     2366,  2769,  5874,  8360,  9919,  5464, 10446, 11415,
+    10861,  2110,  1254,  5789,  8193,   338, 10929,  9617,
+     6461,  1417, 11314,  6759,  8653, 12085,  2057,  8957,
+      827,  2926,  5315,  6828,  4885,   923,  1958,  6883,
+    11499, 10014,  3482,  3805, 11813,  8896,   418,  6026,
+     2731,  4209,  3643,  7302,  6250,  8665, 11964,  2253,
+    11077, 12221,  4782,  7082,  4372,  9168,  5868,  2276,
+     9821,  4404,  4749, 10487,  3833,  3338,  5257,  9461,
+     8034, 11158,  8332,  6105,  9103,  1403,  9407,  2434,
+    10276, 11081,  3988,   751, 11885,  8170,  1594,  6457,
+     9650,  3056,  1956,  4855,  7370,  1468,  1583,  7592,
+     5374,  5209,  9945,  7250,  2678, 11912, 10970,  2035,
+    11227,  4564,  7232,  9004, 11618,  7790,  9522,  8443,
+     8058, 10916,  8724, 10345,  7313,  5115,   652,  9811,
+     6553,  8682,  4624,  6627,  9984,  9929,  3315,  6513,
+     4989,  8067,  7753,  8871, 11935,  9714,  6507, 11194,
+     7969,  6693,  3174, 11007,  2686,  7735,  2908, 11641,
+     6534,  1705,  8410, 11463, 10377,  2894,  9734,  2209,
+     3328,  7406,  1105,  2171,  1663,  2689, 10777,  2957,
+    12171,  3238,  2169, 11924, 10849,  2231,  1058,  3669,
+     9088, 10771,  9162, 12073,  2178,  8761, 10996,  3821,
+     3459,  5061,  7341,  8929,  9302,  6565,  8561,  4820,
+     8747,  9089, 11785,  5082,  4057,  9272,   723,  8071,
+    11809,  4840,  4449,  1223, 11222, 11783,  3054, 12217,
+      726, 11113, 11858,  5370,  1153,  1687,  2447, 11169,
+     7197, 10381,  6950,  5703,  7012,  7126, 12121,  1694,
+     9545,  7187,   241, 10883, 12129,  9806,  1483,  4504,
+     7837,  8024,  1018, 12265,   242, 11897,  8049,  1790,
+     8577,  8755,  4912,  3723,  2399, 11653,  6413,  1901,
+    10530, 10568, 12233,  4661,  7278,  6492,  8273,  7724,
+     4043,  7365,  8687,  9694, 10805,  6771,  8532, 12281,
+     4177,  8062,  2683,  4693,  2859, 11111,  9830,  1241,
+     4896, 12077,  6234,  4730,  3510,  7619,  8174,  5650,
+     2426,  2164,  6854,  6671,  5444,  2455,  6992, 11424,
+     7698,  2257,  2844,  8190,  9585, 10880,  9087,  9757,
+      953,  7800,  7373,  4510,  1632,  8122,  2078,  5673,
+     1170,  6636,  6821, 10076,  4905,  8914,  6381,  6320,
+     5911,  9011,  6427,  3808,  2566,  8945,   948,  2730,
+     3195,  7723,  3029, 11445,  4414,  2600,  6554,  9696,
+      544, 10900,  4789,  1891,   390,  2212,  6370,  7455,
+     1635, 11164,  2127,  6203, 10163,  7100, 10335,  9462,
+     9048,  7078,   316,   910,  1065, 10767,  5106,  3815,
+     9664,  4963,  6281,  3232,  8374, 11826,  9789,  8823,
+      130,  8930, 10316,  2485,   545, 11914,   709,  6164,
+     7484,  6463,  3445,  3154,  3016, 10552,  8298,  8496,
+      355,  3589,  1702,  5368, 11414,  9847,  6190,  9270,
+    10984,  3942,  3263,  2941,  8236,  7073,  7535,  9021,
+     4278, 12164,  8429,  6151,  6591, 10347,  9341,  9244,
+     9198, 11710,  2766,  2832,  8311,  9389,  8760,  9982,
+     7901, 11475, 10256,  3090, 11854,  1314,  5184,  9173,
+    10938,  6454,  6608,  3007,  1426,  8151,  6906, 10243,
+     2197,  3449,  7210, 11274,  3066, 12096,   922,   944,
+    10963,  7226,  2920, 11520,  6730,  3825,  7515,  1030,
+    12144,   438,  1728,  7154,  3646, 10344,  6299,  9195,
+     8668,  2717,  2302, 11607,  8925,  5246, 10596,  3758,
+     1022,  4032,  8500,  4411, 11847,  6505,  9166,  3840,
+    10436,  1275,  2505,  8536,  4048,   146,   576,  6481,
+     9408,  3448,  6196,  3065, 11082,  5002,  8960,  3869,
+     2975,  5845,  3532,  5349,  4437,  1344, 11026,  9663,
+     3949, 10361, 11248,  1280,  7575,   425,   835, 11038,
+     9542,  4145,   192, 10353,  3136,  9342, 10258,  5118,
+     3694,  9860,  7083,  5386,  5088, 10141,  9370,  1783,
+     1479,   448, 11868,  3221,  9509,  7550, 11942,  4523,
+     2525,  4238,  8471, 11872,  7277,  5478,    64,  3451,
+     9238,  3114, 11612,  1706,  9424,  7383,  2361,  9988,
+     1696, 11573, 11316,  8787,   493,  8342,  3956,  5170,
+     7266,  6613,  8077,  5604,  4938,  5509,  6920, 12150,
+     6522,  1826,  8214,  9343, 11272,  1038,  7967,  4665,
+    11334,  2461,   787, 11522,  8758,  7954,  3772,  2929,
+     8357,  6877,  5415,  9916,  2422, 10397, 10885,  1868,
+     1646, 10029,  6403,  4050,  2174,  4705,  2738, 11307,
+    11950,   346,  6752,  1555,  3778,  9013,  8455,  7937,
+    11112, 10844,  9450,  9169,  6882, 10485,  1805, 11498,
+     9000,  7562, 11821,  4719,  4645,  3343, 10327,  1350,
+     4821,  9761,  5009,  3769, 12176,  8308,  6347,  8711,
+     9452, 11197, 11011,  6742,  3704,  7711,  3150, 11249,
+     2294,  3495,  4698,  7929,  3000,  6617, 12133,  1573,
+     9741,  9307, 11635,   450,  1607,  7350,  5766,  9449,
+     8155, 10962,  6212,  7000,  7247, 11925, 11863, 10440,
+     5331, 10763,  1050,  7846,  4861,  1165,  1566,  2643,
+     1000,  6302, 12237,  8717,  3247, 11295, 12071,   150,
+     4632,  2450,  1922,  7246, 10911,  3654,  6167, 10526,
+     6512,  3975, 12147,  3480,  1777,  7684,   350, 10808,
+     9813,  8581,   522,   881,  8526,  6197,  4079,  7002,
+     9275,  3765,  8120,    50,  1544,  4913,  4737, 10608,
+     3637,  1218,  6152,  7605,  6267,  1325,  4049,  1160,
+     8785, 10754,  4213,  7699,  3271, 11053,   174,  4390,
+     2842,  6162,  5456,  2334,  7188,  1255,  6803,  4113,
+     4611,  5734,  1579,  3536,  9405,   406,  6147,  2535,
+     2089,  4538,  5446,  4483, 11121,  7681,  9597, 10759,
+     9283, 11877,    58,  9656,  9140,  2054,  5915,   778,
+     2396,  8611,  6364,  1371,  1537, 10104,  8719,  5275,
+     3135,  8328,  2049,   845,  8889,  5609, 10008,  9687,
+     3707, 10753,  3199, 11779, 11287,  3959,  8212,  7315,
+     7143,  4781,  6068,  8452,  4895, 11063, 10314,   457,
+     8705,  3368, 11099,  9951,  1045,  2776,   683,  4378,
+     2963,  5966,  3336,  3229,  5332, 11777,  9259, 12119,
+    11955,  5416, 10930, 10631,  2381,  5690,  6119, 11010,
+     5728,  7784,  3438,  8345,  6998,  5219,  7796,  3317,
+     8541,  9118,  4324,  9652,  5084,  6085,  1112,  9269,
+     9970,  8022, 11279,  8136,  3985,  9998, 11836,  7640,
+     4890,  5993,  6136,  3670, 10102,  6691,  1146,  6878,
+     6429,  5836,  6695,  5202,  2847, 11232,  9634, 11410,
+     5791, 10221,  4467,  7186, 11516,  2674,  7856,  2712,
+     9521,  7429, 12138,  6643,  1630,  6094, 10238,  9416,
+    11560, 10423,   382,  6389,  2143, 10138,  6328,  1734,
+      949,  3744, 11404, 11996, 10123,  3407,  1489, 10588,
+     7935,  9084,  6715,   904,  7270, 10669,  4046, 10407,
+     8736, 10224,  7509,  7235, 12046, 11667,  8320,  6226,
+     8907, 11572, 10302,   578,  8509,  1248, 11994,  8095,
+    11567,  5232,  8689, 11722,  2645,  3028, 10431,  8494,
+    10616, 11749,  5445,  3469,  2912,  3408,  2503,  6508,
+    12208,  3889, 10966, 10268,  2969, 12050,  3434,  4289,
+    11029,   416,  3998, 10891,  7952,  1744, 11089, 12100,
+     4978,  9202,  3477, 11024,  7635, 12109,  1815,  9349,
+     5067,  1136,  9027, 10362, 12262,  9489, 11848,  7519,
+     5086,  8113,  5241,  5526, 11869,  4235,  5429, 11823,
+     6747,  8774, 11889, 12226,  9852, 11260,  1159,  7771,
+     2545, 12229,   605, 11309,  1689,  4475,  3009,  3454,
+    12280,  3163, 12142, 10699,  9888, 10897,  1747,  1842,
+    12149,  5508,  5906,  3941,  2249,  7021,  3963, 12268,
+     3284, 11946,  8579, 10783,  9041, 12269,  4298,  7866,
+      563,  5588,  1003,  9344, 12286,  9247, 12240, 11759,
+     3296, 11825,  8775,   614,  8146,  1836,  6065,  5410,
+     4846, 10533,  1321, 12282,  5191,  3982,  6956, 11787,
+     7110,  8186,  5529,  2622,  4284,  5959,  8527,  7211,
+    // Shoup companions
+        349496,  354389847, 2869019979, 1493400216, 2479330946, 1485711284, 3272688889, 2791781166,
+     482655206, 4081075198, 2156745315,  801396371,  867101787, 3067883710, 1277760634, 2864127023,
+     826909644,  967756891, 2052944738, 2921794010, 3466659663, 1909651013, 3650844525, 3989507013,
+    3795885735,  737438440,  438269101, 2023237503, 2863428029,  118129949, 3819651523, 3361111602,
+    2258099414,  495237094, 3954207827, 2362249487, 3024196599, 4223669930,  718915105, 3130443654,
+     289033929, 1022627903, 1857575976, 2386364773, 1707292313,  322585630,  684314912, 2405587102,
+    4018864751, 3499861868, 1216948175, 1329835671, 4128606775, 3109124344,  146089700, 2106068266,
+     954476009, 1471032415, 1273217174, 2552026299, 2184355570, 3028390562, 4181380806,  787416495,
+    3871377063, 4271201507, 1671294133, 2475136983, 1528000408, 3204187498, 2050847757,  795454924,
+    3432408968, 1539184308, 1659760736, 3665173898, 1339621583, 1166620622, 1837305157, 3306590087,
+    2807858023, 3899686312, 2912008097, 2133678520, 3181470200,  490344138, 3287717255,  850675433,
+    3591430054, 3872775051, 1393793602,  262472165, 4153770551, 2855389601,  557098044, 2256701426,
+    3372645000, 1068062499,  683615919, 1696807406, 2575792088,  513061436,  553253578, 2653380398,
+    1878196293, 1820529306, 3475746583, 2533852461,  935952674, 4163206968, 3833980896,  711226173,
+    3923801597, 1595103811, 2527561517, 3146870008, 4060454882, 2722580782, 3327909398, 2950802252,
+    2816245949, 3815108064, 3049010878, 3615545339, 2555870765, 1787676598,  227871973, 3428913999,
+    2290253128, 3034332009, 1616073624, 2316115898, 3489376961, 3470154632, 1158582194, 2276273252,
+    1743639990, 2819391421, 2709649397, 3100386921, 4171245396, 3395012801, 2274176271, 3912268200,
+    2785140726, 2339182692, 1109303132, 3846912281,  938748649, 2703358453, 1016336959, 4068493310,
+    2283612687,  595892199, 2939268855, 4006282863, 3626729240, 1011444003, 3402002738,  772038632,
+    1163125653, 2588373976,  386194064,  758757750,  581213330,  939797140, 3766527996, 1033462307,
+    4253726662, 1131670933,  758058757, 4167400930, 3791691772,  779727564,  369767710, 1282304093,
+    3176227747, 3764431015, 3202090517, 4219475967,  761204229, 3061942263, 3843067815, 1335427621,
+    1208909746, 1768803766, 2565656678, 3120657741, 3251020081, 2294447090, 2992042885, 1684575015,
+    3057049307, 3176577244, 4118820862, 1776143201, 1417908887, 3240535175,  252686252, 2820789408,
+    4127208788, 1691564953, 1554911668,  427434697, 3922054113, 4118121869, 1067363505, 4269803519,
+     253734743, 3883958951, 4144334135, 1876798305,  402969915,  589601255,  855218892, 3903530777,
+    2515329125, 3628127227, 2429003393, 1993180770, 2450672201, 2490514846, 4236251818,  592047733,
+    3335947826, 2511834157,   84228750, 3803574666, 4239047793, 3427166515,  518303889, 1574133997,
+    2739007136, 2804363055,  355787835, 4286579370,   84578247, 4157964514, 2813100477,  625599435,
+    2997634835, 3059845282, 1716728729, 1301176925,  838443041, 4072687273, 2241323563,  664393590,
+    3680202264, 3693483146, 4275395470, 1629005009, 2543638374, 2268933817, 2891387780, 2699513987,
+    1413015931, 2574044603, 3036079493, 3388022863, 3776313909, 2366443450, 2981907475, 4292171320,
+    1459848514, 2817643936,  937700159, 1640188910,  999211611, 3883259958, 3435554440,  433725641,
+    1711136779, 4220873955, 2178763619, 1653120295, 1226734088, 2662816814, 2856787588, 1974657435,
+     847879458,  756311272, 2395451692, 2331493761, 1902661075,  858014867, 2443682263, 3992652485,
+    2690427068,  788814483,  993969158, 2862379538, 3349927702, 3802526176, 3175878250, 3410041167,
+     333070537, 2726075751, 2576840578, 1576230979,  570378926, 2838613750,  726254539, 1982695863,
+     408911362, 2319261370, 2383918294, 3521530675, 1714282251, 3115415288, 2230139662, 2208820352,
+    2065876123, 3149316486, 2246216519, 1330884161,  896809022, 3126249691,  331323052,  954126512,
+    1116642567, 2699164490, 1058626083, 3999991919, 1542679277,  908691917, 2290602624, 3388721857,
+     190126308, 3809516114, 1673740611,  660898621,  136303787,  773087123, 2226295196, 2605499323,
+     571427417, 3901783293,  743379887, 2167929216, 3551936905, 2481427927, 3612050370, 3306939584,
+    3162247871, 2473738995,  110441017,  318042170,  372214189, 3763033027, 1784531126, 1333330639,
+    3377537956, 1734553071, 2195189973, 1129573952, 2926686966, 4133150235, 3421225067, 3083611071,
+      45434595, 3121007238, 3605409929,  868499774,  190475805, 4163905961,  247793295, 2154298837,
+    2615634733, 2258798407, 1204016790, 1102313194, 1054082623, 3687891195, 2900125203, 2969325587,
+     124071396, 1254344342,  594843708, 1876099311, 3989157516, 3441495887, 2163385756, 3239836181,
+    3838873852, 1377716745, 1140408355, 1027870357, 2878456395, 2471991511, 2633459075, 3152811455,
+    1495147700, 4251280184, 2945909295, 2149755377, 2303534009, 3616244333, 3264650460, 3230749262,
+    3214672405, 4092608595,  966708401,  989775195, 2904668662, 3281426311, 3061592766, 3488677967,
+    2761374937, 4010476826, 3584440116, 1079945393, 4142936148,  459238915, 1811791883, 3205934983,
+    3822796995, 2255652935, 2309475457, 1050937151,  498382566, 2848749160, 2413625530, 3579896656,
+     767844669, 1205414777, 2519872585, 3940227951, 1071557468, 4227514395,  322236133,  329925065,
+    3831534418, 2525464535, 1020530922, 4026204186, 2352114077, 1336825608, 2626469137,  359981797,
+    4244290246,  153079638,  603930627, 2500300759, 1274265665, 3615195842, 2201480917, 3213623914,
+    3029439052,  949583053,  804541843, 4056610416, 3119259753, 1833460691, 3703269059, 1313409317,
+     357185822, 1409171465, 2970723575, 1541630787, 4140489670, 2273477277, 3203488504, 1342068062,
+    3647349556,  445608536,  875489712, 2983305463, 1414763415,   51026546,  201310209, 2265089351,
+    3288066752, 1205065280, 2165482737, 1071207971, 3873124548, 1748183449, 3131492145, 1352203472,
+    1039753251, 2042809329, 1234423019, 1869458871, 1550717706,  469723821, 3853552722, 3377188459,
+    1380163223, 3621137289, 3931141032,  447356020, 2647438950,  148536178,  291829904, 3857746685,
+    3334899335, 1448664614,   67103403, 3618341314, 1096022250, 3264999957, 3585139109, 1788725089,
+    1291041516, 3446039347, 2475486480, 1882390256, 1778240182, 3544247973, 3274785870,  623152957,
+     516905902,  156574607, 4147829104, 1125729486, 3323365938, 2638701528, 4173691874, 1580774438,
+     882479650, 1481167824, 2960588165, 4149227092, 2543288877, 1914543970,   22367801, 1206113771,
+    3228652280, 1088333319, 4058357900,  596241696, 3293658702, 2580335547,  825162160, 3490774949,
+     592746727, 4044727521, 3954906820, 3071029183,  172301967, 2915503066, 1382609701, 1806898927,
+    2539444411, 2311222941, 2822886390, 1958580578, 1725815648, 1925378373, 2418518487, 4246387228,
+    2279418724,  638181323, 2870767464, 3265349454, 3939528957,  362777773, 2784441732, 1630402997,
+    3961197764,  860111849,  275054053, 4026903180, 3060893773, 2779898272, 1318302273, 1023676394,
+    2920745519, 2403490120, 1892525665, 3465611173,  846481470, 3633719177, 3804273660,  652860192,
+     575271882, 3505104321, 2237828594, 1415462409,  759806241, 1644382873,  956922488, 3951761348,
+    4176487849,  120925924, 2359803009,  543467665, 1320399254, 3150015480, 2954996215, 2773956825,
+    3883609455, 3789944288, 3302745621, 3204536995, 2405237605, 3664474904,  630841888, 4018515255,
+    3145472020, 2642895491, 4131402750, 1649275829, 1623413059, 1168368107, 3609254395,  471820803,
+    1684924512, 3411439155, 1750629928, 1317253782, 4255474147, 2903620172, 2218256768, 3044467419,
+    3303444615, 3913316690, 3848310269, 2356308040, 1294536485, 2694970528, 1100915207, 3931490529,
+     801745868, 1221491634, 1641936394, 2771160850, 1048490673, 2312620929, 4240445780,  549758609,
+    3404449217, 3252767566, 4066396329,  157273601,  561641504, 2568802150, 2015199074, 3302396124,
+    2850147147, 3831184921, 2171074688, 2446478238, 2532803970, 4167750427, 4146081620, 3648747544,
+    1863167927, 3761635040,  366971735, 2742152608, 1698904388,  407163878,  547312131,  923720283,
+     349496891, 2202529408, 4276793457, 3046564400, 1134816405, 3947567386, 4218776973,   52424533,
+    1618869600,  856267383,  671733024, 2532454473, 3813360579, 1277061640, 2155347328, 3678804276,
+    2275923755, 1389250142, 4245338737, 1216249181,  621055975, 2685534112,  122323911, 3777362400,
+    3429612993, 2999032823,  182437377,  307906761, 2979810494, 2165832234, 1425597819, 2447177232,
+    3241583665, 1315855795, 2837914756,   17474844,  539623200, 1717078226, 1655566773, 3707463021,
+    1271120193,  425687213, 2150104874, 2657923857, 2190297017,  463083380, 1415112912,  405416393,
+    3070330189, 3758489568, 1472430402, 2690776565, 1143204331, 3862989138,   60812459, 1534291352,
+     993270164, 2153599843, 1906855038,  815725744, 2512183653,  438618598, 2377627350, 1437480713,
+    1611530165, 2004015174,  551855591, 1235821007, 3287018261,  141895737, 2148357390,  885974619,
+     730099005, 1586016892, 1903360069, 1566794563, 3886754927, 2684485621, 3354121664, 3760237052,
+    3244379641, 4150974576,   20270819, 3374741981, 3194401585,  717866614, 2067274111,  271908581,
+     837394551, 3009517730, 2224198215,  479160237,  537176721, 3531316588, 3047263394, 1843596101,
+    1095672753, 2910610109,  716119130,  295324873, 3106677865, 1960328062, 3497764887, 3385576385,
+    1295584975, 3758140071, 1118040554, 4116723881, 3944771411, 1383658192, 2870068470, 2556569759,
+    2496456293, 1670944636, 2120747135, 2953947724, 1710787282, 3866484107, 3604710935,  159720079,
+    3042370437, 1177105529, 3879065995, 3477843564,  365224251,  970203369,  238706376, 1530097389,
+    1035559288, 2085098452, 1165921629, 1128525461, 1863517423, 4116024887, 3235991715, 4235552824,
+    4178235334, 1892875162, 3820001020, 3715501450,  832152097, 1988637310, 2138571477, 3847960772,
+    2001918192, 2720483801, 1201570311, 2916551557, 2445779244, 1824024275, 2724677763, 1159281188,
+    2985052947, 3186712653, 1511224557, 3373343993, 1776842194, 2126688582,  388640543, 3239486684,
+    3484484005, 2803664061, 3941975435, 2843506706, 1392745111, 3494269918, 4136645204, 2670156248,
+    1709039797, 2094534868, 2144512924, 1282653590, 3530617594, 2338483699,  400523437, 2403839617,
+    2246915513, 2039663857, 2339881686, 1818082828,  995017649, 3925549081, 3367053049, 3987759528,
+    2023936496, 3572207724, 1561202613, 2511484660, 4024806199,  934554687, 2745647577,  947835568,
+    3327559901, 2596412404, 4242193265, 2321707848,  569679932, 2129834054, 3578149172, 3290862727,
+    4040184062, 3642806097,  133507812, 2232935637,  748971837, 3543199483, 2211616327,  606027609,
+     331672549, 1308516360, 3985662547, 4192564706, 3537957029, 1190735908,  520400871, 3700473084,
+    2773257831, 3174829759, 2346871624,  315945189, 2540842399, 3728782332, 1414064421, 3637214146,
+    3053204841, 3573256215, 2624372156, 2528610007, 4210039551, 4077580229, 2907814134, 2175967644,
+    3112968809, 4044378025, 3600516973,  202009203, 2973869047,  436172120, 4191865713, 2829177334,
+    4042630540, 1828567734, 3036778487, 4096802558,  924419277, 1058276586, 3645602072, 2968626593,
+    3710258997, 4106238974, 1903010572, 1212404715, 1017734947, 1191085405,  874790718, 2274525767,
+    4266658047, 1359193409, 3832582908, 3588634078, 1037656269, 4211437539, 1200172324, 1498992166,
+    3854601213,  145390706, 1397288571, 3806370642, 2779199278,  609522578, 3875571026, 4228912383,
+    1739795524, 3216070392, 1215200690, 3852853728, 2668408764, 4232057855,  634336857, 3267446435,
+    1770900747,  397028468, 3154908436, 3621486786, 4285530879, 3316376000, 4140839166, 2627867124,
+    1777541188, 2835468278, 1831713206, 1931319820, 4148178601, 1480119334, 1897418622, 4132101744,
+    2358055524, 3066485723, 4155168539, 4272948991, 3443243372, 3935334994,  405066896, 2715940341,
+     889469588, 4273997482,  211445619, 3952460342,  590300249, 1563998588, 1051636145, 1207162262,
+    4291821823, 1105458666, 4243591252, 3739267238, 3455825260, 3808467623,  610571068,  643773273,
+    4246037731, 1925028876, 2064128639, 1377367248,  786018508, 2453817673, 1385056179, 4287627861,
+    1147747790, 4175089862, 2998333829, 3768624977, 3159801393, 4287977358, 1502137638, 2749142546,
+     196766749, 1952988628,  350545381, 3265698951, 4293918805, 3231797752, 4277841948, 4109733943,
+    1151941753, 4132800738, 3066835220,  214591091, 2847001675,  641676292, 2119698645, 1890778181,
+    1693661934, 3681250755,  461685393, 4292520817, 1814238362, 1391696620, 2431100375, 4119519856,
+    2484922896, 2860981551, 1932368311,  916380848, 1497244681, 2082651974, 2980159991, 2520222082,
+};
+
+const uint32_t ntt_harvey1024_scaled_inv_psi_powers[2048] = {
+    12277,   509,  4012, 10063,  2252,  6886,  4903, 12209,
+    11586,  6265,  9738, 10917,   847, 12205,  3563,  3506,
+     8996,  3475, 11335,  9743, 11729,  7368,  6988,  6721,
+     2685,  5929, 11701,   363, 12253,  1527, 12036,  5611,
+     6756,  8369,  2420, 12049, 10180,  6506,  4636,  8173,
+     2541, 12037, 10689, 10518,  2410, 10425,  9427,  4651,
+    10609,  9815,  8675,  7874,  8055,  5498, 10525,  1089,
+    12181,  4581, 11530,  4544,  7979,   529,  7260, 11569,
+     5962,  7229,  1619, 12230,  7623, 11533,  7489,  6976,
+     7230,  6697,  3703,  1664,  7249,  4867,  1447, 11333,
+    11876,  4205,  6997,  3267, 11965,  1454, 10012,  1343,
+    11648,  1587,  9491, 10129,  5597,  9398,  4857, 12112,
+    10580, 10021, 10178,  8639,  9401,  7802, 11109,  4992,
+     9458,  2312,  4341,  9421, 11050,   326,  8702,  9801,
+    11317,  4362,  5458,  4029, 10366,  4761,  3895,  5809,
+     4502,  3616,  2282, 11758,  7162,  5485,  5956,  1339,
+     3625, 11117,  8749,  2687,  3796,  6936,   734,  3685,
+     8572,   978,  1528,  4825,  9373,   797,  4085, 12087,
+     6520,  1994, 11685,  5138,  1217, 10848,  6846, 10696,
+     9197,  4166,  5579,  4017, 10875,  8773,  1669,  8061,
+    11388,  8519,  2202, 11055,  1138,  2934,  4584,  2186,
+     3541,  2391, 12255, 11683,  7271,  5982, 10477,  3125,
+     3651,  7966,  8249,  7510,  3013,   209,  4448, 12051,
+     8047,  1741,  5007, 11894,  9586,   979,  6606,  8587,
+     3414,  8802,  1463,  6558, 10623,  7173, 12187, 10471,
+     9524,  5657,  6853,  9375, 10953, 11609,   169, 10241,
+     9039,   627,  1055, 11575, 11852,  5223,  2732, 11104,
+     4180,  2937,  7529,  1183, 10242,  1828,  4389,  7385,
+     7291,  9230, 11983,  6835,  3994,  4682,  8270,  3547,
+     8281, 10249,   507,  6145,  2539,  1881,  3165, 10147,
+    10978,  3380,  8196,  8734,   251,  8811, 10298,  3549,
+     6148,  5484,   878,  9866,  9584,  3112, 11371,  8216,
+    11982,  1757,   232, 10641,   265,  6169,  1521,  6146,
+     7617,  5643,  9495,  5863,  8356, 10140,    10,  1624,
+      753,  1855,  6316, 10647,  6155,  4163,  2634,  5020,
+     4174,  9336,  9535,    70, 11368,  5271,   696,  7345,
+      795,  6218,  4563,  6149, 10562,  4640,  3907,  5300,
+      490,  5842,    30,  4872,  2259,  5565,  6659,  7363,
+     6176,   200,  7902,  2771,   233,  3430,  4027,   210,
+     9526,  3524,  2088,  9746,  2385,  6365,  1400,  6158,
+     7108,  1631, 11721,  3611,  1470,  5237,    90,  2327,
+     6777,  4406,  7688,  9800,  6239,   600, 11417,  8313,
+      699, 10290, 12081,   630,  4000, 10572,  6264,  4660,
+     7155,  6806,  4200,  6185,  9035,  4893, 10585, 10833,
+     4410,  3422,   270,  6981,  8042,   929, 10775,  4822,
+     6428,  1800,  9673,   361,  2097,  6292, 11665,  1890,
+    12000,  7138,  6503,  1691,  9176,  8129,   311,  6266,
+     2527,  2390,  7177,  7921,   941, 10266,   810,  8654,
+    11837,  2787,  7747,  2177,  6995,  5400,  4441,  1083,
+     6291,  6587, 10417,  5670, 11422,  9125,  7220,  5073,
+     2950, 12098,   933,  6509,  7581,  7170,  9242, 11474,
+     2823,  6220,  2430,  1384, 10933,  8361, 10952,  6531,
+     8696,  3911,  1034,  3249,  6584,  7472,  6673,  4721,
+     9688,  2797,  9371,  2930,  8850, 11716,  2799,  7238,
+    10454,  9221,  3148,  9844,  8469,  6371,  7290,  4152,
+     8221,   505,  8278,  7304,  1510, 11733,  3102,  9747,
+     7463, 10127,  7730,  1874,  4486,  8391,  3535,  8790,
+     1972, 10570,  8397,  9425,  6784,  3085,  9444,  4954,
+      829,  6824,  9581,   167,    85,  1515,   256,  9623,
+     4530, 10621,  9306,  4663, 10100,  5803, 10901,  5622,
+     1169,   595, 10605,  1792,  5916,  7132,   613,  3697,
+     8063,  9255,  3754,  2573,  2487,  8183,  4165,   501,
+      255,  4545,   768,  4291,  1301,  7285,  3340,  1700,
+     5722,  5120,  8125,  4577,  3507,  1785,  7237,  5376,
+     5459,  9107,  1839, 11091, 11900,  3187, 11262,  7719,
+     7461, 12260,   206,  1503,   765,  1346,  2304,   584,
+     3903,  9566, 10020,  5100,  4877,  3071, 12086,  1442,
+    10521,  5355,  9422,  3839,  4088,  2743,  5517,  8695,
+    11122,  9561,  9208, 10868, 10094, 12202,   618,  4509,
+     2295,  4038,  6912,  1752, 11709,  4120,  5482,  3011,
+     2342,  9213, 11680,  4326,  6985,  3776,  3688, 11517,
+    12264,  8229,  4262,  1507,  8788,  4105,  3046,  8026,
+     5704, 12028,  1854,  1238,  6885, 12114,  8447,  5256,
+    10549,    71,  4157,  9033,  7026,  3061, 10462,   689,
+     8666, 11328, 11064,  9973, 12214,   109,   497,  4521,
+     1786,    26,  9138, 11789,  4823, 11506,  5562,  3714,
+     8366, 11764,   763,  3479,  7069,   213,   182,  2521,
+     8789,  9183,  6808,  2067,  1420,  9406,  8614,  5341,
+    12064,   327,  1491,  1274,  5358,    78,  2836, 10789,
+     2180,  9940,  4397, 11142,   520, 10714,  2289, 10437,
+     8918,   639,   546,  7563,  1789,  2971,  8135,  6201,
+     4260,  3640,  1264,  3734, 11614,   981,  4473,  3822,
+     3785,   234,  8508,  7789,  6540,  5242,   902,  8848,
+     1560,  7564,  6867,  6733,  2176,  1917,  1638, 10400,
+     5367,  8913, 12116,  6314,   491, 10920,  3792, 11202,
+    10264,  2943,  1130, 11466, 11355,   702,   946, 11078,
+     7331,  3437,  2706,  1966,  4680, 10403,  8312,  7910,
+     6528,  5751,  4914,  6622,  3812,  2161, 11770,  6653,
+     1473,  8182, 11376,  9028,  6214,  8829,  3390,  9820,
+     9487,  2106,  2838,  8656,  9704, 10311,  8118,  5898,
+     1751,  6631,   358, 11441,  7295,  4964,  2453,  7577,
+    11436,  6483, 10732,  7670,  4419, 12257,  9550,  2506,
+     6353,  1909, 10170,  4882,  3883,  6318,  8514,  1390,
+     4534,  6355, 12065,  5405,  5253,  7604,  1074,  9745,
+     9596,  2603,  7359, 10442,  9730,  7160,  7618, 10721,
+      968, 12193,  4072,  7518,  6770,  5727,  5932,  2357,
+    11649,  6665,   964,  4170,  1313,  6776, 11617,  3926,
+     3470, 10523,  3222,  4657,  4210,  7809,  9788,  6748,
+     4612,  9191, 10565,  7585,  2904, 12001, 12216, 10265,
+     8021,  4892,  5507,  7071, 10369,  7706,  2892,   221,
+     3939,  8039, 10273, 11778, 10410,  6991,  9666,  1682,
+      341, 11138,  4786,  7955,  1547,  2995,  7117, 10466,
+     8712, 11425, 12070,  6217, 11774,  2387,  4232,  8924,
+     6529, 10829,  8676,   663, 11817, 11828,  6241, 10756,
+     6652,  8684,  4420,  5046,  1023,  8836,  2069, 11576,
+     4641,  8985,  9062,  6820,  1558,  9697, 11632,  6362,
+    10744,  7161,   407,  2194,  7298,  7909,  1450,  1989,
+    10873, 10906,  6434,  7690,  7667,  1474,   971,  2849,
+     3069,  1930,  6207, 10150,  1634,  2377,  2608,  8171,
+     4674,  4513, 10318,  6797,  7654,  9194,  1221,  6582,
+     9605, 11438,  4350,  5967,  8041,  8140,  7013, 10781,
+    10712,  4422,  2913,  8547,  9207,  5790,  6332,  5872,
+     4902,  7131,  7824, 12224,  1733,  1250,  6376,  8102,
+    10673,  3004,  3663,  7457,  4237,  9736,   761,  5612,
+    11834, 12131,  8750,  7765,  7558,   977,  8739,  1063,
+     3043,  5081,  6707,  5327,  2417,  9104, 11183, 12094,
+     5199,  3750,  6839, 12017,  7441,  9012, 10989, 10082,
+      422,  4630,  2283,  4547, 10924, 11815,  1672, 11006,
+    10385,  2931,  1639,  3189,  9129,  2954,  7832,  3692,
+     7251,  2734,  8971, 11704,  3308, 11250,  8228, 11473,
+    10034,  2458,  8389,  5668,  1266,  1601,  6849,  1352,
+     8194, 10867,  5016,  8440,  6577,  8793,  4917,  9567,
+     2809,  8862, 11207, 11076,  9464,  8202,  2335, 10534,
+     9924,  9172,   106,  9841,  5524,  7374,   589,  4715,
+     3798,  4803,  8258,  4056,     4,  8023,  2759,   742,
+     7442,  1801,  2462,  4123,  8427,  2008,  9043,  8650,
+     3814,    28,  7005,  7024,  5194,  2938,   318,  4945,
+     4283,  9833,  1767,  1856, 11394,  2120,   196, 12168,
+    // Shoup companions
+    4290773333,  177893917, 1402181527, 3516987216,  787066998, 2406635592, 1713583257, 4267007544,
+    4049270981, 2189598023, 3403400726, 3815457561,  296023866, 4265609557, 1245257423, 1225336100,
+    3144074033, 1214501696, 3961547261, 3405148210, 4099249036, 2575093094, 2442284275, 2348968605,
+     938399152, 2072167067, 4089463123,  126867371, 4282385407,  533681752, 4206544582, 1961027056,
+    2361200996, 2924939482,  845782476, 4211088042, 3557878352, 2273826774, 1620267587, 2856438091,
+     888071600, 4206894079, 3735772270, 3676008301,  842287507, 3643505090, 3294707193, 1625510040,
+    3707812518, 3430311987, 3031885531, 2751938521, 2815197458, 1921533907, 3678454779,  380602114,
+    4257221631, 1601045258, 4029699155, 1588113873, 2788635694,  184883855, 2537347430, 4043329534,
+    2083700465, 2526513026,  565835466, 4274346979, 2664214801, 4030747646, 2617382218, 2438090313,
+    2526862523, 2340580680, 1294186988,  581562826, 2533502964, 1701001369,  505722001, 3960848268,
+    4150625079, 1469634427, 2445429747, 1141806343, 4181730303,  508168479, 3499162874,  469374324,
+    4070939788,  554651566, 3317074994, 3540054011, 1956134100, 3284571783, 1697506400, 4233106346,
+    3697677108, 3502308346, 3557179358, 3019303643, 3285620274, 2726774745, 3882560964, 1744688480,
+    3305541597,  808036812, 1517166004, 3292610212, 3861940647,  113935986, 3041321947, 3425419030,
+    3955256317, 1524505439, 1907554032, 1408122974, 3622884774, 1663954699, 1361290391, 2030227441,
+    1573435004, 1263780758,  797551905, 4109384446, 2503096734, 1916990448, 2081603484,  467976337,
+    1266926230, 3885356939, 3057748301,  939098146, 1326690199, 2424110437,  256530718, 1287896044,
+    2995887351,  341807959,  534031249, 1686322500, 3275834361,  278549022, 1427694800, 4224368923,
+    2278719730,  696896801, 4083871173, 1795715027,  425337716, 3791342275, 2392655717, 3738218748,
+    3214322908, 1456004048, 1949843156, 1403929011, 3800778691, 3066136226,  583310311, 2817294439,
+    3980070597, 2977364016,  769592154, 3863688132,  397727462, 1025423878, 1602093749,  764000204,
+    1237568491,  835647066, 4283084401, 4083172179, 2541191895, 2090690403, 3661678929, 1092177785,
+    1276013149, 2784092235, 2882999855, 2624721652, 1053034133,   73044850, 1554562172, 4211787035,
+    2812401483,  608474087, 1749930934, 4156916023, 3350277199,  342157456, 2308776463, 3001129804,
+    1193182386, 3076271636,  511313951, 2292000612, 3712705475, 2506941200, 4259318613, 3659581947,
+    3328608391, 1977103913, 2395102195, 3276533355, 3828039449, 4057309409,   59064974, 3579197662,
+    3159102399,  219134550,  368719220, 4045426515, 4142237154, 1825422262,  954825506, 3880813479,
+    1460897005, 1026472369, 2631362093,  413454822, 3579547159,  638880317, 1533941855, 2581034541,
+    2548181833, 3225856305, 4188021247, 2388811251, 1395890583, 1636344444, 2890339290, 1239665473,
+    2894183756, 3581993637,  177194923, 2147658396,  887372606,  657403652, 1106157660, 3546344955,
+    3836776871, 1181299492, 2864476520, 3052505847,   87723719, 3079417108, 3599118985, 1240364466,
+    2148706887, 1916640951,  306858270, 3448136328, 3349578205, 1087634325, 3974129149, 2871466458,
+    4187671750,  614066037,   81083278, 3718996419,   92616676, 2156046321,  531584771, 2148007893,
+    2662117820, 1972210957, 3318472981, 2049100273, 2920396022, 3543898476,    3494968,  567582951,
+     263171159,  648316733, 2207422364, 3721093400, 2151153365, 1454955558,  920574811, 1754474393,
+    1458800023, 3262902976, 3332452857,   24464782, 3973080659, 1842198113,  243249836, 2567054665,
+     277850028, 2173171669, 1594754314, 2149056384, 3691386164, 1621665575, 1365484353, 1852333523,
+     171253476, 2041760838,   10484906, 1702748853,  789513477, 1944950199, 2327299798, 2573345609,
+    2158492800,   69899378, 2761724434,  968455885,   81432775, 1198774336, 1407423980,   73394347,
+    3329307385, 1231627044,  729749508, 3406196701,  833550085, 2224547712,  489295647, 2152201856,
+    2484223902,  570029429, 4096453061, 1262033274,  513760430, 1830315219,   31454720,  813279265,
+    2368540431, 1539883302, 2686932099, 3425069533, 2180511104,  209698134, 3990206006, 2905367656,
+     244298326, 3596323010, 4222271942,  220183041, 1397987564, 3694881133, 2189248526, 1628655513,
+    2500650256, 2378675841, 1467886943, 2161638272, 3157704412, 1710088288, 3699424593, 3786099822,
+    1541281290, 1195978361,   94364160, 2439837797, 2810653999,  324682611, 3765829002, 1685274009,
+    2246566016,  629094404, 3380683428,  126168377,  732894980, 2199034439, 4076881235,  660549124,
+    4193962694, 2494708809, 2272778283,  590999243, 3206983473, 2841060228,  108693533, 2189947520,
+     883178644,  835297569, 2508339188, 2768364875,  328876574, 3587935085,  283092481, 3024546096,
+    4136994701,  974047835, 2707552416,  760854732, 2444730753, 1887283212, 1552115693,  378505133,
+    2198684942, 2302136022, 3640709115, 1981647373, 3991953491, 3189159132, 2523367554, 1772997729,
+    1031015829, 4228213389,  326080599, 2274875264, 2649535932, 2505892709, 3230050268, 4010127329,
+     986629723, 2173870663,  849277445,  483703697, 3821049511, 2922143507, 3827689952, 2282564196,
+    3039224965, 1366882341,  361379785, 1135515399, 2301087531, 2611440771, 2332192755, 1649974823,
+    3385925881,  977542804, 3275135367, 1024025891, 3093047487, 4094705577,  978241798, 2529658498,
+    3653640500, 3222710833, 1100216213, 3440447397, 2959889171, 2226644693, 2547832336, 1451111092,
+    2873213942,  176495930, 2893135265, 2552725293,  527740305, 4100647024, 1084139356, 3406546198,
+    2608295299, 3539355017, 2701610969,  654957174, 1567843053, 2932628414, 1235471510, 3072077673,
+     689207869, 3694182140, 2934725395, 3294008199, 2370986909, 1078197909, 3300648640, 1731407599,
+     289732922, 2384966785, 3348529714,   58365980,   29707235,  529487790,   89471204, 3363208584,
+    1583220917, 3712006481, 3252418069, 1629704003, 3529918601, 2028130459, 3809865611, 1964871522,
+     408561865,  207950650, 3706414531,  626298429, 2067623608, 2492611828,  214241594, 1292090006,
+    2817993433, 3234593728, 1312011329,  899255501,  869198768, 2859933060, 1455654551,  175097942,
+      89121707, 1588463370,  268413612, 1499691160,  454695455, 2546084852, 1167319616,  594144715,
+    1999821211, 1789424082, 2839662241, 1599647271, 1225685597,  623851950, 2529309001, 1878895287,
+    1907903529, 3182868188,  642724782, 3876270020, 4159013005, 1113846592, 3936033988, 2697766503,
+    2607596305, 4284831886,   71996359,  525293827,  267365121,  470422815,  805240837,  204106184,
+    1364086366, 3343287261, 3501958849, 1782434145, 1704496338, 1073304952, 4224019427,  503974517,
+    3677056792, 1871555852, 3292959708, 1341718565, 1428743291,  958669972, 1928174348, 3038875469,
+    3887104423, 3341539776, 3218167374, 3798332213, 3527821619, 4264561066,  215989078, 1575881482,
+     802095365, 1411268446, 2415722511,  612318553, 4092259099, 1439927191, 1915941957, 1052335139,
+     818521719, 3219914858, 4082123689, 1511923551, 2441235785, 1319700261, 1288944534, 4025155695,
+    4286229873, 2876009917, 1489555750,  526691815, 3071378679, 1434684738, 1064567530, 2805062048,
+    1993530267, 4203748607,  647967236,  432677151, 2406286095, 4233805340, 2952200239, 1836955660,
+    3686842705,   24814279, 1452858576, 3157005418, 2455565157, 1069809983, 3656436475,  240803358,
+    3028740059, 3959100783, 3866833604, 3485532495, 4268755029,   38095161,  173699954, 1580075445,
+     624201447,    9086919, 3193702591, 4120218850, 1685623506, 4021311230, 1943901708, 1298031453,
+    2923890991, 4111481428,  266666127, 1215899684, 2470593523,   74442837,   63608434,  881081662,
+    3071728176, 3209429951, 2379374835,  722410074,  496285585, 3287367758, 3010566220, 1866662895,
+    4216330495,  114285483,  521099864,  445259039, 1872604343,   27260757,  991173183, 3770721959,
+     761903222, 3473999098, 1536737830, 3894094361,  181738383, 3744509692,  799998383, 3647699053,
+    3116813275,  223328513,  190825302, 2643244988,  625249938, 1038355263, 2843157209, 2167230222,
+    1488856756, 1272168683,  441764070, 1305021391, 4059056894,  342856450, 1563299594, 1335777118,
+    1322845733,   81782272, 2973519550, 2722231285, 2285709668, 1832062703,  315246195, 3092348493,
+     545215150, 2643594485, 2399995151, 2353162568,  760505235,  669985540,  572475907, 3634767668,
+    1875749815, 3115065791, 4234504333, 2206723371,  171602973, 3816506051, 1325292211, 3915064175,
+    3587236091, 1028569350,  394931487, 4007331354, 3968537199,  245346817,  330624059, 3871726560,
+    2562161709, 1201220815,  945738587,  687110888, 1635645450, 3635816159, 2905018159, 2764520409,
+    2281515705, 2009956621, 1717427723, 2314368413, 1332282149,  755262781, 4113578409, 2325202817,
+     514808920, 2859583563, 3975876634, 3155257933, 2171773681, 3085708052, 1184794461, 3432059471,
+    3315677006,  736040452,  991872177, 3025245090, 3391517832, 3603662445, 2837215762, 2061332664,
+     611969056, 2317513885,  125119887, 3998593932, 2549579821, 1734902567,  857315874, 2648137944,
+    3996846447, 2265788345, 3750800636, 2680641155, 1544426762, 4283783395, 3337695310,  875839209,
+    2220353749,  667189565, 3554383383, 1706243822, 1357096428, 2208121358, 2975616531,  485800678,
+    1584618904, 2221052743, 4216679992, 1889030696, 1835907169, 2657574360,  375359661, 3405847204,
+    3353772167,  909740407, 2571947622, 3649446537, 3400604751, 2502397741, 2662467317, 3746956170,
+     338312990, 4261415594, 1423151340, 2627517628, 2366093953, 2001568695, 2073215558,  823764172,
+    4071289285, 2329396779,  336915003, 1457402036,  458889418, 2368190934, 4060105385, 1372124794,
+    1212754212, 3677755786, 1126078983, 1627607022, 1471381911, 2729221223, 3420875571, 2358405021,
+    1611879662, 3212225927, 3692434655, 2650933919, 1014938972, 4194312191, 4269454022, 3587585588,
+    2803314564, 1709738791, 1924679379, 2471292517, 3623933264, 2693223043, 1010745009,   77238812,
+    1376668254, 2809605508, 3590381563, 4116374384, 3638262637, 2443332766, 3378236950,  587853771,
+     119178439, 3892696374, 1672692121, 2780247769,  540671690, 1046743189, 2487369374, 3657834463,
+    3044816916, 3993001982, 4218427476, 2172822172, 4114976397,  834249079, 1479070843, 3118910257,
+    2281865202, 3784701834, 3032235028,  231716438, 4130004763, 4133849229, 2181210098, 3759188561,
+    2324853320, 3035031003, 1544776259, 1763561313,  357535319, 3088154530,  723109067, 4045776012,
+    1622015072, 3140229567, 3167140828, 2383568798,  544516156, 3389071354, 4065347838, 2223499221,
+    3754994599, 2502747237,  142245234,  766796179, 2550628312, 2764170912,  506770492,  695149316,
+    3800079698, 3811613095, 2248662998, 2687631093, 2679592664,  515158417,  339361481,  995716643,
+    1072605959,  674529000, 2169327203, 3547393445,  571077920,  830754110,  911487892, 2855739098,
+    1633548469, 1577279470, 3606108923, 2375530369, 2675049205, 3213274417,  426735704, 2300388537,
+    3356917640, 3997545441, 1520311476, 2085447949, 2810304502, 2844904694, 2451021698, 3767925984,
+    3743810698, 1545475252, 1018084444, 2987149929, 3217817877, 2023587000, 2213014315, 2052245745,
+    1713233760, 2492262331, 2734463676, 4272249998,  605678112,  436871114, 2228392178, 2831623812,
+    3730180319, 1049888661, 1280207112, 2606198317, 1480818328, 3402701732,  265967134, 1961376553,
+    4135946210, 4239746787, 3058097798, 2713843360, 2641497503,  341458462, 3054253332,  371515195,
+    1063519039, 1775793704, 2344075649, 1861769939,  844733986, 3181819697, 3908423734, 4226815402,
+    1817034337, 1310613342, 2390209238, 4199904141, 2600606367, 3149665983, 3840621337, 3523627657,
+     147487688, 1618170606,  797901402, 1589162364, 3817904039, 4129305769,  584358802, 3846562784,
+    3629525215, 1024375388,  572825404, 1114545586, 3190557119, 1032413816, 2737259651, 1290342522,
+    2534201958,  955524500, 3135336610, 4090511614, 1156135716, 3931840026, 2875660420, 4009777832,
+    3506851806,  859063358, 2931929420, 1980948379,  442463064,  559544522, 2393704207,  472519796,
+    2863777526, 3797982716, 1753076406, 2949753761, 2298641053, 3073126164, 1718476214, 3343636758,
+     981736767, 3097241449, 3916811659, 3871027566, 3307638578, 2866573501,  816075240, 3681600251,
+    3468407148, 3205585486,   37046670, 3439398906, 1930620827, 2577190075,  205853668, 1647877842,
+    1327389192, 1678633568, 2886145327, 1417559390,    1397987, 2804013558,  964261922,  259326693,
+    2600955864,  629443901,  860461346, 1440975682, 2945210302,  701789757, 3160500387, 3023148108,
+    1332981143,    9785912, 2448225722, 2454866163, 1815286852, 1026821866,  111140011, 1728262127,
+    1496895185, 3436602931,  617561006,  648666230, 3982167578,  740933409,   68501390, 4252678172,
+};
+
+const uint32_t ntt_harvey1024_omega_powers[2048] = {
+        0,     1,     1,  1479,     1,  4043,  1479,  7143,
+        1,  6553,  4043, 10984,  1479,  8155,  7143, 11567,
+        1, 11077,  6553,  8747,  4043,  3195, 10984,  8668,
+     1479,  1646,  8155,  8785,  7143,  6429, 11567,  2545,
+        1,  6461, 11077,  9650,  6553,  3328,  8747,  9545,
+     4043,  7698,  3195,  9664, 10984, 10938,  8668,  2975,
+     1479,  7266,  1646,  4821,  8155,  6512,  8785,  9283,
+     7143,  5728,  6429,   949, 11567,  4978,  2545,   563,
+        1,  2366,  6461, 11499, 11077,  8034,  9650, 11227,
+     6553,  7969,  3328,  9088,  8747,   726,  9545,  8577,
+     4043,  4896,  7698,  1170,  3195,  1635,  9664,  7484,
+    10984,  9198, 10938, 10963,  8668, 10436,  2975,  9542,
+     1479,  9238,  7266, 11334,  1646, 11112,  4821,  2294,
+     8155,  1000,  6512,  9275,  8785,  4611,  9283,  3135,
+     7143,  2963,  5728,  9970,  6429,  9521,   949,  8736,
+    11567, 12208,  4978,  5086,  2545, 12149,   563,  4846,
+        1,  1381,  2366, 10861,  6461,   827, 11499,  2731,
+    11077,  9821,  8034, 10276,  9650,  5374, 11227,  8058,
+     6553,  4989,  7969,  6534,  3328, 12171,  9088,  3459,
+     8747, 11809,   726,  7197,  9545,  7837,  8577, 10530,
+     4043,  4177,  4896,  2426,  7698,   953,  1170,  5911,
+     3195,   544,  1635,  9048,  9664,   130,  7484,   355,
+    10984,  4278,  9198,  7901, 10938,  2197, 10963, 12144,
+     8668,  1022, 10436,  9408,  2975,  3949,  9542,  3694,
+     1479,  2525,  9238,  1696,  7266,  6522, 11334,  8357,
+     1646, 11950, 11112,  9000,  4821,  9452,  2294,  9741,
+     8155,  5331,  1000,  4632,  6512,  9813,  9275,  3637,
+     8785,  2842,  4611,  2089,  9283,  2396,  3135,  3707,
+     7143,  8705,  2963, 11955,  5728,  8541,  9970,  4890,
+     6429,  5791,  9521, 11560,   949,  7935,  8736,  8907,
+    11567, 10616, 12208, 11029,  4978,  5067,  5086,  6747,
+     2545, 12280, 12149,  3284,   563,  3296,  4846,  7110,
+        1,  7094,  1381,  2481,  2366,  9919, 10861,  8193,
+     6461,  8653,   827,  4885, 11499, 11813,  2731,  6250,
+    11077,  4372,  9821,  3833,  8034,  9103, 10276, 11885,
+     9650,  7370,  5374,  2678, 11227, 11618,  8058,  7313,
+     6553,  9984,  4989, 11935,  7969,  2686,  6534, 10377,
+     3328,  1663, 12171, 10849,  9088,  2178,  3459,  9302,
+     8747,  4057, 11809, 11222,   726,  1153,  7197,  7012,
+     9545, 12129,  7837,   242,  8577,  2399, 10530,  7278,
+     4043, 10805,  4177,  2859,  4896,  3510,  2426,  5444,
+     7698,  9585,   953,  1632,  1170,  4905,  5911,  2566,
+     3195,  4414,   544,   390,  1635, 10163,  9048,  1065,
+     9664,  8374,   130,   545,  7484,  3016,   355, 11414,
+    10984,  8236,  4278,  6591,  9198,  8311,  7901, 11854,
+    10938,  1426,  2197,  3066, 10963,  6730, 12144,  3646,
+     8668,  8925,  1022, 11847, 10436,  4048,  9408, 11082,
+     2975,  4437,  3949,  7575,  9542,  3136,  3694,  5088,
+     1479,  9509,  2525,  7277,  9238,  9424,  1696,   493,
+     7266,  4938,  6522, 11272, 11334,  8758,  8357,  2422,
+     1646,  2174, 11950,  3778, 11112,  6882,  9000,  4645,
+     4821, 12176,  9452,  3704,  2294,  3000,  9741,  1607,
+     8155,  7247,  5331,  4861,  1000,  3247,  4632, 10911,
+     6512,  1777,  9813,  8526,  9275,  1544,  3637,  6267,
+     8785,  3271,  2842,  7188,  4611,  9405,  2089, 11121,
+     9283,  9140,  2396,  1537,  3135,  8889,  3707, 11287,
+     7143,  4895,  8705,  1045,  2963,  5332, 11955,  2381,
+     5728,  6998,  8541,  5084,  9970,  3985,  4890, 10102,
+     6429,  2847,  5791, 11516,  9521,  1630, 11560,  2143,
+      949, 10123,  7935,  7270,  8736, 12046,  8907,  8509,
+    11567,  2645, 10616,  2912, 12208,  2969, 11029,  7952,
+     4978,  7635,  5067, 12262,  5086, 11869,  6747,  9852,
+     2545,  1689, 12280,  9888, 12149,  2249,  3284,  9041,
+      563, 12286,  3296,  8146,  4846,  5191,  7110,  4284,
+        1,  8209,  7094,  9364,  1381,  6171,  2481,  3656,
+     2366,  5874,  9919, 10446, 10861,  1254,  8193, 10929,
+     6461, 11314,  8653,  2057,   827,  5315,  4885,  1958,
+    11499,  3482, 11813,   418,  2731,  3643,  6250, 11964,
+    11077,  4782,  4372,  5868,  9821,  4749,  3833,  5257,
+     8034,  8332,  9103,  9407, 10276,  3988, 11885,  1594,
+     9650,  1956,  7370,  1583,  5374,  9945,  2678, 10970,
+    11227,  7232, 11618,  9522,  8058,  8724,  7313,   652,
+     6553,  4624,  9984,  3315,  4989,  7753, 11935,  6507,
+     7969,  3174,  2686,  2908,  6534,  8410, 10377,  9734,
+     3328,  1105,  1663, 10777, 12171,  2169, 10849,  1058,
+     9088,  9162,  2178, 10996,  3459,  7341,  9302,  8561,
+     8747, 11785,  4057,   723, 11809,  4449, 11222,  3054,
+      726, 11858,  1153,  2447,  7197,  6950,  7012, 12121,
+     9545,   241, 12129,  1483,  7837,  1018,   242,  8049,
+     8577,  4912,  2399,  6413, 10530, 12233,  7278,  8273,
+     4043,  8687, 10805,  8532,  4177,  2683,  2859,  9830,
+     4896,  6234,  3510,  8174,  2426,  6854,  5444,  6992,
+     7698,  2844,  9585,  9087,   953,  7373,  1632,  2078,
+     1170,  6821,  4905,  6381,  5911,  6427,  2566,   948,
+     3195,  3029,  4414,  6554,   544,  4789,   390,  6370,
+     1635,  2127, 10163, 10335,  9048,   316,  1065,  5106,
+     9664,  6281,  8374,  9789,   130, 10316,   545,   709,
+     7484,  3445,  3016,  8298,   355,  1702, 11414,  6190,
+    10984,  3263,  8236,  7535,  4278,  8429,  6591,  9341,
+     9198,  2766,  8311,  8760,  7901, 10256, 11854,  5184,
+    10938,  6608,  1426,  6906,  2197,  7210,  3066,   922,
+    10963,  2920,  6730,  7515, 12144,  1728,  3646,  6299,
+     8668,  2302,  8925, 10596,  1022,  8500, 11847,  9166,
+    10436,  2505,  4048,   576,  9408,  6196, 11082,  8960,
+     2975,  3532,  4437, 11026,  3949, 11248,  7575,   835,
+     9542,   192,  3136, 10258,  3694,  7083,  5088,  9370,
+     1479, 11868,  9509, 11942,  2525,  8471,  7277,    64,
+     9238, 11612,  9424,  2361,  1696, 11316,   493,  3956,
+     7266,  8077,  4938,  6920,  6522,  8214, 11272,  7967,
+    11334,   787,  8758,  3772,  8357,  5415,  2422, 10885,
+     1646,  6403,  2174,  2738, 11950,  6752,  3778,  8455,
+    11112,  9450,  6882,  1805,  9000, 11821,  4645, 10327,
+     4821,  5009, 12176,  6347,  9452, 11011,  3704,  3150,
+     2294,  4698,  3000, 12133,  9741, 11635,  1607,  5766,
+     8155,  6212,  7247, 11863,  5331,  1050,  4861,  1566,
+     1000, 12237,  3247, 12071,  4632,  1922, 10911,  6167,
+     6512, 12147,  1777,   350,  9813,   522,  8526,  4079,
+     9275,  8120,  1544,  4737,  3637,  6152,  6267,  4049,
+     8785,  4213,  3271,   174,  2842,  5456,  7188,  6803,
+     4611,  1579,  9405,  6147,  2089,  5446, 11121,  9597,
+     9283,    58,  9140,  5915,  2396,  6364,  1537,  8719,
+     3135,  2049,  8889, 10008,  3707,  3199, 11287,  8212,
+     7143,  6068,  4895, 10314,  8705, 11099,  1045,   683,
+     2963,  3336,  5332,  9259, 11955, 10930,  2381,  6119,
+     5728,  3438,  6998,  7796,  8541,  4324,  5084,  1112,
+     9970, 11279,  3985, 11836,  4890,  6136, 10102,  1146,
+     6429,  6695,  2847,  9634,  5791,  4467, 11516,  7856,
+     9521, 12138,  1630, 10238, 11560,   382,  2143,  6328,
+      949, 11404, 10123,  1489,  7935,  6715,  7270,  4046,
+     8736,  7509, 12046,  8320,  8907, 10302,  8509, 11994,
+    11567,  8689,  2645, 10431, 10616,  5445,  2912,  2503,
+    12208, 10966,  2969,  3434, 11029,  3998,  7952, 11089,
+     4978,  3477,  7635,  1815,  5067,  9027, 12262, 11848,
+     5086,  5241, 11869,  5429,  6747, 11889,  9852,  1159,
+     2545,   605,  1689,  3009, 12280, 12142,  9888,  1747,
+    12149,  5906,  2249,  3963,  3284,  8579,  9041,  4298,
+      563,  1003, 12286, 12240,  3296,  8775,  8146,  6065,
+     4846,  1321,  5191,  6956,  7110,  5529,  4284,  8527,
+    // Shoup companions
+             0,     349496,     349496,  516905902,     349496, 1413015931,  516905902, 2496456293,
+        349496, 2290253128, 1413015931, 3838873852,  516905902, 2850147147, 2496456293, 4042630540,
+        349496, 3871377063, 2290253128, 3057049307, 1413015931, 1116642567, 3838873852, 3029439052,
+     516905902,  575271882, 2850147147, 3070330189, 2496456293, 2246915513, 4042630540,  889469588,
+        349496, 2258099414, 3871377063, 3372645000, 2290253128, 1163125653, 3057049307, 3335947826,
+    1413015931, 2690427068, 1116642567, 3377537956, 3838873852, 3822796995, 3029439052, 1039753251,
+     516905902, 2539444411,  575271882, 1684924512, 2850147147, 2275923755, 3070330189, 3244379641,
+    2496456293, 2001918192, 2246915513,  331672549, 4042630540, 1739795524,  889469588,  196766749,
+        349496,  826909644, 2258099414, 4018864751, 3871377063, 2807858023, 3372645000, 3923801597,
+    2290253128, 2785140726, 1163125653, 3176227747, 3057049307,  253734743, 3335947826, 2997634835,
+    1413015931, 1711136779, 2690427068,  408911362, 1116642567,  571427417, 3377537956, 2615634733,
+    3838873852, 3214672405, 3822796995, 3831534418, 3029439052, 3647349556, 1039753251, 3334899335,
+     516905902, 3228652280, 2539444411, 3961197764,  575271882, 3883609455, 1684924512,  801745868,
+    2850147147,  349496891, 2275923755, 3241583665, 3070330189, 1611530165, 3244379641, 1095672753,
+    2496456293, 1035559288, 2001918192, 3484484005, 2246915513, 3327559901,  331672549, 3053204841,
+    4042630540, 4266658047, 1739795524, 1777541188,  889469588, 4246037731,  196766749, 1693661934,
+        349496,  482655206,  826909644, 3795885735, 2258099414,  289033929, 4018864751,  954476009,
+    3871377063, 3432408968, 2807858023, 3591430054, 3372645000, 1878196293, 3923801597, 2816245949,
+    2290253128, 1743639990, 2785140726, 2283612687, 1163125653, 4253726662, 3176227747, 1208909746,
+    3057049307, 4127208788,  253734743, 2515329125, 3335947826, 2739007136, 2997634835, 3680202264,
+    1413015931, 1459848514, 1711136779,  847879458, 2690427068,  333070537,  408911362, 2065876123,
+    1116642567,  190126308,  571427417, 3162247871, 3377537956,   45434595, 2615634733,  124071396,
+    3838873852, 1495147700, 3214672405, 2761374937, 3822796995,  767844669, 3831534418, 4244290246,
+    3029439052,  357185822, 3647349556, 3288066752, 1039753251, 1380163223, 3334899335, 1291041516,
+     516905902,  882479650, 3228652280,  592746727, 2539444411, 2279418724, 3961197764, 2920745519,
+     575271882, 4176487849, 3883609455, 3145472020, 1684924512, 3303444615,  801745868, 3404449217,
+    2850147147, 1863167927,  349496891, 1618869600, 2275923755, 3429612993, 3241583665, 1271120193,
+    3070330189,  993270164, 1611530165,  730099005, 3244379641,  837394551, 1095672753, 1295584975,
+    2496456293, 3042370437, 1035559288, 4178235334, 2001918192, 2985052947, 3484484005, 1709039797,
+    2246915513, 2023936496, 3327559901, 4040184062,  331672549, 2773257831, 3053204841, 3112968809,
+    4042630540, 3710258997, 4266658047, 3854601213, 1739795524, 1770900747, 1777541188, 2358055524,
+     889469588, 4291821823, 4246037731, 1147747790,  196766749, 1151941753, 1693661934, 2484922896,
+        349496, 2479330946,  482655206,  867101787,  826909644, 3466659663, 3795885735, 2863428029,
+    2258099414, 3024196599,  289033929, 1707292313, 4018864751, 4128606775,  954476009, 2184355570,
+    3871377063, 1528000408, 3432408968, 1339621583, 2807858023, 3181470200, 3591430054, 4153770551,
+    3372645000, 2575792088, 1878196293,  935952674, 3923801597, 4060454882, 2816245949, 2555870765,
+    2290253128, 3489376961, 1743639990, 4171245396, 2785140726,  938748649, 2283612687, 3626729240,
+    1163125653,  581213330, 4253726662, 3791691772, 3176227747,  761204229, 1208909746, 3251020081,
+    3057049307, 1417908887, 4127208788, 3922054113,  253734743,  402969915, 2515329125, 2450672201,
+    3335947826, 4239047793, 2739007136,   84578247, 2997634835,  838443041, 3680202264, 2543638374,
+    1413015931, 3776313909, 1459848514,  999211611, 1711136779, 1226734088,  847879458, 1902661075,
+    2690427068, 3349927702,  333070537,  570378926,  408911362, 1714282251, 2065876123,  896809022,
+    1116642567, 1542679277,  190126308,  136303787,  571427417, 3551936905, 3162247871,  372214189,
+    3377537956, 2926686966,   45434595,  190475805, 2615634733, 1054082623,  124071396, 3989157516,
+    3838873852, 2878456395, 1495147700, 2303534009, 3214672405, 2904668662, 2761374937, 4142936148,
+    3822796995,  498382566,  767844669, 1071557468, 3831534418, 2352114077, 4244290246, 1274265665,
+    3029439052, 3119259753,  357185822, 4140489670, 3647349556, 1414763415, 3288066752, 3873124548,
+    1039753251, 1550717706, 1380163223, 2647438950, 3334899335, 1096022250, 1291041516, 1778240182,
+     516905902, 3323365938,  882479650, 2543288877, 3228652280, 3293658702,  592746727,  172301967,
+    2539444411, 1725815648, 2279418724, 3939528957, 3961197764, 3060893773, 2920745519,  846481470,
+     575271882,  759806241, 4176487849, 1320399254, 3883609455, 2405237605, 3145472020, 1623413059,
+    1684924512, 4255474147, 3303444615, 1294536485,  801745868, 1048490673, 3404449217,  561641504,
+    2850147147, 2532803970, 1863167927, 1698904388,  349496891, 1134816405, 1618869600, 3813360579,
+    2275923755,  621055975, 3429612993, 2979810494, 3241583665,  539623200, 1271120193, 2190297017,
+    3070330189, 1143204331,  993270164, 2512183653, 1611530165, 3287018261,  730099005, 3886754927,
+    3244379641, 3194401585,  837394551,  537176721, 1095672753, 3106677865, 1295584975, 3944771411,
+    2496456293, 1710787282, 3042370437,  365224251, 1035559288, 1863517423, 4178235334,  832152097,
+    2001918192, 2445779244, 2985052947, 1776842194, 3484484005, 1392745111, 1709039797, 3530617594,
+    2246915513,  995017649, 2023936496, 4024806199, 3327559901,  569679932, 4040184062,  748971837,
+     331672549, 3537957029, 2773257831, 2540842399, 3053204841, 4210039551, 3112968809, 2973869047,
+    4042630540,  924419277, 3710258997, 1017734947, 4266658047, 1037656269, 3854601213, 2779199278,
+    1739795524, 2668408764, 1770900747, 4285530879, 1777541188, 4148178601, 2358055524, 3443243372,
+     889469588,  590300249, 4291821823, 3455825260, 4246037731,  786018508, 1147747790, 3159801393,
+     196766749, 4293918805, 1151941753, 2847001675, 1693661934, 1814238362, 2484922896, 1497244681,
+        349496, 2869019979, 2479330946, 3272688889,  482655206, 2156745315,  867101787, 1277760634,
+     826909644, 2052944738, 3466659663, 3650844525, 3795885735,  438269101, 2863428029, 3819651523,
+    2258099414, 3954207827, 3024196599,  718915105,  289033929, 1857575976, 1707292313,  684314912,
+    4018864751, 1216948175, 4128606775,  146089700,  954476009, 1273217174, 2184355570, 4181380806,
+    3871377063, 1671294133, 1528000408, 2050847757, 3432408968, 1659760736, 1339621583, 1837305157,
+    2807858023, 2912008097, 3181470200, 3287717255, 3591430054, 1393793602, 4153770551,  557098044,
+    3372645000,  683615919, 2575792088,  553253578, 1878196293, 3475746583,  935952674, 3833980896,
+    3923801597, 2527561517, 4060454882, 3327909398, 2816245949, 3049010878, 2555870765,  227871973,
+    2290253128, 1616073624, 3489376961, 1158582194, 1743639990, 2709649397, 4171245396, 2274176271,
+    2785140726, 1109303132,  938748649, 1016336959, 2283612687, 2939268855, 3626729240, 3402002738,
+    1163125653,  386194064,  581213330, 3766527996, 4253726662,  758058757, 3791691772,  369767710,
+    3176227747, 3202090517,  761204229, 3843067815, 1208909746, 2565656678, 3251020081, 2992042885,
+    3057049307, 4118820862, 1417908887,  252686252, 4127208788, 1554911668, 3922054113, 1067363505,
+     253734743, 4144334135,  402969915,  855218892, 2515329125, 2429003393, 2450672201, 4236251818,
+    3335947826,   84228750, 4239047793,  518303889, 2739007136,  355787835,   84578247, 2813100477,
+    2997634835, 1716728729,  838443041, 2241323563, 3680202264, 4275395470, 2543638374, 2891387780,
+    1413015931, 3036079493, 3776313909, 2981907475, 1459848514,  937700159,  999211611, 3435554440,
+    1711136779, 2178763619, 1226734088, 2856787588,  847879458, 2395451692, 1902661075, 2443682263,
+    2690427068,  993969158, 3349927702, 3175878250,  333070537, 2576840578,  570378926,  726254539,
+     408911362, 2383918294, 1714282251, 2230139662, 2065876123, 2246216519,  896809022,  331323052,
+    1116642567, 1058626083, 1542679277, 2290602624,  190126308, 1673740611,  136303787, 2226295196,
+     571427417,  743379887, 3551936905, 3612050370, 3162247871,  110441017,  372214189, 1784531126,
+    3377537956, 2195189973, 2926686966, 3421225067,   45434595, 3605409929,  190475805,  247793295,
+    2615634733, 1204016790, 1054082623, 2900125203,  124071396,  594843708, 3989157516, 2163385756,
+    3838873852, 1140408355, 2878456395, 2633459075, 1495147700, 2945909295, 2303534009, 3264650460,
+    3214672405,  966708401, 2904668662, 3061592766, 2761374937, 3584440116, 4142936148, 1811791883,
+    3822796995, 2309475457,  498382566, 2413625530,  767844669, 2519872585, 1071557468,  322236133,
+    3831534418, 1020530922, 2352114077, 2626469137, 4244290246,  603930627, 1274265665, 2201480917,
+    3029439052,  804541843, 3119259753, 3703269059,  357185822, 2970723575, 4140489670, 3203488504,
+    3647349556,  875489712, 1414763415,  201310209, 3288066752, 2165482737, 3873124548, 3131492145,
+    1039753251, 1234423019, 1550717706, 3853552722, 1380163223, 3931141032, 2647438950,  291829904,
+    3334899335,   67103403, 1096022250, 3585139109, 1291041516, 2475486480, 1778240182, 3274785870,
+     516905902, 4147829104, 3323365938, 4173691874,  882479650, 2960588165, 2543288877,   22367801,
+    3228652280, 4058357900, 3293658702,  825162160,  592746727, 3954906820,  172301967, 1382609701,
+    2539444411, 2822886390, 1725815648, 2418518487, 2279418724, 2870767464, 3939528957, 2784441732,
+    3961197764,  275054053, 3060893773, 1318302273, 2920745519, 1892525665,  846481470, 3804273660,
+     575271882, 2237828594,  759806241,  956922488, 4176487849, 2359803009, 1320399254, 2954996215,
+    3883609455, 3302745621, 2405237605,  630841888, 3145472020, 4131402750, 1623413059, 3609254395,
+    1684924512, 1750629928, 4255474147, 2218256768, 3303444615, 3848310269, 1294536485, 1100915207,
+     801745868, 1641936394, 1048490673, 4240445780, 3404449217, 4066396329,  561641504, 2015199074,
+    2850147147, 2171074688, 2532803970, 4146081620, 1863167927,  366971735, 1698904388,  547312131,
+     349496891, 4276793457, 1134816405, 4218776973, 1618869600,  671733024, 3813360579, 2155347328,
+    2275923755, 4245338737,  621055975,  122323911, 3429612993,  182437377, 2979810494, 1425597819,
+    3241583665, 2837914756,  539623200, 1655566773, 1271120193, 2150104874, 2190297017, 1415112912,
+    3070330189, 1472430402, 1143204331,   60812459,  993270164, 1906855038, 2512183653, 2377627350,
+    1611530165,  551855591, 3287018261, 2148357390,  730099005, 1903360069, 3886754927, 3354121664,
+    3244379641,   20270819, 3194401585, 2067274111,  837394551, 2224198215,  537176721, 3047263394,
+    1095672753,  716119130, 3106677865, 3497764887, 1295584975, 1118040554, 3944771411, 2870068470,
+    2496456293, 2120747135, 1710787282, 3604710935, 3042370437, 3879065995,  365224251,  238706376,
+    1035559288, 1165921629, 1863517423, 3235991715, 4178235334, 3820001020,  832152097, 2138571477,
+    2001918192, 1201570311, 2445779244, 2724677763, 2985052947, 1511224557, 1776842194,  388640543,
+    3484484005, 3941975435, 1392745111, 4136645204, 1709039797, 2144512924, 3530617594,  400523437,
+    2246915513, 2339881686,  995017649, 3367053049, 2023936496, 1561202613, 4024806199, 2745647577,
+    3327559901, 4242193265,  569679932, 3578149172, 4040184062,  133507812,  748971837, 2211616327,
+     331672549, 3985662547, 3537957029,  520400871, 2773257831, 2346871624, 2540842399, 1414064421,
+    3053204841, 2624372156, 4210039551, 2907814134, 3112968809, 3600516973, 2973869047, 4191865713,
+    4042630540, 3036778487,  924419277, 3645602072, 3710258997, 1903010572, 1017734947,  874790718,
+    4266658047, 3832582908, 1037656269, 1200172324, 3854601213, 1397288571, 2779199278, 3875571026,
+    1739795524, 1215200690, 2668408764,  634336857, 1770900747, 3154908436, 4285530879, 4140839166,
+    1777541188, 1831713206, 4148178601, 1897418622, 2358055524, 4155168539, 3443243372,  405066896,
+     889469588,  211445619,  590300249, 1051636145, 4291821823, 4243591252, 3455825260,  610571068,
+    4246037731, 2064128639,  786018508, 1385056179, 1147747790, 2998333829, 3159801393, 1502137638,
+     196766749,  350545381, 4293918805, 4277841948, 1151941753, 3066835220, 2847001675, 2119698645,
+    1693661934,  461685393, 1814238362, 2431100375, 2484922896, 1932368311, 1497244681, 2980159991,
+};
+
+const uint32_t ntt_harvey1024_omega_powers_rev[2048] = {
+        0,     1,     1,  1479,     1,  1479,  4043,  7143,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+        1,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+     8209, 11868,  8687,  6068,  4624,  6212,  3263,  8689,
+     4782,  6403,  3029,  6695, 11785,  4213,  2302,   605,
+    11314,  8077,  2844,  3438,  1105, 12147,  6608,  3477,
+     1956,  5009,  6281, 11404,   241,    58,  3532,  1003,
+     5874, 11612,  6234,  3336,  3174, 12237,  2766, 10966,
+     8332,  9450,  2127, 12138, 11858,  1579,  2505,  5906,
+     3482,   787,  6821, 11279,  9162,  8120,  2920,  5241,
+     7232,  4698,  3445,  7509,  4912,  2049,   192,  1321,
+     6171,  8471,  2683, 11099,  7753,  1050,  8429,  5445,
+     4749,  6752,  4789,  4467,  4449,  5456,  8500, 12142,
+     5315,  8214,  7373,  4324,  2169,   522,  7210,  9027,
+     9945, 11011, 10316,  6715,  1018,  6364, 11248,  8775,
+     1254, 11316,  6854, 10930,  8410,  1922, 10256,  3998,
+     3988, 11821,   316,   382,  6950,  5446,  6196,  8579,
+     3643,  5415,  6427,  6136,  7341,  6152,  1728, 11889,
+     8724, 11635,  1702, 10302, 12233,  3199,  7083,  5529,
+     9364, 11942,  8532, 10314,  3315, 11863,  7535, 10431,
+     5868,  2738,  6554,  9634,   723,   174, 10596,  3009,
+     2057,  6920,  9087,  7796, 10777,   350,  6906,  1815,
+     1583,  6347,  9789,  1489,  1483,  5915, 11026, 12240,
+    10446,  2361,  8174,  9259,  2908, 12071,  8760,  3434,
+     9407,  1805, 10335, 10238,  2447,  6147,   576,  3963,
+      418,  3772,  6381, 11836, 10996,  4737,  7515,  5429,
+     9522, 12133,  8298,  8320,  6413, 10008, 10258,  6956,
+     3656,    64,  9830,   683,  6507,  1566,  9341,  2503,
+     5257,  8455,  6370,  7856,  3054,  6803,  9166,  1747,
+     1958,  7967,  2078,  1112,  1058,  4079,   922, 11848,
+    10970,  3150,   709,  4046,  8049,  8719,   835,  6065,
+    10929,  3956,  6992,  6119,  9734,  6167,  5184, 11089,
+     1594, 10327,  5106,  6328, 12121,  9597,  8960,  4298,
+    11964, 10885,   948,  1146,  8561,  4049,  6299,  1159,
+      652,  5766,  6190, 11994,  8273,  8212,  9370,  8527,
+    // Shoup companions
+             0,     349496,     349496,  516905902,     349496,  516905902, 1413015931, 2496456293,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+     826909644, 3228652280, 1711136779, 1035559288, 2785140726,  349496891, 3214672405, 4266658047,
+    2807858023, 3883609455,  571427417, 3327559901,  253734743, 1611530165, 3647349556, 4246037731,
+    4018864751, 3961197764,  408911362, 3484484005, 3176227747, 3241583665, 3831534418, 1777541188,
+    3923801597,  801745868, 2615634733, 3053204841, 2997634835, 1095672753, 3334899335, 1693661934,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+     826909644, 3228652280, 1711136779, 1035559288, 2785140726,  349496891, 3214672405, 4266658047,
+    2807858023, 3883609455,  571427417, 3327559901,  253734743, 1611530165, 3647349556, 4246037731,
+    4018864751, 3961197764,  408911362, 3484484005, 3176227747, 3241583665, 3831534418, 1777541188,
+    3923801597,  801745868, 2615634733, 3053204841, 2997634835, 1095672753, 3334899335, 1693661934,
+     482655206,  882479650, 1459848514, 3042370437, 1743639990, 1863167927, 1495147700, 3710258997,
+    3432408968, 4176487849,  190126308, 2023936496, 4127208788,  993270164,  357185822, 4291821823,
+     289033929, 2279418724,  333070537, 2985052947, 4253726662, 3429612993,  767844669, 1770900747,
+    1878196293, 3303444615,   45434595, 2773257831, 2739007136,  837394551, 1380163223, 1151941753,
+    3795885735,  592746727,  847879458, 4178235334, 2283612687, 1618869600, 2761374937, 3854601213,
+    3591430054, 3145472020, 3162247871, 4040184062, 2515329125,  730099005, 3288066752, 1147747790,
+     954476009, 2920745519, 2065876123, 1709039797, 1208909746, 1271120193, 4244290246, 2358055524,
+    2816245949, 3404449217,  124071396, 3112968809, 3680202264, 1295584975, 1291041516, 2484922896,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+     826909644, 3228652280, 1711136779, 1035559288, 2785140726,  349496891, 3214672405, 4266658047,
+    2807858023, 3883609455,  571427417, 3327559901,  253734743, 1611530165, 3647349556, 4246037731,
+    4018864751, 3961197764,  408911362, 3484484005, 3176227747, 3241583665, 3831534418, 1777541188,
+    3923801597,  801745868, 2615634733, 3053204841, 2997634835, 1095672753, 3334899335, 1693661934,
+     482655206,  882479650, 1459848514, 3042370437, 1743639990, 1863167927, 1495147700, 3710258997,
+    3432408968, 4176487849,  190126308, 2023936496, 4127208788,  993270164,  357185822, 4291821823,
+     289033929, 2279418724,  333070537, 2985052947, 4253726662, 3429612993,  767844669, 1770900747,
+    1878196293, 3303444615,   45434595, 2773257831, 2739007136,  837394551, 1380163223, 1151941753,
+    3795885735,  592746727,  847879458, 4178235334, 2283612687, 1618869600, 2761374937, 3854601213,
+    3591430054, 3145472020, 3162247871, 4040184062, 2515329125,  730099005, 3288066752, 1147747790,
+     954476009, 2920745519, 2065876123, 1709039797, 1208909746, 1271120193, 4244290246, 2358055524,
+    2816245949, 3404449217,  124071396, 3112968809, 3680202264, 1295584975, 1291041516, 2484922896,
+    2479330946, 3323365938, 3776313909, 1710787282, 3489376961, 2532803970, 2878456395,  924419277,
+    1528000408,  759806241, 1542679277,  995017649, 1417908887, 1143204331, 3119259753,  590300249,
+    3024196599, 1725815648, 3349927702, 2445779244,  581213330,  621055975,  498382566, 2668408764,
+    2575792088, 4255474147, 2926686966, 3537957029, 4239047793, 3194401585, 1550717706, 4293918805,
+    3466659663, 3293658702, 1226734088, 1863517423,  938748649, 1134816405, 2904668662, 1037656269,
+    3181470200, 2405237605, 3551936905,  569679932,  402969915, 3287018261, 1414763415,  786018508,
+    4128606775, 3060893773, 1714282251, 1392745111,  761204229,  539623200, 2352114077, 4148178601,
+    4060454882, 1048490673, 1054082623, 4210039551,  838443041, 3106677865, 1096022250, 1814238362,
+     867101787, 2543288877,  999211611,  365224251, 4171245396, 1698904388, 2303534009, 1017734947,
+    1339621583, 1320399254,  136303787, 4024806199, 3922054113, 2512183653, 4140489670, 3455825260,
+    1707292313, 3939528957,  570378926, 1776842194, 3791691772, 2979810494, 1071557468, 4285530879,
+     935952674, 1294536485,  190475805, 2540842399,   84578247,  537176721, 2647438950, 2847001675,
+    2863428029,  172301967, 1902661075,  832152097, 3626729240, 3813360579, 4142936148, 2779199278,
+    4153770551, 1623413059,  372214189,  748971837, 2450672201, 3886754927, 3873124548, 3159801393,
+    2184355570,  846481470,  896809022, 3530617594, 3251020081, 2190297017, 1274265665, 3443243372,
+    2555870765,  561641504, 3989157516, 2973869047, 2543638374, 3944771411, 1778240182, 1497244681,
+        349496,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+     826909644, 3228652280, 1711136779, 1035559288, 2785140726,  349496891, 3214672405, 4266658047,
+    2807858023, 3883609455,  571427417, 3327559901,  253734743, 1611530165, 3647349556, 4246037731,
+    4018864751, 3961197764,  408911362, 3484484005, 3176227747, 3241583665, 3831534418, 1777541188,
+    3923801597,  801745868, 2615634733, 3053204841, 2997634835, 1095672753, 3334899335, 1693661934,
+     482655206,  882479650, 1459848514, 3042370437, 1743639990, 1863167927, 1495147700, 3710258997,
+    3432408968, 4176487849,  190126308, 2023936496, 4127208788,  993270164,  357185822, 4291821823,
+     289033929, 2279418724,  333070537, 2985052947, 4253726662, 3429612993,  767844669, 1770900747,
+    1878196293, 3303444615,   45434595, 2773257831, 2739007136,  837394551, 1380163223, 1151941753,
+    3795885735,  592746727,  847879458, 4178235334, 2283612687, 1618869600, 2761374937, 3854601213,
+    3591430054, 3145472020, 3162247871, 4040184062, 2515329125,  730099005, 3288066752, 1147747790,
+     954476009, 2920745519, 2065876123, 1709039797, 1208909746, 1271120193, 4244290246, 2358055524,
+    2816245949, 3404449217,  124071396, 3112968809, 3680202264, 1295584975, 1291041516, 2484922896,
+    2479330946, 3323365938, 3776313909, 1710787282, 3489376961, 2532803970, 2878456395,  924419277,
+    1528000408,  759806241, 1542679277,  995017649, 1417908887, 1143204331, 3119259753,  590300249,
+    3024196599, 1725815648, 3349927702, 2445779244,  581213330,  621055975,  498382566, 2668408764,
+    2575792088, 4255474147, 2926686966, 3537957029, 4239047793, 3194401585, 1550717706, 4293918805,
+    3466659663, 3293658702, 1226734088, 1863517423,  938748649, 1134816405, 2904668662, 1037656269,
+    3181470200, 2405237605, 3551936905,  569679932,  402969915, 3287018261, 1414763415,  786018508,
+    4128606775, 3060893773, 1714282251, 1392745111,  761204229,  539623200, 2352114077, 4148178601,
+    4060454882, 1048490673, 1054082623, 4210039551,  838443041, 3106677865, 1096022250, 1814238362,
+     867101787, 2543288877,  999211611,  365224251, 4171245396, 1698904388, 2303534009, 1017734947,
+    1339621583, 1320399254,  136303787, 4024806199, 3922054113, 2512183653, 4140489670, 3455825260,
+    1707292313, 3939528957,  570378926, 1776842194, 3791691772, 2979810494, 1071557468, 4285530879,
+     935952674, 1294536485,  190475805, 2540842399,   84578247,  537176721, 2647438950, 2847001675,
+    2863428029,  172301967, 1902661075,  832152097, 3626729240, 3813360579, 4142936148, 2779199278,
+    4153770551, 1623413059,  372214189,  748971837, 2450672201, 3886754927, 3873124548, 3159801393,
+    2184355570,  846481470,  896809022, 3530617594, 3251020081, 2190297017, 1274265665, 3443243372,
+    2555870765,  561641504, 3989157516, 2973869047, 2543638374, 3944771411, 1778240182, 1497244681,
+    2869019979, 4147829104, 3036079493, 2120747135, 1616073624, 2171074688, 1140408355, 3036778487,
+    1671294133, 2237828594, 1058626083, 2339881686, 4118820862, 1472430402,  804541843,  211445619,
+    3954207827, 2822886390,  993969158, 1201570311,  386194064, 4245338737, 2309475457, 1215200690,
+     683615919, 1750629928, 2195189973, 3985662547,   84228750,   20270819, 1234423019,  350545381,
+    2052944738, 4058357900, 2178763619, 1165921629, 1109303132, 4276793457,  966708401, 3832582908,
+    2912008097, 3302745621,  743379887, 4242193265, 4144334135,  551855591,  875489712, 2064128639,
+    1216948175,  275054053, 2383918294, 3941975435, 3202090517, 2837914756, 1020530922, 1831713206,
+    2527561517, 1641936394, 1204016790, 2624372156, 1716728729,  716119130,   67103403,  461685393,
+    2156745315, 2960588165,  937700159, 3879065995, 2709649397,  366971735, 2945909295, 1903010572,
+    1659760736, 2359803009, 1673740611, 1561202613, 1554911668, 1906855038, 2970723575, 4243591252,
+    1857575976, 2870767464, 2576840578, 1511224557,  758058757,  182437377, 2519872585, 3154908436,
+    3475746583, 3848310269, 3605409929, 2346871624,  355787835, 2224198215, 3931141032, 3066835220,
+     438269101, 3954906820, 2395451692, 3820001020, 2939268855,  671733024, 3584440116, 1397288571,
+    1393793602, 4131402750,  110441017,  133507812, 2429003393, 1903360069, 2165482737, 2998333829,
+    1273217174, 1892525665, 2246216519, 2144512924, 2565656678, 2150104874,  603930627, 4155168539,
+    3049010878, 4066396329,  594843708, 3600516973, 4275395470, 1118040554, 2475486480, 1932368311,
+    3272688889, 4173691874, 2981907475, 3604710935, 1158582194, 4146081620, 2633459075, 3645602072,
+    2050847757,  956922488, 2290602624, 3367053049,  252686252,   60812459, 3703269059, 1051636145,
+     718915105, 2418518487, 3175878250, 2724677763, 3766527996,  122323911, 2413625530,  634336857,
+     553253578, 2218256768, 3421225067,  520400871,  518303889, 2067274111, 3853552722, 4277841948,
+    3650844525,  825162160, 2856787588, 3235991715, 1016336959, 4218776973, 3061592766, 1200172324,
+    3287717255,  630841888, 3612050370, 3578149172,  855218892, 2148357390,  201310209, 1385056179,
+     146089700, 1318302273, 2230139662, 4136645204, 3843067815, 1655566773, 2626469137, 1897418622,
+    3327909398, 4240445780, 2900125203, 2907814134, 2241323563, 3497764887, 3585139109, 2431100375,
+    1277760634,   22367801, 3435554440,  238706376, 2274176271,  547312131, 3264650460,  874790718,
+    1837305157, 2954996215, 2226295196, 2745647577, 1067363505, 2377627350, 3203488504,  610571068,
+     684314912, 2784441732,  726254539,  388640543,  369767710, 1425597819,  322236133, 4140839166,
+    3833980896, 1100915207,  247793295, 1414064421, 2813100477, 3047263394,  291829904, 2119698645,
+    3819651523, 1382609701, 2443682263, 2138571477, 3402002738, 2155347328, 1811791883, 3875571026,
+     557098044, 3609254395, 1784531126, 2211616327, 4236251818, 3354121664, 3131492145, 1502137638,
+    4181380806, 3804273660,  331323052,  400523437, 2992042885, 1415112912, 2201480917,  405066896,
+     227871973, 2015199074, 2163385756, 4191865713, 2891387780, 2870068470, 3274785870, 2980159991,
+};
+
+const uint32_t ntt_harvey1024_inv_omega_powers[2048] = {
+        0,     1,     1, 10810,     1,  5146, 10810,  8246,
+        1,   722,  5146,  4134, 10810,  1305,  8246,  5736,
+        1,  9744,   722,  5860,  5146,  3504,  4134, 10643,
+    10810,  3621,  1305,  9094,  8246,  3542,  5736,  1212,
+        1, 11726,  9744,  7311,   722, 11340,  5860,  6561,
+     5146,  3006,  3504,  5777,  4134,  7468, 10643,  5023,
+    10810,  9314,  3621,  1351,  1305,  2625,  9094,  4591,
+     8246,  2744,  3542,  8961,  5736,  2639,  1212,  5828,
+        1,  7443, 11726,   140,  9744,  7203,  7311,    81,
+      722,  3553, 11340,  2768,  5860,  2319,  6561,  9326,
+     5146,  9154,  3006,  7678,  3504,  3014,  5777, 11289,
+     4134,  9995,  7468,  1177, 10643,   955,  5023,  3051,
+    10810,  2747,  9314,  1853,  3621,  1326,  1351,  3091,
+     1305,  4805,  2625, 10654,  9094, 11119,  4591,  7393,
+     8246,  3712,  2744, 11563,  3542,  3201,  8961,  4320,
+     5736,  1062,  2639,  4255,  1212,   790,  5828,  9923,
+        1,  5179,  7443,  8993, 11726,  9005,   140,     9,
+     9744,  5542,  7203,  7222,  7311,  1260,    81,  1673,
+      722,  3382,  3553,  4354, 11340,   729,  2768,  6498,
+     5860,  7399,  2319,  3748,  6561,   334,  9326,  3584,
+     5146,  8582,  9154,  9893,  3006, 10200,  7678,  9447,
+     3504,  8652,  3014,  2476,  5777,  7657, 11289,  6958,
+     4134,  2548,  9995,  2837,  7468,  3289,  1177,   339,
+    10643,  3932,   955,  5767,  5023, 10593,  3051,  9764,
+    10810,  8595,  2747,  8340,  9314,  2881,  1853, 11267,
+     3621,   145,  1326, 10092,  1351,  4388,  3091,  8011,
+     1305, 11934,  4805, 12159,  2625,  3241, 10654, 11745,
+     9094,  6378, 11119, 11336,  4591,  9863,  7393,  8112,
+     8246,  1759,  3712,  4452,  2744,  5092, 11563,   480,
+     3542,  8830,  3201,   118,  8961,  5755,  4320,  7300,
+     5736,  4231,  1062,  6915,  2639,  2013,  4255,  2468,
+     1212,  9558,   790, 11462,  5828,  1428,  9923, 10908,
+        1,  8005,  5179,  7098,  7443,  4143,  8993,     3,
+    11726,  3248,  9005, 10040,   140,  2401,     9, 10600,
+     9744,  2437,  5542,   420,  7203,    27,  7222,  4654,
+     7311,  4337,  1260,  9320,    81,  9377,  1673,  9644,
+      722,  3780,  3382,   243,  3553,  5019,  4354,  2166,
+    11340, 10146,   729, 10659,  2768,   773,  6498,  9442,
+     5860,  2187,  7399,  8304,  2319,  7205,  3748,  5291,
+     6561,  9908,   334,  6957,  9326, 11244,  3584,  7394,
+     5146,  1002,  8582,  3400,  9154, 10752,  9893,  3149,
+     3006,  1168, 10200,  2884,  7678,  5101,  9447,  9018,
+     3504,  6022,  8652, 10745,  3014,  3763,  2476, 10512,
+     5777,  1378,  7657,  9042, 11289,  7428,  6958,  5042,
+     4134, 10682,  2548,  9289,  9995,  8585,  2837,   113,
+     7468,  7644,  3289,  5407,  1177,  8511,   339, 10115,
+    10643,  9867,  3932,  3531,   955,  1017,  5767,  7351,
+     5023, 11796, 10593,  2865,  3051,  5012,  9764,  2780,
+    10810,  7201,  8595,  9153,  2747,  4714,  8340,  7852,
+     9314,  1207,  2881,  8241,  1853,   442, 11267,  3364,
+     3621,  8643,   145,  5559,  1326,  9223, 10092, 10863,
+     1351,   435,  4388,  3978,  3091,  5698,  8011,  4053,
+     1305,   875, 11934,  9273,  4805, 11744, 12159,  3915,
+     2625, 11224,  3241,  2126, 10654, 11899, 11745,  7875,
+     9094,  9723,  6378,  7384, 11119, 10657, 11336,  2704,
+     4591,  6845,  9863,  8779,  7393,  9430,  8112,  1484,
+     8246,  5011,  1759,  9890,  3712, 12047,  4452,   160,
+     2744,  5277,  5092, 11136, 11563,  1067,   480,  8232,
+     3542,  2987,  8830, 10111,  3201,  1440,   118, 10626,
+     8961,  1912,  5755,  9603,  4320,   354,  7300,  2305,
+     5736,  4976,  4231,   671,  1062,  9611,  6915,  4919,
+     2639,   404,  2013,  3186,  4255,  8456,  2468,  7917,
+     1212,  6039,  9558,   476,   790,  7404, 11462,  3636,
+     5828,  4096,  1428,  2370,  9923,  9808, 10908,  5195,
+        1,  3762,  8005,  6760,  5179,  5333,  7098, 10968,
+     7443,  6224,  4143,  3514,  8993,    49,     3, 11286,
+    11726,  7991,  3248,  3710,  9005,  8326, 10040,  6383,
+      140, 10542,  2401,   147,     9,  9280, 10600, 11684,
+     9744, 11130,  2437,   400,  5542,  6860,   420,  7048,
+     7203,   441,    27,  3262,  7222, 10474,  4654,  8812,
+     7311,  1200,  4337,  8291,  1260,  8855,  9320,  1323,
+       81,  9786,  9377,  6844,  1673,  1858,  9644,  3600,
+      722,   295,  3780,  1987,  3382,  3969,   243,  4780,
+     3553,  8243,  5019,  5574,  4354, 10800,  2166,   885,
+    11340,  5961, 10146, 11907,   729,  2051, 10659,   151,
+     2768,  4433,   773,  7822,  6498,  2655,  9442,  5594,
+     5860, 11143,  2187,  6153,  7399,   453,  8304,  1010,
+     2319, 11177,  7205,  7965,  3748,  4493,  5291,  8851,
+     6561,  6170,  9908,  1359,   334,  3030,  6957,  8953,
+     9326, 11606, 11244,  1190,  3584,  1975,  7394,  6221,
+     5146,  4077,  1002,  9090,  8582,  2281,  3400, 10240,
+     9154,  3570, 10752,  5925,  9893,  6374,  3149, 12231,
+     3006,  2692,  1168,  6843, 10200,  6142,  2884, 10710,
+     7678,  5486,  5101,  6833,  9447, 12115,  9018,  8076,
+     3504,  8240,  6022,  6137,  8652,  7552, 10745,  4169,
+     3014,  8210,  3763, 11767,  2476, 11939, 10512,   142,
+     5777,  6122,  1378, 10367,  7657,   218,  9042,    52,
+    11289, 10723,  7428, 11239,  6958,   426,  5042,  6077,
+     4134,  6523, 10682,   654,  2548,   156,  9289,  7591,
+     9995,  9139,  8585,  1278,  2837,  5942,   113,  7280,
+     7468,  1962,  7644,   468,  3289, 10484,  5407,  2839,
+     1177,  3834,  8511,  5537,   339,  9551, 10115,  5886,
+    10643,  1404,  9867,  6874,  3932,  8517,  3531, 11502,
+      955,  4322,  1017,  4075,  5767,  5369,  7351,  4212,
+     5023,  8333, 11796,   973, 10593,  9928,  2865,   677,
+     3051, 12225,  5012,  3818,  9764,   347,  2780,   421,
+    10810,  2919,  7201,  5206,  8595,  2031,  9153, 12097,
+     2747, 11454,  4714,  1041,  8340,  1263,  7852,  8757,
+     9314,  3329,  1207,  6093,  2881, 11713,  8241,  9784,
+     1853,  3123,   442,  3789, 11267,  1693,  3364,  9987,
+     3621,  5990,  8643, 10561,   145,  4774,  5559,  9369,
+     1326, 11367,  9223,  5079, 10092,  5383, 10863,  5681,
+     1351,  7105,   435,  2033,  4388,  3529,  3978,  9523,
+     3091,  2948,  5698,  3860,  8011,  4754,  4053,  9026,
+     1305,  6099,   875, 10587, 11934,  3991,  9273,  8844,
+     4805, 11580, 11744,  1973, 12159,  2500,  3915,  6008,
+     2625,  7183, 11224, 11973,  3241,  1954,  2126, 10162,
+    10654,  5919, 11899,  7500, 11745,  5735,  7875,  9260,
+     9094, 11341,  9723,  5862,  6378,  5908,  7384,  5468,
+    11119, 10211, 10657,  4916, 11336,  3202,  2704,  9445,
+     4591,  5297,  6845,  5435,  9863,  4115,  8779,  6055,
+     7393,  2459,  9430,  9606,  8112,  3757,  1484,  3602,
+     8246,  4016,  5011,    56,  1759,  5876,  9890,  7377,
+     3712,  4240, 12047, 11271,  4452, 10806,   160, 12048,
+     2744,   168,  5277,  5339,  5092,  9842, 11136,   431,
+    11563,  9235,  1067,  7840,   480, 11566,  8232,   504,
+     3542,  3728,  2987,  4948,  8830,  1293, 10111,  3127,
+     3201, 11231,  1440, 10120,   118,  1512, 10626, 11184,
+     8961,  2555,  1912,  3879,  5755,  9381,  9603,  9115,
+     4320,  5782,   354,  4536,  7300,  8974,  2305,  7665,
+     5736, 11637,  4976,  3565,  4231,  2767,   671,  5057,
+     1062,  1319,  9611,  2344,  6915, 10706,  4919, 10333,
+     2639, 10695,   404,  8301,  2013,  2882,  3186,  3957,
+     4255,  7032,  8456,  7540,  2468,  6421,  7917,  7507,
+     1212,   325,  6039,  8646,  9558, 11871,   476,  8807,
+      790, 10331,  7404,  6974, 11462, 10232,  3636,   975,
+     5828,  1360,  4096, 11035,  1428,  1843,  2370,  6415,
+     9923,  8633,  9808,  6118, 10908,  2925,  5195,  4080,
+    // Shoup companions
+             0,     349496,     349496, 3778061393,     349496, 1798511002, 3778061393, 2881951364,
+        349496,  252336755, 1798511002, 1444820148, 3778061393,  456093443, 2881951364, 2004714167,
+        349496, 3405497707,  252336755, 2048051782, 1798511002, 1224637106, 1444820148, 3719695413,
+    3778061393, 1265528243,  456093443, 3178324728, 2881951364, 1237917988, 2004714167,  423590232,
+        349496, 4098200546, 3405497707, 2555171771,  252336755, 3963294746, 2048051782, 2293049103,
+    1798511002, 1050587654, 1224637106, 2019043540, 1444820148, 2610042783, 3719695413, 1755522884,
+    3778061393, 3255214044, 1265528243,  472170300,  456093443,  917429339, 3178324728, 1604540227,
+    2881951364,  959019469, 1237917988, 3131841642, 2004714167,  922322295,  423590232, 2036867881,
+        349496, 2601305361, 4098200546,   48929564, 3405497707, 2517426107, 2555171771,   28309248,
+     252336755, 1241762454, 3963294746,  967407394, 2048051782,  810483290, 2293049103, 3259408007,
+    1798511002, 3199294542, 1050587654, 2683437130, 1224637106, 1053383630, 2019043540, 3945470404,
+    1444820148, 3493221427, 2610042783,  411357840, 3719695413,  333769531, 1755522884, 1066315015,
+    3778061393,  960067960, 3255214044,  647617739, 1265528243,  463432877,  472170300, 1080294890,
+     456093443, 1679332562,  917429339, 3723539878, 3178324728, 3886055933, 1604540227, 2583830516,
+    2881951364, 1297332460,  959019469, 4041232552, 1237917988, 1118739548, 3131841642, 1509826569,
+    2004714167,  371165698,  922322295, 1487109272,  423590232,  276102544, 2036867881, 3468057651,
+        349496, 1810044399, 2601305361, 3143025542, 4098200546, 3147219505,   48929564,    3145472,
+    3405497707, 1936911771, 2517426107, 2524066548, 2555171771,  440366082,   28309248,  584708298,
+     252336755, 1181998486, 1241762454, 1521709464, 3963294746,  254783233,  967407394, 2271030799,
+    2048051782, 2585927498,  810483290, 1309914348, 2293049103,  116731961, 3259408007, 1252596858,
+    1798511002, 2999382320, 3199294542, 3457572744, 1050587654, 3564868290, 2683437130, 3301697131,
+    1224637106, 3023847102, 1053383630,  865354302, 2019043540, 2676097695, 3945470404, 2431799368,
+    1444820148,  890518078, 3493221427,  991522680, 2610042783, 1149495275,  411357840,  118479446,
+    3719695413, 1374221776,  333769531, 2015548571, 1755522884, 3702220568, 1066315015, 3412487645,
+    3778061393, 3003925779,  960067960, 2914804072, 3255214044, 1006900543,  647617739, 3937781473,
+    1265528243,   50677049,  463432877, 3527122626,  472170300, 1533592358, 1080294890, 2799819595,
+     456093443, 4170895899, 1679332562, 4249532700,  917429339, 1132719424, 3723539878, 4104840987,
+    3178324728, 2229091172, 3886055933, 3961896758, 1604540227, 3447087837, 2583830516, 2835118781,
+    2881951364,  614765031, 1297332460, 1555960159,  959019469, 1779638170, 4041232552,  167758507,
+    1237917988, 3086057549, 1118739548,   41240633, 3131841642, 2011354608, 1509826569, 2551327305,
+    2004714167, 1478721346,  371165698, 2416771002,  922322295,  703537241, 1487109272,  862558327,
+     423590232, 3340491286,  276102544, 4005933366, 2036867881,  499081560, 3468057651, 3812312089,
+        349496, 2797722614, 1810044399, 2480728933, 2601305361, 1447965620, 3143025542,    1048490,
+    4098200546, 1135165902, 3147219505, 3508948787,   48929564,  839142035,    3145472, 3704667046,
+    3405497707,  851723923, 1936911771,  146788694, 2517426107,    9436416, 2524066548, 1626558531,
+    2555171771, 1515768017,  440366082, 3257311026,   28309248, 3277232348,  584708298, 3370548018,
+     252336755, 1321098248, 1181998486,   84927744, 1241762454, 1754124896, 1521709464,  757010266,
+    3963294746, 3545995458,  254783233, 3725287363,  967407394,  270161096, 2271030799, 3299949646,
+    2048051782,  764349701, 2585927498, 2902222184,  810483290, 2518125101, 1309914348, 1849188051,
+    2293049103, 3462815198,  116731961, 2431449872, 3259408007, 3929743044, 1252596858, 2584180013,
+    1798511002,  350195884, 2999382320, 1188289430, 3199294542, 3757790574, 3457572744, 1100565710,
+    1050587654,  408212368, 3564868290, 1007949034, 2683437130, 1782783642, 3301697131, 3151762964,
+    1224637106, 2104670278, 3023847102, 3755344095, 1053383630, 1315156801,  865354302, 3673911320,
+    2019043540,  481606716, 2676097695, 3160150890, 3945470404, 2596062907, 2431799368, 1762163325,
+    1444820148, 3733325791,  890518078, 3246476622, 3493221427, 3000430810,  991522680,   39493148,
+    2610042783, 2671554236, 1149495275, 1889729690,  411357840, 2974568041,  118479446, 3535161054,
+    3719695413, 3448485825, 1374221776, 1234073522,  333769531,  355438338, 2015548571, 2569151647,
+    1755522884, 4122665328, 3702220568, 1001308593, 1066315015, 1751678418, 3412487645,  971601357,
+    3778061393, 2516727113, 3003925779, 3198945045,  960067960, 1647528345, 2914804072, 2744249589,
+    3255214044,  421842747, 1006900543, 2880203880,  647617739,  154477625, 3937781473, 1175707542,
+    1265528243, 3020701630,   50677049, 1942853218,  463432877, 3223409827, 3527122626, 3796584729,
+     472170300,  152031147, 1533592358, 1390298633, 1080294890, 1991433286, 2799819595, 1416510900,
+     456093443,  305809779, 4170895899, 3240884672, 1679332562, 4104491490, 4249532700, 1368280329,
+     917429339, 3922753106, 1132719424,  743030390, 3723539878, 4158663508, 4104840987, 2752288018,
+    3178324728, 3398158273, 2229091172, 2580685044, 3886055933, 3724588369, 3961896758,  945039593,
+    1604540227, 2392306220, 3447087837, 3068233207, 2583830516, 3295755684, 2835118781,  518653386,
+    2881951364, 1751328921,  614765031, 3456524254, 1297332460, 4210389048, 1555960159,   55919502,
+     959019469, 1844295094, 1779638170, 3891997380, 4041232552,  372913182,  167758507, 2877058408,
+    1237917988, 1043947214, 3086057549, 3533763066, 1118739548,  503275523,   41240633, 3713753965,
+    3131841642,  668238055, 2011354608, 3356218646, 1509826569,  123721899, 2551327305,  805590334,
+    2004714167, 1739096530, 1478721346,  234512413,  371165698, 3359014621, 2416771002, 1719175207,
+     922322295,  141196744,  703537241, 1113497095, 1487109272, 2955345712,  862558327, 2766966887,
+     423590232, 2110611725, 3340491286,  166360520,  276102544, 2587674982, 4005933366, 1270770696,
+    2036867881, 1431539266,  499081560,  828307632, 3468057651, 3427865508, 3812312089, 1815636349,
+        349496, 1314807304, 2797722614, 2362598984, 1810044399, 1863866920, 2480728933, 3833281902,
+    2601305361, 2175268650, 1447965620, 1228132075, 3143025542,   17125347,    1048490, 3944421914,
+    4098200546, 2792829657, 1135165902, 1296633466, 3147219505, 2909911116, 3508948787, 2230838656,
+      48929564, 3684396227,  839142035,   51376043,    3145472, 3243331150, 3704667046, 4083521676,
+    3405497707, 3889900399,  851723923,  139798756, 1936911771, 2397548673,  146788694, 2463254089,
+    2517426107,  154128129,    9436416, 1140058859, 2524066548, 3660630438, 1626558531, 3079766605,
+    2555171771,  419396269, 1515768017, 2897678724,  440366082, 3094794971, 3257311026,  462384387,
+      28309248, 3420176577, 3277232348, 2391956723,  584708298,  649365223, 3370548018, 1258188808,
+     252336755,  103101582, 1321098248,  694450322, 1181998486, 1387153161,   84927744, 1670595139,
+    1241762454, 2880902874, 1754124896, 1948095671, 1521709464, 3774566424,  757010266,  309304748,
+    3963294746, 2083350968, 3545995458, 4161459483,  254783233,  716818123, 3725287363,   52774030,
+     967407394, 1549319718,  270161096, 2733764682, 2271030799,  927914246, 3299949646, 1955085609,
+    2048051782, 3894443858,  764349701, 2150454371, 2585927498,  158322091, 2902222184,  352991860,
+     810483290, 3906326752, 2518125101, 2783742738, 1309914348, 1570289532, 1849188051, 3093396984,
+    2293049103, 2156395818, 3462815198,  474966275,  116731961, 1058975580, 2431449872, 3129045666,
+    3259408007, 4056260919, 3929743044,  415901300, 1252596858,  690256360, 2584180013, 2174220160,
+    1798511002, 1424898825,  350195884, 3176926741, 2999382320,  797202408, 1188289430, 3578848165,
+    3199294542, 1247703901, 3757790574, 2070769080, 3457572744, 2227693184, 1100565710, 4274696476,
+    1050587654,  940845631,  408212368, 2391607226, 3564868290, 2146609905, 1007949034, 3743111704,
+    2683437130, 1917339945, 1782783642, 2388112257, 3301697131, 4234154836, 3151762964, 2822536893,
+    1224637106, 2879854383, 2104670278, 2144862421, 3023847102, 2639400522, 3755344095, 1457052539,
+    1053383630, 2869369476, 1315156801, 4112529918,  865354302, 4172643384, 3673911320,   49628558,
+    2019043540, 2139619967,  481606716, 3623234271, 2676097695,   76190322, 3160150890,   18173838,
+    3945470404, 3747655164, 2596062907, 3927995560, 2431799368,  148885675, 1762163325, 2123892607,
+    1444820148, 2279768221, 3733325791,  228570966,  890518078,   54521515, 3246476622, 2653030901,
+    3493221427, 3194052088, 3000430810,  446657026,  991522680, 2076710527,   39493148, 2544337367,
+    2610042783,  685712900, 2671554236,  163564545, 1149495275, 3664125407, 1889729690,  992221674,
+     411357840, 1339971080, 2974568041, 1935164286,  118479446, 3338044807, 3535161054, 2057138701,
+    3719695413,  490693635, 3448485825, 2402441630, 1374221776, 2976665022, 1234073522, 4019913242,
+     333769531, 1510525563,  355438338, 1424199831, 2015548571, 1876448808, 2569151647, 1472080905,
+    1755522884, 2912357594, 4122665328,  340060475, 3702220568, 3469805135, 1001308593,  236609395,
+    1066315015, 4272599494, 1751678418, 1334379130, 3412487645,  121275421,  971601357,  147138191,
+    3778061393, 1020181425, 2516727113, 1819480815, 3003925779,  709828186, 3198945045, 4227863892,
+     960067960, 4003137391, 1647528345,  363826263, 2914804072,  441414573, 2744249589, 3060544276,
+    3255214044, 1163475150,  421842747, 2129484558, 1006900543, 4093657086, 2880203880, 3419477583,
+     647617739, 1091478791,  154477625, 1324243720, 3937781473,  591698236, 1175707542, 3490425452,
+    1265528243, 2093486378, 3020701630, 3691036668,   50677049, 1668498158, 1942853218, 3274436373,
+     463432877, 3972731162, 3223409827, 1775094710, 3527122626, 1881341765, 3796584729, 1985491838,
+     472170300, 2483175412,  152031147,  710527179, 1533592358, 1233374529, 1390298633, 3328258894,
+    1080294890, 1030316835, 1991433286, 1349058000, 2799819595, 1661508220, 1416510900, 3154558940,
+     456093443, 2131581539,  305809779, 3700123587, 4170895899, 1394842092, 3240884672, 3090950505,
+    1679332562, 4047174000, 4104491490,  689557366, 4249532700,  873742228, 1368280329, 2099777322,
+     917429339, 2510436169, 3922753106, 4184526278, 1132719424,  682916925,  743030390, 3551587408,
+    3723539878, 2068672099, 4158663508, 2621226684, 4104840987, 2004364671, 2752288018, 3236341212,
+    3178324728, 3963644243, 3398158273, 2048750776, 2229091172, 2064827633, 2580685044, 1911049001,
+    3886055933, 3568712756, 3724588369, 1718126717, 3961896758, 1119089045,  945039593, 3300998137,
+    1604540227, 1851285032, 2392306220, 1899515603, 3447087837, 1438179707, 3068233207, 2116203676,
+    2583830516,  859412855, 3295755684, 3357267136, 2835118781, 1313059820,  518653386, 1258887802,
+    2881951364, 1403579515, 1751328921,   19571825,  614765031, 2053643732, 3456524254, 2578238566,
+    1297332460, 1481866818, 4210389048, 3939179460, 1555960159, 3776663406,   55919502, 4210738545,
+     959019469,   58715477, 1844295094, 1865963902, 1779638170, 3439748403, 3891997380,  150633160,
+    4041232552, 3227603790,  372913182, 2740055627,  167758507, 4042281043, 2877058408,  176146433,
+    1237917988, 1302924410, 1043947214, 1729310617, 3086057549,  451899480, 3533763066, 1092876778,
+    1118739548, 3925199585,  503275523, 3536908538,   41240633,  528439299, 3713753965, 3908773231,
+    3131841642,  892964557,  668238055, 1355698440, 2011354608, 3278630336, 3356218646, 3185664163,
+    1509826569, 2020791024,  123721899, 1585317898, 2551327305, 3136385101,  805590334, 2678893671,
+    2004714167, 4067095322, 1739096530, 1245956417, 1478721346,  967057897,  234512413, 1767405778,
+     371165698,  460986399, 3359014621,  819220712, 2416771002, 3741713717, 1719175207, 3611351376,
+     922322295, 3737869251,  141196744, 2901173693,  703537241, 1007250040, 1113497095, 1382959198,
+    1487109272, 2457662138, 2955345712, 2635206559,  862558327, 2244119538, 2766966887, 2623673162,
+     423590232,  113586489, 2110611725, 3021750121, 3340491286, 4148877595,  166360520, 3078019120,
+     276102544, 3610652383, 2587674982, 2437391319, 4005933366, 3576052190, 1270770696,  340759468,
+    2036867881,  475315772, 1431539266, 3856698194,  499081560,  644122770,  828307632, 2242022557,
+    3468057651, 3017206661, 3427865508, 2138221980, 3812312089, 1022278406, 1815636349, 1425947316,
+};
+
+const uint32_t ntt_harvey1024_inv_omega_powers_rev[2048] = {
+        0,     1,     1, 10810,     1, 10810,  5146,  8246,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+        1, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099,  6523, 11637,
+    11130,  5990,  8240,  3728, 11143, 11341,  1404,   325,
+     7991,  3329,  2692,   168,  5961,  7183,  1962, 10695,
+     1200,  7105,  6122,  2555,  6170,  5297,  8333,  1360,
+     6224, 11454,  3570,  4240,  8243, 11580,  9139,  1319,
+      441, 11367,  8210, 11231, 11177, 10211,  4322, 10331,
+    10542,  3123,  5486,  9235,  4433,  5919,  3834,  7032,
+     9786,  2948, 10723,  5782, 11606,  2459, 12225,  8633,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+     6860,  4774,  7552,  1293,   453,  5908,  8517, 11871,
+     8326, 11713,  6142,  9842,  2051,  1954, 10484,  2882,
+     8855,  3529,   218,  9381,  3030,  4115,  9928,  1843,
+       49,  1263,  6374, 10806, 10800,  2500,  5942, 10706,
+    10474,  5383, 11939,  1512,  4493,  3202,  5369, 10232,
+     9280,  1693, 12115, 11566,  2655,  5735,  9551,  6421,
+     1858,  4754,   426,  8974,  1975,  3757,   347,  2925,
+     6760,  5206,  9090,    56,  1987, 10587,   654,  3565,
+      400, 10561,  6137,  4948,  6153,  5862,  6874,  8646,
+     3710,  6093,  6843,  5339, 11907, 11973,   468,  8301,
+     8291,  2033, 10367,  3879,  1359,  5435,   973, 11035,
+     3514,  1041,  5925, 11271,  5574,  1973,  1278,  2344,
+     3262,  5079, 11767, 10120,  7965,  4916,  4075,  6974,
+      147,  3789,  6833,  7840,  7822,  7500,  5537,  7540,
+     6844,  3860, 11239,  4536,  1190,  9606,  3818,  6118,
+    10968, 12097, 10240,  7377,  4780,  8844,  7591,  5057,
+     7048,  9369,  4169,  3127,  1010,  5468, 11502,  8807,
+     6383,  9784, 10710,   431,   151, 10162,  2839,  3957,
+     1323,  9523,    52,  9115,  8953,  6055,   677,  6415,
+    11286,  8757, 12231, 12048,   885,  6008,  7280, 10333,
+     8812,  5681,   142, 11184,  8851,  9445,  4212,   975,
+    11684,  9987,  8076,   504,  5594,  9260,  5886,  7507,
+     3600,  9026,  6077,  7665,  6221,  3602,   421,  4080,
+    // Shoup companions
+             0,     349496,     349496, 3778061393,     349496, 3778061393, 1798511002, 2881951364,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+    2601305361,  960067960, 3199294542, 1297332460, 1241762454, 1679332562, 3493221427,  371165698,
+    2517426107,  463432877, 1053383630, 1118739548,  810483290, 3886055933,  333769531,  276102544,
+      48929564,  647617739, 2683437130, 4041232552,  967407394, 3723539878,  411357840, 1487109272,
+      28309248, 1080294890, 3945470404, 1509826569, 3259408007, 2583830516, 1066315015, 3468057651,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+    2601305361,  960067960, 3199294542, 1297332460, 1241762454, 1679332562, 3493221427,  371165698,
+    2517426107,  463432877, 1053383630, 1118739548,  810483290, 3886055933,  333769531,  276102544,
+      48929564,  647617739, 2683437130, 4041232552,  967407394, 3723539878,  411357840, 1487109272,
+      28309248, 1080294890, 3945470404, 1509826569, 3259408007, 2583830516, 1066315015, 3468057651,
+    1810044399, 3003925779, 2999382320,  614765031, 1181998486, 4170895899,  890518078, 1478721346,
+    1936911771,   50677049, 3023847102, 3086057549, 2585927498, 2229091172, 1374221776, 3340491286,
+    3147219505, 1006900543, 3564868290, 1779638170,  254783233, 1132719424, 1149495275,  703537241,
+     440366082, 1533592358, 2676097695, 2011354608,  116731961, 3447087837, 3702220568,  499081560,
+    3143025542, 2914804072, 3457572744, 1555960159, 1521709464, 4249532700,  991522680, 2416771002,
+    2524066548, 3527122626,  865354302,   41240633, 1309914348, 3961896758, 2015548571, 4005933366,
+       3145472, 3937781473, 3301697131,  167758507, 2271030799, 4104840987,  118479446,  862558327,
+     584708298, 2799819595, 2431799368, 2551327305, 1252596858, 2835118781, 3412487645, 3812312089,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+    2601305361,  960067960, 3199294542, 1297332460, 1241762454, 1679332562, 3493221427,  371165698,
+    2517426107,  463432877, 1053383630, 1118739548,  810483290, 3886055933,  333769531,  276102544,
+      48929564,  647617739, 2683437130, 4041232552,  967407394, 3723539878,  411357840, 1487109272,
+      28309248, 1080294890, 3945470404, 1509826569, 3259408007, 2583830516, 1066315015, 3468057651,
+    1810044399, 3003925779, 2999382320,  614765031, 1181998486, 4170895899,  890518078, 1478721346,
+    1936911771,   50677049, 3023847102, 3086057549, 2585927498, 2229091172, 1374221776, 3340491286,
+    3147219505, 1006900543, 3564868290, 1779638170,  254783233, 1132719424, 1149495275,  703537241,
+     440366082, 1533592358, 2676097695, 2011354608,  116731961, 3447087837, 3702220568,  499081560,
+    3143025542, 2914804072, 3457572744, 1555960159, 1521709464, 4249532700,  991522680, 2416771002,
+    2524066548, 3527122626,  865354302,   41240633, 1309914348, 3961896758, 2015548571, 4005933366,
+       3145472, 3937781473, 3301697131,  167758507, 2271030799, 4104840987,  118479446,  862558327,
+     584708298, 2799819595, 2431799368, 2551327305, 1252596858, 2835118781, 3412487645, 3812312089,
+    2797722614, 2516727113,  350195884, 1751328921, 1321098248,  305809779, 3733325791, 1739096530,
+     851723923, 3020701630, 2104670278, 1043947214,  764349701, 3398158273, 3448485825, 2110611725,
+    1135165902,  421842747,  408212368, 1844295094, 3545995458, 3922753106, 2671554236,  141196744,
+    1515768017,  152031147,  481606716,  668238055, 3462815198, 2392306220, 4122665328, 1431539266,
+    1447965620, 1647528345, 3757790574, 4210389048, 1754124896, 4104491490, 3000430810, 3359014621,
+       9436416, 3223409827, 1315156801,  503275523, 2518125101, 3724588369,  355438338, 2587674982,
+     839142035,  154477625, 1782783642,  372913182,  270161096, 4158663508, 2974568041, 2955345712,
+    3277232348, 1991433286, 2596062907,  123721899, 3929743044, 3295755684, 1751678418, 3427865508,
+    2480728933, 3198945045, 1188289430, 3456524254,   84927744, 3240884672, 3246476622,  234512413,
+     146788694, 1942853218, 3755344095, 3533763066, 2902222184, 2580685044, 1234073522,  166360520,
+    3508948787, 2880203880, 1007949034, 3891997380, 3725287363,  743030390, 1889729690, 1113497095,
+    3257311026, 1390298633, 3160150890, 3356218646, 2431449872, 3068233207, 1001308593,  828307632,
+       1048490, 2744249589, 1100565710,   55919502,  757010266, 1368280329,   39493148, 1719175207,
+    1626558531, 3796584729, 3673911320, 3713753965, 1849188051,  945039593, 2569151647, 1270770696,
+    3704667046, 1175707542, 3151762964, 2877058408, 3299949646, 2752288018, 3535161054, 2766966887,
+    3370548018, 1416510900, 1762163325,  805590334, 2584180013,  518653386,  971601357, 1815636349,
+        349496, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+    2601305361,  960067960, 3199294542, 1297332460, 1241762454, 1679332562, 3493221427,  371165698,
+    2517426107,  463432877, 1053383630, 1118739548,  810483290, 3886055933,  333769531,  276102544,
+      48929564,  647617739, 2683437130, 4041232552,  967407394, 3723539878,  411357840, 1487109272,
+      28309248, 1080294890, 3945470404, 1509826569, 3259408007, 2583830516, 1066315015, 3468057651,
+    1810044399, 3003925779, 2999382320,  614765031, 1181998486, 4170895899,  890518078, 1478721346,
+    1936911771,   50677049, 3023847102, 3086057549, 2585927498, 2229091172, 1374221776, 3340491286,
+    3147219505, 1006900543, 3564868290, 1779638170,  254783233, 1132719424, 1149495275,  703537241,
+     440366082, 1533592358, 2676097695, 2011354608,  116731961, 3447087837, 3702220568,  499081560,
+    3143025542, 2914804072, 3457572744, 1555960159, 1521709464, 4249532700,  991522680, 2416771002,
+    2524066548, 3527122626,  865354302,   41240633, 1309914348, 3961896758, 2015548571, 4005933366,
+       3145472, 3937781473, 3301697131,  167758507, 2271030799, 4104840987,  118479446,  862558327,
+     584708298, 2799819595, 2431799368, 2551327305, 1252596858, 2835118781, 3412487645, 3812312089,
+    2797722614, 2516727113,  350195884, 1751328921, 1321098248,  305809779, 3733325791, 1739096530,
+     851723923, 3020701630, 2104670278, 1043947214,  764349701, 3398158273, 3448485825, 2110611725,
+    1135165902,  421842747,  408212368, 1844295094, 3545995458, 3922753106, 2671554236,  141196744,
+    1515768017,  152031147,  481606716,  668238055, 3462815198, 2392306220, 4122665328, 1431539266,
+    1447965620, 1647528345, 3757790574, 4210389048, 1754124896, 4104491490, 3000430810, 3359014621,
+       9436416, 3223409827, 1315156801,  503275523, 2518125101, 3724588369,  355438338, 2587674982,
+     839142035,  154477625, 1782783642,  372913182,  270161096, 4158663508, 2974568041, 2955345712,
+    3277232348, 1991433286, 2596062907,  123721899, 3929743044, 3295755684, 1751678418, 3427865508,
+    2480728933, 3198945045, 1188289430, 3456524254,   84927744, 3240884672, 3246476622,  234512413,
+     146788694, 1942853218, 3755344095, 3533763066, 2902222184, 2580685044, 1234073522,  166360520,
+    3508948787, 2880203880, 1007949034, 3891997380, 3725287363,  743030390, 1889729690, 1113497095,
+    3257311026, 1390298633, 3160150890, 3356218646, 2431449872, 3068233207, 1001308593,  828307632,
+       1048490, 2744249589, 1100565710,   55919502,  757010266, 1368280329,   39493148, 1719175207,
+    1626558531, 3796584729, 3673911320, 3713753965, 1849188051,  945039593, 2569151647, 1270770696,
+    3704667046, 1175707542, 3151762964, 2877058408, 3299949646, 2752288018, 3535161054, 2766966887,
+    3370548018, 1416510900, 1762163325,  805590334, 2584180013,  518653386,  971601357, 1815636349,
+    1314807304, 1020181425, 1424898825, 1403579515,  103101582, 2131581539, 2279768221, 4067095322,
+    3889900399, 2093486378, 2879854383, 1302924410, 3894443858, 3963644243,  490693635,  113586489,
+    2792829657, 1163475150,  940845631,   58715477, 2083350968, 2510436169,  685712900, 3737869251,
+     419396269, 2483175412, 2139619967,  892964557, 2156395818, 1851285032, 2912357594,  475315772,
+    2175268650, 4003137391, 1247703901, 1481866818, 2880902874, 4047174000, 3194052088,  460986399,
+     154128129, 3972731162, 2869369476, 3925199585, 3906326752, 3568712756, 1510525563, 3610652383,
+    3684396227, 1091478791, 1917339945, 3227603790, 1549319718, 2068672099, 1339971080, 2457662138,
+    3420176577, 1030316835, 3747655164, 2020791024, 4056260919,  859412855, 4272599494, 3017206661,
+    1863866920,  709828186,  797202408, 2053643732, 1387153161, 1394842092,   54521515,  967057897,
+    2397548673, 1668498158, 2639400522,  451899480,  158322091, 2064827633, 2976665022, 4148877595,
+    2909911116, 4093657086, 2146609905, 3439748403,  716818123,  682916925, 3664125407, 1007250040,
+    3094794971, 1233374529,   76190322, 3278630336, 1058975580, 1438179707, 3469805135,  644122770,
+      17125347,  441414573, 2227693184, 3776663406, 3774566424,  873742228, 2076710527, 3741713717,
+    3660630438, 1881341765, 4172643384,  528439299, 1570289532, 1119089045, 1876448808, 3576052190,
+    3243331150,  591698236, 4234154836, 4042281043,  927914246, 2004364671, 3338044807, 2244119538,
+     649365223, 1661508220,  148885675, 3136385101,  690256360, 1313059820,  121275421, 1022278406,
+    2362598984, 1819480815, 3176926741,   19571825,  694450322, 3700123587,  228570966, 1245956417,
+     139798756, 3691036668, 2144862421, 1729310617, 2150454371, 2048750776, 2402441630, 3021750121,
+    1296633466, 2129484558, 2391607226, 1865963902, 4161459483, 4184526278,  163564545, 2901173693,
+    2897678724,  710527179, 3623234271, 1355698440,  474966275, 1899515603,  340060475, 3856698194,
+    1228132075,  363826263, 2070769080, 3939179460, 1948095671,  689557366,  446657026,  819220712,
+    1140058859, 1775094710, 4112529918, 3536908538, 2783742738, 1718126717, 1424199831, 2437391319,
+      51376043, 1324243720, 2388112257, 2740055627, 2733764682, 2621226684, 1935164286, 2635206559,
+    2391956723, 1349058000, 3927995560, 1585317898,  415901300, 3357267136, 1334379130, 2138221980,
+    3833281902, 4227863892, 3578848165, 2578238566, 1670595139, 3090950505, 2653030901, 1767405778,
+    2463254089, 3274436373, 1457052539, 1092876778,  352991860, 1911049001, 4019913242, 3078019120,
+    2230838656, 3419477583, 3743111704,  150633160,   52774030, 3551587408,  992221674, 1382959198,
+     462384387, 3328258894,   18173838, 3185664163, 3129045666, 2116203676,  236609395, 2242022557,
+    3944421914, 3060544276, 4274696476, 4210738545,  309304748, 2099777322, 2544337367, 3611351376,
+    3079766605, 1985491838,   49628558, 3908773231, 3093396984, 3300998137, 1472080905,  340759468,
+    4083521676, 3490425452, 2822536893,  176146433, 1955085609, 3236341212, 2057138701, 2623673162,
+    1258188808, 3154558940, 2123892607, 2678893671, 2174220160, 1258887802,  147138191, 1425947316,
+};
+
+const uint32_t ntt_harvey1024_mixed_powers[2048] = {
+        0,  1479,  4043,  7143,  6553, 10984,  8155, 11567,
+    11077,  8747,  3195,  8668,  1646,  8785,  6429,  2545,
+     6461,  9650,  3328,  9545,  7698,  9664, 10938,  2975,
+     7266,  4821,  6512,  9283,  5728,   949,  4978,   563,
+     2366, 11499,  8034, 11227,  7969,  9088,   726,  8577,
+     4896,  1170,  1635,  7484,  9198, 10963, 10436,  9542,
+     9238, 11334, 11112,  2294,  1000,  9275,  4611,  3135,
+     2963,  9970,  9521,  8736, 12208,  5086, 12149,  4846,
+     1381, 10861,   827,  2731,  9821, 10276,  5374,  8058,
+     4989,  6534, 12171,  3459, 11809,  7197,  7837, 10530,
+     4177,  2426,   953,  5911,   544,  9048,   130,   355,
+     4278,  7901,  2197, 12144,  1022,  9408,  3949,  3694,
+     2525,  1696,  6522,  8357, 11950,  9000,  9452,  9741,
+     5331,  4632,  9813,  3637,  2842,  2089,  2396,  3707,
+     8705, 11955,  8541,  4890,  5791, 11560,  7935,  8907,
+    10616, 11029,  5067,  6747, 12280,  3284,  3296,  7110,
+     7094,  2481,  9919,  8193,  8653,  4885, 11813,  6250,
+     4372,  3833,  9103, 11885,  7370,  2678, 11618,  7313,
+     9984, 11935,  2686, 10377,  1663, 10849,  2178,  9302,
+     4057, 11222,  1153,  7012, 12129,   242,  2399,  7278,
+    10805,  2859,  3510,  5444,  9585,  1632,  4905,  2566,
+     4414,   390, 10163,  1065,  8374,   545,  3016, 11414,
+     8236,  6591,  8311, 11854,  1426,  3066,  6730,  3646,
+     8925, 11847,  4048, 11082,  4437,  7575,  3136,  5088,
+     9509,  7277,  9424,   493,  4938, 11272,  8758,  2422,
+     2174,  3778,  6882,  4645, 12176,  3704,  3000,  1607,
+     7247,  4861,  3247, 10911,  1777,  8526,  1544,  6267,
+     3271,  7188,  9405, 11121,  9140,  1537,  8889, 11287,
+     4895,  1045,  5332,  2381,  6998,  5084,  3985, 10102,
+     2847, 11516,  1630,  2143, 10123,  7270, 12046,  8509,
+     2645,  2912,  2969,  7952,  7635, 12262, 11869,  9852,
+     1689,  9888,  2249,  9041, 12286,  8146,  5191,  4284,
+     8209,  9364,  6171,  3656,  5874, 10446,  1254, 10929,
+    11314,  2057,  5315,  1958,  3482,   418,  3643, 11964,
+     4782,  5868,  4749,  5257,  8332,  9407,  3988,  1594,
+     1956,  1583,  9945, 10970,  7232,  9522,  8724,   652,
+     4624,  3315,  7753,  6507,  3174,  2908,  8410,  9734,
+     1105, 10777,  2169,  1058,  9162, 10996,  7341,  8561,
+    11785,   723,  4449,  3054, 11858,  2447,  6950, 12121,
+      241,  1483,  1018,  8049,  4912,  6413, 12233,  8273,
+     8687,  8532,  2683,  9830,  6234,  8174,  6854,  6992,
+     2844,  9087,  7373,  2078,  6821,  6381,  6427,   948,
+     3029,  6554,  4789,  6370,  2127, 10335,   316,  5106,
+     6281,  9789, 10316,   709,  3445,  8298,  1702,  6190,
+     3263,  7535,  8429,  9341,  2766,  8760, 10256,  5184,
+     6608,  6906,  7210,   922,  2920,  7515,  1728,  6299,
+     2302, 10596,  8500,  9166,  2505,   576,  6196,  8960,
+     3532, 11026, 11248,   835,   192, 10258,  7083,  9370,
+    11868, 11942,  8471,    64, 11612,  2361, 11316,  3956,
+     8077,  6920,  8214,  7967,   787,  3772,  5415, 10885,
+     6403,  2738,  6752,  8455,  9450,  1805, 11821, 10327,
+     5009,  6347, 11011,  3150,  4698, 12133, 11635,  5766,
+     6212, 11863,  1050,  1566, 12237, 12071,  1922,  6167,
+    12147,   350,   522,  4079,  8120,  4737,  6152,  4049,
+     4213,   174,  5456,  6803,  1579,  6147,  5446,  9597,
+       58,  5915,  6364,  8719,  2049, 10008,  3199,  8212,
+     6068, 10314, 11099,   683,  3336,  9259, 10930,  6119,
+     3438,  7796,  4324,  1112, 11279, 11836,  6136,  1146,
+     6695,  9634,  4467,  7856, 12138, 10238,   382,  6328,
+    11404,  1489,  6715,  4046,  7509,  8320, 10302, 11994,
+     8689, 10431,  5445,  2503, 10966,  3434,  3998, 11089,
+     3477,  1815,  9027, 11848,  5241,  5429, 11889,  1159,
+      605,  3009, 12142,  1747,  5906,  3963,  8579,  4298,
+     1003, 12240,  8775,  6065,  1321,  6956,  5529,  8527,
+     1014,  4273,  4251,  7988, 11677,  2293,  8778,  8195,
+     2769,  8360,  5464, 11415,  2110,  5789,   338,  9617,
+     1417,  6759, 12085,  8957,  2926,  6828,   923,  6883,
+    10014,  3805,  8896,  6026,  4209,  7302,  8665,  2253,
+    12221,  7082,  9168,  2276,  4404, 10487,  3338,  9461,
+    11158,  6105,  1403,  2434, 11081,   751,  8170,  6457,
+     3056,  4855,  1468,  7592,  5209,  7250, 11912,  2035,
+     4564,  9004,  7790,  8443, 10916, 10345,  5115,  9811,
+     8682,  6627,  9929,  6513,  8067,  8871,  9714, 11194,
+     6693, 11007,  7735, 11641,  1705, 11463,  2894,  2209,
+     7406,  2171,  2689,  2957,  3238, 11924,  2231,  3669,
+    10771, 12073,  8761,  3821,  5061,  8929,  6565,  4820,
+     9089,  5082,  9272,  8071,  4840,  1223, 11783, 12217,
+    11113,  5370,  1687, 11169, 10381,  5703,  7126,  1694,
+     7187, 10883,  9806,  4504,  8024, 12265, 11897,  1790,
+     8755,  3723, 11653,  1901, 10568,  4661,  6492,  7724,
+     7365,  9694,  6771, 12281,  8062,  4693, 11111,  1241,
+    12077,  4730,  7619,  5650,  2164,  6671,  2455, 11424,
+     2257,  8190, 10880,  9757,  7800,  4510,  8122,  5673,
+     6636, 10076,  8914,  6320,  9011,  3808,  8945,  2730,
+     7723, 11445,  2600,  9696, 10900,  1891,  2212,  7455,
+    11164,  6203,  7100,  9462,  7078,   910, 10767,  3815,
+     4963,  3232, 11826,  8823,  8930,  2485, 11914,  6164,
+     6463,  3154, 10552,  8496,  3589,  5368,  9847,  9270,
+     3942,  2941,  7073,  9021, 12164,  6151, 10347,  9244,
+    11710,  2832,  9389,  9982, 11475,  3090,  1314,  9173,
+     6454,  3007,  8151, 10243,  3449, 11274, 12096,   944,
+     7226, 11520,  3825,  1030,   438,  7154, 10344,  9195,
+     2717, 11607,  5246,  3758,  4032,  4411,  6505,  3840,
+     1275,  8536,   146,  6481,  3448,  3065,  5002,  3869,
+     5845,  5349,  1344,  9663, 10361,  1280,   425, 11038,
+     4145, 10353,  9342,  5118,  9860,  5386, 10141,  1783,
+      448,  3221,  7550,  4523,  4238, 11872,  5478,  3451,
+     3114,  1706,  7383,  9988, 11573,  8787,  8342,  5170,
+     6613,  5604,  5509, 12150,  1826,  9343,  1038,  4665,
+     2461, 11522,  7954,  2929,  6877,  9916, 10397,  1868,
+    10029,  4050,  4705, 11307,   346,  1555,  9013,  7937,
+    10844,  9169, 10485, 11498,  7562,  4719,  3343,  1350,
+     9761,  3769,  8308,  8711, 11197,  6742,  7711, 11249,
+     3495,  7929,  6617,  1573,  9307,   450,  7350,  9449,
+    10962,  7000, 11925, 10440, 10763,  7846,  1165,  2643,
+     6302,  8717, 11295,   150,  2450,  7246,  3654, 10526,
+     3975,  3480,  7684, 10808,  8581,   881,  6197,  7002,
+     3765,    50,  4913, 10608,  1218,  7605,  1325,  1160,
+    10754,  7699, 11053,  4390,  6162,  2334,  1255,  4113,
+     5734,  3536,   406,  2535,  4538,  4483,  7681, 10759,
+    11877,  9656,  2054,   778,  8611,  1371, 10104,  5275,
+     8328,   845,  5609,  9687, 10753, 11779,  3959,  7315,
+     4781,  8452, 11063,   457,  3368,  9951,  2776,  4378,
+     5966,  3229, 11777, 12119,  5416, 10631,  5690, 11010,
+     7784,  8345,  5219,  3317,  9118,  9652,  6085,  9269,
+     8022,  8136,  9998,  7640,  5993,  3670,  6691,  6878,
+     5836,  5202, 11232, 11410, 10221,  7186,  2674,  2712,
+     7429,  6643,  6094,  9416, 10423,  6389, 10138,  1734,
+     3744, 11996,  3407, 10588,  9084,   904, 10669, 10407,
+    10224,  7235, 11667,  6226, 11572,   578,  1248,  8095,
+     5232, 11722,  3028,  8494, 11749,  3469,  3408,  6508,
+     3889, 10268, 12050,  4289,   416, 10891,  1744, 12100,
+     9202, 11024, 12109,  9349,  1136, 10362,  9489,  7519,
+     8113,  5526,  4235, 11823,  8774, 12226, 11260,  7771,
+    12229, 11309,  4475,  3454,  3163, 10699, 10897,  1842,
+     5508,  3941,  7021, 12268, 11946, 10783, 12269,  7866,
+     5588,  9344,  9247, 11759, 11825,   614,  1836,  5410,
+    10533, 12282,  3982, 11787,  8186,  2622,  5959,  7211,
+    // Shoup companions
+             0,  516905902, 1413015931, 2496456293, 2290253128, 3838873852, 2850147147, 4042630540,
+    3871377063, 3057049307, 1116642567, 3029439052,  575271882, 3070330189, 2246915513,  889469588,
+    2258099414, 3372645000, 1163125653, 3335947826, 2690427068, 3377537956, 3822796995, 1039753251,
+    2539444411, 1684924512, 2275923755, 3244379641, 2001918192,  331672549, 1739795524,  196766749,
+     826909644, 4018864751, 2807858023, 3923801597, 2785140726, 3176227747,  253734743, 2997634835,
+    1711136779,  408911362,  571427417, 2615634733, 3214672405, 3831534418, 3647349556, 3334899335,
+    3228652280, 3961197764, 3883609455,  801745868,  349496891, 3241583665, 1611530165, 1095672753,
+    1035559288, 3484484005, 3327559901, 3053204841, 4266658047, 1777541188, 4246037731, 1693661934,
+     482655206, 3795885735,  289033929,  954476009, 3432408968, 3591430054, 1878196293, 2816245949,
+    1743639990, 2283612687, 4253726662, 1208909746, 4127208788, 2515329125, 2739007136, 3680202264,
+    1459848514,  847879458,  333070537, 2065876123,  190126308, 3162247871,   45434595,  124071396,
+    1495147700, 2761374937,  767844669, 4244290246,  357185822, 3288066752, 1380163223, 1291041516,
+     882479650,  592746727, 2279418724, 2920745519, 4176487849, 3145472020, 3303444615, 3404449217,
+    1863167927, 1618869600, 3429612993, 1271120193,  993270164,  730099005,  837394551, 1295584975,
+    3042370437, 4178235334, 2985052947, 1709039797, 2023936496, 4040184062, 2773257831, 3112968809,
+    3710258997, 3854601213, 1770900747, 2358055524, 4291821823, 1147747790, 1151941753, 2484922896,
+    2479330946,  867101787, 3466659663, 2863428029, 3024196599, 1707292313, 4128606775, 2184355570,
+    1528000408, 1339621583, 3181470200, 4153770551, 2575792088,  935952674, 4060454882, 2555870765,
+    3489376961, 4171245396,  938748649, 3626729240,  581213330, 3791691772,  761204229, 3251020081,
+    1417908887, 3922054113,  402969915, 2450672201, 4239047793,   84578247,  838443041, 2543638374,
+    3776313909,  999211611, 1226734088, 1902661075, 3349927702,  570378926, 1714282251,  896809022,
+    1542679277,  136303787, 3551936905,  372214189, 2926686966,  190475805, 1054082623, 3989157516,
+    2878456395, 2303534009, 2904668662, 4142936148,  498382566, 1071557468, 2352114077, 1274265665,
+    3119259753, 4140489670, 1414763415, 3873124548, 1550717706, 2647438950, 1096022250, 1778240182,
+    3323365938, 2543288877, 3293658702,  172301967, 1725815648, 3939528957, 3060893773,  846481470,
+     759806241, 1320399254, 2405237605, 1623413059, 4255474147, 1294536485, 1048490673,  561641504,
+    2532803970, 1698904388, 1134816405, 3813360579,  621055975, 2979810494,  539623200, 2190297017,
+    1143204331, 2512183653, 3287018261, 3886754927, 3194401585,  537176721, 3106677865, 3944771411,
+    1710787282,  365224251, 1863517423,  832152097, 2445779244, 1776842194, 1392745111, 3530617594,
+     995017649, 4024806199,  569679932,  748971837, 3537957029, 2540842399, 4210039551, 2973869047,
+     924419277, 1017734947, 1037656269, 2779199278, 2668408764, 4285530879, 4148178601, 3443243372,
+     590300249, 3455825260,  786018508, 3159801393, 4293918805, 2847001675, 1814238362, 1497244681,
+    2869019979, 3272688889, 2156745315, 1277760634, 2052944738, 3650844525,  438269101, 3819651523,
+    3954207827,  718915105, 1857575976,  684314912, 1216948175,  146089700, 1273217174, 4181380806,
+    1671294133, 2050847757, 1659760736, 1837305157, 2912008097, 3287717255, 1393793602,  557098044,
+     683615919,  553253578, 3475746583, 3833980896, 2527561517, 3327909398, 3049010878,  227871973,
+    1616073624, 1158582194, 2709649397, 2274176271, 1109303132, 1016336959, 2939268855, 3402002738,
+     386194064, 3766527996,  758058757,  369767710, 3202090517, 3843067815, 2565656678, 2992042885,
+    4118820862,  252686252, 1554911668, 1067363505, 4144334135,  855218892, 2429003393, 4236251818,
+      84228750,  518303889,  355787835, 2813100477, 1716728729, 2241323563, 4275395470, 2891387780,
+    3036079493, 2981907475,  937700159, 3435554440, 2178763619, 2856787588, 2395451692, 2443682263,
+     993969158, 3175878250, 2576840578,  726254539, 2383918294, 2230139662, 2246216519,  331323052,
+    1058626083, 2290602624, 1673740611, 2226295196,  743379887, 3612050370,  110441017, 1784531126,
+    2195189973, 3421225067, 3605409929,  247793295, 1204016790, 2900125203,  594843708, 2163385756,
+    1140408355, 2633459075, 2945909295, 3264650460,  966708401, 3061592766, 3584440116, 1811791883,
+    2309475457, 2413625530, 2519872585,  322236133, 1020530922, 2626469137,  603930627, 2201480917,
+     804541843, 3703269059, 2970723575, 3203488504,  875489712,  201310209, 2165482737, 3131492145,
+    1234423019, 3853552722, 3931141032,  291829904,   67103403, 3585139109, 2475486480, 3274785870,
+    4147829104, 4173691874, 2960588165,   22367801, 4058357900,  825162160, 3954906820, 1382609701,
+    2822886390, 2418518487, 2870767464, 2784441732,  275054053, 1318302273, 1892525665, 3804273660,
+    2237828594,  956922488, 2359803009, 2954996215, 3302745621,  630841888, 4131402750, 3609254395,
+    1750629928, 2218256768, 3848310269, 1100915207, 1641936394, 4240445780, 4066396329, 2015199074,
+    2171074688, 4146081620,  366971735,  547312131, 4276793457, 4218776973,  671733024, 2155347328,
+    4245338737,  122323911,  182437377, 1425597819, 2837914756, 1655566773, 2150104874, 1415112912,
+    1472430402,   60812459, 1906855038, 2377627350,  551855591, 2148357390, 1903360069, 3354121664,
+      20270819, 2067274111, 2224198215, 3047263394,  716119130, 3497764887, 1118040554, 2870068470,
+    2120747135, 3604710935, 3879065995,  238706376, 1165921629, 3235991715, 3820001020, 2138571477,
+    1201570311, 2724677763, 1511224557,  388640543, 3941975435, 4136645204, 2144512924,  400523437,
+    2339881686, 3367053049, 1561202613, 2745647577, 4242193265, 3578149172,  133507812, 2211616327,
+    3985662547,  520400871, 2346871624, 1414064421, 2624372156, 2907814134, 3600516973, 4191865713,
+    3036778487, 3645602072, 1903010572,  874790718, 3832582908, 1200172324, 1397288571, 3875571026,
+    1215200690,  634336857, 3154908436, 4140839166, 1831713206, 1897418622, 4155168539,  405066896,
+     211445619, 1051636145, 4243591252,  610571068, 2064128639, 1385056179, 2998333829, 1502137638,
+     350545381, 4277841948, 3066835220, 2119698645,  461685393, 2431100375, 1932368311, 2980159991,
+     354389847, 1493400216, 1485711284, 2791781166, 4081075198,  801396371, 3067883710, 2864127023,
+     967756891, 2921794010, 1909651013, 3989507013,  737438440, 2023237503,  118129949, 3361111602,
+     495237094, 2362249487, 4223669930, 3130443654, 1022627903, 2386364773,  322585630, 2405587102,
+    3499861868, 1329835671, 3109124344, 2106068266, 1471032415, 2552026299, 3028390562,  787416495,
+    4271201507, 2475136983, 3204187498,  795454924, 1539184308, 3665173898, 1166620622, 3306590087,
+    3899686312, 2133678520,  490344138,  850675433, 3872775051,  262472165, 2855389601, 2256701426,
+    1068062499, 1696807406,  513061436, 2653380398, 1820529306, 2533852461, 4163206968,  711226173,
+    1595103811, 3146870008, 2722580782, 2950802252, 3815108064, 3615545339, 1787676598, 3428913999,
+    3034332009, 2316115898, 3470154632, 2276273252, 2819391421, 3100386921, 3395012801, 3912268200,
+    2339182692, 3846912281, 2703358453, 4068493310,  595892199, 4006282863, 1011444003,  772038632,
+    2588373976,  758757750,  939797140, 1033462307, 1131670933, 4167400930,  779727564, 1282304093,
+    3764431015, 4219475967, 3061942263, 1335427621, 1768803766, 3120657741, 2294447090, 1684575015,
+    3176577244, 1776143201, 3240535175, 2820789408, 1691564953,  427434697, 4118121869, 4269803519,
+    3883958951, 1876798305,  589601255, 3903530777, 3628127227, 1993180770, 2490514846,  592047733,
+    2511834157, 3803574666, 3427166515, 1574133997, 2804363055, 4286579370, 4157964514,  625599435,
+    3059845282, 1301176925, 4072687273,  664393590, 3693483146, 1629005009, 2268933817, 2699513987,
+    2574044603, 3388022863, 2366443450, 4292171320, 2817643936, 1640188910, 3883259958,  433725641,
+    4220873955, 1653120295, 2662816814, 1974657435,  756311272, 2331493761,  858014867, 3992652485,
+     788814483, 2862379538, 3802526176, 3410041167, 2726075751, 1576230979, 2838613750, 1982695863,
+    2319261370, 3521530675, 3115415288, 2208820352, 3149316486, 1330884161, 3126249691,  954126512,
+    2699164490, 3999991919,  908691917, 3388721857, 3809516114,  660898621,  773087123, 2605499323,
+    3901783293, 2167929216, 2481427927, 3306939584, 2473738995,  318042170, 3763033027, 1333330639,
+    1734553071, 1129573952, 4133150235, 3083611071, 3121007238,  868499774, 4163905961, 2154298837,
+    2258798407, 1102313194, 3687891195, 2969325587, 1254344342, 1876099311, 3441495887, 3239836181,
+    1377716745, 1027870357, 2471991511, 3152811455, 4251280184, 2149755377, 3616244333, 3230749262,
+    4092608595,  989775195, 3281426311, 3488677967, 4010476826, 1079945393,  459238915, 3205934983,
+    2255652935, 1050937151, 2848749160, 3579896656, 1205414777, 3940227951, 4227514395,  329925065,
+    2525464535, 4026204186, 1336825608,  359981797,  153079638, 2500300759, 3615195842, 3213623914,
+     949583053, 4056610416, 1833460691, 1313409317, 1409171465, 1541630787, 2273477277, 1342068062,
+     445608536, 2983305463,   51026546, 2265089351, 1205065280, 1071207971, 1748183449, 1352203472,
+    2042809329, 1869458871,  469723821, 3377188459, 3621137289,  447356020,  148536178, 3857746685,
+    1448664614, 3618341314, 3264999957, 1788725089, 3446039347, 1882390256, 3544247973,  623152957,
+     156574607, 1125729486, 2638701528, 1580774438, 1481167824, 4149227092, 1914543970, 1206113771,
+    1088333319,  596241696, 2580335547, 3490774949, 4044727521, 3071029183, 2915503066, 1806898927,
+    2311222941, 1958580578, 1925378373, 4246387228,  638181323, 3265349454,  362777773, 1630402997,
+     860111849, 4026903180, 2779898272, 1023676394, 2403490120, 3465611173, 3633719177,  652860192,
+    3505104321, 1415462409, 1644382873, 3951761348,  120925924,  543467665, 3150015480, 2773956825,
+    3789944288, 3204536995, 3664474904, 4018515255, 2642895491, 1649275829, 1168368107,  471820803,
+    3411439155, 1317253782, 2903620172, 3044467419, 3913316690, 2356308040, 2694970528, 3931490529,
+    1221491634, 2771160850, 2312620929,  549758609, 3252767566,  157273601, 2568802150, 3302396124,
+    3831184921, 2446478238, 4167750427, 3648747544, 3761635040, 2742152608,  407163878,  923720283,
+    2202529408, 3046564400, 3947567386,   52424533,  856267383, 2532454473, 1277061640, 3678804276,
+    1389250142, 1216249181, 2685534112, 3777362400, 2999032823,  307906761, 2165832234, 2447177232,
+    1315855795,   17474844, 1717078226, 3707463021,  425687213, 2657923857,  463083380,  405416393,
+    3758489568, 2690776565, 3862989138, 1534291352, 2153599843,  815725744,  438618598, 1437480713,
+    2004015174, 1235821007,  141895737,  885974619, 1586016892, 1566794563, 2684485621, 3760237052,
+    4150974576, 3374741981,  717866614,  271908581, 3009517730,  479160237, 3531316588, 1843596101,
+    2910610109,  295324873, 1960328062, 3385576385, 3758140071, 4116723881, 1383658192, 2556569759,
+    1670944636, 2953947724, 3866484107,  159720079, 1177105529, 3477843564,  970203369, 1530097389,
+    2085098452, 1128525461, 4116024887, 4235552824, 1892875162, 3715501450, 1988637310, 3847960772,
+    2720483801, 2916551557, 1824024275, 1159281188, 3186712653, 3373343993, 2126688582, 3239486684,
+    2803664061, 2843506706, 3494269918, 2670156248, 2094534868, 1282653590, 2338483699, 2403839617,
+    2039663857, 1818082828, 3925549081, 3987759528, 3572207724, 2511484660,  934554687,  947835568,
+    2596412404, 2321707848, 2129834054, 3290862727, 3642806097, 2232935637, 3543199483,  606027609,
+    1308516360, 4192564706, 1190735908, 3700473084, 3174829759,  315945189, 3728782332, 3637214146,
+    3573256215, 2528610007, 4077580229, 2175967644, 4044378025,  202009203,  436172120, 2829177334,
+    1828567734, 4096802558, 1058276586, 2968626593, 4106238974, 1212404715, 1191085405, 2274525767,
+    1359193409, 3588634078, 4211437539, 1498992166,  145390706, 3806370642,  609522578, 4228912383,
+    3216070392, 3852853728, 4232057855, 3267446435,  397028468, 3621486786, 3316376000, 2627867124,
+    2835468278, 1931319820, 1480119334, 4132101744, 3066485723, 4272948991, 3935334994, 2715940341,
+    4273997482, 3952460342, 1563998588, 1207162262, 1105458666, 3739267238, 3808467623,  643773273,
+    1925028876, 1377367248, 2453817673, 4287627861, 4175089862, 3768624977, 4287977358, 2749142546,
+    1952988628, 3265698951, 3231797752, 4109733943, 4132800738,  214591091,  641676292, 1890778181,
+    3681250755, 4292520817, 1391696620, 4119519856, 2860981551,  916380848, 2082651974, 2520222082,
+};
+
+const uint32_t ntt_harvey1024_mixed_powers_rev[2048] = {
+        0,  1479,  4043,  7143,  6553,  8155, 10984, 11567,
+    11077,  1646,  3195,  6429,  8747,  8785,  8668,  2545,
+     6461,  7266,  7698,  5728,  3328,  6512, 10938,  4978,
+     9650,  4821,  9664,   949,  9545,  9283,  2975,   563,
+     2366,  9238,  4896,  2963,  7969,  1000,  9198, 12208,
+     8034, 11112,  1635,  9521,   726,  4611, 10436, 12149,
+    11499, 11334,  1170,  9970,  9088,  9275, 10963,  5086,
+    11227,  2294,  7484,  8736,  8577,  3135,  9542,  4846,
+     1381,  2525,  4177,  8705,  4989,  5331,  4278, 10616,
+     9821, 11950,   544,  5791, 11809,  2842,  1022, 12280,
+      827,  6522,   953,  8541, 12171,  9813,  2197,  5067,
+     5374,  9452,   130,  7935,  7837,  2396,  3949,  3296,
+    10861,  1696,  2426, 11955,  6534,  4632,  7901, 11029,
+    10276,  9000,  9048, 11560,  7197,  2089,  9408,  3284,
+     2731,  8357,  5911,  4890,  3459,  3637, 12144,  6747,
+     8058,  9741,   355,  8907, 10530,  3707,  3694,  7110,
+     7094,  9509, 10805,  4895,  9984,  7247,  8236,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271,  8925,  1689,
+     8653,  4938,  9585,  6998,  1663,  1777,  1426,  7635,
+     7370, 12176,  8374, 10123, 12129,  9140,  4437, 12286,
+     9919,  9424,  3510,  5332,  2686,  3247,  8311,  2969,
+     9103,  6882, 10163,  1630,  1153,  9405,  4048,  2249,
+    11813,  8758,  4905,  3985,  2178,  1544,  6730, 11869,
+    11618,  3000,  3016, 12046,  2399,  8889,  3136,  5191,
+     2481,  7277,  2859,  1045, 11935,  4861,  6591,  2912,
+     3833,  3778,   390, 11516, 11222,  7188, 11847,  9888,
+     4885, 11272,  1632,  5084, 10849,  8526,  3066, 12262,
+     2678,  3704,   545,  7270,   242,  1537,  7575,  8146,
+     8193,   493,  5444,  2381, 10377, 10911, 11854,  7952,
+    11885,  4645,  1065,  2143,  7012, 11121, 11082,  9041,
+     6250,  2422,  2566, 10102,  9302,  6267,  3646,  9852,
+     7313,  1607, 11414,  8509,  7278, 11287,  5088,  4284,
+     8209, 11868,  8687,  6068,  4624,  6212,  3263,  8689,
+     4782,  6403,  3029,  6695, 11785,  4213,  2302,   605,
+    11314,  8077,  2844,  3438,  1105, 12147,  6608,  3477,
+     1956,  5009,  6281, 11404,   241,    58,  3532,  1003,
+     5874, 11612,  6234,  3336,  3174, 12237,  2766, 10966,
+     8332,  9450,  2127, 12138, 11858,  1579,  2505,  5906,
+     3482,   787,  6821, 11279,  9162,  8120,  2920,  5241,
+     7232,  4698,  3445,  7509,  4912,  2049,   192,  1321,
+     6171,  8471,  2683, 11099,  7753,  1050,  8429,  5445,
+     4749,  6752,  4789,  4467,  4449,  5456,  8500, 12142,
+     5315,  8214,  7373,  4324,  2169,   522,  7210,  9027,
+     9945, 11011, 10316,  6715,  1018,  6364, 11248,  8775,
+     1254, 11316,  6854, 10930,  8410,  1922, 10256,  3998,
+     3988, 11821,   316,   382,  6950,  5446,  6196,  8579,
+     3643,  5415,  6427,  6136,  7341,  6152,  1728, 11889,
+     8724, 11635,  1702, 10302, 12233,  3199,  7083,  5529,
+     9364, 11942,  8532, 10314,  3315, 11863,  7535, 10431,
+     5868,  2738,  6554,  9634,   723,   174, 10596,  3009,
+     2057,  6920,  9087,  7796, 10777,   350,  6906,  1815,
+     1583,  6347,  9789,  1489,  1483,  5915, 11026, 12240,
+    10446,  2361,  8174,  9259,  2908, 12071,  8760,  3434,
+     9407,  1805, 10335, 10238,  2447,  6147,   576,  3963,
+      418,  3772,  6381, 11836, 10996,  4737,  7515,  5429,
+     9522, 12133,  8298,  8320,  6413, 10008, 10258,  6956,
+     3656,    64,  9830,   683,  6507,  1566,  9341,  2503,
+     5257,  8455,  6370,  7856,  3054,  6803,  9166,  1747,
+     1958,  7967,  2078,  1112,  1058,  4079,   922, 11848,
+    10970,  3150,   709,  4046,  8049,  8719,   835,  6065,
+    10929,  3956,  6992,  6119,  9734,  6167,  5184, 11089,
+     1594, 10327,  5106,  6328, 12121,  9597,  8960,  4298,
+    11964, 10885,   948,  1146,  8561,  4049,  6299,  1159,
+      652,  5766,  6190, 11994,  8273,  8212,  9370,  8527,
+     1014,   448,  7365,  4781,  8682, 10962,  3942,  5232,
+    12221, 10029,  7723,  5836,  9089, 10754,  2717, 12229,
+     1417,  6613,  2257,  7784,  7406,  3975,  6454,  9202,
+     3056,  9761,  4963,  3744,  7187, 11877,  5845,  5588,
+     2769,  3114, 12077,  5966,  6693,  6302, 11710,  3889,
+    11158, 10844, 11164,  7429, 11113,  5734,  1275,  5508,
+    10014,  2461,  6636,  8022, 10771,  3765,  7226,  8113,
+     4564,  3495,  6463, 10224,  8755,  8328,  4145, 10533,
+    11677,  4238,  8062,  3368,  8067, 10763, 12164, 11749,
+     4404,   346, 10900, 10221,  4840,  6162,  4032,  3163,
+     2926,  1826,  7800,  9118,  3238,  8581,  3449,  1136,
+     5209, 11197,  8930,  9084,  8024,  8611, 10361, 11825,
+     2110, 11573,  2164,  5416,  1705,  2450, 11475,   416,
+    11081,  7562,  7078, 10423, 10381,  4538,  3448, 11946,
+     4209,  6877,  9011,  5993,  5061,  1218,   438,  8774,
+    10916,  9307,  3589, 11572, 10568, 10753,  9860,  8186,
+     4251,  7550,  6771, 11063,  9929, 11925,  7073,  3028,
+     9168,  4705,  2600, 11232,  9272, 11053,  5246,  4475,
+    12085,  5509, 10880,  5219,  2689,  7684,  8151, 12109,
+     1468,  8308, 11826,  3407,  9806,  2054,  1344,  9247,
+     5464,  7383,  7619, 11777,  7735, 11295,  9389, 12050,
+     1403, 10485,  7100,  6094,  1687,   406,   146,  7021,
+     8896,  7954,  8914,  9998,  8761,  4913,  3825,  4235,
+     7790,  6617, 10552, 11667, 11653,  5609,  9342,  3982,
+     8778,  5478, 11111,  2776,  9714,  1165, 10347,  3408,
+     3338,  9013,  2212,  2674, 11783,  1255,  6505, 10897,
+      923,  1038,  8122,  6085,  2231,  6197, 12096,  9489,
+    11912,  7711, 11914, 10669, 11897, 10104,   425,  1836,
+      338,  8342,  2455,  5690,  2894,  3654,  1314,  1744,
+     8170,  3343, 10767, 10138,  7126,  7681,  5002, 12269,
+     8665, 10397,  8945,  6691,  6565,  1325, 10344, 11260,
+     5115,  7350,  9847,  1248,  6492,  3959, 10141,  5959,
+     4273,  3221,  9694,  8452,  6627,  7000,  2941, 11722,
+     7082,  4050, 11445,  5202,  5082,  7699, 11607, 11309,
+     6759,  5604,  8190,  8345,  2171,  3480,  3007, 11024,
+     4855,  3769,  3232, 11996, 10883,  9656,  5349,  9344,
+     8360,  1706,  4730,  3229, 11007,  8717,  2832, 10268,
+     6105,  9169,  6203,  6643,  5370,  3536,  8536,  3941,
+     3805, 11522, 10076,  8136, 12073,    50, 11520,  5526,
+     9004,  7929,  3154,  7235,  3723,   845, 10353, 12282,
+     2293, 11872,  4693,  9951,  8871,  7846,  6151,  3469,
+    10487,  1555,  1891,  7186,  1223,  2334,  4411, 10699,
+     6828,  9343,  4510,  9652, 11924,   881, 11274, 10362,
+     7250,  6742,  2485,   904, 12265,  1371,  1280,   614,
+     5789,  8787,  6671, 10631, 11463,  7246,  3090, 10891,
+      751,  4719,   910,  6389,  5703,  4483,  3065, 10783,
+     7302,  9916,  3808,  3670,  8929,  7605,  7154, 12226,
+    10345,   450,  5368,   578,  4661, 11779,  5386,  2622,
+     7988,  4523, 12281,   457,  6513, 10440,  9021,  8494,
+     2276, 11307,  9696, 11410,  8071,  4390,  3758,  3454,
+     8957, 12150,  9757,  3317,  2957, 10808, 10243,  9349,
+     7592,  8711,  8823, 10588,  4504,   778,  9663, 11759,
+    11415,  9988,  5650, 12119, 11641,   150,  9982,  4289,
+     2434, 11498,  9462,  9416, 11169,  2535,  6481, 12268,
+     6026,  2929,  6320,  7640,  3821, 10608,  1030, 11823,
+     8443,  1573,  8496,  6226,  1901,  9687,  5118, 11787,
+     8195,  3451,  1241,  4378, 11194,  2643,  9244,  6508,
+     9461,  7937,  7455,  2712, 12217,  4113,  3840,  1842,
+     6883,  4665,  5673,  9269,  3669,  7002,   944,  7519,
+     2035, 11249,  6164, 10407,  1790,  5275, 11038,  5410,
+     9617,  5170, 11424, 11010,  2209, 10526,  9173, 12100,
+     6457,  1350,  3815,  1734,  1694, 10759,  3869,  7866,
+     2253,  1868,  2730,  6878,  4820,  1160,  9195,  7771,
+     9811,  9449,  9270,  8095,  7724,  7315,  1783,  7211,
+    // Shoup companions
+             0,  516905902, 1413015931, 2496456293, 2290253128, 2850147147, 3838873852, 4042630540,
+    3871377063,  575271882, 1116642567, 2246915513, 3057049307, 3070330189, 3029439052,  889469588,
+    2258099414, 2539444411, 2690427068, 2001918192, 1163125653, 2275923755, 3822796995, 1739795524,
+    3372645000, 1684924512, 3377537956,  331672549, 3335947826, 3244379641, 1039753251,  196766749,
+     826909644, 3228652280, 1711136779, 1035559288, 2785140726,  349496891, 3214672405, 4266658047,
+    2807858023, 3883609455,  571427417, 3327559901,  253734743, 1611530165, 3647349556, 4246037731,
+    4018864751, 3961197764,  408911362, 3484484005, 3176227747, 3241583665, 3831534418, 1777541188,
+    3923801597,  801745868, 2615634733, 3053204841, 2997634835, 1095672753, 3334899335, 1693661934,
+     482655206,  882479650, 1459848514, 3042370437, 1743639990, 1863167927, 1495147700, 3710258997,
+    3432408968, 4176487849,  190126308, 2023936496, 4127208788,  993270164,  357185822, 4291821823,
+     289033929, 2279418724,  333070537, 2985052947, 4253726662, 3429612993,  767844669, 1770900747,
+    1878196293, 3303444615,   45434595, 2773257831, 2739007136,  837394551, 1380163223, 1151941753,
+    3795885735,  592746727,  847879458, 4178235334, 2283612687, 1618869600, 2761374937, 3854601213,
+    3591430054, 3145472020, 3162247871, 4040184062, 2515329125,  730099005, 3288066752, 1147747790,
+     954476009, 2920745519, 2065876123, 1709039797, 1208909746, 1271120193, 4244290246, 2358055524,
+    2816245949, 3404449217,  124071396, 3112968809, 3680202264, 1295584975, 1291041516, 2484922896,
+    2479330946, 3323365938, 3776313909, 1710787282, 3489376961, 2532803970, 2878456395,  924419277,
+    1528000408,  759806241, 1542679277,  995017649, 1417908887, 1143204331, 3119259753,  590300249,
+    3024196599, 1725815648, 3349927702, 2445779244,  581213330,  621055975,  498382566, 2668408764,
+    2575792088, 4255474147, 2926686966, 3537957029, 4239047793, 3194401585, 1550717706, 4293918805,
+    3466659663, 3293658702, 1226734088, 1863517423,  938748649, 1134816405, 2904668662, 1037656269,
+    3181470200, 2405237605, 3551936905,  569679932,  402969915, 3287018261, 1414763415,  786018508,
+    4128606775, 3060893773, 1714282251, 1392745111,  761204229,  539623200, 2352114077, 4148178601,
+    4060454882, 1048490673, 1054082623, 4210039551,  838443041, 3106677865, 1096022250, 1814238362,
+     867101787, 2543288877,  999211611,  365224251, 4171245396, 1698904388, 2303534009, 1017734947,
+    1339621583, 1320399254,  136303787, 4024806199, 3922054113, 2512183653, 4140489670, 3455825260,
+    1707292313, 3939528957,  570378926, 1776842194, 3791691772, 2979810494, 1071557468, 4285530879,
+     935952674, 1294536485,  190475805, 2540842399,   84578247,  537176721, 2647438950, 2847001675,
+    2863428029,  172301967, 1902661075,  832152097, 3626729240, 3813360579, 4142936148, 2779199278,
+    4153770551, 1623413059,  372214189,  748971837, 2450672201, 3886754927, 3873124548, 3159801393,
+    2184355570,  846481470,  896809022, 3530617594, 3251020081, 2190297017, 1274265665, 3443243372,
+    2555870765,  561641504, 3989157516, 2973869047, 2543638374, 3944771411, 1778240182, 1497244681,
+    2869019979, 4147829104, 3036079493, 2120747135, 1616073624, 2171074688, 1140408355, 3036778487,
+    1671294133, 2237828594, 1058626083, 2339881686, 4118820862, 1472430402,  804541843,  211445619,
+    3954207827, 2822886390,  993969158, 1201570311,  386194064, 4245338737, 2309475457, 1215200690,
+     683615919, 1750629928, 2195189973, 3985662547,   84228750,   20270819, 1234423019,  350545381,
+    2052944738, 4058357900, 2178763619, 1165921629, 1109303132, 4276793457,  966708401, 3832582908,
+    2912008097, 3302745621,  743379887, 4242193265, 4144334135,  551855591,  875489712, 2064128639,
+    1216948175,  275054053, 2383918294, 3941975435, 3202090517, 2837914756, 1020530922, 1831713206,
+    2527561517, 1641936394, 1204016790, 2624372156, 1716728729,  716119130,   67103403,  461685393,
+    2156745315, 2960588165,  937700159, 3879065995, 2709649397,  366971735, 2945909295, 1903010572,
+    1659760736, 2359803009, 1673740611, 1561202613, 1554911668, 1906855038, 2970723575, 4243591252,
+    1857575976, 2870767464, 2576840578, 1511224557,  758058757,  182437377, 2519872585, 3154908436,
+    3475746583, 3848310269, 3605409929, 2346871624,  355787835, 2224198215, 3931141032, 3066835220,
+     438269101, 3954906820, 2395451692, 3820001020, 2939268855,  671733024, 3584440116, 1397288571,
+    1393793602, 4131402750,  110441017,  133507812, 2429003393, 1903360069, 2165482737, 2998333829,
+    1273217174, 1892525665, 2246216519, 2144512924, 2565656678, 2150104874,  603930627, 4155168539,
+    3049010878, 4066396329,  594843708, 3600516973, 4275395470, 1118040554, 2475486480, 1932368311,
+    3272688889, 4173691874, 2981907475, 3604710935, 1158582194, 4146081620, 2633459075, 3645602072,
+    2050847757,  956922488, 2290602624, 3367053049,  252686252,   60812459, 3703269059, 1051636145,
+     718915105, 2418518487, 3175878250, 2724677763, 3766527996,  122323911, 2413625530,  634336857,
+     553253578, 2218256768, 3421225067,  520400871,  518303889, 2067274111, 3853552722, 4277841948,
+    3650844525,  825162160, 2856787588, 3235991715, 1016336959, 4218776973, 3061592766, 1200172324,
+    3287717255,  630841888, 3612050370, 3578149172,  855218892, 2148357390,  201310209, 1385056179,
+     146089700, 1318302273, 2230139662, 4136645204, 3843067815, 1655566773, 2626469137, 1897418622,
+    3327909398, 4240445780, 2900125203, 2907814134, 2241323563, 3497764887, 3585139109, 2431100375,
+    1277760634,   22367801, 3435554440,  238706376, 2274176271,  547312131, 3264650460,  874790718,
+    1837305157, 2954996215, 2226295196, 2745647577, 1067363505, 2377627350, 3203488504,  610571068,
+     684314912, 2784441732,  726254539,  388640543,  369767710, 1425597819,  322236133, 4140839166,
+    3833980896, 1100915207,  247793295, 1414064421, 2813100477, 3047263394,  291829904, 2119698645,
+    3819651523, 1382609701, 2443682263, 2138571477, 3402002738, 2155347328, 1811791883, 3875571026,
+     557098044, 3609254395, 1784531126, 2211616327, 4236251818, 3354121664, 3131492145, 1502137638,
+    4181380806, 3804273660,  331323052,  400523437, 2992042885, 1415112912, 2201480917,  405066896,
+     227871973, 2015199074, 2163385756, 4191865713, 2891387780, 2870068470, 3274785870, 2980159991,
+     354389847,  156574607, 2574044603, 1670944636, 3034332009, 3831184921, 1377716745, 1828567734,
+    4271201507, 3505104321, 2699164490, 2039663857, 3176577244, 3758489568,  949583053, 4273997482,
+     495237094, 2311222941,  788814483, 2720483801, 2588373976, 1389250142, 2255652935, 3216070392,
+    1068062499, 3411439155, 1734553071, 1308516360, 2511834157, 4150974576, 2042809329, 1952988628,
+     967756891, 1088333319, 4220873955, 2085098452, 2339182692, 2202529408, 4092608595, 1359193409,
+    3899686312, 3789944288, 3901783293, 2596412404, 3883958951, 2004015174,  445608536, 1925028876,
+    3499861868,  860111849, 2319261370, 2803664061, 3764431015, 1315855795, 2525464535, 2835468278,
+    1595103811, 1221491634, 2258798407, 3573256215, 3059845282, 2910610109, 1448664614, 3681250755,
+    4081075198, 1481167824, 2817643936, 1177105529, 2819391421, 3761635040, 4251280184, 4106238974,
+    1539184308,  120925924, 3809516114, 3572207724, 1691564953, 2153599843, 1409171465, 1105458666,
+    1022627903,  638181323, 2726075751, 3186712653, 1131670933, 2999032823, 1205414777,  397028468,
+    1820529306, 3913316690, 3121007238, 3174829759, 2804363055, 3009517730, 3621137289, 4132800738,
+     737438440, 4044727521,  756311272, 1892875162,  595892199,  856267383, 4010476826,  145390706,
+    3872775051, 2642895491, 2473738995, 3642806097, 3628127227, 1586016892, 1205065280, 4175089862,
+    1471032415, 2403490120, 3149316486, 2094534868, 1768803766,  425687213,  153079638, 3066485723,
+    3815108064, 3252767566, 1254344342, 4044378025, 3693483146, 3758140071, 3446039347, 2860981551,
+    1485711284, 2638701528, 2366443450, 3866484107, 3470154632, 4167750427, 2471991511, 1058276586,
+    3204187498, 1644382873,  908691917, 3925549081, 3240535175, 3862989138, 1833460691, 1563998588,
+    4223669930, 1925378373, 3802526176, 1824024275,  939797140, 2685534112, 2848749160, 4232057855,
+     513061436, 2903620172, 4133150235, 1190735908, 3427166515,  717866614,  469723821, 3231797752,
+    1909651013, 2580335547, 2662816814, 4116024887, 2703358453, 3947567386, 3281426311, 4211437539,
+     490344138, 3664474904, 2481427927, 2129834054,  589601255,  141895737,   51026546, 2453817673,
+    3109124344, 2779898272, 3115415288, 3494269918, 3061942263, 1717078226, 1336825608, 1480119334,
+    2722580782, 2312620929, 3687891195, 4077580229, 4072687273, 1960328062, 3264999957, 1391696620,
+    3067883710, 1914543970, 3883259958,  970203369, 3395012801,  407163878, 3616244333, 1191085405,
+    1166620622, 3150015480,  773087123,  934554687, 4118121869,  438618598, 2273477277, 3808467623,
+     322585630,  362777773, 2838613750, 2126688582,  779727564, 2165832234, 4227514395, 3316376000,
+    4163206968, 2694970528, 4163905961, 3728782332, 4157964514, 3531316588,  148536178,  641676292,
+     118129949, 2915503066,  858014867, 1988637310, 1011444003, 1277061640,  459238915,  609522578,
+    2855389601, 1168368107, 3763033027, 3543199483, 2490514846, 2684485621, 1748183449, 4287977358,
+    3028390562, 3633719177, 3126249691, 2338483699, 2294447090,  463083380, 3615195842, 3935334994,
+    1787676598, 2568802150, 3441495887,  436172120, 2268933817, 1383658192, 3544247973, 2082651974,
+    1493400216, 1125729486, 3388022863, 2953947724, 2316115898, 2446478238, 1027870357, 4096802558,
+    2475136983, 1415462409, 3999991919, 1818082828, 1776143201, 2690776565, 4056610416, 3952460342,
+    2362249487, 1958580578, 2862379538, 2916551557,  758757750, 1216249181, 1050937151, 3852853728,
+    1696807406, 1317253782, 1129573952, 4192564706, 3803574666, 3374741981, 1869458871, 3265698951,
+    2921794010,  596241696, 1653120295, 1128525461, 3846912281, 3046564400,  989775195, 3588634078,
+    2133678520, 3204536995, 2167929216, 2321707848, 1876798305, 1235821007, 2983305463, 1377367248,
+    1329835671, 4026903180, 3521530675, 2843506706, 4219475967,   17474844, 4026204186, 1931319820,
+    3146870008, 2771160850, 1102313194, 2528610007, 1301176925,  295324873, 3618341314, 4292520817,
+     801396371, 4149227092, 1640188910, 3477843564, 3100386921, 2742152608, 2149755377, 1212404715,
+    3665173898,  543467665,  660898621, 2511484660,  427434697,  815725744, 1541630787, 3739267238,
+    2386364773, 3265349454, 1576230979, 3373343993, 4167400930,  307906761, 3940227951, 3621486786,
+    2533852461, 2356308040,  868499774,  315945189, 4286579370,  479160237,  447356020,  214591091,
+    2023237503, 3071029183, 2331493761, 3715501450, 4006282863, 2532454473, 1079945393, 3806370642,
+     262472165, 1649275829,  318042170, 2232935637, 1993180770, 1566794563, 1071207971, 3768624977,
+    2552026299, 3465611173, 1330884161, 1282653590, 3120657741, 2657923857, 2500300759, 4272948991,
+    3615545339,  157273601, 1876099311,  202009203, 1629005009, 4116723881, 1882390256,  916380848,
+    2791781166, 1580774438, 4292171320,  159720079, 2276273252, 3648747544, 3152811455, 2968626593,
+     795454924, 3951761348, 3388721857, 3987759528, 2820789408, 1534291352, 1313409317, 1207162262,
+    3130443654, 4246387228, 3410041167, 1159281188, 1033462307, 3777362400, 3579896656, 3267446435,
+    2653380398, 3044467419, 3083611071, 3700473084, 1574133997,  271908581, 3377188459, 4109733943,
+    3989507013, 3490774949, 1974657435, 4235552824, 4068493310,   52424533, 3488677967, 1498992166,
+     850675433, 4018515255, 3306939584, 3290862727, 3903530777,  885974619, 2265089351, 4287627861,
+    2106068266, 1023676394, 2208820352, 2670156248, 1335427621, 3707463021,  359981797, 4132101744,
+    2950802252,  549758609, 2969325587, 2175967644,  664393590, 3385576385, 1788725089, 4119519856,
+    2864127023, 1206113771,  433725641, 1530097389, 3912268200,  923720283, 3230749262, 2274525767,
+    3306590087, 2773956825, 2605499323,  947835568, 4269803519, 1437480713, 1342068062,  643773273,
+    2405587102, 1630402997, 1982695863, 3239486684, 1282304093, 2447177232,  329925065, 2627867124,
+     711226173, 3931490529, 2154298837, 3637214146,  625599435, 1843596101, 3857746685, 1890778181,
+    3361111602, 1806898927, 3992652485, 3847960772,  772038632, 3678804276, 3205934983, 4228912383,
+    2256701426,  471820803, 1333330639,  606027609,  592047733, 3760237052, 1352203472, 2749142546,
+     787416495,  652860192,  954126512, 2403839617, 1684575015,  405416393, 3213623914, 2715940341,
+    3428913999, 3302396124, 3239836181, 2829177334, 2699513987, 2556569759,  623152957, 2520222082,
+};
+
+const uint32_t ntt_harvey1024_inv_mixed_powers[2048] = {
+        0, 10810,  5146,  8246,   722,  4134,  1305,  5736,
+     9744,  5860,  3504, 10643,  3621,  9094,  3542,  1212,
+    11726,  7311, 11340,  6561,  3006,  5777,  7468,  5023,
+     9314,  1351,  2625,  4591,  2744,  8961,  2639,  5828,
+     7443,   140,  7203,    81,  3553,  2768,  2319,  9326,
+     9154,  7678,  3014, 11289,  9995,  1177,   955,  3051,
+     2747,  1853,  1326,  3091,  4805, 10654, 11119,  7393,
+     3712, 11563,  3201,  4320,  1062,  4255,   790,  9923,
+     5179,  8993,  9005,     9,  5542,  7222,  1260,  1673,
+     3382,  4354,   729,  6498,  7399,  3748,   334,  3584,
+     8582,  9893, 10200,  9447,  8652,  2476,  7657,  6958,
+     2548,  2837,  3289,   339,  3932,  5767, 10593,  9764,
+     8595,  8340,  2881, 11267,   145, 10092,  4388,  8011,
+    11934, 12159,  3241, 11745,  6378, 11336,  9863,  8112,
+     1759,  4452,  5092,   480,  8830,   118,  5755,  7300,
+     4231,  6915,  2013,  2468,  9558, 11462,  1428, 10908,
+     8005,  7098,  4143,     3,  3248, 10040,  2401, 10600,
+     2437,   420,    27,  4654,  4337,  9320,  9377,  9644,
+     3780,   243,  5019,  2166, 10146, 10659,   773,  9442,
+     2187,  8304,  7205,  5291,  9908,  6957, 11244,  7394,
+     1002,  3400, 10752,  3149,  1168,  2884,  5101,  9018,
+     6022, 10745,  3763, 10512,  1378,  9042,  7428,  5042,
+    10682,  9289,  8585,   113,  7644,  5407,  8511, 10115,
+     9867,  3531,  1017,  7351, 11796,  2865,  5012,  2780,
+     7201,  9153,  4714,  7852,  1207,  8241,   442,  3364,
+     8643,  5559,  9223, 10863,   435,  3978,  5698,  4053,
+      875,  9273, 11744,  3915, 11224,  2126, 11899,  7875,
+     9723,  7384, 10657,  2704,  6845,  8779,  9430,  1484,
+     5011,  9890, 12047,   160,  5277, 11136,  1067,  8232,
+     2987, 10111,  1440, 10626,  1912,  9603,   354,  2305,
+     4976,   671,  9611,  4919,   404,  3186,  8456,  7917,
+     6039,   476,  7404,  3636,  4096,  2370,  9808,  5195,
+     3762,  6760,  5333, 10968,  6224,  3514,    49, 11286,
+     7991,  3710,  8326,  6383, 10542,   147,  9280, 11684,
+    11130,   400,  6860,  7048,   441,  3262, 10474,  8812,
+     1200,  8291,  8855,  1323,  9786,  6844,  1858,  3600,
+      295,  1987,  3969,  4780,  8243,  5574, 10800,   885,
+     5961, 11907,  2051,   151,  4433,  7822,  2655,  5594,
+    11143,  6153,   453,  1010, 11177,  7965,  4493,  8851,
+     6170,  1359,  3030,  8953, 11606,  1190,  1975,  6221,
+     4077,  9090,  2281, 10240,  3570,  5925,  6374, 12231,
+     2692,  6843,  6142, 10710,  5486,  6833, 12115,  8076,
+     8240,  6137,  7552,  4169,  8210, 11767, 11939,   142,
+     6122, 10367,   218,    52, 10723, 11239,   426,  6077,
+     6523,   654,   156,  7591,  9139,  1278,  5942,  7280,
+     1962,   468, 10484,  2839,  3834,  5537,  9551,  5886,
+     1404,  6874,  8517, 11502,  4322,  4075,  5369,  4212,
+     8333,   973,  9928,   677, 12225,  3818,   347,   421,
+     2919,  5206,  2031, 12097, 11454,  1041,  1263,  8757,
+     3329,  6093, 11713,  9784,  3123,  3789,  1693,  9987,
+     5990, 10561,  4774,  9369, 11367,  5079,  5383,  5681,
+     7105,  2033,  3529,  9523,  2948,  3860,  4754,  9026,
+     6099, 10587,  3991,  8844, 11580,  1973,  2500,  6008,
+     7183, 11973,  1954, 10162,  5919,  7500,  5735,  9260,
+    11341,  5862,  5908,  5468, 10211,  4916,  3202,  9445,
+     5297,  5435,  4115,  6055,  2459,  9606,  3757,  3602,
+     4016,    56,  5876,  7377,  4240, 11271, 10806, 12048,
+      168,  5339,  9842,   431,  9235,  7840, 11566,   504,
+     3728,  4948,  1293,  3127, 11231, 10120,  1512, 11184,
+     2555,  3879,  9381,  9115,  5782,  4536,  8974,  7665,
+    11637,  3565,  2767,  5057,  1319,  2344, 10706, 10333,
+    10695,  8301,  2882,  3957,  7032,  7540,  6421,  7507,
+      325,  8646, 11871,  8807, 10331,  6974, 10232,   975,
+     1360, 11035,  1843,  6415,  8633,  6118,  2925,  4080,
+     5078,  6330,  9667,  4103,   502,  8307,     7,  1756,
+     6879, 10453, 11675,   464,   530,  3042,  2945,  6701,
+     4423,    20,  1506,   343,    21,  5268,  8348,  6781,
+    10447,  1392,  1590,  9126,  8835,  7814,   980,    60,
+     4518,  1029,    63,  3515,   466,  8054,  6763,  4176,
+     4770,  2800,  1927, 11153,  2940,   180,  1265,  3087,
+      189, 10545,  1398, 11873,  8000,   239,  2021,  8400,
+     5781,  8881,  8820,   540,  3795,  9261,   567,  7057,
+     4194, 11041, 11711,   717,  6063,   622,  5054,  2065,
+     1882,  1620, 11385,  3205,  1701,  8882,   293,  8545,
+    10555,  2151,  5900,  1866,  2873,  6195,  5646,  4860,
+     9577,  9615,  5103,  2068,   879,  1057,  7087,  6453,
+     5411,  5598,  8619,  6296,  4649,  2291,  4153,  4267,
+     3020,  6204,  2637,  3171,  8972,  7070,  3944,  4505,
+     1279,  6599,  1658,  6873,   170,   512,  9060,  6323,
+     7911,  9513,  2338,  8921, 11832,  1226,  3837,  7508,
+     4974,  8330,   510,  1536,  2602,  6680, 11444,  3961,
+     7014,  2185, 10918,  3678, 11511, 10235,  2633,   412,
+     1530,  4608,  7806,  7751,  9754, 11883,  8753,  6555,
+     8176, 11034,  9955,  6127,  7899,  1236,  4590,  1535,
+    11129, 10964,  4684, 11071,  1681,  7376, 12239,  8524,
+     5287,  6092, 11408,  3708,  1481,  4605,  8809,  8314,
+     1763,  8635,  5043,  9839, 12139,   994,  3572,  5987,
+     9646, 11124,  4443,  1526,  1849,   364,  5289,  1327,
+     2840,  4939, 11839,  2982, 10716,  5672,  4360,  8794,
+     1040,  4578,  5547,  1092,  3578,  3981,  8520,  2528,
+    10939,  8946,  7570,  4727,   791,  1804,  3120,  1445,
+     4352,  3276, 10734, 11943,   982,  7584,  8239,  2260,
+    10421,  1892,  2373,  5412,  9360,  4335,   767,  9828,
+     7624, 11251,  2946, 10463,   139,  6780,  6685,  5676,
+     7119,  3947,  3502,   716,  2301,  4906, 10583,  9175,
+     8838,  6811,   417,  8051,  7766,  4739,  9068, 11841,
+    10506,  2148,  6903,  2429,  7171,  2947,  1936,  8144,
+     1251, 11864, 11009,  1928,  2626, 10945,  6940,  6444,
+     8420,  7287,  9224,  8841,  5808, 12143,  3753, 11014,
+     8449,  5784,  7878,  8257,  8531,  7043,   682,  9572,
+     3094,  1945,  5135, 11851, 11259,  8464,   769,  5063,
+    11345,   193,  1015,  8840,  2046,  4138,  9282,  5835,
+     3116, 10975,  9199,   814,  2307,  2900,  9457,   579,
+     3045,  1942,  6138,   125,  3268,  5216,  9348,  8347,
+     3019,  2442,  6921,  8700,  3793,  1737,  9135,  5826,
+     6125,   375,  9804,  3359,  3466,   463,  9057,  7326,
+     8474,  1522, 11379,  5211,  2827,  5189,  6086,  1125,
+     4834, 10077, 10398,  1389,  2593,  9689,   844,  4566,
+     9559,  3344,  8481,  3278,  5969,  3375,  2213,  5653,
+     6616,  4167,  7779,  4489,  2532,  1409,  4099, 10032,
+      865,  9834,  5618, 10125,  6639,  4670,  7559,   212,
+    11048,  1178,  7596,  4227,     8,  5518,  2595,  4924,
+     4565,  5797,  7628,  1721, 10388,   636,  8566,  3534,
+    10499,   392,    24,  4265,  7785,  2483,  1406,  5102,
+    10595,  5163,  6586,  1908,  1120, 10602,  6919,  1176,
+       72,   506, 11066,  7449,  4218,  3017,  7207,  3200,
+     7469,  5724,  3360,  7228,  8468,  3528,   216,  1518,
+     8620, 10058,   365,  9051,  9332,  9600, 10118,  4883,
+    10080,  9395,   826, 10584,   648,  4554,  1282,  5596,
+     1095,  2575,  3418,  4222,  5776,  2360,  5662,  3607,
+     2478,  7174,  1944,  1373,  3846,  4499,  3285,  7725,
+    10254,   377,  5039,  7080,  4697, 10821,  7434,  9233,
+     5832,  4119, 11538,  1208,  9855, 10886,  6184,  1131,
+     2828,  8951,  1802,  7885, 10013,  3121,  5207,    68,
+    10036,  3624,  4987,  8080,  6263,  3393,  8484,  2275,
+     5406, 11366,  5461,  9363,  3332,   204,  5530, 10872,
+     2672, 11951,  6500, 10179,   874,  6825,  3929,  9520,
+     4094,  3511,  9996,   612,  4301,  8038,  8016, 11275,
+    // Shoup companions
+             0, 3778061393, 1798511002, 2881951364,  252336755, 1444820148,  456093443, 2004714167,
+    3405497707, 2048051782, 1224637106, 3719695413, 1265528243, 3178324728, 1237917988,  423590232,
+    4098200546, 2555171771, 3963294746, 2293049103, 1050587654, 2019043540, 2610042783, 1755522884,
+    3255214044,  472170300,  917429339, 1604540227,  959019469, 3131841642,  922322295, 2036867881,
+    2601305361,   48929564, 2517426107,   28309248, 1241762454,  967407394,  810483290, 3259408007,
+    3199294542, 2683437130, 1053383630, 3945470404, 3493221427,  411357840,  333769531, 1066315015,
+     960067960,  647617739,  463432877, 1080294890, 1679332562, 3723539878, 3886055933, 2583830516,
+    1297332460, 4041232552, 1118739548, 1509826569,  371165698, 1487109272,  276102544, 3468057651,
+    1810044399, 3143025542, 3147219505,    3145472, 1936911771, 2524066548,  440366082,  584708298,
+    1181998486, 1521709464,  254783233, 2271030799, 2585927498, 1309914348,  116731961, 1252596858,
+    2999382320, 3457572744, 3564868290, 3301697131, 3023847102,  865354302, 2676097695, 2431799368,
+     890518078,  991522680, 1149495275,  118479446, 1374221776, 2015548571, 3702220568, 3412487645,
+    3003925779, 2914804072, 1006900543, 3937781473,   50677049, 3527122626, 1533592358, 2799819595,
+    4170895899, 4249532700, 1132719424, 4104840987, 2229091172, 3961896758, 3447087837, 2835118781,
+     614765031, 1555960159, 1779638170,  167758507, 3086057549,   41240633, 2011354608, 2551327305,
+    1478721346, 2416771002,  703537241,  862558327, 3340491286, 4005933366,  499081560, 3812312089,
+    2797722614, 2480728933, 1447965620,    1048490, 1135165902, 3508948787,  839142035, 3704667046,
+     851723923,  146788694,    9436416, 1626558531, 1515768017, 3257311026, 3277232348, 3370548018,
+    1321098248,   84927744, 1754124896,  757010266, 3545995458, 3725287363,  270161096, 3299949646,
+     764349701, 2902222184, 2518125101, 1849188051, 3462815198, 2431449872, 3929743044, 2584180013,
+     350195884, 1188289430, 3757790574, 1100565710,  408212368, 1007949034, 1782783642, 3151762964,
+    2104670278, 3755344095, 1315156801, 3673911320,  481606716, 3160150890, 2596062907, 1762163325,
+    3733325791, 3246476622, 3000430810,   39493148, 2671554236, 1889729690, 2974568041, 3535161054,
+    3448485825, 1234073522,  355438338, 2569151647, 4122665328, 1001308593, 1751678418,  971601357,
+    2516727113, 3198945045, 1647528345, 2744249589,  421842747, 2880203880,  154477625, 1175707542,
+    3020701630, 1942853218, 3223409827, 3796584729,  152031147, 1390298633, 1991433286, 1416510900,
+     305809779, 3240884672, 4104491490, 1368280329, 3922753106,  743030390, 4158663508, 2752288018,
+    3398158273, 2580685044, 3724588369,  945039593, 2392306220, 3068233207, 3295755684,  518653386,
+    1751328921, 3456524254, 4210389048,   55919502, 1844295094, 3891997380,  372913182, 2877058408,
+    1043947214, 3533763066,  503275523, 3713753965,  668238055, 3356218646,  123721899,  805590334,
+    1739096530,  234512413, 3359014621, 1719175207,  141196744, 1113497095, 2955345712, 2766966887,
+    2110611725,  166360520, 2587674982, 1270770696, 1431539266,  828307632, 3427865508, 1815636349,
+    1314807304, 2362598984, 1863866920, 3833281902, 2175268650, 1228132075,   17125347, 3944421914,
+    2792829657, 1296633466, 2909911116, 2230838656, 3684396227,   51376043, 3243331150, 4083521676,
+    3889900399,  139798756, 2397548673, 2463254089,  154128129, 1140058859, 3660630438, 3079766605,
+     419396269, 2897678724, 3094794971,  462384387, 3420176577, 2391956723,  649365223, 1258188808,
+     103101582,  694450322, 1387153161, 1670595139, 2880902874, 1948095671, 3774566424,  309304748,
+    2083350968, 4161459483,  716818123,   52774030, 1549319718, 2733764682,  927914246, 1955085609,
+    3894443858, 2150454371,  158322091,  352991860, 3906326752, 2783742738, 1570289532, 3093396984,
+    2156395818,  474966275, 1058975580, 3129045666, 4056260919,  415901300,  690256360, 2174220160,
+    1424898825, 3176926741,  797202408, 3578848165, 1247703901, 2070769080, 2227693184, 4274696476,
+     940845631, 2391607226, 2146609905, 3743111704, 1917339945, 2388112257, 4234154836, 2822536893,
+    2879854383, 2144862421, 2639400522, 1457052539, 2869369476, 4112529918, 4172643384,   49628558,
+    2139619967, 3623234271,   76190322,   18173838, 3747655164, 3927995560,  148885675, 2123892607,
+    2279768221,  228570966,   54521515, 2653030901, 3194052088,  446657026, 2076710527, 2544337367,
+     685712900,  163564545, 3664125407,  992221674, 1339971080, 1935164286, 3338044807, 2057138701,
+     490693635, 2402441630, 2976665022, 4019913242, 1510525563, 1424199831, 1876448808, 1472080905,
+    2912357594,  340060475, 3469805135,  236609395, 4272599494, 1334379130,  121275421,  147138191,
+    1020181425, 1819480815,  709828186, 4227863892, 4003137391,  363826263,  441414573, 3060544276,
+    1163475150, 2129484558, 4093657086, 3419477583, 1091478791, 1324243720,  591698236, 3490425452,
+    2093486378, 3691036668, 1668498158, 3274436373, 3972731162, 1775094710, 1881341765, 1985491838,
+    2483175412,  710527179, 1233374529, 3328258894, 1030316835, 1349058000, 1661508220, 3154558940,
+    2131581539, 3700123587, 1394842092, 3090950505, 4047174000,  689557366,  873742228, 2099777322,
+    2510436169, 4184526278,  682916925, 3551587408, 2068672099, 2621226684, 2004364671, 3236341212,
+    3963644243, 2048750776, 2064827633, 1911049001, 3568712756, 1718126717, 1119089045, 3300998137,
+    1851285032, 1899515603, 1438179707, 2116203676,  859412855, 3357267136, 1313059820, 1258887802,
+    1403579515,   19571825, 2053643732, 2578238566, 1481866818, 3939179460, 3776663406, 4210738545,
+      58715477, 1865963902, 3439748403,  150633160, 3227603790, 2740055627, 4042281043,  176146433,
+    1302924410, 1729310617,  451899480, 1092876778, 3925199585, 3536908538,  528439299, 3908773231,
+     892964557, 1355698440, 3278630336, 3185664163, 2020791024, 1585317898, 3136385101, 2678893671,
+    4067095322, 1245956417,  967057897, 1767405778,  460986399,  819220712, 3741713717, 3611351376,
+    3737869251, 2901173693, 1007250040, 1382959198, 2457662138, 2635206559, 2244119538, 2623673162,
+     113586489, 3021750121, 4148877595, 3078019120, 3610652383, 2437391319, 3576052190,  340759468,
+     475315772, 3856698194,  644122770, 2242022557, 3017206661, 2138221980, 1022278406, 1425947316,
+    1774745213, 2212315321, 3378586447, 1433985744,  175447439, 2903270675,    2446478,  613716540,
+    2404189114, 3653291003, 4080376204,  162166557,  185233352, 1063169543, 1029268344, 2341978667,
+    1545824749,    6989937,  526342318,  119877433,    7339434, 1841149622, 2917600047, 2369938419,
+    3651194022,  486499672,  555700057, 3189508629, 3087805033, 2730968707,  342506953,   20969813,
+    1579026954,  359632301,   22018304, 1228481572,  162865551, 2814847961, 2363647475, 1459499017,
+    1667100171,  978591295,  673480509, 3897938827, 1027520860,   62909440,  442113567, 1078896903,
+      66054912, 3685444717,  488596653, 4149576589, 2795975129,   83529756,  706333217, 2935773886,
+    2020441528, 3103881890, 3082562580,  188728321, 1326340702, 3236690709,  198164737, 2466399561,
+    1465789961, 3858795175, 4092958092,  250589270, 2118999651,  217387066, 1766357288,  721711080,
+     657753149,  566184963, 3979022106, 1120137536,  594494211, 3104231387,  102402589, 2986450935,
+    3688939686,  751767812, 2062031658,  652161198, 1004104568, 2165133241, 1973259447, 1698554891,
+    3347131727, 3360412608, 1783482635,  722759571,  307207767,  369418214, 2476884467, 2255303438,
+    1891127678, 1956483596, 3012313705, 2200432427, 1624811047,  800697377, 1451460589, 1491303234,
+    1055480611, 2168278713,  921623302, 1108254642, 3135686107, 2470943020, 1378415738, 1574483494,
+     447006523, 2306329985,  579465845, 2402092133,   59414471,  178942408, 3166441834, 2209868843,
+    2764869906, 3324763926,  817123731, 3117861766, 4135247216,  428483188, 1341019571, 2624022659,
+    1738397536, 2911309103,  178243414,  536827224,  909390910, 2334639233, 3999642422, 1384357186,
+    2451371194,  763650707, 3815807058, 1285449565, 4023058714, 3577100681,  920225314,  143992719,
+     534730243, 1610481674, 2728172732, 2708950403, 3408992676, 4153071558, 3059146288, 2290952121,
+    2857486582, 3856348697, 3479241551, 2141367452, 2760675943,  431978157, 1604190730,  536477727,
+    3889550902, 3831883915, 1637043438, 3869280082,  587504274, 2577889069, 4277492451, 2979111500,
+    1847790063, 2129135061, 3987060534, 1295934472,  517604895, 1609433183, 3078718114, 2905717153,
+     616163019, 3017905655, 1762512822, 3438699912, 4242542762,  347399909, 1248402895, 2092437887,
+    3371247012, 3887803417, 1552814687,  533332255,  646219751,  127216868, 1848489057,  463782374,
+     992571171, 1726165145, 4137693694, 1042199729, 3745208686, 1982346366, 1523806445, 3073475661,
+     363476766, 1599996767, 1938659255,  381650605, 1250499876, 1391347123, 2977713513,  883528140,
+    3823146492, 3126599188, 2645691466, 1652071804,  276452040,  630492391, 1090430300,  505023007,
+    1521010470, 1144951815, 3751499630, 4174041371,  343205947, 2650584422, 2879504886,  789862974,
+    3642107103,  661248118,  829356122, 1891477175, 3271290901, 1515069023,  268064115, 3434855446,
+    2664564298, 3932189522, 1029617841, 3656785972,   48580067, 2369588922, 2336386717, 1983744354,
+    2488068368, 1379464229, 1223938112,  250239774,  804192346, 1714631748, 3698725599, 3206633976,
+    3088853524, 2380423325,  145740203, 2813799471, 2714192857, 1656265767, 3169237809, 4138392688,
+    3671814338,  750719322, 2412577039,  848927948, 2506242206, 1029967338,  676625981, 2846302681,
+     437220610, 4146431117, 3847611275,  673830006,  917778836, 3825243474, 2425508424, 2252157966,
+    2942763823, 2546783846, 3223759324, 3089902015, 2029877944, 4243940749, 1311661832, 3849358759,
+    2952899233, 2021490018, 2753336508, 2885795830, 2981557978, 2461506604,  238356879, 3345384242,
+    1081343381,  679771453, 1794666536, 4141887657, 3934985498, 2958141687,  268763109, 1769502760,
+    3965042230,   67452900,  354739344, 3089552518,  715070639, 1446218135, 3244030144, 2039314360,
+    1089032312, 3835728380, 3215021902,  284490469,  806289328, 1013540984, 3305192100,  202358700,
+    1064218033,  678722962, 2145211918,   43687111, 1142155840, 1822975784, 3267096938, 2917250550,
+    1055131114,  853471408, 2418867984, 3040622953, 1325641708,  607076100, 3192654101, 2036168888,
+    2140668458,  131061334, 3426467521, 1173960057, 1211356224,  161817060, 3165393343, 2560414224,
+    2961636656,  531934268, 3976925125, 1821228300,  988027711, 1813539368, 2127038079,  393184002,
+    1689467972, 3521880172, 3634068674,  485451181,  906245438, 3386275378,  294975376, 1595802805,
+    3340840783, 1168717604, 2964083134, 1145650809, 2086146943, 1179552007,  773436620, 1975705925,
+    2312271432, 1456353545, 2718736316, 1568891544,  884926128,  492441119, 1432587757, 3506152812,
+     302314810, 3436952428, 1963473534, 3538656023, 2320309860, 1632150481, 2641847000,   74093340,
+    3861241654,  411707337, 2654778385, 1477323359,    2795975, 1928523845,  906944432, 1720922692,
+    1595453308, 2026033478, 2665962286,  601484149, 3630573705,  222280022, 2993790370, 1235122013,
+    3669367860,  137002781,    8387925, 1490604240, 2720833298,  867800780,  491392629, 1783133138,
+    3702919562, 1804452449, 2301786525,  666840068,  391436518, 3705366040, 2418168990,  411008344,
+      25163776,  176845426, 3867532598, 2603402342, 1474177887, 1054432120, 2518824094, 1118390051,
+    2610392280, 2000520205, 1174309554, 2526163529, 2959539674, 1233025032,   75491328,  530536280,
+    3012663202, 3515239731,  127566365, 3163296362, 3261504988, 3355170155, 3536209545, 1706593319,
+    3522928663, 3283523292,  288684432, 3699075096,  226473985, 1591608842,  448055014, 1955784603,
+     382699095,  899954494, 1194580374, 1475575874, 2018694043,  824812663, 1978851397, 1260635286,
+     866053296, 2507290697,  679421956,  479859231, 1344165043, 1572386513, 1148097287, 2699863484,
+    3583741122,  131760327, 1761114834, 2474437989, 1641586897, 3781905859, 2598159889, 3226904796,
+    2038265869, 1439577694, 4032495130,  422192244, 3444291862, 3804623157, 2161288775,  395280983,
+     988377208, 3128346673,  629793397, 2755782987, 3499512371, 1090779797, 1819830312,   23765788,
+    3507550800, 1266576733, 1742940996, 2823934880, 2188899029, 1185842951, 2965131624,  795105427,
+    1889380193, 3972381665, 1908602522, 3272339392, 1164523641,   71297365, 1932717808, 3799730201,
+     933855693, 4176837346, 2271729792, 3557528855,  305460282, 2385316282, 1373173285, 3327210404,
+    1430840272, 1227083585, 3493570924,  213892097, 1503186129, 2809256011, 2801567079, 3940577448,
+};
+
+const uint32_t ntt_harvey1024_inv_mixed_powers_rev[2048] = {
+        0, 10810,  5146,  8246,   722,  1305,  4134,  5736,
+     9744,  3621,  3504,  3542,  5860,  9094, 10643,  1212,
+    11726,  9314,  3006,  2744, 11340,  2625,  7468,  2639,
+     7311,  1351,  5777,  8961,  6561,  4591,  5023,  5828,
+     7443,  2747,  9154,  3712,  3553,  4805,  9995,  1062,
+     7203,  1326,  3014,  3201,  2319, 11119,   955,   790,
+      140,  1853,  7678, 11563,  2768, 10654,  1177,  4255,
+       81,  3091, 11289,  4320,  9326,  7393,  3051,  9923,
+     5179,  8595,  8582,  1759,  3382, 11934,  2548,  4231,
+     5542,   145,  8652,  8830,  7399,  6378,  3932,  9558,
+     9005,  2881, 10200,  5092,   729,  3241,  3289,  2013,
+     1260,  4388,  7657,  5755,   334,  9863, 10593,  1428,
+     8993,  8340,  9893,  4452,  4354, 12159,  2837,  6915,
+     7222, 10092,  2476,   118,  3748, 11336,  5767, 11462,
+        9, 11267,  9447,   480,  6498, 11745,   339,  2468,
+     1673,  8011,  6958,  7300,  3584,  8112,  9764, 10908,
+     8005,  7201,  1002,  5011,  3780,   875, 10682,  4976,
+     2437,  8643,  6022,  2987,  2187,  9723,  9867,  6039,
+     3248,  1207,  1168,  5277, 10146, 11224,  7644,   404,
+     4337,   435,  1378,  1912,  9908,  6845, 11796,  4096,
+     4143,  4714, 10752, 12047,  5019, 11744,  8585,  9611,
+       27,  9223,  3763,  1440,  7205, 10657,  1017,  7404,
+     2401,   442,  5101,  1067,   773, 11899,  8511,  8456,
+     9377,  5698,  7428,   354, 11244,  9430,  5012,  9808,
+     7098,  9153,  3400,  9890,   243,  9273,  9289,   671,
+      420,  5559, 10745, 10111,  8304,  7384,  3531,   476,
+    10040,  8241,  2884, 11136, 10659,  2126,  5407,  3186,
+     9320,  3978,  9042,  9603,  6957,  8779,  2865,  2370,
+        3,  7852,  3149,   160,  2166,  3915,   113,  4919,
+     4654, 10863, 10512, 10626,  5291,  2704,  7351,  3636,
+    10600,  3364,  9018,  8232,  9442,  7875, 10115,  7917,
+     9644,  4053,  5042,  2305,  7394,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099,  6523, 11637,
+    11130,  5990,  8240,  3728, 11143, 11341,  1404,   325,
+     7991,  3329,  2692,   168,  5961,  7183,  1962, 10695,
+     1200,  7105,  6122,  2555,  6170,  5297,  8333,  1360,
+     6224, 11454,  3570,  4240,  8243, 11580,  9139,  1319,
+      441, 11367,  8210, 11231, 11177, 10211,  4322, 10331,
+    10542,  3123,  5486,  9235,  4433,  5919,  3834,  7032,
+     9786,  2948, 10723,  5782, 11606,  2459, 12225,  8633,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+     6860,  4774,  7552,  1293,   453,  5908,  8517, 11871,
+     8326, 11713,  6142,  9842,  2051,  1954, 10484,  2882,
+     8855,  3529,   218,  9381,  3030,  4115,  9928,  1843,
+       49,  1263,  6374, 10806, 10800,  2500,  5942, 10706,
+    10474,  5383, 11939,  1512,  4493,  3202,  5369, 10232,
+     9280,  1693, 12115, 11566,  2655,  5735,  9551,  6421,
+     1858,  4754,   426,  8974,  1975,  3757,   347,  2925,
+     6760,  5206,  9090,    56,  1987, 10587,   654,  3565,
+      400, 10561,  6137,  4948,  6153,  5862,  6874,  8646,
+     3710,  6093,  6843,  5339, 11907, 11973,   468,  8301,
+     8291,  2033, 10367,  3879,  1359,  5435,   973, 11035,
+     3514,  1041,  5925, 11271,  5574,  1973,  1278,  2344,
+     3262,  5079, 11767, 10120,  7965,  4916,  4075,  6974,
+      147,  3789,  6833,  7840,  7822,  7500,  5537,  7540,
+     6844,  3860, 11239,  4536,  1190,  9606,  3818,  6118,
+    10968, 12097, 10240,  7377,  4780,  8844,  7591,  5057,
+     7048,  9369,  4169,  3127,  1010,  5468, 11502,  8807,
+     6383,  9784, 10710,   431,   151, 10162,  2839,  3957,
+     1323,  9523,    52,  9115,  8953,  6055,   677,  6415,
+    11286,  8757, 12231, 12048,   885,  6008,  7280, 10333,
+     8812,  5681,   142, 11184,  8851,  9445,  4212,   975,
+    11684,  9987,  8076,   504,  5594,  9260,  5886,  7507,
+     3600,  9026,  6077,  7665,  6221,  3602,   421,  4080,
+     5078, 10506,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, 11129,  7469,  5411,  9559, 10421, 10036,
+     4423,  8420,  1530, 10595, 10555,  8474, 10939,  5832,
+      189,  3116,  1763, 10080,  1279,   865,  7119,  2672,
+     6879,  1251,  7014, 10499,  1882,  6125,  1040, 10254,
+     4770, 11345,  5287,  8620,  3020,  6616,  7624,  5406,
+    10447,  8449,  8176,    72,  9577,  4834,  4352,  2828,
+     5781,  3045,  9646,  1095,  7911, 11048,  8838,  4094,
+      502,  7171,  2602, 10388,  6063,  3793, 10716,  3846,
+      466, 11259,  1681,  8468,  4649,  5969,  9360,  6263,
+       21,  5808,  9754,  1120,  2873,  2827,   791,  9855,
+     8000,  2307, 12139,   648,   170,  6639,  2301,   874,
+      530,  2626, 11511,  7785,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481,  9332,  8972,  2532,   139,  3332,
+     8835,  8531,  7899,  4218,   879,  2593,   982, 10013,
+     3795,  3268,  1849,  5776, 11832,     8,  7766,  4301,
+     9667,  6903,   510,  7628, 11711,  6921, 11839,  1944,
+       63,  5135,  4684,  3360,  8619,  8481,  2373,  4987,
+     1506,  9224,  7806,  6586,  5900, 11379,  7570, 11538,
+     1398,  9199,  5043,   826,  1658,  5618,  3502,  6500,
+    11675, 11009, 10918,    24, 11385,  9804,  5547,  5039,
+     1927,  1015, 11408,   365,  2637,  7779,  2946,  5461,
+     1590,  7878,  9955, 11066,  5103, 10398, 10734,  1802,
+     8820,  6138,  4443,  3418,  2338,  7596,   417,  9996,
+        7,  1936, 11444,  8566,  5054,  9135,  4360,  3285,
+     6763,   769, 12239,   216,  4153,  2213,   767,  8484,
+     8348,  3753,  8753,  6919,  5646,  6086,  3120,  6184,
+     2021,  9457,  3572,  1282,  9060,  7559, 10583,  3929,
+     2945,  6940,  2633,  1406,   293,  9057,  8520,  7434,
+     1265,  9282,  8809, 10118,  3944,  4099,  6685,  5530,
+      980,   682,  4590,  7207,  7087,   844,  8239,  5207,
+      567,  9348,  5289,  5662,  3837,  2595,  9068,  8016,
+     6330,  2148,  8330,  5797, 11041,  2442,  4939,  7174,
+     1029,  1945, 10964,  5724,  5598,  3344,  1892,  3624,
+       20,  7287,  4608,  5163,  2151,  1522,  8946,  4119,
+    10545, 10975,  8635,  9395,  6599,  9834,  3947, 11951,
+    10453, 11864,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, 10058,  6204,  4167, 11251, 11366,
+     1392,  5784, 11034,   506,  9615, 10077,  3276,  8951,
+     8881,  1942, 11124,  2575,  9513,  1178,  6811,  3511,
+     8307,  2947,  6680,   636,   622,  1737,  5672,  4499,
+     8054,  8464,  7376,  3528,  2291,  3375,  4335,  3393,
+     5268, 12143, 11883, 10602,  6195,  5189,  1804, 10886,
+      239,  2900,   994,  4554,   512,  4670,  4906,  6825,
+     3042, 10945, 10235,  2483,  8882,   463,  3981, 10821,
+      180,  4138,  4605,  9600,  7070,  1409,  6780,   204,
+     7814,  7043,  1236,  3017,  1057,  9689,  7584,  3121,
+     9261,  5216,   364,  2360,  1226,  5518,  4739,  8038,
+     4103,  2429,  1536,  1721,   717,  8700,  2982,  1373,
+     3515, 11851, 11071,  7228,  6296,  3278,  5412,  8080,
+      343,  8841,  7751,  1908,  1866,  5211,  4727,  1208,
+    11873,   814,  9839, 10584,  6873, 10125,   716, 10179,
+      464,  1928,  3678,  4265,  3205,  3359,  1092,  7080,
+    11153,  8840,  3708,  9051,  3171,  4489, 10463,  9363,
+     9126,  8257,  6127,  7449,  2068,  1389, 11943,  7885,
+      540,   125,  1526,  4222,  8921,  4227,  8051,   612,
+     1756,  8144,  3961,  3534,  2065,  5826,  8794,  7725,
+     4176,  5063,  8524,  1518,  4267,  5653,  9828,  2275,
+     6781, 11014,  6555,  1176,  4860,  1125,  1445,  1131,
+     8400,   579,  5987,  5596,  6323,   212,  9175,  9520,
+     6701,  6444,   412,  5102,  8545,  7326,  2528,  9233,
+     3087,  5835,  8314,  4883,  4505, 10032,  5676, 10872,
+       60,  9572,  1535,  3200,  6453,  4566,  2260,    68,
+     7057,  8347,  1327,  3607,  7508,  4924, 11841, 11275,
+    // Shoup companions
+             0, 3778061393, 1798511002, 2881951364,  252336755,  456093443, 1444820148, 2004714167,
+    3405497707, 1265528243, 1224637106, 1237917988, 2048051782, 3178324728, 3719695413,  423590232,
+    4098200546, 3255214044, 1050587654,  959019469, 3963294746,  917429339, 2610042783,  922322295,
+    2555171771,  472170300, 2019043540, 3131841642, 2293049103, 1604540227, 1755522884, 2036867881,
+    2601305361,  960067960, 3199294542, 1297332460, 1241762454, 1679332562, 3493221427,  371165698,
+    2517426107,  463432877, 1053383630, 1118739548,  810483290, 3886055933,  333769531,  276102544,
+      48929564,  647617739, 2683437130, 4041232552,  967407394, 3723539878,  411357840, 1487109272,
+      28309248, 1080294890, 3945470404, 1509826569, 3259408007, 2583830516, 1066315015, 3468057651,
+    1810044399, 3003925779, 2999382320,  614765031, 1181998486, 4170895899,  890518078, 1478721346,
+    1936911771,   50677049, 3023847102, 3086057549, 2585927498, 2229091172, 1374221776, 3340491286,
+    3147219505, 1006900543, 3564868290, 1779638170,  254783233, 1132719424, 1149495275,  703537241,
+     440366082, 1533592358, 2676097695, 2011354608,  116731961, 3447087837, 3702220568,  499081560,
+    3143025542, 2914804072, 3457572744, 1555960159, 1521709464, 4249532700,  991522680, 2416771002,
+    2524066548, 3527122626,  865354302,   41240633, 1309914348, 3961896758, 2015548571, 4005933366,
+       3145472, 3937781473, 3301697131,  167758507, 2271030799, 4104840987,  118479446,  862558327,
+     584708298, 2799819595, 2431799368, 2551327305, 1252596858, 2835118781, 3412487645, 3812312089,
+    2797722614, 2516727113,  350195884, 1751328921, 1321098248,  305809779, 3733325791, 1739096530,
+     851723923, 3020701630, 2104670278, 1043947214,  764349701, 3398158273, 3448485825, 2110611725,
+    1135165902,  421842747,  408212368, 1844295094, 3545995458, 3922753106, 2671554236,  141196744,
+    1515768017,  152031147,  481606716,  668238055, 3462815198, 2392306220, 4122665328, 1431539266,
+    1447965620, 1647528345, 3757790574, 4210389048, 1754124896, 4104491490, 3000430810, 3359014621,
+       9436416, 3223409827, 1315156801,  503275523, 2518125101, 3724588369,  355438338, 2587674982,
+     839142035,  154477625, 1782783642,  372913182,  270161096, 4158663508, 2974568041, 2955345712,
+    3277232348, 1991433286, 2596062907,  123721899, 3929743044, 3295755684, 1751678418, 3427865508,
+    2480728933, 3198945045, 1188289430, 3456524254,   84927744, 3240884672, 3246476622,  234512413,
+     146788694, 1942853218, 3755344095, 3533763066, 2902222184, 2580685044, 1234073522,  166360520,
+    3508948787, 2880203880, 1007949034, 3891997380, 3725287363,  743030390, 1889729690, 1113497095,
+    3257311026, 1390298633, 3160150890, 3356218646, 2431449872, 3068233207, 1001308593,  828307632,
+       1048490, 2744249589, 1100565710,   55919502,  757010266, 1368280329,   39493148, 1719175207,
+    1626558531, 3796584729, 3673911320, 3713753965, 1849188051,  945039593, 2569151647, 1270770696,
+    3704667046, 1175707542, 3151762964, 2877058408, 3299949646, 2752288018, 3535161054, 2766966887,
+    3370548018, 1416510900, 1762163325,  805590334, 2584180013,  518653386,  971601357, 1815636349,
+    1314807304, 1020181425, 1424898825, 1403579515,  103101582, 2131581539, 2279768221, 4067095322,
+    3889900399, 2093486378, 2879854383, 1302924410, 3894443858, 3963644243,  490693635,  113586489,
+    2792829657, 1163475150,  940845631,   58715477, 2083350968, 2510436169,  685712900, 3737869251,
+     419396269, 2483175412, 2139619967,  892964557, 2156395818, 1851285032, 2912357594,  475315772,
+    2175268650, 4003137391, 1247703901, 1481866818, 2880902874, 4047174000, 3194052088,  460986399,
+     154128129, 3972731162, 2869369476, 3925199585, 3906326752, 3568712756, 1510525563, 3610652383,
+    3684396227, 1091478791, 1917339945, 3227603790, 1549319718, 2068672099, 1339971080, 2457662138,
+    3420176577, 1030316835, 3747655164, 2020791024, 4056260919,  859412855, 4272599494, 3017206661,
+    1863866920,  709828186,  797202408, 2053643732, 1387153161, 1394842092,   54521515,  967057897,
+    2397548673, 1668498158, 2639400522,  451899480,  158322091, 2064827633, 2976665022, 4148877595,
+    2909911116, 4093657086, 2146609905, 3439748403,  716818123,  682916925, 3664125407, 1007250040,
+    3094794971, 1233374529,   76190322, 3278630336, 1058975580, 1438179707, 3469805135,  644122770,
+      17125347,  441414573, 2227693184, 3776663406, 3774566424,  873742228, 2076710527, 3741713717,
+    3660630438, 1881341765, 4172643384,  528439299, 1570289532, 1119089045, 1876448808, 3576052190,
+    3243331150,  591698236, 4234154836, 4042281043,  927914246, 2004364671, 3338044807, 2244119538,
+     649365223, 1661508220,  148885675, 3136385101,  690256360, 1313059820,  121275421, 1022278406,
+    2362598984, 1819480815, 3176926741,   19571825,  694450322, 3700123587,  228570966, 1245956417,
+     139798756, 3691036668, 2144862421, 1729310617, 2150454371, 2048750776, 2402441630, 3021750121,
+    1296633466, 2129484558, 2391607226, 1865963902, 4161459483, 4184526278,  163564545, 2901173693,
+    2897678724,  710527179, 3623234271, 1355698440,  474966275, 1899515603,  340060475, 3856698194,
+    1228132075,  363826263, 2070769080, 3939179460, 1948095671,  689557366,  446657026,  819220712,
+    1140058859, 1775094710, 4112529918, 3536908538, 2783742738, 1718126717, 1424199831, 2437391319,
+      51376043, 1324243720, 2388112257, 2740055627, 2733764682, 2621226684, 1935164286, 2635206559,
+    2391956723, 1349058000, 3927995560, 1585317898,  415901300, 3357267136, 1334379130, 2138221980,
+    3833281902, 4227863892, 3578848165, 2578238566, 1670595139, 3090950505, 2653030901, 1767405778,
+    2463254089, 3274436373, 1457052539, 1092876778,  352991860, 1911049001, 4019913242, 3078019120,
+    2230838656, 3419477583, 3743111704,  150633160,   52774030, 3551587408,  992221674, 1382959198,
+     462384387, 3328258894,   18173838, 3185664163, 3129045666, 2116203676,  236609395, 2242022557,
+    3944421914, 3060544276, 4274696476, 4210738545,  309304748, 2099777322, 2544337367, 3611351376,
+    3079766605, 1985491838,   49628558, 3908773231, 3093396984, 3300998137, 1472080905,  340759468,
+    4083521676, 3490425452, 2822536893,  176146433, 1955085609, 3236341212, 2057138701, 2623673162,
+    1258188808, 3154558940, 2123892607, 2678893671, 2174220160, 1258887802,  147138191, 1425947316,
+    1774745213, 3671814338, 1738397536, 1595453308, 1465789961, 1055131114,  992571171,  866053296,
+    1579026954, 1081343381, 3889550902, 2610392280, 1891127678, 3340840783, 3642107103, 3507550800,
+    1545824749, 2942763823,  534730243, 3702919562, 3688939686, 2961636656, 3823146492, 2038265869,
+      66054912, 1089032312,  616163019, 3522928663,  447006523,  302314810, 2488068368,  933855693,
+    2404189114,  437220610, 2451371194, 3669367860,  657753149, 2140668458,  363476766, 3583741122,
+    1667100171, 3965042230, 1847790063, 3012663202, 1055480611, 2312271432, 2664564298, 1889380193,
+    3651194022, 2952899233, 2857486582,   25163776, 3347131727, 1689467972, 1521010470,  988377208,
+    2020441528, 1064218033, 3371247012,  382699095, 2764869906, 3861241654, 3088853524, 1430840272,
+     175447439, 2506242206,  909390910, 3630573705, 2118999651, 1325641708, 3745208686, 1344165043,
+     162865551, 3934985498,  587504274, 2959539674, 1624811047, 2086146943, 3271290901, 2188899029,
+       7339434, 2029877944, 3408992676,  391436518, 1004104568,  988027711,  276452040, 3444291862,
+    2795975129,  806289328, 4242542762,  226473985,   59414471, 2320309860,  804192346,  305460282,
+     185233352,  917778836, 4023058714, 2720833298,  594494211, 1211356224, 1250499876, 1641586897,
+    1027520860,  715070639,  517604895, 3261504988, 3135686107,  884926128,   48580067, 1164523641,
+    3087805033, 2981557978, 2760675943, 1474177887,  307207767,  906245438,  343205947, 3499512371,
+    1326340702, 1142155840,  646219751, 2018694043, 4135247216,    2795975, 2714192857, 1503186129,
+    3378586447, 2412577039,  178243414, 2665962286, 4092958092, 2418867984, 4137693694,  679421956,
+      22018304, 1794666536, 1637043438, 1174309554, 3012313705, 2964083134,  829356122, 1742940996,
+     526342318, 3223759324, 2728172732, 2301786525, 2062031658, 3976925125, 2645691466, 4032495130,
+     488596653, 3215021902, 1762512822,  288684432,  579465845, 1963473534, 1223938112, 2271729792,
+    4080376204, 3847611275, 3815807058,    8387925, 3979022106, 3426467521, 1938659255, 1761114834,
+     673480509,  354739344, 3987060534,  127566365,  921623302, 2718736316, 1029617841, 1908602522,
+     555700057, 2753336508, 3479241551, 3867532598, 1783482635, 3634068674, 3751499630,  629793397,
+    3082562580, 2145211918, 1552814687, 1194580374,  817123731, 2654778385,  145740203, 3493570924,
+       2446478,  676625981, 3999642422, 2993790370, 1766357288, 3192654101, 1523806445, 1148097287,
+    2363647475,  268763109, 4277492451,   75491328, 1451460589,  773436620,  268064115, 2965131624,
+    2917600047, 1311661832, 3059146288, 2418168990, 1973259447, 2127038079, 1090430300, 2161288775,
+     706333217, 3305192100, 1248402895,  448055014, 3166441834, 2641847000, 3698725599, 1373173285,
+    1029268344, 2425508424,  920225314,  491392629,  102402589, 3165393343, 2977713513, 2598159889,
+     442113567, 3244030144, 3078718114, 3536209545, 1378415738, 1432587757, 2336386717, 1932717808,
+     342506953,  238356879, 1604190730, 2518824094, 2476884467,  294975376, 2879504886, 1819830312,
+     198164737, 3267096938, 1848489057, 1978851397, 1341019571,  906944432, 3169237809, 2801567079,
+    2212315321,  750719322, 2911309103, 2026033478, 3858795175,  853471408, 1726165145, 2507290697,
+     359632301,  679771453, 3831883915, 2000520205, 1956483596, 1168717604,  661248118, 1266576733,
+       6989937, 2546783846, 1610481674, 1804452449,  751767812,  531934268, 3126599188, 1439577694,
+    3685444717, 3835728380, 3017905655, 3283523292, 2306329985, 3436952428, 1379464229, 4176837346,
+    3653291003, 4146431117,  763650707,  137002781,  566184963,  131061334, 1599996767,  131760327,
+     978591295,   67452900, 2129135061, 3515239731, 2168278713, 1456353545, 3932189522, 3972381665,
+     486499672, 2021490018, 3856348697,  176845426, 3360412608, 3521880172, 1144951815, 3128346673,
+    3103881890,  678722962, 3887803417,  899954494, 3324763926,  411707337, 2380423325, 1227083585,
+    2903270675, 1029967338, 2334639233,  222280022,  217387066,  607076100, 1982346366, 1572386513,
+    2814847961, 2958141687, 2577889069, 1233025032,  800697377, 1179552007, 1515069023, 1185842951,
+    1841149622, 4243940749, 4153071558, 3705366040, 2165133241, 1813539368,  630492391, 3804623157,
+      83529756, 1013540984,  347399909, 1591608842,  178942408, 1632150481, 1714631748, 2385316282,
+    1063169543, 3825243474, 3577100681,  867800780, 3104231387,  161817060, 1391347123, 3781905859,
+      62909440, 1446218135, 1609433183, 3355170155, 2470943020,  492441119, 2369588922,   71297365,
+    2730968707, 2461506604,  431978157, 1054432120,  369418214, 3386275378, 2650584422, 1090779797,
+    3236690709, 1822975784,  127216868,  824812663,  428483188, 1928523845, 1656265767, 2809256011,
+    1433985744,  848927948,  536827224,  601484149,  250589270, 3040622953, 1042199729,  479859231,
+    1228481572, 4141887657, 3869280082, 2526163529, 2200432427, 1145650809, 1891477175, 2823934880,
+     119877433, 3089902015, 2708950403,  666840068,  652161198, 1821228300, 1652071804,  422192244,
+    4149576589,  284490469, 3438699912, 3699075096, 2402092133, 3538656023,  250239774, 3557528855,
+     162166557,  673830006, 1285449565, 1490604240, 1120137536, 1173960057,  381650605, 2474437989,
+    3897938827, 3089552518, 1295934472, 3163296362, 1108254642, 1568891544, 3656785972, 3272339392,
+    3189508629, 2885795830, 2141367452, 2603402342,  722759571,  485451181, 4174041371, 2755782987,
+     188728321,   43687111,  533332255, 1475575874, 3117861766, 1477323359, 2813799471,  213892097,
+     613716540, 2846302681, 1384357186, 1235122013,  721711080, 2036168888, 3073475661, 2699863484,
+    1459499017, 1769502760, 2979111500,  530536280, 1491303234, 1975705925, 3434855446,  795105427,
+    2369938419, 3849358759, 2290952121,  411008344, 1698554891,  393184002,  505023007,  395280983,
+    2935773886,  202358700, 2092437887, 1955784603, 2209868843,   74093340, 3206633976, 3327210404,
+    2341978667, 2252157966,  143992719, 1783133138, 2986450935, 2560414224,  883528140, 3226904796,
+    1078896903, 2039314360, 2905717153, 1706593319, 1574483494, 3506152812, 1983744354, 3799730201,
+      20969813, 3345384242,  536477727, 1118390051, 2255303438, 1595802805,  789862974,   23765788,
+    2466399561, 2917250550,  463782374, 1260635286, 2624022659, 1720922692, 4138392688, 3940577448,
+};
+
@@ -0,0 +1,45 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#ifndef __NTT_HARVEY1024_TABLES_H
+#define __NTT_HARVEY1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_harvey1024_psi = 1014;
+static const uint32_t ntt_harvey1024_omega = 8209;
+static const uint32_t ntt_harvey1024_inv_psi = 5078;
+static const uint32_t ntt_harvey1024_inv_omega = 3762;
+static const uint32_t ntt_harvey1024_inv_n = 12277;
+static const uint32_t ntt_harvey1024_inv_n_shoup = 4290773333;
+
+/*
+ * POWERS OF PSI
+ */
+extern const uint32_t ntt_harvey1024_psi_powers[2048];
+extern const uint32_t ntt_harvey1024_scaled_inv_psi_powers[2048];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const uint32_t ntt_harvey1024_omega_powers[2048];
+extern const uint32_t ntt_harvey1024_omega_powers_rev[2048];
+extern const uint32_t ntt_harvey1024_inv_omega_powers[2048];
+extern const uint32_t ntt_harvey1024_inv_omega_powers_rev[2048];
+extern const uint32_t ntt_harvey1024_mixed_powers[2048];
+extern const uint32_t ntt_harvey1024_mixed_powers_rev[2048];
+extern const uint32_t ntt_harvey1024_inv_mixed_powers[2048];
+extern const uint32_t ntt_harvey1024_inv_mixed_powers_rev[2048];
+
+#endif /* __NTT_HARVEY1024_TABLES_H */
@@ -0,0 +1,111 @@
+/*
+ * BD: NTT with Shoup multiplication and Harvey's butterflies
+ *
+ * All variants are specialized to Q=12289.
+ * - omega denotes a primitive n-th root of unity (mod Q).
+ * - psi denotes a square root of omega (mod Q).
+ *
+ * Assembly implementation of the functions in ntt_harvey.h, using
+ * AVX2 instructions on 8 coefficients at a time. The results are
+ * identical to the C functions.
+ *
+ * Tables of constants are generated by make_harvey_tables: they
+ * have 2n elements, the constants followed by their Shoup companions.
+ */
+
+#ifndef __NTT_HARVEY_ASM_H
+#define __NTT_HARVEY_ASM_H
+
+#include <stdint.h>
+
+
+/*****************
+ * NORMALIZATION *
+ ****************/
+
+/*
+ * Reduce all coefficients from [0, 4Q-1] to [0, Q-1]
+ * - n must be positive and a multiple of 8
+ */
+extern void harvey_correct_asm(uint32_t *a, uint32_t n);
+
+
+/**************
+ * PRODUCTS   *
+ *************/
+
+/*
+ * Shoup multiplication by the constants in p:
+ *   a'[i] = mul_shoup(a[i], p[i], p[n + i])
+ * - n must be positive and a multiple of 8
+ * - the result is in [0, 2Q-1]
+ */
+extern void harvey_mul_array32_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * Pointwise product: c[i] = red_shoup(a[i] * b[i])
+ * - n must be positive and a multiple of 8
+ * - a[i] and b[i] must be in [0, 4Q-1]
+ * - the result is in [0, 2Q-1]
+ */
+extern void harvey_mul_array_asm(uint32_t *c, uint32_t n, const uint32_t *a, const uint32_t *b);
+
+/*
+ * Final step of the product functions: Shoup multiplication by
+ * a constant then conversion to [0, Q-1].
+ * - harvey_mul_finalize_asm(a, n, p): a[i] = mul_shoup(a[i], p[i], p[n + i]) converted to [0, Q-1]
+ * - harvey_scalar_mul_finalize_asm(a, n, c, c_shoup): a[i] = mul_shoup(a[i], c, c_shoup) converted to [0, Q-1]
+ * - n must be positive and a multiple of 8
+ */
+extern void harvey_mul_finalize_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void harvey_scalar_mul_finalize_asm(uint32_t *a, uint32_t n, uint32_t c, uint32_t c_shoup);
+
+
+/****************
+ * NTT VARIANTS *
+ ***************/
+
+/*
+ * All variants require n to be a power of two and n >= 16.
+ *
+ * Input/output and bounds are as in ntt_harvey.h:
+ * - Cooley-Tukey variants: input and output in [0, 4Q-1]
+ * - Gentleman-Sande variants: input and output in [0, 2Q-1]
+ *
+ * The plain and combined versions are the same function: they
+ * differ only by the table p.
+ */
+
+/*
+ * COOLEY-TUKEY: BIT-REVERSE TO STANDARD ORDER
+ * - p[t + j] = omega^(n/2t)^j
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^j for mulntt
+ */
+extern void ntt_harvey_ct_rev2std_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void mulntt_harvey_ct_rev2std_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - p[t + j] = omega^(n/2t)^bitrev(j)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) for mulntt
+ */
+extern void ntt_harvey_ct_std2rev_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void mulntt_harvey_ct_std2rev_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - p[t + j] = omega^(n/2t)^bitrev(j)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) for nttmul
+ */
+extern void ntt_harvey_gs_rev2std_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void nttmul_harvey_gs_rev2std_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+
+/*
+ * GENTLEMAN-SANDE: STANDARD TO BIT-REVERSE ORDER
+ * - p[t + j] = omega^(n/2t)^j
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^j for nttmul
+ */
+extern void ntt_harvey_gs_std2rev_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+extern void nttmul_harvey_gs_std2rev_asm(uint32_t *a, uint32_t n, const uint32_t *p);
+
+#endif /* __NTT_HARVEY_ASM_H */
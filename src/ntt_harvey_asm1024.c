@@ -0,0 +1,90 @@
+/*
+ * NTT for Q=12289, n=1024, with Shoup multiplication and Harvey butterflies.
+ * AVX implementation.
+ */
+
+#include "ntt_harvey_asm1024.h"
+
+/*
+ * Input: two arrays a and b in standard order
+ *
+ * Result: 
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1]
+ * The result is also in that range.
+ *
+ * The pointwise products are reduced with red_shoup, which does not
+ * introduce a scaling factor: the final pass only divides by n.
+ */
+void ntt_harvey1024_product1_asm(uint32_t *c, uint32_t *a, uint32_t *b) {
+  harvey_mul_array32_asm(a, 1024, ntt_harvey1024_psi_powers); // 0 <= a[i] < 2Q
+  ntt_harvey1024_ct_std2rev_asm(a);
+
+  harvey_mul_array32_asm(b, 1024, ntt_harvey1024_psi_powers);
+  ntt_harvey1024_ct_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), 0 <= a[i], b[i] < 4Q
+  harvey_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i], 0 <= c[i] < 2Q
+
+  intt_harvey1024_ct_rev2std_asm(c);
+  harvey_mul_finalize_asm(c, 1024, ntt_harvey1024_scaled_inv_psi_powers); // rescale by 1/n, convert to [0, Q-1]
+}
+
+void ntt_harvey1024_product2_asm(uint32_t *c, uint32_t *a, uint32_t *b) {
+  harvey_mul_array32_asm(a, 1024, ntt_harvey1024_psi_powers); // 0 <= a[i] < 2Q
+  ntt_harvey1024_gs_std2rev_asm(a);
+
+  harvey_mul_array32_asm(b, 1024, ntt_harvey1024_psi_powers);
+  ntt_harvey1024_gs_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), 0 <= a[i], b[i] < 2Q
+  harvey_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i], 0 <= c[i] < 2Q
+
+  intt_harvey1024_ct_rev2std_asm(c);
+  harvey_mul_finalize_asm(c, 1024, ntt_harvey1024_scaled_inv_psi_powers); // rescale by 1/n, convert to [0, Q-1]
+}
+
+void ntt_harvey1024_product3_asm(uint32_t *c, uint32_t *a, uint32_t *b) {
+  harvey_mul_array32_asm(a, 1024, ntt_harvey1024_psi_powers); // 0 <= a[i] < 2Q
+  ntt_harvey1024_ct_std2rev_asm(a);
+
+  harvey_mul_array32_asm(b, 1024, ntt_harvey1024_psi_powers);
+  ntt_harvey1024_ct_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), 0 <= a[i], b[i] < 4Q
+  harvey_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i], 0 <= c[i] < 2Q
+
+  intt_harvey1024_gs_rev2std_asm(c);
+  harvey_mul_finalize_asm(c, 1024, ntt_harvey1024_scaled_inv_psi_powers); // rescale by 1/n, convert to [0, Q-1]
+}
+
+void ntt_harvey1024_product4_asm(uint32_t *c, uint32_t *a, uint32_t *b) {
+  harvey_mul_array32_asm(a, 1024, ntt_harvey1024_psi_powers); // 0 <= a[i] < 2Q
+  ntt_harvey1024_gs_std2rev_asm(a);
+
+  harvey_mul_array32_asm(b, 1024, ntt_harvey1024_psi_powers);
+  ntt_harvey1024_gs_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), 0 <= a[i], b[i] < 2Q
+  harvey_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i], 0 <= c[i] < 2Q
+
+  intt_harvey1024_gs_rev2std_asm(c);
+  harvey_mul_finalize_asm(c, 1024, ntt_harvey1024_scaled_inv_psi_powers); // rescale by 1/n, convert to [0, Q-1]
+}
+
+void ntt_harvey1024_product5_asm(uint32_t *c, uint32_t *a, uint32_t *b) {
+  mulntt_harvey1024_ct_std2rev_asm(a);
+  mulntt_harvey1024_ct_std2rev_asm(b);
+
+  // 0 <= a[i], b[i] < 4Q
+  harvey_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i], 0 <= c[i] < 2Q
+
+  inttmul_harvey1024_gs_rev2std_asm(c);
+  harvey_scalar_mul_finalize_asm(c, 1024, ntt_harvey1024_inv_n, ntt_harvey1024_inv_n_shoup); // divide by n, convert to [0, Q-1]
+}
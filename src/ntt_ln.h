@@ -0,0 +1,89 @@
+/*
+ * BD: Longa-Naehrig reduction for several moduli.
+ *
+ * ntt_red.h and ntt_asm.S are specialized to Q = 12289 = 3 * 2^12 + 1.
+ * The same reduction works for any prime q = k * 2^m + 1:
+ *
+ *    red(x) = k * (x & (2^m - 1)) - (x >> m)  ==  k * x  (modulo q)
+ *
+ * This module instantiates the reduction, the lazy NTTs, and the
+ * product for the following moduli:
+ *
+ *       q      k    m    n
+ *    7681     15    9   256
+ *   12289      3   12  1024
+ *   40961      5   13  1024
+ *   65537      1   16  1024
+ *  786433      3   18  1024
+ *
+ * The body is in ntt_ln_impl.h (C) and ntt_ln_asm.S (AVX2). Each one
+ * is compiled once per modulus with q, k, m as compile-time constants.
+ * The functions for modulus q are prefixed with ntt_ln<q>_.
+ *
+ * The tables and the lazy-reduction schedule for q are in
+ * ntt_ln<q>_tables.h (generated by make_ln_tables). The schedule is
+ * computed with the bounds of red_bounds.c for this q. With k = 15
+ * (q = 7681), red only removes 9 bits and multiplies by 15 so the NTTs
+ * must reduce some rounds. With k = 1 (q = 65537), almost no reductions
+ * are needed.
+ *
+ * The tables are 32bit integers (the coefficients don't fit in 16 bits
+ * for q > 65536). The twiddle factors include inverse(k) as in ntt_red.
+ */
+
+#ifndef __NTT_LN_H
+#define __NTT_LN_H
+
+#include <stdint.h>
+
+/*
+ * Functions for modulus q:
+ *
+ * - normalize(a, n): a[i] := a[i] mod q, in [0, q-1]
+ * - reduce_array(a, n): a[i] := red(a[i])
+ * - correct(a, n): from [-q, 2q-1] to [0, q-1]
+ * - mul_reduce_array(c, n, a, b): c[i] := red(a[i] * b[i])
+ * - scalar_mul_reduce_array(a, n, c): a[i] := red(a[i] * c)
+ *
+ * - mulntt_ct_std2rev_lazy(a, n, p, rounds): as in ntt_red.h with 32bit
+ *   table p (e.g. ntt_ln<q>_mixed_powers_rev). The outputs of round k
+ *   are reduced if bit k of rounds is set.
+ * - nttmul_gs_rev2std_lazy(a, n, p, rounds): same thing for the inverse
+ *   NTT (e.g., with ntt_ln<q>_inv_mixed_powers_rev).
+ *
+ * - product(c, a, b): c = a * b modulo (X^n + 1) with n = ntt_ln<q>_n.
+ *   The inputs must be in [0, q-1]. The result is in [0, q-1].
+ *   a and b are modified.
+ *
+ * AVX2 versions (_asm suffix): same results as the C versions.
+ * - the array sizes must be multiples of 8
+ * - ct_std2rev_rounds_asm and gs_rev2std_rounds_asm do the rounds with
+ *   distance d >= 8 (the lazy NTTs complete the others in C).
+ *   The three small-distance rounds of each NTT are not vectorized.
+ */
+#define NTT_LN_DECLARE(q) \
+  extern void ntt_ln##q##_normalize(int32_t *a, uint32_t n); \
+  extern void ntt_ln##q##_reduce_array(int32_t *a, uint32_t n); \
+  extern void ntt_ln##q##_correct(int32_t *a, uint32_t n); \
+  extern void ntt_ln##q##_mul_reduce_array(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b); \
+  extern void ntt_ln##q##_scalar_mul_reduce_array(int32_t *a, uint32_t n, int32_t c); \
+  extern void ntt_ln##q##_mulntt_ct_std2rev_lazy(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_nttmul_gs_rev2std_lazy(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_product(int32_t *c, int32_t *a, int32_t *b); \
+  extern void ntt_ln##q##_reduce_array_asm(int32_t *a, uint32_t n); \
+  extern void ntt_ln##q##_correct_asm(int32_t *a, uint32_t n); \
+  extern void ntt_ln##q##_mul_reduce_array_asm(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b); \
+  extern void ntt_ln##q##_scalar_mul_reduce_array_asm(int32_t *a, uint32_t n, int32_t c); \
+  extern void ntt_ln##q##_ct_std2rev_rounds_asm(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_gs_rev2std_rounds_asm(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_mulntt_ct_std2rev_lazy_asm(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_nttmul_gs_rev2std_lazy_asm(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds); \
+  extern void ntt_ln##q##_product_asm(int32_t *c, int32_t *a, int32_t *b);
+
+NTT_LN_DECLARE(7681)
+NTT_LN_DECLARE(12289)
+NTT_LN_DECLARE(40961)
+NTT_LN_DECLARE(65537)
+NTT_LN_DECLARE(786433)
+
+#endif /* __NTT_LN_H */
@@ -0,0 +1,11 @@
+/*
+ * BD: Longa-Naehrig backend for q = 12289 = 3 * 2^12 + 1
+ */
+
+#define LN_Q 12289
+#define LN_K 3
+#define LN_M 12
+#define LN_NAME(f) ntt_ln12289_##f
+
+#include "ntt_ln12289_tables.h"
+#include "ntt_ln_impl.h"
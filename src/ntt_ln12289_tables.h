@@ -0,0 +1,60 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 12289 = 3 * 2^12 + 1
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ *
+ * Lazy-reduction schedule (inputs in [0, 12288]): 4 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 32560
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 83045022
+ * - pointwise product, then 1 reductions: |c[i]| <= 173456
+ * - inverse NTT: reduced rounds = 9: |c[i]| <= 759292
+ * - final step: rescale, then 1 reductions
+ * - max |z| for mul_red(z) = 8796042698752
+ */
+
+#ifndef __NTT_LN12289_TABLES_H
+#define __NTT_LN12289_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_ln12289_q = 12289;
+static const uint32_t ntt_ln12289_k = 3;
+static const uint32_t ntt_ln12289_m = 12;
+static const uint32_t ntt_ln12289_n = 1024;
+static const uint32_t ntt_ln12289_psi = 1014;
+static const uint32_t ntt_ln12289_inv_k = 8193;
+static const uint32_t ntt_ln12289_inv_n = 12277;
+
+/*
+ * SCHEDULE
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_ln12289_fwd_a_rounds = 0x0;
+static const uint32_t ntt_ln12289_fwd_a_reductions = 1;
+static const uint32_t ntt_ln12289_fwd_b_rounds = 0x0;
+static const uint32_t ntt_ln12289_fwd_b_reductions = 0;
+static const uint32_t ntt_ln12289_pointwise_reductions = 1;
+static const uint32_t ntt_ln12289_inv_rounds = 0x200;
+static const uint32_t ntt_ln12289_final_reductions = 1;
+static const int32_t ntt_ln12289_rescale = 1416;
+
+/*
+ * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev
+ */
+extern const int32_t ntt_ln12289_mixed_powers_rev[1024];
+extern const int32_t ntt_ln12289_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT_LN12289_TABLES_H */
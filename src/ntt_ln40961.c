@@ -0,0 +1,11 @@
+/*
+ * BD: Longa-Naehrig backend for q = 40961 = 5 * 2^13 + 1
+ */
+
+#define LN_Q 40961
+#define LN_K 5
+#define LN_M 13
+#define LN_NAME(f) ntt_ln40961_##f
+
+#include "ntt_ln40961_tables.h"
+#include "ntt_ln_impl.h"
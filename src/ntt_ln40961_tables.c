@@ -0,0 +1,286 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 40961 = 5 * 2^13 + 1
+ * - n = 1024
+ * - psi = 32
+ * - omega = psi^2 = 1024
+ * - inverse of psi = 39681
+ * - inverse of omega = 40921
+ * - inverse of n = 40921
+ * - inverse of k = 32769
+ *
+ * Lazy-reduction schedule (inputs in [0, 40960]): 5 reductions
+ * - forward NTT of a: reduced rounds = 9, then 0 reductions: |a[i]| <= 1020119
+ * - forward NTT of b: reduced rounds = 9, then 0 reductions: |b[i]| <= 1020119
+ * - pointwise product, then 1 reductions: |c[i]| <= 56467
+ * - inverse NTT: reduced rounds = 6: |c[i]| <= 25923160
+ * - final step: rescale, then 1 reductions
+ * - max |z| for mul_red(z) = 17591850532864
+ */
+
+#include "ntt_ln40961_tables.h"
+
+const int32_t ntt_ln40961_mixed_powers_rev[1024] = {
+          0,   -5284,   14528,   15771,    1711,   16324,   11366,   -4629,
+     -10117,  -20346,  -17579,  -19599,    -342,  -16741,   20447,  -16072,
+       5279,    1025,  -10322,  -11098,  -18138,    3221,    7206,    4208,
+     -13456,    7001,    8503,  -19136,  -15670,    8573,   -3571,   12637,
+     -13010,   20449,    5792,    5656,   -9513,   -3236,  -12250,   12139,
+      -9537,   16429,    5713,    3825,    5277,   12904,    8242,   -4964,
+      18074,    8258,   13388,  -12725,   -4705,  -10535,    7384,   11963,
+      17191,  -10652,   17194,   -7990,   19015,   10365,    3719,    9459,
+      -6095,   12209,    6649,   15149,     628,   -2555,  -12634,    -909,
+       2128,   17693,   -8894,  -13777,   18356,   12720,   17368,  -17438,
+      17283,   16368,  -17530,   -3427,  -13145,  -17419,  -10929,   10091,
+      11029,   10374,   -9639,    7843,   19912,  -12917,   -7152,    2747,
+      18231,   -2621,  -10251,   -2712,  -13283,  -16988,     196,  -17234,
+     -19181,   -7472,  -19425,    8131,   -3689,   17161,   -2098,    8927,
+      -2583,    1834,   13221,   16588,  -19586,    1807,   12334,  -19525,
+      -4535,    3775,  -14038,  -17895,   -6858,   17857,    2562,  -20468,
+      -3282,   -3997,  -11460,  -10512,  -19225,    8100,   20334,   20196,
+       5037,    4749,  -16933,   -6182,     563,   -5617,   17242,   -6359,
+       4125,   14721,   10285,    5574,  -19007,  -16920,    3947,    6966,
+      -7791,    9195,   19897,   14734,   -8458,   18105,  -15081,   12373,
+       5368,  -15578,  -17200,    2666,    5959,   17304,  -14088,   -7647,
+      -9811,    5412,    9399,  -15998,   -4016,   13730,    2002,  -12189,
+       4261,  -14792,   17724,   -1928,   -2435,  -17031,   -8802,   13243,
+      -5903,   18733,  -14172,    -261,    4748,  -19578,    3100,   20000,
+      -7812,   -9439,   10014,   -2781,   16692,  -16514,   20319,    6886,
+      19253,  -10562,    6497,   16811,    5234,    2056,   -2242,    4034,
+        -66,  -17603,   -1803,   -2383,    8824,   19932,   17632,   12013,
+     -20192,   -3424,  -15392,   -4168,  -10023,   -5205,   11055,   19791,
+       8434,    1560,   -7917,   20274,  -20412,   -7486,   19559,   15196,
+      15886,   19247,    5748,  -19733,   -3868,   -5135,  -20021,  -15534,
+      -7605,   10395,   13807,   17726,  -14707,    2894,  -12639,    8308,
+      -6787,  -14718,   -1084,    7541,   19913,    1624,  -16434,    -320,
+       8397,   -3964,    7829,   10870,   -9259,    3688,    5860,   11380,
+       3325,   14845,  -19017,    1514,   18441,   19875,    6657,    8594,
+      -1156,  -15386,   -1790,  -18155,  -17979,  -19537,    5964,    8087,
+     -16048,     849,  -17621,  -15906,   10632,   13098,  -11175,   -3388,
+      -9915,    8705,   -8337,   16243,    7406,    4177,   -9934,   19153,
+     -17170,  -11675,   -7311,  -15456,   -3204,  -16707,    1842,   -3972,
+      -6596,   18226,  -12623,   -4802,   15478,  -15097,  -16569,    2773,
+      -9646,  -12022,   -6574,   10440,   14885,    4861,   -1117,   19220,
+     -15208,    8911,    9050,  -11643,  -12304,    5184,    6460,   11287,
+       8139,   12870,  -14114,  -17064,   -4555,    -318,    7758,    2484,
+       2640,    7783,   -9802,   13398,   15689,  -19021,   -8943,   11012,
+     -11540,   14077,    1265,    2876,   -8690,    3395,    8371,  -13381,
+      -9672,   19522,  -11008,    8260,   -2740,   12713,   -4101,    6575,
+      19936,    8379,   15846,   11061,   -9124,     595,  -18380,    6945,
+      17473,   -6190,  -19787,  -12703,   14826,    7123,   14028,   -4632,
+     -15247,   15266,    2399,  -14913,  -18261,   16962,    1984,   12800,
+      -1966,    3172,  -20194,    8455,   15841,   20278,   13828,   -4601,
+      -3198,  -11383,  -12889,   18587,    3058,  -17268,    1617,    1183,
+       5017,     656,    4863,   14197,   -6693,     423,  -13411,    5970,
+       9411,   -5350,   16911,   13968,  -18221,  -15813,    -647,   13003,
+       8058,  -18043,     430,  -14403,   -1173,  -16817,   -7840,   -6977,
+     -11019,   12153,   -1259,    2448,  -16284,    9897,    1998,   11569,
+     -19563,    8562,    3653,   -8144,    5181,    9642,   -1828,    2741,
+      17556,   12844,  -11934,   19463,  -12407,  -17943,   20403,    -500,
+     -12093,    1260,   14086,   19526,   11871,    6557,   -1532,    5972,
+      12831,   -1784,   17246,   10844,   -6275,   16333,   -1992,   -6245,
+      14338,   -2632,   -3027,   17468,  -16605,   11790,   -8633,   13012,
+       8697,   16470,    8577,   -8088,   17659,   -4990,   15084,   -9711,
+      -6355,     -39,    3270,   -6651,  -11778,   -5957,   -1513,   -4476,
+       5747,    6687,  -12432,  -12819,   12385,  -15232,   19957,  -13948,
+      -4930,   -5380,    6823,    5701,   13680,   14264,    1340,  -12496,
+      13482,    2416,   -4069,  -19645,   -7666,  -16425,    6555,       8,
+     -16378,   -5244,   14325,   13140,   13791,  -10125,   -4937,   15716,
+       3944,    4304,   10926,  -12753,  -10944,   -3219,   -1072,   18189,
+       5084,   -8161,   -2616,   13513,   -6962,  -19811,  -15174,   11773,
+      19979,   19227,  -14631,    2063,   -9908,  -12391,    8611,   -5226,
+      -6710,   -1008,  -19461,   17148,  -17689,   19331,   17610,   19799,
+     -18457,   -6765,   18972,    -483,    5020,    3318,   17978,    4996,
+       4914,   18490,   18806,    2410,   13284,   -9432,   -9478,   14167,
+      17619,  -13176,   17715,   -9914,   -5935,    3992,   -3875,   15961,
+       9765,  -18922,    7963,   -6764,   20096,     162,    5322,   11873,
+     -13826,   -7278,    2119,    9707,   13938,   -2570,  -17678,   15438,
+     -20398,   -8717,   12494,   13219,  -11030,   16046,   18921,   -4776,
+     -15721,    4280,   19240,    5210,  -18192,   -3734,   16902,    5982,
+       9938,   -1950,    -344,   -4862,  -15446,  -11123,    6272,  -18995,
+        623,    6662,   -7185,   14426,    4835,   16659,   14786,   -1063,
+       -734,   17727,   13462,   -1677,  -12337,   16863,  -14922,  -10385,
+      18724,   -2083,    1355,     814,  -14651,   -2030,      62,     400,
+      17859,   -5021,    1929,   -8696,    -785,   13434,   -4688,   -9104,
+      -2660,  -11876,   -9363,    6981,   18016,  -15900,   19251,    1317,
+       9117,  -20460,    1432,   14524,    6191,   -8947,    3421,   18107,
+      -3546,    7513,  -18672,  -20044,   16071,    5906,    8940,  -13674,
+       7932,   -6964,  -17907,    3390,  -14117,  -19726,    -245,    1062,
+      13736,    9340,   14041,  -20404,   -5629,  -11211,  -17858,   19562,
+      13469,   18188,   -6286,   20226,    4002,  -12499,    5063,   14166,
+      15909,  -14959,   -2933,   -8352,  -11908,  -12081,   17278,  -15376,
+      -4218,  -15321,   -7240,   -7070,    1651,    4045,   -5168,   15547,
+       1681,  -10296,    3099,    5459,    3644,  -16130,   10178,    6205,
+      -2112,   10158,  -16735,    5666,   -4359,  -17552,   -9230,   15767,
+       9232,   13315,   -1012,  -10493,    6952,   -2716,  -14889,   18897,
+     -16839,    8959,   -7578,   -6608,    2192,    6214,   11473,   -5260,
+      16820,    1489,   20092,  -17041,    -893,    -476,   14704,   -5556,
+       2406,    4952,   -8747,   -6222,  -20053,   10686,    5162,   20090,
+     -12379,  -20405,    6273,   -4454,  -18160,   11007,    6605,  -10240,
+     -18023,   -3965,    4762,   20152,   -9561,   -4867,  -17285,   -4489,
+     -16483,  -16492,    5871,    7487,   16658,  -19376,    8219,  -11719,
+       3969,    -820,  -16319,   -7506,   -1874,  -10769,  -13957,   13018,
+      18957,  -13793,    9582,  -17460,   12536,    9526,   11049,   14467,
+      10408,   -8167,   19943,  -12717,   -8774,   10781,    9800,   -1519,
+     -16947,   -4951,   11814,   -3060,   20355,   -2131,   17983,   -4221,
+      -6267,    9778,    5674,   10180,    3764,    8428,    2285,    6814,
+      19016,  -16055,   -5563,    6392,  -15212,   -8292,    5217,     625,
+       4876,   -1575,    2873,   -3927,   15882,    2044,    1915,   -7465,
+      14682,    2230,   -1077,  -13555,   18084,  -10176,    2490,   -2434,
+       2558,    3290,   14024,   19126,   10516,    5743,     551,  -16265,
+       -631,    -107,    -481,   10110,    8647,  -14243,  -18855,  -18582,
+      18184,   10289,   16393,   18554,   -5758,   -2794,   -8349,    5595,
+     -17424,  -18599,   15540,  -14697,   -5241,   19040,  -14706,   17435,
+     -14318,    6725,  -18769,    3114,  -17100,  -17830,   -1675,   15620,
+       3628,   -3020,   -5154,   14316,  -10898,   10291,  -18434,     -10,
+      19010,   19582,    9168,  -16167,   15380,   -6480,   -8075,   16612,
+     -20414,    4393,   -2838,  -19631,   15934,  -20083,   10783,   -3105,
+      -3300,  -19969,   -8228,    3733,   -9371,   13536,  -19542,  -13765,
+      14425,   -7356,    8659,   -3595,   -9618,  -14484,   20257,    6486,
+      12090,   -3922,   13760,  -10325,    3425,   -5651,   -5114,  -18459,
+      16041,   20247,     673,   -3586,   11405,  -10984,  -17986,    1559,
+     -11601,  -12743,   -5987,  -14842,    1948,  -19144,  -17535,    5790,
+     -11662,    1398,  -13239,    8401,   12586,    -722,   -2480,  -16000,
+     -18327,    -641,     181,   10417,   11223,    5019,   -8063,  -13701,
+        982,  -16127,   19379,   19320,    4005,   -9837,   18178,    4965,
+       8245,   -2302,  -14942,  -14478,    1133,    8631,   10471,    6774,
+      -8423,   -5453,  -12263,  -13050,   -8366,    4164,   -8844,   16936,
+       1445,   -1248,  -18243,   -8027,   -8247,   14181,   -7455,  -20349,
+      20060,    9179,   11786,    -598,  -13290,    4108,  -16752,    4235,
+       6084,   -8316,   13531,   18588,  -12811,    5877,    1919,    9738,
+     -19147,   -4610,   -7325,  -14225,     454,    6893,    4955,     256,
+};
+
+const int32_t ntt_ln40961_inv_mixed_powers_rev[1024] = {
+          0,    5284,  -15771,  -14528,    4629,  -11366,  -16324,   -1711,
+      16072,  -20447,   16741,     342,   19599,   17579,   20346,   10117,
+     -12637,    3571,   -8573,   15670,   19136,   -8503,   -7001,   13456,
+      -4208,   -7206,   -3221,   18138,   11098,   10322,   -1025,   -5279,
+      -9459,   -3719,  -10365,  -19015,    7990,  -17194,   10652,  -17191,
+     -11963,   -7384,   10535,    4705,   12725,  -13388,   -8258,  -18074,
+       4964,   -8242,  -12904,   -5277,   -3825,   -5713,  -16429,    9537,
+     -12139,   12250,    3236,    9513,   -5656,   -5792,  -20449,   13010,
+      20468,   -2562,  -17857,    6858,   17895,   14038,   -3775,    4535,
+      19525,  -12334,   -1807,   19586,  -16588,  -13221,   -1834,    2583,
+      -8927,    2098,  -17161,    3689,   -8131,   19425,    7472,   19181,
+      17234,    -196,   16988,   13283,    2712,   10251,    2621,  -18231,
+      -2747,    7152,   12917,  -19912,   -7843,    9639,  -10374,  -11029,
+     -10091,   10929,   17419,   13145,    3427,   17530,  -16368,  -17283,
+      17438,  -17368,  -12720,  -18356,   13777,    8894,  -17693,   -2128,
+        909,   12634,    2555,    -628,  -15149,   -6649,  -12209,    6095,
+        320,   16434,   -1624,  -19913,   -7541,    1084,   14718,    6787,
+      -8308,   12639,   -2894,   14707,  -17726,  -13807,  -10395,    7605,
+      15534,   20021,    5135,    3868,   19733,   -5748,  -19247,  -15886,
+     -15196,  -19559,    7486,   20412,  -20274,    7917,   -1560,   -8434,
+     -19791,  -11055,    5205,   10023,    4168,   15392,    3424,   20192,
+     -12013,  -17632,  -19932,   -8824,    2383,    1803,   17603,      66,
+      -4034,    2242,   -2056,   -5234,  -16811,   -6497,   10562,  -19253,
+      -6886,  -20319,   16514,  -16692,    2781,  -10014,    9439,    7812,
+     -20000,   -3100,   19578,   -4748,     261,   14172,  -18733,    5903,
+     -13243,    8802,   17031,    2435,    1928,  -17724,   14792,   -4261,
+      12189,   -2002,  -13730,    4016,   15998,   -9399,   -5412,    9811,
+       7647,   14088,  -17304,   -5959,   -2666,   17200,   15578,   -5368,
+     -12373,   15081,  -18105,    8458,  -14734,  -19897,   -9195,    7791,
+      -6966,   -3947,   16920,   19007,   -5574,  -10285,  -14721,   -4125,
+       6359,  -17242,    5617,    -563,    6182,   16933,   -4749,   -5037,
+     -20196,  -20334,   -8100,   19225,   10512,   11460,    3997,    3282,
+         -8,   -6555,   16425,    7666,   19645,    4069,   -2416,  -13482,
+      12496,   -1340,  -14264,  -13680,   -5701,   -6823,    5380,    4930,
+      13948,  -19957,   15232,  -12385,   12819,   12432,   -6687,   -5747,
+       4476,    1513,    5957,   11778,    6651,   -3270,      39,    6355,
+       9711,  -15084,    4990,  -17659,    8088,   -8577,  -16470,   -8697,
+     -13012,    8633,  -11790,   16605,  -17468,    3027,    2632,  -14338,
+       6245,    1992,  -16333,    6275,  -10844,  -17246,    1784,  -12831,
+      -5972,    1532,   -6557,  -11871,  -19526,  -14086,   -1260,   12093,
+        500,  -20403,   17943,   12407,  -19463,   11934,  -12844,  -17556,
+      -2741,    1828,   -9642,   -5181,    8144,   -3653,   -8562,   19563,
+     -11569,   -1998,   -9897,   16284,   -2448,    1259,  -12153,   11019,
+       6977,    7840,   16817,    1173,   14403,    -430,   18043,   -8058,
+     -13003,     647,   15813,   18221,  -13968,  -16911,    5350,   -9411,
+      -5970,   13411,    -423,    6693,  -14197,   -4863,    -656,   -5017,
+      -1183,   -1617,   17268,   -3058,  -18587,   12889,   11383,    3198,
+       4601,  -13828,  -20278,  -15841,   -8455,   20194,   -3172,    1966,
+     -12800,   -1984,  -16962,   18261,   14913,   -2399,  -15266,   15247,
+       4632,  -14028,   -7123,  -14826,   12703,   19787,    6190,  -17473,
+      -6945,   18380,    -595,    9124,  -11061,  -15846,   -8379,  -19936,
+      -6575,    4101,  -12713,    2740,   -8260,   11008,  -19522,    9672,
+      13381,   -8371,   -3395,    8690,   -2876,   -1265,  -14077,   11540,
+     -11012,    8943,   19021,  -15689,  -13398,    9802,   -7783,   -2640,
+      -2484,   -7758,     318,    4555,   17064,   14114,  -12870,   -8139,
+     -11287,   -6460,   -5184,   12304,   11643,   -9050,   -8911,   15208,
+     -19220,    1117,   -4861,  -14885,  -10440,    6574,   12022,    9646,
+      -2773,   16569,   15097,  -15478,    4802,   12623,  -18226,    6596,
+       3972,   -1842,   16707,    3204,   15456,    7311,   11675,   17170,
+     -19153,    9934,   -4177,   -7406,  -16243,    8337,   -8705,    9915,
+       3388,   11175,  -13098,  -10632,   15906,   17621,    -849,   16048,
+      -8087,   -5964,   19537,   17979,   18155,    1790,   15386,    1156,
+      -8594,   -6657,  -19875,  -18441,   -1514,   19017,  -14845,   -3325,
+     -11380,   -5860,   -3688,    9259,  -10870,   -7829,    3964,   -8397,
+       -256,   -4955,   -6893,    -454,   14225,    7325,    4610,   19147,
+      -9738,   -1919,   -5877,   12811,  -18588,  -13531,    8316,   -6084,
+      -4235,   16752,   -4108,   13290,     598,  -11786,   -9179,  -20060,
+      20349,    7455,  -14181,    8247,    8027,   18243,    1248,   -1445,
+     -16936,    8844,   -4164,    8366,   13050,   12263,    5453,    8423,
+      -6774,  -10471,   -8631,   -1133,   14478,   14942,    2302,   -8245,
+      -4965,  -18178,    9837,   -4005,  -19320,  -19379,   16127,    -982,
+      13701,    8063,   -5019,  -11223,  -10417,    -181,     641,   18327,
+      16000,    2480,     722,  -12586,   -8401,   13239,   -1398,   11662,
+      -5790,   17535,   19144,   -1948,   14842,    5987,   12743,   11601,
+      -1559,   17986,   10984,  -11405,    3586,    -673,  -20247,  -16041,
+      18459,    5114,    5651,   -3425,   10325,  -13760,    3922,  -12090,
+      -6486,  -20257,   14484,    9618,    3595,   -8659,    7356,  -14425,
+      13765,   19542,  -13536,    9371,   -3733,    8228,   19969,    3300,
+       3105,  -10783,   20083,  -15934,   19631,    2838,   -4393,   20414,
+     -16612,    8075,    6480,  -15380,   16167,   -9168,  -19582,  -19010,
+         10,   18434,  -10291,   10898,  -14316,    5154,    3020,   -3628,
+     -15620,    1675,   17830,   17100,   -3114,   18769,   -6725,   14318,
+     -17435,   14706,  -19040,    5241,   14697,  -15540,   18599,   17424,
+      -5595,    8349,    2794,    5758,  -18554,  -16393,  -10289,  -18184,
+      18582,   18855,   14243,   -8647,  -10110,     481,     107,     631,
+      16265,    -551,   -5743,  -10516,  -19126,  -14024,   -3290,   -2558,
+       2434,   -2490,   10176,  -18084,   13555,    1077,   -2230,  -14682,
+       7465,   -1915,   -2044,  -15882,    3927,   -2873,    1575,   -4876,
+       -625,   -5217,    8292,   15212,   -6392,    5563,   16055,  -19016,
+      -6814,   -2285,   -8428,   -3764,  -10180,   -5674,   -9778,    6267,
+       4221,  -17983,    2131,  -20355,    3060,  -11814,    4951,   16947,
+       1519,   -9800,  -10781,    8774,   12717,  -19943,    8167,  -10408,
+     -14467,  -11049,   -9526,  -12536,   17460,   -9582,   13793,  -18957,
+     -13018,   13957,   10769,    1874,    7506,   16319,     820,   -3969,
+      11719,   -8219,   19376,  -16658,   -7487,   -5871,   16492,   16483,
+       4489,   17285,    4867,    9561,  -20152,   -4762,    3965,   18023,
+      10240,   -6605,  -11007,   18160,    4454,   -6273,   20405,   12379,
+     -20090,   -5162,  -10686,   20053,    6222,    8747,   -4952,   -2406,
+       5556,  -14704,     476,     893,   17041,  -20092,   -1489,  -16820,
+       5260,  -11473,   -6214,   -2192,    6608,    7578,   -8959,   16839,
+     -18897,   14889,    2716,   -6952,   10493,    1012,  -13315,   -9232,
+     -15767,    9230,   17552,    4359,   -5666,   16735,  -10158,    2112,
+      -6205,  -10178,   16130,   -3644,   -5459,   -3099,   10296,   -1681,
+     -15547,    5168,   -4045,   -1651,    7070,    7240,   15321,    4218,
+      15376,  -17278,   12081,   11908,    8352,    2933,   14959,  -15909,
+     -14166,   -5063,   12499,   -4002,  -20226,    6286,  -18188,  -13469,
+     -19562,   17858,   11211,    5629,   20404,  -14041,   -9340,  -13736,
+      -1062,     245,   19726,   14117,   -3390,   17907,    6964,   -7932,
+      13674,   -8940,   -5906,  -16071,   20044,   18672,   -7513,    3546,
+     -18107,   -3421,    8947,   -6191,  -14524,   -1432,   20460,   -9117,
+      -1317,  -19251,   15900,  -18016,   -6981,    9363,   11876,    2660,
+       9104,    4688,  -13434,     785,    8696,   -1929,    5021,  -17859,
+       -400,     -62,    2030,   14651,    -814,   -1355,    2083,  -18724,
+      10385,   14922,  -16863,   12337,    1677,  -13462,  -17727,     734,
+       1063,  -14786,  -16659,   -4835,  -14426,    7185,   -6662,    -623,
+      18995,   -6272,   11123,   15446,    4862,     344,    1950,   -9938,
+      -5982,  -16902,    3734,   18192,   -5210,  -19240,   -4280,   15721,
+       4776,  -18921,  -16046,   11030,  -13219,  -12494,    8717,   20398,
+     -15438,   17678,    2570,  -13938,   -9707,   -2119,    7278,   13826,
+     -11873,   -5322,    -162,  -20096,    6764,   -7963,   18922,   -9765,
+     -15961,    3875,   -3992,    5935,    9914,  -17715,   13176,  -17619,
+     -14167,    9478,    9432,  -13284,   -2410,  -18806,  -18490,   -4914,
+      -4996,  -17978,   -3318,   -5020,     483,  -18972,    6765,   18457,
+     -19799,  -17610,  -19331,   17689,  -17148,   19461,    1008,    6710,
+       5226,   -8611,   12391,    9908,   -2063,   14631,  -19227,  -19979,
+     -11773,   15174,   19811,    6962,  -13513,    2616,    8161,   -5084,
+     -18189,    1072,    3219,   10944,   12753,  -10926,   -4304,   -3944,
+     -15716,    4937,   10125,  -13791,  -13140,  -14325,    5244,   16378,
+};
+
@@ -0,0 +1,60 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 40961 = 5 * 2^13 + 1
+ * - n = 1024
+ * - psi = 32
+ * - omega = psi^2 = 1024
+ * - inverse of psi = 39681
+ * - inverse of omega = 40921
+ * - inverse of n = 40921
+ * - inverse of k = 32769
+ *
+ * Lazy-reduction schedule (inputs in [0, 40960]): 5 reductions
+ * - forward NTT of a: reduced rounds = 9, then 0 reductions: |a[i]| <= 1020119
+ * - forward NTT of b: reduced rounds = 9, then 0 reductions: |b[i]| <= 1020119
+ * - pointwise product, then 1 reductions: |c[i]| <= 56467
+ * - inverse NTT: reduced rounds = 6: |c[i]| <= 25923160
+ * - final step: rescale, then 1 reductions
+ * - max |z| for mul_red(z) = 17591850532864
+ */
+
+#ifndef __NTT_LN40961_TABLES_H
+#define __NTT_LN40961_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_ln40961_q = 40961;
+static const uint32_t ntt_ln40961_k = 5;
+static const uint32_t ntt_ln40961_m = 13;
+static const uint32_t ntt_ln40961_n = 1024;
+static const uint32_t ntt_ln40961_psi = 32;
+static const uint32_t ntt_ln40961_inv_k = 32769;
+static const uint32_t ntt_ln40961_inv_n = 40921;
+
+/*
+ * SCHEDULE
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_ln40961_fwd_a_rounds = 0x200;
+static const uint32_t ntt_ln40961_fwd_a_reductions = 0;
+static const uint32_t ntt_ln40961_fwd_b_rounds = 0x200;
+static const uint32_t ntt_ln40961_fwd_b_reductions = 0;
+static const uint32_t ntt_ln40961_pointwise_reductions = 1;
+static const uint32_t ntt_ln40961_inv_rounds = 0x40;
+static const uint32_t ntt_ln40961_final_reductions = 1;
+static const int32_t ntt_ln40961_rescale = 7217;
+
+/*
+ * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev
+ */
+extern const int32_t ntt_ln40961_mixed_powers_rev[1024];
+extern const int32_t ntt_ln40961_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT_LN40961_TABLES_H */
@@ -0,0 +1,11 @@
+/*
+ * BD: Longa-Naehrig backend for q = 65537 = 1 * 2^16 + 1
+ */
+
+#define LN_Q 65537
+#define LN_K 1
+#define LN_M 16
+#define LN_NAME(f) ntt_ln65537_##f
+
+#include "ntt_ln65537_tables.h"
+#include "ntt_ln_impl.h"
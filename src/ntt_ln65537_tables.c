@@ -0,0 +1,286 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 65537 = 1 * 2^16 + 1
+ * - n = 1024
+ * - psi = 33
+ * - omega = psi^2 = 1089
+ * - inverse of psi = 1986
+ * - inverse of omega = 11976
+ * - inverse of n = 65473
+ * - inverse of k = 1
+ *
+ * Lazy-reduction schedule (inputs in [0, 65536]): 1 reductions
+ * - forward NTT of a: reduced rounds = none, then 0 reductions: |a[i]| <= 6750848
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 6750848
+ * - pointwise product, then 0 reductions: |c[i]| <= 695465848
+ * - inverse NTT: reduced rounds = 1: |c[i]| <= 44420608
+ * - final step: rescale, then 0 reductions
+ * - max |z| for mul_red(z) = 140733193388032
+ */
+
+#include "ntt_ln65537_tables.h"
+
+const int32_t ntt_ln65537_mixed_powers_rev[1024] = {
+          0,    -256,    4096,      16,     -64,   16384,       4,   -1024,
+      -2048,      -8,     128,  -32768,      -2,     512,   -8192,     -32,
+        510,     514,   -8224,    8160,  -32640,   32641,    2040,    2056,
+       4112,   -4080,    -257,     255,   -1020,   -1028,   16448,  -16320,
+      -9589,   29915,  -19881,  -22350,   23863,  -13987,   27181,  -11414,
+     -22828,   11175,   17811,   27974,   19178,    5707,  -25775,  -20837,
+      24885,  -13471,   18925,    4938,  -19752,   10163,  -31534,   11653,
+      23306,   -2469,  -26033,  -20326,   15767,   26942,   27687,   -9876,
+       -564,   13310,  -16349,   -9024,  -29441,     141,   -2256,  -12297,
+     -24594,    4512,   -6655,    -282,    1128,  -26620,   32698,   18048,
+     -25492,  -27748,  -14791,  -14650,   -6937,    6373,   29106,   20082,
+     -25373,    7325,   13874,  -12746,  -14553,  -10041,   29582,   29300,
+     -31375,  -29051,    6057,   22296,  -23647,   24228,    5574,   14870,
+      29740,  -11148,  -18243,   17081,   -2787,   -7435,  -12114,   20945,
+     -10222,   -4648,    8831,  -32478,   -1162,  -30213,   24649,  -18592,
+      28353,   16239,    2324,   -5111,   20444,    9296,  -17662,    -581,
+       6255,  -28392,   -4487,  -30994,   -7098,  -17948,   25020,   17506,
+     -30525,   15497,   14196,  -29641,  -12510,   -8753,    8974,   -3549,
+     -21263,    3757,    5425,  -12523,  -15445,   21700,  -19515,   15028,
+      30056,  -26507,   30890,   22137,  -23011,   -7514,  -10850,   25046,
+     -12840,   10190,  -31966,   -8829,  -30221,    3210,   14177,  -24777,
+      15983,  -28354,   -5095,   -6420,   25680,  -20380,   -1605,   17658,
+       5300,   19477,   16053,   19263,  -11515,   -1325,   21200,   12371,
+      24742,   23137,   23030,    2650,  -10600,   26583,  -32106,   27011,
+      11178,   22060,  -25275,  -17763,    5515,   29974,  -20825,   22703,
+     -20131,  -23887,  -11030,    5589,  -22356,   21417,  -14987,  -30011,
+       -939,  -21764,   20539,  -15024,   -5441,   16619,   -3756,  -21519,
+      22499,    7512,   10882,   32299,    1878,  -22009,   24459,   30048,
+      32690,   20096,    6149,   -1256,    5024,   24596,    -314,   14847,
+      29694,     628,  -10048,   16345,     157,   25345,  -12298,    2512,
+      25502,   25188,   -9786,   14810,    6297,   26393,  -29066,  -30322,
+       4893,   -7405,  -12594,   12751,   14533,   15161,   19572,  -29620,
+       1089,  -16636,    4028,   17424,   -4159,   16112,    4356,   -1007,
+      -2014,   -8712,    8318,  -32224,   -2178,  -32265,   -8056,   30689,
+      31094,  -30087,   22633,  -26792,  -23906,   24995,   -6698,   10726,
+      21452,   13396,  -17725,   15547,    3349,   -5363,   20271,  -11953,
+     -22038,    5546,  -23199,  -24923,  -31382,  -27259,  -22615,   22184,
+     -21169,  -20307,   -2773,  -11019,  -21461,  -11092,  -19139,  -15691,
+     -32553,   10369,   30707,    3448,  -13792,   -8246,     862,  -24061,
+      17415,   -1724,   27584,   16492,    -431,  -20738,    4123,   -6896,
+     -24363,   10913,   22003,    3414,  -13656,   22475,  -31915,  -21885,
+      21767,   -1707,   27312,   20587,  -16811,  -21826,   21531,   -6828,
+      26900,   -5015,   14703,  -28359,  -17638,   -6725,  -23474,  -20060,
+      25417,  -18589,  -30261,   13450,   11737,   10030,  -29406,   -8819,
+     -22598,   17832,  -23164,   31654,    4458,  -27119,  -24855,    5791,
+      11582,  -15827,   -8916,  -11299,  -20341,   29873,  -19209,    2229,
+       9532,  -15323,  -16980,   21438,  -20215,   -2383,  -27409,    4245,
+       8490,  -10719,  -25107,    4766,  -19064,   30646,  -31577,   22661,
+      -4153,   14576,   28932,    -911,    3644,  -15346,  -16612,   -7233,
+     -14466,  -32313,   -7288,   30692,    8306,  -29152,    7673,    1822,
+     -20846,   28079,    9495,   -5851,   23404,  -27557,  -17847,  -18758,
+      28021,  -29843,   18729,  -10423,  -23845,    9379,  -18990,   11702,
+     -23379,   21157,  -10827,   19158,  -11095,   22229,  -27979,   19091,
+     -27355,   -9579,   22190,   21079,  -18779,   23223,   21654,   27221,
+       4444,  -23535,  -16662,    5567,  -22268,   -1111,   17776,  -28603,
+       8331,   29985,  -21001,    2222,   -8888,  -18467,  -32213,  -11134,
+     -17040,  -28739,    1065,  -10492,  -23569,    4260,   -2623,   16118,
+      32236,    5246,  -18399,   -8520,  -31457,   -8059,   -2130,   20984,
+      26021,   23398,   18854,   23114,  -26919,    9879,  -26990,   28055,
+      -9427,  -11557,  -11699,  -19758,   13495,   18741,   27829,   19309,
+      12819,   -4814,   11487,    8493,   31565,  -19589,  -14261,  -19256,
+      27025,   28522,    2407,  -26359,  -25638,    9628,  -22974,  -16986,
+     -16010,  -30271,   25577,    5988,  -23952,  -28766,    1497,    9990,
+      19980,   -2994,  -17633,   -8005,   32020,   -4995,   14383,  -11976,
+         33,   -8448,    4094,     528,   -2112,   16376,     132,   31745,
+      -2047,    -264,    4224,  -32752,     -66,   16896,   -8188,   -1056,
+      16830,   16962,   -9244,    7132,  -28528,   28561,    1783,    2311,
+       4622,   -3566,   -8481,    8415,   31877,   31613,   18488,  -14264,
+      11248,    4140,    -703,  -16643,    1035,   -2812,  -20545,   16560,
+     -32417,  -24447,   -2070,    5624,  -22496,   -8280,    1406,  -32251,
+     -30776,   14216,  -30845,   31880,    3554,    7694,    7970,   -8673,
+     -17346,  -15940,   -7108,  -15388,   -3985,  -28432,   -3847,    1777,
+     -18612,  -19529,  -15221,   29893,   11502,    4653,   -8911,  -12579,
+     -25158,   17822,  -23004,   -9306,  -28313,  -26479,   30442,    5751,
+      10745,    1834,  -29344,  -24691,  -32310,   13698,  -22557,    7336,
+      14672,  -20423,    -917,  -27396,  -21490,   -3668,   -6849,  -16155,
+      13217,   24372,    3270,   14861,    6093,   13080,  -12669,   31951,
+      -1635,   25338,  -12186,  -26160,  -26434,   16793,   -6540,  -29722,
+      -9641,  -22310,   29275,  -23182,   27191,  -13974,   26973,  -23703,
+      18131,   11591,   11155,   27948,   19282,  -20917,    6987,  -19173,
+       9804,  -19418,  -16997,   25790,   27914,   -2451,  -26321,  -12135,
+     -24270,  -12895,    9709,    4902,  -19608,  -26701,  -31543,   13957,
+      19228,   -7093,  -17586,  -20037,   14611,   -4807,   11375,  -28372,
+       8793,  -22750,  -29222,    9614,   27081,   14186,  -30365,  -25463,
+     -30498,    8585,   -6286,  -29209,  -14238,  -25144,    9082,  -31197,
+       3143,  -18164,   28476,  -15249,   -4541,  -17170,   12572,   -7119,
+     -21711,  -12629,    5453,  -19691,   13227,   21812,  -21307,   15021,
+      30042,  -22923,  -26454,   21913,  -22115,   25258,  -10906,  -26155,
+     -24348,    7073,   17906,    3654,  -14616,    6087,  -31855,   28292,
+      -8953,   -1827,   29232,  -12174,  -16841,  -14146,   29725,   -7308,
+     -30987,    2695,   22417,   28504,   17058,   24131,    7126,   10780,
+      21560,  -14252,   31421,   17275,   -3563,   -5390,   20703,    8529,
+      30178,    7798,    6306,   24089,  -30819,   25224,  -10362,   31192,
+      -3153,   20724,   -3899,   15089,    5181,  -15596,  -12612,   17359,
+     -10415,  -20777,    4747,   29971,   11190,   18988,   23877,  -17571,
+      30395,   17783,  -22380,   27561,   20830,  -23983,   -9494,    5595,
+     -29600,  -24692,    1850,  -14841,   -6173,    7400,   12674,   32306,
+       -925,  -25348,   12346,  -14800,   -6337,  -16153,   -3700,   29682,
+     -22490,   -9816,   25982,  -32155,   -2454,  -27146,  -24423,   26273,
+     -12991,  -16691,    4908,  -11245,  -20557,   19632,   13573,   -1227,
+      -6347,  -13593,   20877,   29522,   12986,   17971,  -25388,   11165,
+      22330,  -14761,  -25972,   29595,   12694,   27186,   23783,    6493,
+     -25657,   14492,   30276,  -17290,    3623,   -9970,   28446,   -7569,
+     -15138,    8645,   -7246,   19940,  -14223,  -28984,    4985,  -30957,
+     -17535,   32444,    5192,  -18412,    8111,   20768,   -4603,   -1298,
+      -2596,    9206,  -16222,   24001,  -30467,     649,  -10384,  -28713,
+     -29818,   31116,   26440,  -18329,    7779,  -25314,   11802,   -6610,
+     -13220,  -23604,  -15558,  -14909,   -5901,    3305,   12657,  -28879,
+     -24827,   -1377,   22032,   -4010,   16040,   22591,   31766,   -5508,
+     -11016,    2005,  -32080,   20355,  -15883,    2754,   21473,    8020,
+     -13129,   18637,   29493,  -13453,  -11725,  -13102,   13021,    9011,
+      18022,  -26042,   23450,   26204,   26258,   28263,    6551,   26906,
+      -5975,   22249,  -28299,  -30063,  -10822,   17878,  -23900,   23459,
+     -18619,  -17737,   21644,   29781,   11950,   21039,   -8939,   -5411,
+     -32548,    9089,  -14350,    3528,  -14112,    8137,     882,  -29181,
+       7175,   -1764,   28224,  -16274,    -441,  -18178,   28700,   -7056,
+      14937,  -22726,  -29606,  -23156,   27087,   12650,   -5789,  -25367,
+      14803,   11578,   11363,  -25300,  -29874,  -20085,   -6325,  -19225,
+      15578,    9789,  -25550,  -12900,  -13937,   28874,   -3225,  -26381,
+      12775,    6450,   27874,    7789,  -31156,  -19578,  -14437,   25800,
+      27513,  -30869,  -30392,  -18551,    8667,    9506,  -21022,    7598,
+      15196,  -23493,  -17334,  -19012,   10511,   -3799,   -4753,  -28435,
+       6712,  -14310,   32349,  -23682,   29191,   -1678,   26848,    8297,
+      16594,   11841,    7155,    3356,  -13424,   28620,     839,  -18173,
+      29805,  -27788,  -14151,   18121,   -6947,    8933,  -11854,   19922,
+     -25693,   23708,   13894,  -17866,    5927,   -9961,   28302,   29295,
+      -4034,  -15888,   -7940,     993,   -3972,  -31760,  -16136,    1985,
+       3970,   32272,    7944,   -2017,    8068,   31776,   15880,   -1986,
+};
+
+const int32_t ntt_ln65537_inv_mixed_powers_rev[1024] = {
+          0,     256,     -16,   -4096,    1024,      -4,  -16384,      64,
+         32,    8192,    -512,       2,   32768,    -128,       8,    2048,
+      16320,  -16448,    1028,    1020,    -255,     257,    4080,   -4112,
+      -2056,   -2040,  -32641,   32640,   -8160,    8224,    -514,    -510,
+       9876,  -27687,  -26942,  -15767,   20326,   26033,    2469,  -23306,
+     -11653,   31534,  -10163,   19752,   -4938,  -18925,   13471,  -24885,
+      20837,   25775,   -5707,  -19178,  -27974,  -17811,  -11175,   22828,
+      11414,  -27181,   13987,  -23863,   22350,   19881,  -29915,    9589,
+        581,   17662,   -9296,  -20444,    5111,   -2324,  -16239,  -28353,
+      18592,  -24649,   30213,    1162,   32478,   -8831,    4648,   10222,
+     -20945,   12114,    7435,    2787,  -17081,   18243,   11148,  -29740,
+     -14870,   -5574,  -24228,   23647,  -22296,   -6057,   29051,   31375,
+     -29300,  -29582,   10041,   14553,   12746,  -13874,   -7325,   25373,
+     -20082,  -29106,   -6373,    6937,   14650,   14791,   27748,   25492,
+     -18048,  -32698,   26620,   -1128,     282,    6655,   -4512,   24594,
+      12297,    2256,    -141,   29441,    9024,   16349,  -13310,     564,
+      29620,  -19572,  -15161,  -14533,  -12751,   12594,    7405,   -4893,
+      30322,   29066,  -26393,   -6297,  -14810,    9786,  -25188,  -25502,
+      -2512,   12298,  -25345,    -157,  -16345,   10048,    -628,  -29694,
+     -14847,     314,  -24596,   -5024,    1256,   -6149,  -20096,  -32690,
+     -30048,  -24459,   22009,   -1878,  -32299,  -10882,   -7512,  -22499,
+      21519,    3756,  -16619,    5441,   15024,  -20539,   21764,     939,
+      30011,   14987,  -21417,   22356,   -5589,   11030,   23887,   20131,
+     -22703,   20825,  -29974,   -5515,   17763,   25275,  -22060,  -11178,
+     -27011,   32106,  -26583,   10600,   -2650,  -23030,  -23137,  -24742,
+     -12371,  -21200,    1325,   11515,  -19263,  -16053,  -19477,   -5300,
+     -17658,    1605,   20380,  -25680,    6420,    5095,   28354,  -15983,
+      24777,  -14177,   -3210,   30221,    8829,   31966,  -10190,   12840,
+     -25046,   10850,    7514,   23011,  -22137,  -30890,   26507,  -30056,
+     -15028,   19515,  -21700,   15445,   12523,   -5425,   -3757,   21263,
+       3549,   -8974,    8753,   12510,   29641,  -14196,  -15497,   30525,
+     -17506,  -25020,   17948,    7098,   30994,    4487,   28392,   -6255,
+      11976,  -14383,    4995,  -32020,    8005,   17633,    2994,  -19980,
+      -9990,   -1497,   28766,   23952,   -5988,  -25577,   30271,   16010,
+      16986,   22974,   -9628,   25638,   26359,   -2407,  -28522,  -27025,
+      19256,   14261,   19589,  -31565,   -8493,  -11487,    4814,  -12819,
+     -19309,  -27829,  -18741,  -13495,   19758,   11699,   11557,    9427,
+     -28055,   26990,   -9879,   26919,  -23114,  -18854,  -23398,  -26021,
+     -20984,    2130,    8059,   31457,    8520,   18399,   -5246,  -32236,
+     -16118,    2623,   -4260,   23569,   10492,   -1065,   28739,   17040,
+      11134,   32213,   18467,    8888,   -2222,   21001,  -29985,   -8331,
+      28603,  -17776,    1111,   22268,   -5567,   16662,   23535,   -4444,
+     -27221,  -21654,  -23223,   18779,  -21079,  -22190,    9579,   27355,
+     -19091,   27979,  -22229,   11095,  -19158,   10827,  -21157,   23379,
+     -11702,   18990,   -9379,   23845,   10423,  -18729,   29843,  -28021,
+      18758,   17847,   27557,  -23404,    5851,   -9495,  -28079,   20846,
+      -1822,   -7673,   29152,   -8306,  -30692,    7288,   32313,   14466,
+       7233,   16612,   15346,   -3644,     911,  -28932,  -14576,    4153,
+     -22661,   31577,  -30646,   19064,   -4766,   25107,   10719,   -8490,
+      -4245,   27409,    2383,   20215,  -21438,   16980,   15323,   -9532,
+      -2229,   19209,  -29873,   20341,   11299,    8916,   15827,  -11582,
+      -5791,   24855,   27119,   -4458,  -31654,   23164,  -17832,   22598,
+       8819,   29406,  -10030,  -11737,  -13450,   30261,   18589,  -25417,
+      20060,   23474,    6725,   17638,   28359,  -14703,    5015,  -26900,
+       6828,  -21531,   21826,   16811,  -20587,  -27312,    1707,  -21767,
+      21885,   31915,  -22475,   13656,   -3414,  -22003,  -10913,   24363,
+       6896,   -4123,   20738,     431,  -16492,  -27584,    1724,  -17415,
+      24061,    -862,    8246,   13792,   -3448,  -30707,  -10369,   32553,
+      15691,   19139,   11092,   21461,   11019,    2773,   20307,   21169,
+     -22184,   22615,   27259,   31382,   24923,   23199,   -5546,   22038,
+      11953,  -20271,    5363,   -3349,  -15547,   17725,  -13396,  -21452,
+     -10726,    6698,  -24995,   23906,   26792,  -22633,   30087,  -31094,
+     -30689,    8056,   32265,    2178,   32224,   -8318,    8712,    2014,
+       1007,   -4356,  -16112,    4159,  -17424,   -4028,   16636,   -1089,
+       1986,  -15880,  -31776,   -8068,    2017,   -7944,  -32272,   -3970,
+      -1985,   16136,   31760,    3972,    -993,    7940,   15888,    4034,
+     -29295,  -28302,    9961,   -5927,   17866,  -13894,  -23708,   25693,
+     -19922,   11854,   -8933,    6947,  -18121,   14151,   27788,  -29805,
+      18173,    -839,  -28620,   13424,   -3356,   -7155,  -11841,  -16594,
+      -8297,  -26848,    1678,  -29191,   23682,  -32349,   14310,   -6712,
+      28435,    4753,    3799,  -10511,   19012,   17334,   23493,  -15196,
+      -7598,   21022,   -9506,   -8667,   18551,   30392,   30869,  -27513,
+     -25800,   14437,   19578,   31156,   -7789,  -27874,   -6450,  -12775,
+      26381,    3225,  -28874,   13937,   12900,   25550,   -9789,  -15578,
+      19225,    6325,   20085,   29874,   25300,  -11363,  -11578,  -14803,
+      25367,    5789,  -12650,  -27087,   23156,   29606,   22726,  -14937,
+       7056,  -28700,   18178,     441,   16274,  -28224,    1764,   -7175,
+      29181,    -882,   -8137,   14112,   -3528,   14350,   -9089,   32548,
+       5411,    8939,  -21039,  -11950,  -29781,  -21644,   17737,   18619,
+     -23459,   23900,  -17878,   10822,   30063,   28299,  -22249,    5975,
+     -26906,   -6551,  -28263,  -26258,  -26204,  -23450,   26042,  -18022,
+      -9011,  -13021,   13102,   11725,   13453,  -29493,  -18637,   13129,
+      -8020,  -21473,   -2754,   15883,  -20355,   32080,   -2005,   11016,
+       5508,  -31766,  -22591,  -16040,    4010,  -22032,    1377,   24827,
+      28879,  -12657,   -3305,    5901,   14909,   15558,   23604,   13220,
+       6610,  -11802,   25314,   -7779,   18329,  -26440,  -31116,   29818,
+      28713,   10384,    -649,   30467,  -24001,   16222,   -9206,    2596,
+       1298,    4603,  -20768,   -8111,   18412,   -5192,  -32444,   17535,
+      30957,   -4985,   28984,   14223,  -19940,    7246,   -8645,   15138,
+       7569,  -28446,    9970,   -3623,   17290,  -30276,  -14492,   25657,
+      -6493,  -23783,  -27186,  -12694,  -29595,   25972,   14761,  -22330,
+     -11165,   25388,  -17971,  -12986,  -29522,  -20877,   13593,    6347,
+       1227,  -13573,  -19632,   20557,   11245,   -4908,   16691,   12991,
+     -26273,   24423,   27146,    2454,   32155,  -25982,    9816,   22490,
+     -29682,    3700,   16153,    6337,   14800,  -12346,   25348,     925,
+     -32306,  -12674,   -7400,    6173,   14841,   -1850,   24692,   29600,
+      -5595,    9494,   23983,  -20830,  -27561,   22380,  -17783,  -30395,
+      17571,  -23877,  -18988,  -11190,  -29971,   -4747,   20777,   10415,
+     -17359,   12612,   15596,   -5181,  -15089,    3899,  -20724,    3153,
+     -31192,   10362,  -25224,   30819,  -24089,   -6306,   -7798,  -30178,
+      -8529,  -20703,    5390,    3563,  -17275,  -31421,   14252,  -21560,
+     -10780,   -7126,  -24131,  -17058,  -28504,  -22417,   -2695,   30987,
+       7308,  -29725,   14146,   16841,   12174,  -29232,    1827,    8953,
+     -28292,   31855,   -6087,   14616,   -3654,  -17906,   -7073,   24348,
+      26155,   10906,  -25258,   22115,  -21913,   26454,   22923,  -30042,
+     -15021,   21307,  -21812,  -13227,   19691,   -5453,   12629,   21711,
+       7119,  -12572,   17170,    4541,   15249,  -28476,   18164,   -3143,
+      31197,   -9082,   25144,   14238,   29209,    6286,   -8585,   30498,
+      25463,   30365,  -14186,  -27081,   -9614,   29222,   22750,   -8793,
+      28372,  -11375,    4807,  -14611,   20037,   17586,    7093,  -19228,
+     -13957,   31543,   26701,   19608,   -4902,   -9709,   12895,   24270,
+      12135,   26321,    2451,  -27914,  -25790,   16997,   19418,   -9804,
+      19173,   -6987,   20917,  -19282,  -27948,  -11155,  -11591,  -18131,
+      23703,  -26973,   13974,  -27191,   23182,  -29275,   22310,    9641,
+      29722,    6540,  -16793,   26434,   26160,   12186,  -25338,    1635,
+     -31951,   12669,  -13080,   -6093,  -14861,   -3270,  -24372,  -13217,
+      16155,    6849,    3668,   21490,   27396,     917,   20423,  -14672,
+      -7336,   22557,  -13698,   32310,   24691,   29344,   -1834,  -10745,
+      -5751,  -30442,   26479,   28313,    9306,   23004,  -17822,   25158,
+      12579,    8911,   -4653,  -11502,  -29893,   15221,   19529,   18612,
+      -1777,    3847,   28432,    3985,   15388,    7108,   15940,   17346,
+       8673,   -7970,   -7694,   -3554,  -31880,   30845,  -14216,   30776,
+      32251,   -1406,    8280,   22496,   -5624,    2070,   24447,   32417,
+     -16560,   20545,    2812,   -1035,   16643,     703,   -4140,  -11248,
+      14264,  -18488,  -31613,  -31877,   -8415,    8481,    3566,   -4622,
+      -2311,   -1783,  -28561,   28528,   -7132,    9244,  -16962,  -16830,
+       1056,    8188,  -16896,      66,   32752,   -4224,     264,    2047,
+     -31745,    -132,  -16376,    2112,    -528,   -4094,    8448,     -33,
+};
+
@@ -0,0 +1,60 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 65537 = 1 * 2^16 + 1
+ * - n = 1024
+ * - psi = 33
+ * - omega = psi^2 = 1089
+ * - inverse of psi = 1986
+ * - inverse of omega = 11976
+ * - inverse of n = 65473
+ * - inverse of k = 1
+ *
+ * Lazy-reduction schedule (inputs in [0, 65536]): 1 reductions
+ * - forward NTT of a: reduced rounds = none, then 0 reductions: |a[i]| <= 6750848
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 6750848
+ * - pointwise product, then 0 reductions: |c[i]| <= 695465848
+ * - inverse NTT: reduced rounds = 1: |c[i]| <= 44420608
+ * - final step: rescale, then 0 reductions
+ * - max |z| for mul_red(z) = 140733193388032
+ */
+
+#ifndef __NTT_LN65537_TABLES_H
+#define __NTT_LN65537_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_ln65537_q = 65537;
+static const uint32_t ntt_ln65537_k = 1;
+static const uint32_t ntt_ln65537_m = 16;
+static const uint32_t ntt_ln65537_n = 1024;
+static const uint32_t ntt_ln65537_psi = 33;
+static const uint32_t ntt_ln65537_inv_k = 1;
+static const uint32_t ntt_ln65537_inv_n = 65473;
+
+/*
+ * SCHEDULE
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_ln65537_fwd_a_rounds = 0x0;
+static const uint32_t ntt_ln65537_fwd_a_reductions = 0;
+static const uint32_t ntt_ln65537_fwd_b_rounds = 0x0;
+static const uint32_t ntt_ln65537_fwd_b_reductions = 0;
+static const uint32_t ntt_ln65537_pointwise_reductions = 0;
+static const uint32_t ntt_ln65537_inv_rounds = 0x2;
+static const uint32_t ntt_ln65537_final_reductions = 0;
+static const int32_t ntt_ln65537_rescale = -64;
+
+/*
+ * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev
+ */
+extern const int32_t ntt_ln65537_mixed_powers_rev[1024];
+extern const int32_t ntt_ln65537_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT_LN65537_TABLES_H */
@@ -0,0 +1,11 @@
+/*
+ * BD: Longa-Naehrig backend for q = 7681 = 15 * 2^9 + 1
+ */
+
+#define LN_Q 7681
+#define LN_K 15
+#define LN_M 9
+#define LN_NAME(f) ntt_ln7681_##f
+
+#include "ntt_ln7681_tables.h"
+#include "ntt_ln_impl.h"
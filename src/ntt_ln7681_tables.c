@@ -0,0 +1,94 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 7681 = 15 * 2^9 + 1
+ * - n = 256
+ * - psi = 62
+ * - omega = psi^2 = 3844
+ * - inverse of psi = 1115
+ * - inverse of omega = 6584
+ * - inverse of n = 7651
+ * - inverse of k = 7169
+ *
+ * Lazy-reduction schedule (inputs in [0, 7680]): 10 reductions
+ * - forward NTT of a: reduced rounds = 6, then 1 reductions: |a[i]| <= 465032
+ * - forward NTT of b: reduced rounds = 6, then 1 reductions: |b[i]| <= 465032
+ * - pointwise product, then 2 reductions: |c[i]| <= 9292
+ * - inverse NTT: reduced rounds = 4, 7: |c[i]| <= 44121489
+ * - final step: rescale, then 2 reductions
+ * - max |z| for mul_red(z) = 1099507702784
+ */
+
+#include "ntt_ln7681_tables.h"
+
+const int32_t ntt_ln7681_mixed_powers_rev[256] = {
+          0,   -3810,    1105,    2432,     989,    3129,    1421,    1063,
+       -421,    3258,   -3727,   -3761,    -882,    3578,   -2207,     349,
+        -22,   -2384,   -3643,   -3736,   -3768,   -3316,    -389,    2536,
+        672,     200,     950,   -3192,    -818,    2134,   -1385,      45,
+       1409,    3254,   -3746,    -932,    2514,   -1995,     125,    -420,
+      -3237,   -2335,   -1490,    1934,     717,    1585,    1768,    2355,
+       3571,    1520,    -461,     320,     -72,   -2216,   -2845,     342,
+        551,    2450,     116,    -697,    1501,    -742,     316,   -1369,
+      -1792,    2027,      27,     831,    -379,    -570,    1133,    -120,
+       2367,    3722,   -1523,   -1642,   -3087,   -2839,    3797,   -2619,
+        -77,    -663,   -1229,    2286,    2174,    3756,    2479,    1195,
+       2352,     700,    3325,   -3491,   -2863,    -212,   -1007,   -3683,
+       1091,    3708,    2251,   -3262,    1118,   -3142,   -3403,   -1470,
+        192,    3349,    2466,    -912,   -1331,    1707,   -1493,   -3279,
+        977,   -2361,    2227,    1120,    -252,     -75,    1564,    1197,
+      -1912,     894,     406,    1401,    1413,   -2597,    1106,    -951,
+      -1020,    1891,    -619,   -2836,    -130,    1973,    3611,   -3223,
+      -3059,    2290,    -644,   -2752,    -917,    -913,    1424,   -1405,
+      -1364,   -1869,   -3117,   -1202,   -3186,    1795,   -1075,    3612,
+       3259,   -2962,   -2548,    1802,    3051,    1731,   -1379,    2790,
+       2867,    2042,   -1822,    3664,    2248,    -794,      69,   -2997,
+       -988,    1169,    -208,   -2988,   -1632,   -1583,    2082,      71,
+      -1347,    2068,    2142,   -3203,    3217,     866,     273,   -1839,
+       3438,   -1720,    -489,    2872,     890,      82,   -3451,    -387,
+      -3570,    2778,    1674,   -2245,    -455,    3065,    1117,     241,
+        815,     334,   -2254,   -1951,     631,     645,   -2697,   -1077,
+       2907,   -2701,     612,    3474,   -3470,    2442,      78,   -2720,
+       -115,   -2686,   -1237,   -1374,    -843,    2218,    -986,    2084,
+      -1487,    -534,    1304,   -2538,     187,   -2779,   -3599,    1032,
+      -3458,     251,    -728,   -2777,    1969,   -1700,    -394,   -3592,
+       -874,    -443,    -184,     311,    -262,    3031,   -2885,   -2596,
+      -3329,    1661,    2129,    2371,    3115,     287,    -557,    2486,
+};
+
+const int32_t ntt_ln7681_inv_mixed_powers_rev[256] = {
+          0,    3810,   -2432,   -1105,   -1063,   -1421,   -3129,    -989,
+       -349,    2207,   -3578,     882,    3761,    3727,   -3258,     421,
+        -45,    1385,   -2134,     818,    3192,    -950,    -200,    -672,
+      -2536,     389,    3316,    3768,    3736,    3643,    2384,      22,
+       1369,    -316,     742,   -1501,     697,    -116,   -2450,    -551,
+       -342,    2845,    2216,      72,    -320,     461,   -1520,   -3571,
+      -2355,   -1768,   -1585,    -717,   -1934,    1490,    2335,    3237,
+        420,    -125,    1995,   -2514,     932,    3746,   -3254,   -1409,
+        951,   -1106,    2597,   -1413,   -1401,    -406,    -894,    1912,
+      -1197,   -1564,      75,     252,   -1120,   -2227,    2361,    -977,
+       3279,    1493,   -1707,    1331,     912,   -2466,   -3349,    -192,
+       1470,    3403,    3142,   -1118,    3262,   -2251,   -3708,   -1091,
+       3683,    1007,     212,    2863,    3491,   -3325,    -700,   -2352,
+      -1195,   -2479,   -3756,   -2174,   -2286,    1229,     663,      77,
+       2619,   -3797,    2839,    3087,    1642,    1523,   -3722,   -2367,
+        120,   -1133,     570,     379,    -831,     -27,   -2027,    1792,
+      -2486,     557,    -287,   -3115,   -2371,   -2129,   -1661,    3329,
+       2596,    2885,   -3031,     262,    -311,     184,     443,     874,
+       3592,     394,    1700,   -1969,    2777,     728,    -251,    3458,
+      -1032,    3599,    2779,    -187,    2538,   -1304,     534,    1487,
+      -2084,     986,   -2218,     843,    1374,    1237,    2686,     115,
+       2720,     -78,   -2442,    3470,   -3474,    -612,    2701,   -2907,
+       1077,    2697,    -645,    -631,    1951,    2254,    -334,    -815,
+       -241,   -1117,   -3065,     455,    2245,   -1674,   -2778,    3570,
+        387,    3451,     -82,    -890,   -2872,     489,    1720,   -3438,
+       1839,    -273,    -866,   -3217,    3203,   -2142,   -2068,    1347,
+        -71,   -2082,    1583,    1632,    2988,     208,   -1169,     988,
+       2997,     -69,     794,   -2248,   -3664,    1822,   -2042,   -2867,
+      -2790,    1379,   -1731,   -3051,   -1802,    2548,    2962,   -3259,
+      -3612,    1075,   -1795,    3186,    1202,    3117,    1869,    1364,
+       1405,   -1424,     913,     917,    2752,     644,   -2290,    3059,
+       3223,   -3611,   -1973,     130,    2836,     619,   -1891,    1020,
+};
+
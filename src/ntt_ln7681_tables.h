@@ -0,0 +1,60 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 7681 = 15 * 2^9 + 1
+ * - n = 256
+ * - psi = 62
+ * - omega = psi^2 = 3844
+ * - inverse of psi = 1115
+ * - inverse of omega = 6584
+ * - inverse of n = 7651
+ * - inverse of k = 7169
+ *
+ * Lazy-reduction schedule (inputs in [0, 7680]): 10 reductions
+ * - forward NTT of a: reduced rounds = 6, then 1 reductions: |a[i]| <= 465032
+ * - forward NTT of b: reduced rounds = 6, then 1 reductions: |b[i]| <= 465032
+ * - pointwise product, then 2 reductions: |c[i]| <= 9292
+ * - inverse NTT: reduced rounds = 4, 7: |c[i]| <= 44121489
+ * - final step: rescale, then 2 reductions
+ * - max |z| for mul_red(z) = 1099507702784
+ */
+
+#ifndef __NTT_LN7681_TABLES_H
+#define __NTT_LN7681_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_ln7681_q = 7681;
+static const uint32_t ntt_ln7681_k = 15;
+static const uint32_t ntt_ln7681_m = 9;
+static const uint32_t ntt_ln7681_n = 256;
+static const uint32_t ntt_ln7681_psi = 62;
+static const uint32_t ntt_ln7681_inv_k = 7169;
+static const uint32_t ntt_ln7681_inv_n = 7651;
+
+/*
+ * SCHEDULE
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_ln7681_fwd_a_rounds = 0x40;
+static const uint32_t ntt_ln7681_fwd_a_reductions = 1;
+static const uint32_t ntt_ln7681_fwd_b_rounds = 0x40;
+static const uint32_t ntt_ln7681_fwd_b_reductions = 1;
+static const uint32_t ntt_ln7681_pointwise_reductions = 2;
+static const uint32_t ntt_ln7681_inv_rounds = 0x90;
+static const uint32_t ntt_ln7681_final_reductions = 2;
+static const int32_t ntt_ln7681_rescale = -3170;
+
+/*
+ * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev
+ */
+extern const int32_t ntt_ln7681_mixed_powers_rev[256];
+extern const int32_t ntt_ln7681_inv_mixed_powers_rev[256];
+
+#endif /* __NTT_LN7681_TABLES_H */
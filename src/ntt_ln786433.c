@@ -0,0 +1,11 @@
+/*
+ * BD: Longa-Naehrig backend for q = 786433 = 3 * 2^18 + 1
+ */
+
+#define LN_Q 786433
+#define LN_K 3
+#define LN_M 18
+#define LN_NAME(f) ntt_ln786433_##f
+
+#include "ntt_ln786433_tables.h"
+#include "ntt_ln_impl.h"
@@ -0,0 +1,286 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 786433 = 3 * 2^18 + 1
+ * - n = 1024
+ * - psi = 19
+ * - omega = psi^2 = 361
+ * - inverse of psi = 579477
+ * - inverse of omega = 71890
+ * - inverse of n = 785665
+ * - inverse of k = 524289
+ *
+ * Lazy-reduction schedule (inputs in [0, 786432]): 4 reductions
+ * - forward NTT of a: reduced rounds = 8, then 0 reductions: |a[i]| <= 7682775
+ * - forward NTT of b: reduced rounds = 8, then 0 reductions: |b[i]| <= 7682775
+ * - pointwise product, then 0 reductions: |c[i]| <= 225944813
+ * - inverse NTT: reduced rounds = 2, 9: |c[i]| <= 2573352
+ * - final step: rescale, then 0 reductions
+ * - max |z| for mul_red(z) = 562743795515392
+ */
+
+#include "ntt_ln786433_tables.h"
+
+const int32_t ntt_ln786433_mixed_powers_rev[1024] = {
+          0, -295486,  342727,  132728, -310462,   81679, -334221,  -24872,
+     -38941, -129124, -305858, -370116,  385132, -194228, -125701, -248279,
+    -139985,  346493,  -95357,  224501, -298561,  343716,  -63187, -282346,
+     379853,  141204,   67366, -126206, -298280, -238154,  234763,  -66128,
+    -105488, -134361,  149867, -247262,  185245,   16788,  -32492, -315289,
+      19514,   38856, -341095,  204536,  186659,  139378, -299175, -369141,
+    -344283, -207562,   50572, -127244,  174818,  167305, -221123,  186383,
+    -370010,  -73163, -288060, -130754,  115363,  147334,  287478,  149262,
+     180802,   93218,  148622,   27449,   87419,  263052,  340836, -250350,
+     185468, -268663, -386565, -387186,   69101,  132112, -381238,  -18787,
+    -170626, -303316,  -83398,  190119,  219161,  240850, -257782, -134221,
+     110380,  -26613, -313883,  168849,   67245,  180324,  -12283,  198729,
+    -391213, -252889, -100610,  318582,  173658, -195779,  107778,  -70886,
+     -91063,  109569,  320845,  236739,  363567, -340822, -156964,  -24312,
+    -289749, -271624, -226808,  237449, -254001,  -54473, -331541,   81781,
+    -301759,  145435, -109652,  346682,  255300, -116557, -211007, -313679,
+    -218704, -339161, -150435, -348147,  -99751,  118304, -209669,  332914,
+      22088, -261903, -150246, -378480, -153121,  145350,  -80631,  245360,
+     -98884,  -95741,  194669,  314355,    4594, -237978,  146916,   14138,
+      11195,  100717,  252907,  167636, -337556,  110911,  -54076, -134274,
+     333625, -129136, -246248, -125360,  179844,  -27658, -234660,  -12818,
+    -240328,  -89311, -289036,  -24046, -358017, -362663,  203666,   68782,
+     270673, -324367,  285072,  160914,  279001,  286413,  293936, -150695,
+      66185,   38369,  111995, -348223,  -18138,  -47481,  325184,  339280,
+     -21671,  232427,  295738, -302588,  263061, -201211,  352516,   97088,
+     143406,  352770, -212251, -138993, -132862,  376716,  373810, -174698,
+     242129,   37443,   -6698,  -73466, -393013, -301046, -349561,   27845,
+     185977,  -63243,  -20381,  175189,  212726, -186902, -341688, -249547,
+    -390849,  300362, -184834, -232547,  101777,  130760,   43358,  294045,
+    -147253, -122332, -228499,  296629,  186056, -100888,  203319,  174405,
+     201066, -175541,  238937,   25445,   87082,  154858, -125641,   41685,
+      47526,  199335,  315751,  155505,  116802,  128598, -226969, -173619,
+    -262024,  284442,  254466,  -57605,  383137,  388098, -329532, -328029,
+      98093, -214217, -314118,   81734, -165989, -123771,  235053,   24643,
+    -202873,   41126,  179175,   42262,  -39200, -174938,   -3950,  309384,
+     287591, -143501,  -60297,   52748,   62241, -252397, -185321, -279218,
+    -332384,  254525, -161890,  391780,   26640, -230996,   66883,  213456,
+     -33343, -128778,  334686,  -87206, -249339,  -16254, -260854, -352724,
+     -29749, -218747,  168533, -321970,  194658, -158236,  390763, -348975,
+     120000,  326879, -180504,  -16214,  -34906, -289870,  -29598, -380295,
+      -4417, -164921,  175098, -314540,  100939, -196621,  358248,   63445,
+     107143, -256084, -351324,  210928, -220395, -279981,   -1143,  295790,
+    -254212, -182889, -222224,  213288, -312612, -347213, -260208,  305065,
+    -260903, -170097,  -65411, -387285, -103978, -176975,  284435,  175766,
+     330047,  -66701, -144292,  188884, -224102,  102751,  372641,  362443,
+     156443,  232759,  219394, -258418,  -86624, -353194,  -40828, -125869,
+      -3800,  247861,  -88656,   -2108,  318300,   -3928, -148485, -361513,
+     379188, -188976, -262722,  109355,  150639,  390305,  110474,    8233,
+    -308844,  246427,  -43158,  148213,  165807,  240362, -192941, -142295,
+     109438, -175023,   25071,  208062, -226371, -219661,   -9770, -291969,
+    -307639,   40551,  282972,  235803,   85568, -188861,  345665,  385220,
+     109230,  182919,   73199,  -38745,   39399,  -69212,  139389,  285932,
+     114376, -218549,  -28599,  358154, -350255,  239091,  222504,   91300,
+    -250778,    2482,  253593,  -29843, -269125, -373465,  385157, -335554,
+     195261,   82030, -111731, -106088,   55937,  372370,  -57559, -137018,
+     299795, -304585,  322112,  120777, -256354,  160885,  212907, -203468,
+      41099, -242184, -193470,   79919, -193372, -285335, -143870, -340717,
+    -135012,  -52176, -338610,  155239,    9231,  -58433, -321066, -151338,
+     114506,  147562,  -58679,  217496, -319753, -149852, -362241, -171584,
+     290892,  -24166, -279644,  328589, -276348,  161616,  120613,  353328,
+    -324982,  -97072,  121731,  198864, -220854,   18380,  -76422,  -18210,
+     319111, -121604,   87326,  128181,  319411, -244650,  259890,   45565,
+     232990,  330772, -251373, -251551,  -20718,   66995,  256713,  106058,
+    -144640, -391901,  -46674,  300562, -301860,   24331, -146777,  238181,
+    -262138, -109203,  220349,  162533,  392686,  -20965,  -58735,  313865,
+      46554,  -94057, -306271,   45693,  239611,  241833,  -29020,    1297,
+    -300416,  291903, -238917,  333354, -167628,  239140,  372313,  140457,
+     139310,  323577, -292912,  -38615, -162289,  193672, -258101,  316434,
+     355027, -193560, -298259,   20620,  373923,  318972,  169085,  300973,
+     370766,  -48169, -189341,  -45981, -385644,  288883, -179294,   64218,
+    -249913,  -11513,  174435,  -58337,  175810,   33063, -269172, -390888,
+      47707,  182769,   31891, -125027, -167402, -346386,  -42949, -309754,
+     289506,  198276, -321914, -264902,   88095,  279390,  184420,  -38052,
+     378160, -385999, -266838, -278637, -259947,  150829, -165625, -356953,
+     -96162, -257973,  -11696, -319904,  231894, -142448, -179260, -190900,
+    -262079,  280786,  327687,   62399, -295211,  280424, -233377, -156314,
+    -355150,  -86293, -338724, -238406,  153770,  212364, -311517,  226032,
+    -157331, -277488, -195409, -220557, -170124, -184154,  163416,  324505,
+       -200,  344175, -377187, -207067, -107421, -248554,   -7815,  -19027,
+    -228390, -382467,  275911,  295494,  132102,  144716,  -76968,  331563,
+    -223211, -152595,  287467, -323329, -322403, -111523,  -51546,   33902,
+    -366761, -257559,  291058, -113223,  236433, -384082,   40877,  -56758,
+    -305930, -246213, -233454, -318719,   87286,  197016, -354328,  268622,
+     212705,  340757,   86635,   39352, -122100, -251990, -241011, -191907,
+      47411,  -94285,   39886,  -22541,  271304,  260931,  260058, -243542,
+     152366, -124043,   13347,  329559,  275574,  187300,  -62511, -266008,
+    -362244,  128491,  -88663,  -88366, -204012,  -63184,   79753,  282527,
+    -315351,  -57422, -231394, -324773, -344622, -115706, -112968,  154856,
+     374684, -302485,  113991, -244141,  279561,  109156, -380093,  271806,
+     365415, -375267, -100604, -281568, -165079,   79707,   24493, -173530,
+    -118147,  -75016, -127262,  177012, -389350, -214843, -350195, -257378,
+     387831,  371249, -387239,  182859,  109629,  381027, -200608,  -22795,
+    -348234,  201847, -366114,  300205,  360897,  125141,   37369,   81824,
+     347925,   34991,  377117,  130920,  389332, -344006,  -69104,  167963,
+    -111911, -189547, -178795, -302978,   81692, -203430,  -27880,    5582,
+     116561, -144800, -292195, -191137, -140061,   84063, -380246, -153029,
+    -259858, -100633,  116256, -308062,  201706,  295965,   30356,   58913,
+     290901, -137958,  323222,  -19920,   -8059,    7650, -252591, -318216,
+      77578,   -5039,  258593,   16545,   41633, -178090,  -75050,  373265,
+     -40802, -367220, -359210,  215779, -390287,  -76945, -375367,  199889,
+     -23832,  117377,   69822,  365923, -280273,  329674, -302089,  123499,
+     152916,  -87483,   67570,  -84048,  -18843, -308826, -237628,  376141,
+     221202, -224028,   56395,  174034, -233663,  139248,  346600, -339061,
+     -79299,  -80763, -283844, -308066,  123219,   -2499,  224071, -147708,
+     -83923,   12233,  181130,  315204,  344975,  196366, -271185, -367411,
+    -323582, -146998, -383692,   75467, -255340,  185392,  -21717,  114979,
+    -111430, -329159, -290091,  120307,  351836, -305583, -225354,  291204,
+    -238559,  -86111,  330057, -280518,  383717, -216793, -100766,  193822,
+     -20571,  305547, -382249, -343369, -325773,  379403,    2282, -191480,
+    -173315, -296177,  236321, -191344,  -72990,  367211,   10701,  -32212,
+     -72200,   -9239, -111598,  -40052, -243764,  -74632,  324517,  209150,
+     126675,  341621, -273120, -281554, -283591,  337898, -260293,  156427,
+    -363005,  -36485,  -33569, -329685,    4601, -151720,  266286, -344306,
+    -279977, -179705, -310084,   21013, -368884, -241394, -185630,  -42380,
+    -340110,  -15964, -128563, -238341,   52926,  343806,  276171,  241283,
+    -283929,  329729, -182085,   50278,  -37852,  257838,  289092,  -72323,
+    -186155, -220266,  243052, -272971, -363381, -175869,  295411,  161834,
+     -46184,   47158,   99669,  219416,  391656,  -17938,  240086,  -84062,
+    -222206,  -14296,  236410,  343627,  276370,   -2867, -307188, -244043,
+     191074, -282084, -171336,  -64536, -152128,  -88917,  113068,   66273,
+      -5552,  117102,  256235,  -54405,  258097,   83666, -374231, -182159,
+    -205929, -204911, -142126, -196191,  175389, -323794,  191210,  270310,
+    -183685, -342054, -328468,  200259,  216157,  298544,  195318, -114364,
+      21917,  327279,  191795,  -48273,  254419,  -75028,  -67652, -364665,
+     116806, -271502,  -46410, -153749, -264061,  349220,  120848, -345990,
+    -228355,   48823,   86328,   76140, -222655,   70248,  219312,   79302,
+    -291788,   -6796,  -57489,  -60871,  392791, -299961,  158949, -344197,
+    -388861, -368222, -100373,  205647, -230309, -324144,  356969, -193159,
+};
+
+const int32_t ntt_ln786433_inv_mixed_powers_rev[1024] = {
+          0,  295486, -132728, -342727,   24872,  334221,  -81679,  310462,
+     248279,  125701,  194228, -385132,  370116,  305858,  129124,   38941,
+      66128, -234763,  238154,  298280,  126206,  -67366, -141204, -379853,
+     282346,   63187, -343716,  298561, -224501,   95357, -346493,  139985,
+    -149262, -287478, -147334, -115363,  130754,  288060,   73163,  370010,
+    -186383,  221123, -167305, -174818,  127244,  -50572,  207562,  344283,
+     369141,  299175, -139378, -186659, -204536,  341095,  -38856,  -19514,
+     315289,   32492,  -16788, -185245,  247262, -149867,  134361,  105488,
+     313679,  211007,  116557, -255300, -346682,  109652, -145435,  301759,
+     -81781,  331541,   54473,  254001, -237449,  226808,  271624,  289749,
+      24312,  156964,  340822, -363567, -236739, -320845, -109569,   91063,
+      70886, -107778,  195779, -173658, -318582,  100610,  252889,  391213,
+    -198729,   12283, -180324,  -67245, -168849,  313883,   26613, -110380,
+     134221,  257782, -240850, -219161, -190119,   83398,  303316,  170626,
+      18787,  381238, -132112,  -69101,  387186,  386565,  268663, -185468,
+     250350, -340836, -263052,  -87419,  -27449, -148622,  -93218, -180802,
+     173619,  226969, -128598, -116802, -155505, -315751, -199335,  -47526,
+     -41685,  125641, -154858,  -87082,  -25445, -238937,  175541, -201066,
+    -174405, -203319,  100888, -186056, -296629,  228499,  122332,  147253,
+    -294045,  -43358, -130760, -101777,  232547,  184834, -300362,  390849,
+     249547,  341688,  186902, -212726, -175189,   20381,   63243, -185977,
+     -27845,  349561,  301046,  393013,   73466,    6698,  -37443, -242129,
+     174698, -373810, -376716,  132862,  138993,  212251, -352770, -143406,
+     -97088, -352516,  201211, -263061,  302588, -295738, -232427,   21671,
+    -339280, -325184,   47481,   18138,  348223, -111995,  -38369,  -66185,
+     150695, -293936, -286413, -279001, -160914, -285072,  324367, -270673,
+     -68782, -203666,  362663,  358017,   24046,  289036,   89311,  240328,
+      12818,  234660,   27658, -179844,  125360,  246248,  129136, -333625,
+     134274,   54076, -110911,  337556, -167636, -252907, -100717,  -11195,
+     -14138, -146916,  237978,   -4594, -314355, -194669,   95741,   98884,
+    -245360,   80631, -145350,  153121,  378480,  150246,  261903,  -22088,
+    -332914,  209669, -118304,   99751,  348147,  150435,  339161,  218704,
+    -238181,  146777,  -24331,  301860, -300562,   46674,  391901,  144640,
+    -106058, -256713,  -66995,   20718,  251551,  251373, -330772, -232990,
+     -45565, -259890,  244650, -319411, -128181,  -87326,  121604, -319111,
+      18210,   76422,  -18380,  220854, -198864, -121731,   97072,  324982,
+    -353328, -120613, -161616,  276348, -328589,  279644,   24166, -290892,
+     171584,  362241,  149852,  319753, -217496,   58679, -147562, -114506,
+     151338,  321066,   58433,   -9231, -155239,  338610,   52176,  135012,
+     340717,  143870,  285335,  193372,  -79919,  193470,  242184,  -41099,
+     203468, -212907, -160885,  256354, -120777, -322112,  304585, -299795,
+     137018,   57559, -372370,  -55937,  106088,  111731,  -82030, -195261,
+     335554, -385157,  373465,  269125,   29843, -253593,   -2482,  250778,
+     -91300, -222504, -239091,  350255, -358154,   28599,  218549, -114376,
+    -285932, -139389,   69212,  -39399,   38745,  -73199, -182919, -109230,
+    -385220, -345665,  188861,  -85568, -235803, -282972,  -40551,  307639,
+     291969,    9770,  219661,  226371, -208062,  -25071,  175023, -109438,
+     142295,  192941, -240362, -165807, -148213,   43158, -246427,  308844,
+      -8233, -110474, -390305, -150639, -109355,  262722,  188976, -379188,
+     361513,  148485,    3928, -318300,    2108,   88656, -247861,    3800,
+     125869,   40828,  353194,   86624,  258418, -219394, -232759, -156443,
+    -362443, -372641, -102751,  224102, -188884,  144292,   66701, -330047,
+    -175766, -284435,  176975,  103978,  387285,   65411,  170097,  260903,
+    -305065,  260208,  347213,  312612, -213288,  222224,  182889,  254212,
+    -295790,    1143,  279981,  220395, -210928,  351324,  256084, -107143,
+     -63445, -358248,  196621, -100939,  314540, -175098,  164921,    4417,
+     380295,   29598,  289870,   34906,   16214,  180504, -326879, -120000,
+     348975, -390763,  158236, -194658,  321970, -168533,  218747,   29749,
+     352724,  260854,   16254,  249339,   87206, -334686,  128778,   33343,
+    -213456,  -66883,  230996,  -26640, -391780,  161890, -254525,  332384,
+     279218,  185321,  252397,  -62241,  -52748,   60297,  143501, -287591,
+    -309384,    3950,  174938,   39200,  -42262, -179175,  -41126,  202873,
+     -24643, -235053,  123771,  165989,  -81734,  314118,  214217,  -98093,
+     328029,  329532, -388098, -383137,   57605, -254466, -284442,  262024,
+     193159, -356969,  324144,  230309, -205647,  100373,  368222,  388861,
+     344197, -158949,  299961, -392791,   60871,   57489,    6796,  291788,
+     -79302, -219312,  -70248,  222655,  -76140,  -86328,  -48823,  228355,
+     345990, -120848, -349220,  264061,  153749,   46410,  271502, -116806,
+     364665,   67652,   75028, -254419,   48273, -191795, -327279,  -21917,
+     114364, -195318, -298544, -216157, -200259,  328468,  342054,  183685,
+    -270310, -191210,  323794, -175389,  196191,  142126,  204911,  205929,
+     182159,  374231,  -83666, -258097,   54405, -256235, -117102,    5552,
+     -66273, -113068,   88917,  152128,   64536,  171336,  282084, -191074,
+     244043,  307188,    2867, -276370, -343627, -236410,   14296,  222206,
+      84062, -240086,   17938, -391656, -219416,  -99669,  -47158,   46184,
+    -161834, -295411,  175869,  363381,  272971, -243052,  220266,  186155,
+      72323, -289092, -257838,   37852,  -50278,  182085, -329729,  283929,
+    -241283, -276171, -343806,  -52926,  238341,  128563,   15964,  340110,
+      42380,  185630,  241394,  368884,  -21013,  310084,  179705,  279977,
+     344306, -266286,  151720,   -4601,  329685,   33569,   36485,  363005,
+    -156427,  260293, -337898,  283591,  281554,  273120, -341621, -126675,
+    -209150, -324517,   74632,  243764,   40052,  111598,    9239,   72200,
+      32212,  -10701, -367211,   72990,  191344, -236321,  296177,  173315,
+     191480,   -2282, -379403,  325773,  343369,  382249, -305547,   20571,
+    -193822,  100766,  216793, -383717,  280518, -330057,   86111,  238559,
+    -291204,  225354,  305583, -351836, -120307,  290091,  329159,  111430,
+    -114979,   21717, -185392,  255340,  -75467,  383692,  146998,  323582,
+     367411,  271185, -196366, -344975, -315204, -181130,  -12233,   83923,
+     147708, -224071,    2499, -123219,  308066,  283844,   80763,   79299,
+     339061, -346600, -139248,  233663, -174034,  -56395,  224028, -221202,
+    -376141,  237628,  308826,   18843,   84048,  -67570,   87483, -152916,
+    -123499,  302089, -329674,  280273, -365923,  -69822, -117377,   23832,
+    -199889,  375367,   76945,  390287, -215779,  359210,  367220,   40802,
+    -373265,   75050,  178090,  -41633,  -16545, -258593,    5039,  -77578,
+     318216,  252591,   -7650,    8059,   19920, -323222,  137958, -290901,
+     -58913,  -30356, -295965, -201706,  308062, -116256,  100633,  259858,
+     153029,  380246,  -84063,  140061,  191137,  292195,  144800, -116561,
+      -5582,   27880,  203430,  -81692,  302978,  178795,  189547,  111911,
+    -167963,   69104,  344006, -389332, -130920, -377117,  -34991, -347925,
+     -81824,  -37369, -125141, -360897, -300205,  366114, -201847,  348234,
+      22795,  200608, -381027, -109629, -182859,  387239, -371249, -387831,
+     257378,  350195,  214843,  389350, -177012,  127262,   75016,  118147,
+     173530,  -24493,  -79707,  165079,  281568,  100604,  375267, -365415,
+    -271806,  380093, -109156, -279561,  244141, -113991,  302485, -374684,
+    -154856,  112968,  115706,  344622,  324773,  231394,   57422,  315351,
+    -282527,  -79753,   63184,  204012,   88366,   88663, -128491,  362244,
+     266008,   62511, -187300, -275574, -329559,  -13347,  124043, -152366,
+     243542, -260058, -260931, -271304,   22541,  -39886,   94285,  -47411,
+     191907,  241011,  251990,  122100,  -39352,  -86635, -340757, -212705,
+    -268622,  354328, -197016,  -87286,  318719,  233454,  246213,  305930,
+      56758,  -40877,  384082, -236433,  113223, -291058,  257559,  366761,
+     -33902,   51546,  111523,  322403,  323329, -287467,  152595,  223211,
+    -331563,   76968, -144716, -132102, -295494, -275911,  382467,  228390,
+      19027,    7815,  248554,  107421,  207067,  377187, -344175,     200,
+    -324505, -163416,  184154,  170124,  220557,  195409,  277488,  157331,
+    -226032,  311517, -212364, -153770,  238406,  338724,   86293,  355150,
+     156314,  233377, -280424,  295211,  -62399, -327687, -280786,  262079,
+     190900,  179260,  142448, -231894,  319904,   11696,  257973,   96162,
+     356953,  165625, -150829,  259947,  278637,  266838,  385999, -378160,
+      38052, -184420, -279390,  -88095,  264902,  321914, -198276, -289506,
+     309754,   42949,  346386,  167402,  125027,  -31891, -182769,  -47707,
+     390888,  269172,  -33063, -175810,   58337, -174435,   11513,  249913,
+     -64218,  179294, -288883,  385644,   45981,  189341,   48169, -370766,
+    -300973, -169085, -318972, -373923,  -20620,  298259,  193560, -355027,
+    -316434,  258101, -193672,  162289,   38615,  292912, -323577, -139310,
+    -140457, -372313, -239140,  167628, -333354,  238917, -291903,  300416,
+      -1297,   29020, -241833, -239611,  -45693,  306271,   94057,  -46554,
+    -313865,   58735,   20965, -392686, -162533, -220349,  109203,  262138,
+};
+
@@ -0,0 +1,60 @@
+/*
+ * Generated by make_ln_tables: do not edit.
+ *
+ * Parameters:
+ * - q = 786433 = 3 * 2^18 + 1
+ * - n = 1024
+ * - psi = 19
+ * - omega = psi^2 = 361
+ * - inverse of psi = 579477
+ * - inverse of omega = 71890
+ * - inverse of n = 785665
+ * - inverse of k = 524289
+ *
+ * Lazy-reduction schedule (inputs in [0, 786432]): 4 reductions
+ * - forward NTT of a: reduced rounds = 8, then 0 reductions: |a[i]| <= 7682775
+ * - forward NTT of b: reduced rounds = 8, then 0 reductions: |b[i]| <= 7682775
+ * - pointwise product, then 0 reductions: |c[i]| <= 225944813
+ * - inverse NTT: reduced rounds = 2, 9: |c[i]| <= 2573352
+ * - final step: rescale, then 0 reductions
+ * - max |z| for mul_red(z) = 562743795515392
+ */
+
+#ifndef __NTT_LN786433_TABLES_H
+#define __NTT_LN786433_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const uint32_t ntt_ln786433_q = 786433;
+static const uint32_t ntt_ln786433_k = 3;
+static const uint32_t ntt_ln786433_m = 18;
+static const uint32_t ntt_ln786433_n = 1024;
+static const uint32_t ntt_ln786433_psi = 19;
+static const uint32_t ntt_ln786433_inv_k = 524289;
+static const uint32_t ntt_ln786433_inv_n = 785665;
+
+/*
+ * SCHEDULE
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_ln786433_fwd_a_rounds = 0x100;
+static const uint32_t ntt_ln786433_fwd_a_reductions = 0;
+static const uint32_t ntt_ln786433_fwd_b_rounds = 0x100;
+static const uint32_t ntt_ln786433_fwd_b_reductions = 0;
+static const uint32_t ntt_ln786433_pointwise_reductions = 0;
+static const uint32_t ntt_ln786433_inv_rounds = 0x204;
+static const uint32_t ntt_ln786433_final_reductions = 0;
+static const int32_t ntt_ln786433_rescale = -55019;
+
+/*
+ * TABLES: as ntt_red<n>_mixed_powers_rev and ntt_red<n>_inv_mixed_powers_rev
+ */
+extern const int32_t ntt_ln786433_mixed_powers_rev[1024];
+extern const int32_t ntt_ln786433_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT_LN786433_TABLES_H */
@@ -0,0 +1,271 @@
+/*
+ * BD: body of the Longa-Naehrig backend for one modulus.
+ *
+ * This file is included by ntt_ln<q>.c after defining
+ * - LN_Q, LN_K, LN_M: the modulus q = k * 2^m + 1 (k odd)
+ * - LN_NAME(f): the name of function f for this modulus
+ *   (e.g., ntt_ln7681_##f)
+ * and after including ntt_ln<q>_tables.h.
+ *
+ * The reduction constants are compile-time constants so the compiler
+ * specializes red and mul_red for each modulus (e.g., k * x is a shift
+ * and an addition for k = 3).
+ */
+
+#if !defined(LN_Q) || !defined(LN_K) || !defined(LN_M) || !defined(LN_NAME)
+#error "LN_Q, LN_K, LN_M, and LN_NAME must be defined"
+#endif
+
+#if LN_Q != (LN_K << LN_M) + 1 || (LN_K & 1) == 0
+#error "LN_Q must be LN_K * 2^LN_M + 1 with LN_K odd"
+#endif
+
+#include <assert.h>
+
+#include "ntt_ln.h"
+
+#define LN_MASK ((1 << LN_M) - 1)
+
+/*
+ * Bound on |x * y| for mul_red: (x * y) >> m must be small enough
+ * for the result to fit in 32 bits (see red_bounds.h)
+ */
+#define LN_MAX_MUL_RED (((int64_t) INT32_MAX - (int64_t) LN_K * LN_MASK) << LN_M)
+
+#define LN_N LN_NAME(n)
+
+
+/*
+ * Longa & Naehrig reduction
+ */
+static inline int32_t red(int32_t x) {
+  return LN_K * (x & LN_MASK) - (x >> LN_M);
+}
+
+static inline int32_t mul_red(int32_t x, int32_t y) {
+  int64_t z;
+
+  z = (int64_t) x * y;
+  assert(-LN_MAX_MUL_RED <= z && z <= LN_MAX_MUL_RED);
+  return LN_K * (int32_t) (z & LN_MASK) - (int32_t) (z >> LN_M);
+}
+
+/*
+ * From [-q, 2q-1] to [0, q-1]
+ */
+static inline int32_t correct_coeff(int32_t x) {
+  x += ((x >> 31) & LN_Q);
+  x -= LN_Q;
+  x += ((x >> 31) & LN_Q);
+  return x;
+}
+
+
+/*
+ * ARRAY OPERATIONS
+ */
+void LN_NAME(normalize)(int32_t *a, uint32_t n) {
+  uint32_t i;
+  int32_t x;
+
+  for (i=0; i<n; i++) {
+    x = a[i] % LN_Q;
+    if (x < 0) x += LN_Q;
+    a[i] = x;
+  }
+}
+
+void LN_NAME(reduce_array)(int32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = red(a[i]);
+  }
+}
+
+void LN_NAME(correct)(int32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = correct_coeff(a[i]);
+  }
+}
+
+void LN_NAME(mul_reduce_array)(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    c[i] = mul_red(a[i], b[i]);
+  }
+}
+
+void LN_NAME(scalar_mul_reduce_array)(int32_t *a, uint32_t n, int32_t c) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = mul_red(a[i], c);
+  }
+}
+
+
+/*
+ * NTTS
+ */
+
+/*
+ * Rounds t0, 2t0, ..., n/2 of the CT NTT (standard to bit-reverse order)
+ * - round t is round number k = log2(t) + 1
+ * - its outputs are reduced if bit k of rounds is set
+ */
+static void ct_std2rev_rounds(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds, uint32_t t0) {
+  uint32_t j, k, s, t, u, d;
+  int32_t x, w;
+
+  d = n;
+  k = 0;
+  for (t=1; t<n; t <<= 1) {
+    d >>= 1;
+    k ++;
+    if (t < t0) continue;
+    if (rounds & ((uint32_t) 1 << k)) {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = mul_red(a[s + d], w);
+          a[s + d] = red(a[s] - x);
+          a[s] = red(a[s] + x);
+        }
+      }
+    } else {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = mul_red(a[s + d], w);
+          a[s + d] = a[s] - x;
+          a[s] = a[s] + x;
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Rounds d = 1, 2, ... of the GS NTT (bit-reverse to standard order)
+ * as long as d < d1. Round d is round number k = log2(d) + 1.
+ */
+static void gs_rev2std_rounds(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds, uint32_t d1) {
+  uint32_t j, k, s, t, u, d;
+  int32_t w, x;
+
+  t = n;
+  k = 0;
+  for (d=1; d<n && d<d1; d<<=1) {
+    t >>= 1;
+    k ++;
+    if (rounds & ((uint32_t) 1 << k)) {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = a[s + d];
+          a[s + d] = red(mul_red(a[s] - x, w));
+          a[s] = red(a[s] + x);
+        }
+      }
+    } else {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = a[s + d];
+          a[s + d] = mul_red(a[s] - x, w);
+          a[s] = a[s] + x;
+        }
+      }
+    }
+  }
+}
+
+void LN_NAME(mulntt_ct_std2rev_lazy)(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds) {
+  ct_std2rev_rounds(a, n, p, rounds, 1);
+}
+
+void LN_NAME(nttmul_gs_rev2std_lazy)(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds) {
+  gs_rev2std_rounds(a, n, p, rounds, n);
+}
+
+/*
+ * AVX2: the rounds with d >= 8 are done by the assembly kernels,
+ * the others (d = 4, 2, 1) in C.
+ */
+void LN_NAME(mulntt_ct_std2rev_lazy_asm)(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds) {
+  LN_NAME(ct_std2rev_rounds_asm)(a, n, p, rounds);
+  ct_std2rev_rounds(a, n, p, rounds, n/8);
+}
+
+void LN_NAME(nttmul_gs_rev2std_lazy_asm)(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds) {
+  gs_rev2std_rounds(a, n, p, rounds, 8);
+  LN_NAME(gs_rev2std_rounds_asm)(a, n, p, rounds);
+}
+
+
+/*
+ * PRODUCTS
+ */
+static void reduce_times(int32_t *a, uint32_t n, uint32_t r) {
+  while (r > 0) {
+    LN_NAME(reduce_array)(a, n);
+    r --;
+  }
+}
+
+static void reduce_times_asm(int32_t *a, uint32_t n, uint32_t r) {
+  while (r > 0) {
+    LN_NAME(reduce_array_asm)(a, n);
+    r --;
+  }
+}
+
+/*
+ * Final step: a[i] = correct(red^r(mul_red(a[i], c)))
+ */
+static void finalize(int32_t *a, uint32_t n, int32_t c, uint32_t r) {
+  uint32_t i, j;
+  int32_t x;
+
+  for (i=0; i<n; i++) {
+    x = mul_red(a[i], c);
+    for (j=0; j<r; j++) {
+      x = red(x);
+    }
+    a[i] = correct_coeff(x);
+  }
+}
+
+void LN_NAME(product)(int32_t *c, int32_t *a, int32_t *b) {
+  LN_NAME(mulntt_ct_std2rev_lazy)(a, LN_N, LN_NAME(mixed_powers_rev), LN_NAME(fwd_a_rounds));
+  reduce_times(a, LN_N, LN_NAME(fwd_a_reductions));
+
+  LN_NAME(mulntt_ct_std2rev_lazy)(b, LN_N, LN_NAME(mixed_powers_rev), LN_NAME(fwd_b_rounds));
+  reduce_times(b, LN_N, LN_NAME(fwd_b_reductions));
+
+  LN_NAME(mul_reduce_array)(c, LN_N, a, b);
+  reduce_times(c, LN_N, LN_NAME(pointwise_reductions));
+
+  LN_NAME(nttmul_gs_rev2std_lazy)(c, LN_N, LN_NAME(inv_mixed_powers_rev), LN_NAME(inv_rounds));
+  finalize(c, LN_N, LN_NAME(rescale), LN_NAME(final_reductions));
+}
+
+void LN_NAME(product_asm)(int32_t *c, int32_t *a, int32_t *b) {
+  LN_NAME(mulntt_ct_std2rev_lazy_asm)(a, LN_N, LN_NAME(mixed_powers_rev), LN_NAME(fwd_a_rounds));
+  reduce_times_asm(a, LN_N, LN_NAME(fwd_a_reductions));
+
+  LN_NAME(mulntt_ct_std2rev_lazy_asm)(b, LN_N, LN_NAME(mixed_powers_rev), LN_NAME(fwd_b_rounds));
+  reduce_times_asm(b, LN_N, LN_NAME(fwd_b_reductions));
+
+  LN_NAME(mul_reduce_array_asm)(c, LN_N, a, b);
+  reduce_times_asm(c, LN_N, LN_NAME(pointwise_reductions));
+
+  LN_NAME(nttmul_gs_rev2std_lazy_asm)(c, LN_N, LN_NAME(inv_mixed_powers_rev), LN_NAME(inv_rounds));
+  LN_NAME(scalar_mul_reduce_array_asm)(c, LN_N, LN_NAME(rescale));
+  reduce_times_asm(c, LN_N, LN_NAME(final_reductions));
+  LN_NAME(correct_asm)(c, LN_N);
+}
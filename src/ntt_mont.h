@@ -0,0 +1,190 @@
+/*
+ * BD: NTT variants with 16-bit coefficients and Montgomery multiplication
+ *
+ * All variants are specialized to Q=12289.
+ * - omega denotes a primitive n-th root of unity (mod Q).
+ * - psi denotes a square root of omega (mod Q).
+ *
+ * This is an alternative to the Longa-Naehrig reduction used in
+ * ntt_red.h. Coefficients and constants are stored as int16_t. All
+ * products are signed Montgomery multiplications with R = 2^16 and all
+ * constants are stored in Montgomery form (i.e., pre-multiplied by R), so
+ * there are no inverse(k) factors and no extra rescaling passes. The
+ * AVX2 implementation in ntt_mont_asm.S uses vpmullw/vpmulhw. The C
+ * functions compute exactly the same values as the assembly code so
+ * they can be used to test it.
+ *
+ * Three kinds of modular operations are used:
+ *
+ * 1) Montgomery multiplication by a constant w, given w' = w * Q^-1 mod 2^16:
+ *
+ *      mul_montc(x, w, w') = hi(x * w) - hi(lo(x * w') * Q)
+ *
+ *    where hi and lo are the high and low 16 bits of a 32-bit product
+ *    (vpmulhw and vpmullw). The result is congruent to x * w * 2^-16
+ *    modulo Q and
+ *      |mul_montc(x, w, w')| <= |x * w|/2^16 + 6145
+ *    For |w| <= (Q-1)/2, that's at most 3|x|/32 + 6145.
+ *
+ * 2) Barrett reduction (same as in ntt_short.h):
+ *
+ *      red(x) = x - Q * round(((x * 21844) >> 16)/2^12)
+ *
+ *    The result is congruent to x modulo Q and -6145 <= red(x) <= 6145.
+ *
+ * 3) Montgomery multiplication of two coefficients:
+ *
+ *      mul_mont(x, y) = hi(x * y) - hi(lo(lo(x * y) * Q^-1) * Q)
+ *
+ *    The result is congruent to x * y * 2^-16 modulo Q and
+ *      |mul_mont(x, y)| <= |x * y|/2^16 + 6145
+ *
+ * A constant c is stored as w = c * 2^16 mod Q so mul_montc(x, w, w')
+ * is congruent to x * c. The tables are generated by
+ * 'make_red_tables <n> <psi> mont'. Each table of constants has 2n
+ * elements: p[i] for i=0 ... n-1 is the constant (in the range
+ * [-(Q-1)/2, (Q-1)/2], in Montgomery form) and p[n + i] is its
+ * Montgomery companion.
+ */
+
+#ifndef NTT_MONT_H
+#define NTT_MONT_H
+
+#include <stdint.h>
+
+
+/*****************
+ * NORMALIZATION *
+ ****************/
+
+/*
+ * Reduce all coefficients to an integer in [0 .. q-1].
+ * Works for any 16-bit coefficients.
+ */
+extern void mont_normalize(int16_t *a, uint32_t n);
+
+
+/**************
+ * REDUCTIONS *
+ *************/
+
+/*
+ * Reduce all elements of array a: a'[i] = red(a[i])
+ * The result satisfies:
+ *     a'[i] == a[i] modulo Q
+ *     -6145 <= a'[i] <= 6145
+ */
+extern void mont_reduce_array(int16_t *a, uint32_t n);
+
+/*
+ * Multiply a[i] by the constant p[i] (Montgomery multiplication)
+ * - p must be a table of 2n constants (i.e., p[n+i] is the Montgomery
+ *   companion of p[i]).
+ * - the result satisfies a'[i] == a[i] * p[i] * 2^-16 modulo Q and
+ *      |a'[i]| <= |a[i] * p[i]|/2^16 + 6145
+ *   If 0 <= a[i] <= Q-1, then |a'[i]| <= 7297.
+ */
+extern void mont_mul_array16(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * Montgomery product: c[i] = mul_mont(a[i], b[i])
+ * The result satisfies:
+ *     c[i] == a[i] * b[i] * 2^-16 modulo Q
+ *     |c[i]| <= |a[i] * b[i]|/2^16 + 6145
+ */
+extern void mont_mul_array(int16_t *c, uint32_t n, const int16_t *a, const int16_t *b);
+
+/*
+ * Final step of the product functions: multiply by a constant and
+ * convert to [0, Q-1] in a single pass.
+ * - mont_mul_finalize(a, n, p): a[i] = mul_montc(a[i], p[i], p[n+i]) converted to [0, Q-1]
+ * - mont_scalar_mul_finalize(a, n, c, c_mont): a[i] = mul_montc(a[i], c, c_mont) converted to [0, Q-1]
+ *
+ * The conversion adds Q to negative numbers. It's correct for any 16-bit
+ * a[i] since |mul_montc(a[i], ...)| <= 9217 if |c| <= (Q-1)/2.
+ */
+extern void mont_mul_finalize(int16_t *a, uint32_t n, const int16_t *p);
+extern void mont_scalar_mul_finalize(int16_t *a, uint32_t n, int16_t c, int16_t c_mont);
+
+
+/****************
+ * NTT VARIANTS *
+ ***************/
+
+/*
+ * The eight variants are the same as in ntt_red.h, except that the
+ * twiddle factors are in Montgomery form rather than scaled by
+ * inverse(3), and all products are Montgomery multiplications
+ * (including products by 1, so that the assembly code does not need
+ * special cases for j=0).
+ *
+ * Because products by 1 are not skipped, the plain and combined
+ * versions (e.g., ntt_mont_ct_rev2std and mulntt_mont_ct_rev2std)
+ * are the same function applied to different tables.
+ *
+ * Reduction schedule:
+ * - in the Cooley-Tukey variants, both outputs of a butterfly are
+ *   reduced in the rounds where the distance between the butterfly
+ *   inputs is 2, 8, 32, 128, ... (i.e., one round out of two).
+ * - in the Gentleman-Sande variants, the sum a[s] + a[s+t] is reduced
+ *   in every round.
+ *
+ * Bounds: the reduction schedule and the bounds are the same as in
+ * ntt_short.h since the bound on mul_montc is lower than the bound on
+ * Barrett multiplication:
+ * - Cooley-Tukey: the input must satisfy -12289 <= a[i] <= 12289.
+ *   Then all intermediate values are between -30771 and 30771 and
+ *   the output is between -13442 and 13442.
+ * - Gentleman-Sande: the input must satisfy -16383 <= a[i] <= 16383.
+ *   The output is then between -12288 and 12288.
+ *
+ * In all cases, the result is NTT(a) (or NTT(a') for the combined
+ * versions), not reduced modulo Q.
+ */
+
+/*
+ * COOLEY-TUKEY: BIT-REVERSE TO STANDARD ORDER
+ * - input: a[0 ... n-1] in bit-reverse order
+ * - p: table of 2n constants such that
+ *   p[t + j] = R * omega^(n/2t)^j (for ntt_mont_ct_rev2std)
+ *   p[t + j] = R * psi^(n/2t) * omega^(n/2t)^j (for mulntt_mont_ct_rev2std)
+ *   for t=1, 2, 4, .., n/2 and j=0, ..., t-1.
+ * - output: NTT(a) or NTT(a') in standard order, where a'[i] = a[i] * psi^i.
+ */
+extern void ntt_mont_ct_rev2std(int16_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_mont_ct_rev2std(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - input: a[0 ... n-1] in standard order
+ * - p: table of 2n constants such that
+ *   p[t + j] = R * omega^(n/2t)^bitrev(j) (for ntt_mont_ct_std2rev)
+ *   p[t + j] = R * psi^(n/2t) * omega^(n/2t)^bitrev(j) (for mulntt_mont_ct_std2rev)
+ * - output: NTT(a) or NTT(a') in bit-reverse order.
+ */
+extern void ntt_mont_ct_std2rev(int16_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_mont_ct_std2rev(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - input: a[0 ... n-1] in bit-reverse order
+ * - p: table of 2n constants such that
+ *   p[t + j] = R * omega^(n/2t)^bitrev(j) (for ntt_mont_gs_rev2std)
+ *   p[t + j] = R * psi^(n/2t) * omega^(n/2t)^bitrev(j) (for nttmul_mont_gs_rev2std)
+ * - output: NTT(a) or a' in standard order, where a'[i] = NTT(a)[i] * psi^i.
+ */
+extern void ntt_mont_gs_rev2std(int16_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_mont_gs_rev2std(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: STANDARD TO BIT-REVERSE ORDER
+ * - input: a[0 ... n-1] in standard order
+ * - p: table of 2n constants such that
+ *   p[t + j] = R * omega^(n/2t)^j (for ntt_mont_gs_std2rev)
+ *   p[t + j] = R * psi^(n/2t) * omega^(n/2t)^j (for nttmul_mont_gs_std2rev)
+ * - output: NTT(a) or a' in bit-reverse order, where a'[i] = NTT(a)[i] * psi^i.
+ */
+extern void ntt_mont_gs_std2rev(int16_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_mont_gs_std2rev(int16_t *a, uint32_t n, const int16_t *p);
+
+#endif /* NTT_MONT_H */
@@ -0,0 +1,94 @@
+/*
+ * NTT for Q=12289, n=1024, with 16-bit coefficients and Montgomery multiplication.
+ */
+
+#ifndef __NTT_MONT1024_H
+#define __NTT_MONT1024_H
+
+#include "ntt_mont1024_tables.h"
+#include "ntt_mont.h"
+
+/*
+ * NTT Variants: as in ntt_mont.h
+ * using tables from ntt_mont1024_tables.h
+ *
+ * Input: a[i] for i=0 .. 1023 is expected to satisfy
+ *   -12289 <= a[i] <= 12289 (Cooley-Tukey)
+ *   -16383 <= a[i] <= 16383 (Gentleman-Sande)
+ *
+ * The result is stored in a, it is not reduced modulo Q.
+ */
+// forward NTTs
+static inline void ntt_mont1024_ct_rev2std(int16_t *a) {
+  ntt_mont_ct_rev2std(a, 1024, ntt_mont1024_omega_powers);
+}
+
+static inline void ntt_mont1024_gs_rev2std(int16_t *a) {
+  ntt_mont_gs_rev2std(a, 1024, ntt_mont1024_omega_powers_rev);
+}
+
+static inline void ntt_mont1024_ct_std2rev(int16_t *a) {
+  ntt_mont_ct_std2rev(a, 1024, ntt_mont1024_omega_powers_rev);
+}
+
+static inline void ntt_mont1024_gs_std2rev(int16_t *a) {
+  ntt_mont_gs_std2rev(a, 1024, ntt_mont1024_omega_powers);
+}
+
+// inverse
+static inline void intt_mont1024_ct_rev2std(int16_t *a) {
+  ntt_mont_ct_rev2std(a, 1024, ntt_mont1024_inv_omega_powers);
+}
+
+static inline void intt_mont1024_gs_rev2std(int16_t *a) {
+  ntt_mont_gs_rev2std(a, 1024, ntt_mont1024_inv_omega_powers_rev);
+}
+
+static inline void intt_mont1024_ct_std2rev(int16_t *a) {
+  ntt_mont_ct_std2rev(a, 1024, ntt_mont1024_inv_omega_powers_rev);
+}
+
+static inline void intt_mont1024_gs_std2rev(int16_t *a) {
+  ntt_mont_gs_std2rev(a, 1024, ntt_mont1024_inv_omega_powers);
+}
+
+// multiplication by powers of psi then forward ntt
+static inline void mulntt_mont1024_ct_rev2std(int16_t *a) {
+  mulntt_mont_ct_rev2std(a, 1024, ntt_mont1024_mixed_powers);
+}
+
+static inline void mulntt_mont1024_ct_std2rev(int16_t *a) {
+  mulntt_mont_ct_std2rev(a, 1024, ntt_mont1024_mixed_powers_rev);
+}
+
+// inverse ntt then multiplication by powers of psi^-1
+static inline void inttmul_mont1024_gs_rev2std(int16_t *a) {
+  nttmul_mont_gs_rev2std(a, 1024, ntt_mont1024_inv_mixed_powers_rev);
+}
+
+static inline void inttmul_mont1024_gs_std2rev(int16_t *a) {
+  nttmul_mont_gs_std2rev(a, 1024, ntt_mont1024_inv_mixed_powers);
+}
+
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Input: two arrays a and b in standard order
+ *
+ * Result: 
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1]
+ * The result is also in that range.
+ */
+extern void ntt_mont1024_product1(int16_t *c, int16_t *a, int16_t *b);
+extern void ntt_mont1024_product2(int16_t *c, int16_t *a, int16_t *b);
+extern void ntt_mont1024_product3(int16_t *c, int16_t *a, int16_t *b);
+extern void ntt_mont1024_product4(int16_t *c, int16_t *a, int16_t *b);
+extern void ntt_mont1024_product5(int16_t *c, int16_t *a, int16_t *b);
+
+#endif /* __NTT_MONT1024_H */
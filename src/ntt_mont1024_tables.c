@@ -0,0 +1,2615 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#include "ntt_mont1024_tables.h"
+
+const int16_t ntt_mont1024_psi_powers[2048] = {
+     4091, -5408, -2818,  5885, -5064,  1906,  3311,  2457,
+    -3269,  3264,  3955,  4156,  -943,  2340,   983,  1353,
+    -4426, -2479,  5539,   473,   351,  -467,  5733,   565,
+    -4673,  5132,  5601,  1896,  5460, -5899,  3157,  6058,
+    -1688, -3461,  5200,   819, -5186,  1088, -2778, -2711,
+     3782,   780,  4424,   451,  2621,  3270, -2250,  4254,
+      117, -4252,  1911, -3908, -5654,  5807,  1867,   632,
+     1820,  2130, -3044, -2077, -4659, -5250, -2363,   273,
+    -5825,  4459,  -926, -5000,  5357,   260,  5571, -3946,
+     4970,  1090,  -750,  1418,    39,  2679,   637, -5399,
+    -5981,  6032, -3474,  4307,  4703,   710, -5111,  3404,
+    -1553, -1750, -4884,    91, -6038, -2610, -4405, -5763,
+     5882,  4183,  1857,  2781,  5753, -3733,  -250,  4569,
+       13,   893, -3884, -5896, -6090,  6107, -1158,  5532,
+     5664,  4333, -5800,  5231, -4614,  3513, -1628, -4066,
+    -6109,  -870,  2628, -1921,  6057, -2702,   619,   927,
+     6014,  2852,  4013,  1523, -4092,  4394, -5391,  2131,
+    -2030,  6132,  -386,  1844,  1888, -2652,  2163,  5840,
+    -1538,  1171, -4639,  2741,  2060,  -290,   876,  3456,
+     2019, -4997, -3890,   309,  6101,  5047,  5434,  4604,
+    -1364,  5561, -1797, -3386, -4773,  2044, -4225,  4711,
+    -3467,  -884,   721,  6043, -4609, -3706,  2550,  5010,
+     4783, -4193,   292,  1152,   673, -5762, -5393,   103,
+     6130, -2414, -2285,  5631, -4551,  5950,  -599, -5225,
+    -1591, -3415,  2688, -2526, -5252, -4391, -3856, -2082,
+     2560,  2861,   850,  1670, -2502, -5494, -3999,   384,
+    -3872, -6017, -5894, -4062, -2053, -4901, -4858,  1877,
+    -1517, -2113, -4296, -5838,  3566,  2958,   896,  -842,
+    -5847, -5560,  2811,  -694, -3243,  5050, -3813,  4653,
+     -834,  2265, -1333,   128, -5387, -6102, -6061, -1354,
+     3412, -5730,  2477,  4722, -4602,  3392, -1432, -1946,
+     5285,   986,  4395, -4377, -1949,  2243,   937,  3865,
+    -1081, -2413, -1271,  1551,  -278,   755,  3652,  4139,
+    -5892, -2034,  2076,  3645, -2959, -1910,  4922,  1574,
+    -1534,  5227,  3619, -4745,  5858,  4425,  1465, -1459,
+    -4746,  4844, -3784, -2808,  3736,  3292, -4520,   517,
+    -4189,  4348, -2879,  5476, -1964,  -678,   692,  1215,
+     3110, -4733,  5737,  4621,  3585, -2354, -2890, -5678,
+     6049,  1475, -3608,  3610, -1582,  5711,  2835,  -936,
+    -2851, -2999, -5603, -3924,  2700, -2647, -5056, -2271,
+    -4751,  -226,  4327,   405,  5133, -5674, -2184, -2556,
+     1195, -4881,  3133, -5989, -2080,  4588, -5299, -2893,
+     3569,  6000,   945,  -312,  3146, -5096, -5964, -1308,
+      900,  3214,  2411,  -757, -5680,  4021, -2654,   135,
+     1711,  2205,  -728,  -852, -3698, -1627, -3052,  2100,
+     3403, -2567,  2330,  3132,  5286,  2000,   315,  -104,
+     5145, -5795, -1988,  -436,   300, -3025,  4900,  3844,
+     2203, -2756, -4981,    45, -3526,   735, -4339,  -284,
+    -5329,  3554,  3079,   700, -2962, -4952,  4873,  1044,
+     1762,  4763,   105, -4131,  1715, -6028, -4759,  3951,
+      100,  3088, -2463, -2815, -3362, -5015,  2436,    15,
+     2921,   245,  2650, -4191,  2320,  5281, -3070, -3863,
+     3109, -5747, -2472,   348, -3509,  5684,    35, -1377,
+     4668,  2087,  2510,  1317, -4063, -3067,  -821,  3158,
+    -5217, -5768,   812,     5,  5070,  4178, -3213, -1397,
+    -3323, -2336,  3073, -5384, -3060, -6012,  -824,   116,
+    -5266,  5991,  4108,  -459,  1556,  4792,  4933,   439,
+     2742,  3074, -4370,  5149, -1739, -6019,  4367,  4098,
+     1690,  5489, -1071, -4562, -5204, -4875, -3072, -5891,
+    -1020, -2004, -4371,  4135,  2341,  1997, -2727,  -153,
+     4615, -2499, -2452, -3950,   914,  5121, -5553, -2380,
+    -4676,  2090,  5552,  1366, -3533,  5926,  -357, -5617,
+    -5831, -1625, -1024, -6060,  -340,  -668, -1457, -2718,
+    -3316,  4762,  -909,   -51, -2558,  -833,  3279, -5413,
+     4401,  1707, -1851,  3303, -5655,  4793,  5947, -3641,
+    -5274, -2121,  -119,  2224, -6040, -4638,  3755, -2020,
+     3983, -4319, -4582,  -906,  2991, -2509,  -303,   -17,
+    -4949, -4374,  1093,  2292,  1467,   569,  -617,  1101,
+    -1885,  5694, -2114, -5310, -1758,  -707, -4136, -3355,
+     2083, -1546,  5348,  3423,  5424, -5536,  2569,  -302,
+      997,  3260,  -101, -4102, -5746, -1458, -3732,   764,
+      489,  4286, -4302,   367,  3468,  1898, -4801, -1770,
+     -586, -4332, -5475,  2978, -3402,  3581,  5879,  1141,
+     1808,  2251, -3240, -4197, -3764,  5183, -4130,  2729,
+     2181,  -486, -1244,  4351,   163,  5525, -1434, -3974,
+     1156,  4729,  2496,  -590,  3901, -1444, -1825,  5089,
+    -1134,  5290,  6056, -3716,  4699, -3346, -1080, -1399,
+    -5351,  5824, -5473,  5006,   727,  -162, -4511, -2646,
+    -4042,  5938,  -478, -5421, -3711, -2520,   832, -4293,
+    -2796,  3615,  3488, -2400,  -378, -2333,  6115, -5335,
+    -2530,  2981,  -360,  3630, -5880, -2155,  2272,  5765,
+    -3854,   -54, -5600,  -882,  2749, -2117,  3937, -1807,
+    -1237,  -840, -3819, -1431,  -932,  1205,  5259,  -800,
+     -126, -4874, -2058,  2318,  3253,  5090,  -120,  1210,
+    -1960,  3378, -3339,  6018, -5381,   -18, -5963,  -294,
+    -3180, -4802, -2784,  3494,  3684,  -280, -1273,  -477,
+    -4407,  4498,  1753, -4363,   -42, -5721,  -686,  4869,
+    -3012,  5793,   -40, -3693,  3443,  1126, -1113,  2006,
+    -5890,    -6, -6084,   -98, -1060, -5697,  -928,  5261,
+     1228,  4003,  3672,  -159, -1469, -2597, -3512,  2642,
+      -14, -1907, -4325,  1623, -1004,  1931,  4083, -1231,
+     5244, -3721,  -371,  4765,  2133,    -2, -2028, -4129,
+     3743, -1899,  3787,  5850, -3687, -2762,  1224,   -53,
+    -4586, -4962, -5267,  4977, -4101, -4732, -5538,   541,
+    -4431,  4740,  1361,  3686,  1748,  2856, -4220, -2508,
+      711, -4097,  -676,  2720,  5344,  -633, -2834,  1950,
+    -1229, -5017,   408, -4114, -5625, -1654, -5852,  1659,
+    -1367,  2519, -1846, -3916, -1477,  1580,  4550,  5325,
+     4679,   952, -5503,  -836,   237, -5462,  3871,  5003,
+    -2315,  -211, -5041,   650, -4506,  2424,   136,  2725,
+    -1875,  3545, -6047,   553, -4552,  4936,  3481,  2791,
+     3604,  4623,  5613,  1775,  5656, -3779,  2262, -4375,
+       79, -5917, -2806,  5764, -4868,  4026,  2416,  4313,
+    -1502,   808, -4051, -3188,  -625,  5278, -6112, -3912,
+     2579, -2451, -2936, -3166, -2895,  1541,  1871,  4688,
+    -2211, -5356,   754,  2638, -4070,  2124,  3161, -2175,
+    -5719,  1342, -3291,  5534, -4597, -3827,  2746, -5159,
+     3888, -2337,  2059, -1304,  4956,  -817, -5075,  3041,
+     -965,  4610,  4720,  5659,  -737,  2311, -3845, -3217,
+    -5453,   708,  5150,  -725,  2190, -3649, -1097,  5941,
+     2564, -5372, -3181, -5816,  1296,  -779, -3410, -4531,
+     1652,  3824, -5788,  5110, -4418,  5633, -2523, -2210,
+    -4342, -3326, -5378,  3024, -5914,   236,  5813, -4338,
+      730,  2880, -4462, -2116,  4951, -5887,  3036, -6035,
+      432, -4356, -5233,  2586,  4647,  5371,  2167, -2393,
+    -5569,  5974,  -841, -4833,  2649, -5205, -5889,  1008,
+     2125,  4175,  6034, -1446, -3853,   960,  2609,  3391,
+    -2446,  2134,  1012, -6108,   144, -1452,  2352,   862,
+     1549, -2306, -3374, -4894,  2240, -2105,  3816, -1611,
+      883, -1735, -1963,   336, -3388,  5488, -2085,  -482,
+     2812,   320,  4966, -2966,  3281, -3385, -3759, -2036,
+       48,  -484,   784, -3809, -3580, -4865, -5221,  2465,
+     4843, -4798,  1272,  -537, -3802,  3518,  3442,   112,
+     2967, -2267,  -695, -4257, -3159,  4203, -2441, -5085,
+     5190,  2968, -1253, -4775,    16,  3935, -3835, -5366,
+     2903, -5718,  2356,  4918, -2482,  2497,   424,  -179,
+     2829,  5269, -2949, -4059,   989, -4852, -4328, -1419,
+    -1053,  1401, -4910, -1695,  1730, -3107, -4514, -5688,
+    // Montgomery companions
+        -5,  -5408,  21758, -22787,  27704, -22670,  15599,  22937,
+     -7365,   3264,  32627, -12228, -13231,  18724, -19497,  21833,
+    -12618, -14767, -31325,  20953,  12639, -29139,   9829,   4661,
+      7615, -11252,  -6687, -30872,  21844,  -1803,   7253,  14250,
+     31080,  -7557,   5200,  29491,  19390,   1088, -10970,  17769,
+     -4410, -15604, -28344,  29123, -26051,  -4922, -10442,  28830,
+      4213,  12132, -18569, -20292,   2538,  18095,  -2229, -32136,
+    -14564, -22446, -19428,  26595,  32205,  19326,   1733, -12015,
+      6463,    363, -25502,  27768, -23315,  16644, -31293, -12138,
+     13162, -23486, -25326,   9610, -20441, -17801, -28035,  15081,
+     22691,   6032,  21102, -32557,  16991,  -7482,  15369, -12980,
+     10735,   6442, -21268,  -4005,   2154,  21966,  -8501,  31101,
+     14074, -16297, -10431, -25891,  26233,  -7829,  -8442,  25049,
+    -28659, -27779,  12500,  26872, -14282,   2011,   7034, -10852,
+      5664, -24339,  26968,  17519,   3578,  23993,  14756,  20510,
+     22563,   7322,  19012,  10367,  26537, -27278,  -3477,  13215,
+     30590,  19236, -24659,  30195,  12292,  12586, -17679,  30803,
+    -26606,  22516,  24190,  18228,   1888,  13732,  30835,   5840,
+     23038,  29843, -16927,   6837, -14324,  24286, -15508,   3456,
+     30691,  -9093,  20686,   4405,  10197, -15433,  13626, -11780,
+    -17748,  26041,  -5893, -11578,  -8869, -14340,   8063, -15769,
+       629, -17268, -11567,   1947,   7679, -11898,  -5642, -19566,
+     17071,   8095,  16676,   1152, -11615,  18814,   6895, -20377,
+    -18446, -26990,  26387,  17919,  15929,  30526,  19881, -25705,
+     18889,  17065,   2688, -27102, -21636,  16089,  -3856,  22494,
+      2560, -25811, -23726,  -6522,   5690,   2698, -16287,    384,
+     -3872,   6271,   2298, -28638,  -6149,  -8997, -13050,   5973,
+     27155,  10175,  28472, -30414,  28142,  27534,    896,  -9034,
+     14633,  27208,  -1285,   7498,    853,  13242,  -7909, -24019,
+     23742,  22745,  -5429,    128,  -1291,   2090,  22611,  -9546,
+     19796,  18846, -26195, -19854, -12794,   3392,  31336, -10138,
+      9381,   9178,    299, -24857,  26723,  30915,  21417,  24345,
+    -21561,  26259,  19209,  13839,   7914,  29427,  20036,     43,
+    -22276,  22542, -14308, -25027, -15247,   6282,  13114,  -6618,
+    -26110,   1131,  32291, -25225, -18718,  24905,  21945, -30131,
+    -12938, -11540,  28984,  29960, -29032, -13092,  28248,   4613,
+     24483, -12036, -15167,  21860,  14420,   7514,  17076,  13503,
+     -5082,  23939,  26217, -24051,  -8703,  22222, -11082, -30254,
+     -6239,  30147,  29160,  11802, -26158,  17999,  31507,  31832,
+    -31523,  17481,  31261, -20308, -13684,  17833,  -5056, -14559,
+    -17039,  24350, -16153,   4501, -23539, -13866,  30584,  13828,
+     -2901,   7407, -25539, -10085,  -2080, -11796,  31565,  25779,
+     -8719,   6000, -11343,  32456,  11338,  27672,  10420,  15076,
+     17284,  27790,  -1685,  -4853,  -5680,   8117, -27230, -20345,
+     13999, -26467,  32040, -17236,  20878,   2469,  13332,  18484,
+      -693,  17913,  10522, -13252,  -2906,   2000,  -3781,  32664,
+     25625,  31069, -18372, -16820, -16084,   9263,  21284,  20228,
+     -1893, -19140,  -9077, -28627,   4666,  13023,  32525,  16100,
+      6959, -21022, -17401, -15684,  21614,  27816,  25353,  17428,
+    -22814,    667,  20585,  32733,  30387,  10356,  15721,  16239,
+     16484,   3088, -14751, -15103,  21214,  15465,  18820,  12303,
+     23401,   4341,  10842, -16479,   2320,  -7007, -27646,  16617,
+      7205,  31117,  30296, -16036,  -7605,  22068,  28707,  10911,
+    -11716, -18393,  27086,   5413, -16351,   1029,  -4917,  -5034,
+      7071,  27000, -15572,   4101,  29646, -20398,  25459,  -5493,
+       773,  -2336,  -9215,  27384, -19444,  10372,  31944,  16500,
+     19310, -14489, -12276,   3637,  17940, -27976,   9029, -20041,
+     -5450, -21502,  20206, -23523,   2357,  30845,  16655, -20478,
+      9882,  -6799, -13359,  20014, -21588,   -779,  -3072,  30973,
+     15364, -18388,  32493, -16345,   6437, -26675,  17753, -20633,
+    -15865, -31171, -18836, -28526, -23662,  -7167,   6735,  14004,
+    -21060,  10282,   5552,  -6826,  25139,  -2266,  -4453,   6671,
+     14649, -22105,  -1024,  10324, -16724,  15716,  10831, -27294,
+    -19700,  12954,  27763, -28723, -27134,  11455,  15567,  -9509,
+     -7887,  -2389,   2245, -17177,  14825,  25273,   1851, -24121,
+    -13466, -22601,  20361,   2224,  26728, -29214,   -341, -18404,
+     16271, -16607,   3610,  -9098,  15279,  26163, -12591,  12271,
+     -9045,   3818,   5189,  18676,  -2629,  21049, -21097, -27571,
+     26787,  30270,  22462, -29886, -26334, -29379,  28632,    741,
+     30755,  -9738,  21732,  15711,   5424,  -5536,  23049, -24878,
+      5093, -13124,  -4197,   4090,  18830,  23118, -20116, -15620,
+     20969,  28862, -28878,  12655, -12916,  10090,   7487,  -9962,
+     -8778,  12052,  31389, -21598, -11594, -25091, -14601,   5237,
+      1808,  -1845,  29528,  -8293, -20148,  17471,  20446,  23209,
+      6277,   7706,  15140,  16639,  28835,   9621,  -9626,   4218,
+     17540,  25209,   2496, -25166, -24771, -17828,  10463,  -7199,
+    -25710,  13482, -26712, -20100,    603,  21230,  31688,  19081,
+     15129,   5824,   6815,  29582, -19753,  24414, -16799,   5546,
+    -12234, -18638, -25054,  23251, -15999,  30248,    832,  -8389,
+     13588,  15903,   3488,  -2400,  -8570,  26339, -30749,  15145,
+     22046,   7077,  32408,  28206,  26888,   1941,   2272,   9861,
+    -28430,   8138,  -5600,  23694, -25923,  -6213,  -8351, -14095,
+     -5333,  31928,    277,  19049, -17316,   5301,   1163,   -800,
+    -24702, -13066, -10250,  26894,   7349, -19486,  32648,   9402,
+     30808, -21198,    757, -18558,  -9477,  24558,  -1867,   7898,
+     13204,  19774,  -2784,  -4698,  20068,  32488, -21753,  28195,
+     16073, -20078,  22233,   -267,  -8234, -26201, -25262,   8965,
+    -19396,  -6495,  32728,  24979,  32115,  -7066, -21593,  -6186,
+     18686,   8186, -22468,  24478, -17444,   6591,   -928, -23411,
+    -15156,  32675, -29096, -12447,  27203,  -6693,  29256, -21934,
+    -24590, -30579,  -8421, -18857,  15380,  -2165,  32755, -13519,
+    -11140, -24201, -29043, -23907,   6229,  24574,  14356,   8159,
+     16031,   2197,   -309,  14042,  16793, -10954, -31544,  -4149,
+    -12778,  19614,  31597,  -7311,  -8197,  11652,  19038, -28131,
+    -16719,  21124, -10927,  -4506,  18132, -29912,  12164,  13876,
+    -19769,   8191, -17060,   2720,   5344, -21113,  21742,  26526,
+     27443, -25497, -32360,  20462, -26105,   6538,  10532,  -2437,
+     19113, -17961,   6346,  12468,  -5573, -14804,  -3642, -23347,
+    -15801, -31816, -17791, -17220, -28435,   2730,  16159,    907,
+      1781, -28883,   7247,   8842, -12698, -30344, -32632,   6821,
+    -30547,  24025, -18335,  21033,  28216, -27832,  23961, -17689,
+     19988,  16911, -23059,  14063, -27112, -32451,  -5930,  16105,
+     12367,  22755,   5386,  22148, -21252,  12218,   2416,  24793,
+    -26078, -31960, -32723, -19572,  11663,  29854,  -6112,  28856,
+     31251, -31123,  29832, -27742, -15183,   5637,  14159,   4688,
+    -30883,  11028, -23822,  27214,   4122, -14260,  23641, -14463,
+     14761,  25918,    805,  30110,  -8693, -32499,  10938,  15321,
+      3888,   9951,  -2037,  31464, -11428,  11471,  31789,  -9247,
+     -5061, -19966,   4720,   1563,  11551, -18169,  -7941,   9071,
+     23219,  17092,  29726,  -4821,  26766,   8639, -21577,  10037,
+     18948,  11012,  25491,  26952,   1296,   3317,  21166,  32333,
+     18036,   3824,  10596,  -3082,  20158,  -6655,   1573,  22366,
+      3850, -27902,  19198,   3024, -14106, -16148,   9909,  20238,
+      8922,   2880, -29038, -18500, -15529, -18175, -13348,  30829,
+       432, -20740,   7055,  10778, -15833,   1275, -18313, -22873,
+      6719,  -2218, -21321,   7455,  23129,  -9301,   6399,   1008,
+    -26547,  16463, -18542,   6746,  24819,    960,  -9679,  15679,
+    -27022,  -6058,  17396,  10276,    144,  14932,   2352,  25438,
+    -27123,  22270, -27950, -29470,   2240, -22585, -28952,   2485,
+     29555,  18745,   2133,    336,  12996,   5488,  -6181,  24094,
+    -13572,    320,  -3226,   5226,  -9007, -23865, -16047, -18420,
+        48, -16868,    784,   8479,  12804,   7423,  -9317,  -9823,
+       747, -29374, -31496, -21017, -11994,  28094, -21134,    112,
+    -17513,   1829,  19785,   8031,  17321,    107, -22921,  23587,
+     -3002, -29800,  -5349,  15705,     16,  16223,    261,   2826,
+    -17577,   2474,  18740,  -3274,  22094,  -9791, -32344, -28851,
+    -25843,   9365,  -7045,     37, -27683, -21236,  28440,   2677,
+     27619,  21881, -29486, -13983, -22846, -31779,  20062,  27080,
+};
+
+const int16_t ntt_mont1024_scaled_inv_psi_powers[2048] = {
+     3755, -4638, -6040,  2224,  -119, -2121, -5274, -3641,
+     5947,  4793, -5655,  3303, -1851,  1707,  4401, -5413,
+     3279,  -833, -2558,   -51,  -909,  4762, -3316, -2718,
+    -1457,  -668,  -340, -6060, -1024, -1625, -5831, -5617,
+     -357,  5926, -3533,  1366,  5552,  2090, -4676, -2380,
+    -5553,  5121,   914, -3950, -2452, -2499,  4615,  -153,
+    -2727,  1997,  2341,  4135, -4371, -2004, -1020, -5891,
+    -3072, -4875, -5204, -4562, -1071,  5489,  1690,  4098,
+     4367, -6019, -1739,  5149, -4370,  3074,  2742,   439,
+     4933,  4792,  1556,  -459,  4108,  5991, -5266,   116,
+     -824, -6012, -3060, -5384,  3073, -2336, -3323, -1397,
+    -3213,  4178,  5070,     5,   812, -5768, -5217,  3158,
+     -821, -3067, -4063,  1317,  2510,  2087,  4668, -1377,
+       35,  5684, -3509,   348, -2472, -5747,  3109, -3863,
+    -3070,  5281,  2320, -4191,  2650,   245,  2921,    15,
+     2436, -5015, -3362, -2815, -2463,  3088,   100,  3951,
+    -4759, -6028,  1715, -4131,   105,  4763,  1762,  1044,
+     4873, -4952, -2962,   700,  3079,  3554, -5329,  -284,
+    -4339,   735, -3526,    45, -4981, -2756,  2203,  3844,
+     4900, -3025,   300,  -436, -1988, -5795,  5145,  -104,
+      315,  2000,  5286,  3132,  2330, -2567,  3403,  2100,
+    -3052, -1627, -3698,  -852,  -728,  2205,  1711,   135,
+    -2654,  4021, -5680,  -757,  2411,  3214,   900, -1308,
+    -5964, -5096,  3146,  -312,   945,  6000,  3569, -2893,
+    -5299,  4588, -2080, -5989,  3133, -4881,  1195, -2556,
+    -2184, -5674,  5133,   405,  4327,  -226, -4751, -2271,
+    -5056, -2647,  2700, -3924, -5603, -2999, -2851,  -936,
+     2835,  5711, -1582,  3610, -3608,  1475,  6049, -5678,
+    -2890, -2354,  3585,  4621,  5737, -4733,  3110,  1215,
+      692,  -678, -1964,  5476, -2879,  4348, -4189,   517,
+    -4520,  3292,  3736, -2808, -3784,  4844, -4746, -1459,
+     1465,  4425,  5858, -4745,  3619,  5227, -1534,  1574,
+     4922, -1910, -2959,  3645,  2076, -2034, -5892,  4139,
+     3652,   755,  -278,  1551, -1271, -2413, -1081,  3865,
+      937,  2243, -1949, -4377,  4395,   986,  5285, -1946,
+    -1432,  3392, -4602,  4722,  2477, -5730,  3412, -1354,
+    -6061, -6102, -5387,   128, -1333,  2265,  -834,  4653,
+    -3813,  5050, -3243,  -694,  2811, -5560, -5847,  -842,
+      896,  2958,  3566, -5838, -4296, -2113, -1517,  1877,
+    -4858, -4901, -2053, -4062, -5894, -6017, -3872,   384,
+    -3999, -5494, -2502,  1670,   850,  2861,  2560, -2082,
+    -3856, -4391, -5252, -2526,  2688, -3415, -1591, -5225,
+     -599,  5950, -4551,  5631, -2285, -2414,  6130,   103,
+    -5393, -5762,   673,  1152,   292, -4193,  4783,  5010,
+     2550, -3706, -4609,  6043,   721,  -884, -3467,  4711,
+    -4225,  2044, -4773, -3386, -1797,  5561, -1364,  4604,
+     5434,  5047,  6101,   309, -3890, -4997,  2019,  3456,
+      876,  -290,  2060,  2741, -4639,  1171, -1538,  5840,
+     2163, -2652,  1888,  1844,  -386,  6132, -2030,  2131,
+    -5391,  4394, -4092,  1523,  4013,  2852,  6014,   927,
+      619, -2702,  6057, -1921,  2628,  -870, -6109, -4066,
+    -1628,  3513, -4614,  5231, -5800,  4333,  5664,  5532,
+    -1158,  6107, -6090, -5896, -3884,   893,    13,  4569,
+     -250, -3733,  5753,  2781,  1857,  4183,  5882, -5763,
+    -4405, -2610, -6038,    91, -4884, -1750, -1553,  3404,
+    -5111,   710,  4703,  4307, -3474,  6032, -5981, -5399,
+      637,  2679,    39,  1418,  -750,  1090,  4970, -3946,
+     5571,   260,  5357, -5000,  -926,  4459, -5825,   273,
+    -2363, -5250, -4659, -2077, -3044,  2130,  1820,   632,
+     1867,  5807, -5654, -3908,  1911, -4252,   117,  4254,
+    -2250,  3270,  2621,   451,  4424,   780,  3782, -2711,
+    -2778,  1088, -5186,   819,  5200, -3461, -1688,  6058,
+     3157, -5899,  5460,  1896,  5601,  5132, -4673,   565,
+     5733,  -467,   351,   473,  5539, -2479, -4426,  1353,
+      983,  2340,  -943,  4156,  3955,  3264, -3269,  2457,
+     3311,  1906, -5064,  5885, -2818, -5408,  4091,  5688,
+     4514,  3107, -1730,  1695,  4910, -1401,  1053,  1419,
+     4328,  4852,  -989,  4059,  2949, -5269, -2829,   179,
+     -424, -2497,  2482, -4918, -2356,  5718, -2903,  5366,
+     3835, -3935,   -16,  4775,  1253, -2968, -5190,  5085,
+     2441, -4203,  3159,  4257,   695,  2267, -2967,  -112,
+    -3442, -3518,  3802,   537, -1272,  4798, -4843, -2465,
+     5221,  4865,  3580,  3809,  -784,   484,   -48,  2036,
+     3759,  3385, -3281,  2966, -4966,  -320, -2812,   482,
+     2085, -5488,  3388,  -336,  1963,  1735,  -883,  1611,
+    -3816,  2105, -2240,  4894,  3374,  2306, -1549,  -862,
+    -2352,  1452,  -144,  6108, -1012, -2134,  2446, -3391,
+    -2609,  -960,  3853,  1446, -6034, -4175, -2125, -1008,
+     5889,  5205, -2649,  4833,   841, -5974,  5569,  2393,
+    -2167, -5371, -4647, -2586,  5233,  4356,  -432,  6035,
+    -3036,  5887, -4951,  2116,  4462, -2880,  -730,  4338,
+    -5813,  -236,  5914, -3024,  5378,  3326,  4342,  2210,
+     2523, -5633,  4418, -5110,  5788, -3824, -1652,  4531,
+     3410,   779, -1296,  5816,  3181,  5372, -2564, -5941,
+     1097,  3649, -2190,   725, -5150,  -708,  5453,  3217,
+     3845, -2311,   737, -5659, -4720, -4610,   965, -3041,
+     5075,   817, -4956,  1304, -2059,  2337, -3888,  5159,
+    -2746,  3827,  4597, -5534,  3291, -1342,  5719,  2175,
+    -3161, -2124,  4070, -2638,  -754,  5356,  2211, -4688,
+    -1871, -1541,  2895,  3166,  2936,  2451, -2579,  3912,
+     6112, -5278,   625,  3188,  4051,  -808,  1502, -4313,
+    -2416, -4026,  4868, -5764,  2806,  5917,   -79,  4375,
+    -2262,  3779, -5656, -1775, -5613, -4623, -3604, -2791,
+    -3481, -4936,  4552,  -553,  6047, -3545,  1875, -2725,
+     -136, -2424,  4506,  -650,  5041,   211,  2315, -5003,
+    -3871,  5462,  -237,   836,  5503,  -952, -4679, -5325,
+    -4550, -1580,  1477,  3916,  1846, -2519,  1367, -1659,
+     5852,  1654,  5625,  4114,  -408,  5017,  1229, -1950,
+     2834,   633, -5344, -2720,   676,  4097,  -711,  2508,
+     4220, -2856, -1748, -3686, -1361, -4740,  4431,  -541,
+     5538,  4732,  4101, -4977,  5267,  4962,  4586,    53,
+    -1224,  2762,  3687, -5850, -3787,  1899, -3743,  4129,
+     2028,     2, -2133, -4765,   371,  3721, -5244,  1231,
+    -4083, -1931,  1004, -1623,  4325,  1907,    14, -2642,
+     3512,  2597,  1469,   159, -3672, -4003, -1228, -5261,
+      928,  5697,  1060,    98,  6084,     6,  5890, -2006,
+     1113, -1126, -3443,  3693,    40, -5793,  3012, -4869,
+      686,  5721,    42,  4363, -1753, -4498,  4407,   477,
+     1273,   280, -3684, -3494,  2784,  4802,  3180,   294,
+     5963,    18,  5381, -6018,  3339, -3378,  1960, -1210,
+      120, -5090, -3253, -2318,  2058,  4874,   126,   800,
+    -5259, -1205,   932,  1431,  3819,   840,  1237,  1807,
+    -3937,  2117, -2749,   882,  5600,    54,  3854, -5765,
+    -2272,  2155,  5880, -3630,   360, -2981,  2530,  5335,
+    -6115,  2333,   378,  2400, -3488, -3615,  2796,  4293,
+     -832,  2520,  3711,  5421,   478, -5938,  4042,  2646,
+     4511,   162,  -727, -5006,  5473, -5824,  5351,  1399,
+     1080,  3346, -4699,  3716, -6056, -5290,  1134, -5089,
+     1825,  1444, -3901,   590, -2496, -4729, -1156,  3974,
+     1434, -5525,  -163, -4351,  1244,   486, -2181, -2729,
+     4130, -5183,  3764,  4197,  3240, -2251, -1808, -1141,
+    -5879, -3581,  3402, -2978,  5475,  4332,   586,  1770,
+     4801, -1898, -3468,  -367,  4302, -4286,  -489,  -764,
+     3732,  1458,  5746,  4102,   101, -3260,  -997,   302,
+    -2569,  5536, -5424, -3423, -5348,  1546, -2083,  3355,
+     4136,   707,  1758,  5310,  2114, -5694,  1885, -1101,
+      617,  -569, -1467, -2292, -1093,  4374,  4949,    17,
+      303,  2509, -2991,   906,  4582,  4319, -3983,  2020,
+    // Montgomery companions
+      -341, -29214,  26728,   2224,  20361, -22601, -13466, -24121,
+      1851,  25273,  14825, -17177,   2245,  -2389,  -7887,  -9509,
+     15567,  11455, -27134, -28723,  27763,  12954, -19700, -27294,
+     10831,  15716, -16724,  10324,  -1024, -22105,  14649,   6671,
+     -4453,  -2266,  25139,  -6826,   5552,  10282, -21060,  14004,
+      6735,  -7167, -23662, -28526, -18836, -31171, -15865, -20633,
+     17753, -26675,   6437, -16345,  32493, -18388,  15364,  30973,
+     -3072,   -779, -21588,  20014, -13359,  -6799,   9882, -20478,
+     16655,  30845,   2357, -23523,  20206, -21502,  -5450, -20041,
+      9029, -27976,  17940,   3637, -12276, -14489,  19310,  16500,
+     31944,  10372, -19444,  27384,  -9215,  -2336,    773,  -5493,
+     25459, -20398,  29646,   4101, -15572,  27000,   7071,  -5034,
+     -4917,   1029, -16351,   5413,  27086, -18393, -11716,  10911,
+     28707,  22068,  -7605, -16036,  30296,  31117,   7205,  16617,
+    -27646,  -7007,   2320, -16479,  10842,   4341,  23401,  12303,
+     18820,  15465,  21214, -15103, -14751,   3088,  16484,  16239,
+     15721,  10356,  30387,  32733,  20585,    667, -22814,  17428,
+     25353,  27816,  21614, -15684, -17401, -21022,   6959,  16100,
+     32525,  13023,   4666, -28627,  -9077, -19140,  -1893,  20228,
+     21284,   9263, -16084, -16820, -18372,  31069,  25625,  32664,
+     -3781,   2000,  -2906, -13252,  10522,  17913,   -693,  18484,
+     13332,   2469,  20878, -17236,  32040, -26467,  13999, -20345,
+    -27230,   8117,  -5680,  -4853,  -1685,  27790,  17284,  15076,
+     10420,  27672,  11338,  32456, -11343,   6000,  -8719,  25779,
+     31565, -11796,  -2080, -10085, -25539,   7407,  -2901,  13828,
+     30584, -13866, -23539,   4501, -16153,  24350, -17039, -14559,
+     -5056,  17833, -13684, -20308,  31261,  17481, -31523,  31832,
+     31507,  17999, -26158,  11802,  29160,  30147,  -6239, -30254,
+    -11082,  22222,  -8703, -24051,  26217,  23939,  -5082,  13503,
+     17076,   7514,  14420,  21860, -15167, -12036,  24483,   4613,
+     28248, -13092, -29032,  29960,  28984, -11540, -12938, -30131,
+     21945,  24905, -18718, -25225,  32291,   1131, -26110,  -6618,
+     13114,   6282, -15247, -25027, -14308,  22542, -22276,     43,
+     20036,  29427,   7914,  13839,  19209,  26259, -21561,  24345,
+     21417,  30915,  26723, -24857,    299,   9178,   9381, -10138,
+     31336,   3392, -12794, -19854, -26195,  18846,  19796,  -9546,
+     22611,   2090,  -1291,    128,  -5429,  22745,  23742, -24019,
+     -7909,  13242,    853,   7498,  -1285,  27208,  14633,  -9034,
+       896,  27534,  28142, -30414,  28472,  10175,  27155,   5973,
+    -13050,  -8997,  -6149, -28638,   2298,   6271,  -3872,    384,
+    -16287,   2698,   5690,  -6522, -23726, -25811,   2560,  22494,
+     -3856,  16089, -21636, -27102,   2688,  17065,  18889, -25705,
+     19881,  30526,  15929,  17919,  26387, -26990, -18446, -20377,
+      6895,  18814, -11615,   1152,  16676,   8095,  17071, -19566,
+     -5642, -11898,   7679,   1947, -11567, -17268,    629, -15769,
+      8063, -14340,  -8869, -11578,  -5893,  26041, -17748, -11780,
+     13626, -15433,  10197,   4405,  20686,  -9093,  30691,   3456,
+    -15508,  24286, -14324,   6837, -16927,  29843,  23038,   5840,
+     30835,  13732,   1888,  18228,  24190,  22516, -26606,  30803,
+    -17679,  12586,  12292,  30195, -24659,  19236,  30590,  13215,
+     -3477, -27278,  26537,  10367,  19012,   7322,  22563,  20510,
+     14756,  23993,   3578,  17519,  26968, -24339,   5664, -10852,
+      7034,   2011, -14282,  26872,  12500, -27779, -28659,  25049,
+     -8442,  -7829,  26233, -25891, -10431, -16297,  14074,  31101,
+     -8501,  21966,   2154,  -4005, -21268,   6442,  10735, -12980,
+     15369,  -7482,  16991, -32557,  21102,   6032,  22691,  15081,
+    -28035, -17801, -20441,   9610, -25326, -23486,  13162, -12138,
+    -31293,  16644, -23315,  27768, -25502,    363,   6463, -12015,
+      1733,  19326,  32205,  26595, -19428, -22446, -14564, -32136,
+     -2229,  18095,   2538, -20292, -18569,  12132,   4213,  28830,
+    -10442,  -4922, -26051,  29123, -28344, -15604,  -4410,  17769,
+    -10970,   1088,  19390,  29491,   5200,  -7557,  31080,  14250,
+      7253,  -1803,  21844, -30872,  -6687, -11252,   7615,   4661,
+      9829, -29139,  12639,  20953, -31325, -14767, -12618,  21833,
+    -19497,  18724, -13231, -12228,  32627,   3264,  -7365,  22937,
+     15599, -22670,  27704, -22787,  21758,  -5408,     -5, -27080,
+    -20062,  31779,  22846,  13983,  29486, -21881, -27619,  -2677,
+    -28440,  21236,  27683,    -37,   7045,  -9365,  25843,  28851,
+     32344,   9791, -22094,   3274, -18740,  -2474,  17577,  -2826,
+      -261, -16223,    -16, -15705,   5349,  29800,   3002, -23587,
+     22921,   -107, -17321,  -8031, -19785,  -1829,  17513,   -112,
+     21134, -28094,  11994,  21017,  31496,  29374,   -747,   9823,
+      9317,  -7423, -12804,  -8479,   -784,  16868,    -48,  18420,
+     16047,  23865,   9007,  -5226,   3226,   -320,  13572, -24094,
+      6181,  -5488, -12996,   -336,  -2133, -18745, -29555,  -2485,
+     28952,  22585,  -2240,  29470,  27950, -22270,  27123, -25438,
+     -2352, -14932,   -144, -10276, -17396,   6058,  27022, -15679,
+      9679,   -960, -24819,  -6746,  18542, -16463,  26547,  -1008,
+     -6399,   9301, -23129,  -7455,  21321,   2218,  -6719,  22873,
+     18313,  -1275,  15833, -10778,  -7055,  20740,   -432, -30829,
+     13348,  18175,  15529,  18500,  29038,  -2880,  -8922, -20238,
+     -9909,  16148,  14106,  -3024, -19198,  27902,  -3850, -22366,
+     -1573,   6655, -20158,   3082, -10596,  -3824, -18036, -32333,
+    -21166,  -3317,  -1296, -26952, -25491, -11012, -18948, -10037,
+     21577,  -8639, -26766,   4821, -29726, -17092, -23219,  -9071,
+      7941,  18169, -11551,  -1563,  -4720,  19966,   5061,   9247,
+    -31789, -11471,  11428, -31464,   2037,  -9951,  -3888, -15321,
+    -10938,  32499,   8693, -30110,   -805, -25918, -14761,  14463,
+    -23641,  14260,  -4122, -27214,  23822, -11028,  30883,  -4688,
+    -14159,  -5637,  15183,  27742, -29832,  31123, -31251, -28856,
+      6112, -29854, -11663,  19572,  32723,  31960,  26078, -24793,
+     -2416, -12218,  21252, -22148,  -5386, -22755, -12367, -16105,
+      5930,  32451,  27112, -14063,  23059, -16911, -19988,  17689,
+    -23961,  27832, -28216, -21033,  18335, -24025,  30547,  -6821,
+     32632,  30344,  12698,  -8842,  -7247,  28883,  -1781,   -907,
+    -16159,  -2730,  28435,  17220,  17791,  31816,  15801,  23347,
+      3642,  14804,   5573, -12468,  -6346,  17961, -19113,   2437,
+    -10532,  -6538,  26105, -20462,  32360,  25497, -27443, -26526,
+    -21742,  21113,  -5344,  -2720,  17060,  -8191,  19769, -13876,
+    -12164,  29912, -18132,   4506,  10927, -21124,  16719,  28131,
+    -19038, -11652,   8197,   7311, -31597, -19614,  12778,   4149,
+     31544,  10954, -16793, -14042,    309,  -2197, -16031,  -8159,
+    -14356, -24574,  -6229,  23907,  29043,  24201,  11140,  13519,
+    -32755,   2165, -15380,  18857,   8421,  30579,  24590,  21934,
+    -29256,   6693, -27203,  12447,  29096, -32675,  15156,  23411,
+       928,  -6591,  17444, -24478,  22468,  -8186, -18686,   6186,
+     21593,   7066, -32115, -24979, -32728,   6495,  19396,  -8965,
+     25262,  26201,   8234,    267, -22233,  20078, -16073, -28195,
+     21753, -32488, -20068,   4698,   2784, -19774, -13204,  -7898,
+      1867, -24558,   9477,  18558,   -757,  21198, -30808,  -9402,
+    -32648,  19486,  -7349, -26894,  10250,  13066,  24702,    800,
+     -1163,  -5301,  17316, -19049,   -277, -31928,   5333,  14095,
+      8351,   6213,  25923, -23694,   5600,  -8138,  28430,  -9861,
+     -2272,  -1941, -26888, -28206, -32408,  -7077, -22046, -15145,
+     30749, -26339,   8570,   2400,  -3488, -15903, -13588,   8389,
+      -832, -30248,  15999, -23251,  25054,  18638,  12234,  -5546,
+     16799, -24414,  19753, -29582,  -6815,  -5824, -15129, -19081,
+    -31688, -21230,   -603,  20100,  26712, -13482,  25710,   7199,
+    -10463,  17828,  24771,  25166,  -2496, -25209, -17540,  -4218,
+      9626,  -9621, -28835, -16639, -15140,  -7706,  -6277, -23209,
+    -20446, -17471,  20148,   8293, -29528,   1845,  -1808,  -5237,
+     14601,  25091,  11594,  21598, -31389, -12052,   8778,   9962,
+     -7487, -10090,  12916, -12655,  28878, -28862, -20969,  15620,
+     20116, -23118, -18830,  -4090,   4197,  13124,  -5093,  24878,
+    -23049,   5536,  -5424, -15711, -21732,   9738, -30755,   -741,
+    -28632,  29379,  26334,  29886, -22462, -30270, -26787,  27571,
+     21097, -21049,   2629, -18676,  -5189,  -3818,   9045, -12271,
+     12591, -26163, -15279,   9098,  -3610,  16607, -16271,  18404,
+};
+
+const int16_t ntt_mont1024_omega_powers[2048] = {
+        0,  4091,  4091,  4401,  4091, -1081,  4401, -1229,
+     4091,  6014, -1081, -5329,  4401, -2530, -1229, -4342,
+     4091, -5825,  6014, -1591, -1081, -4751, -5329, -5266,
+     4401,  -586, -2530, -5890, -1229,  2579, -4342,  2812,
+     4091, -1688, -5825,  5882,  6014, -1364, -1591, -5847,
+    -1081, -4189, -4751,  1711, -5329,  3109, -5266,  4615,
+     4401, -1885,  -586, -1134, -2530, -1960, -5890,  3743,
+    -1229, -1875,  2579,  -965, -4342,  2125,  2812,  5190,
+     4091, -4426, -1688,   117, -5825, -5981,  5882,  5664,
+     6014, -1538, -1364,  4783, -1591, -3872, -5847,  3412,
+    -1081, -1534, -4189,  6049, -4751,  3569,  1711,  5145,
+    -5329,   100,  3109, -5217, -5266,  1690,  4615, -5831,
+     4401,  3983, -1885,   997,  -586,  2181, -1134, -4042,
+    -2530, -1237, -1960, -4407, -5890,   -14,  3743, -4431,
+    -1229,  4679, -1875,    79,  2579, -5719,  -965,  2564,
+    -4342,   432,  2125,  1549,  2812,  4843,  5190,  2829,
+     4091, -3269, -4426, -4673, -1688,  3782,   117,  1820,
+    -5825,  4970, -5981, -1553,  5882,    13,  5664, -6109,
+     6014, -2030, -1538,  2019, -1364, -3467,  4783,  6130,
+    -1591,  2560, -3872, -1517, -5847,  -834,  3412,  5285,
+    -1081, -5892, -1534, -4746, -4189,  3110,  6049, -2851,
+    -4751,  1195,  3569,   900,  1711,  3403,  5145,  2203,
+    -5329,  1762,   100,  2921,  3109,  4668, -5217, -3323,
+    -5266,  2742,  1690, -1020,  4615, -4676, -5831, -3316,
+     4401, -5274,  3983, -4949, -1885,  2083,   997,   489,
+     -586,  1808,  2181,  1156, -1134, -5351, -4042, -2796,
+    -2530, -3854, -1237,  -126, -1960, -3180, -4407, -3012,
+    -5890,  1228,   -14,  5244,  3743, -4586, -4431,   711,
+    -1229, -1367,  4679, -2315, -1875,  3604,    79, -1502,
+     2579, -2211, -5719,  3888,  -965, -5453,  2564,  1652,
+    -4342,   730,   432, -5569,  2125, -2446,  1549,   883,
+     2812,    48,  4843,  2967,  5190,  2903,  2829, -1053,
+     4091, -5064, -3269,  -943, -4426,   351, -4673,  5460,
+    -1688, -5186,  3782,  2621,   117, -5654,  1820, -4659,
+    -5825,  5357,  4970,    39, -5981,  4703, -1553, -6038,
+     5882,  5753,    13, -6090,  5664, -4614, -6109,  6057,
+     6014, -4092, -2030,  1888, -1538,  2060,  2019,  6101,
+    -1364, -4773, -3467, -4609,  4783,   673,  6130, -4551,
+    -1591, -5252,  2560, -2502, -3872, -2053, -1517,  3566,
+    -5847, -3243,  -834, -5387,  3412, -4602,  5285, -1949,
+    -1081,  -278, -5892, -2959, -1534,  5858, -4746,  3736,
+    -4189, -1964,  3110,  3585,  6049, -1582, -2851,  2700,
+    -4751,  5133,  1195, -2080,  3569,  3146,   900, -5680,
+     1711, -3698,  3403,  5286,  5145,   300,  2203, -3526,
+    -5329, -2962,  1762,  1715,   100, -3362,  2921,  2320,
+     3109, -3509,  4668, -4063, -5217,  5070, -3323, -3060,
+    -5266,  1556,  2742, -1739,  1690, -5204, -1020,  2341,
+     4615,   914, -4676, -3533, -5831,  -340, -3316, -2558,
+     4401, -5655, -5274, -6040,  3983,  2991, -4949,  1467,
+    -1885, -1758,  2083,  5424,   997, -5746,   489,  3468,
+     -586, -3402,  1808, -3764,  2181,   163,  1156,  3901,
+    -1134,  4699, -5351,   727, -4042, -3711, -2796,  -378,
+    -2530, -5880, -3854,  2749, -1237,  -932,  -126,  3253,
+    -1960, -5381, -3180,  3684, -4407,   -42, -3012,  3443,
+    -5890, -1060,  1228, -1469,   -14, -1004,  5244,  2133,
+     3743, -3687, -4586, -4101, -4431,  1748,   711,  5344,
+    -1229, -5625, -1367, -1477,  4679,   237, -2315, -4506,
+    -1875, -4552,  3604,  5656,    79, -4868, -1502,  -625,
+     2579, -2895, -2211, -4070, -5719, -4597,  3888,  4956,
+     -965,  -737, -5453,  2190,  2564,  1296,  1652, -4418,
+    -4342, -5914,   730,  4951,   432,  4647, -5569,  2649,
+     2125, -3853, -2446,   144,  1549,  2240,   883, -3388,
+     2812,  3281,    48, -3580,  4843, -3802,  2967, -3159,
+     5190,    16,  2903, -2482,  2829,   989, -1053,  1730,
+     4091, -2818, -5064,  3311, -3269,  3955,  -943,   983,
+    -4426,  5539,   351,  5733, -4673,  5601,  5460,  3157,
+    -1688,  5200, -5186, -2778,  3782,  4424,  2621, -2250,
+      117,  1911, -5654,  1867,  1820, -3044, -4659, -2363,
+    -5825,  -926,  5357,  5571,  4970,  -750,    39,   637,
+    -5981, -3474,  4703, -5111, -1553, -4884, -6038, -4405,
+     5882,  1857,  5753,  -250,    13, -3884, -6090, -1158,
+     5664, -5800, -4614, -1628, -6109,  2628,  6057,   619,
+     6014,  4013, -4092, -5391, -2030,  -386,  1888,  2163,
+    -1538, -4639,  2060,   876,  2019, -3890,  6101,  5434,
+    -1364, -1797, -4773, -4225, -3467,   721, -4609,  2550,
+     4783,   292,   673, -5393,  6130, -2285, -4551,  -599,
+    -1591,  2688, -5252, -3856,  2560,   850, -2502, -3999,
+    -3872, -5894, -2053, -4858, -1517, -4296,  3566,   896,
+    -5847,  2811, -3243, -3813,  -834, -1333, -5387, -6061,
+     3412,  2477, -4602, -1432,  5285,  4395, -1949,   937,
+    -1081, -1271,  -278,  3652, -5892,  2076, -2959,  4922,
+    -1534,  3619,  5858,  1465, -4746, -3784,  3736, -4520,
+    -4189, -2879, -1964,   692,  3110,  5737,  3585, -2890,
+     6049, -3608, -1582,  2835, -2851, -5603,  2700, -5056,
+    -4751,  4327,  5133, -2184,  1195,  3133, -2080, -5299,
+     3569,   945,  3146, -5964,   900,  2411, -5680, -2654,
+     1711,  -728, -3698, -3052,  3403,  2330,  5286,   315,
+     5145, -1988,   300,  4900,  2203, -4981, -3526, -4339,
+    -5329,  3079, -2962,  4873,  1762,   105,  1715, -4759,
+      100, -2463, -3362,  2436,  2921,  2650,  2320, -3070,
+     3109, -2472, -3509,    35,  4668,  2510, -4063,  -821,
+    -5217,   812,  5070, -3213, -3323,  3073, -3060,  -824,
+    -5266,  4108,  1556,  4933,  2742, -4370, -1739,  4367,
+     1690, -1071, -5204, -3072, -1020, -4371,  2341, -2727,
+     4615, -2452,   914, -5553, -4676,  5552, -3533,  -357,
+    -5831, -1024,  -340, -1457, -3316,  -909, -2558,  3279,
+     4401, -1851, -5655,  5947, -5274,  -119, -6040,  3755,
+     3983, -4582,  2991,  -303, -4949,  1093,  1467,  -617,
+    -1885, -2114, -1758, -4136,  2083,  5348,  5424,  2569,
+      997,  -101, -5746, -3732,   489, -4302,  3468, -4801,
+     -586, -5475, -3402,  5879,  1808, -3240, -3764, -4130,
+     2181, -1244,   163, -1434,  1156,  2496,  3901, -1825,
+    -1134,  6056,  4699, -1080, -5351, -5473,   727, -4511,
+    -4042,  -478, -3711,   832, -2796,  3488,  -378,  6115,
+    -2530,  -360, -5880,  2272, -3854, -5600,  2749,  3937,
+    -1237, -3819,  -932,  5259,  -126, -2058,  3253,  -120,
+    -1960, -3339, -5381, -5963, -3180, -2784,  3684, -1273,
+    -4407,  1753,   -42,  -686, -3012,   -40,  3443, -1113,
+    -5890, -6084, -1060,  -928,  1228,  3672, -1469, -3512,
+      -14, -4325, -1004,  4083,  5244,  -371,  2133, -2028,
+     3743,  3787, -3687,  1224, -4586, -5267, -4101, -5538,
+    -4431,  1361,  1748, -4220,   711,  -676,  5344, -2834,
+    -1229,   408, -5625, -5852, -1367, -1846, -1477,  4550,
+     4679, -5503,   237,  3871, -2315, -5041, -4506,   136,
+    -1875, -6047, -4552,  3481,  3604,  5613,  5656,  2262,
+       79, -2806, -4868,  2416, -1502, -4051,  -625, -6112,
+     2579, -2936, -2895,  1871, -2211,   754, -4070,  3161,
+    -5719, -3291, -4597,  2746,  3888,  2059,  4956, -5075,
+     -965,  4720,  -737, -3845, -5453,  5150,  2190, -1097,
+     2564, -3181,  1296, -3410,  1652, -5788, -4418, -2523,
+    -4342, -5378, -5914,  5813,   730, -4462,  4951,  3036,
+      432, -5233,  4647,  2167, -5569,  -841,  2649, -5889,
+     2125,  6034, -3853,  2609, -2446,  1012,   144,  2352,
+     1549, -3374,  2240,  3816,   883, -1963, -3388, -2085,
+     2812,  4966,  3281, -3759,    48,   784, -3580, -5221,
+     4843,  1272, -3802,  3442,  2967,  -695, -3159, -2441,
+     5190, -1253,    16, -3835,  2903,  2356, -2482,   424,
+     2829, -2949,   989, -4328, -1053, -4910,  1730, -4514,
+    // Montgomery companions
+         0,     -5,     -5,  -7887,     -5, -21561,  -7887,  27443,
+        -5,  30590, -21561,   6959,  -7887,  22046,  27443,   3850,
+        -5,   6463,  30590,  18889, -21561, -17039,   6959,  19310,
+     -7887,  -8778,  22046,  18686,  27443,  31251,   3850, -13572,
+        -5,  31080,   6463,  14074,  30590, -17748,  18889,  14633,
+    -21561,  24483, -17039,  13999,   6959,   7205,  19310, -15865,
+     -7887,  26787,  -8778, -25710,  22046,  30808,  18686,  16031,
+     27443, -30547,  31251,  -5061,   3850, -26547, -13572,  -3002,
+        -5, -12618,  31080,   4213,   6463,  22691,  14074,   5664,
+     30590,  23038, -17748,  17071,  18889,  -3872,  14633,  19796,
+    -21561, -26110,  24483,  -6239, -17039,  -8719,  13999,  25625,
+      6959,  16484,   7205,   7071,  19310,   9882, -15865,  14649,
+     -7887,  16271,  26787,   5093,  -8778,   6277, -25710, -12234,
+     22046,  -5333,  30808,  16073,  18686, -24590,  16031, -16719,
+     27443, -15801, -30547,  12367,  31251,  14761,  -5061,  18948,
+      3850,    432, -26547, -27123, -13572,    747,  -3002, -25843,
+        -5,  -7365, -12618,   7615,  31080,  -4410,   4213, -14564,
+      6463,  13162,  22691,  10735,  14074, -28659,   5664,  22563,
+     30590, -26606,  23038,  30691, -17748,    629,  17071, -18446,
+     18889,   2560,  -3872,  27155,  14633,  23742,  19796,   9381,
+    -21561, -22276, -26110, -12938,  24483,  -5082,  -6239, -31523,
+    -17039,  -2901,  -8719,  17284,  13999,   -693,  25625,  -1893,
+      6959, -22814,  16484,  23401,   7205, -11716,   7071,    773,
+     19310,  -5450,   9882,  15364, -15865, -21060,  14649, -19700,
+     -7887, -13466,  16271,  -9045,  26787,  30755,   5093,  20969,
+     -8778,   1808,   6277,  17540, -25710,  15129, -12234,  13588,
+     22046, -28430,  -5333, -24702,  30808,  13204,  16073, -19396,
+     18686, -15156, -24590, -11140,  16031, -12778, -16719, -19769,
+     27443,  19113, -15801,   1781, -30547,  19988,  12367, -26078,
+     31251, -30883,  14761,   3888,  -5061,  23219,  18948,  18036,
+      3850,   8922,    432,   6719, -26547, -27022, -27123,  29555,
+    -13572,     48,    747, -17513,  -3002, -17577, -25843,  27619,
+        -5,  27704,  -7365, -13231, -12618,  12639,   7615,  21844,
+     31080,  19390,  -4410, -26051,   4213,   2538, -14564,  32205,
+      6463, -23315,  13162, -20441,  22691,  16991,  10735,   2154,
+     14074,  26233, -28659, -14282,   5664,   3578,  22563,  26537,
+     30590,  12292, -26606,   1888,  23038, -14324,  30691,  10197,
+    -17748,  -8869,    629,   7679,  17071, -11615, -18446,  15929,
+     18889, -21636,   2560,   5690,  -3872,  -6149,  27155,  28142,
+     14633,    853,  23742,  -1291,  19796, -12794,   9381,  26723,
+    -21561,   7914, -22276, -15247, -26110, -18718, -12938, -29032,
+     24483,  14420,  -5082,  -8703,  -6239, -26158, -31523, -13684,
+    -17039, -23539,  -2901,  -2080,  -8719,  11338,  17284,  -5680,
+     13999,  20878,   -693,  -2906,  25625, -16084,  -1893,   4666,
+      6959,  21614, -22814,  30387,  16484,  21214,  23401,   2320,
+      7205,  -7605, -11716, -16351,   7071,  29646,    773, -19444,
+     19310,  17940,  -5450,   2357,   9882, -21588,  15364,   6437,
+    -15865, -23662, -21060,  25139,  14649, -16724, -19700, -27134,
+     -7887,  14825, -13466,  26728,  16271,  15279,  -9045,  -2629,
+     26787, -26334,  30755,   5424,   5093,  18830,  20969, -12916,
+     -8778, -11594,   1808, -20148,   6277,  28835,  17540, -24771,
+    -25710,    603,  15129, -19753, -12234, -15999,  13588,  -8570,
+     22046,  26888, -28430, -25923,  -5333, -17316, -24702,   7349,
+     30808,  -9477,  13204,  20068,  16073,  -8234, -19396,  32115,
+     18686, -17444, -15156,  27203, -24590,  15380, -11140,   6229,
+     16031,  16793, -12778,  -8197, -16719,  18132, -19769,   5344,
+     27443, -26105,  19113,  -5573, -15801, -28435,   1781, -12698,
+    -30547,  28216,  19988, -27112,  12367, -21252, -26078,  11663,
+     31251, -15183, -30883,   4122,  14761,  -8693,   3888, -11428,
+     -5061,  11551,  23219,  26766,  18948,   1296,  18036,  20158,
+      3850, -14106,   8922, -15529,    432, -15833,   6719,  23129,
+    -26547,  24819, -27022,    144, -27123,   2240,  29555,  12996,
+    -13572,  -9007,     48,  12804,    747, -11994, -17513,  17321,
+     -3002,     16, -17577,  22094, -25843, -27683,  27619, -22846,
+        -5,  21758,  27704,  15599,  -7365,  32627, -13231, -19497,
+    -12618, -31325,  12639,   9829,   7615,  -6687,  21844,   7253,
+     31080,   5200,  19390, -10970,  -4410, -28344, -26051, -10442,
+      4213, -18569,   2538,  -2229, -14564, -19428,  32205,   1733,
+      6463, -25502, -23315, -31293,  13162, -25326, -20441, -28035,
+     22691,  21102,  16991,  15369,  10735, -21268,   2154,  -8501,
+     14074, -10431,  26233,  -8442, -28659,  12500, -14282,   7034,
+      5664,  26968,   3578,  14756,  22563,  19012,  26537,  -3477,
+     30590, -24659,  12292, -17679, -26606,  24190,   1888,  30835,
+     23038, -16927, -14324, -15508,  30691,  20686,  10197,  13626,
+    -17748,  -5893,  -8869,   8063,    629, -11567,   7679,  -5642,
+     17071,  16676, -11615,   6895, -18446,  26387,  15929,  19881,
+     18889,   2688, -21636,  -3856,   2560, -23726,   5690, -16287,
+     -3872,   2298,  -6149, -13050,  27155,  28472,  28142,    896,
+     14633,  -1285,    853,  -7909,  23742,  -5429,  -1291,  22611,
+     19796, -26195, -12794,  31336,   9381,    299,  26723,  21417,
+    -21561,  19209,   7914,  20036, -22276, -14308, -15247,  13114,
+    -26110,  32291, -18718,  21945, -12938,  28984, -29032,  28248,
+     24483, -15167,  14420,  17076,  -5082,  26217,  -8703, -11082,
+     -6239,  29160, -26158,  31507, -31523,  31261, -13684,  -5056,
+    -17039, -16153, -23539,  30584,  -2901, -25539,  -2080,  31565,
+     -8719, -11343,  11338,  10420,  17284,  -1685,  -5680, -27230,
+     13999,  32040,  20878,  13332,   -693,  10522,  -2906,  -3781,
+     25625, -18372, -16084,  21284,  -1893,  -9077,   4666,  32525,
+      6959, -17401,  21614,  25353, -22814,  20585,  30387,  15721,
+     16484, -14751,  21214,  18820,  23401,  10842,   2320, -27646,
+      7205,  30296,  -7605,  28707, -11716,  27086, -16351,  -4917,
+      7071, -15572,  29646,  25459,    773,  -9215, -19444,  31944,
+     19310, -12276,  17940,   9029,  -5450,  20206,   2357,  16655,
+      9882, -13359, -21588,  -3072,  15364,  32493,   6437,  17753,
+    -15865, -18836, -23662,   6735, -21060,   5552,  25139,  -4453,
+     14649,  -1024, -16724,  10831, -19700,  27763, -27134,  15567,
+     -7887,   2245,  14825,   1851, -13466,  20361,  26728,   -341,
+     16271,   3610,  15279, -12591,  -9045,   5189,  -2629, -21097,
+     26787,  22462, -26334,  28632,  30755,  21732,   5424,  23049,
+      5093,  -4197,  18830, -20116,  20969, -28878, -12916,   7487,
+     -8778,  31389, -11594, -14601,   1808,  29528, -20148,  20446,
+      6277,  15140,  28835,  -9626,  17540,   2496, -24771,  10463,
+    -25710, -26712,    603,  31688,  15129,   6815, -19753, -16799,
+    -12234, -25054, -15999,    832,  13588,   3488,  -8570, -30749,
+     22046,  32408,  26888,   2272, -28430,  -5600, -25923,  -8351,
+     -5333,    277, -17316,   1163, -24702, -10250,   7349,  32648,
+     30808,    757,  -9477,  -1867,  13204,  -2784,  20068, -21753,
+     16073,  22233,  -8234, -25262, -19396,  32728,  32115, -21593,
+     18686, -22468, -17444,   -928, -15156, -29096,  27203,  29256,
+    -24590,  -8421,  15380,  32755, -11140, -29043,   6229,  14356,
+     16031,   -309,  16793, -31544, -12778,  31597,  -8197,  19038,
+    -16719, -10927,  18132,  12164, -19769, -17060,   5344,  21742,
+     27443, -32360, -26105,  10532,  19113,   6346,  -5573,  -3642,
+    -15801, -17791, -28435,  16159,   1781,   7247, -12698, -32632,
+    -30547, -18335,  28216,  23961,  19988, -23059, -27112,  -5930,
+     12367,   5386, -21252,   2416, -26078, -32723,  11663,  -6112,
+     31251,  29832, -15183,  14159, -30883, -23822,   4122,  23641,
+     14761,    805,  -8693,  10938,   3888,  -2037, -11428,  31789,
+     -5061,   4720,  11551,  -7941,  23219,  29726,  26766, -21577,
+     18948,  25491,   1296,  21166,  18036,  10596,  20158,   1573,
+      3850,  19198, -14106,   9909,   8922, -29038, -15529, -13348,
+       432,   7055, -15833, -18313,   6719, -21321,  23129,   6399,
+    -26547, -18542,  24819,  -9679, -27022,  17396,    144,   2352,
+    -27123, -27950,   2240, -28952,  29555,   2133,  12996,  -6181,
+    -13572,  -3226,  -9007, -16047,     48,    784,  12804,  -9317,
+       747, -31496, -11994, -21134, -17513,  19785,  17321, -22921,
+     -3002,  -5349,     16,    261, -17577,  18740,  22094, -32344,
+    -25843,  -7045, -27683,  28440,  27619, -29486, -22846,  20062,
+};
+
+const int16_t ntt_mont1024_omega_powers_rev[2048] = {
+        0,  4091,  4091,  4401,  4091,  4401, -1081, -1229,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+    -4426,  3983, -1534,  4679, -1538, -1237,   100,   432,
+    -5981,  2181,  3569, -5719, -3872,   -14,  1690,  4843,
+      117,   997,  6049,    79,  4783, -4407, -5217,  1549,
+     5664, -4042,  5145,  2564,  3412, -4431, -5831,  2829,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+    -4426,  3983, -1534,  4679, -1538, -1237,   100,   432,
+    -5981,  2181,  3569, -5719, -3872,   -14,  1690,  4843,
+      117,   997,  6049,    79,  4783, -4407, -5217,  1549,
+     5664, -4042,  5145,  2564,  3412, -4431, -5831,  2829,
+    -3269, -5274, -5892, -1367, -2030, -3854,  1762,   730,
+     4970,  1808,  1195, -2211,  2560,  1228,  2742,    48,
+     3782,  2083,  3110,  3604, -3467, -3180,  4668, -2446,
+       13, -5351,  3403, -5453,  -834, -4586, -4676,  2903,
+    -4673, -4949, -4746, -2315,  2019,  -126,  2921, -5569,
+    -1553,  1156,   900,  3888, -1517,  5244, -1020,  2967,
+     1820,   489, -2851, -1502,  6130, -3012, -3323,   883,
+    -6109, -2796,  2203,  1652,  5285,   711, -3316, -1053,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+    -4426,  3983, -1534,  4679, -1538, -1237,   100,   432,
+    -5981,  2181,  3569, -5719, -3872,   -14,  1690,  4843,
+      117,   997,  6049,    79,  4783, -4407, -5217,  1549,
+     5664, -4042,  5145,  2564,  3412, -4431, -5831,  2829,
+    -3269, -5274, -5892, -1367, -2030, -3854,  1762,   730,
+     4970,  1808,  1195, -2211,  2560,  1228,  2742,    48,
+     3782,  2083,  3110,  3604, -3467, -3180,  4668, -2446,
+       13, -5351,  3403, -5453,  -834, -4586, -4676,  2903,
+    -4673, -4949, -4746, -2315,  2019,  -126,  2921, -5569,
+    -1553,  1156,   900,  3888, -1517,  5244, -1020,  2967,
+     1820,   489, -2851, -1502,  6130, -3012, -3323,   883,
+    -6109, -2796,  2203,  1652,  5285,   711, -3316, -1053,
+    -5064, -5655,  -278, -5625, -4092, -5880, -2962, -5914,
+     5357, -3402,  5133, -2895, -5252, -1060,  1556,  3281,
+    -5186, -1758, -1964, -4552, -4773, -5381, -3509, -3853,
+     5753,  4699, -3698,  -737, -3243, -3687,   914,    16,
+      351,  2991,  5858,   237,  2060,  -932, -3362,  4647,
+     4703,   163,  3146, -4597, -2053, -1004, -5204, -3802,
+    -5654, -5746, -1582, -4868,   673,   -42,  5070,  2240,
+    -4614, -3711,   300,  1296, -4602,  1748,  -340,   989,
+     -943, -6040, -2959, -1477,  1888,  2749,  1715,  4951,
+       39, -3764, -2080, -4070, -2502, -1469, -1739, -3580,
+     2621,  5424,  3585,  5656, -4609,  3684, -4063,   144,
+    -6090,   727,  5286,  2190, -5387, -4101, -3533, -2482,
+     5460,  1467,  3736, -4506,  6101,  3253,  2320,  2649,
+    -6038,  3901, -5680,  4956,  3566,  2133,  2341, -3159,
+    -4659,  3468,  2700,  -625, -4551,  3443, -3060, -3388,
+     6057,  -378, -3526, -4418, -1949,  5344, -2558,  1730,
+     4091,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+    -4426,  3983, -1534,  4679, -1538, -1237,   100,   432,
+    -5981,  2181,  3569, -5719, -3872,   -14,  1690,  4843,
+      117,   997,  6049,    79,  4783, -4407, -5217,  1549,
+     5664, -4042,  5145,  2564,  3412, -4431, -5831,  2829,
+    -3269, -5274, -5892, -1367, -2030, -3854,  1762,   730,
+     4970,  1808,  1195, -2211,  2560,  1228,  2742,    48,
+     3782,  2083,  3110,  3604, -3467, -3180,  4668, -2446,
+       13, -5351,  3403, -5453,  -834, -4586, -4676,  2903,
+    -4673, -4949, -4746, -2315,  2019,  -126,  2921, -5569,
+    -1553,  1156,   900,  3888, -1517,  5244, -1020,  2967,
+     1820,   489, -2851, -1502,  6130, -3012, -3323,   883,
+    -6109, -2796,  2203,  1652,  5285,   711, -3316, -1053,
+    -5064, -5655,  -278, -5625, -4092, -5880, -2962, -5914,
+     5357, -3402,  5133, -2895, -5252, -1060,  1556,  3281,
+    -5186, -1758, -1964, -4552, -4773, -5381, -3509, -3853,
+     5753,  4699, -3698,  -737, -3243, -3687,   914,    16,
+      351,  2991,  5858,   237,  2060,  -932, -3362,  4647,
+     4703,   163,  3146, -4597, -2053, -1004, -5204, -3802,
+    -5654, -5746, -1582, -4868,   673,   -42,  5070,  2240,
+    -4614, -3711,   300,  1296, -4602,  1748,  -340,   989,
+     -943, -6040, -2959, -1477,  1888,  2749,  1715,  4951,
+       39, -3764, -2080, -4070, -2502, -1469, -1739, -3580,
+     2621,  5424,  3585,  5656, -4609,  3684, -4063,   144,
+    -6090,   727,  5286,  2190, -5387, -4101, -3533, -2482,
+     5460,  1467,  3736, -4506,  6101,  3253,  2320,  2649,
+    -6038,  3901, -5680,  4956,  3566,  2133,  2341, -3159,
+    -4659,  3468,  2700,  -625, -4551,  3443, -3060, -3388,
+     6057,  -378, -3526, -4418, -1949,  5344, -2558,  1730,
+    -2818, -1851, -1271,   408,  4013,  -360,  3079, -5378,
+     -926, -5475,  4327, -2936,  2688, -6084,  4108,  4966,
+     5200, -2114, -2879, -6047, -1797, -3339, -2472,  6034,
+     1857,  6056,  -728,  4720,  2811,  3787, -2452, -1253,
+     5539, -4582,  3619, -5503, -4639, -3819, -2463, -5233,
+    -3474, -1244,   945, -3291, -5894, -4325, -1071,  1272,
+     1911,  -101, -3608, -2806,   292,  1753,   812, -3374,
+    -5800,  -478, -1988, -3181,  2477,  1361, -1024, -2949,
+     3955,  -119,  2076, -1846,  -386, -5600,   105, -4462,
+     -750, -3240,  3133,   754,   850,  3672, -4370,   784,
+     4424,  5348,  5737,  5613,   721, -2784,  2510,  1012,
+    -3884, -5473,  2330,  5150, -1333, -5267,  5552,  2356,
+     5601,  1093, -3784, -5041, -3890, -2058,  2650,  -841,
+    -4884,  2496,  2411,  2059, -4296,  -371, -4371,  -695,
+    -3044, -4302, -5603, -4051, -2285,   -40,  3073, -1963,
+     2628,  3488, -4981, -5788,  4395,  -676,  -909, -4910,
+     3311,  5947,  3652, -5852, -5391,  2272,  4873,  5813,
+     5571,  5879, -2184,  1871, -3856,  -928,  4933, -3759,
+    -2778, -4136,   692,  3481, -4225, -5963,    35,  2609,
+     -250, -1080, -3052, -3845, -3813,  1224, -5553, -3835,
+     5733,  -303,  1465,  3871,   876,  5259,  2436,  2167,
+    -5111, -1434, -5964,  2746, -4858,  4083, -3072,  3442,
+     1867, -3732,  2835,  2416, -5393,  -686, -3213,  3816,
+    -1628,   832,  4900, -3410, -1432, -4220, -1457, -4328,
+      983,  3755,  4922,  4550,  2163,  3937, -4759,  3036,
+      637, -4130, -5299,  3161, -3999, -3512,  4367, -5221,
+    -2250,  2569, -2890,  2262,  2550, -1273,  -821,  2352,
+    -1158, -4511,   315, -1097, -6061, -5538,  -357,   424,
+     3157,  -617, -4520,   136,  5434,  -120, -3070, -5889,
+    -4405, -1825, -2654, -5075,   896, -2028, -2727, -2441,
+    -2363, -4801, -5056, -6112,  -599, -1113,  -824, -2085,
+      619,  6115, -4339, -2523,   937, -2834,  3279, -4514,
+    // Montgomery companions
+         0,     -5,     -5,  -7887,     -5,  -7887, -21561,  27443,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+    -12618,  16271, -26110, -15801,  23038,  -5333,  16484,    432,
+     22691,   6277,  -8719,  14761,  -3872, -24590,   9882,    747,
+      4213,   5093,  -6239,  12367,  17071,  16073,   7071, -27123,
+      5664, -12234,  25625,  18948,  19796, -16719,  14649, -25843,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+    -12618,  16271, -26110, -15801,  23038,  -5333,  16484,    432,
+     22691,   6277,  -8719,  14761,  -3872, -24590,   9882,    747,
+      4213,   5093,  -6239,  12367,  17071,  16073,   7071, -27123,
+      5664, -12234,  25625,  18948,  19796, -16719,  14649, -25843,
+     -7365, -13466, -22276,  19113, -26606, -28430, -22814,   8922,
+     13162,   1808,  -2901, -30883,   2560, -15156,  -5450,     48,
+     -4410,  30755,  -5082,  19988,    629,  13204, -11716, -27022,
+    -28659,  15129,   -693,  23219,  23742, -12778, -21060, -17577,
+      7615,  -9045, -12938,   1781,  30691, -24702,  23401,   6719,
+     10735,  17540,  17284,   3888,  27155, -11140,  15364, -17513,
+    -14564,  20969, -31523, -26078, -18446, -19396,    773,  29555,
+     22563,  13588,  -1893,  18036,   9381, -19769, -19700,  27619,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+    -12618,  16271, -26110, -15801,  23038,  -5333,  16484,    432,
+     22691,   6277,  -8719,  14761,  -3872, -24590,   9882,    747,
+      4213,   5093,  -6239,  12367,  17071,  16073,   7071, -27123,
+      5664, -12234,  25625,  18948,  19796, -16719,  14649, -25843,
+     -7365, -13466, -22276,  19113, -26606, -28430, -22814,   8922,
+     13162,   1808,  -2901, -30883,   2560, -15156,  -5450,     48,
+     -4410,  30755,  -5082,  19988,    629,  13204, -11716, -27022,
+    -28659,  15129,   -693,  23219,  23742, -12778, -21060, -17577,
+      7615,  -9045, -12938,   1781,  30691, -24702,  23401,   6719,
+     10735,  17540,  17284,   3888,  27155, -11140,  15364, -17513,
+    -14564,  20969, -31523, -26078, -18446, -19396,    773,  29555,
+     22563,  13588,  -1893,  18036,   9381, -19769, -19700,  27619,
+     27704,  14825,   7914, -26105,  12292,  26888,  21614, -14106,
+    -23315, -11594, -23539, -15183, -21636, -17444,  17940,  -9007,
+     19390, -26334,  14420,  28216,  -8869,  -9477,  -7605,  24819,
+     26233,    603,  20878,  11551,    853,  16793, -23662,     16,
+     12639,  15279, -18718, -28435, -14324, -17316,  21214, -15833,
+     16991,  28835,  11338,  -8693,  -6149,  15380, -21588, -11994,
+      2538,  18830, -26158, -21252, -11615,  -8234,  29646,   2240,
+      3578, -15999, -16084,   1296, -12794,  18132, -16724, -27683,
+    -13231,  26728, -15247,  -5573,   1888, -25923,  30387, -15529,
+    -20441, -20148,  -2080,   4122,   5690,  27203,   2357,  12804,
+    -26051,   5424,  -8703, -27112,   7679,  20068, -16351,    144,
+    -14282, -19753,  -2906,  26766,  -1291,  -8197,  25139,  22094,
+     21844,  -2629, -29032, -12698,  10197,   7349,   2320,  23129,
+      2154, -24771,  -5680, -11428,  28142,   6229,   6437,  17321,
+     32205, -12916, -13684,  11663,  15929,  32115, -19444,  12996,
+     26537,  -8570,   4666,  20158,  26723,   5344, -27134, -22846,
+        -5,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+    -12618,  16271, -26110, -15801,  23038,  -5333,  16484,    432,
+     22691,   6277,  -8719,  14761,  -3872, -24590,   9882,    747,
+      4213,   5093,  -6239,  12367,  17071,  16073,   7071, -27123,
+      5664, -12234,  25625,  18948,  19796, -16719,  14649, -25843,
+     -7365, -13466, -22276,  19113, -26606, -28430, -22814,   8922,
+     13162,   1808,  -2901, -30883,   2560, -15156,  -5450,     48,
+     -4410,  30755,  -5082,  19988,    629,  13204, -11716, -27022,
+    -28659,  15129,   -693,  23219,  23742, -12778, -21060, -17577,
+      7615,  -9045, -12938,   1781,  30691, -24702,  23401,   6719,
+     10735,  17540,  17284,   3888,  27155, -11140,  15364, -17513,
+    -14564,  20969, -31523, -26078, -18446, -19396,    773,  29555,
+     22563,  13588,  -1893,  18036,   9381, -19769, -19700,  27619,
+     27704,  14825,   7914, -26105,  12292,  26888,  21614, -14106,
+    -23315, -11594, -23539, -15183, -21636, -17444,  17940,  -9007,
+     19390, -26334,  14420,  28216,  -8869,  -9477,  -7605,  24819,
+     26233,    603,  20878,  11551,    853,  16793, -23662,     16,
+     12639,  15279, -18718, -28435, -14324, -17316,  21214, -15833,
+     16991,  28835,  11338,  -8693,  -6149,  15380, -21588, -11994,
+      2538,  18830, -26158, -21252, -11615,  -8234,  29646,   2240,
+      3578, -15999, -16084,   1296, -12794,  18132, -16724, -27683,
+    -13231,  26728, -15247,  -5573,   1888, -25923,  30387, -15529,
+    -20441, -20148,  -2080,   4122,   5690,  27203,   2357,  12804,
+    -26051,   5424,  -8703, -27112,   7679,  20068, -16351,    144,
+    -14282, -19753,  -2906,  26766,  -1291,  -8197,  25139,  22094,
+     21844,  -2629, -29032, -12698,  10197,   7349,   2320,  23129,
+      2154, -24771,  -5680, -11428,  28142,   6229,   6437,  17321,
+     32205, -12916, -13684,  11663,  15929,  32115, -19444,  12996,
+     26537,  -8570,   4666,  20158,  26723,   5344, -27134, -22846,
+     21758,   2245,  19209, -32360, -24659,  32408, -17401,  19198,
+    -25502,  31389, -16153,  29832,   2688, -22468, -12276,  -3226,
+      5200,  22462, -15167, -18335,  -5893,    757,  30296, -18542,
+    -10431, -26712,  32040,   4720,  -1285,   -309, -18836,  -5349,
+    -31325,   3610,  32291, -17791, -16927,    277, -14751,   7055,
+     21102,  15140, -11343,    805,   2298,  -8421, -13359, -31496,
+    -18569,  -4197,  29160,   5386,  16676,  22233, -15572, -27950,
+     26968, -25054, -18372,  25491, -26195, -10927,  -1024,  -7045,
+     32627,  20361, -14308,   6346,  24190,  -5600,  20585, -29038,
+    -25326,  29528, -25539, -23822, -23726, -29096,  20206,    784,
+    -28344,  21732,  26217, -23059, -11567,  -2784,  27086,  17396,
+     12500,   6815,  10522,  29726,  -5429,  31597,   5552,  18740,
+     -6687,   5189,  28984,   7247,  20686, -10250,  10842, -21321,
+    -21268,   2496,  -1685,  -2037,  28472, -29043,  32493,  19785,
+    -19428, -28878,  31261, -32723,  26387,  32728,  -9215,   2133,
+     19012,   3488,  -9077,  10596,    299, -17060,  27763, -29486,
+     15599,   1851,  20036,  10532, -17679,   2272,  25353,   9909,
+    -31293, -14601,  30584,  14159,  -3856,   -928,   9029, -16047,
+    -10970,  28632,  17076,  23961,   8063,  -1867,  28707,  -9679,
+     -8442,  31688,  13332,  -7941,  -7909, -31544,   6735,    261,
+      9829, -12591,  21945,  16159, -15508,   1163,  18820, -18313,
+     15369,  -9626,  10420,  10938, -13050,  32755,  -3072, -21134,
+     -2229, -20116,  31507,   2416,   6895, -25262,  25459, -28952,
+     14756,    832,  21284,  21166,  31336,  12164,  10831,  28440,
+    -19497,   -341,  13114,  -3642,  30835,  -8351,  15721, -13348,
+    -28035,  20446,  31565,  23641, -16287,  29256,  16655,  -9317,
+    -10442,  23049, -11082,  -5930,  -5642, -21753,  -4917,   2352,
+      7034, -16799,  -3781, -21577,  22611,  19038,  -4453, -32344,
+      7253, -21097,  28248, -32632,  13626,  32648, -27646,   6399,
+     -8501,  10463, -27230,  31789,    896,  14356,  17753, -22921,
+      1733,   7487,  -5056,  -6112,  19881, -21593,  31944,  -6181,
+     -3477, -30749,  32525,   1573,  21417,  21742,  15567,  20062,
+};
+
+const int16_t ntt_mont1024_inv_omega_powers[2048] = {
+        0,  4091,  4091, -4401,  4091,  1229, -4401,  1081,
+     4091,  4342,  1229,  2530, -4401,  5329,  1081, -6014,
+     4091, -2812,  4342, -2579,  1229,  5890,  2530,   586,
+    -4401,  5266,  5329,  4751,  1081,  1591, -6014,  5825,
+     4091, -5190, -2812, -2125,  4342,   965, -2579,  1875,
+     1229, -3743,  5890,  1960,  2530,  1134,   586,  1885,
+    -4401, -4615,  5266, -3109,  5329, -1711,  4751,  4189,
+     1081,  5847,  1591,  1364, -6014, -5882,  5825,  1688,
+     4091, -2829, -5190, -4843, -2812, -1549, -2125,  -432,
+     4342, -2564,   965,  5719, -2579,   -79,  1875, -4679,
+     1229,  4431, -3743,    14,  5890,  4407,  1960,  1237,
+     2530,  4042,  1134, -2181,   586,  -997,  1885, -3983,
+    -4401,  5831, -4615, -1690,  5266,  5217, -3109,  -100,
+     5329, -5145, -1711, -3569,  4751, -6049,  4189,  1534,
+     1081, -3412,  5847,  3872,  1591, -4783,  1364,  1538,
+    -6014, -5664, -5882,  5981,  5825,  -117,  1688,  4426,
+     4091,  1053, -2829, -2903, -5190, -2967, -4843,   -48,
+    -2812,  -883, -1549,  2446, -2125,  5569,  -432,  -730,
+     4342, -1652, -2564,  5453,   965, -3888,  5719,  2211,
+    -2579,  1502,   -79, -3604,  1875,  2315, -4679,  1367,
+     1229,  -711,  4431,  4586, -3743, -5244,    14, -1228,
+     5890,  3012,  4407,  3180,  1960,   126,  1237,  3854,
+     2530,  2796,  4042,  5351,  1134, -1156, -2181, -1808,
+      586,  -489,  -997, -2083,  1885,  4949, -3983,  5274,
+    -4401,  3316,  5831,  4676, -4615,  1020, -1690, -2742,
+     5266,  3323,  5217, -4668, -3109, -2921,  -100, -1762,
+     5329, -2203, -5145, -3403, -1711,  -900, -3569, -1195,
+     4751,  2851, -6049, -3110,  4189,  4746,  1534,  5892,
+     1081, -5285, -3412,   834,  5847,  1517,  3872, -2560,
+     1591, -6130, -4783,  3467,  1364, -2019,  1538,  2030,
+    -6014,  6109, -5664,   -13, -5882,  1553,  5981, -4970,
+     5825, -1820,  -117, -3782,  1688,  4673,  4426,  3269,
+     4091, -1730,  1053,  -989, -2829,  2482, -2903,   -16,
+    -5190,  3159, -2967,  3802, -4843,  3580,   -48, -3281,
+    -2812,  3388,  -883, -2240, -1549,  -144,  2446,  3853,
+    -2125, -2649,  5569, -4647,  -432, -4951,  -730,  5914,
+     4342,  4418, -1652, -1296, -2564, -2190,  5453,   737,
+      965, -4956, -3888,  4597,  5719,  4070,  2211,  2895,
+    -2579,   625,  1502,  4868,   -79, -5656, -3604,  4552,
+     1875,  4506,  2315,  -237, -4679,  1477,  1367,  5625,
+     1229, -5344,  -711, -1748,  4431,  4101,  4586,  3687,
+    -3743, -2133, -5244,  1004,    14,  1469, -1228,  1060,
+     5890, -3443,  3012,    42,  4407, -3684,  3180,  5381,
+     1960, -3253,   126,   932,  1237, -2749,  3854,  5880,
+     2530,   378,  2796,  3711,  4042,  -727,  5351, -4699,
+     1134, -3901, -1156,  -163, -2181,  3764, -1808,  3402,
+      586, -3468,  -489,  5746,  -997, -5424, -2083,  1758,
+     1885, -1467,  4949, -2991, -3983,  6040,  5274,  5655,
+    -4401,  2558,  3316,   340,  5831,  3533,  4676,  -914,
+    -4615, -2341,  1020,  5204, -1690,  1739, -2742, -1556,
+     5266,  3060,  3323, -5070,  5217,  4063, -4668,  3509,
+    -3109, -2320, -2921,  3362,  -100, -1715, -1762,  2962,
+     5329,  3526, -2203,  -300, -5145, -5286, -3403,  3698,
+    -1711,  5680,  -900, -3146, -3569,  2080, -1195, -5133,
+     4751, -2700,  2851,  1582, -6049, -3585, -3110,  1964,
+     4189, -3736,  4746, -5858,  1534,  2959,  5892,   278,
+     1081,  1949, -5285,  4602, -3412,  5387,   834,  3243,
+     5847, -3566,  1517,  2053,  3872,  2502, -2560,  5252,
+     1591,  4551, -6130,  -673, -4783,  4609,  3467,  4773,
+     1364, -6101, -2019, -2060,  1538, -1888,  2030,  4092,
+    -6014, -6057,  6109,  4614, -5664,  6090,   -13, -5753,
+    -5882,  6038,  1553, -4703,  5981,   -39, -4970, -5357,
+     5825,  4659, -1820,  5654,  -117, -2621, -3782,  5186,
+     1688, -5460,  4673,  -351,  4426,   943,  3269,  5064,
+     4091,  4514, -1730,  4910,  1053,  4328,  -989,  2949,
+    -2829,  -424,  2482, -2356, -2903,  3835,   -16,  1253,
+    -5190,  2441,  3159,   695, -2967, -3442,  3802, -1272,
+    -4843,  5221,  3580,  -784,   -48,  3759, -3281, -4966,
+    -2812,  2085,  3388,  1963,  -883, -3816, -2240,  3374,
+    -1549, -2352,  -144, -1012,  2446, -2609,  3853, -6034,
+    -2125,  5889, -2649,   841,  5569, -2167, -4647,  5233,
+     -432, -3036, -4951,  4462,  -730, -5813,  5914,  5378,
+     4342,  2523,  4418,  5788, -1652,  3410, -1296,  3181,
+    -2564,  1097, -2190, -5150,  5453,  3845,   737, -4720,
+      965,  5075, -4956, -2059, -3888, -2746,  4597,  3291,
+     5719, -3161,  4070,  -754,  2211, -1871,  2895,  2936,
+    -2579,  6112,   625,  4051,  1502, -2416,  4868,  2806,
+      -79, -2262, -5656, -5613, -3604, -3481,  4552,  6047,
+     1875,  -136,  4506,  5041,  2315, -3871,  -237,  5503,
+    -4679, -4550,  1477,  1846,  1367,  5852,  5625,  -408,
+     1229,  2834, -5344,   676,  -711,  4220, -1748, -1361,
+     4431,  5538,  4101,  5267,  4586, -1224,  3687, -3787,
+    -3743,  2028, -2133,   371, -5244, -4083,  1004,  4325,
+       14,  3512,  1469, -3672, -1228,   928,  1060,  6084,
+     5890,  1113, -3443,    40,  3012,   686,    42, -1753,
+     4407,  1273, -3684,  2784,  3180,  5963,  5381,  3339,
+     1960,   120, -3253,  2058,   126, -5259,   932,  3819,
+     1237, -3937, -2749,  5600,  3854, -2272,  5880,   360,
+     2530, -6115,   378, -3488,  2796,  -832,  3711,   478,
+     4042,  4511,  -727,  5473,  5351,  1080, -4699, -6056,
+     1134,  1825, -3901, -2496, -1156,  1434,  -163,  1244,
+    -2181,  4130,  3764,  3240, -1808, -5879,  3402,  5475,
+      586,  4801, -3468,  4302,  -489,  3732,  5746,   101,
+     -997, -2569, -5424, -5348, -2083,  4136,  1758,  2114,
+     1885,   617, -1467, -1093,  4949,   303, -2991,  4582,
+    -3983, -3755,  6040,   119,  5274, -5947,  5655,  1851,
+    -4401, -3279,  2558,   909,  3316,  1457,   340,  1024,
+     5831,   357,  3533, -5552,  4676,  5553,  -914,  2452,
+    -4615,  2727, -2341,  4371,  1020,  3072,  5204,  1071,
+    -1690, -4367,  1739,  4370, -2742, -4933, -1556, -4108,
+     5266,   824,  3060, -3073,  3323,  3213, -5070,  -812,
+     5217,   821,  4063, -2510, -4668,   -35,  3509,  2472,
+    -3109,  3070, -2320, -2650, -2921, -2436,  3362,  2463,
+     -100,  4759, -1715,  -105, -1762, -4873,  2962, -3079,
+     5329,  4339,  3526,  4981, -2203, -4900,  -300,  1988,
+    -5145,  -315, -5286, -2330, -3403,  3052,  3698,   728,
+    -1711,  2654,  5680, -2411,  -900,  5964, -3146,  -945,
+    -3569,  5299,  2080, -3133, -1195,  2184, -5133, -4327,
+     4751,  5056, -2700,  5603,  2851, -2835,  1582,  3608,
+    -6049,  2890, -3585, -5737, -3110,  -692,  1964,  2879,
+     4189,  4520, -3736,  3784,  4746, -1465, -5858, -3619,
+     1534, -4922,  2959, -2076,  5892, -3652,   278,  1271,
+     1081,  -937,  1949, -4395, -5285,  1432,  4602, -2477,
+    -3412,  6061,  5387,  1333,   834,  3813,  3243, -2811,
+     5847,  -896, -3566,  4296,  1517,  4858,  2053,  5894,
+     3872,  3999,  2502,  -850, -2560,  3856,  5252, -2688,
+     1591,   599,  4551,  2285, -6130,  5393,  -673,  -292,
+    -4783, -2550,  4609,  -721,  3467,  4225,  4773,  1797,
+     1364, -5434, -6101,  3890, -2019,  -876, -2060,  4639,
+     1538, -2163, -1888,   386,  2030,  5391,  4092, -4013,
+    -6014,  -619, -6057, -2628,  6109,  1628,  4614,  5800,
+    -5664,  1158,  6090,  3884,   -13,   250, -5753, -1857,
+    -5882,  4405,  6038,  4884,  1553,  5111, -4703,  3474,
+     5981,  -637,   -39,   750, -4970, -5571, -5357,   926,
+     5825,  2363,  4659,  3044, -1820, -1867,  5654, -1911,
+     -117,  2250, -2621, -4424, -3782,  2778,  5186, -5200,
+     1688, -3157, -5460, -5601,  4673, -5733,  -351, -5539,
+     4426,  -983,   943, -3955,  3269, -3311,  5064,  2818,
+    // Montgomery companions
+         0,     -5,     -5,   7887,     -5, -27443,   7887,  21561,
+        -5,  -3850, -27443, -22046,   7887,  -6959,  21561, -30590,
+        -5,  13572,  -3850, -31251, -27443, -18686, -22046,   8778,
+      7887, -19310,  -6959,  17039,  21561, -18889, -30590,  -6463,
+        -5,   3002,  13572,  26547,  -3850,   5061, -31251,  30547,
+    -27443, -16031, -18686, -30808, -22046,  25710,   8778, -26787,
+      7887,  15865, -19310,  -7205,  -6959, -13999,  17039, -24483,
+     21561, -14633, -18889,  17748, -30590, -14074,  -6463, -31080,
+        -5,  25843,   3002,   -747,  13572,  27123,  26547,   -432,
+     -3850, -18948,   5061, -14761, -31251, -12367,  30547,  15801,
+    -27443,  16719, -16031,  24590, -18686, -16073, -30808,   5333,
+    -22046,  12234,  25710,  -6277,   8778,  -5093, -26787, -16271,
+      7887, -14649,  15865,  -9882, -19310,  -7071,  -7205, -16484,
+     -6959, -25625, -13999,   8719,  17039,   6239, -24483,  26110,
+     21561, -19796, -14633,   3872, -18889, -17071,  17748, -23038,
+    -30590,  -5664, -14074, -22691,  -6463,  -4213, -31080,  12618,
+        -5, -27619,  25843,  17577,   3002,  17513,   -747,    -48,
+     13572, -29555,  27123,  27022,  26547,  -6719,   -432,  -8922,
+     -3850, -18036, -18948, -23219,   5061,  -3888, -14761,  30883,
+    -31251,  26078, -12367, -19988,  30547,  -1781,  15801, -19113,
+    -27443,  19769,  16719,  12778, -16031,  11140,  24590,  15156,
+    -18686,  19396, -16073, -13204, -30808,  24702,   5333,  28430,
+    -22046, -13588,  12234, -15129,  25710, -17540,  -6277,  -1808,
+      8778, -20969,  -5093, -30755, -26787,   9045, -16271,  13466,
+      7887,  19700, -14649,  21060,  15865, -15364,  -9882,   5450,
+    -19310,   -773,  -7071,  11716,  -7205, -23401, -16484,  22814,
+     -6959,   1893, -25625,    693, -13999, -17284,   8719,   2901,
+     17039,  31523,   6239,   5082, -24483,  12938,  26110,  22276,
+     21561,  -9381, -19796, -23742, -14633, -27155,   3872,  -2560,
+    -18889,  18446, -17071,   -629,  17748, -30691, -23038,  26606,
+    -30590, -22563,  -5664,  28659, -14074, -10735, -22691, -13162,
+     -6463,  14564,  -4213,   4410, -31080,  -7615,  12618,   7365,
+        -5,  22846, -27619,  27683,  25843, -22094,  17577,    -16,
+      3002, -17321,  17513,  11994,   -747, -12804,    -48,   9007,
+     13572, -12996, -29555,  -2240,  27123,   -144,  27022, -24819,
+     26547, -23129,  -6719,  15833,   -432,  15529,  -8922,  14106,
+     -3850, -20158, -18036,  -1296, -18948, -26766, -23219, -11551,
+      5061,  11428,  -3888,   8693, -14761,  -4122,  30883,  15183,
+    -31251, -11663,  26078,  21252, -12367,  27112, -19988, -28216,
+     30547,  12698,  -1781,  28435,  15801,   5573, -19113,  26105,
+    -27443,  -5344,  19769, -18132,  16719,   8197,  12778, -16793,
+    -16031,  -6229,  11140, -15380,  24590, -27203,  15156,  17444,
+    -18686, -32115,  19396,   8234, -16073, -20068, -13204,   9477,
+    -30808,  -7349,  24702,  17316,   5333,  25923,  28430, -26888,
+    -22046,   8570, -13588,  15999,  12234,  19753, -15129,   -603,
+     25710,  24771, -17540, -28835,  -6277,  20148,  -1808,  11594,
+      8778,  12916, -20969, -18830,  -5093,  -5424, -30755,  26334,
+    -26787,   2629,   9045, -15279, -16271, -26728,  13466, -14825,
+      7887,  27134,  19700,  16724, -14649, -25139,  21060,  23662,
+     15865,  -6437, -15364,  21588,  -9882,  -2357,   5450, -17940,
+    -19310,  19444,   -773, -29646,  -7071,  16351,  11716,   7605,
+     -7205,  -2320, -23401, -21214, -16484, -30387,  22814, -21614,
+     -6959,  -4666,   1893,  16084, -25625,   2906,    693, -20878,
+    -13999,   5680, -17284, -11338,   8719,   2080,   2901,  23539,
+     17039,  13684,  31523,  26158,   6239,   8703,   5082, -14420,
+    -24483,  29032,  12938,  18718,  26110,  15247,  22276,  -7914,
+     21561, -26723,  -9381,  12794, -19796,   1291, -23742,   -853,
+    -14633, -28142, -27155,   6149,   3872,  -5690,  -2560,  21636,
+    -18889, -15929,  18446,  11615, -17071,  -7679,   -629,   8869,
+     17748, -10197, -30691,  14324, -23038,  -1888,  26606, -12292,
+    -30590, -26537, -22563,  -3578,  -5664,  14282,  28659, -26233,
+    -14074,  -2154, -10735, -16991, -22691,  20441, -13162,  23315,
+     -6463, -32205,  14564,  -2538,  -4213,  26051,   4410, -19390,
+    -31080, -21844,  -7615, -12639,  12618,  13231,   7365, -27704,
+        -5, -20062,  22846,  29486, -27619, -28440,  27683,   7045,
+     25843,  32344, -22094, -18740,  17577,   -261,    -16,   5349,
+      3002,  22921, -17321, -19785,  17513,  21134,  11994,  31496,
+      -747,   9317, -12804,   -784,    -48,  16047,   9007,   3226,
+     13572,   6181, -12996,  -2133, -29555,  28952,  -2240,  27950,
+     27123,  -2352,   -144, -17396,  27022,   9679, -24819,  18542,
+     26547,  -6399, -23129,  21321,  -6719,  18313,  15833,  -7055,
+      -432,  13348,  15529,  29038,  -8922,  -9909,  14106, -19198,
+     -3850,  -1573, -20158, -10596, -18036, -21166,  -1296, -25491,
+    -18948,  21577, -26766, -29726, -23219,   7941, -11551,  -4720,
+      5061, -31789,  11428,   2037,  -3888, -10938,   8693,   -805,
+    -14761, -23641,  -4122,  23822,  30883, -14159,  15183, -29832,
+    -31251,   6112, -11663,  32723,  26078,  -2416,  21252,  -5386,
+    -12367,   5930,  27112,  23059, -19988, -23961, -28216,  18335,
+     30547,  32632,  12698,  -7247,  -1781, -16159,  28435,  17791,
+     15801,   3642,   5573,  -6346, -19113, -10532,  26105,  32360,
+    -27443, -21742,  -5344,  17060,  19769, -12164, -18132,  10927,
+     16719, -19038,   8197, -31597,  12778,  31544, -16793,    309,
+    -16031, -14356,  -6229,  29043,  11140, -32755, -15380,   8421,
+     24590, -29256, -27203,  29096,  15156,    928,  17444,  22468,
+    -18686,  21593, -32115, -32728,  19396,  25262,   8234, -22233,
+    -16073,  21753, -20068,   2784, -13204,   1867,   9477,   -757,
+    -30808, -32648,  -7349,  10250,  24702,  -1163,  17316,   -277,
+      5333,   8351,  25923,   5600,  28430,  -2272, -26888, -32408,
+    -22046,  30749,   8570,  -3488, -13588,   -832,  15999,  25054,
+     12234,  16799,  19753,  -6815, -15129, -31688,   -603,  26712,
+     25710, -10463,  24771,  -2496, -17540,   9626, -28835, -15140,
+     -6277, -20446,  20148, -29528,  -1808,  14601,  11594, -31389,
+      8778,  -7487,  12916,  28878, -20969,  20116, -18830,   4197,
+     -5093, -23049,  -5424, -21732, -30755, -28632,  26334, -22462,
+    -26787,  21097,   2629,  -5189,   9045,  12591, -15279,  -3610,
+    -16271,    341, -26728, -20361,  13466,  -1851, -14825,  -2245,
+      7887, -15567,  27134, -27763,  19700, -10831,  16724,   1024,
+    -14649,   4453, -25139,  -5552,  21060,  -6735,  23662,  18836,
+     15865, -17753,  -6437, -32493, -15364,   3072,  21588,  13359,
+     -9882, -16655,  -2357, -20206,   5450,  -9029, -17940,  12276,
+    -19310, -31944,  19444,   9215,   -773, -25459, -29646,  15572,
+     -7071,   4917,  16351, -27086,  11716, -28707,   7605, -30296,
+     -7205,  27646,  -2320, -10842, -23401, -18820, -21214,  14751,
+    -16484, -15721, -30387, -20585,  22814, -25353, -21614,  17401,
+     -6959, -32525,  -4666,   9077,   1893, -21284,  16084,  18372,
+    -25625,   3781,   2906, -10522,    693, -13332, -20878, -32040,
+    -13999,  27230,   5680,   1685, -17284, -10420, -11338,  11343,
+      8719, -31565,   2080,  25539,   2901, -30584,  23539,  16153,
+     17039,   5056,  13684, -31261,  31523, -31507,  26158, -29160,
+      6239,  11082,   8703, -26217,   5082, -17076, -14420,  15167,
+    -24483, -28248,  29032, -28984,  12938, -21945,  18718, -32291,
+     26110, -13114,  15247,  14308,  22276, -20036,  -7914, -19209,
+     21561, -21417, -26723,   -299,  -9381, -31336,  12794,  26195,
+    -19796, -22611,   1291,   5429, -23742,   7909,   -853,   1285,
+    -14633,   -896, -28142, -28472, -27155,  13050,   6149,  -2298,
+      3872,  16287,  -5690,  23726,  -2560,   3856,  21636,  -2688,
+    -18889, -19881, -15929, -26387,  18446,  -6895,  11615, -16676,
+    -17071,   5642,  -7679,  11567,   -629,  -8063,   8869,   5893,
+     17748, -13626, -10197, -20686, -30691,  15508,  14324,  16927,
+    -23038, -30835,  -1888, -24190,  26606,  17679, -12292,  24659,
+    -30590,   3477, -26537, -19012, -22563, -14756,  -3578, -26968,
+     -5664,  -7034,  14282, -12500,  28659,   8442, -26233,  10431,
+    -14074,   8501,  -2154,  21268, -10735, -15369, -16991, -21102,
+    -22691,  28035,  20441,  25326, -13162,  31293,  23315,  25502,
+     -6463,  -1733, -32205,  19428,  14564,   2229,  -2538,  18569,
+     -4213,  10442,  26051,  28344,   4410,  10970, -19390,  -5200,
+    -31080,  -7253, -21844,   6687,  -7615,  -9829, -12639,  31325,
+     12618,  19497,  13231, -32627,   7365, -15599, -27704, -21758,
+};
+
+const int16_t ntt_mont1024_inv_omega_powers_rev[2048] = {
+        0,  4091,  4091, -4401,  4091, -4401,  1229,  1081,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+    -2829,  5831,  4431, -3412, -2564, -5145,  4042, -5664,
+    -1549,  5217,  4407, -4783,   -79, -6049,  -997,  -117,
+    -4843, -1690,    14,  3872,  5719, -3569, -2181,  5981,
+     -432,  -100,  1237,  1538, -4679,  1534, -3983,  4426,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+    -2829,  5831,  4431, -3412, -2564, -5145,  4042, -5664,
+    -1549,  5217,  4407, -4783,   -79, -6049,  -997,  -117,
+    -4843, -1690,    14,  3872,  5719, -3569, -2181,  5981,
+     -432,  -100,  1237,  1538, -4679,  1534, -3983,  4426,
+     1053,  3316,  -711, -5285, -1652, -2203,  2796,  6109,
+     -883,  3323,  3012, -6130,  1502,  2851,  -489, -1820,
+    -2967,  1020, -5244,  1517, -3888,  -900, -1156,  1553,
+     5569, -2921,   126, -2019,  2315,  4746,  4949,  4673,
+    -2903,  4676,  4586,   834,  5453, -3403,  5351,   -13,
+     2446, -4668,  3180,  3467, -3604, -3110, -2083, -3782,
+      -48, -2742, -1228, -2560,  2211, -1195, -1808, -4970,
+     -730, -1762,  3854,  2030,  1367,  5892,  5274,  3269,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+    -2829,  5831,  4431, -3412, -2564, -5145,  4042, -5664,
+    -1549,  5217,  4407, -4783,   -79, -6049,  -997,  -117,
+    -4843, -1690,    14,  3872,  5719, -3569, -2181,  5981,
+     -432,  -100,  1237,  1538, -4679,  1534, -3983,  4426,
+     1053,  3316,  -711, -5285, -1652, -2203,  2796,  6109,
+     -883,  3323,  3012, -6130,  1502,  2851,  -489, -1820,
+    -2967,  1020, -5244,  1517, -3888,  -900, -1156,  1553,
+     5569, -2921,   126, -2019,  2315,  4746,  4949,  4673,
+    -2903,  4676,  4586,   834,  5453, -3403,  5351,   -13,
+     2446, -4668,  3180,  3467, -3604, -3110, -2083, -3782,
+      -48, -2742, -1228, -2560,  2211, -1195, -1808, -4970,
+     -730, -1762,  3854,  2030,  1367,  5892,  5274,  3269,
+    -1730,  2558, -5344,  1949,  4418,  3526,   378, -6057,
+     3388,  3060, -3443,  4551,   625, -2700, -3468,  4659,
+     3159, -2341, -2133, -3566, -4956,  5680, -3901,  6038,
+    -2649, -2320, -3253, -6101,  4506, -3736, -1467, -5460,
+     2482,  3533,  4101,  5387, -2190, -5286,  -727,  6090,
+     -144,  4063, -3684,  4609, -5656, -3585, -5424, -2621,
+     3580,  1739,  1469,  2502,  4070,  2080,  3764,   -39,
+    -4951, -1715, -2749, -1888,  1477,  2959,  6040,   943,
+     -989,   340, -1748,  4602, -1296,  -300,  3711,  4614,
+    -2240, -5070,    42,  -673,  4868,  1582,  5746,  5654,
+     3802,  5204,  1004,  2053,  4597, -3146,  -163, -4703,
+    -4647,  3362,   932, -2060,  -237, -5858, -2991,  -351,
+      -16,  -914,  3687,  3243,   737,  3698, -4699, -5753,
+     3853,  3509,  5381,  4773,  4552,  1964,  1758,  5186,
+    -3281, -1556,  1060,  5252,  2895, -5133,  3402, -5357,
+     5914,  2962,  5880,  4092,  5625,   278,  5655,  5064,
+     4091, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+    -2829,  5831,  4431, -3412, -2564, -5145,  4042, -5664,
+    -1549,  5217,  4407, -4783,   -79, -6049,  -997,  -117,
+    -4843, -1690,    14,  3872,  5719, -3569, -2181,  5981,
+     -432,  -100,  1237,  1538, -4679,  1534, -3983,  4426,
+     1053,  3316,  -711, -5285, -1652, -2203,  2796,  6109,
+     -883,  3323,  3012, -6130,  1502,  2851,  -489, -1820,
+    -2967,  1020, -5244,  1517, -3888,  -900, -1156,  1553,
+     5569, -2921,   126, -2019,  2315,  4746,  4949,  4673,
+    -2903,  4676,  4586,   834,  5453, -3403,  5351,   -13,
+     2446, -4668,  3180,  3467, -3604, -3110, -2083, -3782,
+      -48, -2742, -1228, -2560,  2211, -1195, -1808, -4970,
+     -730, -1762,  3854,  2030,  1367,  5892,  5274,  3269,
+    -1730,  2558, -5344,  1949,  4418,  3526,   378, -6057,
+     3388,  3060, -3443,  4551,   625, -2700, -3468,  4659,
+     3159, -2341, -2133, -3566, -4956,  5680, -3901,  6038,
+    -2649, -2320, -3253, -6101,  4506, -3736, -1467, -5460,
+     2482,  3533,  4101,  5387, -2190, -5286,  -727,  6090,
+     -144,  4063, -3684,  4609, -5656, -3585, -5424, -2621,
+     3580,  1739,  1469,  2502,  4070,  2080,  3764,   -39,
+    -4951, -1715, -2749, -1888,  1477,  2959,  6040,   943,
+     -989,   340, -1748,  4602, -1296,  -300,  3711,  4614,
+    -2240, -5070,    42,  -673,  4868,  1582,  5746,  5654,
+     3802,  5204,  1004,  2053,  4597, -3146,  -163, -4703,
+    -4647,  3362,   932, -2060,  -237, -5858, -2991,  -351,
+      -16,  -914,  3687,  3243,   737,  3698, -4699, -5753,
+     3853,  3509,  5381,  4773,  4552,  1964,  1758,  5186,
+    -3281, -1556,  1060,  5252,  2895, -5133,  3402, -5357,
+     5914,  2962,  5880,  4092,  5625,   278,  5655,  5064,
+     4514, -3279,  2834,  -937,  2523,  4339, -6115,  -619,
+     2085,   824,  1113,   599,  6112,  5056,  4801,  2363,
+     2441,  2727,  2028,  -896,  5075,  2654,  1825,  4405,
+     5889,  3070,   120, -5434,  -136,  4520,   617, -3157,
+     -424,   357,  5538,  6061,  1097,  -315,  4511,  1158,
+    -2352,   821,  1273, -2550, -2262,  2890, -2569,  2250,
+     5221, -4367,  3512,  3999, -3161,  5299,  4130,  -637,
+    -3036,  4759, -3937, -2163, -4550, -4922, -3755,  -983,
+     4328,  1457,  4220,  1432,  3410, -4900,  -832,  1628,
+    -3816,  3213,   686,  5393, -2416, -2835,  3732, -1867,
+    -3442,  3072, -4083,  4858, -2746,  5964,  1434,  5111,
+    -2167, -2436, -5259,  -876, -3871, -1465,   303, -5733,
+     3835,  5553, -1224,  3813,  3845,  3052,  1080,   250,
+    -2609,   -35,  5963,  4225, -3481,  -692,  4136,  2778,
+     3759, -4933,   928,  3856, -1871,  2184, -5879, -5571,
+    -5813, -4873, -2272,  5391,  5852, -3652, -5947, -3311,
+     4910,   909,   676, -4395,  5788,  4981, -3488, -2628,
+     1963, -3073,    40,  2285,  4051,  5603,  4302,  3044,
+      695,  4371,   371,  4296, -2059, -2411, -2496,  4884,
+      841, -2650,  2058,  3890,  5041,  3784, -1093, -5601,
+    -2356, -5552,  5267,  1333, -5150, -2330,  5473,  3884,
+    -1012, -2510,  2784,  -721, -5613, -5737, -5348, -4424,
+     -784,  4370, -3672,  -850,  -754, -3133,  3240,   750,
+     4462,  -105,  5600,   386,  1846, -2076,   119, -3955,
+     2949,  1024, -1361, -2477,  3181,  1988,   478,  5800,
+     3374,  -812, -1753,  -292,  2806,  3608,   101, -1911,
+    -1272,  1071,  4325,  5894,  3291,  -945,  1244,  3474,
+     5233,  2463,  3819,  4639,  5503, -3619,  4582, -5539,
+     1253,  2452, -3787, -2811, -4720,   728, -6056, -1857,
+    -6034,  2472,  3339,  1797,  6047,  2879,  2114, -5200,
+    -4966, -4108,  6084, -2688,  2936, -4327,  5475,   926,
+     5378, -3079,   360, -4013,  -408,  1271,  1851,  2818,
+    // Montgomery companions
+         0,     -5,     -5,   7887,     -5,   7887, -27443,  21561,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+     25843, -14649,  16719, -19796, -18948, -25625,  12234,  -5664,
+     27123,  -7071, -16073, -17071, -12367,   6239,  -5093,  -4213,
+      -747,  -9882,  24590,   3872, -14761,   8719,  -6277, -22691,
+      -432, -16484,   5333, -23038,  15801,  26110, -16271,  12618,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+     25843, -14649,  16719, -19796, -18948, -25625,  12234,  -5664,
+     27123,  -7071, -16073, -17071, -12367,   6239,  -5093,  -4213,
+      -747,  -9882,  24590,   3872, -14761,   8719,  -6277, -22691,
+      -432, -16484,   5333, -23038,  15801,  26110, -16271,  12618,
+    -27619,  19700,  19769,  -9381, -18036,   1893, -13588, -22563,
+    -29555,   -773,  19396,  18446,  26078,  31523, -20969,  14564,
+     17513, -15364,  11140, -27155,  -3888, -17284, -17540, -10735,
+     -6719, -23401,  24702, -30691,  -1781,  12938,   9045,  -7615,
+     17577,  21060,  12778, -23742, -23219,    693, -15129,  28659,
+     27022,  11716, -13204,   -629, -19988,   5082, -30755,   4410,
+       -48,   5450,  15156,  -2560,  30883,   2901,  -1808, -13162,
+     -8922,  22814,  28430,  26606, -19113,  22276,  13466,   7365,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+     25843, -14649,  16719, -19796, -18948, -25625,  12234,  -5664,
+     27123,  -7071, -16073, -17071, -12367,   6239,  -5093,  -4213,
+      -747,  -9882,  24590,   3872, -14761,   8719,  -6277, -22691,
+      -432, -16484,   5333, -23038,  15801,  26110, -16271,  12618,
+    -27619,  19700,  19769,  -9381, -18036,   1893, -13588, -22563,
+    -29555,   -773,  19396,  18446,  26078,  31523, -20969,  14564,
+     17513, -15364,  11140, -27155,  -3888, -17284, -17540, -10735,
+     -6719, -23401,  24702, -30691,  -1781,  12938,   9045,  -7615,
+     17577,  21060,  12778, -23742, -23219,    693, -15129,  28659,
+     27022,  11716, -13204,   -629, -19988,   5082, -30755,   4410,
+       -48,   5450,  15156,  -2560,  30883,   2901,  -1808, -13162,
+     -8922,  22814,  28430,  26606, -19113,  22276,  13466,   7365,
+     22846,  27134,  -5344, -26723, -20158,  -4666,   8570, -26537,
+    -12996,  19444, -32115, -15929, -11663,  13684,  12916, -32205,
+    -17321,  -6437,  -6229, -28142,  11428,   5680,  24771,  -2154,
+    -23129,  -2320,  -7349, -10197,  12698,  29032,   2629, -21844,
+    -22094, -25139,   8197,   1291, -26766,   2906,  19753,  14282,
+      -144,  16351, -20068,  -7679,  27112,   8703,  -5424,  26051,
+    -12804,  -2357, -27203,  -5690,  -4122,   2080,  20148,  20441,
+     15529, -30387,  25923,  -1888,   5573,  15247, -26728,  13231,
+     27683,  16724, -18132,  12794,  -1296,  16084,  15999,  -3578,
+     -2240, -29646,   8234,  11615,  21252,  26158, -18830,  -2538,
+     11994,  21588, -15380,   6149,   8693, -11338, -28835, -16991,
+     15833, -21214,  17316,  14324,  28435,  18718, -15279, -12639,
+       -16,  23662, -16793,   -853, -11551, -20878,   -603, -26233,
+    -24819,   7605,   9477,   8869, -28216, -14420,  26334, -19390,
+      9007, -17940,  17444,  21636,  15183,  23539,  11594,  23315,
+     14106, -21614, -26888, -12292,  26105,  -7914, -14825, -27704,
+        -5,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+     25843, -14649,  16719, -19796, -18948, -25625,  12234,  -5664,
+     27123,  -7071, -16073, -17071, -12367,   6239,  -5093,  -4213,
+      -747,  -9882,  24590,   3872, -14761,   8719,  -6277, -22691,
+      -432, -16484,   5333, -23038,  15801,  26110, -16271,  12618,
+    -27619,  19700,  19769,  -9381, -18036,   1893, -13588, -22563,
+    -29555,   -773,  19396,  18446,  26078,  31523, -20969,  14564,
+     17513, -15364,  11140, -27155,  -3888, -17284, -17540, -10735,
+     -6719, -23401,  24702, -30691,  -1781,  12938,   9045,  -7615,
+     17577,  21060,  12778, -23742, -23219,    693, -15129,  28659,
+     27022,  11716, -13204,   -629, -19988,   5082, -30755,   4410,
+       -48,   5450,  15156,  -2560,  30883,   2901,  -1808, -13162,
+     -8922,  22814,  28430,  26606, -19113,  22276,  13466,   7365,
+     22846,  27134,  -5344, -26723, -20158,  -4666,   8570, -26537,
+    -12996,  19444, -32115, -15929, -11663,  13684,  12916, -32205,
+    -17321,  -6437,  -6229, -28142,  11428,   5680,  24771,  -2154,
+    -23129,  -2320,  -7349, -10197,  12698,  29032,   2629, -21844,
+    -22094, -25139,   8197,   1291, -26766,   2906,  19753,  14282,
+      -144,  16351, -20068,  -7679,  27112,   8703,  -5424,  26051,
+    -12804,  -2357, -27203,  -5690,  -4122,   2080,  20148,  20441,
+     15529, -30387,  25923,  -1888,   5573,  15247, -26728,  13231,
+     27683,  16724, -18132,  12794,  -1296,  16084,  15999,  -3578,
+     -2240, -29646,   8234,  11615,  21252,  26158, -18830,  -2538,
+     11994,  21588, -15380,   6149,   8693, -11338, -28835, -16991,
+     15833, -21214,  17316,  14324,  28435,  18718, -15279, -12639,
+       -16,  23662, -16793,   -853, -11551, -20878,   -603, -26233,
+    -24819,   7605,   9477,   8869, -28216, -14420,  26334, -19390,
+      9007, -17940,  17444,  21636,  15183,  23539,  11594,  23315,
+     14106, -21614, -26888, -12292,  26105,  -7914, -14825, -27704,
+    -20062, -15567, -21742, -21417,  -1573, -32525,  30749,   3477,
+      6181, -31944,  21593, -19881,   6112,   5056,  -7487,  -1733,
+     22921, -17753, -14356,   -896, -31789,  27230, -10463,   8501,
+     -6399,  27646, -32648, -13626,  32632, -28248,  21097,  -7253,
+     32344,   4453, -19038, -22611,  21577,   3781,  16799,  -7034,
+     -2352,   4917,  21753,   5642,   5930,  11082, -23049,  10442,
+      9317, -16655, -29256,  16287, -23641, -31565, -20446,  28035,
+     13348, -15721,   8351, -30835,   3642, -13114,    341,  19497,
+    -28440, -10831, -12164, -31336, -21166, -21284,   -832, -14756,
+     28952, -25459,  25262,  -6895,  -2416, -31507,  20116,   2229,
+     21134,   3072, -32755,  13050, -10938, -10420,   9626, -15369,
+     18313, -18820,  -1163,  15508, -16159, -21945,  12591,  -9829,
+      -261,  -6735,  31544,   7909,   7941, -13332, -31688,   8442,
+      9679, -28707,   1867,  -8063, -23961, -17076, -28632,  10970,
+     16047,  -9029,    928,   3856, -14159, -30584,  14601,  31293,
+     -9909, -25353,  -2272,  17679, -10532, -20036,  -1851, -15599,
+     29486, -27763,  17060,   -299, -10596,   9077,  -3488, -19012,
+     -2133,   9215, -32728, -26387,  32723, -31261,  28878,  19428,
+    -19785, -32493,  29043, -28472,   2037,   1685,  -2496,  21268,
+     21321, -10842,  10250, -20686,  -7247, -28984,  -5189,   6687,
+    -18740,  -5552, -31597,   5429, -29726, -10522,  -6815, -12500,
+    -17396, -27086,   2784,  11567,  23059, -26217, -21732,  28344,
+      -784, -20206,  29096,  23726,  23822,  25539, -29528,  25326,
+     29038, -20585,   5600, -24190,  -6346,  14308, -20361, -32627,
+      7045,   1024,  10927,  26195, -25491,  18372,  25054, -26968,
+     27950,  15572, -22233, -16676,  -5386, -29160,   4197,  18569,
+     31496,  13359,   8421,  -2298,   -805,  11343, -15140, -21102,
+     -7055,  14751,   -277,  16927,  17791, -32291,  -3610,  31325,
+      5349,  18836,    309,   1285,  -4720, -32040,  26712,  10431,
+     18542, -30296,   -757,   5893,  18335,  15167, -22462,  -5200,
+      3226,  12276,  22468,  -2688, -29832,  16153, -31389,  25502,
+    -19198,  17401, -32408,  24659,  32360, -19209,  -2245, -21758,
+};
+
+const int16_t ntt_mont1024_mixed_powers[2048] = {
+        0,  4401, -1081, -1229,  6014, -5329, -2530, -4342,
+    -5825, -1591, -4751, -5266,  -586, -5890,  2579,  2812,
+    -1688,  5882, -1364, -5847, -4189,  1711,  3109,  4615,
+    -1885, -1134, -1960,  3743, -1875,  -965,  2125,  5190,
+    -4426,   117, -5981,  5664, -1538,  4783, -3872,  3412,
+    -1534,  6049,  3569,  5145,   100, -5217,  1690, -5831,
+     3983,   997,  2181, -4042, -1237, -4407,   -14, -4431,
+     4679,    79, -5719,  2564,   432,  1549,  4843,  2829,
+    -3269, -4673,  3782,  1820,  4970, -1553,    13, -6109,
+    -2030,  2019, -3467,  6130,  2560, -1517,  -834,  5285,
+    -5892, -4746,  3110, -2851,  1195,   900,  3403,  2203,
+     1762,  2921,  4668, -3323,  2742, -1020, -4676, -3316,
+    -5274, -4949,  2083,   489,  1808,  1156, -5351, -2796,
+    -3854,  -126, -3180, -3012,  1228,  5244, -4586,   711,
+    -1367, -2315,  3604, -1502, -2211,  3888, -5453,  1652,
+      730, -5569, -2446,   883,    48,  2967,  2903, -1053,
+    -5064,  -943,   351,  5460, -5186,  2621, -5654, -4659,
+     5357,    39,  4703, -6038,  5753, -6090, -4614,  6057,
+    -4092,  1888,  2060,  6101, -4773, -4609,   673, -4551,
+    -5252, -2502, -2053,  3566, -3243, -5387, -4602, -1949,
+     -278, -2959,  5858,  3736, -1964,  3585, -1582,  2700,
+     5133, -2080,  3146, -5680, -3698,  5286,   300, -3526,
+    -2962,  1715, -3362,  2320, -3509, -4063,  5070, -3060,
+     1556, -1739, -5204,  2341,   914, -3533,  -340, -2558,
+    -5655, -6040,  2991,  1467, -1758,  5424, -5746,  3468,
+    -3402, -3764,   163,  3901,  4699,   727, -3711,  -378,
+    -5880,  2749,  -932,  3253, -5381,  3684,   -42,  3443,
+    -1060, -1469, -1004,  2133, -3687, -4101,  1748,  5344,
+    -5625, -1477,   237, -4506, -4552,  5656, -4868,  -625,
+    -2895, -4070, -4597,  4956,  -737,  2190,  1296, -4418,
+    -5914,  4951,  4647,  2649, -3853,   144,  2240, -3388,
+     3281, -3580, -3802, -3159,    16, -2482,   989,  1730,
+    -2818,  3311,  3955,   983,  5539,  5733,  5601,  3157,
+     5200, -2778,  4424, -2250,  1911,  1867, -3044, -2363,
+     -926,  5571,  -750,   637, -3474, -5111, -4884, -4405,
+     1857,  -250, -3884, -1158, -5800, -1628,  2628,   619,
+     4013, -5391,  -386,  2163, -4639,   876, -3890,  5434,
+    -1797, -4225,   721,  2550,   292, -5393, -2285,  -599,
+     2688, -3856,   850, -3999, -5894, -4858, -4296,   896,
+     2811, -3813, -1333, -6061,  2477, -1432,  4395,   937,
+    -1271,  3652,  2076,  4922,  3619,  1465, -3784, -4520,
+    -2879,   692,  5737, -2890, -3608,  2835, -5603, -5056,
+     4327, -2184,  3133, -5299,   945, -5964,  2411, -2654,
+     -728, -3052,  2330,   315, -1988,  4900, -4981, -4339,
+     3079,  4873,   105, -4759, -2463,  2436,  2650, -3070,
+    -2472,    35,  2510,  -821,   812, -3213,  3073,  -824,
+     4108,  4933, -4370,  4367, -1071, -3072, -4371, -2727,
+    -2452, -5553,  5552,  -357, -1024, -1457,  -909,  3279,
+    -1851,  5947,  -119,  3755, -4582,  -303,  1093,  -617,
+    -2114, -4136,  5348,  2569,  -101, -3732, -4302, -4801,
+    -5475,  5879, -3240, -4130, -1244, -1434,  2496, -1825,
+     6056, -1080, -5473, -4511,  -478,   832,  3488,  6115,
+     -360,  2272, -5600,  3937, -3819,  5259, -2058,  -120,
+    -3339, -5963, -2784, -1273,  1753,  -686,   -40, -1113,
+    -6084,  -928,  3672, -3512, -4325,  4083,  -371, -2028,
+     3787,  1224, -5267, -5538,  1361, -4220,  -676, -2834,
+      408, -5852, -1846,  4550, -5503,  3871, -5041,   136,
+    -6047,  3481,  5613,  2262, -2806,  2416, -4051, -6112,
+    -2936,  1871,   754,  3161, -3291,  2746,  2059, -5075,
+     4720, -3845,  5150, -1097, -3181, -3410, -5788, -2523,
+    -5378,  5813, -4462,  3036, -5233,  2167,  -841, -5889,
+     6034,  2609,  1012,  2352, -3374,  3816, -1963, -2085,
+     4966, -3759,   784, -5221,  1272,  3442,  -695, -2441,
+    -1253, -3835,  2356,   424, -2949, -4328, -4910, -4514,
+    -5408,  5885,  1906,  2457,  3264,  4156,  2340,  1353,
+    -2479,   473,  -467,   565,  5132,  1896, -5899,  6058,
+    -3461,   819,  1088, -2711,   780,   451,  3270,  4254,
+    -4252, -3908,  5807,   632,  2130, -2077, -5250,   273,
+     4459, -5000,   260, -3946,  1090,  1418,  2679, -5399,
+     6032,  4307,   710,  3404, -1750,    91, -2610, -5763,
+     4183,  2781, -3733,  4569,   893, -5896,  6107,  5532,
+     4333,  5231,  3513, -4066,  -870, -1921, -2702,   927,
+     2852,  1523,  4394,  2131,  6132,  1844, -2652,  5840,
+     1171,  2741,  -290,  3456, -4997,   309,  5047,  4604,
+     5561, -3386,  2044,  4711,  -884,  6043, -3706,  5010,
+    -4193,  1152, -5762,   103, -2414,  5631,  5950, -5225,
+    -3415, -2526, -4391, -2082,  2861,  1670, -5494,   384,
+    -6017, -4062, -4901,  1877, -2113, -5838,  2958,  -842,
+    -5560,  -694,  5050,  4653,  2265,   128, -6102, -1354,
+    -5730,  4722,  3392, -1946,   986, -4377,  2243,  3865,
+    -2413,  1551,   755,  4139, -2034,  3645, -1910,  1574,
+     5227, -4745,  4425, -1459,  4844, -2808,  3292,   517,
+     4348,  5476,  -678,  1215, -4733,  4621, -2354, -5678,
+     1475,  3610,  5711,  -936, -2999, -3924, -2647, -2271,
+     -226,   405, -5674, -2556, -4881, -5989,  4588, -2893,
+     6000,  -312, -5096, -1308,  3214,  -757,  4021,   135,
+     2205,  -852, -1627,  2100, -2567,  3132,  2000,  -104,
+    -5795,  -436, -3025,  3844, -2756,    45,   735,  -284,
+     3554,   700, -4952,  1044,  4763, -4131, -6028,  3951,
+     3088, -2815, -5015,    15,   245, -4191,  5281, -3863,
+    -5747,   348,  5684, -1377,  2087,  1317, -3067,  3158,
+    -5768,     5,  4178, -1397, -2336, -5384, -6012,   116,
+     5991,  -459,  4792,   439,  3074,  5149, -6019,  4098,
+     5489, -4562, -4875, -5891, -2004,  4135,  1997,  -153,
+    -2499, -3950,  5121, -2380,  2090,  1366,  5926, -5617,
+    -1625, -6060,  -668, -2718,  4762,   -51,  -833, -5413,
+     1707,  3303,  4793, -3641, -2121,  2224, -4638, -2020,
+    -4319,  -906, -2509,   -17, -4374,  2292,   569,  1101,
+     5694, -5310,  -707, -3355, -1546,  3423, -5536,  -302,
+     3260, -4102, -1458,   764,  4286,   367,  1898, -1770,
+    -4332,  2978,  3581,  1141,  2251, -4197,  5183,  2729,
+     -486,  4351,  5525, -3974,  4729,  -590, -1444,  5089,
+     5290, -3716, -3346, -1399,  5824,  5006,  -162, -2646,
+     5938, -5421, -2520, -4293,  3615, -2400, -2333, -5335,
+     2981,  3630, -2155,  5765,   -54,  -882, -2117, -1807,
+     -840, -1431,  1205,  -800, -4874,  2318,  5090,  1210,
+     3378,  6018,   -18,  -294, -4802,  3494,  -280,  -477,
+     4498, -4363, -5721,  4869,  5793, -3693,  1126,  2006,
+       -6,   -98, -5697,  5261,  4003,  -159, -2597,  2642,
+    -1907,  1623,  1931, -1231, -3721,  4765,    -2, -4129,
+    -1899,  5850, -2762,   -53, -4962,  4977, -4732,   541,
+     4740,  3686,  2856, -2508, -4097,  2720,  -633,  1950,
+    -5017, -4114, -1654,  1659,  2519, -3916,  1580,  5325,
+      952,  -836, -5462,  5003,  -211,   650,  2424,  2725,
+     3545,   553,  4936,  2791,  4623,  1775, -3779, -4375,
+    -5917,  5764,  4026,  4313,   808, -3188,  5278, -3912,
+    -2451, -3166,  1541,  4688, -5356,  2638,  2124, -2175,
+     1342,  5534, -3827, -5159, -2337, -1304,  -817,  3041,
+     4610,  5659,  2311, -3217,   708,  -725, -3649,  5941,
+    -5372, -5816,  -779, -4531,  3824,  5110,  5633, -2210,
+    -3326,  3024,   236, -4338,  2880, -2116, -5887, -6035,
+    -4356,  2586,  5371, -2393,  5974, -4833, -5205,  1008,
+     4175, -1446,   960,  3391,  2134, -6108, -1452,   862,
+    -2306, -4894, -2105, -1611, -1735,   336,  5488,  -482,
+      320, -2966, -3385, -2036,  -484, -3809, -4865,  2465,
+    -4798,  -537,  3518,   112, -2267, -4257,  4203, -5085,
+     2968, -4775,  3935, -5366, -5718,  4918,  2497,  -179,
+     5269, -4059, -4852, -1419,  1401, -1695, -3107, -5688,
+    // Montgomery companions
+         0,  -7887, -21561,  27443,  30590,   6959,  22046,   3850,
+      6463,  18889, -17039,  19310,  -8778,  18686,  31251, -13572,
+     31080,  14074, -17748,  14633,  24483,  13999,   7205, -15865,
+     26787, -25710,  30808,  16031, -30547,  -5061, -26547,  -3002,
+    -12618,   4213,  22691,   5664,  23038,  17071,  -3872,  19796,
+    -26110,  -6239,  -8719,  25625,  16484,   7071,   9882,  14649,
+     16271,   5093,   6277, -12234,  -5333,  16073, -24590, -16719,
+    -15801,  12367,  14761,  18948,    432, -27123,    747, -25843,
+     -7365,   7615,  -4410, -14564,  13162,  10735, -28659,  22563,
+    -26606,  30691,    629, -18446,   2560,  27155,  23742,   9381,
+    -22276, -12938,  -5082, -31523,  -2901,  17284,   -693,  -1893,
+    -22814,  23401, -11716,    773,  -5450,  15364, -21060, -19700,
+    -13466,  -9045,  30755,  20969,   1808,  17540,  15129,  13588,
+    -28430, -24702,  13204, -19396, -15156, -11140, -12778, -19769,
+     19113,   1781,  19988, -26078, -30883,   3888,  23219,  18036,
+      8922,   6719, -27022,  29555,     48, -17513, -17577,  27619,
+     27704, -13231,  12639,  21844,  19390, -26051,   2538,  32205,
+    -23315, -20441,  16991,   2154,  26233, -14282,   3578,  26537,
+     12292,   1888, -14324,  10197,  -8869,   7679, -11615,  15929,
+    -21636,   5690,  -6149,  28142,    853,  -1291, -12794,  26723,
+      7914, -15247, -18718, -29032,  14420,  -8703, -26158, -13684,
+    -23539,  -2080,  11338,  -5680,  20878,  -2906, -16084,   4666,
+     21614,  30387,  21214,   2320,  -7605, -16351,  29646, -19444,
+     17940,   2357, -21588,   6437, -23662,  25139, -16724, -27134,
+     14825,  26728,  15279,  -2629, -26334,   5424,  18830, -12916,
+    -11594, -20148,  28835, -24771,    603, -19753, -15999,  -8570,
+     26888, -25923, -17316,   7349,  -9477,  20068,  -8234,  32115,
+    -17444,  27203,  15380,   6229,  16793,  -8197,  18132,   5344,
+    -26105,  -5573, -28435, -12698,  28216, -27112, -21252,  11663,
+    -15183,   4122,  -8693, -11428,  11551,  26766,   1296,  20158,
+    -14106, -15529, -15833,  23129,  24819,    144,   2240,  12996,
+     -9007,  12804, -11994,  17321,     16,  22094, -27683, -22846,
+     21758,  15599,  32627, -19497, -31325,   9829,  -6687,   7253,
+      5200, -10970, -28344, -10442, -18569,  -2229, -19428,   1733,
+    -25502, -31293, -25326, -28035,  21102,  15369, -21268,  -8501,
+    -10431,  -8442,  12500,   7034,  26968,  14756,  19012,  -3477,
+    -24659, -17679,  24190,  30835, -16927, -15508,  20686,  13626,
+     -5893,   8063, -11567,  -5642,  16676,   6895,  26387,  19881,
+      2688,  -3856, -23726, -16287,   2298, -13050,  28472,    896,
+     -1285,  -7909,  -5429,  22611, -26195,  31336,    299,  21417,
+     19209,  20036, -14308,  13114,  32291,  21945,  28984,  28248,
+    -15167,  17076,  26217, -11082,  29160,  31507,  31261,  -5056,
+    -16153,  30584, -25539,  31565, -11343,  10420,  -1685, -27230,
+     32040,  13332,  10522,  -3781, -18372,  21284,  -9077,  32525,
+    -17401,  25353,  20585,  15721, -14751,  18820,  10842, -27646,
+     30296,  28707,  27086,  -4917, -15572,  25459,  -9215,  31944,
+    -12276,   9029,  20206,  16655, -13359,  -3072,  32493,  17753,
+    -18836,   6735,   5552,  -4453,  -1024,  10831,  27763,  15567,
+      2245,   1851,  20361,   -341,   3610, -12591,   5189, -21097,
+     22462,  28632,  21732,  23049,  -4197, -20116, -28878,   7487,
+     31389, -14601,  29528,  20446,  15140,  -9626,   2496,  10463,
+    -26712,  31688,   6815, -16799, -25054,    832,   3488, -30749,
+     32408,   2272,  -5600,  -8351,    277,   1163, -10250,  32648,
+       757,  -1867,  -2784, -21753,  22233, -25262,  32728, -21593,
+    -22468,   -928, -29096,  29256,  -8421,  32755, -29043,  14356,
+      -309, -31544,  31597,  19038, -10927,  12164, -17060,  21742,
+    -32360,  10532,   6346,  -3642, -17791,  16159,   7247, -32632,
+    -18335,  23961, -23059,  -5930,   5386,   2416, -32723,  -6112,
+     29832,  14159, -23822,  23641,    805,  10938,  -2037,  31789,
+      4720,  -7941,  29726, -21577,  25491,  21166,  10596,   1573,
+     19198,   9909, -29038, -13348,   7055, -18313, -21321,   6399,
+    -18542,  -9679,  17396,   2352, -27950, -28952,   2133,  -6181,
+     -3226, -16047,    784,  -9317, -31496, -21134,  19785, -22921,
+     -5349,    261,  18740, -32344,  -7045,  28440, -29486,  20062,
+     -5408, -22787, -22670,  22937,   3264, -12228,  18724,  21833,
+    -14767,  20953, -29139,   4661, -11252, -30872,  -1803,  14250,
+     -7557,  29491,   1088,  17769, -15604,  29123,  -4922,  28830,
+     12132, -20292,  18095, -32136, -22446,  26595,  19326, -12015,
+       363,  27768,  16644, -12138, -23486,   9610, -17801,  15081,
+      6032, -32557,  -7482, -12980,   6442,  -4005,  21966,  31101,
+    -16297, -25891,  -7829,  25049, -27779,  26872,   2011, -10852,
+    -24339,  17519,  23993,  20510,   7322,  10367, -27278,  13215,
+     19236,  30195,  12586,  30803,  22516,  18228,  13732,   5840,
+     29843,   6837,  24286,   3456,  -9093,   4405, -15433, -11780,
+     26041, -11578, -14340, -15769, -17268,   1947, -11898, -19566,
+      8095,   1152,  18814, -20377, -26990,  17919,  30526, -25705,
+     17065, -27102,  16089,  22494, -25811,  -6522,   2698,    384,
+      6271, -28638,  -8997,   5973,  10175, -30414,  27534,  -9034,
+     27208,   7498,  13242, -24019,  22745,    128,   2090,  -9546,
+     18846, -19854,   3392, -10138,   9178, -24857,  30915,  24345,
+     26259,  13839,  29427,     43,  22542, -25027,   6282,  -6618,
+      1131, -25225,  24905, -30131, -11540,  29960, -13092,   4613,
+    -12036,  21860,   7514,  13503,  23939, -24051,  22222, -30254,
+     30147,  11802,  17999,  31832,  17481, -20308,  17833, -14559,
+     24350,   4501, -13866,  13828,   7407, -10085, -11796,  25779,
+      6000,  32456,  27672,  15076,  27790,  -4853,   8117, -20345,
+    -26467, -17236,   2469,  18484,  17913, -13252,   2000,  32664,
+     31069, -16820,   9263,  20228, -19140, -28627,  13023,  16100,
+    -21022, -15684,  27816,  17428,    667,  32733,  10356,  16239,
+      3088, -15103,  15465,  12303,   4341, -16479,  -7007,  16617,
+     31117, -16036,  22068,  10911, -18393,   5413,   1029,  -5034,
+     27000,   4101, -20398,  -5493,  -2336,  27384,  10372,  16500,
+    -14489,   3637, -27976, -20041, -21502, -23523,  30845, -20478,
+     -6799,  20014,   -779,  30973, -18388, -16345, -26675, -20633,
+    -31171, -28526,  -7167,  14004,  10282,  -6826,  -2266,   6671,
+    -22105,  10324,  15716, -27294,  12954, -28723,  11455,  -9509,
+     -2389, -17177,  25273, -24121, -22601,   2224, -29214, -18404,
+    -16607,  -9098,  26163,  12271,   3818,  18676,  21049, -27571,
+     30270, -29886, -29379,    741,  -9738,  15711,  -5536, -24878,
+    -13124,   4090,  23118, -15620,  28862,  12655,  10090,  -9962,
+     12052, -21598, -25091,   5237,  -1845,  -8293,  17471,  23209,
+      7706,  16639,   9621,   4218,  25209, -25166, -17828,  -7199,
+     13482, -20100,  21230,  19081,   5824,  29582,  24414,   5546,
+    -18638,  23251,  30248,  -8389,  15903,  -2400,  26339,  15145,
+      7077,  28206,   1941,   9861,   8138,  23694,  -6213, -14095,
+     31928,  19049,   5301,   -800, -13066,  26894, -19486,   9402,
+    -21198, -18558,  24558,   7898,  19774,  -4698,  32488,  28195,
+    -20078,   -267, -26201,   8965,  -6495,  24979,  -7066,  -6186,
+      8186,  24478,   6591, -23411,  32675, -12447,  -6693, -21934,
+    -30579, -18857,  -2165, -13519, -24201, -23907,  24574,   8159,
+      2197,  14042, -10954,  -4149,  19614,  -7311,  11652, -28131,
+     21124,  -4506, -29912,  13876,   8191,   2720, -21113,  26526,
+    -25497,  20462,   6538,  -2437, -17961,  12468, -14804, -23347,
+    -31816, -17220,   2730,    907, -28883,   8842, -30344,   6821,
+     24025,  21033, -27832, -17689,  16911,  14063, -32451,  16105,
+     22755,  22148,  12218,  24793, -31960, -19572,  29854,  28856,
+    -31123, -27742,   5637,   4688,  11028,  27214, -14260, -14463,
+     25918,  30110, -32499,  15321,   9951,  31464,  11471,  -9247,
+    -19966,   1563, -18169,   9071,  17092,  -4821,   8639,  10037,
+     11012,  26952,   3317,  32333,   3824,  -3082,  -6655,  22366,
+    -27902,   3024, -16148,  20238,   2880, -18500, -18175,  30829,
+    -20740,  10778,   1275, -22873,  -2218,   7455,  -9301,   1008,
+     16463,   6746,    960,  15679,  -6058,  10276,  14932,  25438,
+     22270, -29470, -22585,   2485,  18745,    336,   5488,  24094,
+       320,   5226, -23865, -18420, -16868,   8479,   7423,  -9823,
+    -29374, -21017,  28094,    112,   1829,   8031,    107,  23587,
+    -29800,  15705,  16223,   2826,   2474,  -3274,  -9791, -28851,
+      9365,     37, -21236,   2677,  21881, -13983, -31779,  27080,
+};
+
+const int16_t ntt_mont1024_mixed_powers_rev[2048] = {
+        0,  4401, -1081, -1229,  6014, -2530, -5329, -4342,
+    -5825,  -586, -4751,  2579, -1591, -5890, -5266,  2812,
+    -1688, -1885, -4189, -1875, -1364, -1960,  3109,  2125,
+     5882, -1134,  1711,  -965, -5847,  3743,  4615,  5190,
+    -4426,  3983, -1534,  4679, -1538, -1237,   100,   432,
+    -5981,  2181,  3569, -5719, -3872,   -14,  1690,  4843,
+      117,   997,  6049,    79,  4783, -4407, -5217,  1549,
+     5664, -4042,  5145,  2564,  3412, -4431, -5831,  2829,
+    -3269, -5274, -5892, -1367, -2030, -3854,  1762,   730,
+     4970,  1808,  1195, -2211,  2560,  1228,  2742,    48,
+     3782,  2083,  3110,  3604, -3467, -3180,  4668, -2446,
+       13, -5351,  3403, -5453,  -834, -4586, -4676,  2903,
+    -4673, -4949, -4746, -2315,  2019,  -126,  2921, -5569,
+    -1553,  1156,   900,  3888, -1517,  5244, -1020,  2967,
+     1820,   489, -2851, -1502,  6130, -3012, -3323,   883,
+    -6109, -2796,  2203,  1652,  5285,   711, -3316, -1053,
+    -5064, -5655,  -278, -5625, -4092, -5880, -2962, -5914,
+     5357, -3402,  5133, -2895, -5252, -1060,  1556,  3281,
+    -5186, -1758, -1964, -4552, -4773, -5381, -3509, -3853,
+     5753,  4699, -3698,  -737, -3243, -3687,   914,    16,
+      351,  2991,  5858,   237,  2060,  -932, -3362,  4647,
+     4703,   163,  3146, -4597, -2053, -1004, -5204, -3802,
+    -5654, -5746, -1582, -4868,   673,   -42,  5070,  2240,
+    -4614, -3711,   300,  1296, -4602,  1748,  -340,   989,
+     -943, -6040, -2959, -1477,  1888,  2749,  1715,  4951,
+       39, -3764, -2080, -4070, -2502, -1469, -1739, -3580,
+     2621,  5424,  3585,  5656, -4609,  3684, -4063,   144,
+    -6090,   727,  5286,  2190, -5387, -4101, -3533, -2482,
+     5460,  1467,  3736, -4506,  6101,  3253,  2320,  2649,
+    -6038,  3901, -5680,  4956,  3566,  2133,  2341, -3159,
+    -4659,  3468,  2700,  -625, -4551,  3443, -3060, -3388,
+     6057,  -378, -3526, -4418, -1949,  5344, -2558,  1730,
+    -2818, -1851, -1271,   408,  4013,  -360,  3079, -5378,
+     -926, -5475,  4327, -2936,  2688, -6084,  4108,  4966,
+     5200, -2114, -2879, -6047, -1797, -3339, -2472,  6034,
+     1857,  6056,  -728,  4720,  2811,  3787, -2452, -1253,
+     5539, -4582,  3619, -5503, -4639, -3819, -2463, -5233,
+    -3474, -1244,   945, -3291, -5894, -4325, -1071,  1272,
+     1911,  -101, -3608, -2806,   292,  1753,   812, -3374,
+    -5800,  -478, -1988, -3181,  2477,  1361, -1024, -2949,
+     3955,  -119,  2076, -1846,  -386, -5600,   105, -4462,
+     -750, -3240,  3133,   754,   850,  3672, -4370,   784,
+     4424,  5348,  5737,  5613,   721, -2784,  2510,  1012,
+    -3884, -5473,  2330,  5150, -1333, -5267,  5552,  2356,
+     5601,  1093, -3784, -5041, -3890, -2058,  2650,  -841,
+    -4884,  2496,  2411,  2059, -4296,  -371, -4371,  -695,
+    -3044, -4302, -5603, -4051, -2285,   -40,  3073, -1963,
+     2628,  3488, -4981, -5788,  4395,  -676,  -909, -4910,
+     3311,  5947,  3652, -5852, -5391,  2272,  4873,  5813,
+     5571,  5879, -2184,  1871, -3856,  -928,  4933, -3759,
+    -2778, -4136,   692,  3481, -4225, -5963,    35,  2609,
+     -250, -1080, -3052, -3845, -3813,  1224, -5553, -3835,
+     5733,  -303,  1465,  3871,   876,  5259,  2436,  2167,
+    -5111, -1434, -5964,  2746, -4858,  4083, -3072,  3442,
+     1867, -3732,  2835,  2416, -5393,  -686, -3213,  3816,
+    -1628,   832,  4900, -3410, -1432, -4220, -1457, -4328,
+      983,  3755,  4922,  4550,  2163,  3937, -4759,  3036,
+      637, -4130, -5299,  3161, -3999, -3512,  4367, -5221,
+    -2250,  2569, -2890,  2262,  2550, -1273,  -821,  2352,
+    -1158, -4511,   315, -1097, -6061, -5538,  -357,   424,
+     3157,  -617, -4520,   136,  5434,  -120, -3070, -5889,
+    -4405, -1825, -2654, -5075,   896, -2028, -2727, -2441,
+    -2363, -4801, -5056, -6112,  -599, -1113,  -824, -2085,
+      619,  6115, -4339, -2523,   937, -2834,  3279, -4514,
+    -5408,  1707, -2413, -5017,  2852,  2981,  3554, -3326,
+     4459, -4332,  -226, -2451, -3415,    -6,  5991,   320,
+    -3461,  5694,  4348,  3545,  5561,  3378, -5747,  4175,
+     4183,  5290,  2205,  4610, -5560, -1899, -2499,  2968,
+    -2479, -4319,  5227,   952,  1171,  -840,  3088, -4356,
+     6032,  -486,  6000,  1342, -6017, -1907,  5489, -4798,
+    -4252,  3260,  1475, -5917, -4193,  4498, -5768, -2306,
+     4333,  5938, -5795, -5372, -5730,  4740, -1625,  5269,
+     3264, -2121, -2034,  2519,  6132,   -54,  4763,  2880,
+     1090,  2251, -4881, -5356,  2861,  4003,  3074,  -484,
+      780, -1546, -4733,  4623,  -884, -4802,  2087,  2134,
+      893,  5824, -2567,   708,  2265, -4962,  2090, -5718,
+     5132, -4374,  4844,  -211, -4997, -4874,   245,  5974,
+    -1750,  4729,  3214, -2337, -2113, -3721, -2004, -2267,
+     2130,  4286, -2999,   808, -2414,  5793, -2336, -1735,
+     -870,  3615, -2756,  3824,   986, -4097,  4762,  1401,
+     1906,  4793,   755, -1654,  4394, -2155, -4952,   236,
+      260,  3581, -5674,  1541, -4391, -5697,  4792, -3385,
+     1088,  -707,  -678,  4936,  2044,   -18,  5684,   960,
+    -3733, -3346, -1627,  2311,  5050, -2762,  5121,  3935,
+     -467, -2509,  4425, -5462,  -290,  1205, -5015,  5371,
+      710,  5525, -5096, -3827, -4901,  1931, -4875,  3518,
+     5807, -1458,  5711,  4026, -5762, -5721,  4178, -2105,
+     3513, -2520, -3025,  -779,  3392,  2856,  -668, -4852,
+     2340, -4638, -1910,  1580, -2652, -2117, -6028, -5887,
+     2679,  5183,  4588,  2124, -5494, -2597, -6019, -4865,
+     3270, -5536, -2354, -3779, -3706,  -280, -3067, -1452,
+     6107,  -162,  2000, -3649, -6102, -4732,  5926,  2497,
+    -5899,   569,  3292,  2424,  5047,  5090,  5281, -5205,
+    -2610, -1444,  4021,  -817,  2958,    -2,  1997,  4203,
+    -5250,  1898, -2647,  5278,  5950,  1126, -6012,  5488,
+    -2702, -2333,   735,  5633,  2243,  -633,  -833, -3107,
+     5885,  3303,  1551, -4114,  1523,  3630,   700,  3024,
+    -5000,  2978,   405, -3166, -2526,   -98,  -459, -2966,
+      819, -5310,  5476,   553, -3386,  6018,   348, -1446,
+     2781, -3716,  -852,  5659,  -694,  5850, -3950, -4775,
+      473,  -906, -4745,  -836,  2741, -1431, -2815,  2586,
+     4307,  4351,  -312,  5534, -4062,  1623, -4562,  -537,
+    -3908, -4102,  3610,  5764,  1152, -4363,     5, -4894,
+     5231, -5421,  -436, -5816,  4722,  3686, -6060, -4059,
+     4156,  2224,  3645, -3916,  1844,  -882, -4131, -2116,
+     1418, -4197, -5989,  2638,  1670,  -159,  5149, -3809,
+      451,  3423,  4621,  1775,  6043,  3494,  1317, -6108,
+    -5896,  5006,  3132,  -725,   128,  4977,  1366,  4918,
+     1896,  2292, -2808,   650,   309,  2318, -4191, -4833,
+       91,  -590,  -757, -1304, -5838,  4765,  4135, -4257,
+    -2077,   367, -3924, -3188,  5631, -3693, -5384,   336,
+    -1921, -2400,    45,  5110, -4377,  2720,   -51, -1695,
+     2457, -3641,  4139,  1659,  2131,  5765,  1044, -4338,
+    -3946,  1141, -2556,  4688, -2082,  5261,   439, -2036,
+    -2711, -3355,  1215,  2791,  4711,  -294, -1377,  3391,
+     4569, -1399,  2100, -3217,  4653,   -53, -2380, -5366,
+      565,   -17, -1459,  5003,  3456,  -800,    15, -2393,
+     3404, -3974, -1308, -5159,  1877, -1231, -5891,   112,
+      632,   764,  -936,  4313,   103,  4869, -1397, -1611,
+    -4066, -4293,  3844, -4531, -1946, -2508, -2718, -1419,
+     1353, -2020,  1574,  5325,  5840, -1807,  3951, -6035,
+    -5399,  2729, -2893, -2175,   384,  2642,  4098,  2465,
+     4254,  -302, -5678, -4375,  5010,  -477,  3158,   862,
+     5532, -2646,  -104,  5941, -1354,   541, -5617,  -179,
+     6058,  1101,   517,  2725,  4604,  1210, -3863,  1008,
+    -5763,  5089,   135,  3041,  -842, -4129,  -153, -5085,
+      273, -1770, -2271, -3912, -5225,  2006,   116,  -482,
+      927, -5335,  -284, -2210,  3865,  1950, -5413, -5688,
+    // Montgomery companions
+         0,  -7887, -21561,  27443,  30590,  22046,   6959,   3850,
+      6463,  -8778, -17039,  31251,  18889,  18686,  19310, -13572,
+     31080,  26787,  24483, -30547, -17748,  30808,   7205, -26547,
+     14074, -25710,  13999,  -5061,  14633,  16031, -15865,  -3002,
+    -12618,  16271, -26110, -15801,  23038,  -5333,  16484,    432,
+     22691,   6277,  -8719,  14761,  -3872, -24590,   9882,    747,
+      4213,   5093,  -6239,  12367,  17071,  16073,   7071, -27123,
+      5664, -12234,  25625,  18948,  19796, -16719,  14649, -25843,
+     -7365, -13466, -22276,  19113, -26606, -28430, -22814,   8922,
+     13162,   1808,  -2901, -30883,   2560, -15156,  -5450,     48,
+     -4410,  30755,  -5082,  19988,    629,  13204, -11716, -27022,
+    -28659,  15129,   -693,  23219,  23742, -12778, -21060, -17577,
+      7615,  -9045, -12938,   1781,  30691, -24702,  23401,   6719,
+     10735,  17540,  17284,   3888,  27155, -11140,  15364, -17513,
+    -14564,  20969, -31523, -26078, -18446, -19396,    773,  29555,
+     22563,  13588,  -1893,  18036,   9381, -19769, -19700,  27619,
+     27704,  14825,   7914, -26105,  12292,  26888,  21614, -14106,
+    -23315, -11594, -23539, -15183, -21636, -17444,  17940,  -9007,
+     19390, -26334,  14420,  28216,  -8869,  -9477,  -7605,  24819,
+     26233,    603,  20878,  11551,    853,  16793, -23662,     16,
+     12639,  15279, -18718, -28435, -14324, -17316,  21214, -15833,
+     16991,  28835,  11338,  -8693,  -6149,  15380, -21588, -11994,
+      2538,  18830, -26158, -21252, -11615,  -8234,  29646,   2240,
+      3578, -15999, -16084,   1296, -12794,  18132, -16724, -27683,
+    -13231,  26728, -15247,  -5573,   1888, -25923,  30387, -15529,
+    -20441, -20148,  -2080,   4122,   5690,  27203,   2357,  12804,
+    -26051,   5424,  -8703, -27112,   7679,  20068, -16351,    144,
+    -14282, -19753,  -2906,  26766,  -1291,  -8197,  25139,  22094,
+     21844,  -2629, -29032, -12698,  10197,   7349,   2320,  23129,
+      2154, -24771,  -5680, -11428,  28142,   6229,   6437,  17321,
+     32205, -12916, -13684,  11663,  15929,  32115, -19444,  12996,
+     26537,  -8570,   4666,  20158,  26723,   5344, -27134, -22846,
+     21758,   2245,  19209, -32360, -24659,  32408, -17401,  19198,
+    -25502,  31389, -16153,  29832,   2688, -22468, -12276,  -3226,
+      5200,  22462, -15167, -18335,  -5893,    757,  30296, -18542,
+    -10431, -26712,  32040,   4720,  -1285,   -309, -18836,  -5349,
+    -31325,   3610,  32291, -17791, -16927,    277, -14751,   7055,
+     21102,  15140, -11343,    805,   2298,  -8421, -13359, -31496,
+    -18569,  -4197,  29160,   5386,  16676,  22233, -15572, -27950,
+     26968, -25054, -18372,  25491, -26195, -10927,  -1024,  -7045,
+     32627,  20361, -14308,   6346,  24190,  -5600,  20585, -29038,
+    -25326,  29528, -25539, -23822, -23726, -29096,  20206,    784,
+    -28344,  21732,  26217, -23059, -11567,  -2784,  27086,  17396,
+     12500,   6815,  10522,  29726,  -5429,  31597,   5552,  18740,
+     -6687,   5189,  28984,   7247,  20686, -10250,  10842, -21321,
+    -21268,   2496,  -1685,  -2037,  28472, -29043,  32493,  19785,
+    -19428, -28878,  31261, -32723,  26387,  32728,  -9215,   2133,
+     19012,   3488,  -9077,  10596,    299, -17060,  27763, -29486,
+     15599,   1851,  20036,  10532, -17679,   2272,  25353,   9909,
+    -31293, -14601,  30584,  14159,  -3856,   -928,   9029, -16047,
+    -10970,  28632,  17076,  23961,   8063,  -1867,  28707,  -9679,
+     -8442,  31688,  13332,  -7941,  -7909, -31544,   6735,    261,
+      9829, -12591,  21945,  16159, -15508,   1163,  18820, -18313,
+     15369,  -9626,  10420,  10938, -13050,  32755,  -3072, -21134,
+     -2229, -20116,  31507,   2416,   6895, -25262,  25459, -28952,
+     14756,    832,  21284,  21166,  31336,  12164,  10831,  28440,
+    -19497,   -341,  13114,  -3642,  30835,  -8351,  15721, -13348,
+    -28035,  20446,  31565,  23641, -16287,  29256,  16655,  -9317,
+    -10442,  23049, -11082,  -5930,  -5642, -21753,  -4917,   2352,
+      7034, -16799,  -3781, -21577,  22611,  19038,  -4453, -32344,
+      7253, -21097,  28248, -32632,  13626,  32648, -27646,   6399,
+     -8501,  10463, -27230,  31789,    896,  14356,  17753, -22921,
+      1733,   7487,  -5056,  -6112,  19881, -21593,  31944,  -6181,
+     -3477, -30749,  32525,   1573,  21417,  21742,  15567,  20062,
+     -5408,  -2389,  26259, -25497,  19236,   7077, -21022, -27902,
+       363,  12052,  24350, -31123,  17065,   8186, -14489,    320,
+     -7557,  30270, -12036,  24025,  26041, -21198,  31117,  16463,
+    -16297,  13482, -26467, -19966,  27208,   2197, -31171, -29800,
+    -14767, -16607,   1131, -31816,  29843,  31928,   3088, -20740,
+      6032,   7706,   6000,  25918,   6271, -30579,  -6799, -29374,
+     12132, -13124,  30147,  22755,   8095, -20078,  27000,  22270,
+    -24339, -18638,  31069,  11012,  18846,  21124, -22105,   9365,
+      3264, -22601,  22542, -17961,  22516,   8138,    667,   2880,
+    -23486,  -1845,   7407,  11028, -25811,  32675, -21502, -16868,
+    -15604,  -9738,  23939,  16911, -17268,  19774, -18393,  -6058,
+    -27779,   5824,  17913,  17092,  22745,  19614,  10282,   2474,
+    -11252,   3818, -11540, -28883,  -9093, -13066,   4341,  -2218,
+      6442,  25209,  27790,   9951,  10175, -24201, -18388,   1829,
+    -22446,  28862,  17481, -31960, -26990,  -6495,  -2336,  18745,
+      7322,  15903, -19140,   3824,   9178,   8191,  12954,  21881,
+    -22670,  25273,  29427,   6538,  12586,   1941,  27816, -16148,
+     16644, -25091, -13866,   5637,  16089,   6591, -27976, -23865,
+      1088, -29379,   7514, -27832, -14340,  24558,  22068,    960,
+     -7829,  21230,   2469, -18169,  13242, -10954,  -7167,  16223,
+    -29139,  26163,  24905,   2730,  24286,   5301,  15465,   1275,
+     -7482,   9621,  27672, -32499,  -8997,  -2165,   -779,  28094,
+     18095,  23118,  17999,  12218,  18814, -26201, -20398, -22585,
+     23993,  30248,   9263,   3317,   3392, -29912,  15716, -21236,
+     18724, -29214,   6282, -14804,  13732,  -6213,  10356, -18175,
+    -17801,  17471, -11796, -14260,   2698,  -6693,  30845,   7423,
+     -4922,  -5536,  22222, -32451, -11898,  32488,   1029,  14932,
+      2011,  24414,   2000,   8639,   2090,  11652,  -2266,  -9791,
+     -1803,  21049, -13092, -30344, -15433, -19486,  -7007,  -9301,
+     21966, -17828,   8117,  11471,  27534,  24574, -26675,    107,
+     19326,  10090,  17833,  29854,  30526,  -7066,  10372,   5488,
+    -27278,  26339,  13023,  -6655,  30915, -21113,  11455, -31779,
+    -22787, -17177,  13839,  20462,  30195,  28206, -15684,   3024,
+     27768, -21598,   4501, -27742, -27102,  24478,   3637,   5226,
+     29491, -29886,  21860,  21033, -11578, -18558, -16036,   6746,
+    -25891, -20100, -17236,   1563,   7498,  14042, -28526,  15705,
+     20953,  -9098, -25225, -17220,   6837,  19049, -15103,  10778,
+    -32557,  16639,  32456,  30110, -28638, -18857,  20014, -21017,
+    -20292,   4090,  11802,  22148,   1152,   -267,   4101, -29470,
+     17519,  23251, -16820,  26952, -19854,  -4506,  10324,     37,
+    -12228,   2224, -25027,  12468,  18228,  23694,  32733, -18500,
+      9610,  -8293, -10085,  27214,  -6522, -12447, -23523,   8479,
+     29123,  15711, -24051,  14063,   1947,  -4698,   5413,  10276,
+     26872,  29582, -13252,  -4821,    128,  -7311,  -6826,  -3274,
+    -30872,  18676,  29960,   8842,   4405,  26894, -16479,   7455,
+     -4005, -25166,  -4853,  31464, -30414, -23907, -16345,   8031,
+     26595,  12655, -20308, -19572,  17919,  24979,  27384,    336,
+     10367,  -2400, -28627,  -3082, -24857,   2720, -28723, -13983,
+     22937, -24121,     43,  -2437,  30803,   9861,  17428,  20238,
+    -12138,   5237,  13828,   4688,  22494, -23411, -20041, -18420,
+     17769,    741,  13503, -17689, -15769,   7898,  10911,  15679,
+     25049,  19081,  18484,   9071, -24019,  -4149,  14004,   2826,
+      4661,  12271, -30131,    907,   3456,   -800,  12303, -22873,
+    -12980,   4218,  15076,  15321,   5973, -13519,  30973,    112,
+    -32136, -15620,  31832,  24793, -20377,   8965,  -5493,   2485,
+     20510,  -8389,  20228,  32333, -10138,  13876, -27294,   2677,
+     21833, -18404,  -6618, -23347,   5840, -14095,  16239,  30829,
+     15081,  23209,  25779, -14463,    384, -21934, -20478,  -9823,
+     28830, -24878, -30254,  16105, -19566,  28195,  -5034,  25438,
+    -10852,   5546,  32664,  10037,  -9546, -28131,   6671, -28851,
+     14250, -27571,   4613,   6821, -11780,   9402,  16617,   1008,
+     31101,  -7199, -20345,  -9247,  -9034,   8159, -20633,  23587,
+    -12015,  -9962, -14559,  28856, -25705,  -6186,  16500,  24094,
+     13215,  15145,  16100,  22366,  24345,  26526,  -9509,  27080,
+};
+
+const int16_t ntt_mont1024_inv_mixed_powers[2048] = {
+        0, -4401,  1229,  1081,  4342,  2530,  5329, -6014,
+    -2812, -2579,  5890,   586,  5266,  4751,  1591,  5825,
+    -5190, -2125,   965,  1875, -3743,  1960,  1134,  1885,
+    -4615, -3109, -1711,  4189,  5847,  1364, -5882,  1688,
+    -2829, -4843, -1549,  -432, -2564,  5719,   -79, -4679,
+     4431,    14,  4407,  1237,  4042, -2181,  -997, -3983,
+     5831, -1690,  5217,  -100, -5145, -3569, -6049,  1534,
+    -3412,  3872, -4783,  1538, -5664,  5981,  -117,  4426,
+     1053, -2903, -2967,   -48,  -883,  2446,  5569,  -730,
+    -1652,  5453, -3888,  2211,  1502, -3604,  2315,  1367,
+     -711,  4586, -5244, -1228,  3012,  3180,   126,  3854,
+     2796,  5351, -1156, -1808,  -489, -2083,  4949,  5274,
+     3316,  4676,  1020, -2742,  3323, -4668, -2921, -1762,
+    -2203, -3403,  -900, -1195,  2851, -3110,  4746,  5892,
+    -5285,   834,  1517, -2560, -6130,  3467, -2019,  2030,
+     6109,   -13,  1553, -4970, -1820, -3782,  4673,  3269,
+    -1730,  -989,  2482,   -16,  3159,  3802,  3580, -3281,
+     3388, -2240,  -144,  3853, -2649, -4647, -4951,  5914,
+     4418, -1296, -2190,   737, -4956,  4597,  4070,  2895,
+      625,  4868, -5656,  4552,  4506,  -237,  1477,  5625,
+    -5344, -1748,  4101,  3687, -2133,  1004,  1469,  1060,
+    -3443,    42, -3684,  5381, -3253,   932, -2749,  5880,
+      378,  3711,  -727, -4699, -3901,  -163,  3764,  3402,
+    -3468,  5746, -5424,  1758, -1467, -2991,  6040,  5655,
+     2558,   340,  3533,  -914, -2341,  5204,  1739, -1556,
+     3060, -5070,  4063,  3509, -2320,  3362, -1715,  2962,
+     3526,  -300, -5286,  3698,  5680, -3146,  2080, -5133,
+    -2700,  1582, -3585,  1964, -3736, -5858,  2959,   278,
+     1949,  4602,  5387,  3243, -3566,  2053,  2502,  5252,
+     4551,  -673,  4609,  4773, -6101, -2060, -1888,  4092,
+    -6057,  4614,  6090, -5753,  6038, -4703,   -39, -5357,
+     4659,  5654, -2621,  5186, -5460,  -351,   943,  5064,
+     4514,  4910,  4328,  2949,  -424, -2356,  3835,  1253,
+     2441,   695, -3442, -1272,  5221,  -784,  3759, -4966,
+     2085,  1963, -3816,  3374, -2352, -1012, -2609, -6034,
+     5889,   841, -2167,  5233, -3036,  4462, -5813,  5378,
+     2523,  5788,  3410,  3181,  1097, -5150,  3845, -4720,
+     5075, -2059, -2746,  3291, -3161,  -754, -1871,  2936,
+     6112,  4051, -2416,  2806, -2262, -5613, -3481,  6047,
+     -136,  5041, -3871,  5503, -4550,  1846,  5852,  -408,
+     2834,   676,  4220, -1361,  5538,  5267, -1224, -3787,
+     2028,   371, -4083,  4325,  3512, -3672,   928,  6084,
+     1113,    40,   686, -1753,  1273,  2784,  5963,  3339,
+      120,  2058, -5259,  3819, -3937,  5600, -2272,   360,
+    -6115, -3488,  -832,   478,  4511,  5473,  1080, -6056,
+     1825, -2496,  1434,  1244,  4130,  3240, -5879,  5475,
+     4801,  4302,  3732,   101, -2569, -5348,  4136,  2114,
+      617, -1093,   303,  4582, -3755,   119, -5947,  1851,
+    -3279,   909,  1457,  1024,   357, -5552,  5553,  2452,
+     2727,  4371,  3072,  1071, -4367,  4370, -4933, -4108,
+      824, -3073,  3213,  -812,   821, -2510,   -35,  2472,
+     3070, -2650, -2436,  2463,  4759,  -105, -4873, -3079,
+     4339,  4981, -4900,  1988,  -315, -2330,  3052,   728,
+     2654, -2411,  5964,  -945,  5299, -3133,  2184, -4327,
+     5056,  5603, -2835,  3608,  2890, -5737,  -692,  2879,
+     4520,  3784, -1465, -3619, -4922, -2076, -3652,  1271,
+     -937, -4395,  1432, -2477,  6061,  1333,  3813, -2811,
+     -896,  4296,  4858,  5894,  3999,  -850,  3856, -2688,
+      599,  2285,  5393,  -292, -2550,  -721,  4225,  1797,
+    -5434,  3890,  -876,  4639, -2163,   386,  5391, -4013,
+     -619, -2628,  1628,  5800,  1158,  3884,   250, -1857,
+     4405,  4884,  5111,  3474,  -637,   750, -5571,   926,
+     2363,  3044, -1867, -1911,  2250, -4424,  2778, -5200,
+    -3157, -5601, -5733, -5539,  -983, -3955, -3311,  2818,
+     5688,  3107,  1695, -1401,  1419,  4852,  4059, -5269,
+      179, -2497, -4918,  5718,  5366, -3935,  4775, -2968,
+     5085, -4203,  4257,  2267,  -112, -3518,   537,  4798,
+    -2465,  4865,  3809,   484,  2036,  3385,  2966,  -320,
+      482, -5488,  -336,  1735,  1611,  2105,  4894,  2306,
+     -862,  1452,  6108, -2134, -3391,  -960,  1446, -4175,
+    -1008,  5205,  4833, -5974,  2393, -5371, -2586,  4356,
+     6035,  5887,  2116, -2880,  4338,  -236, -3024,  3326,
+     2210, -5633, -5110, -3824,  4531,   779,  5816,  5372,
+    -5941,  3649,   725,  -708,  3217, -2311, -5659, -4610,
+    -3041,   817,  1304,  2337,  5159,  3827, -5534, -1342,
+     2175, -2124, -2638,  5356, -4688, -1541,  3166,  2451,
+     3912, -5278,  3188,  -808, -4313, -4026, -5764,  5917,
+     4375,  3779, -1775, -4623, -2791, -4936,  -553, -3545,
+    -2725, -2424,  -650,   211, -5003,  5462,   836,  -952,
+    -5325, -1580,  3916, -2519, -1659,  1654,  4114,  5017,
+    -1950,   633, -2720,  4097,  2508, -2856, -3686, -4740,
+     -541,  4732, -4977,  4962,    53,  2762, -5850,  1899,
+     4129,     2, -4765,  3721,  1231, -1931, -1623,  1907,
+    -2642,  2597,   159, -4003, -5261,  5697,    98,     6,
+    -2006, -1126,  3693, -5793, -4869,  5721,  4363, -4498,
+      477,   280, -3494,  4802,   294,    18, -6018, -3378,
+    -1210, -5090, -2318,  4874,   800, -1205,  1431,   840,
+     1807,  2117,   882,    54, -5765,  2155, -3630, -2981,
+     5335,  2333,  2400, -3615,  4293,  2520,  5421, -5938,
+     2646,   162, -5006, -5824,  1399,  3346,  3716, -5290,
+    -5089,  1444,   590, -4729,  3974, -5525, -4351,   486,
+    -2729, -5183,  4197, -2251, -1141, -3581, -2978,  4332,
+     1770, -1898,  -367, -4286,  -764,  1458,  4102, -3260,
+      302,  5536, -3423,  1546,  3355,   707,  5310, -5694,
+    -1101,  -569, -2292,  4374,    17,  2509,   906,  4319,
+     2020,  4638, -2224,  2121,  3641, -4793, -3303, -1707,
+     5413,   833,    51, -4762,  2718,   668,  6060,  1625,
+     5617, -5926, -1366, -2090,  2380, -5121,  3950,  2499,
+      153, -1997, -4135,  2004,  5891,  4875,  4562, -5489,
+    -4098,  6019, -5149, -3074,  -439, -4792,   459, -5991,
+     -116,  6012,  5384,  2336,  1397, -4178,    -5,  5768,
+    -3158,  3067, -1317, -2087,  1377, -5684,  -348,  5747,
+     3863, -5281,  4191,  -245,   -15,  5015,  2815, -3088,
+    -3951,  6028,  4131, -4763, -1044,  4952,  -700, -3554,
+      284,  -735,   -45,  2756, -3844,  3025,   436,  5795,
+      104, -2000, -3132,  2567, -2100,  1627,   852, -2205,
+     -135, -4021,   757, -3214,  1308,  5096,   312, -6000,
+     2893, -4588,  5989,  4881,  2556,  5674,  -405,   226,
+     2271,  2647,  3924,  2999,   936, -5711, -3610, -1475,
+     5678,  2354, -4621,  4733, -1215,   678, -5476, -4348,
+     -517, -3292,  2808, -4844,  1459, -4425,  4745, -5227,
+    -1574,  1910, -3645,  2034, -4139,  -755, -1551,  2413,
+    -3865, -2243,  4377,  -986,  1946, -3392, -4722,  5730,
+     1354,  6102,  -128, -2265, -4653, -5050,   694,  5560,
+      842, -2958,  5838,  2113, -1877,  4901,  4062,  6017,
+     -384,  5494, -1670, -2861,  2082,  4391,  2526,  3415,
+     5225, -5950, -5631,  2414,  -103,  5762, -1152,  4193,
+    -5010,  3706, -6043,   884, -4711, -2044,  3386, -5561,
+    -4604, -5047,  -309,  4997, -3456,   290, -2741, -1171,
+    -5840,  2652, -1844, -6132, -2131, -4394, -1523, -2852,
+     -927,  2702,  1921,   870,  4066, -3513, -5231, -4333,
+    -5532, -6107,  5896,  -893, -4569,  3733, -2781, -4183,
+     5763,  2610,   -91,  1750, -3404,  -710, -4307, -6032,
+     5399, -2679, -1418, -1090,  3946,  -260,  5000, -4459,
+     -273,  5250,  2077, -2130,  -632, -5807,  3908,  4252,
+    -4254, -3270,  -451,  -780,  2711, -1088,  -819,  3461,
+    -6058,  5899, -1896, -5132,  -565,   467,  -473,  2479,
+    -1353, -2340, -4156, -3264, -2457, -1906, -5885,  5408,
+    // Montgomery companions
+         0,   7887, -27443,  21561,  -3850, -22046,  -6959, -30590,
+     13572, -31251, -18686,   8778, -19310,  17039, -18889,  -6463,
+      3002,  26547,   5061,  30547, -16031, -30808,  25710, -26787,
+     15865,  -7205, -13999, -24483, -14633,  17748, -14074, -31080,
+     25843,   -747,  27123,   -432, -18948, -14761, -12367,  15801,
+     16719,  24590, -16073,   5333,  12234,  -6277,  -5093, -16271,
+    -14649,  -9882,  -7071, -16484, -25625,   8719,   6239,  26110,
+    -19796,   3872, -17071, -23038,  -5664, -22691,  -4213,  12618,
+    -27619,  17577,  17513,    -48, -29555,  27022,  -6719,  -8922,
+    -18036, -23219,  -3888,  30883,  26078, -19988,  -1781, -19113,
+     19769,  12778,  11140,  15156,  19396, -13204,  24702,  28430,
+    -13588, -15129, -17540,  -1808, -20969, -30755,   9045,  13466,
+     19700,  21060, -15364,   5450,   -773,  11716, -23401,  22814,
+      1893,    693, -17284,   2901,  31523,   5082,  12938,  22276,
+     -9381, -23742, -27155,  -2560,  18446,   -629, -30691,  26606,
+    -22563,  28659, -10735, -13162,  14564,   4410,  -7615,   7365,
+     22846,  27683, -22094,    -16, -17321,  11994, -12804,   9007,
+    -12996,  -2240,   -144, -24819, -23129,  15833,  15529,  14106,
+    -20158,  -1296, -26766, -11551,  11428,   8693,  -4122,  15183,
+    -11663,  21252,  27112, -28216,  12698,  28435,   5573,  26105,
+     -5344, -18132,   8197, -16793,  -6229, -15380, -27203,  17444,
+    -32115,   8234, -20068,   9477,  -7349,  17316,  25923, -26888,
+      8570,  15999,  19753,   -603,  24771, -28835,  20148,  11594,
+     12916, -18830,  -5424,  26334,   2629, -15279, -26728, -14825,
+     27134,  16724, -25139,  23662,  -6437,  21588,  -2357, -17940,
+     19444, -29646,  16351,   7605,  -2320, -21214, -30387, -21614,
+     -4666,  16084,   2906, -20878,   5680, -11338,   2080,  23539,
+     13684,  26158,   8703, -14420,  29032,  18718,  15247,  -7914,
+    -26723,  12794,   1291,   -853, -28142,   6149,  -5690,  21636,
+    -15929,  11615,  -7679,   8869, -10197,  14324,  -1888, -12292,
+    -26537,  -3578,  14282, -26233,  -2154, -16991,  20441,  23315,
+    -32205,  -2538,  26051, -19390, -21844, -12639,  13231, -27704,
+    -20062,  29486, -28440,   7045,  32344, -18740,   -261,   5349,
+     22921, -19785,  21134,  31496,   9317,   -784,  16047,   3226,
+      6181,  -2133,  28952,  27950,  -2352, -17396,   9679,  18542,
+     -6399,  21321,  18313,  -7055,  13348,  29038,  -9909, -19198,
+     -1573, -10596, -21166, -25491,  21577, -29726,   7941,  -4720,
+    -31789,   2037, -10938,   -805, -23641,  23822, -14159, -29832,
+      6112,  32723,  -2416,  -5386,   5930,  23059, -23961,  18335,
+     32632,  -7247, -16159,  17791,   3642,  -6346, -10532,  32360,
+    -21742,  17060, -12164,  10927, -19038, -31597,  31544,    309,
+    -14356,  29043, -32755,   8421, -29256,  29096,    928,  22468,
+     21593, -32728,  25262, -22233,  21753,   2784,   1867,   -757,
+    -32648,  10250,  -1163,   -277,   8351,   5600,  -2272, -32408,
+     30749,  -3488,   -832,  25054,  16799,  -6815, -31688,  26712,
+    -10463,  -2496,   9626, -15140, -20446, -29528,  14601, -31389,
+     -7487,  28878,  20116,   4197, -23049, -21732, -28632, -22462,
+     21097,  -5189,  12591,  -3610,    341, -20361,  -1851,  -2245,
+    -15567, -27763, -10831,   1024,   4453,  -5552,  -6735,  18836,
+    -17753, -32493,   3072,  13359, -16655, -20206,  -9029,  12276,
+    -31944,   9215, -25459,  15572,   4917, -27086, -28707, -30296,
+     27646, -10842, -18820,  14751, -15721, -20585, -25353,  17401,
+    -32525,   9077, -21284,  18372,   3781, -10522, -13332, -32040,
+     27230,   1685, -10420,  11343, -31565,  25539, -30584,  16153,
+      5056, -31261, -31507, -29160,  11082, -26217, -17076,  15167,
+    -28248, -28984, -21945, -32291, -13114,  14308, -20036, -19209,
+    -21417,   -299, -31336,  26195, -22611,   5429,   7909,   1285,
+      -896, -28472,  13050,  -2298,  16287,  23726,   3856,  -2688,
+    -19881, -26387,  -6895, -16676,   5642,  11567,  -8063,   5893,
+    -13626, -20686,  15508,  16927, -30835, -24190,  17679,  24659,
+      3477, -19012, -14756, -26968,  -7034, -12500,   8442,  10431,
+      8501,  21268, -15369, -21102,  28035,  25326,  31293,  25502,
+     -1733,  19428,   2229,  18569,  10442,  28344,  10970,  -5200,
+     -7253,   6687,  -9829,  31325,  19497, -32627, -15599, -21758,
+    -27080,  31779,  13983, -21881,  -2677,  21236,    -37,  -9365,
+     28851,   9791,   3274,  -2474,  -2826, -16223, -15705,  29800,
+    -23587,   -107,  -8031,  -1829,   -112, -28094,  21017,  29374,
+      9823,  -7423,  -8479,  16868,  18420,  23865,  -5226,   -320,
+    -24094,  -5488,   -336, -18745,  -2485,  22585,  29470, -22270,
+    -25438, -14932, -10276,   6058, -15679,   -960,  -6746, -16463,
+     -1008,   9301,  -7455,   2218,  22873,  -1275, -10778,  20740,
+    -30829,  18175,  18500,  -2880, -20238,  16148,  -3024,  27902,
+    -22366,   6655,   3082,  -3824, -32333,  -3317, -26952, -11012,
+    -10037,  -8639,   4821, -17092,  -9071,  18169,  -1563,  19966,
+      9247, -11471, -31464,  -9951, -15321,  32499, -30110, -25918,
+     14463,  14260, -27214, -11028,  -4688,  -5637,  27742,  31123,
+    -28856, -29854,  19572,  31960, -24793, -12218, -22148, -22755,
+    -16105,  32451, -14063, -16911,  17689,  27832, -21033, -24025,
+     -6821,  30344,  -8842,  28883,   -907,  -2730,  17220,  31816,
+     23347,  14804, -12468,  17961,   2437,  -6538, -20462,  25497,
+    -26526,  21113,  -2720,  -8191, -13876,  29912,   4506, -21124,
+     28131, -11652,   7311, -19614,   4149,  10954, -14042,  -2197,
+     -8159, -24574,  23907,  24201,  13519,   2165,  18857,  30579,
+     21934,   6693,  12447, -32675,  23411,  -6591, -24478,  -8186,
+      6186,   7066, -24979,   6495,  -8965,  26201,    267,  20078,
+    -28195, -32488,   4698, -19774,  -7898, -24558,  18558,  21198,
+     -9402,  19486, -26894,  13066,    800,  -5301, -19049, -31928,
+     14095,   6213, -23694,  -8138,  -9861,  -1941, -28206,  -7077,
+    -15145, -26339,   2400, -15903,   8389, -30248, -23251,  18638,
+     -5546, -24414, -29582,  -5824, -19081, -21230,  20100, -13482,
+      7199,  17828,  25166, -25209,  -4218,  -9621, -16639,  -7706,
+    -23209, -17471,   8293,   1845,  -5237,  25091,  21598, -12052,
+      9962, -10090, -12655, -28862,  15620, -23118,  -4090,  13124,
+     24878,   5536, -15711,   9738,   -741,  29379,  29886, -30270,
+     27571, -21049, -18676,  -3818, -12271, -26163,   9098,  16607,
+     18404,  29214,  -2224,  22601,  24121, -25273,  17177,   2389,
+      9509, -11455,  28723, -12954,  27294, -15716, -10324,  22105,
+     -6671,   2266,   6826, -10282, -14004,   7167,  28526,  31171,
+     20633,  26675,  16345,  18388, -30973,    779, -20014,   6799,
+     20478, -30845,  23523,  21502,  20041,  27976,  -3637,  14489,
+    -16500, -10372, -27384,   2336,   5493,  20398,  -4101, -27000,
+      5034,  -1029,  -5413,  18393, -10911, -22068,  16036, -31117,
+    -16617,   7007,  16479,  -4341, -12303, -15465,  15103,  -3088,
+    -16239, -10356, -32733,   -667, -17428, -27816,  15684,  21022,
+    -16100, -13023,  28627,  19140, -20228,  -9263,  16820, -31069,
+    -32664,  -2000,  13252, -17913, -18484,  -2469,  17236,  26467,
+     20345,  -8117,   4853, -27790, -15076, -27672, -32456,  -6000,
+    -25779,  11796,  10085,  -7407, -13828,  13866,  -4501, -24350,
+     14559, -17833,  20308, -17481, -31832, -17999, -11802, -30147,
+     30254, -22222,  24051, -23939, -13503,  -7514, -21860,  12036,
+     -4613,  13092, -29960,  11540,  30131, -24905,  25225,  -1131,
+      6618,  -6282,  25027, -22542,    -43, -29427, -13839, -26259,
+    -24345, -30915,  24857,  -9178,  10138,  -3392,  19854, -18846,
+      9546,  -2090,   -128, -22745,  24019, -13242,  -7498, -27208,
+      9034, -27534,  30414, -10175,  -5973,   8997,  28638,  -6271,
+      -384,  -2698,   6522,  25811, -22494, -16089,  27102, -17065,
+     25705, -30526, -17919,  26990,  20377, -18814,  -1152,  -8095,
+     19566,  11898,  -1947,  17268,  15769,  14340,  11578, -26041,
+     11780,  15433,  -4405,   9093,  -3456, -24286,  -6837, -29843,
+     -5840, -13732, -18228, -22516, -30803, -12586, -30195, -19236,
+    -13215,  27278, -10367,  -7322, -20510, -23993, -17519,  24339,
+     10852,  -2011, -26872,  27779, -25049,   7829,  25891,  16297,
+    -31101, -21966,   4005,  -6442,  12980,   7482,  32557,  -6032,
+    -15081,  17801,  -9610,  23486,  12138, -16644, -27768,   -363,
+     12015, -19326, -26595,  22446,  32136, -18095,  20292, -12132,
+    -28830,   4922, -29123,  15604, -17769,  -1088, -29491,   7557,
+    -14250,   1803,  30872,  11252,  -4661,  29139, -20953,  14767,
+    -21833, -18724,  12228,  -3264, -22937,  22670,  22787,   5408,
+};
+
+const int16_t ntt_mont1024_inv_mixed_powers_rev[2048] = {
+        0, -4401,  1229,  1081,  4342,  5329,  2530, -6014,
+    -2812,  5266,  5890,  1591, -2579,  4751,   586,  5825,
+    -5190, -4615, -3743,  5847,   965, -1711,  1134, -5882,
+    -2125, -3109,  1960,  1364,  1875,  4189,  1885,  1688,
+    -2829,  5831,  4431, -3412, -2564, -5145,  4042, -5664,
+    -1549,  5217,  4407, -4783,   -79, -6049,  -997,  -117,
+    -4843, -1690,    14,  3872,  5719, -3569, -2181,  5981,
+     -432,  -100,  1237,  1538, -4679,  1534, -3983,  4426,
+     1053,  3316,  -711, -5285, -1652, -2203,  2796,  6109,
+     -883,  3323,  3012, -6130,  1502,  2851,  -489, -1820,
+    -2967,  1020, -5244,  1517, -3888,  -900, -1156,  1553,
+     5569, -2921,   126, -2019,  2315,  4746,  4949,  4673,
+    -2903,  4676,  4586,   834,  5453, -3403,  5351,   -13,
+     2446, -4668,  3180,  3467, -3604, -3110, -2083, -3782,
+      -48, -2742, -1228, -2560,  2211, -1195, -1808, -4970,
+     -730, -1762,  3854,  2030,  1367,  5892,  5274,  3269,
+    -1730,  2558, -5344,  1949,  4418,  3526,   378, -6057,
+     3388,  3060, -3443,  4551,   625, -2700, -3468,  4659,
+     3159, -2341, -2133, -3566, -4956,  5680, -3901,  6038,
+    -2649, -2320, -3253, -6101,  4506, -3736, -1467, -5460,
+     2482,  3533,  4101,  5387, -2190, -5286,  -727,  6090,
+     -144,  4063, -3684,  4609, -5656, -3585, -5424, -2621,
+     3580,  1739,  1469,  2502,  4070,  2080,  3764,   -39,
+    -4951, -1715, -2749, -1888,  1477,  2959,  6040,   943,
+     -989,   340, -1748,  4602, -1296,  -300,  3711,  4614,
+    -2240, -5070,    42,  -673,  4868,  1582,  5746,  5654,
+     3802,  5204,  1004,  2053,  4597, -3146,  -163, -4703,
+    -4647,  3362,   932, -2060,  -237, -5858, -2991,  -351,
+      -16,  -914,  3687,  3243,   737,  3698, -4699, -5753,
+     3853,  3509,  5381,  4773,  4552,  1964,  1758,  5186,
+    -3281, -1556,  1060,  5252,  2895, -5133,  3402, -5357,
+     5914,  2962,  5880,  4092,  5625,   278,  5655,  5064,
+     4514, -3279,  2834,  -937,  2523,  4339, -6115,  -619,
+     2085,   824,  1113,   599,  6112,  5056,  4801,  2363,
+     2441,  2727,  2028,  -896,  5075,  2654,  1825,  4405,
+     5889,  3070,   120, -5434,  -136,  4520,   617, -3157,
+     -424,   357,  5538,  6061,  1097,  -315,  4511,  1158,
+    -2352,   821,  1273, -2550, -2262,  2890, -2569,  2250,
+     5221, -4367,  3512,  3999, -3161,  5299,  4130,  -637,
+    -3036,  4759, -3937, -2163, -4550, -4922, -3755,  -983,
+     4328,  1457,  4220,  1432,  3410, -4900,  -832,  1628,
+    -3816,  3213,   686,  5393, -2416, -2835,  3732, -1867,
+    -3442,  3072, -4083,  4858, -2746,  5964,  1434,  5111,
+    -2167, -2436, -5259,  -876, -3871, -1465,   303, -5733,
+     3835,  5553, -1224,  3813,  3845,  3052,  1080,   250,
+    -2609,   -35,  5963,  4225, -3481,  -692,  4136,  2778,
+     3759, -4933,   928,  3856, -1871,  2184, -5879, -5571,
+    -5813, -4873, -2272,  5391,  5852, -3652, -5947, -3311,
+     4910,   909,   676, -4395,  5788,  4981, -3488, -2628,
+     1963, -3073,    40,  2285,  4051,  5603,  4302,  3044,
+      695,  4371,   371,  4296, -2059, -2411, -2496,  4884,
+      841, -2650,  2058,  3890,  5041,  3784, -1093, -5601,
+    -2356, -5552,  5267,  1333, -5150, -2330,  5473,  3884,
+    -1012, -2510,  2784,  -721, -5613, -5737, -5348, -4424,
+     -784,  4370, -3672,  -850,  -754, -3133,  3240,   750,
+     4462,  -105,  5600,   386,  1846, -2076,   119, -3955,
+     2949,  1024, -1361, -2477,  3181,  1988,   478,  5800,
+     3374,  -812, -1753,  -292,  2806,  3608,   101, -1911,
+    -1272,  1071,  4325,  5894,  3291,  -945,  1244,  3474,
+     5233,  2463,  3819,  4639,  5503, -3619,  4582, -5539,
+     1253,  2452, -3787, -2811, -4720,   728, -6056, -1857,
+    -6034,  2472,  3339,  1797,  6047,  2879,  2114, -5200,
+    -4966, -4108,  6084, -2688,  2936, -4327,  5475,   926,
+     5378, -3079,   360, -4013,  -408,  1271,  1851,  2818,
+     5688,  5413, -1950, -3865,  2210,   284,  5335,  -927,
+      482,  -116, -2006,  5225,  3912,  2271,  1770,  -273,
+     5085,   153,  4129,   842, -3041,  -135, -5089,  5763,
+    -1008,  3863, -1210, -4604, -2725,  -517, -1101, -6058,
+      179,  5617,  -541,  1354, -5941,   104,  2646, -5532,
+     -862, -3158,   477, -5010,  4375,  5678,   302, -4254,
+    -2465, -4098, -2642,  -384,  2175,  2893, -2729,  5399,
+     6035, -3951,  1807, -5840, -5325, -1574,  2020, -1353,
+     1419,  2718,  2508,  1946,  4531, -3844,  4293,  4066,
+     1611,  1397, -4869,  -103, -4313,   936,  -764,  -632,
+     -112,  5891,  1231, -1877,  5159,  1308,  3974, -3404,
+     2393,   -15,   800, -3456, -5003,  1459,    17,  -565,
+     5366,  2380,    53, -4653,  3217, -2100,  1399, -4569,
+    -3391,  1377,   294, -4711, -2791, -1215,  3355,  2711,
+     2036,  -439, -5261,  2082, -4688,  2556, -1141,  3946,
+     4338, -1044, -5765, -2131, -1659, -4139,  3641, -2457,
+     1695,    51, -2720,  4377, -5110,   -45,  2400,  1921,
+     -336,  5384,  3693, -5631,  3188,  3924,  -367,  2077,
+     4257, -4135, -4765,  5838,  1304,   757,   590,   -91,
+     4833,  4191, -2318,  -309,  -650,  2808, -2292, -1896,
+    -4918, -1366, -4977,  -128,   725, -3132, -5006,  5896,
+     6108, -1317, -3494, -6043, -1775, -4621, -3423,  -451,
+     3809, -5149,   159, -1670, -2638,  5989,  4197, -1418,
+     2116,  4131,   882, -1844,  3916, -3645, -2224, -4156,
+     4059,  6060, -3686, -4722,  5816,   436,  5421, -5231,
+     4894,    -5,  4363, -1152, -5764, -3610,  4102,  3908,
+      537,  4562, -1623,  4062, -5534,   312, -4351, -4307,
+    -2586,  2815,  1431, -2741,   836,  4745,   906,  -473,
+     4775,  3950, -5850,   694, -5659,   852,  3716, -2781,
+     1446,  -348, -6018,  3386,  -553, -5476,  5310,  -819,
+     2966,   459,    98,  2526,  3166,  -405, -2978,  5000,
+    -3024,  -700, -3630, -1523,  4114, -1551, -3303, -5885,
+     3107,   833,   633, -2243, -5633,  -735,  2333,  2702,
+    -5488,  6012, -1126, -5950, -5278,  2647, -1898,  5250,
+    -4203, -1997,     2, -2958,   817, -4021,  1444,  2610,
+     5205, -5281, -5090, -5047, -2424, -3292,  -569,  5899,
+    -2497, -5926,  4732,  6102,  3649, -2000,   162, -6107,
+     1452,  3067,   280,  3706,  3779,  2354,  5536, -3270,
+     4865,  6019,  2597,  5494, -2124, -4588, -5183, -2679,
+     5887,  6028,  2117,  2652, -1580,  1910,  4638, -2340,
+     4852,   668, -2856, -3392,   779,  3025,  2520, -3513,
+     2105, -4178,  5721,  5762, -4026, -5711,  1458, -5807,
+    -3518,  4875, -1931,  4901,  3827,  5096, -5525,  -710,
+    -5371,  5015, -1205,   290,  5462, -4425,  2509,   467,
+    -3935, -5121,  2762, -5050, -2311,  1627,  3346,  3733,
+     -960, -5684,    18, -2044, -4936,   678,   707, -1088,
+     3385, -4792,  5697,  4391, -1541,  5674, -3581,  -260,
+     -236,  4952,  2155, -4394,  1654,  -755, -4793, -1906,
+    -1401, -4762,  4097,  -986, -3824,  2756, -3615,   870,
+     1735,  2336, -5793,  2414,  -808,  2999, -4286, -2130,
+     2267,  2004,  3721,  2113,  2337, -3214, -4729,  1750,
+    -5974,  -245,  4874,  4997,   211, -4844,  4374, -5132,
+     5718, -2090,  4962, -2265,  -708,  2567, -5824,  -893,
+    -2134, -2087,  4802,   884, -4623,  4733,  1546,  -780,
+      484, -3074, -4003, -2861,  5356,  4881, -2251, -1090,
+    -2880, -4763,    54, -6132, -2519,  2034,  2121, -3264,
+    -5269,  1625, -4740,  5730,  5372,  5795, -5938, -4333,
+     2306,  5768, -4498,  4193,  5917, -1475, -3260,  4252,
+     4798, -5489,  1907,  6017, -1342, -6000,   486, -6032,
+     4356, -3088,   840, -1171,  -952, -5227,  4319,  2479,
+    -2968,  2499,  1899,  5560, -4610, -2205, -5290, -4183,
+    -4175,  5747, -3378, -5561, -3545, -4348, -5694,  3461,
+     -320, -5991,     6,  3415,  2451,   226,  4332, -4459,
+     3326, -3554, -2981, -2852,  5017,  2413, -1707,  5408,
+    // Montgomery companions
+         0,   7887, -27443,  21561,  -3850,  -6959, -22046, -30590,
+     13572, -19310, -18686, -18889, -31251,  17039,   8778,  -6463,
+      3002,  15865, -16031, -14633,   5061, -13999,  25710, -14074,
+     26547,  -7205, -30808,  17748,  30547, -24483, -26787, -31080,
+     25843, -14649,  16719, -19796, -18948, -25625,  12234,  -5664,
+     27123,  -7071, -16073, -17071, -12367,   6239,  -5093,  -4213,
+      -747,  -9882,  24590,   3872, -14761,   8719,  -6277, -22691,
+      -432, -16484,   5333, -23038,  15801,  26110, -16271,  12618,
+    -27619,  19700,  19769,  -9381, -18036,   1893, -13588, -22563,
+    -29555,   -773,  19396,  18446,  26078,  31523, -20969,  14564,
+     17513, -15364,  11140, -27155,  -3888, -17284, -17540, -10735,
+     -6719, -23401,  24702, -30691,  -1781,  12938,   9045,  -7615,
+     17577,  21060,  12778, -23742, -23219,    693, -15129,  28659,
+     27022,  11716, -13204,   -629, -19988,   5082, -30755,   4410,
+       -48,   5450,  15156,  -2560,  30883,   2901,  -1808, -13162,
+     -8922,  22814,  28430,  26606, -19113,  22276,  13466,   7365,
+     22846,  27134,  -5344, -26723, -20158,  -4666,   8570, -26537,
+    -12996,  19444, -32115, -15929, -11663,  13684,  12916, -32205,
+    -17321,  -6437,  -6229, -28142,  11428,   5680,  24771,  -2154,
+    -23129,  -2320,  -7349, -10197,  12698,  29032,   2629, -21844,
+    -22094, -25139,   8197,   1291, -26766,   2906,  19753,  14282,
+      -144,  16351, -20068,  -7679,  27112,   8703,  -5424,  26051,
+    -12804,  -2357, -27203,  -5690,  -4122,   2080,  20148,  20441,
+     15529, -30387,  25923,  -1888,   5573,  15247, -26728,  13231,
+     27683,  16724, -18132,  12794,  -1296,  16084,  15999,  -3578,
+     -2240, -29646,   8234,  11615,  21252,  26158, -18830,  -2538,
+     11994,  21588, -15380,   6149,   8693, -11338, -28835, -16991,
+     15833, -21214,  17316,  14324,  28435,  18718, -15279, -12639,
+       -16,  23662, -16793,   -853, -11551, -20878,   -603, -26233,
+    -24819,   7605,   9477,   8869, -28216, -14420,  26334, -19390,
+      9007, -17940,  17444,  21636,  15183,  23539,  11594,  23315,
+     14106, -21614, -26888, -12292,  26105,  -7914, -14825, -27704,
+    -20062, -15567, -21742, -21417,  -1573, -32525,  30749,   3477,
+      6181, -31944,  21593, -19881,   6112,   5056,  -7487,  -1733,
+     22921, -17753, -14356,   -896, -31789,  27230, -10463,   8501,
+     -6399,  27646, -32648, -13626,  32632, -28248,  21097,  -7253,
+     32344,   4453, -19038, -22611,  21577,   3781,  16799,  -7034,
+     -2352,   4917,  21753,   5642,   5930,  11082, -23049,  10442,
+      9317, -16655, -29256,  16287, -23641, -31565, -20446,  28035,
+     13348, -15721,   8351, -30835,   3642, -13114,    341,  19497,
+    -28440, -10831, -12164, -31336, -21166, -21284,   -832, -14756,
+     28952, -25459,  25262,  -6895,  -2416, -31507,  20116,   2229,
+     21134,   3072, -32755,  13050, -10938, -10420,   9626, -15369,
+     18313, -18820,  -1163,  15508, -16159, -21945,  12591,  -9829,
+      -261,  -6735,  31544,   7909,   7941, -13332, -31688,   8442,
+      9679, -28707,   1867,  -8063, -23961, -17076, -28632,  10970,
+     16047,  -9029,    928,   3856, -14159, -30584,  14601,  31293,
+     -9909, -25353,  -2272,  17679, -10532, -20036,  -1851, -15599,
+     29486, -27763,  17060,   -299, -10596,   9077,  -3488, -19012,
+     -2133,   9215, -32728, -26387,  32723, -31261,  28878,  19428,
+    -19785, -32493,  29043, -28472,   2037,   1685,  -2496,  21268,
+     21321, -10842,  10250, -20686,  -7247, -28984,  -5189,   6687,
+    -18740,  -5552, -31597,   5429, -29726, -10522,  -6815, -12500,
+    -17396, -27086,   2784,  11567,  23059, -26217, -21732,  28344,
+      -784, -20206,  29096,  23726,  23822,  25539, -29528,  25326,
+     29038, -20585,   5600, -24190,  -6346,  14308, -20361, -32627,
+      7045,   1024,  10927,  26195, -25491,  18372,  25054, -26968,
+     27950,  15572, -22233, -16676,  -5386, -29160,   4197,  18569,
+     31496,  13359,   8421,  -2298,   -805,  11343, -15140, -21102,
+     -7055,  14751,   -277,  16927,  17791, -32291,  -3610,  31325,
+      5349,  18836,    309,   1285,  -4720, -32040,  26712,  10431,
+     18542, -30296,   -757,   5893,  18335,  15167, -22462,  -5200,
+      3226,  12276,  22468,  -2688, -29832,  16153, -31389,  25502,
+    -19198,  17401, -32408,  24659,  32360, -19209,  -2245, -21758,
+    -27080,   9509, -26526, -24345, -22366, -16100, -15145, -13215,
+    -24094, -16500,   6186,  25705, -28856,  14559,   9962,  12015,
+    -23587,  20633,  -8159,   9034,   9247,  20345,   7199, -31101,
+     -1008, -16617,  -9402,  11780,  -6821,  -4613,  27571, -14250,
+     28851,  -6671,  28131,   9546, -10037, -32664,  -5546,  10852,
+    -25438,   5034, -28195,  19566, -16105,  30254,  24878, -28830,
+      9823,  20478,  21934,   -384,  14463, -25779, -23209, -15081,
+    -30829, -16239,  14095,  -5840,  23347,   6618,  18404, -21833,
+     -2677,  27294, -13876,  10138, -32333, -20228,   8389, -20510,
+     -2485,   5493,  -8965,  20377, -24793, -31832,  15620,  32136,
+      -112, -30973,  13519,  -5973, -15321, -15076,  -4218,  12980,
+     22873, -12303,    800,  -3456,   -907,  30131, -12271,  -4661,
+     -2826, -14004,   4149,  24019,  -9071, -18484, -19081, -25049,
+    -15679, -10911,  -7898,  15769,  17689, -13503,   -741, -17769,
+     18420,  20041,  23411, -22494,  -4688, -13828,  -5237,  12138,
+    -20238, -17428,  -9861, -30803,   2437,    -43,  24121, -22937,
+     13983,  28723,  -2720,  24857,   3082,  28627,   2400, -10367,
+      -336, -27384, -24979, -17919,  19572,  20308, -12655, -26595,
+     -8031,  16345,  23907,  30414, -31464,   4853,  25166,   4005,
+     -7455,  16479, -26894,  -4405,  -8842, -29960, -18676,  30872,
+      3274,   6826,   7311,   -128,   4821,  13252, -29582, -26872,
+    -10276,  -5413,   4698,  -1947, -14063,  24051, -15711, -29123,
+     -8479,  23523,  12447,   6522, -27214,  10085,   8293,  -9610,
+     18500, -32733, -23694, -18228, -12468,  25027,  -2224,  12228,
+       -37, -10324,   4506,  19854, -26952,  16820, -23251, -17519,
+     29470,  -4101,    267,  -1152, -22148, -11802,  -4090,  20292,
+     21017, -20014,  18857,  28638, -30110, -32456, -16639,  32557,
+    -10778,  15103, -19049,  -6837,  17220,  25225,   9098, -20953,
+    -15705,  28526, -14042,  -7498,  -1563,  17236,  20100,  25891,
+     -6746,  16036,  18558,  11578, -21033, -21860,  29886, -29491,
+     -5226,  -3637, -24478,  27102,  27742,  -4501,  21598, -27768,
+     -3024,  15684, -28206, -30195, -20462, -13839,  17177,  22787,
+     31779, -11455,  21113, -30915,   6655, -13023, -26339,  27278,
+     -5488, -10372,   7066, -30526, -29854, -17833, -10090, -19326,
+      -107,  26675, -24574, -27534, -11471,  -8117,  17828, -21966,
+      9301,   7007,  19486,  15433,  30344,  13092, -21049,   1803,
+      9791,   2266, -11652,  -2090,  -8639,  -2000, -24414,  -2011,
+    -14932,  -1029, -32488,  11898,  32451, -22222,   5536,   4922,
+     -7423, -30845,   6693,  -2698,  14260,  11796, -17471,  17801,
+     18175, -10356,   6213, -13732,  14804,  -6282,  29214, -18724,
+     21236, -15716,  29912,  -3392,  -3317,  -9263, -30248, -23993,
+     22585,  20398,  26201, -18814, -12218, -17999, -23118, -18095,
+    -28094,    779,   2165,   8997,  32499, -27672,  -9621,   7482,
+     -1275, -15465,  -5301, -24286,  -2730, -24905, -26163,  29139,
+    -16223,   7167,  10954, -13242,  18169,  -2469, -21230,   7829,
+      -960, -22068, -24558,  14340,  27832,  -7514,  29379,  -1088,
+     23865,  27976,  -6591, -16089,  -5637,  13866,  25091, -16644,
+     16148, -27816,  -1941, -12586,  -6538, -29427, -25273,  22670,
+    -21881, -12954,  -8191,  -9178,  -3824,  19140, -15903,  -7322,
+    -18745,   2336,   6495,  26990,  31960, -17481, -28862,  22446,
+     -1829,  18388,  24201, -10175,  -9951, -27790, -25209,  -6442,
+      2218,  -4341,  13066,   9093,  28883,  11540,  -3818,  11252,
+     -2474, -10282, -19614, -22745, -17092, -17913,  -5824,  27779,
+      6058,  18393, -19774,  17268, -16911, -23939,   9738,  15604,
+     16868,  21502, -32675,  25811, -11028,  -7407,   1845,  23486,
+     -2880,   -667,  -8138, -22516,  17961, -22542,  22601,  -3264,
+     -9365,  22105, -21124, -18846, -11012, -31069,  18638,  24339,
+    -22270, -27000,  20078,  -8095, -22755, -30147,  13124, -12132,
+     29374,   6799,  30579,  -6271, -25918,  -6000,  -7706,  -6032,
+     20740,  -3088, -31928, -29843,  31816,  -1131,  16607,  14767,
+     29800,  31171,  -2197, -27208,  19966,  26467, -13482,  16297,
+    -16463, -31117,  21198, -26041, -24025,  12036, -30270,   7557,
+      -320,  14489,  -8186, -17065,  31123, -24350, -12052,   -363,
+     27902,  21022,  -7077, -19236,  25497, -26259,   2389,   5408,
+};
+
@@ -0,0 +1,49 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_MONT1024_TABLES_H
+#define __NTT_MONT1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int16_t ntt_mont1024_psi = 1014;
+static const int16_t ntt_mont1024_omega = -4080;
+static const int16_t ntt_mont1024_inv_psi = 5078;
+static const int16_t ntt_mont1024_inv_omega = 3762;
+static const int16_t ntt_mont1024_inv_n = -12;
+static const int16_t ntt_mont1024_rescale = 3755;
+static const int16_t ntt_mont1024_rescale_mont = -341;
+static const int16_t ntt_mont1024_qinv = -12287;
+
+/*
+ * POWERS OF PSI (MONTGOMERY FORM)
+ */
+extern const int16_t ntt_mont1024_psi_powers[2048];
+extern const int16_t ntt_mont1024_scaled_inv_psi_powers[2048];
+
+/*
+ * TABLES FOR NTT COMPUTATION (MONTGOMERY FORM)
+ */
+extern const int16_t ntt_mont1024_omega_powers[2048];
+extern const int16_t ntt_mont1024_omega_powers_rev[2048];
+extern const int16_t ntt_mont1024_inv_omega_powers[2048];
+extern const int16_t ntt_mont1024_inv_omega_powers_rev[2048];
+extern const int16_t ntt_mont1024_mixed_powers[2048];
+extern const int16_t ntt_mont1024_mixed_powers_rev[2048];
+extern const int16_t ntt_mont1024_inv_mixed_powers[2048];
+extern const int16_t ntt_mont1024_inv_mixed_powers_rev[2048];
+
+#endif /* __NTT_MONT1024_TABLES_H */
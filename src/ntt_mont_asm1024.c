@@ -0,0 +1,90 @@
+/*
+ * NTT for Q=12289, n=1024, with 16-bit coefficients and Montgomery multiplication.
+ * AVX implementation.
+ */
+
+#include "ntt_mont_asm1024.h"
+
+/*
+ * Input: two arrays a and b in standard order
+ *
+ * Result: 
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1]
+ * The result is also in that range.
+ */
+void ntt_mont1024_product1_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mont_mul_array16_asm(a, 1024, ntt_mont1024_psi_powers); // -7297 <= a[i] <= 7297
+  ntt_mont1024_ct_std2rev_asm(a);
+
+  mont_mul_array16_asm(b, 1024, ntt_mont1024_psi_powers);
+  ntt_mont1024_ct_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  mont_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_mont1024_ct_rev2std_asm(c);
+  mont_mul_finalize_asm(c, 1024, ntt_mont1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_mont1024_product2_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mont_mul_array16_asm(a, 1024, ntt_mont1024_psi_powers); // -7297 <= a[i] <= 7297
+  ntt_mont1024_gs_std2rev_asm(a);
+
+  mont_mul_array16_asm(b, 1024, ntt_mont1024_psi_powers);
+  ntt_mont1024_gs_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  mont_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_mont1024_ct_rev2std_asm(c);
+  mont_mul_finalize_asm(c, 1024, ntt_mont1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_mont1024_product3_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mont_mul_array16_asm(a, 1024, ntt_mont1024_psi_powers); // -7297 <= a[i] <= 7297
+  ntt_mont1024_ct_std2rev_asm(a);
+
+  mont_mul_array16_asm(b, 1024, ntt_mont1024_psi_powers);
+  ntt_mont1024_ct_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  mont_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_mont1024_gs_rev2std_asm(c);
+  mont_mul_finalize_asm(c, 1024, ntt_mont1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_mont1024_product4_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mont_mul_array16_asm(a, 1024, ntt_mont1024_psi_powers); // -7297 <= a[i] <= 7297
+  ntt_mont1024_gs_std2rev_asm(a);
+
+  mont_mul_array16_asm(b, 1024, ntt_mont1024_psi_powers);
+  ntt_mont1024_gs_std2rev_asm(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  mont_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_mont1024_gs_rev2std_asm(c);
+  mont_mul_finalize_asm(c, 1024, ntt_mont1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_mont1024_product5_asm(int16_t *c, int16_t *a, int16_t *b) {
+  mulntt_mont1024_ct_std2rev_asm(a);
+  mulntt_mont1024_ct_std2rev_asm(b);
+
+  mont_mul_array_asm(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  inttmul_mont1024_gs_rev2std_asm(c);
+  mont_scalar_mul_finalize_asm(c, 1024, ntt_mont1024_rescale, ntt_mont1024_rescale_mont); // rescale, convert to [0, Q-1]
+}
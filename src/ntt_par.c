@@ -0,0 +1,348 @@
+/*
+ * BD: a single large NTT computed by several threads.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // for pthread_setaffinity_np
+#endif
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ntt_par.h"
+#include "ntt_red.h"
+
+/*
+ * Number of busy-wait iterations before a thread waiting at the
+ * barrier starts yielding
+ */
+#define SPIN_LIMIT 128
+
+typedef enum ntt_par_kind {
+  NTT_PAR_CT_STD2REV,
+  NTT_PAR_GS_REV2STD,
+} ntt_par_kind_t;
+
+typedef struct ntt_par_worker_s {
+  uint32_t id;
+  ntt_par_t *par;
+} ntt_par_worker_t;
+
+struct ntt_par_s {
+  uint32_t nthreads;
+  bool pin;
+  ntt_par_worker_t *workers; // array of nthreads workers (0 is the caller)
+  pthread_t *threads;        // array of nthreads - 1 background threads
+
+  // start and shutdown
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  uint64_t generation;       // incremented for each transform
+  bool shutdown;
+
+  // barrier: count and phase are on their own cache line
+  uint32_t count __attribute__ ((aligned(64)));
+  uint32_t phase;
+
+  // current transform
+  ntt_par_kind_t kind __attribute__ ((aligned(64)));
+  int32_t *a;
+  uint32_t n;
+  const int16_t *p;
+  uint32_t levels;
+};
+
+
+/*
+ * BARRIER
+ */
+static inline void backoff(uint32_t *spins) {
+  if (*spins < SPIN_LIMIT) {
+    (*spins) ++;
+    __builtin_ia32_pause();
+  } else {
+    sched_yield();
+  }
+}
+
+/*
+ * Wait until all threads reach the barrier. The last thread to arrive
+ * resets the counter then starts the next phase.
+ */
+static void barrier_wait(ntt_par_t *par) {
+  uint32_t phase, spins;
+
+  phase = __atomic_load_n(&par->phase, __ATOMIC_ACQUIRE);
+  if (__atomic_add_fetch(&par->count, 1, __ATOMIC_ACQ_REL) == par->nthreads) {
+    __atomic_store_n(&par->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&par->phase, phase + 1, __ATOMIC_RELEASE);
+  } else {
+    spins = 0;
+    while (__atomic_load_n(&par->phase, __ATOMIC_ACQUIRE) == phase) {
+      backoff(&spins);
+    }
+  }
+}
+
+
+/*
+ * TRANSFORMS
+ */
+
+/*
+ * Start of thread i's range when [0, total) is split into k ranges.
+ * The boundaries are rounded down to a multiple of 16 (except for i = k).
+ */
+static uint32_t range_start(uint32_t total, uint32_t i, uint32_t k) {
+  if (i == k) return total;
+  return ((uint32_t) (((uint64_t) total * i)/k)) & ~((uint32_t) 15);
+}
+
+/*
+ * Butterflies of round t assigned to thread id
+ */
+static void run_round(ntt_par_t *par, uint32_t id, uint32_t t) {
+  uint32_t k, lo, hi;
+
+  k = par->nthreads;
+  lo = range_start(par->n/2, id, k);
+  hi = range_start(par->n/2, id + 1, k);
+  if (par->kind == NTT_PAR_CT_STD2REV) {
+    ntt_red_ct_std2rev_round(par->a, par->n, par->p, t, lo, hi);
+  } else {
+    ntt_red_gs_rev2std_round(par->a, par->n, par->p, t, lo, hi);
+  }
+}
+
+/*
+ * Blocks assigned to thread id: blocks are numbered 0 ... nb-1 where
+ * nb = 2^levels. Block b is r = nb + b in the block numbering of
+ * ntt_red.c.
+ */
+static void run_blocks(ntt_par_t *par, uint32_t id) {
+  uint32_t k, b, nb, m, end;
+
+  k = par->nthreads;
+  nb = ((uint32_t) 1) << par->levels;
+  m = par->n >> par->levels;
+  end = (uint32_t) (((uint64_t) nb * (id + 1))/k);
+  for (b = (uint32_t) (((uint64_t) nb * id)/k); b<end; b++) {
+    if (par->kind == NTT_PAR_CT_STD2REV) {
+      ntt_red_ct_std2rev_block(par->a + b * m, m, par->p, nb + b);
+    } else {
+      ntt_red_gs_rev2std_block(par->a + b * m, m, par->p, nb + b);
+    }
+  }
+}
+
+/*
+ * Thread id's part of the current transform. All threads go through
+ * the same number of barriers (levels + 1) and the last one marks the
+ * end of the transform.
+ */
+static void run_transform(ntt_par_t *par, uint32_t id) {
+  uint32_t t, nb;
+
+  nb = ((uint32_t) 1) << par->levels;
+  if (par->kind == NTT_PAR_CT_STD2REV) {
+    for (t=1; t<nb; t <<= 1) {
+      run_round(par, id, t);
+      barrier_wait(par);
+    }
+    run_blocks(par, id);
+    barrier_wait(par);
+  } else {
+    run_blocks(par, id);
+    barrier_wait(par);
+    for (t=nb>>1; t>0; t >>= 1) {
+      run_round(par, id, t);
+      barrier_wait(par);
+    }
+  }
+}
+
+
+/*
+ * THREADS
+ */
+
+/*
+ * Number of online processors (at least 1)
+ */
+static uint32_t num_cores(void) {
+  long k;
+
+  k = sysconf(_SC_NPROCESSORS_ONLN);
+  return (k < 1) ? 1 : (uint32_t) k;
+}
+
+/*
+ * Bind the calling thread to core k (modulo the number of cores)
+ */
+static void pin_thread(uint32_t k) {
+#if defined(__linux__)
+  cpu_set_t set;
+
+  CPU_ZERO(&set);
+  CPU_SET(k % num_cores(), &set);
+  (void) pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void) k;
+#endif
+}
+
+/*
+ * Body of the background threads
+ */
+static void *worker_main(void *arg) {
+  ntt_par_worker_t *w;
+  ntt_par_t *par;
+  uint64_t seen;
+
+  w = arg;
+  par = w->par;
+  if (par->pin) {
+    pin_thread(w->id);
+  }
+
+  seen = 0;
+  pthread_mutex_lock(&par->lock);
+  for (;;) {
+    while (par->generation == seen && !par->shutdown) {
+      pthread_cond_wait(&par->start, &par->lock);
+    }
+    if (par->shutdown) break;
+    seen = par->generation;
+    pthread_mutex_unlock(&par->lock);
+
+    run_transform(par, w->id);
+
+    pthread_mutex_lock(&par->lock);
+  }
+  pthread_mutex_unlock(&par->lock);
+
+  return NULL;
+}
+
+/*
+ * Stop background threads 1 ... k-1 and free everything
+ */
+static void cleanup(ntt_par_t *par, uint32_t k) {
+  uint32_t i;
+
+  pthread_mutex_lock(&par->lock);
+  par->shutdown = true;
+  pthread_cond_broadcast(&par->start);
+  pthread_mutex_unlock(&par->lock);
+  for (i=1; i<k; i++) {
+    pthread_join(par->threads[i-1], NULL);
+  }
+
+  pthread_cond_destroy(&par->start);
+  pthread_mutex_destroy(&par->lock);
+  free(par->threads);
+  free(par->workers);
+  free(par);
+}
+
+ntt_par_t *ntt_par_create(uint32_t nthreads, bool pin) {
+  ntt_par_t *par;
+  void *p;
+  uint32_t i;
+
+  if (nthreads == 0) {
+    nthreads = num_cores();
+  }
+
+  if (posix_memalign(&p, 64, sizeof(ntt_par_t)) != 0) return NULL;
+  par = p;
+  memset(par, 0, sizeof(ntt_par_t));
+  par->workers = calloc(nthreads, sizeof(ntt_par_worker_t));
+  par->threads = calloc(nthreads, sizeof(pthread_t));
+  par->nthreads = nthreads;
+  par->pin = pin;
+  pthread_mutex_init(&par->lock, NULL);
+  pthread_cond_init(&par->start, NULL);
+  if (par->workers == NULL || par->threads == NULL) {
+    cleanup(par, 0);
+    return NULL;
+  }
+
+  for (i=0; i<nthreads; i++) {
+    par->workers[i].id = i;
+    par->workers[i].par = par;
+  }
+  for (i=1; i<nthreads; i++) {
+    if (pthread_create(par->threads + (i-1), NULL, worker_main, par->workers + i) != 0) {
+      cleanup(par, i);
+      return NULL;
+    }
+  }
+  return par;
+}
+
+void ntt_par_delete(ntt_par_t *par) {
+  cleanup(par, par->nthreads);
+}
+
+uint32_t ntt_par_size(const ntt_par_t *par) {
+  return par->nthreads;
+}
+
+uint32_t ntt_par_levels(const ntt_par_t *par, uint32_t n) {
+  uint32_t k, levels;
+
+  k = par->nthreads;
+  levels = 0;
+  while ((((uint32_t) 1) << levels) < k) levels ++;
+  if ((k & (k - 1)) != 0) {
+    levels += 2;
+  }
+  while (levels > 0 && (n >> levels) < NTT_PAR_MIN_BLOCK) levels --;
+  return levels;
+}
+
+/*
+ * Run a transform: the caller is worker 0
+ */
+static void ntt_par_run(ntt_par_t *par, ntt_par_kind_t kind, int32_t *a, uint32_t n, const int16_t *p, uint32_t levels) {
+  assert(levels > 0);
+
+  pthread_mutex_lock(&par->lock);
+  par->kind = kind;
+  par->a = a;
+  par->n = n;
+  par->p = p;
+  par->levels = levels;
+  par->generation ++;
+  pthread_cond_broadcast(&par->start);
+  pthread_mutex_unlock(&par->lock);
+
+  run_transform(par, 0);
+}
+
+void ntt_par_ct_std2rev(ntt_par_t *par, int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t levels;
+
+  levels = ntt_par_levels(par, n);
+  if (levels == 0) {
+    ntt_red_ct_std2rev_rec(a, n, p);
+  } else {
+    ntt_par_run(par, NTT_PAR_CT_STD2REV, a, n, p, levels);
+  }
+}
+
+void ntt_par_gs_rev2std(ntt_par_t *par, int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t levels;
+
+  levels = ntt_par_levels(par, n);
+  if (levels == 0) {
+    ntt_red_gs_rev2std_rec(a, n, p);
+  } else {
+    ntt_par_run(par, NTT_PAR_GS_REV2STD, a, n, p, levels);
+  }
+}
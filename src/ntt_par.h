@@ -0,0 +1,93 @@
+/*
+ * BD: a single large NTT computed by several threads.
+ *
+ * This is for latency rather than throughput (see ntt_pool.h for
+ * batches of independent products). One transform of size n is split
+ * across the threads of a ntt_par object:
+ *
+ * - ct_std2rev: the first L rounds are layer-parallel. Each round's
+ *   n/2 butterflies are split into k contiguous ranges, one per thread,
+ *   and the threads synchronize after each round. After L rounds, the
+ *   array is made of 2^L independent blocks of n/2^L coefficients.
+ *   These are distributed to the threads (contiguous runs of blocks)
+ *   and each block is finished by ntt_red_ct_std2rev_block.
+ *
+ * - gs_rev2std: the same in reverse order (independent blocks with
+ *   ntt_red_gs_rev2std_block first, then the last L rounds in
+ *   parallel).
+ *
+ * The butterflies are the same as in ntt_red_ct_std2rev_rec and
+ * ntt_red_gs_rev2std_rec, so the results are identical to the
+ * single-threaded functions (mulntt_red_ct_std2rev, etc.)
+ *
+ * Scheduling:
+ * - for k threads, L = ceil(log2(k)) when k is a power of two, and
+ *   ceil(log2(k)) + 2 otherwise (so that 2^L >= 4k and the blocks are
+ *   nearly balanced). L is reduced if the blocks would be smaller than
+ *   NTT_PAR_MIN_BLOCK coefficients. If L = 0, the caller does the whole
+ *   transform.
+ * - the partition is static: on every call, thread i works on the same
+ *   parts of the array and of the table. The range boundaries are
+ *   multiples of 16 coefficients (64 bytes) so two threads never write
+ *   the same cache line in a round.
+ * - if pin is true, each background thread is bound to one core. A block
+ *   (and the part of the table it uses) then stays in the private cache
+ *   of the same core across calls, and on a NUMA machine the pages that
+ *   a thread touches first are allocated on its node.
+ * - the threads synchronize with a spinning barrier that yields after a
+ *   while (so oversubscription is tolerated).
+ *
+ * A ntt_par object is not reentrant: a single thread at a time may call
+ * ntt_par_ct_std2rev or ntt_par_gs_rev2std on it.
+ */
+
+#ifndef __NTT_PAR_H
+#define __NTT_PAR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Smallest block processed by one thread (in number of coefficients)
+ */
+#ifndef NTT_PAR_MIN_BLOCK
+#define NTT_PAR_MIN_BLOCK 1024
+#endif
+
+typedef struct ntt_par_s ntt_par_t;
+
+/*
+ * Create a set of nthreads threads
+ * - nthreads = 0 means one thread per core
+ * - if pin is true, background thread k is bound to core k modulo the
+ *   number of cores (Linux only, ignored elsewhere). The calling thread
+ *   is not pinned.
+ *
+ * Return NULL if the threads can't be created.
+ */
+extern ntt_par_t *ntt_par_create(uint32_t nthreads, bool pin);
+
+/*
+ * Stop the threads and free the object
+ */
+extern void ntt_par_delete(ntt_par_t *par);
+
+/*
+ * Number of threads (including the caller)
+ */
+extern uint32_t ntt_par_size(const ntt_par_t *par);
+
+/*
+ * Number of layer-parallel rounds used for size n
+ */
+extern uint32_t ntt_par_levels(const ntt_par_t *par, uint32_t n);
+
+/*
+ * Parallel versions of ntt_red_ct_std2rev_rec and ntt_red_gs_rev2std_rec
+ * - n must be a power of two
+ * - p: same tables as the radix-2 versions
+ */
+extern void ntt_par_ct_std2rev(ntt_par_t *par, int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_par_gs_rev2std(ntt_par_t *par, int32_t *a, uint32_t n, const int16_t *p);
+
+#endif /* __NTT_PAR_H */
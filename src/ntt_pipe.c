@@ -0,0 +1,460 @@
+/*
+ * BD: pipelined products for long streams of polynomials.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // for pthread_setaffinity_np
+#endif
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ntt_pipe.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+
+#define DEFAULT_DEPTH 8
+
+/*
+ * Number of busy-wait iterations before a stalled stage starts yielding
+ */
+#define SPIN_LIMIT 128
+
+/*
+ * Single-producer/single-consumer ring of depth slots
+ * - tail = number of slots pushed (written by the producer only)
+ * - head = number of slots popped (written by the consumer only)
+ * - slot k is at slots + (k & mask) * slot_size
+ * Each side's index and counters are on their own cache line.
+ */
+typedef struct ntt_ring_s {
+  int32_t *slots;
+  uint32_t mask;
+  uint32_t slot_size;
+
+  // producer side
+  uint32_t tail __attribute__ ((aligned(64)));
+  uint32_t max_depth;
+  uint64_t pushes;
+  uint64_t full_stalls;
+  uint64_t depth_sum;
+
+  // consumer side
+  uint32_t head __attribute__ ((aligned(64)));
+  uint64_t empty_stalls;
+} __attribute__ ((aligned(64))) ntt_ring_t;
+
+/*
+ * Stage bodies for a given n
+ * - forward(a): a in [0, Q-1] is converted to the NTT domain
+ * - inverse(a): a is converted back to [0, Q-1] in standard order
+ */
+typedef struct stage_funs_s {
+  void (*forward)(int32_t *a);
+  void (*inverse)(int32_t *a);
+} stage_funs_t;
+
+/*
+ * Background threads: stage 1 = pointwise, stage 2 = inverse
+ */
+typedef struct ntt_stage_s {
+  uint32_t id;
+  ntt_pipe_t *pipe;
+} ntt_stage_t;
+
+struct ntt_pipe_s {
+  ntt_ring_t queue[2];
+  uint32_t n;
+  bool pin;
+  const stage_funs_t *funs;
+  ntt_stage_t stages[2];
+  pthread_t threads[2];
+
+  // synchronization
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  uint64_t generation;     // incremented for each batch
+  uint32_t pending;        // number of background threads still working on the batch
+  bool shutdown;
+
+  // current batch
+  int32_t * const *c;
+  uint32_t count;
+};
+
+
+/*
+ * Stage bodies: same steps as ntt_red<n>_product5_asm
+ */
+static void forward16(int32_t *a) {
+  shift_array_asm(a, 16);
+  mulntt_red16_ct_std2rev_fused_asm(a);
+}
+
+static void inverse16(int32_t *a) {
+  inttmul_red16_gs_rev2std_asm(a);
+  scalar_mul_reduce_finalize_asm(a, 16, ntt_red16_rescale8);
+}
+
+static void forward256(int32_t *a) {
+  shift_array_asm(a, 256);
+  mulntt_red256_ct_std2rev_fused_asm(a);
+}
+
+static void inverse256(int32_t *a) {
+  inttmul_red256_gs_rev2std_asm(a);
+  scalar_mul_reduce_finalize_asm(a, 256, ntt_red256_rescale8);
+}
+
+static void forward512(int32_t *a) {
+  shift_array_asm(a, 512);
+  mulntt_red512_ct_std2rev_fused_asm(a);
+}
+
+static void inverse512(int32_t *a) {
+  inttmul_red512_gs_rev2std_asm(a);
+  scalar_mul_reduce_finalize_asm(a, 512, ntt_red512_rescale8);
+}
+
+static void forward1024(int32_t *a) {
+  mulntt_red1024_ct_std2rev_fused_asm(a);
+}
+
+static void inverse1024(int32_t *a) {
+  inttmul_red1024_gs_rev2std_asm(a);
+  scalar_mul_reduce_finalize_asm(a, 1024, ntt_red1024_rescale8);
+}
+
+static const stage_funs_t funs16 = { forward16, inverse16 };
+static const stage_funs_t funs256 = { forward256, inverse256 };
+static const stage_funs_t funs512 = { forward512, inverse512 };
+static const stage_funs_t funs1024 = { forward1024, inverse1024 };
+
+static const stage_funs_t *get_stage_funs(uint32_t n) {
+  switch (n) {
+  case 16: return &funs16;
+  case 256: return &funs256;
+  case 512: return &funs512;
+  case 1024: return &funs1024;
+  }
+  return NULL;
+}
+
+
+/*
+ * RING BUFFERS
+ */
+static inline void backoff(uint32_t *spins) {
+  if (*spins < SPIN_LIMIT) {
+    (*spins) ++;
+    __builtin_ia32_pause();
+  } else {
+    sched_yield();
+  }
+}
+
+/*
+ * Producer: wait for a free slot and return it
+ */
+static int32_t *ring_reserve(ntt_ring_t *r) {
+  uint32_t head, tail, depth, spins;
+
+  tail = r->tail;
+  head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+  if (tail - head > r->mask) {
+    r->full_stalls ++;
+    spins = 0;
+    do {
+      backoff(&spins);
+      head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    } while (tail - head > r->mask);
+  }
+  depth = tail - head + 1;
+  r->depth_sum += depth;
+  if (depth > r->max_depth) {
+    r->max_depth = depth;
+  }
+  return r->slots + (tail & r->mask) * r->slot_size;
+}
+
+/*
+ * Producer: publish the slot returned by ring_reserve
+ */
+static inline void ring_push(ntt_ring_t *r) {
+  r->pushes ++;
+  __atomic_store_n(&r->tail, r->tail + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Consumer: wait for a full slot and return it
+ */
+static int32_t *ring_front(ntt_ring_t *r) {
+  uint32_t head, spins;
+
+  head = r->head;
+  if (__atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) == head) {
+    r->empty_stalls ++;
+    spins = 0;
+    do {
+      backoff(&spins);
+    } while (__atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) == head);
+  }
+  return r->slots + (head & r->mask) * r->slot_size;
+}
+
+/*
+ * Consumer: release the slot returned by ring_front
+ */
+static inline void ring_pop(ntt_ring_t *r) {
+  __atomic_store_n(&r->head, r->head + 1, __ATOMIC_RELEASE);
+}
+
+static void ring_reset_stats(ntt_ring_t *r) {
+  r->max_depth = 0;
+  r->pushes = 0;
+  r->full_stalls = 0;
+  r->depth_sum = 0;
+  r->empty_stalls = 0;
+}
+
+
+/*
+ * STAGES
+ */
+
+/*
+ * Stage 0 (caller): slot = a[i], b[i] in the NTT domain
+ */
+static void run_forward(ntt_pipe_t *pipe, int32_t * const *a, int32_t * const *b, uint32_t count) {
+  const stage_funs_t *funs;
+  int32_t *x;
+  uint32_t i, n;
+
+  funs = pipe->funs;
+  n = pipe->n;
+  for (i=0; i<count; i++) {
+    x = ring_reserve(pipe->queue);
+    memcpy(x, a[i], n * sizeof(int32_t));
+    memcpy(x + n, b[i], n * sizeof(int32_t));
+    funs->forward(x);
+    funs->forward(x + n);
+    ring_push(pipe->queue);
+  }
+}
+
+/*
+ * Stage 1: pointwise product
+ */
+static void run_pointwise(ntt_pipe_t *pipe, uint32_t count) {
+  int32_t *x, *y;
+  uint32_t i, n;
+
+  n = pipe->n;
+  for (i=0; i<count; i++) {
+    x = ring_front(pipe->queue);
+    y = ring_reserve(pipe->queue + 1);
+    mul_reduce_array_asm(y, n, x, x + n); // y[i] = 3 * x[i] * x[n + i]
+    reduce_array_twice_asm(y, n);         // y[i] = 9 * y[i] mod Q
+    ring_pop(pipe->queue);
+    ring_push(pipe->queue + 1);
+  }
+}
+
+/*
+ * Stage 2: inverse NTT then copy to c[i]
+ */
+static void run_inverse(ntt_pipe_t *pipe, int32_t * const *c, uint32_t count) {
+  const stage_funs_t *funs;
+  int32_t *x;
+  uint32_t i, n;
+
+  funs = pipe->funs;
+  n = pipe->n;
+  for (i=0; i<count; i++) {
+    x = ring_front(pipe->queue + 1);
+    funs->inverse(x);
+    memcpy(c[i], x, n * sizeof(int32_t));
+    ring_pop(pipe->queue + 1);
+  }
+}
+
+/*
+ * Bind the calling thread to core k (modulo the number of cores)
+ */
+static void pin_thread(uint32_t k) {
+#if defined(__linux__)
+  cpu_set_t set;
+  long ncores;
+
+  ncores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (ncores < 1) ncores = 1;
+  CPU_ZERO(&set);
+  CPU_SET(k % ncores, &set);
+  (void) pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void) k;
+#endif
+}
+
+/*
+ * Body of the background threads
+ */
+static void *stage_main(void *arg) {
+  ntt_stage_t *s;
+  ntt_pipe_t *pipe;
+  uint64_t seen;
+
+  s = arg;
+  pipe = s->pipe;
+  if (pipe->pin) {
+    pin_thread(s->id);
+  }
+
+  // the pipeline is created with generation 0: a batch may be posted
+  // before this thread gets here
+  seen = 0;
+  pthread_mutex_lock(&pipe->lock);
+  for (;;) {
+    while (pipe->generation == seen && !pipe->shutdown) {
+      pthread_cond_wait(&pipe->start, &pipe->lock);
+    }
+    if (pipe->shutdown) break;
+    seen = pipe->generation;
+    pthread_mutex_unlock(&pipe->lock);
+
+    if (s->id == 1) {
+      run_pointwise(pipe, pipe->count);
+    } else {
+      run_inverse(pipe, pipe->c, pipe->count);
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    assert(pipe->pending > 0);
+    pipe->pending --;
+    if (pipe->pending == 0) {
+      pthread_cond_signal(&pipe->done);
+    }
+  }
+  pthread_mutex_unlock(&pipe->lock);
+
+  return NULL;
+}
+
+
+/*
+ * Stop background threads 0 ... k-1 and free everything
+ */
+static void cleanup(ntt_pipe_t *pipe, uint32_t k) {
+  uint32_t i;
+
+  pthread_mutex_lock(&pipe->lock);
+  pipe->shutdown = true;
+  pthread_cond_broadcast(&pipe->start);
+  pthread_mutex_unlock(&pipe->lock);
+  for (i=0; i<k; i++) {
+    pthread_join(pipe->threads[i], NULL);
+  }
+
+  free(pipe->queue[0].slots);
+  free(pipe->queue[1].slots);
+  pthread_cond_destroy(&pipe->done);
+  pthread_cond_destroy(&pipe->start);
+  pthread_mutex_destroy(&pipe->lock);
+  free(pipe);
+}
+
+ntt_pipe_t *ntt_pipe_create(uint32_t n, uint32_t depth, bool pin) {
+  const stage_funs_t *funs;
+  ntt_pipe_t *pipe;
+  void *p;
+  uint32_t i;
+
+  funs = get_stage_funs(n);
+  if (funs == NULL || !avx2_supported()) return NULL;
+  if (depth == 0) {
+    depth = DEFAULT_DEPTH;
+  }
+  if ((depth & (depth - 1)) != 0) return NULL;
+
+  if (posix_memalign(&p, 64, sizeof(ntt_pipe_t)) != 0) return NULL;
+  memset(p, 0, sizeof(ntt_pipe_t));
+  pipe = p;
+  pipe->n = n;
+  pipe->pin = pin;
+  pipe->funs = funs;
+  pthread_mutex_init(&pipe->lock, NULL);
+  pthread_cond_init(&pipe->start, NULL);
+  pthread_cond_init(&pipe->done, NULL);
+
+  for (i=0; i<2; i++) {
+    pipe->queue[i].mask = depth - 1;
+    pipe->queue[i].slot_size = (i == 0) ? 2 * n : n;
+    if (posix_memalign(&p, 64, depth * pipe->queue[i].slot_size * sizeof(int32_t)) != 0) {
+      cleanup(pipe, 0);
+      return NULL;
+    }
+    pipe->queue[i].slots = p;
+  }
+
+  for (i=0; i<2; i++) {
+    pipe->stages[i].id = i + 1;
+    pipe->stages[i].pipe = pipe;
+    if (pthread_create(pipe->threads + i, NULL, stage_main, pipe->stages + i) != 0) {
+      cleanup(pipe, i);
+      return NULL;
+    }
+  }
+  return pipe;
+}
+
+void ntt_pipe_delete(ntt_pipe_t *pipe) {
+  cleanup(pipe, 2);
+}
+
+void ntt_pipe_product(ntt_pipe_t *pipe, int32_t * const *c, int32_t * const *a, int32_t * const *b,
+		      uint32_t count) {
+  if (count == 0) return;
+
+  pthread_mutex_lock(&pipe->lock);
+  pipe->c = c;
+  pipe->count = count;
+  pipe->pending = 2;
+  pipe->generation ++;
+  pthread_cond_broadcast(&pipe->start);
+  pthread_mutex_unlock(&pipe->lock);
+
+  // the caller runs the forward stage
+  run_forward(pipe, a, b, count);
+
+  pthread_mutex_lock(&pipe->lock);
+  while (pipe->pending > 0) {
+    pthread_cond_wait(&pipe->done, &pipe->lock);
+  }
+  pthread_mutex_unlock(&pipe->lock);
+}
+
+void ntt_pipe_get_stats(const ntt_pipe_t *pipe, ntt_pipe_stats_t *stats) {
+  const ntt_ring_t *r;
+  uint32_t i;
+
+  for (i=0; i<2; i++) {
+    r = pipe->queue + i;
+    stats->queue[i].pushes = r->pushes;
+    stats->queue[i].full_stalls = r->full_stalls;
+    stats->queue[i].empty_stalls = r->empty_stalls;
+    stats->queue[i].depth_sum = r->depth_sum;
+    stats->queue[i].max_depth = r->max_depth;
+  }
+}
+
+void ntt_pipe_reset_stats(ntt_pipe_t *pipe) {
+  ring_reset_stats(pipe->queue);
+  ring_reset_stats(pipe->queue + 1);
+}
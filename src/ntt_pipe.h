@@ -0,0 +1,103 @@
+/*
+ * BD: pipelined products for long streams of polynomials.
+ *
+ * A pipeline splits product5 of ntt_red<n>_asm into three stages that
+ * run on different threads:
+ *
+ * 1) forward:   copy a[i] and b[i], then mulntt_red<n>_ct_std2rev_fused_asm
+ *               on both (run by the thread that calls ntt_pipe_product)
+ * 2) pointwise: mul_reduce_array_asm + reduce_array_twice_asm
+ * 3) inverse:   inttmul_red<n>_gs_rev2std_asm + scalar_mul_reduce_finalize_asm,
+ *               then copy to c[i]
+ *
+ * The stages are connected by two single-producer/single-consumer ring
+ * buffers of aligned slots:
+ * - queue 0 (forward -> pointwise): each slot holds two arrays of n integers
+ * - queue 1 (pointwise -> inverse): each slot holds one array of n integers
+ *
+ * The rings are lock-free: the producer and the consumer each own an index
+ * and publish it with a release store. A stage that finds its output queue
+ * full or its input queue empty spins for a while then yields the processor.
+ * The number of such stalls is recorded so that an unbalanced pipeline can
+ * be detected (a queue that is often full means that the next stage is the
+ * bottleneck).
+ *
+ * The result is the same as ntt_red<n>_product5_asm. Requires AVX2.
+ *
+ * A pipeline is not reentrant: a single thread at a time may call
+ * ntt_pipe_product on a given pipeline.
+ */
+
+#ifndef __NTT_PIPE_H
+#define __NTT_PIPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct ntt_pipe_s ntt_pipe_t;
+
+/*
+ * Counters for one queue
+ * - pushes: number of slots written by the producer
+ * - full_stalls: number of times the producer had to wait for a free slot
+ *   (backpressure from the consumer)
+ * - empty_stalls: number of times the consumer had to wait for a slot
+ * - max_depth: largest number of slots in use, including the one being
+ *   written, observed by the producer when it gets a slot
+ * - depth_sum: sum of these observations (depth_sum/pushes is the
+ *   average depth)
+ */
+typedef struct ntt_pipe_queue_stats_s {
+  uint64_t pushes;
+  uint64_t full_stalls;
+  uint64_t empty_stalls;
+  uint64_t depth_sum;
+  uint32_t max_depth;
+} ntt_pipe_queue_stats_t;
+
+typedef struct ntt_pipe_stats_s {
+  ntt_pipe_queue_stats_t queue[2];
+} ntt_pipe_stats_t;
+
+/*
+ * Create a pipeline for products of size n
+ * - n must be 16, 256, 512, or 1024
+ * - depth = number of slots in each queue. It must be a power of two;
+ *   0 means the default (8).
+ * - if pin is true, the pointwise and inverse threads are bound to
+ *   cores 1 and 2 modulo the number of cores (Linux only, ignored
+ *   elsewhere). The calling thread is not pinned.
+ *
+ * Return NULL if n or depth is not supported, if AVX2 is not available,
+ * or if the threads or slots can't be allocated.
+ */
+extern ntt_pipe_t *ntt_pipe_create(uint32_t n, uint32_t depth, bool pin);
+
+/*
+ * Stop the threads and free the pipeline
+ */
+extern void ntt_pipe_delete(ntt_pipe_t *pipe);
+
+/*
+ * Compute c[i] = a[i] * b[i] for i=0 ... count-1
+ * - each a[i], b[i] is an array of n integers in [0, Q-1]
+ * - each c[i] is an array of n integers
+ * - the result c[i] is in [0, Q-1]
+ * - the a[i] and b[i] are not modified
+ */
+extern void ntt_pipe_product(ntt_pipe_t *pipe, int32_t * const *c, int32_t * const *a, int32_t * const *b,
+			     uint32_t count);
+
+/*
+ * Copy the counters into *stats. The counters are cumulative since the
+ * pipeline was created or since the last call to ntt_pipe_reset_stats.
+ * Must not be called while ntt_pipe_product is running.
+ */
+extern void ntt_pipe_get_stats(const ntt_pipe_t *pipe, ntt_pipe_stats_t *stats);
+
+/*
+ * Reset all counters to zero
+ */
+extern void ntt_pipe_reset_stats(ntt_pipe_t *pipe);
+
+#endif /* __NTT_PIPE_H */
@@ -0,0 +1,349 @@
+/*
+ * BD: batch products on a pool of worker threads.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // for pthread_setaffinity_np
+#endif
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ntt_pool.h"
+#include "ntt16.h"
+#include "ntt256.h"
+#include "ntt512.h"
+#include "ntt1024.h"
+#include "ntt_red16.h"
+#include "ntt_red256.h"
+#include "ntt_red512.h"
+#include "ntt_red1024.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+
+/*
+ * Largest supported n: the scratch arrays have this size.
+ */
+#define MAX_N 1024
+
+/*
+ * Per-thread state
+ * - next, end: range of products assigned to this thread. The owner
+ *   and the thieves take products from this range by incrementing next.
+ * - a, b: scratch arrays (aligned)
+ * The struct is aligned on a cache line so that threads don't share
+ * the counters.
+ */
+typedef struct ntt_worker_s {
+  uint32_t next;
+  uint32_t end;
+  uint32_t id;
+  ntt_pool_t *pool;
+  int32_t *a;
+  int32_t *b;
+} __attribute__ ((aligned(64))) ntt_worker_t;
+
+struct ntt_pool_s {
+  uint32_t nthreads;
+  bool pin;
+  ntt_worker_t *workers;   // array of nthreads workers (0 is the caller)
+  pthread_t *threads;      // array of nthreads - 1 background threads
+
+  // synchronization
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  uint64_t generation;     // incremented for each batch
+  uint32_t pending;        // number of background threads still working on the batch
+  bool shutdown;
+
+  // current batch: product i is computed by fun, or by funs[i] if funs is not NULL
+  ntt_pool_fun_t fun;
+  const ntt_pool_fun_t *funs;
+  uint32_t n;
+  int32_t * const *c;
+  int32_t * const *a;
+  int32_t * const *b;
+};
+
+
+/*
+ * Product function for the given backend and size
+ * - return NULL if not supported
+ */
+static ntt_pool_fun_t get_product_fun(ntt_pool_backend_t backend, uint32_t n) {
+  switch (backend) {
+  case NTT_POOL_DEFAULT:
+    switch (n) {
+    case 16: return ntt16_product5;
+    case 256: return ntt256_product5;
+    case 512: return ntt512_product5;
+    case 1024: return ntt1024_product5;
+    }
+    break;
+
+  case NTT_POOL_RED:
+    switch (n) {
+    case 16: return ntt_red16_product5;
+    case 256: return ntt_red256_product5;
+    case 512: return ntt_red512_product5;
+    case 1024: return ntt_red1024_product5;
+    }
+    break;
+
+  case NTT_POOL_RED_ASM:
+    if (avx2_supported()) {
+      switch (n) {
+      case 16: return ntt_red16_product5_asm;
+      case 256: return ntt_red256_product5_asm;
+      case 512: return ntt_red512_product5_asm;
+      case 1024: return ntt_red1024_product5_asm;
+      }
+    }
+    break;
+  }
+  return NULL;
+}
+
+
+/*
+ * Process products from the range of worker v
+ */
+static void run_range(ntt_pool_t *pool, ntt_worker_t *w, ntt_worker_t *v) {
+  ntt_pool_fun_t f;
+  uint32_t i, n;
+
+  n = pool->n;
+  for (;;) {
+    i = __atomic_fetch_add(&v->next, 1, __ATOMIC_RELAXED);
+    if (i >= v->end) break;
+    memcpy(w->a, pool->a[i], n * sizeof(int32_t));
+    memcpy(w->b, pool->b[i], n * sizeof(int32_t));
+    f = (pool->funs != NULL) ? pool->funs[i] : pool->fun;
+    f(pool->c[i], w->a, w->b);
+  }
+}
+
+/*
+ * Worker w: own range first, then steal from the others
+ */
+static void run_batch(ntt_pool_t *pool, ntt_worker_t *w) {
+  uint32_t k, id;
+
+  id = w->id;
+  for (k=0; k<pool->nthreads; k++) {
+    run_range(pool, w, pool->workers + ((id + k) % pool->nthreads));
+  }
+}
+
+/*
+ * Bind the calling thread to core k (modulo the number of cores)
+ */
+static void pin_thread(uint32_t k) {
+#if defined(__linux__)
+  cpu_set_t set;
+
+  CPU_ZERO(&set);
+  CPU_SET(k % ntt_pool_num_cores(), &set);
+  (void) pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void) k;
+#endif
+}
+
+/*
+ * Body of the background threads
+ */
+static void *worker_main(void *arg) {
+  ntt_worker_t *w;
+  ntt_pool_t *pool;
+  uint64_t seen;
+
+  w = arg;
+  pool = w->pool;
+  if (pool->pin) {
+    pin_thread(w->id);
+  }
+
+  // the pool is created with generation 0: a batch may be posted
+  // before this thread gets here
+  seen = 0;
+  pthread_mutex_lock(&pool->lock);
+  for (;;) {
+    while (pool->generation == seen && !pool->shutdown) {
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if (pool->shutdown) break;
+    seen = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+
+    run_batch(pool, w);
+
+    pthread_mutex_lock(&pool->lock);
+    assert(pool->pending > 0);
+    pool->pending --;
+    if (pool->pending == 0) {
+      pthread_cond_signal(&pool->done);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
+}
+
+
+uint32_t ntt_pool_num_cores(void) {
+  long k;
+
+  k = sysconf(_SC_NPROCESSORS_ONLN);
+  return (k < 1) ? 1 : (uint32_t) k;
+}
+
+/*
+ * Stop background threads 1 ... k-1 and free everything
+ */
+static void cleanup(ntt_pool_t *pool, uint32_t k) {
+  uint32_t i;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for (i=1; i<k; i++) {
+    pthread_join(pool->threads[i-1], NULL);
+  }
+
+  for (i=0; i<pool->nthreads; i++) {
+    free(pool->workers[i].a);
+    free(pool->workers[i].b);
+  }
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->start);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool);
+}
+
+ntt_pool_t *ntt_pool_create(uint32_t nthreads, bool pin) {
+  ntt_pool_t *pool;
+  ntt_worker_t *w;
+  void *p;
+  uint32_t i;
+
+  if (nthreads == 0) {
+    nthreads = ntt_pool_num_cores();
+  }
+
+  pool = calloc(1, sizeof(ntt_pool_t));
+  if (pool == NULL) return NULL;
+  if (posix_memalign(&p, 64, nthreads * sizeof(ntt_worker_t)) != 0) {
+    free(pool);
+    return NULL;
+  }
+  memset(p, 0, nthreads * sizeof(ntt_worker_t));
+  pool->workers = p;
+  pool->threads = calloc(nthreads, sizeof(pthread_t));
+  pool->nthreads = nthreads;
+  pool->pin = pin;
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  if (pool->threads == NULL) goto error;
+
+  for (i=0; i<nthreads; i++) {
+    w = pool->workers + i;
+    w->id = i;
+    w->pool = pool;
+    if (posix_memalign(&p, 64, MAX_N * sizeof(int32_t)) != 0) goto error;
+    w->a = p;
+    if (posix_memalign(&p, 64, MAX_N * sizeof(int32_t)) != 0) goto error;
+    w->b = p;
+  }
+
+  for (i=1; i<nthreads; i++) {
+    if (pthread_create(pool->threads + (i-1), NULL, worker_main, pool->workers + i) != 0) {
+      cleanup(pool, i);
+      return NULL;
+    }
+  }
+  return pool;
+
+ error:
+  cleanup(pool, 0);
+  return NULL;
+}
+
+void ntt_pool_delete(ntt_pool_t *pool) {
+  cleanup(pool, pool->nthreads);
+}
+
+uint32_t ntt_pool_size(const ntt_pool_t *pool) {
+  return pool->nthreads;
+}
+
+/*
+ * Run a batch: either fun or funs must be non-NULL
+ */
+static void run_products(ntt_pool_t *pool, uint32_t n, ntt_pool_fun_t fun, const ntt_pool_fun_t *funs,
+			 int32_t * const *c, int32_t * const *a, int32_t * const *b, uint32_t count) {
+  uint32_t i, k, lo;
+
+  k = pool->nthreads;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->fun = fun;
+  pool->funs = funs;
+  pool->n = n;
+  pool->c = c;
+  pool->a = a;
+  pool->b = b;
+  // split [0, count) into k ranges of nearly equal size
+  lo = 0;
+  for (i=0; i<k; i++) {
+    pool->workers[i].next = lo;
+    lo += count/k + (i < count % k);
+    pool->workers[i].end = lo;
+  }
+  assert(lo == count);
+  pool->pending = k - 1;
+  pool->generation ++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  // the caller is worker 0
+  run_batch(pool, pool->workers);
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->pending > 0) {
+    pthread_cond_wait(&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+}
+
+int32_t ntt_pool_product(ntt_pool_t *pool, ntt_pool_backend_t backend, uint32_t n,
+			 int32_t * const *c, int32_t * const *a, int32_t * const *b, uint32_t count) {
+  ntt_pool_fun_t fun;
+
+  fun = get_product_fun(backend, n);
+  if (fun == NULL) return -1;
+  if (count > 0) {
+    run_products(pool, n, fun, NULL, c, a, b, count);
+  }
+  return 0;
+}
+
+int32_t ntt_pool_product_funs(ntt_pool_t *pool, uint32_t n, const ntt_pool_fun_t *fun,
+			      int32_t * const *c, int32_t * const *a, int32_t * const *b, uint32_t count) {
+  if (n > MAX_N) return -1;
+  if (count > 0) {
+    run_products(pool, n, NULL, fun, c, a, b, count);
+  }
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * BD: batch products on a pool of worker threads.
+ *
+ * A pool is a set of persistent threads that compute many independent
+ * products c[i] = a[i] * b[i] (modulo X^n + 1 and Q=12289) in parallel.
+ * The product function is product5 of the selected backend:
+ *
+ * - NTT_POOL_DEFAULT: ntt<n>_product5 (ntt.c, no lazy reduction)
+ * - NTT_POOL_RED:     ntt_red<n>_product5 (ntt_red.c)
+ * - NTT_POOL_RED_ASM: ntt_red<n>_product5_asm (ntt_asm.S, requires AVX2)
+ *
+ * for n = 16, 256, 512, or 1024.
+ *
+ * A pool of k threads uses the calling thread plus k-1 background
+ * threads. The batch is split into k contiguous ranges, one per
+ * thread. A thread that finishes its range takes the remaining products
+ * from the other ranges (work stealing), so uneven batches or slow
+ * threads don't leave the other threads idle.
+ *
+ * Each thread owns aligned scratch arrays: the inputs a[i] and b[i]
+ * are copied there before the product, so they are not modified
+ * (unlike the product functions called directly).
+ *
+ * A pool is not reentrant: a single thread at a time may call
+ * ntt_pool_product on a given pool.
+ */
+
+#ifndef __NTT_POOL_H
+#define __NTT_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum ntt_pool_backend {
+  NTT_POOL_DEFAULT,
+  NTT_POOL_RED,
+  NTT_POOL_RED_ASM,
+} ntt_pool_backend_t;
+
+typedef struct ntt_pool_s ntt_pool_t;
+
+/*
+ * Product function: c := a * b (a and b may be modified)
+ */
+typedef void (*ntt_pool_fun_t)(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Number of online processors (at least 1)
+ */
+extern uint32_t ntt_pool_num_cores(void);
+
+/*
+ * Create a pool of nthreads threads
+ * - nthreads = 0 means one thread per core
+ * - if pin is true, background thread k is bound to core k modulo the
+ *   number of cores (Linux only, ignored elsewhere). The calling thread
+ *   is not pinned.
+ *
+ * Return NULL if the threads or scratch arrays can't be allocated.
+ */
+extern ntt_pool_t *ntt_pool_create(uint32_t nthreads, bool pin);
+
+/*
+ * Stop the threads and free the pool
+ */
+extern void ntt_pool_delete(ntt_pool_t *pool);
+
+/*
+ * Number of threads in the pool (including the caller)
+ */
+extern uint32_t ntt_pool_size(const ntt_pool_t *pool);
+
+/*
+ * Compute c[i] = a[i] * b[i] for i=0 ... count-1
+ * - each a[i], b[i] is an array of n integers in [0, Q-1]
+ * - each c[i] is an array of n integers
+ * - the result c[i] is in [0, Q-1]
+ * - the a[i] and b[i] are not modified
+ *
+ * Return 0 if the products were computed, -1 if the backend doesn't
+ * support size n (or AVX2 is not available for NTT_POOL_RED_ASM).
+ */
+extern int32_t ntt_pool_product(ntt_pool_t *pool, ntt_pool_backend_t backend, uint32_t n,
+				int32_t * const *c, int32_t * const *a, int32_t * const *b, uint32_t count);
+
+/*
+ * Same thing with a product function per product: c[i] is computed
+ * by fun[i](c[i], a[i], b[i]) on a copy of a[i] and b[i].
+ * - each a[i], b[i], c[i] is an array of n integers
+ * - the inputs and outputs depend on fun[i] (e.g., the modulus)
+ *
+ * This allows a batch to mix different moduli (e.g., the channels of
+ * ntt_rns.h).
+ *
+ * Return 0 if the products were computed, -1 if n is larger than 1024.
+ */
+extern int32_t ntt_pool_product_funs(ntt_pool_t *pool, uint32_t n, const ntt_pool_fun_t *fun,
+				     int32_t * const *c, int32_t * const *a, int32_t * const *b, uint32_t count);
+
+#endif /* __NTT_POOL_H */
@@ -147,24 +147,26 @@ void reduce_array_twice(int32_t *a, uint32_t n) {
  * Convert to integers in the range [0, Q-1] after double reduction.
  * - the input must be in the interval [-Q, 2*Q-1]
  */
+static int32_t correct_coeff(int32_t x) {
+#if 1
+  x += ((x >> 16) & Q);
+  x -= Q;
+  x += ((x >> 16) & Q);
+#else
+  if (x < 0) {
+    x += Q;
+  } else if (x >= Q) {
+    x -= Q;
+  }
+#endif
+  return x;
+}
+
 void correct(int32_t *a, uint32_t n) {
   uint32_t i;
-  int32_t x;
 
   for (i=0; i<n; i++) {
-    x = a[i];
-#if 1
-    x += ((x >> 16) & Q);
-    x -= Q;
-    x += ((x >> 16) & Q);
-#else
-    if (x < 0) {
-      x += Q;
-    } else if (x >= Q) {
-      x -= Q;
-    }
-#endif
-    a[i] = x;
+    a[i] = correct_coeff(a[i]);
   }
 }
 
@@ -223,6 +225,35 @@ void scalar_mul_reduce_array(int32_t *a, uint32_t n, int32_t c) {
 }
 
 
+/*
+ * Final step of the products: multiply, reduce twice, then correct
+ * in a single pass.
+ * - mul_reduce_finalize(a, n, p) is the same as
+ *     mul_reduce_array16(a, n, p);
+ *     reduce_array_twice(a, n);
+ *     correct(a, n);
+ * - scalar_mul_reduce_finalize(a, n, c) is the same as
+ *     scalar_mul_reduce_array(a, n, c);
+ *     reduce_array_twice(a, n);
+ *     correct(a, n);
+ */
+void mul_reduce_finalize(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = correct_coeff(red(red(mul_red(a[i], p[i]))));
+  }
+}
+
+void scalar_mul_reduce_finalize(int32_t *a, uint32_t n, int32_t c) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = correct_coeff(red(red(mul_red(a[i], c))));
+  }
+}
+
+
 
 
 /*
@@ -553,3 +584,874 @@ void nttmul_red_gs_std2rev(int32_t *a, uint32_t n, const int16_t *p) {
   }
 }
 
+
+/*
+ * RADIX-4 VARIANTS
+ */
+
+/*
+ * The radix-4 functions do the same butterflies as the radix-2 functions
+ * above but two rounds at a time: each pass loads four coefficients,
+ * applies the two rounds, and stores them back. The results (and the
+ * bounds) are the same as for the radix-2 functions.
+ *
+ * The tables are in consumption order: three coefficients per group
+ * in each pass, starting at p[1] (see make_red_tables.c).
+ */
+
+/*
+ * COOLEY-TUKEY/INPUT IN BIT-REVERSE ORDER/OUTPUT IN STANDARD ORDER
+ */
+void ntt_red_ct_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    /*
+     * Rounds t and 2t: for group j, the coefficients are
+     * a[s], a[s+t], a[s+2t], a[s+3t] with s = j + 4t * m
+     * - round t: (a[s], a[s+t]) and (a[s+2t], a[s+3t]) with w1 = w_t^j
+     * - round 2t: (a[s], a[s+2t]) with w2 = w_2t^j and
+     *   (a[s+t], a[s+3t]) with w3 = w_2t^(j+t)
+     */
+    // first group: j=0 so w1 = w2 = 1
+    w3 = p[i + 2];
+    for (s=0; s<n; s += 4*t) {
+      a0 = a[s];
+      a1 = a[s + t];
+      a2 = a[s + 2*t];
+      a3 = a[s + 3*t];
+      x = a0 - a1;
+      a0 = a0 + a1;
+      y = a2 - a3;
+      a2 = a2 + a3;
+      a[s] = a0 + a2;
+      a[s + 2*t] = a0 - a2;
+      y = mul_red(y, w3);
+      a[s + t] = x + y;
+      a[s + 3*t] = x - y;
+    }
+    i += 3;
+    // general case
+    for (j=1; j<t; j++, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=j; s<n; s += 4*t) {
+	x = mul_red(a[s + t], w1);
+	y = mul_red(a[s + 3*t], w1);
+	a0 = a[s] + x;
+	a1 = a[s] - x;
+	a2 = a[s + 2*t] + y;
+	a3 = a[s + 2*t] - y;
+	x = mul_red(a2, w2);
+	y = mul_red(a3, w3);
+	a[s] = a0 + x;
+	a[s + 2*t] = a0 - x;
+	a[s + t] = a1 + y;
+	a[s + 3*t] = a1 - y;
+      }
+    }
+  }
+
+  // last round if log2(n) is odd: t = n/2
+  if (t < n) {
+    x = a[t];
+    a[t] = a[0] - x;
+    a[0] = a[0] + x;
+    i ++;
+    for (j=1; j<t; j++, i++) {
+      w1 = p[i];
+      x = mul_red(a[j + t], w1);
+      a[j + t] = a[j] - x;
+      a[j] = a[j] + x;
+    }
+  }
+}
+
+void mulntt_red_ct_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    for (j=0; j<t; j++, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=j; s<n; s += 4*t) {
+	x = mul_red(a[s + t], w1);
+	y = mul_red(a[s + 3*t], w1);
+	a0 = a[s] + x;
+	a1 = a[s] - x;
+	a2 = a[s + 2*t] + y;
+	a3 = a[s + 2*t] - y;
+	x = mul_red(a2, w2);
+	y = mul_red(a3, w3);
+	a[s] = a0 + x;
+	a[s + 2*t] = a0 - x;
+	a[s + t] = a1 + y;
+	a[s + 3*t] = a1 - y;
+      }
+    }
+  }
+
+  if (t < n) {
+    for (j=0; j<t; j++, i++) {
+      w1 = p[i];
+      x = mul_red(a[j + t], w1);
+      a[j + t] = a[j] - x;
+      a[j] = a[j] + x;
+    }
+  }
+}
+
+
+/*
+ * COOLEY-TUKEY/INPUT IN STANDARD ORDER/OUTPUT IN BIT-REVERSE ORDER
+ */
+void ntt_red_ct_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, u, d, h;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  d = n >> 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    /*
+     * Rounds t and 2t: d = n/2t, h = d/2.
+     * For group j, the coefficients are a[s], a[s+h], a[s+d], a[s+d+h]
+     * with u <= s < u + h and u = 2d * j.
+     * - round t: (a[s], a[s+d]) and (a[s+h], a[s+d+h]) with w1
+     * - round 2t: (a[s], a[s+h]) with w2 and (a[s+d], a[s+d+h]) with w3
+     */
+    h = d >> 1;
+    // first group: j=0 so w1 = w2 = 1
+    w3 = p[i + 2];
+    for (s=0; s<h; s++) {
+      a0 = a[s];
+      a1 = a[s + h];
+      a2 = a[s + d];
+      a3 = a[s + d + h];
+      x = a0 - a2;
+      a0 = a0 + a2;
+      y = a1 - a3;
+      a1 = a1 + a3;
+      a[s] = a0 + a1;
+      a[s + h] = a0 - a1;
+      y = mul_red(y, w3);
+      a[s + d] = x + y;
+      a[s + d + h] = x - y;
+    }
+    i += 3;
+    // general case
+    for (j=1, u=2*d; j<t; j++, u += 2*d, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=u; s<u+h; s++) {
+	x = mul_red(a[s + d], w1);
+	y = mul_red(a[s + d + h], w1);
+	a0 = a[s] + x;
+	a2 = a[s] - x;
+	a1 = a[s + h] + y;
+	a3 = a[s + h] - y;
+	x = mul_red(a1, w2);
+	y = mul_red(a3, w3);
+	a[s] = a0 + x;
+	a[s + h] = a0 - x;
+	a[s + d] = a2 + y;
+	a[s + d + h] = a2 - y;
+      }
+    }
+    d >>= 2;
+  }
+
+  // last round if log2(n) is odd: t = n/2, d = 1
+  if (t < n) {
+    x = a[1];
+    a[1] = a[0] - x;
+    a[0] = a[0] + x;
+    i ++;
+    for (j=1, u=2; j<t; j++, u += 2, i++) {
+      w1 = p[i];
+      x = mul_red(a[u + 1], w1);
+      a[u + 1] = a[u] - x;
+      a[u] = a[u] + x;
+    }
+  }
+}
+
+void mulntt_red_ct_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, u, d, h;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  d = n >> 1;
+  for (t=1; 4*t<=n; t <<= 2) {
+    h = d >> 1;
+    for (j=0, u=0; j<t; j++, u += 2*d, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=u; s<u+h; s++) {
+	x = mul_red(a[s + d], w1);
+	y = mul_red(a[s + d + h], w1);
+	a0 = a[s] + x;
+	a2 = a[s] - x;
+	a1 = a[s + h] + y;
+	a3 = a[s + h] - y;
+	x = mul_red(a1, w2);
+	y = mul_red(a3, w3);
+	a[s] = a0 + x;
+	a[s + h] = a0 - x;
+	a[s + d] = a2 + y;
+	a[s + d + h] = a2 - y;
+      }
+    }
+    d >>= 2;
+  }
+
+  if (t < n) {
+    for (j=0, u=0; j<t; j++, u += 2, i++) {
+      w1 = p[i];
+      x = mul_red(a[u + 1], w1);
+      a[u + 1] = a[u] - x;
+      a[u] = a[u] + x;
+    }
+  }
+}
+
+
+/*
+ * GENTLEMAN-SANDE/INPUT IN BIT-REVERSE ORDER/OUTPUT IN STANDARD ORDER
+ */
+void ntt_red_gs_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, u, d;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  d = 1;
+  for (t=n>>1; t>=2; t >>= 2) {
+    /*
+     * Rounds d and 2d (t = n/2d): for group j, the coefficients are
+     * a[s], a[s+d], a[s+2d], a[s+3d] with u <= s < u+d and u = 4d * j.
+     * - round d: (a[s], a[s+d]) with w1 and (a[s+2d], a[s+3d]) with w2
+     * - round 2d: (a[s], a[s+2d]) and (a[s+d], a[s+3d]) with w3
+     */
+    // first group: j=0 so w1 = w3 = 1
+    w2 = p[i + 1];
+    for (s=0; s<d; s++) {
+      a0 = a[s];
+      a1 = a[s + d];
+      a2 = a[s + 2*d];
+      a3 = a[s + 3*d];
+      x = a0 - a1;
+      a0 = a0 + a1;
+      y = mul_red(a2 - a3, w2);
+      a2 = a2 + a3;
+      a[s] = a0 + a2;
+      a[s + 2*d] = a0 - a2;
+      a[s + d] = x + y;
+      a[s + 3*d] = x - y;
+    }
+    i += 3;
+    // general case
+    for (j=1, u=4*d; j<(t>>1); j++, u += 4*d, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=u; s<u+d; s++) {
+	a0 = a[s];
+	a1 = a[s + d];
+	a2 = a[s + 2*d];
+	a3 = a[s + 3*d];
+	x = mul_red(a0 - a1, w1);
+	a0 = a0 + a1;
+	y = mul_red(a2 - a3, w2);
+	a2 = a2 + a3;
+	a[s] = a0 + a2;
+	a[s + 2*d] = mul_red(a0 - a2, w3);
+	a[s + d] = x + y;
+	a[s + 3*d] = mul_red(x - y, w3);
+      }
+    }
+    d <<= 2;
+  }
+
+  // last round if log2(n) is odd: t = 1, d = n/2
+  if (t == 1) {
+    for (s=0; s<d; s++) {
+      x = a[s + d];
+      a[s + d] = a[s] - x;
+      a[s] = a[s] + x;
+    }
+  }
+}
+
+void nttmul_red_gs_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, u, d;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  d = 1;
+  for (t=n>>1; t>=2; t >>= 2) {
+    for (j=0, u=0; j<(t>>1); j++, u += 4*d, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=u; s<u+d; s++) {
+	a0 = a[s];
+	a1 = a[s + d];
+	a2 = a[s + 2*d];
+	a3 = a[s + 3*d];
+	x = mul_red(a0 - a1, w1);
+	a0 = a0 + a1;
+	y = mul_red(a2 - a3, w2);
+	a2 = a2 + a3;
+	a[s] = a0 + a2;
+	a[s + 2*d] = mul_red(a0 - a2, w3);
+	a[s + d] = x + y;
+	a[s + 3*d] = mul_red(x - y, w3);
+      }
+    }
+    d <<= 2;
+  }
+
+  if (t == 1) {
+    w1 = p[i];
+    for (s=0; s<d; s++) {
+      x = a[s + d];
+      a[s + d] = mul_red(a[s] - x, w1);
+      a[s] = a[s] + x;
+    }
+  }
+}
+
+
+/*
+ * GENTLEMAN-SANDE/INPUT IN STANDARD ORDER/OUTPUT IN BIT-REVERSE ORDER
+ */
+void ntt_red_gs_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, h;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  for (t=n>>1; t>=2; t >>= 2) {
+    /*
+     * Rounds t and t/2 (h = t/2): for group j, the coefficients are
+     * a[s], a[s+h], a[s+t], a[s+t+h] with s = j + 2t * m.
+     * - round t: (a[s], a[s+t]) with w1 and (a[s+h], a[s+t+h]) with w2
+     * - round h: (a[s], a[s+h]) and (a[s+t], a[s+t+h]) with w3
+     */
+    h = t >> 1;
+    // first group: j=0 so w1 = w3 = 1
+    w2 = p[i + 1];
+    for (s=0; s<n; s += 2*t) {
+      a0 = a[s];
+      a1 = a[s + h];
+      a2 = a[s + t];
+      a3 = a[s + t + h];
+      x = a0 - a2;
+      a0 = a0 + a2;
+      y = mul_red(a1 - a3, w2);
+      a1 = a1 + a3;
+      a[s] = a0 + a1;
+      a[s + h] = a0 - a1;
+      a[s + t] = x + y;
+      a[s + t + h] = x - y;
+    }
+    i += 3;
+    // general case
+    for (j=1; j<h; j++, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=j; s<n; s += 2*t) {
+	a0 = a[s];
+	a1 = a[s + h];
+	a2 = a[s + t];
+	a3 = a[s + t + h];
+	x = mul_red(a0 - a2, w1);
+	a0 = a0 + a2;
+	y = mul_red(a1 - a3, w2);
+	a1 = a1 + a3;
+	a[s] = a0 + a1;
+	a[s + h] = mul_red(a0 - a1, w3);
+	a[s + t] = x + y;
+	a[s + t + h] = mul_red(x - y, w3);
+      }
+    }
+  }
+
+  // last round if log2(n) is odd: t = 1
+  if (t == 1) {
+    for (s=0; s<n; s += 2) {
+      x = a[s + 1];
+      a[s + 1] = a[s] - x;
+      a[s] = a[s] + x;
+    }
+  }
+}
+
+void nttmul_red_gs_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i, j, s, t, h;
+  int32_t a0, a1, a2, a3, x, y, w1, w2, w3;
+
+  i = 1;
+  for (t=n>>1; t>=2; t >>= 2) {
+    h = t >> 1;
+    for (j=0; j<h; j++, i += 3) {
+      w1 = p[i];
+      w2 = p[i + 1];
+      w3 = p[i + 2];
+      for (s=j; s<n; s += 2*t) {
+	a0 = a[s];
+	a1 = a[s + h];
+	a2 = a[s + t];
+	a3 = a[s + t + h];
+	x = mul_red(a0 - a2, w1);
+	a0 = a0 + a2;
+	y = mul_red(a1 - a3, w2);
+	a1 = a1 + a3;
+	a[s] = a0 + a1;
+	a[s + h] = mul_red(a0 - a1, w3);
+	a[s + t] = x + y;
+	a[s + t + h] = mul_red(x - y, w3);
+      }
+    }
+  }
+
+  if (t == 1) {
+    w1 = p[i];
+    for (s=0; s<n; s += 2) {
+      x = a[s + 1];
+      a[s + 1] = mul_red(a[s] - x, w1);
+      a[s] = a[s] + x;
+    }
+  }
+}
+
+
+/*
+ * CONSTANT-GEOMETRY VARIANTS
+ */
+
+/*
+ * Copy b into a
+ */
+static void copy_array(int32_t *a, const int32_t *b, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = b[i];
+  }
+}
+
+/*
+ * All rounds use the same loop with h = n/2:
+ * - std2rev: butterfly on (src[i], src[i+h]), result in (dst[2i], dst[2i+1])
+ * - rev2std: butterfly on (src[2i], src[2i+1]), result in (dst[i], dst[i+h])
+ * Round k uses p[k * h + i] for butterfly i. The butterflies are the
+ * ones of the radix-2 functions so the results are the same.
+ *
+ * The rounds alternate between a and tmp. If log2(n) is odd, the result
+ * is copied back into a at the end.
+ */
+void ntt_red_ct_std2rev_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp) {
+  uint32_t i, h, t;
+  int32_t *src, *dst, *aux;
+  int32_t x;
+
+  h = n >> 1;
+  src = a;
+  dst = tmp;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      x = mul_red(src[i + h], p[i]);
+      dst[2*i] = src[i] + x;
+      dst[2*i + 1] = src[i] - x;
+    }
+    p += h;
+    aux = src; src = dst; dst = aux;
+  }
+  if (src != a) {
+    copy_array(a, src, n);
+  }
+}
+
+void ntt_red_gs_std2rev_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp) {
+  uint32_t i, h, t;
+  int32_t *src, *dst, *aux;
+  int32_t x, y;
+
+  h = n >> 1;
+  src = a;
+  dst = tmp;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      x = src[i];
+      y = src[i + h];
+      dst[2*i] = x + y;
+      dst[2*i + 1] = mul_red(x - y, p[i]);
+    }
+    p += h;
+    aux = src; src = dst; dst = aux;
+  }
+  if (src != a) {
+    copy_array(a, src, n);
+  }
+}
+
+void ntt_red_ct_rev2std_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp) {
+  uint32_t i, h, t;
+  int32_t *src, *dst, *aux;
+  int32_t x;
+
+  h = n >> 1;
+  src = a;
+  dst = tmp;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      x = mul_red(src[2*i + 1], p[i]);
+      dst[i] = src[2*i] + x;
+      dst[i + h] = src[2*i] - x;
+    }
+    p += h;
+    aux = src; src = dst; dst = aux;
+  }
+  if (src != a) {
+    copy_array(a, src, n);
+  }
+}
+
+void ntt_red_gs_rev2std_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp) {
+  uint32_t i, h, t;
+  int32_t *src, *dst, *aux;
+  int32_t x, y;
+
+  h = n >> 1;
+  src = a;
+  dst = tmp;
+  for (t=1; t<n; t <<= 1) {
+    for (i=0; i<h; i++) {
+      x = src[2*i];
+      y = src[2*i + 1];
+      dst[i] = x + y;
+      dst[i + h] = mul_red(x - y, p[i]);
+    }
+    p += h;
+    aux = src; src = dst; dst = aux;
+  }
+  if (src != a) {
+    copy_array(a, src, n);
+  }
+}
+
+
+
+/*
+ * LAZY REDUCTION
+ */
+
+/*
+ * Same as mulntt_red_ct_std2rev but the outputs of round k are
+ * reduced if bit k of rounds is set.
+ */
+void mulntt_red_ct_std2rev_lazy(int32_t *a, uint32_t n, const int16_t *p, uint32_t rounds) {
+  uint32_t j, k, s, t, u, d;
+  int32_t x, w;
+
+  d = n;
+  k = 0;
+  for (t=1; t<n; t <<= 1) {
+    d >>= 1;
+    k ++;
+    if (rounds & ((uint32_t) 1 << k)) {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = mul_red(a[s + d], w);
+          a[s + d] = red(a[s] - x);
+          a[s] = red(a[s] + x);
+        }
+      }
+    } else {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = mul_red(a[s + d], w);
+          a[s + d] = a[s] - x;
+          a[s] = a[s] + x;
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Same as nttmul_red_gs_rev2std but the outputs of round k are
+ * reduced if bit k of rounds is set.
+ */
+void nttmul_red_gs_rev2std_lazy(int32_t *a, uint32_t n, const int16_t *p, uint32_t rounds) {
+  uint32_t j, k, s, t, u, d;
+  int32_t w, x;
+
+  t = n;
+  k = 0;
+  for (d=1; d<n; d<<=1) {
+    t >>= 1;
+    k ++;
+    if (rounds & ((uint32_t) 1 << k)) {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = a[s + d];
+          a[s + d] = red(mul_red(a[s] - x, w));
+          a[s] = red(a[s] + x);
+        }
+      }
+    } else {
+      for (j=0, u=0; j<t; j++, u += 2*d) {
+        w = p[t + j];
+        for (s=u; s<u+d; s++) {
+          x = a[s + d];
+          a[s + d] = mul_red(a[s] - x, w);
+          a[s] = a[s] + x;
+        }
+      }
+    }
+  }
+}
+
+
+/*
+ * RECURSIVE (DEPTH-FIRST) VARIANTS
+ */
+
+/*
+ * Blocks of at most NTT_RED_LEAF coefficients are processed by the
+ * breadth-first loops. 2048 coefficients use 8KB so a leaf block and
+ * the part of the table it uses stay in a 32KB L1 cache.
+ */
+#ifndef NTT_RED_LEAF
+#define NTT_RED_LEAF 2048
+#endif
+
+/*
+ * Block numbering: the block of size m = n/2^l at position b * m
+ * is block r = 2^l + b (so the children of block r are 2r and 2r+1).
+ * Round t of the block (t=1, 2, ..., m/2) uses p[r * t + j]
+ * for j=0 ... t-1. For r=1, this is the same as the radix-2 loops.
+ */
+static void ntt_red_ct_std2rev_leaf(int32_t *a, uint32_t m, const int16_t *p, uint32_t r) {
+  uint32_t j, s, t, u, d;
+  int32_t x, w;
+
+  d = m;
+  for (t=1; t<m; t <<= 1) {
+    d >>= 1;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      w = p[r * t + j];
+      for (s=u; s<u+d; s++) {
+        x = mul_red(a[s + d], w);
+        a[s + d] = a[s] - x;
+        a[s] = a[s] + x;
+      }
+    }
+  }
+}
+
+void ntt_red_ct_std2rev_block(int32_t *a, uint32_t m, const int16_t *p, uint32_t r) {
+  uint32_t s, h;
+  int32_t x, w;
+
+  if (m <= NTT_RED_LEAF) {
+    ntt_red_ct_std2rev_leaf(a, m, p, r);
+  } else {
+    // first round then the two halves
+    h = m >> 1;
+    w = p[r];
+    for (s=0; s<h; s++) {
+      x = mul_red(a[s + h], w);
+      a[s + h] = a[s] - x;
+      a[s] = a[s] + x;
+    }
+    ntt_red_ct_std2rev_block(a, h, p, 2 * r);
+    ntt_red_ct_std2rev_block(a + h, h, p, 2 * r + 1);
+  }
+}
+
+void ntt_red_ct_std2rev_rec(int32_t *a, uint32_t n, const int16_t *p) {
+  ntt_red_ct_std2rev_block(a, n, p, 1);
+}
+
+static void ntt_red_gs_rev2std_leaf(int32_t *a, uint32_t m, const int16_t *p, uint32_t r) {
+  uint32_t j, s, t, u, d;
+  int32_t w, x;
+
+  t = m;
+  for (d=1; d<m; d<<=1) {
+    t >>= 1;
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      w = p[r * t + j];
+      for (s=u; s<u+d; s++) {
+        x = a[s + d];
+        a[s + d] = mul_red(a[s] - x, w);
+        a[s] = a[s] + x;
+      }
+    }
+  }
+}
+
+void ntt_red_gs_rev2std_block(int32_t *a, uint32_t m, const int16_t *p, uint32_t r) {
+  uint32_t s, h;
+  int32_t w, x;
+
+  if (m <= NTT_RED_LEAF) {
+    ntt_red_gs_rev2std_leaf(a, m, p, r);
+  } else {
+    // the two halves then the last round
+    h = m >> 1;
+    ntt_red_gs_rev2std_block(a, h, p, 2 * r);
+    ntt_red_gs_rev2std_block(a + h, h, p, 2 * r + 1);
+    w = p[r];
+    for (s=0; s<h; s++) {
+      x = a[s + h];
+      a[s + h] = mul_red(a[s] - x, w);
+      a[s] = a[s] + x;
+    }
+  }
+}
+
+void ntt_red_gs_rev2std_rec(int32_t *a, uint32_t n, const int16_t *p) {
+  ntt_red_gs_rev2std_block(a, n, p, 1);
+}
+
+/*
+ * Butterflies lo to hi-1 of a round with t blocks: butterfly
+ * q = j * d + i (with d = n/2t and i < d) combines a[j * 2d + i] and
+ * a[j * 2d + i + d] using p[t + j].
+ */
+void ntt_red_ct_std2rev_round(int32_t *a, uint32_t n, const int16_t *p, uint32_t t, uint32_t lo, uint32_t hi) {
+  uint32_t j, s, u, d, end;
+  int32_t x, w;
+
+  d = n/(2 * t);
+  while (lo < hi) {
+    j = lo/d;
+    u = j * 2 * d;
+    end = (hi < (j + 1) * d) ? hi : (j + 1) * d;
+    w = p[t + j];
+    for (s=u + lo - j * d; s<u + end - j * d; s++) {
+      x = mul_red(a[s + d], w);
+      a[s + d] = a[s] - x;
+      a[s] = a[s] + x;
+    }
+    lo = end;
+  }
+}
+
+void ntt_red_gs_rev2std_round(int32_t *a, uint32_t n, const int16_t *p, uint32_t t, uint32_t lo, uint32_t hi) {
+  uint32_t j, s, u, d, end;
+  int32_t x, w;
+
+  d = n/(2 * t);
+  while (lo < hi) {
+    j = lo/d;
+    u = j * 2 * d;
+    end = (hi < (j + 1) * d) ? hi : (j + 1) * d;
+    w = p[t + j];
+    for (s=u + lo - j * d; s<u + end - j * d; s++) {
+      x = a[s + d];
+      a[s + d] = mul_red(a[s] - x, w);
+      a[s] = a[s] + x;
+    }
+    lo = end;
+  }
+}
+
+
+/*
+ * FOUR-STEP VARIANTS
+ */
+
+/*
+ * Transpose: a is a matrix of rows x cols elements, b is its transpose
+ * (cols x rows). The copy is done by blocks of 8 x 8.
+ */
+void transpose(int32_t *b, const int32_t *a, uint32_t rows, uint32_t cols) {
+  uint32_t i, j, k, l, i_end, j_end;
+
+  for (i=0; i<rows; i += 8) {
+    i_end = (i + 8 < rows) ? i + 8 : rows;
+    for (j=0; j<cols; j += 8) {
+      j_end = (j + 8 < cols) ? j + 8 : cols;
+      for (k=i; k<i_end; k++) {
+        for (l=j; l<j_end; l++) {
+          b[l * rows + k] = a[k * cols + l];
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Multiply a[i] by p[i] then reduce: each coefficient is multiplied
+ * by 9 * p[i] modulo Q.
+ */
+static void mul_reduce_twice_array16(int32_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = red(mul_red(a[i], p[i]));
+  }
+}
+
+/*
+ * n = n1 * n2:
+ * 1) transpose a (n1 x n2) into tmp (n2 x n1)
+ * 2) n2 NTTs of size n1 on the rows of tmp (table p1)
+ * 3) multiply by the twiddle factors tw and reduce
+ * 4) transpose tmp into a (n1 x n2)
+ * 5) n1 NTTs of size n2 on the rows of a (table p2)
+ */
+void ntt_red_ct_std2rev_4step(int32_t *a, uint32_t n, uint32_t n1,
+                              const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  transpose(tmp, a, n1, n2);
+  for (i=0; i<n; i += n1) {
+    mulntt_red_ct_std2rev(tmp + i, n1, p1);
+  }
+  mul_reduce_twice_array16(tmp, n, tw);
+  transpose(a, tmp, n2, n1);
+  for (i=0; i<n; i += n2) {
+    mulntt_red_ct_std2rev(a + i, n2, p2);
+  }
+}
+
+/*
+ * Inverse of the above:
+ * 1) n1 NTTs of size n2 on the rows of a (table p2)
+ * 2) transpose a (n1 x n2) into tmp (n2 x n1)
+ * 3) multiply by the twiddle factors tw and reduce
+ * 4) n2 NTTs of size n1 on the rows of tmp (table p1)
+ * 5) transpose tmp into a
+ */
+void ntt_red_gs_rev2std_4step(int32_t *a, uint32_t n, uint32_t n1,
+                              const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp) {
+  uint32_t i, n2;
+
+  n2 = n/n1;
+  for (i=0; i<n; i += n2) {
+    nttmul_red_gs_rev2std(a + i, n2, p2);
+  }
+  transpose(tmp, a, n1, n2);
+  mul_reduce_twice_array16(tmp, n, tw);
+  for (i=0; i<n; i += n1) {
+    nttmul_red_gs_rev2std(tmp + i, n1, p1);
+  }
+  transpose(a, tmp, n2, n1);
+}
@@ -147,6 +147,18 @@ extern void mul_reduce_array(int32_t *c, uint32_t n, const int32_t *a, const int
  */
 extern void scalar_mul_reduce_array(int32_t *a, uint32_t n, int32_t c);
 
+/*
+ * Final step of the product functions: multiply, reduce twice, and
+ * convert to [0, Q-1] in a single pass.
+ * - mul_reduce_finalize(a, n, p): a[i] = correct(red(red(mul_red(a[i], p[i]))))
+ * - scalar_mul_reduce_finalize(a, n, c): a[i] = correct(red(red(mul_red(a[i], c))))
+ *
+ * These are equivalent to mul_reduce_array16 (or scalar_mul_reduce_array)
+ * followed by reduce_array_twice and correct.
+ */
+extern void mul_reduce_finalize(int32_t *a, uint32_t n, const int16_t *p);
+extern void scalar_mul_reduce_finalize(int32_t *a, uint32_t n, int32_t c);
+
 
 /****************
  * NTT VARIANTS *
@@ -283,4 +295,173 @@ extern void ntt_red_gs_std2rev(int32_t *a, uint32_t n, const int16_t *p);
  */
 extern void nttmul_red_gs_std2rev(int32_t *a, uint32_t n, const int16_t *p);
 
+
+/*
+ * RADIX-4 VARIANTS
+ */
+
+/*
+ * Same as versions 1 to 8 but with two rounds per pass over the array.
+ * - the butterflies are the same so the results and the bounds are
+ *   the same as for the radix-2 versions.
+ * - if log2(n) is odd, the last pass is a radix-2 round.
+ *
+ * The table p must be the radix-4 version of the table used by the
+ * radix-2 function (generated by make_red_tables):
+ *  <table>_ct_r4 for the Cooley-Tukey versions
+ *  <table>_gs_r4 for the Gentleman-Sande versions
+ * For example, ntt_red_ct_rev2std_r4 uses ntt_red<n>_omega_powers_ct_r4
+ * where ntt_red_ct_rev2std uses ntt_red<n>_omega_powers.
+ */
+extern void ntt_red_ct_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_red_ct_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_red_gs_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_red_gs_rev2std_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_red_gs_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_red_gs_std2rev_r4(int32_t *a, uint32_t n, const int16_t *p);
+
+
+/*
+ * CONSTANT-GEOMETRY VARIANTS
+ */
+
+/*
+ * All rounds access memory in the same way (Pease's constant geometry):
+ * - std2rev: each round reads a[i] and a[i+n/2] and writes
+ *   b[2i] and b[2i+1] for i=0 ... n/2-1
+ * - rev2std: each round reads b[2i] and b[2i+1] and writes
+ *   a[i] and a[i+n/2]
+ * where a and b alternate between the input array and tmp.
+ *
+ * - a = input/output array
+ * - tmp = scratch array of size n
+ * - p = table of n/2 * log2(n) coefficients: p[k * n/2 + i] is
+ *   used by butterfly i in round k. These tables are generated by
+ *   make_red_tables:
+ *  <table>_ct_cg for the Cooley-Tukey versions
+ *  <table>_gs_cg for the Gentleman-Sande versions
+ *
+ * The butterflies are the same as in the radix-2 versions:
+ * - with the mixed_powers tables, these compute the same as versions
+ *   2, 4, 6, 8.
+ * - with the omega_powers tables, they compute the same as versions
+ *   1, 3, 5, 7: the butterflies for j=0 multiply by inverse(3)
+ *   instead of skipping the multiplication, and mul_red(x, inverse(3)) = x.
+ */
+extern void ntt_red_ct_rev2std_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp);
+extern void ntt_red_ct_std2rev_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp);
+extern void ntt_red_gs_rev2std_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp);
+extern void ntt_red_gs_std2rev_cg(int32_t *a, uint32_t n, const int16_t *p, int32_t *tmp);
+
+
+/*
+ * LAZY REDUCTION
+ */
+
+/*
+ * Variants of versions 4 and 6 that reduce the result of some rounds.
+ * - rounds are numbered from 1 to log_2(n) (in execution order)
+ * - if bit k of rounds is set, the coefficients produced by round k
+ *   are replaced by red(x). Each reduction multiplies the result by 3
+ *   (modulo Q).
+ * - with rounds = 0, these are the same as mulntt_red_ct_std2rev and
+ *   nttmul_red_gs_rev2std.
+ *
+ * The schedules are computed by make_lazy_schedule (using the bounds
+ * of red_bounds.c).
+ */
+extern void mulntt_red_ct_std2rev_lazy(int32_t *a, uint32_t n, const int16_t *p, uint32_t rounds);
+extern void nttmul_red_gs_rev2std_lazy(int32_t *a, uint32_t n, const int16_t *p, uint32_t rounds);
+
+
+/*
+ * RECURSIVE VARIANTS
+ */
+
+/*
+ * Depth-first versions of ntt_red_ct_std2rev and ntt_red_gs_rev2std:
+ * - ct_std2rev does the first round on the whole array then recurses
+ *   on the two halves.
+ * - gs_rev2std recurses on the two halves then does the last round.
+ * Blocks of at most 2048 coefficients (8KB) are processed by the
+ * breadth-first loops, so the array is read once from memory for all
+ * the rounds done in a leaf block, instead of once per round.
+ *
+ * - p: same tables as the radix-2 versions (i.e., omega_powers_rev
+ *   or mixed_powers_rev for ct_std2rev, inv_omega_powers_rev or
+ *   inv_mixed_powers_rev for gs_rev2std).
+ *
+ * The butterflies are the same as in the radix-2 versions so the
+ * results are the same as versions 3, 4, 5, 6 (the butterflies for j=0
+ * multiply by inverse(3), like in the constant-geometry variants).
+ */
+extern void ntt_red_ct_std2rev_rec(int32_t *a, uint32_t n, const int16_t *p);
+extern void ntt_red_gs_rev2std_rec(int32_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * The same on block r of a size-n transform: the block has m = n/2^l
+ * coefficients and starts at a[b * m] where r = 2^l + b. It uses
+ * p[r * t + j] in round t. The transform is the same as running the
+ * rounds of ntt_red_ct_std2rev (or ntt_red_gs_rev2std) that apply to
+ * this block only (i.e., rounds l+1 to log2(n) for ct_std2rev, and
+ * rounds 1 to log2(m) for gs_rev2std).
+ *
+ * Different blocks of the same level are independent (used by ntt_par).
+ */
+extern void ntt_red_ct_std2rev_block(int32_t *a, uint32_t m, const int16_t *p, uint32_t r);
+extern void ntt_red_gs_rev2std_block(int32_t *a, uint32_t m, const int16_t *p, uint32_t r);
+
+/*
+ * Part of one round: round with t blocks of size 2d = n/t, butterflies
+ * lo to hi-1 out of n/2 (butterfly j * d + i is for block j).
+ * ct_std2rev and gs_rev2std do the same butterflies as round t of
+ * ntt_red_ct_std2rev and ntt_red_gs_rev2std, respectively.
+ */
+extern void ntt_red_ct_std2rev_round(int32_t *a, uint32_t n, const int16_t *p, uint32_t t, uint32_t lo, uint32_t hi);
+extern void ntt_red_gs_rev2std_round(int32_t *a, uint32_t n, const int16_t *p, uint32_t t, uint32_t lo, uint32_t hi);
+
+
+/*
+ * FOUR-STEP VARIANTS
+ */
+
+/*
+ * Transpose: a is a matrix with rows x cols elements (stored row
+ * by row). It's copied into b as a matrix of cols x rows elements.
+ * a and b must be distinct.
+ */
+extern void transpose(int32_t *b, const int32_t *a, uint32_t rows, uint32_t cols);
+
+/*
+ * Four-step versions of ntt_red_ct_std2rev and ntt_red_gs_rev2std:
+ * - n = n1 * n2: the array is seen as a matrix with n1 rows and n2 columns
+ * - the NTT is computed as n2 NTTs of size n1 (on the columns), a
+ *   multiplication by twiddle factors, and n1 NTTs of size n2 (on the rows).
+ *   The transpositions make all the small NTTs operate on contiguous blocks.
+ * - the result is the same as the full NTT modulo Q, in the same order
+ *   (i.e., bit-reverse order for ct_std2rev).
+ *
+ * - p1 = table for the column NTTs, p2 = table for the row NTTs,
+ *   tw = twiddle factors (generated by make_red_tables for n1 = n1_4step).
+ *   The small NTTs use a prefix of the tables for size n:
+ *     ct_std2rev: p1 = omega_powers_rev or mixed_powers_rev
+ *                 p2 = omega_powers_rev
+ *                 tw = twiddles_4step or mixed_twiddles_4step
+ *     gs_rev2std: p1 = inv_omega_powers_rev or inv_mixed_powers_rev
+ *                 p2 = inv_omega_powers_rev
+ *                 tw = inv_twiddles_4step or inv_mixed_twiddles_4step
+ *   With the mixed tables, these compute the same as mulntt_red_ct_std2rev
+ *   and nttmul_red_gs_rev2std.
+ * - tmp = scratch array of size n
+ *
+ * The coefficients are reduced after the twiddle multiplication so
+ * the second half of the NTT starts from small coefficients.
+ */
+extern void ntt_red_ct_std2rev_4step(int32_t *a, uint32_t n, uint32_t n1,
+                                     const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp);
+extern void ntt_red_gs_rev2std_4step(int32_t *a, uint32_t n, uint32_t n1,
+                                     const int16_t *p1, const int16_t *p2, const int16_t *tw, int32_t *tmp);
+
 #endif /* NTT_RED_H */
@@ -31,9 +31,7 @@ void ntt_red1024_product1(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_ct_rev2std(c);
-  mul_reduce_array16(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct(c, 1024);
+  mul_reduce_finalize(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product2(int32_t *c, int32_t *a, int32_t *b) {
@@ -55,9 +53,7 @@ void ntt_red1024_product2(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_ct_rev2std(c);
-  mul_reduce_array16(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct(c, 1024);
+  mul_reduce_finalize(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product3(int32_t *c, int32_t *a, int32_t *b) {
@@ -79,9 +75,7 @@ void ntt_red1024_product3(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_gs_rev2std(c);
-  mul_reduce_array16(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct(c, 1024);
+  mul_reduce_finalize(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product4(int32_t *c, int32_t *a, int32_t *b) {
@@ -103,9 +97,7 @@ void ntt_red1024_product4(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_gs_rev2std(c);
-  mul_reduce_array16(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct(c, 1024);
+  mul_reduce_finalize(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product5(int32_t *c, int32_t *a, int32_t *b) {
@@ -121,7 +113,47 @@ void ntt_red1024_product5(int32_t *c, int32_t *a, int32_t *b) {
   reduce_array_twice(c, 1024);  // c[i] = 9 * c[i] mod Q
 
   inttmul_red1024_gs_rev2std(c);
-  scalar_mul_reduce_array(c, 1024, ntt_red1024_rescale8);
-  reduce_array_twice(c, 1024);
-  correct(c, 1024);
+  scalar_mul_reduce_finalize(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product_r4(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_r4(a);
+  reduce_array(a, 1024);
+
+  mulntt_red1024_ct_std2rev_r4(b);
+  reduce_array(b, 1024);
+
+  mul_reduce_array(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_r4(c);
+  scalar_mul_reduce_finalize(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product7(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_cg(a, c); // c is used as scratch
+  reduce_array(a, 1024);
+
+  mulntt_red1024_ct_std2rev_cg(b, c);
+  reduce_array(b, 1024);
+
+  mul_reduce_array(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_cg(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product_4step(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_4step(a, c); // c is used as scratch
+  reduce_array(a, 1024);
+
+  mulntt_red1024_ct_std2rev_4step(b, c);
+  reduce_array(b, 1024);
+
+  mul_reduce_array(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_4step(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
 }
@@ -70,6 +70,146 @@ static inline void inttmul_red1024_gs_std2rev(int32_t *a) {
 }
 
 
+/*
+ * Radix-4 versions: same results as above
+ */
+static inline void ntt_red1024_ct_rev2std_r4(int32_t *a) {
+  ntt_red_ct_rev2std_r4(a, 1024, ntt_red1024_omega_powers_ct_r4);
+}
+
+static inline void ntt_red1024_gs_rev2std_r4(int32_t *a) {
+  ntt_red_gs_rev2std_r4(a, 1024, ntt_red1024_omega_powers_rev_gs_r4);
+}
+
+static inline void ntt_red1024_ct_std2rev_r4(int32_t *a) {
+  ntt_red_ct_std2rev_r4(a, 1024, ntt_red1024_omega_powers_rev_ct_r4);
+}
+
+static inline void ntt_red1024_gs_std2rev_r4(int32_t *a) {
+  ntt_red_gs_std2rev_r4(a, 1024, ntt_red1024_omega_powers_gs_r4);
+}
+
+static inline void intt_red1024_ct_rev2std_r4(int32_t *a) {
+  ntt_red_ct_rev2std_r4(a, 1024, ntt_red1024_inv_omega_powers_ct_r4);
+}
+
+static inline void intt_red1024_gs_rev2std_r4(int32_t *a) {
+  ntt_red_gs_rev2std_r4(a, 1024, ntt_red1024_inv_omega_powers_rev_gs_r4);
+}
+
+static inline void intt_red1024_ct_std2rev_r4(int32_t *a) {
+  ntt_red_ct_std2rev_r4(a, 1024, ntt_red1024_inv_omega_powers_rev_ct_r4);
+}
+
+static inline void intt_red1024_gs_std2rev_r4(int32_t *a) {
+  ntt_red_gs_std2rev_r4(a, 1024, ntt_red1024_inv_omega_powers_gs_r4);
+}
+
+static inline void mulntt_red1024_ct_rev2std_r4(int32_t *a) {
+  mulntt_red_ct_rev2std_r4(a, 1024, ntt_red1024_mixed_powers_ct_r4);
+}
+
+static inline void mulntt_red1024_ct_std2rev_r4(int32_t *a) {
+  mulntt_red_ct_std2rev_r4(a, 1024, ntt_red1024_mixed_powers_rev_ct_r4);
+}
+
+static inline void inttmul_red1024_gs_rev2std_r4(int32_t *a) {
+  nttmul_red_gs_rev2std_r4(a, 1024, ntt_red1024_inv_mixed_powers_rev_gs_r4);
+}
+
+static inline void inttmul_red1024_gs_std2rev_r4(int32_t *a) {
+  nttmul_red_gs_std2rev_r4(a, 1024, ntt_red1024_inv_mixed_powers_gs_r4);
+}
+
+
+/*
+ * Constant-geometry versions: same results as above
+ * - tmp must be an array of 1024 elements
+ */
+static inline void ntt_red1024_ct_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_rev2std_cg(a, 1024, ntt_red1024_omega_powers_ct_cg, tmp);
+}
+
+static inline void ntt_red1024_gs_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_cg(a, 1024, ntt_red1024_omega_powers_rev_gs_cg, tmp);
+}
+
+static inline void ntt_red1024_ct_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_cg(a, 1024, ntt_red1024_omega_powers_rev_ct_cg, tmp);
+}
+
+static inline void ntt_red1024_gs_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_std2rev_cg(a, 1024, ntt_red1024_omega_powers_gs_cg, tmp);
+}
+
+static inline void intt_red1024_ct_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_rev2std_cg(a, 1024, ntt_red1024_inv_omega_powers_ct_cg, tmp);
+}
+
+static inline void intt_red1024_gs_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_cg(a, 1024, ntt_red1024_inv_omega_powers_rev_gs_cg, tmp);
+}
+
+static inline void intt_red1024_ct_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_cg(a, 1024, ntt_red1024_inv_omega_powers_rev_ct_cg, tmp);
+}
+
+static inline void intt_red1024_gs_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_std2rev_cg(a, 1024, ntt_red1024_inv_omega_powers_gs_cg, tmp);
+}
+
+static inline void mulntt_red1024_ct_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_rev2std_cg(a, 1024, ntt_red1024_mixed_powers_ct_cg, tmp);
+}
+
+static inline void mulntt_red1024_ct_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_cg(a, 1024, ntt_red1024_mixed_powers_rev_ct_cg, tmp);
+}
+
+static inline void inttmul_red1024_gs_rev2std_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_cg(a, 1024, ntt_red1024_inv_mixed_powers_rev_gs_cg, tmp);
+}
+
+static inline void inttmul_red1024_gs_std2rev_cg(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_std2rev_cg(a, 1024, ntt_red1024_inv_mixed_powers_gs_cg, tmp);
+}
+
+
+/*
+ * Four-step versions: same results as above modulo Q
+ * - tmp must be an array of 1024 elements
+ */
+static inline void ntt_red1024_ct_std2rev_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_omega_powers_rev,
+                           ntt_red1024_omega_powers_rev, ntt_red1024_twiddles_4step, tmp);
+}
+
+static inline void ntt_red1024_gs_rev2std_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_omega_powers_rev,
+                           ntt_red1024_omega_powers_rev, ntt_red1024_twiddles_4step, tmp);
+}
+
+static inline void intt_red1024_ct_std2rev_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_omega_powers_rev,
+                           ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_twiddles_4step, tmp);
+}
+
+static inline void intt_red1024_gs_rev2std_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_omega_powers_rev,
+                           ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_twiddles_4step, tmp);
+}
+
+static inline void mulntt_red1024_ct_std2rev_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_mixed_powers_rev,
+                           ntt_red1024_omega_powers_rev, ntt_red1024_mixed_twiddles_4step, tmp);
+}
+
+static inline void inttmul_red1024_gs_rev2std_4step(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_mixed_powers_rev,
+                           ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_mixed_twiddles_4step, tmp);
+}
+
+
 /*
  * PRODUCTS
  */
@@ -90,4 +230,19 @@ extern void ntt_red1024_product3(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product4(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product5(int32_t *c, int32_t *a, int32_t *b);
 
+/*
+ * Same as product5 but with the radix-4 NTTs
+ */
+extern void ntt_red1024_product_r4(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the constant-geometry NTTs
+ */
+extern void ntt_red1024_product7(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the four-step NTTs
+ */
+extern void ntt_red1024_product_4step(int32_t *c, int32_t *a, int32_t *b);
+
 #endif /* __NTT_RED1024_H */
@@ -0,0 +1,44 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 1024. The inputs are in [0, 12288].
+ * The products ntt_red1024_product5 and ntt_red1024_product5_asm use 4 reductions.
+ *
+ * C schedule: 3 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 32560
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 83045022
+ * - pointwise product, then 2 reductions: |c[i]| <= 12328
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 309019872
+ *
+ * AVX2 schedule: 3 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 32560
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 83045022
+ * - pointwise product, then 2 reductions: |c[i]| <= 12328
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 309019872
+ *
+ */
+
+#include "ntt_red.h"
+#include "ntt_red1024.h"
+#include "ntt_asm.h"
+#include "ntt_red_asm1024.h"
+#include "ntt_red1024_lazy.h"
+
+void ntt_red1024_lazy_product(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev(a);
+  reduce_array(a, 1024);
+  mulntt_red1024_ct_std2rev(b);
+  mul_reduce_array(c, 1024, a, b);
+  reduce_array_twice(c, 1024);
+  inttmul_red1024_gs_rev2std(c);
+  scalar_mul_reduce_finalize(c, 1024, ntt_red1024_lazy_rescale);
+}
+
+void ntt_red1024_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_fused_asm(a);
+  mulntt_red1024_ct_std2rev_asm(b);
+  mul_reduce_array_asm(c, 1024, a, b);
+  reduce_array_twice_asm(c, 1024);
+  inttmul_red1024_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 1024, ntt_red1024_lazy_asm_rescale);
+}
@@ -0,0 +1,58 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 1024. The inputs are in [0, 12288].
+ * The products ntt_red1024_product5 and ntt_red1024_product5_asm use 4 reductions.
+ *
+ * C schedule: 3 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 32560
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 83045022
+ * - pointwise product, then 2 reductions: |c[i]| <= 12328
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 309019872
+ *
+ * AVX2 schedule: 3 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 32560
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 83045022
+ * - pointwise product, then 2 reductions: |c[i]| <= 12328
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 309019872
+ *
+ */
+
+#ifndef __NTT_RED1024_LAZY_H
+#define __NTT_RED1024_LAZY_H
+
+#include <stdint.h>
+
+/*
+ * SCHEDULES
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_red1024_lazy_fwd_a_rounds = 0x0;
+static const uint32_t ntt_red1024_lazy_fwd_a_reductions = 1;
+static const uint32_t ntt_red1024_lazy_fwd_b_rounds = 0x0;
+static const uint32_t ntt_red1024_lazy_fwd_b_reductions = 0;
+static const uint32_t ntt_red1024_lazy_pointwise_reductions = 2;
+static const uint32_t ntt_red1024_lazy_inv_rounds = 0x0;
+static const int32_t ntt_red1024_lazy_rescale = 472;
+
+static const uint32_t ntt_red1024_lazy_asm_fwd_a_rounds = 0x0;
+static const uint32_t ntt_red1024_lazy_asm_fwd_a_reductions = 1;
+static const uint32_t ntt_red1024_lazy_asm_fwd_b_rounds = 0x0;
+static const uint32_t ntt_red1024_lazy_asm_fwd_b_reductions = 0;
+static const uint32_t ntt_red1024_lazy_asm_pointwise_reductions = 2;
+static const uint32_t ntt_red1024_lazy_asm_inv_rounds = 0x0;
+static const int32_t ntt_red1024_lazy_asm_rescale = 472;
+
+/*
+ * PRODUCTS
+ * - input: a and b must contain integers in [0, 12288]
+ * - the product is stored in c, in standard order, with coefficients in [0, 12288]
+ * - a and b are modified
+ * - the _asm variant requires AVX2
+ */
+extern void ntt_red1024_lazy_product(int32_t *c, int32_t *a, int32_t *b);
+extern void ntt_red1024_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b);
+
+#endif /* __NTT_RED1024_LAZY_H */
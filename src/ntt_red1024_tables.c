@@ -0,0 +1,11904 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red1024_tables.h"
+
+const int16_t ntt_red1024_psi_powers[1024] = {
+    -4096,   338, -1360, -2672, -5828,  1417,  -975, -5530,
+    -3636,  -204,  2057, -3332,   827,  2926,  5315, -5461,
+     4885,   923,  1958, -5406,  -790, -2275,  3482,  3805,
+     -476, -3393,   418,  6026,  2731,  4209,  3643, -4987,
+    -6039, -3624,  -325,  2253, -1212,   -68,  4782, -5207,
+     4372, -3121,  5868,  2276, -2468,  4404,  4749, -1802,
+     3833,  3338,  5257, -2828, -4255, -1131, -3957,  6105,
+    -3186,  1403, -2882,  2434, -2013, -1208,  3988,   751,
+     -404, -4119,  1594, -5832, -2639,  3056,  1956,  4855,
+    -4919,  1468,  1583, -4697,  5374,  5209, -2344, -5039,
+     2678,  -377, -1319,  2035, -1062,  4564, -5057, -3285,
+     -671, -4499, -2767, -3846, -4231, -1373, -3565, -1944,
+    -4976,  5115,   652, -2478, -5736, -3607,  4624, -5662,
+    -2305, -2360,  3315, -5776,  4989, -4222, -4536, -3418,
+     -354, -2575, -5782, -1095, -4320, -5596,  3174, -1282,
+     2686, -4554,  2908,  -648, -5755,  1705, -3879,  -826,
+    -1912,  2894, -2555,  2209,  3328, -4883,  1105,  2171,
+     1663,  2689, -1512,  2957,  -118,  3238,  2169,  -365,
+    -1440,  2231,  1058,  3669, -3201, -1518, -3127,  -216,
+     2178, -3528, -1293,  3821,  3459,  5061, -4948, -3360,
+    -2987, -5724, -3728,  4820, -3542, -3200,  -504,  5082,
+     4057, -3017,   723, -4218,  -480,  4840,  4449,  1223,
+    -1067,  -506,  3054,   -72,   726, -1176,  -431,  5370,
+     1153,  1687,  2447, -1120, -5092, -1908, -5339,  5703,
+    -5277, -5163,  -168,  1694, -2744, -5102,   241, -1406,
+     -160, -2483,  1483,  4504, -4452, -4265,  1018,   -24,
+      242,  -392, -4240,  1790, -3712, -3534,  4912,  3723,
+     2399,  -636, -5876,  1901, -1759, -1721,   -56,  4661,
+    -5011, -5797, -4016, -4565,  4043, -4924, -3602, -2595,
+    -1484, -5518, -3757,    -8,  4177, -4227,  2683,  4693,
+     2859, -1178, -2459,  1241,  4896,  -212, -6055,  4730,
+     3510, -4670, -4115,  5650,  2426,  2164, -5435, -5618,
+     5444,  2455, -5297,  -865, -4591,  2257,  2844, -4099,
+    -2704, -1409, -3202, -2532,   953, -4489, -4916,  4510,
+     1632, -4167,  2078,  5673,  1170, -5653, -5468, -2213,
+     4905, -3375, -5908, -5969,  5911, -3278, -5862,  3808,
+     2566, -3344,   948,  2730,  3195, -4566,  3029,  -844,
+     4414,  2600, -5735, -2593,   544, -1389,  4789,  1891,
+      390,  2212, -5919, -4834,  1635, -1125,  2127, -6086,
+    -2126, -5189, -1954, -2827, -3241, -5211,   316,   910,
+     1065, -1522,  5106,  3815, -2625,  4963, -6008,  3232,
+    -3915,  -463, -2500, -3466,   130, -3359, -1973,  2485,
+      545,  -375,   709, -6125, -4805, -5826,  3445,  3154,
+     3016, -1737, -3991, -3793,   355,  3589,  1702,  5368,
+     -875, -2442, -6099, -3019, -1305,  3942,  3263,  2941,
+    -4053, -5216, -4754, -3268,  4278,  -125, -3860, -6138,
+    -5698, -1942, -2948, -3045, -3091,  -579,  2766,  2832,
+    -3978, -2900, -3529, -2307, -4388,  -814, -2033,  3090,
+     -435,  1314,  5184, -3116, -1351, -5835, -5681,  3007,
+     1426, -4138, -5383, -2046,  2197,  3449, -5079, -1015,
+     3066,  -193,   922,   944, -1326, -5063,  2920,  -769,
+    -5559,  3825, -4774,  1030,  -145,   438,  1728, -5135,
+     3646, -1945, -5990, -3094, -3621,  2717,  2302,  -682,
+    -3364,  5246, -1693,  3758,  1022,  4032, -3789,  4411,
+     -442, -5784, -3123,  3840, -1853,  1275,  2505, -3753,
+     4048,   146,   576, -5808, -2881,  3448, -6093,  3065,
+    -1207,  5002, -3329,  3869,  2975,  5845,  3532,  5349,
+     4437,  1344, -1263, -2626,  3949, -1928, -1041,  1280,
+    -4714,   425,   835, -1251, -2747,  4145,   192, -1936,
+     3136, -2947, -2031,  5118,  3694, -2429, -5206,  5386,
+     5088, -2148, -2919,  1783,  1479,   448,  -421,  3221,
+    -2780, -4739,  -347,  4523,  2525,  4238, -3818,  -417,
+    -5012,  5478,    64,  3451, -3051,  3114,  -677,  1706,
+    -2865, -4906,  2361, -2301,  1696,  -716,  -973, -3502,
+      493, -3947,  3956,  5170, -5023, -5676, -4212,  5604,
+     4938,  5509, -5369,  -139, -5767,  1826, -4075, -2946,
+    -1017,  1038, -4322,  4665,  -955,  2461,   787,  -767,
+    -3531, -4335,  3772,  2929, -3932, -5412,  5415, -2373,
+     2422, -1892, -1404,  1868,  1646, -2260, -5886,  4050,
+     2174,  4705,  2738,  -982,  -339,   346, -5537,  1555,
+     3778, -3276, -3834, -4352, -1177, -1445, -2839, -3120,
+    -5407, -1804,  1805,  -791, -3289, -4727,  -468,  4719,
+     4645,  3343, -1962,  1350,  4821, -2528,  5009,  3769,
+     -113, -3981, -5942, -3578, -2837, -1092, -1278, -5547,
+     3704, -4578,  3150, -1040,  2294,  3495,  4698, -4360,
+     3000, -5672,  -156,  1573, -2548, -2982,  -654,   450,
+     1607, -4939,  5766, -2840, -4134, -1327, -6077, -5289,
+    -5042,  -364,  -426, -1849,  5331, -1526,  1050, -4443,
+     4861,  1165,  1566,  2643,  1000, -5987,   -52, -3572,
+     3247,  -994,  -218,   150,  4632,  2450,  1922, -5043,
+    -1378,  3654, -6122, -1763, -5777,  3975,  -142,  3480,
+     1777, -4605,   350, -1481, -2476, -3708,   522,   881,
+    -3763, -6092,  4079, -5287, -3014,  3765, -4169,    50,
+     1544,  4913,  4737, -1681,  3637,  1218, -6137, -4684,
+    -6022,  1325,  4049,  1160, -3504, -1535,  4213, -4590,
+     3271, -1236,   174,  4390,  2842, -6127,  5456,  2334,
+    -5101,  1255, -5486,  4113,  4611,  5734,  1579,  3536,
+    -2884,   406, -6142,  2535,  2089,  4538,  5446,  4483,
+    -1168, -4608, -2692, -1530, -3006,  -412,    58, -2633,
+    -3149,  2054,  5915,   778,  2396, -3678, -5925,  1371,
+     1537, -2185, -3570,  5275,  3135, -3961,  2049,   845,
+    -3400,  5609, -2281, -2602,  3707, -1536,  3199,  -510,
+    -1002,  3959, -4077, -4974, -5146,  4781,  6068, -3837,
+     4895, -1226, -1975,   457, -3584,  3368, -1190, -2338,
+     1045,  2776,   683,  4378,  2963,  5966,  3336,  3229,
+     5332,  -512, -3030,  -170,  -334,  5416, -1359, -1658,
+     2381,  5690,  6119, -1279,  5728, -4505,  3438, -3944,
+    -5291,  5219, -4493,  3317, -3748, -3171,  4324, -2637,
+     5084,  6085,  1112, -3020, -2319, -4267, -1010, -4153,
+     3985, -2291,  -453, -4649,  4890,  5993,  6136,  3670,
+    -2187, -5598,  1146, -5411, -5860,  5836, -5594,  5202,
+     2847, -1057, -2655,  -879,  5791, -2068,  4467, -5103,
+     -773,  2674, -4433,  2712, -2768, -4860,  -151, -5646,
+     1630,  6094, -2051, -2873,  -729, -1866,   382, -5900,
+     2143, -2151, -5961,  1734,   949,  3744,  -885,  -293,
+    -2166,  3407,  1489, -1701, -4354, -3205, -5574,   904,
+    -5019, -1620,  4046, -1882, -3553, -2065, -4780, -5054,
+     -243,  -622, -3969, -6063, -3382,  -717, -1987,   578,
+    -3780,  1248,  -295, -4194,  -722,  5232, -3600,  -567,
+     2645,  3028, -1858, -3795, -1673,  -540,  5445,  3469,
+     2912,  3408,  2503, -5781,   -81,  3889, -1323, -2021,
+     2969,  -239,  3434,  4289, -1260,   416,  3998, -1398,
+    -4337,  1744, -1200,  -189,  4978, -3087,  3477, -1265,
+    -4654,  -180,  1815, -2940,  5067,  1136, -3262, -1927,
+      -27, -2800,  -441, -4770,  5086, -4176,  5241,  5526,
+     -420,  4235,  5429,  -466, -5542, -3515,  -400,   -63,
+    -2437, -1029,  1159, -4518,  2545,   -60,   605,  -980,
+     1689,  4475,  3009,  3454,    -9,  3163,  -147, -1590,
+    -2401, -1392,  1747,  1842,  -140,  5508,  5906,  3941,
+     2249, -5268,  3963,   -21,  3284,  -343, -3710, -1506,
+    -3248,   -20,  4298, -4423,   563,  5588,  1003, -2945,
+       -3, -3042,   -49,  -530,  3296,  -464, -3514,   614,
+    -4143,  1836,  6065,  5410,  4846, -1756,  1321,    -7,
+     5191,  3982, -5333,  -502, -5179, -4103,  5529,  2622,
+     4284,  5959, -3762, -5078,    -1, -1014,  4080, -4273,
+     5195, -4251,  2925,  4301, -1381,   612,  6118, -2293,
+    -2481,  3511, -3656,  4094, -2366, -2769, -5874,  3929,
+     2370, -5464,  1843,   874,  1428, -2110, -1254, -5789,
+};
+
+const int16_t ntt_red1024_psi_powers_rev[1024] = {
+        0, -4096, -4096,  5444, -4096,  5444, -1912,  -435,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+     4885,  1632, -1440,  3066,  2678,   545,   242, -4714,
+     3833,   390, -1067,  -442,  -354, -5698,  2859, -5012,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+     4885,  1632, -1440,  3066,  2678,   545,   242, -4714,
+     3833,   390, -1067,  -442,  -354, -5698,  2859, -5012,
+    -3636, -2704,  1663,  1426, -4919, -3915,  -160,  4437,
+     4372,  4414,  4057, -3364, -2305, -4053, -1484, -2780,
+     -476,  4905,  2178, -5559,  -671,  3016,  2399,  3136,
+    -3186, -2126,  1153,  4048,  2686, -3978,  3510, -2865,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+     4885,  1632, -1440,  3066,  2678,   545,   242, -4714,
+     3833,   390, -1067,  -442,  -354, -5698,  2859, -5012,
+    -3636, -2704,  1663,  1426, -4919, -3915,  -160,  4437,
+     4372,  4414,  4057, -3364, -2305, -4053, -1484, -2780,
+     -476,  4905,  2178, -5559,  -671,  3016,  2399,  3136,
+    -3186, -2126,  1153,  4048,  2686, -3978,  3510, -2865,
+    -5828, -4591,  3328, -1351, -2639, -2625, -2744,  2975,
+    -1212,  3195, -3542, -3621, -5736, -1305,  4043,  1479,
+     -790,  1170, -3201, -1326, -1062, -4805, -3712, -2747,
+    -4255,  1635,   726, -1853, -4320, -3091,  4896, -3051,
+      827,   953,  -118,  2197,  5374,   130, -4452,  3949,
+    -2468,   544,  -480,  1022,  4989,  4278,  4177,  2525,
+     2731,  5911,  3459,  -145, -4231,   355, -1759,  3694,
+    -2013, -3241, -5092, -2881, -5755, -4388,  2426,  1696,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+     4885,  1632, -1440,  3066,  2678,   545,   242, -4714,
+     3833,   390, -1067,  -442,  -354, -5698,  2859, -5012,
+    -3636, -2704,  1663,  1426, -4919, -3915,  -160,  4437,
+     4372,  4414,  4057, -3364, -2305, -4053, -1484, -2780,
+     -476,  4905,  2178, -5559,  -671,  3016,  2399,  3136,
+    -3186, -2126,  1153,  4048,  2686, -3978,  3510, -2865,
+    -5828, -4591,  3328, -1351, -2639, -2625, -2744,  2975,
+    -1212,  3195, -3542, -3621, -5736, -1305,  4043,  1479,
+     -790,  1170, -3201, -1326, -1062, -4805, -3712, -2747,
+    -4255,  1635,   726, -1853, -4320, -3091,  4896, -3051,
+      827,   953,  -118,  2197,  5374,   130, -4452,  3949,
+    -2468,   544,  -480,  1022,  4989,  4278,  4177,  2525,
+     2731,  5911,  3459,  -145, -4231,   355, -1759,  3694,
+    -2013, -3241, -5092, -2881, -5755, -4388,  2426,  1696,
+    -1360, -5297, -2555,  5184,  1594,  5106,  -168, -3329,
+     -325,   948, -3728, -5990,   652, -6099, -4016, -2919,
+     1958,  2078,  1058,   922, -1319,   709, -4240,   835,
+     5257, -5919,  3054, -3123, -5782, -2948, -2459,    64,
+     2057, -3202, -1512, -5383,  1583, -2500,  1483, -1263,
+     5868, -5735,   723, -1693,  3315, -4754, -3757,  -347,
+      418, -5908, -1293, -4774, -2767, -3991, -5876, -2031,
+    -2882, -1954,  2447,   576,  2908, -3529, -4115,  2361,
+     -975,  2844,  1105, -5681,  1956, -6008,   241,  3532,
+     4782,  3029,  -504,  2302,  4624,  3263, -3602,  -421,
+     3482, -5468, -3127,  2920, -5057,  3445,  4912,   192,
+    -3957,  2127,  -431,  2505,  3174,  2766, -6055,  -677,
+     5315, -4916,  2169, -5079, -2344, -1973,  1018, -1041,
+     4749,  4789,  4449, -3789, -4536, -3860,  2683, -3818,
+     3643, -5862, -4948,  1728, -3565,  1702,   -56, -5206,
+     3988,   316, -5339, -6093, -3879, -2033, -5435,  -973,
+    -4096,  5444, -1912,  -435,  -404,  1065, -5277, -1207,
+    -6039,  2566, -2987,  3646, -4976,  -875, -5011,  5088,
+     4885,  1632, -1440,  3066,  2678,   545,   242, -4714,
+     3833,   390, -1067,  -442,  -354, -5698,  2859, -5012,
+    -3636, -2704,  1663,  1426, -4919, -3915,  -160,  4437,
+     4372,  4414,  4057, -3364, -2305, -4053, -1484, -2780,
+     -476,  4905,  2178, -5559,  -671,  3016,  2399,  3136,
+    -3186, -2126,  1153,  4048,  2686, -3978,  3510, -2865,
+    -5828, -4591,  3328, -1351, -2639, -2625, -2744,  2975,
+    -1212,  3195, -3542, -3621, -5736, -1305,  4043,  1479,
+     -790,  1170, -3201, -1326, -1062, -4805, -3712, -2747,
+    -4255,  1635,   726, -1853, -4320, -3091,  4896, -3051,
+      827,   953,  -118,  2197,  5374,   130, -4452,  3949,
+    -2468,   544,  -480,  1022,  4989,  4278,  4177,  2525,
+     2731,  5911,  3459,  -145, -4231,   355, -1759,  3694,
+    -2013, -3241, -5092, -2881, -5755, -4388,  2426,  1696,
+    -1360, -5297, -2555,  5184,  1594,  5106,  -168, -3329,
+     -325,   948, -3728, -5990,   652, -6099, -4016, -2919,
+     1958,  2078,  1058,   922, -1319,   709, -4240,   835,
+     5257, -5919,  3054, -3123, -5782, -2948, -2459,    64,
+     2057, -3202, -1512, -5383,  1583, -2500,  1483, -1263,
+     5868, -5735,   723, -1693,  3315, -4754, -3757,  -347,
+      418, -5908, -1293, -4774, -2767, -3991, -5876, -2031,
+    -2882, -1954,  2447,   576,  2908, -3529, -4115,  2361,
+     -975,  2844,  1105, -5681,  1956, -6008,   241,  3532,
+     4782,  3029,  -504,  2302,  4624,  3263, -3602,  -421,
+     3482, -5468, -3127,  2920, -5057,  3445,  4912,   192,
+    -3957,  2127,  -431,  2505,  3174,  2766, -6055,  -677,
+     5315, -4916,  2169, -5079, -2344, -1973,  1018, -1041,
+     4749,  4789,  4449, -3789, -4536, -3860,  2683, -3818,
+     3643, -5862, -4948,  1728, -3565,  1702,   -56, -5206,
+     3988,   316, -5339, -6093, -3879, -2033, -5435,  -973,
+      338,  2455,  2894,  1314, -4119, -1522, -5163,  5002,
+    -3624, -3344, -5724, -1945,  5115, -2442, -5797, -2148,
+      923, -4167,  2231,  -193,  -377,  -375,  -392,   425,
+     3338,  2212,  -506, -5784, -2575, -1942, -1178,  5478,
+     -204, -1409,  2689, -4138,  1468,  -463, -2483,  1344,
+    -3121,  2600, -3017,  5246, -2360, -5216, -5518, -4739,
+    -3393, -3375, -3528,  3825, -4499, -1737,  -636, -2947,
+     1403, -5189,  1687,   146, -4554, -2900, -4670, -4906,
+     1417,  2257, -4883, -5835,  3056,  4963, -5102,  5845,
+      -68, -4566, -3200,  2717, -3607,  3942, -4924,   448,
+    -2275, -5653, -1518, -5063,  4564, -5826, -3534,  4145,
+    -1131, -1125, -1176,  1275, -5596,  -579,  -212,  3114,
+     2926, -4489,  3238,  3449,  5209, -3359, -4265, -1928,
+     4404, -1389,  4840,  4032, -4222,  -125, -4227,  4238,
+     4209, -3278,  5061,   438, -1373,  3589, -1721, -2429,
+    -1208, -5211, -1908,  3448,  1705,  -814,  2164,  -716,
+    -2672,  -865,  2209, -3116, -5832,  3815,  1694,  3869,
+     2253,  2730,  4820, -3094, -2478, -3019, -4565,  1783,
+    -5406,  5673,  3669,   944,  2035, -6125,  1790, -1251,
+    -2828, -4834,   -72,  3840, -1095, -3045,  1241,  3451,
+    -3332, -2532,  2957, -2046, -4697, -3466,  4504, -2626,
+     2276, -2593, -4218,  3758, -5776, -3268,    -8,  4523,
+     6026, -5969,  3821,  1030, -3846, -3793,  1901,  5118,
+     2434, -2827, -1120, -5808,  -648, -2307,  5650, -2301,
+    -5530, -4099,  2171,  3007,  4855,  3232, -1406,  5349,
+    -5207,  -844,  5082,  -682, -5662,  2941, -2595,  3221,
+     3805, -2213,  -216,  -769, -3285,  3154,  3723, -1936,
+     6105, -6086,  5370, -3753, -1282,  2832,  4730,  1706,
+    -5461,  4510,  -365, -1015, -5039,  2485,   -24,  1280,
+    -1802,  1891,  1223,  4411, -3418, -6138,  4693,  -417,
+    -4987,  3808, -3360, -5135, -1944,  5368,  4661,  5386,
+      751,   910,  5703,  3065,  -826,  3090, -5618, -3502,
+};
+
+const int16_t ntt_red1024_inv_psi_powers[1024] = {
+    -4096,  5789,  1254,  2110, -1428,  -874, -1843,  5464,
+    -2370, -3929,  5874,  2769,  2366, -4094,  3656, -3511,
+     2481,  2293, -6118,  -612,  1381, -4301, -2925,  4251,
+    -5195,  4273, -4080,  1014,     1,  5078,  3762, -5959,
+    -4284, -2622, -5529,  4103,  5179,   502,  5333, -3982,
+    -5191,     7, -1321,  1756, -4846, -5410, -6065, -1836,
+     4143,  -614,  3514,   464, -3296,   530,    49,  3042,
+        3,  2945, -1003, -5588,  -563,  4423, -4298,    20,
+     3248,  1506,  3710,   343, -3284,    21, -3963,  5268,
+    -2249, -3941, -5906, -5508,   140, -1842, -1747,  1392,
+     2401,  1590,   147, -3163,     9, -3454, -3009, -4475,
+    -1689,   980,  -605,    60, -2545,  4518, -1159,  1029,
+     2437,    63,   400,  3515,  5542,   466, -5429, -4235,
+      420, -5526, -5241,  4176, -5086,  4770,   441,  2800,
+       27,  1927,  3262, -1136, -5067,  2940, -1815,   180,
+     4654,  1265, -3477,  3087, -4978,   189,  1200, -1744,
+     4337,  1398, -3998,  -416,  1260, -4289, -3434,   239,
+    -2969,  2021,  1323, -3889,    81,  5781, -2503, -3408,
+    -2912, -3469, -5445,   540,  1673,  3795,  1858, -3028,
+    -2645,   567,  3600, -5232,   722,  4194,   295, -1248,
+     3780,  -578,  1987,   717,  3382,  6063,  3969,   622,
+      243,  5054,  4780,  2065,  3553,  1882, -4046,  1620,
+     5019,  -904,  5574,  3205,  4354,  1701, -1489, -3407,
+     2166,   293,   885, -3744,  -949, -1734,  5961,  2151,
+    -2143,  5900,  -382,  1866,   729,  2873,  2051, -6094,
+    -1630,  5646,   151,  4860,  2768, -2712,  4433, -2674,
+      773,  5103, -4467,  2068, -5791,   879,  2655,  1057,
+    -2847, -5202,  5594, -5836,  5860,  5411, -1146,  5598,
+     2187, -3670, -6136, -5993, -4890,  4649,   453,  2291,
+    -3985,  4153,  1010,  4267,  2319,  3020, -1112, -6085,
+    -5084,  2637, -4324,  3171,  3748, -3317,  4493, -5219,
+     5291,  3944, -3438,  4505, -5728,  1279, -6119, -5690,
+    -2381,  1658,  1359, -5416,   334,   170,  3030,   512,
+    -5332, -3229, -3336, -5966, -2963, -4378,  -683, -2776,
+    -1045,  2338,  1190, -3368,  3584,  -457,  1975,  1226,
+    -4895,  3837, -6068, -4781,  5146,  4974,  4077, -3959,
+     1002,   510, -3199,  1536, -3707,  2602,  2281, -5609,
+     3400,  -845, -2049,  3961, -3135, -5275,  3570,  2185,
+    -1537, -1371,  5925,  3678, -2396,  -778, -5915, -2054,
+     3149,  2633,   -58,   412,  3006,  1530,  2692,  4608,
+     1168, -4483, -5446, -4538, -2089, -2535,  6142,  -406,
+     2884, -3536, -1579, -5734, -4611, -4113,  5486, -1255,
+     5101, -2334, -5456,  6127, -2842, -4390,  -174,  1236,
+    -3271,  4590, -4213,  1535,  3504, -1160, -4049, -1325,
+     6022,  4684,  6137, -1218, -3637,  1681, -4737, -4913,
+    -1544,   -50,  4169, -3765,  3014,  5287, -4079,  6092,
+     3763,  -881,  -522,  3708,  2476,  1481,  -350,  4605,
+    -1777, -3480,   142, -3975,  5777,  1763,  6122, -3654,
+     1378,  5043, -1922, -2450, -4632,  -150,   218,   994,
+    -3247,  3572,    52,  5987, -1000, -2643, -1566, -1165,
+    -4861,  4443, -1050,  1526, -5331,  1849,   426,   364,
+     5042,  5289,  6077,  1327,  4134,  2840, -5766,  4939,
+    -1607,  -450,   654,  2982,  2548, -1573,   156,  5672,
+    -3000,  4360, -4698, -3495, -2294,  1040, -3150,  4578,
+    -3704,  5547,  1278,  1092,  2837,  3578,  5942,  3981,
+      113, -3769, -5009,  2528, -4821, -1350,  1962, -3343,
+    -4645, -4719,   468,  4727,  3289,   791, -1805,  1804,
+     5407,  3120,  2839,  1445,  1177,  4352,  3834,  3276,
+    -3778, -1555,  5537,  -346,   339,   982, -2738, -4705,
+    -2174, -4050,  5886,  2260, -1646, -1868,  1404,  1892,
+    -2422,  2373, -5415,  5412,  3932, -2929, -3772,  4335,
+     3531,   767,  -787, -2461,   955, -4665,  4322, -1038,
+     1017,  2946,  4075, -1826,  5767,   139,  5369, -5509,
+    -4938, -5604,  4212,  5676,  5023, -5170, -3956,  3947,
+     -493,  3502,   973,   716, -1696,  2301, -2361,  4906,
+     2865, -1706,   677, -3114,  3051, -3451,   -64, -5478,
+     5012,   417,  3818, -4238, -2525, -4523,   347,  4739,
+     2780, -3221,   421,  -448, -1479, -1783,  2919,  2148,
+    -5088, -5386,  5206,  2429, -3694, -5118,  2031,  2947,
+    -3136,  1936,  -192, -4145,  2747,  1251,  -835,  -425,
+     4714, -1280,  1041,  1928, -3949,  2626,  1263, -1344,
+    -4437, -5349, -3532, -5845, -2975, -3869,  3329, -5002,
+     1207, -3065,  6093, -3448,  2881,  5808,  -576,  -146,
+    -4048,  3753, -2505, -1275,  1853, -3840,  3123,  5784,
+      442, -4411,  3789, -4032, -1022, -3758,  1693, -5246,
+     3364,   682, -2302, -2717,  3621,  3094,  5990,  1945,
+    -3646,  5135, -1728,  -438,   145, -1030,  4774, -3825,
+     5559,   769, -2920,  5063,  1326,  -944,  -922,   193,
+    -3066,  1015,  5079, -3449, -2197,  2046,  5383,  4138,
+    -1426, -3007,  5681,  5835,  1351,  3116, -5184, -1314,
+      435, -3090,  2033,   814,  4388,  2307,  3529,  2900,
+     3978, -2832, -2766,   579,  3091,  3045,  2948,  1942,
+     5698,  6138,  3860,   125, -4278,  3268,  4754,  5216,
+     4053, -2941, -3263, -3942,  1305,  3019,  6099,  2442,
+      875, -5368, -1702, -3589,  -355,  3793,  3991,  1737,
+    -3016, -3154, -3445,  5826,  4805,  6125,  -709,   375,
+     -545, -2485,  1973,  3359,  -130,  3466,  2500,   463,
+     3915, -3232,  6008, -4963,  2625, -3815, -5106,  1522,
+    -1065,  -910,  -316,  5211,  3241,  2827,  1954,  5189,
+     2126,  6086, -2127,  1125, -1635,  4834,  5919, -2212,
+     -390, -1891, -4789,  1389,  -544,  2593,  5735, -2600,
+    -4414,   844, -3029,  4566, -3195, -2730,  -948,  3344,
+    -2566, -3808,  5862,  3278, -5911,  5969,  5908,  3375,
+    -4905,  2213,  5468,  5653, -1170, -5673, -2078,  4167,
+    -1632, -4510,  4916,  4489,  -953,  2532,  3202,  1409,
+     2704,  4099, -2844, -2257,  4591,   865,  5297, -2455,
+    -5444,  5618,  5435, -2164, -2426, -5650,  4115,  4670,
+    -3510, -4730,  6055,   212, -4896, -1241,  2459,  1178,
+    -2859, -4693, -2683,  4227, -4177,     8,  3757,  5518,
+     1484,  2595,  3602,  4924, -4043,  4565,  4016,  5797,
+     5011, -4661,    56,  1721,  1759, -1901,  5876,   636,
+    -2399, -3723, -4912,  3534,  3712, -1790,  4240,   392,
+     -242,    24, -1018,  4265,  4452, -4504, -1483,  2483,
+      160,  1406,  -241,  5102,  2744, -1694,   168,  5163,
+     5277, -5703,  5339,  1908,  5092,  1120, -2447, -1687,
+    -1153, -5370,   431,  1176,  -726,    72, -3054,   506,
+     1067, -1223, -4449, -4840,   480,  4218,  -723,  3017,
+    -4057, -5082,   504,  3200,  3542, -4820,  3728,  5724,
+     2987,  3360,  4948, -5061, -3459, -3821,  1293,  3528,
+    -2178,   216,  3127,  1518,  3201, -3669, -1058, -2231,
+     1440,   365, -2169, -3238,   118, -2957,  1512, -2689,
+    -1663, -2171, -1105,  4883, -3328, -2209,  2555, -2894,
+     1912,   826,  3879, -1705,  5755,   648, -2908,  4554,
+    -2686,  1282, -3174,  5596,  4320,  1095,  5782,  2575,
+      354,  3418,  4536,  4222, -4989,  5776, -3315,  2360,
+     2305,  5662, -4624,  3607,  5736,  2478,  -652, -5115,
+     4976,  1944,  3565,  1373,  4231,  3846,  2767,  4499,
+      671,  3285,  5057, -4564,  1062, -2035,  1319,   377,
+    -2678,  5039,  2344, -5209, -5374,  4697, -1583, -1468,
+     4919, -4855, -1956, -3056,  2639,  5832, -1594,  4119,
+      404,  -751, -3988,  1208,  2013, -2434,  2882, -1403,
+     3186, -6105,  3957,  1131,  4255,  2828, -5257, -3338,
+    -3833,  1802, -4749, -4404,  2468, -2276, -5868,  3121,
+    -4372,  5207, -4782,    68,  1212, -2253,   325,  3624,
+     6039,  4987, -3643, -4209, -2731, -6026,  -418,  3393,
+      476, -3805, -3482,  2275,   790,  5406, -1958,  -923,
+    -4885,  5461, -5315, -2926,  -827,  3332, -2057,   204,
+     3636,  5530,   975, -1417,  5828,  2672,  1360,  -338,
+};
+
+const int16_t ntt_red1024_scaled_inv_psi_powers[1024] = {
+    -3939,  4250,  2016,   511,  1879,  5298,  2623, -1682,
+     -341,  1151, -4786,  4334, -1547, -2995,  5172,  1823,
+     3577,   864,   219,  6072,   515, -2387, -4232,  3365,
+     5760,  1460,  3613,  -663,   472,   461,  6048,  1533,
+     5637,  3605, -4420, -5046, -1023,  3453, -2069,   713,
+    -4641,  3304,  3227,  5469, -1558,  2592,   657,  5927,
+     1545,  5128,  -407, -2194,  4991,  4380, -1450, -1989,
+     1416,  1383,  5855,  4599,  4622, -1474,  -971, -2849,
+    -3069, -1930,  6082,  2139, -1634, -2377, -2608,  4118,
+    -4674, -4513,  1971,  5492,  4635,  3095, -1221,  5707,
+     2684,   851, -4350, -5967,  4248,  4149,  5276,  1508,
+     1577, -4422, -2913,  3742,  3082, -5790,  5957, -5872,
+    -4902,  5158,  4465,    65, -1733, -1250,  5913,  4187,
+     1616, -3004, -3663,  4832, -4237,  2553,  -761, -5612,
+      455,   158,  3539,  4524,  4731,  -977,  3550, -1063,
+    -3043, -5081,  5582, -5327, -2417,  3185,  1106,   195,
+    -5199, -3750,  5450,   272,  4848,  3277,  1300,  2207,
+     -422, -4630, -2283, -4547,  1365,   474, -1672,  1283,
+     1904, -2931, -1639, -3189,  3160, -2954,  4457, -3692,
+     5038, -2734,  3318,   585, -3308,  1039,  4061,   816,
+     2255, -2458,  3900, -5668, -1266, -1601,  5440, -1352,
+     4095,  1422, -5016,  3849,  5712,  3496, -4917,  2722,
+    -2809,  3427,  1082,  1213,  2825,  4087, -2335,  1755,
+     2365,  3117,  -106,  2448, -5524,  4915,  -589, -4715,
+    -3798, -4803,  4031, -4056,    -4,  4266, -2759,  -742,
+     4847, -1801, -2462, -4123,  3862, -2008,  3246,  3639,
+    -3814,   -28,  5284,  5265, -5194, -2938,  -318, -4945,
+    -4283,  2456, -1767, -1856,   895, -2120,  -196,   121,
+      -12,   509,  4012, -2226,  2252, -5403,  4903,   -80,
+     -703, -6024, -2551, -1372,   847,   -84,  3563,  3506,
+    -3293,  3475,  -954, -2546,  -560, -4921, -5301, -5568,
+     2685,  5929,  -588,   363,   -36,  1527,  -253,  5611,
+    -5533, -3920,  2420,  -240, -2109, -5783,  4636, -4116,
+     2541,  -252, -1600, -1771,  2410, -1864, -2862,  4651,
+    -1680, -2474, -3614, -4415, -4234,  5498, -1764,  1089,
+     -108,  4581,  -759,  4544, -4310,   529, -5029,  -720,
+     5962, -5060,  1619,   -59, -4666,  -756, -4800, -5313,
+    -5059, -5592,  3703,  1664, -5040,  4867,  1447,  -956,
+     -413,  4205, -5292,  3267,  -324,  1454, -2277,  1343,
+     -641,  1587, -2798, -2160,  5597, -2891,  4857,  -177,
+    -1709, -2268, -2111, -3650, -2888, -4487, -1180,  4992,
+    -2831,  2312,  4341, -2868, -1239,   326, -3587, -2488,
+     -972,  4362,  5458,  4029, -1923,  4761,  3895,  5809,
+     4502,  3616,  2282,  -531, -5127,  5485,  5956,  1339,
+     3625, -1172, -3540,  2687,  3796, -5353,   734,  3685,
+    -3717,   978,  1528,  4825, -2916,   797,  4085,  -202,
+    -5769,  1994,  -604,  5138,  1217, -1441, -5443, -1593,
+    -3092,  4166,  5579,  4017, -1414, -3516,  1669, -4228,
+     -901, -3770,  2202, -1234,  1138,  2934,  4584,  2186,
+     3541,  2391,   -34,  -606, -5018,  5982, -1812,  3125,
+     3651, -4323, -4040, -4779,  3013,   209,  4448,  -238,
+    -4242,  1741,  5007,  -395, -2703,   979, -5683, -3702,
+     3414, -3487,  1463, -5731, -1666, -5116,  -102, -1818,
+    -2765,  5657, -5436, -2914, -1336,  -680,   169, -2048,
+    -3250,   627,  1055,  -714,  -437,  5223,  2732, -1185,
+     4180,  2937, -4760,  1183, -2047,  1828,  4389, -4904,
+    -4998, -3059,  -306, -5454,  3994,  4682, -4019,  3547,
+    -4008, -2040,   507, -6144,  2539,  1881,  3165, -2142,
+    -1311,  3380, -4093, -3555,   251, -3478, -1991,  3549,
+    -6141,  5484,   878, -2423, -2705,  3112,  -918, -4073,
+     -307,  1757,   232, -1648,   265, -6120,  1521, -6143,
+    -4672,  5643, -2794,  5863, -3933, -2149,    10,  1624,
+      753,  1855, -5973, -1642, -6134,  4163,  2634,  5020,
+     4174, -2953, -2754,    70,  -921,  5271,   696, -4944,
+      795, -6071,  4563, -6140, -1727,  4640,  3907,  5300,
+      490,  5842,    30,  4872,  2259,  5565, -5630, -4926,
+    -6113,   200, -4387,  2771,   233,  3430,  4027,   210,
+    -2763,  3524,  2088, -2543,  2385, -5924,  1400, -6131,
+    -5181,  1631,  -568,  3611,  1470,  5237,    90,  2327,
+    -5512,  4406, -4601, -2489, -6050,   600,  -872, -3976,
+      699, -1999,  -208,   630,  4000, -1717, -6025,  4660,
+    -5134, -5483,  4200, -6104, -3254,  4893, -1704, -1456,
+     4410,  3422,   270, -5308, -4247,   929, -1514,  4822,
+    -5861,  1800, -2616,   361,  2097, -5997,  -624,  1890,
+     -289, -5151, -5786,  1691, -3113, -4160,   311, -6023,
+     2527,  2390, -5112, -4368,   941, -2023,   810, -3635,
+     -452,  2787, -4542,  2177, -5294,  5400,  4441,  1083,
+    -5998, -5702, -1872,  5670,  -867, -3164, -5069,  5073,
+     2950,  -191,   933, -5780, -4708, -5119, -3047,  -815,
+     2823, -6069,  2430,  1384, -1356, -3928, -1337, -5758,
+    -3593,  3911,  1034,  3249, -5705, -4817, -5616,  4721,
+    -2601,  2797, -2918,  2930, -3439,  -573,  2799, -5051,
+    -1835, -3068,  3148, -2445, -3820, -5918, -4999,  4152,
+    -4068,   505, -4011, -4985,  1510,  -556,  3102, -2542,
+    -4826, -2162, -4559,  1874,  4486, -3898,  3535, -3499,
+     1972, -1719, -3892, -2864, -5505,  3085, -2845,  4954,
+      829, -5465, -2708,   167,    85,  1515,   256, -2666,
+     4530, -1668, -2983,  4663, -2189,  5803, -1388,  5622,
+     1169,   595, -1684,  1792,  5916, -5157,   613,  3697,
+    -4226, -3034,  3754,  2573,  2487, -4106,  4165,   501,
+      255,  4545,   768,  4291,  1301, -5004,  3340,  1700,
+     5722,  5120, -4164,  4577,  3507,  1785, -5052,  5376,
+     5459, -3182,  1839, -1198,  -389,  3187, -1027, -4570,
+    -4828,   -29,   206,  1503,   765,  1346,  2304,   584,
+     3903, -2723, -2269,  5100,  4877,  3071,  -203,  1442,
+    -1768,  5355, -2867,  3839,  4088,  2743,  5517, -3594,
+    -1167, -2728, -3081, -1421, -2195,   -87,   618,  4509,
+     2295,  4038, -5377,  1752,  -580,  4120,  5482,  3011,
+     2342, -3076,  -609,  4326, -5304,  3776,  3688,  -772,
+      -25, -4060,  4262,  1507, -3501,  4105,  3046, -4263,
+     5704,  -261,  1854,  1238, -5404,  -175, -3842,  5256,
+    -1740,    71,  4157, -3256, -5263,  3061, -1827,   689,
+    -3623,  -961, -1225, -2316,   -75,   109,   497,  4521,
+     1786,    26, -3151,  -500,  4823,  -783,  5562,  3714,
+    -3923,  -525,   763,  3479, -5220,   213,   182,  2521,
+    -3500, -3106, -5481,  2067,  1420, -2883, -3675,  5341,
+     -225,   327,  1491,  1274,  5358,    78,  2836, -1500,
+     2180, -2349,  4397, -1147,   520, -1575,  2289, -1852,
+    -3371,   639,   546, -4726,  1789,  2971, -4154, -6088,
+     4260,  3640,  1264,  3734,  -675,   981,  4473,  3822,
+     3785,   234, -3781, -4500, -5749,  5242,   902, -3441,
+     1560, -4725, -5422, -5556,  2176,  1917,  1638, -1889,
+     5367, -3376,  -173, -5975,   491, -1369,  3792, -1087,
+    -2025,  2943,  1130,  -823,  -934,   702,   946, -1211,
+    -4958,  3437,  2706,  1966,  4680, -1886, -3977, -4379,
+    -5761,  5751,  4914, -5667,  3812,  2161,  -519, -5636,
+     1473, -4107,  -913, -3261, -6075, -3460,  3390, -2469,
+    -2802,  2106,  2838, -3633, -2585, -1978, -4171,  5898,
+     1751, -5658,   358,  -848, -4994,  4964,  2453, -4712,
+     -853, -5806, -1557, -4619,  4419,   -32, -2739,  2506,
+    -5936,  1909, -2119,  4882,  3883, -5971, -3775,  1390,
+     4534, -5934,  -224,  5405,  5253, -4685,  1074, -2544,
+    -2693,  2603, -4930, -1847, -2559, -5129, -4671, -1568,
+      968,   -96,  4072, -4771, -5519,  5727,  5932,  2357,
+     -640, -5624,   964,  4170,  1313, -5513,  -672,  3926,
+     3470, -1766,  3222,  4657,  4210, -4480, -2501, -5541,
+     4612, -3098, -1724, -4704,  2904,  -288,   -73, -2024,
+    -4268,  4892,  5507, -5218, -1920, -4583,  2892,   221,
+};
+
+const int16_t ntt_red1024_scaled_inv_psi_powers_var[1024] = {
+     1416,  1383,  5855,  4599,  4622, -1474,  -971, -2849,
+    -3069, -1930,  6082,  2139, -1634, -2377, -2608,  4118,
+    -4674, -4513,  1971,  5492,  4635,  3095, -1221,  5707,
+     2684,   851, -4350, -5967,  4248,  4149,  5276,  1508,
+     1577, -4422, -2913,  3742,  3082, -5790,  5957, -5872,
+    -4902,  5158,  4465,    65, -1733, -1250,  5913,  4187,
+     1616, -3004, -3663,  4832, -4237,  2553,  -761, -5612,
+      455,   158,  3539,  4524,  4731,  -977,  3550, -1063,
+    -3043, -5081,  5582, -5327, -2417,  3185,  1106,   195,
+    -5199, -3750,  5450,   272,  4848,  3277,  1300,  2207,
+     -422, -4630, -2283, -4547,  1365,   474, -1672,  1283,
+     1904, -2931, -1639, -3189,  3160, -2954,  4457, -3692,
+     5038, -2734,  3318,   585, -3308,  1039,  4061,   816,
+     2255, -2458,  3900, -5668, -1266, -1601,  5440, -1352,
+     4095,  1422, -5016,  3849,  5712,  3496, -4917,  2722,
+    -2809,  3427,  1082,  1213,  2825,  4087, -2335,  1755,
+     2365,  3117,  -106,  2448, -5524,  4915,  -589, -4715,
+    -3798, -4803,  4031, -4056,    -4,  4266, -2759,  -742,
+     4847, -1801, -2462, -4123,  3862, -2008,  3246,  3639,
+    -3814,   -28,  5284,  5265, -5194, -2938,  -318, -4945,
+    -4283,  2456, -1767, -1856,   895, -2120,  -196,   121,
+      -12,   509,  4012, -2226,  2252, -5403,  4903,   -80,
+     -703, -6024, -2551, -1372,   847,   -84,  3563,  3506,
+    -3293,  3475,  -954, -2546,  -560, -4921, -5301, -5568,
+     2685,  5929,  -588,   363,   -36,  1527,  -253,  5611,
+    -5533, -3920,  2420,  -240, -2109, -5783,  4636, -4116,
+     2541,  -252, -1600, -1771,  2410, -1864, -2862,  4651,
+    -1680, -2474, -3614, -4415, -4234,  5498, -1764,  1089,
+     -108,  4581,  -759,  4544, -4310,   529, -5029,  -720,
+     5962, -5060,  1619,   -59, -4666,  -756, -4800, -5313,
+    -5059, -5592,  3703,  1664, -5040,  4867,  1447,  -956,
+     -413,  4205, -5292,  3267,  -324,  1454, -2277,  1343,
+     -641,  1587, -2798, -2160,  5597, -2891,  4857,  -177,
+    -1709, -2268, -2111, -3650, -2888, -4487, -1180,  4992,
+    -2831,  2312,  4341, -2868, -1239,   326, -3587, -2488,
+     -972,  4362,  5458,  4029, -1923,  4761,  3895,  5809,
+     4502,  3616,  2282,  -531, -5127,  5485,  5956,  1339,
+     3625, -1172, -3540,  2687,  3796, -5353,   734,  3685,
+    -3717,   978,  1528,  4825, -2916,   797,  4085,  -202,
+    -5769,  1994,  -604,  5138,  1217, -1441, -5443, -1593,
+    -3092,  4166,  5579,  4017, -1414, -3516,  1669, -4228,
+     -901, -3770,  2202, -1234,  1138,  2934,  4584,  2186,
+     3541,  2391,   -34,  -606, -5018,  5982, -1812,  3125,
+     3651, -4323, -4040, -4779,  3013,   209,  4448,  -238,
+    -4242,  1741,  5007,  -395, -2703,   979, -5683, -3702,
+     3414, -3487,  1463, -5731, -1666, -5116,  -102, -1818,
+    -2765,  5657, -5436, -2914, -1336,  -680,   169, -2048,
+    -3250,   627,  1055,  -714,  -437,  5223,  2732, -1185,
+     4180,  2937, -4760,  1183, -2047,  1828,  4389, -4904,
+    -4998, -3059,  -306, -5454,  3994,  4682, -4019,  3547,
+    -4008, -2040,   507, -6144,  2539,  1881,  3165, -2142,
+    -1311,  3380, -4093, -3555,   251, -3478, -1991,  3549,
+    -6141,  5484,   878, -2423, -2705,  3112,  -918, -4073,
+     -307,  1757,   232, -1648,   265, -6120,  1521, -6143,
+    -4672,  5643, -2794,  5863, -3933, -2149,    10,  1624,
+      753,  1855, -5973, -1642, -6134,  4163,  2634,  5020,
+     4174, -2953, -2754,    70,  -921,  5271,   696, -4944,
+      795, -6071,  4563, -6140, -1727,  4640,  3907,  5300,
+      490,  5842,    30,  4872,  2259,  5565, -5630, -4926,
+    -6113,   200, -4387,  2771,   233,  3430,  4027,   210,
+    -2763,  3524,  2088, -2543,  2385, -5924,  1400, -6131,
+    -5181,  1631,  -568,  3611,  1470,  5237,    90,  2327,
+    -5512,  4406, -4601, -2489, -6050,   600,  -872, -3976,
+      699, -1999,  -208,   630,  4000, -1717, -6025,  4660,
+    -5134, -5483,  4200, -6104, -3254,  4893, -1704, -1456,
+     4410,  3422,   270, -5308, -4247,   929, -1514,  4822,
+    -5861,  1800, -2616,   361,  2097, -5997,  -624,  1890,
+     -289, -5151, -5786,  1691, -3113, -4160,   311, -6023,
+     2527,  2390, -5112, -4368,   941, -2023,   810, -3635,
+     -452,  2787, -4542,  2177, -5294,  5400,  4441,  1083,
+    -5998, -5702, -1872,  5670,  -867, -3164, -5069,  5073,
+     2950,  -191,   933, -5780, -4708, -5119, -3047,  -815,
+     2823, -6069,  2430,  1384, -1356, -3928, -1337, -5758,
+    -3593,  3911,  1034,  3249, -5705, -4817, -5616,  4721,
+    -2601,  2797, -2918,  2930, -3439,  -573,  2799, -5051,
+    -1835, -3068,  3148, -2445, -3820, -5918, -4999,  4152,
+    -4068,   505, -4011, -4985,  1510,  -556,  3102, -2542,
+    -4826, -2162, -4559,  1874,  4486, -3898,  3535, -3499,
+     1972, -1719, -3892, -2864, -5505,  3085, -2845,  4954,
+      829, -5465, -2708,   167,    85,  1515,   256, -2666,
+     4530, -1668, -2983,  4663, -2189,  5803, -1388,  5622,
+     1169,   595, -1684,  1792,  5916, -5157,   613,  3697,
+    -4226, -3034,  3754,  2573,  2487, -4106,  4165,   501,
+      255,  4545,   768,  4291,  1301, -5004,  3340,  1700,
+     5722,  5120, -4164,  4577,  3507,  1785, -5052,  5376,
+     5459, -3182,  1839, -1198,  -389,  3187, -1027, -4570,
+    -4828,   -29,   206,  1503,   765,  1346,  2304,   584,
+     3903, -2723, -2269,  5100,  4877,  3071,  -203,  1442,
+    -1768,  5355, -2867,  3839,  4088,  2743,  5517, -3594,
+    -1167, -2728, -3081, -1421, -2195,   -87,   618,  4509,
+     2295,  4038, -5377,  1752,  -580,  4120,  5482,  3011,
+     2342, -3076,  -609,  4326, -5304,  3776,  3688,  -772,
+      -25, -4060,  4262,  1507, -3501,  4105,  3046, -4263,
+     5704,  -261,  1854,  1238, -5404,  -175, -3842,  5256,
+    -1740,    71,  4157, -3256, -5263,  3061, -1827,   689,
+    -3623,  -961, -1225, -2316,   -75,   109,   497,  4521,
+     1786,    26, -3151,  -500,  4823,  -783,  5562,  3714,
+    -3923,  -525,   763,  3479, -5220,   213,   182,  2521,
+    -3500, -3106, -5481,  2067,  1420, -2883, -3675,  5341,
+     -225,   327,  1491,  1274,  5358,    78,  2836, -1500,
+     2180, -2349,  4397, -1147,   520, -1575,  2289, -1852,
+    -3371,   639,   546, -4726,  1789,  2971, -4154, -6088,
+     4260,  3640,  1264,  3734,  -675,   981,  4473,  3822,
+     3785,   234, -3781, -4500, -5749,  5242,   902, -3441,
+     1560, -4725, -5422, -5556,  2176,  1917,  1638, -1889,
+     5367, -3376,  -173, -5975,   491, -1369,  3792, -1087,
+    -2025,  2943,  1130,  -823,  -934,   702,   946, -1211,
+    -4958,  3437,  2706,  1966,  4680, -1886, -3977, -4379,
+    -5761,  5751,  4914, -5667,  3812,  2161,  -519, -5636,
+     1473, -4107,  -913, -3261, -6075, -3460,  3390, -2469,
+    -2802,  2106,  2838, -3633, -2585, -1978, -4171,  5898,
+     1751, -5658,   358,  -848, -4994,  4964,  2453, -4712,
+     -853, -5806, -1557, -4619,  4419,   -32, -2739,  2506,
+    -5936,  1909, -2119,  4882,  3883, -5971, -3775,  1390,
+     4534, -5934,  -224,  5405,  5253, -4685,  1074, -2544,
+    -2693,  2603, -4930, -1847, -2559, -5129, -4671, -1568,
+      968,   -96,  4072, -4771, -5519,  5727,  5932,  2357,
+     -640, -5624,   964,  4170,  1313, -5513,  -672,  3926,
+     3470, -1766,  3222,  4657,  4210, -4480, -2501, -5541,
+     4612, -3098, -1724, -4704,  2904,  -288,   -73, -2024,
+    -4268,  4892,  5507, -5218, -1920, -4583,  2892,   221,
+     3939, -4250, -2016,  -511, -1879, -5298, -2623,  1682,
+      341, -1151,  4786, -4334,  1547,  2995, -5172, -1823,
+    -3577,  -864,  -219, -6072,  -515,  2387,  4232, -3365,
+    -5760, -1460, -3613,   663,  -472,  -461, -6048, -1533,
+    -5637, -3605,  4420,  5046,  1023, -3453,  2069,  -713,
+     4641, -3304, -3227, -5469,  1558, -2592,  -657, -5927,
+    -1545, -5128,   407,  2194, -4991, -4380,  1450,  1989,
+};
+
+const int16_t ntt_red1024_omega_powers[1024] = {
+        0, -4096, -4096,   493, -4096,  5444,   493,  2381,
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+    -4096,  -404, -1912, -5277,  5444,  1065,  -435, -1207,
+      493,  4645, -1378, -1168,  2381,  2143, -4337, -3248,
+    -4096, -6039,  -404, -4976, -1912, -2987, -5277, -5011,
+     5444,  2566,  1065,  -875,  -435,  3646, -1207,  5088,
+      493,  2422,  4645,  1607, -1378, -6022, -1168, -1002,
+     2381, -2187,  2143, -3780, -4337, -2437, -3248,  4284,
+    -4096,  4885, -6039,  3833,  -404,  2678, -4976,  -354,
+    -1912, -1440, -2987, -1067, -5277,   242, -5011,  2859,
+     5444,  1632,  2566,   390,  1065,   545,  -875, -5698,
+     -435,  3066,  3646,  -442, -1207, -4714,  5088, -5012,
+      493, -1017,  2422,  3778,  4645,  3704,  1607,  4861,
+    -1378, -3763, -6022, -5101, -1168,  1537, -1002,  1045,
+     2381,  5084, -2187,  -773,  2143, -5019, -3780,  2912,
+    -4337,   -27, -2437, -2401, -3248, -4143,  4284, -2481,
+    -4096, -3636,  4885,  -476, -6039,  4372,  3833, -3186,
+     -404, -4919,  2678,  -671, -4976, -2305,  -354,  2686,
+    -1912,  1663, -1440,  2178, -2987,  4057, -1067,  1153,
+    -5277,  -160,   242,  2399, -5011, -1484,  2859,  3510,
+     5444, -2704,  1632,  4905,  2566,  4414,   390, -2126,
+     1065, -3915,   545,  3016,  -875, -4053, -5698, -3978,
+     -435,  1426,  3066, -5559,  3646, -3364,  -442,  4048,
+    -1207,  4437, -4714,  3136,  5088, -2780, -5012, -2865,
+      493,  4938, -1017, -3531,  2422,  2174,  3778, -5407,
+     4645,  -113,  3704,  3000,  1607, -5042,  4861,  3247,
+    -1378,  1777, -3763,  1544, -6022,  3271, -5101, -2884,
+    -1168, -3149,  1537, -3400, -1002,  4895,  1045,  5332,
+     2381, -5291,  5084,  3985, -2187,  2847,  -773,  1630,
+     2143, -2166, -5019,  -243, -3780,  2645,  2912,  2969,
+    -4337, -4654,   -27,  -420, -2437,  1689, -2401,  2249,
+    -3248,    -3, -4143,  5191,  4284,  5195, -2481,  2370,
+    -4096, -5828, -3636,   827,  4885,  -790,  -476,  2731,
+    -6039, -1212,  4372, -2468,  3833, -4255, -3186, -2013,
+     -404, -2639, -4919,  5374,  2678, -1062,  -671, -4231,
+    -4976, -5736, -2305,  4989,  -354, -4320,  2686, -5755,
+    -1912,  3328,  1663,  -118, -1440, -3201,  2178,  3459,
+    -2987, -3542,  4057,  -480, -1067,   726,  1153, -5092,
+    -5277, -2744,  -160, -4452,   242, -3712,  2399, -1759,
+    -5011,  4043, -1484,  4177,  2859,  4896,  3510,  2426,
+     5444, -4591, -2704,   953,  1632,  1170,  4905,  5911,
+     2566,  3195,  4414,   544,   390,  1635, -2126, -3241,
+     1065, -2625, -3915,   130,   545, -4805,  3016,   355,
+     -875, -1305, -4053,  4278, -5698, -3091, -3978, -4388,
+     -435, -1351,  1426,  2197,  3066, -1326, -5559,  -145,
+     3646, -3621, -3364,  1022,  -442, -1853,  4048, -2881,
+    -1207,  2975,  4437,  3949, -4714, -2747,  3136,  3694,
+     5088,  1479, -2780,  2525, -5012, -3051, -2865,  1696,
+      493, -5023,  4938, -5767, -1017,  -955, -3531, -3932,
+     2422,  1646,  2174,  -339,  3778, -1177, -5407, -3289,
+     4645,  4821,  -113, -2837,  3704,  2294,  3000, -2548,
+     1607, -4134, -5042,  5331,  4861,  1000,  3247,  4632,
+    -1378, -5777,  1777, -2476, -3763, -3014,  1544,  3637,
+    -6022, -3504,  3271,  2842, -5101,  4611, -2884,  2089,
+    -1168, -3006, -3149,  2396,  1537,  3135, -3400,  3707,
+    -1002, -5146,  4895, -3584,  1045,  2963,  5332,  -334,
+     2381,  5728, -5291, -3748,  5084, -2319,  3985,  4890,
+    -2187, -5860,  2847,  5791,  -773, -2768,  1630,  -729,
+     2143,   949, -2166, -4354, -5019, -3553,  -243, -3382,
+    -3780,  -722,  2645, -1673,  2912,   -81,  2969, -1260,
+    -4337,  4978, -4654,  5067,   -27,  5086,  -420, -5542,
+    -2437,  2545,  1689,    -9, -2401,  -140,  2249,  3284,
+    -3248,   563,    -3,  3296, -4143,  4846,  5191, -5179,
+     4284,    -1,  5195, -1381, -2481, -2366,  2370,  1428,
+    -4096, -1360, -5828,  -975, -3636,  2057,   827,  5315,
+     4885,  1958,  -790,  3482,  -476,   418,  2731,  3643,
+    -6039,  -325, -1212,  4782,  4372,  5868, -2468,  4749,
+     3833,  5257, -4255, -3957, -3186, -2882, -2013,  3988,
+     -404,  1594, -2639,  1956, -4919,  1583,  5374, -2344,
+     2678, -1319, -1062, -5057,  -671, -2767, -4231, -3565,
+    -4976,   652, -5736,  4624, -2305,  3315,  4989, -4536,
+     -354, -5782, -4320,  3174,  2686,  2908, -5755, -3879,
+    -1912, -2555,  3328,  1105,  1663, -1512,  -118,  2169,
+    -1440,  1058, -3201, -3127,  2178, -1293,  3459, -4948,
+    -2987, -3728, -3542,  -504,  4057,   723,  -480,  4449,
+    -1067,  3054,   726,  -431,  1153,  2447, -5092, -5339,
+    -5277,  -168, -2744,   241,  -160,  1483, -4452,  1018,
+      242, -4240, -3712,  4912,  2399, -5876, -1759,   -56,
+    -5011, -4016,  4043, -3602, -1484, -3757,  4177,  2683,
+     2859, -2459,  4896, -6055,  3510, -4115,  2426, -5435,
+     5444, -5297, -4591,  2844, -2704, -3202,   953, -4916,
+     1632,  2078,  1170, -5468,  4905, -5908,  5911, -5862,
+     2566,   948,  3195,  3029,  4414, -5735,   544,  4789,
+      390, -5919,  1635,  2127, -2126, -1954, -3241,   316,
+     1065,  5106, -2625, -6008, -3915, -2500,   130, -1973,
+      545,   709, -4805,  3445,  3016, -3991,   355,  1702,
+     -875, -6099, -1305,  3263, -4053, -4754,  4278, -3860,
+    -5698, -2948, -3091,  2766, -3978, -3529, -4388, -2033,
+     -435,  5184, -1351, -5681,  1426, -5383,  2197, -5079,
+     3066,   922, -1326,  2920, -5559, -4774,  -145,  1728,
+     3646, -5990, -3621,  2302, -3364, -1693,  1022, -3789,
+     -442, -3123, -1853,  2505,  4048,   576, -2881, -6093,
+    -1207, -3329,  2975,  3532,  4437, -1263,  3949, -1041,
+    -4714,   835, -2747,   192,  3136, -2031,  3694, -5206,
+     5088, -2919,  1479,  -421, -2780,  -347,  2525, -3818,
+    -5012,    64, -3051,  -677, -2865,  2361,  1696,  -973,
+      493,  3956, -5023, -4212,  4938, -5369, -5767, -4075,
+    -1017, -4322,  -955,   787, -3531,  3772, -3932,  5415,
+     2422, -1404,  1646, -5886,  2174,  2738,  -339, -5537,
+     3778, -3834, -1177, -2839, -5407,  1805, -3289,  -468,
+     4645, -1962,  4821,  5009,  -113, -5942, -2837, -1278,
+     3704,  3150,  2294,  4698,  3000,  -156, -2548,  -654,
+     1607,  5766, -4134, -6077, -5042,  -426,  5331,  1050,
+     4861,  1566,  1000,   -52,  3247,  -218,  4632,  1922,
+    -1378, -6122, -5777,  -142,  1777,   350, -2476,   522,
+    -3763,  4079, -3014, -4169,  1544,  4737,  3637, -6137,
+    -6022,  4049, -3504,  4213,  3271,   174,  2842,  5456,
+    -5101, -5486,  4611,  1579, -2884, -6142,  2089,  5446,
+    -1168, -2692, -3006,    58, -3149,  5915,  2396, -5925,
+     1537, -3570,  3135,  2049, -3400, -2281,  3707,  3199,
+    -1002, -4077, -5146,  6068,  4895, -1975, -3584, -1190,
+     1045,   683,  2963,  3336,  5332, -3030,  -334, -1359,
+     2381,  6119,  5728,  3438, -5291, -4493, -3748,  4324,
+     5084,  1112, -2319, -1010,  3985,  -453,  4890,  6136,
+    -2187,  1146, -5860, -5594,  2847, -2655,  5791,  4467,
+     -773, -4433, -2768,  -151,  1630, -2051,  -729,   382,
+     2143, -5961,   949,  -885, -2166,  1489, -4354, -5574,
+    -5019,  4046, -3553, -4780,  -243, -3969, -3382, -1987,
+    -3780,  -295,  -722, -3600,  2645, -1858, -1673,  5445,
+     2912,  2503,   -81, -1323,  2969,  3434, -1260,  3998,
+    -4337, -1200,  4978,  3477, -4654,  1815,  5067, -3262,
+      -27,  -441,  5086,  5241,  -420,  5429, -5542,  -400,
+    -2437,  1159,  2545,   605,  1689,  3009,    -9,  -147,
+    -2401,  1747,  -140,  5906,  2249,  3963,  3284, -3710,
+    -3248,  4298,   563,  1003,    -3,   -49,  3296, -3514,
+    -4143,  6065,  4846,  1321,  5191, -5333, -5179,  5529,
+     4284, -3762,    -1,  4080,  5195,  2925, -1381,  6118,
+    -2481, -3656, -2366, -5874,  2370,  1843,  1428, -1254,
+};
+
+const int16_t ntt_red1024_omega_powers_rev[1024] = {
+        0, -4096, -4096,   493, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+};
+
+const int16_t ntt_red1024_inv_omega_powers[1024] = {
+        0, -4096, -4096,  -493, -4096, -2381,  -493, -5444,
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+    -4096,  3248,  4337, -2143, -2381,  1168,  1378, -4645,
+     -493,  1207,   435, -1065, -5444,  5277,  1912,   404,
+    -4096, -4284,  3248,  2437,  4337,  3780, -2143,  2187,
+    -2381,  1002,  1168,  6022,  1378, -1607, -4645, -2422,
+     -493, -5088,  1207, -3646,   435,   875, -1065, -2566,
+    -5444,  5011,  5277,  2987,  1912,  4976,   404,  6039,
+    -4096,  2481, -4284,  4143,  3248,  2401,  2437,    27,
+     4337, -2912,  3780,  5019, -2143,   773,  2187, -5084,
+    -2381, -1045,  1002, -1537,  1168,  5101,  6022,  3763,
+     1378, -4861, -1607, -3704, -4645, -3778, -2422,  1017,
+     -493,  5012, -5088,  4714,  1207,   442, -3646, -3066,
+      435,  5698,   875,  -545, -1065,  -390, -2566, -1632,
+    -5444, -2859,  5011,  -242,  5277,  1067,  2987,  1440,
+     1912,   354,  4976, -2678,   404, -3833,  6039, -4885,
+    -4096, -2370,  2481, -5195, -4284, -5191,  4143,     3,
+     3248, -2249,  2401, -1689,  2437,   420,    27,  4654,
+     4337, -2969, -2912, -2645,  3780,   243,  5019,  2166,
+    -2143, -1630,   773, -2847,  2187, -3985, -5084,  5291,
+    -2381, -5332, -1045, -4895,  1002,  3400, -1537,  3149,
+     1168,  2884,  5101, -3271,  6022, -1544,  3763, -1777,
+     1378, -3247, -4861,  5042, -1607, -3000, -3704,   113,
+    -4645,  5407, -3778, -2174, -2422,  3531,  1017, -4938,
+     -493,  2865,  5012,  2780, -5088, -3136,  4714, -4437,
+     1207, -4048,   442,  3364, -3646,  5559, -3066, -1426,
+      435,  3978,  5698,  4053,   875, -3016,  -545,  3915,
+    -1065,  2126,  -390, -4414, -2566, -4905, -1632,  2704,
+    -5444, -3510, -2859,  1484,  5011, -2399,  -242,   160,
+     5277, -1153,  1067, -4057,  2987, -2178,  1440, -1663,
+     1912, -2686,   354,  2305,  4976,   671, -2678,  4919,
+      404,  3186, -3833, -4372,  6039,   476, -4885,  3636,
+    -4096, -1428, -2370,  2366,  2481,  1381, -5195,     1,
+    -4284,  5179, -5191, -4846,  4143, -3296,     3,  -563,
+     3248, -3284, -2249,   140,  2401,     9, -1689, -2545,
+     2437,  5542,   420, -5086,    27, -5067,  4654, -4978,
+     4337,  1260, -2969,    81, -2912,  1673, -2645,   722,
+     3780,  3382,   243,  3553,  5019,  4354,  2166,  -949,
+    -2143,   729, -1630,  2768,   773, -5791, -2847,  5860,
+     2187, -4890, -3985,  2319, -5084,  3748,  5291, -5728,
+    -2381,   334, -5332, -2963, -1045,  3584, -4895,  5146,
+     1002, -3707,  3400, -3135, -1537, -2396,  3149,  3006,
+     1168, -2089,  2884, -4611,  5101, -2842, -3271,  3504,
+     6022, -3637, -1544,  3014,  3763,  2476, -1777,  5777,
+     1378, -4632, -3247, -1000, -4861, -5331,  5042,  4134,
+    -1607,  2548, -3000, -2294, -3704,  2837,   113, -4821,
+    -4645,  3289,  5407,  1177, -3778,   339, -2174, -1646,
+    -2422,  3932,  3531,   955,  1017,  5767, -4938,  5023,
+     -493, -1696,  2865,  3051,  5012, -2525,  2780, -1479,
+    -5088, -3694, -3136,  2747,  4714, -3949, -4437, -2975,
+     1207,  2881, -4048,  1853,   442, -1022,  3364,  3621,
+    -3646,   145,  5559,  1326, -3066, -2197, -1426,  1351,
+      435,  4388,  3978,  3091,  5698, -4278,  4053,  1305,
+      875,  -355, -3016,  4805,  -545,  -130,  3915,  2625,
+    -1065,  3241,  2126, -1635,  -390,  -544, -4414, -3195,
+    -2566, -5911, -4905, -1170, -1632,  -953,  2704,  4591,
+    -5444, -2426, -3510, -4896, -2859, -4177,  1484, -4043,
+     5011,  1759, -2399,  3712,  -242,  4452,   160,  2744,
+     5277,  5092, -1153,  -726,  1067,   480, -4057,  3542,
+     2987, -3459, -2178,  3201,  1440,   118, -1663, -3328,
+     1912,  5755, -2686,  4320,   354, -4989,  2305,  5736,
+     4976,  4231,   671,  1062, -2678, -5374,  4919,  2639,
+      404,  2013,  3186,  4255, -3833,  2468, -4372,  1212,
+     6039, -2731,   476,   790, -4885,  -827,  3636,  5828,
+    -4096,  1254, -1428, -1843, -2370,  5874,  2366,  3656,
+     2481, -6118,  1381, -2925, -5195, -4080,     1,  3762,
+    -4284, -5529,  5179,  5333, -5191, -1321, -4846, -6065,
+     4143,  3514, -3296,    49,     3, -1003,  -563, -4298,
+     3248,  3710, -3284, -3963, -2249, -5906,   140, -1747,
+     2401,   147,     9, -3009, -1689,  -605, -2545, -1159,
+     2437,   400,  5542, -5429,   420, -5241, -5086,   441,
+       27,  3262, -5067, -1815,  4654, -3477, -4978,  1200,
+     4337, -3998,  1260, -3434, -2969,  1323,    81, -2503,
+    -2912, -5445,  1673,  1858, -2645,  3600,   722,   295,
+     3780,  1987,  3382,  3969,   243,  4780,  3553, -4046,
+     5019,  5574,  4354, -1489,  2166,   885,  -949,  5961,
+    -2143,  -382,   729,  2051, -1630,   151,  2768,  4433,
+      773, -4467, -5791,  2655, -2847,  5594,  5860, -1146,
+     2187, -6136, -4890,   453, -3985,  1010,  2319, -1112,
+    -5084, -4324,  3748,  4493,  5291, -3438, -5728, -6119,
+    -2381,  1359,   334,  3030, -5332, -3336, -2963,  -683,
+    -1045,  1190,  3584,  1975, -4895, -6068,  5146,  4077,
+     1002, -3199, -3707,  2281,  3400, -2049, -3135,  3570,
+    -1537,  5925, -2396, -5915,  3149,   -58,  3006,  2692,
+     1168, -5446, -2089,  6142,  2884, -1579, -4611,  5486,
+     5101, -5456, -2842,  -174, -3271, -4213,  3504, -4049,
+     6022,  6137, -3637, -4737, -1544,  4169,  3014, -4079,
+     3763,  -522,  2476,  -350, -1777,   142,  5777,  6122,
+     1378, -1922, -4632,   218, -3247,    52, -1000, -1566,
+    -4861, -1050, -5331,   426,  5042,  6077,  4134, -5766,
+    -1607,   654,  2548,   156, -3000, -4698, -2294, -3150,
+    -3704,  1278,  2837,  5942,   113, -5009, -4821,  1962,
+    -4645,   468,  3289, -1805,  5407,  2839,  1177,  3834,
+    -3778,  5537,   339, -2738, -2174,  5886, -1646,  1404,
+    -2422, -5415,  3932, -3772,  3531,  -787,   955,  4322,
+     1017,  4075,  5767,  5369, -4938,  4212,  5023, -3956,
+     -493,   973, -1696, -2361,  2865,   677,  3051,   -64,
+     5012,  3818, -2525,   347,  2780,   421, -1479,  2919,
+    -5088,  5206, -3694,  2031, -3136,  -192,  2747,  -835,
+     4714,  1041, -3949,  1263, -4437, -3532, -2975,  3329,
+     1207,  6093,  2881,  -576, -4048, -2505,  1853,  3123,
+      442,  3789, -1022,  1693,  3364, -2302,  3621,  5990,
+    -3646, -1728,   145,  4774,  5559, -2920,  1326,  -922,
+    -3066,  5079, -2197,  5383, -1426,  5681,  1351, -5184,
+      435,  2033,  4388,  3529,  3978, -2766,  3091,  2948,
+     5698,  3860, -4278,  4754,  4053, -3263,  1305,  6099,
+      875, -1702,  -355,  3991, -3016, -3445,  4805,  -709,
+     -545,  1973,  -130,  2500,  3915,  6008,  2625, -5106,
+    -1065,  -316,  3241,  1954,  2126, -2127, -1635,  5919,
+     -390, -4789,  -544,  5735, -4414, -3029, -3195,  -948,
+    -2566,  5862, -5911,  5908, -4905,  5468, -1170, -2078,
+    -1632,  4916,  -953,  3202,  2704, -2844,  4591,  5297,
+    -5444,  5435, -2426,  4115, -3510,  6055, -4896,  2459,
+    -2859, -2683, -4177,  3757,  1484,  3602, -4043,  4016,
+     5011,    56,  1759,  5876, -2399, -4912,  3712,  4240,
+     -242, -1018,  4452, -1483,   160,  -241,  2744,   168,
+     5277,  5339,  5092, -2447, -1153,   431,  -726, -3054,
+     1067, -4449,   480,  -723, -4057,   504,  3542,  3728,
+     2987,  4948, -3459,  1293, -2178,  3127,  3201, -1058,
+     1440, -2169,   118,  1512, -1663, -1105, -3328,  2555,
+     1912,  3879,  5755, -2908, -2686, -3174,  4320,  5782,
+      354,  4536, -4989, -3315,  2305, -4624,  5736,  -652,
+     4976,  3565,  4231,  2767,   671,  5057,  1062,  1319,
+    -2678,  2344, -5374, -1583,  4919, -1956,  2639, -1594,
+      404, -3988,  2013,  2882,  3186,  3957,  4255, -5257,
+    -3833, -4749,  2468, -5868, -4372, -4782,  1212,   325,
+     6039, -3643, -2731,  -418,   476, -3482,   790, -1958,
+    -4885, -5315,  -827, -2057,  3636,   975,  5828,  1360,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_rev[1024] = {
+        0, -4096, -4096,  -493, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+};
+
+const int16_t ntt_red1024_mixed_powers[1024] = {
+        0,   493,  5444,  2381, -1912,  -435, -1378, -4337,
+     -404, -5277,  1065, -1207,  4645, -1168,  2143, -3248,
+    -6039, -4976, -2987, -5011,  2566,  -875,  3646,  5088,
+     2422,  1607, -6022, -1002, -2187, -3780, -2437,  4284,
+     4885,  3833,  2678,  -354, -1440, -1067,   242,  2859,
+     1632,   390,   545, -5698,  3066,  -442, -4714, -5012,
+    -1017,  3778,  3704,  4861, -3763, -5101,  1537,  1045,
+     5084,  -773, -5019,  2912,   -27, -2401, -4143, -2481,
+    -3636,  -476,  4372, -3186, -4919,  -671, -2305,  2686,
+     1663,  2178,  4057,  1153,  -160,  2399, -1484,  3510,
+    -2704,  4905,  4414, -2126, -3915,  3016, -4053, -3978,
+     1426, -5559, -3364,  4048,  4437,  3136, -2780, -2865,
+     4938, -3531,  2174, -5407,  -113,  3000, -5042,  3247,
+     1777,  1544,  3271, -2884, -3149, -3400,  4895,  5332,
+    -5291,  3985,  2847,  1630, -2166,  -243,  2645,  2969,
+    -4654,  -420,  1689,  2249,    -3,  5191,  5195,  2370,
+    -5828,   827,  -790,  2731, -1212, -2468, -4255, -2013,
+    -2639,  5374, -1062, -4231, -5736,  4989, -4320, -5755,
+     3328,  -118, -3201,  3459, -3542,  -480,   726, -5092,
+    -2744, -4452, -3712, -1759,  4043,  4177,  4896,  2426,
+    -4591,   953,  1170,  5911,  3195,   544,  1635, -3241,
+    -2625,   130, -4805,   355, -1305,  4278, -3091, -4388,
+    -1351,  2197, -1326,  -145, -3621,  1022, -1853, -2881,
+     2975,  3949, -2747,  3694,  1479,  2525, -3051,  1696,
+    -5023, -5767,  -955, -3932,  1646,  -339, -1177, -3289,
+     4821, -2837,  2294, -2548, -4134,  5331,  1000,  4632,
+    -5777, -2476, -3014,  3637, -3504,  2842,  4611,  2089,
+    -3006,  2396,  3135,  3707, -5146, -3584,  2963,  -334,
+     5728, -3748, -2319,  4890, -5860,  5791, -2768,  -729,
+      949, -4354, -3553, -3382,  -722, -1673,   -81, -1260,
+     4978,  5067,  5086, -5542,  2545,    -9,  -140,  3284,
+      563,  3296,  4846, -5179,    -1, -1381, -2366,  1428,
+    -1360,  -975,  2057,  5315,  1958,  3482,   418,  3643,
+     -325,  4782,  5868,  4749,  5257, -3957, -2882,  3988,
+     1594,  1956,  1583, -2344, -1319, -5057, -2767, -3565,
+      652,  4624,  3315, -4536, -5782,  3174,  2908, -3879,
+    -2555,  1105, -1512,  2169,  1058, -3127, -1293, -4948,
+    -3728,  -504,   723,  4449,  3054,  -431,  2447, -5339,
+     -168,   241,  1483,  1018, -4240,  4912, -5876,   -56,
+    -4016, -3602, -3757,  2683, -2459, -6055, -4115, -5435,
+    -5297,  2844, -3202, -4916,  2078, -5468, -5908, -5862,
+      948,  3029, -5735,  4789, -5919,  2127, -1954,   316,
+     5106, -6008, -2500, -1973,   709,  3445, -3991,  1702,
+    -6099,  3263, -4754, -3860, -2948,  2766, -3529, -2033,
+     5184, -5681, -5383, -5079,   922,  2920, -4774,  1728,
+    -5990,  2302, -1693, -3789, -3123,  2505,   576, -6093,
+    -3329,  3532, -1263, -1041,   835,   192, -2031, -5206,
+    -2919,  -421,  -347, -3818,    64,  -677,  2361,  -973,
+     3956, -4212, -5369, -4075, -4322,   787,  3772,  5415,
+    -1404, -5886,  2738, -5537, -3834, -2839,  1805,  -468,
+    -1962,  5009, -5942, -1278,  3150,  4698,  -156,  -654,
+     5766, -6077,  -426,  1050,  1566,   -52,  -218,  1922,
+    -6122,  -142,   350,   522,  4079, -4169,  4737, -6137,
+     4049,  4213,   174,  5456, -5486,  1579, -6142,  5446,
+    -2692,    58,  5915, -5925, -3570,  2049, -2281,  3199,
+    -4077,  6068, -1975, -1190,   683,  3336, -3030, -1359,
+     6119,  3438, -4493,  4324,  1112, -1010,  -453,  6136,
+     1146, -5594, -2655,  4467, -4433,  -151, -2051,   382,
+    -5961,  -885,  1489, -5574,  4046, -4780, -3969, -1987,
+     -295, -3600, -1858,  5445,  2503, -1323,  3434,  3998,
+    -1200,  3477,  1815, -3262,  -441,  5241,  5429,  -400,
+     1159,   605,  3009,  -147,  1747,  5906,  3963, -3710,
+     4298,  1003,   -49, -3514,  6065,  1321, -5333,  5529,
+    -3762,  4080,  2925,  6118, -3656, -5874,  1843, -1254,
+      338, -2672,  1417, -5530,  -204, -3332,  2926, -5461,
+      923, -5406, -2275,  3805, -3393,  6026,  4209, -4987,
+    -3624,  2253,   -68, -5207, -3121,  2276,  4404, -1802,
+     3338, -2828, -1131,  6105,  1403,  2434, -1208,   751,
+    -4119, -5832,  3056,  4855,  1468, -4697,  5209, -5039,
+     -377,  2035,  4564, -3285, -4499, -3846, -1373, -1944,
+     5115, -2478, -3607, -5662, -2360, -5776, -4222, -3418,
+    -2575, -1095, -5596, -1282, -4554,  -648,  1705,  -826,
+     2894,  2209, -4883,  2171,  2689,  2957,  3238,  -365,
+     2231,  3669, -1518,  -216, -3528,  3821,  5061, -3360,
+    -5724,  4820, -3200,  5082, -3017, -4218,  4840,  1223,
+     -506,   -72, -1176,  5370,  1687, -1120, -1908,  5703,
+    -5163,  1694, -5102, -1406, -2483,  4504, -4265,   -24,
+     -392,  1790, -3534,  3723,  -636,  1901, -1721,  4661,
+    -5797, -4565, -4924, -2595, -5518,    -8, -4227,  4693,
+    -1178,  1241,  -212,  4730, -4670,  5650,  2164, -5618,
+     2455,  -865,  2257, -4099, -1409, -2532, -4489,  4510,
+    -4167,  5673, -5653, -2213, -3375, -5969, -3278,  3808,
+    -3344,  2730, -4566,  -844,  2600, -2593, -1389,  1891,
+     2212, -4834, -1125, -6086, -5189, -2827, -5211,   910,
+    -1522,  3815,  4963,  3232,  -463, -3466, -3359,  2485,
+     -375, -6125, -5826,  3154, -1737, -3793,  3589,  5368,
+    -2442, -3019,  3942,  2941, -5216, -3268,  -125, -6138,
+    -1942, -3045,  -579,  2832, -2900, -2307,  -814,  3090,
+     1314, -3116, -5835,  3007, -4138, -2046,  3449, -1015,
+     -193,   944, -5063,  -769,  3825,  1030,   438, -5135,
+    -1945, -3094,  2717,  -682,  5246,  3758,  4032,  4411,
+    -5784,  3840,  1275, -3753,   146, -5808,  3448,  3065,
+     5002,  3869,  5845,  5349,  1344, -2626, -1928,  1280,
+      425, -1251,  4145, -1936, -2947,  5118, -2429,  5386,
+    -2148,  1783,   448,  3221, -4739,  4523,  4238,  -417,
+     5478,  3451,  3114,  1706, -4906, -2301,  -716, -3502,
+    -3947,  5170, -5676,  5604,  5509,  -139,  1826, -2946,
+     1038,  4665,  2461,  -767, -4335,  2929, -5412, -2373,
+    -1892,  1868, -2260,  4050,  4705,  -982,   346,  1555,
+    -3276, -4352, -1445, -3120, -1804,  -791, -4727,  4719,
+     3343,  1350, -2528,  3769, -3981, -3578, -1092, -5547,
+    -4578, -1040,  3495, -4360, -5672,  1573, -2982,   450,
+    -4939, -2840, -1327, -5289,  -364, -1849, -1526, -4443,
+     1165,  2643, -5987, -3572,  -994,   150,  2450, -5043,
+     3654, -1763,  3975,  3480, -4605, -1481, -3708,   881,
+    -6092, -5287,  3765,    50,  4913, -1681,  1218, -4684,
+     1325,  1160, -1535, -4590, -1236,  4390, -6127,  2334,
+     1255,  4113,  5734,  3536,   406,  2535,  4538,  4483,
+    -4608, -1530,  -412, -2633,  2054,   778, -3678,  1371,
+    -2185,  5275, -3961,   845,  5609, -2602, -1536,  -510,
+     3959, -4974,  4781, -3837, -1226,   457,  3368, -2338,
+     2776,  4378,  5966,  3229,  -512,  -170,  5416, -1658,
+     5690, -1279, -4505, -3944,  5219,  3317, -3171, -2637,
+     6085, -3020, -4267, -4153, -2291, -4649,  5993,  3670,
+    -5598, -5411,  5836,  5202, -1057,  -879, -2068, -5103,
+     2674,  2712, -4860, -5646,  6094, -2873, -1866, -5900,
+    -2151,  1734,  3744,  -293,  3407, -1701, -3205,   904,
+    -1620, -1882, -2065, -5054,  -622, -6063,  -717,   578,
+     1248, -4194,  5232,  -567,  3028, -3795,  -540,  3469,
+     3408, -5781,  3889, -2021,  -239,  4289,   416, -1398,
+     1744,  -189, -3087, -1265,  -180, -2940,  1136, -1927,
+    -2800, -4770, -4176,  5526,  4235,  -466, -3515,   -63,
+    -1029, -4518,   -60,  -980,  4475,  3454,  3163, -1590,
+    -1392,  1842,  5508,  3941, -5268,   -21,  -343, -1506,
+      -20, -4423,  5588, -2945, -3042,  -530,  -464,   614,
+     1836,  5410, -1756,    -7,  3982,  -502, -4103,  2622,
+     5959, -5078, -1014, -4273, -4251,  4301,   612, -2293,
+     3511,  4094, -2769,  3929, -5464,   874, -2110, -5789,
+};
+
+const int16_t ntt_red1024_mixed_powers_rev[1024] = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+      338, -3947,  2455,  5690,  2894,  3654,  1314,  1744,
+    -4119,  3343, -1522, -2151, -5163, -4608,  5002,   -20,
+    -3624, -1892, -3344, -5598, -5724,  1325, -1945, -1029,
+     5115, -4939, -2442,  1248, -5797,  3959, -2148,  5959,
+      923,  1038, -4167,  6085,  2231, -6092,  -193, -2800,
+     -377, -4578,  -375, -1620,  -392, -2185,   425,  1836,
+     3338, -3276,  2212,  2674,  -506,  1255, -5784, -1392,
+    -2575,  1165, -1942,  3408, -1178,  2776,  5478,  3511,
+     -204,  5509, -1409,  5219,  2689, -4605, -4138,  -180,
+     1468, -3981,  -463,  3407, -2483,  2054,  1344, -3042,
+    -3121,  4705,  2600, -1057, -3017, -1236,  5246,  4475,
+    -2360,  -364, -5216,  3028, -5518, -1226, -4739, -4251,
+    -3393, -4335, -3375, -2291, -3528,  4913,  3825,  4235,
+    -4499, -5672, -1737,  -622,  -636,  5609, -2947,  3982,
+     1403, -1804, -5189,  6094,  1687,   406,   146, -5268,
+    -4554,  -994, -2900,  -239, -4670,  -512, -4906, -5464,
+     1417, -5676,  2257, -4505, -4883,  3975, -5835, -3087,
+     3056, -2528,  4963,  3744, -5102,  -412,  5845,  5588,
+      -68, -2260, -4566,  5836, -3200, -1535,  2717,   -60,
+    -3607, -1327,  3942,  5232, -4924,  4781,   448, -1014,
+    -2275,  2461, -5653, -4267, -1518,  3765, -5063, -4176,
+     4564,  3495, -5826, -2065, -3534, -3961,  4145, -1756,
+    -1131, -1445, -1125, -4860, -1176,  5734,  1275,  5508,
+    -5596, -5987,  -579,  3889,  -212,  5966,  3114, -2769,
+     2926,  1826, -4489, -3171,  3238, -3708,  3449,  1136,
+     5209, -1092, -3359, -3205, -4265, -3678, -1928,  -464,
+     4404,   346, -1389, -2068,  4840, -6127,  4032,  3163,
+    -4222, -1526,  -125,  -540, -4227,  3368,  4238,   612,
+     4209, -5412, -3278,  5993,  5061,  1218,   438, -3515,
+    -1373, -2982,  3589,  -717, -1721, -1536, -2429, -4103,
+    -1208, -4727, -5211, -1866, -1908,  4538,  3448,  -343,
+     1705,  2450,  -814,   416,  2164,  5416,  -716, -2110,
+    -2672,  5170,  -865, -1279,  2209, -1763, -3116,  -189,
+    -5832,  1350,  3815,  1734,  1694, -1530,  3869, -4423,
+     2253,  1868,  2730, -5411,  4820,  1160, -3094, -4518,
+    -2478, -2840, -3019, -4194, -4565, -4974,  1783, -5078,
+    -5406,  4665,  5673, -3020,  3669, -5287,   944, -4770,
+     2035, -1040, -6125, -1882,  1790,  5275, -1251,  5410,
+    -2828, -4352, -4834,  2712,   -72,  4113,  3840,  1842,
+    -1095,  2643, -3045, -5781,  1241,  4378,  3451,  4094,
+    -3332,  -139, -2532,  3317,  2957, -1481, -2046, -2940,
+    -4697, -3578, -3466, -1701,  4504,   778, -2626,  -530,
+     2276,  -982, -2593,  -879, -4218,  4390,  3758,  3454,
+    -5776, -1849, -3268, -3795,    -8,   457,  4523,  4301,
+     6026,  2929, -5969, -4649,  3821, -1681,  1030,  -466,
+    -3846,  1573, -3793, -6063,  1901, -2602,  5118,  -502,
+     2434,  -791, -2827, -2873, -1120,  2535, -5808,   -21,
+     -648,   150, -2307,  4289,  5650,  -170, -2301,   874,
+    -5530,  5604, -4099, -3944,  2171,  3480,  3007, -1265,
+     4855,  3769,  3232,  -293, -1406, -2633,  5349, -2945,
+    -5207,  4050,  -844,  5202,  5082, -4590,  -682,  -980,
+    -5662, -5289,  2941,  -567, -2595, -3837,  3221, -4273,
+     3805,  -767, -2213, -4153,  -216,    50,  -769,  5526,
+    -3285, -4360,  3154, -5054,  3723,   845, -1936,    -7,
+     6105, -3120, -6086, -5646,  5370,  3536, -3753,  3941,
+    -1282, -3572,  2832, -2021,  4730,  3229,  1706,  3929,
+    -5461, -2946,  4510, -2637,  -365,   881, -1015, -1927,
+    -5039, -5547,  2485,   904,   -24,  1371,  1280,   614,
+    -1802,  1555,  1891, -5103,  1223,  2334,  4411, -1590,
+    -3418, -4443, -6138,  3469,  4693, -2338,  -417, -2293,
+    -4987, -2373,  3808,  3670, -3360, -4684, -5135,   -63,
+    -1944,   450,  5368,   578,  4661,  -510,  5386,  2622,
+      751,  4719,   910, -5900,  5703,  4483,  3065, -1506,
+     -826, -5043,  3090, -1398, -5618, -1658, -3502, -5789,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers[1024] = {
+        0,  -493, -2381, -5444,  4337,  1378,   435,  1912,
+     3248, -2143,  1168, -4645,  1207, -1065,  5277,   404,
+    -4284,  2437,  3780,  2187,  1002,  6022, -1607, -2422,
+    -5088, -3646,   875, -2566,  5011,  2987,  4976,  6039,
+     2481,  4143,  2401,    27, -2912,  5019,   773, -5084,
+    -1045, -1537,  5101,  3763, -4861, -3704, -3778,  1017,
+     5012,  4714,   442, -3066,  5698,  -545,  -390, -1632,
+    -2859,  -242,  1067,  1440,   354, -2678, -3833, -4885,
+    -2370, -5195, -5191,     3, -2249, -1689,   420,  4654,
+    -2969, -2645,   243,  2166, -1630, -2847, -3985,  5291,
+    -5332, -4895,  3400,  3149,  2884, -3271, -1544, -1777,
+    -3247,  5042, -3000,   113,  5407, -2174,  3531, -4938,
+     2865,  2780, -3136, -4437, -4048,  3364,  5559, -1426,
+     3978,  4053, -3016,  3915,  2126, -4414, -4905,  2704,
+    -3510,  1484, -2399,   160, -1153, -4057, -2178, -1663,
+    -2686,  2305,   671,  4919,  3186, -4372,   476,  3636,
+    -1428,  2366,  1381,     1,  5179, -4846, -3296,  -563,
+    -3284,   140,     9, -2545,  5542, -5086, -5067, -4978,
+     1260,    81,  1673,   722,  3382,  3553,  4354,  -949,
+      729,  2768, -5791,  5860, -4890,  2319,  3748, -5728,
+      334, -2963,  3584,  5146, -3707, -3135, -2396,  3006,
+    -2089, -4611, -2842,  3504, -3637,  3014,  2476,  5777,
+    -4632, -1000, -5331,  4134,  2548, -2294,  2837, -4821,
+     3289,  1177,   339, -1646,  3932,   955,  5767,  5023,
+    -1696,  3051, -2525, -1479, -3694,  2747, -3949, -2975,
+     2881,  1853, -1022,  3621,   145,  1326, -2197,  1351,
+     4388,  3091, -4278,  1305,  -355,  4805,  -130,  2625,
+     3241, -1635,  -544, -3195, -5911, -1170,  -953,  4591,
+    -2426, -4896, -4177, -4043,  1759,  3712,  4452,  2744,
+     5092,  -726,   480,  3542, -3459,  3201,   118, -3328,
+     5755,  4320, -4989,  5736,  4231,  1062, -5374,  2639,
+     2013,  4255,  2468,  1212, -2731,   790,  -827,  5828,
+     1254, -1843,  5874,  3656, -6118, -2925, -4080,  3762,
+    -5529,  5333, -1321, -6065,  3514,    49, -1003, -4298,
+     3710, -3963, -5906, -1747,   147, -3009,  -605, -1159,
+      400, -5429, -5241,   441,  3262, -1815, -3477,  1200,
+    -3998, -3434,  1323, -2503, -5445,  1858,  3600,   295,
+     1987,  3969,  4780, -4046,  5574, -1489,   885,  5961,
+     -382,  2051,   151,  4433, -4467,  2655,  5594, -1146,
+    -6136,   453,  1010, -1112, -4324,  4493, -3438, -6119,
+     1359,  3030, -3336,  -683,  1190,  1975, -6068,  4077,
+    -3199,  2281, -2049,  3570,  5925, -5915,   -58,  2692,
+    -5446,  6142, -1579,  5486, -5456,  -174, -4213, -4049,
+     6137, -4737,  4169, -4079,  -522,  -350,   142,  6122,
+    -1922,   218,    52, -1566, -1050,   426,  6077, -5766,
+      654,   156, -4698, -3150,  1278,  5942, -5009,  1962,
+      468, -1805,  2839,  3834,  5537, -2738,  5886,  1404,
+    -5415, -3772,  -787,  4322,  4075,  5369,  4212, -3956,
+      973, -2361,   677,   -64,  3818,   347,   421,  2919,
+     5206,  2031,  -192,  -835,  1041,  1263, -3532,  3329,
+     6093,  -576, -2505,  3123,  3789,  1693, -2302,  5990,
+    -1728,  4774, -2920,  -922,  5079,  5383,  5681, -5184,
+     2033,  3529, -2766,  2948,  3860,  4754, -3263,  6099,
+    -1702,  3991, -3445,  -709,  1973,  2500,  6008, -5106,
+     -316,  1954, -2127,  5919, -4789,  5735, -3029,  -948,
+     5862,  5908,  5468, -2078,  4916,  3202, -2844,  5297,
+     5435,  4115,  6055,  2459, -2683,  3757,  3602,  4016,
+       56,  5876, -4912,  4240, -1018, -1483,  -241,   168,
+     5339, -2447,   431, -3054, -4449,  -723,   504,  3728,
+     4948,  1293,  3127, -1058, -2169,  1512, -1105,  2555,
+     3879, -2908, -3174,  5782,  4536, -3315, -4624,  -652,
+     3565,  2767,  5057,  1319,  2344, -1583, -1956, -1594,
+    -3988,  2882,  3957, -5257, -4749, -5868, -4782,   325,
+    -3643,  -418, -3482, -1958, -5315, -2057,   975,  1360,
+     5789,  2110,  -874,  5464, -3929,  2769, -4094, -3511,
+     2293,  -612, -4301,  4251,  4273,  1014,  5078, -5959,
+    -2622,  4103,   502, -3982,     7,  1756, -5410, -1836,
+     -614,   464,   530,  3042,  2945, -5588,  4423,    20,
+     1506,   343,    21,  5268, -3941, -5508, -1842,  1392,
+     1590, -3163, -3454, -4475,   980,    60,  4518,  1029,
+       63,  3515,   466, -4235, -5526,  4176,  4770,  2800,
+     1927, -1136,  2940,   180,  1265,  3087,   189, -1744,
+     1398,  -416, -4289,   239,  2021, -3889,  5781, -3408,
+    -3469,   540,  3795, -3028,   567, -5232,  4194, -1248,
+     -578,   717,  6063,   622,  5054,  2065,  1882,  1620,
+     -904,  3205,  1701, -3407,   293, -3744, -1734,  2151,
+     5900,  1866,  2873, -6094,  5646,  4860, -2712, -2674,
+     5103,  2068,   879,  1057, -5202, -5836,  5411,  5598,
+    -3670, -5993,  4649,  2291,  4153,  4267,  3020, -6085,
+     2637,  3171, -3317, -5219,  3944,  4505,  1279, -5690,
+     1658, -5416,   170,   512, -3229, -5966, -4378, -2776,
+     2338, -3368,  -457,  1226,  3837, -4781,  4974, -3959,
+      510,  1536,  2602, -5609,  -845,  3961, -5275,  2185,
+    -1371,  3678,  -778, -2054,  2633,   412,  1530,  4608,
+    -4483, -4538, -2535,  -406, -3536, -5734, -4113, -1255,
+    -2334,  6127, -4390,  1236,  4590,  1535, -1160, -1325,
+     4684, -1218,  1681, -4913,   -50, -3765,  5287,  6092,
+     -881,  3708,  1481,  4605, -3480, -3975,  1763, -3654,
+     5043, -2450,  -150,   994,  3572,  5987, -2643, -1165,
+     4443,  1526,  1849,   364,  5289,  1327,  2840,  4939,
+     -450,  2982, -1573,  5672,  4360, -3495,  1040,  4578,
+     5547,  1092,  3578,  3981, -3769,  2528, -1350, -3343,
+    -4719,  4727,   791,  1804,  3120,  1445,  4352,  3276,
+    -1555,  -346,   982, -4705, -4050,  2260, -1868,  1892,
+     2373,  5412, -2929,  4335,   767, -2461, -4665, -1038,
+     2946, -1826,   139, -5509, -5604,  5676, -5170,  3947,
+     3502,   716,  2301,  4906, -1706, -3114, -3451, -5478,
+      417, -4238, -4523,  4739, -3221,  -448, -1783,  2148,
+    -5386,  2429, -5118,  2947,  1936, -4145,  1251,  -425,
+    -1280,  1928,  2626, -1344, -5349, -5845, -3869, -5002,
+    -3065, -3448,  5808,  -146,  3753, -1275, -3840,  5784,
+    -4411, -4032, -3758, -5246,   682, -2717,  3094,  1945,
+     5135,  -438, -1030, -3825,   769,  5063,  -944,   193,
+     1015, -3449,  2046,  4138, -3007,  5835,  3116, -1314,
+    -3090,   814,  2307,  2900, -2832,   579,  3045,  1942,
+     6138,   125,  3268,  5216, -2941, -3942,  3019,  2442,
+    -5368, -3589,  3793,  1737, -3154,  5826,  6125,   375,
+    -2485,  3359,  3466,   463, -3232, -4963, -3815,  1522,
+     -910,  5211,  2827,  5189,  6086,  1125,  4834, -2212,
+    -1891,  1389,  2593, -2600,   844,  4566, -2730,  3344,
+    -3808,  3278,  5969,  3375,  2213,  5653, -5673,  4167,
+    -4510,  4489,  2532,  1409,  4099, -2257,   865, -2455,
+     5618, -2164, -5650,  4670, -4730,   212, -1241,  1178,
+    -4693,  4227,     8,  5518,  2595,  4924,  4565,  5797,
+    -4661,  1721, -1901,   636, -3723,  3534, -1790,   392,
+       24,  4265, -4504,  2483,  1406,  5102, -1694,  5163,
+    -5703,  1908,  1120, -1687, -5370,  1176,    72,   506,
+    -1223, -4840,  4218,  3017, -5082,  3200, -4820,  5724,
+     3360, -5061, -3821,  3528,   216,  1518, -3669, -2231,
+      365, -3238, -2957, -2689, -2171,  4883, -2209, -2894,
+      826, -1705,   648,  4554,  1282,  5596,  1095,  2575,
+     3418,  4222,  5776,  2360,  5662,  3607,  2478, -5115,
+     1944,  1373,  3846,  4499,  3285, -4564, -2035,   377,
+     5039, -5209,  4697, -1468, -4855, -3056,  5832,  4119,
+     -751,  1208, -2434, -1403, -6105,  1131,  2828, -3338,
+     1802, -4404, -2276,  3121,  5207,    68, -2253,  3624,
+     4987, -4209, -6026,  3393, -3805,  2275,  5406,  -923,
+     5461, -2926,  3332,   204,  5530, -1417,  2672,  -338,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers_rev[1024] = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+     5789,  3502,  1658,  5618,  1398, -3090,  5043,   826,
+     1506, -3065, -4483, -5703,  5900,  -910, -4719,  -751,
+    -2622, -5386,   510, -4661,  -578, -5368,  -450,  1944,
+       63,  5135,  4684,  3360, -3670, -3808,  2373,  4987,
+     2293,   417,  2338, -4693, -3469,  6138,  4443,  3418,
+     1590, -4411, -2334, -1223,  5103, -1891, -1555,  1802,
+     -614, -1280, -1371,    24,  -904, -2485,  5547,  5039,
+     1927,  1015,  -881,   365,  2637, -4510,  2946,  5461,
+    -3929, -1706, -3229, -4730,  2021, -2832,  3572,  1282,
+    -3941,  3753, -3536, -5370,  5646,  6086,  3120, -6105,
+        7,  1936,  -845, -3723,  5054, -3154,  4360,  3285,
+    -5526,   769,   -50,   216,  4153,  2213,   767, -3805,
+     4273, -3221,  3837,  2595,   567, -2941,  5289,  5662,
+      980,   682,  4590, -5082, -5202,   844, -4050,  5207,
+     2945, -5349,  2633,  1406,   293, -3232, -3769, -4855,
+     1265, -3007, -3480, -2171,  3944,  4099, -5604,  5530,
+     -874,  2301,   170, -5650, -4289,  2307,  -150,   648,
+       21,  5808, -2535,  1120,  2873,  2827,   791, -2434,
+      502, -5118,  2602, -1901,  6063,  3793, -1573,  3846,
+      466, -1030,  1681, -3821,  4649,  5969, -2929, -6026,
+    -4301, -4523,  -457,     8,  3795,  3268,  1849,  5776,
+    -3454, -3758, -4390,  4218,   879,  2593,   982, -2276,
+      530,  2626,  -778, -4504,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481, -2957, -3317,  2532,   139,  3332,
+    -4094, -3451, -4378, -1241,  5781,  3045, -2643,  1095,
+    -1842, -3840, -4113,    72, -2712,  4834,  4352,  2828,
+    -5410,  1251, -5275, -1790,  1882,  6125,  1040, -2035,
+     4770,  -944,  5287, -3669,  3020, -5673, -4665,  5406,
+     5078, -1783,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, -1160, -4820,  5411, -2730, -1868, -2253,
+     4423, -3869,  1530, -1694, -1734, -3815, -1350,  5832,
+      189,  3116,  1763, -2209,  1279,   865, -5170,  2672,
+     2110,   716, -5416, -2164,  -416,   814, -2450, -1705,
+      343, -3448, -4538,  1908,  1866,  5211,  4727,  1208,
+     4103,  2429,  1536,  1721,   717, -3589,  2982,  1373,
+     3515,  -438, -1218, -5061, -5993,  3278,  5412, -4209,
+     -612, -4238, -3368,  4227,   540,   125,  1526,  4222,
+    -3163, -4032,  6127, -4840,  2068,  1389,  -346, -4404,
+      464,  1928,  3678,  4265,  3205,  3359,  1092, -5209,
+    -1136, -3449,  3708, -3238,  3171,  4489, -1826, -2926,
+     2769, -3114, -5966,   212, -3889,   579,  5987,  5596,
+    -5508, -1275, -5734,  1176,  4860,  1125,  1445,  1131,
+     1756, -4145,  3961,  3534,  2065,  5826, -3495, -4564,
+     4176,  5063, -3765,  1518,  4267,  5653, -2461,  2275,
+     1014,  -448, -4781,  4924, -5232, -3942,  1327,  3607,
+       60, -2717,  1535,  3200, -5836,  4566,  2260,    68,
+    -5588, -5845,   412,  5102, -3744, -4963,  2528, -3056,
+     3087,  5835, -3975,  4883,  4505, -2257,  5676, -1417,
+     5464,  4906,   512,  4670,   239,  2900,   994,  4554,
+     5268,  -146,  -406, -1687, -6094,  5189,  1804, -1403,
+    -3982,  2947, -5609,   636,   622,  1737,  5672,  4499,
+    -4235, -3825, -4913,  3528,  2291,  3375,  4335,  3393,
+     4251,  4739,  1226,  5518, -3028,  5216,   364,  2360,
+    -4475, -5246,  1236,  3017,  1057, -2600, -4705,  3121,
+     3042, -1344, -2054,  2483, -3407,   463,  3981, -1468,
+      180,  4138,  4605, -2689, -5219,  1409, -5509,   204,
+    -3511, -5478, -2776,  1178, -3408,  1942, -1165,  2575,
+     1392,  5784, -1255,   506, -2674, -2212,  3276, -3338,
+    -1836,  -425,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, -2231, -6085,  4167, -1038,  -923,
+    -5959,  2148, -3959,  5797, -1248,  2442,  4939, -5115,
+     1029,  1945, -1325,  5724,  5598,  3344,  1892,  3624,
+       20, -5002,  4608,  5163,  2151,  1522, -3343,  4119,
+    -1744, -1314, -3654, -2894, -5690, -2455,  3947,  -338,
+};
+
+const int16_t ntt_red1024_omega_powers_ct_r4[1024] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,  5444,
+    -1912, -1378,   493,  5444,  2381,  2381,  -435, -4337,
+    -4096, -4096,   493,  -404, -6039,  2422, -1912,  -404,
+     4645, -5277, -4976,  1607,  5444, -1912, -1378,  1065,
+    -2987, -6022,  -435, -5277, -1168, -1207, -5011, -1002,
+      493,  5444,  2381,  4645,  2566, -2187, -1378,  1065,
+     2143, -1168,  -875, -3780,  2381,  -435, -4337,  2143,
+     3646, -2437, -4337, -1207, -3248, -3248,  5088,  4284,
+    -4096, -4096,   493,  4885, -3636,  4938, -6039,  4885,
+    -1017,  3833,  -476, -3531,  -404, -6039,  2422,  2678,
+     4372,  2174, -4976,  3833,  3778,  -354, -3186, -5407,
+    -1912,  -404,  4645, -1440, -4919,  -113, -2987,  2678,
+     3704, -1067,  -671,  3000, -5277, -4976,  1607,   242,
+    -2305, -5042, -5011,  -354,  4861,  2859,  2686,  3247,
+     5444, -1912, -1378,  1632,  1663,  1777,  2566, -1440,
+    -3763,   390,  2178,  1544,  1065, -2987, -6022,   545,
+     4057,  3271,  -875, -1067, -5101, -5698,  1153, -2884,
+     -435, -5277, -1168,  3066,  -160, -3149,  3646,   242,
+     1537,  -442,  2399, -3400, -1207, -5011, -1002, -4714,
+    -1484,  4895,  5088,  2859,  1045, -5012,  3510,  5332,
+      493,  5444,  2381, -1017, -2704, -5291,  2422,  1632,
+     5084,  3778,  4905,  3985,  4645,  2566, -2187,  3704,
+     4414,  2847,  1607,   390,  -773,  4861, -2126,  1630,
+    -1378,  1065,  2143, -3763, -3915, -2166, -6022,   545,
+    -5019, -5101,  3016,  -243, -1168,  -875, -3780,  1537,
+    -4053,  2645, -1002, -5698,  2912,  1045, -3978,  2969,
+     2381,  -435, -4337,  5084,  1426, -4654, -2187,  3066,
+      -27,  -773, -5559,  -420,  2143,  3646, -2437, -5019,
+    -3364,  1689, -3780,  -442, -2401,  2912,  4048,  2249,
+    -4337, -1207, -3248,   -27,  4437,    -3, -2437, -4714,
+    -4143, -2401,  3136,  5191, -3248,  5088,  4284, -4143,
+    -2780,  5195,  4284, -5012, -2481, -2481, -2865,  2370,
+    -4096, -4096,   493, -5828, -1360,  3956, -3636, -5828,
+    -5023,   827,  -975, -4212,  4885, -3636,  4938,  -790,
+     2057, -5369,  -476,   827, -5767,  2731,  5315, -4075,
+    -6039,  4885, -1017, -1212,  1958, -4322,  4372,  -790,
+     -955, -2468,  3482,   787,  3833,  -476, -3531, -4255,
+      418,  3772, -3186,  2731, -3932, -2013,  3643,  5415,
+     -404, -6039,  2422, -2639,  -325, -1404, -4919, -1212,
+     1646,  5374,  4782, -5886,  2678,  4372,  2174, -1062,
+     5868,  2738,  -671, -2468,  -339, -4231,  4749, -5537,
+    -4976,  3833,  3778, -5736,  5257, -3834, -2305, -4255,
+    -1177,  4989, -3957, -2839,  -354, -3186, -5407, -4320,
+    -2882,  1805,  2686, -2013, -3289, -5755,  3988,  -468,
+    -1912,  -404,  4645,  3328,  1594, -1962,  1663, -2639,
+     4821,  -118,  1956,  5009, -1440, -4919,  -113, -3201,
+     1583, -5942,  2178,  5374, -2837,  3459, -2344, -1278,
+    -2987,  2678,  3704, -3542, -1319,  3150,  4057, -1062,
+     2294,  -480, -5057,  4698, -1067,  -671,  3000,   726,
+    -2767,  -156,  1153, -4231, -2548, -5092, -3565,  -654,
+    -5277, -4976,  1607, -2744,   652,  5766,  -160, -5736,
+    -4134, -4452,  4624, -6077,   242, -2305, -5042, -3712,
+     3315,  -426,  2399,  4989,  5331, -1759, -4536,  1050,
+    -5011,  -354,  4861,  4043, -5782,  1566, -1484, -4320,
+     1000,  4177,  3174,   -52,  2859,  2686,  3247,  4896,
+     2908,  -218,  3510, -5755,  4632,  2426, -3879,  1922,
+     5444, -1912, -1378, -4591, -2555, -6122, -2704,  3328,
+    -5777,   953,  1105,  -142,  1632,  1663,  1777,  1170,
+    -1512,   350,  4905,  -118, -2476,  5911,  2169,   522,
+     2566, -1440, -3763,  3195,  1058,  4079,  4414, -3201,
+    -3014,   544, -3127, -4169,   390,  2178,  1544,  1635,
+    -1293,  4737, -2126,  3459,  3637, -3241, -4948, -6137,
+     1065, -2987, -6022, -2625, -3728,  4049, -3915, -3542,
+    -3504,   130,  -504,  4213,   545,  4057,  3271, -4805,
+      723,   174,  3016,  -480,  2842,   355,  4449,  5456,
+     -875, -1067, -5101, -1305,  3054, -5486, -4053,   726,
+     4611,  4278,  -431,  1579, -5698,  1153, -2884, -3091,
+     2447, -6142, -3978, -5092,  2089, -4388, -5339,  5446,
+     -435, -5277, -1168, -1351,  -168, -2692,  1426, -2744,
+    -3006,  2197,   241,    58,  3066,  -160, -3149, -1326,
+     1483,  5915, -5559, -4452,  2396,  -145,  1018, -5925,
+     3646,   242,  1537, -3621, -4240, -3570, -3364, -3712,
+     3135,  1022,  4912,  2049,  -442,  2399, -3400, -1853,
+    -5876, -2281,  4048, -1759,  3707, -2881,   -56,  3199,
+    -1207, -5011, -1002,  2975, -4016, -4077,  4437,  4043,
+    -5146,  3949, -3602,  6068, -4714, -1484,  4895, -2747,
+    -3757, -1975,  3136,  4177, -3584,  3694,  2683, -1190,
+     5088,  2859,  1045,  1479, -2459,   683, -2780,  4896,
+     2963,  2525, -6055,  3336, -5012,  3510,  5332, -3051,
+    -4115, -3030, -2865,  2426,  -334,  1696, -5435, -1359,
+      493,  5444,  2381, -5023, -5297,  6119,  4938, -4591,
+     5728, -5767,  2844,  3438, -1017, -2704, -5291,  -955,
+    -3202, -4493, -3531,   953, -3748, -3932, -4916,  4324,
+     2422,  1632,  5084,  1646,  2078,  1112,  2174,  1170,
+    -2319,  -339, -5468, -1010,  3778,  4905,  3985, -1177,
+    -5908,  -453, -5407,  5911,  4890, -3289, -5862,  6136,
+     4645,  2566, -2187,  4821,   948,  1146,  -113,  3195,
+    -5860, -2837,  3029, -5594,  3704,  4414,  2847,  2294,
+    -5735, -2655,  3000,   544,  5791, -2548,  4789,  4467,
+     1607,   390,  -773, -4134, -5919, -4433, -5042,  1635,
+    -2768,  5331,  2127,  -151,  4861, -2126,  1630,  1000,
+    -1954, -2051,  3247, -3241,  -729,  4632,   316,   382,
+    -1378,  1065,  2143, -5777,  5106, -5961,  1777, -2625,
+      949, -2476, -6008,  -885, -3763, -3915, -2166, -3014,
+    -2500,  1489,  1544,   130, -4354,  3637, -1973, -5574,
+    -6022,   545, -5019, -3504,   709,  4046,  3271, -4805,
+    -3553,  2842,  3445, -4780, -5101,  3016,  -243,  4611,
+    -3991, -3969, -2884,   355, -3382,  2089,  1702, -1987,
+    -1168,  -875, -3780, -3006, -6099,  -295, -3149, -1305,
+     -722,  2396,  3263, -3600,  1537, -4053,  2645,  3135,
+    -4754, -1858, -3400,  4278, -1673,  3707, -3860,  5445,
+    -1002, -5698,  2912, -5146, -2948,  2503,  4895, -3091,
+      -81, -3584,  2766, -1323,  1045, -3978,  2969,  2963,
+    -3529,  3434,  5332, -4388, -1260,  -334, -2033,  3998,
+     2381,  -435, -4337,  5728,  5184, -1200, -5291, -1351,
+     4978, -3748, -5681,  3477,  5084,  1426, -4654, -2319,
+    -5383,  1815,  3985,  2197,  5067,  4890, -5079, -3262,
+    -2187,  3066,   -27, -5860,   922,  -441,  2847, -1326,
+     5086,  5791,  2920,  5241,  -773, -5559,  -420, -2768,
+    -4774,  5429,  1630,  -145, -5542,  -729,  1728,  -400,
+     2143,  3646, -2437,   949, -5990,  1159, -2166, -3621,
+     2545, -4354,  2302,   605, -5019, -3364,  1689, -3553,
+    -1693,  3009,  -243,  1022,    -9, -3382, -3789,  -147,
+    -3780,  -442, -2401,  -722, -3123,  1747,  2645, -1853,
+     -140, -1673,  2505,  5906,  2912,  4048,  2249,   -81,
+      576,  3963,  2969, -2881,  3284, -1260, -6093, -3710,
+    -4337, -1207, -3248,  4978, -3329,  4298, -4654,  2975,
+      563,  5067,  3532,  1003,   -27,  4437,    -3,  5086,
+    -1263,   -49,  -420,  3949,  3296, -5542, -1041, -3514,
+    -2437, -4714, -4143,  2545,   835,  6065,  1689, -2747,
+     4846,    -9,   192,  1321, -2401,  3136,  5191,  -140,
+    -2031, -5333,  2249,  3694, -5179,  3284, -5206,  5529,
+    -3248,  5088,  4284,   563, -2919, -3762,    -3,  1479,
+       -1,  3296,  -421,  4080, -4143, -2780,  5195,  4846,
+     -347,  2925,  5191,  2525, -1381, -5179, -3818,  6118,
+     4284, -5012, -2481,    -1,    64, -3656,  5195, -3051,
+    -2366, -1381,  -677, -5874, -2481, -2865,  2370, -2366,
+     2361,  1843,  2370,  1696,  1428,  1428,  -973, -1254,
+};
+
+const int16_t ntt_red1024_omega_powers_gs_r4[1024] = {
+        0, -4096,   493, -4096, -1360,  3956, -5828, -5828,
+    -5023, -3636,  -975, -4212,   827, -3636,  4938,  4885,
+     2057, -5369,  -790,   827, -5767,  -476,  5315, -4075,
+     2731,  4885, -1017, -6039,  1958, -4322, -1212,  -790,
+     -955,  4372,  3482,   787, -2468,  -476, -3531,  3833,
+      418,  3772, -4255,  2731, -3932, -3186,  3643,  5415,
+    -2013, -6039,  2422,  -404,  -325, -1404, -2639, -1212,
+     1646, -4919,  4782, -5886,  5374,  4372,  2174,  2678,
+     5868,  2738, -1062, -2468,  -339,  -671,  4749, -5537,
+    -4231,  3833,  3778, -4976,  5257, -3834, -5736, -4255,
+    -1177, -2305, -3957, -2839,  4989, -3186, -5407,  -354,
+    -2882,  1805, -4320, -2013, -3289,  2686,  3988,  -468,
+    -5755,  -404,  4645, -1912,  1594, -1962,  3328, -2639,
+     4821,  1663,  1956,  5009,  -118, -4919,  -113, -1440,
+     1583, -5942, -3201,  5374, -2837,  2178, -2344, -1278,
+     3459,  2678,  3704, -2987, -1319,  3150, -3542, -1062,
+     2294,  4057, -5057,  4698,  -480,  -671,  3000, -1067,
+    -2767,  -156,   726, -4231, -2548,  1153, -3565,  -654,
+    -5092, -4976,  1607, -5277,   652,  5766, -2744, -5736,
+    -4134,  -160,  4624, -6077, -4452, -2305, -5042,   242,
+     3315,  -426, -3712,  4989,  5331,  2399, -4536,  1050,
+    -1759,  -354,  4861, -5011, -5782,  1566,  4043, -4320,
+     1000, -1484,  3174,   -52,  4177,  2686,  3247,  2859,
+     2908,  -218,  4896, -5755,  4632,  3510, -3879,  1922,
+     2426, -1912, -1378,  5444, -2555, -6122, -4591,  3328,
+    -5777, -2704,  1105,  -142,   953,  1663,  1777,  1632,
+    -1512,   350,  1170,  -118, -2476,  4905,  2169,   522,
+     5911, -1440, -3763,  2566,  1058,  4079,  3195, -3201,
+    -3014,  4414, -3127, -4169,   544,  2178,  1544,   390,
+    -1293,  4737,  1635,  3459,  3637, -2126, -4948, -6137,
+    -3241, -2987, -6022,  1065, -3728,  4049, -2625, -3542,
+    -3504, -3915,  -504,  4213,   130,  4057,  3271,   545,
+      723,   174, -4805,  -480,  2842,  3016,  4449,  5456,
+      355, -1067, -5101,  -875,  3054, -5486, -1305,   726,
+     4611, -4053,  -431,  1579,  4278,  1153, -2884, -5698,
+     2447, -6142, -3091, -5092,  2089, -3978, -5339,  5446,
+    -4388, -5277, -1168,  -435,  -168, -2692, -1351, -2744,
+    -3006,  1426,   241,    58,  2197,  -160, -3149,  3066,
+     1483,  5915, -1326, -4452,  2396, -5559,  1018, -5925,
+     -145,   242,  1537,  3646, -4240, -3570, -3621, -3712,
+     3135, -3364,  4912,  2049,  1022,  2399, -3400,  -442,
+    -5876, -2281, -1853, -1759,  3707,  4048,   -56,  3199,
+    -2881, -5011, -1002, -1207, -4016, -4077,  2975,  4043,
+    -5146,  4437, -3602,  6068,  3949, -1484,  4895, -4714,
+    -3757, -1975, -2747,  4177, -3584,  3136,  2683, -1190,
+     3694,  2859,  1045,  5088, -2459,   683,  1479,  4896,
+     2963, -2780, -6055,  3336,  2525,  3510,  5332, -5012,
+    -4115, -3030, -3051,  2426,  -334, -2865, -5435, -1359,
+     1696,  5444,  2381,   493, -5297,  6119, -5023, -4591,
+     5728,  4938,  2844,  3438, -5767, -2704, -5291, -1017,
+    -3202, -4493,  -955,   953, -3748, -3531, -4916,  4324,
+    -3932,  1632,  5084,  2422,  2078,  1112,  1646,  1170,
+    -2319,  2174, -5468, -1010,  -339,  4905,  3985,  3778,
+    -5908,  -453, -1177,  5911,  4890, -5407, -5862,  6136,
+    -3289,  2566, -2187,  4645,   948,  1146,  4821,  3195,
+    -5860,  -113,  3029, -5594, -2837,  4414,  2847,  3704,
+    -5735, -2655,  2294,   544,  5791,  3000,  4789,  4467,
+    -2548,   390,  -773,  1607, -5919, -4433, -4134,  1635,
+    -2768, -5042,  2127,  -151,  5331, -2126,  1630,  4861,
+    -1954, -2051,  1000, -3241,  -729,  3247,   316,   382,
+     4632,  1065,  2143, -1378,  5106, -5961, -5777, -2625,
+      949,  1777, -6008,  -885, -2476, -3915, -2166, -3763,
+    -2500,  1489, -3014,   130, -4354,  1544, -1973, -5574,
+     3637,   545, -5019, -6022,   709,  4046, -3504, -4805,
+    -3553,  3271,  3445, -4780,  2842,  3016,  -243, -5101,
+    -3991, -3969,  4611,   355, -3382, -2884,  1702, -1987,
+     2089,  -875, -3780, -1168, -6099,  -295, -3006, -1305,
+     -722, -3149,  3263, -3600,  2396, -4053,  2645,  1537,
+    -4754, -1858,  3135,  4278, -1673, -3400, -3860,  5445,
+     3707, -5698,  2912, -1002, -2948,  2503, -5146, -3091,
+      -81,  4895,  2766, -1323, -3584, -3978,  2969,  1045,
+    -3529,  3434,  2963, -4388, -1260,  5332, -2033,  3998,
+     -334,  -435, -4337,  2381,  5184, -1200,  5728, -1351,
+     4978, -5291, -5681,  3477, -3748,  1426, -4654,  5084,
+    -5383,  1815, -2319,  2197,  5067,  3985, -5079, -3262,
+     4890,  3066,   -27, -2187,   922,  -441, -5860, -1326,
+     5086,  2847,  2920,  5241,  5791, -5559,  -420,  -773,
+    -4774,  5429, -2768,  -145, -5542,  1630,  1728,  -400,
+     -729,  3646, -2437,  2143, -5990,  1159,   949, -3621,
+     2545, -2166,  2302,   605, -4354, -3364,  1689, -5019,
+    -1693,  3009, -3553,  1022,    -9,  -243, -3789,  -147,
+    -3382,  -442, -2401, -3780, -3123,  1747,  -722, -1853,
+     -140,  2645,  2505,  5906, -1673,  4048,  2249,  2912,
+      576,  3963,   -81, -2881,  3284,  2969, -6093, -3710,
+    -1260, -1207, -3248, -4337, -3329,  4298,  4978,  2975,
+      563, -4654,  3532,  1003,  5067,  4437,    -3,   -27,
+    -1263,   -49,  5086,  3949,  3296,  -420, -1041, -3514,
+    -5542, -4714, -4143, -2437,   835,  6065,  2545, -2747,
+     4846,  1689,   192,  1321,    -9,  3136,  5191, -2401,
+    -2031, -5333,  -140,  3694, -5179,  2249, -5206,  5529,
+     3284,  5088,  4284, -3248, -2919, -3762,   563,  1479,
+       -1,    -3,  -421,  4080,  3296, -2780,  5195, -4143,
+     -347,  2925,  4846,  2525, -1381,  5191, -3818,  6118,
+    -5179, -5012, -2481,  4284,    64, -3656,    -1, -3051,
+    -2366,  5195,  -677, -5874, -1381, -2865,  2370, -2481,
+     2361,  1843, -2366,  1696,  1428,  2370,  -973, -1254,
+     1428, -4096,   493, -4096, -3636,  4938,  4885,  4885,
+    -1017, -6039,  -476, -3531,  3833, -6039,  2422,  -404,
+     4372,  2174,  2678,  3833,  3778, -4976, -3186, -5407,
+     -354,  -404,  4645, -1912, -4919,  -113, -1440,  2678,
+     3704, -2987,  -671,  3000, -1067, -4976,  1607, -5277,
+    -2305, -5042,   242,  -354,  4861, -5011,  2686,  3247,
+     2859, -1912, -1378,  5444,  1663,  1777,  1632, -1440,
+    -3763,  2566,  2178,  1544,   390, -2987, -6022,  1065,
+     4057,  3271,   545, -1067, -5101,  -875,  1153, -2884,
+    -5698, -5277, -1168,  -435,  -160, -3149,  3066,   242,
+     1537,  3646,  2399, -3400,  -442, -5011, -1002, -1207,
+    -1484,  4895, -4714,  2859,  1045,  5088,  3510,  5332,
+    -5012,  5444,  2381,   493, -2704, -5291, -1017,  1632,
+     5084,  2422,  4905,  3985,  3778,  2566, -2187,  4645,
+     4414,  2847,  3704,   390,  -773,  1607, -2126,  1630,
+     4861,  1065,  2143, -1378, -3915, -2166, -3763,   545,
+    -5019, -6022,  3016,  -243, -5101,  -875, -3780, -1168,
+    -4053,  2645,  1537, -5698,  2912, -1002, -3978,  2969,
+     1045,  -435, -4337,  2381,  1426, -4654,  5084,  3066,
+      -27, -2187, -5559,  -420,  -773,  3646, -2437,  2143,
+    -3364,  1689, -5019,  -442, -2401, -3780,  4048,  2249,
+     2912, -1207, -3248, -4337,  4437,    -3,   -27, -4714,
+    -4143, -2437,  3136,  5191, -2401,  5088,  4284, -3248,
+    -2780,  5195, -4143, -5012, -2481,  4284, -2865,  2370,
+    -2481, -4096,   493, -4096, -6039,  2422,  -404,  -404,
+     4645, -1912, -4976,  1607, -5277, -1912, -1378,  5444,
+    -2987, -6022,  1065, -5277, -1168,  -435, -5011, -1002,
+    -1207,  5444,  2381,   493,  2566, -2187,  4645,  1065,
+     2143, -1378,  -875, -3780, -1168,  -435, -4337,  2381,
+     3646, -2437,  2143, -1207, -3248, -4337,  5088,  4284,
+    -3248, -4096,   493, -4096, -1912, -1378,  5444,  5444,
+     2381,   493,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red1024_omega_powers_rev_ct_r4[1024] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,   493,
+     5444,  2381,  5444, -1912, -1378,  2381,  -435, -4337,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+     -404, -6039,  2422,  4645,  2566, -2187,  1065, -2987,
+    -6022,  2143,  3646, -2437, -5277, -4976,  1607, -1168,
+     -875, -3780, -1207, -5011, -1002, -3248,  5088,  4284,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+     -404, -6039,  2422,  4645,  2566, -2187,  1065, -2987,
+    -6022,  2143,  3646, -2437, -5277, -4976,  1607, -1168,
+     -875, -3780, -1207, -5011, -1002, -3248,  5088,  4284,
+    -6039,  4885, -1017,  2422,  1632,  5084,  2566, -1440,
+    -3763, -2187,  3066,   -27, -2987,  2678,  3704, -6022,
+      545, -5019,  3646,   242,  1537, -2437, -4714, -4143,
+    -4976,  3833,  3778,  1607,   390,  -773,  -875, -1067,
+    -5101, -3780,  -442, -2401, -5011,  -354,  4861, -1002,
+    -5698,  2912,  5088,  2859,  1045,  4284, -5012, -2481,
+     4885, -3636,  4938, -1017, -2704, -5291,  1632,  1663,
+     1777,  5084,  1426, -4654, -1440, -4919,  -113, -3763,
+    -3915, -2166,  3066,  -160, -3149,   -27,  4437,    -3,
+     2678,  4372,  2174,  3704,  4414,  2847,   545,  4057,
+     3271, -5019, -3364,  1689,   242, -2305, -5042,  1537,
+    -4053,  2645, -4714, -1484,  4895, -4143, -2780,  5195,
+     3833,  -476, -3531,  3778,  4905,  3985,   390,  2178,
+     1544,  -773, -5559,  -420, -1067,  -671,  3000, -5101,
+     3016,  -243,  -442,  2399, -3400, -2401,  3136,  5191,
+     -354, -3186, -5407,  4861, -2126,  1630, -5698,  1153,
+    -2884,  2912,  4048,  2249,  2859,  2686,  3247,  1045,
+    -3978,  2969, -5012,  3510,  5332, -2481, -2865,  2370,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+     -404, -6039,  2422,  4645,  2566, -2187,  1065, -2987,
+    -6022,  2143,  3646, -2437, -5277, -4976,  1607, -1168,
+     -875, -3780, -1207, -5011, -1002, -3248,  5088,  4284,
+    -6039,  4885, -1017,  2422,  1632,  5084,  2566, -1440,
+    -3763, -2187,  3066,   -27, -2987,  2678,  3704, -6022,
+      545, -5019,  3646,   242,  1537, -2437, -4714, -4143,
+    -4976,  3833,  3778,  1607,   390,  -773,  -875, -1067,
+    -5101, -3780,  -442, -2401, -5011,  -354,  4861, -1002,
+    -5698,  2912,  5088,  2859,  1045,  4284, -5012, -2481,
+     4885, -3636,  4938, -1017, -2704, -5291,  1632,  1663,
+     1777,  5084,  1426, -4654, -1440, -4919,  -113, -3763,
+    -3915, -2166,  3066,  -160, -3149,   -27,  4437,    -3,
+     2678,  4372,  2174,  3704,  4414,  2847,   545,  4057,
+     3271, -5019, -3364,  1689,   242, -2305, -5042,  1537,
+    -4053,  2645, -4714, -1484,  4895, -4143, -2780,  5195,
+     3833,  -476, -3531,  3778,  4905,  3985,   390,  2178,
+     1544,  -773, -5559,  -420, -1067,  -671,  3000, -5101,
+     3016,  -243,  -442,  2399, -3400, -2401,  3136,  5191,
+     -354, -3186, -5407,  4861, -2126,  1630, -5698,  1153,
+    -2884,  2912,  4048,  2249,  2859,  2686,  3247,  1045,
+    -3978,  2969, -5012,  3510,  5332, -2481, -2865,  2370,
+    -3636, -5828, -5023,  4938, -4591,  5728, -2704,  3328,
+    -5777, -5291, -1351,  4978,  1663, -2639,  4821,  1777,
+    -2625,   949,  1426, -2744, -3006, -4654,  2975,   563,
+    -4919, -1212,  1646,  -113,  3195, -5860, -3915, -3542,
+    -3504, -2166, -3621,  2545,  -160, -5736, -4134, -3149,
+    -1305,  -722,  4437,  4043, -5146,    -3,  1479,    -1,
+     4372,  -790,  -955,  2174,  1170, -2319,  4414, -3201,
+    -3014,  2847, -1326,  5086,  4057, -1062,  2294,  3271,
+    -4805, -3553, -3364, -3712,  3135,  1689, -2747,  4846,
+    -2305, -4255, -1177, -5042,  1635, -2768, -4053,   726,
+     4611,  2645, -1853,  -140, -1484, -4320,  1000,  4895,
+    -3091,   -81, -2780,  4896,  2963,  5195, -3051, -2366,
+     -476,   827, -5767, -3531,   953, -3748,  4905,  -118,
+    -2476,  3985,  2197,  5067,  2178,  5374, -2837,  1544,
+      130, -4354, -5559, -4452,  2396,  -420,  3949,  3296,
+     -671, -2468,  -339,  3000,   544,  5791,  3016,  -480,
+     2842,  -243,  1022,    -9,  2399,  4989,  5331, -3400,
+     4278, -1673,  3136,  4177, -3584,  5191,  2525, -1381,
+    -3186,  2731, -3932, -5407,  5911,  4890, -2126,  3459,
+     3637,  1630,  -145, -5542,  1153, -4231, -2548, -2884,
+      355, -3382,  4048, -1759,  3707,  2249,  3694, -5179,
+     2686, -2013, -3289,  3247, -3241,  -729, -3978, -5092,
+     2089,  2969, -2881,  3284,  3510, -5755,  4632,  5332,
+    -4388, -1260, -2865,  2426,  -334,  2370,  1696,  1428,
+    -5828, -1360,  3956, -5023, -5297,  6119, -4591, -2555,
+    -6122,  5728,  5184, -1200,  3328,  1594, -1962, -5777,
+     5106, -5961, -1351,  -168, -2692,  4978, -3329,  4298,
+    -2639,  -325, -1404,  4821,   948,  1146, -2625, -3728,
+     4049,   949, -5990,  1159, -2744,   652,  5766, -3006,
+    -6099,  -295,  2975, -4016, -4077,   563, -2919, -3762,
+    -1212,  1958, -4322,  1646,  2078,  1112,  3195,  1058,
+     4079, -5860,   922,  -441, -3542, -1319,  3150, -3504,
+      709,  4046, -3621, -4240, -3570,  2545,   835,  6065,
+    -5736,  5257, -3834, -4134, -5919, -4433, -1305,  3054,
+    -5486,  -722, -3123,  1747,  4043, -5782,  1566, -5146,
+    -2948,  2503,  1479, -2459,   683,    -1,    64, -3656,
+     -790,  2057, -5369,  -955, -3202, -4493,  1170, -1512,
+      350, -2319, -5383,  1815, -3201,  1583, -5942, -3014,
+    -2500,  1489, -1326,  1483,  5915,  5086, -1263,   -49,
+    -1062,  5868,  2738,  2294, -5735, -2655, -4805,   723,
+      174, -3553, -1693,  3009, -3712,  3315,  -426,  3135,
+    -4754, -1858, -2747, -3757, -1975,  4846,  -347,  2925,
+    -4255,   418,  3772, -1177, -5908,  -453,  1635, -1293,
+     4737, -2768, -4774,  5429,   726, -2767,  -156,  4611,
+    -3991, -3969, -1853, -5876, -2281,  -140, -2031, -5333,
+    -4320, -2882,  1805,  1000, -1954, -2051, -3091,  2447,
+    -6142,   -81,   576,  3963,  4896,  2908,  -218,  2963,
+    -3529,  3434, -3051, -4115, -3030, -2366,  2361,  1843,
+      827,  -975, -4212, -5767,  2844,  3438,   953,  1105,
+     -142, -3748, -5681,  3477,  -118,  1956,  5009, -2476,
+    -6008,  -885,  2197,   241,    58,  5067,  3532,  1003,
+     5374,  4782, -5886, -2837,  3029, -5594,   130,  -504,
+     4213, -4354,  2302,   605, -4452,  4624, -6077,  2396,
+     3263, -3600,  3949, -3602,  6068,  3296,  -421,  4080,
+    -2468,  3482,   787,  -339, -5468, -1010,   544, -3127,
+    -4169,  5791,  2920,  5241,  -480, -5057,  4698,  2842,
+     3445, -4780,  1022,  4912,  2049,    -9,   192,  1321,
+     4989, -3957, -2839,  5331,  2127,  -151,  4278,  -431,
+     1579, -1673,  2505,  5906,  4177,  3174,   -52, -3584,
+     2766, -1323,  2525, -6055,  3336, -1381,  -677, -5874,
+     2731,  5315, -4075, -3932, -4916,  4324,  5911,  2169,
+      522,  4890, -5079, -3262,  3459, -2344, -1278,  3637,
+    -1973, -5574,  -145,  1018, -5925, -5542, -1041, -3514,
+    -4231,  4749, -5537, -2548,  4789,  4467,   355,  4449,
+     5456, -3382, -3789,  -147, -1759, -4536,  1050,  3707,
+    -3860,  5445,  3694,  2683, -1190, -5179, -3818,  6118,
+    -2013,  3643,  5415, -3289, -5862,  6136, -3241, -4948,
+    -6137,  -729,  1728,  -400, -5092, -3565,  -654,  2089,
+     1702, -1987, -2881,   -56,  3199,  3284, -5206,  5529,
+    -5755,  3988,  -468,  4632,   316,   382, -4388, -5339,
+     5446, -1260, -6093, -3710,  2426, -3879,  1922,  -334,
+    -2033,  3998,  1696, -5435, -1359,  1428,  -973, -1254,
+};
+
+const int16_t ntt_red1024_omega_powers_rev_gs_r4[1024] = {
+        0, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,  -404,  4645, -1912,
+     1065,  2143, -1378, -5277, -1168,  -435, -1207, -3248,
+    -4337, -6039,  2422,  -404,  2566, -2187,  4645, -2987,
+    -6022,  1065,  3646, -2437,  2143, -4976,  1607, -5277,
+     -875, -3780, -1168, -5011, -1002, -1207,  5088,  4284,
+    -3248,  4885, -1017, -6039,  1632,  5084,  2422, -1440,
+    -3763,  2566,  3066,   -27, -2187,  2678,  3704, -2987,
+      545, -5019, -6022,   242,  1537,  3646, -4714, -4143,
+    -2437,  3833,  3778, -4976,   390,  -773,  1607, -1067,
+    -5101,  -875,  -442, -2401, -3780,  -354,  4861, -5011,
+    -5698,  2912, -1002,  2859,  1045,  5088, -5012, -2481,
+     4284, -3636,  4938,  4885, -2704, -5291, -1017,  1663,
+     1777,  1632,  1426, -4654,  5084, -4919,  -113, -1440,
+    -3915, -2166, -3763,  -160, -3149,  3066,  4437,    -3,
+      -27,  4372,  2174,  2678,  4414,  2847,  3704,  4057,
+     3271,   545, -3364,  1689, -5019, -2305, -5042,   242,
+    -4053,  2645,  1537, -1484,  4895, -4714, -2780,  5195,
+    -4143,  -476, -3531,  3833,  4905,  3985,  3778,  2178,
+     1544,   390, -5559,  -420,  -773,  -671,  3000, -1067,
+     3016,  -243, -5101,  2399, -3400,  -442,  3136,  5191,
+    -2401, -3186, -5407,  -354, -2126,  1630,  4861,  1153,
+    -2884, -5698,  4048,  2249,  2912,  2686,  3247,  2859,
+    -3978,  2969,  1045,  3510,  5332, -5012, -2865,  2370,
+    -2481, -5828, -5023, -3636, -4591,  5728,  4938,  3328,
+    -5777, -2704, -1351,  4978, -5291, -2639,  4821,  1663,
+    -2625,   949,  1777, -2744, -3006,  1426,  2975,   563,
+    -4654, -1212,  1646, -4919,  3195, -5860,  -113, -3542,
+    -3504, -3915, -3621,  2545, -2166, -5736, -4134,  -160,
+    -1305,  -722, -3149,  4043, -5146,  4437,  1479,    -1,
+       -3,  -790,  -955,  4372,  1170, -2319,  2174, -3201,
+    -3014,  4414, -1326,  5086,  2847, -1062,  2294,  4057,
+    -4805, -3553,  3271, -3712,  3135, -3364, -2747,  4846,
+     1689, -4255, -1177, -2305,  1635, -2768, -5042,   726,
+     4611, -4053, -1853,  -140,  2645, -4320,  1000, -1484,
+    -3091,   -81,  4895,  4896,  2963, -2780, -3051, -2366,
+     5195,   827, -5767,  -476,   953, -3748, -3531,  -118,
+    -2476,  4905,  2197,  5067,  3985,  5374, -2837,  2178,
+      130, -4354,  1544, -4452,  2396, -5559,  3949,  3296,
+     -420, -2468,  -339,  -671,   544,  5791,  3000,  -480,
+     2842,  3016,  1022,    -9,  -243,  4989,  5331,  2399,
+     4278, -1673, -3400,  4177, -3584,  3136,  2525, -1381,
+     5191,  2731, -3932, -3186,  5911,  4890, -5407,  3459,
+     3637, -2126,  -145, -5542,  1630, -4231, -2548,  1153,
+      355, -3382, -2884, -1759,  3707,  4048,  3694, -5179,
+     2249, -2013, -3289,  2686, -3241,  -729,  3247, -5092,
+     2089, -3978, -2881,  3284,  2969, -5755,  4632,  3510,
+    -4388, -1260,  5332,  2426,  -334, -2865,  1696,  1428,
+     2370, -1360,  3956, -5828, -5297,  6119, -5023, -2555,
+    -6122, -4591,  5184, -1200,  5728,  1594, -1962,  3328,
+     5106, -5961, -5777,  -168, -2692, -1351, -3329,  4298,
+     4978,  -325, -1404, -2639,   948,  1146,  4821, -3728,
+     4049, -2625, -5990,  1159,   949,   652,  5766, -2744,
+    -6099,  -295, -3006, -4016, -4077,  2975, -2919, -3762,
+      563,  1958, -4322, -1212,  2078,  1112,  1646,  1058,
+     4079,  3195,   922,  -441, -5860, -1319,  3150, -3542,
+      709,  4046, -3504, -4240, -3570, -3621,   835,  6065,
+     2545,  5257, -3834, -5736, -5919, -4433, -4134,  3054,
+    -5486, -1305, -3123,  1747,  -722, -5782,  1566,  4043,
+    -2948,  2503, -5146, -2459,   683,  1479,    64, -3656,
+       -1,  2057, -5369,  -790, -3202, -4493,  -955, -1512,
+      350,  1170, -5383,  1815, -2319,  1583, -5942, -3201,
+    -2500,  1489, -3014,  1483,  5915, -1326, -1263,   -49,
+     5086,  5868,  2738, -1062, -5735, -2655,  2294,   723,
+      174, -4805, -1693,  3009, -3553,  3315,  -426, -3712,
+    -4754, -1858,  3135, -3757, -1975, -2747,  -347,  2925,
+     4846,   418,  3772, -4255, -5908,  -453, -1177, -1293,
+     4737,  1635, -4774,  5429, -2768, -2767,  -156,   726,
+    -3991, -3969,  4611, -5876, -2281, -1853, -2031, -5333,
+     -140, -2882,  1805, -4320, -1954, -2051,  1000,  2447,
+    -6142, -3091,   576,  3963,   -81,  2908,  -218,  4896,
+    -3529,  3434,  2963, -4115, -3030, -3051,  2361,  1843,
+    -2366,  -975, -4212,   827,  2844,  3438, -5767,  1105,
+     -142,   953, -5681,  3477, -3748,  1956,  5009,  -118,
+    -6008,  -885, -2476,   241,    58,  2197,  3532,  1003,
+     5067,  4782, -5886,  5374,  3029, -5594, -2837,  -504,
+     4213,   130,  2302,   605, -4354,  4624, -6077, -4452,
+     3263, -3600,  2396, -3602,  6068,  3949,  -421,  4080,
+     3296,  3482,   787, -2468, -5468, -1010,  -339, -3127,
+    -4169,   544,  2920,  5241,  5791, -5057,  4698,  -480,
+     3445, -4780,  2842,  4912,  2049,  1022,   192,  1321,
+       -9, -3957, -2839,  4989,  2127,  -151,  5331,  -431,
+     1579,  4278,  2505,  5906, -1673,  3174,   -52,  4177,
+     2766, -1323, -3584, -6055,  3336,  2525,  -677, -5874,
+    -1381,  5315, -4075,  2731, -4916,  4324, -3932,  2169,
+      522,  5911, -5079, -3262,  4890, -2344, -1278,  3459,
+    -1973, -5574,  3637,  1018, -5925,  -145, -1041, -3514,
+    -5542,  4749, -5537, -4231,  4789,  4467, -2548,  4449,
+     5456,   355, -3789,  -147, -3382, -4536,  1050, -1759,
+    -3860,  5445,  3707,  2683, -1190,  3694, -3818,  6118,
+    -5179,  3643,  5415, -2013, -5862,  6136, -3289, -4948,
+    -6137, -3241,  1728,  -400,  -729, -3565,  -654, -5092,
+     1702, -1987,  2089,   -56,  3199, -2881, -5206,  5529,
+     3284,  3988,  -468, -5755,   316,   382,  4632, -5339,
+     5446, -4388, -6093, -3710, -1260, -3879,  1922,  2426,
+    -2033,  3998,  -334, -5435, -1359,  1696,  -973, -1254,
+     1428, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,  -404,  4645, -1912,
+     1065,  2143, -1378, -5277, -1168,  -435, -1207, -3248,
+    -4337, -6039,  2422,  -404,  2566, -2187,  4645, -2987,
+    -6022,  1065,  3646, -2437,  2143, -4976,  1607, -5277,
+     -875, -3780, -1168, -5011, -1002, -1207,  5088,  4284,
+    -3248,  4885, -1017, -6039,  1632,  5084,  2422, -1440,
+    -3763,  2566,  3066,   -27, -2187,  2678,  3704, -2987,
+      545, -5019, -6022,   242,  1537,  3646, -4714, -4143,
+    -2437,  3833,  3778, -4976,   390,  -773,  1607, -1067,
+    -5101,  -875,  -442, -2401, -3780,  -354,  4861, -5011,
+    -5698,  2912, -1002,  2859,  1045,  5088, -5012, -2481,
+     4284, -3636,  4938,  4885, -2704, -5291, -1017,  1663,
+     1777,  1632,  1426, -4654,  5084, -4919,  -113, -1440,
+    -3915, -2166, -3763,  -160, -3149,  3066,  4437,    -3,
+      -27,  4372,  2174,  2678,  4414,  2847,  3704,  4057,
+     3271,   545, -3364,  1689, -5019, -2305, -5042,   242,
+    -4053,  2645,  1537, -1484,  4895, -4714, -2780,  5195,
+    -4143,  -476, -3531,  3833,  4905,  3985,  3778,  2178,
+     1544,   390, -5559,  -420,  -773,  -671,  3000, -1067,
+     3016,  -243, -5101,  2399, -3400,  -442,  3136,  5191,
+    -2401, -3186, -5407,  -354, -2126,  1630,  4861,  1153,
+    -2884, -5698,  4048,  2249,  2912,  2686,  3247,  2859,
+    -3978,  2969,  1045,  3510,  5332, -5012, -2865,  2370,
+    -2481, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,  -404,  4645, -1912,
+     1065,  2143, -1378, -5277, -1168,  -435, -1207, -3248,
+    -4337, -6039,  2422,  -404,  2566, -2187,  4645, -2987,
+    -6022,  1065,  3646, -2437,  2143, -4976,  1607, -5277,
+     -875, -3780, -1168, -5011, -1002, -1207,  5088,  4284,
+    -3248, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_ct_r4[1024] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493, -2381,
+     4337,   435,  -493, -2381, -5444, -5444,  1378,  1912,
+    -4096, -4096,  -493,  3248, -4284, -5088,  4337,  3248,
+     1207, -2143,  2437, -3646, -2381,  4337,   435,  1168,
+     3780,   875,  1378, -2143, -1065, -4645,  2187, -2566,
+     -493, -2381, -5444,  1207,  1002,  5011,   435,  1168,
+     5277, -1065,  6022,  2987, -5444,  1378,  1912,  5277,
+    -1607,  4976,  1912, -4645,   404,   404, -2422,  6039,
+    -4096, -4096,  -493,  2481, -2370,  2865, -4284,  2481,
+     5012,  4143, -5195,  2780,  3248, -4284, -5088,  2401,
+    -5191, -3136,  2437,  4143,  4714,    27,     3, -4437,
+     4337,  3248,  1207, -2912, -2249, -4048,  3780,  2401,
+      442,  5019, -1689,  3364, -2143,  2437, -3646,   773,
+      420,  5559,  2187,    27, -3066, -5084,  4654, -1426,
+    -2381,  4337,   435, -1045, -2969,  3978,  1002, -2912,
+     5698, -1537, -2645,  4053,  1168,  3780,   875,  5101,
+      243, -3016,  6022,  5019,  -545,  3763,  2166,  3915,
+     1378, -2143, -1065, -4861, -1630,  2126, -1607,   773,
+     -390, -3704, -2847, -4414, -4645,  2187, -2566, -3778,
+    -3985, -4905, -2422, -5084, -1632,  1017,  5291,  2704,
+     -493, -2381, -5444,  5012, -5332, -3510, -5088, -1045,
+    -2859,  4714, -4895,  1484,  1207,  1002,  5011,   442,
+     3400, -2399, -3646, -1537,  -242, -3066,  3149,   160,
+      435,  1168,  5277,  5698,  2884, -1153,   875,  5101,
+     1067,  -545, -3271, -4057, -1065,  6022,  2987,  -390,
+    -1544, -2178, -2566,  3763,  1440, -1632, -1777, -1663,
+    -5444,  1378,  1912, -2859, -3247, -2686,  5011, -4861,
+      354,  -242,  5042,  2305,  5277, -1607,  4976,  1067,
+    -3000,   671,  2987, -3704, -2678,  1440,   113,  4919,
+     1912, -4645,   404,   354,  5407,  3186,  4976, -3778,
+    -3833, -2678, -2174, -4372,   404, -2422,  6039, -3833,
+     3531,   476,  6039,  1017, -4885, -4885, -4938,  3636,
+    -4096, -4096,  -493, -1428,  1254,   973, -2370, -1428,
+    -1696,  2366, -1843, -2361,  2481, -2370,  2865,  1381,
+     5874,   677, -5195,  2366,  3051,     1,  3656,   -64,
+    -4284,  2481,  5012,  5179, -6118,  3818, -5191,  1381,
+    -2525, -4846, -2925,   347,  4143, -5195,  2780, -3296,
+    -4080,   421,     3,     1, -1479,  -563,  3762,  2919,
+     3248, -4284, -5088, -3284, -5529,  5206, -2249,  5179,
+    -3694,   140,  5333,  2031,  2401, -5191, -3136,     9,
+    -1321,  -192, -1689, -4846,  2747, -2545, -6065,  -835,
+     2437,  4143,  4714,  5542,  3514,  1041,   420, -3296,
+    -3949, -5086,    49,  1263,    27,     3, -4437, -5067,
+    -1003, -3532,  4654,  -563, -2975, -4978, -4298,  3329,
+     4337,  3248,  1207,  1260,  3710,  6093, -2969, -3284,
+     2881,    81, -3963,  -576, -2912, -2249, -4048,  1673,
+    -5906, -2505, -2645,   140,  1853,   722, -1747,  3123,
+     3780,  2401,   442,  3382,   147,  3789,   243,     9,
+    -1022,  3553, -3009,  1693,  5019, -1689,  3364,  4354,
+     -605, -2302,  2166, -2545,  3621,  -949, -1159,  5990,
+    -2143,  2437, -3646,   729,   400, -1728, -1630,  5542,
+      145,  2768, -5429,  4774,   773,   420,  5559, -5791,
+    -5241, -2920, -2847, -5086,  1326,  5860,   441,  -922,
+     2187,    27, -3066, -4890,  3262,  5079, -3985, -5067,
+    -2197,  2319, -1815,  5383, -5084,  4654, -1426,  3748,
+    -3477,  5681,  5291, -4978,  1351, -5728,  1200, -5184,
+    -2381,  4337,   435,   334, -3998,  2033, -5332,  1260,
+     4388, -2963, -3434,  3529, -1045, -2969,  3978,  3584,
+     1323, -2766, -4895,    81,  3091,  5146, -2503,  2948,
+     1002, -2912,  5698, -3707, -5445,  3860,  3400,  1673,
+    -4278, -3135,  1858,  4754, -1537, -2645,  4053, -2396,
+     3600, -3263,  3149,   722,  1305,  3006,   295,  6099,
+     1168,  3780,   875, -2089,  1987, -1702,  2884,  3382,
+     -355, -4611,  3969,  3991,  5101,   243, -3016, -2842,
+     4780, -3445, -3271,  3553,  4805,  3504, -4046,  -709,
+     6022,  5019,  -545, -3637,  5574,  1973, -1544,  4354,
+     -130,  3014, -1489,  2500,  3763,  2166,  3915,  2476,
+      885,  6008, -1777,  -949,  2625,  5777,  5961, -5106,
+     1378, -2143, -1065, -4632,  -382,  -316, -3247,   729,
+     3241, -1000,  2051,  1954, -4861, -1630,  2126, -5331,
+      151, -2127,  5042,  2768, -1635,  4134,  4433,  5919,
+    -1607,   773,  -390,  2548, -4467, -4789, -3000, -5791,
+     -544, -2294,  2655,  5735, -3704, -2847, -4414,  2837,
+     5594, -3029,   113,  5860, -3195, -4821, -1146,  -948,
+    -4645,  2187, -2566,  3289, -6136,  5862,  5407, -4890,
+    -5911,  1177,   453,  5908, -3778, -3985, -4905,   339,
+     1010,  5468, -2174,  2319, -1170, -1646, -1112, -2078,
+    -2422, -5084, -1632,  3932, -4324,  4916,  3531,  3748,
+     -953,   955,  4493,  3202,  1017,  5291,  2704,  5767,
+    -3438, -2844, -4938, -5728,  4591,  5023, -6119,  5297,
+     -493, -2381, -5444, -1696,  1359,  5435,  2865,   334,
+    -2426,  3051,  3030,  4115,  5012, -5332, -3510, -2525,
+    -3336,  6055,  2780, -2963, -4896, -1479,  -683,  2459,
+    -5088, -1045, -2859, -3694,  1190, -2683, -3136,  3584,
+    -4177,  2747,  1975,  3757,  4714, -4895,  1484, -3949,
+    -6068,  3602, -4437,  5146, -4043, -2975,  4077,  4016,
+     1207,  1002,  5011,  2881, -3199,    56, -4048, -3707,
+     1759,  1853,  2281,  5876,   442,  3400, -2399, -1022,
+    -2049, -4912,  3364, -3135,  3712,  3621,  3570,  4240,
+    -3646, -1537,  -242,   145,  5925, -1018,  5559, -2396,
+     4452,  1326, -5915, -1483, -3066,  3149,   160, -2197,
+      -58,  -241, -1426,  3006,  2744,  1351,  2692,   168,
+      435,  1168,  5277,  4388, -5446,  5339,  3978, -2089,
+     5092,  3091,  6142, -2447,  5698,  2884, -1153, -4278,
+    -1579,   431,  4053, -4611,  -726,  1305,  5486, -3054,
+      875,  5101,  1067,  -355, -5456, -4449, -3016, -2842,
+      480,  4805,  -174,  -723,  -545, -3271, -4057,  -130,
+    -4213,   504,  3915,  3504,  3542,  2625, -4049,  3728,
+    -1065,  6022,  2987,  3241,  6137,  4948,  2126, -3637,
+    -3459, -1635, -4737,  1293,  -390, -1544, -2178,  -544,
+     4169,  3127, -4414,  3014,  3201, -3195, -4079, -1058,
+    -2566,  3763,  1440, -5911,  -522, -2169, -4905,  2476,
+      118, -1170,  -350,  1512, -1632, -1777, -1663,  -953,
+      142, -1105,  2704,  5777, -3328,  4591,  6122,  2555,
+    -5444,  1378,  1912, -2426, -1922,  3879, -3510, -4632,
+     5755, -4896,   218, -2908, -2859, -3247, -2686, -4177,
+       52, -3174,  1484, -1000,  4320, -4043, -1566,  5782,
+     5011, -4861,   354,  1759, -1050,  4536, -2399, -5331,
+    -4989,  3712,   426, -3315,  -242,  5042,  2305,  4452,
+     6077, -4624,   160,  4134,  5736,  2744, -5766,  -652,
+     5277, -1607,  4976,  5092,   654,  3565, -1153,  2548,
+     4231,  -726,   156,  2767,  1067, -3000,   671,   480,
+    -4698,  5057, -4057, -2294,  1062,  3542, -3150,  1319,
+     2987, -3704, -2678, -3459,  1278,  2344, -2178,  2837,
+    -5374,  3201,  5942, -1583,  1440,   113,  4919,   118,
+    -5009, -1956, -1663, -4821,  2639, -3328,  1962, -1594,
+     1912, -4645,   404,  5755,   468, -3988, -2686,  3289,
+     2013,  4320, -1805,  2882,   354,  5407,  3186, -4989,
+     2839,  3957,  2305,  1177,  4255,  5736,  3834, -5257,
+     4976, -3778, -3833,  4231,  5537, -4749,   671,   339,
+     2468,  1062, -2738, -5868, -2678, -2174, -4372, -5374,
+     5886, -4782,  4919, -1646,  1212,  2639,  1404,   325,
+      404, -2422,  6039,  2013, -5415, -3643,  3186,  3932,
+    -2731,  4255, -3772,  -418, -3833,  3531,   476,  2468,
+     -787, -3482, -4372,   955,   790,  1212,  4322, -1958,
+     6039,  1017, -4885, -2731,  4075, -5315,   476,  5767,
+     -827,   790,  5369, -2057, -4885, -4938,  3636,  -827,
+     4212,   975,  3636,  5023,  5828,  5828, -3956,  1360,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_gs_r4[1024] = {
+        0, -4096,  -493, -4096,  1254,   973, -1428, -1428,
+    -1696, -2370, -1843, -2361,  2366, -2370,  2865,  2481,
+     5874,   677,  1381,  2366,  3051, -5195,  3656,   -64,
+        1,  2481,  5012, -4284, -6118,  3818,  5179,  1381,
+    -2525, -5191, -2925,   347, -4846, -5195,  2780,  4143,
+    -4080,   421, -3296,     1, -1479,     3,  3762,  2919,
+     -563, -4284, -5088,  3248, -5529,  5206, -3284,  5179,
+    -3694, -2249,  5333,  2031,   140, -5191, -3136,  2401,
+    -1321,  -192,     9, -4846,  2747, -1689, -6065,  -835,
+    -2545,  4143,  4714,  2437,  3514,  1041,  5542, -3296,
+    -3949,   420,    49,  1263, -5086,     3, -4437,    27,
+    -1003, -3532, -5067,  -563, -2975,  4654, -4298,  3329,
+    -4978,  3248,  1207,  4337,  3710,  6093,  1260, -3284,
+     2881, -2969, -3963,  -576,    81, -2249, -4048, -2912,
+    -5906, -2505,  1673,   140,  1853, -2645, -1747,  3123,
+      722,  2401,   442,  3780,   147,  3789,  3382,     9,
+    -1022,   243, -3009,  1693,  3553, -1689,  3364,  5019,
+     -605, -2302,  4354, -2545,  3621,  2166, -1159,  5990,
+     -949,  2437, -3646, -2143,   400, -1728,   729,  5542,
+      145, -1630, -5429,  4774,  2768,   420,  5559,   773,
+    -5241, -2920, -5791, -5086,  1326, -2847,   441,  -922,
+     5860,    27, -3066,  2187,  3262,  5079, -4890, -5067,
+    -2197, -3985, -1815,  5383,  2319,  4654, -1426, -5084,
+    -3477,  5681,  3748, -4978,  1351,  5291,  1200, -5184,
+    -5728,  4337,   435, -2381, -3998,  2033,   334,  1260,
+     4388, -5332, -3434,  3529, -2963, -2969,  3978, -1045,
+     1323, -2766,  3584,    81,  3091, -4895, -2503,  2948,
+     5146, -2912,  5698,  1002, -5445,  3860, -3707,  1673,
+    -4278,  3400,  1858,  4754, -3135, -2645,  4053, -1537,
+     3600, -3263, -2396,   722,  1305,  3149,   295,  6099,
+     3006,  3780,   875,  1168,  1987, -1702, -2089,  3382,
+     -355,  2884,  3969,  3991, -4611,   243, -3016,  5101,
+     4780, -3445, -2842,  3553,  4805, -3271, -4046,  -709,
+     3504,  5019,  -545,  6022,  5574,  1973, -3637,  4354,
+     -130, -1544, -1489,  2500,  3014,  2166,  3915,  3763,
+      885,  6008,  2476,  -949,  2625, -1777,  5961, -5106,
+     5777, -2143, -1065,  1378,  -382,  -316, -4632,   729,
+     3241, -3247,  2051,  1954, -1000, -1630,  2126, -4861,
+      151, -2127, -5331,  2768, -1635,  5042,  4433,  5919,
+     4134,   773,  -390, -1607, -4467, -4789,  2548, -5791,
+     -544, -3000,  2655,  5735, -2294, -2847, -4414, -3704,
+     5594, -3029,  2837,  5860, -3195,   113, -1146,  -948,
+    -4821,  2187, -2566, -4645, -6136,  5862,  3289, -4890,
+    -5911,  5407,   453,  5908,  1177, -3985, -4905, -3778,
+     1010,  5468,   339,  2319, -1170, -2174, -1112, -2078,
+    -1646, -5084, -1632, -2422, -4324,  4916,  3932,  3748,
+     -953,  3531,  4493,  3202,   955,  5291,  2704,  1017,
+    -3438, -2844,  5767, -5728,  4591, -4938, -6119,  5297,
+     5023, -2381, -5444,  -493,  1359,  5435, -1696,   334,
+    -2426,  2865,  3030,  4115,  3051, -5332, -3510,  5012,
+    -3336,  6055, -2525, -2963, -4896,  2780,  -683,  2459,
+    -1479, -1045, -2859, -5088,  1190, -2683, -3694,  3584,
+    -4177, -3136,  1975,  3757,  2747, -4895,  1484,  4714,
+    -6068,  3602, -3949,  5146, -4043, -4437,  4077,  4016,
+    -2975,  1002,  5011,  1207, -3199,    56,  2881, -3707,
+     1759, -4048,  2281,  5876,  1853,  3400, -2399,   442,
+    -2049, -4912, -1022, -3135,  3712,  3364,  3570,  4240,
+     3621, -1537,  -242, -3646,  5925, -1018,   145, -2396,
+     4452,  5559, -5915, -1483,  1326,  3149,   160, -3066,
+      -58,  -241, -2197,  3006,  2744, -1426,  2692,   168,
+     1351,  1168,  5277,   435, -5446,  5339,  4388, -2089,
+     5092,  3978,  6142, -2447,  3091,  2884, -1153,  5698,
+    -1579,   431, -4278, -4611,  -726,  4053,  5486, -3054,
+     1305,  5101,  1067,   875, -5456, -4449,  -355, -2842,
+      480, -3016,  -174,  -723,  4805, -3271, -4057,  -545,
+    -4213,   504,  -130,  3504,  3542,  3915, -4049,  3728,
+     2625,  6022,  2987, -1065,  6137,  4948,  3241, -3637,
+    -3459,  2126, -4737,  1293, -1635, -1544, -2178,  -390,
+     4169,  3127,  -544,  3014,  3201, -4414, -4079, -1058,
+    -3195,  3763,  1440, -2566,  -522, -2169, -5911,  2476,
+      118, -4905,  -350,  1512, -1170, -1777, -1663, -1632,
+      142, -1105,  -953,  5777, -3328,  2704,  6122,  2555,
+     4591,  1378,  1912, -5444, -1922,  3879, -2426, -4632,
+     5755, -3510,   218, -2908, -4896, -3247, -2686, -2859,
+       52, -3174, -4177, -1000,  4320,  1484, -1566,  5782,
+    -4043, -4861,   354,  5011, -1050,  4536,  1759, -5331,
+    -4989, -2399,   426, -3315,  3712,  5042,  2305,  -242,
+     6077, -4624,  4452,  4134,  5736,   160, -5766,  -652,
+     2744, -1607,  4976,  5277,   654,  3565,  5092,  2548,
+     4231, -1153,   156,  2767,  -726, -3000,   671,  1067,
+    -4698,  5057,   480, -2294,  1062, -4057, -3150,  1319,
+     3542, -3704, -2678,  2987,  1278,  2344, -3459,  2837,
+    -5374, -2178,  5942, -1583,  3201,   113,  4919,  1440,
+    -5009, -1956,   118, -4821,  2639, -1663,  1962, -1594,
+    -3328, -4645,   404,  1912,   468, -3988,  5755,  3289,
+     2013, -2686, -1805,  2882,  4320,  5407,  3186,   354,
+     2839,  3957, -4989,  1177,  4255,  2305,  3834, -5257,
+     5736, -3778, -3833,  4976,  5537, -4749,  4231,   339,
+     2468,   671, -2738, -5868,  1062, -2174, -4372, -2678,
+     5886, -4782, -5374, -1646,  1212,  4919,  1404,   325,
+     2639, -2422,  6039,   404, -5415, -3643,  2013,  3932,
+    -2731,  3186, -3772,  -418,  4255,  3531,   476, -3833,
+     -787, -3482,  2468,   955,   790, -4372,  4322, -1958,
+     1212,  1017, -4885,  6039,  4075, -5315, -2731,  5767,
+     -827,   476,  5369, -2057,   790, -4938,  3636, -4885,
+     4212,   975,  -827,  5023,  5828,  3636, -3956,  1360,
+     5828, -4096,  -493, -4096, -2370,  2865,  2481,  2481,
+     5012, -4284, -5195,  2780,  4143, -4284, -5088,  3248,
+    -5191, -3136,  2401,  4143,  4714,  2437,     3, -4437,
+       27,  3248,  1207,  4337, -2249, -4048, -2912,  2401,
+      442,  3780, -1689,  3364,  5019,  2437, -3646, -2143,
+      420,  5559,   773,    27, -3066,  2187,  4654, -1426,
+    -5084,  4337,   435, -2381, -2969,  3978, -1045, -2912,
+     5698,  1002, -2645,  4053, -1537,  3780,   875,  1168,
+      243, -3016,  5101,  5019,  -545,  6022,  2166,  3915,
+     3763, -2143, -1065,  1378, -1630,  2126, -4861,   773,
+     -390, -1607, -2847, -4414, -3704,  2187, -2566, -4645,
+    -3985, -4905, -3778, -5084, -1632, -2422,  5291,  2704,
+     1017, -2381, -5444,  -493, -5332, -3510,  5012, -1045,
+    -2859, -5088, -4895,  1484,  4714,  1002,  5011,  1207,
+     3400, -2399,   442, -1537,  -242, -3646,  3149,   160,
+    -3066,  1168,  5277,   435,  2884, -1153,  5698,  5101,
+     1067,   875, -3271, -4057,  -545,  6022,  2987, -1065,
+    -1544, -2178,  -390,  3763,  1440, -2566, -1777, -1663,
+    -1632,  1378,  1912, -5444, -3247, -2686, -2859, -4861,
+      354,  5011,  5042,  2305,  -242, -1607,  4976,  5277,
+    -3000,   671,  1067, -3704, -2678,  2987,   113,  4919,
+     1440, -4645,   404,  1912,  5407,  3186,   354, -3778,
+    -3833,  4976, -2174, -4372, -2678, -2422,  6039,   404,
+     3531,   476, -3833,  1017, -4885,  6039, -4938,  3636,
+    -4885, -4096,  -493, -4096, -4284, -5088,  3248,  3248,
+     1207,  4337,  2437, -3646, -2143,  4337,   435, -2381,
+     3780,   875,  1168, -2143, -1065,  1378,  2187, -2566,
+    -4645, -2381, -5444,  -493,  1002,  5011,  1207,  1168,
+     5277,   435,  6022,  2987, -1065,  1378,  1912, -5444,
+    -1607,  4976,  5277, -4645,   404,  1912, -2422,  6039,
+      404, -4096,  -493, -4096,  4337,   435, -2381, -2381,
+    -5444,  -493,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_rev_ct_r4[1024] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493,  -493,
+    -2381, -5444, -2381,  4337,   435, -5444,  1378,  1912,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+     3248, -4284, -5088,  1207,  1002,  5011,  1168,  3780,
+      875,  5277, -1607,  4976, -2143,  2437, -3646, -1065,
+     6022,  2987, -4645,  2187, -2566,   404, -2422,  6039,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+     3248, -4284, -5088,  1207,  1002,  5011,  1168,  3780,
+      875,  5277, -1607,  4976, -2143,  2437, -3646, -1065,
+     6022,  2987, -4645,  2187, -2566,   404, -2422,  6039,
+    -4284,  2481,  5012, -5088, -1045, -2859,  1002, -2912,
+     5698,  5011, -4861,   354,  3780,  2401,   442,   875,
+     5101,  1067, -1607,   773,  -390,  4976, -3778, -3833,
+     2437,  4143,  4714, -3646, -1537,  -242,  6022,  5019,
+     -545,  2987, -3704, -2678,  2187,    27, -3066, -2566,
+     3763,  1440, -2422, -5084, -1632,  6039,  1017, -4885,
+     2481, -2370,  2865,  5012, -5332, -3510, -1045, -2969,
+     3978, -2859, -3247, -2686, -2912, -2249, -4048,  5698,
+     2884, -1153, -4861, -1630,  2126,   354,  5407,  3186,
+     2401, -5191, -3136,   442,  3400, -2399,  5101,   243,
+    -3016,  1067, -3000,   671,   773,   420,  5559,  -390,
+    -1544, -2178, -3778, -3985, -4905, -3833,  3531,   476,
+     4143, -5195,  2780,  4714, -4895,  1484, -1537, -2645,
+     4053,  -242,  5042,  2305,  5019, -1689,  3364,  -545,
+    -3271, -4057, -3704, -2847, -4414, -2678, -2174, -4372,
+       27,     3, -4437, -3066,  3149,   160,  3763,  2166,
+     3915,  1440,   113,  4919, -5084,  4654, -1426, -1632,
+    -1777, -1663,  1017,  5291,  2704, -4885, -4938,  3636,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+     3248, -4284, -5088,  1207,  1002,  5011,  1168,  3780,
+      875,  5277, -1607,  4976, -2143,  2437, -3646, -1065,
+     6022,  2987, -4645,  2187, -2566,   404, -2422,  6039,
+    -4284,  2481,  5012, -5088, -1045, -2859,  1002, -2912,
+     5698,  5011, -4861,   354,  3780,  2401,   442,   875,
+     5101,  1067, -1607,   773,  -390,  4976, -3778, -3833,
+     2437,  4143,  4714, -3646, -1537,  -242,  6022,  5019,
+     -545,  2987, -3704, -2678,  2187,    27, -3066, -2566,
+     3763,  1440, -2422, -5084, -1632,  6039,  1017, -4885,
+     2481, -2370,  2865,  5012, -5332, -3510, -1045, -2969,
+     3978, -2859, -3247, -2686, -2912, -2249, -4048,  5698,
+     2884, -1153, -4861, -1630,  2126,   354,  5407,  3186,
+     2401, -5191, -3136,   442,  3400, -2399,  5101,   243,
+    -3016,  1067, -3000,   671,   773,   420,  5559,  -390,
+    -1544, -2178, -3778, -3985, -4905, -3833,  3531,   476,
+     4143, -5195,  2780,  4714, -4895,  1484, -1537, -2645,
+     4053,  -242,  5042,  2305,  5019, -1689,  3364,  -545,
+    -3271, -4057, -3704, -2847, -4414, -2678, -2174, -4372,
+       27,     3, -4437, -3066,  3149,   160,  3763,  2166,
+     3915,  1440,   113,  4919, -5084,  4654, -1426, -1632,
+    -1777, -1663,  1017,  5291,  2704, -4885, -4938,  3636,
+    -2370, -1428, -1696,  2865,   334, -2426, -5332,  1260,
+     4388, -3510, -4632,  5755, -2969, -3284,  2881,  3978,
+    -2089,  5092, -3247,   729,  3241, -2686,  3289,  2013,
+    -2249,  5179, -3694, -4048, -3707,  1759,  2884,  3382,
+     -355, -1153,  2548,  4231, -1630,  5542,   145,  2126,
+    -3637, -3459,  5407, -4890, -5911,  3186,  3932, -2731,
+    -5191,  1381, -2525, -3136,  3584, -4177,  3400,  1673,
+    -4278, -2399, -5331, -4989,   243,     9, -1022, -3016,
+    -2842,   480, -3000, -5791,  -544,   671,   339,  2468,
+      420, -3296, -3949,  5559, -2396,  4452, -1544,  4354,
+     -130, -2178,  2837, -5374, -3985, -5067, -2197, -4905,
+     2476,   118,  3531,  3748,  -953,   476,  5767,  -827,
+    -5195,  2366,  3051,  2780, -2963, -4896, -4895,    81,
+     3091,  1484, -1000,  4320, -2645,   140,  1853,  4053,
+    -4611,  -726,  5042,  2768, -1635,  2305,  1177,  4255,
+    -1689, -4846,  2747,  3364, -3135,  3712, -3271,  3553,
+     4805, -4057, -2294,  1062, -2847, -5086,  1326, -4414,
+     3014,  3201, -2174,  2319, -1170, -4372,   955,   790,
+        3,     1, -1479, -4437,  5146, -4043,  3149,   722,
+     1305,   160,  4134,  5736,  2166, -2545,  3621,  3915,
+     3504,  3542,   113,  5860, -3195,  4919, -1646,  1212,
+     4654,  -563, -2975, -1426,  3006,  2744, -1777,  -949,
+     2625, -1663, -4821,  2639,  5291, -4978,  1351,  2704,
+     5777, -3328, -4938, -5728,  4591,  3636,  5023,  5828,
+    -1428,  1254,   973, -1696,  1359,  5435,   334, -3998,
+     2033, -2426, -1922,  3879,  1260,  3710,  6093,  4388,
+    -5446,  5339, -4632,  -382,  -316,  5755,   468, -3988,
+    -3284, -5529,  5206,  2881, -3199,    56, -2089,  1987,
+    -1702,  5092,   654,  3565,   729,   400, -1728,  3241,
+     6137,  4948,  3289, -6136,  5862,  2013, -5415, -3643,
+     5179, -6118,  3818, -3694,  1190, -2683, -3707, -5445,
+     3860,  1759, -1050,  4536,  3382,   147,  3789,  -355,
+    -5456, -4449,  2548, -4467, -4789,  4231,  5537, -4749,
+     5542,  3514,  1041,   145,  5925, -1018, -3637,  5574,
+     1973, -3459,  1278,  2344, -4890,  3262,  5079, -5911,
+     -522, -2169,  3932, -4324,  4916, -2731,  4075, -5315,
+     1381,  5874,   677, -2525, -3336,  6055,  3584,  1323,
+    -2766, -4177,    52, -3174,  1673, -5906, -2505, -4278,
+    -1579,   431, -5331,   151, -2127, -4989,  2839,  3957,
+        9, -1321,  -192, -1022, -2049, -4912, -2842,  4780,
+    -3445,   480, -4698,  5057, -5791, -5241, -2920,  -544,
+     4169,  3127,   339,  1010,  5468,  2468,  -787, -3482,
+    -3296, -4080,   421, -3949, -6068,  3602, -2396,  3600,
+    -3263,  4452,  6077, -4624,  4354,  -605, -2302,  -130,
+    -4213,   504,  2837,  5594, -3029, -5374,  5886, -4782,
+    -5067, -1003, -3532, -2197,   -58,  -241,  2476,   885,
+     6008,   118, -5009, -1956,  3748, -3477,  5681,  -953,
+      142, -1105,  5767, -3438, -2844,  -827,  4212,   975,
+     2366, -1843, -2361,  3051,  3030,  4115, -2963, -3434,
+     3529, -4896,   218, -2908,    81, -3963,  -576,  3091,
+     6142, -2447, -1000,  2051,  1954,  4320, -1805,  2882,
+      140,  5333,  2031,  1853,  2281,  5876, -4611,  3969,
+     3991,  -726,   156,  2767,  2768, -5429,  4774, -1635,
+    -4737,  1293,  1177,   453,  5908,  4255, -3772,  -418,
+    -4846, -2925,   347,  2747,  1975,  3757, -3135,  1858,
+     4754,  3712,   426, -3315,  3553, -3009,  1693,  4805,
+     -174,  -723, -2294,  2655,  5735,  1062, -2738, -5868,
+    -5086,    49,  1263,  1326, -5915, -1483,  3014, -1489,
+     2500,  3201,  5942, -1583,  2319, -1815,  5383, -1170,
+     -350,  1512,   955,  4493,  3202,   790,  5369, -2057,
+        1,  3656,   -64, -1479,  -683,  2459,  5146, -2503,
+     2948, -4043, -1566,  5782,   722, -1747,  3123,  1305,
+     5486, -3054,  4134,  4433,  5919,  5736,  3834, -5257,
+    -2545, -6065,  -835,  3621,  3570,  4240,  3504, -4046,
+     -709,  3542, -3150,  1319,  5860,   441,  -922, -3195,
+    -4079, -1058, -1646, -1112, -2078,  1212,  4322, -1958,
+     -563,  3762,  2919, -2975,  4077,  4016,  3006,   295,
+     6099,  2744, -5766,  -652,  -949, -1159,  5990,  2625,
+    -4049,  3728, -4821, -1146,  -948,  2639,  1404,   325,
+    -4978, -4298,  3329,  1351,  2692,   168,  5777,  5961,
+    -5106, -3328,  1962, -1594, -5728,  1200, -5184,  4591,
+     6122,  2555,  5023, -6119,  5297,  5828, -3956,  1360,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_rev_gs_r4[1024] = {
+        0, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444,  3248,  1207,  4337,
+     1168,  5277,   435, -2143, -1065,  1378, -4645,   404,
+     1912, -4284, -5088,  3248,  1002,  5011,  1207,  3780,
+      875,  1168, -1607,  4976,  5277,  2437, -3646, -2143,
+     6022,  2987, -1065,  2187, -2566, -4645, -2422,  6039,
+      404,  2481,  5012, -4284, -1045, -2859, -5088, -2912,
+     5698,  1002, -4861,   354,  5011,  2401,   442,  3780,
+     5101,  1067,   875,   773,  -390, -1607, -3778, -3833,
+     4976,  4143,  4714,  2437, -1537,  -242, -3646,  5019,
+     -545,  6022, -3704, -2678,  2987,    27, -3066,  2187,
+     3763,  1440, -2566, -5084, -1632, -2422,  1017, -4885,
+     6039, -2370,  2865,  2481, -5332, -3510,  5012, -2969,
+     3978, -1045, -3247, -2686, -2859, -2249, -4048, -2912,
+     2884, -1153,  5698, -1630,  2126, -4861,  5407,  3186,
+      354, -5191, -3136,  2401,  3400, -2399,   442,   243,
+    -3016,  5101, -3000,   671,  1067,   420,  5559,   773,
+    -1544, -2178,  -390, -3985, -4905, -3778,  3531,   476,
+    -3833, -5195,  2780,  4143, -4895,  1484,  4714, -2645,
+     4053, -1537,  5042,  2305,  -242, -1689,  3364,  5019,
+    -3271, -4057,  -545, -2847, -4414, -3704, -2174, -4372,
+    -2678,     3, -4437,    27,  3149,   160, -3066,  2166,
+     3915,  3763,   113,  4919,  1440,  4654, -1426, -5084,
+    -1777, -1663, -1632,  5291,  2704,  1017, -4938,  3636,
+    -4885, -1428, -1696, -2370,   334, -2426,  2865,  1260,
+     4388, -5332, -4632,  5755, -3510, -3284,  2881, -2969,
+    -2089,  5092,  3978,   729,  3241, -3247,  3289,  2013,
+    -2686,  5179, -3694, -2249, -3707,  1759, -4048,  3382,
+     -355,  2884,  2548,  4231, -1153,  5542,   145, -1630,
+    -3637, -3459,  2126, -4890, -5911,  5407,  3932, -2731,
+     3186,  1381, -2525, -5191,  3584, -4177, -3136,  1673,
+    -4278,  3400, -5331, -4989, -2399,     9, -1022,   243,
+    -2842,   480, -3016, -5791,  -544, -3000,   339,  2468,
+      671, -3296, -3949,   420, -2396,  4452,  5559,  4354,
+     -130, -1544,  2837, -5374, -2178, -5067, -2197, -3985,
+     2476,   118, -4905,  3748,  -953,  3531,  5767,  -827,
+      476,  2366,  3051, -5195, -2963, -4896,  2780,    81,
+     3091, -4895, -1000,  4320,  1484,   140,  1853, -2645,
+    -4611,  -726,  4053,  2768, -1635,  5042,  1177,  4255,
+     2305, -4846,  2747, -1689, -3135,  3712,  3364,  3553,
+     4805, -3271, -2294,  1062, -4057, -5086,  1326, -2847,
+     3014,  3201, -4414,  2319, -1170, -2174,   955,   790,
+    -4372,     1, -1479,     3,  5146, -4043, -4437,   722,
+     1305,  3149,  4134,  5736,   160, -2545,  3621,  2166,
+     3504,  3542,  3915,  5860, -3195,   113, -1646,  1212,
+     4919,  -563, -2975,  4654,  3006,  2744, -1426,  -949,
+     2625, -1777, -4821,  2639, -1663, -4978,  1351,  5291,
+     5777, -3328,  2704, -5728,  4591, -4938,  5023,  5828,
+     3636,  1254,   973, -1428,  1359,  5435, -1696, -3998,
+     2033,   334, -1922,  3879, -2426,  3710,  6093,  1260,
+    -5446,  5339,  4388,  -382,  -316, -4632,   468, -3988,
+     5755, -5529,  5206, -3284, -3199,    56,  2881,  1987,
+    -1702, -2089,   654,  3565,  5092,   400, -1728,   729,
+     6137,  4948,  3241, -6136,  5862,  3289, -5415, -3643,
+     2013, -6118,  3818,  5179,  1190, -2683, -3694, -5445,
+     3860, -3707, -1050,  4536,  1759,   147,  3789,  3382,
+    -5456, -4449,  -355, -4467, -4789,  2548,  5537, -4749,
+     4231,  3514,  1041,  5542,  5925, -1018,   145,  5574,
+     1973, -3637,  1278,  2344, -3459,  3262,  5079, -4890,
+     -522, -2169, -5911, -4324,  4916,  3932,  4075, -5315,
+    -2731,  5874,   677,  1381, -3336,  6055, -2525,  1323,
+    -2766,  3584,    52, -3174, -4177, -5906, -2505,  1673,
+    -1579,   431, -4278,   151, -2127, -5331,  2839,  3957,
+    -4989, -1321,  -192,     9, -2049, -4912, -1022,  4780,
+    -3445, -2842, -4698,  5057,   480, -5241, -2920, -5791,
+     4169,  3127,  -544,  1010,  5468,   339,  -787, -3482,
+     2468, -4080,   421, -3296, -6068,  3602, -3949,  3600,
+    -3263, -2396,  6077, -4624,  4452,  -605, -2302,  4354,
+    -4213,   504,  -130,  5594, -3029,  2837,  5886, -4782,
+    -5374, -1003, -3532, -5067,   -58,  -241, -2197,   885,
+     6008,  2476, -5009, -1956,   118, -3477,  5681,  3748,
+      142, -1105,  -953, -3438, -2844,  5767,  4212,   975,
+     -827, -1843, -2361,  2366,  3030,  4115,  3051, -3434,
+     3529, -2963,   218, -2908, -4896, -3963,  -576,    81,
+     6142, -2447,  3091,  2051,  1954, -1000, -1805,  2882,
+     4320,  5333,  2031,   140,  2281,  5876,  1853,  3969,
+     3991, -4611,   156,  2767,  -726, -5429,  4774,  2768,
+    -4737,  1293, -1635,   453,  5908,  1177, -3772,  -418,
+     4255, -2925,   347, -4846,  1975,  3757,  2747,  1858,
+     4754, -3135,   426, -3315,  3712, -3009,  1693,  3553,
+     -174,  -723,  4805,  2655,  5735, -2294, -2738, -5868,
+     1062,    49,  1263, -5086, -5915, -1483,  1326, -1489,
+     2500,  3014,  5942, -1583,  3201, -1815,  5383,  2319,
+     -350,  1512, -1170,  4493,  3202,   955,  5369, -2057,
+      790,  3656,   -64,     1,  -683,  2459, -1479, -2503,
+     2948,  5146, -1566,  5782, -4043, -1747,  3123,   722,
+     5486, -3054,  1305,  4433,  5919,  4134,  3834, -5257,
+     5736, -6065,  -835, -2545,  3570,  4240,  3621, -4046,
+     -709,  3504, -3150,  1319,  3542,   441,  -922,  5860,
+    -4079, -1058, -3195, -1112, -2078, -1646,  4322, -1958,
+     1212,  3762,  2919,  -563,  4077,  4016, -2975,   295,
+     6099,  3006, -5766,  -652,  2744, -1159,  5990,  -949,
+    -4049,  3728,  2625, -1146,  -948, -4821,  1404,   325,
+     2639, -4298,  3329, -4978,  2692,   168,  1351,  5961,
+    -5106,  5777,  1962, -1594, -3328,  1200, -5184, -5728,
+     6122,  2555,  4591, -6119,  5297,  5023, -3956,  1360,
+     5828, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444,  3248,  1207,  4337,
+     1168,  5277,   435, -2143, -1065,  1378, -4645,   404,
+     1912, -4284, -5088,  3248,  1002,  5011,  1207,  3780,
+      875,  1168, -1607,  4976,  5277,  2437, -3646, -2143,
+     6022,  2987, -1065,  2187, -2566, -4645, -2422,  6039,
+      404,  2481,  5012, -4284, -1045, -2859, -5088, -2912,
+     5698,  1002, -4861,   354,  5011,  2401,   442,  3780,
+     5101,  1067,   875,   773,  -390, -1607, -3778, -3833,
+     4976,  4143,  4714,  2437, -1537,  -242, -3646,  5019,
+     -545,  6022, -3704, -2678,  2987,    27, -3066,  2187,
+     3763,  1440, -2566, -5084, -1632, -2422,  1017, -4885,
+     6039, -2370,  2865,  2481, -5332, -3510,  5012, -2969,
+     3978, -1045, -3247, -2686, -2859, -2249, -4048, -2912,
+     2884, -1153,  5698, -1630,  2126, -4861,  5407,  3186,
+      354, -5191, -3136,  2401,  3400, -2399,   442,   243,
+    -3016,  5101, -3000,   671,  1067,   420,  5559,   773,
+    -1544, -2178,  -390, -3985, -4905, -3778,  3531,   476,
+    -3833, -5195,  2780,  4143, -4895,  1484,  4714, -2645,
+     4053, -1537,  5042,  2305,  -242, -1689,  3364,  5019,
+    -3271, -4057,  -545, -2847, -4414, -3704, -2174, -4372,
+    -2678,     3, -4437,    27,  3149,   160, -3066,  2166,
+     3915,  3763,   113,  4919,  1440,  4654, -1426, -5084,
+    -1777, -1663, -1632,  5291,  2704,  1017, -4938,  3636,
+    -4885, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444,  3248,  1207,  4337,
+     1168,  5277,   435, -2143, -1065,  1378, -4645,   404,
+     1912, -4284, -5088,  3248,  1002,  5011,  1207,  3780,
+      875,  1168, -1607,  4976,  5277,  2437, -3646, -2143,
+     6022,  2987, -1065,  2187, -2566, -4645, -2422,  6039,
+      404, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red1024_mixed_powers_ct_r4[1024] = {
+        0,   493,  5444,  2381, -1912,  -404,  4645,  -435,
+    -5277, -1168, -1378,  1065,  2143, -4337, -1207, -3248,
+    -6039,  4885, -1017, -4976,  3833,  3778, -2987,  2678,
+     3704, -5011,  -354,  4861,  2566, -1440, -3763,  -875,
+    -1067, -5101,  3646,   242,  1537,  5088,  2859,  1045,
+     2422,  1632,  5084,  1607,   390,  -773, -6022,   545,
+    -5019, -1002, -5698,  2912, -2187,  3066,   -27, -3780,
+     -442, -2401, -2437, -4714, -4143,  4284, -5012, -2481,
+    -3636, -5828, -5023,  -476,   827, -5767,  4372,  -790,
+     -955, -3186,  2731, -3932, -4919, -1212,  1646,  -671,
+    -2468,  -339, -2305, -4255, -1177,  2686, -2013, -3289,
+     1663, -2639,  4821,  2178,  5374, -2837,  4057, -1062,
+     2294,  1153, -4231, -2548,  -160, -5736, -4134,  2399,
+     4989,  5331, -1484, -4320,  1000,  3510, -5755,  4632,
+    -2704,  3328, -5777,  4905,  -118, -2476,  4414, -3201,
+    -3014, -2126,  3459,  3637, -3915, -3542, -3504,  3016,
+     -480,  2842, -4053,   726,  4611, -3978, -5092,  2089,
+     1426, -2744, -3006, -5559, -4452,  2396, -3364, -3712,
+     3135,  4048, -1759,  3707,  4437,  4043, -5146,  3136,
+     4177, -3584, -2780,  4896,  2963, -2865,  2426,  -334,
+     4938, -4591,  5728, -3531,   953, -3748,  2174,  1170,
+    -2319, -5407,  5911,  4890,  -113,  3195, -5860,  3000,
+      544,  5791, -5042,  1635, -2768,  3247, -3241,  -729,
+     1777, -2625,   949,  1544,   130, -4354,  3271, -4805,
+    -3553, -2884,   355, -3382, -3149, -1305,  -722, -3400,
+     4278, -1673,  4895, -3091,   -81,  5332, -4388, -1260,
+    -5291, -1351,  4978,  3985,  2197,  5067,  2847, -1326,
+     5086,  1630,  -145, -5542, -2166, -3621,  2545,  -243,
+     1022,    -9,  2645, -1853,  -140,  2969, -2881,  3284,
+    -4654,  2975,   563,  -420,  3949,  3296,  1689, -2747,
+     4846,  2249,  3694, -5179,    -3,  1479,    -1,  5191,
+     2525, -1381,  5195, -3051, -2366,  2370,  1696,  1428,
+    -1360,   338, -3947,  -975, -2672,  5170,  2057,  1417,
+    -5676,  5315, -5530,  5604,  1958,  -204,  5509,  3482,
+    -3332,  -139,   418,  2926,  1826,  3643, -5461, -2946,
+     -325,   923,  1038,  4782, -5406,  4665,  5868, -2275,
+     2461,  4749,  3805,  -767,  5257, -3393, -4335, -3957,
+     6026,  2929, -2882,  4209, -5412,  3988, -4987, -2373,
+     1594, -3624, -1892,  1956,  2253,  1868,  1583,   -68,
+    -2260, -2344, -5207,  4050, -1319, -3121,  4705, -5057,
+     2276,  -982, -2767,  4404,   346, -3565, -1802,  1555,
+      652,  3338, -3276,  4624, -2828, -4352,  3315, -1131,
+    -1445, -4536,  6105, -3120, -5782,  1403, -1804,  3174,
+     2434,  -791,  2908, -1208, -4727, -3879,   751,  4719,
+    -2555, -4119,  3343,  1105, -5832,  1350, -1512,  3056,
+    -2528,  2169,  4855,  3769,  1058,  1468, -3981, -3127,
+    -4697, -3578, -1293,  5209, -1092, -4948, -5039, -5547,
+    -3728,  -377, -4578,  -504,  2035, -1040,   723,  4564,
+     3495,  4449, -3285, -4360,  3054, -4499, -5672,  -431,
+    -3846,  1573,  2447, -1373, -2982, -5339, -1944,   450,
+     -168,  5115, -4939,   241, -2478, -2840,  1483, -3607,
+    -1327,  1018, -5662, -5289, -4240, -2360,  -364,  4912,
+    -5776, -1849, -5876, -4222, -1526,   -56, -3418, -4443,
+    -4016, -2575,  1165, -3602, -1095,  2643, -3757, -5596,
+    -5987,  2683, -1282, -3572, -2459, -4554,  -994, -6055,
+     -648,   150, -4115,  1705,  2450, -5435,  -826, -5043,
+    -5297,  2894,  3654,  2844,  2209, -1763, -3202, -4883,
+     3975, -4916,  2171,  3480,  2078,  2689, -4605, -5468,
+     2957, -1481, -5908,  3238, -3708, -5862,  -365,   881,
+      948,  2231, -6092,  3029,  3669, -5287, -5735, -1518,
+     3765,  4789,  -216,    50, -5919, -3528,  4913,  2127,
+     3821, -1681, -1954,  5061,  1218,   316, -3360, -4684,
+     5106, -5724,  1325, -6008,  4820,  1160, -2500, -3200,
+    -1535, -1973,  5082, -4590,   709, -3017, -1236,  3445,
+    -4218,  4390, -3991,  4840, -6127,  1702,  1223,  2334,
+    -6099,  -506,  1255,  3263,   -72,  4113, -4754, -1176,
+     5734, -3860,  5370,  3536, -2948,  1687,   406,  2766,
+    -1120,  2535, -3529, -1908,  4538, -2033,  5703,  4483,
+     5184, -5163, -4608, -5681,  1694, -1530, -5383, -5102,
+     -412, -5079, -1406, -2633,   922, -2483,  2054,  2920,
+     4504,   778, -4774, -4265, -3678,  1728,   -24,  1371,
+    -5990,  -392, -2185,  2302,  1790,  5275, -1693, -3534,
+    -3961, -3789,  3723,   845, -3123,  -636,  5609,  2505,
+     1901, -2602,   576, -1721, -1536, -6093,  4661,  -510,
+    -3329, -5797,  3959,  3532, -4565, -4974, -1263, -4924,
+     4781, -1041, -2595, -3837,   835, -5518, -1226,   192,
+       -8,   457, -2031, -4227,  3368, -5206,  4693, -2338,
+    -2919, -1178,  2776,  -421,  1241,  4378,  -347,  -212,
+     5966, -3818,  4730,  3229,    64, -4670,  -512,  -677,
+     5650,  -170,  2361,  2164,  5416,  -973, -5618, -1658,
+     3956,  2455,  5690, -4212,  -865, -1279, -5369,  2257,
+    -4505, -4075, -4099, -3944, -4322, -1409,  5219,   787,
+    -2532,  3317,  3772, -4489, -3171,  5415,  4510, -2637,
+    -1404, -4167,  6085, -5886,  5673, -3020,  2738, -5653,
+    -4267, -5537, -2213, -4153, -3834, -3375, -2291, -2839,
+    -5969, -4649,  1805, -3278,  5993,  -468,  3808,  3670,
+    -1962, -3344, -5598,  5009,  2730, -5411, -5942, -4566,
+     5836, -1278,  -844,  5202,  3150,  2600, -1057,  4698,
+    -2593,  -879,  -156, -1389, -2068,  -654,  1891, -5103,
+     5766,  2212,  2674, -6077, -4834,  2712,  -426, -1125,
+    -4860,  1050, -6086, -5646,  1566, -5189,  6094,   -52,
+    -2827, -2873,  -218, -5211, -1866,  1922,   910, -5900,
+    -6122, -1522, -2151,  -142,  3815,  1734,   350,  4963,
+     3744,   522,  3232,  -293,  4079,  -463,  3407, -4169,
+    -3466, -1701,  4737, -3359, -3205, -6137,  2485,   904,
+     4049,  -375, -1620,  4213, -6125, -1882,   174, -5826,
+    -2065,  5456,  3154, -5054, -5486, -1737,  -622,  1579,
+    -3793, -6063, -6142,  3589,  -717,  5446,  5368,   578,
+    -2692, -2442,  1248,    58, -3019, -4194,  5915,  3942,
+     5232, -5925,  2941,  -567, -3570, -5216,  3028,  2049,
+    -3268, -3795, -2281,  -125,  -540,  3199, -6138,  3469,
+    -4077, -1942,  3408,  6068, -3045, -5781, -1975,  -579,
+     3889, -1190,  2832, -2021,   683, -2900,  -239,  3336,
+    -2307,  4289, -3030,  -814,   416, -1359,  3090, -1398,
+     6119,  1314,  1744,  3438, -3116,  -189, -4493, -5835,
+    -3087,  4324,  3007, -1265,  1112, -4138,  -180, -1010,
+    -2046, -2940,  -453,  3449,  1136,  6136, -1015, -1927,
+     1146,  -193, -2800, -5594,   944, -4770, -2655, -5063,
+    -4176,  4467,  -769,  5526, -4433,  3825,  4235,  -151,
+     1030,  -466, -2051,   438, -3515,   382, -5135,   -63,
+    -5961, -1945, -1029,  -885, -3094, -4518,  1489,  2717,
+      -60, -5574,  -682,  -980,  4046,  5246,  4475, -4780,
+     3758,  3454, -3969,  4032,  3163, -1987,  4411, -1590,
+     -295, -5784, -1392, -3600,  3840,  1842, -1858,  1275,
+     5508,  5445, -3753,  3941,  2503,   146, -5268, -1323,
+    -5808,   -21,  3434,  3448,  -343,  3998,  3065, -1506,
+    -1200,  5002,   -20,  3477,  3869, -4423,  1815,  5845,
+     5588, -3262,  5349, -2945,  -441,  1344, -3042,  5241,
+    -2626,  -530,  5429, -1928,  -464,  -400,  1280,   614,
+     1159,   425,  1836,   605, -1251,  5410,  3009,  4145,
+    -1756,  -147, -1936,    -7,  1747, -2947,  3982,  5906,
+     5118,  -502,  3963, -2429, -4103, -3710,  5386,  2622,
+     4298, -2148,  5959,  1003,  1783, -5078,   -49,   448,
+    -1014, -3514,  3221, -4273,  6065, -4739, -4251,  1321,
+     4523,  4301, -5333,  4238,   612,  5529,  -417, -2293,
+    -3762,  5478,  3511,  4080,  3451,  4094,  2925,  3114,
+    -2769,  6118,  1706,  3929, -3656, -4906, -5464, -5874,
+    -2301,   874,  1843,  -716, -2110, -1254, -3502, -5789,
+};
+
+const int16_t ntt_red1024_mixed_powers_rev_ct_r4[1024] = {
+        0,   493,  5444,  2381, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+    -6039,  4885, -1017,  2422,  1632,  5084,  2566, -1440,
+    -3763, -2187,  3066,   -27, -2987,  2678,  3704, -6022,
+      545, -5019,  3646,   242,  1537, -2437, -4714, -4143,
+    -4976,  3833,  3778,  1607,   390,  -773,  -875, -1067,
+    -5101, -3780,  -442, -2401, -5011,  -354,  4861, -1002,
+    -5698,  2912,  5088,  2859,  1045,  4284, -5012, -2481,
+    -3636, -5828, -5023,  4938, -4591,  5728, -2704,  3328,
+    -5777, -5291, -1351,  4978,  1663, -2639,  4821,  1777,
+    -2625,   949,  1426, -2744, -3006, -4654,  2975,   563,
+    -4919, -1212,  1646,  -113,  3195, -5860, -3915, -3542,
+    -3504, -2166, -3621,  2545,  -160, -5736, -4134, -3149,
+    -1305,  -722,  4437,  4043, -5146,    -3,  1479,    -1,
+     4372,  -790,  -955,  2174,  1170, -2319,  4414, -3201,
+    -3014,  2847, -1326,  5086,  4057, -1062,  2294,  3271,
+    -4805, -3553, -3364, -3712,  3135,  1689, -2747,  4846,
+    -2305, -4255, -1177, -5042,  1635, -2768, -4053,   726,
+     4611,  2645, -1853,  -140, -1484, -4320,  1000,  4895,
+    -3091,   -81, -2780,  4896,  2963,  5195, -3051, -2366,
+     -476,   827, -5767, -3531,   953, -3748,  4905,  -118,
+    -2476,  3985,  2197,  5067,  2178,  5374, -2837,  1544,
+      130, -4354, -5559, -4452,  2396,  -420,  3949,  3296,
+     -671, -2468,  -339,  3000,   544,  5791,  3016,  -480,
+     2842,  -243,  1022,    -9,  2399,  4989,  5331, -3400,
+     4278, -1673,  3136,  4177, -3584,  5191,  2525, -1381,
+    -3186,  2731, -3932, -5407,  5911,  4890, -2126,  3459,
+     3637,  1630,  -145, -5542,  1153, -4231, -2548, -2884,
+      355, -3382,  4048, -1759,  3707,  2249,  3694, -5179,
+     2686, -2013, -3289,  3247, -3241,  -729, -3978, -5092,
+     2089,  2969, -2881,  3284,  3510, -5755,  4632,  5332,
+    -4388, -1260, -2865,  2426,  -334,  2370,  1696,  1428,
+    -1360,   338, -3947,  3956,  2455,  5690, -5297,  2894,
+     3654,  6119,  1314,  1744, -2555, -4119,  3343, -6122,
+    -1522, -2151,  5184, -5163, -4608, -1200,  5002,   -20,
+     1594, -3624, -1892, -1962, -3344, -5598,  5106, -5724,
+     1325, -5961, -1945, -1029,  -168,  5115, -4939, -2692,
+    -2442,  1248, -3329, -5797,  3959,  4298, -2148,  5959,
+     -325,   923,  1038, -1404, -4167,  6085,   948,  2231,
+    -6092,  1146,  -193, -2800, -3728,  -377, -4578,  4049,
+     -375, -1620, -5990,  -392, -2185,  1159,   425,  1836,
+      652,  3338, -3276,  5766,  2212,  2674, -6099,  -506,
+     1255,  -295, -5784, -1392, -4016, -2575,  1165, -4077,
+    -1942,  3408, -2919, -1178,  2776, -3762,  5478,  3511,
+     1958,  -204,  5509, -4322, -1409,  5219,  2078,  2689,
+    -4605,  1112, -4138,  -180,  1058,  1468, -3981,  4079,
+     -463,  3407,   922, -2483,  2054,  -441,  1344, -3042,
+    -1319, -3121,  4705,  3150,  2600, -1057,   709, -3017,
+    -1236,  4046,  5246,  4475, -4240, -2360,  -364, -3570,
+    -5216,  3028,   835, -5518, -1226,  6065, -4739, -4251,
+     5257, -3393, -4335, -3834, -3375, -2291, -5919, -3528,
+     4913, -4433,  3825,  4235,  3054, -4499, -5672, -5486,
+    -1737,  -622, -3123,  -636,  5609,  1747, -2947,  3982,
+    -5782,  1403, -1804,  1566, -5189,  6094, -2948,  1687,
+      406,  2503,   146, -5268, -2459, -4554,  -994,   683,
+    -2900,  -239,    64, -4670,  -512, -3656, -4906, -5464,
+     2057,  1417, -5676, -5369,  2257, -4505, -3202, -4883,
+     3975, -4493, -5835, -3087, -1512,  3056, -2528,   350,
+     4963,  3744, -5383, -5102,  -412,  1815,  5845,  5588,
+     1583,   -68, -2260, -5942, -4566,  5836, -2500, -3200,
+    -1535,  1489,  2717,   -60,  1483, -3607, -1327,  5915,
+     3942,  5232, -1263, -4924,  4781,   -49,   448, -1014,
+     5868, -2275,  2461,  2738, -5653, -4267, -5735, -1518,
+     3765, -2655, -5063, -4176,   723,  4564,  3495,   174,
+    -5826, -2065, -1693, -3534, -3961,  3009,  4145, -1756,
+     3315, -1131, -1445,  -426, -1125, -4860, -4754, -1176,
+     5734, -1858,  1275,  5508, -3757, -5596, -5987, -1975,
+     -579,  3889,  -347,  -212,  5966,  2925,  3114, -2769,
+      418,  2926,  1826,  3772, -4489, -3171, -5908,  3238,
+    -3708,  -453,  3449,  1136, -1293,  5209, -1092,  4737,
+    -3359, -3205, -4774, -4265, -3678,  5429, -1928,  -464,
+    -2767,  4404,   346,  -156, -1389, -2068, -3991,  4840,
+    -6127, -3969,  4032,  3163, -5876, -4222, -1526, -2281,
+     -125,  -540, -2031, -4227,  3368, -5333,  4238,   612,
+    -2882,  4209, -5412,  1805, -3278,  5993, -1954,  5061,
+     1218, -2051,   438, -3515,  2447, -1373, -2982, -6142,
+     3589,  -717,   576, -1721, -1536,  3963, -2429, -4103,
+     2908, -1208, -4727,  -218, -5211, -1866, -3529, -1908,
+     4538,  3434,  3448,  -343, -4115,  1705,  2450, -3030,
+     -814,   416,  2361,  2164,  5416,  1843,  -716, -2110,
+     -975, -2672,  5170, -4212,  -865, -1279,  2844,  2209,
+    -1763,  3438, -3116,  -189,  1105, -5832,  1350,  -142,
+     3815,  1734, -5681,  1694, -1530,  3477,  3869, -4423,
+     1956,  2253,  1868,  5009,  2730, -5411, -6008,  4820,
+     1160,  -885, -3094, -4518,   241, -2478, -2840,    58,
+    -3019, -4194,  3532, -4565, -4974,  1003,  1783, -5078,
+     4782, -5406,  4665, -5886,  5673, -3020,  3029,  3669,
+    -5287, -5594,   944, -4770,  -504,  2035, -1040,  4213,
+    -6125, -1882,  2302,  1790,  5275,   605, -1251,  5410,
+     4624, -2828, -4352, -6077, -4834,  2712,  3263,   -72,
+     4113, -3600,  3840,  1842, -3602, -1095,  2643,  6068,
+    -3045, -5781,  -421,  1241,  4378,  4080,  3451,  4094,
+     3482, -3332,  -139,   787, -2532,  3317, -5468,  2957,
+    -1481, -1010, -2046, -2940, -3127, -4697, -3578, -4169,
+    -3466, -1701,  2920,  4504,   778,  5241, -2626,  -530,
+    -5057,  2276,  -982,  4698, -2593,  -879,  3445, -4218,
+     4390, -4780,  3758,  3454,  4912, -5776, -1849,  2049,
+    -3268, -3795,   192,    -8,   457,  1321,  4523,  4301,
+    -3957,  6026,  2929, -2839, -5969, -4649,  2127,  3821,
+    -1681,  -151,  1030,  -466,  -431, -3846,  1573,  1579,
+    -3793, -6063,  2505,  1901, -2602,  5906,  5118,  -502,
+     3174,  2434,  -791,   -52, -2827, -2873,  2766, -1120,
+     2535, -1323, -5808,   -21, -6055,  -648,   150,  3336,
+    -2307,  4289,  -677,  5650,  -170, -5874, -2301,   874,
+     5315, -5530,  5604, -4075, -4099, -3944, -4916,  2171,
+     3480,  4324,  3007, -1265,  2169,  4855,  3769,   522,
+     3232,  -293, -5079, -1406, -2633, -3262,  5349, -2945,
+    -2344, -5207,  4050, -1278,  -844,  5202, -1973,  5082,
+    -4590, -5574,  -682,  -980,  1018, -5662, -5289, -5925,
+     2941,  -567, -1041, -2595, -3837, -3514,  3221, -4273,
+     4749,  3805,  -767, -5537, -2213, -4153,  4789,  -216,
+       50,  4467,  -769,  5526,  4449, -3285, -4360,  5456,
+     3154, -5054, -3789,  3723,   845,  -147, -1936,    -7,
+    -4536,  6105, -3120,  1050, -6086, -5646, -3860,  5370,
+     3536,  5445, -3753,  3941,  2683, -1282, -3572, -1190,
+     2832, -2021, -3818,  4730,  3229,  6118,  1706,  3929,
+     3643, -5461, -2946,  5415,  4510, -2637, -5862,  -365,
+      881,  6136, -1015, -1927, -4948, -5039, -5547, -6137,
+     2485,   904,  1728,   -24,  1371,  -400,  1280,   614,
+    -3565, -1802,  1555,  -654,  1891, -5103,  1702,  1223,
+     2334, -1987,  4411, -1590,   -56, -3418, -4443,  3199,
+    -6138,  3469, -5206,  4693, -2338,  5529,  -417, -2293,
+     3988, -4987, -2373,  -468,  3808,  3670,   316, -3360,
+    -4684,   382, -5135,   -63, -5339, -1944,   450,  5446,
+     5368,   578, -6093,  4661,  -510, -3710,  5386,  2622,
+    -3879,   751,  4719,  1922,   910, -5900, -2033,  5703,
+     4483,  3998,  3065, -1506, -5435,  -826, -5043, -1359,
+     3090, -1398,  -973, -5618, -1658, -1254, -3502, -5789,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers_gs_r4[1024] = {
+        0,  5789,  3502,  1254,  2110,   716, -1843,  -874,
+     2301,  5874,  5464,  4906,  3656, -3929, -1706, -6118,
+     2769, -3114, -2925, -4094, -3451, -4080, -3511, -5478,
+     3762,  2293,   417, -5529,  -612, -4238,  5333, -4301,
+    -4523, -1321,  4251,  4739, -6065,  4273, -3221,  3514,
+     1014,  -448,    49,  5078, -1783, -1003, -5959,  2148,
+    -4298, -2622, -5386,  3710,  4103,  2429, -3963,   502,
+    -5118, -5906, -3982,  2947, -1747,     7,  1936,   147,
+     1756, -4145, -3009, -5410,  1251,  -605, -1836,  -425,
+    -1159,  -614, -1280,   400,   464,  1928, -5429,   530,
+     2626, -5241,  3042, -1344,   441,  2945, -5349,  3262,
+    -5588, -5845, -1815,  4423, -3869, -3477,    20, -5002,
+     1200,  1506, -3065, -3998,   343, -3448, -3434,    21,
+     5808,  1323,  5268,  -146, -2503, -3941,  3753, -5445,
+    -5508, -1275,  1858, -1842, -3840,  3600,  1392,  5784,
+      295,  1590, -4411,  1987, -3163, -4032,  3969, -3454,
+    -3758,  4780, -4475, -5246, -4046,   980,   682,  5574,
+       60, -2717, -1489,  4518,  3094,   885,  1029,  1945,
+     5961,    63,  5135,  -382,  3515,  -438,  2051,   466,
+    -1030,   151, -4235, -3825,  4433, -5526,   769, -4467,
+     4176,  5063,  2655,  4770,  -944,  5594,  2800,   193,
+    -1146,  1927,  1015, -6136, -1136, -3449,   453,  2940,
+     2046,  1010,   180,  4138, -1112,  1265, -3007, -4324,
+     3087,  5835,  4493,   189,  3116, -3438, -1744, -1314,
+    -6119,  1398, -3090,  1359,  -416,   814,  3030, -4289,
+     2307, -3336,   239,  2900,  -683,  2021, -2832,  1190,
+    -3889,   579,  1975,  5781,  3045, -6068, -3408,  1942,
+     4077, -3469,  6138, -3199,   540,   125,  2281,  3795,
+     3268, -2049, -3028,  5216,  3570,   567, -2941,  5925,
+    -5232, -3942, -5915,  4194,  3019,   -58, -1248,  2442,
+     2692,  -578, -5368, -5446,   717, -3589,  6142,  6063,
+     3793, -1579,   622,  1737,  5486,  5054, -3154, -5456,
+     2065,  5826,  -174,  1882,  6125, -4213,  1620,   375,
+    -4049,  -904, -2485,  6137,  3205,  3359, -4737,  1701,
+     3466,  4169, -3407,   463, -4079,   293, -3232,  -522,
+    -3744, -4963,  -350, -1734, -3815,   142,  2151,  1522,
+     6122,  5900,  -910, -1922,  1866,  5211,   218,  2873,
+     2827,    52, -6094,  5189, -1566,  5646,  6086, -1050,
+     4860,  1125,   426, -2712,  4834,  6077, -2674, -2212,
+    -5766,  5103, -1891,   654,  2068,  1389,   156,   879,
+     2593, -4698,  1057, -2600, -3150, -5202,   844,  1278,
+    -5836,  4566,  5942,  5411, -2730, -5009,  5598,  3344,
+     1962, -3670, -3808,   468, -5993,  3278, -1805,  4649,
+     5969,  2839,  2291,  3375,  3834,  4153,  2213,  5537,
+     4267,  5653, -2738,  3020, -5673,  5886, -6085,  4167,
+     1404,  2637, -4510, -5415,  3171,  4489, -3772, -3317,
+     2532,  -787, -5219,  1409,  4322,  3944,  4099,  4075,
+     4505, -2257,  5369,  1279,   865,  4212, -5690, -2455,
+    -3956,  1658,  5618,   973, -5416, -2164, -2361,   170,
+    -5650,   677,   512,  4670,   -64, -3229, -4730,  3818,
+    -5966,   212,   347, -4378, -1241,   421, -2776,  1178,
+     2919,  2338, -4693,  5206, -3368,  4227,  2031,  -457,
+        8,  -192,  1226,  5518,  -835,  3837,  2595,  1041,
+    -4781,  4924,  1263,  4974,  4565, -3532, -3959,  5797,
+     3329,   510, -4661,  6093,  1536,  1721,  -576,  2602,
+    -1901, -2505, -5609,   636,  3123,  -845, -3723,  3789,
+     3961,  3534,  1693, -5275, -1790, -2302,  2185,   392,
+     5990, -1371,    24, -1728,  3678,  4265,  4774,  -778,
+    -4504, -2920, -2054,  2483,  -922,  2633,  1406,  5079,
+      412,  5102,  5383,  1530, -1694,  5681,  4608,  5163,
+    -5184, -4483, -5703,  2033, -4538,  1908,  3529, -2535,
+     1120, -2766,  -406, -1687,  2948, -3536, -5370,  3860,
+    -5734,  1176,  4754, -4113,    72, -3263, -1255,   506,
+     6099, -2334, -1223, -1702,  6127, -4840,  3991, -4390,
+     4218, -3445,  1236,  3017,  -709,  4590, -5082,  1973,
+     1535,  3200,  2500, -1160, -4820,  6008, -1325,  5724,
+    -5106,  4684,  3360,  -316, -1218, -5061,  1954,  1681,
+    -3821, -2127, -4913,  3528,  5919,   -50,   216, -4789,
+    -3765,  1518,  5735,  5287, -3669, -3029,  6092, -2231,
+     -948,  -881,   365,  5862,  3708, -3238,  5908,  1481,
+    -2957,  5468,  4605, -2689, -2078, -3480, -2171,  4916,
+    -3975,  4883,  3202,  1763, -2209, -2844, -3654, -2894,
+     5297,  5043,   826,  5435, -2450, -1705,  4115,  -150,
+      648,  6055,   994,  4554,  2459,  3572,  1282, -2683,
+     5987,  5596,  3757, -2643,  1095,  3602, -1165,  2575,
+     4016,  4443,  3418,    56,  1526,  4222,  5876,  1849,
+     5776, -4912,   364,  2360,  4240,  5289,  5662, -1018,
+     1327,  3607, -1483,  2840,  2478,  -241,  4939, -5115,
+      168,  -450,  1944,  5339,  2982,  1373, -2447, -1573,
+     3846,   431,  5672,  4499, -3054,  4360,  3285, -4449,
+    -3495, -4564,  -723,  1040, -2035,   504,  4578,   377,
+     3728,  5547,  5039,  4948,  1092, -5209,  1293,  3578,
+     4697,  3127,  3981, -1468, -1058, -3769, -4855, -2169,
+     2528, -3056,  1512, -1350,  5832, -1105, -3343,  4119,
+     2555, -4719,  -751,  3879,  4727,  1208, -2908,   791,
+    -2434, -3174,  1804, -1403,  5782,  3120, -6105,  4536,
+     1445,  1131, -3315,  4352,  2828, -4624,  3276, -3338,
+     -652, -1555,  1802,  3565,  -346, -4404,  2767,   982,
+    -2276,  5057, -4705,  3121,  1319, -4050,  5207,  2344,
+     2260,    68, -1583, -1868, -2253, -1956,  1892,  3624,
+    -1594,  2373,  4987, -3988,  5412, -4209,  2882, -2929,
+    -6026,  3957,  4335,  3393, -5257,   767, -3805, -4749,
+    -2461,  2275, -5868, -4665,  5406, -4782, -1038,  -923,
+      325,  2946,  5461, -3643, -1826, -2926,  -418,   139,
+     3332, -3482, -5509,   204, -1958, -5604,  5530, -5315,
+     5676, -1417, -2057, -5170,  2672,   975,  3947,  -338,
+     1360, -1428, -1696, -2370,  2366,  3051, -5195,  1381,
+    -2525, -5191,     1, -1479,     3,  5179, -3694, -2249,
+    -4846,  2747, -1689, -3296, -3949,   420,  -563, -2975,
+     4654, -3284,  2881, -2969,   140,  1853, -2645,     9,
+    -1022,   243, -2545,  3621,  2166,  5542,   145, -1630,
+    -5086,  1326, -2847, -5067, -2197, -3985, -4978,  1351,
+     5291,  1260,  4388, -5332,    81,  3091, -4895,  1673,
+    -4278,  3400,   722,  1305,  3149,  3382,  -355,  2884,
+     3553,  4805, -3271,  4354,  -130, -1544,  -949,  2625,
+    -1777,   729,  3241, -3247,  2768, -1635,  5042, -5791,
+     -544, -3000,  5860, -3195,   113, -4890, -5911,  5407,
+     2319, -1170, -2174,  3748,  -953,  3531, -5728,  4591,
+    -4938,   334, -2426,  2865, -2963, -4896,  2780,  3584,
+    -4177, -3136,  5146, -4043, -4437, -3707,  1759, -4048,
+    -3135,  3712,  3364, -2396,  4452,  5559,  3006,  2744,
+    -1426, -2089,  5092,  3978, -4611,  -726,  4053, -2842,
+      480, -3016,  3504,  3542,  3915, -3637, -3459,  2126,
+     3014,  3201, -4414,  2476,   118, -4905,  5777, -3328,
+     2704, -4632,  5755, -3510, -1000,  4320,  1484, -5331,
+    -4989, -2399,  4134,  5736,   160,  2548,  4231, -1153,
+    -2294,  1062, -4057,  2837, -5374, -2178, -4821,  2639,
+    -1663,  3289,  2013, -2686,  1177,  4255,  2305,   339,
+     2468,   671, -1646,  1212,  4919,  3932, -2731,  3186,
+      955,   790, -4372,  5767,  -827,   476,  5023,  5828,
+     3636,  2481,  5012, -4284,  4143,  4714,  2437,  2401,
+      442,  3780,    27, -3066,  2187, -2912,  5698,  1002,
+     5019,  -545,  6022,   773,  -390, -1607, -5084, -1632,
+    -2422, -1045, -2859, -5088, -1537,  -242, -3646,  5101,
+     1067,   875,  3763,  1440, -2566, -4861,   354,  5011,
+    -3704, -2678,  2987, -3778, -3833,  4976,  1017, -4885,
+     6039,  3248,  1207,  4337, -2143, -1065,  1378,  1168,
+     5277,   435, -4645,   404,  1912, -2381, -5444,  -493,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers_rev_gs_r4[1024] = {
+        0,  5789,  3502,  1254,  1658,  5618,   973,  1398,
+    -3090,  1359,  5043,   826,  5435,  1506, -3065, -3998,
+    -4483, -5703,  2033,  5900,  -910, -1922, -4719,  -751,
+     3879, -2622, -5386,  3710,   510, -4661,  6093,  -578,
+    -5368, -5446,  -450,  1944,  5339,    63,  5135,  -382,
+     4684,  3360,  -316, -3670, -3808,   468,  2373,  4987,
+    -3988,  2293,   417, -5529,  2338, -4693,  5206, -3469,
+     6138, -3199,  4443,  3418,    56,  1590, -4411,  1987,
+    -2334, -1223, -1702,  5103, -1891,   654, -1555,  1802,
+     3565,  -614, -1280,   400, -1371,    24, -1728,  -904,
+    -2485,  6137,  5547,  5039,  4948,  1927,  1015, -6136,
+     -881,   365,  5862,  2637, -4510, -5415,  2946,  5461,
+    -3643, -3929, -1706, -6118, -3229, -4730,  3818,  2021,
+    -2832,  1190,  3572,  1282, -2683, -3941,  3753, -5445,
+    -3536, -5370,  3860,  5646,  6086, -1050,  3120, -6105,
+     4536,     7,  1936,   147,  -845, -3723,  3789,  5054,
+    -3154, -5456,  4360,  3285, -4449, -5526,   769, -4467,
+      -50,   216, -4789,  4153,  2213,  5537,   767, -3805,
+    -4749,  4273, -3221,  3514,  3837,  2595,  1041,   567,
+    -2941,  5925,  5289,  5662, -1018,   980,   682,  5574,
+     4590, -5082,  1973, -5202,   844,  1278, -4050,  5207,
+     2344,  2945, -5349,  3262,  2633,  1406,  5079,   293,
+    -3232,  -522, -3769, -4855, -2169,  1265, -3007, -4324,
+    -3480, -2171,  4916,  3944,  4099,  4075, -5604,  5530,
+    -5315,  -874,  2301,  5874,   170, -5650,   677, -4289,
+     2307, -3336,  -150,   648,  6055,    21,  5808,  1323,
+    -2535,  1120, -2766,  2873,  2827,    52,   791, -2434,
+    -3174,   502, -5118, -5906,  2602, -1901, -2505,  6063,
+     3793, -1579, -1573,  3846,   431,   466, -1030,   151,
+     1681, -3821, -2127,  4649,  5969,  2839, -2929, -6026,
+     3957, -4301, -4523, -1321,  -457,     8,  -192,  3795,
+     3268, -2049,  1849,  5776, -4912, -3454, -3758,  4780,
+    -4390,  4218, -3445,   879,  2593, -4698,   982, -2276,
+     5057,   530,  2626, -5241,  -778, -4504, -2920,  1701,
+     3466,  4169,  3578,  4697,  3127,  2940,  2046,  1010,
+     1481, -2957,  5468, -3317,  2532,  -787,   139,  3332,
+    -3482, -4094, -3451, -4080, -4378, -1241,   421,  5781,
+     3045, -6068, -2643,  1095,  3602, -1842, -3840,  3600,
+    -4113,    72, -3263, -2712,  4834,  6077,  4352,  2828,
+    -4624, -5410,  1251,  -605, -5275, -1790, -2302,  1882,
+     6125, -4213,  1040, -2035,   504,  4770,  -944,  5594,
+     5287, -3669, -3029,  3020, -5673,  5886, -4665,  5406,
+    -4782,  5078, -1783, -1003,  4974,  4565, -3532,  4194,
+     3019,   -58,  2840,  2478,  -241,  4518,  3094,   885,
+    -1160, -4820,  6008,  5411, -2730, -5009, -1868, -2253,
+    -1956,  4423, -3869, -3477,  1530, -1694,  5681, -1734,
+    -3815,   142, -1350,  5832, -1105,   189,  3116, -3438,
+     1763, -2209, -2844,  1279,   865,  4212, -5170,  2672,
+      975,  2110,   716, -1843, -5416, -2164, -2361,  -416,
+      814,  3030, -2450, -1705,  4115,   343, -3448, -3434,
+    -4538,  1908,  3529,  1866,  5211,   218,  4727,  1208,
+    -2908,  4103,  2429, -3963,  1536,  1721,  -576,   717,
+    -3589,  6142,  2982,  1373, -2447,  3515,  -438,  2051,
+    -1218, -5061,  1954, -5993,  3278, -1805,  5412, -4209,
+     2882,  -612, -4238,  5333, -3368,  4227,  2031,   540,
+      125,  2281,  1526,  4222,  5876, -3163, -4032,  3969,
+     6127, -4840,  3991,  2068,  1389,   156,  -346, -4404,
+     2767,   464,  1928, -5429,  3678,  4265,  4774,  3205,
+     3359, -4737,  1092, -5209,  1293, -1136, -3449,   453,
+     3708, -3238,  5908,  3171,  4489, -3772, -1826, -2926,
+     -418,  2769, -3114, -2925, -5966,   212,   347, -3889,
+      579,  1975,  5987,  5596,  3757, -5508, -1275,  1858,
+    -5734,  1176,  4754,  4860,  1125,   426,  1445,  1131,
+    -3315,  1756, -4145, -3009,  3961,  3534,  1693,  2065,
+     5826,  -174, -3495, -4564,  -723,  4176,  5063,  2655,
+    -3765,  1518,  5735,  4267,  5653, -2738, -2461,  2275,
+    -5868,  1014,  -448,    49, -4781,  4924,  1263, -5232,
+    -3942, -5915,  1327,  3607, -1483,    60, -2717, -1489,
+     1535,  3200,  2500, -5836,  4566,  5942,  2260,    68,
+    -1583, -5588, -5845, -1815,   412,  5102,  5383, -3744,
+    -4963,  -350,  2528, -3056,  1512,  3087,  5835,  4493,
+    -3975,  4883,  3202,  4505, -2257,  5369,  5676, -1417,
+    -2057,  5464,  4906,  3656,   512,  4670,   -64,   239,
+     2900,  -683,   994,  4554,  2459,  5268,  -146, -2503,
+     -406, -1687,  2948, -6094,  5189, -1566,  1804, -1403,
+     5782, -3982,  2947, -1747, -5609,   636,  3123,   622,
+     1737,  5486,  5672,  4499, -3054, -4235, -3825,  4433,
+    -4913,  3528,  5919,  2291,  3375,  3834,  4335,  3393,
+    -5257,  4251,  4739, -6065,  1226,  5518,  -835, -3028,
+     5216,  3570,   364,  2360,  4240, -4475, -5246, -4046,
+     1236,  3017,  -709,  1057, -2600, -3150, -4705,  3121,
+     1319,  3042, -1344,   441, -2054,  2483,  -922, -3407,
+      463, -4079,  3981, -1468, -1058,   180,  4138, -1112,
+     4605, -2689, -2078, -5219,  1409,  4322, -5509,   204,
+    -1958, -3511, -5478,  3762, -2776,  1178,  2919, -3408,
+     1942,  4077, -1165,  2575,  4016,  1392,  5784,   295,
+    -1255,   506,  6099, -2674, -2212, -5766,  3276, -3338,
+     -652, -1836,  -425, -1159,  2185,   392,  5990,  1620,
+      375, -4049,  4578,   377,  3728,  2800,   193, -1146,
+     6092, -2231,  -948, -6085,  4167,  1404, -1038,  -923,
+      325, -5959,  2148, -4298, -3959,  5797,  3329, -1248,
+     2442,  2692,  4939, -5115,   168,  1029,  1945,  5961,
+    -1325,  5724, -5106,  5598,  3344,  1962,  1892,  3624,
+    -1594,    20, -5002,  1200,  4608,  5163, -5184,  2151,
+     1522,  6122, -3343,  4119,  2555, -1744, -1314, -6119,
+    -3654, -2894,  5297, -5690, -2455, -3956,  3947,  -338,
+     1360, -1428, -1696, -2370,   334, -2426,  2865,  1260,
+     4388, -5332, -4632,  5755, -3510, -3284,  2881, -2969,
+    -2089,  5092,  3978,   729,  3241, -3247,  3289,  2013,
+    -2686,  5179, -3694, -2249, -3707,  1759, -4048,  3382,
+     -355,  2884,  2548,  4231, -1153,  5542,   145, -1630,
+    -3637, -3459,  2126, -4890, -5911,  5407,  3932, -2731,
+     3186,  1381, -2525, -5191,  3584, -4177, -3136,  1673,
+    -4278,  3400, -5331, -4989, -2399,     9, -1022,   243,
+    -2842,   480, -3016, -5791,  -544, -3000,   339,  2468,
+      671, -3296, -3949,   420, -2396,  4452,  5559,  4354,
+     -130, -1544,  2837, -5374, -2178, -5067, -2197, -3985,
+     2476,   118, -4905,  3748,  -953,  3531,  5767,  -827,
+      476,  2366,  3051, -5195, -2963, -4896,  2780,    81,
+     3091, -4895, -1000,  4320,  1484,   140,  1853, -2645,
+    -4611,  -726,  4053,  2768, -1635,  5042,  1177,  4255,
+     2305, -4846,  2747, -1689, -3135,  3712,  3364,  3553,
+     4805, -3271, -2294,  1062, -4057, -5086,  1326, -2847,
+     3014,  3201, -4414,  2319, -1170, -2174,   955,   790,
+    -4372,     1, -1479,     3,  5146, -4043, -4437,   722,
+     1305,  3149,  4134,  5736,   160, -2545,  3621,  2166,
+     3504,  3542,  3915,  5860, -3195,   113, -1646,  1212,
+     4919,  -563, -2975,  4654,  3006,  2744, -1426,  -949,
+     2625, -1777, -4821,  2639, -1663, -4978,  1351,  5291,
+     5777, -3328,  2704, -5728,  4591, -4938,  5023,  5828,
+     3636,  2481,  5012, -4284, -1045, -2859, -5088, -2912,
+     5698,  1002, -4861,   354,  5011,  2401,   442,  3780,
+     5101,  1067,   875,   773,  -390, -1607, -3778, -3833,
+     4976,  4143,  4714,  2437, -1537,  -242, -3646,  5019,
+     -545,  6022, -3704, -2678,  2987,    27, -3066,  2187,
+     3763,  1440, -2566, -5084, -1632, -2422,  1017, -4885,
+     6039,  3248,  1207,  4337,  1168,  5277,   435, -2143,
+    -1065,  1378, -4645,   404,  1912, -2381, -5444,  -493,
+};
+
+const int16_t ntt_red1024_omega_powers_ct_cg[5120] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4885,  4885,  4885,  4885,  4885,  4885,  4885,  4885,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+     3833,  3833,  3833,  3833,  3833,  3833,  3833,  3833,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     2678,  2678,  2678,  2678,  2678,  2678,  2678,  2678,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+     -354,  -354,  -354,  -354,  -354,  -354,  -354,  -354,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1440, -1440, -1440, -1440, -1440, -1440, -1440, -1440,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -1067, -1067, -1067, -1067, -1067, -1067, -1067, -1067,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+      242,   242,   242,   242,   242,   242,   242,   242,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     2859,  2859,  2859,  2859,  2859,  2859,  2859,  2859,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1632,  1632,  1632,  1632,  1632,  1632,  1632,  1632,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+      390,   390,   390,   390,   390,   390,   390,   390,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+      545,   545,   545,   545,   545,   545,   545,   545,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+    -5698, -5698, -5698, -5698, -5698, -5698, -5698, -5698,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     3066,  3066,  3066,  3066,  3066,  3066,  3066,  3066,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     -442,  -442,  -442,  -442,  -442,  -442,  -442,  -442,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -4714, -4714, -4714, -4714, -4714, -4714, -4714, -4714,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+    -5012, -5012, -5012, -5012, -5012, -5012, -5012, -5012,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1017, -1017, -1017, -1017, -1017, -1017, -1017, -1017,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     3778,  3778,  3778,  3778,  3778,  3778,  3778,  3778,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     4861,  4861,  4861,  4861,  4861,  4861,  4861,  4861,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -3763, -3763, -3763, -3763, -3763, -3763, -3763, -3763,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -5101, -5101, -5101, -5101, -5101, -5101, -5101, -5101,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     1537,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     1045,  1045,  1045,  1045,  1045,  1045,  1045,  1045,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     5084,  5084,  5084,  5084,  5084,  5084,  5084,  5084,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+     -773,  -773,  -773,  -773,  -773,  -773,  -773,  -773,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -5019, -5019, -5019, -5019, -5019, -5019, -5019, -5019,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+     2912,  2912,  2912,  2912,  2912,  2912,  2912,  2912,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+      -27,   -27,   -27,   -27,   -27,   -27,   -27,   -27,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2401, -2401, -2401, -2401, -2401, -2401, -2401, -2401,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4143, -4143, -4143, -4143, -4143, -4143, -4143, -4143,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+    -2481, -2481, -2481, -2481, -2481, -2481, -2481, -2481,
+    -4096, -4096, -4096, -4096, -3636, -3636, -3636, -3636,
+     4885,  4885,  4885,  4885,  -476,  -476,  -476,  -476,
+    -6039, -6039, -6039, -6039,  4372,  4372,  4372,  4372,
+     3833,  3833,  3833,  3833, -3186, -3186, -3186, -3186,
+     -404,  -404,  -404,  -404, -4919, -4919, -4919, -4919,
+     2678,  2678,  2678,  2678,  -671,  -671,  -671,  -671,
+    -4976, -4976, -4976, -4976, -2305, -2305, -2305, -2305,
+     -354,  -354,  -354,  -354,  2686,  2686,  2686,  2686,
+    -1912, -1912, -1912, -1912,  1663,  1663,  1663,  1663,
+    -1440, -1440, -1440, -1440,  2178,  2178,  2178,  2178,
+    -2987, -2987, -2987, -2987,  4057,  4057,  4057,  4057,
+    -1067, -1067, -1067, -1067,  1153,  1153,  1153,  1153,
+    -5277, -5277, -5277, -5277,  -160,  -160,  -160,  -160,
+      242,   242,   242,   242,  2399,  2399,  2399,  2399,
+    -5011, -5011, -5011, -5011, -1484, -1484, -1484, -1484,
+     2859,  2859,  2859,  2859,  3510,  3510,  3510,  3510,
+     5444,  5444,  5444,  5444, -2704, -2704, -2704, -2704,
+     1632,  1632,  1632,  1632,  4905,  4905,  4905,  4905,
+     2566,  2566,  2566,  2566,  4414,  4414,  4414,  4414,
+      390,   390,   390,   390, -2126, -2126, -2126, -2126,
+     1065,  1065,  1065,  1065, -3915, -3915, -3915, -3915,
+      545,   545,   545,   545,  3016,  3016,  3016,  3016,
+     -875,  -875,  -875,  -875, -4053, -4053, -4053, -4053,
+    -5698, -5698, -5698, -5698, -3978, -3978, -3978, -3978,
+     -435,  -435,  -435,  -435,  1426,  1426,  1426,  1426,
+     3066,  3066,  3066,  3066, -5559, -5559, -5559, -5559,
+     3646,  3646,  3646,  3646, -3364, -3364, -3364, -3364,
+     -442,  -442,  -442,  -442,  4048,  4048,  4048,  4048,
+    -1207, -1207, -1207, -1207,  4437,  4437,  4437,  4437,
+    -4714, -4714, -4714, -4714,  3136,  3136,  3136,  3136,
+     5088,  5088,  5088,  5088, -2780, -2780, -2780, -2780,
+    -5012, -5012, -5012, -5012, -2865, -2865, -2865, -2865,
+      493,   493,   493,   493,  4938,  4938,  4938,  4938,
+    -1017, -1017, -1017, -1017, -3531, -3531, -3531, -3531,
+     2422,  2422,  2422,  2422,  2174,  2174,  2174,  2174,
+     3778,  3778,  3778,  3778, -5407, -5407, -5407, -5407,
+     4645,  4645,  4645,  4645,  -113,  -113,  -113,  -113,
+     3704,  3704,  3704,  3704,  3000,  3000,  3000,  3000,
+     1607,  1607,  1607,  1607, -5042, -5042, -5042, -5042,
+     4861,  4861,  4861,  4861,  3247,  3247,  3247,  3247,
+    -1378, -1378, -1378, -1378,  1777,  1777,  1777,  1777,
+    -3763, -3763, -3763, -3763,  1544,  1544,  1544,  1544,
+    -6022, -6022, -6022, -6022,  3271,  3271,  3271,  3271,
+    -5101, -5101, -5101, -5101, -2884, -2884, -2884, -2884,
+    -1168, -1168, -1168, -1168, -3149, -3149, -3149, -3149,
+     1537,  1537,  1537,  1537, -3400, -3400, -3400, -3400,
+    -1002, -1002, -1002, -1002,  4895,  4895,  4895,  4895,
+     1045,  1045,  1045,  1045,  5332,  5332,  5332,  5332,
+     2381,  2381,  2381,  2381, -5291, -5291, -5291, -5291,
+     5084,  5084,  5084,  5084,  3985,  3985,  3985,  3985,
+    -2187, -2187, -2187, -2187,  2847,  2847,  2847,  2847,
+     -773,  -773,  -773,  -773,  1630,  1630,  1630,  1630,
+     2143,  2143,  2143,  2143, -2166, -2166, -2166, -2166,
+    -5019, -5019, -5019, -5019,  -243,  -243,  -243,  -243,
+    -3780, -3780, -3780, -3780,  2645,  2645,  2645,  2645,
+     2912,  2912,  2912,  2912,  2969,  2969,  2969,  2969,
+    -4337, -4337, -4337, -4337, -4654, -4654, -4654, -4654,
+      -27,   -27,   -27,   -27,  -420,  -420,  -420,  -420,
+    -2437, -2437, -2437, -2437,  1689,  1689,  1689,  1689,
+    -2401, -2401, -2401, -2401,  2249,  2249,  2249,  2249,
+    -3248, -3248, -3248, -3248,    -3,    -3,    -3,    -3,
+    -4143, -4143, -4143, -4143,  5191,  5191,  5191,  5191,
+     4284,  4284,  4284,  4284,  5195,  5195,  5195,  5195,
+    -2481, -2481, -2481, -2481,  2370,  2370,  2370,  2370,
+    -4096, -4096, -5828, -5828, -3636, -3636,   827,   827,
+     4885,  4885,  -790,  -790,  -476,  -476,  2731,  2731,
+    -6039, -6039, -1212, -1212,  4372,  4372, -2468, -2468,
+     3833,  3833, -4255, -4255, -3186, -3186, -2013, -2013,
+     -404,  -404, -2639, -2639, -4919, -4919,  5374,  5374,
+     2678,  2678, -1062, -1062,  -671,  -671, -4231, -4231,
+    -4976, -4976, -5736, -5736, -2305, -2305,  4989,  4989,
+     -354,  -354, -4320, -4320,  2686,  2686, -5755, -5755,
+    -1912, -1912,  3328,  3328,  1663,  1663,  -118,  -118,
+    -1440, -1440, -3201, -3201,  2178,  2178,  3459,  3459,
+    -2987, -2987, -3542, -3542,  4057,  4057,  -480,  -480,
+    -1067, -1067,   726,   726,  1153,  1153, -5092, -5092,
+    -5277, -5277, -2744, -2744,  -160,  -160, -4452, -4452,
+      242,   242, -3712, -3712,  2399,  2399, -1759, -1759,
+    -5011, -5011,  4043,  4043, -1484, -1484,  4177,  4177,
+     2859,  2859,  4896,  4896,  3510,  3510,  2426,  2426,
+     5444,  5444, -4591, -4591, -2704, -2704,   953,   953,
+     1632,  1632,  1170,  1170,  4905,  4905,  5911,  5911,
+     2566,  2566,  3195,  3195,  4414,  4414,   544,   544,
+      390,   390,  1635,  1635, -2126, -2126, -3241, -3241,
+     1065,  1065, -2625, -2625, -3915, -3915,   130,   130,
+      545,   545, -4805, -4805,  3016,  3016,   355,   355,
+     -875,  -875, -1305, -1305, -4053, -4053,  4278,  4278,
+    -5698, -5698, -3091, -3091, -3978, -3978, -4388, -4388,
+     -435,  -435, -1351, -1351,  1426,  1426,  2197,  2197,
+     3066,  3066, -1326, -1326, -5559, -5559,  -145,  -145,
+     3646,  3646, -3621, -3621, -3364, -3364,  1022,  1022,
+     -442,  -442, -1853, -1853,  4048,  4048, -2881, -2881,
+    -1207, -1207,  2975,  2975,  4437,  4437,  3949,  3949,
+    -4714, -4714, -2747, -2747,  3136,  3136,  3694,  3694,
+     5088,  5088,  1479,  1479, -2780, -2780,  2525,  2525,
+    -5012, -5012, -3051, -3051, -2865, -2865,  1696,  1696,
+      493,   493, -5023, -5023,  4938,  4938, -5767, -5767,
+    -1017, -1017,  -955,  -955, -3531, -3531, -3932, -3932,
+     2422,  2422,  1646,  1646,  2174,  2174,  -339,  -339,
+     3778,  3778, -1177, -1177, -5407, -5407, -3289, -3289,
+     4645,  4645,  4821,  4821,  -113,  -113, -2837, -2837,
+     3704,  3704,  2294,  2294,  3000,  3000, -2548, -2548,
+     1607,  1607, -4134, -4134, -5042, -5042,  5331,  5331,
+     4861,  4861,  1000,  1000,  3247,  3247,  4632,  4632,
+    -1378, -1378, -5777, -5777,  1777,  1777, -2476, -2476,
+    -3763, -3763, -3014, -3014,  1544,  1544,  3637,  3637,
+    -6022, -6022, -3504, -3504,  3271,  3271,  2842,  2842,
+    -5101, -5101,  4611,  4611, -2884, -2884,  2089,  2089,
+    -1168, -1168, -3006, -3006, -3149, -3149,  2396,  2396,
+     1537,  1537,  3135,  3135, -3400, -3400,  3707,  3707,
+    -1002, -1002, -5146, -5146,  4895,  4895, -3584, -3584,
+     1045,  1045,  2963,  2963,  5332,  5332,  -334,  -334,
+     2381,  2381,  5728,  5728, -5291, -5291, -3748, -3748,
+     5084,  5084, -2319, -2319,  3985,  3985,  4890,  4890,
+    -2187, -2187, -5860, -5860,  2847,  2847,  5791,  5791,
+     -773,  -773, -2768, -2768,  1630,  1630,  -729,  -729,
+     2143,  2143,   949,   949, -2166, -2166, -4354, -4354,
+    -5019, -5019, -3553, -3553,  -243,  -243, -3382, -3382,
+    -3780, -3780,  -722,  -722,  2645,  2645, -1673, -1673,
+     2912,  2912,   -81,   -81,  2969,  2969, -1260, -1260,
+    -4337, -4337,  4978,  4978, -4654, -4654,  5067,  5067,
+      -27,   -27,  5086,  5086,  -420,  -420, -5542, -5542,
+    -2437, -2437,  2545,  2545,  1689,  1689,    -9,    -9,
+    -2401, -2401,  -140,  -140,  2249,  2249,  3284,  3284,
+    -3248, -3248,   563,   563,    -3,    -3,  3296,  3296,
+    -4143, -4143,  4846,  4846,  5191,  5191, -5179, -5179,
+     4284,  4284,    -1,    -1,  5195,  5195, -1381, -1381,
+    -2481, -2481, -2366, -2366,  2370,  2370,  1428,  1428,
+    -4096, -1360, -5828,  -975, -3636,  2057,   827,  5315,
+     4885,  1958,  -790,  3482,  -476,   418,  2731,  3643,
+    -6039,  -325, -1212,  4782,  4372,  5868, -2468,  4749,
+     3833,  5257, -4255, -3957, -3186, -2882, -2013,  3988,
+     -404,  1594, -2639,  1956, -4919,  1583,  5374, -2344,
+     2678, -1319, -1062, -5057,  -671, -2767, -4231, -3565,
+    -4976,   652, -5736,  4624, -2305,  3315,  4989, -4536,
+     -354, -5782, -4320,  3174,  2686,  2908, -5755, -3879,
+    -1912, -2555,  3328,  1105,  1663, -1512,  -118,  2169,
+    -1440,  1058, -3201, -3127,  2178, -1293,  3459, -4948,
+    -2987, -3728, -3542,  -504,  4057,   723,  -480,  4449,
+    -1067,  3054,   726,  -431,  1153,  2447, -5092, -5339,
+    -5277,  -168, -2744,   241,  -160,  1483, -4452,  1018,
+      242, -4240, -3712,  4912,  2399, -5876, -1759,   -56,
+    -5011, -4016,  4043, -3602, -1484, -3757,  4177,  2683,
+     2859, -2459,  4896, -6055,  3510, -4115,  2426, -5435,
+     5444, -5297, -4591,  2844, -2704, -3202,   953, -4916,
+     1632,  2078,  1170, -5468,  4905, -5908,  5911, -5862,
+     2566,   948,  3195,  3029,  4414, -5735,   544,  4789,
+      390, -5919,  1635,  2127, -2126, -1954, -3241,   316,
+     1065,  5106, -2625, -6008, -3915, -2500,   130, -1973,
+      545,   709, -4805,  3445,  3016, -3991,   355,  1702,
+     -875, -6099, -1305,  3263, -4053, -4754,  4278, -3860,
+    -5698, -2948, -3091,  2766, -3978, -3529, -4388, -2033,
+     -435,  5184, -1351, -5681,  1426, -5383,  2197, -5079,
+     3066,   922, -1326,  2920, -5559, -4774,  -145,  1728,
+     3646, -5990, -3621,  2302, -3364, -1693,  1022, -3789,
+     -442, -3123, -1853,  2505,  4048,   576, -2881, -6093,
+    -1207, -3329,  2975,  3532,  4437, -1263,  3949, -1041,
+    -4714,   835, -2747,   192,  3136, -2031,  3694, -5206,
+     5088, -2919,  1479,  -421, -2780,  -347,  2525, -3818,
+    -5012,    64, -3051,  -677, -2865,  2361,  1696,  -973,
+      493,  3956, -5023, -4212,  4938, -5369, -5767, -4075,
+    -1017, -4322,  -955,   787, -3531,  3772, -3932,  5415,
+     2422, -1404,  1646, -5886,  2174,  2738,  -339, -5537,
+     3778, -3834, -1177, -2839, -5407,  1805, -3289,  -468,
+     4645, -1962,  4821,  5009,  -113, -5942, -2837, -1278,
+     3704,  3150,  2294,  4698,  3000,  -156, -2548,  -654,
+     1607,  5766, -4134, -6077, -5042,  -426,  5331,  1050,
+     4861,  1566,  1000,   -52,  3247,  -218,  4632,  1922,
+    -1378, -6122, -5777,  -142,  1777,   350, -2476,   522,
+    -3763,  4079, -3014, -4169,  1544,  4737,  3637, -6137,
+    -6022,  4049, -3504,  4213,  3271,   174,  2842,  5456,
+    -5101, -5486,  4611,  1579, -2884, -6142,  2089,  5446,
+    -1168, -2692, -3006,    58, -3149,  5915,  2396, -5925,
+     1537, -3570,  3135,  2049, -3400, -2281,  3707,  3199,
+    -1002, -4077, -5146,  6068,  4895, -1975, -3584, -1190,
+     1045,   683,  2963,  3336,  5332, -3030,  -334, -1359,
+     2381,  6119,  5728,  3438, -5291, -4493, -3748,  4324,
+     5084,  1112, -2319, -1010,  3985,  -453,  4890,  6136,
+    -2187,  1146, -5860, -5594,  2847, -2655,  5791,  4467,
+     -773, -4433, -2768,  -151,  1630, -2051,  -729,   382,
+     2143, -5961,   949,  -885, -2166,  1489, -4354, -5574,
+    -5019,  4046, -3553, -4780,  -243, -3969, -3382, -1987,
+    -3780,  -295,  -722, -3600,  2645, -1858, -1673,  5445,
+     2912,  2503,   -81, -1323,  2969,  3434, -1260,  3998,
+    -4337, -1200,  4978,  3477, -4654,  1815,  5067, -3262,
+      -27,  -441,  5086,  5241,  -420,  5429, -5542,  -400,
+    -2437,  1159,  2545,   605,  1689,  3009,    -9,  -147,
+    -2401,  1747,  -140,  5906,  2249,  3963,  3284, -3710,
+    -3248,  4298,   563,  1003,    -3,   -49,  3296, -3514,
+    -4143,  6065,  4846,  1321,  5191, -5333, -5179,  5529,
+     4284, -3762,    -1,  4080,  5195,  2925, -1381,  6118,
+    -2481, -3656, -2366, -5874,  2370,  1843,  1428, -1254,
+};
+
+const int16_t ntt_red1024_omega_powers_gs_cg[5120] = {
+    -4096, -1360, -5828,  -975, -3636,  2057,   827,  5315,
+     4885,  1958,  -790,  3482,  -476,   418,  2731,  3643,
+    -6039,  -325, -1212,  4782,  4372,  5868, -2468,  4749,
+     3833,  5257, -4255, -3957, -3186, -2882, -2013,  3988,
+     -404,  1594, -2639,  1956, -4919,  1583,  5374, -2344,
+     2678, -1319, -1062, -5057,  -671, -2767, -4231, -3565,
+    -4976,   652, -5736,  4624, -2305,  3315,  4989, -4536,
+     -354, -5782, -4320,  3174,  2686,  2908, -5755, -3879,
+    -1912, -2555,  3328,  1105,  1663, -1512,  -118,  2169,
+    -1440,  1058, -3201, -3127,  2178, -1293,  3459, -4948,
+    -2987, -3728, -3542,  -504,  4057,   723,  -480,  4449,
+    -1067,  3054,   726,  -431,  1153,  2447, -5092, -5339,
+    -5277,  -168, -2744,   241,  -160,  1483, -4452,  1018,
+      242, -4240, -3712,  4912,  2399, -5876, -1759,   -56,
+    -5011, -4016,  4043, -3602, -1484, -3757,  4177,  2683,
+     2859, -2459,  4896, -6055,  3510, -4115,  2426, -5435,
+     5444, -5297, -4591,  2844, -2704, -3202,   953, -4916,
+     1632,  2078,  1170, -5468,  4905, -5908,  5911, -5862,
+     2566,   948,  3195,  3029,  4414, -5735,   544,  4789,
+      390, -5919,  1635,  2127, -2126, -1954, -3241,   316,
+     1065,  5106, -2625, -6008, -3915, -2500,   130, -1973,
+      545,   709, -4805,  3445,  3016, -3991,   355,  1702,
+     -875, -6099, -1305,  3263, -4053, -4754,  4278, -3860,
+    -5698, -2948, -3091,  2766, -3978, -3529, -4388, -2033,
+     -435,  5184, -1351, -5681,  1426, -5383,  2197, -5079,
+     3066,   922, -1326,  2920, -5559, -4774,  -145,  1728,
+     3646, -5990, -3621,  2302, -3364, -1693,  1022, -3789,
+     -442, -3123, -1853,  2505,  4048,   576, -2881, -6093,
+    -1207, -3329,  2975,  3532,  4437, -1263,  3949, -1041,
+    -4714,   835, -2747,   192,  3136, -2031,  3694, -5206,
+     5088, -2919,  1479,  -421, -2780,  -347,  2525, -3818,
+    -5012,    64, -3051,  -677, -2865,  2361,  1696,  -973,
+      493,  3956, -5023, -4212,  4938, -5369, -5767, -4075,
+    -1017, -4322,  -955,   787, -3531,  3772, -3932,  5415,
+     2422, -1404,  1646, -5886,  2174,  2738,  -339, -5537,
+     3778, -3834, -1177, -2839, -5407,  1805, -3289,  -468,
+     4645, -1962,  4821,  5009,  -113, -5942, -2837, -1278,
+     3704,  3150,  2294,  4698,  3000,  -156, -2548,  -654,
+     1607,  5766, -4134, -6077, -5042,  -426,  5331,  1050,
+     4861,  1566,  1000,   -52,  3247,  -218,  4632,  1922,
+    -1378, -6122, -5777,  -142,  1777,   350, -2476,   522,
+    -3763,  4079, -3014, -4169,  1544,  4737,  3637, -6137,
+    -6022,  4049, -3504,  4213,  3271,   174,  2842,  5456,
+    -5101, -5486,  4611,  1579, -2884, -6142,  2089,  5446,
+    -1168, -2692, -3006,    58, -3149,  5915,  2396, -5925,
+     1537, -3570,  3135,  2049, -3400, -2281,  3707,  3199,
+    -1002, -4077, -5146,  6068,  4895, -1975, -3584, -1190,
+     1045,   683,  2963,  3336,  5332, -3030,  -334, -1359,
+     2381,  6119,  5728,  3438, -5291, -4493, -3748,  4324,
+     5084,  1112, -2319, -1010,  3985,  -453,  4890,  6136,
+    -2187,  1146, -5860, -5594,  2847, -2655,  5791,  4467,
+     -773, -4433, -2768,  -151,  1630, -2051,  -729,   382,
+     2143, -5961,   949,  -885, -2166,  1489, -4354, -5574,
+    -5019,  4046, -3553, -4780,  -243, -3969, -3382, -1987,
+    -3780,  -295,  -722, -3600,  2645, -1858, -1673,  5445,
+     2912,  2503,   -81, -1323,  2969,  3434, -1260,  3998,
+    -4337, -1200,  4978,  3477, -4654,  1815,  5067, -3262,
+      -27,  -441,  5086,  5241,  -420,  5429, -5542,  -400,
+    -2437,  1159,  2545,   605,  1689,  3009,    -9,  -147,
+    -2401,  1747,  -140,  5906,  2249,  3963,  3284, -3710,
+    -3248,  4298,   563,  1003,    -3,   -49,  3296, -3514,
+    -4143,  6065,  4846,  1321,  5191, -5333, -5179,  5529,
+     4284, -3762,    -1,  4080,  5195,  2925, -1381,  6118,
+    -2481, -3656, -2366, -5874,  2370,  1843,  1428, -1254,
+    -4096, -4096, -5828, -5828, -3636, -3636,   827,   827,
+     4885,  4885,  -790,  -790,  -476,  -476,  2731,  2731,
+    -6039, -6039, -1212, -1212,  4372,  4372, -2468, -2468,
+     3833,  3833, -4255, -4255, -3186, -3186, -2013, -2013,
+     -404,  -404, -2639, -2639, -4919, -4919,  5374,  5374,
+     2678,  2678, -1062, -1062,  -671,  -671, -4231, -4231,
+    -4976, -4976, -5736, -5736, -2305, -2305,  4989,  4989,
+     -354,  -354, -4320, -4320,  2686,  2686, -5755, -5755,
+    -1912, -1912,  3328,  3328,  1663,  1663,  -118,  -118,
+    -1440, -1440, -3201, -3201,  2178,  2178,  3459,  3459,
+    -2987, -2987, -3542, -3542,  4057,  4057,  -480,  -480,
+    -1067, -1067,   726,   726,  1153,  1153, -5092, -5092,
+    -5277, -5277, -2744, -2744,  -160,  -160, -4452, -4452,
+      242,   242, -3712, -3712,  2399,  2399, -1759, -1759,
+    -5011, -5011,  4043,  4043, -1484, -1484,  4177,  4177,
+     2859,  2859,  4896,  4896,  3510,  3510,  2426,  2426,
+     5444,  5444, -4591, -4591, -2704, -2704,   953,   953,
+     1632,  1632,  1170,  1170,  4905,  4905,  5911,  5911,
+     2566,  2566,  3195,  3195,  4414,  4414,   544,   544,
+      390,   390,  1635,  1635, -2126, -2126, -3241, -3241,
+     1065,  1065, -2625, -2625, -3915, -3915,   130,   130,
+      545,   545, -4805, -4805,  3016,  3016,   355,   355,
+     -875,  -875, -1305, -1305, -4053, -4053,  4278,  4278,
+    -5698, -5698, -3091, -3091, -3978, -3978, -4388, -4388,
+     -435,  -435, -1351, -1351,  1426,  1426,  2197,  2197,
+     3066,  3066, -1326, -1326, -5559, -5559,  -145,  -145,
+     3646,  3646, -3621, -3621, -3364, -3364,  1022,  1022,
+     -442,  -442, -1853, -1853,  4048,  4048, -2881, -2881,
+    -1207, -1207,  2975,  2975,  4437,  4437,  3949,  3949,
+    -4714, -4714, -2747, -2747,  3136,  3136,  3694,  3694,
+     5088,  5088,  1479,  1479, -2780, -2780,  2525,  2525,
+    -5012, -5012, -3051, -3051, -2865, -2865,  1696,  1696,
+      493,   493, -5023, -5023,  4938,  4938, -5767, -5767,
+    -1017, -1017,  -955,  -955, -3531, -3531, -3932, -3932,
+     2422,  2422,  1646,  1646,  2174,  2174,  -339,  -339,
+     3778,  3778, -1177, -1177, -5407, -5407, -3289, -3289,
+     4645,  4645,  4821,  4821,  -113,  -113, -2837, -2837,
+     3704,  3704,  2294,  2294,  3000,  3000, -2548, -2548,
+     1607,  1607, -4134, -4134, -5042, -5042,  5331,  5331,
+     4861,  4861,  1000,  1000,  3247,  3247,  4632,  4632,
+    -1378, -1378, -5777, -5777,  1777,  1777, -2476, -2476,
+    -3763, -3763, -3014, -3014,  1544,  1544,  3637,  3637,
+    -6022, -6022, -3504, -3504,  3271,  3271,  2842,  2842,
+    -5101, -5101,  4611,  4611, -2884, -2884,  2089,  2089,
+    -1168, -1168, -3006, -3006, -3149, -3149,  2396,  2396,
+     1537,  1537,  3135,  3135, -3400, -3400,  3707,  3707,
+    -1002, -1002, -5146, -5146,  4895,  4895, -3584, -3584,
+     1045,  1045,  2963,  2963,  5332,  5332,  -334,  -334,
+     2381,  2381,  5728,  5728, -5291, -5291, -3748, -3748,
+     5084,  5084, -2319, -2319,  3985,  3985,  4890,  4890,
+    -2187, -2187, -5860, -5860,  2847,  2847,  5791,  5791,
+     -773,  -773, -2768, -2768,  1630,  1630,  -729,  -729,
+     2143,  2143,   949,   949, -2166, -2166, -4354, -4354,
+    -5019, -5019, -3553, -3553,  -243,  -243, -3382, -3382,
+    -3780, -3780,  -722,  -722,  2645,  2645, -1673, -1673,
+     2912,  2912,   -81,   -81,  2969,  2969, -1260, -1260,
+    -4337, -4337,  4978,  4978, -4654, -4654,  5067,  5067,
+      -27,   -27,  5086,  5086,  -420,  -420, -5542, -5542,
+    -2437, -2437,  2545,  2545,  1689,  1689,    -9,    -9,
+    -2401, -2401,  -140,  -140,  2249,  2249,  3284,  3284,
+    -3248, -3248,   563,   563,    -3,    -3,  3296,  3296,
+    -4143, -4143,  4846,  4846,  5191,  5191, -5179, -5179,
+     4284,  4284,    -1,    -1,  5195,  5195, -1381, -1381,
+    -2481, -2481, -2366, -2366,  2370,  2370,  1428,  1428,
+    -4096, -4096, -4096, -4096, -3636, -3636, -3636, -3636,
+     4885,  4885,  4885,  4885,  -476,  -476,  -476,  -476,
+    -6039, -6039, -6039, -6039,  4372,  4372,  4372,  4372,
+     3833,  3833,  3833,  3833, -3186, -3186, -3186, -3186,
+     -404,  -404,  -404,  -404, -4919, -4919, -4919, -4919,
+     2678,  2678,  2678,  2678,  -671,  -671,  -671,  -671,
+    -4976, -4976, -4976, -4976, -2305, -2305, -2305, -2305,
+     -354,  -354,  -354,  -354,  2686,  2686,  2686,  2686,
+    -1912, -1912, -1912, -1912,  1663,  1663,  1663,  1663,
+    -1440, -1440, -1440, -1440,  2178,  2178,  2178,  2178,
+    -2987, -2987, -2987, -2987,  4057,  4057,  4057,  4057,
+    -1067, -1067, -1067, -1067,  1153,  1153,  1153,  1153,
+    -5277, -5277, -5277, -5277,  -160,  -160,  -160,  -160,
+      242,   242,   242,   242,  2399,  2399,  2399,  2399,
+    -5011, -5011, -5011, -5011, -1484, -1484, -1484, -1484,
+     2859,  2859,  2859,  2859,  3510,  3510,  3510,  3510,
+     5444,  5444,  5444,  5444, -2704, -2704, -2704, -2704,
+     1632,  1632,  1632,  1632,  4905,  4905,  4905,  4905,
+     2566,  2566,  2566,  2566,  4414,  4414,  4414,  4414,
+      390,   390,   390,   390, -2126, -2126, -2126, -2126,
+     1065,  1065,  1065,  1065, -3915, -3915, -3915, -3915,
+      545,   545,   545,   545,  3016,  3016,  3016,  3016,
+     -875,  -875,  -875,  -875, -4053, -4053, -4053, -4053,
+    -5698, -5698, -5698, -5698, -3978, -3978, -3978, -3978,
+     -435,  -435,  -435,  -435,  1426,  1426,  1426,  1426,
+     3066,  3066,  3066,  3066, -5559, -5559, -5559, -5559,
+     3646,  3646,  3646,  3646, -3364, -3364, -3364, -3364,
+     -442,  -442,  -442,  -442,  4048,  4048,  4048,  4048,
+    -1207, -1207, -1207, -1207,  4437,  4437,  4437,  4437,
+    -4714, -4714, -4714, -4714,  3136,  3136,  3136,  3136,
+     5088,  5088,  5088,  5088, -2780, -2780, -2780, -2780,
+    -5012, -5012, -5012, -5012, -2865, -2865, -2865, -2865,
+      493,   493,   493,   493,  4938,  4938,  4938,  4938,
+    -1017, -1017, -1017, -1017, -3531, -3531, -3531, -3531,
+     2422,  2422,  2422,  2422,  2174,  2174,  2174,  2174,
+     3778,  3778,  3778,  3778, -5407, -5407, -5407, -5407,
+     4645,  4645,  4645,  4645,  -113,  -113,  -113,  -113,
+     3704,  3704,  3704,  3704,  3000,  3000,  3000,  3000,
+     1607,  1607,  1607,  1607, -5042, -5042, -5042, -5042,
+     4861,  4861,  4861,  4861,  3247,  3247,  3247,  3247,
+    -1378, -1378, -1378, -1378,  1777,  1777,  1777,  1777,
+    -3763, -3763, -3763, -3763,  1544,  1544,  1544,  1544,
+    -6022, -6022, -6022, -6022,  3271,  3271,  3271,  3271,
+    -5101, -5101, -5101, -5101, -2884, -2884, -2884, -2884,
+    -1168, -1168, -1168, -1168, -3149, -3149, -3149, -3149,
+     1537,  1537,  1537,  1537, -3400, -3400, -3400, -3400,
+    -1002, -1002, -1002, -1002,  4895,  4895,  4895,  4895,
+     1045,  1045,  1045,  1045,  5332,  5332,  5332,  5332,
+     2381,  2381,  2381,  2381, -5291, -5291, -5291, -5291,
+     5084,  5084,  5084,  5084,  3985,  3985,  3985,  3985,
+    -2187, -2187, -2187, -2187,  2847,  2847,  2847,  2847,
+     -773,  -773,  -773,  -773,  1630,  1630,  1630,  1630,
+     2143,  2143,  2143,  2143, -2166, -2166, -2166, -2166,
+    -5019, -5019, -5019, -5019,  -243,  -243,  -243,  -243,
+    -3780, -3780, -3780, -3780,  2645,  2645,  2645,  2645,
+     2912,  2912,  2912,  2912,  2969,  2969,  2969,  2969,
+    -4337, -4337, -4337, -4337, -4654, -4654, -4654, -4654,
+      -27,   -27,   -27,   -27,  -420,  -420,  -420,  -420,
+    -2437, -2437, -2437, -2437,  1689,  1689,  1689,  1689,
+    -2401, -2401, -2401, -2401,  2249,  2249,  2249,  2249,
+    -3248, -3248, -3248, -3248,    -3,    -3,    -3,    -3,
+    -4143, -4143, -4143, -4143,  5191,  5191,  5191,  5191,
+     4284,  4284,  4284,  4284,  5195,  5195,  5195,  5195,
+    -2481, -2481, -2481, -2481,  2370,  2370,  2370,  2370,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4885,  4885,  4885,  4885,  4885,  4885,  4885,  4885,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+     3833,  3833,  3833,  3833,  3833,  3833,  3833,  3833,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     2678,  2678,  2678,  2678,  2678,  2678,  2678,  2678,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+     -354,  -354,  -354,  -354,  -354,  -354,  -354,  -354,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1440, -1440, -1440, -1440, -1440, -1440, -1440, -1440,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -1067, -1067, -1067, -1067, -1067, -1067, -1067, -1067,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+      242,   242,   242,   242,   242,   242,   242,   242,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     2859,  2859,  2859,  2859,  2859,  2859,  2859,  2859,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1632,  1632,  1632,  1632,  1632,  1632,  1632,  1632,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+      390,   390,   390,   390,   390,   390,   390,   390,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+      545,   545,   545,   545,   545,   545,   545,   545,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+    -5698, -5698, -5698, -5698, -5698, -5698, -5698, -5698,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     3066,  3066,  3066,  3066,  3066,  3066,  3066,  3066,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     -442,  -442,  -442,  -442,  -442,  -442,  -442,  -442,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -4714, -4714, -4714, -4714, -4714, -4714, -4714, -4714,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+    -5012, -5012, -5012, -5012, -5012, -5012, -5012, -5012,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1017, -1017, -1017, -1017, -1017, -1017, -1017, -1017,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     3778,  3778,  3778,  3778,  3778,  3778,  3778,  3778,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     4861,  4861,  4861,  4861,  4861,  4861,  4861,  4861,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -3763, -3763, -3763, -3763, -3763, -3763, -3763, -3763,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -5101, -5101, -5101, -5101, -5101, -5101, -5101, -5101,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     1537,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     1045,  1045,  1045,  1045,  1045,  1045,  1045,  1045,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     5084,  5084,  5084,  5084,  5084,  5084,  5084,  5084,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+     -773,  -773,  -773,  -773,  -773,  -773,  -773,  -773,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -5019, -5019, -5019, -5019, -5019, -5019, -5019, -5019,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+     2912,  2912,  2912,  2912,  2912,  2912,  2912,  2912,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+      -27,   -27,   -27,   -27,   -27,   -27,   -27,   -27,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2401, -2401, -2401, -2401, -2401, -2401, -2401, -2401,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4143, -4143, -4143, -4143, -4143, -4143, -4143, -4143,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+    -2481, -2481, -2481, -2481, -2481, -2481, -2481, -2481,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red1024_omega_powers_rev_ct_cg[5120] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+};
+
+const int16_t ntt_red1024_omega_powers_rev_gs_cg[5120] = {
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_ct_cg[5120] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     2481,  2481,  2481,  2481,  2481,  2481,  2481,  2481,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     4143,  4143,  4143,  4143,  4143,  4143,  4143,  4143,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     2401,  2401,  2401,  2401,  2401,  2401,  2401,  2401,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+       27,    27,    27,    27,    27,    27,    27,    27,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2912, -2912, -2912, -2912, -2912, -2912, -2912, -2912,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     5019,  5019,  5019,  5019,  5019,  5019,  5019,  5019,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+      773,   773,   773,   773,   773,   773,   773,   773,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -5084, -5084, -5084, -5084, -5084, -5084, -5084, -5084,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+    -1537, -1537, -1537, -1537, -1537, -1537, -1537, -1537,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     5101,  5101,  5101,  5101,  5101,  5101,  5101,  5101,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     3763,  3763,  3763,  3763,  3763,  3763,  3763,  3763,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4861, -4861, -4861, -4861, -4861, -4861, -4861, -4861,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -3704, -3704, -3704, -3704, -3704, -3704, -3704, -3704,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -3778, -3778, -3778, -3778, -3778, -3778, -3778, -3778,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+     1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+     4714,  4714,  4714,  4714,  4714,  4714,  4714,  4714,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      442,   442,   442,   442,   442,   442,   442,   442,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3066, -3066, -3066, -3066, -3066, -3066, -3066, -3066,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     5698,  5698,  5698,  5698,  5698,  5698,  5698,  5698,
+      875,   875,   875,   875,   875,   875,   875,   875,
+     -545,  -545,  -545,  -545,  -545,  -545,  -545,  -545,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     -390,  -390,  -390,  -390,  -390,  -390,  -390,  -390,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -1632, -1632, -1632, -1632, -1632, -1632, -1632, -1632,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -2859, -2859, -2859, -2859, -2859, -2859, -2859, -2859,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1067,  1067,  1067,  1067,  1067,  1067,  1067,  1067,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1440,  1440,  1440,  1440,  1440,  1440,  1440,  1440,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      354,   354,   354,   354,   354,   354,   354,   354,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+    -2678, -2678, -2678, -2678, -2678, -2678, -2678, -2678,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -3833, -3833, -3833, -3833, -3833, -3833, -3833, -3833,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -4885, -4885, -4885, -4885, -4885, -4885, -4885, -4885,
+    -4096, -4096, -4096, -4096, -2370, -2370, -2370, -2370,
+     2481,  2481,  2481,  2481, -5195, -5195, -5195, -5195,
+    -4284, -4284, -4284, -4284, -5191, -5191, -5191, -5191,
+     4143,  4143,  4143,  4143,     3,     3,     3,     3,
+     3248,  3248,  3248,  3248, -2249, -2249, -2249, -2249,
+     2401,  2401,  2401,  2401, -1689, -1689, -1689, -1689,
+     2437,  2437,  2437,  2437,   420,   420,   420,   420,
+       27,    27,    27,    27,  4654,  4654,  4654,  4654,
+     4337,  4337,  4337,  4337, -2969, -2969, -2969, -2969,
+    -2912, -2912, -2912, -2912, -2645, -2645, -2645, -2645,
+     3780,  3780,  3780,  3780,   243,   243,   243,   243,
+     5019,  5019,  5019,  5019,  2166,  2166,  2166,  2166,
+    -2143, -2143, -2143, -2143, -1630, -1630, -1630, -1630,
+      773,   773,   773,   773, -2847, -2847, -2847, -2847,
+     2187,  2187,  2187,  2187, -3985, -3985, -3985, -3985,
+    -5084, -5084, -5084, -5084,  5291,  5291,  5291,  5291,
+    -2381, -2381, -2381, -2381, -5332, -5332, -5332, -5332,
+    -1045, -1045, -1045, -1045, -4895, -4895, -4895, -4895,
+     1002,  1002,  1002,  1002,  3400,  3400,  3400,  3400,
+    -1537, -1537, -1537, -1537,  3149,  3149,  3149,  3149,
+     1168,  1168,  1168,  1168,  2884,  2884,  2884,  2884,
+     5101,  5101,  5101,  5101, -3271, -3271, -3271, -3271,
+     6022,  6022,  6022,  6022, -1544, -1544, -1544, -1544,
+     3763,  3763,  3763,  3763, -1777, -1777, -1777, -1777,
+     1378,  1378,  1378,  1378, -3247, -3247, -3247, -3247,
+    -4861, -4861, -4861, -4861,  5042,  5042,  5042,  5042,
+    -1607, -1607, -1607, -1607, -3000, -3000, -3000, -3000,
+    -3704, -3704, -3704, -3704,   113,   113,   113,   113,
+    -4645, -4645, -4645, -4645,  5407,  5407,  5407,  5407,
+    -3778, -3778, -3778, -3778, -2174, -2174, -2174, -2174,
+    -2422, -2422, -2422, -2422,  3531,  3531,  3531,  3531,
+     1017,  1017,  1017,  1017, -4938, -4938, -4938, -4938,
+     -493,  -493,  -493,  -493,  2865,  2865,  2865,  2865,
+     5012,  5012,  5012,  5012,  2780,  2780,  2780,  2780,
+    -5088, -5088, -5088, -5088, -3136, -3136, -3136, -3136,
+     4714,  4714,  4714,  4714, -4437, -4437, -4437, -4437,
+     1207,  1207,  1207,  1207, -4048, -4048, -4048, -4048,
+      442,   442,   442,   442,  3364,  3364,  3364,  3364,
+    -3646, -3646, -3646, -3646,  5559,  5559,  5559,  5559,
+    -3066, -3066, -3066, -3066, -1426, -1426, -1426, -1426,
+      435,   435,   435,   435,  3978,  3978,  3978,  3978,
+     5698,  5698,  5698,  5698,  4053,  4053,  4053,  4053,
+      875,   875,   875,   875, -3016, -3016, -3016, -3016,
+     -545,  -545,  -545,  -545,  3915,  3915,  3915,  3915,
+    -1065, -1065, -1065, -1065,  2126,  2126,  2126,  2126,
+     -390,  -390,  -390,  -390, -4414, -4414, -4414, -4414,
+    -2566, -2566, -2566, -2566, -4905, -4905, -4905, -4905,
+    -1632, -1632, -1632, -1632,  2704,  2704,  2704,  2704,
+    -5444, -5444, -5444, -5444, -3510, -3510, -3510, -3510,
+    -2859, -2859, -2859, -2859,  1484,  1484,  1484,  1484,
+     5011,  5011,  5011,  5011, -2399, -2399, -2399, -2399,
+     -242,  -242,  -242,  -242,   160,   160,   160,   160,
+     5277,  5277,  5277,  5277, -1153, -1153, -1153, -1153,
+     1067,  1067,  1067,  1067, -4057, -4057, -4057, -4057,
+     2987,  2987,  2987,  2987, -2178, -2178, -2178, -2178,
+     1440,  1440,  1440,  1440, -1663, -1663, -1663, -1663,
+     1912,  1912,  1912,  1912, -2686, -2686, -2686, -2686,
+      354,   354,   354,   354,  2305,  2305,  2305,  2305,
+     4976,  4976,  4976,  4976,   671,   671,   671,   671,
+    -2678, -2678, -2678, -2678,  4919,  4919,  4919,  4919,
+      404,   404,   404,   404,  3186,  3186,  3186,  3186,
+    -3833, -3833, -3833, -3833, -4372, -4372, -4372, -4372,
+     6039,  6039,  6039,  6039,   476,   476,   476,   476,
+    -4885, -4885, -4885, -4885,  3636,  3636,  3636,  3636,
+    -4096, -4096, -1428, -1428, -2370, -2370,  2366,  2366,
+     2481,  2481,  1381,  1381, -5195, -5195,     1,     1,
+    -4284, -4284,  5179,  5179, -5191, -5191, -4846, -4846,
+     4143,  4143, -3296, -3296,     3,     3,  -563,  -563,
+     3248,  3248, -3284, -3284, -2249, -2249,   140,   140,
+     2401,  2401,     9,     9, -1689, -1689, -2545, -2545,
+     2437,  2437,  5542,  5542,   420,   420, -5086, -5086,
+       27,    27, -5067, -5067,  4654,  4654, -4978, -4978,
+     4337,  4337,  1260,  1260, -2969, -2969,    81,    81,
+    -2912, -2912,  1673,  1673, -2645, -2645,   722,   722,
+     3780,  3780,  3382,  3382,   243,   243,  3553,  3553,
+     5019,  5019,  4354,  4354,  2166,  2166,  -949,  -949,
+    -2143, -2143,   729,   729, -1630, -1630,  2768,  2768,
+      773,   773, -5791, -5791, -2847, -2847,  5860,  5860,
+     2187,  2187, -4890, -4890, -3985, -3985,  2319,  2319,
+    -5084, -5084,  3748,  3748,  5291,  5291, -5728, -5728,
+    -2381, -2381,   334,   334, -5332, -5332, -2963, -2963,
+    -1045, -1045,  3584,  3584, -4895, -4895,  5146,  5146,
+     1002,  1002, -3707, -3707,  3400,  3400, -3135, -3135,
+    -1537, -1537, -2396, -2396,  3149,  3149,  3006,  3006,
+     1168,  1168, -2089, -2089,  2884,  2884, -4611, -4611,
+     5101,  5101, -2842, -2842, -3271, -3271,  3504,  3504,
+     6022,  6022, -3637, -3637, -1544, -1544,  3014,  3014,
+     3763,  3763,  2476,  2476, -1777, -1777,  5777,  5777,
+     1378,  1378, -4632, -4632, -3247, -3247, -1000, -1000,
+    -4861, -4861, -5331, -5331,  5042,  5042,  4134,  4134,
+    -1607, -1607,  2548,  2548, -3000, -3000, -2294, -2294,
+    -3704, -3704,  2837,  2837,   113,   113, -4821, -4821,
+    -4645, -4645,  3289,  3289,  5407,  5407,  1177,  1177,
+    -3778, -3778,   339,   339, -2174, -2174, -1646, -1646,
+    -2422, -2422,  3932,  3932,  3531,  3531,   955,   955,
+     1017,  1017,  5767,  5767, -4938, -4938,  5023,  5023,
+     -493,  -493, -1696, -1696,  2865,  2865,  3051,  3051,
+     5012,  5012, -2525, -2525,  2780,  2780, -1479, -1479,
+    -5088, -5088, -3694, -3694, -3136, -3136,  2747,  2747,
+     4714,  4714, -3949, -3949, -4437, -4437, -2975, -2975,
+     1207,  1207,  2881,  2881, -4048, -4048,  1853,  1853,
+      442,   442, -1022, -1022,  3364,  3364,  3621,  3621,
+    -3646, -3646,   145,   145,  5559,  5559,  1326,  1326,
+    -3066, -3066, -2197, -2197, -1426, -1426,  1351,  1351,
+      435,   435,  4388,  4388,  3978,  3978,  3091,  3091,
+     5698,  5698, -4278, -4278,  4053,  4053,  1305,  1305,
+      875,   875,  -355,  -355, -3016, -3016,  4805,  4805,
+     -545,  -545,  -130,  -130,  3915,  3915,  2625,  2625,
+    -1065, -1065,  3241,  3241,  2126,  2126, -1635, -1635,
+     -390,  -390,  -544,  -544, -4414, -4414, -3195, -3195,
+    -2566, -2566, -5911, -5911, -4905, -4905, -1170, -1170,
+    -1632, -1632,  -953,  -953,  2704,  2704,  4591,  4591,
+    -5444, -5444, -2426, -2426, -3510, -3510, -4896, -4896,
+    -2859, -2859, -4177, -4177,  1484,  1484, -4043, -4043,
+     5011,  5011,  1759,  1759, -2399, -2399,  3712,  3712,
+     -242,  -242,  4452,  4452,   160,   160,  2744,  2744,
+     5277,  5277,  5092,  5092, -1153, -1153,  -726,  -726,
+     1067,  1067,   480,   480, -4057, -4057,  3542,  3542,
+     2987,  2987, -3459, -3459, -2178, -2178,  3201,  3201,
+     1440,  1440,   118,   118, -1663, -1663, -3328, -3328,
+     1912,  1912,  5755,  5755, -2686, -2686,  4320,  4320,
+      354,   354, -4989, -4989,  2305,  2305,  5736,  5736,
+     4976,  4976,  4231,  4231,   671,   671,  1062,  1062,
+    -2678, -2678, -5374, -5374,  4919,  4919,  2639,  2639,
+      404,   404,  2013,  2013,  3186,  3186,  4255,  4255,
+    -3833, -3833,  2468,  2468, -4372, -4372,  1212,  1212,
+     6039,  6039, -2731, -2731,   476,   476,   790,   790,
+    -4885, -4885,  -827,  -827,  3636,  3636,  5828,  5828,
+    -4096,  1254, -1428, -1843, -2370,  5874,  2366,  3656,
+     2481, -6118,  1381, -2925, -5195, -4080,     1,  3762,
+    -4284, -5529,  5179,  5333, -5191, -1321, -4846, -6065,
+     4143,  3514, -3296,    49,     3, -1003,  -563, -4298,
+     3248,  3710, -3284, -3963, -2249, -5906,   140, -1747,
+     2401,   147,     9, -3009, -1689,  -605, -2545, -1159,
+     2437,   400,  5542, -5429,   420, -5241, -5086,   441,
+       27,  3262, -5067, -1815,  4654, -3477, -4978,  1200,
+     4337, -3998,  1260, -3434, -2969,  1323,    81, -2503,
+    -2912, -5445,  1673,  1858, -2645,  3600,   722,   295,
+     3780,  1987,  3382,  3969,   243,  4780,  3553, -4046,
+     5019,  5574,  4354, -1489,  2166,   885,  -949,  5961,
+    -2143,  -382,   729,  2051, -1630,   151,  2768,  4433,
+      773, -4467, -5791,  2655, -2847,  5594,  5860, -1146,
+     2187, -6136, -4890,   453, -3985,  1010,  2319, -1112,
+    -5084, -4324,  3748,  4493,  5291, -3438, -5728, -6119,
+    -2381,  1359,   334,  3030, -5332, -3336, -2963,  -683,
+    -1045,  1190,  3584,  1975, -4895, -6068,  5146,  4077,
+     1002, -3199, -3707,  2281,  3400, -2049, -3135,  3570,
+    -1537,  5925, -2396, -5915,  3149,   -58,  3006,  2692,
+     1168, -5446, -2089,  6142,  2884, -1579, -4611,  5486,
+     5101, -5456, -2842,  -174, -3271, -4213,  3504, -4049,
+     6022,  6137, -3637, -4737, -1544,  4169,  3014, -4079,
+     3763,  -522,  2476,  -350, -1777,   142,  5777,  6122,
+     1378, -1922, -4632,   218, -3247,    52, -1000, -1566,
+    -4861, -1050, -5331,   426,  5042,  6077,  4134, -5766,
+    -1607,   654,  2548,   156, -3000, -4698, -2294, -3150,
+    -3704,  1278,  2837,  5942,   113, -5009, -4821,  1962,
+    -4645,   468,  3289, -1805,  5407,  2839,  1177,  3834,
+    -3778,  5537,   339, -2738, -2174,  5886, -1646,  1404,
+    -2422, -5415,  3932, -3772,  3531,  -787,   955,  4322,
+     1017,  4075,  5767,  5369, -4938,  4212,  5023, -3956,
+     -493,   973, -1696, -2361,  2865,   677,  3051,   -64,
+     5012,  3818, -2525,   347,  2780,   421, -1479,  2919,
+    -5088,  5206, -3694,  2031, -3136,  -192,  2747,  -835,
+     4714,  1041, -3949,  1263, -4437, -3532, -2975,  3329,
+     1207,  6093,  2881,  -576, -4048, -2505,  1853,  3123,
+      442,  3789, -1022,  1693,  3364, -2302,  3621,  5990,
+    -3646, -1728,   145,  4774,  5559, -2920,  1326,  -922,
+    -3066,  5079, -2197,  5383, -1426,  5681,  1351, -5184,
+      435,  2033,  4388,  3529,  3978, -2766,  3091,  2948,
+     5698,  3860, -4278,  4754,  4053, -3263,  1305,  6099,
+      875, -1702,  -355,  3991, -3016, -3445,  4805,  -709,
+     -545,  1973,  -130,  2500,  3915,  6008,  2625, -5106,
+    -1065,  -316,  3241,  1954,  2126, -2127, -1635,  5919,
+     -390, -4789,  -544,  5735, -4414, -3029, -3195,  -948,
+    -2566,  5862, -5911,  5908, -4905,  5468, -1170, -2078,
+    -1632,  4916,  -953,  3202,  2704, -2844,  4591,  5297,
+    -5444,  5435, -2426,  4115, -3510,  6055, -4896,  2459,
+    -2859, -2683, -4177,  3757,  1484,  3602, -4043,  4016,
+     5011,    56,  1759,  5876, -2399, -4912,  3712,  4240,
+     -242, -1018,  4452, -1483,   160,  -241,  2744,   168,
+     5277,  5339,  5092, -2447, -1153,   431,  -726, -3054,
+     1067, -4449,   480,  -723, -4057,   504,  3542,  3728,
+     2987,  4948, -3459,  1293, -2178,  3127,  3201, -1058,
+     1440, -2169,   118,  1512, -1663, -1105, -3328,  2555,
+     1912,  3879,  5755, -2908, -2686, -3174,  4320,  5782,
+      354,  4536, -4989, -3315,  2305, -4624,  5736,  -652,
+     4976,  3565,  4231,  2767,   671,  5057,  1062,  1319,
+    -2678,  2344, -5374, -1583,  4919, -1956,  2639, -1594,
+      404, -3988,  2013,  2882,  3186,  3957,  4255, -5257,
+    -3833, -4749,  2468, -5868, -4372, -4782,  1212,   325,
+     6039, -3643, -2731,  -418,   476, -3482,   790, -1958,
+    -4885, -5315,  -827, -2057,  3636,   975,  5828,  1360,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_gs_cg[5120] = {
+    -4096,  1254, -1428, -1843, -2370,  5874,  2366,  3656,
+     2481, -6118,  1381, -2925, -5195, -4080,     1,  3762,
+    -4284, -5529,  5179,  5333, -5191, -1321, -4846, -6065,
+     4143,  3514, -3296,    49,     3, -1003,  -563, -4298,
+     3248,  3710, -3284, -3963, -2249, -5906,   140, -1747,
+     2401,   147,     9, -3009, -1689,  -605, -2545, -1159,
+     2437,   400,  5542, -5429,   420, -5241, -5086,   441,
+       27,  3262, -5067, -1815,  4654, -3477, -4978,  1200,
+     4337, -3998,  1260, -3434, -2969,  1323,    81, -2503,
+    -2912, -5445,  1673,  1858, -2645,  3600,   722,   295,
+     3780,  1987,  3382,  3969,   243,  4780,  3553, -4046,
+     5019,  5574,  4354, -1489,  2166,   885,  -949,  5961,
+    -2143,  -382,   729,  2051, -1630,   151,  2768,  4433,
+      773, -4467, -5791,  2655, -2847,  5594,  5860, -1146,
+     2187, -6136, -4890,   453, -3985,  1010,  2319, -1112,
+    -5084, -4324,  3748,  4493,  5291, -3438, -5728, -6119,
+    -2381,  1359,   334,  3030, -5332, -3336, -2963,  -683,
+    -1045,  1190,  3584,  1975, -4895, -6068,  5146,  4077,
+     1002, -3199, -3707,  2281,  3400, -2049, -3135,  3570,
+    -1537,  5925, -2396, -5915,  3149,   -58,  3006,  2692,
+     1168, -5446, -2089,  6142,  2884, -1579, -4611,  5486,
+     5101, -5456, -2842,  -174, -3271, -4213,  3504, -4049,
+     6022,  6137, -3637, -4737, -1544,  4169,  3014, -4079,
+     3763,  -522,  2476,  -350, -1777,   142,  5777,  6122,
+     1378, -1922, -4632,   218, -3247,    52, -1000, -1566,
+    -4861, -1050, -5331,   426,  5042,  6077,  4134, -5766,
+    -1607,   654,  2548,   156, -3000, -4698, -2294, -3150,
+    -3704,  1278,  2837,  5942,   113, -5009, -4821,  1962,
+    -4645,   468,  3289, -1805,  5407,  2839,  1177,  3834,
+    -3778,  5537,   339, -2738, -2174,  5886, -1646,  1404,
+    -2422, -5415,  3932, -3772,  3531,  -787,   955,  4322,
+     1017,  4075,  5767,  5369, -4938,  4212,  5023, -3956,
+     -493,   973, -1696, -2361,  2865,   677,  3051,   -64,
+     5012,  3818, -2525,   347,  2780,   421, -1479,  2919,
+    -5088,  5206, -3694,  2031, -3136,  -192,  2747,  -835,
+     4714,  1041, -3949,  1263, -4437, -3532, -2975,  3329,
+     1207,  6093,  2881,  -576, -4048, -2505,  1853,  3123,
+      442,  3789, -1022,  1693,  3364, -2302,  3621,  5990,
+    -3646, -1728,   145,  4774,  5559, -2920,  1326,  -922,
+    -3066,  5079, -2197,  5383, -1426,  5681,  1351, -5184,
+      435,  2033,  4388,  3529,  3978, -2766,  3091,  2948,
+     5698,  3860, -4278,  4754,  4053, -3263,  1305,  6099,
+      875, -1702,  -355,  3991, -3016, -3445,  4805,  -709,
+     -545,  1973,  -130,  2500,  3915,  6008,  2625, -5106,
+    -1065,  -316,  3241,  1954,  2126, -2127, -1635,  5919,
+     -390, -4789,  -544,  5735, -4414, -3029, -3195,  -948,
+    -2566,  5862, -5911,  5908, -4905,  5468, -1170, -2078,
+    -1632,  4916,  -953,  3202,  2704, -2844,  4591,  5297,
+    -5444,  5435, -2426,  4115, -3510,  6055, -4896,  2459,
+    -2859, -2683, -4177,  3757,  1484,  3602, -4043,  4016,
+     5011,    56,  1759,  5876, -2399, -4912,  3712,  4240,
+     -242, -1018,  4452, -1483,   160,  -241,  2744,   168,
+     5277,  5339,  5092, -2447, -1153,   431,  -726, -3054,
+     1067, -4449,   480,  -723, -4057,   504,  3542,  3728,
+     2987,  4948, -3459,  1293, -2178,  3127,  3201, -1058,
+     1440, -2169,   118,  1512, -1663, -1105, -3328,  2555,
+     1912,  3879,  5755, -2908, -2686, -3174,  4320,  5782,
+      354,  4536, -4989, -3315,  2305, -4624,  5736,  -652,
+     4976,  3565,  4231,  2767,   671,  5057,  1062,  1319,
+    -2678,  2344, -5374, -1583,  4919, -1956,  2639, -1594,
+      404, -3988,  2013,  2882,  3186,  3957,  4255, -5257,
+    -3833, -4749,  2468, -5868, -4372, -4782,  1212,   325,
+     6039, -3643, -2731,  -418,   476, -3482,   790, -1958,
+    -4885, -5315,  -827, -2057,  3636,   975,  5828,  1360,
+    -4096, -4096, -1428, -1428, -2370, -2370,  2366,  2366,
+     2481,  2481,  1381,  1381, -5195, -5195,     1,     1,
+    -4284, -4284,  5179,  5179, -5191, -5191, -4846, -4846,
+     4143,  4143, -3296, -3296,     3,     3,  -563,  -563,
+     3248,  3248, -3284, -3284, -2249, -2249,   140,   140,
+     2401,  2401,     9,     9, -1689, -1689, -2545, -2545,
+     2437,  2437,  5542,  5542,   420,   420, -5086, -5086,
+       27,    27, -5067, -5067,  4654,  4654, -4978, -4978,
+     4337,  4337,  1260,  1260, -2969, -2969,    81,    81,
+    -2912, -2912,  1673,  1673, -2645, -2645,   722,   722,
+     3780,  3780,  3382,  3382,   243,   243,  3553,  3553,
+     5019,  5019,  4354,  4354,  2166,  2166,  -949,  -949,
+    -2143, -2143,   729,   729, -1630, -1630,  2768,  2768,
+      773,   773, -5791, -5791, -2847, -2847,  5860,  5860,
+     2187,  2187, -4890, -4890, -3985, -3985,  2319,  2319,
+    -5084, -5084,  3748,  3748,  5291,  5291, -5728, -5728,
+    -2381, -2381,   334,   334, -5332, -5332, -2963, -2963,
+    -1045, -1045,  3584,  3584, -4895, -4895,  5146,  5146,
+     1002,  1002, -3707, -3707,  3400,  3400, -3135, -3135,
+    -1537, -1537, -2396, -2396,  3149,  3149,  3006,  3006,
+     1168,  1168, -2089, -2089,  2884,  2884, -4611, -4611,
+     5101,  5101, -2842, -2842, -3271, -3271,  3504,  3504,
+     6022,  6022, -3637, -3637, -1544, -1544,  3014,  3014,
+     3763,  3763,  2476,  2476, -1777, -1777,  5777,  5777,
+     1378,  1378, -4632, -4632, -3247, -3247, -1000, -1000,
+    -4861, -4861, -5331, -5331,  5042,  5042,  4134,  4134,
+    -1607, -1607,  2548,  2548, -3000, -3000, -2294, -2294,
+    -3704, -3704,  2837,  2837,   113,   113, -4821, -4821,
+    -4645, -4645,  3289,  3289,  5407,  5407,  1177,  1177,
+    -3778, -3778,   339,   339, -2174, -2174, -1646, -1646,
+    -2422, -2422,  3932,  3932,  3531,  3531,   955,   955,
+     1017,  1017,  5767,  5767, -4938, -4938,  5023,  5023,
+     -493,  -493, -1696, -1696,  2865,  2865,  3051,  3051,
+     5012,  5012, -2525, -2525,  2780,  2780, -1479, -1479,
+    -5088, -5088, -3694, -3694, -3136, -3136,  2747,  2747,
+     4714,  4714, -3949, -3949, -4437, -4437, -2975, -2975,
+     1207,  1207,  2881,  2881, -4048, -4048,  1853,  1853,
+      442,   442, -1022, -1022,  3364,  3364,  3621,  3621,
+    -3646, -3646,   145,   145,  5559,  5559,  1326,  1326,
+    -3066, -3066, -2197, -2197, -1426, -1426,  1351,  1351,
+      435,   435,  4388,  4388,  3978,  3978,  3091,  3091,
+     5698,  5698, -4278, -4278,  4053,  4053,  1305,  1305,
+      875,   875,  -355,  -355, -3016, -3016,  4805,  4805,
+     -545,  -545,  -130,  -130,  3915,  3915,  2625,  2625,
+    -1065, -1065,  3241,  3241,  2126,  2126, -1635, -1635,
+     -390,  -390,  -544,  -544, -4414, -4414, -3195, -3195,
+    -2566, -2566, -5911, -5911, -4905, -4905, -1170, -1170,
+    -1632, -1632,  -953,  -953,  2704,  2704,  4591,  4591,
+    -5444, -5444, -2426, -2426, -3510, -3510, -4896, -4896,
+    -2859, -2859, -4177, -4177,  1484,  1484, -4043, -4043,
+     5011,  5011,  1759,  1759, -2399, -2399,  3712,  3712,
+     -242,  -242,  4452,  4452,   160,   160,  2744,  2744,
+     5277,  5277,  5092,  5092, -1153, -1153,  -726,  -726,
+     1067,  1067,   480,   480, -4057, -4057,  3542,  3542,
+     2987,  2987, -3459, -3459, -2178, -2178,  3201,  3201,
+     1440,  1440,   118,   118, -1663, -1663, -3328, -3328,
+     1912,  1912,  5755,  5755, -2686, -2686,  4320,  4320,
+      354,   354, -4989, -4989,  2305,  2305,  5736,  5736,
+     4976,  4976,  4231,  4231,   671,   671,  1062,  1062,
+    -2678, -2678, -5374, -5374,  4919,  4919,  2639,  2639,
+      404,   404,  2013,  2013,  3186,  3186,  4255,  4255,
+    -3833, -3833,  2468,  2468, -4372, -4372,  1212,  1212,
+     6039,  6039, -2731, -2731,   476,   476,   790,   790,
+    -4885, -4885,  -827,  -827,  3636,  3636,  5828,  5828,
+    -4096, -4096, -4096, -4096, -2370, -2370, -2370, -2370,
+     2481,  2481,  2481,  2481, -5195, -5195, -5195, -5195,
+    -4284, -4284, -4284, -4284, -5191, -5191, -5191, -5191,
+     4143,  4143,  4143,  4143,     3,     3,     3,     3,
+     3248,  3248,  3248,  3248, -2249, -2249, -2249, -2249,
+     2401,  2401,  2401,  2401, -1689, -1689, -1689, -1689,
+     2437,  2437,  2437,  2437,   420,   420,   420,   420,
+       27,    27,    27,    27,  4654,  4654,  4654,  4654,
+     4337,  4337,  4337,  4337, -2969, -2969, -2969, -2969,
+    -2912, -2912, -2912, -2912, -2645, -2645, -2645, -2645,
+     3780,  3780,  3780,  3780,   243,   243,   243,   243,
+     5019,  5019,  5019,  5019,  2166,  2166,  2166,  2166,
+    -2143, -2143, -2143, -2143, -1630, -1630, -1630, -1630,
+      773,   773,   773,   773, -2847, -2847, -2847, -2847,
+     2187,  2187,  2187,  2187, -3985, -3985, -3985, -3985,
+    -5084, -5084, -5084, -5084,  5291,  5291,  5291,  5291,
+    -2381, -2381, -2381, -2381, -5332, -5332, -5332, -5332,
+    -1045, -1045, -1045, -1045, -4895, -4895, -4895, -4895,
+     1002,  1002,  1002,  1002,  3400,  3400,  3400,  3400,
+    -1537, -1537, -1537, -1537,  3149,  3149,  3149,  3149,
+     1168,  1168,  1168,  1168,  2884,  2884,  2884,  2884,
+     5101,  5101,  5101,  5101, -3271, -3271, -3271, -3271,
+     6022,  6022,  6022,  6022, -1544, -1544, -1544, -1544,
+     3763,  3763,  3763,  3763, -1777, -1777, -1777, -1777,
+     1378,  1378,  1378,  1378, -3247, -3247, -3247, -3247,
+    -4861, -4861, -4861, -4861,  5042,  5042,  5042,  5042,
+    -1607, -1607, -1607, -1607, -3000, -3000, -3000, -3000,
+    -3704, -3704, -3704, -3704,   113,   113,   113,   113,
+    -4645, -4645, -4645, -4645,  5407,  5407,  5407,  5407,
+    -3778, -3778, -3778, -3778, -2174, -2174, -2174, -2174,
+    -2422, -2422, -2422, -2422,  3531,  3531,  3531,  3531,
+     1017,  1017,  1017,  1017, -4938, -4938, -4938, -4938,
+     -493,  -493,  -493,  -493,  2865,  2865,  2865,  2865,
+     5012,  5012,  5012,  5012,  2780,  2780,  2780,  2780,
+    -5088, -5088, -5088, -5088, -3136, -3136, -3136, -3136,
+     4714,  4714,  4714,  4714, -4437, -4437, -4437, -4437,
+     1207,  1207,  1207,  1207, -4048, -4048, -4048, -4048,
+      442,   442,   442,   442,  3364,  3364,  3364,  3364,
+    -3646, -3646, -3646, -3646,  5559,  5559,  5559,  5559,
+    -3066, -3066, -3066, -3066, -1426, -1426, -1426, -1426,
+      435,   435,   435,   435,  3978,  3978,  3978,  3978,
+     5698,  5698,  5698,  5698,  4053,  4053,  4053,  4053,
+      875,   875,   875,   875, -3016, -3016, -3016, -3016,
+     -545,  -545,  -545,  -545,  3915,  3915,  3915,  3915,
+    -1065, -1065, -1065, -1065,  2126,  2126,  2126,  2126,
+     -390,  -390,  -390,  -390, -4414, -4414, -4414, -4414,
+    -2566, -2566, -2566, -2566, -4905, -4905, -4905, -4905,
+    -1632, -1632, -1632, -1632,  2704,  2704,  2704,  2704,
+    -5444, -5444, -5444, -5444, -3510, -3510, -3510, -3510,
+    -2859, -2859, -2859, -2859,  1484,  1484,  1484,  1484,
+     5011,  5011,  5011,  5011, -2399, -2399, -2399, -2399,
+     -242,  -242,  -242,  -242,   160,   160,   160,   160,
+     5277,  5277,  5277,  5277, -1153, -1153, -1153, -1153,
+     1067,  1067,  1067,  1067, -4057, -4057, -4057, -4057,
+     2987,  2987,  2987,  2987, -2178, -2178, -2178, -2178,
+     1440,  1440,  1440,  1440, -1663, -1663, -1663, -1663,
+     1912,  1912,  1912,  1912, -2686, -2686, -2686, -2686,
+      354,   354,   354,   354,  2305,  2305,  2305,  2305,
+     4976,  4976,  4976,  4976,   671,   671,   671,   671,
+    -2678, -2678, -2678, -2678,  4919,  4919,  4919,  4919,
+      404,   404,   404,   404,  3186,  3186,  3186,  3186,
+    -3833, -3833, -3833, -3833, -4372, -4372, -4372, -4372,
+     6039,  6039,  6039,  6039,   476,   476,   476,   476,
+    -4885, -4885, -4885, -4885,  3636,  3636,  3636,  3636,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     2481,  2481,  2481,  2481,  2481,  2481,  2481,  2481,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     4143,  4143,  4143,  4143,  4143,  4143,  4143,  4143,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     2401,  2401,  2401,  2401,  2401,  2401,  2401,  2401,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+       27,    27,    27,    27,    27,    27,    27,    27,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2912, -2912, -2912, -2912, -2912, -2912, -2912, -2912,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     5019,  5019,  5019,  5019,  5019,  5019,  5019,  5019,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+      773,   773,   773,   773,   773,   773,   773,   773,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -5084, -5084, -5084, -5084, -5084, -5084, -5084, -5084,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+    -1537, -1537, -1537, -1537, -1537, -1537, -1537, -1537,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     5101,  5101,  5101,  5101,  5101,  5101,  5101,  5101,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     3763,  3763,  3763,  3763,  3763,  3763,  3763,  3763,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4861, -4861, -4861, -4861, -4861, -4861, -4861, -4861,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -3704, -3704, -3704, -3704, -3704, -3704, -3704, -3704,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -3778, -3778, -3778, -3778, -3778, -3778, -3778, -3778,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+     1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+     4714,  4714,  4714,  4714,  4714,  4714,  4714,  4714,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      442,   442,   442,   442,   442,   442,   442,   442,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3066, -3066, -3066, -3066, -3066, -3066, -3066, -3066,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     5698,  5698,  5698,  5698,  5698,  5698,  5698,  5698,
+      875,   875,   875,   875,   875,   875,   875,   875,
+     -545,  -545,  -545,  -545,  -545,  -545,  -545,  -545,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     -390,  -390,  -390,  -390,  -390,  -390,  -390,  -390,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -1632, -1632, -1632, -1632, -1632, -1632, -1632, -1632,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -2859, -2859, -2859, -2859, -2859, -2859, -2859, -2859,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1067,  1067,  1067,  1067,  1067,  1067,  1067,  1067,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1440,  1440,  1440,  1440,  1440,  1440,  1440,  1440,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      354,   354,   354,   354,   354,   354,   354,   354,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+    -2678, -2678, -2678, -2678, -2678, -2678, -2678, -2678,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -3833, -3833, -3833, -3833, -3833, -3833, -3833, -3833,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -4885, -4885, -4885, -4885, -4885, -4885, -4885, -4885,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_rev_ct_cg[5120] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+};
+
+const int16_t ntt_red1024_inv_omega_powers_rev_gs_cg[5120] = {
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red1024_mixed_powers_ct_cg[5120] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4885,  4885,  4885,  4885,  4885,  4885,  4885,  4885,
+     4885,  4885,  4885,  4885,  4885,  4885,  4885,  4885,
+     3833,  3833,  3833,  3833,  3833,  3833,  3833,  3833,
+     3833,  3833,  3833,  3833,  3833,  3833,  3833,  3833,
+     2678,  2678,  2678,  2678,  2678,  2678,  2678,  2678,
+     2678,  2678,  2678,  2678,  2678,  2678,  2678,  2678,
+     -354,  -354,  -354,  -354,  -354,  -354,  -354,  -354,
+     -354,  -354,  -354,  -354,  -354,  -354,  -354,  -354,
+    -1440, -1440, -1440, -1440, -1440, -1440, -1440, -1440,
+    -1440, -1440, -1440, -1440, -1440, -1440, -1440, -1440,
+    -1067, -1067, -1067, -1067, -1067, -1067, -1067, -1067,
+    -1067, -1067, -1067, -1067, -1067, -1067, -1067, -1067,
+      242,   242,   242,   242,   242,   242,   242,   242,
+      242,   242,   242,   242,   242,   242,   242,   242,
+     2859,  2859,  2859,  2859,  2859,  2859,  2859,  2859,
+     2859,  2859,  2859,  2859,  2859,  2859,  2859,  2859,
+     1632,  1632,  1632,  1632,  1632,  1632,  1632,  1632,
+     1632,  1632,  1632,  1632,  1632,  1632,  1632,  1632,
+      390,   390,   390,   390,   390,   390,   390,   390,
+      390,   390,   390,   390,   390,   390,   390,   390,
+      545,   545,   545,   545,   545,   545,   545,   545,
+      545,   545,   545,   545,   545,   545,   545,   545,
+    -5698, -5698, -5698, -5698, -5698, -5698, -5698, -5698,
+    -5698, -5698, -5698, -5698, -5698, -5698, -5698, -5698,
+     3066,  3066,  3066,  3066,  3066,  3066,  3066,  3066,
+     3066,  3066,  3066,  3066,  3066,  3066,  3066,  3066,
+     -442,  -442,  -442,  -442,  -442,  -442,  -442,  -442,
+     -442,  -442,  -442,  -442,  -442,  -442,  -442,  -442,
+    -4714, -4714, -4714, -4714, -4714, -4714, -4714, -4714,
+    -4714, -4714, -4714, -4714, -4714, -4714, -4714, -4714,
+    -5012, -5012, -5012, -5012, -5012, -5012, -5012, -5012,
+    -5012, -5012, -5012, -5012, -5012, -5012, -5012, -5012,
+    -1017, -1017, -1017, -1017, -1017, -1017, -1017, -1017,
+    -1017, -1017, -1017, -1017, -1017, -1017, -1017, -1017,
+     3778,  3778,  3778,  3778,  3778,  3778,  3778,  3778,
+     3778,  3778,  3778,  3778,  3778,  3778,  3778,  3778,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     4861,  4861,  4861,  4861,  4861,  4861,  4861,  4861,
+     4861,  4861,  4861,  4861,  4861,  4861,  4861,  4861,
+    -3763, -3763, -3763, -3763, -3763, -3763, -3763, -3763,
+    -3763, -3763, -3763, -3763, -3763, -3763, -3763, -3763,
+    -5101, -5101, -5101, -5101, -5101, -5101, -5101, -5101,
+    -5101, -5101, -5101, -5101, -5101, -5101, -5101, -5101,
+     1537,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+     1537,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+     1045,  1045,  1045,  1045,  1045,  1045,  1045,  1045,
+     1045,  1045,  1045,  1045,  1045,  1045,  1045,  1045,
+     5084,  5084,  5084,  5084,  5084,  5084,  5084,  5084,
+     5084,  5084,  5084,  5084,  5084,  5084,  5084,  5084,
+     -773,  -773,  -773,  -773,  -773,  -773,  -773,  -773,
+     -773,  -773,  -773,  -773,  -773,  -773,  -773,  -773,
+    -5019, -5019, -5019, -5019, -5019, -5019, -5019, -5019,
+    -5019, -5019, -5019, -5019, -5019, -5019, -5019, -5019,
+     2912,  2912,  2912,  2912,  2912,  2912,  2912,  2912,
+     2912,  2912,  2912,  2912,  2912,  2912,  2912,  2912,
+      -27,   -27,   -27,   -27,   -27,   -27,   -27,   -27,
+      -27,   -27,   -27,   -27,   -27,   -27,   -27,   -27,
+    -2401, -2401, -2401, -2401, -2401, -2401, -2401, -2401,
+    -2401, -2401, -2401, -2401, -2401, -2401, -2401, -2401,
+    -4143, -4143, -4143, -4143, -4143, -4143, -4143, -4143,
+    -4143, -4143, -4143, -4143, -4143, -4143, -4143, -4143,
+    -2481, -2481, -2481, -2481, -2481, -2481, -2481, -2481,
+    -2481, -2481, -2481, -2481, -2481, -2481, -2481, -2481,
+    -3636, -3636, -3636, -3636, -3636, -3636, -3636, -3636,
+     -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+     4372,  4372,  4372,  4372,  4372,  4372,  4372,  4372,
+    -3186, -3186, -3186, -3186, -3186, -3186, -3186, -3186,
+    -4919, -4919, -4919, -4919, -4919, -4919, -4919, -4919,
+     -671,  -671,  -671,  -671,  -671,  -671,  -671,  -671,
+    -2305, -2305, -2305, -2305, -2305, -2305, -2305, -2305,
+     2686,  2686,  2686,  2686,  2686,  2686,  2686,  2686,
+     1663,  1663,  1663,  1663,  1663,  1663,  1663,  1663,
+     2178,  2178,  2178,  2178,  2178,  2178,  2178,  2178,
+     4057,  4057,  4057,  4057,  4057,  4057,  4057,  4057,
+     1153,  1153,  1153,  1153,  1153,  1153,  1153,  1153,
+     -160,  -160,  -160,  -160,  -160,  -160,  -160,  -160,
+     2399,  2399,  2399,  2399,  2399,  2399,  2399,  2399,
+    -1484, -1484, -1484, -1484, -1484, -1484, -1484, -1484,
+     3510,  3510,  3510,  3510,  3510,  3510,  3510,  3510,
+    -2704, -2704, -2704, -2704, -2704, -2704, -2704, -2704,
+     4905,  4905,  4905,  4905,  4905,  4905,  4905,  4905,
+     4414,  4414,  4414,  4414,  4414,  4414,  4414,  4414,
+    -2126, -2126, -2126, -2126, -2126, -2126, -2126, -2126,
+    -3915, -3915, -3915, -3915, -3915, -3915, -3915, -3915,
+     3016,  3016,  3016,  3016,  3016,  3016,  3016,  3016,
+    -4053, -4053, -4053, -4053, -4053, -4053, -4053, -4053,
+    -3978, -3978, -3978, -3978, -3978, -3978, -3978, -3978,
+     1426,  1426,  1426,  1426,  1426,  1426,  1426,  1426,
+    -5559, -5559, -5559, -5559, -5559, -5559, -5559, -5559,
+    -3364, -3364, -3364, -3364, -3364, -3364, -3364, -3364,
+     4048,  4048,  4048,  4048,  4048,  4048,  4048,  4048,
+     4437,  4437,  4437,  4437,  4437,  4437,  4437,  4437,
+     3136,  3136,  3136,  3136,  3136,  3136,  3136,  3136,
+    -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780,
+    -2865, -2865, -2865, -2865, -2865, -2865, -2865, -2865,
+     4938,  4938,  4938,  4938,  4938,  4938,  4938,  4938,
+    -3531, -3531, -3531, -3531, -3531, -3531, -3531, -3531,
+     2174,  2174,  2174,  2174,  2174,  2174,  2174,  2174,
+    -5407, -5407, -5407, -5407, -5407, -5407, -5407, -5407,
+     -113,  -113,  -113,  -113,  -113,  -113,  -113,  -113,
+     3000,  3000,  3000,  3000,  3000,  3000,  3000,  3000,
+    -5042, -5042, -5042, -5042, -5042, -5042, -5042, -5042,
+     3247,  3247,  3247,  3247,  3247,  3247,  3247,  3247,
+     1777,  1777,  1777,  1777,  1777,  1777,  1777,  1777,
+     1544,  1544,  1544,  1544,  1544,  1544,  1544,  1544,
+     3271,  3271,  3271,  3271,  3271,  3271,  3271,  3271,
+    -2884, -2884, -2884, -2884, -2884, -2884, -2884, -2884,
+    -3149, -3149, -3149, -3149, -3149, -3149, -3149, -3149,
+    -3400, -3400, -3400, -3400, -3400, -3400, -3400, -3400,
+     4895,  4895,  4895,  4895,  4895,  4895,  4895,  4895,
+     5332,  5332,  5332,  5332,  5332,  5332,  5332,  5332,
+    -5291, -5291, -5291, -5291, -5291, -5291, -5291, -5291,
+     3985,  3985,  3985,  3985,  3985,  3985,  3985,  3985,
+     2847,  2847,  2847,  2847,  2847,  2847,  2847,  2847,
+     1630,  1630,  1630,  1630,  1630,  1630,  1630,  1630,
+    -2166, -2166, -2166, -2166, -2166, -2166, -2166, -2166,
+     -243,  -243,  -243,  -243,  -243,  -243,  -243,  -243,
+     2645,  2645,  2645,  2645,  2645,  2645,  2645,  2645,
+     2969,  2969,  2969,  2969,  2969,  2969,  2969,  2969,
+    -4654, -4654, -4654, -4654, -4654, -4654, -4654, -4654,
+     -420,  -420,  -420,  -420,  -420,  -420,  -420,  -420,
+     1689,  1689,  1689,  1689,  1689,  1689,  1689,  1689,
+     2249,  2249,  2249,  2249,  2249,  2249,  2249,  2249,
+       -3,    -3,    -3,    -3,    -3,    -3,    -3,    -3,
+     5191,  5191,  5191,  5191,  5191,  5191,  5191,  5191,
+     5195,  5195,  5195,  5195,  5195,  5195,  5195,  5195,
+     2370,  2370,  2370,  2370,  2370,  2370,  2370,  2370,
+    -5828, -5828, -5828, -5828,   827,   827,   827,   827,
+     -790,  -790,  -790,  -790,  2731,  2731,  2731,  2731,
+    -1212, -1212, -1212, -1212, -2468, -2468, -2468, -2468,
+    -4255, -4255, -4255, -4255, -2013, -2013, -2013, -2013,
+    -2639, -2639, -2639, -2639,  5374,  5374,  5374,  5374,
+    -1062, -1062, -1062, -1062, -4231, -4231, -4231, -4231,
+    -5736, -5736, -5736, -5736,  4989,  4989,  4989,  4989,
+    -4320, -4320, -4320, -4320, -5755, -5755, -5755, -5755,
+     3328,  3328,  3328,  3328,  -118,  -118,  -118,  -118,
+    -3201, -3201, -3201, -3201,  3459,  3459,  3459,  3459,
+    -3542, -3542, -3542, -3542,  -480,  -480,  -480,  -480,
+      726,   726,   726,   726, -5092, -5092, -5092, -5092,
+    -2744, -2744, -2744, -2744, -4452, -4452, -4452, -4452,
+    -3712, -3712, -3712, -3712, -1759, -1759, -1759, -1759,
+     4043,  4043,  4043,  4043,  4177,  4177,  4177,  4177,
+     4896,  4896,  4896,  4896,  2426,  2426,  2426,  2426,
+    -4591, -4591, -4591, -4591,   953,   953,   953,   953,
+     1170,  1170,  1170,  1170,  5911,  5911,  5911,  5911,
+     3195,  3195,  3195,  3195,   544,   544,   544,   544,
+     1635,  1635,  1635,  1635, -3241, -3241, -3241, -3241,
+    -2625, -2625, -2625, -2625,   130,   130,   130,   130,
+    -4805, -4805, -4805, -4805,   355,   355,   355,   355,
+    -1305, -1305, -1305, -1305,  4278,  4278,  4278,  4278,
+    -3091, -3091, -3091, -3091, -4388, -4388, -4388, -4388,
+    -1351, -1351, -1351, -1351,  2197,  2197,  2197,  2197,
+    -1326, -1326, -1326, -1326,  -145,  -145,  -145,  -145,
+    -3621, -3621, -3621, -3621,  1022,  1022,  1022,  1022,
+    -1853, -1853, -1853, -1853, -2881, -2881, -2881, -2881,
+     2975,  2975,  2975,  2975,  3949,  3949,  3949,  3949,
+    -2747, -2747, -2747, -2747,  3694,  3694,  3694,  3694,
+     1479,  1479,  1479,  1479,  2525,  2525,  2525,  2525,
+    -3051, -3051, -3051, -3051,  1696,  1696,  1696,  1696,
+    -5023, -5023, -5023, -5023, -5767, -5767, -5767, -5767,
+     -955,  -955,  -955,  -955, -3932, -3932, -3932, -3932,
+     1646,  1646,  1646,  1646,  -339,  -339,  -339,  -339,
+    -1177, -1177, -1177, -1177, -3289, -3289, -3289, -3289,
+     4821,  4821,  4821,  4821, -2837, -2837, -2837, -2837,
+     2294,  2294,  2294,  2294, -2548, -2548, -2548, -2548,
+    -4134, -4134, -4134, -4134,  5331,  5331,  5331,  5331,
+     1000,  1000,  1000,  1000,  4632,  4632,  4632,  4632,
+    -5777, -5777, -5777, -5777, -2476, -2476, -2476, -2476,
+    -3014, -3014, -3014, -3014,  3637,  3637,  3637,  3637,
+    -3504, -3504, -3504, -3504,  2842,  2842,  2842,  2842,
+     4611,  4611,  4611,  4611,  2089,  2089,  2089,  2089,
+    -3006, -3006, -3006, -3006,  2396,  2396,  2396,  2396,
+     3135,  3135,  3135,  3135,  3707,  3707,  3707,  3707,
+    -5146, -5146, -5146, -5146, -3584, -3584, -3584, -3584,
+     2963,  2963,  2963,  2963,  -334,  -334,  -334,  -334,
+     5728,  5728,  5728,  5728, -3748, -3748, -3748, -3748,
+    -2319, -2319, -2319, -2319,  4890,  4890,  4890,  4890,
+    -5860, -5860, -5860, -5860,  5791,  5791,  5791,  5791,
+    -2768, -2768, -2768, -2768,  -729,  -729,  -729,  -729,
+      949,   949,   949,   949, -4354, -4354, -4354, -4354,
+    -3553, -3553, -3553, -3553, -3382, -3382, -3382, -3382,
+     -722,  -722,  -722,  -722, -1673, -1673, -1673, -1673,
+      -81,   -81,   -81,   -81, -1260, -1260, -1260, -1260,
+     4978,  4978,  4978,  4978,  5067,  5067,  5067,  5067,
+     5086,  5086,  5086,  5086, -5542, -5542, -5542, -5542,
+     2545,  2545,  2545,  2545,    -9,    -9,    -9,    -9,
+     -140,  -140,  -140,  -140,  3284,  3284,  3284,  3284,
+      563,   563,   563,   563,  3296,  3296,  3296,  3296,
+     4846,  4846,  4846,  4846, -5179, -5179, -5179, -5179,
+       -1,    -1,    -1,    -1, -1381, -1381, -1381, -1381,
+    -2366, -2366, -2366, -2366,  1428,  1428,  1428,  1428,
+    -1360, -1360,  -975,  -975,  2057,  2057,  5315,  5315,
+     1958,  1958,  3482,  3482,   418,   418,  3643,  3643,
+     -325,  -325,  4782,  4782,  5868,  5868,  4749,  4749,
+     5257,  5257, -3957, -3957, -2882, -2882,  3988,  3988,
+     1594,  1594,  1956,  1956,  1583,  1583, -2344, -2344,
+    -1319, -1319, -5057, -5057, -2767, -2767, -3565, -3565,
+      652,   652,  4624,  4624,  3315,  3315, -4536, -4536,
+    -5782, -5782,  3174,  3174,  2908,  2908, -3879, -3879,
+    -2555, -2555,  1105,  1105, -1512, -1512,  2169,  2169,
+     1058,  1058, -3127, -3127, -1293, -1293, -4948, -4948,
+    -3728, -3728,  -504,  -504,   723,   723,  4449,  4449,
+     3054,  3054,  -431,  -431,  2447,  2447, -5339, -5339,
+     -168,  -168,   241,   241,  1483,  1483,  1018,  1018,
+    -4240, -4240,  4912,  4912, -5876, -5876,   -56,   -56,
+    -4016, -4016, -3602, -3602, -3757, -3757,  2683,  2683,
+    -2459, -2459, -6055, -6055, -4115, -4115, -5435, -5435,
+    -5297, -5297,  2844,  2844, -3202, -3202, -4916, -4916,
+     2078,  2078, -5468, -5468, -5908, -5908, -5862, -5862,
+      948,   948,  3029,  3029, -5735, -5735,  4789,  4789,
+    -5919, -5919,  2127,  2127, -1954, -1954,   316,   316,
+     5106,  5106, -6008, -6008, -2500, -2500, -1973, -1973,
+      709,   709,  3445,  3445, -3991, -3991,  1702,  1702,
+    -6099, -6099,  3263,  3263, -4754, -4754, -3860, -3860,
+    -2948, -2948,  2766,  2766, -3529, -3529, -2033, -2033,
+     5184,  5184, -5681, -5681, -5383, -5383, -5079, -5079,
+      922,   922,  2920,  2920, -4774, -4774,  1728,  1728,
+    -5990, -5990,  2302,  2302, -1693, -1693, -3789, -3789,
+    -3123, -3123,  2505,  2505,   576,   576, -6093, -6093,
+    -3329, -3329,  3532,  3532, -1263, -1263, -1041, -1041,
+      835,   835,   192,   192, -2031, -2031, -5206, -5206,
+    -2919, -2919,  -421,  -421,  -347,  -347, -3818, -3818,
+       64,    64,  -677,  -677,  2361,  2361,  -973,  -973,
+     3956,  3956, -4212, -4212, -5369, -5369, -4075, -4075,
+    -4322, -4322,   787,   787,  3772,  3772,  5415,  5415,
+    -1404, -1404, -5886, -5886,  2738,  2738, -5537, -5537,
+    -3834, -3834, -2839, -2839,  1805,  1805,  -468,  -468,
+    -1962, -1962,  5009,  5009, -5942, -5942, -1278, -1278,
+     3150,  3150,  4698,  4698,  -156,  -156,  -654,  -654,
+     5766,  5766, -6077, -6077,  -426,  -426,  1050,  1050,
+     1566,  1566,   -52,   -52,  -218,  -218,  1922,  1922,
+    -6122, -6122,  -142,  -142,   350,   350,   522,   522,
+     4079,  4079, -4169, -4169,  4737,  4737, -6137, -6137,
+     4049,  4049,  4213,  4213,   174,   174,  5456,  5456,
+    -5486, -5486,  1579,  1579, -6142, -6142,  5446,  5446,
+    -2692, -2692,    58,    58,  5915,  5915, -5925, -5925,
+    -3570, -3570,  2049,  2049, -2281, -2281,  3199,  3199,
+    -4077, -4077,  6068,  6068, -1975, -1975, -1190, -1190,
+      683,   683,  3336,  3336, -3030, -3030, -1359, -1359,
+     6119,  6119,  3438,  3438, -4493, -4493,  4324,  4324,
+     1112,  1112, -1010, -1010,  -453,  -453,  6136,  6136,
+     1146,  1146, -5594, -5594, -2655, -2655,  4467,  4467,
+    -4433, -4433,  -151,  -151, -2051, -2051,   382,   382,
+    -5961, -5961,  -885,  -885,  1489,  1489, -5574, -5574,
+     4046,  4046, -4780, -4780, -3969, -3969, -1987, -1987,
+     -295,  -295, -3600, -3600, -1858, -1858,  5445,  5445,
+     2503,  2503, -1323, -1323,  3434,  3434,  3998,  3998,
+    -1200, -1200,  3477,  3477,  1815,  1815, -3262, -3262,
+     -441,  -441,  5241,  5241,  5429,  5429,  -400,  -400,
+     1159,  1159,   605,   605,  3009,  3009,  -147,  -147,
+     1747,  1747,  5906,  5906,  3963,  3963, -3710, -3710,
+     4298,  4298,  1003,  1003,   -49,   -49, -3514, -3514,
+     6065,  6065,  1321,  1321, -5333, -5333,  5529,  5529,
+    -3762, -3762,  4080,  4080,  2925,  2925,  6118,  6118,
+    -3656, -3656, -5874, -5874,  1843,  1843, -1254, -1254,
+      338, -2672,  1417, -5530,  -204, -3332,  2926, -5461,
+      923, -5406, -2275,  3805, -3393,  6026,  4209, -4987,
+    -3624,  2253,   -68, -5207, -3121,  2276,  4404, -1802,
+     3338, -2828, -1131,  6105,  1403,  2434, -1208,   751,
+    -4119, -5832,  3056,  4855,  1468, -4697,  5209, -5039,
+     -377,  2035,  4564, -3285, -4499, -3846, -1373, -1944,
+     5115, -2478, -3607, -5662, -2360, -5776, -4222, -3418,
+    -2575, -1095, -5596, -1282, -4554,  -648,  1705,  -826,
+     2894,  2209, -4883,  2171,  2689,  2957,  3238,  -365,
+     2231,  3669, -1518,  -216, -3528,  3821,  5061, -3360,
+    -5724,  4820, -3200,  5082, -3017, -4218,  4840,  1223,
+     -506,   -72, -1176,  5370,  1687, -1120, -1908,  5703,
+    -5163,  1694, -5102, -1406, -2483,  4504, -4265,   -24,
+     -392,  1790, -3534,  3723,  -636,  1901, -1721,  4661,
+    -5797, -4565, -4924, -2595, -5518,    -8, -4227,  4693,
+    -1178,  1241,  -212,  4730, -4670,  5650,  2164, -5618,
+     2455,  -865,  2257, -4099, -1409, -2532, -4489,  4510,
+    -4167,  5673, -5653, -2213, -3375, -5969, -3278,  3808,
+    -3344,  2730, -4566,  -844,  2600, -2593, -1389,  1891,
+     2212, -4834, -1125, -6086, -5189, -2827, -5211,   910,
+    -1522,  3815,  4963,  3232,  -463, -3466, -3359,  2485,
+     -375, -6125, -5826,  3154, -1737, -3793,  3589,  5368,
+    -2442, -3019,  3942,  2941, -5216, -3268,  -125, -6138,
+    -1942, -3045,  -579,  2832, -2900, -2307,  -814,  3090,
+     1314, -3116, -5835,  3007, -4138, -2046,  3449, -1015,
+     -193,   944, -5063,  -769,  3825,  1030,   438, -5135,
+    -1945, -3094,  2717,  -682,  5246,  3758,  4032,  4411,
+    -5784,  3840,  1275, -3753,   146, -5808,  3448,  3065,
+     5002,  3869,  5845,  5349,  1344, -2626, -1928,  1280,
+      425, -1251,  4145, -1936, -2947,  5118, -2429,  5386,
+    -2148,  1783,   448,  3221, -4739,  4523,  4238,  -417,
+     5478,  3451,  3114,  1706, -4906, -2301,  -716, -3502,
+    -3947,  5170, -5676,  5604,  5509,  -139,  1826, -2946,
+     1038,  4665,  2461,  -767, -4335,  2929, -5412, -2373,
+    -1892,  1868, -2260,  4050,  4705,  -982,   346,  1555,
+    -3276, -4352, -1445, -3120, -1804,  -791, -4727,  4719,
+     3343,  1350, -2528,  3769, -3981, -3578, -1092, -5547,
+    -4578, -1040,  3495, -4360, -5672,  1573, -2982,   450,
+    -4939, -2840, -1327, -5289,  -364, -1849, -1526, -4443,
+     1165,  2643, -5987, -3572,  -994,   150,  2450, -5043,
+     3654, -1763,  3975,  3480, -4605, -1481, -3708,   881,
+    -6092, -5287,  3765,    50,  4913, -1681,  1218, -4684,
+     1325,  1160, -1535, -4590, -1236,  4390, -6127,  2334,
+     1255,  4113,  5734,  3536,   406,  2535,  4538,  4483,
+    -4608, -1530,  -412, -2633,  2054,   778, -3678,  1371,
+    -2185,  5275, -3961,   845,  5609, -2602, -1536,  -510,
+     3959, -4974,  4781, -3837, -1226,   457,  3368, -2338,
+     2776,  4378,  5966,  3229,  -512,  -170,  5416, -1658,
+     5690, -1279, -4505, -3944,  5219,  3317, -3171, -2637,
+     6085, -3020, -4267, -4153, -2291, -4649,  5993,  3670,
+    -5598, -5411,  5836,  5202, -1057,  -879, -2068, -5103,
+     2674,  2712, -4860, -5646,  6094, -2873, -1866, -5900,
+    -2151,  1734,  3744,  -293,  3407, -1701, -3205,   904,
+    -1620, -1882, -2065, -5054,  -622, -6063,  -717,   578,
+     1248, -4194,  5232,  -567,  3028, -3795,  -540,  3469,
+     3408, -5781,  3889, -2021,  -239,  4289,   416, -1398,
+     1744,  -189, -3087, -1265,  -180, -2940,  1136, -1927,
+    -2800, -4770, -4176,  5526,  4235,  -466, -3515,   -63,
+    -1029, -4518,   -60,  -980,  4475,  3454,  3163, -1590,
+    -1392,  1842,  5508,  3941, -5268,   -21,  -343, -1506,
+      -20, -4423,  5588, -2945, -3042,  -530,  -464,   614,
+     1836,  5410, -1756,    -7,  3982,  -502, -4103,  2622,
+     5959, -5078, -1014, -4273, -4251,  4301,   612, -2293,
+     3511,  4094, -2769,  3929, -5464,   874, -2110, -5789,
+};
+
+const int16_t ntt_red1024_mixed_powers_rev_ct_cg[5120] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+      338, -3947,  2455,  5690,  2894,  3654,  1314,  1744,
+    -4119,  3343, -1522, -2151, -5163, -4608,  5002,   -20,
+    -3624, -1892, -3344, -5598, -5724,  1325, -1945, -1029,
+     5115, -4939, -2442,  1248, -5797,  3959, -2148,  5959,
+      923,  1038, -4167,  6085,  2231, -6092,  -193, -2800,
+     -377, -4578,  -375, -1620,  -392, -2185,   425,  1836,
+     3338, -3276,  2212,  2674,  -506,  1255, -5784, -1392,
+    -2575,  1165, -1942,  3408, -1178,  2776,  5478,  3511,
+     -204,  5509, -1409,  5219,  2689, -4605, -4138,  -180,
+     1468, -3981,  -463,  3407, -2483,  2054,  1344, -3042,
+    -3121,  4705,  2600, -1057, -3017, -1236,  5246,  4475,
+    -2360,  -364, -5216,  3028, -5518, -1226, -4739, -4251,
+    -3393, -4335, -3375, -2291, -3528,  4913,  3825,  4235,
+    -4499, -5672, -1737,  -622,  -636,  5609, -2947,  3982,
+     1403, -1804, -5189,  6094,  1687,   406,   146, -5268,
+    -4554,  -994, -2900,  -239, -4670,  -512, -4906, -5464,
+     1417, -5676,  2257, -4505, -4883,  3975, -5835, -3087,
+     3056, -2528,  4963,  3744, -5102,  -412,  5845,  5588,
+      -68, -2260, -4566,  5836, -3200, -1535,  2717,   -60,
+    -3607, -1327,  3942,  5232, -4924,  4781,   448, -1014,
+    -2275,  2461, -5653, -4267, -1518,  3765, -5063, -4176,
+     4564,  3495, -5826, -2065, -3534, -3961,  4145, -1756,
+    -1131, -1445, -1125, -4860, -1176,  5734,  1275,  5508,
+    -5596, -5987,  -579,  3889,  -212,  5966,  3114, -2769,
+     2926,  1826, -4489, -3171,  3238, -3708,  3449,  1136,
+     5209, -1092, -3359, -3205, -4265, -3678, -1928,  -464,
+     4404,   346, -1389, -2068,  4840, -6127,  4032,  3163,
+    -4222, -1526,  -125,  -540, -4227,  3368,  4238,   612,
+     4209, -5412, -3278,  5993,  5061,  1218,   438, -3515,
+    -1373, -2982,  3589,  -717, -1721, -1536, -2429, -4103,
+    -1208, -4727, -5211, -1866, -1908,  4538,  3448,  -343,
+     1705,  2450,  -814,   416,  2164,  5416,  -716, -2110,
+    -2672,  5170,  -865, -1279,  2209, -1763, -3116,  -189,
+    -5832,  1350,  3815,  1734,  1694, -1530,  3869, -4423,
+     2253,  1868,  2730, -5411,  4820,  1160, -3094, -4518,
+    -2478, -2840, -3019, -4194, -4565, -4974,  1783, -5078,
+    -5406,  4665,  5673, -3020,  3669, -5287,   944, -4770,
+     2035, -1040, -6125, -1882,  1790,  5275, -1251,  5410,
+    -2828, -4352, -4834,  2712,   -72,  4113,  3840,  1842,
+    -1095,  2643, -3045, -5781,  1241,  4378,  3451,  4094,
+    -3332,  -139, -2532,  3317,  2957, -1481, -2046, -2940,
+    -4697, -3578, -3466, -1701,  4504,   778, -2626,  -530,
+     2276,  -982, -2593,  -879, -4218,  4390,  3758,  3454,
+    -5776, -1849, -3268, -3795,    -8,   457,  4523,  4301,
+     6026,  2929, -5969, -4649,  3821, -1681,  1030,  -466,
+    -3846,  1573, -3793, -6063,  1901, -2602,  5118,  -502,
+     2434,  -791, -2827, -2873, -1120,  2535, -5808,   -21,
+     -648,   150, -2307,  4289,  5650,  -170, -2301,   874,
+    -5530,  5604, -4099, -3944,  2171,  3480,  3007, -1265,
+     4855,  3769,  3232,  -293, -1406, -2633,  5349, -2945,
+    -5207,  4050,  -844,  5202,  5082, -4590,  -682,  -980,
+    -5662, -5289,  2941,  -567, -2595, -3837,  3221, -4273,
+     3805,  -767, -2213, -4153,  -216,    50,  -769,  5526,
+    -3285, -4360,  3154, -5054,  3723,   845, -1936,    -7,
+     6105, -3120, -6086, -5646,  5370,  3536, -3753,  3941,
+    -1282, -3572,  2832, -2021,  4730,  3229,  1706,  3929,
+    -5461, -2946,  4510, -2637,  -365,   881, -1015, -1927,
+    -5039, -5547,  2485,   904,   -24,  1371,  1280,   614,
+    -1802,  1555,  1891, -5103,  1223,  2334,  4411, -1590,
+    -3418, -4443, -6138,  3469,  4693, -2338,  -417, -2293,
+    -4987, -2373,  3808,  3670, -3360, -4684, -5135,   -63,
+    -1944,   450,  5368,   578,  4661,  -510,  5386,  2622,
+      751,  4719,   910, -5900,  5703,  4483,  3065, -1506,
+     -826, -5043,  3090, -1398, -5618, -1658, -3502, -5789,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers_gs_cg[5120] = {
+     5789,  2110,  -874,  5464, -3929,  2769, -4094, -3511,
+     2293,  -612, -4301,  4251,  4273,  1014,  5078, -5959,
+    -2622,  4103,   502, -3982,     7,  1756, -5410, -1836,
+     -614,   464,   530,  3042,  2945, -5588,  4423,    20,
+     1506,   343,    21,  5268, -3941, -5508, -1842,  1392,
+     1590, -3163, -3454, -4475,   980,    60,  4518,  1029,
+       63,  3515,   466, -4235, -5526,  4176,  4770,  2800,
+     1927, -1136,  2940,   180,  1265,  3087,   189, -1744,
+     1398,  -416, -4289,   239,  2021, -3889,  5781, -3408,
+    -3469,   540,  3795, -3028,   567, -5232,  4194, -1248,
+     -578,   717,  6063,   622,  5054,  2065,  1882,  1620,
+     -904,  3205,  1701, -3407,   293, -3744, -1734,  2151,
+     5900,  1866,  2873, -6094,  5646,  4860, -2712, -2674,
+     5103,  2068,   879,  1057, -5202, -5836,  5411,  5598,
+    -3670, -5993,  4649,  2291,  4153,  4267,  3020, -6085,
+     2637,  3171, -3317, -5219,  3944,  4505,  1279, -5690,
+     1658, -5416,   170,   512, -3229, -5966, -4378, -2776,
+     2338, -3368,  -457,  1226,  3837, -4781,  4974, -3959,
+      510,  1536,  2602, -5609,  -845,  3961, -5275,  2185,
+    -1371,  3678,  -778, -2054,  2633,   412,  1530,  4608,
+    -4483, -4538, -2535,  -406, -3536, -5734, -4113, -1255,
+    -2334,  6127, -4390,  1236,  4590,  1535, -1160, -1325,
+     4684, -1218,  1681, -4913,   -50, -3765,  5287,  6092,
+     -881,  3708,  1481,  4605, -3480, -3975,  1763, -3654,
+     5043, -2450,  -150,   994,  3572,  5987, -2643, -1165,
+     4443,  1526,  1849,   364,  5289,  1327,  2840,  4939,
+     -450,  2982, -1573,  5672,  4360, -3495,  1040,  4578,
+     5547,  1092,  3578,  3981, -3769,  2528, -1350, -3343,
+    -4719,  4727,   791,  1804,  3120,  1445,  4352,  3276,
+    -1555,  -346,   982, -4705, -4050,  2260, -1868,  1892,
+     2373,  5412, -2929,  4335,   767, -2461, -4665, -1038,
+     2946, -1826,   139, -5509, -5604,  5676, -5170,  3947,
+     3502,   716,  2301,  4906, -1706, -3114, -3451, -5478,
+      417, -4238, -4523,  4739, -3221,  -448, -1783,  2148,
+    -5386,  2429, -5118,  2947,  1936, -4145,  1251,  -425,
+    -1280,  1928,  2626, -1344, -5349, -5845, -3869, -5002,
+    -3065, -3448,  5808,  -146,  3753, -1275, -3840,  5784,
+    -4411, -4032, -3758, -5246,   682, -2717,  3094,  1945,
+     5135,  -438, -1030, -3825,   769,  5063,  -944,   193,
+     1015, -3449,  2046,  4138, -3007,  5835,  3116, -1314,
+    -3090,   814,  2307,  2900, -2832,   579,  3045,  1942,
+     6138,   125,  3268,  5216, -2941, -3942,  3019,  2442,
+    -5368, -3589,  3793,  1737, -3154,  5826,  6125,   375,
+    -2485,  3359,  3466,   463, -3232, -4963, -3815,  1522,
+     -910,  5211,  2827,  5189,  6086,  1125,  4834, -2212,
+    -1891,  1389,  2593, -2600,   844,  4566, -2730,  3344,
+    -3808,  3278,  5969,  3375,  2213,  5653, -5673,  4167,
+    -4510,  4489,  2532,  1409,  4099, -2257,   865, -2455,
+     5618, -2164, -5650,  4670, -4730,   212, -1241,  1178,
+    -4693,  4227,     8,  5518,  2595,  4924,  4565,  5797,
+    -4661,  1721, -1901,   636, -3723,  3534, -1790,   392,
+       24,  4265, -4504,  2483,  1406,  5102, -1694,  5163,
+    -5703,  1908,  1120, -1687, -5370,  1176,    72,   506,
+    -1223, -4840,  4218,  3017, -5082,  3200, -4820,  5724,
+     3360, -5061, -3821,  3528,   216,  1518, -3669, -2231,
+      365, -3238, -2957, -2689, -2171,  4883, -2209, -2894,
+      826, -1705,   648,  4554,  1282,  5596,  1095,  2575,
+     3418,  4222,  5776,  2360,  5662,  3607,  2478, -5115,
+     1944,  1373,  3846,  4499,  3285, -4564, -2035,   377,
+     5039, -5209,  4697, -1468, -4855, -3056,  5832,  4119,
+     -751,  1208, -2434, -1403, -6105,  1131,  2828, -3338,
+     1802, -4404, -2276,  3121,  5207,    68, -2253,  3624,
+     4987, -4209, -6026,  3393, -3805,  2275,  5406,  -923,
+     5461, -2926,  3332,   204,  5530, -1417,  2672,  -338,
+     1254,  1254, -1843, -1843,  5874,  5874,  3656,  3656,
+    -6118, -6118, -2925, -2925, -4080, -4080,  3762,  3762,
+    -5529, -5529,  5333,  5333, -1321, -1321, -6065, -6065,
+     3514,  3514,    49,    49, -1003, -1003, -4298, -4298,
+     3710,  3710, -3963, -3963, -5906, -5906, -1747, -1747,
+      147,   147, -3009, -3009,  -605,  -605, -1159, -1159,
+      400,   400, -5429, -5429, -5241, -5241,   441,   441,
+     3262,  3262, -1815, -1815, -3477, -3477,  1200,  1200,
+    -3998, -3998, -3434, -3434,  1323,  1323, -2503, -2503,
+    -5445, -5445,  1858,  1858,  3600,  3600,   295,   295,
+     1987,  1987,  3969,  3969,  4780,  4780, -4046, -4046,
+     5574,  5574, -1489, -1489,   885,   885,  5961,  5961,
+     -382,  -382,  2051,  2051,   151,   151,  4433,  4433,
+    -4467, -4467,  2655,  2655,  5594,  5594, -1146, -1146,
+    -6136, -6136,   453,   453,  1010,  1010, -1112, -1112,
+    -4324, -4324,  4493,  4493, -3438, -3438, -6119, -6119,
+     1359,  1359,  3030,  3030, -3336, -3336,  -683,  -683,
+     1190,  1190,  1975,  1975, -6068, -6068,  4077,  4077,
+    -3199, -3199,  2281,  2281, -2049, -2049,  3570,  3570,
+     5925,  5925, -5915, -5915,   -58,   -58,  2692,  2692,
+    -5446, -5446,  6142,  6142, -1579, -1579,  5486,  5486,
+    -5456, -5456,  -174,  -174, -4213, -4213, -4049, -4049,
+     6137,  6137, -4737, -4737,  4169,  4169, -4079, -4079,
+     -522,  -522,  -350,  -350,   142,   142,  6122,  6122,
+    -1922, -1922,   218,   218,    52,    52, -1566, -1566,
+    -1050, -1050,   426,   426,  6077,  6077, -5766, -5766,
+      654,   654,   156,   156, -4698, -4698, -3150, -3150,
+     1278,  1278,  5942,  5942, -5009, -5009,  1962,  1962,
+      468,   468, -1805, -1805,  2839,  2839,  3834,  3834,
+     5537,  5537, -2738, -2738,  5886,  5886,  1404,  1404,
+    -5415, -5415, -3772, -3772,  -787,  -787,  4322,  4322,
+     4075,  4075,  5369,  5369,  4212,  4212, -3956, -3956,
+      973,   973, -2361, -2361,   677,   677,   -64,   -64,
+     3818,  3818,   347,   347,   421,   421,  2919,  2919,
+     5206,  5206,  2031,  2031,  -192,  -192,  -835,  -835,
+     1041,  1041,  1263,  1263, -3532, -3532,  3329,  3329,
+     6093,  6093,  -576,  -576, -2505, -2505,  3123,  3123,
+     3789,  3789,  1693,  1693, -2302, -2302,  5990,  5990,
+    -1728, -1728,  4774,  4774, -2920, -2920,  -922,  -922,
+     5079,  5079,  5383,  5383,  5681,  5681, -5184, -5184,
+     2033,  2033,  3529,  3529, -2766, -2766,  2948,  2948,
+     3860,  3860,  4754,  4754, -3263, -3263,  6099,  6099,
+    -1702, -1702,  3991,  3991, -3445, -3445,  -709,  -709,
+     1973,  1973,  2500,  2500,  6008,  6008, -5106, -5106,
+     -316,  -316,  1954,  1954, -2127, -2127,  5919,  5919,
+    -4789, -4789,  5735,  5735, -3029, -3029,  -948,  -948,
+     5862,  5862,  5908,  5908,  5468,  5468, -2078, -2078,
+     4916,  4916,  3202,  3202, -2844, -2844,  5297,  5297,
+     5435,  5435,  4115,  4115,  6055,  6055,  2459,  2459,
+    -2683, -2683,  3757,  3757,  3602,  3602,  4016,  4016,
+       56,    56,  5876,  5876, -4912, -4912,  4240,  4240,
+    -1018, -1018, -1483, -1483,  -241,  -241,   168,   168,
+     5339,  5339, -2447, -2447,   431,   431, -3054, -3054,
+    -4449, -4449,  -723,  -723,   504,   504,  3728,  3728,
+     4948,  4948,  1293,  1293,  3127,  3127, -1058, -1058,
+    -2169, -2169,  1512,  1512, -1105, -1105,  2555,  2555,
+     3879,  3879, -2908, -2908, -3174, -3174,  5782,  5782,
+     4536,  4536, -3315, -3315, -4624, -4624,  -652,  -652,
+     3565,  3565,  2767,  2767,  5057,  5057,  1319,  1319,
+     2344,  2344, -1583, -1583, -1956, -1956, -1594, -1594,
+    -3988, -3988,  2882,  2882,  3957,  3957, -5257, -5257,
+    -4749, -4749, -5868, -5868, -4782, -4782,   325,   325,
+    -3643, -3643,  -418,  -418, -3482, -3482, -1958, -1958,
+    -5315, -5315, -2057, -2057,   975,   975,  1360,  1360,
+    -1428, -1428, -1428, -1428,  2366,  2366,  2366,  2366,
+     1381,  1381,  1381,  1381,     1,     1,     1,     1,
+     5179,  5179,  5179,  5179, -4846, -4846, -4846, -4846,
+    -3296, -3296, -3296, -3296,  -563,  -563,  -563,  -563,
+    -3284, -3284, -3284, -3284,   140,   140,   140,   140,
+        9,     9,     9,     9, -2545, -2545, -2545, -2545,
+     5542,  5542,  5542,  5542, -5086, -5086, -5086, -5086,
+    -5067, -5067, -5067, -5067, -4978, -4978, -4978, -4978,
+     1260,  1260,  1260,  1260,    81,    81,    81,    81,
+     1673,  1673,  1673,  1673,   722,   722,   722,   722,
+     3382,  3382,  3382,  3382,  3553,  3553,  3553,  3553,
+     4354,  4354,  4354,  4354,  -949,  -949,  -949,  -949,
+      729,   729,   729,   729,  2768,  2768,  2768,  2768,
+    -5791, -5791, -5791, -5791,  5860,  5860,  5860,  5860,
+    -4890, -4890, -4890, -4890,  2319,  2319,  2319,  2319,
+     3748,  3748,  3748,  3748, -5728, -5728, -5728, -5728,
+      334,   334,   334,   334, -2963, -2963, -2963, -2963,
+     3584,  3584,  3584,  3584,  5146,  5146,  5146,  5146,
+    -3707, -3707, -3707, -3707, -3135, -3135, -3135, -3135,
+    -2396, -2396, -2396, -2396,  3006,  3006,  3006,  3006,
+    -2089, -2089, -2089, -2089, -4611, -4611, -4611, -4611,
+    -2842, -2842, -2842, -2842,  3504,  3504,  3504,  3504,
+    -3637, -3637, -3637, -3637,  3014,  3014,  3014,  3014,
+     2476,  2476,  2476,  2476,  5777,  5777,  5777,  5777,
+    -4632, -4632, -4632, -4632, -1000, -1000, -1000, -1000,
+    -5331, -5331, -5331, -5331,  4134,  4134,  4134,  4134,
+     2548,  2548,  2548,  2548, -2294, -2294, -2294, -2294,
+     2837,  2837,  2837,  2837, -4821, -4821, -4821, -4821,
+     3289,  3289,  3289,  3289,  1177,  1177,  1177,  1177,
+      339,   339,   339,   339, -1646, -1646, -1646, -1646,
+     3932,  3932,  3932,  3932,   955,   955,   955,   955,
+     5767,  5767,  5767,  5767,  5023,  5023,  5023,  5023,
+    -1696, -1696, -1696, -1696,  3051,  3051,  3051,  3051,
+    -2525, -2525, -2525, -2525, -1479, -1479, -1479, -1479,
+    -3694, -3694, -3694, -3694,  2747,  2747,  2747,  2747,
+    -3949, -3949, -3949, -3949, -2975, -2975, -2975, -2975,
+     2881,  2881,  2881,  2881,  1853,  1853,  1853,  1853,
+    -1022, -1022, -1022, -1022,  3621,  3621,  3621,  3621,
+      145,   145,   145,   145,  1326,  1326,  1326,  1326,
+    -2197, -2197, -2197, -2197,  1351,  1351,  1351,  1351,
+     4388,  4388,  4388,  4388,  3091,  3091,  3091,  3091,
+    -4278, -4278, -4278, -4278,  1305,  1305,  1305,  1305,
+     -355,  -355,  -355,  -355,  4805,  4805,  4805,  4805,
+     -130,  -130,  -130,  -130,  2625,  2625,  2625,  2625,
+     3241,  3241,  3241,  3241, -1635, -1635, -1635, -1635,
+     -544,  -544,  -544,  -544, -3195, -3195, -3195, -3195,
+    -5911, -5911, -5911, -5911, -1170, -1170, -1170, -1170,
+     -953,  -953,  -953,  -953,  4591,  4591,  4591,  4591,
+    -2426, -2426, -2426, -2426, -4896, -4896, -4896, -4896,
+    -4177, -4177, -4177, -4177, -4043, -4043, -4043, -4043,
+     1759,  1759,  1759,  1759,  3712,  3712,  3712,  3712,
+     4452,  4452,  4452,  4452,  2744,  2744,  2744,  2744,
+     5092,  5092,  5092,  5092,  -726,  -726,  -726,  -726,
+      480,   480,   480,   480,  3542,  3542,  3542,  3542,
+    -3459, -3459, -3459, -3459,  3201,  3201,  3201,  3201,
+      118,   118,   118,   118, -3328, -3328, -3328, -3328,
+     5755,  5755,  5755,  5755,  4320,  4320,  4320,  4320,
+    -4989, -4989, -4989, -4989,  5736,  5736,  5736,  5736,
+     4231,  4231,  4231,  4231,  1062,  1062,  1062,  1062,
+    -5374, -5374, -5374, -5374,  2639,  2639,  2639,  2639,
+     2013,  2013,  2013,  2013,  4255,  4255,  4255,  4255,
+     2468,  2468,  2468,  2468,  1212,  1212,  1212,  1212,
+    -2731, -2731, -2731, -2731,   790,   790,   790,   790,
+     -827,  -827,  -827,  -827,  5828,  5828,  5828,  5828,
+    -2370, -2370, -2370, -2370, -2370, -2370, -2370, -2370,
+    -5195, -5195, -5195, -5195, -5195, -5195, -5195, -5195,
+    -5191, -5191, -5191, -5191, -5191, -5191, -5191, -5191,
+        3,     3,     3,     3,     3,     3,     3,     3,
+    -2249, -2249, -2249, -2249, -2249, -2249, -2249, -2249,
+    -1689, -1689, -1689, -1689, -1689, -1689, -1689, -1689,
+      420,   420,   420,   420,   420,   420,   420,   420,
+     4654,  4654,  4654,  4654,  4654,  4654,  4654,  4654,
+    -2969, -2969, -2969, -2969, -2969, -2969, -2969, -2969,
+    -2645, -2645, -2645, -2645, -2645, -2645, -2645, -2645,
+      243,   243,   243,   243,   243,   243,   243,   243,
+     2166,  2166,  2166,  2166,  2166,  2166,  2166,  2166,
+    -1630, -1630, -1630, -1630, -1630, -1630, -1630, -1630,
+    -2847, -2847, -2847, -2847, -2847, -2847, -2847, -2847,
+    -3985, -3985, -3985, -3985, -3985, -3985, -3985, -3985,
+     5291,  5291,  5291,  5291,  5291,  5291,  5291,  5291,
+    -5332, -5332, -5332, -5332, -5332, -5332, -5332, -5332,
+    -4895, -4895, -4895, -4895, -4895, -4895, -4895, -4895,
+     3400,  3400,  3400,  3400,  3400,  3400,  3400,  3400,
+     3149,  3149,  3149,  3149,  3149,  3149,  3149,  3149,
+     2884,  2884,  2884,  2884,  2884,  2884,  2884,  2884,
+    -3271, -3271, -3271, -3271, -3271, -3271, -3271, -3271,
+    -1544, -1544, -1544, -1544, -1544, -1544, -1544, -1544,
+    -1777, -1777, -1777, -1777, -1777, -1777, -1777, -1777,
+    -3247, -3247, -3247, -3247, -3247, -3247, -3247, -3247,
+     5042,  5042,  5042,  5042,  5042,  5042,  5042,  5042,
+    -3000, -3000, -3000, -3000, -3000, -3000, -3000, -3000,
+      113,   113,   113,   113,   113,   113,   113,   113,
+     5407,  5407,  5407,  5407,  5407,  5407,  5407,  5407,
+    -2174, -2174, -2174, -2174, -2174, -2174, -2174, -2174,
+     3531,  3531,  3531,  3531,  3531,  3531,  3531,  3531,
+    -4938, -4938, -4938, -4938, -4938, -4938, -4938, -4938,
+     2865,  2865,  2865,  2865,  2865,  2865,  2865,  2865,
+     2780,  2780,  2780,  2780,  2780,  2780,  2780,  2780,
+    -3136, -3136, -3136, -3136, -3136, -3136, -3136, -3136,
+    -4437, -4437, -4437, -4437, -4437, -4437, -4437, -4437,
+    -4048, -4048, -4048, -4048, -4048, -4048, -4048, -4048,
+     3364,  3364,  3364,  3364,  3364,  3364,  3364,  3364,
+     5559,  5559,  5559,  5559,  5559,  5559,  5559,  5559,
+    -1426, -1426, -1426, -1426, -1426, -1426, -1426, -1426,
+     3978,  3978,  3978,  3978,  3978,  3978,  3978,  3978,
+     4053,  4053,  4053,  4053,  4053,  4053,  4053,  4053,
+    -3016, -3016, -3016, -3016, -3016, -3016, -3016, -3016,
+     3915,  3915,  3915,  3915,  3915,  3915,  3915,  3915,
+     2126,  2126,  2126,  2126,  2126,  2126,  2126,  2126,
+    -4414, -4414, -4414, -4414, -4414, -4414, -4414, -4414,
+    -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905,
+     2704,  2704,  2704,  2704,  2704,  2704,  2704,  2704,
+    -3510, -3510, -3510, -3510, -3510, -3510, -3510, -3510,
+     1484,  1484,  1484,  1484,  1484,  1484,  1484,  1484,
+    -2399, -2399, -2399, -2399, -2399, -2399, -2399, -2399,
+      160,   160,   160,   160,   160,   160,   160,   160,
+    -1153, -1153, -1153, -1153, -1153, -1153, -1153, -1153,
+    -4057, -4057, -4057, -4057, -4057, -4057, -4057, -4057,
+    -2178, -2178, -2178, -2178, -2178, -2178, -2178, -2178,
+    -1663, -1663, -1663, -1663, -1663, -1663, -1663, -1663,
+    -2686, -2686, -2686, -2686, -2686, -2686, -2686, -2686,
+     2305,  2305,  2305,  2305,  2305,  2305,  2305,  2305,
+      671,   671,   671,   671,   671,   671,   671,   671,
+     4919,  4919,  4919,  4919,  4919,  4919,  4919,  4919,
+     3186,  3186,  3186,  3186,  3186,  3186,  3186,  3186,
+    -4372, -4372, -4372, -4372, -4372, -4372, -4372, -4372,
+      476,   476,   476,   476,   476,   476,   476,   476,
+     3636,  3636,  3636,  3636,  3636,  3636,  3636,  3636,
+     2481,  2481,  2481,  2481,  2481,  2481,  2481,  2481,
+     2481,  2481,  2481,  2481,  2481,  2481,  2481,  2481,
+     4143,  4143,  4143,  4143,  4143,  4143,  4143,  4143,
+     4143,  4143,  4143,  4143,  4143,  4143,  4143,  4143,
+     2401,  2401,  2401,  2401,  2401,  2401,  2401,  2401,
+     2401,  2401,  2401,  2401,  2401,  2401,  2401,  2401,
+       27,    27,    27,    27,    27,    27,    27,    27,
+       27,    27,    27,    27,    27,    27,    27,    27,
+    -2912, -2912, -2912, -2912, -2912, -2912, -2912, -2912,
+    -2912, -2912, -2912, -2912, -2912, -2912, -2912, -2912,
+     5019,  5019,  5019,  5019,  5019,  5019,  5019,  5019,
+     5019,  5019,  5019,  5019,  5019,  5019,  5019,  5019,
+      773,   773,   773,   773,   773,   773,   773,   773,
+      773,   773,   773,   773,   773,   773,   773,   773,
+    -5084, -5084, -5084, -5084, -5084, -5084, -5084, -5084,
+    -5084, -5084, -5084, -5084, -5084, -5084, -5084, -5084,
+    -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+    -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+    -1537, -1537, -1537, -1537, -1537, -1537, -1537, -1537,
+    -1537, -1537, -1537, -1537, -1537, -1537, -1537, -1537,
+     5101,  5101,  5101,  5101,  5101,  5101,  5101,  5101,
+     5101,  5101,  5101,  5101,  5101,  5101,  5101,  5101,
+     3763,  3763,  3763,  3763,  3763,  3763,  3763,  3763,
+     3763,  3763,  3763,  3763,  3763,  3763,  3763,  3763,
+    -4861, -4861, -4861, -4861, -4861, -4861, -4861, -4861,
+    -4861, -4861, -4861, -4861, -4861, -4861, -4861, -4861,
+    -3704, -3704, -3704, -3704, -3704, -3704, -3704, -3704,
+    -3704, -3704, -3704, -3704, -3704, -3704, -3704, -3704,
+    -3778, -3778, -3778, -3778, -3778, -3778, -3778, -3778,
+    -3778, -3778, -3778, -3778, -3778, -3778, -3778, -3778,
+     1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+     1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+     5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+     5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+     4714,  4714,  4714,  4714,  4714,  4714,  4714,  4714,
+     4714,  4714,  4714,  4714,  4714,  4714,  4714,  4714,
+      442,   442,   442,   442,   442,   442,   442,   442,
+      442,   442,   442,   442,   442,   442,   442,   442,
+    -3066, -3066, -3066, -3066, -3066, -3066, -3066, -3066,
+    -3066, -3066, -3066, -3066, -3066, -3066, -3066, -3066,
+     5698,  5698,  5698,  5698,  5698,  5698,  5698,  5698,
+     5698,  5698,  5698,  5698,  5698,  5698,  5698,  5698,
+     -545,  -545,  -545,  -545,  -545,  -545,  -545,  -545,
+     -545,  -545,  -545,  -545,  -545,  -545,  -545,  -545,
+     -390,  -390,  -390,  -390,  -390,  -390,  -390,  -390,
+     -390,  -390,  -390,  -390,  -390,  -390,  -390,  -390,
+    -1632, -1632, -1632, -1632, -1632, -1632, -1632, -1632,
+    -1632, -1632, -1632, -1632, -1632, -1632, -1632, -1632,
+    -2859, -2859, -2859, -2859, -2859, -2859, -2859, -2859,
+    -2859, -2859, -2859, -2859, -2859, -2859, -2859, -2859,
+     -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+     -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+     1067,  1067,  1067,  1067,  1067,  1067,  1067,  1067,
+     1067,  1067,  1067,  1067,  1067,  1067,  1067,  1067,
+     1440,  1440,  1440,  1440,  1440,  1440,  1440,  1440,
+     1440,  1440,  1440,  1440,  1440,  1440,  1440,  1440,
+      354,   354,   354,   354,   354,   354,   354,   354,
+      354,   354,   354,   354,   354,   354,   354,   354,
+    -2678, -2678, -2678, -2678, -2678, -2678, -2678, -2678,
+    -2678, -2678, -2678, -2678, -2678, -2678, -2678, -2678,
+    -3833, -3833, -3833, -3833, -3833, -3833, -3833, -3833,
+    -3833, -3833, -3833, -3833, -3833, -3833, -3833, -3833,
+    -4885, -4885, -4885, -4885, -4885, -4885, -4885, -4885,
+    -4885, -4885, -4885, -4885, -4885, -4885, -4885, -4885,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red1024_inv_mixed_powers_rev_gs_cg[5120] = {
+     5789,  3502,  1658,  5618,  1398, -3090,  5043,   826,
+     1506, -3065, -4483, -5703,  5900,  -910, -4719,  -751,
+    -2622, -5386,   510, -4661,  -578, -5368,  -450,  1944,
+       63,  5135,  4684,  3360, -3670, -3808,  2373,  4987,
+     2293,   417,  2338, -4693, -3469,  6138,  4443,  3418,
+     1590, -4411, -2334, -1223,  5103, -1891, -1555,  1802,
+     -614, -1280, -1371,    24,  -904, -2485,  5547,  5039,
+     1927,  1015,  -881,   365,  2637, -4510,  2946,  5461,
+    -3929, -1706, -3229, -4730,  2021, -2832,  3572,  1282,
+    -3941,  3753, -3536, -5370,  5646,  6086,  3120, -6105,
+        7,  1936,  -845, -3723,  5054, -3154,  4360,  3285,
+    -5526,   769,   -50,   216,  4153,  2213,   767, -3805,
+     4273, -3221,  3837,  2595,   567, -2941,  5289,  5662,
+      980,   682,  4590, -5082, -5202,   844, -4050,  5207,
+     2945, -5349,  2633,  1406,   293, -3232, -3769, -4855,
+     1265, -3007, -3480, -2171,  3944,  4099, -5604,  5530,
+     -874,  2301,   170, -5650, -4289,  2307,  -150,   648,
+       21,  5808, -2535,  1120,  2873,  2827,   791, -2434,
+      502, -5118,  2602, -1901,  6063,  3793, -1573,  3846,
+      466, -1030,  1681, -3821,  4649,  5969, -2929, -6026,
+    -4301, -4523,  -457,     8,  3795,  3268,  1849,  5776,
+    -3454, -3758, -4390,  4218,   879,  2593,   982, -2276,
+      530,  2626,  -778, -4504,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481, -2957, -3317,  2532,   139,  3332,
+    -4094, -3451, -4378, -1241,  5781,  3045, -2643,  1095,
+    -1842, -3840, -4113,    72, -2712,  4834,  4352,  2828,
+    -5410,  1251, -5275, -1790,  1882,  6125,  1040, -2035,
+     4770,  -944,  5287, -3669,  3020, -5673, -4665,  5406,
+     5078, -1783,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, -1160, -4820,  5411, -2730, -1868, -2253,
+     4423, -3869,  1530, -1694, -1734, -3815, -1350,  5832,
+      189,  3116,  1763, -2209,  1279,   865, -5170,  2672,
+     2110,   716, -5416, -2164,  -416,   814, -2450, -1705,
+      343, -3448, -4538,  1908,  1866,  5211,  4727,  1208,
+     4103,  2429,  1536,  1721,   717, -3589,  2982,  1373,
+     3515,  -438, -1218, -5061, -5993,  3278,  5412, -4209,
+     -612, -4238, -3368,  4227,   540,   125,  1526,  4222,
+    -3163, -4032,  6127, -4840,  2068,  1389,  -346, -4404,
+      464,  1928,  3678,  4265,  3205,  3359,  1092, -5209,
+    -1136, -3449,  3708, -3238,  3171,  4489, -1826, -2926,
+     2769, -3114, -5966,   212, -3889,   579,  5987,  5596,
+    -5508, -1275, -5734,  1176,  4860,  1125,  1445,  1131,
+     1756, -4145,  3961,  3534,  2065,  5826, -3495, -4564,
+     4176,  5063, -3765,  1518,  4267,  5653, -2461,  2275,
+     1014,  -448, -4781,  4924, -5232, -3942,  1327,  3607,
+       60, -2717,  1535,  3200, -5836,  4566,  2260,    68,
+    -5588, -5845,   412,  5102, -3744, -4963,  2528, -3056,
+     3087,  5835, -3975,  4883,  4505, -2257,  5676, -1417,
+     5464,  4906,   512,  4670,   239,  2900,   994,  4554,
+     5268,  -146,  -406, -1687, -6094,  5189,  1804, -1403,
+    -3982,  2947, -5609,   636,   622,  1737,  5672,  4499,
+    -4235, -3825, -4913,  3528,  2291,  3375,  4335,  3393,
+     4251,  4739,  1226,  5518, -3028,  5216,   364,  2360,
+    -4475, -5246,  1236,  3017,  1057, -2600, -4705,  3121,
+     3042, -1344, -2054,  2483, -3407,   463,  3981, -1468,
+      180,  4138,  4605, -2689, -5219,  1409, -5509,   204,
+    -3511, -5478, -2776,  1178, -3408,  1942, -1165,  2575,
+     1392,  5784, -1255,   506, -2674, -2212,  3276, -3338,
+    -1836,  -425,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, -2231, -6085,  4167, -1038,  -923,
+    -5959,  2148, -3959,  5797, -1248,  2442,  4939, -5115,
+     1029,  1945, -1325,  5724,  5598,  3344,  1892,  3624,
+       20, -5002,  4608,  5163,  2151,  1522, -3343,  4119,
+    -1744, -1314, -3654, -2894, -5690, -2455,  3947,  -338,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red1024_twiddles_4step[1024] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731, -2013, -2468,  5374, -1212, -2639, -4255, -1062,
+    -6039,  -404,  3833,  2678,  4372, -4919, -3186,  -671,
+     3643,  3988,  4749, -2344,  4782,  1956, -3957, -5057,
+     -325,  1594,  5257, -1319,  5868,  1583, -2882, -2767,
+     2731, -4231, -2013, -5755, -2468,  4989,  5374,  -118,
+    -1212, -5736, -2639,  3328, -4255, -4320, -1062, -3201,
+    -6039, -4976,  -404, -1912,  3833,  -354,  2678, -1440,
+     4372, -2305, -4919,  1663, -3186,  2686,  -671,  2178,
+     2731, -5755,  5374,  -480, -4255, -3201, -5736, -2744,
+     4372,  1663,  -671,  1153,  -404, -2987,  -354,   242,
+     -325, -2555, -1319,  3054, -2882, -1293,  3315,  1483,
+     4749,  2169, -3565, -5339,  1956,  -504,  3174,  4912,
+     2731,  3459, -4231, -1759, -2013, -5092, -5755,  2426,
+    -2468,  -480,  4989,  4177,  5374, -4452,  -118,   953,
+    -1212, -3542, -5736,  4043, -2639, -2744,  3328, -4591,
+    -4255,   726, -4320,  4896, -1062, -3712, -3201,  1170,
+     2731, -5092,  4989,   953, -2639,  4043, -3201,  1635,
+     3833,   242, -1912,  2566,  -671,  3510,  4057, -3915,
+     4782,   241,  3174, -5468, -2344,  2683, -4948,   316,
+    -2882, -5876, -1512, -5735,   652, -5297,  3054,   709,
+     2731, -1759, -5755, -3241,  5374,   953,  -480,  4278,
+    -4255,  4896, -3201, -4805, -5736,  3195, -2744, -1351,
+     4372, -1484,  1663, -3915,  -671,  4905,  1153, -3978,
+     -404,  5444, -2987,  -875,  -354,   390,   242,  3066,
+     2731,  2426,  -118,  4278, -1062,  1635, -2744, -3621,
+    -3186,  4905,  4057,  1426,  -354,   545, -5011, -1207,
+     5868, -3202, -1293, -3529,   652,  5106, -4240, -3123,
+     1956,  3029,  -431,  2920, -3879,  1702,  2683, -1041,
+     2731,  5911,  3459,  -145, -4231,   355, -1759,  3694,
+    -2013, -3241, -5092, -2881, -5755, -4388,  2426,  1696,
+    -2468,   544,  -480,  1022,  4989,  4278,  4177,  2525,
+     5374,   130, -4452,  3949,  -118,  2197,   953, -5767,
+     2731, -3241,  -480,  3949, -5736, -1351,  4896,  -955,
+     -404,  -875,   242, -5012,  1663, -3364,  4905, -5407,
+     4749, -1973, -5339, -5206,  3174,  2920,  2844, -5886,
+    -1319, -2948, -4016,  3956, -1293,   576, -5735, -5942,
+     2731,   355, -5092,  1696,  4989,  1022,   953, -2837,
+    -2639, -1351,  4043,  1646, -3201, -2747,  1635,  1000,
+     3833, -5698,   242, -1017, -1912, -1207,  2566,  1607,
+     -671, -5559,  3510, -5407,  4057, -2780, -3915,  1777,
+     2731, -4388, -4452,  -339, -4320, -2747,  3195, -5777,
+    -4919, -3364,  3510,  3000, -2987,   493,   545, -5101,
+     5257,   922, -4016, -1962, -1512,  -347, -1954,  4737,
+    -3565, -6093, -4916,  1050,  -431,   787,  3263,    58,
+     2731,  -145, -1759, -2548, -5755,  1696, -3241,  2089,
+     5374,  3949,   953, -2476,  -480,  -339,  4278, -3584,
+    -4255, -1853,  4896,  1000, -3201,  -955, -4805,  3135,
+    -5736,  1479,  3195, -3504, -2744,  4821, -1351,  5728,
+     2731, -2881,  4177, -2476,  3328,  1646, -4805,  2963,
+     2678, -5012,  2566, -1168,  1153,  3000,  1426,  2847,
+    -3957,   192,  2844,  4213, -4948,  -468, -3860,  4324,
+     3315, -5369, -1954, -2281, -4240,  1566, -5990, -5961,
+     2731,  3694,  2426,  2089,  -118, -2837,  4278,  5791,
+    -1062,  -955,  1635,  2963, -2744, -5777, -3621,  -722,
+    -3186, -2865,  4905, -3400,  4057, -5042,  1426, -2166,
+     -354,  3778,   545,  5084, -5011, -6022, -1207, -4337,
+     2731,  1696,   953, -3584, -3201,  1000, -1351,  -722,
+     -671, -5407, -3915,  2847,   242, -5101, -1207, -2437,
+    -2882,  3772, -5735, -4493,  3054,  4079, -5990, -1200,
+     3174,  4698,  3263,  -885,  2683, -5925, -5206, -3710,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+     2731, -3289,   544, -4354, -3542, -3006, -1853,  4846,
+    -4976, -1378, -5698,   -27, -1484, -5291, -2865,   476,
+     3988,  -654, -1973,  5445,   241,  6068,   192, -5874,
+    -2555,  4049,   922,  1747, -3202, -2655,  3772,  2882,
+     2731, -2548, -3241, -1260,  -480, -3584,  3949,  -827,
+    -5736, -3504, -1351,   563,  4896, -2768,  -955,  1062,
+     -404, -1378,  -875, -2437,   242,  5084, -5012, -3833,
+     1663, -3149, -3364,  5195,  4905,  -243, -5407, -2686,
+     2731,  4632,   130,    -9,   726, -2319,  1479,  2639,
+    -2305, -3149, -5559,  2370,  5444, -3780,  3778,  1440,
+     1594,  4049, -2948,  6065, -5876, -2051, -5369, -3315,
+     2169, -1190, -6093, -3643,  3029,  3477,  4698,   431,
+     2731,  3637,   355, -5179, -5092,  -729,  1696,  5755,
+     4989, -3584,  1022,  2468,   953,  5067, -2837,  4452,
+    -2639, -3006, -1351,  5828,  4043,  -722,  1646,  3542,
+    -3201, -2319, -2747,  1062,  1635,  -140,  1000, -4896,
+     2731,  2089,  4278,  -827, -2744,  -722,  -955,  -726,
+     -354,  5084, -1207,  4976,  4905,  2249, -5042,  2704,
+     1956,  6068,  2920,  3957,  2683, -3262,  -468,    56,
+    -1293, -2051,  -347,  1512,  5106, -3762,  4079,  5919,
+     2731,  3707, -4388,  2013, -4452,  5067,  -339, -4177,
+    -4320, -2768, -2747,  3201,  3195,    -1, -5777,  2625,
+    -4919, -5291, -3364,  2305,  3510,  2249,  3000, -4905,
+    -2987, -3780,   493,  5277,   545, -4885, -5101,  5698,
+     2731,  -334,  2197, -4989, -3712,  -140,  4821, -3195,
+     2686,  -243, -2780,   160,   390, -4885, -6022,   435,
+     1583, -2655,   576,  1293, -5297, -3762,  1566,  -709,
+     -504,  3477,   787,  6055,  1702, -3988, -5925,  3789,
+     2731,  4890,  -145, -3459, -1759, -5179, -2548,  -355,
+    -5755, -1260,  1696, -2426, -3241,  2013,  2089,  2881,
+     5374, -4354,  3949,  4452,   953,  -827, -2476, -2197,
+     -480,    -9,  -339,  -544,  4278, -4989, -3584, -2525,
+     2731,  -729,  1022,  4452,  4043,  5828,  1000,  1326,
+    -1912, -2437, -1017,  -390, -3915,  2305, -3400,  2865,
+    -2344,  5445, -5206,  5435, -5468,  3957,  4213, -3532,
+     3054,  6065, -1962,  6099, -3529,  1293, -4493, -2738,
+     2731, -3382, -2881, -2426,  4177,  2468, -2476, -3949,
+     3328,   563,  1646,  1305, -4805,  3201,  2963,  1177,
+     2678,   -27, -5012,  -390,  2566,  4976, -1168,  -493,
+     1153,  2370,  3000,  5559,  1426,   160,  2847,  5042,
+     2731, -1260,  3949,  -544,  4896,  1062, -3504,  5023,
+     1663,  5195, -5407,  5559,  -875,  5277,  5084, -4861,
+    -1319,  1747,  3956,  6099, -5735,  1512, -2281, -1805,
+    -5339, -3643,  1050,  1041,  2920,  6055,  -885, -4213,
+     2731, -5542,  3694,  -355,  2426,  5755,  2089,  3289,
+     -118,  -827, -2837, -3949,  4278, -4177,  5791, -2842,
+    -1062,  4846,  -955,  1326,  1635,  -726,  2963, -1000,
+    -2744,  2639, -5777,  5023, -3621, -3195,  -722,  5146,
+     2731,  3284,  2525, -2197, -4591,  3542,  3135, -1000,
+    -1440, -3833,  1607,  -493, -3978, -4905, -2166, -4895,
+    -5057, -5874, -5886, -3532,   316,    56,  4324, -5456,
+     1483, -3315,  4737, -1805, -3123,  -709, -1200, -1146,
+     2731, -5179,  1696,  2881,   953,  4452, -3584, -2842,
+    -3201,  1062,  1000,  1177, -1351,  2625,  -722,  5860,
+     -671,   476, -5407,  2865, -3915,  2704,  2847, -4895,
+      242,  1440, -5101, -4861, -1207,   435, -2437,  3780,
+     2731,  1428, -5767, -2525,  1170, -4896,  5728,  5146,
+     2178, -2686,  1777,  5042,  3066,  5698, -4337,  3780,
+    -2767,  2882, -5942, -2738,   709,  5919, -5961, -1146,
+     4912,   431,    58, -4213, -1041,  3789, -3710,   400,
+};
+
+const int16_t ntt_red1024_inv_twiddles_4step[1024] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731, -1428,   827,  1381,  -790,  2366, -5828,     1,
+     -476, -2370, -3636, -5195,  4885,  2481, -4096, -4284,
+      418, -1843,  2057, -2925,  1958,  3656, -1360,  3762,
+     3482,  5874,  -975, -4080,  5315, -6118,  1254, -5529,
+     2731,  5179, -1428, -3284,   827, -3296,  1381,     9,
+     -790, -4846,  2366,   140, -5828,  -563,     1, -2545,
+     -476, -5191, -2370, -2249, -3636,     3, -5195, -1689,
+     4885,  4143,  2481,  2401, -4096,  3248, -4284,  2437,
+     2731, -3284,  1381, -5067, -5828, -2545, -4846,    81,
+     4885,  2401, -4284,  4337, -2370,   420,     3, -2645,
+     3482, -5906, -4080, -3477,  1254,   400,  3514, -5445,
+     2057, -3009,  5333, -3434,  3656,   441, -4298,   295,
+     2731,  5542,  5179,  3382, -1428,  1260, -3284,   729,
+      827, -5067, -3296,  4354,  1381,  1673,     9, -5791,
+     -790, -5086, -4846,  3553,  2366,    81,   140,  2768,
+    -5828, -4978,  -563,  -949,     1,   722, -2545,  5860,
+     2731,  1260, -3296, -5791,  2366,  3553, -2545, -5728,
+    -3636, -2645, -2249, -3985, -4284, -2143,    27, -1045,
+     1958, -2503, -4298, -1146, -2925, -1489, -5429,  3030,
+     1254,  1987,   147, -4324, -1321,   151, -3477, -6068,
+     2731,  3382, -3284,   334,  1381, -5791, -5067, -2396,
+    -5828,  -949, -2545,  5146, -4846,  2319,    81, -4611,
+     4885,  5019,  2401, -1045, -4284,  2187,  4337,  1168,
+    -2370, -1630,   420,  3400,     3,  5291, -2645, -3271,
+     2731,   729,     9, -2396,     1, -5728,    81,  3014,
+    -4096,  2187,    27,  5101,     3, -4895,   243, -3247,
+     5315, -4467,   400, -5446, -1321, -3336,  3600,   142,
+     3656, -1112,  1200, -4049, -3963,  2281, -1489,   426,
+     2731, -4890,  5542, -3637,  5179, -3707,  3382,  2548,
+    -1428,   334,  1260, -4632, -3284, -2089,   729,  3289,
+      827,  3748, -5067,  2476, -3296, -2396,  4354,  2837,
+     1381,  3584,  1673, -5331,     9, -2842, -5791,   339,
+     2731,   334, -5067, -5331, -4846, -4611,  -949, -1646,
+    -2370,  3400, -2645,   113,  2401,  3763,  2187,  -493,
+     2057,  1975, -3434,   156, -4298, -4049,  4433,  4322,
+    -4080,   -58,  4780,  2839,   400, -1922, -4324,  3818,
+     2731, -3707,  1260,  3289, -3296,  2476, -5791, -2525,
+     2366, -4611,  3553,   955, -2545,  4134, -5728, -2975,
+    -3636,  3149, -2645, -2174, -2249, -3247, -3985, -3136,
+    -4284,  6022, -2143,  -493,    27, -3704, -1045,   442,
+     2731, -2089,  1673,  5767,  -563,  4134,  2319,  1853,
+     2481,  3763, -2143, -5088,   420,  5407, -4895, -1426,
+     -975, -4213,  4780,   677,   147,  1278,  1359, -1728,
+     5333,   218,  2655,  1263,  1200,  1404,  3570,  2948,
+     2731, -3637,  3382, -3694, -3284,  3289,   334,  4388,
+     1381, -5331, -5791, -1022, -5067,  5767, -2396,  -130,
+    -5828,  5777,  -949, -2975, -2545, -1646,  5146,  1305,
+    -4846, -2294,  2319,  1326,    81,  3051, -4611, -1635,
+     2731, -4632,  4354, -1022,   140,   955,  5146,  2625,
+    -5195,   113, -3985,  3978,  4337, -5088,  5101, -1632,
+    -1360, -5766,  4433,  -922, -5429, -2361, -5915,  5735,
+     3514,  5537,  1359, -1702,  3600, -3532,  4169,  6055,
+     2731,  2548,   729,  4388,     9, -2525, -2396,  -953,
+        1, -1646, -5728,  2625,    81,  1853,  3014,  3712,
+    -4096, -4645,  2187,   875,    27,  4714,  5101, -2859,
+        3, -4938, -4895, -4414,   243,  5559, -3247, -1153,
+     2731,  3289, -5791,  -130, -2545, -2975, -4611,  3712,
+    -4284,  -493, -1045, -1632, -2645, -1426, -3247, -2178,
+     1254, -5415, -4324, -4789, -3477, -2302,  4169,   431,
+    -4298,  2919,  3570,  2459, -1489,  4754,   156, -2908,
+     2731,  3932, -4890, -5911,  5542,   145, -3637, -3459,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     2731, -1696,  3748, -4177, -5086,  3091,  5777,  5736,
+    -5191, -4048,  3149, -4057,  5019,  -390, -4645,  6039,
+    -1843,  2031,  1975, -1483, -2503,  -709, -5766, -1594,
+    -5906, -2920, -4213, -1105, -4467,  4916, -5415, -1254,
+     2731, -3694,   334,  5092, -5067,  -130, -5331,  2468,
+    -4846,  1326, -4611,  4320,  -949,  4591, -1646,    -1,
+    -2370, -4048,  3400, -2178, -2645, -4414,   113,  3636,
+     2401,  5698,  3763, -2678,  2187,  5011,  -493, -3248,
+     2731,  2881,  3584,   118, -4978, -3195, -2294, -2366,
+     4143,  5698,  6022,   404, -1630, -2399, -4938,  1689,
+     5874, -2920,   -58, -4624,  1987,  5435,  5537, -3514,
+    -3009,  2500,   218,  -418, -1112, -3054,  2919, -1200,
+     2731,   145, -3707,  4231,  1260, -2426,  3289,  3284,
+    -3296,  -130,  2476,  -827, -5791,   480, -2525, -1673,
+     2366,  3091, -4611,  4255,  3553,  3712,   955,  5086,
+    -2545, -3195,  4134,    -1, -5728, -3328, -2975,   949,
+     2731,  4388, -2396,  2468,    81,  3712, -1646,  4978,
+        3, -4414, -3247,  5191,  2187,  1912,  4714,  -773,
+     3656,  -709, -4049,  1360, -1489,  -723, -2361, -3969,
+      400,  5435,  1278,  -147, -3336,  5057, -2302,  3438,
+     2731,  -355, -2089,  1428,  1673,   480,  5767, -4354,
+     -563,  4591,  4134,  2545,  2319,  1062,  1853,  2963,
+     2481,  -390,  3763, -4143, -2143,  1912, -5088, -2187,
+      420, -2399,  5407,  2969, -4895, -4372, -1426, -3149,
+     2731,  3241, -2842,  3296,   722, -3328,  3051, -2319,
+     3248,  5011, -3704,  2912,  5291, -4372,  5559, -2884,
+    -6118,  4916, -1922,  -400,   151,  5057, -3532,  6068,
+      441, -3054,  1404, -5961,  2281,  1843,  4754,   350,
+     2731, -5911, -3637, -5542,  3382,  4231, -3694,  3707,
+    -3284,  5092,  3289,  -729,   334,  1428,  4388,  4632,
+     1381, -4177, -5331, -1673, -5791,  2468, -1022,  2842,
+    -5067,   118,  5767, -3748, -2396,  3296,  -130, -2837,
+     2731, -2426,  2476, -1673,  3553,  4255, -2975, -3504,
+    -2249, -2178, -2174, -5291, -1045, -4143,   875,  4645,
+    -2925, -1483,   156, -2051, -1146,  1360,  -922,  1566,
+    -3477, -4624,   677,  2049, -5446,  -400, -4789, -4075,
+     2731,  1759, -4632,  -729,  4354,  -827, -1022,  5331,
+      140,  4320,   955,  3135,  5146,  2545,  2625, -5023,
+    -5195, -4057,   113, -5291, -3985,  5191,  3978, -5407,
+     4337,   404, -5088, -6022,  5101,  2912, -1632, -4714,
+     2731,  5092, -5331, -3748,  -949,    -1,  1326, -1177,
+     2401, -2678,  -493, -6022,  3400,  2969, -4414,  4437,
+    -4080, -1105,  2839,  2049, -4324,  -147, -1702,  -973,
+    -3434,  -418,  1263,  -426, -4049, -5961,  2459,   922,
+     2731, -3459,  2548,  3707,   729,  3284,  4388,  1696,
+        9,  2468, -2525,  5331, -2396, -4354,  -953,  2197,
+        1,  5736, -1646, -3504, -5728,  4978,  2625,  2975,
+       81, -2366,  1853, -1177,  3014, -2319,  3712, -4805,
+     2731,  5755,  2837,  2842,  2768,  5086,  1305,  2975,
+    -1689,  3636, -3136, -5407,  1168, -2187, -2859,   545,
+     3762, -1594,  4322,  1566,  3030, -3969,  5735, -5383,
+    -5445, -3514, -1728,  -973,   142,  6068,   431, -5468,
+     2731,  4231,  3289,  4632, -5791, -1673,  -130,  2197,
+    -2545,    -1, -2975, -5023, -4611,  2963,  3712,  1170,
+    -4284,  6039,  -493,  4645, -1045,  -773, -1632,   545,
+    -2645,  1689, -1426,  4437, -3247, -2884, -2178,  2399,
+     2731,  2013,   339, -2837,  5860,   949, -1635, -4805,
+     2437, -3248,   442, -4714, -3271, -3149, -1153,  2399,
+    -5529, -1254,  3818, -4075, -6068,  3438,  6055, -5468,
+      295, -1200,  2948,   922,   426,   350, -2908, -1293,
+};
+
+const int16_t ntt_red1024_mixed_twiddles_4step[1024] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     4209, -1208,  4404,  5209,   -68,  3056, -1131,  4564,
+    -3624, -4119,  3338,  -377, -3121,  1468,  1403, -4499,
+    -4987,   751, -1802, -5039, -5207,  4855,  6105, -3285,
+     2253, -5832, -2828,  2035,  2276, -4697,  2434, -3846,
+     3643, -3565,  3988, -3879,  4749, -4536, -2344,  2169,
+     4782,  4624,  1956,  1105, -3957,  3174, -5057, -3127,
+     -325,   652,  1594, -2555,  5257, -5782, -1319,  1058,
+     5868,  3315,  1583, -1512, -2882,  2908, -2767, -1293,
+    -4987,  -826, -5039,  1223,  6105,  -216, -5662, -1406,
+     2276,  2957, -3846, -1120, -5832,  4820, -1095,  1790,
+      -68, -4883,  4564, -1176, -1208,  5061, -4222, -4265,
+     3338,  2231,  5115, -5163,  1468, -3017, -4554,  -636,
+    -6039, -2987, -4976, -5011,  -404, -5277, -1912,  5444,
+     3833, -1067,  -354,  2859,  2678,   242, -1440,  1632,
+     4372,  4057, -2305, -1484, -4919,  -160,  1663, -2704,
+    -3186,  1153,  2686,  3510,  -671,  2399,  2178,  4905,
+    -3624, -5163, -2575, -4167,  1468, -5518, -3528, -5189,
+    -1131, -3534, -4883, -4566, -1373,  2164,  4840, -3359,
+     2276,  4504,  -648, -5969,  2035,  1241,  4820,  3815,
+      751,  4661,  -365,  1891, -5662, -4099,  5370,  3154,
+     -325, -4016, -2555,  5106, -1319,  2078,  3054, -2948,
+    -2882, -4115, -1293, -3991,  3315, -5735,  1483, -5383,
+     4749,  2683,  2169, -1973, -3565, -5862, -5339, -2033,
+     1956,  2844,  -504,  3263,  3174,  2127,  4912,  2920,
+     2253,  -865,  3669, -3045, -3846, -2827,  4504,  3758,
+      751,  3808,  1223, -1015, -1282,  3154, -2595,  5349,
+     3338, -4167, -5724,  1314, -2360,  -463,  -636,   146,
+     5209, -1389, -1908,   438, -4883,  3942,  -212,  4145,
+    -1212,  3195, -3542, -3621, -5736, -1305,  4043,  1479,
+    -2639, -2625, -2744,  2975,  3328, -1351, -4591, -5023,
+    -4255,  1635,   726, -1853, -4320, -3091,  4896, -3051,
+    -1062, -4805, -3712, -2747, -3201, -1326,  1170,  -955,
+      -68,  4963, -1176,  4145, -4222,  3449,  2164, -5412,
+     1468, -5216,  -636, -4906,  2231, -5784, -3344,  3343,
+     6105,  3154, -1406,  3221,  -826, -5135,  4510,  1555,
+    -3846, -2307,    -8,  -139,  4820,  3869, -4834, -1040,
+     4782,  3263,   241, -4212,  3174,  2505, -5468,  4698,
+    -2344, -5079,  2683, -5537, -4948, -5206,   316,  1922,
+    -2882, -3529, -5876,  3772, -1512, -1263, -5735,  -426,
+      652, -5990, -5297, -1962,  3054,    64,   709,  4079,
+    -5207,  3007,  3723, -3120,  -826,  5386,  1891,   881,
+     2035,  3840,  -865, -2840, -4218,  -139, -3793,  2535,
+    -1208,   438, -4227, -1092, -1518,  3114,  4963, -1535,
+    -2360,  1344, -3375,  -994, -5163, -1892, -1942, -2185,
+     4372, -3364, -1484, -5042,  1663,  4938, -3915, -3149,
+     -671,  3136,  4905,  1544,  1153, -5407, -3978,  5332,
+     -404, -1207,  5444, -1378, -2987,  2422,  -875, -1002,
+     -354, -5012,   390, -5101,   242,  3704,  3066,  5084,
+    -3121,  1344, -4670,  4913,  2231, -3276, -2442,  5690,
+    -1373,  -716, -1389, -3678, -5102, -1327, -5063, -4860,
+    -5832,  1783,  5673,  4113, -4218, -3578, -2307, -4649,
+    -1282,  -767,  3232, -3837,  4661, -5043,  4411,   904,
+     5868,  -347, -3202,  5915, -1293,  -156, -3529, -2051,
+      652, -1404,  5106,  6119, -4240,  4079, -3123,  2503,
+     1956, -4212,  3029,  6068,  -431,   -52,  2920, -4780,
+    -3879,  -468,  1702,  6136,  2683,  5456, -1041, -3262,
+     2276,  -139, -5969,  -170,  4820, -1763,   944, -5781,
+    -5662,  3769,  3154, -5646,  4661,  4483,  1280, -1590,
+     1468,  4705, -5189, -2291, -5163,  1325, -5784, -2800,
+    -4883, -1327,  -579, -2065,  2164, -1536,  4238,  -464,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+     -118, -2476,  2197,  5067,   953, -3748, -5767,  -827,
+     4404, -1092, -5211,  -717, -1176, -3961,  5845, -1014,
+    -2575, -6092,  1314, -1029, -4670, -2291,  5509,  3121,
+    -5039, -4443,  5368, -1398,  3723,  3229,  3221,  5530,
+     3669,  4113, -3094, -4423, -5969, -2873,  -982,  4697,
+     4749,  1050, -1973, -3262, -5339, -1359, -5206, -3643,
+     3174,  1579,  2920,  1321,  2844,  -885, -5886, -4624,
+    -1319,  4079, -2948,  1747, -4016,  1146,  3956, -1594,
+    -1293, -2281,   576,  1843, -5735, -1858, -5942,  1512,
+    -1802,   881,  5368, -1506, -1406,  5202,  1706,  3285,
+     -648, -2602,  3758,  3332,  5673, -5781,  1350, -4820,
+     4564,  5734, -5835, -1014, -4227, -3205, -5412, -1705,
+    -5724,  5690,   425, -3338, -5189,  4235,  -364,  2483,
+     3833, -5101, -5698, -2481,   242, -5019, -1017,  1440,
+    -1912,  2381, -1207,   404,  2566, -2437,  1607,  5011,
+     -671, -3400, -5559,   476,  3510,  2969, -5407, -1153,
+     4057,  2847, -2780,  2305, -3915,    -3,  1777,  2704,
+     3338, -2185,  1314,  3624,  -636,  -239,  4705,  2483,
+    -4883,  5836,  4145,  5596, -1389,  -464,  2450,  3278,
+    -3846,  -170,  3758,  4697,  -865, -4518, -1040, -1241,
+     1223,   904, -3502,  3360,  3154,  3929, -4590, -3232,
+     5257,   683,   922,  1319, -4016,  1159, -1962,  5297,
+    -1512,  1489,  -347,  -723, -1954,  1843,  4737,  3991,
+    -3565,  6136, -6093,  3879, -4916, -3514,  1050, -4789,
+     -431, -1323,   787, -4912,  3263, -4782,    58,  5681,
+    -2828, -3020, -3094, -2209,    -8,  -530,  1573,  2827,
+     -365,  3469, -3502, -4661,  3232,  5207,  3536,   769,
+     5115, -2151,   425,   506, -3375, -5464, -4605,  5216,
+    -1908, -3515,   346,  4489,  -579, -4564,  4781, -5845,
+    -4255, -2768, -1853,  -726,  4896, -2366,  1000,  3091,
+    -3201,  5086,  -955, -1170, -4805,  1062,  3135,  2747,
+    -5736,  -722,  1479, -4043,  3195,  1212, -3504,  3621,
+    -2744,   563,  4821,  2625, -1351, -3328,  5728,  5023,
+    -1131, -2065,  5845,  4924,  2164, -4209, -3708, -4032,
+    -3528, -5268,  4705,   463, -2442, -2894,  2776, -1038,
+    -5662, -1265,  1706,  2213,  1891,  5039,  4483, -5386,
+     4504,  4301,  1573,  2307,   944,    72, -5411, -1350,
+    -3957, -1323,   192,  5468,  2844, -1956,  4213,   421,
+    -4948,  5529,  -468,  2033, -3860, -4449,  4324,  1278,
+     3315,  3009, -5369,  2500, -1954, -2908, -2281, -3772,
+    -4240, -1958,  1566,  3123, -5990,  4016, -5961,  6122,
+     6105,  5526,  3221, -3232,  4510,  3418,  4483,  2373,
+     4820,  2672, -1040, -3840, -2307, -1901,  -879,  1481,
+    -4222,  -464, -5412,   814,  4963,  3200,  5966, -3495,
+     -636, -1403, -4605,  4739, -5784,  4167,  1248,  4608,
+    -3186,  2249, -2865,  3978,  4905, -2178, -3400, -3000,
+     4057, -4372, -5042,  2780,  1426,  2704, -2166,  3149,
+     -354, -2481,  3778,   442,   545,  -242,  5084,  3763,
+    -5011,  4976, -6022, -2422, -1207, -1065, -4337, -2381,
+     1403,  3982,  5509, -5246, -3344,  5163,  2776,  6092,
+     4840, -5209,  2450,  5412, -5063,  1125,  5232,  4505,
+    -1095,  5406,  1350, -1783, -3793, -5650,  -879,  -778,
+    -2595, -2171,  3536,  4360,  1280,  6138,   -63,  5900,
+    -2882,  1843,  3772,  2031, -5735,  3757, -4493, -5915,
+     3054,  5782,  4079, -3150, -5990,  6099, -1200,  5961,
+     3174,  3957,  4698,  -787,  3263, -3029,  -885, -3438,
+     2683, -4449, -5925,  -522, -5206, -1728, -3710, -3998,
+     2434, -6026,  -982,   139, -4834, -5673, -5411,  1279,
+     5370,   216, -4590, -3480,  4411,  1015,   -63,  1398,
+    -4554,  4499,  -364,  3981, -1942,   375,  1248,  2151,
+     -212,  3534,  4781,   412,  4238,  1928, -4103,   343,
+};
+
+const int16_t ntt_red1024_inv_mixed_twiddles_4step[1024] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     6026,  -874, -3332, -4301, -5406, -4094, -2672,  5078,
+     3805, -3929, -5530,  4273, -5461,  2293,  5789, -2622,
+    -3393,  5464,  -204,  4251,   923, -3511,   338, -5959,
+    -2275,  2769,  1417,  1014,  2926,  -612,  2110,  4103,
+      418,  5333, -1843, -3963,  2057,    49, -2925, -3009,
+     1958, -6065,  3656, -1747, -1360, -4298,  3762, -1159,
+     3482, -1321,  5874, -5906,  -975, -1003, -4080,  -605,
+     5315,  3514, -6118,   147,  1254,  3710, -5529,   400,
+    -3393,  5268,  4251,   180,   338,  1029, -1836, -3408,
+     2926, -3163,  4103,  -416,  2769,  4176, -5588, -5232,
+    -5406, -1842,  5078,   189,  -874,   466,   530,  3795,
+    -5530,   980,     7,  2021,  2293,  1927,  1506,  -578,
+     -476,   420, -5191,   243, -2370, -2969, -2249, -1630,
+    -3636,  4654,     3,  2166, -5195, -2645, -1689, -2847,
+     4885,    27,  4143,  5019,  2481, -2912,  2401,   773,
+    -4096,  4337,  3248, -2143, -4284,  3780,  2437,  2187,
+     3805,  2021,  2945, -5202,  2293,  -904,    63,  1658,
+    -2672,  4194, -1842,  3020,   502,  2873,  2940,  -457,
+     2926,   540,   343, -5993,  1014, -3744,  4176, -5966,
+     5464,   622, -4475, -5219, -1836, -2674, -1744, -3959,
+     3482,  4780, -5906, -3336, -4080,  5594, -3477,   -58,
+     1254,  -382,   400, -3199,  3514, -4324, -5445, -5456,
+     2057, -1489, -3009,  1975,  5333,   453, -3434,  6142,
+     3656,  4433,   441,  3570, -4298, -6119,   295, -4049,
+    -2275,  4860,    60,   412,  4103, -5416,   540,  3708,
+     5464,  2291,   180,  1236,    20, -3959,  1620, -1165,
+    -5530, -5202, -5526, -3536,  -614,  2338,  -578,  5043,
+    -4301, -3317, -4289,  1681, -1842, -5275, -1734,  2840,
+     -790,  2319, -5086,  3014, -4846, -3135,  3553, -2294,
+     2366, -2963,    81, -1000,   140, -4611,  2768,  1177,
+    -5828, -5728, -4978,  5777,  -563,  3006,  -949, -4821,
+        1,  5146,   722,  4134, -2545,  3504,  5860, -1646,
+    -5406, -4378,   189,  2840,   530, -4390,  2873, -2929,
+     2293, -1371,  -578, -4719,   980, -3480,  4153, -1706,
+      338, -3959, -3408,  4578,  5268, -4913,  1057, -5509,
+     4103, -4538,  3205,  -346,  4176,  5987,  4505,  -448,
+     1958,  3570, -2503,  3834, -4298,  6122, -1146,  2919,
+    -2925,  -174, -1489,  5369, -5429,   156,  3030,  -576,
+     1254, -5446,  1987, -5415,   147, -1050, -4324,  1041,
+    -1321,  4169,   151,   677, -3477, -5009, -6068, -2302,
+      923, -1255, -1248,  3947,  5268,  5672, -5219, -5246,
+     1014, -3975,  4860, -4145, -1136,  -346,  1536,   814,
+     -874,  1681,  1701, -4523,  4518, -1350, -4378,  -944,
+     -614,  4443, -3670, -3065,  2021,   767,  2633, -2941,
+     4885,  3763,  5019,  4714,  2401, -3778, -1045,  5698,
+    -4284, -1607,  2187, -3646,  4337,  -493,  1168, -1065,
+    -2370, -3247, -1630, -4048,   420,  3531,  3400, -3016,
+        3,   113,  5291, -1426, -2645,  2780, -3271, -4414,
+    -5461,  4443,  5900,  5135,   980, -5604,  -845,  6086,
+      502,   791, -3317,  3268,  5781,  1251, -1160,   865,
+     2769, -3495, -5836,  5835, -1136, -4238, -4538,  3278,
+       20,  1892, -2776,   375,   622,  -146,  4605,  5518,
+     5315,  1278, -4467,  3860,   400,  5206, -5446,  5435,
+    -1321,  -787, -3336, -2127,  3600, -2302,   142,  -241,
+     3656,  3834, -1112,  -709,  1200,  3329, -4049,  4016,
+    -3963, -2361,  2281,  5908, -1489,  5383,   426,  -723,
+     2926,  -346, -5993,  5211,  4176, -1275,  1535,  5102,
+    -1836, -5478, -3959, -2455,   622,  2900,   364, -2689,
+     2293,  2946,  1658, -3808,  2021,   769, -3480, -5082,
+    -1842,  1251,  1530,  4565,  2873,  3793,  3578,  5776,
+      827,  5767,  3748,  -953, -5067, -2197,  2476,   118,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3332, -4523,   170, -1901,   189,  3019, -2643, -2035,
+     2945,   682, -3536,   216,  5900, -3808, -1555,  5461,
+     4251, -1344, -5609, -1687, -1248,  1522,  4578, -3338,
+       60,  5835, -3765,  5596, -5993, -2164, -1826,   612,
+     2057,  1263,  1975,  -723, -3434,  1954,   156,  -418,
+    -4298, -5184, -4049,  -652,  4433,  2459,  4322,  6065,
+    -4080, -2302,   -58, -1105,  4780,  5468,  2839, -5874,
+      400, -1702, -1922, -3988, -4324, -1018,  3818,  -147,
+     -204, -5246, -5609,  4554, -3408,  4167, -3343,  5959,
+      343, -3589,  3708, -4404, -5836,  5102, -3114, -4176,
+     5078,  3116, -4113, -2035,  1701,     8, -2929,   -21,
+    -5526,  6086,  5289,  5530,  1658,  3360, -1280,  3469,
+    -3636, -1426,  3149,  4919, -2645,  1484, -2174,  1689,
+    -2249,  2126, -3247,  2370, -3985, -2178, -3136,  -243,
+    -4284,   875,  6022,  6039, -2143,  5277,  -493, -4337,
+       27, -1632, -3704, -4143, -1045,   354,   442,  -773,
+    -5530, -2941, -3536, -3805,  -578, -5703,  2946,  3469,
+    -1842, -5673,  2840, -4423, -3317,  5776,  5808, -4649,
+     4103,  5211,  3708,   612,  4860,  1518,  -448,  3744,
+      180,  5518,  1804,  4235, -3959,  4119,   193,  2776,
+     -975,  6008, -4213,  4080,  4780,  3127,   677,  -151,
+      147, -2683,  1278, -3262,  1359, -3988, -1728,  3199,
+     5333,  5908,   218,  3963,  2655, -3315,  1263, -4493,
+     1200,   168,  1404,  -295,  3570, -1958,  2948, -5486,
+     1417,  4566, -3765,  5508,  3205,  4222,  2429,  5416,
+    -4475,  2483,  1804,  -622, -2776,  -923, -1314,  1325,
+        7, -4730,  5289, -1265, -3670,  -751, -4411,  1371,
+    -4289, -3821,   139,  -879,  1530, -5078,  6125,  2643,
+    -5828,  4591,  5777,  4978,  -949,  2639, -2975, -3006,
+    -2545,  3542, -1646, -5860,  5146,    -1,  1305, -4134,
+    -4846,  3712, -2294, -3553,  2319,   790,  1326, -3014,
+       81,  4320,  3051,  2963, -4611,  -140, -1635, -1177,
+    -2672,  4565, -2643, -1882,  2873, -6026, -3758, -1481,
+       63,   826,  2946, -2338,  -845,  3941, -3232,  4050,
+    -1836,   506, -3343, -5598, -5219, -4251,  2900, -5672,
+      540, -5209,  2429,  4538,  1535, -3087,  5653,  3114,
+    -1360,   168, -5766,  1146,  4433, -3656,  -922,  3150,
+    -5429,  2767, -2361, -6142, -5915,  1815,  5735,  -347,
+     3514, -2169,  5537, -1190,  1359, -3710, -1702,  5415,
+     3600, -4782, -3532,  -142,  4169, -4780,  6055,  2505,
+      338,  5724,  4578,  2776,  1057, -3042,  2900, -4335,
+     4176,  1131,  -448,  3975, -4538,  -717,  4489,  4032,
+      530,  5776, -2929,  2535, -4378, -4770, -3815,  1783,
+     -578, -5789, -4411, -5547, -3480,  5202, -3723,  2832,
+    -4096,  1912, -4645, -1168,  2187, -2437,   875,  5088,
+       27, -4885,  4714,  3704,  5101,  -773, -2859, -5698,
+        3,  4919, -4938,  1777, -4895,  2645, -4414, -3364,
+      243,  5191,  5559, -3531, -3247,  5332, -1153, -2126,
+     5789,  1944, -1555,   881,  4153, -2021, -3232,  -682,
+     2940,  4301,  5808,  2929, -1160, -1279, -1790, -4834,
+    -5588,    68, -3114,  3495,  1536, -1866,  4489,  -125,
+     1620, -1392, -1314, -2148,   364,  2054,  3528, -4670,
+     1254, -3988, -5415,  -654, -4324, -5574, -4789, -3860,
+    -3477,  1003, -2302,  -421,  4169,  2049,   431, -6055,
+    -4298,  1360,  2919, -1404,  3570,  1112,  2459, -5919,
+    -1489,  1815,  4754, -1693,   156,  4737, -2908,  2447,
+     2110, -4209, -1826,   346,  4505,  5836,  5653, -1125,
+    -1744, -1029,   193, -5784,  4605, -1236,  3528,  1687,
+     1506,  2622, -1280,  -417,  2633, -3837, -3723,  4730,
+    -1734, -4194,  6125, -3045,  3578, -1849,  3846,  -648,
+};
+
+const int32_t ntt_red1024_mixed_powers_rev_simd[1664] __attribute__ ((aligned(32))) = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5828, -5828, -5828, -5023, -5023, -5023, -5023,
+    -4591, -4591, -4591, -4591,  5728,  5728,  5728,  5728,
+     3328,  3328,  3328,  3328, -5777, -5777, -5777, -5777,
+    -1351, -1351, -1351, -1351,  4978,  4978,  4978,  4978,
+    -2639, -2639, -2639, -2639,  4821,  4821,  4821,  4821,
+    -2625, -2625, -2625, -2625,   949,   949,   949,   949,
+    -2744, -2744, -2744, -2744, -3006, -3006, -3006, -3006,
+     2975,  2975,  2975,  2975,   563,   563,   563,   563,
+    -1212, -1212, -1212, -1212,  1646,  1646,  1646,  1646,
+     3195,  3195,  3195,  3195, -5860, -5860, -5860, -5860,
+    -3542, -3542, -3542, -3542, -3504, -3504, -3504, -3504,
+    -3621, -3621, -3621, -3621,  2545,  2545,  2545,  2545,
+    -5736, -5736, -5736, -5736, -4134, -4134, -4134, -4134,
+    -1305, -1305, -1305, -1305,  -722,  -722,  -722,  -722,
+     4043,  4043,  4043,  4043, -5146, -5146, -5146, -5146,
+     1479,  1479,  1479,  1479,    -1,    -1,    -1,    -1,
+     -790,  -790,  -790,  -790,  -955,  -955,  -955,  -955,
+     1170,  1170,  1170,  1170, -2319, -2319, -2319, -2319,
+    -3201, -3201, -3201, -3201, -3014, -3014, -3014, -3014,
+    -1326, -1326, -1326, -1326,  5086,  5086,  5086,  5086,
+    -1062, -1062, -1062, -1062,  2294,  2294,  2294,  2294,
+    -4805, -4805, -4805, -4805, -3553, -3553, -3553, -3553,
+    -3712, -3712, -3712, -3712,  3135,  3135,  3135,  3135,
+    -2747, -2747, -2747, -2747,  4846,  4846,  4846,  4846,
+    -4255, -4255, -4255, -4255, -1177, -1177, -1177, -1177,
+     1635,  1635,  1635,  1635, -2768, -2768, -2768, -2768,
+      726,   726,   726,   726,  4611,  4611,  4611,  4611,
+    -1853, -1853, -1853, -1853,  -140,  -140,  -140,  -140,
+    -4320, -4320, -4320, -4320,  1000,  1000,  1000,  1000,
+    -3091, -3091, -3091, -3091,   -81,   -81,   -81,   -81,
+     4896,  4896,  4896,  4896,  2963,  2963,  2963,  2963,
+    -3051, -3051, -3051, -3051, -2366, -2366, -2366, -2366,
+      827,   827,   827,   827, -5767, -5767, -5767, -5767,
+      953,   953,   953,   953, -3748, -3748, -3748, -3748,
+     -118,  -118,  -118,  -118, -2476, -2476, -2476, -2476,
+     2197,  2197,  2197,  2197,  5067,  5067,  5067,  5067,
+     5374,  5374,  5374,  5374, -2837, -2837, -2837, -2837,
+      130,   130,   130,   130, -4354, -4354, -4354, -4354,
+    -4452, -4452, -4452, -4452,  2396,  2396,  2396,  2396,
+     3949,  3949,  3949,  3949,  3296,  3296,  3296,  3296,
+    -2468, -2468, -2468, -2468,  -339,  -339,  -339,  -339,
+      544,   544,   544,   544,  5791,  5791,  5791,  5791,
+     -480,  -480,  -480,  -480,  2842,  2842,  2842,  2842,
+     1022,  1022,  1022,  1022,    -9,    -9,    -9,    -9,
+     4989,  4989,  4989,  4989,  5331,  5331,  5331,  5331,
+     4278,  4278,  4278,  4278, -1673, -1673, -1673, -1673,
+     4177,  4177,  4177,  4177, -3584, -3584, -3584, -3584,
+     2525,  2525,  2525,  2525, -1381, -1381, -1381, -1381,
+     2731,  2731,  2731,  2731, -3932, -3932, -3932, -3932,
+     5911,  5911,  5911,  5911,  4890,  4890,  4890,  4890,
+     3459,  3459,  3459,  3459,  3637,  3637,  3637,  3637,
+     -145,  -145,  -145,  -145, -5542, -5542, -5542, -5542,
+    -4231, -4231, -4231, -4231, -2548, -2548, -2548, -2548,
+      355,   355,   355,   355, -3382, -3382, -3382, -3382,
+    -1759, -1759, -1759, -1759,  3707,  3707,  3707,  3707,
+     3694,  3694,  3694,  3694, -5179, -5179, -5179, -5179,
+    -2013, -2013, -2013, -2013, -3289, -3289, -3289, -3289,
+    -3241, -3241, -3241, -3241,  -729,  -729,  -729,  -729,
+    -5092, -5092, -5092, -5092,  2089,  2089,  2089,  2089,
+    -2881, -2881, -2881, -2881,  3284,  3284,  3284,  3284,
+    -5755, -5755, -5755, -5755,  4632,  4632,  4632,  4632,
+    -4388, -4388, -4388, -4388, -1260, -1260, -1260, -1260,
+     2426,  2426,  2426,  2426,  -334,  -334,  -334,  -334,
+     1696,  1696,  1696,  1696,  1428,  1428,  1428,  1428,
+    -1360, -1360, -5297, -5297,  3956,  3956,  6119,  6119,
+    -2555, -2555,  5184,  5184, -6122, -6122, -1200, -1200,
+     1594,  1594,  5106,  5106, -1962, -1962, -5961, -5961,
+     -168,  -168, -3329, -3329, -2692, -2692,  4298,  4298,
+     -325,  -325,   948,   948, -1404, -1404,  1146,  1146,
+    -3728, -3728, -5990, -5990,  4049,  4049,  1159,  1159,
+      652,   652, -6099, -6099,  5766,  5766,  -295,  -295,
+    -4016, -4016, -2919, -2919, -4077, -4077, -3762, -3762,
+     1958,  1958,  2078,  2078, -4322, -4322,  1112,  1112,
+     1058,  1058,   922,   922,  4079,  4079,  -441,  -441,
+    -1319, -1319,   709,   709,  3150,  3150,  4046,  4046,
+    -4240, -4240,   835,   835, -3570, -3570,  6065,  6065,
+     5257,  5257, -5919, -5919, -3834, -3834, -4433, -4433,
+     3054,  3054, -3123, -3123, -5486, -5486,  1747,  1747,
+    -5782, -5782, -2948, -2948,  1566,  1566,  2503,  2503,
+    -2459, -2459,    64,    64,   683,   683, -3656, -3656,
+     2057,  2057, -3202, -3202, -5369, -5369, -4493, -4493,
+    -1512, -1512, -5383, -5383,   350,   350,  1815,  1815,
+     1583,  1583, -2500, -2500, -5942, -5942,  1489,  1489,
+     1483,  1483, -1263, -1263,  5915,  5915,   -49,   -49,
+     5868,  5868, -5735, -5735,  2738,  2738, -2655, -2655,
+      723,   723, -1693, -1693,   174,   174,  3009,  3009,
+     3315,  3315, -4754, -4754,  -426,  -426, -1858, -1858,
+    -3757, -3757,  -347,  -347, -1975, -1975,  2925,  2925,
+      418,   418, -5908, -5908,  3772,  3772,  -453,  -453,
+    -1293, -1293, -4774, -4774,  4737,  4737,  5429,  5429,
+    -2767, -2767, -3991, -3991,  -156,  -156, -3969, -3969,
+    -5876, -5876, -2031, -2031, -2281, -2281, -5333, -5333,
+    -2882, -2882, -1954, -1954,  1805,  1805, -2051, -2051,
+     2447,  2447,   576,   576, -6142, -6142,  3963,  3963,
+     2908,  2908, -3529, -3529,  -218,  -218,  3434,  3434,
+    -4115, -4115,  2361,  2361, -3030, -3030,  1843,  1843,
+     -975,  -975,  2844,  2844, -4212, -4212,  3438,  3438,
+     1105,  1105, -5681, -5681,  -142,  -142,  3477,  3477,
+     1956,  1956, -6008, -6008,  5009,  5009,  -885,  -885,
+      241,   241,  3532,  3532,    58,    58,  1003,  1003,
+     4782,  4782,  3029,  3029, -5886, -5886, -5594, -5594,
+     -504,  -504,  2302,  2302,  4213,  4213,   605,   605,
+     4624,  4624,  3263,  3263, -6077, -6077, -3600, -3600,
+    -3602, -3602,  -421,  -421,  6068,  6068,  4080,  4080,
+     3482,  3482, -5468, -5468,   787,   787, -1010, -1010,
+    -3127, -3127,  2920,  2920, -4169, -4169,  5241,  5241,
+    -5057, -5057,  3445,  3445,  4698,  4698, -4780, -4780,
+     4912,  4912,   192,   192,  2049,  2049,  1321,  1321,
+    -3957, -3957,  2127,  2127, -2839, -2839,  -151,  -151,
+     -431,  -431,  2505,  2505,  1579,  1579,  5906,  5906,
+     3174,  3174,  2766,  2766,   -52,   -52, -1323, -1323,
+    -6055, -6055,  -677,  -677,  3336,  3336, -5874, -5874,
+     5315,  5315, -4916, -4916, -4075, -4075,  4324,  4324,
+     2169,  2169, -5079, -5079,   522,   522, -3262, -3262,
+    -2344, -2344, -1973, -1973, -1278, -1278, -5574, -5574,
+     1018,  1018, -1041, -1041, -5925, -5925, -3514, -3514,
+     4749,  4749,  4789,  4789, -5537, -5537,  4467,  4467,
+     4449,  4449, -3789, -3789,  5456,  5456,  -147,  -147,
+    -4536, -4536, -3860, -3860,  1050,  1050,  5445,  5445,
+     2683,  2683, -3818, -3818, -1190, -1190,  6118,  6118,
+     3643,  3643, -5862, -5862,  5415,  5415,  6136,  6136,
+    -4948, -4948,  1728,  1728, -6137, -6137,  -400,  -400,
+    -3565, -3565,  1702,  1702,  -654,  -654, -1987, -1987,
+      -56,   -56, -5206, -5206,  3199,  3199,  5529,  5529,
+     3988,  3988,   316,   316,  -468,  -468,   382,   382,
+    -5339, -5339, -6093, -6093,  5446,  5446, -3710, -3710,
+    -3879, -3879, -2033, -2033,  1922,  1922,  3998,  3998,
+    -5435, -5435,  -973,  -973, -1359, -1359, -1254, -1254,
+      338,  2894, -3947,  3654,  2455,  1314,  5690,  1744,
+    -4119, -5163,  3343, -4608, -1522,  5002, -2151,   -20,
+    -3624, -5724, -1892,  1325, -3344, -1945, -5598, -1029,
+     5115, -5797, -4939,  3959, -2442, -2148,  1248,  5959,
+      923,  2231,  1038, -6092, -4167,  -193,  6085, -2800,
+     -377,  -392, -4578, -2185,  -375,   425, -1620,  1836,
+     3338,  -506, -3276,  1255,  2212, -5784,  2674, -1392,
+    -2575, -1178,  1165,  2776, -1942,  5478,  3408,  3511,
+     -204,  2689,  5509, -4605, -1409, -4138,  5219,  -180,
+     1468, -2483, -3981,  2054,  -463,  1344,  3407, -3042,
+    -3121, -3017,  4705, -1236,  2600,  5246, -1057,  4475,
+    -2360, -5518,  -364, -1226, -5216, -4739,  3028, -4251,
+    -3393, -3528, -4335,  4913, -3375,  3825, -2291,  4235,
+    -4499,  -636, -5672,  5609, -1737, -2947,  -622,  3982,
+     1403,  1687, -1804,   406, -5189,   146,  6094, -5268,
+    -4554, -4670,  -994,  -512, -2900, -4906,  -239, -5464,
+     1417, -4883, -5676,  3975,  2257, -5835, -4505, -3087,
+     3056, -5102, -2528,  -412,  4963,  5845,  3744,  5588,
+      -68, -3200, -2260, -1535, -4566,  2717,  5836,   -60,
+    -3607, -4924, -1327,  4781,  3942,   448,  5232, -1014,
+    -2275, -1518,  2461,  3765, -5653, -5063, -4267, -4176,
+     4564, -3534,  3495, -3961, -5826,  4145, -2065, -1756,
+    -1131, -1176, -1445,  5734, -1125,  1275, -4860,  5508,
+    -5596,  -212, -5987,  5966,  -579,  3114,  3889, -2769,
+     2926,  3238,  1826, -3708, -4489,  3449, -3171,  1136,
+     5209, -4265, -1092, -3678, -3359, -1928, -3205,  -464,
+     4404,  4840,   346, -6127, -1389,  4032, -2068,  3163,
+    -4222, -4227, -1526,  3368,  -125,  4238,  -540,   612,
+     4209,  5061, -5412,  1218, -3278,   438,  5993, -3515,
+    -1373, -1721, -2982, -1536,  3589, -2429,  -717, -4103,
+    -1208, -1908, -4727,  4538, -5211,  3448, -1866,  -343,
+     1705,  2164,  2450,  5416,  -814,  -716,   416, -2110,
+    -2672,  2209,  5170, -1763,  -865, -3116, -1279,  -189,
+    -5832,  1694,  1350, -1530,  3815,  3869,  1734, -4423,
+     2253,  4820,  1868,  1160,  2730, -3094, -5411, -4518,
+    -2478, -4565, -2840, -4974, -3019,  1783, -4194, -5078,
+    -5406,  3669,  4665, -5287,  5673,   944, -3020, -4770,
+     2035,  1790, -1040,  5275, -6125, -1251, -1882,  5410,
+    -2828,   -72, -4352,  4113, -4834,  3840,  2712,  1842,
+    -1095,  1241,  2643,  4378, -3045,  3451, -5781,  4094,
+    -3332,  2957,  -139, -1481, -2532, -2046,  3317, -2940,
+    -4697,  4504, -3578,   778, -3466, -2626, -1701,  -530,
+     2276, -4218,  -982,  4390, -2593,  3758,  -879,  3454,
+    -5776,    -8, -1849,   457, -3268,  4523, -3795,  4301,
+     6026,  3821,  2929, -1681, -5969,  1030, -4649,  -466,
+    -3846,  1901,  1573, -2602, -3793,  5118, -6063,  -502,
+     2434, -1120,  -791,  2535, -2827, -5808, -2873,   -21,
+     -648,  5650,   150,  -170, -2307, -2301,  4289,   874,
+    -5530,  2171,  5604,  3480, -4099,  3007, -3944, -1265,
+     4855, -1406,  3769, -2633,  3232,  5349,  -293, -2945,
+    -5207,  5082,  4050, -4590,  -844,  -682,  5202,  -980,
+    -5662, -2595, -5289, -3837,  2941,  3221,  -567, -4273,
+     3805,  -216,  -767,    50, -2213,  -769, -4153,  5526,
+    -3285,  3723, -4360,   845,  3154, -1936, -5054,    -7,
+     6105,  5370, -3120,  3536, -6086, -3753, -5646,  3941,
+    -1282,  4730, -3572,  3229,  2832,  1706, -2021,  3929,
+    -5461,  -365, -2946,   881,  4510, -1015, -2637, -1927,
+    -5039,   -24, -5547,  1371,  2485,  1280,   904,   614,
+    -1802,  1223,  1555,  2334,  1891,  4411, -5103, -1590,
+    -3418,  4693, -4443, -2338, -6138,  -417,  3469, -2293,
+    -4987, -3360, -2373, -4684,  3808, -5135,  3670,   -63,
+    -1944,  4661,   450,  -510,  5368,  5386,   578,  2622,
+      751,  5703,  4719,  4483,   910,  3065, -5900, -1506,
+     -826, -5618, -5043, -1658,  3090, -3502, -1398, -5789,
+};
+
+const int32_t ntt_red1024_inv_mixed_powers_rev_simd[1280] __attribute__ ((aligned(32))) = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     5789,  1254,  3502,  1254,  1658,   973,  5618,   973,
+     1398,  1359, -3090,  1359,  5043,  5435,   826,  5435,
+     1506, -3998, -3065, -3998, -4483,  2033, -5703,  2033,
+     5900, -1922,  -910, -1922, -4719,  3879,  -751,  3879,
+    -2622,  3710, -5386,  3710,   510,  6093, -4661,  6093,
+     -578, -5446, -5368, -5446,  -450,  5339,  1944,  5339,
+       63,  -382,  5135,  -382,  4684,  -316,  3360,  -316,
+    -3670,   468, -3808,   468,  2373, -3988,  4987, -3988,
+     2293, -5529,   417, -5529,  2338,  5206, -4693,  5206,
+    -3469, -3199,  6138, -3199,  4443,    56,  3418,    56,
+     1590,  1987, -4411,  1987, -2334, -1702, -1223, -1702,
+     5103,   654, -1891,   654, -1555,  3565,  1802,  3565,
+     -614,   400, -1280,   400, -1371, -1728,    24, -1728,
+     -904,  6137, -2485,  6137,  5547,  4948,  5039,  4948,
+     1927, -6136,  1015, -6136,  -881,  5862,   365,  5862,
+     2637, -5415, -4510, -5415,  2946, -3643,  5461, -3643,
+    -3929, -6118, -1706, -6118, -3229,  3818, -4730,  3818,
+     2021,  1190, -2832,  1190,  3572, -2683,  1282, -2683,
+    -3941, -5445,  3753, -5445, -3536,  3860, -5370,  3860,
+     5646, -1050,  6086, -1050,  3120,  4536, -6105,  4536,
+        7,   147,  1936,   147,  -845,  3789, -3723,  3789,
+     5054, -5456, -3154, -5456,  4360, -4449,  3285, -4449,
+    -5526, -4467,   769, -4467,   -50, -4789,   216, -4789,
+     4153,  5537,  2213,  5537,   767, -4749, -3805, -4749,
+     4273,  3514, -3221,  3514,  3837,  1041,  2595,  1041,
+      567,  5925, -2941,  5925,  5289, -1018,  5662, -1018,
+      980,  5574,   682,  5574,  4590,  1973, -5082,  1973,
+    -5202,  1278,   844,  1278, -4050,  2344,  5207,  2344,
+     2945,  3262, -5349,  3262,  2633,  5079,  1406,  5079,
+      293,  -522, -3232,  -522, -3769, -2169, -4855, -2169,
+     1265, -4324, -3007, -4324, -3480,  4916, -2171,  4916,
+     3944,  4075,  4099,  4075, -5604, -5315,  5530, -5315,
+     -874,  5874,  2301,  5874,   170,   677, -5650,   677,
+    -4289, -3336,  2307, -3336,  -150,  6055,   648,  6055,
+       21,  1323,  5808,  1323, -2535, -2766,  1120, -2766,
+     2873,    52,  2827,    52,   791, -3174, -2434, -3174,
+      502, -5906, -5118, -5906,  2602, -2505, -1901, -2505,
+     6063, -1579,  3793, -1579, -1573,   431,  3846,   431,
+      466,   151, -1030,   151,  1681, -2127, -3821, -2127,
+     4649,  2839,  5969,  2839, -2929,  3957, -6026,  3957,
+    -4301, -1321, -4523, -1321,  -457,  -192,     8,  -192,
+     3795, -2049,  3268, -2049,  1849, -4912,  5776, -4912,
+    -3454,  4780, -3758,  4780, -4390, -3445,  4218, -3445,
+      879, -4698,  2593, -4698,   982,  5057, -2276,  5057,
+      530, -5241,  2626, -5241,  -778, -2920, -4504, -2920,
+     1701,  4169,  3466,  4169,  3578,  3127,  4697,  3127,
+     2940,  1010,  2046,  1010,  1481,  5468, -2957,  5468,
+    -3317,  -787,  2532,  -787,   139, -3482,  3332, -3482,
+    -4094, -4080, -3451, -4080, -4378,   421, -1241,   421,
+     5781, -6068,  3045, -6068, -2643,  3602,  1095,  3602,
+    -1842,  3600, -3840,  3600, -4113, -3263,    72, -3263,
+    -2712,  6077,  4834,  6077,  4352, -4624,  2828, -4624,
+    -5410,  -605,  1251,  -605, -5275, -2302, -1790, -2302,
+     1882, -4213,  6125, -4213,  1040,   504, -2035,   504,
+     4770,  5594,  -944,  5594,  5287, -3029, -3669, -3029,
+     3020,  5886, -5673,  5886, -4665, -4782,  5406, -4782,
+     5078, -1003, -1783, -1003,  4974, -3532,  4565, -3532,
+     4194,   -58,  3019,   -58,  2840,  -241,  2478,  -241,
+     4518,   885,  3094,   885, -1160,  6008, -4820,  6008,
+     5411, -5009, -2730, -5009, -1868, -1956, -2253, -1956,
+     4423, -3477, -3869, -3477,  1530,  5681, -1694,  5681,
+    -1734,   142, -3815,   142, -1350, -1105,  5832, -1105,
+      189, -3438,  3116, -3438,  1763, -2844, -2209, -2844,
+     1279,  4212,   865,  4212, -5170,   975,  2672,   975,
+     2110, -1843,   716, -1843, -5416, -2361, -2164, -2361,
+     -416,  3030,   814,  3030, -2450,  4115, -1705,  4115,
+      343, -3434, -3448, -3434, -4538,  3529,  1908,  3529,
+     1866,   218,  5211,   218,  4727, -2908,  1208, -2908,
+     4103, -3963,  2429, -3963,  1536,  -576,  1721,  -576,
+      717,  6142, -3589,  6142,  2982, -2447,  1373, -2447,
+     3515,  2051,  -438,  2051, -1218,  1954, -5061,  1954,
+    -5993, -1805,  3278, -1805,  5412,  2882, -4209,  2882,
+     -612,  5333, -4238,  5333, -3368,  2031,  4227,  2031,
+      540,  2281,   125,  2281,  1526,  5876,  4222,  5876,
+    -3163,  3969, -4032,  3969,  6127,  3991, -4840,  3991,
+     2068,   156,  1389,   156,  -346,  2767, -4404,  2767,
+      464, -5429,  1928, -5429,  3678,  4774,  4265,  4774,
+     3205, -4737,  3359, -4737,  1092,  1293, -5209,  1293,
+    -1136,   453, -3449,   453,  3708,  5908, -3238,  5908,
+     3171, -3772,  4489, -3772, -1826,  -418, -2926,  -418,
+     2769, -2925, -3114, -2925, -5966,   347,   212,   347,
+    -3889,  1975,   579,  1975,  5987,  3757,  5596,  3757,
+    -5508,  1858, -1275,  1858, -5734,  4754,  1176,  4754,
+     4860,   426,  1125,   426,  1445, -3315,  1131, -3315,
+     1756, -3009, -4145, -3009,  3961,  1693,  3534,  1693,
+     2065,  -174,  5826,  -174, -3495,  -723, -4564,  -723,
+     4176,  2655,  5063,  2655, -3765,  5735,  1518,  5735,
+     4267, -2738,  5653, -2738, -2461, -5868,  2275, -5868,
+     1014,    49,  -448,    49, -4781,  1263,  4924,  1263,
+    -5232, -5915, -3942, -5915,  1327, -1483,  3607, -1483,
+       60, -1489, -2717, -1489,  1535,  2500,  3200,  2500,
+    -5836,  5942,  4566,  5942,  2260, -1583,    68, -1583,
+    -5588, -1815, -5845, -1815,   412,  5383,  5102,  5383,
+    -3744,  -350, -4963,  -350,  2528,  1512, -3056,  1512,
+     3087,  4493,  5835,  4493, -3975,  3202,  4883,  3202,
+     4505,  5369, -2257,  5369,  5676, -2057, -1417, -2057,
+     5464,  3656,  4906,  3656,   512,   -64,  4670,   -64,
+      239,  -683,  2900,  -683,   994,  2459,  4554,  2459,
+     5268, -2503,  -146, -2503,  -406,  2948, -1687,  2948,
+    -6094, -1566,  5189, -1566,  1804,  5782, -1403,  5782,
+    -3982, -1747,  2947, -1747, -5609,  3123,   636,  3123,
+      622,  5486,  1737,  5486,  5672, -3054,  4499, -3054,
+    -4235,  4433, -3825,  4433, -4913,  5919,  3528,  5919,
+     2291,  3834,  3375,  3834,  4335, -5257,  3393, -5257,
+     4251, -6065,  4739, -6065,  1226,  -835,  5518,  -835,
+    -3028,  3570,  5216,  3570,   364,  4240,  2360,  4240,
+    -4475, -4046, -5246, -4046,  1236,  -709,  3017,  -709,
+     1057, -3150, -2600, -3150, -4705,  1319,  3121,  1319,
+     3042,   441, -1344,   441, -2054,  -922,  2483,  -922,
+    -3407, -4079,   463, -4079,  3981, -1058, -1468, -1058,
+      180, -1112,  4138, -1112,  4605, -2078, -2689, -2078,
+    -5219,  4322,  1409,  4322, -5509, -1958,   204, -1958,
+    -3511,  3762, -5478,  3762, -2776,  2919,  1178,  2919,
+    -3408,  4077,  1942,  4077, -1165,  4016,  2575,  4016,
+     1392,   295,  5784,   295, -1255,  6099,   506,  6099,
+    -2674, -5766, -2212, -5766,  3276,  -652, -3338,  -652,
+    -1836, -1159,  -425, -1159,  2185,  5990,   392,  5990,
+     1620, -4049,   375, -4049,  4578,  3728,   377,  3728,
+     2800, -1146,   193, -1146,  6092,  -948, -2231,  -948,
+    -6085,  1404,  4167,  1404, -1038,   325,  -923,   325,
+    -5959, -4298,  2148, -4298, -3959,  3329,  5797,  3329,
+    -1248,  2692,  2442,  2692,  4939,   168, -5115,   168,
+     1029,  5961,  1945,  5961, -1325, -5106,  5724, -5106,
+     5598,  1962,  3344,  1962,  1892, -1594,  3624, -1594,
+       20,  1200, -5002,  1200,  4608, -5184,  5163, -5184,
+     2151,  6122,  1522,  6122, -3343,  2555,  4119,  2555,
+    -1744, -6119, -1314, -6119, -3654,  5297, -2894,  5297,
+    -5690, -3956, -2455, -3956,  3947,  1360,  -338,  1360,
+};
+
@@ -0,0 +1,98 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED1024_TABLES_H
+#define __NTT_RED1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red1024_psi = 1014;
+static const int32_t ntt_red1024_omega = 8209;
+static const int32_t ntt_red1024_inv_psi = 5078;
+static const int32_t ntt_red1024_inv_omega = 3762;
+static const int32_t ntt_red1024_inv_n = 12277;
+static const int32_t ntt_red1024_inv_k = 8193;
+static const int32_t ntt_red1024_rescale8 = 8350;
+static const int32_t ntt_red1024_rescale6 = 1416;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red1024_psi_powers[1024];
+extern const int16_t ntt_red1024_inv_psi_powers[1024];
+extern const int16_t ntt_red1024_scaled_inv_psi_powers[1024];
+extern const int16_t ntt_red1024_scaled_inv_psi_powers_var[1024];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red1024_omega_powers[1024];
+extern const int16_t ntt_red1024_omega_powers_rev[1024];
+extern const int16_t ntt_red1024_inv_omega_powers[1024];
+extern const int16_t ntt_red1024_inv_omega_powers_rev[1024];
+extern const int16_t ntt_red1024_mixed_powers[1024];
+extern const int16_t ntt_red1024_mixed_powers_rev[1024];
+extern const int16_t ntt_red1024_inv_mixed_powers[1024];
+extern const int16_t ntt_red1024_inv_mixed_powers_rev[1024];
+
+/*
+ * TABLES FOR RADIX-4 NTT COMPUTATION
+ */
+extern const int16_t ntt_red1024_omega_powers_ct_r4[1024];
+extern const int16_t ntt_red1024_omega_powers_rev_ct_r4[1024];
+extern const int16_t ntt_red1024_omega_powers_gs_r4[1024];
+extern const int16_t ntt_red1024_omega_powers_rev_gs_r4[1024];
+extern const int16_t ntt_red1024_inv_omega_powers_ct_r4[1024];
+extern const int16_t ntt_red1024_inv_omega_powers_rev_ct_r4[1024];
+extern const int16_t ntt_red1024_inv_omega_powers_gs_r4[1024];
+extern const int16_t ntt_red1024_inv_omega_powers_rev_gs_r4[1024];
+extern const int16_t ntt_red1024_mixed_powers_ct_r4[1024];
+extern const int16_t ntt_red1024_mixed_powers_rev_ct_r4[1024];
+extern const int16_t ntt_red1024_inv_mixed_powers_gs_r4[1024];
+extern const int16_t ntt_red1024_inv_mixed_powers_rev_gs_r4[1024];
+
+/*
+ * TABLES FOR CONSTANT-GEOMETRY NTT COMPUTATION
+ */
+extern const int16_t ntt_red1024_omega_powers_ct_cg[5120];
+extern const int16_t ntt_red1024_omega_powers_rev_ct_cg[5120];
+extern const int16_t ntt_red1024_omega_powers_gs_cg[5120];
+extern const int16_t ntt_red1024_omega_powers_rev_gs_cg[5120];
+extern const int16_t ntt_red1024_inv_omega_powers_ct_cg[5120];
+extern const int16_t ntt_red1024_inv_omega_powers_rev_ct_cg[5120];
+extern const int16_t ntt_red1024_inv_omega_powers_gs_cg[5120];
+extern const int16_t ntt_red1024_inv_omega_powers_rev_gs_cg[5120];
+extern const int16_t ntt_red1024_mixed_powers_ct_cg[5120];
+extern const int16_t ntt_red1024_mixed_powers_rev_ct_cg[5120];
+extern const int16_t ntt_red1024_inv_mixed_powers_gs_cg[5120];
+extern const int16_t ntt_red1024_inv_mixed_powers_rev_gs_cg[5120];
+
+/*
+ * TABLES FOR FOUR-STEP NTT COMPUTATION
+ */
+static const int32_t ntt_red1024_n1_4step = 32;
+extern const int16_t ntt_red1024_twiddles_4step[1024];
+extern const int16_t ntt_red1024_inv_twiddles_4step[1024];
+extern const int16_t ntt_red1024_mixed_twiddles_4step[1024];
+extern const int16_t ntt_red1024_inv_mixed_twiddles_4step[1024];
+
+/*
+ * TABLES IN SIMD LAYOUT (32bit, aligned)
+ */
+extern const int32_t ntt_red1024_mixed_powers_rev_simd[1664];
+extern const int32_t ntt_red1024_inv_mixed_powers_rev_simd[1280];
+
+#endif /* __NTT_RED1024_TABLES_H */
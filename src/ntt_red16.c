@@ -33,9 +33,7 @@ void ntt_red16_product1(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red16_ct_rev2std(c);
-  mul_reduce_array16(c, 16, ntt_red16_scaled_inv_psi_powers);
-  reduce_array_twice(c, 16); // c[i] = 9 * c[i] mod Q
-  correct(c, 16);
+  mul_reduce_finalize(c, 16, ntt_red16_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red16_product2(int32_t *c, int32_t *a, int32_t *b) {
@@ -57,9 +55,7 @@ void ntt_red16_product2(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red16_ct_rev2std(c);
-  mul_reduce_array16(c, 16, ntt_red16_scaled_inv_psi_powers);
-  reduce_array_twice(c, 16); // c[i] = 9 * c[i] mod Q
-  correct(c, 16);
+  mul_reduce_finalize(c, 16, ntt_red16_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red16_product3(int32_t *c, int32_t *a, int32_t *b) {
@@ -81,9 +77,7 @@ void ntt_red16_product3(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red16_gs_rev2std(c);
-  mul_reduce_array16(c, 16, ntt_red16_scaled_inv_psi_powers);
-  reduce_array_twice(c, 16); // c[i] = 9 * c[i] mod Q
-  correct(c, 16);
+  mul_reduce_finalize(c, 16, ntt_red16_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red16_product4(int32_t *c, int32_t *a, int32_t *b) {
@@ -105,9 +99,7 @@ void ntt_red16_product4(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red16_gs_rev2std(c);
-  mul_reduce_array16(c, 16, ntt_red16_scaled_inv_psi_powers);
-  reduce_array_twice(c, 16); // c[i] = 9 * c[i] mod Q
-  correct(c, 16);
+  mul_reduce_finalize(c, 16, ntt_red16_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red16_product5(int32_t *c, int32_t *a, int32_t *b) {
@@ -123,7 +115,53 @@ void ntt_red16_product5(int32_t *c, int32_t *a, int32_t *b) {
   reduce_array_twice(c, 16);  // c[i] = 9 * c[i] mod Q
 
   inttmul_red16_gs_rev2std(c);
-  scalar_mul_reduce_array(c, 16, ntt_red16_rescale8);
-  reduce_array_twice(c, 16);
-  correct(c, 16);
+  scalar_mul_reduce_finalize(c, 16, ntt_red16_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red16_product_r4(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array(a, 16);
+  mulntt_red16_ct_std2rev_r4(a);
+  reduce_array(a, 16);
+
+  shift_array(b, 16);
+  mulntt_red16_ct_std2rev_r4(b);
+  reduce_array(b, 16);
+
+  mul_reduce_array(c, 16, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 16);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red16_gs_rev2std_r4(c);
+  scalar_mul_reduce_finalize(c, 16, ntt_red16_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red16_product7(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array(a, 16);
+  mulntt_red16_ct_std2rev_cg(a, c); // c is used as scratch
+  reduce_array(a, 16);
+
+  shift_array(b, 16);
+  mulntt_red16_ct_std2rev_cg(b, c);
+  reduce_array(b, 16);
+
+  mul_reduce_array(c, 16, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 16);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red16_gs_rev2std_cg(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize(c, 16, ntt_red16_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red16_product_4step(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array(a, 16);
+  mulntt_red16_ct_std2rev_4step(a, c); // c is used as scratch
+  reduce_array(a, 16);
+
+  shift_array(b, 16);
+  mulntt_red16_ct_std2rev_4step(b, c);
+  reduce_array(b, 16);
+
+  mul_reduce_array(c, 16, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice(c, 16);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red16_gs_rev2std_4step(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize(c, 16, ntt_red16_rescale8); // rescale, reduce twice, convert to [0, Q-1]
 }
@@ -0,0 +1,41 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 16. The inputs are in [0, 12288].
+ * The products ntt_red16_product5 and ntt_red16_product5_asm use 4 reductions.
+ *
+ * C schedule: 0 reductions
+ * - forward NTT of a: reduced rounds = none, then 0 reductions: |a[i]| <= 381880
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 381880
+ * - pointwise product, then 0 reductions: |c[i]| <= 35615385
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 1033395556
+ *
+ * AVX2 schedule: 0 reductions
+ * - forward NTT of a: reduced rounds = none, then 0 reductions: |a[i]| <= 381880
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 381880
+ * - pointwise product, then 0 reductions: |c[i]| <= 35615385
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 1033395556
+ *
+ */
+
+#include "ntt_red.h"
+#include "ntt_red16.h"
+#include "ntt_asm.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red16_lazy.h"
+
+void ntt_red16_lazy_product(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red16_ct_std2rev(a);
+  mulntt_red16_ct_std2rev(b);
+  mul_reduce_array(c, 16, a, b);
+  inttmul_red16_gs_rev2std(c);
+  scalar_mul_reduce_finalize(c, 16, ntt_red16_lazy_rescale);
+}
+
+void ntt_red16_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red16_ct_std2rev_asm(a);
+  mulntt_red16_ct_std2rev_asm(b);
+  mul_reduce_array_asm(c, 16, a, b);
+  inttmul_red16_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 16, ntt_red16_lazy_asm_rescale);
+}
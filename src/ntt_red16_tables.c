@@ -0,0 +1,257 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 16
+ * - psi = 1212
+ * - omega = psi^2 = 6553
+ * - inverse of psi = 2545
+ * - inverse of omega = 722
+ * - inverse of n = 11521
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red16_tables.h"
+
+const int16_t ntt_red16_psi_powers[16] = {
+    -4096,   404, -1912,  5277,  5444, -1065,  -435,  1207,
+      493, -4645, -1378,  1168,  2381, -2143, -4337,  3248,
+};
+
+const int16_t ntt_red16_psi_powers_rev[16] = {
+        0, -4096, -4096,  5444, -4096,  5444, -1912,  -435,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+};
+
+const int16_t ntt_red16_inv_psi_powers[16] = {
+    -4096, -3248,  4337,  2143, -2381, -1168,  1378,  4645,
+     -493, -1207,   435,  1065, -5444, -5277,  1912,  -404,
+};
+
+const int16_t ntt_red16_scaled_inv_psi_powers[16] = {
+     5973,  -208,  -933, -2708,  2269, -1225,  3781,   358,
+     1724,   407,  3539, -1082,  -954,  5292,  -604, -1055,
+};
+
+const int16_t ntt_red16_scaled_inv_psi_powers_var[16] = {
+     4601, -1872,  3892,   206, -4157,  1264, -2838,  3222,
+     3227,  3663, -5016,  2551,  3703, -1528, -5436,  2794,
+};
+
+const int16_t ntt_red16_omega_powers[16] = {
+        0, -4096, -4096,   493, -4096,  5444,   493,  2381,
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+};
+
+const int16_t ntt_red16_omega_powers_rev[16] = {
+        0, -4096, -4096,   493, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+};
+
+const int16_t ntt_red16_inv_omega_powers[16] = {
+        0, -4096, -4096,  -493, -4096, -2381,  -493, -5444,
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+};
+
+const int16_t ntt_red16_inv_omega_powers_rev[16] = {
+        0, -4096, -4096,  -493, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+};
+
+const int16_t ntt_red16_mixed_powers[16] = {
+        0,   493,  5444,  2381, -1912,  -435, -1378, -4337,
+      404,  5277, -1065,  1207, -4645,  1168, -2143,  3248,
+};
+
+const int16_t ntt_red16_mixed_powers_rev[16] = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+};
+
+const int16_t ntt_red16_inv_mixed_powers[16] = {
+        0,  -493, -2381, -5444,  4337,  1378,   435,  1912,
+    -3248,  2143, -1168,  4645, -1207,  1065, -5277,  -404,
+};
+
+const int16_t ntt_red16_inv_mixed_powers_rev[16] = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+};
+
+const int16_t ntt_red16_omega_powers_ct_r4[16] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,  5444,
+    -1912, -1378,   493,  5444,  2381,  2381,  -435, -4337,
+};
+
+const int16_t ntt_red16_omega_powers_gs_r4[16] = {
+        0, -4096,   493, -4096, -1912, -1378,  5444,  5444,
+     2381,   493,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red16_omega_powers_rev_ct_r4[16] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,   493,
+     5444,  2381,  5444, -1912, -1378,  2381,  -435, -4337,
+};
+
+const int16_t ntt_red16_omega_powers_rev_gs_r4[16] = {
+        0, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red16_inv_omega_powers_ct_r4[16] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493, -2381,
+     4337,   435,  -493, -2381, -5444, -5444,  1378,  1912,
+};
+
+const int16_t ntt_red16_inv_omega_powers_gs_r4[16] = {
+        0, -4096,  -493, -4096,  4337,   435, -2381, -2381,
+    -5444,  -493,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red16_inv_omega_powers_rev_ct_r4[16] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493,  -493,
+    -2381, -5444, -2381,  4337,   435, -5444,  1378,  1912,
+};
+
+const int16_t ntt_red16_inv_omega_powers_rev_gs_r4[16] = {
+        0, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red16_mixed_powers_ct_r4[16] = {
+        0,   493,  5444,  2381, -1912,   404, -4645,  -435,
+     5277,  1168, -1378, -1065, -2143, -4337,  1207,  3248,
+};
+
+const int16_t ntt_red16_mixed_powers_rev_ct_r4[16] = {
+        0,   493,  5444,  2381, -1912,   404, -4645, -1378,
+    -1065, -2143,  -435,  5277,  1168, -4337,  1207,  3248,
+};
+
+const int16_t ntt_red16_inv_mixed_powers_gs_r4[16] = {
+        0, -3248, -1207,  4337,  2143,  1065,  1378, -1168,
+    -5277,   435,  4645,  -404,  1912, -2381, -5444,  -493,
+};
+
+const int16_t ntt_red16_inv_mixed_powers_rev_gs_r4[16] = {
+        0, -3248, -1207,  4337, -1168, -5277,   435,  2143,
+     1065,  1378,  4645,  -404,  1912, -2381, -5444,  -493,
+};
+
+const int16_t ntt_red16_omega_powers_ct_cg[32] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096,   493,   493,   493,   493,
+    -4096, -4096,  5444,  5444,   493,   493,  2381,  2381,
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+};
+
+const int16_t ntt_red16_omega_powers_gs_cg[32] = {
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+    -4096, -4096,  5444,  5444,   493,   493,  2381,  2381,
+    -4096, -4096, -4096, -4096,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red16_omega_powers_rev_ct_cg[32] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+};
+
+const int16_t ntt_red16_omega_powers_rev_gs_cg[32] = {
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red16_inv_omega_powers_ct_cg[32] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096,  -493,  -493,  -493,  -493,
+    -4096, -4096, -2381, -2381,  -493,  -493, -5444, -5444,
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+};
+
+const int16_t ntt_red16_inv_omega_powers_gs_cg[32] = {
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+    -4096, -4096, -2381, -2381,  -493,  -493, -5444, -5444,
+    -4096, -4096, -4096, -4096,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red16_inv_omega_powers_rev_ct_cg[32] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+};
+
+const int16_t ntt_red16_inv_omega_powers_rev_gs_cg[32] = {
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red16_mixed_powers_ct_cg[32] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  5444,  5444,  5444,  2381,  2381,  2381,  2381,
+    -1912, -1912,  -435,  -435, -1378, -1378, -4337, -4337,
+      404,  5277, -1065,  1207, -4645,  1168, -2143,  3248,
+};
+
+const int16_t ntt_red16_mixed_powers_rev_ct_cg[32] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+};
+
+const int16_t ntt_red16_inv_mixed_powers_gs_cg[32] = {
+    -3248,  2143, -1168,  4645, -1207,  1065, -5277,  -404,
+     4337,  4337,  1378,  1378,   435,   435,  1912,  1912,
+    -2381, -2381, -2381, -2381, -5444, -5444, -5444, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red16_inv_mixed_powers_rev_gs_cg[32] = {
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red16_twiddles_4step[16] = {
+     2731,  2731,  2731,  2731,  2731,  5911,  3459,  -145,
+     2731, -3932,  5911,  4890,  2731,  4890,  -145, -3459,
+};
+
+const int16_t ntt_red16_inv_twiddles_4step[16] = {
+     2731,  2731,  2731,  2731,  2731, -4890,  5542, -3637,
+     2731,  3932, -4890, -5911,  2731, -5911, -3637, -5542,
+};
+
+const int16_t ntt_red16_mixed_twiddles_4step[16] = {
+     2731,  2731,  2731,  2731,  4231,  -355,  1759, -3694,
+     3459,  3637,  -145, -5542,  1759,  5179,  2548,   355,
+};
+
+const int16_t ntt_red16_inv_mixed_twiddles_4step[16] = {
+     2731,  2731,  2731,  2731, -5179,  3707, -3382, -2548,
+     5542,   145, -3637, -3459, -3382, -4231,  3694, -3707,
+};
+
+const int32_t ntt_red16_mixed_powers_rev_simd[32] __attribute__ ((aligned(32))) = {
+        0,   493,     0,     0,     0,     0,     0,     0,
+     5444,  5444,  5444,  5444,  2381,  2381,  2381,  2381,
+    -1912, -1912,  -435,  -435, -1378, -1378, -4337, -4337,
+      404,  5277, -4645,  1168, -1065,  1207, -2143,  3248,
+};
+
+const int32_t ntt_red16_inv_mixed_powers_rev_simd[24] __attribute__ ((aligned(32))) = {
+        0,  -493, -2381, -5444,     0,     0,     0,     0,
+    -3248,  4337, -1207,  4337, -1168,   435, -5277,   435,
+     2143,  1378,  1065,  1378,  4645,  1912,  -404,  1912,
+};
+
@@ -0,0 +1,98 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 16
+ * - psi = 1212
+ * - omega = psi^2 = 6553
+ * - inverse of psi = 2545
+ * - inverse of omega = 722
+ * - inverse of n = 11521
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED16_TABLES_H
+#define __NTT_RED16_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red16_psi = 1212;
+static const int32_t ntt_red16_omega = 6553;
+static const int32_t ntt_red16_inv_psi = 2545;
+static const int32_t ntt_red16_inv_omega = 722;
+static const int32_t ntt_red16_inv_n = 11521;
+static const int32_t ntt_red16_inv_k = 8193;
+static const int32_t ntt_red16_rescale8 = 5973;
+static const int32_t ntt_red16_rescale6 = 4601;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red16_psi_powers[16];
+extern const int16_t ntt_red16_inv_psi_powers[16];
+extern const int16_t ntt_red16_scaled_inv_psi_powers[16];
+extern const int16_t ntt_red16_scaled_inv_psi_powers_var[16];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red16_omega_powers[16];
+extern const int16_t ntt_red16_omega_powers_rev[16];
+extern const int16_t ntt_red16_inv_omega_powers[16];
+extern const int16_t ntt_red16_inv_omega_powers_rev[16];
+extern const int16_t ntt_red16_mixed_powers[16];
+extern const int16_t ntt_red16_mixed_powers_rev[16];
+extern const int16_t ntt_red16_inv_mixed_powers[16];
+extern const int16_t ntt_red16_inv_mixed_powers_rev[16];
+
+/*
+ * TABLES FOR RADIX-4 NTT COMPUTATION
+ */
+extern const int16_t ntt_red16_omega_powers_ct_r4[16];
+extern const int16_t ntt_red16_omega_powers_rev_ct_r4[16];
+extern const int16_t ntt_red16_omega_powers_gs_r4[16];
+extern const int16_t ntt_red16_omega_powers_rev_gs_r4[16];
+extern const int16_t ntt_red16_inv_omega_powers_ct_r4[16];
+extern const int16_t ntt_red16_inv_omega_powers_rev_ct_r4[16];
+extern const int16_t ntt_red16_inv_omega_powers_gs_r4[16];
+extern const int16_t ntt_red16_inv_omega_powers_rev_gs_r4[16];
+extern const int16_t ntt_red16_mixed_powers_ct_r4[16];
+extern const int16_t ntt_red16_mixed_powers_rev_ct_r4[16];
+extern const int16_t ntt_red16_inv_mixed_powers_gs_r4[16];
+extern const int16_t ntt_red16_inv_mixed_powers_rev_gs_r4[16];
+
+/*
+ * TABLES FOR CONSTANT-GEOMETRY NTT COMPUTATION
+ */
+extern const int16_t ntt_red16_omega_powers_ct_cg[32];
+extern const int16_t ntt_red16_omega_powers_rev_ct_cg[32];
+extern const int16_t ntt_red16_omega_powers_gs_cg[32];
+extern const int16_t ntt_red16_omega_powers_rev_gs_cg[32];
+extern const int16_t ntt_red16_inv_omega_powers_ct_cg[32];
+extern const int16_t ntt_red16_inv_omega_powers_rev_ct_cg[32];
+extern const int16_t ntt_red16_inv_omega_powers_gs_cg[32];
+extern const int16_t ntt_red16_inv_omega_powers_rev_gs_cg[32];
+extern const int16_t ntt_red16_mixed_powers_ct_cg[32];
+extern const int16_t ntt_red16_mixed_powers_rev_ct_cg[32];
+extern const int16_t ntt_red16_inv_mixed_powers_gs_cg[32];
+extern const int16_t ntt_red16_inv_mixed_powers_rev_gs_cg[32];
+
+/*
+ * TABLES FOR FOUR-STEP NTT COMPUTATION
+ */
+static const int32_t ntt_red16_n1_4step = 4;
+extern const int16_t ntt_red16_twiddles_4step[16];
+extern const int16_t ntt_red16_inv_twiddles_4step[16];
+extern const int16_t ntt_red16_mixed_twiddles_4step[16];
+extern const int16_t ntt_red16_inv_mixed_twiddles_4step[16];
+
+/*
+ * TABLES IN SIMD LAYOUT (32bit, aligned)
+ */
+extern const int32_t ntt_red16_mixed_powers_rev_simd[32];
+extern const int32_t ntt_red16_inv_mixed_powers_rev_simd[24];
+
+#endif /* __NTT_RED16_TABLES_H */
@@ -0,0 +1,44 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 256. The inputs are in [0, 12288].
+ * The products ntt_red256_product5 and ntt_red256_product5_asm use 4 reductions.
+ *
+ * C schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 15530
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 13291078
+ * - pointwise product, then 1 reductions: |c[i]| <= 24591
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 58164626
+ *
+ * AVX2 schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 15530
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 13291078
+ * - pointwise product, then 1 reductions: |c[i]| <= 24591
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 58164626
+ *
+ */
+
+#include "ntt_red.h"
+#include "ntt_red256.h"
+#include "ntt_asm.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red256_lazy.h"
+
+void ntt_red256_lazy_product(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red256_ct_std2rev(a);
+  reduce_array(a, 256);
+  mulntt_red256_ct_std2rev(b);
+  mul_reduce_array(c, 256, a, b);
+  reduce_array(c, 256);
+  inttmul_red256_gs_rev2std(c);
+  scalar_mul_reduce_finalize(c, 256, ntt_red256_lazy_rescale);
+}
+
+void ntt_red256_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red256_ct_std2rev_fused_asm(a);
+  mulntt_red256_ct_std2rev_asm(b);
+  mul_reduce_array_asm(c, 256, a, b);
+  reduce_array_asm(c, 256);
+  inttmul_red256_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 256, ntt_red256_lazy_asm_rescale);
+}
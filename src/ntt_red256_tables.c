@@ -0,0 +1,2700 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 256
+ * - psi = 1002
+ * - omega = psi^2 = 8595
+ * - inverse of psi = 10805
+ * - inverse of omega = 2525
+ * - inverse of n = 12241
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red256_tables.h"
+
+const int16_t ntt_red256_psi_powers[256] = {
+    -4096,   334,  2865, -4896, -2481, -3584, -2780,  4043,
+    -4284, -3707, -3136,  3712, -4143,  2396,  4437, -2744,
+     3248, -2089, -4048,  -726, -2401,  2842, -3364, -3542,
+     2437, -3637,  5559,  3201,   -27, -2476,  1426,  3328,
+     4337, -4632,  3978,  4320,  2912,  5331, -4053, -5736,
+     3780,  2548, -3016,  1062, -5019, -2837, -3915, -2639,
+    -2143,  3289,  2126,  4255,  -773,  -339,  4414, -1212,
+     2187,  3932, -4905,   790,  5084, -5767, -2704, -5828,
+    -2381, -1696, -3510, -2366,  1045,  2525, -1484,     1,
+     1002, -3694, -2399,  4846,  1537,  3949,  -160,  -563,
+     1168,  2881, -1153,  -140, -5101,  1022,  4057, -2545,
+     6022,   145, -2178,  5086, -3763,  2197,  1663, -4978,
+     1378,  4388, -2686,   -81,  4861,  4278, -2305,   722,
+    -1607,  -355,   671, -3553,  3704,   130, -4919,  -949,
+    -4645,  3241,  3186, -2768,  3778,   544,  4372,  5860,
+    -2422, -5911,   476, -2319, -1017,   953, -3636, -5728,
+     -493, -2426,  2370,  2963, -5012,  4177, -5195,  5146,
+    -5088,  1759,  5191,  3135, -4714, -4452,     3,  3006,
+     1207,  5092,  2249,  4611,  -442,  -480, -1689,  3504,
+    -3646, -3459,  -420, -3014,  3066,  -118,  4654,  5777,
+      435,  5755,  2969,  1000, -5698,  4989, -2645,  4134,
+      875,  4231,  -243,  2294,   545,  5374,  2166, -4821,
+    -1065,  2013,  1630, -1177,   390, -2468, -2847, -1646,
+    -2566, -2731,  3985,  -955,  1632,   827,  5291,  5023,
+    -5444,  1428,  5332, -3051,  2859,  1381, -4895, -1479,
+     5011, -5179, -3400, -2747,   242, -3296,  3149, -2975,
+     5277,  3284, -2884, -1853, -1067,     9, -3271,  3621,
+     2987, -5542,  1544, -1326, -1440, -5067, -1777,  1351,
+     1912, -1260,  3247, -3091,  -354,  1673,  5042,  1305,
+     4976, -3382,  3000, -4805,  2678,  4354,   113,  2625,
+      404,  -729, -5407,  1635,  3833, -5791, -2174, -3195,
+     6039,  4890, -3531,  1170,  4885,  3748, -4938,  4591,
+};
+
+const int16_t ntt_red256_psi_powers_rev[256] = {
+        0, -4096, -4096, -2381, -4096, -2381,  4337,  1378,
+    -4096, -2381,  4337,  1378,  3248,  1168, -2143, -4645,
+    -4096, -2381,  4337,  1378,  3248,  1168, -2143, -4645,
+    -4284,  1002,  3780, -1607,  2437,  6022,  2187, -2422,
+    -4096, -2381,  4337,  1378,  3248,  1168, -2143, -4645,
+    -4284,  1002,  3780, -1607,  2437,  6022,  2187, -2422,
+    -2481,  1045,  2912,  4861, -2401, -5101,  -773,  3778,
+    -4143,  1537, -5019,  3704,   -27, -3763,  5084, -1017,
+    -4096, -2381,  4337,  1378,  3248,  1168, -2143, -4645,
+    -4284,  1002,  3780, -1607,  2437,  6022,  2187, -2422,
+    -2481,  1045,  2912,  4861, -2401, -5101,  -773,  3778,
+    -4143,  1537, -5019,  3704,   -27, -3763,  5084, -1017,
+     2865, -3510,  3978, -2686, -4048, -1153,  2126,  3186,
+    -3136, -2399, -3016,   671,  5559, -2178, -4905,   476,
+    -2780, -1484, -4053, -2305, -3364,  4057,  4414,  4372,
+     4437,  -160, -3915, -4919,  1426,  1663, -2704, -3636,
+    -4096, -2381,  4337,  1378,  3248,  1168, -2143, -4645,
+    -4284,  1002,  3780, -1607,  2437,  6022,  2187, -2422,
+    -2481,  1045,  2912,  4861, -2401, -5101,  -773,  3778,
+    -4143,  1537, -5019,  3704,   -27, -3763,  5084, -1017,
+     2865, -3510,  3978, -2686, -4048, -1153,  2126,  3186,
+    -3136, -2399, -3016,   671,  5559, -2178, -4905,   476,
+    -2780, -1484, -4053, -2305, -3364,  4057,  4414,  4372,
+     4437,  -160, -3915, -4919,  1426,  1663, -2704, -3636,
+      334, -1696, -4632,  4388, -2089,  2881,  3289,  3241,
+    -3707, -3694,  2548,  -355, -3637,   145,  3932, -5911,
+    -3584,  2525,  5331,  4278,  2842,  1022,  -339,   544,
+     2396,  3949, -2837,   130, -2476,  2197, -5767,   953,
+    -4896, -2366,  4320,   -81,  -726,  -140,  4255, -2768,
+     3712,  4846,  1062, -3553,  3201,  5086,   790, -2319,
+     4043,     1, -5736,   722, -3542, -2545, -1212,  5860,
+    -2744,  -563, -2639,  -949,  3328, -4978, -5828, -5728,
+};
+
+const int16_t ntt_red256_inv_psi_powers[256] = {
+    -4096, -4591,  4938, -3748, -4885, -1170,  3531, -4890,
+    -6039,  3195,  2174,  5791, -3833, -1635,  5407,   729,
+     -404, -2625,  -113, -4354, -2678,  4805, -3000,  3382,
+    -4976, -1305, -5042, -1673,   354,  3091, -3247,  1260,
+    -1912, -1351,  1777,  5067,  1440,  1326, -1544,  5542,
+    -2987, -3621,  3271,    -9,  1067,  1853,  2884, -3284,
+    -5277,  2975, -3149,  3296,  -242,  2747,  3400,  5179,
+    -5011,  1479,  4895, -1381, -2859,  3051, -5332, -1428,
+     5444, -5023, -5291,  -827, -1632,   955, -3985,  2731,
+     2566,  1646,  2847,  2468,  -390,  1177, -1630, -2013,
+     1065,  4821, -2166, -5374,  -545, -2294,   243, -4231,
+     -875, -4134,  2645, -4989,  5698, -1000, -2969, -5755,
+     -435, -5777, -4654,   118, -3066,  3014,   420,  3459,
+     3646, -3504,  1689,   480,   442, -4611, -2249, -5092,
+    -1207, -3006,    -3,  4452,  4714, -3135, -5191, -1759,
+     5088, -5146,  5195, -4177,  5012, -2963, -2370,  2426,
+      493,  5728,  3636,  -953,  1017,  2319,  -476,  5911,
+     2422, -5860, -4372,  -544, -3778,  2768, -3186, -3241,
+     4645,   949,  4919,  -130, -3704,  3553,  -671,   355,
+     1607,  -722,  2305, -4278, -4861,    81,  2686, -4388,
+    -1378,  4978, -1663, -2197,  3763, -5086,  2178,  -145,
+    -6022,  2545, -4057, -1022,  5101,   140,  1153, -2881,
+    -1168,   563,   160, -3949, -1537, -4846,  2399,  3694,
+    -1002,    -1,  1484, -2525, -1045,  2366,  3510,  1696,
+     2381,  5828,  2704,  5767, -5084,  -790,  4905, -3932,
+    -2187,  1212, -4414,   339,   773, -4255, -2126, -3289,
+     2143,  2639,  3915,  2837,  5019, -1062,  3016, -2548,
+    -3780,  5736,  4053, -5331, -2912, -4320, -3978,  4632,
+    -4337, -3328, -1426,  2476,    27, -3201, -5559,  3637,
+    -2437,  3542,  3364, -2842,  2401,   726,  4048,  2089,
+    -3248,  2744, -4437, -2396,  4143, -3712,  3136,  3707,
+     4284, -4043,  2780,  3584,  2481,  4896, -2865,  -334,
+};
+
+const int16_t ntt_red256_scaled_inv_psi_powers[256] = {
+    -3467, -4063, -4407,  2240, -6130,  3060,  5890, -3281,
+     2560, -1739,   -14, -3802,  1517, -2341, -3743,   -16,
+     -834, -3533, -4431,   989, -5285,  2558,  1229, -5064,
+    -5892, -6040,  4679,  -351,  4746, -1467,  1875, -5186,
+     3110,  5424,    79,  5654,  2851, -3468, -2579,  5357,
+     1195, -3764, -5719, -4703,  -900, -3901,   965,  5753,
+     3403,   727,  2564,  4614, -2203,   378,  4342, -4092,
+     1762,  2749,   432, -2060, -2921, -3253, -2125, -4773,
+     4668,  3684,  1549,  -673,  3323, -3443, -2812, -5252,
+     2742, -1469,  4843,  2053,  1020, -2133, -5190, -3243,
+    -4676, -4101,  2829,  4602,  3316, -5344,  4091,  -278,
+    -5274, -1477,  4426, -5858,  4949,  4506, -1688, -1964,
+     2083,  5656,  -117,  1582,  -489,   625, -5825,  5133,
+     1808, -4070,  5981, -3146, -1156, -4956,  5882, -3698,
+    -5351,  2190, -5664,  -300,  2796,  4418,  6014, -2962,
+    -3854,  4951,  1538,  3362,   126, -2649, -1364, -3509,
+    -3180,   144, -4783, -5070,  3012,  3388, -1591,  1556,
+     1228, -3580,  3872,  5204, -5244,  3159, -5847,   914,
+    -4586, -2482, -3412,   340,  -711, -1730, -1081, -5655,
+    -1367,   943,  1534, -2991,  2315,  5460, -4189, -1758,
+     3604, -2621, -6049,  5746,  1502, -4659, -4751, -3402,
+    -2211,   -39, -3569,  -163, -3888, -6038,  1711,  4699,
+    -5453,  6090, -5145,  3711, -1652,  6057, -5329, -5880,
+      730, -1888,  -100,   932,  5569,  6101,  3109, -5381,
+    -2446,  4609,  5217,    42,  -883, -4551, -5266, -1060,
+       48,  2502, -1690,  1004, -2967,  3566,  4615, -3687,
+     2903,  5387,  5831, -1748,  1053, -1949,  4401, -5625,
+     3269,  2959, -3983,  -237, -4673,  3736, -1885, -4552,
+    -3782, -3585,  -997,  4868,  1820,  2700,  -586, -2895,
+    -4970,  2080, -2181,  4597, -1553, -5680, -1134,  -737,
+      -13, -5286,  4042, -1296, -6109, -3526, -2530, -5914,
+     2030, -1715,  1237, -4647,  2019,  2320, -1960, -3853,
+};
+
+const int16_t ntt_red256_scaled_inv_psi_powers_var[256] = {
+     5664,   300, -2796, -4418, -6014,  2962,  3854, -4951,
+    -1538, -3362,  -126,  2649,  1364,  3509,  3180,  -144,
+     4783,  5070, -3012, -3388,  1591, -1556, -1228,  3580,
+    -3872, -5204,  5244, -3159,  5847,  -914,  4586,  2482,
+     3412,  -340,   711,  1730,  1081,  5655,  1367,  -943,
+    -1534,  2991, -2315, -5460,  4189,  1758, -3604,  2621,
+     6049, -5746, -1502,  4659,  4751,  3402,  2211,    39,
+     3569,   163,  3888,  6038, -1711, -4699,  5453, -6090,
+     5145, -3711,  1652, -6057,  5329,  5880,  -730,  1888,
+      100,  -932, -5569, -6101, -3109,  5381,  2446, -4609,
+    -5217,   -42,   883,  4551,  5266,  1060,   -48, -2502,
+     1690, -1004,  2967, -3566, -4615,  3687, -2903, -5387,
+    -5831,  1748, -1053,  1949, -4401,  5625, -3269, -2959,
+     3983,   237,  4673, -3736,  1885,  4552,  3782,  3585,
+      997, -4868, -1820, -2700,   586,  2895,  4970, -2080,
+     2181, -4597,  1553,  5680,  1134,   737,    13,  5286,
+    -4042,  1296,  6109,  3526,  2530,  5914, -2030,  1715,
+    -1237,  4647, -2019, -2320,  1960,  3853, -3467, -4063,
+    -4407,  2240, -6130,  3060,  5890, -3281,  2560, -1739,
+      -14, -3802,  1517, -2341, -3743,   -16,  -834, -3533,
+    -4431,   989, -5285,  2558,  1229, -5064, -5892, -6040,
+     4679,  -351,  4746, -1467,  1875, -5186,  3110,  5424,
+       79,  5654,  2851, -3468, -2579,  5357,  1195, -3764,
+    -5719, -4703,  -900, -3901,   965,  5753,  3403,   727,
+     2564,  4614, -2203,   378,  4342, -4092,  1762,  2749,
+      432, -2060, -2921, -3253, -2125, -4773,  4668,  3684,
+     1549,  -673,  3323, -3443, -2812, -5252,  2742, -1469,
+     4843,  2053,  1020, -2133, -5190, -3243, -4676, -4101,
+     2829,  4602,  3316, -5344,  4091,  -278, -5274, -1477,
+     4426, -5858,  4949,  4506, -1688, -1964,  2083,  5656,
+     -117,  1582,  -489,   625, -5825,  5133,  1808, -4070,
+     5981, -3146, -1156, -4956,  5882, -3698, -5351,  2190,
+};
+
+const int16_t ntt_red256_omega_powers[256] = {
+        0, -4096, -4096,  -493, -4096, -2381,  -493, -5444,
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+    -4096,  3248,  4337, -2143, -2381,  1168,  1378, -4645,
+     -493,  1207,   435, -1065, -5444,  5277,  1912,   404,
+    -4096, -4284,  3248,  2437,  4337,  3780, -2143,  2187,
+    -2381,  1002,  1168,  6022,  1378, -1607, -4645, -2422,
+     -493, -5088,  1207, -3646,   435,   875, -1065, -2566,
+    -5444,  5011,  5277,  2987,  1912,  4976,   404,  6039,
+    -4096, -2481, -4284, -4143,  3248, -2401,  2437,   -27,
+     4337,  2912,  3780, -5019, -2143,  -773,  2187,  5084,
+    -2381,  1045,  1002,  1537,  1168, -5101,  6022, -3763,
+     1378,  4861, -1607,  3704, -4645,  3778, -2422, -1017,
+     -493, -5012, -5088, -4714,  1207,  -442, -3646,  3066,
+      435, -5698,   875,   545, -1065,   390, -2566,  1632,
+    -5444,  2859,  5011,   242,  5277, -1067,  2987, -1440,
+     1912,  -354,  4976,  2678,   404,  3833,  6039,  4885,
+    -4096,  2865, -2481, -2780, -4284, -3136, -4143,  4437,
+     3248, -4048, -2401, -3364,  2437,  5559,   -27,  1426,
+     4337,  3978,  2912, -4053,  3780, -3016, -5019, -3915,
+    -2143,  2126,  -773,  4414,  2187, -4905,  5084, -2704,
+    -2381, -3510,  1045, -1484,  1002, -2399,  1537,  -160,
+     1168, -1153, -5101,  4057,  6022, -2178, -3763,  1663,
+     1378, -2686,  4861, -2305, -1607,   671,  3704, -4919,
+    -4645,  3186,  3778,  4372, -2422,   476, -1017, -3636,
+     -493,  2370, -5012, -5195, -5088,  5191, -4714,     3,
+     1207,  2249,  -442, -1689, -3646,  -420,  3066,  4654,
+      435,  2969, -5698, -2645,   875,  -243,   545,  2166,
+    -1065,  1630,   390, -2847, -2566,  3985,  1632,  5291,
+    -5444,  5332,  2859, -4895,  5011, -3400,   242,  3149,
+     5277, -2884, -1067, -3271,  2987,  1544, -1440, -1777,
+     1912,  3247,  -354,  5042,  4976,  3000,  2678,   113,
+      404, -5407,  3833, -2174,  6039, -3531,  4885, -4938,
+};
+
+const int16_t ntt_red256_omega_powers_rev[256] = {
+        0, -4096, -4096,  -493, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+};
+
+const int16_t ntt_red256_inv_omega_powers[256] = {
+        0, -4096, -4096,   493, -4096,  5444,   493,  2381,
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+    -4096,  -404, -1912, -5277,  5444,  1065,  -435, -1207,
+      493,  4645, -1378, -1168,  2381,  2143, -4337, -3248,
+    -4096, -6039,  -404, -4976, -1912, -2987, -5277, -5011,
+     5444,  2566,  1065,  -875,  -435,  3646, -1207,  5088,
+      493,  2422,  4645,  1607, -1378, -6022, -1168, -1002,
+     2381, -2187,  2143, -3780, -4337, -2437, -3248,  4284,
+    -4096, -4885, -6039, -3833,  -404, -2678, -4976,   354,
+    -1912,  1440, -2987,  1067, -5277,  -242, -5011, -2859,
+     5444, -1632,  2566,  -390,  1065,  -545,  -875,  5698,
+     -435, -3066,  3646,   442, -1207,  4714,  5088,  5012,
+      493,  1017,  2422, -3778,  4645, -3704,  1607, -4861,
+    -1378,  3763, -6022,  5101, -1168, -1537, -1002, -1045,
+     2381, -5084, -2187,   773,  2143,  5019, -3780, -2912,
+    -4337,    27, -2437,  2401, -3248,  4143,  4284,  2481,
+    -4096,  4938, -4885,  3531, -6039,  2174, -3833,  5407,
+     -404,  -113, -2678, -3000, -4976, -5042,   354, -3247,
+    -1912,  1777,  1440, -1544, -2987,  3271,  1067,  2884,
+    -5277, -3149,  -242,  3400, -5011,  4895, -2859, -5332,
+     5444, -5291, -1632, -3985,  2566,  2847,  -390, -1630,
+     1065, -2166,  -545,   243,  -875,  2645,  5698, -2969,
+     -435, -4654, -3066,   420,  3646,  1689,   442, -2249,
+    -1207,    -3,  4714, -5191,  5088,  5195,  5012, -2370,
+      493,  3636,  1017,  -476,  2422, -4372, -3778, -3186,
+     4645,  4919, -3704,  -671,  1607,  2305, -4861,  2686,
+    -1378, -1663,  3763,  2178, -6022, -4057,  5101,  1153,
+    -1168,   160, -1537,  2399, -1002,  1484, -1045,  3510,
+     2381,  2704, -5084,  4905, -2187, -4414,   773, -2126,
+     2143,  3915,  5019,  3016, -3780,  4053, -2912, -3978,
+    -4337, -1426,    27, -5559, -2437,  3364,  2401,  4048,
+    -3248, -4437,  4143,  3136,  4284,  2780,  2481, -2865,
+};
+
+const int16_t ntt_red256_inv_omega_powers_rev[256] = {
+        0, -4096, -4096,   493, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+};
+
+const int16_t ntt_red256_mixed_powers[256] = {
+        0,  -493, -2381, -5444,  4337,  1378,   435,  1912,
+     3248, -2143,  1168, -4645,  1207, -1065,  5277,   404,
+    -4284,  2437,  3780,  2187,  1002,  6022, -1607, -2422,
+    -5088, -3646,   875, -2566,  5011,  2987,  4976,  6039,
+    -2481, -4143, -2401,   -27,  2912, -5019,  -773,  5084,
+     1045,  1537, -5101, -3763,  4861,  3704,  3778, -1017,
+    -5012, -4714,  -442,  3066, -5698,   545,   390,  1632,
+     2859,   242, -1067, -1440,  -354,  2678,  3833,  4885,
+     2865, -2780, -3136,  4437, -4048, -3364,  5559,  1426,
+     3978, -4053, -3016, -3915,  2126,  4414, -4905, -2704,
+    -3510, -1484, -2399,  -160, -1153,  4057, -2178,  1663,
+    -2686, -2305,   671, -4919,  3186,  4372,   476, -3636,
+     2370, -5195,  5191,     3,  2249, -1689,  -420,  4654,
+     2969, -2645,  -243,  2166,  1630, -2847,  3985,  5291,
+     5332, -4895, -3400,  3149, -2884, -3271,  1544, -1777,
+     3247,  5042,  3000,   113, -5407, -2174, -3531, -4938,
+      334, -4896, -3584,  4043, -3707,  3712,  2396, -2744,
+    -2089,  -726,  2842, -3542, -3637,  3201, -2476,  3328,
+    -4632,  4320,  5331, -5736,  2548,  1062, -2837, -2639,
+     3289,  4255,  -339, -1212,  3932,   790, -5767, -5828,
+    -1696, -2366,  2525,     1, -3694,  4846,  3949,  -563,
+     2881,  -140,  1022, -2545,   145,  5086,  2197, -4978,
+     4388,   -81,  4278,   722,  -355, -3553,   130,  -949,
+     3241, -2768,   544,  5860, -5911, -2319,   953, -5728,
+    -2426,  2963,  4177,  5146,  1759,  3135, -4452,  3006,
+     5092,  4611,  -480,  3504, -3459, -3014,  -118,  5777,
+     5755,  1000,  4989,  4134,  4231,  2294,  5374, -4821,
+     2013, -1177, -2468, -1646, -2731,  -955,   827,  5023,
+     1428, -3051,  1381, -1479, -5179, -2747, -3296, -2975,
+     3284, -1853,     9,  3621, -5542, -1326, -5067,  1351,
+    -1260, -3091,  1673,  1305, -3382, -4805,  4354,  2625,
+     -729,  1635, -5791, -3195,  4890,  1170,  3748,  4591,
+};
+
+const int16_t ntt_red256_mixed_powers_rev[256] = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+      334, -2426, -1696,  1428, -4632,  5755,  4388, -1260,
+    -2089,  5092,  2881,  3284,  3289,  2013,  3241,  -729,
+    -3707,  1759, -3694, -5179,  2548,  4231,  -355, -3382,
+    -3637, -3459,   145, -5542,  3932, -2731, -5911,  4890,
+    -3584,  4177,  2525,  1381,  5331,  4989,  4278,  1673,
+     2842,  -480,  1022,     9,  -339, -2468,   544, -5791,
+     2396, -4452,  3949, -3296, -2837,  5374,   130,  4354,
+    -2476,  -118,  2197, -5067, -5767,   827,   953,  3748,
+    -4896,  2963, -2366, -3051,  4320,  1000,   -81, -3091,
+     -726,  4611,  -140, -1853,  4255, -1177, -2768,  1635,
+     3712,  3135,  4846, -2747,  1062,  2294, -3553, -4805,
+     3201, -3014,  5086, -1326,   790,  -955, -2319,  1170,
+     4043,  5146,     1, -1479, -5736,  4134,   722,  1305,
+    -3542,  3504, -2545,  3621, -1212, -1646,  5860, -3195,
+    -2744,  3006,  -563, -2975, -2639, -4821,  -949,  2625,
+     3328,  5777, -4978,  1351, -5828,  5023, -5728,  4591,
+};
+
+const int16_t ntt_red256_inv_mixed_powers[256] = {
+        0,   493,  5444,  2381, -1912,  -435, -1378, -4337,
+     -404, -5277,  1065, -1207,  4645, -1168,  2143, -3248,
+    -6039, -4976, -2987, -5011,  2566,  -875,  3646,  5088,
+     2422,  1607, -6022, -1002, -2187, -3780, -2437,  4284,
+    -4885, -3833, -2678,   354,  1440,  1067,  -242, -2859,
+    -1632,  -390,  -545,  5698, -3066,   442,  4714,  5012,
+     1017, -3778, -3704, -4861,  3763,  5101, -1537, -1045,
+    -5084,   773,  5019, -2912,    27,  2401,  4143,  2481,
+     4938,  3531,  2174,  5407,  -113, -3000, -5042, -3247,
+     1777, -1544,  3271,  2884, -3149,  3400,  4895, -5332,
+    -5291, -3985,  2847, -1630, -2166,   243,  2645, -2969,
+    -4654,   420,  1689, -2249,    -3, -5191,  5195, -2370,
+     3636,  -476, -4372, -3186,  4919,  -671,  2305,  2686,
+    -1663,  2178, -4057,  1153,   160,  2399,  1484,  3510,
+     2704,  4905, -4414, -2126,  3915,  3016,  4053, -3978,
+    -1426, -5559,  3364,  4048, -4437,  3136,  2780, -2865,
+    -4591, -3748, -1170, -4890,  3195,  5791, -1635,   729,
+    -2625, -4354,  4805,  3382, -1305, -1673,  3091,  1260,
+    -1351,  5067,  1326,  5542, -3621,    -9,  1853, -3284,
+     2975,  3296,  2747,  5179,  1479, -1381,  3051, -1428,
+    -5023,  -827,   955,  2731,  1646,  2468,  1177, -2013,
+     4821, -5374, -2294, -4231, -4134, -4989, -1000, -5755,
+    -5777,   118,  3014,  3459, -3504,   480, -4611, -5092,
+    -3006,  4452, -3135, -1759, -5146, -4177, -2963,  2426,
+     5728,  -953,  2319,  5911, -5860,  -544,  2768, -3241,
+      949,  -130,  3553,   355,  -722, -4278,    81, -4388,
+     4978, -2197, -5086,  -145,  2545, -1022,   140, -2881,
+      563, -3949, -4846,  3694,    -1, -2525,  2366,  1696,
+     5828,  5767,  -790, -3932,  1212,   339, -4255, -3289,
+     2639,  2837, -1062, -2548,  5736, -5331, -4320,  4632,
+    -3328,  2476, -3201,  3637,  3542, -2842,   726,  2089,
+     2744, -2396, -3712,  3707, -4043,  3584,  4896,  -334,
+};
+
+const int16_t ntt_red256_inv_mixed_powers_rev[256] = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+    -4591,  5728, -5023,  5828, -1351,  4978, -5777, -3328,
+    -2625,   949,  4821,  2639,  2975,   563, -3006,  2744,
+     3195, -5860,  1646,  1212, -3621,  2545, -3504,  3542,
+    -1305,  -722, -4134,  5736,  1479,    -1, -5146, -4043,
+    -1170,  2319,   955,  -790,  1326, -5086,  3014, -3201,
+     4805,  3553, -2294, -1062,  2747, -4846, -3135, -3712,
+    -1635,  2768,  1177, -4255,  1853,   140, -4611,   726,
+     3091,    81, -1000, -4320,  3051,  2366, -2963,  4896,
+    -3748,  -953,  -827,  5767,  5067, -2197,   118,  2476,
+    -4354,  -130, -5374,  2837,  3296, -3949,  4452, -2396,
+     5791,  -544,  2468,   339,    -9, -1022,   480, -2842,
+    -1673, -4278, -4989, -5331, -1381, -2525, -4177,  3584,
+    -4890,  5911,  2731, -3932,  5542,  -145,  3459,  3637,
+     3382,   355, -4231, -2548,  5179,  3694, -1759,  3707,
+      729, -3241, -2013, -3289, -3284, -2881, -5092,  2089,
+     1260, -4388, -5755,  4632, -1428,  1696,  2426,  -334,
+};
+
+const int16_t ntt_red256_omega_powers_ct_r4[256] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493, -2381,
+     4337,   435,  -493, -2381, -5444, -5444,  1378,  1912,
+    -4096, -4096,  -493,  3248, -4284, -5088,  4337,  3248,
+     1207, -2143,  2437, -3646, -2381,  4337,   435,  1168,
+     3780,   875,  1378, -2143, -1065, -4645,  2187, -2566,
+     -493, -2381, -5444,  1207,  1002,  5011,   435,  1168,
+     5277, -1065,  6022,  2987, -5444,  1378,  1912,  5277,
+    -1607,  4976,  1912, -4645,   404,   404, -2422,  6039,
+    -4096, -4096,  -493, -2481,  2865,  2370, -4284, -2481,
+    -5012, -4143, -2780, -5195,  3248, -4284, -5088, -2401,
+    -3136,  5191,  2437, -4143, -4714,   -27,  4437,     3,
+     4337,  3248,  1207,  2912, -4048,  2249,  3780, -2401,
+     -442, -5019, -3364, -1689, -2143,  2437, -3646,  -773,
+     5559,  -420,  2187,   -27,  3066,  5084,  1426,  4654,
+    -2381,  4337,   435,  1045,  3978,  2969,  1002,  2912,
+    -5698,  1537, -4053, -2645,  1168,  3780,   875, -5101,
+    -3016,  -243,  6022, -5019,   545, -3763, -3915,  2166,
+     1378, -2143, -1065,  4861,  2126,  1630, -1607,  -773,
+      390,  3704,  4414, -2847, -4645,  2187, -2566,  3778,
+    -4905,  3985, -2422,  5084,  1632, -1017, -2704,  5291,
+     -493, -2381, -5444, -5012, -3510,  5332, -5088,  1045,
+     2859, -4714, -1484, -4895,  1207,  1002,  5011,  -442,
+    -2399, -3400, -3646,  1537,   242,  3066,  -160,  3149,
+      435,  1168,  5277, -5698, -1153, -2884,   875, -5101,
+    -1067,   545,  4057, -3271, -1065,  6022,  2987,   390,
+    -2178,  1544, -2566, -3763, -1440,  1632,  1663, -1777,
+    -5444,  1378,  1912,  2859, -2686,  3247,  5011,  4861,
+     -354,   242, -2305,  5042,  5277, -1607,  4976, -1067,
+      671,  3000,  2987,  3704,  2678, -1440, -4919,   113,
+     1912, -4645,   404,  -354,  3186, -5407,  4976,  3778,
+     3833,  2678,  4372, -2174,   404, -2422,  6039,  3833,
+      476, -3531,  6039, -1017,  4885,  4885, -3636, -4938,
+};
+
+const int16_t ntt_red256_omega_powers_gs_r4[256] = {
+        0, -4096,  -493, -4096,  2865,  2370, -2481, -2481,
+    -5012, -4284, -2780, -5195, -4143, -4284, -5088,  3248,
+    -3136,  5191, -2401, -4143, -4714,  2437,  4437,     3,
+      -27,  3248,  1207,  4337, -4048,  2249,  2912, -2401,
+     -442,  3780, -3364, -1689, -5019,  2437, -3646, -2143,
+     5559,  -420,  -773,   -27,  3066,  2187,  1426,  4654,
+     5084,  4337,   435, -2381,  3978,  2969,  1045,  2912,
+    -5698,  1002, -4053, -2645,  1537,  3780,   875,  1168,
+    -3016,  -243, -5101, -5019,   545,  6022, -3915,  2166,
+    -3763, -2143, -1065,  1378,  2126,  1630,  4861,  -773,
+      390, -1607,  4414, -2847,  3704,  2187, -2566, -4645,
+    -4905,  3985,  3778,  5084,  1632, -2422, -2704,  5291,
+    -1017, -2381, -5444,  -493, -3510,  5332, -5012,  1045,
+     2859, -5088, -1484, -4895, -4714,  1002,  5011,  1207,
+    -2399, -3400,  -442,  1537,   242, -3646,  -160,  3149,
+     3066,  1168,  5277,   435, -1153, -2884, -5698, -5101,
+    -1067,   875,  4057, -3271,   545,  6022,  2987, -1065,
+    -2178,  1544,   390, -3763, -1440, -2566,  1663, -1777,
+     1632,  1378,  1912, -5444, -2686,  3247,  2859,  4861,
+     -354,  5011, -2305,  5042,   242, -1607,  4976,  5277,
+      671,  3000, -1067,  3704,  2678,  2987, -4919,   113,
+    -1440, -4645,   404,  1912,  3186, -5407,  -354,  3778,
+     3833,  4976,  4372, -2174,  2678, -2422,  6039,   404,
+      476, -3531,  3833, -1017,  4885,  6039, -3636, -4938,
+     4885, -4096,  -493, -4096, -4284, -5088,  3248,  3248,
+     1207,  4337,  2437, -3646, -2143,  4337,   435, -2381,
+     3780,   875,  1168, -2143, -1065,  1378,  2187, -2566,
+    -4645, -2381, -5444,  -493,  1002,  5011,  1207,  1168,
+     5277,   435,  6022,  2987, -1065,  1378,  1912, -5444,
+    -1607,  4976,  5277, -4645,   404,  1912, -2422,  6039,
+      404, -4096,  -493, -4096,  4337,   435, -2381, -2381,
+    -5444,  -493,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red256_omega_powers_rev_ct_r4[256] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493,  -493,
+    -2381, -5444, -2381,  4337,   435, -5444,  1378,  1912,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+     3248, -4284, -5088,  1207,  1002,  5011,  1168,  3780,
+      875,  5277, -1607,  4976, -2143,  2437, -3646, -1065,
+     6022,  2987, -4645,  2187, -2566,   404, -2422,  6039,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+     3248, -4284, -5088,  1207,  1002,  5011,  1168,  3780,
+      875,  5277, -1607,  4976, -2143,  2437, -3646, -1065,
+     6022,  2987, -4645,  2187, -2566,   404, -2422,  6039,
+    -4284, -2481, -5012, -5088,  1045,  2859,  1002,  2912,
+    -5698,  5011,  4861,  -354,  3780, -2401,  -442,   875,
+    -5101, -1067, -1607,  -773,   390,  4976,  3778,  3833,
+     2437, -4143, -4714, -3646,  1537,   242,  6022, -5019,
+      545,  2987,  3704,  2678,  2187,   -27,  3066, -2566,
+    -3763, -1440, -2422,  5084,  1632,  6039, -1017,  4885,
+    -2481,  2865,  2370, -5012, -3510,  5332,  1045,  3978,
+     2969,  2859, -2686,  3247,  2912, -4048,  2249, -5698,
+    -1153, -2884,  4861,  2126,  1630,  -354,  3186, -5407,
+    -2401, -3136,  5191,  -442, -2399, -3400, -5101, -3016,
+     -243, -1067,   671,  3000,  -773,  5559,  -420,   390,
+    -2178,  1544,  3778, -4905,  3985,  3833,   476, -3531,
+    -4143, -2780, -5195, -4714, -1484, -4895,  1537, -4053,
+    -2645,   242, -2305,  5042, -5019, -3364, -1689,   545,
+     4057, -3271,  3704,  4414, -2847,  2678,  4372, -2174,
+      -27,  4437,     3,  3066,  -160,  3149, -3763, -3915,
+     2166, -1440, -4919,   113,  5084,  1426,  4654,  1632,
+     1663, -1777, -1017, -2704,  5291,  4885, -3636, -4938,
+};
+
+const int16_t ntt_red256_omega_powers_rev_gs_r4[256] = {
+        0, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444,  3248,  1207,  4337,
+     1168,  5277,   435, -2143, -1065,  1378, -4645,   404,
+     1912, -4284, -5088,  3248,  1002,  5011,  1207,  3780,
+      875,  1168, -1607,  4976,  5277,  2437, -3646, -2143,
+     6022,  2987, -1065,  2187, -2566, -4645, -2422,  6039,
+      404, -2481, -5012, -4284,  1045,  2859, -5088,  2912,
+    -5698,  1002,  4861,  -354,  5011, -2401,  -442,  3780,
+    -5101, -1067,   875,  -773,   390, -1607,  3778,  3833,
+     4976, -4143, -4714,  2437,  1537,   242, -3646, -5019,
+      545,  6022,  3704,  2678,  2987,   -27,  3066,  2187,
+    -3763, -1440, -2566,  5084,  1632, -2422, -1017,  4885,
+     6039,  2865,  2370, -2481, -3510,  5332, -5012,  3978,
+     2969,  1045, -2686,  3247,  2859, -4048,  2249,  2912,
+    -1153, -2884, -5698,  2126,  1630,  4861,  3186, -5407,
+     -354, -3136,  5191, -2401, -2399, -3400,  -442, -3016,
+     -243, -5101,   671,  3000, -1067,  5559,  -420,  -773,
+    -2178,  1544,   390, -4905,  3985,  3778,   476, -3531,
+     3833, -2780, -5195, -4143, -1484, -4895, -4714, -4053,
+    -2645,  1537, -2305,  5042,   242, -3364, -1689, -5019,
+     4057, -3271,   545,  4414, -2847,  3704,  4372, -2174,
+     2678,  4437,     3,   -27,  -160,  3149,  3066, -3915,
+     2166, -3763, -4919,   113, -1440,  1426,  4654,  5084,
+     1663, -1777,  1632, -2704,  5291, -1017, -3636, -4938,
+     4885, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444,  3248,  1207,  4337,
+     1168,  5277,   435, -2143, -1065,  1378, -4645,   404,
+     1912, -4284, -5088,  3248,  1002,  5011,  1207,  3780,
+      875,  1168, -1607,  4976,  5277,  2437, -3646, -2143,
+     6022,  2987, -1065,  2187, -2566, -4645, -2422,  6039,
+      404, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -4096,  -493, -4096,
+};
+
+const int16_t ntt_red256_inv_omega_powers_ct_r4[256] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,  5444,
+    -1912, -1378,   493,  5444,  2381,  2381,  -435, -4337,
+    -4096, -4096,   493,  -404, -6039,  2422, -1912,  -404,
+     4645, -5277, -4976,  1607,  5444, -1912, -1378,  1065,
+    -2987, -6022,  -435, -5277, -1168, -1207, -5011, -1002,
+      493,  5444,  2381,  4645,  2566, -2187, -1378,  1065,
+     2143, -1168,  -875, -3780,  2381,  -435, -4337,  2143,
+     3646, -2437, -4337, -1207, -3248, -3248,  5088,  4284,
+    -4096, -4096,   493, -4885,  4938,  3636, -6039, -4885,
+     1017, -3833,  3531,  -476,  -404, -6039,  2422, -2678,
+     2174, -4372, -4976, -3833, -3778,   354,  5407, -3186,
+    -1912,  -404,  4645,  1440,  -113,  4919, -2987, -2678,
+    -3704,  1067, -3000,  -671, -5277, -4976,  1607,  -242,
+    -5042,  2305, -5011,   354, -4861, -2859, -3247,  2686,
+     5444, -1912, -1378, -1632,  1777, -1663,  2566,  1440,
+     3763,  -390, -1544,  2178,  1065, -2987, -6022,  -545,
+     3271, -4057,  -875,  1067,  5101,  5698,  2884,  1153,
+     -435, -5277, -1168, -3066, -3149,   160,  3646,  -242,
+    -1537,   442,  3400,  2399, -1207, -5011, -1002,  4714,
+     4895,  1484,  5088, -2859, -1045,  5012, -5332,  3510,
+      493,  5444,  2381,  1017, -5291,  2704,  2422, -1632,
+    -5084, -3778, -3985,  4905,  4645,  2566, -2187, -3704,
+     2847, -4414,  1607,  -390,   773, -4861, -1630, -2126,
+    -1378,  1065,  2143,  3763, -2166,  3915, -6022,  -545,
+     5019,  5101,   243,  3016, -1168,  -875, -3780, -1537,
+     2645,  4053, -1002,  5698, -2912, -1045, -2969, -3978,
+     2381,  -435, -4337, -5084, -4654, -1426, -2187, -3066,
+       27,   773,   420, -5559,  2143,  3646, -2437,  5019,
+     1689,  3364, -3780,   442,  2401, -2912, -2249,  4048,
+    -4337, -1207, -3248,    27,    -3, -4437, -2437,  4714,
+     4143,  2401, -5191,  3136, -3248,  5088,  4284,  4143,
+     5195,  2780,  4284,  5012,  2481,  2481, -2370, -2865,
+};
+
+const int16_t ntt_red256_inv_omega_powers_gs_r4[256] = {
+        0, -4096,   493, -4096,  4938,  3636, -4885, -4885,
+     1017, -6039,  3531,  -476, -3833, -6039,  2422,  -404,
+     2174, -4372, -2678, -3833, -3778, -4976,  5407, -3186,
+      354,  -404,  4645, -1912,  -113,  4919,  1440, -2678,
+    -3704, -2987, -3000,  -671,  1067, -4976,  1607, -5277,
+    -5042,  2305,  -242,   354, -4861, -5011, -3247,  2686,
+    -2859, -1912, -1378,  5444,  1777, -1663, -1632,  1440,
+     3763,  2566, -1544,  2178,  -390, -2987, -6022,  1065,
+     3271, -4057,  -545,  1067,  5101,  -875,  2884,  1153,
+     5698, -5277, -1168,  -435, -3149,   160, -3066,  -242,
+    -1537,  3646,  3400,  2399,   442, -5011, -1002, -1207,
+     4895,  1484,  4714, -2859, -1045,  5088, -5332,  3510,
+     5012,  5444,  2381,   493, -5291,  2704,  1017, -1632,
+    -5084,  2422, -3985,  4905, -3778,  2566, -2187,  4645,
+     2847, -4414, -3704,  -390,   773,  1607, -1630, -2126,
+    -4861,  1065,  2143, -1378, -2166,  3915,  3763,  -545,
+     5019, -6022,   243,  3016,  5101,  -875, -3780, -1168,
+     2645,  4053, -1537,  5698, -2912, -1002, -2969, -3978,
+    -1045,  -435, -4337,  2381, -4654, -1426, -5084, -3066,
+       27, -2187,   420, -5559,   773,  3646, -2437,  2143,
+     1689,  3364,  5019,   442,  2401, -3780, -2249,  4048,
+    -2912, -1207, -3248, -4337,    -3, -4437,    27,  4714,
+     4143, -2437, -5191,  3136,  2401,  5088,  4284, -3248,
+     5195,  2780,  4143,  5012,  2481,  4284, -2370, -2865,
+     2481, -4096,   493, -4096, -6039,  2422,  -404,  -404,
+     4645, -1912, -4976,  1607, -5277, -1912, -1378,  5444,
+    -2987, -6022,  1065, -5277, -1168,  -435, -5011, -1002,
+    -1207,  5444,  2381,   493,  2566, -2187,  4645,  1065,
+     2143, -1378,  -875, -3780, -1168,  -435, -4337,  2381,
+     3646, -2437,  2143, -1207, -3248, -4337,  5088,  4284,
+    -3248, -4096,   493, -4096, -1912, -1378,  5444,  5444,
+     2381,   493,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red256_inv_omega_powers_rev_ct_r4[256] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,   493,
+     5444,  2381,  5444, -1912, -1378,  2381,  -435, -4337,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+     -404, -6039,  2422,  4645,  2566, -2187,  1065, -2987,
+    -6022,  2143,  3646, -2437, -5277, -4976,  1607, -1168,
+     -875, -3780, -1207, -5011, -1002, -3248,  5088,  4284,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,  -404,  4645, -1378,
+     1065,  2143,  -435, -5277, -1168, -4337, -1207, -3248,
+     -404, -6039,  2422,  4645,  2566, -2187,  1065, -2987,
+    -6022,  2143,  3646, -2437, -5277, -4976,  1607, -1168,
+     -875, -3780, -1207, -5011, -1002, -3248,  5088,  4284,
+    -6039, -4885,  1017,  2422, -1632, -5084,  2566,  1440,
+     3763, -2187, -3066,    27, -2987, -2678, -3704, -6022,
+     -545,  5019,  3646,  -242, -1537, -2437,  4714,  4143,
+    -4976, -3833, -3778,  1607,  -390,   773,  -875,  1067,
+     5101, -3780,   442,  2401, -5011,   354, -4861, -1002,
+     5698, -2912,  5088, -2859, -1045,  4284,  5012,  2481,
+    -4885,  4938,  3636,  1017, -5291,  2704, -1632,  1777,
+    -1663, -5084, -4654, -1426,  1440,  -113,  4919,  3763,
+    -2166,  3915, -3066, -3149,   160,    27,    -3, -4437,
+    -2678,  2174, -4372, -3704,  2847, -4414,  -545,  3271,
+    -4057,  5019,  1689,  3364,  -242, -5042,  2305, -1537,
+     2645,  4053,  4714,  4895,  1484,  4143,  5195,  2780,
+    -3833,  3531,  -476, -3778, -3985,  4905,  -390, -1544,
+     2178,   773,   420, -5559,  1067, -3000,  -671,  5101,
+      243,  3016,   442,  3400,  2399,  2401, -5191,  3136,
+      354,  5407, -3186, -4861, -1630, -2126,  5698,  2884,
+     1153, -2912, -2249,  4048, -2859, -3247,  2686, -1045,
+    -2969, -3978,  5012, -5332,  3510,  2481, -2370, -2865,
+};
+
+const int16_t ntt_red256_inv_omega_powers_rev_gs_r4[256] = {
+        0, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,  -404,  4645, -1912,
+     1065,  2143, -1378, -5277, -1168,  -435, -1207, -3248,
+    -4337, -6039,  2422,  -404,  2566, -2187,  4645, -2987,
+    -6022,  1065,  3646, -2437,  2143, -4976,  1607, -5277,
+     -875, -3780, -1168, -5011, -1002, -1207,  5088,  4284,
+    -3248, -4885,  1017, -6039, -1632, -5084,  2422,  1440,
+     3763,  2566, -3066,    27, -2187, -2678, -3704, -2987,
+     -545,  5019, -6022,  -242, -1537,  3646,  4714,  4143,
+    -2437, -3833, -3778, -4976,  -390,   773,  1607,  1067,
+     5101,  -875,   442,  2401, -3780,   354, -4861, -5011,
+     5698, -2912, -1002, -2859, -1045,  5088,  5012,  2481,
+     4284,  4938,  3636, -4885, -5291,  2704,  1017,  1777,
+    -1663, -1632, -4654, -1426, -5084,  -113,  4919,  1440,
+    -2166,  3915,  3763, -3149,   160, -3066,    -3, -4437,
+       27,  2174, -4372, -2678,  2847, -4414, -3704,  3271,
+    -4057,  -545,  1689,  3364,  5019, -5042,  2305,  -242,
+     2645,  4053, -1537,  4895,  1484,  4714,  5195,  2780,
+     4143,  3531,  -476, -3833, -3985,  4905, -3778, -1544,
+     2178,  -390,   420, -5559,   773, -3000,  -671,  1067,
+      243,  3016,  5101,  3400,  2399,   442, -5191,  3136,
+     2401,  5407, -3186,   354, -1630, -2126, -4861,  2884,
+     1153,  5698, -2249,  4048, -2912, -3247,  2686, -2859,
+    -2969, -3978, -1045, -5332,  3510,  5012, -2370, -2865,
+     2481, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,  -404,  4645, -1912,
+     1065,  2143, -1378, -5277, -1168,  -435, -1207, -3248,
+    -4337, -6039,  2422,  -404,  2566, -2187,  4645, -2987,
+    -6022,  1065,  3646, -2437,  2143, -4976,  1607, -5277,
+     -875, -3780, -1168, -5011, -1002, -1207,  5088,  4284,
+    -3248, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381, -4096,   493, -4096,
+};
+
+const int16_t ntt_red256_mixed_powers_ct_r4[256] = {
+        0,  -493, -2381, -5444,  4337,  3248,  1207,  1378,
+    -2143, -1065,   435,  1168,  5277,  1912, -4645,   404,
+    -4284, -2481, -5012,  2437, -4143, -4714,  3780, -2401,
+     -442,  2187,   -27,  3066,  1002,  2912, -5698,  6022,
+    -5019,   545, -1607,  -773,   390, -2422,  5084,  1632,
+    -5088,  1045,  2859, -3646,  1537,   242,   875, -5101,
+    -1067, -2566, -3763, -1440,  5011,  4861,  -354,  2987,
+     3704,  2678,  4976,  3778,  3833,  6039, -1017,  4885,
+     2865,   334, -2426, -2780, -4896,  2963, -3136, -3584,
+     4177,  4437,  4043,  5146, -4048, -3707,  1759, -3364,
+     3712,  3135,  5559,  2396, -4452,  1426, -2744,  3006,
+     3978, -2089,  5092, -4053,  -726,  4611, -3016,  2842,
+     -480, -3915, -3542,  3504,  2126, -3637, -3459,  4414,
+     3201, -3014, -4905, -2476,  -118, -2704,  3328,  5777,
+    -3510, -4632,  5755, -1484,  4320,  1000, -2399,  5331,
+     4989,  -160, -5736,  4134, -1153,  2548,  4231,  4057,
+     1062,  2294, -2178, -2837,  5374,  1663, -2639, -4821,
+    -2686,  3289,  2013, -2305,  4255, -1177,   671,  -339,
+    -2468, -4919, -1212, -1646,  3186,  3932, -2731,  4372,
+      790,  -955,   476, -5767,   827, -3636, -5828,  5023,
+     2370, -1696,  1428, -5195, -2366, -3051,  5191,  2525,
+     1381,     3,     1, -1479,  2249, -3694, -5179, -1689,
+     4846, -2747,  -420,  3949, -3296,  4654,  -563, -2975,
+     2969,  2881,  3284, -2645,  -140, -1853,  -243,  1022,
+        9,  2166, -2545,  3621,  1630,   145, -5542, -2847,
+     5086, -1326,  3985,  2197, -5067,  5291, -4978,  1351,
+     5332,  4388, -1260, -4895,   -81, -3091, -3400,  4278,
+     1673,  3149,   722,  1305, -2884,  -355, -3382, -3271,
+    -3553, -4805,  1544,   130,  4354, -1777,  -949,  2625,
+     3247,  3241,  -729,  5042, -2768,  1635,  3000,   544,
+    -5791,   113,  5860, -3195, -5407, -5911,  4890, -2174,
+    -2319,  1170, -3531,   953,  3748, -4938, -5728,  4591,
+};
+
+const int16_t ntt_red256_mixed_powers_rev_ct_r4[256] = {
+        0,  -493, -2381, -5444,  4337,  3248,  1207,   435,
+     1168,  5277,  1378, -2143, -1065,  1912, -4645,   404,
+    -4284, -2481, -5012, -5088,  1045,  2859,  1002,  2912,
+    -5698,  5011,  4861,  -354,  3780, -2401,  -442,   875,
+    -5101, -1067, -1607,  -773,   390,  4976,  3778,  3833,
+     2437, -4143, -4714, -3646,  1537,   242,  6022, -5019,
+      545,  2987,  3704,  2678,  2187,   -27,  3066, -2566,
+    -3763, -1440, -2422,  5084,  1632,  6039, -1017,  4885,
+     2865,   334, -2426,  2370, -1696,  1428, -3510, -4632,
+     5755,  5332,  4388, -1260,  3978, -2089,  5092,  2969,
+     2881,  3284, -2686,  3289,  2013,  3247,  3241,  -729,
+    -4048, -3707,  1759,  2249, -3694, -5179, -1153,  2548,
+     4231, -2884,  -355, -3382,  2126, -3637, -3459,  1630,
+      145, -5542,  3186,  3932, -2731, -5407, -5911,  4890,
+    -3136, -3584,  4177,  5191,  2525,  1381, -2399,  5331,
+     4989, -3400,  4278,  1673, -3016,  2842,  -480,  -243,
+     1022,     9,   671,  -339, -2468,  3000,   544, -5791,
+     5559,  2396, -4452,  -420,  3949, -3296, -2178, -2837,
+     5374,  1544,   130,  4354, -4905, -2476,  -118,  3985,
+     2197, -5067,   476, -5767,   827, -3531,   953,  3748,
+    -2780, -4896,  2963, -5195, -2366, -3051, -1484,  4320,
+     1000, -4895,   -81, -3091, -4053,  -726,  4611, -2645,
+     -140, -1853, -2305,  4255, -1177,  5042, -2768,  1635,
+    -3364,  3712,  3135, -1689,  4846, -2747,  4057,  1062,
+     2294, -3271, -3553, -4805,  4414,  3201, -3014, -2847,
+     5086, -1326,  4372,   790,  -955, -2174, -2319,  1170,
+     4437,  4043,  5146,     3,     1, -1479,  -160, -5736,
+     4134,  3149,   722,  1305, -3915, -3542,  3504,  2166,
+    -2545,  3621, -4919, -1212, -1646,   113,  5860, -3195,
+     1426, -2744,  3006,  4654,  -563, -2975,  1663, -2639,
+    -4821, -1777,  -949,  2625, -2704,  3328,  5777,  5291,
+    -4978,  1351, -3636, -5828,  5023, -4938, -5728,  4591,
+};
+
+const int16_t ntt_red256_inv_mixed_powers_gs_r4[256] = {
+        0, -4591,  5728,  4938, -3748,  -953,  3531, -1170,
+     2319,  2174, -4890,  5911,  5407,  3195, -5860,  -113,
+     5791,  -544, -3000, -1635,  2768, -5042,   729, -3241,
+    -3247, -2625,   949,  1777, -4354,  -130, -1544,  4805,
+     3553,  3271,  3382,   355,  2884, -1305,  -722, -3149,
+    -1673, -4278,  3400,  3091,    81,  4895,  1260, -4388,
+    -5332, -1351,  4978, -5291,  5067, -2197, -3985,  1326,
+    -5086,  2847,  5542,  -145, -1630, -3621,  2545, -2166,
+       -9, -1022,   243,  1853,   140,  2645, -3284, -2881,
+    -2969,  2975,   563, -4654,  3296, -3949,   420,  2747,
+    -4846,  1689,  5179,  3694, -2249,  1479,    -1,    -3,
+    -1381, -2525, -5191,  3051,  2366,  5195, -1428,  1696,
+    -2370, -5023,  5828,  3636,  -827,  5767,  -476,   955,
+     -790, -4372,  2731, -3932, -3186,  1646,  1212,  4919,
+     2468,   339,  -671,  1177, -4255,  2305, -2013, -3289,
+     2686,  4821,  2639, -1663, -5374,  2837,  2178, -2294,
+    -1062, -4057, -4231, -2548,  1153, -4134,  5736,   160,
+    -4989, -5331,  2399, -1000, -4320,  1484, -5755,  4632,
+     3510, -5777, -3328,  2704,   118,  2476,  4905,  3014,
+    -3201, -4414,  3459,  3637, -2126, -3504,  3542,  3915,
+      480, -2842,  3016, -4611,   726,  4053, -5092,  2089,
+    -3978, -3006,  2744, -1426,  4452, -2396, -5559, -3135,
+    -3712,  3364, -1759,  3707,  4048, -5146, -4043, -4437,
+    -4177,  3584,  3136, -2963,  4896,  2780,  2426,  -334,
+    -2865, -4885,  1017, -6039, -3833, -3778, -4976, -2678,
+    -3704, -2987,   354, -4861, -5011,  1440,  3763,  2566,
+     1067,  5101,  -875,  -242, -1537,  3646, -2859, -1045,
+     5088, -1632, -5084,  2422,  -390,   773,  1607,  -545,
+     5019, -6022,  5698, -2912, -1002, -3066,    27, -2187,
+      442,  2401, -3780,  4714,  4143, -2437,  5012,  2481,
+     4284,  -404,  4645, -1912, -5277, -1168,  -435,  1065,
+     2143, -1378, -1207, -3248, -4337,  5444,  2381,   493,
+};
+
+const int16_t ntt_red256_inv_mixed_powers_rev_gs_r4[256] = {
+        0, -4591,  5728,  4938, -5023,  5828,  3636, -1351,
+     4978, -5291, -5777, -3328,  2704, -2625,   949,  1777,
+     4821,  2639, -1663,  2975,   563, -4654, -3006,  2744,
+    -1426,  3195, -5860,  -113,  1646,  1212,  4919, -3621,
+     2545, -2166, -3504,  3542,  3915, -1305,  -722, -3149,
+    -4134,  5736,   160,  1479,    -1,    -3, -5146, -4043,
+    -4437, -1170,  2319,  2174,   955,  -790, -4372,  1326,
+    -5086,  2847,  3014, -3201, -4414,  4805,  3553,  3271,
+    -2294, -1062, -4057,  2747, -4846,  1689, -3135, -3712,
+     3364, -1635,  2768, -5042,  1177, -4255,  2305,  1853,
+      140,  2645, -4611,   726,  4053,  3091,    81,  4895,
+    -1000, -4320,  1484,  3051,  2366,  5195, -2963,  4896,
+     2780, -3748,  -953,  3531,  -827,  5767,  -476,  5067,
+    -2197, -3985,   118,  2476,  4905, -4354,  -130, -1544,
+    -5374,  2837,  2178,  3296, -3949,   420,  4452, -2396,
+    -5559,  5791,  -544, -3000,  2468,   339,  -671,    -9,
+    -1022,   243,   480, -2842,  3016, -1673, -4278,  3400,
+    -4989, -5331,  2399, -1381, -2525, -5191, -4177,  3584,
+     3136, -4890,  5911,  5407,  2731, -3932, -3186,  5542,
+     -145, -1630,  3459,  3637, -2126,  3382,   355,  2884,
+    -4231, -2548,  1153,  5179,  3694, -2249, -1759,  3707,
+     4048,   729, -3241, -3247, -2013, -3289,  2686, -3284,
+    -2881, -2969, -5092,  2089, -3978,  1260, -4388, -5332,
+    -5755,  4632,  3510, -1428,  1696, -2370,  2426,  -334,
+    -2865, -4885,  1017, -6039, -1632, -5084,  2422,  1440,
+     3763,  2566, -3066,    27, -2187, -2678, -3704, -2987,
+     -545,  5019, -6022,  -242, -1537,  3646,  4714,  4143,
+    -2437, -3833, -3778, -4976,  -390,   773,  1607,  1067,
+     5101,  -875,   442,  2401, -3780,   354, -4861, -5011,
+     5698, -2912, -1002, -2859, -1045,  5088,  5012,  2481,
+     4284,  -404,  4645, -1912,  1065,  2143, -1378, -5277,
+    -1168,  -435, -1207, -3248, -4337,  5444,  2381,   493,
+};
+
+const int16_t ntt_red256_omega_powers_ct_cg[1024] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -4096, -4096, -4096, -4096, -4284, -4284, -4284, -4284,
+     3248,  3248,  3248,  3248,  2437,  2437,  2437,  2437,
+     4337,  4337,  4337,  4337,  3780,  3780,  3780,  3780,
+    -2143, -2143, -2143, -2143,  2187,  2187,  2187,  2187,
+    -2381, -2381, -2381, -2381,  1002,  1002,  1002,  1002,
+     1168,  1168,  1168,  1168,  6022,  6022,  6022,  6022,
+     1378,  1378,  1378,  1378, -1607, -1607, -1607, -1607,
+    -4645, -4645, -4645, -4645, -2422, -2422, -2422, -2422,
+     -493,  -493,  -493,  -493, -5088, -5088, -5088, -5088,
+     1207,  1207,  1207,  1207, -3646, -3646, -3646, -3646,
+      435,   435,   435,   435,   875,   875,   875,   875,
+    -1065, -1065, -1065, -1065, -2566, -2566, -2566, -2566,
+    -5444, -5444, -5444, -5444,  5011,  5011,  5011,  5011,
+     5277,  5277,  5277,  5277,  2987,  2987,  2987,  2987,
+     1912,  1912,  1912,  1912,  4976,  4976,  4976,  4976,
+      404,   404,   404,   404,  6039,  6039,  6039,  6039,
+    -4096, -4096, -2481, -2481, -4284, -4284, -4143, -4143,
+     3248,  3248, -2401, -2401,  2437,  2437,   -27,   -27,
+     4337,  4337,  2912,  2912,  3780,  3780, -5019, -5019,
+    -2143, -2143,  -773,  -773,  2187,  2187,  5084,  5084,
+    -2381, -2381,  1045,  1045,  1002,  1002,  1537,  1537,
+     1168,  1168, -5101, -5101,  6022,  6022, -3763, -3763,
+     1378,  1378,  4861,  4861, -1607, -1607,  3704,  3704,
+    -4645, -4645,  3778,  3778, -2422, -2422, -1017, -1017,
+     -493,  -493, -5012, -5012, -5088, -5088, -4714, -4714,
+     1207,  1207,  -442,  -442, -3646, -3646,  3066,  3066,
+      435,   435, -5698, -5698,   875,   875,   545,   545,
+    -1065, -1065,   390,   390, -2566, -2566,  1632,  1632,
+    -5444, -5444,  2859,  2859,  5011,  5011,   242,   242,
+     5277,  5277, -1067, -1067,  2987,  2987, -1440, -1440,
+     1912,  1912,  -354,  -354,  4976,  4976,  2678,  2678,
+      404,   404,  3833,  3833,  6039,  6039,  4885,  4885,
+    -4096,  2865, -2481, -2780, -4284, -3136, -4143,  4437,
+     3248, -4048, -2401, -3364,  2437,  5559,   -27,  1426,
+     4337,  3978,  2912, -4053,  3780, -3016, -5019, -3915,
+    -2143,  2126,  -773,  4414,  2187, -4905,  5084, -2704,
+    -2381, -3510,  1045, -1484,  1002, -2399,  1537,  -160,
+     1168, -1153, -5101,  4057,  6022, -2178, -3763,  1663,
+     1378, -2686,  4861, -2305, -1607,   671,  3704, -4919,
+    -4645,  3186,  3778,  4372, -2422,   476, -1017, -3636,
+     -493,  2370, -5012, -5195, -5088,  5191, -4714,     3,
+     1207,  2249,  -442, -1689, -3646,  -420,  3066,  4654,
+      435,  2969, -5698, -2645,   875,  -243,   545,  2166,
+    -1065,  1630,   390, -2847, -2566,  3985,  1632,  5291,
+    -5444,  5332,  2859, -4895,  5011, -3400,   242,  3149,
+     5277, -2884, -1067, -3271,  2987,  1544, -1440, -1777,
+     1912,  3247,  -354,  5042,  4976,  3000,  2678,   113,
+      404, -5407,  3833, -2174,  6039, -3531,  4885, -4938,
+};
+
+const int16_t ntt_red256_omega_powers_gs_cg[1024] = {
+    -4096,  2865, -2481, -2780, -4284, -3136, -4143,  4437,
+     3248, -4048, -2401, -3364,  2437,  5559,   -27,  1426,
+     4337,  3978,  2912, -4053,  3780, -3016, -5019, -3915,
+    -2143,  2126,  -773,  4414,  2187, -4905,  5084, -2704,
+    -2381, -3510,  1045, -1484,  1002, -2399,  1537,  -160,
+     1168, -1153, -5101,  4057,  6022, -2178, -3763,  1663,
+     1378, -2686,  4861, -2305, -1607,   671,  3704, -4919,
+    -4645,  3186,  3778,  4372, -2422,   476, -1017, -3636,
+     -493,  2370, -5012, -5195, -5088,  5191, -4714,     3,
+     1207,  2249,  -442, -1689, -3646,  -420,  3066,  4654,
+      435,  2969, -5698, -2645,   875,  -243,   545,  2166,
+    -1065,  1630,   390, -2847, -2566,  3985,  1632,  5291,
+    -5444,  5332,  2859, -4895,  5011, -3400,   242,  3149,
+     5277, -2884, -1067, -3271,  2987,  1544, -1440, -1777,
+     1912,  3247,  -354,  5042,  4976,  3000,  2678,   113,
+      404, -5407,  3833, -2174,  6039, -3531,  4885, -4938,
+    -4096, -4096, -2481, -2481, -4284, -4284, -4143, -4143,
+     3248,  3248, -2401, -2401,  2437,  2437,   -27,   -27,
+     4337,  4337,  2912,  2912,  3780,  3780, -5019, -5019,
+    -2143, -2143,  -773,  -773,  2187,  2187,  5084,  5084,
+    -2381, -2381,  1045,  1045,  1002,  1002,  1537,  1537,
+     1168,  1168, -5101, -5101,  6022,  6022, -3763, -3763,
+     1378,  1378,  4861,  4861, -1607, -1607,  3704,  3704,
+    -4645, -4645,  3778,  3778, -2422, -2422, -1017, -1017,
+     -493,  -493, -5012, -5012, -5088, -5088, -4714, -4714,
+     1207,  1207,  -442,  -442, -3646, -3646,  3066,  3066,
+      435,   435, -5698, -5698,   875,   875,   545,   545,
+    -1065, -1065,   390,   390, -2566, -2566,  1632,  1632,
+    -5444, -5444,  2859,  2859,  5011,  5011,   242,   242,
+     5277,  5277, -1067, -1067,  2987,  2987, -1440, -1440,
+     1912,  1912,  -354,  -354,  4976,  4976,  2678,  2678,
+      404,   404,  3833,  3833,  6039,  6039,  4885,  4885,
+    -4096, -4096, -4096, -4096, -4284, -4284, -4284, -4284,
+     3248,  3248,  3248,  3248,  2437,  2437,  2437,  2437,
+     4337,  4337,  4337,  4337,  3780,  3780,  3780,  3780,
+    -2143, -2143, -2143, -2143,  2187,  2187,  2187,  2187,
+    -2381, -2381, -2381, -2381,  1002,  1002,  1002,  1002,
+     1168,  1168,  1168,  1168,  6022,  6022,  6022,  6022,
+     1378,  1378,  1378,  1378, -1607, -1607, -1607, -1607,
+    -4645, -4645, -4645, -4645, -2422, -2422, -2422, -2422,
+     -493,  -493,  -493,  -493, -5088, -5088, -5088, -5088,
+     1207,  1207,  1207,  1207, -3646, -3646, -3646, -3646,
+      435,   435,   435,   435,   875,   875,   875,   875,
+    -1065, -1065, -1065, -1065, -2566, -2566, -2566, -2566,
+    -5444, -5444, -5444, -5444,  5011,  5011,  5011,  5011,
+     5277,  5277,  5277,  5277,  2987,  2987,  2987,  2987,
+     1912,  1912,  1912,  1912,  4976,  4976,  4976,  4976,
+      404,   404,   404,   404,  6039,  6039,  6039,  6039,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red256_omega_powers_rev_ct_cg[1024] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+};
+
+const int16_t ntt_red256_omega_powers_rev_gs_cg[1024] = {
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red256_inv_omega_powers_ct_cg[1024] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4096, -4096, -4096, -4096, -6039, -6039, -6039, -6039,
+     -404,  -404,  -404,  -404, -4976, -4976, -4976, -4976,
+    -1912, -1912, -1912, -1912, -2987, -2987, -2987, -2987,
+    -5277, -5277, -5277, -5277, -5011, -5011, -5011, -5011,
+     5444,  5444,  5444,  5444,  2566,  2566,  2566,  2566,
+     1065,  1065,  1065,  1065,  -875,  -875,  -875,  -875,
+     -435,  -435,  -435,  -435,  3646,  3646,  3646,  3646,
+    -1207, -1207, -1207, -1207,  5088,  5088,  5088,  5088,
+      493,   493,   493,   493,  2422,  2422,  2422,  2422,
+     4645,  4645,  4645,  4645,  1607,  1607,  1607,  1607,
+    -1378, -1378, -1378, -1378, -6022, -6022, -6022, -6022,
+    -1168, -1168, -1168, -1168, -1002, -1002, -1002, -1002,
+     2381,  2381,  2381,  2381, -2187, -2187, -2187, -2187,
+     2143,  2143,  2143,  2143, -3780, -3780, -3780, -3780,
+    -4337, -4337, -4337, -4337, -2437, -2437, -2437, -2437,
+    -3248, -3248, -3248, -3248,  4284,  4284,  4284,  4284,
+    -4096, -4096, -4885, -4885, -6039, -6039, -3833, -3833,
+     -404,  -404, -2678, -2678, -4976, -4976,   354,   354,
+    -1912, -1912,  1440,  1440, -2987, -2987,  1067,  1067,
+    -5277, -5277,  -242,  -242, -5011, -5011, -2859, -2859,
+     5444,  5444, -1632, -1632,  2566,  2566,  -390,  -390,
+     1065,  1065,  -545,  -545,  -875,  -875,  5698,  5698,
+     -435,  -435, -3066, -3066,  3646,  3646,   442,   442,
+    -1207, -1207,  4714,  4714,  5088,  5088,  5012,  5012,
+      493,   493,  1017,  1017,  2422,  2422, -3778, -3778,
+     4645,  4645, -3704, -3704,  1607,  1607, -4861, -4861,
+    -1378, -1378,  3763,  3763, -6022, -6022,  5101,  5101,
+    -1168, -1168, -1537, -1537, -1002, -1002, -1045, -1045,
+     2381,  2381, -5084, -5084, -2187, -2187,   773,   773,
+     2143,  2143,  5019,  5019, -3780, -3780, -2912, -2912,
+    -4337, -4337,    27,    27, -2437, -2437,  2401,  2401,
+    -3248, -3248,  4143,  4143,  4284,  4284,  2481,  2481,
+    -4096,  4938, -4885,  3531, -6039,  2174, -3833,  5407,
+     -404,  -113, -2678, -3000, -4976, -5042,   354, -3247,
+    -1912,  1777,  1440, -1544, -2987,  3271,  1067,  2884,
+    -5277, -3149,  -242,  3400, -5011,  4895, -2859, -5332,
+     5444, -5291, -1632, -3985,  2566,  2847,  -390, -1630,
+     1065, -2166,  -545,   243,  -875,  2645,  5698, -2969,
+     -435, -4654, -3066,   420,  3646,  1689,   442, -2249,
+    -1207,    -3,  4714, -5191,  5088,  5195,  5012, -2370,
+      493,  3636,  1017,  -476,  2422, -4372, -3778, -3186,
+     4645,  4919, -3704,  -671,  1607,  2305, -4861,  2686,
+    -1378, -1663,  3763,  2178, -6022, -4057,  5101,  1153,
+    -1168,   160, -1537,  2399, -1002,  1484, -1045,  3510,
+     2381,  2704, -5084,  4905, -2187, -4414,   773, -2126,
+     2143,  3915,  5019,  3016, -3780,  4053, -2912, -3978,
+    -4337, -1426,    27, -5559, -2437,  3364,  2401,  4048,
+    -3248, -4437,  4143,  3136,  4284,  2780,  2481, -2865,
+};
+
+const int16_t ntt_red256_inv_omega_powers_gs_cg[1024] = {
+    -4096,  4938, -4885,  3531, -6039,  2174, -3833,  5407,
+     -404,  -113, -2678, -3000, -4976, -5042,   354, -3247,
+    -1912,  1777,  1440, -1544, -2987,  3271,  1067,  2884,
+    -5277, -3149,  -242,  3400, -5011,  4895, -2859, -5332,
+     5444, -5291, -1632, -3985,  2566,  2847,  -390, -1630,
+     1065, -2166,  -545,   243,  -875,  2645,  5698, -2969,
+     -435, -4654, -3066,   420,  3646,  1689,   442, -2249,
+    -1207,    -3,  4714, -5191,  5088,  5195,  5012, -2370,
+      493,  3636,  1017,  -476,  2422, -4372, -3778, -3186,
+     4645,  4919, -3704,  -671,  1607,  2305, -4861,  2686,
+    -1378, -1663,  3763,  2178, -6022, -4057,  5101,  1153,
+    -1168,   160, -1537,  2399, -1002,  1484, -1045,  3510,
+     2381,  2704, -5084,  4905, -2187, -4414,   773, -2126,
+     2143,  3915,  5019,  3016, -3780,  4053, -2912, -3978,
+    -4337, -1426,    27, -5559, -2437,  3364,  2401,  4048,
+    -3248, -4437,  4143,  3136,  4284,  2780,  2481, -2865,
+    -4096, -4096, -4885, -4885, -6039, -6039, -3833, -3833,
+     -404,  -404, -2678, -2678, -4976, -4976,   354,   354,
+    -1912, -1912,  1440,  1440, -2987, -2987,  1067,  1067,
+    -5277, -5277,  -242,  -242, -5011, -5011, -2859, -2859,
+     5444,  5444, -1632, -1632,  2566,  2566,  -390,  -390,
+     1065,  1065,  -545,  -545,  -875,  -875,  5698,  5698,
+     -435,  -435, -3066, -3066,  3646,  3646,   442,   442,
+    -1207, -1207,  4714,  4714,  5088,  5088,  5012,  5012,
+      493,   493,  1017,  1017,  2422,  2422, -3778, -3778,
+     4645,  4645, -3704, -3704,  1607,  1607, -4861, -4861,
+    -1378, -1378,  3763,  3763, -6022, -6022,  5101,  5101,
+    -1168, -1168, -1537, -1537, -1002, -1002, -1045, -1045,
+     2381,  2381, -5084, -5084, -2187, -2187,   773,   773,
+     2143,  2143,  5019,  5019, -3780, -3780, -2912, -2912,
+    -4337, -4337,    27,    27, -2437, -2437,  2401,  2401,
+    -3248, -3248,  4143,  4143,  4284,  4284,  2481,  2481,
+    -4096, -4096, -4096, -4096, -6039, -6039, -6039, -6039,
+     -404,  -404,  -404,  -404, -4976, -4976, -4976, -4976,
+    -1912, -1912, -1912, -1912, -2987, -2987, -2987, -2987,
+    -5277, -5277, -5277, -5277, -5011, -5011, -5011, -5011,
+     5444,  5444,  5444,  5444,  2566,  2566,  2566,  2566,
+     1065,  1065,  1065,  1065,  -875,  -875,  -875,  -875,
+     -435,  -435,  -435,  -435,  3646,  3646,  3646,  3646,
+    -1207, -1207, -1207, -1207,  5088,  5088,  5088,  5088,
+      493,   493,   493,   493,  2422,  2422,  2422,  2422,
+     4645,  4645,  4645,  4645,  1607,  1607,  1607,  1607,
+    -1378, -1378, -1378, -1378, -6022, -6022, -6022, -6022,
+    -1168, -1168, -1168, -1168, -1002, -1002, -1002, -1002,
+     2381,  2381,  2381,  2381, -2187, -2187, -2187, -2187,
+     2143,  2143,  2143,  2143, -3780, -3780, -3780, -3780,
+    -4337, -4337, -4337, -4337, -2437, -2437, -2437, -2437,
+    -3248, -3248, -3248, -3248,  4284,  4284,  4284,  4284,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red256_inv_omega_powers_rev_ct_cg[1024] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+};
+
+const int16_t ntt_red256_inv_omega_powers_rev_gs_cg[1024] = {
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red256_mixed_powers_ct_cg[1024] = {
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -2481, -2481, -2481, -2481, -4143, -4143, -4143, -4143,
+    -2401, -2401, -2401, -2401,   -27,   -27,   -27,   -27,
+     2912,  2912,  2912,  2912, -5019, -5019, -5019, -5019,
+     -773,  -773,  -773,  -773,  5084,  5084,  5084,  5084,
+     1045,  1045,  1045,  1045,  1537,  1537,  1537,  1537,
+    -5101, -5101, -5101, -5101, -3763, -3763, -3763, -3763,
+     4861,  4861,  4861,  4861,  3704,  3704,  3704,  3704,
+     3778,  3778,  3778,  3778, -1017, -1017, -1017, -1017,
+    -5012, -5012, -5012, -5012, -4714, -4714, -4714, -4714,
+     -442,  -442,  -442,  -442,  3066,  3066,  3066,  3066,
+    -5698, -5698, -5698, -5698,   545,   545,   545,   545,
+      390,   390,   390,   390,  1632,  1632,  1632,  1632,
+     2859,  2859,  2859,  2859,   242,   242,   242,   242,
+    -1067, -1067, -1067, -1067, -1440, -1440, -1440, -1440,
+     -354,  -354,  -354,  -354,  2678,  2678,  2678,  2678,
+     3833,  3833,  3833,  3833,  4885,  4885,  4885,  4885,
+     2865,  2865, -2780, -2780, -3136, -3136,  4437,  4437,
+    -4048, -4048, -3364, -3364,  5559,  5559,  1426,  1426,
+     3978,  3978, -4053, -4053, -3016, -3016, -3915, -3915,
+     2126,  2126,  4414,  4414, -4905, -4905, -2704, -2704,
+    -3510, -3510, -1484, -1484, -2399, -2399,  -160,  -160,
+    -1153, -1153,  4057,  4057, -2178, -2178,  1663,  1663,
+    -2686, -2686, -2305, -2305,   671,   671, -4919, -4919,
+     3186,  3186,  4372,  4372,   476,   476, -3636, -3636,
+     2370,  2370, -5195, -5195,  5191,  5191,     3,     3,
+     2249,  2249, -1689, -1689,  -420,  -420,  4654,  4654,
+     2969,  2969, -2645, -2645,  -243,  -243,  2166,  2166,
+     1630,  1630, -2847, -2847,  3985,  3985,  5291,  5291,
+     5332,  5332, -4895, -4895, -3400, -3400,  3149,  3149,
+    -2884, -2884, -3271, -3271,  1544,  1544, -1777, -1777,
+     3247,  3247,  5042,  5042,  3000,  3000,   113,   113,
+    -5407, -5407, -2174, -2174, -3531, -3531, -4938, -4938,
+      334, -4896, -3584,  4043, -3707,  3712,  2396, -2744,
+    -2089,  -726,  2842, -3542, -3637,  3201, -2476,  3328,
+    -4632,  4320,  5331, -5736,  2548,  1062, -2837, -2639,
+     3289,  4255,  -339, -1212,  3932,   790, -5767, -5828,
+    -1696, -2366,  2525,     1, -3694,  4846,  3949,  -563,
+     2881,  -140,  1022, -2545,   145,  5086,  2197, -4978,
+     4388,   -81,  4278,   722,  -355, -3553,   130,  -949,
+     3241, -2768,   544,  5860, -5911, -2319,   953, -5728,
+    -2426,  2963,  4177,  5146,  1759,  3135, -4452,  3006,
+     5092,  4611,  -480,  3504, -3459, -3014,  -118,  5777,
+     5755,  1000,  4989,  4134,  4231,  2294,  5374, -4821,
+     2013, -1177, -2468, -1646, -2731,  -955,   827,  5023,
+     1428, -3051,  1381, -1479, -5179, -2747, -3296, -2975,
+     3284, -1853,     9,  3621, -5542, -1326, -5067,  1351,
+    -1260, -3091,  1673,  1305, -3382, -4805,  4354,  2625,
+     -729,  1635, -5791, -3195,  4890,  1170,  3748,  4591,
+};
+
+const int16_t ntt_red256_mixed_powers_rev_ct_cg[1024] = {
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+    -2481, -5012,  1045,  2859,  2912, -5698,  4861,  -354,
+    -2401,  -442, -5101, -1067,  -773,   390,  3778,  3833,
+    -4143, -4714,  1537,   242, -5019,   545,  3704,  2678,
+      -27,  3066, -3763, -1440,  5084,  1632, -1017,  4885,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+     2865,  2370, -3510,  5332,  3978,  2969, -2686,  3247,
+    -4048,  2249, -1153, -2884,  2126,  1630,  3186, -5407,
+    -3136,  5191, -2399, -3400, -3016,  -243,   671,  3000,
+     5559,  -420, -2178,  1544, -4905,  3985,   476, -3531,
+    -2780, -5195, -1484, -4895, -4053, -2645, -2305,  5042,
+    -3364, -1689,  4057, -3271,  4414, -2847,  4372, -2174,
+     4437,     3,  -160,  3149, -3915,  2166, -4919,   113,
+     1426,  4654,  1663, -1777, -2704,  5291, -3636, -4938,
+      334, -2426, -1696,  1428, -4632,  5755,  4388, -1260,
+    -2089,  5092,  2881,  3284,  3289,  2013,  3241,  -729,
+    -3707,  1759, -3694, -5179,  2548,  4231,  -355, -3382,
+    -3637, -3459,   145, -5542,  3932, -2731, -5911,  4890,
+    -3584,  4177,  2525,  1381,  5331,  4989,  4278,  1673,
+     2842,  -480,  1022,     9,  -339, -2468,   544, -5791,
+     2396, -4452,  3949, -3296, -2837,  5374,   130,  4354,
+    -2476,  -118,  2197, -5067, -5767,   827,   953,  3748,
+    -4896,  2963, -2366, -3051,  4320,  1000,   -81, -3091,
+     -726,  4611,  -140, -1853,  4255, -1177, -2768,  1635,
+     3712,  3135,  4846, -2747,  1062,  2294, -3553, -4805,
+     3201, -3014,  5086, -1326,   790,  -955, -2319,  1170,
+     4043,  5146,     1, -1479, -5736,  4134,   722,  1305,
+    -3542,  3504, -2545,  3621, -1212, -1646,  5860, -3195,
+    -2744,  3006,  -563, -2975, -2639, -4821,  -949,  2625,
+     3328,  5777, -4978,  1351, -5828,  5023, -5728,  4591,
+};
+
+const int16_t ntt_red256_inv_mixed_powers_gs_cg[1024] = {
+    -4591, -3748, -1170, -4890,  3195,  5791, -1635,   729,
+    -2625, -4354,  4805,  3382, -1305, -1673,  3091,  1260,
+    -1351,  5067,  1326,  5542, -3621,    -9,  1853, -3284,
+     2975,  3296,  2747,  5179,  1479, -1381,  3051, -1428,
+    -5023,  -827,   955,  2731,  1646,  2468,  1177, -2013,
+     4821, -5374, -2294, -4231, -4134, -4989, -1000, -5755,
+    -5777,   118,  3014,  3459, -3504,   480, -4611, -5092,
+    -3006,  4452, -3135, -1759, -5146, -4177, -2963,  2426,
+     5728,  -953,  2319,  5911, -5860,  -544,  2768, -3241,
+      949,  -130,  3553,   355,  -722, -4278,    81, -4388,
+     4978, -2197, -5086,  -145,  2545, -1022,   140, -2881,
+      563, -3949, -4846,  3694,    -1, -2525,  2366,  1696,
+     5828,  5767,  -790, -3932,  1212,   339, -4255, -3289,
+     2639,  2837, -1062, -2548,  5736, -5331, -4320,  4632,
+    -3328,  2476, -3201,  3637,  3542, -2842,   726,  2089,
+     2744, -2396, -3712,  3707, -4043,  3584,  4896,  -334,
+     4938,  4938,  3531,  3531,  2174,  2174,  5407,  5407,
+     -113,  -113, -3000, -3000, -5042, -5042, -3247, -3247,
+     1777,  1777, -1544, -1544,  3271,  3271,  2884,  2884,
+    -3149, -3149,  3400,  3400,  4895,  4895, -5332, -5332,
+    -5291, -5291, -3985, -3985,  2847,  2847, -1630, -1630,
+    -2166, -2166,   243,   243,  2645,  2645, -2969, -2969,
+    -4654, -4654,   420,   420,  1689,  1689, -2249, -2249,
+       -3,    -3, -5191, -5191,  5195,  5195, -2370, -2370,
+     3636,  3636,  -476,  -476, -4372, -4372, -3186, -3186,
+     4919,  4919,  -671,  -671,  2305,  2305,  2686,  2686,
+    -1663, -1663,  2178,  2178, -4057, -4057,  1153,  1153,
+      160,   160,  2399,  2399,  1484,  1484,  3510,  3510,
+     2704,  2704,  4905,  4905, -4414, -4414, -2126, -2126,
+     3915,  3915,  3016,  3016,  4053,  4053, -3978, -3978,
+    -1426, -1426, -5559, -5559,  3364,  3364,  4048,  4048,
+    -4437, -4437,  3136,  3136,  2780,  2780, -2865, -2865,
+    -4885, -4885, -4885, -4885, -3833, -3833, -3833, -3833,
+    -2678, -2678, -2678, -2678,   354,   354,   354,   354,
+     1440,  1440,  1440,  1440,  1067,  1067,  1067,  1067,
+     -242,  -242,  -242,  -242, -2859, -2859, -2859, -2859,
+    -1632, -1632, -1632, -1632,  -390,  -390,  -390,  -390,
+     -545,  -545,  -545,  -545,  5698,  5698,  5698,  5698,
+    -3066, -3066, -3066, -3066,   442,   442,   442,   442,
+     4714,  4714,  4714,  4714,  5012,  5012,  5012,  5012,
+     1017,  1017,  1017,  1017, -3778, -3778, -3778, -3778,
+    -3704, -3704, -3704, -3704, -4861, -4861, -4861, -4861,
+     3763,  3763,  3763,  3763,  5101,  5101,  5101,  5101,
+    -1537, -1537, -1537, -1537, -1045, -1045, -1045, -1045,
+    -5084, -5084, -5084, -5084,   773,   773,   773,   773,
+     5019,  5019,  5019,  5019, -2912, -2912, -2912, -2912,
+       27,    27,    27,    27,  2401,  2401,  2401,  2401,
+     4143,  4143,  4143,  4143,  2481,  2481,  2481,  2481,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+};
+
+const int16_t ntt_red256_inv_mixed_powers_rev_gs_cg[1024] = {
+    -4591,  5728, -5023,  5828, -1351,  4978, -5777, -3328,
+    -2625,   949,  4821,  2639,  2975,   563, -3006,  2744,
+     3195, -5860,  1646,  1212, -3621,  2545, -3504,  3542,
+    -1305,  -722, -4134,  5736,  1479,    -1, -5146, -4043,
+    -1170,  2319,   955,  -790,  1326, -5086,  3014, -3201,
+     4805,  3553, -2294, -1062,  2747, -4846, -3135, -3712,
+    -1635,  2768,  1177, -4255,  1853,   140, -4611,   726,
+     3091,    81, -1000, -4320,  3051,  2366, -2963,  4896,
+    -3748,  -953,  -827,  5767,  5067, -2197,   118,  2476,
+    -4354,  -130, -5374,  2837,  3296, -3949,  4452, -2396,
+     5791,  -544,  2468,   339,    -9, -1022,   480, -2842,
+    -1673, -4278, -4989, -5331, -1381, -2525, -4177,  3584,
+    -4890,  5911,  2731, -3932,  5542,  -145,  3459,  3637,
+     3382,   355, -4231, -2548,  5179,  3694, -1759,  3707,
+      729, -3241, -2013, -3289, -3284, -2881, -5092,  2089,
+     1260, -4388, -5755,  4632, -1428,  1696,  2426,  -334,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+     4938,  3636, -5291,  2704,  1777, -1663, -4654, -1426,
+     -113,  4919, -2166,  3915, -3149,   160,    -3, -4437,
+     2174, -4372,  2847, -4414,  3271, -4057,  1689,  3364,
+    -5042,  2305,  2645,  4053,  4895,  1484,  5195,  2780,
+     3531,  -476, -3985,  4905, -1544,  2178,   420, -5559,
+    -3000,  -671,   243,  3016,  3400,  2399, -5191,  3136,
+     5407, -3186, -1630, -2126,  2884,  1153, -2249,  4048,
+    -3247,  2686, -2969, -3978, -5332,  3510, -2370, -2865,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+};
+
+const int16_t ntt_red256_twiddles_4step[256] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  5179, -1428, -3284,  -827,  3296, -1381,    -9,
+      955,  2747,  3051,  1853, -5023,  2975,  1479, -3621,
+     2731,  5542,  5179,  3382, -1428,  1260, -3284,   729,
+     -827,  5067,  3296, -4354, -1381, -1673,    -9,  5791,
+     2731,  3382, -3284,   334, -1381,  5791,  5067,  2396,
+    -5023, -2625, -3621,  4043,  2747, -1170,  3091,  -726,
+     2731, -4890,  5542, -3637,  5179, -3707,  3382,  2548,
+    -1428,   334,  1260, -4632, -3284, -2089,   729,  3289,
+     2731, -3707,  1260,  3289,  3296, -2476,  5791,  2525,
+     3051,  -726,  4805,   790, -3621, -5736, -4591,  -563,
+     2731, -3637,  3382, -3694, -3284,  3289,   334,  4388,
+    -1381,  5331,  5791,  1022,  5067, -5767,  2396,   130,
+     2731,  2548,   729,  4388,    -9,  2525,  2396,   953,
+     1479, -1212, -4591,  -949,  3091,  -140,  3201,  3135,
+     2731,  3932, -4890, -5911,  5542,   145, -3637, -3459,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     2731, -3694,   334,  5092,  5067,   130,  5331, -2468,
+     2747,  5086,  -726,  1000, -2625, -5728, -1212, -1479,
+     2731,   145, -3707,  4231,  1260, -2426,  3289,  3284,
+     3296,   130, -2476,   827,  5791,  -480,  2525,  1673,
+     2731,  -355, -2089,  1428, -1673,  -480, -5767,  4354,
+     2975, -5728, -5736,  3621, -1170,  2294,  -140,  4896,
+     2731, -5911, -3637, -5542,  3382,  4231, -3694,  3707,
+    -3284,  5092,  3289,  -729,   334,  1428,  4388,  4632,
+     2731,  1759, -4632,  -729, -4354,   827,  1022, -5331,
+     1853,  1000,   790, -3712,  4043,  3621,  -949,  5828,
+     2731, -3459,  2548,  3707,   729,  3284,  4388,  1696,
+       -9, -2468,  2525, -5331,  2396,  4354,   953, -2197,
+     2731,  4231,  3289,  4632,  5791,  1673,   130, -2197,
+    -3621, -1479,  -563,  5828,  -726,  4896,  3135,  2319,
+};
+
+const int16_t ntt_red256_inv_twiddles_4step[256] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731, -4231, -2013, -5755,  2468, -4989, -5374,   118,
+     1646, -4134,  4821, -5777,  1177, -1000, -2294,  3014,
+     2731,  3459, -4231, -1759, -2013, -5092, -5755,  2426,
+     2468,   480, -4989, -4177, -5374,  4452,   118,  -953,
+     2731, -1759, -5755, -3241, -5374,  -953,   480, -4278,
+     1177, -2963,  3014,  3553, -4134, -5860, -3006,  4978,
+     2731,  5911,  3459,  -145, -4231,   355, -1759,  3694,
+    -2013, -3241, -5092, -2881, -5755, -4388,  2426,  1696,
+     2731,   355, -5092,  1696, -4989, -1022,  -953,  2837,
+     4821,  4978, -5146,  1212,  3014, -4846,  2768, -4320,
+     2731,  -145, -1759, -2548, -5755,  1696, -3241,  2089,
+    -5374, -3949,  -953,  2476,   480,   339, -4278,  3584,
+     2731,  3694,  2426,  2089,   118,  2837, -4278, -5791,
+    -2294,  -790,  2768,  4896, -3006, -3328,  2545,  1305,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+     2731, -2548, -3241, -1260,   480,  3584, -3949,   827,
+    -4134,  3542,  4978, -2975, -2963,  1635,  -790,  2294,
+     2731,  3637,   355, -5179, -5092,  -729,  1696,  5755,
+    -4989,  3584, -1022, -2468,  -953, -5067,  2837, -4452,
+     2731,  3707, -4388,  2013,  4452, -5067,   339,  4177,
+    -1000,  1635, -4846, -3014, -5860, -1479, -3328,  -949,
+     2731,  4890,  -145, -3459, -1759, -5179, -2548,  -355,
+    -5755, -1260,  1696, -2426, -3241,  2013,  2089,  2881,
+     2731, -3382, -2881, -2426, -4177, -2468,  2476,  3949,
+    -5777, -2975,  1212,   722,  3553, -3014,  4896,  4255,
+     2731, -5542,  3694,  -355,  2426,  5755,  2089,  3289,
+      118,   827,  2837,  3949, -4278,  4177, -5791,  2842,
+     2731, -5179,  1696,  2881,  -953, -4452,  3584,  2842,
+     3014,  2294, -4320,  4255,  4978,  -949,  1305,  3195,
+};
+
+const int16_t ntt_red256_mixed_twiddles_4step[256] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+    -3985,  3400, -5332,  2884, -5291, -3149,  4895,  3271,
+    -1632,  -242, -2859,  1067,  5444, -5277, -5011, -2987,
+      955,  1326,  2747,  4805,  3051,  3091,  1853, -1635,
+    -5023, -1351,  2975, -2625,  1479, -1305, -3621,  3195,
+    -1632, -2678,  1067, -2481, -5011, -6039, -1912,  3248,
+    -5332,  5407, -1544, -3136, -3149,  4938, -5042, -3364,
+     -827, -3748,  5067, -2476,  3296,  2396, -4354, -2837,
+    -1381, -3584, -1673,  5331,    -9,  2842,  5791,  -339,
+    -5291,  4437, -5042,  4414,  2884,  3978,  3531, -2399,
+    -5011,  2437,  -404, -2381,  1440, -5019, -2481, -5101,
+    -5023,  3328, -2625,  -563, -3621, -1212,  4043,   722,
+     2747,  1062, -1170,  5086,  3091, -2366,  -726, -2768,
+     5444, -2143, -6039, -1607,  1440,  1537, -2401, -5012,
+    -3149, -2704, -2780,  4372, -3000, -2178,  3978,  2249,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+    -5332, -1153, -3136,  -420, -5042,  4372, -3915,  5291,
+     1067,  4861,   -27,   545, -6039, -5088, -2381,  5277,
+     3051,   -81,  -726, -1177,  4805,  3135,   790, -1326,
+    -3621,  5860, -5736, -1479, -4591,  5777,  -563,  2625,
+    -2859,  3778,   -27,   242,  -404,   435,  1002,  6039,
+    -1544,  5191,  2126,  3247, -2780, -2847,  1663, -4437,
+    -1381,  4177,  5331,  1673,  5791, -2468,  1022, -2842,
+     5067,  -118, -5767,  3748,  2396, -3296,   130,  2837,
+     4895, -1689, -3915, -4938,  3531, -3400, -2686, -2126,
+    -1912, -1065,  1002, -2437, -2401,  -354, -1017, -1537,
+     1479,  4134, -1212,  3542, -4591,  1351,  -949,   563,
+     3091, -3051,  -140, -4255,  3201,  1170,  3135,  3553,
+    -5011, -2566, -2381,  2143, -2481,  3833, -1017, -3704,
+    -5042, -3271,  1663,   160,  3978,  4048,  -420, -5191,
+};
+
+const int16_t ntt_red256_inv_mixed_twiddles_4step[256] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2566,  -875,  1065,  -435,  -390,  5698,  -545, -3066,
+     2847,  2645, -2166, -4654, -1630, -2969,   243,   420,
+     1646, -3504, -4134, -5146,  4821, -3006, -5777,  5728,
+     1177, -4611, -1000, -2963, -2294, -3135,  3014,  2319,
+     2847,  5195, -4654,  4919,   243,  -476, -2249,  2686,
+     1065,   493,  3646,  1607,  5698, -3778,  4714,  3763,
+     2468,  -544,   480, -1022, -4989, -4278, -4177, -2525,
+    -5374,  -130,  4452, -3949,   118, -2197,  -953,  5767,
+     -390, -4861,  4714, -5084,  -435, -1168,  2422, -3780,
+      243,  2178, -2370, -2126,  1689,  1484,  4919, -1426,
+     1177,   140, -2963, -4320,  3014,  -790,  3553, -3712,
+    -4134,    -1, -5860,  3542, -3006,  2639,  4978,  4591,
+    -1630,  3510,  -476,  3136,  1689,  4053, -1663,   113,
+     5698,   773, -3704,  4885,  5088, -2437, -1168,  1912,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+     1065, -4337,  1607,  2987,  4714,  4885, -1045,   390,
+    -4654, -4437, -4057, -4895,  -476,  3000, -2126,  2969,
+     4821,  2744,  4978,  5023, -5146,  1305,  1212,  3504,
+     3014,  1170, -4846,  2294,  2768, -1853, -4320,  2963,
+    -2166, -4938, -4057, -2645, -2370, -2884,  3016,   476,
+     3646,  4976,  2381,  1207, -3704,  1632,  2401,  4861,
+    -5374,  4354, -3949, -4452,  -953,   827,  2476,  2197,
+      480,     9,   339,   544, -4278,  4989,  3584,  2525,
+     -545, -1440, -1045,  3778,  2422,   875, -3248, -2381,
+    -2249,  5332,  3016, -2178, -1663,     3, -2174, -4053,
+    -2294, -2747,  -790,  5086,  2768,  4611,  4896,  4320,
+    -3006, -4821, -3328, -5828,  2545,  5860,  1305,  4043,
+      243,  3985, -2126, -3510,  4919, -3636, -2174, -2780,
+     4714,  3066,  2401,  2912, -1168,  1378,  2987, -4976,
+};
+
+const int32_t ntt_red256_mixed_powers_rev_simd[416] __attribute__ ((aligned(32))) = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -2481, -2481, -2481, -2481, -5012, -5012, -5012, -5012,
+     1045,  1045,  1045,  1045,  2859,  2859,  2859,  2859,
+     2912,  2912,  2912,  2912, -5698, -5698, -5698, -5698,
+     4861,  4861,  4861,  4861,  -354,  -354,  -354,  -354,
+    -2401, -2401, -2401, -2401,  -442,  -442,  -442,  -442,
+    -5101, -5101, -5101, -5101, -1067, -1067, -1067, -1067,
+     -773,  -773,  -773,  -773,   390,   390,   390,   390,
+     3778,  3778,  3778,  3778,  3833,  3833,  3833,  3833,
+    -4143, -4143, -4143, -4143, -4714, -4714, -4714, -4714,
+     1537,  1537,  1537,  1537,   242,   242,   242,   242,
+    -5019, -5019, -5019, -5019,   545,   545,   545,   545,
+     3704,  3704,  3704,  3704,  2678,  2678,  2678,  2678,
+      -27,   -27,   -27,   -27,  3066,  3066,  3066,  3066,
+    -3763, -3763, -3763, -3763, -1440, -1440, -1440, -1440,
+     5084,  5084,  5084,  5084,  1632,  1632,  1632,  1632,
+    -1017, -1017, -1017, -1017,  4885,  4885,  4885,  4885,
+     2865,  2865, -3510, -3510,  2370,  2370,  5332,  5332,
+     3978,  3978, -2686, -2686,  2969,  2969,  3247,  3247,
+    -4048, -4048, -1153, -1153,  2249,  2249, -2884, -2884,
+     2126,  2126,  3186,  3186,  1630,  1630, -5407, -5407,
+    -3136, -3136, -2399, -2399,  5191,  5191, -3400, -3400,
+    -3016, -3016,   671,   671,  -243,  -243,  3000,  3000,
+     5559,  5559, -2178, -2178,  -420,  -420,  1544,  1544,
+    -4905, -4905,   476,   476,  3985,  3985, -3531, -3531,
+    -2780, -2780, -1484, -1484, -5195, -5195, -4895, -4895,
+    -4053, -4053, -2305, -2305, -2645, -2645,  5042,  5042,
+    -3364, -3364,  4057,  4057, -1689, -1689, -3271, -3271,
+     4414,  4414,  4372,  4372, -2847, -2847, -2174, -2174,
+     4437,  4437,  -160,  -160,     3,     3,  3149,  3149,
+    -3915, -3915, -4919, -4919,  2166,  2166,   113,   113,
+     1426,  1426,  1663,  1663,  4654,  4654, -1777, -1777,
+    -2704, -2704, -3636, -3636,  5291,  5291, -4938, -4938,
+      334, -4632, -2426,  5755, -1696,  4388,  1428, -1260,
+    -2089,  3289,  5092,  2013,  2881,  3241,  3284,  -729,
+    -3707,  2548,  1759,  4231, -3694,  -355, -5179, -3382,
+    -3637,  3932, -3459, -2731,   145, -5911, -5542,  4890,
+    -3584,  5331,  4177,  4989,  2525,  4278,  1381,  1673,
+     2842,  -339,  -480, -2468,  1022,   544,     9, -5791,
+     2396, -2837, -4452,  5374,  3949,   130, -3296,  4354,
+    -2476, -5767,  -118,   827,  2197,   953, -5067,  3748,
+    -4896,  4320,  2963,  1000, -2366,   -81, -3051, -3091,
+     -726,  4255,  4611, -1177,  -140, -2768, -1853,  1635,
+     3712,  1062,  3135,  2294,  4846, -3553, -2747, -4805,
+     3201,   790, -3014,  -955,  5086, -2319, -1326,  1170,
+     4043, -5736,  5146,  4134,     1,   722, -1479,  1305,
+    -3542, -1212,  3504, -1646, -2545,  5860,  3621, -3195,
+    -2744, -2639,  3006, -4821,  -563,  -949, -2975,  2625,
+     3328, -5828,  5777,  5023, -4978, -5728,  1351,  4591,
+};
+
+const int32_t ntt_red256_inv_mixed_powers_rev_simd[320] __attribute__ ((aligned(32))) = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4885,  1017, -1632, -5084,  1440,  3763, -3066,    27,
+    -2678, -3704,  -545,  5019,  -242, -1537,  4714,  4143,
+    -3833, -3778,  -390,   773,  1067,  5101,   442,  2401,
+      354, -4861,  5698, -2912, -2859, -1045,  5012,  2481,
+    -4591,  4938,  5728,  4938, -5023,  3636,  5828,  3636,
+    -1351, -5291,  4978, -5291, -5777,  2704, -3328,  2704,
+    -2625,  1777,   949,  1777,  4821, -1663,  2639, -1663,
+     2975, -4654,   563, -4654, -3006, -1426,  2744, -1426,
+     3195,  -113, -5860,  -113,  1646,  4919,  1212,  4919,
+    -3621, -2166,  2545, -2166, -3504,  3915,  3542,  3915,
+    -1305, -3149,  -722, -3149, -4134,   160,  5736,   160,
+     1479,    -3,    -1,    -3, -5146, -4437, -4043, -4437,
+    -1170,  2174,  2319,  2174,   955, -4372,  -790, -4372,
+     1326,  2847, -5086,  2847,  3014, -4414, -3201, -4414,
+     4805,  3271,  3553,  3271, -2294, -4057, -1062, -4057,
+     2747,  1689, -4846,  1689, -3135,  3364, -3712,  3364,
+    -1635, -5042,  2768, -5042,  1177,  2305, -4255,  2305,
+     1853,  2645,   140,  2645, -4611,  4053,   726,  4053,
+     3091,  4895,    81,  4895, -1000,  1484, -4320,  1484,
+     3051,  5195,  2366,  5195, -2963,  2780,  4896,  2780,
+    -3748,  3531,  -953,  3531,  -827,  -476,  5767,  -476,
+     5067, -3985, -2197, -3985,   118,  4905,  2476,  4905,
+    -4354, -1544,  -130, -1544, -5374,  2178,  2837,  2178,
+     3296,   420, -3949,   420,  4452, -5559, -2396, -5559,
+     5791, -3000,  -544, -3000,  2468,  -671,   339,  -671,
+       -9,   243, -1022,   243,   480,  3016, -2842,  3016,
+    -1673,  3400, -4278,  3400, -4989,  2399, -5331,  2399,
+    -1381, -5191, -2525, -5191, -4177,  3136,  3584,  3136,
+    -4890,  5407,  5911,  5407,  2731, -3186, -3932, -3186,
+     5542, -1630,  -145, -1630,  3459, -2126,  3637, -2126,
+     3382,  2884,   355,  2884, -4231,  1153, -2548,  1153,
+     5179, -2249,  3694, -2249, -1759,  4048,  3707,  4048,
+      729, -3247, -3241, -3247, -2013,  2686, -3289,  2686,
+    -3284, -2969, -2881, -2969, -5092, -3978,  2089, -3978,
+     1260, -5332, -4388, -5332, -5755,  3510,  4632,  3510,
+    -1428, -2370,  1696, -2370,  2426, -2865,  -334, -2865,
+};
+
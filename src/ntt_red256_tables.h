@@ -0,0 +1,98 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 256
+ * - psi = 1002
+ * - omega = psi^2 = 8595
+ * - inverse of psi = 10805
+ * - inverse of omega = 2525
+ * - inverse of n = 12241
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED256_TABLES_H
+#define __NTT_RED256_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red256_psi = 1002;
+static const int32_t ntt_red256_omega = 8595;
+static const int32_t ntt_red256_inv_psi = 10805;
+static const int32_t ntt_red256_inv_omega = 2525;
+static const int32_t ntt_red256_inv_n = 12241;
+static const int32_t ntt_red256_inv_k = 8193;
+static const int32_t ntt_red256_rescale8 = 8822;
+static const int32_t ntt_red256_rescale6 = 5664;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red256_psi_powers[256];
+extern const int16_t ntt_red256_inv_psi_powers[256];
+extern const int16_t ntt_red256_scaled_inv_psi_powers[256];
+extern const int16_t ntt_red256_scaled_inv_psi_powers_var[256];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red256_omega_powers[256];
+extern const int16_t ntt_red256_omega_powers_rev[256];
+extern const int16_t ntt_red256_inv_omega_powers[256];
+extern const int16_t ntt_red256_inv_omega_powers_rev[256];
+extern const int16_t ntt_red256_mixed_powers[256];
+extern const int16_t ntt_red256_mixed_powers_rev[256];
+extern const int16_t ntt_red256_inv_mixed_powers[256];
+extern const int16_t ntt_red256_inv_mixed_powers_rev[256];
+
+/*
+ * TABLES FOR RADIX-4 NTT COMPUTATION
+ */
+extern const int16_t ntt_red256_omega_powers_ct_r4[256];
+extern const int16_t ntt_red256_omega_powers_rev_ct_r4[256];
+extern const int16_t ntt_red256_omega_powers_gs_r4[256];
+extern const int16_t ntt_red256_omega_powers_rev_gs_r4[256];
+extern const int16_t ntt_red256_inv_omega_powers_ct_r4[256];
+extern const int16_t ntt_red256_inv_omega_powers_rev_ct_r4[256];
+extern const int16_t ntt_red256_inv_omega_powers_gs_r4[256];
+extern const int16_t ntt_red256_inv_omega_powers_rev_gs_r4[256];
+extern const int16_t ntt_red256_mixed_powers_ct_r4[256];
+extern const int16_t ntt_red256_mixed_powers_rev_ct_r4[256];
+extern const int16_t ntt_red256_inv_mixed_powers_gs_r4[256];
+extern const int16_t ntt_red256_inv_mixed_powers_rev_gs_r4[256];
+
+/*
+ * TABLES FOR CONSTANT-GEOMETRY NTT COMPUTATION
+ */
+extern const int16_t ntt_red256_omega_powers_ct_cg[1024];
+extern const int16_t ntt_red256_omega_powers_rev_ct_cg[1024];
+extern const int16_t ntt_red256_omega_powers_gs_cg[1024];
+extern const int16_t ntt_red256_omega_powers_rev_gs_cg[1024];
+extern const int16_t ntt_red256_inv_omega_powers_ct_cg[1024];
+extern const int16_t ntt_red256_inv_omega_powers_rev_ct_cg[1024];
+extern const int16_t ntt_red256_inv_omega_powers_gs_cg[1024];
+extern const int16_t ntt_red256_inv_omega_powers_rev_gs_cg[1024];
+extern const int16_t ntt_red256_mixed_powers_ct_cg[1024];
+extern const int16_t ntt_red256_mixed_powers_rev_ct_cg[1024];
+extern const int16_t ntt_red256_inv_mixed_powers_gs_cg[1024];
+extern const int16_t ntt_red256_inv_mixed_powers_rev_gs_cg[1024];
+
+/*
+ * TABLES FOR FOUR-STEP NTT COMPUTATION
+ */
+static const int32_t ntt_red256_n1_4step = 16;
+extern const int16_t ntt_red256_twiddles_4step[256];
+extern const int16_t ntt_red256_inv_twiddles_4step[256];
+extern const int16_t ntt_red256_mixed_twiddles_4step[256];
+extern const int16_t ntt_red256_inv_mixed_twiddles_4step[256];
+
+/*
+ * TABLES IN SIMD LAYOUT (32bit, aligned)
+ */
+extern const int32_t ntt_red256_mixed_powers_rev_simd[416];
+extern const int32_t ntt_red256_inv_mixed_powers_rev_simd[320];
+
+#endif /* __NTT_RED256_TABLES_H */
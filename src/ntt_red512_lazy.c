@@ -0,0 +1,44 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 512. The inputs are in [0, 12288].
+ * The products ntt_red512_product5 and ntt_red512_product5_asm use 4 reductions.
+ *
+ * C schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 20399
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 33232614
+ * - pointwise product, then 1 reductions: |c[i]| <= 52695
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 329401506
+ *
+ * AVX2 schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 20399
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 33232614
+ * - pointwise product, then 1 reductions: |c[i]| <= 52695
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 329401506
+ *
+ */
+
+#include "ntt_red.h"
+#include "ntt_red512.h"
+#include "ntt_asm.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red512_lazy.h"
+
+void ntt_red512_lazy_product(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red512_ct_std2rev(a);
+  reduce_array(a, 512);
+  mulntt_red512_ct_std2rev(b);
+  mul_reduce_array(c, 512, a, b);
+  reduce_array(c, 512);
+  inttmul_red512_gs_rev2std(c);
+  scalar_mul_reduce_finalize(c, 512, ntt_red512_lazy_rescale);
+}
+
+void ntt_red512_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red512_ct_std2rev_fused_asm(a);
+  mulntt_red512_ct_std2rev_asm(b);
+  mul_reduce_array_asm(c, 512, a, b);
+  reduce_array_asm(c, 512);
+  inttmul_red512_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 512, ntt_red512_lazy_asm_rescale);
+}
@@ -0,0 +1,58 @@
+/*
+ * Generated by make_lazy_schedule: do not edit.
+ *
+ * Lazy-reduction products for n = 512. The inputs are in [0, 12288].
+ * The products ntt_red512_product5 and ntt_red512_product5_asm use 4 reductions.
+ *
+ * C schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 20399
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 33232614
+ * - pointwise product, then 1 reductions: |c[i]| <= 52695
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 329401506
+ *
+ * AVX2 schedule: 2 reductions
+ * - forward NTT of a: reduced rounds = none, then 1 reductions: |a[i]| <= 20399
+ * - forward NTT of b: reduced rounds = none, then 0 reductions: |b[i]| <= 33232614
+ * - pointwise product, then 1 reductions: |c[i]| <= 52695
+ * - inverse NTT: reduced rounds = none: |c[i]| <= 329401506
+ *
+ */
+
+#ifndef __NTT_RED512_LAZY_H
+#define __NTT_RED512_LAZY_H
+
+#include <stdint.h>
+
+/*
+ * SCHEDULES
+ * - *_rounds: bit k is set if round k of the NTT is reduced
+ * - *_reductions: number of reductions after the stage
+ * - rescale: constant for the final step
+ */
+static const uint32_t ntt_red512_lazy_fwd_a_rounds = 0x0;
+static const uint32_t ntt_red512_lazy_fwd_a_reductions = 1;
+static const uint32_t ntt_red512_lazy_fwd_b_rounds = 0x0;
+static const uint32_t ntt_red512_lazy_fwd_b_reductions = 0;
+static const uint32_t ntt_red512_lazy_pointwise_reductions = 1;
+static const uint32_t ntt_red512_lazy_inv_rounds = 0x0;
+static const int32_t ntt_red512_lazy_rescale = 2832;
+
+static const uint32_t ntt_red512_lazy_asm_fwd_a_rounds = 0x0;
+static const uint32_t ntt_red512_lazy_asm_fwd_a_reductions = 1;
+static const uint32_t ntt_red512_lazy_asm_fwd_b_rounds = 0x0;
+static const uint32_t ntt_red512_lazy_asm_fwd_b_reductions = 0;
+static const uint32_t ntt_red512_lazy_asm_pointwise_reductions = 1;
+static const uint32_t ntt_red512_lazy_asm_inv_rounds = 0x0;
+static const int32_t ntt_red512_lazy_asm_rescale = 2832;
+
+/*
+ * PRODUCTS
+ * - input: a and b must contain integers in [0, 12288]
+ * - the product is stored in c, in standard order, with coefficients in [0, 12288]
+ * - a and b are modified
+ * - the _asm variant requires AVX2
+ */
+extern void ntt_red512_lazy_product(int32_t *c, int32_t *a, int32_t *b);
+extern void ntt_red512_lazy_product_asm(int32_t *c, int32_t *a, int32_t *b);
+
+#endif /* __NTT_RED512_LAZY_H */
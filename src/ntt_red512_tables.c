@@ -0,0 +1,5640 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 512
+ * - psi = 1003
+ * - omega = psi^2 = 10600
+ * - inverse of psi = 1360
+ * - inverse of omega = 6250
+ * - inverse of n = 12265
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red512_tables.h"
+
+const int16_t ntt_red512_psi_powers[512] = {
+    -4096, -3762,  -563,   605,  4654, -1858,  4354,  4467,
+    -5084,   683, -3135,  1579, -1544,  -218,  2548,  -468,
+    -2422,  3956, -1479,  3532,  3364, -5383, -4278, -1973,
+     -390,  2078, -4896,  4912, -1153, -1293,  5755, -3565,
+      404,  -325,  5828, -4080,    -3, -3009,  5067, -5445,
+    -5019,  4433, -2319, -3336, -3400,  6142,  3637, -1922,
+     1607,  1962,  1646,  4212, -2780,  1263,  1022,  5079,
+    -5698,  -709,  1635,  5468,  3510,  5876, -5092,  4948,
+    -1912,  -652, -2639, -4782, -3636,  2925, -3296,  -147,
+       27,  2503,  3553,  -151, -3985, -3030, -3707,  5446,
+     6022, -6122,  4134,  5009, -2174, -5369, -2525, -1041,
+      442,   922,  3091,  3445,  2126, -5908, -2426,   -56,
+     5277, -3728, -3328,  4624,  4919,  5868,  -827, -6118,
+    -4143, -1747,  5086,  1323,  -243,  2051,  4890,  1359,
+    -1002,  2692, -3504,   142, -5042,  5942,  -339,  4075,
+    -5012,  -835, -1853, -2920, -3978,  3991, -3241,  5862,
+     5444,  4016, -2744,   504,  1663, -3315,  5374, -4749,
+     4885, -3656, -4846,  5906,   420,  3434,  3382,   382,
+     2187,  6119,  5146,    58, -3271,   350, -5331, -1278,
+    -3778, -4322,  3051,   192, -4048, -4774,  4388,  1702,
+    -1065,   948,  4591, -3602,   160,   723,   118, -4536,
+    -2678,  5257,   790,  5874,  5191, -3963, -5542, -3998,
+    -3780,  5961, -5860, -3438,  4895, -5915,  2842,  -522,
+     4861, -3150, -1177,  -787, -2865,  2031, -2881, -1728,
+     -435,  6099, -2625, -3029, -2704,  3757, -4452, -4449,
+    -1440,  5782, -1062,  3957,  -476,  1843,  5179, -3710,
+     2437, -1200,   722,  -885, -2847, -4493,  3584, -5925,
+     5101,  4079, -1000,  4698,  5407,  3772, -1696, -5206,
+     1207, -5990,  1351,  3263,  3915, -5735,  -953,  2683,
+     -242,  3054,  3201,  3174,   671, -2882, -2731,  1254,
+     4284, -4298,  2545, -3477,  2645, -1489,  5791, -4324,
+     1045,  3570,  4611,  4169,  3247,   156, -3289, -5415,
+      493,  2919,  2975, -2302,  1426,  4754,   130, -4789,
+     1632,  2459, -3712,   431,  2178, -2908, -4231, -3988,
+    -6039,  1360,     1,  1003, -1689,  1815,  1673, -5574,
+      773,  1112, -2963,  2049,  2884,  4737, -4632,  -654,
+    -4645, -1404,  5023,  -421, -4437, -1693, -2197, -3860,
+     -545, -5919, -1170, -6055, -2399,  2447, -3459, -3879,
+     4976,  1594,  1212,  -975,  5195,    49,    -9,  3262,
+     2912, -4046, -2768,  1010,  5332,  2281,  2089,  6137,
+    -1378, -5766,  4821,  5886,  4938,   347,  3949,  3789,
+     3066,  2948, -4805, -2127,  4905,  4115, -1759,  5339,
+    -2987,  2555, -5736, -1956,  4372, -2057,  1381, -3514,
+     2401,  -441,    81, -4780, -1630,  -453,   334,  3199,
+     1168,  4049,  5777, -6077,   113,  2738,  5767, -3818,
+     4714, -3123,  1326,  2766, -3016, -1954, -5911, -5435,
+     5011,  -168,  3542,  1105,  2305,  1583,  2468,  5315,
+    -2481, -6065,  -140, -5241,  2969,  3969,  -729, -6136,
+     2381,  4077, -3006, -4213,  1777,   426, -2837,  5537,
+    -1017,   -64, -2747, -2505, -5559,  3529,   355,  -316,
+     2566,  5297,  4043,  -241,  4057,  1512,  4989,  2344,
+     3833, -1958,  2366,  1321, -2249,  5429,  1260, -1987,
+    -2143,  1146, -5728,  6068,  3149,   174,  2476,  1050,
+    -3704, -3834,   955,  -677, -3136,   576,   145, -2033,
+      875,  5106, -3195,  2844,  1484,  1483,   480,  2169,
+      354, -1319,  4255,  3482,  2370,  5333,  3284,   400,
+    -4337,   295,   949,  5594, -5291,  1975,  2396, -5456,
+    -3763, -1566,  2294,  2839, -3531, -2361,  3694,  6093,
+     3646, -5184, -1305,  6008,  4414,  3202,  4177, -1018,
+    -1067, -1058, -4320,  5057, -3186,  -418, -1428,  5529,
+     3248,  1159, -4978, -3600,  2166, -2655,  3748, -1190,
+    -1537, -5486,  3014,   -52, -3000,  1805,  3932,  -973,
+    -5088, -3329,  3621, -5681,  4053, -2500,  -544, -4916,
+    -2859, -4240,  -726, -3127, -2686, -2767,  2013,  3643,
+};
+
+const int16_t ntt_red512_psi_powers_rev[512] = {
+        0, -4096, -4096,  5444, -4096,  5444, -1912,  -435,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -2422,  2187,  6022,  2437,  1607, -3780, -1002,  4284,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -2422,  2187,  6022,  2437,  1607, -3780, -1002,  4284,
+    -5084,  4885,    27, -1440, -5019, -2678, -4143,  -242,
+     -390, -3778,   442,  5101, -5698,  4861, -5012,  1045,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -2422,  2187,  6022,  2437,  1607, -3780, -1002,  4284,
+    -5084,  4885,    27, -1440, -5019, -2678, -4143,  -242,
+     -390, -3778,   442,  5101, -5698,  4861, -5012,  1045,
+     4654,  1663, -3636, -2704,    -3,   160,  4919,  3915,
+     3364, -3271, -2174, -2847, -2780,  4895, -5042,  2645,
+    -1544,   420, -3985,  -476, -3400,  5191,  -243,   671,
+    -1153, -4048,  2126,  5407,  3510, -2865, -3978,  3247,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -2422,  2187,  6022,  2437,  1607, -3780, -1002,  4284,
+    -5084,  4885,    27, -1440, -5019, -2678, -4143,  -242,
+     -390, -3778,   442,  5101, -5698,  4861, -5012,  1045,
+     4654,  1663, -3636, -2704,    -3,   160,  4919,  3915,
+     3364, -3271, -2174, -2847, -2780,  4895, -5042,  2645,
+    -1544,   420, -3985,  -476, -3400,  5191,  -243,   671,
+    -1153, -4048,  2126,  5407,  3510, -2865, -3978,  3247,
+     -563, -2744, -2639, -2625,  5828,  4591, -3328,  1351,
+    -1479,  5146,  4134,   722,  1646, -5860, -3504,  2545,
+    -3135, -4846,  3553, -1062, -2319,   790,  5086,  3201,
+    -4896,  3051,  3091, -1000,  1635, -1177, -1853,  4611,
+     4354,  5374, -3296, -4452,  5067,   118,  -827,  -953,
+    -4278, -5331, -2525,  3584,  1022,  2842,  -339,  5791,
+     2548,  3382, -3707,  5179,  3637, -5542,  4890, -2731,
+     5755,  4388, -2426, -1696, -5092, -2881, -3241, -3289,
+    -4096,  5444, -1912,  -435,   404, -1065,  5277,  1207,
+    -2422,  2187,  6022,  2437,  1607, -3780, -1002,  4284,
+    -5084,  4885,    27, -1440, -5019, -2678, -4143,  -242,
+     -390, -3778,   442,  5101, -5698,  4861, -5012,  1045,
+     4654,  1663, -3636, -2704,    -3,   160,  4919,  3915,
+     3364, -3271, -2174, -2847, -2780,  4895, -5042,  2645,
+    -1544,   420, -3985,  -476, -3400,  5191,  -243,   671,
+    -1153, -4048,  2126,  5407,  3510, -2865, -3978,  3247,
+     -563, -2744, -2639, -2625,  5828,  4591, -3328,  1351,
+    -1479,  5146,  4134,   722,  1646, -5860, -3504,  2545,
+    -3135, -4846,  3553, -1062, -2319,   790,  5086,  3201,
+    -4896,  3051,  3091, -1000,  1635, -1177, -1853,  4611,
+     4354,  5374, -3296, -4452,  5067,   118,  -827,  -953,
+    -4278, -5331, -2525,  3584,  1022,  2842,  -339,  5791,
+     2548,  3382, -3707,  5179,  3637, -5542,  4890, -2731,
+     5755,  4388, -2426, -1696, -5092, -2881, -3241, -3289,
+    -3762,  4016,  -652,  6099,  -325,   948, -3728, -5990,
+     3956,  6119, -6122, -1200,  1962,  5961,  2692, -4298,
+      683, -3656,  2503,  5782,  4433,  5257, -1747,  3054,
+     2078, -4322,   922,  4079,  -709, -3150,  -835,  3570,
+    -1858, -3315,  2925,  3757, -3009,   723,  5868, -5735,
+    -5383,   350, -5369, -4493,  1263, -5915,  5942, -1489,
+     -218,  3434, -3030,  1843,  6142, -3963,  2051, -2882,
+    -1293, -4774, -5908,  3772,  5876,  2031,  3991,   156,
+      605,   504, -4782, -3029, -4080, -3602,  4624,  3263,
+     3532,    58,  5009,  -885,  4212, -3438,   142, -3477,
+     1579,  5906,  -151,  3957, -3336,  5874,  1323,  3174,
+     4912,   192,  3445,  4698,  5468,  -787, -2920,  4169,
+     4467, -4749,  -147, -4449, -5445, -4536, -6118,  2683,
+    -1973, -1278, -1041, -5925,  5079,  -522,  4075, -4324,
+     -468,   382,  5446, -3710, -1922, -3998,  1359,  1254,
+    -3565,  1702,   -56, -5206,  4948, -1728,  5862, -5415,
+};
+
+const int16_t ntt_red512_inv_psi_powers[512] = {
+    -4096, -3643, -2013,  2767,  2686,  3127,   726,  4240,
+     2859,  4916,   544,  2500, -4053,  5681, -3621,  3329,
+     5088,   973, -3932, -1805,  3000,    52, -3014,  5486,
+     1537,  1190, -3748,  2655, -2166,  3600,  4978, -1159,
+    -3248, -5529,  1428,   418,  3186, -5057,  4320,  1058,
+     1067,  1018, -4177, -3202, -4414, -6008,  1305,  5184,
+    -3646, -6093, -3694,  2361,  3531, -2839, -2294,  1566,
+     3763,  5456, -2396, -1975,  5291, -5594,  -949,  -295,
+     4337,  -400, -3284, -5333, -2370, -3482, -4255,  1319,
+     -354, -2169,  -480, -1483, -1484, -2844,  3195, -5106,
+     -875,  2033,  -145,  -576,  3136,   677,  -955,  3834,
+     3704, -1050, -2476,  -174, -3149, -6068,  5728, -1146,
+     2143,  1987, -1260, -5429,  2249, -1321, -2366,  1958,
+    -3833, -2344, -4989, -1512, -4057,   241, -4043, -5297,
+    -2566,   316,  -355, -3529,  5559,  2505,  2747,    64,
+     1017, -5537,  2837,  -426, -1777,  4213,  3006, -4077,
+    -2381,  6136,   729, -3969, -2969,  5241,   140,  6065,
+     2481, -5315, -2468, -1583, -2305, -1105, -3542,   168,
+    -5011,  5435,  5911,  1954,  3016, -2766, -1326,  3123,
+    -4714,  3818, -5767, -2738,  -113,  6077, -5777, -4049,
+    -1168, -3199,  -334,   453,  1630,  4780,   -81,   441,
+    -2401,  3514, -1381,  2057, -4372,  1956,  5736, -2555,
+     2987, -5339,  1759, -4115, -4905,  2127,  4805, -2948,
+    -3066, -3789, -3949,  -347, -4938, -5886, -4821,  5766,
+     1378, -6137, -2089, -2281, -5332, -1010,  2768,  4046,
+    -2912, -3262,     9,   -49, -5195,   975, -1212, -1594,
+    -4976,  3879,  3459, -2447,  2399,  6055,  1170,  5919,
+      545,  3860,  2197,  1693,  4437,   421, -5023,  1404,
+     4645,   654,  4632, -4737, -2884, -2049,  2963, -1112,
+     -773,  5574, -1673, -1815,  1689, -1003,    -1, -1360,
+     6039,  3988,  4231,  2908, -2178,  -431,  3712, -2459,
+    -1632,  4789,  -130, -4754, -1426,  2302, -2975, -2919,
+     -493,  5415,  3289,  -156, -3247, -4169, -4611, -3570,
+    -1045,  4324, -5791,  1489, -2645,  3477, -2545,  4298,
+    -4284, -1254,  2731,  2882,  -671, -3174, -3201, -3054,
+      242, -2683,   953,  5735, -3915, -3263, -1351,  5990,
+    -1207,  5206,  1696, -3772, -5407, -4698,  1000, -4079,
+    -5101,  5925, -3584,  4493,  2847,   885,  -722,  1200,
+    -2437,  3710, -5179, -1843,   476, -3957,  1062, -5782,
+     1440,  4449,  4452, -3757,  2704,  3029,  2625, -6099,
+      435,  1728,  2881, -2031,  2865,   787,  1177,  3150,
+    -4861,   522, -2842,  5915, -4895,  3438,  5860, -5961,
+     3780,  3998,  5542,  3963, -5191, -5874,  -790, -5257,
+     2678,  4536,  -118,  -723,  -160,  3602, -4591,  -948,
+     1065, -1702, -4388,  4774,  4048,  -192, -3051,  4322,
+     3778,  1278,  5331,  -350,  3271,   -58, -5146, -6119,
+    -2187,  -382, -3382, -3434,  -420, -5906,  4846,  3656,
+    -4885,  4749, -5374,  3315, -1663,  -504,  2744, -4016,
+    -5444, -5862,  3241, -3991,  3978,  2920,  1853,   835,
+     5012, -4075,   339, -5942,  5042,  -142,  3504, -2692,
+     1002, -1359, -4890, -2051,   243, -1323, -5086,  1747,
+     4143,  6118,   827, -5868, -4919, -4624,  3328,  3728,
+    -5277,    56,  2426,  5908, -2126, -3445, -3091,  -922,
+     -442,  1041,  2525,  5369,  2174, -5009, -4134,  6122,
+    -6022, -5446,  3707,  3030,  3985,   151, -3553, -2503,
+      -27,   147,  3296, -2925,  3636,  4782,  2639,   652,
+     1912, -4948,  5092, -5876, -3510, -5468, -1635,   709,
+     5698, -5079, -1022, -1263,  2780, -4212, -1646, -1962,
+    -1607,  1922, -3637, -6142,  3400,  3336,  2319, -4433,
+     5019,  5445, -5067,  3009,     3,  4080, -5828,   325,
+     -404,  3565, -5755,  1293,  1153, -4912,  4896, -2078,
+      390,  1973,  4278,  5383, -3364, -3532,  1479, -3956,
+     2422,   468, -2548,   218,  1544, -1579,  3135,  -683,
+     5084, -4467, -4354,  1858, -4654,  -605,   563,  3762,
+};
+
+const int16_t ntt_red512_scaled_inv_psi_powers[512] = {
+     4411,  1928,  4523, -5509,  4050,  2528, -2840, -3654,
+    -4684, -4538, -2602,   512, -4153,  4860, -1882, -3408,
+    -1927, -3163,  -530,  4251,  5530,   -68,  5832,  5115,
+      826,  5061,  1120,  -636, -4730, -5653,  4834,  -375,
+     6138,  3449, -3758,  1344, -3221, -5676, -1868,  3343,
+     -450,  2450,  1681,   406,  -845,  5966,  3020,  2674,
+     -904,  -540,  2940,  4475,  2945, -1014, -2672,  3624,
+      751,  1373,  -648,  3528,  5370,  3534,  1241,  4167,
+     1891,  3359, -3268,  4138,  -682, -5845,  1783,  3947,
+    -2373,  4727,  1573,   994,    50, -5734,  5275, -2776,
+    -2637,  2068, -1701, -3028, -1265,    60, -4423, -5959,
+    -5789,  4209, -2434, -4499,  1282, -1518,    72,  -392,
+    -4693, -4489,  2593,  -463, -2941, -5835,  3094,  5002,
+    -5386,  -716, -2929, -1804,  4360, -5987,  5287,  1255,
+    -1371,  3368, -3317, -1057,   293,  5232,   189, -1029,
+     1506, -4103,  -874,  3393,  6105, -4564, -1095, -2231,
+     1223,  4265,    -8,  1409,  -844, -4963, -3019, -1314,
+    -5135, -3448,  5118,  4906,  -767,  1445, -1040, -1165,
+      881,  6127,   778,  1226, -3944, -5836,  1734, -1248,
+    -1398,  3515,   -21, -3982,  3929, -2275,  2828,  -377,
+     3418,  3238,  4218, -2483,  2595,  2257, -2730, -1522,
+    -5368,  -814, -1030,   146,  1936,  3114, -4665, -3276,
+     5547, -1526,  1481, -1236,  2633,  4781,  1279, -5598,
+     5900,  -717, -4289,  4235, -3941, -1756, -4094,  -923,
+    -1802, -5209, -5776, -2689,  5082,  5102, -4565, -2455,
+     3808,  5211, -3793,  2900,  -769, -1275, -1251, -5478,
+    -2946,  -346, -3578,   364,  3480,  1535, -1530, -3959,
+    -1658, -5993, -2873,   622, -2021,  4176,  1842, -1836,
+    -2293,  2926, -2276,  1468,  5662, -4883, -4820, -5163,
+    -4661,  2164,  5969, -5189, -3154,  -579,  -944, -5784,
+    -1280,  4238,   139,  4705, -3769, -1327,  1763,  1325,
+    -4483, -1536,   170, -2291,  5646, -2065,  5781, -2800,
+     1590,  -464, -4301,   204, -5207, -3056, -2478, -2894,
+    -3360,  1908,  1901,  4670, -2213,  1125, -6125,  1942,
+    -1015, -4032, -2626,  4739,  5604,  2260,  1350,  4939,
+    -5043, -1218,  2535, -5609,  3229,  4267,  2712,  1620,
+     3469, -1136,  3454,  3042, -4273,  1417, -2253, -4119,
+     1944,  1705, -3821,  1687, -3723,  -212, -5673,  2212,
+    -2485,  -125,  2046,  5246, -5349,   448, -5170, -1892,
+    -4719, -2982,  -150,  4913, -3536, -3961, -4378,  6085,
+     5103, -3205,  3795,  -180,   980,  5588,  5078,  -338,
+    -4987,  1208, -3846,  4554,  -216,  1176,  1790,  1178,
+     4510,  1389, -3466,  5216,  3007, -2717,  3869,  2148,
+    -3502,  5412,  -791,  5672, -3572, -3765,  4113,  2185,
+    -2338,  3171,  -879, -3407,  -567,  3087, -4518,    20,
+     2622,  2110, -6026,  1403,  3285, -5596, -3669,  -506,
+       24, -4227,  2532,  2600, -3232,  3942,  3116, -1945,
+    -3065, -2429,  2301, -4335,  3120,  3495, -2643, -6092,
+    -2334, -3678,  -457,  5219, -5202,  3744,  4194,  1744,
+       63,  -343,   502, -5464,  3805,  1131,  2035,  2575,
+     -365, -4840,  4504,  5518, -4099,  4566,  3815,  2442,
+     3090,  -438, -5808,  2947,  1706, -2461, -4352,  4578,
+    -4443,  3708,  4390, -2054, -3837,  4505, -5411,  2151,
+      578,  -416,  -466,  5268,    -7,  2769,  5406,  3338,
+     5039, -4222, -2957, -3017,  1406, -4924,   865, -3344,
+     -910,  3589,  2307,  3825,  3753,  4145, -3451,  1038,
+    -1555, -1092,  1849, -4605,  4590,  -412,  4974,  5690,
+    -3670, -1866,  6063,  -239, -5526,  5508, -5410,  3511,
+    -5461, -4404, -4697,  2360,  2171,  3200,  1694,  5797,
+    -5618,  3278, -2827,  1737,  2832,  5063,  3840,  -425,
+     -417, -1826,  -982,  3981, -5289, -3975,  1160,  4608,
+     -510, -5416, -4649, -6094, -5054, -3889, -4770,  1392,
+      614,  -612,  3332, -3121, -4855, -3607, -2209, -5724,
+    -5703, -1721, -5650, -3375,  6086, -5826,  3045,  -193,
+};
+
+const int16_t ntt_red512_scaled_inv_psi_powers_var[512] = {
+     2832,  5063,  3840,  -425,  -417, -1826,  -982,  3981,
+    -5289, -3975,  1160,  4608,  -510, -5416, -4649, -6094,
+    -5054, -3889, -4770,  1392,   614,  -612,  3332, -3121,
+    -4855, -3607, -2209, -5724, -5703, -1721, -5650, -3375,
+     6086, -5826,  3045,  -193, -4411, -1928, -4523,  5509,
+    -4050, -2528,  2840,  3654,  4684,  4538,  2602,  -512,
+     4153, -4860,  1882,  3408,  1927,  3163,   530, -4251,
+    -5530,    68, -5832, -5115,  -826, -5061, -1120,   636,
+     4730,  5653, -4834,   375, -6138, -3449,  3758, -1344,
+     3221,  5676,  1868, -3343,   450, -2450, -1681,  -406,
+      845, -5966, -3020, -2674,   904,   540, -2940, -4475,
+    -2945,  1014,  2672, -3624,  -751, -1373,   648, -3528,
+    -5370, -3534, -1241, -4167, -1891, -3359,  3268, -4138,
+      682,  5845, -1783, -3947,  2373, -4727, -1573,  -994,
+      -50,  5734, -5275,  2776,  2637, -2068,  1701,  3028,
+     1265,   -60,  4423,  5959,  5789, -4209,  2434,  4499,
+    -1282,  1518,   -72,   392,  4693,  4489, -2593,   463,
+     2941,  5835, -3094, -5002,  5386,   716,  2929,  1804,
+    -4360,  5987, -5287, -1255,  1371, -3368,  3317,  1057,
+     -293, -5232,  -189,  1029, -1506,  4103,   874, -3393,
+    -6105,  4564,  1095,  2231, -1223, -4265,     8, -1409,
+      844,  4963,  3019,  1314,  5135,  3448, -5118, -4906,
+      767, -1445,  1040,  1165,  -881, -6127,  -778, -1226,
+     3944,  5836, -1734,  1248,  1398, -3515,    21,  3982,
+    -3929,  2275, -2828,   377, -3418, -3238, -4218,  2483,
+    -2595, -2257,  2730,  1522,  5368,   814,  1030,  -146,
+    -1936, -3114,  4665,  3276, -5547,  1526, -1481,  1236,
+    -2633, -4781, -1279,  5598, -5900,   717,  4289, -4235,
+     3941,  1756,  4094,   923,  1802,  5209,  5776,  2689,
+    -5082, -5102,  4565,  2455, -3808, -5211,  3793, -2900,
+      769,  1275,  1251,  5478,  2946,   346,  3578,  -364,
+    -3480, -1535,  1530,  3959,  1658,  5993,  2873,  -622,
+     2021, -4176, -1842,  1836,  2293, -2926,  2276, -1468,
+    -5662,  4883,  4820,  5163,  4661, -2164, -5969,  5189,
+     3154,   579,   944,  5784,  1280, -4238,  -139, -4705,
+     3769,  1327, -1763, -1325,  4483,  1536,  -170,  2291,
+    -5646,  2065, -5781,  2800, -1590,   464,  4301,  -204,
+     5207,  3056,  2478,  2894,  3360, -1908, -1901, -4670,
+     2213, -1125,  6125, -1942,  1015,  4032,  2626, -4739,
+    -5604, -2260, -1350, -4939,  5043,  1218, -2535,  5609,
+    -3229, -4267, -2712, -1620, -3469,  1136, -3454, -3042,
+     4273, -1417,  2253,  4119, -1944, -1705,  3821, -1687,
+     3723,   212,  5673, -2212,  2485,   125, -2046, -5246,
+     5349,  -448,  5170,  1892,  4719,  2982,   150, -4913,
+     3536,  3961,  4378, -6085, -5103,  3205, -3795,   180,
+     -980, -5588, -5078,   338,  4987, -1208,  3846, -4554,
+      216, -1176, -1790, -1178, -4510, -1389,  3466, -5216,
+    -3007,  2717, -3869, -2148,  3502, -5412,   791, -5672,
+     3572,  3765, -4113, -2185,  2338, -3171,   879,  3407,
+      567, -3087,  4518,   -20, -2622, -2110,  6026, -1403,
+    -3285,  5596,  3669,   506,   -24,  4227, -2532, -2600,
+     3232, -3942, -3116,  1945,  3065,  2429, -2301,  4335,
+    -3120, -3495,  2643,  6092,  2334,  3678,   457, -5219,
+     5202, -3744, -4194, -1744,   -63,   343,  -502,  5464,
+    -3805, -1131, -2035, -2575,   365,  4840, -4504, -5518,
+     4099, -4566, -3815, -2442, -3090,   438,  5808, -2947,
+    -1706,  2461,  4352, -4578,  4443, -3708, -4390,  2054,
+     3837, -4505,  5411, -2151,  -578,   416,   466, -5268,
+        7, -2769, -5406, -3338, -5039,  4222,  2957,  3017,
+    -1406,  4924,  -865,  3344,   910, -3589, -2307, -3825,
+    -3753, -4145,  3451, -1038,  1555,  1092, -1849,  4605,
+    -4590,   412, -4974, -5690,  3670,  1866, -6063,   239,
+     5526, -5508,  5410, -3511,  5461,  4404,  4697, -2360,
+    -2171, -3200, -1694, -5797,  5618, -3278,  2827, -1737,
+};
+
+const int16_t ntt_red512_omega_powers[512] = {
+        0, -4096, -4096,   493, -4096,  5444,   493,  2381,
+    -4096, -1912,  5444,  -435,   493, -1378,  2381, -4337,
+    -4096,   404, -1912,  5277,  5444, -1065,  -435,  1207,
+      493, -4645, -1378,  1168,  2381, -2143, -4337,  3248,
+    -4096, -2422,   404,  1607, -1912,  6022,  5277, -1002,
+     5444,  2187, -1065, -3780,  -435,  2437,  1207,  4284,
+      493, -6039, -4645,  4976, -1378, -2987,  1168,  5011,
+     2381,  2566, -2143,   875, -4337,  3646,  3248, -5088,
+    -4096, -5084, -2422,  -390,   404, -5019,  1607, -5698,
+    -1912,    27,  6022,   442,  5277, -4143, -1002, -5012,
+     5444,  4885,  2187, -3778, -1065, -2678, -3780,  4861,
+     -435, -1440,  2437,  5101,  1207,  -242,  4284,  1045,
+      493,  1632, -6039,   773, -4645,  -545,  4976,  2912,
+    -1378,  3066, -2987,  2401,  1168,  4714,  5011, -2481,
+     2381, -1017,  2566,  3833, -2143, -3704,   875,   354,
+    -4337, -3763,  3646, -1067,  3248, -1537, -5088, -2859,
+    -4096,  4654, -5084, -1544, -2422,  3364,  -390, -1153,
+      404,    -3, -5019, -3400,  1607, -2780, -5698,  3510,
+    -1912, -3636,    27, -3985,  6022, -2174,   442,  2126,
+     5277,  4919, -4143,  -243, -1002, -5042, -5012, -3978,
+     5444,  1663,  4885,   420,  2187, -3271, -3778, -4048,
+    -1065,   160, -2678,  5191, -3780,  4895,  4861, -2865,
+     -435, -2704, -1440,  -476,  2437, -2847,  5101,  5407,
+     1207,  3915,  -242,   671,  4284,  2645,  1045,  3247,
+      493,  1426,  1632,  2178, -6039, -1689,   773,  2884,
+    -4645, -4437,  -545, -2399,  4976,  5195,  2912,  5332,
+    -1378,  4938,  3066,  4905, -2987,  4372,  2401, -1630,
+     1168,   113,  4714, -3016,  5011,  2305, -2481,  2969,
+     2381,  1777, -1017, -5559,  2566,  4057,  3833, -2249,
+    -2143,  3149, -3704, -3136,   875,  1484,   354,  2370,
+    -4337, -5291, -3763, -3531,  3646,  4414, -1067, -3186,
+     3248,  2166, -1537, -3000, -5088,  4053, -2859, -2686,
+    -4096,  -563,  4654,  4354, -5084, -3135, -1544,  2548,
+    -2422, -1479,  3364, -4278,  -390, -4896, -1153,  5755,
+      404,  5828,    -3,  5067, -5019, -2319, -3400,  3637,
+     1607,  1646, -2780,  1022, -5698,  1635,  3510, -5092,
+    -1912, -2639, -3636, -3296,    27,  3553, -3985, -3707,
+     6022,  4134, -2174, -2525,   442,  3091,  2126, -2426,
+     5277, -3328,  4919,  -827, -4143,  5086,  -243,  4890,
+    -1002, -3504, -5042,  -339, -5012, -1853, -3978, -3241,
+     5444, -2744,  1663,  5374,  4885, -4846,   420,  3382,
+     2187,  5146, -3271, -5331, -3778,  3051, -4048,  4388,
+    -1065,  4591,   160,   118, -2678,   790,  5191, -5542,
+    -3780, -5860,  4895,  2842,  4861, -1177, -2865, -2881,
+     -435, -2625, -2704, -4452, -1440, -1062,  -476,  5179,
+     2437,   722, -2847,  3584,  5101, -1000,  5407, -1696,
+     1207,  1351,  3915,  -953,  -242,  3201,   671, -2731,
+     4284,  2545,  2645,  5791,  1045,  4611,  3247, -3289,
+      493,  2975,  1426,   130,  1632, -3712,  2178, -4231,
+    -6039,     1, -1689,  1673,   773, -2963,  2884, -4632,
+    -4645,  5023, -4437, -2197,  -545, -1170, -2399, -3459,
+     4976,  1212,  5195,    -9,  2912, -2768,  5332,  2089,
+    -1378,  4821,  4938,  3949,  3066, -4805,  4905, -1759,
+    -2987, -5736,  4372,  1381,  2401,    81, -1630,   334,
+     1168,  5777,   113,  5767,  4714,  1326, -3016, -5911,
+     5011,  3542,  2305,  2468, -2481,  -140,  2969,  -729,
+     2381, -3006,  1777, -2837, -1017, -2747, -5559,   355,
+     2566,  4043,  4057,  4989,  3833,  2366, -2249,  1260,
+    -2143, -5728,  3149,  2476, -3704,   955, -3136,   145,
+      875, -3195,  1484,   480,   354,  4255,  2370,  3284,
+    -4337,   949, -5291,  2396, -3763,  2294, -3531,  3694,
+     3646, -1305,  4414,  4177, -1067, -4320, -3186, -1428,
+     3248, -4978,  2166,  3748, -1537,  3014, -3000,  3932,
+    -5088,  3621,  4053,  -544, -2859,  -726, -2686,  2013,
+};
+
+const int16_t ntt_red512_omega_powers_rev[512] = {
+        0, -4096, -4096,   493, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+};
+
+const int16_t ntt_red512_inv_omega_powers[512] = {
+        0, -4096, -4096,  -493, -4096, -2381,  -493, -5444,
+    -4096,  4337, -2381,  1378,  -493,   435, -5444,  1912,
+    -4096, -3248,  4337,  2143, -2381, -1168,  1378,  4645,
+     -493, -1207,   435,  1065, -5444, -5277,  1912,  -404,
+    -4096,  5088, -3248, -3646,  4337,  -875,  2143, -2566,
+    -2381, -5011, -1168,  2987,  1378, -4976,  4645,  6039,
+     -493, -4284, -1207, -2437,   435,  3780,  1065, -2187,
+    -5444,  1002, -5277, -6022,  1912, -1607,  -404,  2422,
+    -4096,  2859,  5088,  1537, -3248,  1067, -3646,  3763,
+     4337,  -354,  -875,  3704,  2143, -3833, -2566,  1017,
+    -2381,  2481, -5011, -4714, -1168, -2401,  2987, -3066,
+     1378, -2912, -4976,   545,  4645,  -773,  6039, -1632,
+     -493, -1045, -4284,   242, -1207, -5101, -2437,  1440,
+      435, -4861,  3780,  2678,  1065,  3778, -2187, -4885,
+    -5444,  5012,  1002,  4143, -5277,  -442, -6022,   -27,
+     1912,  5698, -1607,  5019,  -404,   390,  2422,  5084,
+    -4096,  2686,  2859, -4053,  5088,  3000,  1537, -2166,
+    -3248,  3186,  1067, -4414, -3646,  3531,  3763,  5291,
+     4337, -2370,  -354, -1484,  -875,  3136,  3704, -3149,
+     2143,  2249, -3833, -4057, -2566,  5559,  1017, -1777,
+    -2381, -2969,  2481, -2305, -5011,  3016, -4714,  -113,
+    -1168,  1630, -2401, -4372,  2987, -4905, -3066, -4938,
+     1378, -5332, -2912, -5195, -4976,  2399,   545,  4437,
+     4645, -2884,  -773,  1689,  6039, -2178, -1632, -1426,
+     -493, -3247, -1045, -2645, -4284,  -671,   242, -3915,
+    -1207, -5407, -5101,  2847, -2437,   476,  1440,  2704,
+      435,  2865, -4861, -4895,  3780, -5191,  2678,  -160,
+     1065,  4048,  3778,  3271, -2187,  -420, -4885, -1663,
+    -5444,  3978,  5012,  5042,  1002,   243,  4143, -4919,
+    -5277, -2126,  -442,  2174, -6022,  3985,   -27,  3636,
+     1912, -3510,  5698,  2780, -1607,  3400,  5019,     3,
+     -404,  1153,   390, -3364,  2422,  1544,  5084, -4654,
+    -4096, -2013,  2686,   726,  2859,   544, -4053, -3621,
+     5088, -3932,  3000, -3014,  1537, -3748, -2166,  4978,
+    -3248,  1428,  3186,  4320,  1067, -4177, -4414,  1305,
+    -3646, -3694,  3531, -2294,  3763, -2396,  5291,  -949,
+     4337, -3284, -2370, -4255,  -354,  -480, -1484,  3195,
+     -875,  -145,  3136,  -955,  3704, -2476, -3149,  5728,
+     2143, -1260,  2249, -2366, -3833, -4989, -4057, -4043,
+    -2566,  -355,  5559,  2747,  1017,  2837, -1777,  3006,
+    -2381,   729, -2969,   140,  2481, -2468, -2305, -3542,
+    -5011,  5911,  3016, -1326, -4714, -5767,  -113, -5777,
+    -1168,  -334,  1630,   -81, -2401, -1381, -4372,  5736,
+     2987,  1759, -4905,  4805, -3066, -3949, -4938, -4821,
+     1378, -2089, -5332,  2768, -2912,     9, -5195, -1212,
+    -4976,  3459,  2399,  1170,   545,  2197,  4437, -5023,
+     4645,  4632, -2884,  2963,  -773, -1673,  1689,    -1,
+     6039,  4231, -2178,  3712, -1632,  -130, -1426, -2975,
+     -493,  3289, -3247, -4611, -1045, -5791, -2645, -2545,
+    -4284,  2731,  -671, -3201,   242,   953, -3915, -1351,
+    -1207,  1696, -5407,  1000, -5101, -3584,  2847,  -722,
+    -2437, -5179,   476,  1062,  1440,  4452,  2704,  2625,
+      435,  2881,  2865,  1177, -4861, -2842, -4895,  5860,
+     3780,  5542, -5191,  -790,  2678,  -118,  -160, -4591,
+     1065, -4388,  4048, -3051,  3778,  5331,  3271, -5146,
+    -2187, -3382,  -420,  4846, -4885, -5374, -1663,  2744,
+    -5444,  3241,  3978,  1853,  5012,   339,  5042,  3504,
+     1002, -4890,   243, -5086,  4143,   827, -4919,  3328,
+    -5277,  2426, -2126, -3091,  -442,  2525,  2174, -4134,
+    -6022,  3707,  3985, -3553,   -27,  3296,  3636,  2639,
+     1912,  5092, -3510, -1635,  5698, -1022,  2780, -1646,
+    -1607, -3637,  3400,  2319,  5019, -5067,     3, -5828,
+     -404, -5755,  1153,  4896,   390,  4278, -3364,  1479,
+     2422, -2548,  1544,  3135,  5084, -4354, -4654,   563,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev[512] = {
+        0, -4096, -4096,  -493, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+};
+
+const int16_t ntt_red512_mixed_powers[512] = {
+        0,   493,  5444,  2381, -1912,  -435, -1378, -4337,
+      404,  5277, -1065,  1207, -4645,  1168, -2143,  3248,
+    -2422,  1607,  6022, -1002,  2187, -3780,  2437,  4284,
+    -6039,  4976, -2987,  5011,  2566,   875,  3646, -5088,
+    -5084,  -390, -5019, -5698,    27,   442, -4143, -5012,
+     4885, -3778, -2678,  4861, -1440,  5101,  -242,  1045,
+     1632,   773,  -545,  2912,  3066,  2401,  4714, -2481,
+    -1017,  3833, -3704,   354, -3763, -1067, -1537, -2859,
+     4654, -1544,  3364, -1153,    -3, -3400, -2780,  3510,
+    -3636, -3985, -2174,  2126,  4919,  -243, -5042, -3978,
+     1663,   420, -3271, -4048,   160,  5191,  4895, -2865,
+    -2704,  -476, -2847,  5407,  3915,   671,  2645,  3247,
+     1426,  2178, -1689,  2884, -4437, -2399,  5195,  5332,
+     4938,  4905,  4372, -1630,   113, -3016,  2305,  2969,
+     1777, -5559,  4057, -2249,  3149, -3136,  1484,  2370,
+    -5291, -3531,  4414, -3186,  2166, -3000,  4053, -2686,
+     -563,  4354, -3135,  2548, -1479, -4278, -4896,  5755,
+     5828,  5067, -2319,  3637,  1646,  1022,  1635, -5092,
+    -2639, -3296,  3553, -3707,  4134, -2525,  3091, -2426,
+    -3328,  -827,  5086,  4890, -3504,  -339, -1853, -3241,
+    -2744,  5374, -4846,  3382,  5146, -5331,  3051,  4388,
+     4591,   118,   790, -5542, -5860,  2842, -1177, -2881,
+    -2625, -4452, -1062,  5179,   722,  3584, -1000, -1696,
+     1351,  -953,  3201, -2731,  2545,  5791,  4611, -3289,
+     2975,   130, -3712, -4231,     1,  1673, -2963, -4632,
+     5023, -2197, -1170, -3459,  1212,    -9, -2768,  2089,
+     4821,  3949, -4805, -1759, -5736,  1381,    81,   334,
+     5777,  5767,  1326, -5911,  3542,  2468,  -140,  -729,
+    -3006, -2837, -2747,   355,  4043,  4989,  2366,  1260,
+    -5728,  2476,   955,   145, -3195,   480,  4255,  3284,
+      949,  2396,  2294,  3694, -1305,  4177, -4320, -1428,
+    -4978,  3748,  3014,  3932,  3621,  -544,  -726,  2013,
+    -3762,   605, -1858,  4467,   683,  1579,  -218,  -468,
+     3956,  3532, -5383, -1973,  2078,  4912, -1293, -3565,
+     -325, -4080, -3009, -5445,  4433, -3336,  6142, -1922,
+     1962,  4212,  1263,  5079,  -709,  5468,  5876,  4948,
+     -652, -4782,  2925,  -147,  2503,  -151, -3030,  5446,
+    -6122,  5009, -5369, -1041,   922,  3445, -5908,   -56,
+    -3728,  4624,  5868, -6118, -1747,  1323,  2051,  1359,
+     2692,   142,  5942,  4075,  -835, -2920,  3991,  5862,
+     4016,   504, -3315, -4749, -3656,  5906,  3434,   382,
+     6119,    58,   350, -1278, -4322,   192, -4774,  1702,
+      948, -3602,   723, -4536,  5257,  5874, -3963, -3998,
+     5961, -3438, -5915,  -522, -3150,  -787,  2031, -1728,
+     6099, -3029,  3757, -4449,  5782,  3957,  1843, -3710,
+    -1200,  -885, -4493, -5925,  4079,  4698,  3772, -5206,
+    -5990,  3263, -5735,  2683,  3054,  3174, -2882,  1254,
+    -4298, -3477, -1489, -4324,  3570,  4169,   156, -5415,
+     2919, -2302,  4754, -4789,  2459,   431, -2908, -3988,
+     1360,  1003,  1815, -5574,  1112,  2049,  4737,  -654,
+    -1404,  -421, -1693, -3860, -5919, -6055,  2447, -3879,
+     1594,  -975,    49,  3262, -4046,  1010,  2281,  6137,
+    -5766,  5886,   347,  3789,  2948, -2127,  4115,  5339,
+     2555, -1956, -2057, -3514,  -441, -4780,  -453,  3199,
+     4049, -6077,  2738, -3818, -3123,  2766, -1954, -5435,
+     -168,  1105,  1583,  5315, -6065, -5241,  3969, -6136,
+     4077, -4213,   426,  5537,   -64, -2505,  3529,  -316,
+     5297,  -241,  1512,  2344, -1958,  1321,  5429, -1987,
+     1146,  6068,   174,  1050, -3834,  -677,   576, -2033,
+     5106,  2844,  1483,  2169, -1319,  3482,  5333,   400,
+      295,  5594,  1975, -5456, -1566,  2839, -2361,  6093,
+    -5184,  6008,  3202, -1018, -1058,  5057,  -418,  5529,
+     1159, -3600, -2655, -1190, -5486,   -52,  1805,  -973,
+    -3329, -5681, -2500, -4916, -4240, -3127, -2767,  3643,
+};
+
+const int16_t ntt_red512_mixed_powers_rev[512] = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+    -3762,  2919,  4016,  4077,  -652, -5766,  6099,   295,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+     3956,  1360,  6119,  5297, -6122,  2555, -1200, -5184,
+     1962,  1594,  5961,  5106,  2692,  -168, -4298, -3329,
+      683,  2459, -3656,   -64,  2503,  2948,  5782, -1566,
+     4433, -5919,  5257, -3834, -1747, -3123,  3054, -5486,
+     2078,  1112, -4322, -1958,   922,  -441,  4079, -1058,
+     -709, -4046, -3150, -1319,  -835, -6065,  3570, -4240,
+    -1858,  4754, -3315,   426,  2925,   347,  3757,  1975,
+    -3009, -1693,   723,   174,  5868,  2738, -5735, -2655,
+    -5383,  1815,   350,  1512, -5369, -2057, -4493,  3202,
+     1263,    49, -5915,  1483,  5942,  1583, -1489, -2500,
+     -218, -2908,  3434,  3529, -3030,  4115,  1843, -2361,
+     6142,  2447, -3963,   576,  2051, -1954, -2882,  1805,
+    -1293,  4737, -4774,  5429, -5908,  -453,  3772,  -418,
+     5876,  2281,  2031,  5333,  3991,  3969,   156, -2767,
+      605, -2302,   504, -4213, -4782,  5886, -3029,  5594,
+    -4080,  -421, -3602,  6068,  4624, -6077,  3263, -3600,
+     3532,  1003,    58,  -241,  5009, -1956,  -885,  6008,
+     4212,  -975, -3438,  2844,   142,  1105, -3477, -5681,
+     1579,   431,  5906, -2505,  -151, -2127,  3957,  2839,
+    -3336, -6055,  5874,  -677,  1323,  2766,  3174,   -52,
+     4912,  2049,   192,  1321,  3445, -4780,  4698,  5057,
+     5468,  1010,  -787,  3482, -2920, -5241,  4169, -3127,
+     4467, -4789, -4749,  5537,  -147,  3789, -4449, -5456,
+    -5445, -3860, -4536,  1050, -6118, -3818,  2683, -1190,
+    -1973, -5574, -1278,  2344, -1041, -3514, -5925, -1018,
+     5079,  3262,  -522,  2169,  4075,  5315, -4324, -4916,
+     -468, -3988,   382,  -316,  5446,  5339, -3710,  6093,
+    -1922, -3879, -3998, -2033,  1359, -5435,  1254,  -973,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     4948,  6137, -1728,   400,  5862, -6136, -5415,  3643,
+};
+
+const int16_t ntt_red512_inv_mixed_powers[512] = {
+        0,  -493, -2381, -5444,  4337,  1378,   435,  1912,
+    -3248,  2143, -1168,  4645, -1207,  1065, -5277,  -404,
+     5088, -3646,  -875, -2566, -5011,  2987, -4976,  6039,
+    -4284, -2437,  3780, -2187,  1002, -6022, -1607,  2422,
+     2859,  1537,  1067,  3763,  -354,  3704, -3833,  1017,
+     2481, -4714, -2401, -3066, -2912,   545,  -773, -1632,
+    -1045,   242, -5101,  1440, -4861,  2678,  3778, -4885,
+     5012,  4143,  -442,   -27,  5698,  5019,   390,  5084,
+     2686, -4053,  3000, -2166,  3186, -4414,  3531,  5291,
+    -2370, -1484,  3136, -3149,  2249, -4057,  5559, -1777,
+    -2969, -2305,  3016,  -113,  1630, -4372, -4905, -4938,
+    -5332, -5195,  2399,  4437, -2884,  1689, -2178, -1426,
+    -3247, -2645,  -671, -3915, -5407,  2847,   476,  2704,
+     2865, -4895, -5191,  -160,  4048,  3271,  -420, -1663,
+     3978,  5042,   243, -4919, -2126,  2174,  3985,  3636,
+    -3510,  2780,  3400,     3,  1153, -3364,  1544, -4654,
+    -2013,   726,   544, -3621, -3932, -3014, -3748,  4978,
+     1428,  4320, -4177,  1305, -3694, -2294, -2396,  -949,
+    -3284, -4255,  -480,  3195,  -145,  -955, -2476,  5728,
+    -1260, -2366, -4989, -4043,  -355,  2747,  2837,  3006,
+      729,   140, -2468, -3542,  5911, -1326, -5767, -5777,
+     -334,   -81, -1381,  5736,  1759,  4805, -3949, -4821,
+    -2089,  2768,     9, -1212,  3459,  1170,  2197, -5023,
+     4632,  2963, -1673,    -1,  4231,  3712,  -130, -2975,
+     3289, -4611, -5791, -2545,  2731, -3201,   953, -1351,
+     1696,  1000, -3584,  -722, -5179,  1062,  4452,  2625,
+     2881,  1177, -2842,  5860,  5542,  -790,  -118, -4591,
+    -4388, -3051,  5331, -5146, -3382,  4846, -5374,  2744,
+     3241,  1853,   339,  3504, -4890, -5086,   827,  3328,
+     2426, -3091,  2525, -4134,  3707, -3553,  3296,  2639,
+     5092, -1635, -1022, -1646, -3637,  2319, -5067, -5828,
+    -5755,  4896,  4278,  1479, -2548,  3135, -4354,   563,
+    -3643,  2767,  3127,  4240,  4916,  2500,  5681,  3329,
+      973, -1805,    52,  5486,  1190,  2655,  3600, -1159,
+    -5529,   418, -5057,  1058,  1018, -3202, -6008,  5184,
+    -6093,  2361, -2839,  1566,  5456, -1975, -5594,  -295,
+     -400, -5333, -3482,  1319, -2169, -1483, -2844, -5106,
+     2033,  -576,   677,  3834, -1050,  -174, -6068, -1146,
+     1987, -5429, -1321,  1958, -2344, -1512,   241, -5297,
+      316, -3529,  2505,    64, -5537,  -426,  4213, -4077,
+     6136, -3969,  5241,  6065, -5315, -1583, -1105,   168,
+     5435,  1954, -2766,  3123,  3818, -2738,  6077, -4049,
+    -3199,   453,  4780,   441,  3514,  2057,  1956, -2555,
+    -5339, -4115,  2127, -2948, -3789,  -347, -5886,  5766,
+    -6137, -2281, -1010,  4046, -3262,   -49,   975, -1594,
+     3879, -2447,  6055,  5919,  3860,  1693,   421,  1404,
+      654, -4737, -2049, -1112,  5574, -1815, -1003, -1360,
+     3988,  2908,  -431, -2459,  4789, -4754,  2302, -2919,
+     5415,  -156, -4169, -3570,  4324,  1489,  3477,  4298,
+    -1254,  2882, -3174, -3054, -2683,  5735, -3263,  5990,
+     5206, -3772, -4698, -4079,  5925,  4493,   885,  1200,
+     3710, -1843, -3957, -5782,  4449, -3757,  3029, -6099,
+     1728, -2031,   787,  3150,   522,  5915,  3438, -5961,
+     3998,  3963, -5874, -5257,  4536,  -723,  3602,  -948,
+    -1702,  4774,  -192,  4322,  1278,  -350,   -58, -6119,
+     -382, -3434, -5906,  3656,  4749,  3315,  -504, -4016,
+    -5862, -3991,  2920,   835, -4075, -5942,  -142, -2692,
+    -1359, -2051, -1323,  1747,  6118, -5868, -4624,  3728,
+       56,  5908, -3445,  -922,  1041,  5369, -5009,  6122,
+    -5446,  3030,   151, -2503,   147, -2925,  4782,   652,
+    -4948, -5876, -5468,   709, -5079, -1263, -4212, -1962,
+     1922, -6142,  3336, -4433,  5445,  3009,  4080,   325,
+     3565,  1293, -4912, -2078,  1973,  5383, -3532, -3956,
+      468,   218, -1579,  -683, -4467,  1858,  -605,  3762,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_rev[512] = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+    -3643,  5415,  6136, -5862,  -400,  1728, -6137, -4948,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      973, -1254,  5435, -1359,  2033,  3998,  3879,  1922,
+    -6093,  3710, -5339, -5446,   316,  -382,  3988,   468,
+     4916,  4324, -5315, -4075, -2169,   522, -3262, -5079,
+     1018,  5925,  3514,  1041, -2344,  1278,  5574,  1973,
+     1190, -2683,  3818,  6118, -1050,  4536,  3860,  5445,
+     5456,  4449, -3789,   147, -5537,  4749,  4789, -4467,
+     3127, -4169,  5241,  2920, -3482,   787, -1010, -5468,
+    -5057, -4698,  4780, -3445, -1321,  -192, -2049, -4912,
+       52, -3174, -2766, -1323,   677, -5874,  6055,  3336,
+    -2839, -3957,  2127,   151,  2505, -5906,  -431, -1579,
+     5681,  3477, -1105,  -142, -2844,  3438,   975, -4212,
+    -6008,   885,  1956, -5009,   241,   -58, -1003, -3532,
+     3600, -3263,  6077, -4624, -6068,  3602,   421,  4080,
+    -5594,  3029, -5886,  4782,  4213,  -504,  2302,  -605,
+     2767,  -156, -3969, -3991, -5333, -2031, -2281, -5876,
+      418, -3772,   453,  5908, -5429,  4774, -4737,  1293,
+    -1805,  2882,  1954, -2051,  -576,  3963, -2447, -6142,
+     2361, -1843, -4115,  3030, -3529, -3434,  2908,   218,
+     2500,  1489, -1583, -5942, -1483,  5915,   -49, -1263,
+    -3202,  4493,  2057,  5369, -1512,  -350, -1815,  5383,
+     2655,  5735, -2738, -5868,  -174,  -723,  1693,  3009,
+    -1975, -3757,  -347, -2925,  -426,  3315, -4754,  1858,
+     4240, -3570,  6065,   835,  1319,  3150,  4046,   709,
+     1058, -4079,   441,  -922,  1958,  4322, -1112, -2078,
+     5486, -3054,  3123,  1747,  3834, -5257,  5919, -4433,
+     1566, -5782, -2948, -2503,    64,  3656, -2459,  -683,
+     3329,  4298,   168, -2692, -5106, -5961, -1594, -1962,
+     5184,  1200, -2555,  6122, -5297, -6119, -1360, -3956,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+     -295, -6099,  5766,   652, -4077, -4016, -2919,  3762,
+};
+
+const int16_t ntt_red512_omega_powers_ct_r4[512] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,  5444,
+    -1912, -1378,   493,  5444,  2381,  2381,  -435, -4337,
+    -4096, -4096,   493,   404, -2422, -6039, -1912,   404,
+    -4645,  5277,  1607,  4976,  5444, -1912, -1378, -1065,
+     6022, -2987,  -435,  5277,  1168,  1207, -1002,  5011,
+      493,  5444,  2381, -4645,  2187,  2566, -1378, -1065,
+    -2143,  1168, -3780,   875,  2381,  -435, -4337, -2143,
+     2437,  3646, -4337,  1207,  3248,  3248,  4284, -5088,
+    -4096, -4096,   493, -5084,  4654,  1426, -2422, -5084,
+     1632,  -390, -1544,  2178,   404, -2422, -6039, -5019,
+     3364, -1689,  1607,  -390,   773, -5698, -1153,  2884,
+    -1912,   404, -4645,    27,    -3, -4437,  6022, -5019,
+     -545,   442, -3400, -2399,  5277,  1607,  4976, -4143,
+    -2780,  5195, -1002, -5698,  2912, -5012,  3510,  5332,
+     5444, -1912, -1378,  4885, -3636,  4938,  2187,    27,
+     3066, -3778, -3985,  4905, -1065,  6022, -2987, -2678,
+    -2174,  4372, -3780,   442,  2401,  4861,  2126, -1630,
+     -435,  5277,  1168, -1440,  4919,   113,  2437, -4143,
+     4714,  5101,  -243, -3016,  1207, -1002,  5011,  -242,
+    -5042,  2305,  4284, -5012, -2481,  1045, -3978,  2969,
+      493,  5444,  2381,  1632,  1663,  1777, -6039,  4885,
+    -1017,   773,   420, -5559, -4645,  2187,  2566,  -545,
+    -3271,  4057,  4976, -3778,  3833,  2912, -4048, -2249,
+    -1378, -1065, -2143,  3066,   160,  3149, -2987, -2678,
+    -3704,  2401,  5191, -3136,  1168, -3780,   875,  4714,
+     4895,  1484,  5011,  4861,   354, -2481, -2865,  2370,
+     2381,  -435, -4337, -1017, -2704, -5291,  2566, -1440,
+    -3763,  3833,  -476, -3531, -2143,  2437,  3646, -3704,
+    -2847,  4414,   875,  5101, -1067,   354,  5407, -3186,
+    -4337,  1207,  3248, -3763,  3915,  2166,  3646,  -242,
+    -1537, -1067,   671, -3000,  3248,  4284, -5088, -1537,
+     2645,  4053, -5088,  1045, -2859, -2859,  3247, -2686,
+    -4096,  -563,  4654,  4354, -5084, -3135, -1544,  2548,
+    -2422, -1479,  3364, -4278,  -390, -4896, -1153,  5755,
+      404,  5828,    -3,  5067, -5019, -2319, -3400,  3637,
+     1607,  1646, -2780,  1022, -5698,  1635,  3510, -5092,
+    -1912, -2639, -3636, -3296,    27,  3553, -3985, -3707,
+     6022,  4134, -2174, -2525,   442,  3091,  2126, -2426,
+     5277, -3328,  4919,  -827, -4143,  5086,  -243,  4890,
+    -1002, -3504, -5042,  -339, -5012, -1853, -3978, -3241,
+     5444, -2744,  1663,  5374,  4885, -4846,   420,  3382,
+     2187,  5146, -3271, -5331, -3778,  3051, -4048,  4388,
+    -1065,  4591,   160,   118, -2678,   790,  5191, -5542,
+    -3780, -5860,  4895,  2842,  4861, -1177, -2865, -2881,
+     -435, -2625, -2704, -4452, -1440, -1062,  -476,  5179,
+     2437,   722, -2847,  3584,  5101, -1000,  5407, -1696,
+     1207,  1351,  3915,  -953,  -242,  3201,   671, -2731,
+     4284,  2545,  2645,  5791,  1045,  4611,  3247, -3289,
+      493,  2975,  1426,   130,  1632, -3712,  2178, -4231,
+    -6039,     1, -1689,  1673,   773, -2963,  2884, -4632,
+    -4645,  5023, -4437, -2197,  -545, -1170, -2399, -3459,
+     4976,  1212,  5195,    -9,  2912, -2768,  5332,  2089,
+    -1378,  4821,  4938,  3949,  3066, -4805,  4905, -1759,
+    -2987, -5736,  4372,  1381,  2401,    81, -1630,   334,
+     1168,  5777,   113,  5767,  4714,  1326, -3016, -5911,
+     5011,  3542,  2305,  2468, -2481,  -140,  2969,  -729,
+     2381, -3006,  1777, -2837, -1017, -2747, -5559,   355,
+     2566,  4043,  4057,  4989,  3833,  2366, -2249,  1260,
+    -2143, -5728,  3149,  2476, -3704,   955, -3136,   145,
+      875, -3195,  1484,   480,   354,  4255,  2370,  3284,
+    -4337,   949, -5291,  2396, -3763,  2294, -3531,  3694,
+     3646, -1305,  4414,  4177, -1067, -4320, -3186, -1428,
+     3248, -4978,  2166,  3748, -1537,  3014, -3000,  3932,
+    -5088,  3621,  4053,  -544, -2859,  -726, -2686,  2013,
+};
+
+const int16_t ntt_red512_omega_powers_gs_r4[512] = {
+        0, -4096,   493, -4096,  -563,  2975,  4654,  4654,
+     1426, -5084,  4354,   130, -1544, -5084,  1632, -2422,
+    -3135, -3712,  3364, -1544,  2178,  -390,  2548, -4231,
+    -1153, -2422, -6039,   404, -1479,     1,    -3,  3364,
+    -1689, -5019, -4278,  1673, -3400,  -390,   773,  1607,
+    -4896, -2963, -2780, -1153,  2884, -5698,  5755, -4632,
+     3510,   404, -4645, -1912,  5828,  5023, -3636,    -3,
+    -4437,    27,  5067, -2197, -3985, -5019,  -545,  6022,
+    -2319, -1170, -2174, -3400, -2399,   442,  3637, -3459,
+     2126,  1607,  4976,  5277,  1646,  1212,  4919, -2780,
+     5195, -4143,  1022,    -9,  -243, -5698,  2912, -1002,
+     1635, -2768, -5042,  3510,  5332, -5012, -5092,  2089,
+    -3978, -1912, -1378,  5444, -2639,  4821,  1663, -3636,
+     4938,  4885, -3296,  3949,   420,    27,  3066,  2187,
+     3553, -4805, -3271, -3985,  4905, -3778, -3707, -1759,
+    -4048,  6022, -2987, -1065,  4134, -5736,   160, -2174,
+     4372, -2678, -2525,  1381,  5191,   442,  2401, -3780,
+     3091,    81,  4895,  2126, -1630,  4861, -2426,   334,
+    -2865,  5277,  1168,  -435, -3328,  5777, -2704,  4919,
+      113, -1440,  -827,  5767,  -476, -4143,  4714,  2437,
+     5086,  1326, -2847,  -243, -3016,  5101,  4890, -5911,
+     5407, -1002,  5011,  1207, -3504,  3542,  3915, -5042,
+     2305,  -242,  -339,  2468,   671, -5012, -2481,  4284,
+    -1853,  -140,  2645, -3978,  2969,  1045, -3241,  -729,
+     3247,  5444,  2381,   493, -2744, -3006,  1426,  1663,
+     1777,  1632,  5374, -2837,  2178,  4885, -1017, -6039,
+    -4846, -2747, -1689,   420, -5559,   773,  3382,   355,
+     2884,  2187,  2566, -4645,  5146,  4043, -4437, -3271,
+     4057,  -545, -5331,  4989, -2399, -3778,  3833,  4976,
+     3051,  2366,  5195, -4048, -2249,  2912,  4388,  1260,
+     5332, -1065, -2143, -1378,  4591, -5728,  4938,   160,
+     3149,  3066,   118,  2476,  4905, -2678, -3704, -2987,
+      790,   955,  4372,  5191, -3136,  2401, -5542,   145,
+    -1630, -3780,   875,  1168, -5860, -3195,   113,  4895,
+     1484,  4714,  2842,   480, -3016,  4861,   354,  5011,
+    -1177,  4255,  2305, -2865,  2370, -2481, -2881,  3284,
+     2969,  -435, -4337,  2381, -2625,   949,  1777, -2704,
+    -5291, -1017, -4452,  2396, -5559, -1440, -3763,  2566,
+    -1062,  2294,  4057,  -476, -3531,  3833,  5179,  3694,
+    -2249,  2437,  3646, -2143,   722, -1305,  3149, -2847,
+     4414, -3704,  3584,  4177, -3136,  5101, -1067,   875,
+    -1000, -4320,  1484,  5407, -3186,   354, -1696, -1428,
+     2370,  1207,  3248, -4337,  1351, -4978, -5291,  3915,
+     2166, -3763,  -953,  3748, -3531,  -242, -1537,  3646,
+     3201,  3014,  4414,   671, -3000, -1067, -2731,  3932,
+    -3186,  4284, -5088,  3248,  2545,  3621,  2166,  2645,
+     4053, -1537,  5791,  -544, -3000,  1045, -2859, -5088,
+     4611,  -726,  4053,  3247, -2686, -2859, -3289,  2013,
+    -2686, -4096,   493, -4096, -5084,  1632, -2422, -2422,
+    -6039,   404,  -390,   773,  1607,   404, -4645, -1912,
+    -5019,  -545,  6022,  1607,  4976,  5277, -5698,  2912,
+    -1002, -1912, -1378,  5444,    27,  3066,  2187,  6022,
+    -2987, -1065,   442,  2401, -3780,  5277,  1168,  -435,
+    -4143,  4714,  2437, -1002,  5011,  1207, -5012, -2481,
+     4284,  5444,  2381,   493,  4885, -1017, -6039,  2187,
+     2566, -4645, -3778,  3833,  4976, -1065, -2143, -1378,
+    -2678, -3704, -2987, -3780,   875,  1168,  4861,   354,
+     5011,  -435, -4337,  2381, -1440, -3763,  2566,  2437,
+     3646, -2143,  5101, -1067,   875,  1207,  3248, -4337,
+     -242, -1537,  3646,  4284, -5088,  3248,  1045, -2859,
+    -5088, -4096,   493, -4096,   404, -4645, -1912, -1912,
+    -1378,  5444,  5277,  1168,  -435,  5444,  2381,   493,
+    -1065, -2143, -1378,  -435, -4337,  2381,  1207,  3248,
+    -4337, -4096,   493, -4096,  5444,  2381,   493, -4096,
+};
+
+const int16_t ntt_red512_omega_powers_rev_ct_r4[512] = {
+        0, -4096, -4096,   493, -4096, -4096,   493,   493,
+     5444,  2381,  5444, -1912, -1378,  2381,  -435, -4337,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,   404, -4645, -1378,
+    -1065, -2143,  -435,  5277,  1168, -4337,  1207,  3248,
+      404, -2422, -6039, -4645,  2187,  2566, -1065,  6022,
+    -2987, -2143,  2437,  3646,  5277,  1607,  4976,  1168,
+    -3780,   875,  1207, -1002,  5011,  3248,  4284, -5088,
+    -4096, -4096,   493,   493,  5444,  2381,  5444, -1912,
+    -1378,  2381,  -435, -4337, -1912,   404, -4645, -1378,
+    -1065, -2143,  -435,  5277,  1168, -4337,  1207,  3248,
+      404, -2422, -6039, -4645,  2187,  2566, -1065,  6022,
+    -2987, -2143,  2437,  3646,  5277,  1607,  4976,  1168,
+    -3780,   875,  1207, -1002,  5011,  3248,  4284, -5088,
+    -2422, -5084,  1632, -6039,  4885, -1017,  2187,    27,
+     3066,  2566, -1440, -3763,  6022, -5019,  -545, -2987,
+    -2678, -3704,  2437, -4143,  4714,  3646,  -242, -1537,
+     1607,  -390,   773,  4976, -3778,  3833, -3780,   442,
+     2401,   875,  5101, -1067, -1002, -5698,  2912,  5011,
+     4861,   354,  4284, -5012, -2481, -5088,  1045, -2859,
+    -5084,  4654,  1426,  1632,  1663,  1777,  4885, -3636,
+     4938, -1017, -2704, -5291,    27,    -3, -4437,  3066,
+      160,  3149, -1440,  4919,   113, -3763,  3915,  2166,
+    -5019,  3364, -1689,  -545, -3271,  4057, -2678, -2174,
+     4372, -3704, -2847,  4414, -4143, -2780,  5195,  4714,
+     4895,  1484,  -242, -5042,  2305, -1537,  2645,  4053,
+     -390, -1544,  2178,   773,   420, -5559, -3778, -3985,
+     4905,  3833,  -476, -3531,   442, -3400, -2399,  2401,
+     5191, -3136,  5101,  -243, -3016, -1067,   671, -3000,
+    -5698, -1153,  2884,  2912, -4048, -2249,  4861,  2126,
+    -1630,   354,  5407, -3186, -5012,  3510,  5332, -2481,
+    -2865,  2370,  1045, -3978,  2969, -2859,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+};
+
+const int16_t ntt_red512_omega_powers_rev_gs_r4[512] = {
+        0, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,   404, -4645, -1912,
+    -1065, -2143, -1378,  5277,  1168,  -435,  1207,  3248,
+    -4337, -2422, -6039,   404,  2187,  2566, -4645,  6022,
+    -2987, -1065,  2437,  3646, -2143,  1607,  4976,  5277,
+    -3780,   875,  1168, -1002,  5011,  1207,  4284, -5088,
+     3248, -5084,  1632, -2422,  4885, -1017, -6039,    27,
+     3066,  2187, -1440, -3763,  2566, -5019,  -545,  6022,
+    -2678, -3704, -2987, -4143,  4714,  2437,  -242, -1537,
+     3646,  -390,   773,  1607, -3778,  3833,  4976,   442,
+     2401, -3780,  5101, -1067,   875, -5698,  2912, -1002,
+     4861,   354,  5011, -5012, -2481,  4284,  1045, -2859,
+    -5088,  4654,  1426, -5084,  1663,  1777,  1632, -3636,
+     4938,  4885, -2704, -5291, -1017,    -3, -4437,    27,
+      160,  3149,  3066,  4919,   113, -1440,  3915,  2166,
+    -3763,  3364, -1689, -5019, -3271,  4057,  -545, -2174,
+     4372, -2678, -2847,  4414, -3704, -2780,  5195, -4143,
+     4895,  1484,  4714, -5042,  2305,  -242,  2645,  4053,
+    -1537, -1544,  2178,  -390,   420, -5559,   773, -3985,
+     4905, -3778,  -476, -3531,  3833, -3400, -2399,   442,
+     5191, -3136,  2401,  -243, -3016,  5101,   671, -3000,
+    -1067, -1153,  2884, -5698, -4048, -2249,  2912,  2126,
+    -1630,  4861,  5407, -3186,   354,  3510,  5332, -5012,
+    -2865,  2370, -2481, -3978,  2969,  1045,  3247, -2686,
+    -2859,  -563,  2975,  4654, -2744, -3006,  1426, -2639,
+     4821,  1663, -2625,   949,  1777,  5828,  5023, -3636,
+     4591, -5728,  4938, -3328,  5777, -2704,  1351, -4978,
+    -5291, -1479,     1,    -3,  5146,  4043, -4437,  4134,
+    -5736,   160,   722, -1305,  3149,  1646,  1212,  4919,
+    -5860, -3195,   113, -3504,  3542,  3915,  2545,  3621,
+     2166, -3135, -3712,  3364, -4846, -2747, -1689,  3553,
+    -4805, -3271, -1062,  2294,  4057, -2319, -1170, -2174,
+      790,   955,  4372,  5086,  1326, -2847,  3201,  3014,
+     4414, -4896, -2963, -2780,  3051,  2366,  5195,  3091,
+       81,  4895, -1000, -4320,  1484,  1635, -2768, -5042,
+    -1177,  4255,  2305, -1853,  -140,  2645,  4611,  -726,
+     4053,  4354,   130, -1544,  5374, -2837,  2178, -3296,
+     3949,   420, -4452,  2396, -5559,  5067, -2197, -3985,
+      118,  2476,  4905,  -827,  5767,  -476,  -953,  3748,
+    -3531, -4278,  1673, -3400, -5331,  4989, -2399, -2525,
+     1381,  5191,  3584,  4177, -3136,  1022,    -9,  -243,
+     2842,   480, -3016,  -339,  2468,   671,  5791,  -544,
+    -3000,  2548, -4231, -1153,  3382,   355,  2884, -3707,
+    -1759, -4048,  5179,  3694, -2249,  3637, -3459,  2126,
+    -5542,   145, -1630,  4890, -5911,  5407, -2731,  3932,
+    -3186,  5755, -4632,  3510,  4388,  1260,  5332, -2426,
+      334, -2865, -1696, -1428,  2370, -5092,  2089, -3978,
+    -2881,  3284,  2969, -3241,  -729,  3247, -3289,  2013,
+    -2686, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,   404, -4645, -1912,
+    -1065, -2143, -1378,  5277,  1168,  -435,  1207,  3248,
+    -4337, -2422, -6039,   404,  2187,  2566, -4645,  6022,
+    -2987, -1065,  2437,  3646, -2143,  1607,  4976,  5277,
+    -3780,   875,  1168, -1002,  5011,  1207,  4284, -5088,
+     3248, -5084,  1632, -2422,  4885, -1017, -6039,    27,
+     3066,  2187, -1440, -3763,  2566, -5019,  -545,  6022,
+    -2678, -3704, -2987, -4143,  4714,  2437,  -242, -1537,
+     3646,  -390,   773,  1607, -3778,  3833,  4976,   442,
+     2401, -3780,  5101, -1067,   875, -5698,  2912, -1002,
+     4861,   354,  5011, -5012, -2481,  4284,  1045, -2859,
+    -5088, -4096,   493, -4096,  5444,  2381,   493, -1912,
+    -1378,  5444,  -435, -4337,  2381,   404, -4645, -1912,
+    -1065, -2143, -1378,  5277,  1168,  -435,  1207,  3248,
+    -4337, -4096,   493, -4096,  5444,  2381,   493, -4096,
+};
+
+const int16_t ntt_red512_inv_omega_powers_ct_r4[512] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493, -2381,
+     4337,   435,  -493, -2381, -5444, -5444,  1378,  1912,
+    -4096, -4096,  -493, -3248,  5088, -4284,  4337, -3248,
+    -1207,  2143, -3646, -2437, -2381,  4337,   435, -1168,
+     -875,  3780,  1378,  2143,  1065,  4645, -2566, -2187,
+     -493, -2381, -5444, -1207, -5011,  1002,   435, -1168,
+    -5277,  1065,  2987, -6022, -5444,  1378,  1912, -5277,
+    -4976, -1607,  1912,  4645,  -404,  -404,  6039,  2422,
+    -4096, -4096,  -493,  2859,  2686, -3247,  5088,  2859,
+    -1045,  1537, -4053, -2645, -3248,  5088, -4284,  1067,
+     3000,  -671, -3646,  1537,   242,  3763, -2166, -3915,
+     4337, -3248, -1207,  -354,  3186, -5407,  -875,  1067,
+    -5101,  3704, -4414,  2847,  2143, -3646, -2437, -3833,
+     3531,   476, -2566,  3763,  1440,  1017,  5291,  2704,
+    -2381,  4337,   435,  2481, -2370,  2865, -5011,  -354,
+    -4861, -4714, -1484, -4895, -1168,  -875,  3780, -2401,
+     3136, -5191,  2987,  3704,  2678, -3066, -3149,  -160,
+     1378,  2143,  1065, -2912,  2249,  4048, -4976, -3833,
+     3778,   545, -4057,  3271,  4645, -2566, -2187,  -773,
+     5559,  -420,  6039,  1017, -4885, -1632, -1777, -1663,
+     -493, -2381, -5444, -1045, -2969,  3978, -4284,  2481,
+     5012,   242, -2305,  5042, -1207, -5011,  1002, -5101,
+     3016,   243, -2437, -4714,  4143,  1440,  -113, -4919,
+      435, -1168, -5277, -4861,  1630, -2126,  3780, -2401,
+     -442,  2678, -4372,  2174,  1065,  2987, -6022,  3778,
+    -4905,  3985, -2187, -3066,   -27, -4885, -4938,  3636,
+    -5444,  1378,  1912,  5012, -5332, -3510,  1002, -2912,
+     5698,  4143, -5195,  2780, -5277, -4976, -1607,  -442,
+     2399,  3400, -6022,   545,  5019,   -27,  4437,     3,
+     1912,  4645,  -404,  5698, -2884,  1153, -1607,  -773,
+      390,  5019,  1689, -3364,  -404,  6039,  2422,   390,
+    -2178,  1544,  2422, -1632,  5084,  5084, -1426, -4654,
+    -4096, -2013,  2686,   726,  2859,   544, -4053, -3621,
+     5088, -3932,  3000, -3014,  1537, -3748, -2166,  4978,
+    -3248,  1428,  3186,  4320,  1067, -4177, -4414,  1305,
+    -3646, -3694,  3531, -2294,  3763, -2396,  5291,  -949,
+     4337, -3284, -2370, -4255,  -354,  -480, -1484,  3195,
+     -875,  -145,  3136,  -955,  3704, -2476, -3149,  5728,
+     2143, -1260,  2249, -2366, -3833, -4989, -4057, -4043,
+    -2566,  -355,  5559,  2747,  1017,  2837, -1777,  3006,
+    -2381,   729, -2969,   140,  2481, -2468, -2305, -3542,
+    -5011,  5911,  3016, -1326, -4714, -5767,  -113, -5777,
+    -1168,  -334,  1630,   -81, -2401, -1381, -4372,  5736,
+     2987,  1759, -4905,  4805, -3066, -3949, -4938, -4821,
+     1378, -2089, -5332,  2768, -2912,     9, -5195, -1212,
+    -4976,  3459,  2399,  1170,   545,  2197,  4437, -5023,
+     4645,  4632, -2884,  2963,  -773, -1673,  1689,    -1,
+     6039,  4231, -2178,  3712, -1632,  -130, -1426, -2975,
+     -493,  3289, -3247, -4611, -1045, -5791, -2645, -2545,
+    -4284,  2731,  -671, -3201,   242,   953, -3915, -1351,
+    -1207,  1696, -5407,  1000, -5101, -3584,  2847,  -722,
+    -2437, -5179,   476,  1062,  1440,  4452,  2704,  2625,
+      435,  2881,  2865,  1177, -4861, -2842, -4895,  5860,
+     3780,  5542, -5191,  -790,  2678,  -118,  -160, -4591,
+     1065, -4388,  4048, -3051,  3778,  5331,  3271, -5146,
+    -2187, -3382,  -420,  4846, -4885, -5374, -1663,  2744,
+    -5444,  3241,  3978,  1853,  5012,   339,  5042,  3504,
+     1002, -4890,   243, -5086,  4143,   827, -4919,  3328,
+    -5277,  2426, -2126, -3091,  -442,  2525,  2174, -4134,
+    -6022,  3707,  3985, -3553,   -27,  3296,  3636,  2639,
+     1912,  5092, -3510, -1635,  5698, -1022,  2780, -1646,
+    -1607, -3637,  3400,  2319,  5019, -5067,     3, -5828,
+     -404, -5755,  1153,  4896,   390,  4278, -3364,  1479,
+     2422, -2548,  1544,  3135,  5084, -4354, -4654,   563,
+};
+
+const int16_t ntt_red512_inv_omega_powers_gs_r4[512] = {
+        0, -4096,  -493, -4096, -2013,  3289,  2686,  2686,
+    -3247,  2859,   726, -4611, -4053,  2859, -1045,  5088,
+      544, -5791,  3000, -4053, -2645,  1537, -3621, -2545,
+    -2166,  5088, -4284, -3248, -3932,  2731,  3186,  3000,
+     -671,  1067, -3014, -3201, -4414,  1537,   242, -3646,
+    -3748,   953,  3531, -2166, -3915,  3763,  4978, -1351,
+     5291, -3248, -1207,  4337,  1428,  1696, -2370,  3186,
+    -5407,  -354,  4320,  1000, -1484,  1067, -5101,  -875,
+    -4177, -3584,  3136, -4414,  2847,  3704,  1305,  -722,
+    -3149, -3646, -2437,  2143, -3694, -5179,  2249,  3531,
+      476, -3833, -2294,  1062, -4057,  3763,  1440, -2566,
+    -2396,  4452,  5559,  5291,  2704,  1017,  -949,  2625,
+    -1777,  4337,   435, -2381, -3284,  2881, -2969, -2370,
+     2865,  2481, -4255,  1177, -2305,  -354, -4861, -5011,
+     -480, -2842,  3016, -1484, -4895, -4714,  3195,  5860,
+     -113,  -875,  3780, -1168,  -145,  5542,  1630,  3136,
+    -5191, -2401,  -955,  -790, -4372,  3704,  2678,  2987,
+    -2476,  -118, -4905, -3149,  -160, -3066,  5728, -4591,
+    -4938,  2143,  1065,  1378, -1260, -4388, -5332,  2249,
+     4048, -2912, -2366, -3051, -5195, -3833,  3778, -4976,
+    -4989,  5331,  2399, -4057,  3271,   545, -4043, -5146,
+     4437, -2566, -2187,  4645,  -355, -3382, -2884,  5559,
+     -420,  -773,  2747,  4846,  1689,  1017, -4885,  6039,
+     2837, -5374, -2178, -1777, -1663, -1632,  3006,  2744,
+    -1426, -2381, -5444,  -493,   729,  3241, -3247, -2969,
+     3978, -1045,   140,  1853, -2645,  2481,  5012, -4284,
+    -2468,   339,  -671, -2305,  5042,   242, -3542,  3504,
+    -3915, -5011,  1002, -1207,  5911, -4890, -5407,  3016,
+      243, -5101, -1326, -5086,  2847, -4714,  4143, -2437,
+    -5767,   827,   476,  -113, -4919,  1440, -5777,  3328,
+     2704, -1168, -5277,   435,  -334,  2426,  2865,  1630,
+    -2126, -4861,   -81, -3091, -4895, -2401,  -442,  3780,
+    -1381,  2525, -5191, -4372,  2174,  2678,  5736, -4134,
+     -160,  2987, -6022,  1065,  1759,  3707,  4048, -4905,
+     3985,  3778,  4805, -3553,  3271, -3066,   -27, -2187,
+    -3949,  3296,  -420, -4938,  3636, -4885, -4821,  2639,
+    -1663,  1378,  1912, -5444, -2089,  5092,  3978, -5332,
+    -3510,  5012,  2768, -1635,  5042, -2912,  5698,  1002,
+        9, -1022,   243, -5195,  2780,  4143, -1212, -1646,
+    -4919, -4976, -1607, -5277,  3459, -3637, -2126,  2399,
+     3400,  -442,  1170,  2319,  2174,   545,  5019, -6022,
+     2197, -5067,  3985,  4437,     3,   -27, -5023, -5828,
+     3636,  4645,  -404,  1912,  4632, -5755, -3510, -2884,
+     1153,  5698,  2963,  4896,  2780,  -773,   390, -1607,
+    -1673,  4278,  3400,  1689, -3364,  5019,    -1,  1479,
+        3,  6039,  2422,  -404,  4231, -2548,  1153, -2178,
+     1544,   390,  3712,  3135, -3364, -1632,  5084,  2422,
+     -130, -4354,  1544, -1426, -4654,  5084, -2975,   563,
+    -4654, -4096,  -493, -4096,  2859, -1045,  5088,  5088,
+    -4284, -3248,  1537,   242, -3646, -3248, -1207,  4337,
+     1067, -5101,  -875, -3646, -2437,  2143,  3763,  1440,
+    -2566,  4337,   435, -2381,  -354, -4861, -5011,  -875,
+     3780, -1168,  3704,  2678,  2987,  2143,  1065,  1378,
+    -3833,  3778, -4976, -2566, -2187,  4645,  1017, -4885,
+     6039, -2381, -5444,  -493,  2481,  5012, -4284, -5011,
+     1002, -1207, -4714,  4143, -2437, -1168, -5277,   435,
+    -2401,  -442,  3780,  2987, -6022,  1065, -3066,   -27,
+    -2187,  1378,  1912, -5444, -2912,  5698,  1002, -4976,
+    -1607, -5277,   545,  5019, -6022,  4645,  -404,  1912,
+     -773,   390, -1607,  6039,  2422,  -404, -1632,  5084,
+     2422, -4096,  -493, -4096, -3248, -1207,  4337,  4337,
+      435, -2381,  2143,  1065,  1378, -2381, -5444,  -493,
+    -1168, -5277,   435,  1378,  1912, -5444,  4645,  -404,
+     1912, -4096,  -493, -4096, -2381, -5444,  -493, -4096,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev_ct_r4[512] = {
+        0, -4096, -4096,  -493, -4096, -4096,  -493,  -493,
+    -2381, -5444, -2381,  4337,   435, -5444,  1378,  1912,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337, -3248, -1207,   435,
+    -1168, -5277,  1378,  2143,  1065,  1912,  4645,  -404,
+    -3248,  5088, -4284, -1207, -5011,  1002, -1168,  -875,
+     3780, -5277, -4976, -1607,  2143, -3646, -2437,  1065,
+     2987, -6022,  4645, -2566, -2187,  -404,  6039,  2422,
+    -4096, -4096,  -493,  -493, -2381, -5444, -2381,  4337,
+      435, -5444,  1378,  1912,  4337, -3248, -1207,   435,
+    -1168, -5277,  1378,  2143,  1065,  1912,  4645,  -404,
+    -3248,  5088, -4284, -1207, -5011,  1002, -1168,  -875,
+     3780, -5277, -4976, -1607,  2143, -3646, -2437,  1065,
+     2987, -6022,  4645, -2566, -2187,  -404,  6039,  2422,
+     5088,  2859, -1045, -4284,  2481,  5012, -5011,  -354,
+    -4861,  1002, -2912,  5698,  -875,  1067, -5101,  3780,
+    -2401,  -442, -4976, -3833,  3778, -1607,  -773,   390,
+    -3646,  1537,   242, -2437, -4714,  4143,  2987,  3704,
+     2678, -6022,   545,  5019, -2566,  3763,  1440, -2187,
+    -3066,   -27,  6039,  1017, -4885,  2422, -1632,  5084,
+     2859,  2686, -3247, -1045, -2969,  3978,  2481, -2370,
+     2865,  5012, -5332, -3510,  -354,  3186, -5407, -4861,
+     1630, -2126, -2912,  2249,  4048,  5698, -2884,  1153,
+     1067,  3000,  -671, -5101,  3016,   243, -2401,  3136,
+    -5191,  -442,  2399,  3400, -3833,  3531,   476,  3778,
+    -4905,  3985,  -773,  5559,  -420,   390, -2178,  1544,
+     1537, -4053, -2645,   242, -2305,  5042, -4714, -1484,
+    -4895,  4143, -5195,  2780,  3704, -4414,  2847,  2678,
+    -4372,  2174,   545, -4057,  3271,  5019,  1689, -3364,
+     3763, -2166, -3915,  1440,  -113, -4919, -3066, -3149,
+     -160,   -27,  4437,     3,  1017,  5291,  2704, -4885,
+    -4938,  3636, -1632, -1777, -1663,  5084, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev_gs_r4[512] = {
+        0, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -3248, -1207,  4337,
+    -1168, -5277,   435,  2143,  1065,  1378,  4645,  -404,
+     1912,  5088, -4284, -3248, -5011,  1002, -1207,  -875,
+     3780, -1168, -4976, -1607, -5277, -3646, -2437,  2143,
+     2987, -6022,  1065, -2566, -2187,  4645,  6039,  2422,
+     -404,  2859, -1045,  5088,  2481,  5012, -4284,  -354,
+    -4861, -5011, -2912,  5698,  1002,  1067, -5101,  -875,
+    -2401,  -442,  3780, -3833,  3778, -4976,  -773,   390,
+    -1607,  1537,   242, -3646, -4714,  4143, -2437,  3704,
+     2678,  2987,   545,  5019, -6022,  3763,  1440, -2566,
+    -3066,   -27, -2187,  1017, -4885,  6039, -1632,  5084,
+     2422,  2686, -3247,  2859, -2969,  3978, -1045, -2370,
+     2865,  2481, -5332, -3510,  5012,  3186, -5407,  -354,
+     1630, -2126, -4861,  2249,  4048, -2912, -2884,  1153,
+     5698,  3000,  -671,  1067,  3016,   243, -5101,  3136,
+    -5191, -2401,  2399,  3400,  -442,  3531,   476, -3833,
+    -4905,  3985,  3778,  5559,  -420,  -773, -2178,  1544,
+      390, -4053, -2645,  1537, -2305,  5042,   242, -1484,
+    -4895, -4714, -5195,  2780,  4143, -4414,  2847,  3704,
+    -4372,  2174,  2678, -4057,  3271,   545,  1689, -3364,
+     5019, -2166, -3915,  3763,  -113, -4919,  1440, -3149,
+     -160, -3066,  4437,     3,   -27,  5291,  2704,  1017,
+    -4938,  3636, -4885, -1777, -1663, -1632, -1426, -4654,
+     5084, -2013,  3289,  2686,   729,  3241, -3247, -3284,
+     2881, -2969, -2089,  5092,  3978,  1428,  1696, -2370,
+     -334,  2426,  2865, -1260, -4388, -5332,  4632, -5755,
+    -3510, -3932,  2731,  3186,  5911, -4890, -5407,  -145,
+     5542,  1630,  3459, -3637, -2126, -3694, -5179,  2249,
+     1759,  3707,  4048,  -355, -3382, -2884,  4231, -2548,
+     1153,   544, -5791,  3000, -2468,   339,  -671,  -480,
+    -2842,  3016,     9, -1022,   243, -4177, -3584,  3136,
+    -1381,  2525, -5191, -4989,  5331,  2399, -1673,  4278,
+     3400, -3748,   953,  3531, -5767,   827,   476, -2476,
+     -118, -4905,  2197, -5067,  3985, -2396,  4452,  5559,
+    -3949,  3296,  -420,  2837, -5374, -2178,  -130, -4354,
+     1544,   726, -4611, -4053,   140,  1853, -2645, -4255,
+     1177, -2305,  2768, -1635,  5042,  4320,  1000, -1484,
+      -81, -3091, -4895, -2366, -3051, -5195,  2963,  4896,
+     2780, -3014, -3201, -4414, -1326, -5086,  2847,  -955,
+     -790, -4372,  1170,  2319,  2174, -2294,  1062, -4057,
+     4805, -3553,  3271,  2747,  4846,  1689,  3712,  3135,
+    -3364, -3621, -2545, -2166, -3542,  3504, -3915,  3195,
+     5860,  -113, -1212, -1646, -4919,  1305,  -722, -3149,
+     5736, -4134,  -160, -4043, -5146,  4437,    -1,  1479,
+        3,  4978, -1351,  5291, -5777,  3328,  2704,  5728,
+    -4591, -4938, -5023, -5828,  3636,  -949,  2625, -1777,
+    -4821,  2639, -1663,  3006,  2744, -1426, -2975,   563,
+    -4654, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -3248, -1207,  4337,
+    -1168, -5277,   435,  2143,  1065,  1378,  4645,  -404,
+     1912,  5088, -4284, -3248, -5011,  1002, -1207,  -875,
+     3780, -1168, -4976, -1607, -5277, -3646, -2437,  2143,
+     2987, -6022,  1065, -2566, -2187,  4645,  6039,  2422,
+     -404,  2859, -1045,  5088,  2481,  5012, -4284,  -354,
+    -4861, -5011, -2912,  5698,  1002,  1067, -5101,  -875,
+    -2401,  -442,  3780, -3833,  3778, -4976,  -773,   390,
+    -1607,  1537,   242, -3646, -4714,  4143, -2437,  3704,
+     2678,  2987,   545,  5019, -6022,  3763,  1440, -2566,
+    -3066,   -27, -2187,  1017, -4885,  6039, -1632,  5084,
+     2422, -4096,  -493, -4096, -2381, -5444,  -493,  4337,
+      435, -2381,  1378,  1912, -5444, -3248, -1207,  4337,
+    -1168, -5277,   435,  2143,  1065,  1378,  4645,  -404,
+     1912, -4096,  -493, -4096, -2381, -5444,  -493, -4096,
+};
+
+const int16_t ntt_red512_mixed_powers_ct_r4[512] = {
+        0,   493,  5444,  2381, -1912,   404, -4645,  -435,
+     5277,  1168, -1378, -1065, -2143, -4337,  1207,  3248,
+    -2422, -5084,  1632,  1607,  -390,   773,  6022, -5019,
+     -545, -1002, -5698,  2912,  2187,    27,  3066, -3780,
+      442,  2401,  2437, -4143,  4714,  4284, -5012, -2481,
+    -6039,  4885, -1017,  4976, -3778,  3833, -2987, -2678,
+    -3704,  5011,  4861,   354,  2566, -1440, -3763,   875,
+     5101, -1067,  3646,  -242, -1537, -5088,  1045, -2859,
+     4654,  -563,  2975, -1544,  4354,   130,  3364, -3135,
+    -3712, -1153,  2548, -4231,    -3, -1479,     1, -3400,
+    -4278,  1673, -2780, -4896, -2963,  3510,  5755, -4632,
+    -3636,  5828,  5023, -3985,  5067, -2197, -2174, -2319,
+    -1170,  2126,  3637, -3459,  4919,  1646,  1212,  -243,
+     1022,    -9, -5042,  1635, -2768, -3978, -5092,  2089,
+     1663, -2639,  4821,   420, -3296,  3949, -3271,  3553,
+    -4805, -4048, -3707, -1759,   160,  4134, -5736,  5191,
+    -2525,  1381,  4895,  3091,    81, -2865, -2426,   334,
+    -2704, -3328,  5777,  -476,  -827,  5767, -2847,  5086,
+     1326,  5407,  4890, -5911,  3915, -3504,  3542,   671,
+     -339,  2468,  2645, -1853,  -140,  3247, -3241,  -729,
+     1426, -2744, -3006,  2178,  5374, -2837, -1689, -4846,
+    -2747,  2884,  3382,   355, -4437,  5146,  4043, -2399,
+    -5331,  4989,  5195,  3051,  2366,  5332,  4388,  1260,
+     4938,  4591, -5728,  4905,   118,  2476,  4372,   790,
+      955, -1630, -5542,   145,   113, -5860, -3195, -3016,
+     2842,   480,  2305, -1177,  4255,  2969, -2881,  3284,
+     1777, -2625,   949, -5559, -4452,  2396,  4057, -1062,
+     2294, -2249,  5179,  3694,  3149,   722, -1305, -3136,
+     3584,  4177,  1484, -1000, -4320,  2370, -1696, -1428,
+    -5291,  1351, -4978, -3531,  -953,  3748,  4414,  3201,
+     3014, -3186, -2731,  3932,  2166,  2545,  3621, -3000,
+     5791,  -544,  4053,  4611,  -726, -2686, -3289,  2013,
+    -3762,   605, -1858,  4467,   683,  1579,  -218,  -468,
+     3956,  3532, -5383, -1973,  2078,  4912, -1293, -3565,
+     -325, -4080, -3009, -5445,  4433, -3336,  6142, -1922,
+     1962,  4212,  1263,  5079,  -709,  5468,  5876,  4948,
+     -652, -4782,  2925,  -147,  2503,  -151, -3030,  5446,
+    -6122,  5009, -5369, -1041,   922,  3445, -5908,   -56,
+    -3728,  4624,  5868, -6118, -1747,  1323,  2051,  1359,
+     2692,   142,  5942,  4075,  -835, -2920,  3991,  5862,
+     4016,   504, -3315, -4749, -3656,  5906,  3434,   382,
+     6119,    58,   350, -1278, -4322,   192, -4774,  1702,
+      948, -3602,   723, -4536,  5257,  5874, -3963, -3998,
+     5961, -3438, -5915,  -522, -3150,  -787,  2031, -1728,
+     6099, -3029,  3757, -4449,  5782,  3957,  1843, -3710,
+    -1200,  -885, -4493, -5925,  4079,  4698,  3772, -5206,
+    -5990,  3263, -5735,  2683,  3054,  3174, -2882,  1254,
+    -4298, -3477, -1489, -4324,  3570,  4169,   156, -5415,
+     2919, -2302,  4754, -4789,  2459,   431, -2908, -3988,
+     1360,  1003,  1815, -5574,  1112,  2049,  4737,  -654,
+    -1404,  -421, -1693, -3860, -5919, -6055,  2447, -3879,
+     1594,  -975,    49,  3262, -4046,  1010,  2281,  6137,
+    -5766,  5886,   347,  3789,  2948, -2127,  4115,  5339,
+     2555, -1956, -2057, -3514,  -441, -4780,  -453,  3199,
+     4049, -6077,  2738, -3818, -3123,  2766, -1954, -5435,
+     -168,  1105,  1583,  5315, -6065, -5241,  3969, -6136,
+     4077, -4213,   426,  5537,   -64, -2505,  3529,  -316,
+     5297,  -241,  1512,  2344, -1958,  1321,  5429, -1987,
+     1146,  6068,   174,  1050, -3834,  -677,   576, -2033,
+     5106,  2844,  1483,  2169, -1319,  3482,  5333,   400,
+      295,  5594,  1975, -5456, -1566,  2839, -2361,  6093,
+    -5184,  6008,  3202, -1018, -1058,  5057,  -418,  5529,
+     1159, -3600, -2655, -1190, -5486,   -52,  1805,  -973,
+    -3329, -5681, -2500, -4916, -4240, -3127, -2767,  3643,
+};
+
+const int16_t ntt_red512_mixed_powers_rev_ct_r4[512] = {
+        0,   493,  5444,  2381, -1912,   404, -4645, -1378,
+    -1065, -2143,  -435,  5277,  1168, -4337,  1207,  3248,
+    -2422, -5084,  1632, -6039,  4885, -1017,  2187,    27,
+     3066,  2566, -1440, -3763,  6022, -5019,  -545, -2987,
+    -2678, -3704,  2437, -4143,  4714,  3646,  -242, -1537,
+     1607,  -390,   773,  4976, -3778,  3833, -3780,   442,
+     2401,   875,  5101, -1067, -1002, -5698,  2912,  5011,
+     4861,   354,  4284, -5012, -2481, -5088,  1045, -2859,
+     4654,  -563,  2975,  1426, -2744, -3006,  1663, -2639,
+     4821,  1777, -2625,   949, -3636,  5828,  5023,  4938,
+     4591, -5728, -2704, -3328,  5777, -5291,  1351, -4978,
+       -3, -1479,     1, -4437,  5146,  4043,   160,  4134,
+    -5736,  3149,   722, -1305,  4919,  1646,  1212,   113,
+    -5860, -3195,  3915, -3504,  3542,  2166,  2545,  3621,
+     3364, -3135, -3712, -1689, -4846, -2747, -3271,  3553,
+    -4805,  4057, -1062,  2294, -2174, -2319, -1170,  4372,
+      790,   955, -2847,  5086,  1326,  4414,  3201,  3014,
+    -2780, -4896, -2963,  5195,  3051,  2366,  4895,  3091,
+       81,  1484, -1000, -4320, -5042,  1635, -2768,  2305,
+    -1177,  4255,  2645, -1853,  -140,  4053,  4611,  -726,
+    -1544,  4354,   130,  2178,  5374, -2837,   420, -3296,
+     3949, -5559, -4452,  2396, -3985,  5067, -2197,  4905,
+      118,  2476,  -476,  -827,  5767, -3531,  -953,  3748,
+    -3400, -4278,  1673, -2399, -5331,  4989,  5191, -2525,
+     1381, -3136,  3584,  4177,  -243,  1022,    -9, -3016,
+     2842,   480,   671,  -339,  2468, -3000,  5791,  -544,
+    -1153,  2548, -4231,  2884,  3382,   355, -4048, -3707,
+    -1759, -2249,  5179,  3694,  2126,  3637, -3459, -1630,
+    -5542,   145,  5407,  4890, -5911, -3186, -2731,  3932,
+     3510,  5755, -4632,  5332,  4388,  1260, -2865, -2426,
+      334,  2370, -1696, -1428, -3978, -5092,  2089,  2969,
+    -2881,  3284,  3247, -3241,  -729, -2686, -3289,  2013,
+    -3762,  2919,  4016,  4077,  -652, -5766,  6099,   295,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+     3956,  1360,  6119,  5297, -6122,  2555, -1200, -5184,
+     1962,  1594,  5961,  5106,  2692,  -168, -4298, -3329,
+      683,  2459, -3656,   -64,  2503,  2948,  5782, -1566,
+     4433, -5919,  5257, -3834, -1747, -3123,  3054, -5486,
+     2078,  1112, -4322, -1958,   922,  -441,  4079, -1058,
+     -709, -4046, -3150, -1319,  -835, -6065,  3570, -4240,
+    -1858,  4754, -3315,   426,  2925,   347,  3757,  1975,
+    -3009, -1693,   723,   174,  5868,  2738, -5735, -2655,
+    -5383,  1815,   350,  1512, -5369, -2057, -4493,  3202,
+     1263,    49, -5915,  1483,  5942,  1583, -1489, -2500,
+     -218, -2908,  3434,  3529, -3030,  4115,  1843, -2361,
+     6142,  2447, -3963,   576,  2051, -1954, -2882,  1805,
+    -1293,  4737, -4774,  5429, -5908,  -453,  3772,  -418,
+     5876,  2281,  2031,  5333,  3991,  3969,   156, -2767,
+      605, -2302,   504, -4213, -4782,  5886, -3029,  5594,
+    -4080,  -421, -3602,  6068,  4624, -6077,  3263, -3600,
+     3532,  1003,    58,  -241,  5009, -1956,  -885,  6008,
+     4212,  -975, -3438,  2844,   142,  1105, -3477, -5681,
+     1579,   431,  5906, -2505,  -151, -2127,  3957,  2839,
+    -3336, -6055,  5874,  -677,  1323,  2766,  3174,   -52,
+     4912,  2049,   192,  1321,  3445, -4780,  4698,  5057,
+     5468,  1010,  -787,  3482, -2920, -5241,  4169, -3127,
+     4467, -4789, -4749,  5537,  -147,  3789, -4449, -5456,
+    -5445, -3860, -4536,  1050, -6118, -3818,  2683, -1190,
+    -1973, -5574, -1278,  2344, -1041, -3514, -5925, -1018,
+     5079,  3262,  -522,  2169,  4075,  5315, -4324, -4916,
+     -468, -3988,   382,  -316,  5446,  5339, -3710,  6093,
+    -1922, -3879, -3998, -2033,  1359, -5435,  1254,  -973,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     4948,  6137, -1728,   400,  5862, -6136, -5415,  3643,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_gs_r4[512] = {
+        0, -3643,  5415, -2013,  2767,  -156,   726,  3127,
+    -4169,   544,  4240, -3570, -3621,  4916,  4324, -3932,
+     2500,  1489, -3014,  5681,  3477, -3748,  3329,  4298,
+     4978,   973, -1254,  1428, -1805,  2882,  4320,    52,
+    -3174, -4177,  5486, -3054,  1305,  1190, -2683, -3694,
+     2655,  5735, -2294,  3600, -3263, -2396, -1159,  5990,
+     -949, -5529,  5206, -3284,   418, -3772, -4255, -5057,
+    -4698,  -480,  1058, -4079,  3195,  1018,  5925,  -145,
+    -3202,  4493,  -955, -6008,   885, -2476,  5184,  1200,
+     5728, -6093,  3710, -1260,  2361, -1843, -2366, -2839,
+    -3957, -4989,  1566, -5782, -4043,  5456,  4449,  -355,
+    -1975, -3757,  2747, -5594,  3029,  2837,  -295, -6099,
+     3006,  -400,  1728,   729, -5333, -2031,   140, -3482,
+      787, -2468,  1319,  3150, -3542, -2169,   522,  5911,
+    -1483,  5915, -1326, -2844,  3438, -5767, -5106, -5961,
+    -5777,  2033,  3998,  -334,  -576,  3963,   -81,   677,
+    -5874, -1381,  3834, -5257,  5736, -1050,  4536,  1759,
+     -174,  -723,  4805, -6068,  3602, -3949, -1146,  -948,
+    -4821,  1987, -1702, -2089, -5429,  4774,  2768, -1321,
+     -192,     9,  1958,  4322, -1212, -2344,  1278,  3459,
+    -1512,  -350,  1170,   241,   -58,  2197, -5297, -6119,
+    -5023,   316,  -382,  4632, -3529, -3434,  2963,  2505,
+    -5906, -1673,    64,  3656,    -1, -5537,  4749,  4231,
+     -426,  3315,  3712,  4213,  -504,  -130, -4077, -4016,
+    -2975,  6136, -5862,  3289, -3969, -3991, -4611,  5241,
+     2920, -5791,  6065,   835, -2545, -5315, -4075,  2731,
+    -1583, -5942, -3201, -1105,  -142,   953,   168, -2692,
+    -1351,  5435, -1359,  1696,  1954, -2051,  1000, -2766,
+    -1323, -3584,  3123,  1747,  -722,  3818,  6118, -5179,
+    -2738, -5868,  1062,  6077, -4624,  4452, -4049,  3728,
+     2625, -3199,    56,  2881,   453,  5908,  1177,  4780,
+    -3445, -2842,   441,  -922,  5860,  3514,  1041,  5542,
+     2057,  5369,  -790,  1956, -5009,  -118, -2555,  6122,
+    -4591, -5339, -5446, -4388, -4115,  3030, -3051,  2127,
+      151,  5331, -2948, -2503, -5146, -3789,   147, -3382,
+     -347, -2925,  4846, -5886,  4782, -5374,  5766,   652,
+     2744, -6137, -4948,  3241, -2281, -5876,  1853, -1010,
+    -5468,   339,  4046,   709,  3504, -3262, -5079, -4890,
+      -49, -1263, -5086,   975, -4212,   827, -1594, -1962,
+     3328,  3879,  1922,  2426, -2447, -6142, -3091,  6055,
+     3336,  2525,  5919, -4433, -4134,  3860,  5445,  3707,
+     1693,  3009, -3553,   421,  4080,  3296,  1404,   325,
+     2639,   654,  3565,  5092, -4737,  1293, -1635, -2049,
+    -4912, -1022, -1112, -2078, -1646,  5574,  1973, -3637,
+    -1815,  5383,  2319, -1003, -3532, -5067, -1360, -3956,
+    -5828,  3988,   468, -5755,  2908,   218,  4896,  -431,
+    -1579,  4278, -2459,  -683,  1479,  4789, -4467, -2548,
+    -4754,  1858,  3135,  2302,  -605, -4354, -2919,  3762,
+      563,  2686, -3247,  2859, -4053, -2645,  1537,  3000,
+     -671,  1067, -2166, -3915,  3763,  3186, -5407,  -354,
+    -4414,  2847,  3704,  3531,   476, -3833,  5291,  2704,
+     1017, -2370,  2865,  2481, -1484, -4895, -4714,  3136,
+    -5191, -2401, -3149,  -160, -3066,  2249,  4048, -2912,
+    -4057,  3271,   545,  5559,  -420,  -773, -1777, -1663,
+    -1632, -2969,  3978, -1045, -2305,  5042,   242,  3016,
+      243, -5101,  -113, -4919,  1440,  1630, -2126, -4861,
+    -4372,  2174,  2678, -4905,  3985,  3778, -4938,  3636,
+    -4885, -5332, -3510,  5012, -5195,  2780,  4143,  2399,
+     3400,  -442,  4437,     3,   -27, -2884,  1153,  5698,
+     1689, -3364,  5019, -2178,  1544,   390, -1426, -4654,
+     5084,  5088, -4284, -3248, -3646, -2437,  2143,  -875,
+     3780, -1168, -2566, -2187,  4645, -5011,  1002, -1207,
+     2987, -6022,  1065, -4976, -1607, -5277,  6039,  2422,
+     -404,  4337,   435, -2381,  1378,  1912, -5444,  -493,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_rev_gs_r4[512] = {
+        0, -3643,  5415, -2013,  6136, -5862,  3289,  -400,
+     1728,   729, -6137, -4948,  3241, -5529,  5206, -3284,
+    -3199,    56,  2881,  1987, -1702, -2089,   654,  3565,
+     5092,   973, -1254,  1428,  5435, -1359,  1696,  2033,
+     3998,  -334,  3879,  1922,  2426, -6093,  3710, -1260,
+    -5339, -5446, -4388,   316,  -382,  4632,  3988,   468,
+    -5755,  4916,  4324, -3932, -5315, -4075,  2731, -2169,
+      522,  5911, -3262, -5079, -4890,  1018,  5925,  -145,
+     3514,  1041,  5542, -2344,  1278,  3459,  5574,  1973,
+    -3637,  1190, -2683, -3694,  3818,  6118, -5179, -1050,
+     4536,  1759,  3860,  5445,  3707,  5456,  4449,  -355,
+    -3789,   147, -3382, -5537,  4749,  4231,  4789, -4467,
+    -2548,  3127, -4169,   544,  5241,  2920, -5791, -3482,
+      787, -2468, -1010, -5468,   339, -5057, -4698,  -480,
+     4780, -3445, -2842, -1321,  -192,     9, -2049, -4912,
+    -1022,    52, -3174, -4177, -2766, -1323, -3584,   677,
+    -5874, -1381,  6055,  3336,  2525, -2839, -3957, -4989,
+     2127,   151,  5331,  2505, -5906, -1673,  -431, -1579,
+     4278,  5681,  3477, -3748, -1105,  -142,   953, -2844,
+     3438, -5767,   975, -4212,   827, -6008,   885, -2476,
+     1956, -5009,  -118,   241,   -58,  2197, -1003, -3532,
+    -5067,  3600, -3263, -2396,  6077, -4624,  4452, -6068,
+     3602, -3949,   421,  4080,  3296, -5594,  3029,  2837,
+    -5886,  4782, -5374,  4213,  -504,  -130,  2302,  -605,
+    -4354,  2767,  -156,   726, -3969, -3991, -4611, -5333,
+    -2031,   140, -2281, -5876,  1853,   418, -3772, -4255,
+      453,  5908,  1177, -5429,  4774,  2768, -4737,  1293,
+    -1635, -1805,  2882,  4320,  1954, -2051,  1000,  -576,
+     3963,   -81, -2447, -6142, -3091,  2361, -1843, -2366,
+    -4115,  3030, -3051, -3529, -3434,  2963,  2908,   218,
+     4896,  2500,  1489, -3014, -1583, -5942, -3201, -1483,
+     5915, -1326,   -49, -1263, -5086, -3202,  4493,  -955,
+     2057,  5369,  -790, -1512,  -350,  1170, -1815,  5383,
+     2319,  2655,  5735, -2294, -2738, -5868,  1062,  -174,
+     -723,  4805,  1693,  3009, -3553, -1975, -3757,  2747,
+     -347, -2925,  4846,  -426,  3315,  3712, -4754,  1858,
+     3135,  4240, -3570, -3621,  6065,   835, -2545,  1319,
+     3150, -3542,  4046,   709,  3504,  1058, -4079,  3195,
+      441,  -922,  5860,  1958,  4322, -1212, -1112, -2078,
+    -1646,  5486, -3054,  1305,  3123,  1747,  -722,  3834,
+    -5257,  5736,  5919, -4433, -4134,  1566, -5782, -4043,
+    -2948, -2503, -5146,    64,  3656,    -1, -2459,  -683,
+     1479,  3329,  4298,  4978,   168, -2692, -1351, -5106,
+    -5961, -5777, -1594, -1962,  3328,  5184,  1200,  5728,
+    -2555,  6122, -4591, -5297, -6119, -5023, -1360, -3956,
+    -5828, -1159,  5990,  -949, -4049,  3728,  2625, -1146,
+     -948, -4821,  1404,   325,  2639,  -295, -6099,  3006,
+     5766,   652,  2744, -4077, -4016, -2975, -2919,  3762,
+      563,  2686, -3247,  2859, -2969,  3978, -1045, -2370,
+     2865,  2481, -5332, -3510,  5012,  3186, -5407,  -354,
+     1630, -2126, -4861,  2249,  4048, -2912, -2884,  1153,
+     5698,  3000,  -671,  1067,  3016,   243, -5101,  3136,
+    -5191, -2401,  2399,  3400,  -442,  3531,   476, -3833,
+    -4905,  3985,  3778,  5559,  -420,  -773, -2178,  1544,
+      390, -4053, -2645,  1537, -2305,  5042,   242, -1484,
+    -4895, -4714, -5195,  2780,  4143, -4414,  2847,  3704,
+    -4372,  2174,  2678, -4057,  3271,   545,  1689, -3364,
+     5019, -2166, -3915,  3763,  -113, -4919,  1440, -3149,
+     -160, -3066,  4437,     3,   -27,  5291,  2704,  1017,
+    -4938,  3636, -4885, -1777, -1663, -1632, -1426, -4654,
+     5084,  5088, -4284, -3248, -5011,  1002, -1207,  -875,
+     3780, -1168, -4976, -1607, -5277, -3646, -2437,  2143,
+     2987, -6022,  1065, -2566, -2187,  4645,  6039,  2422,
+     -404,  4337,   435, -2381,  1378,  1912, -5444,  -493,
+};
+
+const int16_t ntt_red512_omega_powers_ct_cg[2304] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -4096, -4096, -4096, -4096, -5084, -5084, -5084, -5084,
+    -2422, -2422, -2422, -2422,  -390,  -390,  -390,  -390,
+      404,   404,   404,   404, -5019, -5019, -5019, -5019,
+     1607,  1607,  1607,  1607, -5698, -5698, -5698, -5698,
+    -1912, -1912, -1912, -1912,    27,    27,    27,    27,
+     6022,  6022,  6022,  6022,   442,   442,   442,   442,
+     5277,  5277,  5277,  5277, -4143, -4143, -4143, -4143,
+    -1002, -1002, -1002, -1002, -5012, -5012, -5012, -5012,
+     5444,  5444,  5444,  5444,  4885,  4885,  4885,  4885,
+     2187,  2187,  2187,  2187, -3778, -3778, -3778, -3778,
+    -1065, -1065, -1065, -1065, -2678, -2678, -2678, -2678,
+    -3780, -3780, -3780, -3780,  4861,  4861,  4861,  4861,
+     -435,  -435,  -435,  -435, -1440, -1440, -1440, -1440,
+     2437,  2437,  2437,  2437,  5101,  5101,  5101,  5101,
+     1207,  1207,  1207,  1207,  -242,  -242,  -242,  -242,
+     4284,  4284,  4284,  4284,  1045,  1045,  1045,  1045,
+      493,   493,   493,   493,  1632,  1632,  1632,  1632,
+    -6039, -6039, -6039, -6039,   773,   773,   773,   773,
+    -4645, -4645, -4645, -4645,  -545,  -545,  -545,  -545,
+     4976,  4976,  4976,  4976,  2912,  2912,  2912,  2912,
+    -1378, -1378, -1378, -1378,  3066,  3066,  3066,  3066,
+    -2987, -2987, -2987, -2987,  2401,  2401,  2401,  2401,
+     1168,  1168,  1168,  1168,  4714,  4714,  4714,  4714,
+     5011,  5011,  5011,  5011, -2481, -2481, -2481, -2481,
+     2381,  2381,  2381,  2381, -1017, -1017, -1017, -1017,
+     2566,  2566,  2566,  2566,  3833,  3833,  3833,  3833,
+    -2143, -2143, -2143, -2143, -3704, -3704, -3704, -3704,
+      875,   875,   875,   875,   354,   354,   354,   354,
+    -4337, -4337, -4337, -4337, -3763, -3763, -3763, -3763,
+     3646,  3646,  3646,  3646, -1067, -1067, -1067, -1067,
+     3248,  3248,  3248,  3248, -1537, -1537, -1537, -1537,
+    -5088, -5088, -5088, -5088, -2859, -2859, -2859, -2859,
+    -4096, -4096,  4654,  4654, -5084, -5084, -1544, -1544,
+    -2422, -2422,  3364,  3364,  -390,  -390, -1153, -1153,
+      404,   404,    -3,    -3, -5019, -5019, -3400, -3400,
+     1607,  1607, -2780, -2780, -5698, -5698,  3510,  3510,
+    -1912, -1912, -3636, -3636,    27,    27, -3985, -3985,
+     6022,  6022, -2174, -2174,   442,   442,  2126,  2126,
+     5277,  5277,  4919,  4919, -4143, -4143,  -243,  -243,
+    -1002, -1002, -5042, -5042, -5012, -5012, -3978, -3978,
+     5444,  5444,  1663,  1663,  4885,  4885,   420,   420,
+     2187,  2187, -3271, -3271, -3778, -3778, -4048, -4048,
+    -1065, -1065,   160,   160, -2678, -2678,  5191,  5191,
+    -3780, -3780,  4895,  4895,  4861,  4861, -2865, -2865,
+     -435,  -435, -2704, -2704, -1440, -1440,  -476,  -476,
+     2437,  2437, -2847, -2847,  5101,  5101,  5407,  5407,
+     1207,  1207,  3915,  3915,  -242,  -242,   671,   671,
+     4284,  4284,  2645,  2645,  1045,  1045,  3247,  3247,
+      493,   493,  1426,  1426,  1632,  1632,  2178,  2178,
+    -6039, -6039, -1689, -1689,   773,   773,  2884,  2884,
+    -4645, -4645, -4437, -4437,  -545,  -545, -2399, -2399,
+     4976,  4976,  5195,  5195,  2912,  2912,  5332,  5332,
+    -1378, -1378,  4938,  4938,  3066,  3066,  4905,  4905,
+    -2987, -2987,  4372,  4372,  2401,  2401, -1630, -1630,
+     1168,  1168,   113,   113,  4714,  4714, -3016, -3016,
+     5011,  5011,  2305,  2305, -2481, -2481,  2969,  2969,
+     2381,  2381,  1777,  1777, -1017, -1017, -5559, -5559,
+     2566,  2566,  4057,  4057,  3833,  3833, -2249, -2249,
+    -2143, -2143,  3149,  3149, -3704, -3704, -3136, -3136,
+      875,   875,  1484,  1484,   354,   354,  2370,  2370,
+    -4337, -4337, -5291, -5291, -3763, -3763, -3531, -3531,
+     3646,  3646,  4414,  4414, -1067, -1067, -3186, -3186,
+     3248,  3248,  2166,  2166, -1537, -1537, -3000, -3000,
+    -5088, -5088,  4053,  4053, -2859, -2859, -2686, -2686,
+    -4096,  -563,  4654,  4354, -5084, -3135, -1544,  2548,
+    -2422, -1479,  3364, -4278,  -390, -4896, -1153,  5755,
+      404,  5828,    -3,  5067, -5019, -2319, -3400,  3637,
+     1607,  1646, -2780,  1022, -5698,  1635,  3510, -5092,
+    -1912, -2639, -3636, -3296,    27,  3553, -3985, -3707,
+     6022,  4134, -2174, -2525,   442,  3091,  2126, -2426,
+     5277, -3328,  4919,  -827, -4143,  5086,  -243,  4890,
+    -1002, -3504, -5042,  -339, -5012, -1853, -3978, -3241,
+     5444, -2744,  1663,  5374,  4885, -4846,   420,  3382,
+     2187,  5146, -3271, -5331, -3778,  3051, -4048,  4388,
+    -1065,  4591,   160,   118, -2678,   790,  5191, -5542,
+    -3780, -5860,  4895,  2842,  4861, -1177, -2865, -2881,
+     -435, -2625, -2704, -4452, -1440, -1062,  -476,  5179,
+     2437,   722, -2847,  3584,  5101, -1000,  5407, -1696,
+     1207,  1351,  3915,  -953,  -242,  3201,   671, -2731,
+     4284,  2545,  2645,  5791,  1045,  4611,  3247, -3289,
+      493,  2975,  1426,   130,  1632, -3712,  2178, -4231,
+    -6039,     1, -1689,  1673,   773, -2963,  2884, -4632,
+    -4645,  5023, -4437, -2197,  -545, -1170, -2399, -3459,
+     4976,  1212,  5195,    -9,  2912, -2768,  5332,  2089,
+    -1378,  4821,  4938,  3949,  3066, -4805,  4905, -1759,
+    -2987, -5736,  4372,  1381,  2401,    81, -1630,   334,
+     1168,  5777,   113,  5767,  4714,  1326, -3016, -5911,
+     5011,  3542,  2305,  2468, -2481,  -140,  2969,  -729,
+     2381, -3006,  1777, -2837, -1017, -2747, -5559,   355,
+     2566,  4043,  4057,  4989,  3833,  2366, -2249,  1260,
+    -2143, -5728,  3149,  2476, -3704,   955, -3136,   145,
+      875, -3195,  1484,   480,   354,  4255,  2370,  3284,
+    -4337,   949, -5291,  2396, -3763,  2294, -3531,  3694,
+     3646, -1305,  4414,  4177, -1067, -4320, -3186, -1428,
+     3248, -4978,  2166,  3748, -1537,  3014, -3000,  3932,
+    -5088,  3621,  4053,  -544, -2859,  -726, -2686,  2013,
+};
+
+const int16_t ntt_red512_omega_powers_gs_cg[2304] = {
+    -4096,  -563,  4654,  4354, -5084, -3135, -1544,  2548,
+    -2422, -1479,  3364, -4278,  -390, -4896, -1153,  5755,
+      404,  5828,    -3,  5067, -5019, -2319, -3400,  3637,
+     1607,  1646, -2780,  1022, -5698,  1635,  3510, -5092,
+    -1912, -2639, -3636, -3296,    27,  3553, -3985, -3707,
+     6022,  4134, -2174, -2525,   442,  3091,  2126, -2426,
+     5277, -3328,  4919,  -827, -4143,  5086,  -243,  4890,
+    -1002, -3504, -5042,  -339, -5012, -1853, -3978, -3241,
+     5444, -2744,  1663,  5374,  4885, -4846,   420,  3382,
+     2187,  5146, -3271, -5331, -3778,  3051, -4048,  4388,
+    -1065,  4591,   160,   118, -2678,   790,  5191, -5542,
+    -3780, -5860,  4895,  2842,  4861, -1177, -2865, -2881,
+     -435, -2625, -2704, -4452, -1440, -1062,  -476,  5179,
+     2437,   722, -2847,  3584,  5101, -1000,  5407, -1696,
+     1207,  1351,  3915,  -953,  -242,  3201,   671, -2731,
+     4284,  2545,  2645,  5791,  1045,  4611,  3247, -3289,
+      493,  2975,  1426,   130,  1632, -3712,  2178, -4231,
+    -6039,     1, -1689,  1673,   773, -2963,  2884, -4632,
+    -4645,  5023, -4437, -2197,  -545, -1170, -2399, -3459,
+     4976,  1212,  5195,    -9,  2912, -2768,  5332,  2089,
+    -1378,  4821,  4938,  3949,  3066, -4805,  4905, -1759,
+    -2987, -5736,  4372,  1381,  2401,    81, -1630,   334,
+     1168,  5777,   113,  5767,  4714,  1326, -3016, -5911,
+     5011,  3542,  2305,  2468, -2481,  -140,  2969,  -729,
+     2381, -3006,  1777, -2837, -1017, -2747, -5559,   355,
+     2566,  4043,  4057,  4989,  3833,  2366, -2249,  1260,
+    -2143, -5728,  3149,  2476, -3704,   955, -3136,   145,
+      875, -3195,  1484,   480,   354,  4255,  2370,  3284,
+    -4337,   949, -5291,  2396, -3763,  2294, -3531,  3694,
+     3646, -1305,  4414,  4177, -1067, -4320, -3186, -1428,
+     3248, -4978,  2166,  3748, -1537,  3014, -3000,  3932,
+    -5088,  3621,  4053,  -544, -2859,  -726, -2686,  2013,
+    -4096, -4096,  4654,  4654, -5084, -5084, -1544, -1544,
+    -2422, -2422,  3364,  3364,  -390,  -390, -1153, -1153,
+      404,   404,    -3,    -3, -5019, -5019, -3400, -3400,
+     1607,  1607, -2780, -2780, -5698, -5698,  3510,  3510,
+    -1912, -1912, -3636, -3636,    27,    27, -3985, -3985,
+     6022,  6022, -2174, -2174,   442,   442,  2126,  2126,
+     5277,  5277,  4919,  4919, -4143, -4143,  -243,  -243,
+    -1002, -1002, -5042, -5042, -5012, -5012, -3978, -3978,
+     5444,  5444,  1663,  1663,  4885,  4885,   420,   420,
+     2187,  2187, -3271, -3271, -3778, -3778, -4048, -4048,
+    -1065, -1065,   160,   160, -2678, -2678,  5191,  5191,
+    -3780, -3780,  4895,  4895,  4861,  4861, -2865, -2865,
+     -435,  -435, -2704, -2704, -1440, -1440,  -476,  -476,
+     2437,  2437, -2847, -2847,  5101,  5101,  5407,  5407,
+     1207,  1207,  3915,  3915,  -242,  -242,   671,   671,
+     4284,  4284,  2645,  2645,  1045,  1045,  3247,  3247,
+      493,   493,  1426,  1426,  1632,  1632,  2178,  2178,
+    -6039, -6039, -1689, -1689,   773,   773,  2884,  2884,
+    -4645, -4645, -4437, -4437,  -545,  -545, -2399, -2399,
+     4976,  4976,  5195,  5195,  2912,  2912,  5332,  5332,
+    -1378, -1378,  4938,  4938,  3066,  3066,  4905,  4905,
+    -2987, -2987,  4372,  4372,  2401,  2401, -1630, -1630,
+     1168,  1168,   113,   113,  4714,  4714, -3016, -3016,
+     5011,  5011,  2305,  2305, -2481, -2481,  2969,  2969,
+     2381,  2381,  1777,  1777, -1017, -1017, -5559, -5559,
+     2566,  2566,  4057,  4057,  3833,  3833, -2249, -2249,
+    -2143, -2143,  3149,  3149, -3704, -3704, -3136, -3136,
+      875,   875,  1484,  1484,   354,   354,  2370,  2370,
+    -4337, -4337, -5291, -5291, -3763, -3763, -3531, -3531,
+     3646,  3646,  4414,  4414, -1067, -1067, -3186, -3186,
+     3248,  3248,  2166,  2166, -1537, -1537, -3000, -3000,
+    -5088, -5088,  4053,  4053, -2859, -2859, -2686, -2686,
+    -4096, -4096, -4096, -4096, -5084, -5084, -5084, -5084,
+    -2422, -2422, -2422, -2422,  -390,  -390,  -390,  -390,
+      404,   404,   404,   404, -5019, -5019, -5019, -5019,
+     1607,  1607,  1607,  1607, -5698, -5698, -5698, -5698,
+    -1912, -1912, -1912, -1912,    27,    27,    27,    27,
+     6022,  6022,  6022,  6022,   442,   442,   442,   442,
+     5277,  5277,  5277,  5277, -4143, -4143, -4143, -4143,
+    -1002, -1002, -1002, -1002, -5012, -5012, -5012, -5012,
+     5444,  5444,  5444,  5444,  4885,  4885,  4885,  4885,
+     2187,  2187,  2187,  2187, -3778, -3778, -3778, -3778,
+    -1065, -1065, -1065, -1065, -2678, -2678, -2678, -2678,
+    -3780, -3780, -3780, -3780,  4861,  4861,  4861,  4861,
+     -435,  -435,  -435,  -435, -1440, -1440, -1440, -1440,
+     2437,  2437,  2437,  2437,  5101,  5101,  5101,  5101,
+     1207,  1207,  1207,  1207,  -242,  -242,  -242,  -242,
+     4284,  4284,  4284,  4284,  1045,  1045,  1045,  1045,
+      493,   493,   493,   493,  1632,  1632,  1632,  1632,
+    -6039, -6039, -6039, -6039,   773,   773,   773,   773,
+    -4645, -4645, -4645, -4645,  -545,  -545,  -545,  -545,
+     4976,  4976,  4976,  4976,  2912,  2912,  2912,  2912,
+    -1378, -1378, -1378, -1378,  3066,  3066,  3066,  3066,
+    -2987, -2987, -2987, -2987,  2401,  2401,  2401,  2401,
+     1168,  1168,  1168,  1168,  4714,  4714,  4714,  4714,
+     5011,  5011,  5011,  5011, -2481, -2481, -2481, -2481,
+     2381,  2381,  2381,  2381, -1017, -1017, -1017, -1017,
+     2566,  2566,  2566,  2566,  3833,  3833,  3833,  3833,
+    -2143, -2143, -2143, -2143, -3704, -3704, -3704, -3704,
+      875,   875,   875,   875,   354,   354,   354,   354,
+    -4337, -4337, -4337, -4337, -3763, -3763, -3763, -3763,
+     3646,  3646,  3646,  3646, -1067, -1067, -1067, -1067,
+     3248,  3248,  3248,  3248, -1537, -1537, -1537, -1537,
+    -5088, -5088, -5088, -5088, -2859, -2859, -2859, -2859,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+      875,   875,   875,   875,   875,   875,   875,   875,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red512_omega_powers_rev_ct_cg[2304] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+};
+
+const int16_t ntt_red512_omega_powers_rev_gs_cg[2304] = {
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -4096,   493,  5444,  2381,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096,   493, -4096,   493, -4096,   493, -4096,   493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red512_inv_omega_powers_ct_cg[2304] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+    -4096, -4096, -4096, -4096,  2859,  2859,  2859,  2859,
+     5088,  5088,  5088,  5088,  1537,  1537,  1537,  1537,
+    -3248, -3248, -3248, -3248,  1067,  1067,  1067,  1067,
+    -3646, -3646, -3646, -3646,  3763,  3763,  3763,  3763,
+     4337,  4337,  4337,  4337,  -354,  -354,  -354,  -354,
+     -875,  -875,  -875,  -875,  3704,  3704,  3704,  3704,
+     2143,  2143,  2143,  2143, -3833, -3833, -3833, -3833,
+    -2566, -2566, -2566, -2566,  1017,  1017,  1017,  1017,
+    -2381, -2381, -2381, -2381,  2481,  2481,  2481,  2481,
+    -5011, -5011, -5011, -5011, -4714, -4714, -4714, -4714,
+    -1168, -1168, -1168, -1168, -2401, -2401, -2401, -2401,
+     2987,  2987,  2987,  2987, -3066, -3066, -3066, -3066,
+     1378,  1378,  1378,  1378, -2912, -2912, -2912, -2912,
+    -4976, -4976, -4976, -4976,   545,   545,   545,   545,
+     4645,  4645,  4645,  4645,  -773,  -773,  -773,  -773,
+     6039,  6039,  6039,  6039, -1632, -1632, -1632, -1632,
+     -493,  -493,  -493,  -493, -1045, -1045, -1045, -1045,
+    -4284, -4284, -4284, -4284,   242,   242,   242,   242,
+    -1207, -1207, -1207, -1207, -5101, -5101, -5101, -5101,
+    -2437, -2437, -2437, -2437,  1440,  1440,  1440,  1440,
+      435,   435,   435,   435, -4861, -4861, -4861, -4861,
+     3780,  3780,  3780,  3780,  2678,  2678,  2678,  2678,
+     1065,  1065,  1065,  1065,  3778,  3778,  3778,  3778,
+    -2187, -2187, -2187, -2187, -4885, -4885, -4885, -4885,
+    -5444, -5444, -5444, -5444,  5012,  5012,  5012,  5012,
+     1002,  1002,  1002,  1002,  4143,  4143,  4143,  4143,
+    -5277, -5277, -5277, -5277,  -442,  -442,  -442,  -442,
+    -6022, -6022, -6022, -6022,   -27,   -27,   -27,   -27,
+     1912,  1912,  1912,  1912,  5698,  5698,  5698,  5698,
+    -1607, -1607, -1607, -1607,  5019,  5019,  5019,  5019,
+     -404,  -404,  -404,  -404,   390,   390,   390,   390,
+     2422,  2422,  2422,  2422,  5084,  5084,  5084,  5084,
+    -4096, -4096,  2686,  2686,  2859,  2859, -4053, -4053,
+     5088,  5088,  3000,  3000,  1537,  1537, -2166, -2166,
+    -3248, -3248,  3186,  3186,  1067,  1067, -4414, -4414,
+    -3646, -3646,  3531,  3531,  3763,  3763,  5291,  5291,
+     4337,  4337, -2370, -2370,  -354,  -354, -1484, -1484,
+     -875,  -875,  3136,  3136,  3704,  3704, -3149, -3149,
+     2143,  2143,  2249,  2249, -3833, -3833, -4057, -4057,
+    -2566, -2566,  5559,  5559,  1017,  1017, -1777, -1777,
+    -2381, -2381, -2969, -2969,  2481,  2481, -2305, -2305,
+    -5011, -5011,  3016,  3016, -4714, -4714,  -113,  -113,
+    -1168, -1168,  1630,  1630, -2401, -2401, -4372, -4372,
+     2987,  2987, -4905, -4905, -3066, -3066, -4938, -4938,
+     1378,  1378, -5332, -5332, -2912, -2912, -5195, -5195,
+    -4976, -4976,  2399,  2399,   545,   545,  4437,  4437,
+     4645,  4645, -2884, -2884,  -773,  -773,  1689,  1689,
+     6039,  6039, -2178, -2178, -1632, -1632, -1426, -1426,
+     -493,  -493, -3247, -3247, -1045, -1045, -2645, -2645,
+    -4284, -4284,  -671,  -671,   242,   242, -3915, -3915,
+    -1207, -1207, -5407, -5407, -5101, -5101,  2847,  2847,
+    -2437, -2437,   476,   476,  1440,  1440,  2704,  2704,
+      435,   435,  2865,  2865, -4861, -4861, -4895, -4895,
+     3780,  3780, -5191, -5191,  2678,  2678,  -160,  -160,
+     1065,  1065,  4048,  4048,  3778,  3778,  3271,  3271,
+    -2187, -2187,  -420,  -420, -4885, -4885, -1663, -1663,
+    -5444, -5444,  3978,  3978,  5012,  5012,  5042,  5042,
+     1002,  1002,   243,   243,  4143,  4143, -4919, -4919,
+    -5277, -5277, -2126, -2126,  -442,  -442,  2174,  2174,
+    -6022, -6022,  3985,  3985,   -27,   -27,  3636,  3636,
+     1912,  1912, -3510, -3510,  5698,  5698,  2780,  2780,
+    -1607, -1607,  3400,  3400,  5019,  5019,     3,     3,
+     -404,  -404,  1153,  1153,   390,   390, -3364, -3364,
+     2422,  2422,  1544,  1544,  5084,  5084, -4654, -4654,
+    -4096, -2013,  2686,   726,  2859,   544, -4053, -3621,
+     5088, -3932,  3000, -3014,  1537, -3748, -2166,  4978,
+    -3248,  1428,  3186,  4320,  1067, -4177, -4414,  1305,
+    -3646, -3694,  3531, -2294,  3763, -2396,  5291,  -949,
+     4337, -3284, -2370, -4255,  -354,  -480, -1484,  3195,
+     -875,  -145,  3136,  -955,  3704, -2476, -3149,  5728,
+     2143, -1260,  2249, -2366, -3833, -4989, -4057, -4043,
+    -2566,  -355,  5559,  2747,  1017,  2837, -1777,  3006,
+    -2381,   729, -2969,   140,  2481, -2468, -2305, -3542,
+    -5011,  5911,  3016, -1326, -4714, -5767,  -113, -5777,
+    -1168,  -334,  1630,   -81, -2401, -1381, -4372,  5736,
+     2987,  1759, -4905,  4805, -3066, -3949, -4938, -4821,
+     1378, -2089, -5332,  2768, -2912,     9, -5195, -1212,
+    -4976,  3459,  2399,  1170,   545,  2197,  4437, -5023,
+     4645,  4632, -2884,  2963,  -773, -1673,  1689,    -1,
+     6039,  4231, -2178,  3712, -1632,  -130, -1426, -2975,
+     -493,  3289, -3247, -4611, -1045, -5791, -2645, -2545,
+    -4284,  2731,  -671, -3201,   242,   953, -3915, -1351,
+    -1207,  1696, -5407,  1000, -5101, -3584,  2847,  -722,
+    -2437, -5179,   476,  1062,  1440,  4452,  2704,  2625,
+      435,  2881,  2865,  1177, -4861, -2842, -4895,  5860,
+     3780,  5542, -5191,  -790,  2678,  -118,  -160, -4591,
+     1065, -4388,  4048, -3051,  3778,  5331,  3271, -5146,
+    -2187, -3382,  -420,  4846, -4885, -5374, -1663,  2744,
+    -5444,  3241,  3978,  1853,  5012,   339,  5042,  3504,
+     1002, -4890,   243, -5086,  4143,   827, -4919,  3328,
+    -5277,  2426, -2126, -3091,  -442,  2525,  2174, -4134,
+    -6022,  3707,  3985, -3553,   -27,  3296,  3636,  2639,
+     1912,  5092, -3510, -1635,  5698, -1022,  2780, -1646,
+    -1607, -3637,  3400,  2319,  5019, -5067,     3, -5828,
+     -404, -5755,  1153,  4896,   390,  4278, -3364,  1479,
+     2422, -2548,  1544,  3135,  5084, -4354, -4654,   563,
+};
+
+const int16_t ntt_red512_inv_omega_powers_gs_cg[2304] = {
+    -4096, -2013,  2686,   726,  2859,   544, -4053, -3621,
+     5088, -3932,  3000, -3014,  1537, -3748, -2166,  4978,
+    -3248,  1428,  3186,  4320,  1067, -4177, -4414,  1305,
+    -3646, -3694,  3531, -2294,  3763, -2396,  5291,  -949,
+     4337, -3284, -2370, -4255,  -354,  -480, -1484,  3195,
+     -875,  -145,  3136,  -955,  3704, -2476, -3149,  5728,
+     2143, -1260,  2249, -2366, -3833, -4989, -4057, -4043,
+    -2566,  -355,  5559,  2747,  1017,  2837, -1777,  3006,
+    -2381,   729, -2969,   140,  2481, -2468, -2305, -3542,
+    -5011,  5911,  3016, -1326, -4714, -5767,  -113, -5777,
+    -1168,  -334,  1630,   -81, -2401, -1381, -4372,  5736,
+     2987,  1759, -4905,  4805, -3066, -3949, -4938, -4821,
+     1378, -2089, -5332,  2768, -2912,     9, -5195, -1212,
+    -4976,  3459,  2399,  1170,   545,  2197,  4437, -5023,
+     4645,  4632, -2884,  2963,  -773, -1673,  1689,    -1,
+     6039,  4231, -2178,  3712, -1632,  -130, -1426, -2975,
+     -493,  3289, -3247, -4611, -1045, -5791, -2645, -2545,
+    -4284,  2731,  -671, -3201,   242,   953, -3915, -1351,
+    -1207,  1696, -5407,  1000, -5101, -3584,  2847,  -722,
+    -2437, -5179,   476,  1062,  1440,  4452,  2704,  2625,
+      435,  2881,  2865,  1177, -4861, -2842, -4895,  5860,
+     3780,  5542, -5191,  -790,  2678,  -118,  -160, -4591,
+     1065, -4388,  4048, -3051,  3778,  5331,  3271, -5146,
+    -2187, -3382,  -420,  4846, -4885, -5374, -1663,  2744,
+    -5444,  3241,  3978,  1853,  5012,   339,  5042,  3504,
+     1002, -4890,   243, -5086,  4143,   827, -4919,  3328,
+    -5277,  2426, -2126, -3091,  -442,  2525,  2174, -4134,
+    -6022,  3707,  3985, -3553,   -27,  3296,  3636,  2639,
+     1912,  5092, -3510, -1635,  5698, -1022,  2780, -1646,
+    -1607, -3637,  3400,  2319,  5019, -5067,     3, -5828,
+     -404, -5755,  1153,  4896,   390,  4278, -3364,  1479,
+     2422, -2548,  1544,  3135,  5084, -4354, -4654,   563,
+    -4096, -4096,  2686,  2686,  2859,  2859, -4053, -4053,
+     5088,  5088,  3000,  3000,  1537,  1537, -2166, -2166,
+    -3248, -3248,  3186,  3186,  1067,  1067, -4414, -4414,
+    -3646, -3646,  3531,  3531,  3763,  3763,  5291,  5291,
+     4337,  4337, -2370, -2370,  -354,  -354, -1484, -1484,
+     -875,  -875,  3136,  3136,  3704,  3704, -3149, -3149,
+     2143,  2143,  2249,  2249, -3833, -3833, -4057, -4057,
+    -2566, -2566,  5559,  5559,  1017,  1017, -1777, -1777,
+    -2381, -2381, -2969, -2969,  2481,  2481, -2305, -2305,
+    -5011, -5011,  3016,  3016, -4714, -4714,  -113,  -113,
+    -1168, -1168,  1630,  1630, -2401, -2401, -4372, -4372,
+     2987,  2987, -4905, -4905, -3066, -3066, -4938, -4938,
+     1378,  1378, -5332, -5332, -2912, -2912, -5195, -5195,
+    -4976, -4976,  2399,  2399,   545,   545,  4437,  4437,
+     4645,  4645, -2884, -2884,  -773,  -773,  1689,  1689,
+     6039,  6039, -2178, -2178, -1632, -1632, -1426, -1426,
+     -493,  -493, -3247, -3247, -1045, -1045, -2645, -2645,
+    -4284, -4284,  -671,  -671,   242,   242, -3915, -3915,
+    -1207, -1207, -5407, -5407, -5101, -5101,  2847,  2847,
+    -2437, -2437,   476,   476,  1440,  1440,  2704,  2704,
+      435,   435,  2865,  2865, -4861, -4861, -4895, -4895,
+     3780,  3780, -5191, -5191,  2678,  2678,  -160,  -160,
+     1065,  1065,  4048,  4048,  3778,  3778,  3271,  3271,
+    -2187, -2187,  -420,  -420, -4885, -4885, -1663, -1663,
+    -5444, -5444,  3978,  3978,  5012,  5012,  5042,  5042,
+     1002,  1002,   243,   243,  4143,  4143, -4919, -4919,
+    -5277, -5277, -2126, -2126,  -442,  -442,  2174,  2174,
+    -6022, -6022,  3985,  3985,   -27,   -27,  3636,  3636,
+     1912,  1912, -3510, -3510,  5698,  5698,  2780,  2780,
+    -1607, -1607,  3400,  3400,  5019,  5019,     3,     3,
+     -404,  -404,  1153,  1153,   390,   390, -3364, -3364,
+     2422,  2422,  1544,  1544,  5084,  5084, -4654, -4654,
+    -4096, -4096, -4096, -4096,  2859,  2859,  2859,  2859,
+     5088,  5088,  5088,  5088,  1537,  1537,  1537,  1537,
+    -3248, -3248, -3248, -3248,  1067,  1067,  1067,  1067,
+    -3646, -3646, -3646, -3646,  3763,  3763,  3763,  3763,
+     4337,  4337,  4337,  4337,  -354,  -354,  -354,  -354,
+     -875,  -875,  -875,  -875,  3704,  3704,  3704,  3704,
+     2143,  2143,  2143,  2143, -3833, -3833, -3833, -3833,
+    -2566, -2566, -2566, -2566,  1017,  1017,  1017,  1017,
+    -2381, -2381, -2381, -2381,  2481,  2481,  2481,  2481,
+    -5011, -5011, -5011, -5011, -4714, -4714, -4714, -4714,
+    -1168, -1168, -1168, -1168, -2401, -2401, -2401, -2401,
+     2987,  2987,  2987,  2987, -3066, -3066, -3066, -3066,
+     1378,  1378,  1378,  1378, -2912, -2912, -2912, -2912,
+    -4976, -4976, -4976, -4976,   545,   545,   545,   545,
+     4645,  4645,  4645,  4645,  -773,  -773,  -773,  -773,
+     6039,  6039,  6039,  6039, -1632, -1632, -1632, -1632,
+     -493,  -493,  -493,  -493, -1045, -1045, -1045, -1045,
+    -4284, -4284, -4284, -4284,   242,   242,   242,   242,
+    -1207, -1207, -1207, -1207, -5101, -5101, -5101, -5101,
+    -2437, -2437, -2437, -2437,  1440,  1440,  1440,  1440,
+      435,   435,   435,   435, -4861, -4861, -4861, -4861,
+     3780,  3780,  3780,  3780,  2678,  2678,  2678,  2678,
+     1065,  1065,  1065,  1065,  3778,  3778,  3778,  3778,
+    -2187, -2187, -2187, -2187, -4885, -4885, -4885, -4885,
+    -5444, -5444, -5444, -5444,  5012,  5012,  5012,  5012,
+     1002,  1002,  1002,  1002,  4143,  4143,  4143,  4143,
+    -5277, -5277, -5277, -5277,  -442,  -442,  -442,  -442,
+    -6022, -6022, -6022, -6022,   -27,   -27,   -27,   -27,
+     1912,  1912,  1912,  1912,  5698,  5698,  5698,  5698,
+    -1607, -1607, -1607, -1607,  5019,  5019,  5019,  5019,
+     -404,  -404,  -404,  -404,   390,   390,   390,   390,
+     2422,  2422,  2422,  2422,  5084,  5084,  5084,  5084,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev_ct_cg[2304] = {
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev_gs_cg[2304] = {
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444, -4096,  -493, -2381, -5444,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096,  -493, -4096,  -493, -4096,  -493, -4096,  -493,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+    -4096, -4096, -4096, -4096, -4096, -4096, -4096, -4096,
+};
+
+const int16_t ntt_red512_mixed_powers_ct_cg[2304] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     5444,  5444,  5444,  5444,  5444,  5444,  5444,  5444,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+     2381,  2381,  2381,  2381,  2381,  2381,  2381,  2381,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+    -1912, -1912, -1912, -1912, -1912, -1912, -1912, -1912,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+     -435,  -435,  -435,  -435,  -435,  -435,  -435,  -435,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -1378, -1378, -1378, -1378, -1378, -1378, -1378, -1378,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+    -4337, -4337, -4337, -4337, -4337, -4337, -4337, -4337,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+      404,   404,   404,   404,   404,   404,   404,   404,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+     5277,  5277,  5277,  5277,  5277,  5277,  5277,  5277,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+    -1065, -1065, -1065, -1065, -1065, -1065, -1065, -1065,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+     1207,  1207,  1207,  1207,  1207,  1207,  1207,  1207,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+    -4645, -4645, -4645, -4645, -4645, -4645, -4645, -4645,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+     1168,  1168,  1168,  1168,  1168,  1168,  1168,  1168,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+    -2143, -2143, -2143, -2143, -2143, -2143, -2143, -2143,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+     3248,  3248,  3248,  3248,  3248,  3248,  3248,  3248,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+    -2422, -2422, -2422, -2422, -2422, -2422, -2422, -2422,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     1607,  1607,  1607,  1607,  1607,  1607,  1607,  1607,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+     6022,  6022,  6022,  6022,  6022,  6022,  6022,  6022,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+    -1002, -1002, -1002, -1002, -1002, -1002, -1002, -1002,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+     2187,  2187,  2187,  2187,  2187,  2187,  2187,  2187,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+    -3780, -3780, -3780, -3780, -3780, -3780, -3780, -3780,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     2437,  2437,  2437,  2437,  2437,  2437,  2437,  2437,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+     4284,  4284,  4284,  4284,  4284,  4284,  4284,  4284,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+    -6039, -6039, -6039, -6039, -6039, -6039, -6039, -6039,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+     4976,  4976,  4976,  4976,  4976,  4976,  4976,  4976,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+    -2987, -2987, -2987, -2987, -2987, -2987, -2987, -2987,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     5011,  5011,  5011,  5011,  5011,  5011,  5011,  5011,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+     2566,  2566,  2566,  2566,  2566,  2566,  2566,  2566,
+      875,   875,   875,   875,   875,   875,   875,   875,
+      875,   875,   875,   875,   875,   875,   875,   875,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+     3646,  3646,  3646,  3646,  3646,  3646,  3646,  3646,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5088, -5088, -5088, -5088, -5088, -5088, -5088, -5088,
+    -5084, -5084, -5084, -5084, -5084, -5084, -5084, -5084,
+     -390,  -390,  -390,  -390,  -390,  -390,  -390,  -390,
+    -5019, -5019, -5019, -5019, -5019, -5019, -5019, -5019,
+    -5698, -5698, -5698, -5698, -5698, -5698, -5698, -5698,
+       27,    27,    27,    27,    27,    27,    27,    27,
+      442,   442,   442,   442,   442,   442,   442,   442,
+    -4143, -4143, -4143, -4143, -4143, -4143, -4143, -4143,
+    -5012, -5012, -5012, -5012, -5012, -5012, -5012, -5012,
+     4885,  4885,  4885,  4885,  4885,  4885,  4885,  4885,
+    -3778, -3778, -3778, -3778, -3778, -3778, -3778, -3778,
+    -2678, -2678, -2678, -2678, -2678, -2678, -2678, -2678,
+     4861,  4861,  4861,  4861,  4861,  4861,  4861,  4861,
+    -1440, -1440, -1440, -1440, -1440, -1440, -1440, -1440,
+     5101,  5101,  5101,  5101,  5101,  5101,  5101,  5101,
+     -242,  -242,  -242,  -242,  -242,  -242,  -242,  -242,
+     1045,  1045,  1045,  1045,  1045,  1045,  1045,  1045,
+     1632,  1632,  1632,  1632,  1632,  1632,  1632,  1632,
+      773,   773,   773,   773,   773,   773,   773,   773,
+     -545,  -545,  -545,  -545,  -545,  -545,  -545,  -545,
+     2912,  2912,  2912,  2912,  2912,  2912,  2912,  2912,
+     3066,  3066,  3066,  3066,  3066,  3066,  3066,  3066,
+     2401,  2401,  2401,  2401,  2401,  2401,  2401,  2401,
+     4714,  4714,  4714,  4714,  4714,  4714,  4714,  4714,
+    -2481, -2481, -2481, -2481, -2481, -2481, -2481, -2481,
+    -1017, -1017, -1017, -1017, -1017, -1017, -1017, -1017,
+     3833,  3833,  3833,  3833,  3833,  3833,  3833,  3833,
+    -3704, -3704, -3704, -3704, -3704, -3704, -3704, -3704,
+      354,   354,   354,   354,   354,   354,   354,   354,
+    -3763, -3763, -3763, -3763, -3763, -3763, -3763, -3763,
+    -1067, -1067, -1067, -1067, -1067, -1067, -1067, -1067,
+    -1537, -1537, -1537, -1537, -1537, -1537, -1537, -1537,
+    -2859, -2859, -2859, -2859, -2859, -2859, -2859, -2859,
+     4654,  4654,  4654,  4654, -1544, -1544, -1544, -1544,
+     3364,  3364,  3364,  3364, -1153, -1153, -1153, -1153,
+       -3,    -3,    -3,    -3, -3400, -3400, -3400, -3400,
+    -2780, -2780, -2780, -2780,  3510,  3510,  3510,  3510,
+    -3636, -3636, -3636, -3636, -3985, -3985, -3985, -3985,
+    -2174, -2174, -2174, -2174,  2126,  2126,  2126,  2126,
+     4919,  4919,  4919,  4919,  -243,  -243,  -243,  -243,
+    -5042, -5042, -5042, -5042, -3978, -3978, -3978, -3978,
+     1663,  1663,  1663,  1663,   420,   420,   420,   420,
+    -3271, -3271, -3271, -3271, -4048, -4048, -4048, -4048,
+      160,   160,   160,   160,  5191,  5191,  5191,  5191,
+     4895,  4895,  4895,  4895, -2865, -2865, -2865, -2865,
+    -2704, -2704, -2704, -2704,  -476,  -476,  -476,  -476,
+    -2847, -2847, -2847, -2847,  5407,  5407,  5407,  5407,
+     3915,  3915,  3915,  3915,   671,   671,   671,   671,
+     2645,  2645,  2645,  2645,  3247,  3247,  3247,  3247,
+     1426,  1426,  1426,  1426,  2178,  2178,  2178,  2178,
+    -1689, -1689, -1689, -1689,  2884,  2884,  2884,  2884,
+    -4437, -4437, -4437, -4437, -2399, -2399, -2399, -2399,
+     5195,  5195,  5195,  5195,  5332,  5332,  5332,  5332,
+     4938,  4938,  4938,  4938,  4905,  4905,  4905,  4905,
+     4372,  4372,  4372,  4372, -1630, -1630, -1630, -1630,
+      113,   113,   113,   113, -3016, -3016, -3016, -3016,
+     2305,  2305,  2305,  2305,  2969,  2969,  2969,  2969,
+     1777,  1777,  1777,  1777, -5559, -5559, -5559, -5559,
+     4057,  4057,  4057,  4057, -2249, -2249, -2249, -2249,
+     3149,  3149,  3149,  3149, -3136, -3136, -3136, -3136,
+     1484,  1484,  1484,  1484,  2370,  2370,  2370,  2370,
+    -5291, -5291, -5291, -5291, -3531, -3531, -3531, -3531,
+     4414,  4414,  4414,  4414, -3186, -3186, -3186, -3186,
+     2166,  2166,  2166,  2166, -3000, -3000, -3000, -3000,
+     4053,  4053,  4053,  4053, -2686, -2686, -2686, -2686,
+     -563,  -563,  4354,  4354, -3135, -3135,  2548,  2548,
+    -1479, -1479, -4278, -4278, -4896, -4896,  5755,  5755,
+     5828,  5828,  5067,  5067, -2319, -2319,  3637,  3637,
+     1646,  1646,  1022,  1022,  1635,  1635, -5092, -5092,
+    -2639, -2639, -3296, -3296,  3553,  3553, -3707, -3707,
+     4134,  4134, -2525, -2525,  3091,  3091, -2426, -2426,
+    -3328, -3328,  -827,  -827,  5086,  5086,  4890,  4890,
+    -3504, -3504,  -339,  -339, -1853, -1853, -3241, -3241,
+    -2744, -2744,  5374,  5374, -4846, -4846,  3382,  3382,
+     5146,  5146, -5331, -5331,  3051,  3051,  4388,  4388,
+     4591,  4591,   118,   118,   790,   790, -5542, -5542,
+    -5860, -5860,  2842,  2842, -1177, -1177, -2881, -2881,
+    -2625, -2625, -4452, -4452, -1062, -1062,  5179,  5179,
+      722,   722,  3584,  3584, -1000, -1000, -1696, -1696,
+     1351,  1351,  -953,  -953,  3201,  3201, -2731, -2731,
+     2545,  2545,  5791,  5791,  4611,  4611, -3289, -3289,
+     2975,  2975,   130,   130, -3712, -3712, -4231, -4231,
+        1,     1,  1673,  1673, -2963, -2963, -4632, -4632,
+     5023,  5023, -2197, -2197, -1170, -1170, -3459, -3459,
+     1212,  1212,    -9,    -9, -2768, -2768,  2089,  2089,
+     4821,  4821,  3949,  3949, -4805, -4805, -1759, -1759,
+    -5736, -5736,  1381,  1381,    81,    81,   334,   334,
+     5777,  5777,  5767,  5767,  1326,  1326, -5911, -5911,
+     3542,  3542,  2468,  2468,  -140,  -140,  -729,  -729,
+    -3006, -3006, -2837, -2837, -2747, -2747,   355,   355,
+     4043,  4043,  4989,  4989,  2366,  2366,  1260,  1260,
+    -5728, -5728,  2476,  2476,   955,   955,   145,   145,
+    -3195, -3195,   480,   480,  4255,  4255,  3284,  3284,
+      949,   949,  2396,  2396,  2294,  2294,  3694,  3694,
+    -1305, -1305,  4177,  4177, -4320, -4320, -1428, -1428,
+    -4978, -4978,  3748,  3748,  3014,  3014,  3932,  3932,
+     3621,  3621,  -544,  -544,  -726,  -726,  2013,  2013,
+    -3762,   605, -1858,  4467,   683,  1579,  -218,  -468,
+     3956,  3532, -5383, -1973,  2078,  4912, -1293, -3565,
+     -325, -4080, -3009, -5445,  4433, -3336,  6142, -1922,
+     1962,  4212,  1263,  5079,  -709,  5468,  5876,  4948,
+     -652, -4782,  2925,  -147,  2503,  -151, -3030,  5446,
+    -6122,  5009, -5369, -1041,   922,  3445, -5908,   -56,
+    -3728,  4624,  5868, -6118, -1747,  1323,  2051,  1359,
+     2692,   142,  5942,  4075,  -835, -2920,  3991,  5862,
+     4016,   504, -3315, -4749, -3656,  5906,  3434,   382,
+     6119,    58,   350, -1278, -4322,   192, -4774,  1702,
+      948, -3602,   723, -4536,  5257,  5874, -3963, -3998,
+     5961, -3438, -5915,  -522, -3150,  -787,  2031, -1728,
+     6099, -3029,  3757, -4449,  5782,  3957,  1843, -3710,
+    -1200,  -885, -4493, -5925,  4079,  4698,  3772, -5206,
+    -5990,  3263, -5735,  2683,  3054,  3174, -2882,  1254,
+    -4298, -3477, -1489, -4324,  3570,  4169,   156, -5415,
+     2919, -2302,  4754, -4789,  2459,   431, -2908, -3988,
+     1360,  1003,  1815, -5574,  1112,  2049,  4737,  -654,
+    -1404,  -421, -1693, -3860, -5919, -6055,  2447, -3879,
+     1594,  -975,    49,  3262, -4046,  1010,  2281,  6137,
+    -5766,  5886,   347,  3789,  2948, -2127,  4115,  5339,
+     2555, -1956, -2057, -3514,  -441, -4780,  -453,  3199,
+     4049, -6077,  2738, -3818, -3123,  2766, -1954, -5435,
+     -168,  1105,  1583,  5315, -6065, -5241,  3969, -6136,
+     4077, -4213,   426,  5537,   -64, -2505,  3529,  -316,
+     5297,  -241,  1512,  2344, -1958,  1321,  5429, -1987,
+     1146,  6068,   174,  1050, -3834,  -677,   576, -2033,
+     5106,  2844,  1483,  2169, -1319,  3482,  5333,   400,
+      295,  5594,  1975, -5456, -1566,  2839, -2361,  6093,
+    -5184,  6008,  3202, -1018, -1058,  5057,  -418,  5529,
+     1159, -3600, -2655, -1190, -5486,   -52,  1805,  -973,
+    -3329, -5681, -2500, -4916, -4240, -3127, -2767,  3643,
+};
+
+const int16_t ntt_red512_mixed_powers_rev_ct_cg[2304] = {
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+      493,   493,   493,   493,   493,   493,   493,   493,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+     5444,  2381,  5444,  2381,  5444,  2381,  5444,  2381,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+    -1912, -1378,  -435, -4337, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     4654,  1426,  1663,  1777, -3636,  4938, -2704, -5291,
+       -3, -4437,   160,  3149,  4919,   113,  3915,  2166,
+     3364, -1689, -3271,  4057, -2174,  4372, -2847,  4414,
+    -2780,  5195,  4895,  1484, -5042,  2305,  2645,  4053,
+    -1544,  2178,   420, -5559, -3985,  4905,  -476, -3531,
+    -3400, -2399,  5191, -3136,  -243, -3016,   671, -3000,
+    -1153,  2884, -4048, -2249,  2126, -1630,  5407, -3186,
+     3510,  5332, -2865,  2370, -3978,  2969,  3247, -2686,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+     -563,  2975, -2744, -3006, -2639,  4821, -2625,   949,
+     5828,  5023,  4591, -5728, -3328,  5777,  1351, -4978,
+    -1479,     1,  5146,  4043,  4134, -5736,   722, -1305,
+     1646,  1212, -5860, -3195, -3504,  3542,  2545,  3621,
+    -3135, -3712, -4846, -2747,  3553, -4805, -1062,  2294,
+    -2319, -1170,   790,   955,  5086,  1326,  3201,  3014,
+    -4896, -2963,  3051,  2366,  3091,    81, -1000, -4320,
+     1635, -2768, -1177,  4255, -1853,  -140,  4611,  -726,
+     4354,   130,  5374, -2837, -3296,  3949, -4452,  2396,
+     5067, -2197,   118,  2476,  -827,  5767,  -953,  3748,
+    -4278,  1673, -5331,  4989, -2525,  1381,  3584,  4177,
+     1022,    -9,  2842,   480,  -339,  2468,  5791,  -544,
+     2548, -4231,  3382,   355, -3707, -1759,  5179,  3694,
+     3637, -3459, -5542,   145,  4890, -5911, -2731,  3932,
+     5755, -4632,  4388,  1260, -2426,   334, -1696, -1428,
+    -5092,  2089, -2881,  3284, -3241,  -729, -3289,  2013,
+    -3762,  2919,  4016,  4077,  -652, -5766,  6099,   295,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+     3956,  1360,  6119,  5297, -6122,  2555, -1200, -5184,
+     1962,  1594,  5961,  5106,  2692,  -168, -4298, -3329,
+      683,  2459, -3656,   -64,  2503,  2948,  5782, -1566,
+     4433, -5919,  5257, -3834, -1747, -3123,  3054, -5486,
+     2078,  1112, -4322, -1958,   922,  -441,  4079, -1058,
+     -709, -4046, -3150, -1319,  -835, -6065,  3570, -4240,
+    -1858,  4754, -3315,   426,  2925,   347,  3757,  1975,
+    -3009, -1693,   723,   174,  5868,  2738, -5735, -2655,
+    -5383,  1815,   350,  1512, -5369, -2057, -4493,  3202,
+     1263,    49, -5915,  1483,  5942,  1583, -1489, -2500,
+     -218, -2908,  3434,  3529, -3030,  4115,  1843, -2361,
+     6142,  2447, -3963,   576,  2051, -1954, -2882,  1805,
+    -1293,  4737, -4774,  5429, -5908,  -453,  3772,  -418,
+     5876,  2281,  2031,  5333,  3991,  3969,   156, -2767,
+      605, -2302,   504, -4213, -4782,  5886, -3029,  5594,
+    -4080,  -421, -3602,  6068,  4624, -6077,  3263, -3600,
+     3532,  1003,    58,  -241,  5009, -1956,  -885,  6008,
+     4212,  -975, -3438,  2844,   142,  1105, -3477, -5681,
+     1579,   431,  5906, -2505,  -151, -2127,  3957,  2839,
+    -3336, -6055,  5874,  -677,  1323,  2766,  3174,   -52,
+     4912,  2049,   192,  1321,  3445, -4780,  4698,  5057,
+     5468,  1010,  -787,  3482, -2920, -5241,  4169, -3127,
+     4467, -4789, -4749,  5537,  -147,  3789, -4449, -5456,
+    -5445, -3860, -4536,  1050, -6118, -3818,  2683, -1190,
+    -1973, -5574, -1278,  2344, -1041, -3514, -5925, -1018,
+     5079,  3262,  -522,  2169,  4075,  5315, -4324, -4916,
+     -468, -3988,   382,  -316,  5446,  5339, -3710,  6093,
+    -1922, -3879, -3998, -2033,  1359, -5435,  1254,  -973,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     4948,  6137, -1728,   400,  5862, -6136, -5415,  3643,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_gs_cg[2304] = {
+    -3643,  2767,  3127,  4240,  4916,  2500,  5681,  3329,
+      973, -1805,    52,  5486,  1190,  2655,  3600, -1159,
+    -5529,   418, -5057,  1058,  1018, -3202, -6008,  5184,
+    -6093,  2361, -2839,  1566,  5456, -1975, -5594,  -295,
+     -400, -5333, -3482,  1319, -2169, -1483, -2844, -5106,
+     2033,  -576,   677,  3834, -1050,  -174, -6068, -1146,
+     1987, -5429, -1321,  1958, -2344, -1512,   241, -5297,
+      316, -3529,  2505,    64, -5537,  -426,  4213, -4077,
+     6136, -3969,  5241,  6065, -5315, -1583, -1105,   168,
+     5435,  1954, -2766,  3123,  3818, -2738,  6077, -4049,
+    -3199,   453,  4780,   441,  3514,  2057,  1956, -2555,
+    -5339, -4115,  2127, -2948, -3789,  -347, -5886,  5766,
+    -6137, -2281, -1010,  4046, -3262,   -49,   975, -1594,
+     3879, -2447,  6055,  5919,  3860,  1693,   421,  1404,
+      654, -4737, -2049, -1112,  5574, -1815, -1003, -1360,
+     3988,  2908,  -431, -2459,  4789, -4754,  2302, -2919,
+     5415,  -156, -4169, -3570,  4324,  1489,  3477,  4298,
+    -1254,  2882, -3174, -3054, -2683,  5735, -3263,  5990,
+     5206, -3772, -4698, -4079,  5925,  4493,   885,  1200,
+     3710, -1843, -3957, -5782,  4449, -3757,  3029, -6099,
+     1728, -2031,   787,  3150,   522,  5915,  3438, -5961,
+     3998,  3963, -5874, -5257,  4536,  -723,  3602,  -948,
+    -1702,  4774,  -192,  4322,  1278,  -350,   -58, -6119,
+     -382, -3434, -5906,  3656,  4749,  3315,  -504, -4016,
+    -5862, -3991,  2920,   835, -4075, -5942,  -142, -2692,
+    -1359, -2051, -1323,  1747,  6118, -5868, -4624,  3728,
+       56,  5908, -3445,  -922,  1041,  5369, -5009,  6122,
+    -5446,  3030,   151, -2503,   147, -2925,  4782,   652,
+    -4948, -5876, -5468,   709, -5079, -1263, -4212, -1962,
+     1922, -6142,  3336, -4433,  5445,  3009,  4080,   325,
+     3565,  1293, -4912, -2078,  1973,  5383, -3532, -3956,
+      468,   218, -1579,  -683, -4467,  1858,  -605,  3762,
+    -2013, -2013,   726,   726,   544,   544, -3621, -3621,
+    -3932, -3932, -3014, -3014, -3748, -3748,  4978,  4978,
+     1428,  1428,  4320,  4320, -4177, -4177,  1305,  1305,
+    -3694, -3694, -2294, -2294, -2396, -2396,  -949,  -949,
+    -3284, -3284, -4255, -4255,  -480,  -480,  3195,  3195,
+     -145,  -145,  -955,  -955, -2476, -2476,  5728,  5728,
+    -1260, -1260, -2366, -2366, -4989, -4989, -4043, -4043,
+     -355,  -355,  2747,  2747,  2837,  2837,  3006,  3006,
+      729,   729,   140,   140, -2468, -2468, -3542, -3542,
+     5911,  5911, -1326, -1326, -5767, -5767, -5777, -5777,
+     -334,  -334,   -81,   -81, -1381, -1381,  5736,  5736,
+     1759,  1759,  4805,  4805, -3949, -3949, -4821, -4821,
+    -2089, -2089,  2768,  2768,     9,     9, -1212, -1212,
+     3459,  3459,  1170,  1170,  2197,  2197, -5023, -5023,
+     4632,  4632,  2963,  2963, -1673, -1673,    -1,    -1,
+     4231,  4231,  3712,  3712,  -130,  -130, -2975, -2975,
+     3289,  3289, -4611, -4611, -5791, -5791, -2545, -2545,
+     2731,  2731, -3201, -3201,   953,   953, -1351, -1351,
+     1696,  1696,  1000,  1000, -3584, -3584,  -722,  -722,
+    -5179, -5179,  1062,  1062,  4452,  4452,  2625,  2625,
+     2881,  2881,  1177,  1177, -2842, -2842,  5860,  5860,
+     5542,  5542,  -790,  -790,  -118,  -118, -4591, -4591,
+    -4388, -4388, -3051, -3051,  5331,  5331, -5146, -5146,
+    -3382, -3382,  4846,  4846, -5374, -5374,  2744,  2744,
+     3241,  3241,  1853,  1853,   339,   339,  3504,  3504,
+    -4890, -4890, -5086, -5086,   827,   827,  3328,  3328,
+     2426,  2426, -3091, -3091,  2525,  2525, -4134, -4134,
+     3707,  3707, -3553, -3553,  3296,  3296,  2639,  2639,
+     5092,  5092, -1635, -1635, -1022, -1022, -1646, -1646,
+    -3637, -3637,  2319,  2319, -5067, -5067, -5828, -5828,
+    -5755, -5755,  4896,  4896,  4278,  4278,  1479,  1479,
+    -2548, -2548,  3135,  3135, -4354, -4354,   563,   563,
+     2686,  2686,  2686,  2686, -4053, -4053, -4053, -4053,
+     3000,  3000,  3000,  3000, -2166, -2166, -2166, -2166,
+     3186,  3186,  3186,  3186, -4414, -4414, -4414, -4414,
+     3531,  3531,  3531,  3531,  5291,  5291,  5291,  5291,
+    -2370, -2370, -2370, -2370, -1484, -1484, -1484, -1484,
+     3136,  3136,  3136,  3136, -3149, -3149, -3149, -3149,
+     2249,  2249,  2249,  2249, -4057, -4057, -4057, -4057,
+     5559,  5559,  5559,  5559, -1777, -1777, -1777, -1777,
+    -2969, -2969, -2969, -2969, -2305, -2305, -2305, -2305,
+     3016,  3016,  3016,  3016,  -113,  -113,  -113,  -113,
+     1630,  1630,  1630,  1630, -4372, -4372, -4372, -4372,
+    -4905, -4905, -4905, -4905, -4938, -4938, -4938, -4938,
+    -5332, -5332, -5332, -5332, -5195, -5195, -5195, -5195,
+     2399,  2399,  2399,  2399,  4437,  4437,  4437,  4437,
+    -2884, -2884, -2884, -2884,  1689,  1689,  1689,  1689,
+    -2178, -2178, -2178, -2178, -1426, -1426, -1426, -1426,
+    -3247, -3247, -3247, -3247, -2645, -2645, -2645, -2645,
+     -671,  -671,  -671,  -671, -3915, -3915, -3915, -3915,
+    -5407, -5407, -5407, -5407,  2847,  2847,  2847,  2847,
+      476,   476,   476,   476,  2704,  2704,  2704,  2704,
+     2865,  2865,  2865,  2865, -4895, -4895, -4895, -4895,
+    -5191, -5191, -5191, -5191,  -160,  -160,  -160,  -160,
+     4048,  4048,  4048,  4048,  3271,  3271,  3271,  3271,
+     -420,  -420,  -420,  -420, -1663, -1663, -1663, -1663,
+     3978,  3978,  3978,  3978,  5042,  5042,  5042,  5042,
+      243,   243,   243,   243, -4919, -4919, -4919, -4919,
+    -2126, -2126, -2126, -2126,  2174,  2174,  2174,  2174,
+     3985,  3985,  3985,  3985,  3636,  3636,  3636,  3636,
+    -3510, -3510, -3510, -3510,  2780,  2780,  2780,  2780,
+     3400,  3400,  3400,  3400,     3,     3,     3,     3,
+     1153,  1153,  1153,  1153, -3364, -3364, -3364, -3364,
+     1544,  1544,  1544,  1544, -4654, -4654, -4654, -4654,
+     2859,  2859,  2859,  2859,  2859,  2859,  2859,  2859,
+     1537,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+     1067,  1067,  1067,  1067,  1067,  1067,  1067,  1067,
+     3763,  3763,  3763,  3763,  3763,  3763,  3763,  3763,
+     -354,  -354,  -354,  -354,  -354,  -354,  -354,  -354,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+    -3833, -3833, -3833, -3833, -3833, -3833, -3833, -3833,
+     1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+     2481,  2481,  2481,  2481,  2481,  2481,  2481,  2481,
+    -4714, -4714, -4714, -4714, -4714, -4714, -4714, -4714,
+    -2401, -2401, -2401, -2401, -2401, -2401, -2401, -2401,
+    -3066, -3066, -3066, -3066, -3066, -3066, -3066, -3066,
+    -2912, -2912, -2912, -2912, -2912, -2912, -2912, -2912,
+      545,   545,   545,   545,   545,   545,   545,   545,
+     -773,  -773,  -773,  -773,  -773,  -773,  -773,  -773,
+    -1632, -1632, -1632, -1632, -1632, -1632, -1632, -1632,
+    -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+      242,   242,   242,   242,   242,   242,   242,   242,
+    -5101, -5101, -5101, -5101, -5101, -5101, -5101, -5101,
+     1440,  1440,  1440,  1440,  1440,  1440,  1440,  1440,
+    -4861, -4861, -4861, -4861, -4861, -4861, -4861, -4861,
+     2678,  2678,  2678,  2678,  2678,  2678,  2678,  2678,
+     3778,  3778,  3778,  3778,  3778,  3778,  3778,  3778,
+    -4885, -4885, -4885, -4885, -4885, -4885, -4885, -4885,
+     5012,  5012,  5012,  5012,  5012,  5012,  5012,  5012,
+     4143,  4143,  4143,  4143,  4143,  4143,  4143,  4143,
+     -442,  -442,  -442,  -442,  -442,  -442,  -442,  -442,
+      -27,   -27,   -27,   -27,   -27,   -27,   -27,   -27,
+     5698,  5698,  5698,  5698,  5698,  5698,  5698,  5698,
+     5019,  5019,  5019,  5019,  5019,  5019,  5019,  5019,
+      390,   390,   390,   390,   390,   390,   390,   390,
+     5084,  5084,  5084,  5084,  5084,  5084,  5084,  5084,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+     5088,  5088,  5088,  5088,  5088,  5088,  5088,  5088,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+    -3646, -3646, -3646, -3646, -3646, -3646, -3646, -3646,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+     -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -2566, -2566, -2566, -2566, -2566, -2566, -2566, -2566,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+    -5011, -5011, -5011, -5011, -5011, -5011, -5011, -5011,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+     2987,  2987,  2987,  2987,  2987,  2987,  2987,  2987,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+    -4976, -4976, -4976, -4976, -4976, -4976, -4976, -4976,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+     6039,  6039,  6039,  6039,  6039,  6039,  6039,  6039,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -4284, -4284, -4284, -4284, -4284, -4284, -4284, -4284,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+     3780,  3780,  3780,  3780,  3780,  3780,  3780,  3780,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+     1002,  1002,  1002,  1002,  1002,  1002,  1002,  1002,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -6022, -6022, -6022, -6022, -6022, -6022, -6022, -6022,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+    -1607, -1607, -1607, -1607, -1607, -1607, -1607, -1607,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+     2422,  2422,  2422,  2422,  2422,  2422,  2422,  2422,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+    -3248, -3248, -3248, -3248, -3248, -3248, -3248, -3248,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+     2143,  2143,  2143,  2143,  2143,  2143,  2143,  2143,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+    -1168, -1168, -1168, -1168, -1168, -1168, -1168, -1168,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+     4645,  4645,  4645,  4645,  4645,  4645,  4645,  4645,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+    -1207, -1207, -1207, -1207, -1207, -1207, -1207, -1207,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+     1065,  1065,  1065,  1065,  1065,  1065,  1065,  1065,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+    -5277, -5277, -5277, -5277, -5277, -5277, -5277, -5277,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     4337,  4337,  4337,  4337,  4337,  4337,  4337,  4337,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+     1378,  1378,  1378,  1378,  1378,  1378,  1378,  1378,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+      435,   435,   435,   435,   435,   435,   435,   435,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+     1912,  1912,  1912,  1912,  1912,  1912,  1912,  1912,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -2381, -2381, -2381, -2381, -2381, -2381, -2381, -2381,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+    -5444, -5444, -5444, -5444, -5444, -5444, -5444, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_rev_gs_cg[2304] = {
+    -3643,  5415,  6136, -5862,  -400,  1728, -6137, -4948,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      973, -1254,  5435, -1359,  2033,  3998,  3879,  1922,
+    -6093,  3710, -5339, -5446,   316,  -382,  3988,   468,
+     4916,  4324, -5315, -4075, -2169,   522, -3262, -5079,
+     1018,  5925,  3514,  1041, -2344,  1278,  5574,  1973,
+     1190, -2683,  3818,  6118, -1050,  4536,  3860,  5445,
+     5456,  4449, -3789,   147, -5537,  4749,  4789, -4467,
+     3127, -4169,  5241,  2920, -3482,   787, -1010, -5468,
+    -5057, -4698,  4780, -3445, -1321,  -192, -2049, -4912,
+       52, -3174, -2766, -1323,   677, -5874,  6055,  3336,
+    -2839, -3957,  2127,   151,  2505, -5906,  -431, -1579,
+     5681,  3477, -1105,  -142, -2844,  3438,   975, -4212,
+    -6008,   885,  1956, -5009,   241,   -58, -1003, -3532,
+     3600, -3263,  6077, -4624, -6068,  3602,   421,  4080,
+    -5594,  3029, -5886,  4782,  4213,  -504,  2302,  -605,
+     2767,  -156, -3969, -3991, -5333, -2031, -2281, -5876,
+      418, -3772,   453,  5908, -5429,  4774, -4737,  1293,
+    -1805,  2882,  1954, -2051,  -576,  3963, -2447, -6142,
+     2361, -1843, -4115,  3030, -3529, -3434,  2908,   218,
+     2500,  1489, -1583, -5942, -1483,  5915,   -49, -1263,
+    -3202,  4493,  2057,  5369, -1512,  -350, -1815,  5383,
+     2655,  5735, -2738, -5868,  -174,  -723,  1693,  3009,
+    -1975, -3757,  -347, -2925,  -426,  3315, -4754,  1858,
+     4240, -3570,  6065,   835,  1319,  3150,  4046,   709,
+     1058, -4079,   441,  -922,  1958,  4322, -1112, -2078,
+     5486, -3054,  3123,  1747,  3834, -5257,  5919, -4433,
+     1566, -5782, -2948, -2503,    64,  3656, -2459,  -683,
+     3329,  4298,   168, -2692, -5106, -5961, -1594, -1962,
+     5184,  1200, -2555,  6122, -5297, -6119, -1360, -3956,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+     -295, -6099,  5766,   652, -4077, -4016, -2919,  3762,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+    -2013,  3289,   729,  3241, -3284,  2881, -2089,  5092,
+     1428,  1696,  -334,  2426, -1260, -4388,  4632, -5755,
+    -3932,  2731,  5911, -4890,  -145,  5542,  3459, -3637,
+    -3694, -5179,  1759,  3707,  -355, -3382,  4231, -2548,
+      544, -5791, -2468,   339,  -480, -2842,     9, -1022,
+    -4177, -3584, -1381,  2525, -4989,  5331, -1673,  4278,
+    -3748,   953, -5767,   827, -2476,  -118,  2197, -5067,
+    -2396,  4452, -3949,  3296,  2837, -5374,  -130, -4354,
+      726, -4611,   140,  1853, -4255,  1177,  2768, -1635,
+     4320,  1000,   -81, -3091, -2366, -3051,  2963,  4896,
+    -3014, -3201, -1326, -5086,  -955,  -790,  1170,  2319,
+    -2294,  1062,  4805, -3553,  2747,  4846,  3712,  3135,
+    -3621, -2545, -3542,  3504,  3195,  5860, -1212, -1646,
+     1305,  -722,  5736, -4134, -4043, -5146,    -1,  1479,
+     4978, -1351, -5777,  3328,  5728, -4591, -5023, -5828,
+     -949,  2625, -4821,  2639,  3006,  2744, -2975,   563,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+     4337,   435,  1378,  1912,  4337,   435,  1378,  1912,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+    -2381, -5444, -2381, -5444, -2381, -5444, -2381, -5444,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+     -493,  -493,  -493,  -493,  -493,  -493,  -493,  -493,
+};
+
+const int16_t ntt_red512_twiddles_4step[512] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  3289, -5791,  -130, -2545, -2975, -4611,  3712,
+    -4284,  -493, -1045, -1632, -2645, -1426, -3247, -2178,
+     2731,  4231,  3289,  4632, -5791, -1673,  -130,  2197,
+    -2545,    -1, -2975, -5023, -4611,  2963,  3712,  1170,
+     2731,  4632,  -130,     9, -4611,  1170,    -1, -4821,
+    -2645,  4437, -2178, -5332,  -493, -4976,  -773, -3066,
+     2731,  3459,  4231,  1759,  3289, -2089,  4632,  -334,
+    -5791,     9, -1673, -1381,  -130, -3949,  2197, -5767,
+     2731, -2089, -1673, -5767, -2975,  5736,  1170,   140,
+    -1045, -3066,  4645, -5011, -2178,  1630, -5195, -1777,
+     2731,  1759,  4632,   729,  -130, -5767,     9, -4989,
+    -4611,   -81,  1170,  2747,    -1, -3542, -4821,  5728,
+     2731,  -334,  2197, -4989,  3712,   140, -4821,  3195,
+    -3247,  3016, -5195, -3149,  -773,  1017,  2987,  4337,
+     2731,  5911,  3459,  -145,  4231,  -355,  1759, -3694,
+     3289,   729, -2089, -3284,  4632, -1260,  -334,  1428,
+     2731,   729,     9, -2396,    -1,  5728,   -81, -3014,
+     -493, -2566, -3066,  1067,  4437, -1484,  3016,  2686,
+     2731,  -355, -2089,  1428, -1673,  -480, -5767,  4354,
+    -2975,  5728,  5736, -3621,  1170, -2294,   140, -4896,
+     2731, -1260, -3949,   544,  2963, -2294, -3542,  5828,
+    -1426, -1484,  1630, -1544, -4976, -3248,  1017, -5698,
+     2731,  -145,  1759,  2548,  4632,  1428,   729, -5092,
+     -130, -2396, -5767,  5067,     9,   544, -4989, -2525,
+     2731, -3284, -1381,  5067, -5023, -3621,  2747,  3091,
+    -1632,  1067, -5011, -1912, -5332, -1544, -3149, -5042,
+     2731, -3694,  -334, -5092,  2197,  4354, -4989,  -339,
+     3712, -3014,   140,  3091, -4821,  5828,  3195,  5146,
+     2731,  1428, -5767, -2525,  1170, -4896,  5728,  5146,
+    -2178,  2686, -1777, -5042, -3066, -5698,  4337, -3780,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+     4231,  2548,  -355,  3382,  1759, -3707, -3694,  5179,
+     2731, -2013, -2468,  5374, -1212, -2639, -4255, -1062,
+     6039,   404, -3833, -2678, -4372,  4919,  3186,   671,
+     2731,  2548,   729,  4388,     9, -2525, -2396,  -953,
+       -1,  1646,  5728, -2625,   -81, -1853, -3014, -3712,
+     2731,  5755,  2837,  2842,  2768,  5086,  1305,  2975,
+     1689, -3636,  3136,  5407, -1168,  2187,  2859,  -545,
+     2731,  3637,  -355,  5179, -2089, -3241,  1428, -4632,
+    -1673, -2525,  -480,  5791, -5767,   118,  4354,  3949,
+     2731, -5092, -4989,  -953, -4821,  5146, -3014, -2768,
+     -773, -4143,  4337, -6039,  3016, -2865,  3364,   113,
+     2731, -3707, -1260, -3289, -3949,   118,   544,  1381,
+     2963, -1853, -2294, -1170, -3542,   722,  5828, -3006,
+     2731, -2426, -2476,  1673,  4805, -1177,  -563,  3542,
+    -2884,   420, -4414,  4938,  2481,  -242,  1607, -2143,
+     2731,  4890,  -145, -3459,  1759,  5179,  2548,   355,
+     4632,  4388,  1428,   334,   729, -3289, -5092,  3284,
+     2731, -3241,  -480,  3949,  5736,  1351, -4896,   955,
+     4645, -3780,  1537, -2481, -1777, -1689, -3985, -3186,
+     2731,  3382, -3284,   334, -1381,  5791,  5067,  2396,
+    -5023, -2625, -3621,  4043,  2747, -1170,  3091,  -726,
+     2731,  4388, -2396,  2468,   -81, -3712,  1646, -4978,
+     4437, -2847,  2686, -3136, -2566, -1378, -4143,   390,
+     2731, -5542, -3694,   355,  -334, -4632, -5092,  2013,
+     2197,  -953,  4354,  2396, -4989,  1381,  -339, -1022,
+     2731, -2881, -4177,  2476, -5777,  1212,  3553,  4896,
+      545,  1045, -2422,  3248,  2249, -3016,  1663,  2174,
+     2731,  5179,  1428,  3284, -5767,  3949, -2525, -1022,
+     1170, -3712, -4896,  -726,  5728, -3006,  5146,  3504,
+     2731, -1696, -3748,  4177, -1326,    81, -3328, -4134,
+     2399,  2884,    -3, -3364,  3704,  3833, -1065, -2187,
+};
+
+const int16_t ntt_red512_inv_twiddles_4step[512] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  1696,   953, -3584, -3201,  1000, -1351,  -722,
+     -671, -5407, -3915,  2847,   242, -5101, -1207, -2437,
+     2731, -5179,  1696,  2881,   953,  4452, -3584, -2842,
+    -3201,  1062,  1000,  1177, -1351,  2625,  -722,  5860,
+     2731,  2881, -3584,  -118, -1351,  5860,  1062, -3051,
+      242, -4861, -2437,  1065, -5407, -5191,  2704,  3271,
+     2731,  5542, -5179, -3382,  1696, -4388,  2881,  3241,
+      953,  -118,  4452, -5374, -3584,  5331, -2842,   339,
+     2731, -4388,  4452,   339,  1000,  4846,  5860,  3328,
+    -3915,  3271,  2865,   243, -2437, -5444,  2678,  -442,
+     2731, -3382,  2881,  2426, -3584,   339,  -118,  3296,
+    -1351,  2744,  5860, -4134,  1062, -5086, -3051, -1635,
+     2731,  3241, -2842,  3296,  -722,  3328, -3051,  2319,
+    -1207,  1002,  2678,  5698,  2704,  2174,  -420,  1153,
+     2731, -4890,  5542, -3637, -5179,  3707, -3382, -2548,
+     1696,  2426, -4388, -5755,  2881,  5092,  3241,  2013,
+     2731,  2426,  -118,  4278,  1062, -1635,  2744,  3621,
+    -5407,  3985,  3271, -4654, -4861,  5019,  1002,  3248,
+     2731,  3707, -4388,  2013,  4452, -5067,   339,  4177,
+     1000, -1635,  4846,  3014,  5860,  1479,  3328,   949,
+     2731,  5092,  5331,  3748,  2625,  1479, -5086,  4255,
+    -5101,  5019, -5444,  3646, -5191, -2686,  2174,  3149,
+     2731, -3637, -3382,  3694,  2881,  2013,  2426,  1260,
+    -3584,  4278,   339,   480,  -118,  3748,  3296, -2837,
+     2731, -5755, -5374,   480,  1177,  3014, -4134, -3006,
+     2847, -4654,   243, -2249,  1065,  3646,  5698,  4714,
+     2731, -2548,  3241,  1260, -2842,  4177,  3296,  5767,
+     -722,  3621,  3328, -3006, -3051,  4255,  2319, -4805,
+     2731,  2013,   339, -2837,  5860,   949, -1635, -4805,
+    -2437,  3248,  -442,  4714,  3271,  3149,  1153, -2399,
+     2731,  3932, -4890, -5911,  5542,   145, -3637, -3459,
+    -5179,  3694,  3707, -1759, -3382,   355, -2548, -4231,
+     2731, -1428,   827,  1381,  -790,  2366, -5828,     1,
+      476,  2370,  3636,  5195, -4885, -2481,  4096,  4284,
+     2731,  3694,  2426,  2089,  -118, -2837,  4278,  5791,
+     1062,   955, -1635, -2963,  2744,  5777,  3621,   722,
+     2731,  3284,  2525, -2197, -4591,  3542,  3135, -1000,
+     1440,  3833, -1607,   493,  3978,  4905,  2166,  4895,
+     2731,   145,  3707, -4231, -4388,   334,  2013, -2881,
+     4452, -2837, -5067,  -953,   339,    -9,  4177, -5331,
+     2731,  1260,  3296,  5791, -3051, -4805,  3621,  4591,
+     2704,  2305,  1153,  -476,  1002, -4645, -3763, -5012,
+     2731,   355,  5092, -1696,  5331,    -9,  3748,  5374,
+     2625,  5777,  1479, -5860, -5086, -3712,  4255,  3091,
+     2731,  -729, -1022, -4452, -5146,  5023, -4320,  5086,
+      435, -2987,  5084, -3778, -4919,  2645, -3136,  3510,
+     2731, -5911, -3637, -5542, -3382, -4231,  3694, -3707,
+     2881,  2089,  2013, -3241,  2426, -1696,  1260,  5755,
+     2731,   334, -5067, -5331,  4846,  4611,   949,  1646,
+     2865, -2399,  4053,  4919,  -442, -1440,  2566, -4096,
+     2731, -1759, -5755, -3241, -5374,  -953,   480, -4278,
+     1177, -2963,  3014,  3553, -4134, -5860, -3006,  4978,
+     2731,  2089,  4278,  -827,  2744,   722,   955,   726,
+    -4861,  1632,  3248,  1607,  3985, -4048,  2305,  5291,
+     2731, -3459, -2548, -3707,  3241, -2881,  1260,  1428,
+    -2842,  5791,  4177, -4278,  3296,  5374,  5767, -2476,
+     2731, -4632, -4354,  1022,  1853,   790,  4043,  -949,
+    -4895,  3915, -3531,  2686,  1912, -1002,  2401,  1017,
+     2731, -4231,  2013,  5755,   339, -5331, -2837, -2476,
+     5860,   722,   949,  4978, -1635,  3091, -4805, -1326,
+     2731, -3289,  -544,  4354,  3504, -2744,  -140,  2747,
+     3780,  -435,   354,  3763,  2780, -3636,  5332, -4905,
+};
+
+const int16_t ntt_red512_mixed_twiddles_4step[512] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+    -1254,  5415,  4324,  4789,  3477,  2302, -4169,  -431,
+     4298, -2919, -3570, -2459,  1489, -4754,  -156,  2908,
+    -4284,  6039,  -493,  4645, -1045,  -773, -1632,   545,
+    -2645,  1689, -1426,  4437, -3247, -2884, -2178,  2399,
+     4298,  1404, -2459,  4046,  -156, -2447, -1815,  -347,
+     4324,  3860,  3988, -6137,  2302,   975, -2049,  2127,
+    -2545, -1212,    -1,  5736, -2975, -4821, -5023, -5777,
+    -4611,  2768,  2963,   -81,  3712,  4805,  1170, -1326,
+     3477, -5886, -2049, -2766,  4789,  3514,  3879,  6136,
+     -156, -4115,  1693, -1583, -1360, -4049,  4046,    64,
+    -2645, -4372,  4437, -1777, -2178,  3016, -5332,  2249,
+     -493, -1168, -4976, -2566,  -773,  2481, -3066,  3704,
+     1489, -2738, -2447, -5429, -1360, -4077, -2948,  1319,
+     2302, -1105, -1010,   677,   654,   316,  3514,  5456,
+    -5791, -2468,     9,  -480, -1673, -4989, -1381, -4177,
+     -130,  2837, -3949, -2396,  2197, -2476, -5767, -3748,
+     4324, -5537, -6137, -6093, -2049,   677,  6077,  5681,
+    -2459,  1958, -2555, -1159, -2447, -5333, -1583, -1858,
+    -1045, -3833, -3066,  1537,  4645,  4337, -5011, -2422,
+    -2178,  3136,  1630,  2686, -5195, -4414, -1777,    -3,
+    -3570,  3834, -2555, -3762,  1693, -3202, -3969,  6142,
+     3988,  -400,  3818, -1973, -1010,    52,   241, -4782,
+    -4611, -4255,   -81, -4896,  1170, -3014,  2747,  3553,
+       -1,  1305, -3542,  1646, -4821,  -563,  5728, -3328,
+    -4169, -2839,  6077,  4212,  3879, -3643, -2344, -6118,
+    -1815,  2655, -3969, -3030, -2948,  2078, -5106,  4016,
+    -3247,  3186,  3016, -3985, -5195,  3364, -3149,  1663,
+     -773,  2859,  1017, -4143,  2987,  1607,  4337, -1065,
+     -156, -1805, -1583,  5868,  4046,  4433, -5106,   948,
+    -2049,  1579,   241,   504,  3514,  -147, -6093, -1728,
+     3289, -2013,   729, -3241, -2089, -5092, -3284, -2881,
+     4632,  5755, -1260,  4388,  -334, -2426,  1428, -1696,
+     5415,  -468, -5537, -1278, -5886,  5009, -2839,  4698,
+     1404,  1962,  3834, -3150, -2738,  5942, -1805,   156,
+     -493,   404, -2566, -3780, -3066, -4143,  1067,  1045,
+     4437, -3636, -1484, -2847,  3016,   420,  2686,  2884,
+    -2919,  1962,  1958,  5782, -4115,  3991,  2655,  1815,
+     3860, -1041,  -400,  1254, -1105, -3602,  1579,  1010,
+    -2975, -2639,  5728,  1351,  5736,  5146, -3621,  1212,
+     1170,  5086, -2294, -3712,   140, -1177, -4896,    81,
+     2302,  5009,   677,  4169,  3514, -4536, -3643,  5339,
+    -2447,  3991, -3202, -1693, -4077, -1200,  4433, -6065,
+    -1426,  4919, -1484, -1689,  1630, -2865, -1544, -3016,
+    -4976,  2187, -3248, -1378,  1017,  -242, -5698,  3833,
+    -4754,  5942, -5333,  2447, -4049, -1200,  2078,   -64,
+      975, -3602,    52, -4780,   316, -5415,  -147,  2169,
+     -130,  5374, -2396,  3949, -5767,  -953,  5067,  2476,
+        9,  2842,   544,  2468, -4989,  1673, -2525,  4177,
+     4789, -1278, -6093,  3199, -2766,  4169,  4212,  5594,
+     4046,  5782, -3762,  5297, -5429,  2447,  5868, -2500,
+    -1632, -2678,  1067, -2481, -5011, -6039, -1912,  3248,
+    -5332,  5407, -1544, -3136, -3149,  4938, -5042, -3364,
+    -2459, -3150, -1159,  5297, -1583, -1693, -3030, -2767,
+    -6137,  1254, -1973, -5456,   677, -4780,   504, -4212,
+     3712, -1062, -3014,   955,   140, -2768,  3091,  4896,
+    -4821,  2975,  5828, -4978,  3195,  3542,  5146, -4134,
+     -431,  4698,  5681,  5594,  6136,  5339, -6118, -5079,
+     -347,  1815,  6142, -2767,  1319,   -64,   948, -2692,
+    -2178,   671,  2686, -3186, -1777,   113, -5042,  2174,
+    -3066,  -545, -5698,   390,  4337, -2143, -3780, -2187,
+     2908,   156, -1858, -2500,    64, -6065,  4016, -2692,
+     2127,  1010, -4782, -4212,  5456,  2169, -1728,  3998,
+};
+
+const int16_t ntt_red512_inv_mixed_twiddles_4step[512] = {
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2731,  2731,  2731,  2731,  2731,  2731,  2731,  2731,
+     2882, -3772,  5735,  4493, -3054, -4079,  5990,  1200,
+    -3174, -4698, -3263,   885, -2683,  5925,  5206,  3710,
+     -671,   476, -5407,  2865, -3915,  2704,  2847, -4895,
+      242,  1440, -5101, -4861, -1207,   435, -2437,  3780,
+    -3174,   787,   885,  3602,  5206,  3998,  4449,  1278,
+     5735,  5915, -1843,  4774, -4079, -5257, -6099, -6119,
+    -3201,  -790,  1062,  4846,  1000, -3051,  1177,  1853,
+    -1351, -4591,  2625,  2744,  -722, -5146,  5860,  3504,
+    -3054,  4322, -6099, -2692,  4493,  3315,  3963,  5908,
+     5206,  -382,   522,  6118, -3957,  2920,  3602, -5009,
+      242, -4885, -4861,  -442, -2437,  1002,  1065,  1912,
+    -5407,  3978, -5191,  3985,  2704, -4919,  3271,  2780,
+    -2683, -4075,  3998, -4948, -3957, -3445,   -58,  4080,
+    -4079,  1747,  -948, -1962, -2031,  3030,  3315,  5383,
+      953,   827,  -118, -5067,  4452,  3296, -5374, -4354,
+    -3584,  2525,  5331,  4278, -2842, -1022,   339,  -544,
+     5735,  5369,  4774,   218, -6099, -1962,   835, -5486,
+      885,  4782, -5906, -3127,  3998,  3565,  6118, -1018,
+    -3915,  3636,  3271,  4053,  2865,  1153,   243, -3531,
+    -2437, -1607, -5444,  3248,  2678,  5084,  -442,   354,
+    -3263, -4212, -5906,  5057,   522, -4467,    56, -2033,
+    -1843,  1293, -5942,  1975,  -948, -3329, -2503, -1958,
+    -1351, -5828,  2744,   949,  5860,  3621, -4134,  4043,
+     1062,  3135, -5086,   955, -3051, -4320, -1635,  -140,
+     5990, -3956,   835, -3834,  3963,  -418, -2925,  1583,
+     4449, -4916,    56,  -316,   -58,  5594,  3336, -4780,
+    -1207,  4096,  1002,  2566,  2678, -3763,  5698,  2401,
+     2704,  2166,  2174,  2305,  -420, -3136,  1153,  5332,
+     5206,  -973,  6118,  5315,  3602,  2844,  3336,  1010,
+    -6099, -5184, -2503,  -441,  3315,  1512,   218,  4737,
+     1696, -1428,  2426,   334, -4388,  1260, -5755, -4632,
+     2881,  3284,  5092,  2089,  3241,  -729,  2013, -3289,
+    -3772, -2361,  5369,   347,  4322,   -64, -3956,  2919,
+      787,  -677, -4212,  -421, -4075, -3818,  -973, -5206,
+    -5407,  2370,  3985, -2399,  3271,  2305, -4654,  3915,
+    -4861,  3833,  5019,  1632,  1002, -2987,  3248,  -435,
+    -4698,  -677,  4782,  1003,  -382,  3199, -4916, -4449,
+     5915,   426,  1293, -2882,  1747, -4046, -5184,   948,
+     1000,  2366, -1635,  4611,  4846, -4805,  3014,   790,
+     5860,  3542,  1479,   722,  3328,  5023,   949, -2744,
+    -4079,   -64, -1962, -5990,  3315,    49,  -418,  3434,
+     3998,  3199, -4467,  -522, -3445,   431,  2844,  4624,
+    -5101, -2481,  5019, -1440, -5444, -4645,  3646, -1002,
+    -5191,  4905, -2686, -4048,  2174,  2645,  3149, -3636,
+     5925, -3818,  3565, -3998,  2920,   431,  5594,  5009,
+    -5257, -4046, -3329,  4016,  3030,  3772,  1512, -3009,
+    -3584,  1381,  4278, -5331,   339,  5791,   480,  1022,
+     -118, -2197,  3748,  -827,  3296, -4452, -2837,  4354,
+     4493,   347,   218,  3991, -2692, -5990, -3834,  2078,
+     3602,  1003,  5057,  -151, -4948, -3998,  5315,  1190,
+     2847,  5195, -4654,  4919,   243,  -476, -2249,  2686,
+     1065,   493,  3646,  1607,  5698, -3778,  4714,  3763,
+      885,  -421, -3127,  -151,  6118,  -522,  -316, -5529,
+     4774, -2882,  1975, -5383, -1962,  4016,  -441,  3834,
+     -722,     1,  3621,  1646,  3328,  4591, -3006,  -949,
+    -3051, -1000,  4255,   726,  2319,  5086, -4805,  2747,
+     1200,  2919, -5486,  2078,  5908,  3434,  1583,  -174,
+     1278, -4449, -2033, -5529,  4080,  5009,  1010, -2766,
+    -2437,  4284,  3248, -4096,  -442, -5012,  4714,  1017,
+     3271,  4895,  3149,  5291,  1153,  3510, -2399, -4905,
+     3710, -5206, -1018,  1190, -5009,  4624, -4780, -2766,
+    -6119,   948, -1958,  3834,  5383, -3009,  4737, -2447,
+};
+
+const int32_t ntt_red512_mixed_powers_rev_simd[832] __attribute__ ((aligned(32))) = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+      404, -4645, -1065, -2143,  5277,  1168,  1207,  3248,
+    -2422, -6039,  2187,  2566,  6022, -2987,  2437,  3646,
+     1607,  4976, -3780,   875, -1002,  5011,  4284, -5088,
+    -5084,  1632,  4885, -1017,    27,  3066, -1440, -3763,
+    -5019,  -545, -2678, -3704, -4143,  4714,  -242, -1537,
+     -390,   773, -3778,  3833,   442,  2401,  5101, -1067,
+    -5698,  2912,  4861,   354, -5012, -2481,  1045, -2859,
+     4654,  4654,  4654,  4654,  1426,  1426,  1426,  1426,
+     1663,  1663,  1663,  1663,  1777,  1777,  1777,  1777,
+    -3636, -3636, -3636, -3636,  4938,  4938,  4938,  4938,
+    -2704, -2704, -2704, -2704, -5291, -5291, -5291, -5291,
+       -3,    -3,    -3,    -3, -4437, -4437, -4437, -4437,
+      160,   160,   160,   160,  3149,  3149,  3149,  3149,
+     4919,  4919,  4919,  4919,   113,   113,   113,   113,
+     3915,  3915,  3915,  3915,  2166,  2166,  2166,  2166,
+     3364,  3364,  3364,  3364, -1689, -1689, -1689, -1689,
+    -3271, -3271, -3271, -3271,  4057,  4057,  4057,  4057,
+    -2174, -2174, -2174, -2174,  4372,  4372,  4372,  4372,
+    -2847, -2847, -2847, -2847,  4414,  4414,  4414,  4414,
+    -2780, -2780, -2780, -2780,  5195,  5195,  5195,  5195,
+     4895,  4895,  4895,  4895,  1484,  1484,  1484,  1484,
+    -5042, -5042, -5042, -5042,  2305,  2305,  2305,  2305,
+     2645,  2645,  2645,  2645,  4053,  4053,  4053,  4053,
+    -1544, -1544, -1544, -1544,  2178,  2178,  2178,  2178,
+      420,   420,   420,   420, -5559, -5559, -5559, -5559,
+    -3985, -3985, -3985, -3985,  4905,  4905,  4905,  4905,
+     -476,  -476,  -476,  -476, -3531, -3531, -3531, -3531,
+    -3400, -3400, -3400, -3400, -2399, -2399, -2399, -2399,
+     5191,  5191,  5191,  5191, -3136, -3136, -3136, -3136,
+     -243,  -243,  -243,  -243, -3016, -3016, -3016, -3016,
+      671,   671,   671,   671, -3000, -3000, -3000, -3000,
+    -1153, -1153, -1153, -1153,  2884,  2884,  2884,  2884,
+    -4048, -4048, -4048, -4048, -2249, -2249, -2249, -2249,
+     2126,  2126,  2126,  2126, -1630, -1630, -1630, -1630,
+     5407,  5407,  5407,  5407, -3186, -3186, -3186, -3186,
+     3510,  3510,  3510,  3510,  5332,  5332,  5332,  5332,
+    -2865, -2865, -2865, -2865,  2370,  2370,  2370,  2370,
+    -3978, -3978, -3978, -3978,  2969,  2969,  2969,  2969,
+     3247,  3247,  3247,  3247, -2686, -2686, -2686, -2686,
+     -563,  -563, -2744, -2744,  2975,  2975, -3006, -3006,
+    -2639, -2639, -2625, -2625,  4821,  4821,   949,   949,
+     5828,  5828,  4591,  4591,  5023,  5023, -5728, -5728,
+    -3328, -3328,  1351,  1351,  5777,  5777, -4978, -4978,
+    -1479, -1479,  5146,  5146,     1,     1,  4043,  4043,
+     4134,  4134,   722,   722, -5736, -5736, -1305, -1305,
+     1646,  1646, -5860, -5860,  1212,  1212, -3195, -3195,
+    -3504, -3504,  2545,  2545,  3542,  3542,  3621,  3621,
+    -3135, -3135, -4846, -4846, -3712, -3712, -2747, -2747,
+     3553,  3553, -1062, -1062, -4805, -4805,  2294,  2294,
+    -2319, -2319,   790,   790, -1170, -1170,   955,   955,
+     5086,  5086,  3201,  3201,  1326,  1326,  3014,  3014,
+    -4896, -4896,  3051,  3051, -2963, -2963,  2366,  2366,
+     3091,  3091, -1000, -1000,    81,    81, -4320, -4320,
+     1635,  1635, -1177, -1177, -2768, -2768,  4255,  4255,
+    -1853, -1853,  4611,  4611,  -140,  -140,  -726,  -726,
+     4354,  4354,  5374,  5374,   130,   130, -2837, -2837,
+    -3296, -3296, -4452, -4452,  3949,  3949,  2396,  2396,
+     5067,  5067,   118,   118, -2197, -2197,  2476,  2476,
+     -827,  -827,  -953,  -953,  5767,  5767,  3748,  3748,
+    -4278, -4278, -5331, -5331,  1673,  1673,  4989,  4989,
+    -2525, -2525,  3584,  3584,  1381,  1381,  4177,  4177,
+     1022,  1022,  2842,  2842,    -9,    -9,   480,   480,
+     -339,  -339,  5791,  5791,  2468,  2468,  -544,  -544,
+     2548,  2548,  3382,  3382, -4231, -4231,   355,   355,
+    -3707, -3707,  5179,  5179, -1759, -1759,  3694,  3694,
+     3637,  3637, -5542, -5542, -3459, -3459,   145,   145,
+     4890,  4890, -2731, -2731, -5911, -5911,  3932,  3932,
+     5755,  5755,  4388,  4388, -4632, -4632,  1260,  1260,
+    -2426, -2426, -1696, -1696,   334,   334, -1428, -1428,
+    -5092, -5092, -2881, -2881,  2089,  2089,  3284,  3284,
+    -3241, -3241, -3289, -3289,  -729,  -729,  2013,  2013,
+    -3762,  -652,  2919, -5766,  4016,  6099,  4077,   295,
+     -325, -3728, -1404,  4049,   948, -5990,  1146,  1159,
+     3956, -6122,  1360,  2555,  6119, -1200,  5297, -5184,
+     1962,  2692,  1594,  -168,  5961, -4298,  5106, -3329,
+      683,  2503,  2459,  2948, -3656,  5782,   -64, -1566,
+     4433, -1747, -5919, -3123,  5257,  3054, -3834, -5486,
+     2078,   922,  1112,  -441, -4322,  4079, -1958, -1058,
+     -709,  -835, -4046, -6065, -3150,  3570, -1319, -4240,
+    -1858,  2925,  4754,   347, -3315,  3757,   426,  1975,
+    -3009,  5868, -1693,  2738,   723, -5735,   174, -2655,
+    -5383, -5369,  1815, -2057,   350, -4493,  1512,  3202,
+     1263,  5942,    49,  1583, -5915, -1489,  1483, -2500,
+     -218, -3030, -2908,  4115,  3434,  1843,  3529, -2361,
+     6142,  2051,  2447, -1954, -3963, -2882,   576,  1805,
+    -1293, -5908,  4737,  -453, -4774,  3772,  5429,  -418,
+     5876,  3991,  2281,  3969,  2031,   156,  5333, -2767,
+      605, -4782, -2302,  5886,   504, -3029, -4213,  5594,
+    -4080,  4624,  -421, -6077, -3602,  3263,  6068, -3600,
+     3532,  5009,  1003, -1956,    58,  -885,  -241,  6008,
+     4212,   142,  -975,  1105, -3438, -3477,  2844, -5681,
+     1579,  -151,   431, -2127,  5906,  3957, -2505,  2839,
+    -3336,  1323, -6055,  2766,  5874,  3174,  -677,   -52,
+     4912,  3445,  2049, -4780,   192,  4698,  1321,  5057,
+     5468, -2920,  1010, -5241,  -787,  4169,  3482, -3127,
+     4467,  -147, -4789,  3789, -4749, -4449,  5537, -5456,
+    -5445, -6118, -3860, -3818, -4536,  2683,  1050, -1190,
+    -1973, -1041, -5574, -3514, -1278, -5925,  2344, -1018,
+     5079,  4075,  3262,  5315,  -522, -4324,  2169, -4916,
+     -468,  5446, -3988,  5339,   382, -3710,  -316,  6093,
+    -1922,  1359, -3879, -5435, -3998,  1254, -2033,  -973,
+    -3565,   -56,  -654,  3199,  1702, -5206, -1987,  5529,
+     4948,  5862,  6137, -6136, -1728, -5415,   400,  3643,
+};
+
+const int32_t ntt_red512_inv_mixed_powers_rev_simd[640] __attribute__ ((aligned(32))) = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -3248, -1207, -1168, -5277,  2143,  1065,  4645,  -404,
+     5088, -4284, -5011,  1002,  -875,  3780, -4976, -1607,
+    -3646, -2437,  2987, -6022, -2566, -2187,  6039,  2422,
+     2859, -1045,  2481,  5012,  -354, -4861, -2912,  5698,
+     1067, -5101, -2401,  -442, -3833,  3778,  -773,   390,
+     1537,   242, -4714,  4143,  3704,  2678,   545,  5019,
+     3763,  1440, -3066,   -27,  1017, -4885, -1632,  5084,
+     2686, -3247, -2969,  3978, -2370,  2865, -5332, -3510,
+     3186, -5407,  1630, -2126,  2249,  4048, -2884,  1153,
+     3000,  -671,  3016,   243,  3136, -5191,  2399,  3400,
+     3531,   476, -4905,  3985,  5559,  -420, -2178,  1544,
+    -4053, -2645, -2305,  5042, -1484, -4895, -5195,  2780,
+    -4414,  2847, -4372,  2174, -4057,  3271,  1689, -3364,
+    -2166, -3915,  -113, -4919, -3149,  -160,  4437,     3,
+     5291,  2704, -4938,  3636, -1777, -1663, -1426, -4654,
+    -3643, -2013,  5415, -2013,  6136,  3289, -5862,  3289,
+     -400,   729,  1728,   729, -6137,  3241, -4948,  3241,
+    -5529, -3284,  5206, -3284, -3199,  2881,    56,  2881,
+     1987, -2089, -1702, -2089,   654,  5092,  3565,  5092,
+      973,  1428, -1254,  1428,  5435,  1696, -1359,  1696,
+     2033,  -334,  3998,  -334,  3879,  2426,  1922,  2426,
+    -6093, -1260,  3710, -1260, -5339, -4388, -5446, -4388,
+      316,  4632,  -382,  4632,  3988, -5755,   468, -5755,
+     4916, -3932,  4324, -3932, -5315,  2731, -4075,  2731,
+    -2169,  5911,   522,  5911, -3262, -4890, -5079, -4890,
+     1018,  -145,  5925,  -145,  3514,  5542,  1041,  5542,
+    -2344,  3459,  1278,  3459,  5574, -3637,  1973, -3637,
+     1190, -3694, -2683, -3694,  3818, -5179,  6118, -5179,
+    -1050,  1759,  4536,  1759,  3860,  3707,  5445,  3707,
+     5456,  -355,  4449,  -355, -3789, -3382,   147, -3382,
+    -5537,  4231,  4749,  4231,  4789, -2548, -4467, -2548,
+     3127,   544, -4169,   544,  5241, -5791,  2920, -5791,
+    -3482, -2468,   787, -2468, -1010,   339, -5468,   339,
+    -5057,  -480, -4698,  -480,  4780, -2842, -3445, -2842,
+    -1321,     9,  -192,     9, -2049, -1022, -4912, -1022,
+       52, -4177, -3174, -4177, -2766, -3584, -1323, -3584,
+      677, -1381, -5874, -1381,  6055,  2525,  3336,  2525,
+    -2839, -4989, -3957, -4989,  2127,  5331,   151,  5331,
+     2505, -1673, -5906, -1673,  -431,  4278, -1579,  4278,
+     5681, -3748,  3477, -3748, -1105,   953,  -142,   953,
+    -2844, -5767,  3438, -5767,   975,   827, -4212,   827,
+    -6008, -2476,   885, -2476,  1956,  -118, -5009,  -118,
+      241,  2197,   -58,  2197, -1003, -5067, -3532, -5067,
+     3600, -2396, -3263, -2396,  6077,  4452, -4624,  4452,
+    -6068, -3949,  3602, -3949,   421,  3296,  4080,  3296,
+    -5594,  2837,  3029,  2837, -5886, -5374,  4782, -5374,
+     4213,  -130,  -504,  -130,  2302, -4354,  -605, -4354,
+     2767,   726,  -156,   726, -3969, -4611, -3991, -4611,
+    -5333,   140, -2031,   140, -2281,  1853, -5876,  1853,
+      418, -4255, -3772, -4255,   453,  1177,  5908,  1177,
+    -5429,  2768,  4774,  2768, -4737, -1635,  1293, -1635,
+    -1805,  4320,  2882,  4320,  1954,  1000, -2051,  1000,
+     -576,   -81,  3963,   -81, -2447, -3091, -6142, -3091,
+     2361, -2366, -1843, -2366, -4115, -3051,  3030, -3051,
+    -3529,  2963, -3434,  2963,  2908,  4896,   218,  4896,
+     2500, -3014,  1489, -3014, -1583, -3201, -5942, -3201,
+    -1483, -1326,  5915, -1326,   -49, -5086, -1263, -5086,
+    -3202,  -955,  4493,  -955,  2057,  -790,  5369,  -790,
+    -1512,  1170,  -350,  1170, -1815,  2319,  5383,  2319,
+     2655, -2294,  5735, -2294, -2738,  1062, -5868,  1062,
+     -174,  4805,  -723,  4805,  1693, -3553,  3009, -3553,
+    -1975,  2747, -3757,  2747,  -347,  4846, -2925,  4846,
+     -426,  3712,  3315,  3712, -4754,  3135,  1858,  3135,
+     4240, -3621, -3570, -3621,  6065, -2545,   835, -2545,
+     1319, -3542,  3150, -3542,  4046,  3504,   709,  3504,
+     1058,  3195, -4079,  3195,   441,  5860,  -922,  5860,
+     1958, -1212,  4322, -1212, -1112, -1646, -2078, -1646,
+     5486,  1305, -3054,  1305,  3123,  -722,  1747,  -722,
+     3834,  5736, -5257,  5736,  5919, -4134, -4433, -4134,
+     1566, -4043, -5782, -4043, -2948, -5146, -2503, -5146,
+       64,    -1,  3656,    -1, -2459,  1479,  -683,  1479,
+     3329,  4978,  4298,  4978,   168, -1351, -2692, -1351,
+    -5106, -5777, -5961, -5777, -1594,  3328, -1962,  3328,
+     5184,  5728,  1200,  5728, -2555, -4591,  6122, -4591,
+    -5297, -5023, -6119, -5023, -1360, -5828, -3956, -5828,
+    -1159,  -949,  5990,  -949, -4049,  2625,  3728,  2625,
+    -1146, -4821,  -948, -4821,  1404,  2639,   325,  2639,
+     -295,  3006, -6099,  3006,  5766,  2744,   652,  2744,
+    -4077, -2975, -4016, -2975, -2919,   563,  3762,   563,
+};
+
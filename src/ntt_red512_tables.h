@@ -0,0 +1,98 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 512
+ * - psi = 1003
+ * - omega = psi^2 = 10600
+ * - inverse of psi = 1360
+ * - inverse of omega = 6250
+ * - inverse of n = 12265
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED512_TABLES_H
+#define __NTT_RED512_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red512_psi = 1003;
+static const int32_t ntt_red512_omega = 10600;
+static const int32_t ntt_red512_inv_psi = 1360;
+static const int32_t ntt_red512_inv_omega = 6250;
+static const int32_t ntt_red512_inv_n = 12265;
+static const int32_t ntt_red512_inv_k = 8193;
+static const int32_t ntt_red512_rescale8 = 4411;
+static const int32_t ntt_red512_rescale6 = 2832;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red512_psi_powers[512];
+extern const int16_t ntt_red512_inv_psi_powers[512];
+extern const int16_t ntt_red512_scaled_inv_psi_powers[512];
+extern const int16_t ntt_red512_scaled_inv_psi_powers_var[512];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red512_omega_powers[512];
+extern const int16_t ntt_red512_omega_powers_rev[512];
+extern const int16_t ntt_red512_inv_omega_powers[512];
+extern const int16_t ntt_red512_inv_omega_powers_rev[512];
+extern const int16_t ntt_red512_mixed_powers[512];
+extern const int16_t ntt_red512_mixed_powers_rev[512];
+extern const int16_t ntt_red512_inv_mixed_powers[512];
+extern const int16_t ntt_red512_inv_mixed_powers_rev[512];
+
+/*
+ * TABLES FOR RADIX-4 NTT COMPUTATION
+ */
+extern const int16_t ntt_red512_omega_powers_ct_r4[512];
+extern const int16_t ntt_red512_omega_powers_rev_ct_r4[512];
+extern const int16_t ntt_red512_omega_powers_gs_r4[512];
+extern const int16_t ntt_red512_omega_powers_rev_gs_r4[512];
+extern const int16_t ntt_red512_inv_omega_powers_ct_r4[512];
+extern const int16_t ntt_red512_inv_omega_powers_rev_ct_r4[512];
+extern const int16_t ntt_red512_inv_omega_powers_gs_r4[512];
+extern const int16_t ntt_red512_inv_omega_powers_rev_gs_r4[512];
+extern const int16_t ntt_red512_mixed_powers_ct_r4[512];
+extern const int16_t ntt_red512_mixed_powers_rev_ct_r4[512];
+extern const int16_t ntt_red512_inv_mixed_powers_gs_r4[512];
+extern const int16_t ntt_red512_inv_mixed_powers_rev_gs_r4[512];
+
+/*
+ * TABLES FOR CONSTANT-GEOMETRY NTT COMPUTATION
+ */
+extern const int16_t ntt_red512_omega_powers_ct_cg[2304];
+extern const int16_t ntt_red512_omega_powers_rev_ct_cg[2304];
+extern const int16_t ntt_red512_omega_powers_gs_cg[2304];
+extern const int16_t ntt_red512_omega_powers_rev_gs_cg[2304];
+extern const int16_t ntt_red512_inv_omega_powers_ct_cg[2304];
+extern const int16_t ntt_red512_inv_omega_powers_rev_ct_cg[2304];
+extern const int16_t ntt_red512_inv_omega_powers_gs_cg[2304];
+extern const int16_t ntt_red512_inv_omega_powers_rev_gs_cg[2304];
+extern const int16_t ntt_red512_mixed_powers_ct_cg[2304];
+extern const int16_t ntt_red512_mixed_powers_rev_ct_cg[2304];
+extern const int16_t ntt_red512_inv_mixed_powers_gs_cg[2304];
+extern const int16_t ntt_red512_inv_mixed_powers_rev_gs_cg[2304];
+
+/*
+ * TABLES FOR FOUR-STEP NTT COMPUTATION
+ */
+static const int32_t ntt_red512_n1_4step = 16;
+extern const int16_t ntt_red512_twiddles_4step[512];
+extern const int16_t ntt_red512_inv_twiddles_4step[512];
+extern const int16_t ntt_red512_mixed_twiddles_4step[512];
+extern const int16_t ntt_red512_inv_mixed_twiddles_4step[512];
+
+/*
+ * TABLES IN SIMD LAYOUT (32bit, aligned)
+ */
+extern const int32_t ntt_red512_mixed_powers_rev_simd[832];
+extern const int32_t ntt_red512_inv_mixed_powers_rev_simd[640];
+
+#endif /* __NTT_RED512_TABLES_H */
@@ -15,13 +15,9 @@
  * The result is also in that range.
  */
 void ntt_red1024_product1_asm(int32_t *c, int32_t *a, int32_t *b) {
-  mul_reduce_array16_asm(a, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_ct_std2rev_asm(a);
-  reduce_array_asm(a, 1024);
+  ntt_red1024_ct_std2rev_fused_asm(a);
 
-  mul_reduce_array16_asm(b, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_ct_std2rev_asm(b);
-  reduce_array_asm(b, 1024);
+  ntt_red1024_ct_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -31,21 +27,15 @@ void ntt_red1024_product1_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_ct_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers_var);
-  reduce_array_twice_asm(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 1024);
+  mul_reduce_finalize_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers_var); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product2_asm(int32_t *c, int32_t *a, int32_t *b) {
   //  shift_array(a, 1024); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_gs_std2rev_asm(a);
-  reduce_array_asm(a, 1024);
+  ntt_red1024_gs_std2rev_fused_asm(a);
 
   //  shift_array(b, 1024);
-  mul_reduce_array16_asm(b, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_gs_std2rev_asm(b);
-  reduce_array_asm(b, 1024);
+  ntt_red1024_gs_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -55,21 +45,15 @@ void ntt_red1024_product2_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_ct_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 1024);
+  mul_reduce_finalize_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product3_asm(int32_t *c, int32_t *a, int32_t *b) {
   //  shift_array(a, 1024); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_ct_std2rev_asm(a);
-  reduce_array_asm(a, 1024);
+  ntt_red1024_ct_std2rev_fused_asm(a);
 
   //  shift_array(b, 1024);
-  mul_reduce_array16_asm(b, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_ct_std2rev_asm(b);
-  reduce_array_asm(b, 1024);
+  ntt_red1024_ct_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -79,21 +63,15 @@ void ntt_red1024_product3_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_gs_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 1024);
+  mul_reduce_finalize_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product4_asm(int32_t *c, int32_t *a, int32_t *b) {
   //  shift_array(a, 1024); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_gs_std2rev_asm(a);
-  reduce_array_asm(a, 1024);
+  ntt_red1024_gs_std2rev_fused_asm(a);
 
   //  shift_array(b, 1024);
-  mul_reduce_array16_asm(b, 1024, ntt_red1024_psi_powers);
-  ntt_red1024_gs_std2rev_asm(b);
-  reduce_array_asm(b, 1024);
+  ntt_red1024_gs_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -103,25 +81,91 @@ void ntt_red1024_product4_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red1024_gs_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 1024); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 1024);
+  mul_reduce_finalize_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red1024_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
   //  shift_array(a, 1024);
-  mulntt_red1024_ct_std2rev_asm(a);
-  reduce_array_asm(a, 1024);
+  mulntt_red1024_ct_std2rev_fused_asm(a);
 
   //  shift_array(b, 1024);
-  mulntt_red1024_ct_std2rev_asm(b);
-  reduce_array_asm(b, 1024);
+  mulntt_red1024_ct_std2rev_fused_asm(b);
 
   mul_reduce_array_asm(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
   reduce_array_twice_asm(c, 1024);  // c[i] = 9 * c[i] mod Q
 
   inttmul_red1024_gs_rev2std_asm(c);
-  scalar_mul_reduce_array_asm(c, 1024, ntt_red1024_rescale8);
-  reduce_array_twice_asm(c, 1024);
-  correct_asm(c, 1024);
+  scalar_mul_reduce_finalize_asm(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product6_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_fused2_asm(a, b);
+
+  mul_reduce_array_asm(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product_4step_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_4step_asm(a, c); // c is used as scratch
+  reduce_array_asm(a, 1024);
+
+  mulntt_red1024_ct_std2rev_4step_asm(b, c);
+  reduce_array_asm(b, 1024);
+
+  mul_reduce_array_asm(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_4step_asm(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize_asm(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red1024_product_simd_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mulntt_red1024_ct_std2rev_simd_fused_asm(a);
+
+  mulntt_red1024_ct_std2rev_simd_fused_asm(b);
+
+  mul_reduce_array_asm(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_simd_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 1024, ntt_red1024_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+/*
+ * The vpmulld NTTs of size 1024 compute 9 * NTT (two reduced rounds):
+ * - forward: mul_reduce_array16, the vpmulld NTT, then the product by
+ *   INV27 = inverse of 27 modulo Q give 3 * NTT(psi * a). This is one
+ *   third of what product1 has at this point (reduce_array gives
+ *   9 * NTT(psi * a)).
+ * - inverse: the factor 9 cancels the two factors 1/3. The final step
+ *   is then the same as in product1.
+ *
+ * Bounds (checked with ntt_ct_mulld_bounds and the other functions
+ * of red_bounds.c):
+ * - after mul_reduce_array16: -18408 <= a[i] <= 30700
+ *   (more than 21499: this relies on the table-specific precondition
+ *   of ntt_red_ct_std2rev_mulld_asm in ntt_asm.h)
+ * - forward NTT: |w * x| <= 1677990501 and |a[i]| <= 309225
+ * - after the product by INV27: -239175 <= a[i] <= 251464
+ * - inverse NTT: |c[i]| <= 12289 on input and |w * x| <= 1764982296
+ */
+#define INV27 (-3186)
+
+void ntt_red1024_product_mulld_asm(int32_t *c, int32_t *a, int32_t *b) {
+  mul_reduce_array16_asm(a, 1024, ntt_red1024_psi_powers);
+  ntt_red1024_ct_std2rev_mulld_asm(a);
+  scalar_mul_reduce_array_asm(a, 1024, INV27);
+
+  mul_reduce_array16_asm(b, 1024, ntt_red1024_psi_powers);
+  ntt_red1024_ct_std2rev_mulld_asm(b);
+  scalar_mul_reduce_array_asm(b, 1024, INV27);
+
+  mul_reduce_array_asm(c, 1024, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  intt_red1024_ct_rev2std_mulld_asm(c);
+  mul_reduce_finalize_asm(c, 1024, ntt_red1024_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
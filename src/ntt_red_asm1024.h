@@ -8,6 +8,7 @@
 
 #include "ntt_red1024_tables.h"
 #include "ntt_asm.h"
+#include "ntt_4step_asm.h"
 
 /*
  * NTT Variants: as in ntt_asm.h
@@ -35,6 +36,11 @@ static inline void ntt_red1024_gs_std2rev_asm(int32_t *a) {
   ntt_red_gs_std2rev_asm(a, 1024, ntt_red1024_omega_powers);
 }
 
+// register-resident version of ntt_red1024_ct_std2rev_asm
+static inline void ntt_red1024_ct_std2rev_reg_asm(int32_t *a) {
+  ntt_red_ct_std2rev_reg_asm(a, 1024, ntt_red1024_omega_powers_rev);
+}
+
 // inverse
 static inline void intt_red1024_ct_rev2std_asm(int32_t *a) {
   ntt_red_ct_rev2std_asm(a, 1024, ntt_red1024_inv_omega_powers);
@@ -70,6 +76,102 @@ static inline void inttmul_red1024_gs_std2rev_asm(int32_t *a) {
   nttmul_red_gs_std2rev_asm(a, 1024, ntt_red1024_inv_mixed_powers);
 }
 
+// fused: multiplication by powers of psi, forward ntt, then reduction
+static inline void ntt_red1024_ct_std2rev_fused_asm(int32_t *a) {
+  ntt_red_ct_std2rev_fused_asm(a, 1024, ntt_red1024_omega_powers_rev, ntt_red1024_psi_powers);
+}
+
+static inline void ntt_red1024_gs_std2rev_fused_asm(int32_t *a) {
+  ntt_red_gs_std2rev_fused_asm(a, 1024, ntt_red1024_omega_powers, ntt_red1024_psi_powers);
+}
+
+// fused: mulntt then reduction
+static inline void mulntt_red1024_ct_std2rev_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_fused_asm(a, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+// register-resident versions of mulntt_red1024_ct_std2rev_asm and of the fused variant
+static inline void mulntt_red1024_ct_std2rev_reg_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_reg_asm(a, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+static inline void mulntt_red1024_ct_std2rev_reg_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_reg_fused_asm(a, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+// fused, two operands: same as mulntt_red1024_ct_std2rev_fused_asm(a) then (b)
+static inline void mulntt_red1024_ct_std2rev_fused2_asm(int32_t *a, int32_t *b) {
+  mulntt_red_ct_std2rev_fused2_asm(a, b, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+// same as mulntt_red1024_ct_std2rev_asm, the fused variant, and inttmul_red1024_gs_rev2std_asm
+// but using the tables in SIMD layout
+static inline void mulntt_red1024_ct_std2rev_simd_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_simd_asm(a, 1024, ntt_red1024_mixed_powers_rev_simd);
+}
+
+static inline void mulntt_red1024_ct_std2rev_simd_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_simd_fused_asm(a, 1024, ntt_red1024_mixed_powers_rev_simd);
+}
+
+static inline void inttmul_red1024_gs_rev2std_simd_asm(int32_t *a) {
+  nttmul_red_gs_rev2std_simd_asm(a, 1024, ntt_red1024_inv_mixed_powers_rev_simd);
+}
+
+// fused: pointwise product then inverse ntt
+static inline void pointwise_intt_red1024_ct_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_ntt_red_ct_rev2std_asm(c, 1024, a, b, ntt_red1024_inv_omega_powers);
+}
+
+static inline void pointwise_intt_red1024_gs_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_ntt_red_gs_rev2std_asm(c, 1024, a, b, ntt_red1024_inv_omega_powers_rev);
+}
+
+static inline void pointwise_inttmul_red1024_gs_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_nttmul_red_gs_rev2std_asm(c, 1024, a, b, ntt_red1024_inv_mixed_powers_rev);
+}
+
+// vpmulld versions: 9 * ntt_red1024_ct_std2rev and 9 * intt_red1024_ct_rev2std (modulo Q)
+static inline void ntt_red1024_ct_std2rev_mulld_asm(int32_t *a) {
+  ntt_red_ct_std2rev_mulld_asm(a, 1024, ntt_red1024_omega_powers_rev);
+}
+
+static inline void intt_red1024_ct_rev2std_mulld_asm(int32_t *a) {
+  ntt_red_ct_rev2std_mulld_asm(a, 1024, ntt_red1024_inv_omega_powers);
+}
+
+// four-step versions (same results as the C versions in ntt_red1024.h)
+// tmp must be an array of 1024 elements
+static inline void ntt_red1024_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_omega_powers_rev,
+                               ntt_red1024_omega_powers_rev, ntt_red1024_twiddles_4step, tmp);
+}
+
+static inline void ntt_red1024_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_omega_powers_rev,
+                               ntt_red1024_omega_powers_rev, ntt_red1024_twiddles_4step, tmp);
+}
+
+static inline void intt_red1024_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_omega_powers_rev,
+                               ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_twiddles_4step, tmp);
+}
+
+static inline void intt_red1024_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_omega_powers_rev,
+                               ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_twiddles_4step, tmp);
+}
+
+static inline void mulntt_red1024_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_mixed_powers_rev,
+                               ntt_red1024_omega_powers_rev, ntt_red1024_mixed_twiddles_4step, tmp);
+}
+
+static inline void inttmul_red1024_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 1024, ntt_red1024_n1_4step, ntt_red1024_inv_mixed_powers_rev,
+                               ntt_red1024_inv_omega_powers_rev, ntt_red1024_inv_mixed_twiddles_4step, tmp);
+}
+
 
 /*
  * PRODUCTS
@@ -91,4 +193,27 @@ extern void ntt_red1024_product3_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product4_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product5_asm(int32_t *c, int32_t *a, int32_t *b);
 
+/*
+ * Same as product5 but the forward transforms of a and b are computed
+ * in lockstep by mulntt_red_ct_std2rev_fused2_asm.
+ */
+extern void ntt_red1024_product6_asm(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the four-step NTTs
+ */
+extern void ntt_red1024_product_4step_asm(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the tables in SIMD layout
+ */
+extern void ntt_red1024_product_simd_asm(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product1 but with the vpmulld NTTs. They compute 9 * NTT
+ * so the forward transforms are followed by a multiplication by
+ * the inverse of 27 instead of a reduction.
+ */
+extern void ntt_red1024_product_mulld_asm(int32_t *c, int32_t *a, int32_t *b);
+
 #endif /* __NTT_RED_ASM1024_H */
@@ -7,6 +7,7 @@
 
 #include "ntt_red256_tables.h"
 #include "ntt_asm.h"
+#include "ntt_4step_asm.h"
 
 /*
  * NTT Variants: as in ntt_asm.h
@@ -34,6 +35,11 @@ static inline void ntt_red256_gs_std2rev_asm(int32_t *a) {
   ntt_red_gs_std2rev_asm(a, 256, ntt_red256_omega_powers);
 }
 
+// register-resident version of ntt_red256_ct_std2rev_asm
+static inline void ntt_red256_ct_std2rev_reg_asm(int32_t *a) {
+  ntt_red_ct_std2rev_reg_asm(a, 256, ntt_red256_omega_powers_rev);
+}
+
 // inverse
 static inline void intt_red256_ct_rev2std_asm(int32_t *a) {
   ntt_red_ct_rev2std_asm(a, 256, ntt_red256_inv_omega_powers);
@@ -69,6 +75,93 @@ static inline void inttmul_red256_gs_std2rev_asm(int32_t *a) {
   nttmul_red_gs_std2rev_asm(a, 256, ntt_red256_inv_mixed_powers);
 }
 
+// fused: multiplication by powers of psi, forward ntt, then reduction
+static inline void ntt_red256_ct_std2rev_fused_asm(int32_t *a) {
+  ntt_red_ct_std2rev_fused_asm(a, 256, ntt_red256_omega_powers_rev, ntt_red256_psi_powers);
+}
+
+static inline void ntt_red256_gs_std2rev_fused_asm(int32_t *a) {
+  ntt_red_gs_std2rev_fused_asm(a, 256, ntt_red256_omega_powers, ntt_red256_psi_powers);
+}
+
+// fused: mulntt then reduction
+static inline void mulntt_red256_ct_std2rev_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_fused_asm(a, 256, ntt_red256_mixed_powers_rev);
+}
+
+// register-resident versions of mulntt_red256_ct_std2rev_asm and of the fused variant
+static inline void mulntt_red256_ct_std2rev_reg_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_reg_asm(a, 256, ntt_red256_mixed_powers_rev);
+}
+
+static inline void mulntt_red256_ct_std2rev_reg_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_reg_fused_asm(a, 256, ntt_red256_mixed_powers_rev);
+}
+
+// fused, two operands: same as mulntt_red256_ct_std2rev_fused_asm(a) then (b)
+static inline void mulntt_red256_ct_std2rev_fused2_asm(int32_t *a, int32_t *b) {
+  mulntt_red_ct_std2rev_fused2_asm(a, b, 256, ntt_red256_mixed_powers_rev);
+}
+
+// same as mulntt_red256_ct_std2rev_asm, the fused variant, and inttmul_red256_gs_rev2std_asm
+// but using the tables in SIMD layout
+static inline void mulntt_red256_ct_std2rev_simd_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_simd_asm(a, 256, ntt_red256_mixed_powers_rev_simd);
+}
+
+static inline void mulntt_red256_ct_std2rev_simd_fused_asm(int32_t *a) {
+  mulntt_red_ct_std2rev_simd_fused_asm(a, 256, ntt_red256_mixed_powers_rev_simd);
+}
+
+static inline void inttmul_red256_gs_rev2std_simd_asm(int32_t *a) {
+  nttmul_red_gs_rev2std_simd_asm(a, 256, ntt_red256_inv_mixed_powers_rev_simd);
+}
+
+// fused: pointwise product then inverse ntt
+static inline void pointwise_intt_red256_ct_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_ntt_red_ct_rev2std_asm(c, 256, a, b, ntt_red256_inv_omega_powers);
+}
+
+static inline void pointwise_intt_red256_gs_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_ntt_red_gs_rev2std_asm(c, 256, a, b, ntt_red256_inv_omega_powers_rev);
+}
+
+static inline void pointwise_inttmul_red256_gs_rev2std_asm(int32_t *c, const int32_t *a, const int32_t *b) {
+  pointwise_nttmul_red_gs_rev2std_asm(c, 256, a, b, ntt_red256_inv_mixed_powers_rev);
+}
+
+// four-step versions (same results as the C versions in ntt_red256.h)
+// tmp must be an array of 256 elements
+static inline void ntt_red256_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_omega_powers_rev,
+                               ntt_red256_omega_powers_rev, ntt_red256_twiddles_4step, tmp);
+}
+
+static inline void ntt_red256_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_omega_powers_rev,
+                               ntt_red256_omega_powers_rev, ntt_red256_twiddles_4step, tmp);
+}
+
+static inline void intt_red256_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_inv_omega_powers_rev,
+                               ntt_red256_inv_omega_powers_rev, ntt_red256_inv_twiddles_4step, tmp);
+}
+
+static inline void intt_red256_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_inv_omega_powers_rev,
+                               ntt_red256_inv_omega_powers_rev, ntt_red256_inv_twiddles_4step, tmp);
+}
+
+static inline void mulntt_red256_ct_std2rev_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_ct_std2rev_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_mixed_powers_rev,
+                               ntt_red256_omega_powers_rev, ntt_red256_mixed_twiddles_4step, tmp);
+}
+
+static inline void inttmul_red256_gs_rev2std_4step_asm(int32_t *a, int32_t *tmp) {
+  ntt_red_gs_rev2std_4step_asm(a, 256, ntt_red256_n1_4step, ntt_red256_inv_mixed_powers_rev,
+                               ntt_red256_inv_omega_powers_rev, ntt_red256_inv_mixed_twiddles_4step, tmp);
+}
+
 
 /*
  * PRODUCTS
@@ -90,4 +183,20 @@ extern void ntt_red256_product3_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red256_product4_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red256_product5_asm(int32_t *c, int32_t *a, int32_t *b);
 
+/*
+ * Same as product5 but the forward transforms of a and b are computed
+ * in lockstep by mulntt_red_ct_std2rev_fused2_asm.
+ */
+extern void ntt_red256_product6_asm(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the four-step NTTs
+ */
+extern void ntt_red256_product_4step_asm(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Same as product5 but with the tables in SIMD layout
+ */
+extern void ntt_red256_product_simd_asm(int32_t *c, int32_t *a, int32_t *b);
+
 #endif /* __NTT_RED_ASM256_H */
@@ -16,14 +16,10 @@
  */
 void ntt_red512_product1_asm(int32_t *c, int32_t *a, int32_t *b) {
   shift_array_asm(a, 512); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 512, ntt_red512_psi_powers);
-  ntt_red512_ct_std2rev_asm(a);
-  reduce_array_asm(a, 512);
+  ntt_red512_ct_std2rev_fused_asm(a);
 
   shift_array_asm(b, 512);
-  mul_reduce_array16_asm(b, 512, ntt_red512_psi_powers);
-  ntt_red512_ct_std2rev_asm(b);
-  reduce_array_asm(b, 512);
+  ntt_red512_ct_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -33,21 +29,15 @@ void ntt_red512_product1_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red512_ct_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 512, ntt_red512_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 512); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 512);
+  mul_reduce_finalize_asm(c, 512, ntt_red512_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red512_product2_asm(int32_t *c, int32_t *a, int32_t *b) {
   shift_array_asm(a, 512); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 512, ntt_red512_psi_powers);
-  ntt_red512_gs_std2rev_asm(a);
-  reduce_array_asm(a, 512);
+  ntt_red512_gs_std2rev_fused_asm(a);
 
   shift_array_asm(b, 512);
-  mul_reduce_array16_asm(b, 512, ntt_red512_psi_powers);
-  ntt_red512_gs_std2rev_asm(b);
-  reduce_array_asm(b, 512);
+  ntt_red512_gs_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -57,21 +47,15 @@ void ntt_red512_product2_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red512_ct_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 512, ntt_red512_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 512); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 512);
+  mul_reduce_finalize_asm(c, 512, ntt_red512_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red512_product3_asm(int32_t *c, int32_t *a, int32_t *b) {
   shift_array_asm(a, 512); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 512, ntt_red512_psi_powers);
-  ntt_red512_ct_std2rev_asm(a);
-  reduce_array_asm(a, 512);
+  ntt_red512_ct_std2rev_fused_asm(a);
 
   shift_array_asm(b, 512);
-  mul_reduce_array16_asm(b, 512, ntt_red512_psi_powers);
-  ntt_red512_ct_std2rev_asm(b);
-  reduce_array_asm(b, 512);
+  ntt_red512_ct_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -81,21 +65,15 @@ void ntt_red512_product3_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red512_gs_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 512, ntt_red512_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 512); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 512);
+  mul_reduce_finalize_asm(c, 512, ntt_red512_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red512_product4_asm(int32_t *c, int32_t *a, int32_t *b) {
   shift_array_asm(a, 512); // convert to [-(Q-1)/2, (Q-1)/2]
-  mul_reduce_array16_asm(a, 512, ntt_red512_psi_powers);
-  ntt_red512_gs_std2rev_asm(a);
-  reduce_array_asm(a, 512);
+  ntt_red512_gs_std2rev_fused_asm(a);
 
   shift_array_asm(b, 512);
-  mul_reduce_array16_asm(b, 512, ntt_red512_psi_powers);
-  ntt_red512_gs_std2rev_asm(b);
-  reduce_array_asm(b, 512);
+  ntt_red512_gs_std2rev_fused_asm(b);
   
   // at this point:
   // a = NTT(a) * 3, -524287 <= a[i] <= 536573
@@ -105,25 +83,61 @@ void ntt_red512_product4_asm(int32_t *c, int32_t *a, int32_t *b) {
 
   // we have: -130 <= c[i] <= 12413
   intt_red512_gs_rev2std_asm(c);
-  mul_reduce_array16_asm(c, 512, ntt_red512_scaled_inv_psi_powers);
-  reduce_array_twice_asm(c, 512); // c[i] = 9 * c[i] mod Q
-  correct_asm(c, 512);
+  mul_reduce_finalize_asm(c, 512, ntt_red512_scaled_inv_psi_powers); // rescale, reduce twice, convert to [0, Q-1]
 }
 
 void ntt_red512_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
   shift_array_asm(a, 512);
-  mulntt_red512_ct_std2rev_asm(a);
+  mulntt_red512_ct_std2rev_fused_asm(a);
+
+  shift_array_asm(b, 512);
+  mulntt_red512_ct_std2rev_fused_asm(b);
+
+  mul_reduce_array_asm(c, 512, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 512);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red512_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 512, ntt_red512_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red512_product6_asm(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 512);
+  shift_array_asm(b, 512);
+  mulntt_red512_ct_std2rev_fused2_asm(a, b);
+
+  mul_reduce_array_asm(c, 512, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 512);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red512_gs_rev2std_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 512, ntt_red512_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red512_product_4step_asm(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 512);
+  mulntt_red512_ct_std2rev_4step_asm(a, c); // c is used as scratch
   reduce_array_asm(a, 512);
 
   shift_array_asm(b, 512);
-  mulntt_red512_ct_std2rev_asm(b);
+  mulntt_red512_ct_std2rev_4step_asm(b, c);
   reduce_array_asm(b, 512);
 
   mul_reduce_array_asm(c, 512, a, b); // c[i] = 3 * a[i] * b[i] 
   reduce_array_twice_asm(c, 512);  // c[i] = 9 * c[i] mod Q
 
-  inttmul_red512_gs_rev2std_asm(c);
-  scalar_mul_reduce_array_asm(c, 512, ntt_red512_rescale8);
-  reduce_array_twice_asm(c, 512);
-  correct_asm(c, 512);
+  inttmul_red512_gs_rev2std_4step_asm(c, a); // a is used as scratch
+  scalar_mul_reduce_finalize_asm(c, 512, ntt_red512_rescale8); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red512_product_simd_asm(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 512);
+  mulntt_red512_ct_std2rev_simd_fused_asm(a);
+
+  shift_array_asm(b, 512);
+  mulntt_red512_ct_std2rev_simd_fused_asm(b);
+
+  mul_reduce_array_asm(c, 512, a, b); // c[i] = 3 * a[i] * b[i] 
+  reduce_array_twice_asm(c, 512);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red512_gs_rev2std_simd_asm(c);
+  scalar_mul_reduce_finalize_asm(c, 512, ntt_red512_rescale8); // rescale, reduce twice, convert to [0, Q-1]
 }
@@ -0,0 +1,58 @@
+/*
+ * NTT for Q=12289, any n = 2^i <= 1024, using one set of tables.
+ */
+
+#include <assert.h>
+
+#include "ntt_red_shared.h"
+
+/*
+ * log2(n)
+ */
+static uint32_t log_size(uint32_t n) {
+  uint32_t k;
+
+  assert(n > 0 && (n & (n - 1)) == 0 && n <= (uint32_t) ntt_red_shared_max_n);
+  k = 0;
+  while ((((uint32_t) 1) << k) < n) k ++;
+  return k;
+}
+
+void ntt_red_shared_product(int32_t *c, int32_t *a, int32_t *b, uint32_t n) {
+  uint32_t k;
+
+  k = log_size(n);
+
+  shift_array(a, n);
+  mulntt_red_shared_ct_std2rev(a, n);
+  reduce_array(a, n);
+
+  shift_array(b, n);
+  mulntt_red_shared_ct_std2rev(b, n);
+  reduce_array(b, n);
+
+  mul_reduce_array(c, n, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice(c, n);     // c[i] = 9 * c[i] mod Q
+
+  inttmul_red_shared_gs_rev2std(c, n);
+  scalar_mul_reduce_finalize(c, n, ntt_red_shared_rescale8[k]); // rescale, reduce twice, convert to [0, Q-1]
+}
+
+void ntt_red_shared_product_asm(int32_t *c, int32_t *a, int32_t *b, uint32_t n) {
+  uint32_t k;
+
+  k = log_size(n);
+  assert(n >= 16);
+
+  shift_array_asm(a, n);
+  mulntt_red_shared_ct_std2rev_fused_asm(a, n);
+
+  shift_array_asm(b, n);
+  mulntt_red_shared_ct_std2rev_fused_asm(b, n);
+
+  mul_reduce_array_asm(c, n, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice_asm(c, n);     // c[i] = 9 * c[i] mod Q
+
+  inttmul_red_shared_gs_rev2std_asm(c, n);
+  scalar_mul_reduce_finalize_asm(c, n, ntt_red_shared_rescale8[k]); // rescale, reduce twice, convert to [0, Q-1]
+}
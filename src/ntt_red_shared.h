@@ -0,0 +1,85 @@
+/*
+ * NTT for Q=12289, any n = 2^i <= 1024, using one set of tables
+ * (ntt_red_shared_tables.h).
+ *
+ * The ntt_red<n>_tables are built for each size with unrelated roots,
+ * so each size has its own tables. Here, the root for size n is
+ * psi^(1024/n) (with psi the root used for n=1024): then the tables
+ * for size n are the first n elements of the tables for 1024 and the
+ * kernels of ntt_red.h and ntt_asm.h use them directly.
+ *
+ * The NTT values differ from the ntt_red<n> versions for n < 1024
+ * (different roots), but the products are the same.
+ */
+
+#ifndef __NTT_RED_SHARED_H
+#define __NTT_RED_SHARED_H
+
+#include <stdint.h>
+
+#include "ntt_red_shared_tables.h"
+#include "ntt_red.h"
+#include "ntt_asm.h"
+
+/*
+ * NTT variants: as in ntt_red.h
+ * - n must be a power of two between 2 and 1024
+ */
+static inline void ntt_red_shared_ct_std2rev(int32_t *a, uint32_t n) {
+  ntt_red_ct_std2rev(a, n, ntt_red_shared_omega_powers_rev);
+}
+
+static inline void intt_red_shared_gs_rev2std(int32_t *a, uint32_t n) {
+  ntt_red_gs_rev2std(a, n, ntt_red_shared_inv_omega_powers_rev);
+}
+
+static inline void mulntt_red_shared_ct_std2rev(int32_t *a, uint32_t n) {
+  mulntt_red_ct_std2rev(a, n, ntt_red_shared_mixed_powers_rev);
+}
+
+static inline void inttmul_red_shared_gs_rev2std(int32_t *a, uint32_t n) {
+  nttmul_red_gs_rev2std(a, n, ntt_red_shared_inv_mixed_powers_rev);
+}
+
+/*
+ * AVX2 versions
+ * - n must be a power of two between 16 and 1024
+ */
+static inline void ntt_red_shared_ct_std2rev_asm(int32_t *a, uint32_t n) {
+  ntt_red_ct_std2rev_asm(a, n, ntt_red_shared_omega_powers_rev);
+}
+
+static inline void intt_red_shared_gs_rev2std_asm(int32_t *a, uint32_t n) {
+  ntt_red_gs_rev2std_asm(a, n, ntt_red_shared_inv_omega_powers_rev);
+}
+
+static inline void mulntt_red_shared_ct_std2rev_asm(int32_t *a, uint32_t n) {
+  mulntt_red_ct_std2rev_asm(a, n, ntt_red_shared_mixed_powers_rev);
+}
+
+static inline void inttmul_red_shared_gs_rev2std_asm(int32_t *a, uint32_t n) {
+  nttmul_red_gs_rev2std_asm(a, n, ntt_red_shared_inv_mixed_powers_rev);
+}
+
+static inline void mulntt_red_shared_ct_std2rev_fused_asm(int32_t *a, uint32_t n) {
+  mulntt_red_ct_std2rev_fused_asm(a, n, ntt_red_shared_mixed_powers_rev);
+}
+
+/*
+ * PRODUCTS
+ */
+
+/*
+ * Same as ntt_red<n>_product5 for any n = 2^i <= 1024
+ * - the inputs a and b are modified
+ * - they must contain elements in the range [0, Q-1]
+ * - the result c is in that range
+ */
+extern void ntt_red_shared_product(int32_t *c, int32_t *a, int32_t *b, uint32_t n);
+
+/*
+ * Same as ntt_red<n>_product5_asm for n = 2^i between 16 and 1024
+ */
+extern void ntt_red_shared_product_asm(int32_t *c, int32_t *a, int32_t *b, uint32_t n);
+
+#endif /* __NTT_RED_SHARED_H */
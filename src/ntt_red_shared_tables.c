@@ -0,0 +1,553 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red_shared_tables.h"
+
+const int32_t ntt_red_shared_rescale8[11] = {
+     9545, // n = 1
+    10917, // n = 2
+    11603, // n = 4
+    11946, // n = 8
+     5973, // n = 16
+     9131, // n = 32
+    10710, // n = 64
+     5355, // n = 128
+     8822, // n = 256
+     4411, // n = 512
+     8350, // n = 1024
+};
+
+const int16_t ntt_red_shared_omega_powers_rev[1024] = {
+        0, -4096, -4096,   493, -4096,   493,  5444,  2381,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+};
+
+const int16_t ntt_red_shared_inv_omega_powers_rev[1024] = {
+        0, -4096, -4096,  -493, -4096,  -493, -2381, -5444,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4096,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+};
+
+const int16_t ntt_red_shared_mixed_powers_rev[1024] = {
+        0,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     -354,  4861, -5698,  2912,  2859,  1045, -5012, -2481,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -2305, -5042, -4053,  2645, -1484,  4895, -2780,  5195,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     2686,  3247, -3978,  2969,  3510,  5332, -2865,  2370,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5736, -4134, -1305,  -722,  4043, -5146,  1479,    -1,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+    -4320,  1000, -3091,   -81,  4896,  2963, -3051, -2366,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+     4989,  5331,  4278, -1673,  4177, -3584,  2525, -1381,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+    -5755,  4632, -4388, -1260,  2426,  -334,  1696,  1428,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+    -5782,  1566, -2948,  2503, -2459,   683,    64, -3656,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     3315,  -426, -4754, -1858, -3757, -1975,  -347,  2925,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+     2908,  -218, -3529,  3434, -4115, -3030,  2361,  1843,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     4624, -6077,  3263, -3600, -3602,  6068,  -421,  4080,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3174,   -52,  2766, -1323, -6055,  3336,  -677, -5874,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+    -4536,  1050, -3860,  5445,  2683, -1190, -3818,  6118,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+    -3879,  1922, -2033,  3998, -5435, -1359,  -973, -1254,
+      338, -3947,  2455,  5690,  2894,  3654,  1314,  1744,
+    -4119,  3343, -1522, -2151, -5163, -4608,  5002,   -20,
+    -3624, -1892, -3344, -5598, -5724,  1325, -1945, -1029,
+     5115, -4939, -2442,  1248, -5797,  3959, -2148,  5959,
+      923,  1038, -4167,  6085,  2231, -6092,  -193, -2800,
+     -377, -4578,  -375, -1620,  -392, -2185,   425,  1836,
+     3338, -3276,  2212,  2674,  -506,  1255, -5784, -1392,
+    -2575,  1165, -1942,  3408, -1178,  2776,  5478,  3511,
+     -204,  5509, -1409,  5219,  2689, -4605, -4138,  -180,
+     1468, -3981,  -463,  3407, -2483,  2054,  1344, -3042,
+    -3121,  4705,  2600, -1057, -3017, -1236,  5246,  4475,
+    -2360,  -364, -5216,  3028, -5518, -1226, -4739, -4251,
+    -3393, -4335, -3375, -2291, -3528,  4913,  3825,  4235,
+    -4499, -5672, -1737,  -622,  -636,  5609, -2947,  3982,
+     1403, -1804, -5189,  6094,  1687,   406,   146, -5268,
+    -4554,  -994, -2900,  -239, -4670,  -512, -4906, -5464,
+     1417, -5676,  2257, -4505, -4883,  3975, -5835, -3087,
+     3056, -2528,  4963,  3744, -5102,  -412,  5845,  5588,
+      -68, -2260, -4566,  5836, -3200, -1535,  2717,   -60,
+    -3607, -1327,  3942,  5232, -4924,  4781,   448, -1014,
+    -2275,  2461, -5653, -4267, -1518,  3765, -5063, -4176,
+     4564,  3495, -5826, -2065, -3534, -3961,  4145, -1756,
+    -1131, -1445, -1125, -4860, -1176,  5734,  1275,  5508,
+    -5596, -5987,  -579,  3889,  -212,  5966,  3114, -2769,
+     2926,  1826, -4489, -3171,  3238, -3708,  3449,  1136,
+     5209, -1092, -3359, -3205, -4265, -3678, -1928,  -464,
+     4404,   346, -1389, -2068,  4840, -6127,  4032,  3163,
+    -4222, -1526,  -125,  -540, -4227,  3368,  4238,   612,
+     4209, -5412, -3278,  5993,  5061,  1218,   438, -3515,
+    -1373, -2982,  3589,  -717, -1721, -1536, -2429, -4103,
+    -1208, -4727, -5211, -1866, -1908,  4538,  3448,  -343,
+     1705,  2450,  -814,   416,  2164,  5416,  -716, -2110,
+    -2672,  5170,  -865, -1279,  2209, -1763, -3116,  -189,
+    -5832,  1350,  3815,  1734,  1694, -1530,  3869, -4423,
+     2253,  1868,  2730, -5411,  4820,  1160, -3094, -4518,
+    -2478, -2840, -3019, -4194, -4565, -4974,  1783, -5078,
+    -5406,  4665,  5673, -3020,  3669, -5287,   944, -4770,
+     2035, -1040, -6125, -1882,  1790,  5275, -1251,  5410,
+    -2828, -4352, -4834,  2712,   -72,  4113,  3840,  1842,
+    -1095,  2643, -3045, -5781,  1241,  4378,  3451,  4094,
+    -3332,  -139, -2532,  3317,  2957, -1481, -2046, -2940,
+    -4697, -3578, -3466, -1701,  4504,   778, -2626,  -530,
+     2276,  -982, -2593,  -879, -4218,  4390,  3758,  3454,
+    -5776, -1849, -3268, -3795,    -8,   457,  4523,  4301,
+     6026,  2929, -5969, -4649,  3821, -1681,  1030,  -466,
+    -3846,  1573, -3793, -6063,  1901, -2602,  5118,  -502,
+     2434,  -791, -2827, -2873, -1120,  2535, -5808,   -21,
+     -648,   150, -2307,  4289,  5650,  -170, -2301,   874,
+    -5530,  5604, -4099, -3944,  2171,  3480,  3007, -1265,
+     4855,  3769,  3232,  -293, -1406, -2633,  5349, -2945,
+    -5207,  4050,  -844,  5202,  5082, -4590,  -682,  -980,
+    -5662, -5289,  2941,  -567, -2595, -3837,  3221, -4273,
+     3805,  -767, -2213, -4153,  -216,    50,  -769,  5526,
+    -3285, -4360,  3154, -5054,  3723,   845, -1936,    -7,
+     6105, -3120, -6086, -5646,  5370,  3536, -3753,  3941,
+    -1282, -3572,  2832, -2021,  4730,  3229,  1706,  3929,
+    -5461, -2946,  4510, -2637,  -365,   881, -1015, -1927,
+    -5039, -5547,  2485,   904,   -24,  1371,  1280,   614,
+    -1802,  1555,  1891, -5103,  1223,  2334,  4411, -1590,
+    -3418, -4443, -6138,  3469,  4693, -2338,  -417, -2293,
+    -4987, -2373,  3808,  3670, -3360, -4684, -5135,   -63,
+    -1944,   450,  5368,   578,  4661,  -510,  5386,  2622,
+      751,  4719,   910, -5900,  5703,  4483,  3065, -1506,
+     -826, -5043,  3090, -1398, -5618, -1658, -3502, -5789,
+};
+
+const int16_t ntt_red_shared_inv_mixed_powers_rev[1024] = {
+        0,  -493, -2381, -5444,  4337,   435,  1378,  1912,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     2481,  5012, -1045, -2859, -2912,  5698, -4861,   354,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+    -2370,  2865, -5332, -3510, -2969,  3978, -3247, -2686,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -5195,  2780, -4895,  1484, -2645,  4053,  5042,  2305,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1428, -1696,   334, -2426,  1260,  4388, -4632,  5755,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+     1381, -2525,  3584, -4177,  1673, -4278, -5331, -4989,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+     2366,  3051, -2963, -4896,    81,  3091, -1000,  4320,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+     1254,   973,  1359,  5435, -3998,  2033, -1922,  3879,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+    -6118,  3818,  1190, -2683, -5445,  3860, -1050,  4536,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+     5874,   677, -3336,  6055,  1323, -2766,    52, -3174,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -4080,   421, -6068,  3602,  3600, -3263,  6077, -4624,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+    -1843, -2361,  3030,  4115, -3434,  3529,   218, -2908,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -2925,   347,  1975,  3757,  1858,  4754,   426, -3315,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+     3656,   -64,  -683,  2459, -2503,  2948, -1566,  5782,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+     5789,  3502,  1658,  5618,  1398, -3090,  5043,   826,
+     1506, -3065, -4483, -5703,  5900,  -910, -4719,  -751,
+    -2622, -5386,   510, -4661,  -578, -5368,  -450,  1944,
+       63,  5135,  4684,  3360, -3670, -3808,  2373,  4987,
+     2293,   417,  2338, -4693, -3469,  6138,  4443,  3418,
+     1590, -4411, -2334, -1223,  5103, -1891, -1555,  1802,
+     -614, -1280, -1371,    24,  -904, -2485,  5547,  5039,
+     1927,  1015,  -881,   365,  2637, -4510,  2946,  5461,
+    -3929, -1706, -3229, -4730,  2021, -2832,  3572,  1282,
+    -3941,  3753, -3536, -5370,  5646,  6086,  3120, -6105,
+        7,  1936,  -845, -3723,  5054, -3154,  4360,  3285,
+    -5526,   769,   -50,   216,  4153,  2213,   767, -3805,
+     4273, -3221,  3837,  2595,   567, -2941,  5289,  5662,
+      980,   682,  4590, -5082, -5202,   844, -4050,  5207,
+     2945, -5349,  2633,  1406,   293, -3232, -3769, -4855,
+     1265, -3007, -3480, -2171,  3944,  4099, -5604,  5530,
+     -874,  2301,   170, -5650, -4289,  2307,  -150,   648,
+       21,  5808, -2535,  1120,  2873,  2827,   791, -2434,
+      502, -5118,  2602, -1901,  6063,  3793, -1573,  3846,
+      466, -1030,  1681, -3821,  4649,  5969, -2929, -6026,
+    -4301, -4523,  -457,     8,  3795,  3268,  1849,  5776,
+    -3454, -3758, -4390,  4218,   879,  2593,   982, -2276,
+      530,  2626,  -778, -4504,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481, -2957, -3317,  2532,   139,  3332,
+    -4094, -3451, -4378, -1241,  5781,  3045, -2643,  1095,
+    -1842, -3840, -4113,    72, -2712,  4834,  4352,  2828,
+    -5410,  1251, -5275, -1790,  1882,  6125,  1040, -2035,
+     4770,  -944,  5287, -3669,  3020, -5673, -4665,  5406,
+     5078, -1783,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, -1160, -4820,  5411, -2730, -1868, -2253,
+     4423, -3869,  1530, -1694, -1734, -3815, -1350,  5832,
+      189,  3116,  1763, -2209,  1279,   865, -5170,  2672,
+     2110,   716, -5416, -2164,  -416,   814, -2450, -1705,
+      343, -3448, -4538,  1908,  1866,  5211,  4727,  1208,
+     4103,  2429,  1536,  1721,   717, -3589,  2982,  1373,
+     3515,  -438, -1218, -5061, -5993,  3278,  5412, -4209,
+     -612, -4238, -3368,  4227,   540,   125,  1526,  4222,
+    -3163, -4032,  6127, -4840,  2068,  1389,  -346, -4404,
+      464,  1928,  3678,  4265,  3205,  3359,  1092, -5209,
+    -1136, -3449,  3708, -3238,  3171,  4489, -1826, -2926,
+     2769, -3114, -5966,   212, -3889,   579,  5987,  5596,
+    -5508, -1275, -5734,  1176,  4860,  1125,  1445,  1131,
+     1756, -4145,  3961,  3534,  2065,  5826, -3495, -4564,
+     4176,  5063, -3765,  1518,  4267,  5653, -2461,  2275,
+     1014,  -448, -4781,  4924, -5232, -3942,  1327,  3607,
+       60, -2717,  1535,  3200, -5836,  4566,  2260,    68,
+    -5588, -5845,   412,  5102, -3744, -4963,  2528, -3056,
+     3087,  5835, -3975,  4883,  4505, -2257,  5676, -1417,
+     5464,  4906,   512,  4670,   239,  2900,   994,  4554,
+     5268,  -146,  -406, -1687, -6094,  5189,  1804, -1403,
+    -3982,  2947, -5609,   636,   622,  1737,  5672,  4499,
+    -4235, -3825, -4913,  3528,  2291,  3375,  4335,  3393,
+     4251,  4739,  1226,  5518, -3028,  5216,   364,  2360,
+    -4475, -5246,  1236,  3017,  1057, -2600, -4705,  3121,
+     3042, -1344, -2054,  2483, -3407,   463,  3981, -1468,
+      180,  4138,  4605, -2689, -5219,  1409, -5509,   204,
+    -3511, -5478, -2776,  1178, -3408,  1942, -1165,  2575,
+     1392,  5784, -1255,   506, -2674, -2212,  3276, -3338,
+    -1836,  -425,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, -2231, -6085,  4167, -1038,  -923,
+    -5959,  2148, -3959,  5797, -1248,  2442,  4939, -5115,
+     1029,  1945, -1325,  5724,  5598,  3344,  1892,  3624,
+       20, -5002,  4608,  5163,  2151,  1522, -3343,  4119,
+    -1744, -1314, -3654, -2894, -5690, -2455,  3947,  -338,
+};
+
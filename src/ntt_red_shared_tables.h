@@ -0,0 +1,43 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED_SHARED_TABLES_H
+#define __NTT_RED_SHARED_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS: the root for size m <= max_n is psi^(max_n/m)
+ */
+static const int32_t ntt_red_shared_max_n = 1024;
+static const int32_t ntt_red_shared_log_max_n = 10;
+static const int32_t ntt_red_shared_psi = 1014;
+static const int32_t ntt_red_shared_omega = 8209;
+static const int32_t ntt_red_shared_inv_psi = 5078;
+static const int32_t ntt_red_shared_inv_omega = 3762;
+static const int32_t ntt_red_shared_inv_k = 8193;
+
+/*
+ * RESCALING FACTORS: rescale8[i] is for size 2^i
+ */
+extern const int32_t ntt_red_shared_rescale8[11];
+
+/*
+ * TABLES FOR NTT COMPUTATION: size m uses the first m elements
+ */
+extern const int16_t ntt_red_shared_omega_powers_rev[1024];
+extern const int16_t ntt_red_shared_inv_omega_powers_rev[1024];
+extern const int16_t ntt_red_shared_mixed_powers_rev[1024];
+extern const int16_t ntt_red_shared_inv_mixed_powers_rev[1024];
+
+#endif /* __NTT_RED_SHARED_TABLES_H */
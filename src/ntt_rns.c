@@ -0,0 +1,256 @@
+/*
+ * BD: products with large coefficients using several primes (RNS).
+ */
+
+#include <assert.h>
+
+#include "ntt_rns.h"
+#include "ntt_ln.h"
+#include "ntt_asm.h"
+
+typedef void (*array_fun_t)(int32_t *a, uint32_t n);
+typedef void (*scalar_fun_t)(int32_t *a, uint32_t n, int32_t c);
+
+/*
+ * Channel i: modulus q_i and its kernels.
+ *
+ * garner[j] for j < i is used to compute the mixed-radix digit v_i:
+ *
+ *    s := x_i
+ *    for j = 0 ... i-1: s := red(mul_red(s - v_j, garner[j]))
+ *    v_i := correct(s)
+ *
+ * mul_red and red each multiply by k_i, so garner[j] = inverse(q_j) *
+ * inverse(k_i)^2 modulo q_i (in [-q_i/2, q_i/2]). Then v_i is
+ * (...((x_i - v_0)/q_0 - v_1)/q_1 ... - v_{i-1})/q_{i-1} modulo q_i.
+ *
+ * Bounds: before each subtraction, s and v_j are less than 2^20 in
+ * absolute value, so |(s - v_j) * garner[j]| < 2^39. This is well
+ * within the mul_red bound for each q_i, and after the final red,
+ * s is in [-q_i, 2q_i - 1] as required by correct.
+ */
+typedef struct rns_channel_s {
+  ntt_pool_fun_t product;
+  ntt_pool_fun_t product_asm;
+  scalar_fun_t scalar_mul_reduce;
+  scalar_fun_t scalar_mul_reduce_asm;
+  array_fun_t reduce;
+  array_fun_t reduce_asm;
+  array_fun_t correct;
+  array_fun_t correct_asm;
+  int32_t garner[NTT_RNS_CHANNELS];
+} rns_channel_t;
+
+#define RNS_CHANNEL(q) \
+  ntt_ln##q##_product, ntt_ln##q##_product_asm, \
+  ntt_ln##q##_scalar_mul_reduce_array, ntt_ln##q##_scalar_mul_reduce_array_asm, \
+  ntt_ln##q##_reduce_array, ntt_ln##q##_reduce_array_asm, \
+  ntt_ln##q##_correct, ntt_ln##q##_correct_asm
+
+static const rns_channel_t channel[NTT_RNS_CHANNELS] = {
+  { RNS_CHANNEL(12289), { 0 } },
+  { RNS_CHANNEL(40961), { 3511 } },
+  { RNS_CHANNEL(65537), { -20164, -21843 } },
+  { RNS_CHANNEL(786433), { -22192, 158439, -166819 } },
+};
+
+const int32_t ntt_rns_primes[NTT_RNS_CHANNELS] = {
+  12289, 40961, 65537, 786433,
+};
+
+/*
+ * Mixed-radix weights: q0, q0 * q1, q0 * q1 * q2
+ */
+#define RNS_Q1 ((uint64_t) 12289)
+#define RNS_Q2 ((uint64_t) 503369729)
+#define RNS_Q3 ((uint64_t) 32989341929473)
+
+/*
+ * To get the sign of the result: x = v0 + v1 Q1 + v2 Q2 + v3 Q3 is
+ * in [0, P-1]. If x < 2^63 then v3 <= 2^63/Q3 < 279587, and if
+ * x >= P - 2^63 then v3 >= 506846. So x is the result if v3 <= q3/2
+ * and x - P otherwise.
+ */
+#define RNS_HALF_Q3 393216
+
+
+/*
+ * CONVERSIONS
+ */
+void ntt_rns_from_int64(ntt_rns_poly_t *x, const int64_t *a) {
+  uint32_t i, j;
+  int64_t q, r;
+
+  for (i=0; i<NTT_RNS_CHANNELS; i++) {
+    q = ntt_rns_primes[i];
+    for (j=0; j<NTT_RNS_N; j++) {
+      r = a[j] % q;
+      if (r < 0) r += q;
+      x->r[i][j] = (int32_t) r;
+    }
+  }
+}
+
+/*
+ * a[j] := a[j] - b[j]
+ */
+static void sub_array(int32_t *a, const int32_t *b) {
+  uint32_t j;
+
+  for (j=0; j<NTT_RNS_N; j++) {
+    a[j] -= b[j];
+  }
+}
+
+/*
+ * Combine the digits: v3 is centered then the sum is computed modulo 2^64.
+ */
+static void combine(int64_t *c, const ntt_rns_poly_t *x) {
+  uint32_t j;
+  int32_t v3;
+  uint64_t s;
+
+  for (j=0; j<NTT_RNS_N; j++) {
+    v3 = x->r[3][j];
+    v3 -= ((RNS_HALF_Q3 - v3) >> 31) & 786433;
+    s = (uint64_t) x->r[0][j] + (uint64_t) x->r[1][j] * RNS_Q1 + (uint64_t) x->r[2][j] * RNS_Q2
+      + (uint64_t) (int64_t) v3 * RNS_Q3;
+    c[j] = (int64_t) s;
+  }
+}
+
+void ntt_rns_to_int64(int64_t *c, ntt_rns_poly_t *x) {
+  const rns_channel_t *ch;
+  uint32_t i, j;
+
+  for (i=1; i<NTT_RNS_CHANNELS; i++) {
+    ch = channel + i;
+    for (j=0; j<i; j++) {
+      sub_array(x->r[i], x->r[j]);
+      ch->scalar_mul_reduce(x->r[i], NTT_RNS_N, ch->garner[j]);
+      ch->reduce(x->r[i], NTT_RNS_N);
+    }
+    ch->correct(x->r[i], NTT_RNS_N);
+  }
+  combine(c, x);
+}
+
+void ntt_rns_to_int64_asm(int64_t *c, ntt_rns_poly_t *x) {
+  const rns_channel_t *ch;
+  uint32_t i, j;
+
+  for (i=1; i<NTT_RNS_CHANNELS; i++) {
+    ch = channel + i;
+    for (j=0; j<i; j++) {
+      sub_array(x->r[i], x->r[j]);
+      ch->scalar_mul_reduce_asm(x->r[i], NTT_RNS_N, ch->garner[j]);
+      ch->reduce_asm(x->r[i], NTT_RNS_N);
+    }
+    ch->correct_asm(x->r[i], NTT_RNS_N);
+  }
+  combine(c, x);
+}
+
+
+/*
+ * CHANNEL PRODUCTS
+ */
+void ntt_rns_mul(ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b) {
+  uint32_t i;
+
+  for (i=0; i<NTT_RNS_CHANNELS; i++) {
+    channel[i].product(c->r[i], a->r[i], b->r[i]);
+  }
+}
+
+void ntt_rns_mul_asm(ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b) {
+  uint32_t i;
+
+  for (i=0; i<NTT_RNS_CHANNELS; i++) {
+    channel[i].product_asm(c->r[i], a->r[i], b->r[i]);
+  }
+}
+
+int32_t ntt_rns_mul_pool(ntt_pool_t *pool, ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b) {
+  ntt_pool_fun_t fun[NTT_RNS_CHANNELS];
+  int32_t *pa[NTT_RNS_CHANNELS], *pb[NTT_RNS_CHANNELS], *pc[NTT_RNS_CHANNELS];
+  bool avx2;
+  uint32_t i;
+
+  avx2 = avx2_supported();
+  for (i=0; i<NTT_RNS_CHANNELS; i++) {
+    fun[i] = avx2 ? channel[i].product_asm : channel[i].product;
+    pa[i] = a->r[i];
+    pb[i] = b->r[i];
+    pc[i] = c->r[i];
+  }
+  return ntt_pool_product_funs(pool, NTT_RNS_N, fun, pc, pa, pb, NTT_RNS_CHANNELS);
+}
+
+
+/*
+ * PRODUCTS
+ */
+void ntt_rns_product(int64_t *c, const int64_t *a, const int64_t *b) {
+  ntt_rns_poly_t x, y, z;
+
+  ntt_rns_from_int64(&x, a);
+  ntt_rns_from_int64(&y, b);
+  ntt_rns_mul(&z, &x, &y);
+  ntt_rns_to_int64(c, &z);
+}
+
+void ntt_rns_product_asm(int64_t *c, const int64_t *a, const int64_t *b) {
+  ntt_rns_poly_t x, y, z;
+
+  ntt_rns_from_int64(&x, a);
+  ntt_rns_from_int64(&y, b);
+  ntt_rns_mul_asm(&z, &x, &y);
+  ntt_rns_to_int64_asm(c, &z);
+}
+
+/*
+ * Map a from [0, m-1] to (-m/2, m/2]
+ */
+static void center(int64_t *c, const uint64_t *a, uint64_t m) {
+  uint32_t j;
+
+  for (j=0; j<NTT_RNS_N; j++) {
+    assert(a[j] < m);
+    c[j] = (a[j] > m/2) ? (int64_t) a[j] - (int64_t) m : (int64_t) a[j];
+  }
+}
+
+/*
+ * Map c from integers to [0, m-1]
+ */
+static void uncenter(uint64_t *c, const int64_t *a, uint64_t m) {
+  uint32_t j;
+  int64_t r;
+
+  for (j=0; j<NTT_RNS_N; j++) {
+    r = a[j] % (int64_t) m;
+    if (r < 0) r += m;
+    c[j] = r;
+  }
+}
+
+void ntt_rns_product_mod(uint64_t *c, const uint64_t *a, const uint64_t *b, uint64_t m) {
+  int64_t x[NTT_RNS_N], y[NTT_RNS_N];
+
+  assert(2 <= m && m <= NTT_RNS_MAX_MODULUS);
+  center(x, a, m);
+  center(y, b, m);
+  ntt_rns_product(x, x, y);
+  uncenter(c, x, m);
+}
+
+void ntt_rns_product_mod_asm(uint64_t *c, const uint64_t *a, const uint64_t *b, uint64_t m) {
+  int64_t x[NTT_RNS_N], y[NTT_RNS_N];
+
+  assert(2 <= m && m <= NTT_RNS_MAX_MODULUS);
+  center(x, a, m);
+  center(y, b, m);
+  ntt_rns_product_asm(x, x, y);
+  uncenter(c, x, m);
+}
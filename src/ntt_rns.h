@@ -0,0 +1,115 @@
+/*
+ * BD: products with large coefficients using several primes (RNS).
+ *
+ * A polynomial with large integer coefficients is represented by its
+ * residues modulo the primes of ntt_ln.h that support n = 1024:
+ *
+ *    q0 = 12289, q1 = 40961, q2 = 65537, q3 = 786433
+ *
+ * Their product P = q0 * q1 * q2 * q3 is about 2^64.49. Each channel
+ * (one prime) is multiplied independently by ntt_ln<q>_product, then
+ * the coefficients of the result are recovered modulo P by the Chinese
+ * remainder theorem (Garner's algorithm). The result is exact if all
+ * its coefficients fit in 64 bits (signed).
+ *
+ * This holds if sum_i |a_i| * max_j |b_j| < 2^63, for example when all
+ * the coefficients of a and b are in [-2^26, 2^26].
+ *
+ * Layout: a ntt_rns_poly_t stores the four channels in separate
+ * aligned arrays of 1024 coefficients, so each channel is a normal input
+ * for the single-modulus kernels. The channels of a product can be
+ * computed in parallel on a thread pool (ntt_rns_mul_pool).
+ *
+ * CRT reconstruction: the mixed-radix digits v1, v2, v3 of Garner's
+ * algorithm are computed channel by channel on whole arrays, with the
+ * vectorized kernels of ntt_ln.h (scalar_mul_reduce_array,
+ * reduce_array, correct). Then each coefficient is
+ *
+ *    v0 + v1 * q0 + v2 * (q0 * q1) + v3 * (q0 * q1 * q2)
+ *
+ * computed modulo 2^64, with v3 centered to get signed results.
+ *
+ * All products are modulo X^1024 + 1 (negacyclic).
+ */
+
+#ifndef __NTT_RNS_H
+#define __NTT_RNS_H
+
+#include <stdint.h>
+
+#include "ntt_pool.h"
+
+#define NTT_RNS_N 1024
+#define NTT_RNS_CHANNELS 4
+
+/*
+ * Largest modulus for ntt_rns_product_mod
+ */
+#define NTT_RNS_MAX_MODULUS ((uint64_t) 1 << 27)
+
+typedef struct ntt_rns_poly_s {
+  int32_t r[NTT_RNS_CHANNELS][NTT_RNS_N] __attribute__ ((aligned(64)));
+} ntt_rns_poly_t;
+
+/*
+ * The primes q0 ... q3
+ */
+extern const int32_t ntt_rns_primes[NTT_RNS_CHANNELS];
+
+/*
+ * Conversion to the RNS representation: x->r[i][j] := a[j] mod q_i
+ * - a must be an array of NTT_RNS_N integers
+ * - the residues are in [0, q_i - 1]
+ */
+extern void ntt_rns_from_int64(ntt_rns_poly_t *x, const int64_t *a);
+
+/*
+ * CRT reconstruction: c[j] := the integer in [-2^63, 2^63 - 1] equal to
+ * x modulo P (if there's one).
+ * - the residues of x must be in [0, q_i - 1]
+ * - x is modified (x->r[i] is replaced by the mixed-radix digits)
+ * - the _asm version requires AVX2
+ */
+extern void ntt_rns_to_int64(int64_t *c, ntt_rns_poly_t *x);
+extern void ntt_rns_to_int64_asm(int64_t *c, ntt_rns_poly_t *x);
+
+/*
+ * Product of each channel: c->r[i] := a->r[i] * b->r[i] modulo q_i
+ * - the residues of a and b must be in [0, q_i - 1]
+ * - the residues of c are in [0, q_i - 1]
+ * - a and b are modified
+ * - the _asm version requires AVX2
+ */
+extern void ntt_rns_mul(ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b);
+extern void ntt_rns_mul_asm(ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b);
+
+/*
+ * Same thing with one channel per thread of pool
+ * - a and b are not modified
+ * - the AVX2 products are used if available
+ * Return 0 if the products were computed, -1 otherwise.
+ */
+extern int32_t ntt_rns_mul_pool(ntt_pool_t *pool, ntt_rns_poly_t *c, ntt_rns_poly_t *a, ntt_rns_poly_t *b);
+
+/*
+ * Exact product c := a * b modulo X^1024 + 1 (over the integers)
+ * - a and b: arrays of NTT_RNS_N integers
+ * - the coefficients of the result must be in [-2^63, 2^63 - 1]
+ *   (see above)
+ * - the _asm version requires AVX2
+ */
+extern void ntt_rns_product(int64_t *c, const int64_t *a, const int64_t *b);
+extern void ntt_rns_product_asm(int64_t *c, const int64_t *a, const int64_t *b);
+
+/*
+ * Product modulo X^1024 + 1 and m, for 2 <= m <= NTT_RNS_MAX_MODULUS
+ * - the coefficients of a and b must be in [0, m-1]
+ * - the result is in [0, m-1]
+ * The inputs are mapped to (-m/2, m/2] so the integer product fits
+ * in 63 bits (1024 * 2^26 * 2^26 = 2^62).
+ * - the _asm version requires AVX2
+ */
+extern void ntt_rns_product_mod(uint64_t *c, const uint64_t *a, const uint64_t *b, uint64_t m);
+extern void ntt_rns_product_mod_asm(uint64_t *c, const uint64_t *a, const uint64_t *b, uint64_t m);
+
+#endif /* __NTT_RNS_H */
@@ -0,0 +1,272 @@
+/*
+ * BD: NTT variants with 16-bit coefficients.
+ *
+ * All variants are specialized to Q=12289.
+ * These functions are reference implementations for ntt_short_asm.S:
+ * they perform the same 16-bit operations in the same order.
+ */
+
+#include <assert.h>
+
+#include "ntt_short.h"
+
+#define Q 12289
+
+// Q^-1 modulo 2^16 (as a signed number)
+#define QINV (-12287)
+
+// round(2^28/Q) for Barrett reduction
+#define BARRETT_V 21844
+
+
+/*
+ * Emulation of the AVX2 16-bit multiplications
+ */
+// vpmulhw: high-order half of the product
+static inline int16_t mulhi(int16_t x, int16_t y) {
+  return (int16_t) (((int32_t) x * y) >> 16);
+}
+
+// vpmullw: low-order half of the product
+static inline int16_t mullo(int16_t x, int16_t y) {
+  return (int16_t) ((int32_t) x * y);
+}
+
+// vpmulhrsw: round(x * y/2^15)
+static inline int16_t mulhrs(int16_t x, int16_t y) {
+  return (int16_t) (((int32_t) x * y + 0x4000) >> 15);
+}
+
+/*
+ * Barrett reduction: result in [-6145, 6145]
+ */
+static inline int16_t red(int16_t x) {
+  int16_t t;
+
+  t = mulhi(x, BARRETT_V);
+  t = mulhrs(t, 8);       // round(t/2^12)
+  return x - mullo(t, Q);
+}
+
+/*
+ * Barrett multiplication by w where w_bar = round(w * 2^15/Q)
+ */
+static inline int16_t mul_bar(int16_t x, int16_t w, int16_t w_bar) {
+  int16_t t;
+
+  t = mulhrs(x, w_bar);
+  return mullo(x, w) - mullo(t, Q);
+}
+
+/*
+ * Montgomery multiplication: result == x * y * 2^-16
+ */
+static inline int16_t mul_mont(int16_t x, int16_t y) {
+  int16_t m;
+
+  m = mullo(mullo(x, y), QINV);
+  return mulhi(x, y) - mulhi(m, Q);
+}
+
+/*
+ * Conversion from [-Q+1, Q-1] to [0, Q-1]
+ */
+static inline int16_t correct_coeff(int16_t x) {
+  assert(-Q < x && x < Q);
+  return x + (Q & (x >> 15));
+}
+
+
+/*
+ * NORMALIZATION
+ */
+void short_normalize(int16_t *a, uint32_t n) {
+  uint32_t i;
+  int32_t x;
+
+  for (i=0; i<n; i++) {
+    x = a[i] % Q;
+    if (x < 0) x += Q;
+    a[i] = x;
+  }
+}
+
+
+/*
+ * REDUCTIONS
+ */
+void short_reduce_array(int16_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = red(a[i]);
+  }
+}
+
+void short_mul_array16(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = mul_bar(a[i], p[i], p[n + i]);
+  }
+}
+
+void short_mul_array(int16_t *c, uint32_t n, const int16_t *a, const int16_t *b) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    c[i] = mul_mont(a[i], b[i]);
+  }
+}
+
+void short_mul_finalize(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = correct_coeff(mul_bar(a[i], p[i], p[n + i]));
+  }
+}
+
+void short_scalar_mul_finalize(int16_t *a, uint32_t n, int16_t c, int16_t c_bar) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = correct_coeff(mul_bar(a[i], c, c_bar));
+  }
+}
+
+
+/*
+ * COOLEY-TUKEY/BIT-REVERSE TO STANDARD ORDER
+ */
+void ntt_short_ct_rev2std(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t j, s, t;
+  int16_t x, w, w_bar;
+
+  for (t=1; t<n; t <<= 1) {
+    /*
+     * process m blocks of size t to produce m/2 blocks of size 2t
+     * - m = n/t
+     * - w_t for this round is omega^(n/2t) = p[t]
+     */
+    for (j=0; j<t; j++) {
+      w = p[t + j];   // w_t^j
+      w_bar = p[n + t + j];
+      for (s=j; s<n; s += t + t) {
+        x = mul_bar(a[s + t], w, w_bar);
+        a[s + t] = a[s] - x;
+        a[s] = a[s] + x;
+      }
+    }
+    if (t & 0xAAAAAAAA) {
+      short_reduce_array(a, n);
+    }
+  }
+}
+
+void mulntt_short_ct_rev2std(int16_t *a, uint32_t n, const int16_t *p) {
+  ntt_short_ct_rev2std(a, n, p);
+}
+
+
+/*
+ * COOLEY-TUKEY/STANDARD TO BIT-REVERSE ORDER
+ */
+void ntt_short_ct_std2rev(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t j, s, t, u, d;
+  int16_t x, w, w_bar;
+
+  d = n;
+  for (t=1; t<n; t <<= 1) {
+    d >>= 1;
+    /*
+     * Invariant: d * 2t = n.
+     *
+     * Each iteration produces d blocks of size 2t.
+     * Block i is stored at indices {i, i+d, ..., i+d*(2t-1) } in
+     * bit-reverse order.
+     *
+     * The w_t for this round is omega^(n/2t).
+     * and w_t,j is w_t^bitrev(j)
+     */
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      w = p[t + j]; // w_t^bitrev(j)
+      w_bar = p[n + t + j];
+      for (s=u; s<u+d; s++) {
+        x = mul_bar(a[s + d], w, w_bar);
+        a[s + d] = a[s] - x;
+        a[s] = a[s] + x;
+      }
+    }
+    if (d & 0xAAAAAAAA) {
+      short_reduce_array(a, n);
+    }
+  }
+}
+
+void mulntt_short_ct_std2rev(int16_t *a, uint32_t n, const int16_t *p) {
+  ntt_short_ct_std2rev(a, n, p);
+}
+
+
+/*
+ * GENTLEMAN-SANDE/BIT-REVERSE TO STANDARD ORDER
+ */
+void ntt_short_gs_rev2std(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t j, s, t, u, d;
+  int16_t w, w_bar, x;
+
+  t = n;
+  for (d=1; d<n; d<<=1) {
+    t >>= 1;
+    /*
+     * Split d blocks of size 2t into 2d blocks of size t.
+     * Block i is stored at indices i+dj for j= 0 ... 2t-1, in
+     * bit-reverse order.
+     * w_t = omega^(n/2t) = omega^d
+     */
+    for (j=0, u=0; j<t; j++, u += 2*d) {
+      w = p[t + j];  // w_t^bitrev(j)
+      w_bar = p[n + t + j];
+      for (s=u; s<u+d; s++) {
+        x = a[s + d];
+        a[s + d] = mul_bar(a[s] - x, w, w_bar);
+        a[s] = red(a[s] + x);
+      }
+    }
+  }
+}
+
+void nttmul_short_gs_rev2std(int16_t *a, uint32_t n, const int16_t *p) {
+  ntt_short_gs_rev2std(a, n, p);
+}
+
+
+/*
+ * GENTLEMAN-SANDE/STANDARD TO BIT-REVERSE ORDER
+ */
+void ntt_short_gs_std2rev(int16_t *a, uint32_t n, const int16_t *p) {
+  uint32_t j, s, t;
+  int16_t w, w_bar, x;
+
+  for (t = n>>1; t > 0; t >>= 1) {
+    /*
+     * Split block of size 2t into two blocks of size t
+     * block i is stored at [2ti, 2ti+1, ..., 2ti + 2t - 1] in standard order
+     * w_t is omega^(n/2t)
+     */
+    for (j=0; j<t; j++) {
+      w = p[t + j]; // w_t^j
+      w_bar = p[n + t + j];
+      for (s=j; s<n; s += t + t) {
+        x = a[s + t];
+        a[s + t] = mul_bar(a[s] - x, w, w_bar);
+        a[s] = red(a[s] + x);
+      }
+    }
+  }
+}
+
+void nttmul_short_gs_std2rev(int16_t *a, uint32_t n, const int16_t *p) {
+  ntt_short_gs_std2rev(a, n, p);
+}
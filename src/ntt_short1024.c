@@ -0,0 +1,89 @@
+/*
+ * NTT for Q=12289, n=1024, with 16-bit coefficients.
+ */
+
+#include "ntt_short1024.h"
+
+/*
+ * Input: two arrays a and b in standard order
+ *
+ * Result: 
+ * - the product is stored in array c, in standard order.
+ * - arrays a and b are modified
+ *
+ * The input arrays must contain elements in the range [0, Q-1]
+ * The result is also in that range.
+ */
+void ntt_short1024_product1(int16_t *c, int16_t *a, int16_t *b) {
+  short_mul_array16(a, 1024, ntt_short1024_psi_powers); // -8449 <= a[i] <= 8449
+  ntt_short1024_ct_std2rev(a);
+
+  short_mul_array16(b, 1024, ntt_short1024_psi_powers);
+  ntt_short1024_ct_std2rev(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  short_mul_array(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_short1024_ct_rev2std(c);
+  short_mul_finalize(c, 1024, ntt_short1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_short1024_product2(int16_t *c, int16_t *a, int16_t *b) {
+  short_mul_array16(a, 1024, ntt_short1024_psi_powers); // -8449 <= a[i] <= 8449
+  ntt_short1024_gs_std2rev(a);
+
+  short_mul_array16(b, 1024, ntt_short1024_psi_powers);
+  ntt_short1024_gs_std2rev(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  short_mul_array(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_short1024_ct_rev2std(c);
+  short_mul_finalize(c, 1024, ntt_short1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_short1024_product3(int16_t *c, int16_t *a, int16_t *b) {
+  short_mul_array16(a, 1024, ntt_short1024_psi_powers); // -8449 <= a[i] <= 8449
+  ntt_short1024_ct_std2rev(a);
+
+  short_mul_array16(b, 1024, ntt_short1024_psi_powers);
+  ntt_short1024_ct_std2rev(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  short_mul_array(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_short1024_gs_rev2std(c);
+  short_mul_finalize(c, 1024, ntt_short1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_short1024_product4(int16_t *c, int16_t *a, int16_t *b) {
+  short_mul_array16(a, 1024, ntt_short1024_psi_powers); // -8449 <= a[i] <= 8449
+  ntt_short1024_gs_std2rev(a);
+
+  short_mul_array16(b, 1024, ntt_short1024_psi_powers);
+  ntt_short1024_gs_std2rev(b);
+
+  // at this point:
+  // a = NTT(a), b = NTT(b), -13442 <= a[i], b[i] <= 13442
+  short_mul_array(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  // we have: -8903 <= c[i] <= 8903
+  intt_short1024_gs_rev2std(c);
+  short_mul_finalize(c, 1024, ntt_short1024_scaled_inv_psi_powers); // rescale by 2^16/n, convert to [0, Q-1]
+}
+
+void ntt_short1024_product5(int16_t *c, int16_t *a, int16_t *b) {
+  mulntt_short1024_ct_std2rev(a);
+  mulntt_short1024_ct_std2rev(b);
+
+  short_mul_array(c, 1024, a, b); // c[i] = a[i] * b[i] * 2^-16
+
+  inttmul_short1024_gs_rev2std(c);
+  short_scalar_mul_finalize(c, 1024, ntt_short1024_rescale, ntt_short1024_rescale_bar); // rescale, convert to [0, Q-1]
+}
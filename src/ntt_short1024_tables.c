@@ -0,0 +1,2613 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#include "ntt_short1024_tables.h"
+
+const int16_t ntt_short1024_psi_powers[2048] = {
+        1,  1014, -4080,  4273, -5195,  4251, -2925, -4301,
+     1381,  -612, -6118,  2293,  2481, -3511,  3656, -4094,
+     2366,  2769,  5874, -3929, -2370,  5464, -1843,  -874,
+    -1428,  2110,  1254,  5789, -4096,   338, -1360, -2672,
+    -5828,  1417,  -975, -5530, -3636,  -204,  2057, -3332,
+      827,  2926,  5315, -5461,  4885,   923,  1958, -5406,
+     -790, -2275,  3482,  3805,  -476, -3393,   418,  6026,
+     2731,  4209,  3643, -4987, -6039, -3624,  -325,  2253,
+    -1212,   -68,  4782, -5207,  4372, -3121,  5868,  2276,
+    -2468,  4404,  4749, -1802,  3833,  3338,  5257, -2828,
+    -4255, -1131, -3957,  6105, -3186,  1403, -2882,  2434,
+    -2013, -1208,  3988,   751,  -404, -4119,  1594, -5832,
+    -2639,  3056,  1956,  4855, -4919,  1468,  1583, -4697,
+     5374,  5209, -2344, -5039,  2678,  -377, -1319,  2035,
+    -1062,  4564, -5057, -3285,  -671, -4499, -2767, -3846,
+    -4231, -1373, -3565, -1944, -4976,  5115,   652, -2478,
+    -5736, -3607,  4624, -5662, -2305, -2360,  3315, -5776,
+     4989, -4222, -4536, -3418,  -354, -2575, -5782, -1095,
+    -4320, -5596,  3174, -1282,  2686, -4554,  2908,  -648,
+    -5755,  1705, -3879,  -826, -1912,  2894, -2555,  2209,
+     3328, -4883,  1105,  2171,  1663,  2689, -1512,  2957,
+     -118,  3238,  2169,  -365, -1440,  2231,  1058,  3669,
+    -3201, -1518, -3127,  -216,  2178, -3528, -1293,  3821,
+     3459,  5061, -4948, -3360, -2987, -5724, -3728,  4820,
+    -3542, -3200,  -504,  5082,  4057, -3017,   723, -4218,
+     -480,  4840,  4449,  1223, -1067,  -506,  3054,   -72,
+      726, -1176,  -431,  5370,  1153,  1687,  2447, -1120,
+    -5092, -1908, -5339,  5703, -5277, -5163,  -168,  1694,
+    -2744, -5102,   241, -1406,  -160, -2483,  1483,  4504,
+    -4452, -4265,  1018,   -24,   242,  -392, -4240,  1790,
+    -3712, -3534,  4912,  3723,  2399,  -636, -5876,  1901,
+    -1759, -1721,   -56,  4661, -5011, -5797, -4016, -4565,
+     4043, -4924, -3602, -2595, -1484, -5518, -3757,    -8,
+     4177, -4227,  2683,  4693,  2859, -1178, -2459,  1241,
+     4896,  -212, -6055,  4730,  3510, -4670, -4115,  5650,
+     2426,  2164, -5435, -5618,  5444,  2455, -5297,  -865,
+    -4591,  2257,  2844, -4099, -2704, -1409, -3202, -2532,
+      953, -4489, -4916,  4510,  1632, -4167,  2078,  5673,
+     1170, -5653, -5468, -2213,  4905, -3375, -5908, -5969,
+     5911, -3278, -5862,  3808,  2566, -3344,   948,  2730,
+     3195, -4566,  3029,  -844,  4414,  2600, -5735, -2593,
+      544, -1389,  4789,  1891,   390,  2212, -5919, -4834,
+     1635, -1125,  2127, -6086, -2126, -5189, -1954, -2827,
+    -3241, -5211,   316,   910,  1065, -1522,  5106,  3815,
+    -2625,  4963, -6008,  3232, -3915,  -463, -2500, -3466,
+      130, -3359, -1973,  2485,   545,  -375,   709, -6125,
+    -4805, -5826,  3445,  3154,  3016, -1737, -3991, -3793,
+      355,  3589,  1702,  5368,  -875, -2442, -6099, -3019,
+    -1305,  3942,  3263,  2941, -4053, -5216, -4754, -3268,
+     4278,  -125, -3860, -6138, -5698, -1942, -2948, -3045,
+    -3091,  -579,  2766,  2832, -3978, -2900, -3529, -2307,
+    -4388,  -814, -2033,  3090,  -435,  1314,  5184, -3116,
+    -1351, -5835, -5681,  3007,  1426, -4138, -5383, -2046,
+     2197,  3449, -5079, -1015,  3066,  -193,   922,   944,
+    -1326, -5063,  2920,  -769, -5559,  3825, -4774,  1030,
+     -145,   438,  1728, -5135,  3646, -1945, -5990, -3094,
+    -3621,  2717,  2302,  -682, -3364,  5246, -1693,  3758,
+     1022,  4032, -3789,  4411,  -442, -5784, -3123,  3840,
+    -1853,  1275,  2505, -3753,  4048,   146,   576, -5808,
+    -2881,  3448, -6093,  3065, -1207,  5002, -3329,  3869,
+     2975,  5845,  3532,  5349,  4437,  1344, -1263, -2626,
+     3949, -1928, -1041,  1280, -4714,   425,   835, -1251,
+    -2747,  4145,   192, -1936,  3136, -2947, -2031,  5118,
+     3694, -2429, -5206,  5386,  5088, -2148, -2919,  1783,
+     1479,   448,  -421,  3221, -2780, -4739,  -347,  4523,
+     2525,  4238, -3818,  -417, -5012,  5478,    64,  3451,
+    -3051,  3114,  -677,  1706, -2865, -4906,  2361, -2301,
+     1696,  -716,  -973, -3502,   493, -3947,  3956,  5170,
+    -5023, -5676, -4212,  5604,  4938,  5509, -5369,  -139,
+    -5767,  1826, -4075, -2946, -1017,  1038, -4322,  4665,
+     -955,  2461,   787,  -767, -3531, -4335,  3772,  2929,
+    -3932, -5412,  5415, -2373,  2422, -1892, -1404,  1868,
+     1646, -2260, -5886,  4050,  2174,  4705,  2738,  -982,
+     -339,   346, -5537,  1555,  3778, -3276, -3834, -4352,
+    -1177, -1445, -2839, -3120, -5407, -1804,  1805,  -791,
+    -3289, -4727,  -468,  4719,  4645,  3343, -1962,  1350,
+     4821, -2528,  5009,  3769,  -113, -3981, -5942, -3578,
+    -2837, -1092, -1278, -5547,  3704, -4578,  3150, -1040,
+     2294,  3495,  4698, -4360,  3000, -5672,  -156,  1573,
+    -2548, -2982,  -654,   450,  1607, -4939,  5766, -2840,
+    -4134, -1327, -6077, -5289, -5042,  -364,  -426, -1849,
+     5331, -1526,  1050, -4443,  4861,  1165,  1566,  2643,
+     1000, -5987,   -52, -3572,  3247,  -994,  -218,   150,
+     4632,  2450,  1922, -5043, -1378,  3654, -6122, -1763,
+    -5777,  3975,  -142,  3480,  1777, -4605,   350, -1481,
+    -2476, -3708,   522,   881, -3763, -6092,  4079, -5287,
+    -3014,  3765, -4169,    50,  1544,  4913,  4737, -1681,
+     3637,  1218, -6137, -4684, -6022,  1325,  4049,  1160,
+    -3504, -1535,  4213, -4590,  3271, -1236,   174,  4390,
+     2842, -6127,  5456,  2334, -5101,  1255, -5486,  4113,
+     4611,  5734,  1579,  3536, -2884,   406, -6142,  2535,
+     2089,  4538,  5446,  4483, -1168, -4608, -2692, -1530,
+    -3006,  -412,    58, -2633, -3149,  2054,  5915,   778,
+     2396, -3678, -5925,  1371,  1537, -2185, -3570,  5275,
+     3135, -3961,  2049,   845, -3400,  5609, -2281, -2602,
+     3707, -1536,  3199,  -510, -1002,  3959, -4077, -4974,
+    -5146,  4781,  6068, -3837,  4895, -1226, -1975,   457,
+    -3584,  3368, -1190, -2338,  1045,  2776,   683,  4378,
+     2963,  5966,  3336,  3229,  5332,  -512, -3030,  -170,
+     -334,  5416, -1359, -1658,  2381,  5690,  6119, -1279,
+     5728, -4505,  3438, -3944, -5291,  5219, -4493,  3317,
+    -3748, -3171,  4324, -2637,  5084,  6085,  1112, -3020,
+    -2319, -4267, -1010, -4153,  3985, -2291,  -453, -4649,
+     4890,  5993,  6136,  3670, -2187, -5598,  1146, -5411,
+    -5860,  5836, -5594,  5202,  2847, -1057, -2655,  -879,
+     5791, -2068,  4467, -5103,  -773,  2674, -4433,  2712,
+    -2768, -4860,  -151, -5646,  1630,  6094, -2051, -2873,
+     -729, -1866,   382, -5900,  2143, -2151, -5961,  1734,
+      949,  3744,  -885,  -293, -2166,  3407,  1489, -1701,
+    -4354, -3205, -5574,   904, -5019, -1620,  4046, -1882,
+    -3553, -2065, -4780, -5054,  -243,  -622, -3969, -6063,
+    -3382,  -717, -1987,   578, -3780,  1248,  -295, -4194,
+     -722,  5232, -3600,  -567,  2645,  3028, -1858, -3795,
+    -1673,  -540,  5445,  3469,  2912,  3408,  2503, -5781,
+      -81,  3889, -1323, -2021,  2969,  -239,  3434,  4289,
+    -1260,   416,  3998, -1398, -4337,  1744, -1200,  -189,
+     4978, -3087,  3477, -1265, -4654,  -180,  1815, -2940,
+     5067,  1136, -3262, -1927,   -27, -2800,  -441, -4770,
+     5086, -4176,  5241,  5526,  -420,  4235,  5429,  -466,
+    -5542, -3515,  -400,   -63, -2437, -1029,  1159, -4518,
+     2545,   -60,   605,  -980,  1689,  4475,  3009,  3454,
+       -9,  3163,  -147, -1590, -2401, -1392,  1747,  1842,
+     -140,  5508,  5906,  3941,  2249, -5268,  3963,   -21,
+     3284,  -343, -3710, -1506, -3248,   -20,  4298, -4423,
+      563,  5588,  1003, -2945,    -3, -3042,   -49,  -530,
+     3296,  -464, -3514,   614, -4143,  1836,  6065,  5410,
+     4846, -1756,  1321,    -7,  5191,  3982, -5333,  -502,
+    -5179, -4103,  5529,  2622,  4284,  5959, -3762, -5078,
+    // Barrett companions
+         3,   2704, -10879,  11394, -13852,  11335,  -7799, -11468,
+      3682,  -1632, -16313,   6114,   6615,  -9362,   9749, -10916,
+      6309,   7383,  15663, -10476,  -6319,  14569,  -4914,  -2330,
+     -3808,   5626,   3344,  15436, -10922,    901,  -3626,  -7125,
+    -15540,   3778,  -2600, -14745,  -9695,   -544,   5485,  -8885,
+      2205,   7802,  14172, -14561,  13026,   2461,   5221, -14415,
+     -2106,  -6066,   9285,  10146,  -1269,  -9047,   1115,  16068,
+      7282,  11223,   9714, -13298, -16103,  -9663,   -867,   6008,
+     -3232,   -181,  12751, -13884,  11658,  -8322,  15647,   6069,
+     -6581,  11743,  12663,  -4805,  10221,   8901,  14018,  -7541,
+    -11346,  -3016, -10551,  16279,  -8495,   3741,  -7685,   6490,
+     -5368,  -3221,  10634,   2003,  -1077, -10983,   4250, -15551,
+     -7037,   8149,   5216,  12946, -13116,   3914,   4221, -12524,
+     14330,  13890,  -6250, -13436,   7141,  -1005,  -3517,   5426,
+     -2832,  12170, -13484,  -8759,  -1789, -11996,  -7378, -10255,
+    -11282,  -3661,  -9506,  -5184, -13268,  13639,   1739,  -6607,
+    -15295,  -9618,  12330, -15097,  -6146,  -6293,   8839, -15401,
+     13303, -11258, -12095,  -9114,   -944,  -6866, -15417,  -2920,
+    -11519, -14921,   8463,  -3418,   7162, -12143,   7754,  -1728,
+    -15345,   4546, -10343,  -2202,  -5098,   7717,  -6813,   5890,
+      8874, -13020,   2946,   5789,   4434,   7170,  -4032,   7885,
+      -315,   8634,   5784,   -973,  -3840,   5949,   2821,   9783,
+     -8535,  -4048,  -8338,   -576,   5808,  -9407,  -3448,  10189,
+      9223,  13495, -13194,  -8959,  -7965, -15263,  -9941,  12852,
+     -9445,  -8533,  -1344,  13551,  10818,  -8045,   1928, -11247,
+     -1280,  12906,  11863,   3261,  -2845,  -1349,   8143,   -192,
+      1936,  -3136,  -1149,  14319,   3074,   4498,   6525,  -2986,
+    -13578,  -5088, -14236,  15207, -14071, -13767,   -448,   4517,
+     -7317, -13604,    643,  -3749,   -427,  -6621,   3954,  12010,
+    -11871, -11372,   2714,    -64,    645,  -1045, -11306,   4773,
+     -9898,  -9423,  13098,   9927,   6397,  -1696, -15668,   5069,
+     -4690,  -4589,   -149,  12428, -13362, -15457, -10708, -12172,
+     10780, -13130,  -9605,  -6919,  -3957, -14713, -10018,    -21,
+     11138, -11271,   7154,  12514,   7623,  -3141,  -6557,   3309,
+     13055,   -565, -16145,  12612,   9359, -12452, -10972,  15065,
+      6469,   5770, -14492, -14980,  14516,   6546, -14124,  -2306,
+    -12242,   6018,   7583, -10930,  -7210,  -3757,  -8538,  -6751,
+      2541, -11970, -13108,  12026,   4352, -11111,   5541,  15127,
+      3120, -15073, -14580,  -5901,  13079,  -8999, -15753, -15916,
+     15761,  -8741, -15631,  10154,   6842,  -8917,   2528,   7279,
+      8519, -12175,   8077,  -2250,  11770,   6933, -15292,  -6914,
+      1451,  -3704,  12770,   5042,   1040,   5898, -15783, -12890,
+      4360,  -3000,   5672, -16228,  -5669, -13836,  -5210,  -7538,
+     -8642, -13895,    843,   2426,   2840,  -4058,  13615,  10173,
+     -6999,  13234, -16020,   8618, -10439,  -1235,  -6666,  -9242,
+       347,  -8957,  -5261,   6626,   1453,  -1000,   1891, -16332,
+    -12812, -15535,   9186,   8410,   8042,  -4632, -10642, -10114,
+       947,   9570,   4538,  14314,  -2333,  -6511, -16263,  -8050,
+     -3480,  10511,   8701,   7842, -10807, -13908, -12676,  -8714,
+     11407,   -333, -10292, -16367, -15193,  -5178,  -7861,  -8119,
+     -8242,  -1544,   7375,   7551, -10607,  -7733,  -9410,  -6151,
+    -11700,  -2170,  -5421,   8239,  -1160,   3504,  13823,  -8309,
+     -3602, -15559, -15148,   8018,   3802, -11034, -14353,  -5456,
+      5858,   9197, -13543,  -2706,   8175,   -515,   2458,   2517,
+     -3536, -13500,   7786,  -2050, -14823,  10199, -12730,   2746,
+      -387,   1168,   4608, -13692,   9722,  -5186, -15972,  -8250,
+     -9655,   7245,   6138,  -1819,  -8970,  13988,  -4514,  10021,
+      2725,  10751, -10103,  11762,  -1179, -15423,  -8327,  10239,
+     -4941,   3400,   6679, -10007,  10794,    389,   1536, -15487,
+     -7682,   9194, -16247,   8173,  -3218,  13338,  -8877,  10316,
+      7933,  15585,   9418,  14263,  11831,   3584,  -3368,  -7002,
+     10530,  -5141,  -2776,   3413, -12570,   1133,   2226,  -3336,
+     -7325,  11052,    512,  -5162,   8362,  -7858,  -5416,  13647,
+      9850,  -6477, -13882,  14361,  13567,  -5728,  -7783,   4754,
+      3944,   1195,  -1123,   8589,  -7413, -12636,   -925,  12060,
+      6733,  11300, -10181,  -1112, -13364,  14607,    171,   9202,
+     -8135,   8303,  -1805,   4549,  -7639, -13082,   6295,  -6136,
+      4522,  -1909,  -2594,  -9338,   1315, -10524,  10548,  13786,
+    -13394, -15135, -11231,  14943,  13167,  14689, -14316,   -371,
+    -15377,   4869, -10866,  -7855,  -2712,   2768, -11524,  12439,
+     -2546,   6562,   2098,  -2045,  -9415, -11559,  10058,   7810,
+    -10484, -14431,  14439,  -6327,   6458,  -5045,  -3744,   4981,
+      4389,  -6026, -15695,  10799,   5797,  12546,   7301,  -2618,
+      -904,    923, -14764,   4146,  10074,  -8735, -10223, -11604,
+     -3138,  -3853,  -7570,  -8319, -14417,  -4810,   4813,  -2109,
+     -8770, -12604,  -1248,  12583,  12386,   8914,  -5232,   3600,
+     12855,  -6741,  13356,  10050,   -301, -10615, -15844,  -9541,
+     -7565,  -2912,  -3408, -14791,   9877, -12207,   8399,  -2773,
+      6117,   9319,  12527, -11626,   7999, -15124,   -416,   4194,
+     -6794,  -7951,  -1744,   1200,   4285, -13170,  15375,  -7573,
+    -11023,  -3538, -16204, -14103, -13444,   -971,  -1136,  -4930,
+     14215,  -4069,   2800, -11847,  12962,   3106,   4176,   7047,
+      2666, -15964,   -139,  -9525,   8658,  -2650,   -581,    400,
+     12351,   6533,   5125, -13447,  -3674,   9743, -16324,  -4701,
+    -15404,  10599,   -379,   9279,   4738, -12279,    933,  -3949,
+     -6602,  -9887,   1392,   2349, -10034, -16244,  10876, -14098,
+     -8037,  10039, -11116,    133,   4117,  13100,  12631,  -4482,
+      9698,   3248, -16364, -12490, -16057,   3533,  10796,   3093,
+     -9343,  -4093,  11234, -12239,   8722,  -3296,    464,  11706,
+      7578, -16337,  14548,   6223, -13602,   3346, -14628,  10967,
+     12295,  15289,   4210,   9429,  -7690,   1083, -16377,   6759,
+      5570,  12100,  14521,  11954,  -3114, -12287,  -7178,  -4080,
+     -8015,  -1099,    155,  -7021,  -8397,   5477,  15772,   2074,
+      6389,  -9807, -15799,   3656,   4098,  -5826,  -9519,  14066,
+      8359, -10562,   5464,   2253,  -9066,  14956,  -6082,  -6938,
+      9885,  -4096,   8530,  -1360,  -2672,  10556, -10871, -13263,
+    -13722,  12748,  16180, -10231,  13052,  -3269,  -5266,   1219,
+     -9557,   8981,  -3173,  -6234,   2786,   7402,   1821,  11674,
+      7901,  15908,   8895,   8610,  14218,  -1365,  -8079,   -453,
+      -891,  14441,  -3624,  -4421,   6349,  15172,  16316,  -3410,
+     15273, -12012,   9167, -10516, -14108,  13916, -11980,   8845,
+     -9994,  -8455,  11530,  -7031,  13556,  16225,   2965,  -8053,
+     -6183, -11378,  -2693, -11074,  10626,  -6109,  -1208, -12396,
+     13039,  15980,  16361,   9786,  -5832, -14927,   3056, -14428,
+    -15625,  15561, -14916,  13871,   7591,  -2818,  -7079,  -2344,
+     15441,  -5514,  11911, -13607,  -2061,   7130, -11820,   7231,
+     -7381, -12959,   -403, -15055,   4346,  16249,  -5469,  -7661,
+     -1944,  -4976,   1019, -15732,   5714,  -5736, -15895,   4624,
+      2530,   9983,  -2360,   -781,  -5776,   9085,   3970,  -4536,
+    -11610,  -8546, -14863,   2410, -13383,  -4320,  10788,  -5018,
+     -9474,  -5506, -12746, -13476,   -648,  -1659, -10583, -16167,
+     -9018,  -1912,  -5298,   1541, -10079,   3328,   -787, -11183,
+     -1925,  13951,  -9599,  -1512,   7053,   8074,  -4954, -10119,
+     -4461,  -1440,  14519,   9250,   7765,   9087,   6674, -15415,
+      -216,  10370,  -3528,  -5389,   7917,   -637,   9157,  11436,
+     -3360,   1109,  10660,  -3728, -11564,   4650,  -3200,   -504,
+     13274,  -8231,   9271,  -3373, -12410,   -480,   4840,  -7839,
+     13511,   3029,  -8698,  -5138,    -72,  -7466,  -1176, -12719,
+     13562, -11135,  13975,  14735,  -1120,  11292,  14476,  -1243,
+    -14777,  -9373,  -1067,   -168,  -6498,  -2744,   3090, -12047,
+      6786,   -160,   1613,  -2613,   4504,  11932,   8023,   9210,
+       -24,   8434,   -392,  -4240,  -6402,  -3712,   4658,   4912,
+      -373,  14687,  15748,  10508,   5997, -14047,  10567,    -56,
+      8757,   -915,  -9893,  -4016,  -8661,    -53,  11460, -11794,
+      1501,  14900,   2674,  -7853,     -8,  -8111,   -131,  -1413,
+      8789,  -1237,  -9370,   1637, -11047,   4896,  16172,  14425,
+     12922,  -4682,   3522,    -19,  13842,  10618, -14220,  -1339,
+    -13810, -10940,  14743,   6991,  11423,  15889, -10031, -13540,
+};
+
+const int16_t ntt_short1024_scaled_inv_psi_powers[2048] = {
+       64,  5478, -5012,  -417, -3818,  4238,  2525,  4523,
+     -347, -4739, -2780,  3221,  -421,   448,  1479,  1783,
+    -2919, -2148,  5088,  5386, -5206, -2429,  3694,  5118,
+    -2031, -2947,  3136, -1936,   192,  4145, -2747, -1251,
+      835,   425, -4714,  1280, -1041, -1928,  3949, -2626,
+    -1263,  1344,  4437,  5349,  3532,  5845,  2975,  3869,
+    -3329,  5002, -1207,  3065, -6093,  3448, -2881, -5808,
+      576,   146,  4048, -3753,  2505,  1275, -1853,  3840,
+    -3123, -5784,  -442,  4411, -3789,  4032,  1022,  3758,
+    -1693,  5246, -3364,  -682,  2302,  2717, -3621, -3094,
+    -5990, -1945,  3646, -5135,  1728,   438,  -145,  1030,
+    -4774,  3825, -5559,  -769,  2920, -5063, -1326,   944,
+      922,  -193,  3066, -1015, -5079,  3449,  2197, -2046,
+    -5383, -4138,  1426,  3007, -5681, -5835, -1351, -3116,
+     5184,  1314,  -435,  3090, -2033,  -814, -4388, -2307,
+    -3529, -2900, -3978,  2832,  2766,  -579, -3091, -3045,
+    -2948, -1942, -5698, -6138, -3860,  -125,  4278, -3268,
+    -4754, -5216, -4053,  2941,  3263,  3942, -1305, -3019,
+    -6099, -2442,  -875,  5368,  1702,  3589,   355, -3793,
+    -3991, -1737,  3016,  3154,  3445, -5826, -4805, -6125,
+      709,  -375,   545,  2485, -1973, -3359,   130, -3466,
+    -2500,  -463, -3915,  3232, -6008,  4963, -2625,  3815,
+     5106, -1522,  1065,   910,   316, -5211, -3241, -2827,
+    -1954, -5189, -2126, -6086,  2127, -1125,  1635, -4834,
+    -5919,  2212,   390,  1891,  4789, -1389,   544, -2593,
+    -5735,  2600,  4414,  -844,  3029, -4566,  3195,  2730,
+      948, -3344,  2566,  3808, -5862, -3278,  5911, -5969,
+    -5908, -3375,  4905, -2213, -5468, -5653,  1170,  5673,
+     2078, -4167,  1632,  4510, -4916, -4489,   953, -2532,
+    -3202, -1409, -2704, -4099,  2844,  2257, -4591,  -865,
+    -5297,  2455,  5444, -5618, -5435,  2164,  2426,  5650,
+    -4115, -4670,  3510,  4730, -6055,  -212,  4896,  1241,
+    -2459, -1178,  2859,  4693,  2683, -4227,  4177,    -8,
+    -3757, -5518, -1484, -2595, -3602, -4924,  4043, -4565,
+    -4016, -5797, -5011,  4661,   -56, -1721, -1759,  1901,
+    -5876,  -636,  2399,  3723,  4912, -3534, -3712,  1790,
+    -4240,  -392,   242,   -24,  1018, -4265, -4452,  4504,
+     1483, -2483,  -160, -1406,   241, -5102, -2744,  1694,
+     -168, -5163, -5277,  5703, -5339, -1908, -5092, -1120,
+     2447,  1687,  1153,  5370,  -431, -1176,   726,   -72,
+     3054,  -506, -1067,  1223,  4449,  4840,  -480, -4218,
+      723, -3017,  4057,  5082,  -504, -3200, -3542,  4820,
+    -3728, -5724, -2987, -3360, -4948,  5061,  3459,  3821,
+    -1293, -3528,  2178,  -216, -3127, -1518, -3201,  3669,
+     1058,  2231, -1440,  -365,  2169,  3238,  -118,  2957,
+    -1512,  2689,  1663,  2171,  1105, -4883,  3328,  2209,
+    -2555,  2894, -1912,  -826, -3879,  1705, -5755,  -648,
+     2908, -4554,  2686, -1282,  3174, -5596, -4320, -1095,
+    -5782, -2575,  -354, -3418, -4536, -4222,  4989, -5776,
+     3315, -2360, -2305, -5662,  4624, -3607, -5736, -2478,
+      652,  5115, -4976, -1944, -3565, -1373, -4231, -3846,
+    -2767, -4499,  -671, -3285, -5057,  4564, -1062,  2035,
+    -1319,  -377,  2678, -5039, -2344,  5209,  5374, -4697,
+     1583,  1468, -4919,  4855,  1956,  3056, -2639, -5832,
+     1594, -4119,  -404,   751,  3988, -1208, -2013,  2434,
+    -2882,  1403, -3186,  6105, -3957, -1131, -4255, -2828,
+     5257,  3338,  3833, -1802,  4749,  4404, -2468,  2276,
+     5868, -3121,  4372, -5207,  4782,   -68, -1212,  2253,
+     -325, -3624, -6039, -4987,  3643,  4209,  2731,  6026,
+      418, -3393,  -476,  3805,  3482, -2275,  -790, -5406,
+     1958,   923,  4885, -5461,  5315,  2926,   827, -3332,
+     2057,  -204, -3636, -5530,  -975,  1417, -5828, -2672,
+    -1360,   338, -4096,  5789,  1254,  2110, -1428,  -874,
+    -1843,  5464, -2370, -3929,  5874,  2769,  2366, -4094,
+     3656, -3511,  2481,  2293, -6118,  -612,  1381, -4301,
+    -2925,  4251, -5195,  4273, -4080,  1014,     1,  5078,
+     3762, -5959, -4284, -2622, -5529,  4103,  5179,   502,
+     5333, -3982, -5191,     7, -1321,  1756, -4846, -5410,
+    -6065, -1836,  4143,  -614,  3514,   464, -3296,   530,
+       49,  3042,     3,  2945, -1003, -5588,  -563,  4423,
+    -4298,    20,  3248,  1506,  3710,   343, -3284,    21,
+    -3963,  5268, -2249, -3941, -5906, -5508,   140, -1842,
+    -1747,  1392,  2401,  1590,   147, -3163,     9, -3454,
+    -3009, -4475, -1689,   980,  -605,    60, -2545,  4518,
+    -1159,  1029,  2437,    63,   400,  3515,  5542,   466,
+    -5429, -4235,   420, -5526, -5241,  4176, -5086,  4770,
+      441,  2800,    27,  1927,  3262, -1136, -5067,  2940,
+    -1815,   180,  4654,  1265, -3477,  3087, -4978,   189,
+     1200, -1744,  4337,  1398, -3998,  -416,  1260, -4289,
+    -3434,   239, -2969,  2021,  1323, -3889,    81,  5781,
+    -2503, -3408, -2912, -3469, -5445,   540,  1673,  3795,
+     1858, -3028, -2645,   567,  3600, -5232,   722,  4194,
+      295, -1248,  3780,  -578,  1987,   717,  3382,  6063,
+     3969,   622,   243,  5054,  4780,  2065,  3553,  1882,
+    -4046,  1620,  5019,  -904,  5574,  3205,  4354,  1701,
+    -1489, -3407,  2166,   293,   885, -3744,  -949, -1734,
+     5961,  2151, -2143,  5900,  -382,  1866,   729,  2873,
+     2051, -6094, -1630,  5646,   151,  4860,  2768, -2712,
+     4433, -2674,   773,  5103, -4467,  2068, -5791,   879,
+     2655,  1057, -2847, -5202,  5594, -5836,  5860,  5411,
+    -1146,  5598,  2187, -3670, -6136, -5993, -4890,  4649,
+      453,  2291, -3985,  4153,  1010,  4267,  2319,  3020,
+    -1112, -6085, -5084,  2637, -4324,  3171,  3748, -3317,
+     4493, -5219,  5291,  3944, -3438,  4505, -5728,  1279,
+    -6119, -5690, -2381,  1658,  1359, -5416,   334,   170,
+     3030,   512, -5332, -3229, -3336, -5966, -2963, -4378,
+     -683, -2776, -1045,  2338,  1190, -3368,  3584,  -457,
+     1975,  1226, -4895,  3837, -6068, -4781,  5146,  4974,
+     4077, -3959,  1002,   510, -3199,  1536, -3707,  2602,
+     2281, -5609,  3400,  -845, -2049,  3961, -3135, -5275,
+     3570,  2185, -1537, -1371,  5925,  3678, -2396,  -778,
+    -5915, -2054,  3149,  2633,   -58,   412,  3006,  1530,
+     2692,  4608,  1168, -4483, -5446, -4538, -2089, -2535,
+     6142,  -406,  2884, -3536, -1579, -5734, -4611, -4113,
+     5486, -1255,  5101, -2334, -5456,  6127, -2842, -4390,
+     -174,  1236, -3271,  4590, -4213,  1535,  3504, -1160,
+    -4049, -1325,  6022,  4684,  6137, -1218, -3637,  1681,
+    -4737, -4913, -1544,   -50,  4169, -3765,  3014,  5287,
+    -4079,  6092,  3763,  -881,  -522,  3708,  2476,  1481,
+     -350,  4605, -1777, -3480,   142, -3975,  5777,  1763,
+     6122, -3654,  1378,  5043, -1922, -2450, -4632,  -150,
+      218,   994, -3247,  3572,    52,  5987, -1000, -2643,
+    -1566, -1165, -4861,  4443, -1050,  1526, -5331,  1849,
+      426,   364,  5042,  5289,  6077,  1327,  4134,  2840,
+    -5766,  4939, -1607,  -450,   654,  2982,  2548, -1573,
+      156,  5672, -3000,  4360, -4698, -3495, -2294,  1040,
+    -3150,  4578, -3704,  5547,  1278,  1092,  2837,  3578,
+     5942,  3981,   113, -3769, -5009,  2528, -4821, -1350,
+     1962, -3343, -4645, -4719,   468,  4727,  3289,   791,
+    -1805,  1804,  5407,  3120,  2839,  1445,  1177,  4352,
+     3834,  3276, -3778, -1555,  5537,  -346,   339,   982,
+    -2738, -4705, -2174, -4050,  5886,  2260, -1646, -1868,
+     1404,  1892, -2422,  2373, -5415,  5412,  3932, -2929,
+    -3772,  4335,  3531,   767,  -787, -2461,   955, -4665,
+     4322, -1038,  1017,  2946,  4075, -1826,  5767,   139,
+     5369, -5509, -4938, -5604,  4212,  5676,  5023, -5170,
+    -3956,  3947,  -493,  3502,   973,   716, -1696,  2301,
+    -2361,  4906,  2865, -1706,   677, -3114,  3051, -3451,
+    // Barrett companions
+       171,  14607, -13364,  -1112, -10181,  11300,   6733,  12060,
+      -925, -12636,  -7413,   8589,  -1123,   1195,   3944,   4754,
+     -7783,  -5728,  13567,  14361, -13882,  -6477,   9850,  13647,
+     -5416,  -7858,   8362,  -5162,    512,  11052,  -7325,  -3336,
+      2226,   1133, -12570,   3413,  -2776,  -5141,  10530,  -7002,
+     -3368,   3584,  11831,  14263,   9418,  15585,   7933,  10316,
+     -8877,  13338,  -3218,   8173, -16247,   9194,  -7682, -15487,
+      1536,    389,  10794, -10007,   6679,   3400,  -4941,  10239,
+     -8327, -15423,  -1179,  11762, -10103,  10751,   2725,  10021,
+     -4514,  13988,  -8970,  -1819,   6138,   7245,  -9655,  -8250,
+    -15972,  -5186,   9722, -13692,   4608,   1168,   -387,   2746,
+    -12730,  10199, -14823,  -2050,   7786, -13500,  -3536,   2517,
+      2458,   -515,   8175,  -2706, -13543,   9197,   5858,  -5456,
+    -14353, -11034,   3802,   8018, -15148, -15559,  -3602,  -8309,
+     13823,   3504,  -1160,   8239,  -5421,  -2170, -11700,  -6151,
+     -9410,  -7733, -10607,   7551,   7375,  -1544,  -8242,  -8119,
+     -7861,  -5178, -15193, -16367, -10292,   -333,  11407,  -8714,
+    -12676, -13908, -10807,   7842,   8701,  10511,  -3480,  -8050,
+    -16263,  -6511,  -2333,  14314,   4538,   9570,    947, -10114,
+    -10642,  -4632,   8042,   8410,   9186, -15535, -12812, -16332,
+      1891,  -1000,   1453,   6626,  -5261,  -8957,    347,  -9242,
+     -6666,  -1235, -10439,   8618, -16020,  13234,  -6999,  10173,
+     13615,  -4058,   2840,   2426,    843, -13895,  -8642,  -7538,
+     -5210, -13836,  -5669, -16228,   5672,  -3000,   4360, -12890,
+    -15783,   5898,   1040,   5042,  12770,  -3704,   1451,  -6914,
+    -15292,   6933,  11770,  -2250,   8077, -12175,   8519,   7279,
+      2528,  -8917,   6842,  10154, -15631,  -8741,  15761, -15916,
+    -15753,  -8999,  13079,  -5901, -14580, -15073,   3120,  15127,
+      5541, -11111,   4352,  12026, -13108, -11970,   2541,  -6751,
+     -8538,  -3757,  -7210, -10930,   7583,   6018, -12242,  -2306,
+    -14124,   6546,  14516, -14980, -14492,   5770,   6469,  15065,
+    -10972, -12452,   9359,  12612, -16145,   -565,  13055,   3309,
+     -6557,  -3141,   7623,  12514,   7154, -11271,  11138,    -21,
+    -10018, -14713,  -3957,  -6919,  -9605, -13130,  10780, -12172,
+    -10708, -15457, -13362,  12428,   -149,  -4589,  -4690,   5069,
+    -15668,  -1696,   6397,   9927,  13098,  -9423,  -9898,   4773,
+    -11306,  -1045,    645,    -64,   2714, -11372, -11871,  12010,
+      3954,  -6621,   -427,  -3749,    643, -13604,  -7317,   4517,
+      -448, -13767, -14071,  15207, -14236,  -5088, -13578,  -2986,
+      6525,   4498,   3074,  14319,  -1149,  -3136,   1936,   -192,
+      8143,  -1349,  -2845,   3261,  11863,  12906,  -1280, -11247,
+      1928,  -8045,  10818,  13551,  -1344,  -8533,  -9445,  12852,
+     -9941, -15263,  -7965,  -8959, -13194,  13495,   9223,  10189,
+     -3448,  -9407,   5808,   -576,  -8338,  -4048,  -8535,   9783,
+      2821,   5949,  -3840,   -973,   5784,   8634,   -315,   7885,
+     -4032,   7170,   4434,   5789,   2946, -13020,   8874,   5890,
+     -6813,   7717,  -5098,  -2202, -10343,   4546, -15345,  -1728,
+      7754, -12143,   7162,  -3418,   8463, -14921, -11519,  -2920,
+    -15417,  -6866,   -944,  -9114, -12095, -11258,  13303, -15401,
+      8839,  -6293,  -6146, -15097,  12330,  -9618, -15295,  -6607,
+      1739,  13639, -13268,  -5184,  -9506,  -3661, -11282, -10255,
+     -7378, -11996,  -1789,  -8759, -13484,  12170,  -2832,   5426,
+     -3517,  -1005,   7141, -13436,  -6250,  13890,  14330, -12524,
+      4221,   3914, -13116,  12946,   5216,   8149,  -7037, -15551,
+      4250, -10983,  -1077,   2003,  10634,  -3221,  -5368,   6490,
+     -7685,   3741,  -8495,  16279, -10551,  -3016, -11346,  -7541,
+     14018,   8901,  10221,  -4805,  12663,  11743,  -6581,   6069,
+     15647,  -8322,  11658, -13884,  12751,   -181,  -3232,   6008,
+      -867,  -9663, -16103, -13298,   9714,  11223,   7282,  16068,
+      1115,  -9047,  -1269,  10146,   9285,  -6066,  -2106, -14415,
+      5221,   2461,  13026, -14561,  14172,   7802,   2205,  -8885,
+      5485,   -544,  -9695, -14745,  -2600,   3778, -15540,  -7125,
+     -3626,    901, -10922,  15436,   3344,   5626,  -3808,  -2330,
+     -4914,  14569,  -6319, -10476,  15663,   7383,   6309, -10916,
+      9749,  -9362,   6615,   6114, -16313,  -1632,   3682, -11468,
+     -7799,  11335, -13852,  11394, -10879,   2704,      3,  13540,
+     10031, -15889, -11423,  -6991, -14743,  10940,  13810,   1339,
+     14220, -10618, -13842,     19,  -3522,   4682, -12922, -14425,
+    -16172,  -4896,  11047,  -1637,   9370,   1237,  -8789,   1413,
+       131,   8111,      8,   7853,  -2674, -14900,  -1501,  11794,
+    -11460,     53,   8661,   4016,   9893,    915,  -8757,     56,
+    -10567,  14047,  -5997, -10508, -15748, -14687,    373,  -4912,
+     -4658,   3712,   6402,   4240,    392,  -8434,     24,  -9210,
+     -8023, -11932,  -4504,   2613,  -1613,    160,  -6786,  12047,
+     -3090,   2744,   6498,    168,   1067,   9373,  14777,   1243,
+    -14476, -11292,   1120, -14735, -13975,  11135, -13562,  12719,
+      1176,   7466,     72,   5138,   8698,  -3029, -13511,   7839,
+     -4840,    480,  12410,   3373,  -9271,   8231, -13274,    504,
+      3200,  -4650,  11564,   3728, -10660,  -1109,   3360, -11436,
+     -9157,    637,  -7917,   5389,   3528, -10370,    216,  15415,
+     -6674,  -9087,  -7765,  -9250, -14519,   1440,   4461,  10119,
+      4954,  -8074,  -7053,   1512,   9599, -13951,   1925,  11183,
+       787,  -3328,  10079,  -1541,   5298,   1912,   9018,  16167,
+     10583,   1659,    648,  13476,  12746,   5506,   9474,   5018,
+    -10788,   4320,  13383,  -2410,  14863,   8546,  11610,   4536,
+     -3970,  -9085,   5776,    781,   2360,  -9983,  -2530,  -4624,
+     15895,   5736,  -5714,  15732,  -1019,   4976,   1944,   7661,
+      5469, -16249,  -4346,  15055,    403,  12959,   7381,  -7231,
+     11820,  -7130,   2061,  13607, -11911,   5514, -15441,   2344,
+      7079,   2818,  -7591, -13871,  14916, -15561,  15625,  14428,
+     -3056,  14927,   5832,  -9786, -16361, -15980, -13039,  12396,
+      1208,   6109, -10626,  11074,   2693,  11378,   6183,   8053,
+     -2965, -16225, -13556,   7031, -11530,   8455,   9994,  -8845,
+     11980, -13916,  14108,  10516,  -9167,  12012, -15273,   3410,
+    -16316, -15172,  -6349,   4421,   3624, -14441,    891,    453,
+      8079,   1365, -14218,  -8610,  -8895, -15908,  -7901, -11674,
+     -1821,  -7402,  -2786,   6234,   3173,  -8981,   9557,  -1219,
+      5266,   3269, -13052,  10231, -16180, -12748,  13722,  13263,
+     10871, -10556,   2672,   1360,  -8530,   4096,  -9885,   6938,
+      6082, -14956,   9066,  -2253,  -5464,  10562,  -8359, -14066,
+      9519,   5826,  -4098,  -3656,  15799,   9807,  -6389,  -2074,
+    -15772,  -5477,   8397,   7021,   -155,   1099,   8015,   4080,
+      7178,  12287,   3114, -11954, -14521, -12100,  -5570,  -6759,
+     16377,  -1083,   7690,  -9429,  -4210, -15289, -12295, -10967,
+     14628,  -3346,  13602,  -6223, -14548,  16337,  -7578, -11706,
+      -464,   3296,  -8722,  12239, -11234,   4093,   9343,  -3093,
+    -10796,  -3533,  16057,  12490,  16364,  -3248,  -9698,   4482,
+    -12631, -13100,  -4117,   -133,  11116, -10039,   8037,  14098,
+    -10876,  16244,  10034,  -2349,  -1392,   9887,   6602,   3949,
+      -933,  12279,  -4738,  -9279,    379, -10599,  15404,   4701,
+     16324,  -9743,   3674,  13447,  -5125,  -6533, -12351,   -400,
+       581,   2650,  -8658,   9525,    139,  15964,  -2666,  -7047,
+     -4176,  -3106, -12962,  11847,  -2800,   4069, -14215,   4930,
+      1136,    971,  13444,  14103,  16204,   3538,  11023,   7573,
+    -15375,  13170,  -4285,  -1200,   1744,   7951,   6794,  -4194,
+       416,  15124,  -7999,  11626, -12527,  -9319,  -6117,   2773,
+     -8399,  12207,  -9877,  14791,   3408,   2912,   7565,   9541,
+     15844,  10615,    301, -10050, -13356,   6741, -12855,  -3600,
+      5232,  -8914, -12386, -12583,   1248,  12604,   8770,   2109,
+     -4813,   4810,  14417,   8319,   7570,   3853,   3138,  11604,
+     10223,   8735, -10074,  -4146,  14764,   -923,    904,   2618,
+     -7301, -12546,  -5797, -10799,  15695,   6026,  -4389,  -4981,
+      3744,   5045,  -6458,   6327, -14439,  14431,  10484,  -7810,
+    -10058,  11559,   9415,   2045,  -2098,  -6562,   2546, -12439,
+     11524,  -2768,   2712,   7855,  10866,  -4869,  15377,    371,
+     14316, -14689, -13167, -14943,  11231,  15135,  13394, -13786,
+    -10548,  10524,  -1315,   9338,   2594,   1909,  -4522,   6136,
+     -6295,  13082,   7639,  -4549,   1805,  -8303,   8135,  -9202,
+};
+
+const int16_t ntt_short1024_omega_powers[2048] = {
+        0,     1,     1,  1479,     1,  4043,  1479, -5146,
+        1, -5736,  4043, -1305,  1479, -4134, -5146,  -722,
+        1, -1212, -5736, -3542,  4043,  3195, -1305, -3621,
+     1479,  1646, -4134, -3504, -5146, -5860,  -722,  2545,
+        1, -5828, -1212, -2639, -5736,  3328, -3542, -2744,
+     4043, -4591,  3195, -2625, -1305, -1351, -3621,  2975,
+     1479, -5023,  1646,  4821, -4134, -5777, -3504, -3006,
+    -5146,  5728, -5860,   949,  -722,  4978,  2545,   563,
+        1,  2366, -5828,  -790, -1212, -4255, -2639, -1062,
+    -5736, -4320,  3328, -3201, -3542,   726, -2744, -3712,
+     4043,  4896, -4591,  1170,  3195,  1635, -2625, -4805,
+    -1305, -3091, -1351, -1326, -3621, -1853,  2975, -2747,
+     1479, -3051, -5023,  -955,  1646, -1177,  4821,  2294,
+    -4134,  1000, -5777, -3014, -3504,  4611, -3006,  3135,
+    -5146,  2963,  5728, -2319, -5860, -2768,   949, -3553,
+     -722,   -81,  4978,  5086,  2545,  -140,   563,  4846,
+        1,  1381,  2366, -1428, -5828,   827,  -790,  2731,
+    -1212, -2468, -4255, -2013, -2639,  5374, -1062, -4231,
+    -5736,  4989, -4320, -5755,  3328,  -118, -3201,  3459,
+    -3542,  -480,   726, -5092, -2744, -4452, -3712, -1759,
+     4043,  4177,  4896,  2426, -4591,   953,  1170,  5911,
+     3195,   544,  1635, -3241, -2625,   130, -4805,   355,
+    -1305,  4278, -3091, -4388, -1351,  2197, -1326,  -145,
+    -3621,  1022, -1853, -2881,  2975,  3949, -2747,  3694,
+     1479,  2525, -3051,  1696, -5023, -5767,  -955, -3932,
+     1646,  -339, -1177, -3289,  4821, -2837,  2294, -2548,
+    -4134,  5331,  1000,  4632, -5777, -2476, -3014,  3637,
+    -3504,  2842,  4611,  2089, -3006,  2396,  3135,  3707,
+    -5146, -3584,  2963,  -334,  5728, -3748, -2319,  4890,
+    -5860,  5791, -2768,  -729,   949, -4354, -3553, -3382,
+     -722, -1673,   -81, -1260,  4978,  5067,  5086, -5542,
+     2545,    -9,  -140,  3284,   563,  3296,  4846, -5179,
+        1, -5195,  1381,  2481,  2366, -2370, -1428, -4096,
+    -5828, -3636,   827,  4885,  -790,  -476,  2731, -6039,
+    -1212,  4372, -2468,  3833, -4255, -3186, -2013,  -404,
+    -2639, -4919,  5374,  2678, -1062,  -671, -4231, -4976,
+    -5736, -2305,  4989,  -354, -4320,  2686, -5755, -1912,
+     3328,  1663,  -118, -1440, -3201,  2178,  3459, -2987,
+    -3542,  4057,  -480, -1067,   726,  1153, -5092, -5277,
+    -2744,  -160, -4452,   242, -3712,  2399, -1759, -5011,
+     4043, -1484,  4177,  2859,  4896,  3510,  2426,  5444,
+    -4591, -2704,   953,  1632,  1170,  4905,  5911,  2566,
+     3195,  4414,   544,   390,  1635, -2126, -3241,  1065,
+    -2625, -3915,   130,   545, -4805,  3016,   355,  -875,
+    -1305, -4053,  4278, -5698, -3091, -3978, -4388,  -435,
+    -1351,  1426,  2197,  3066, -1326, -5559,  -145,  3646,
+    -3621, -3364,  1022,  -442, -1853,  4048, -2881, -1207,
+     2975,  4437,  3949, -4714, -2747,  3136,  3694,  5088,
+     1479, -2780,  2525, -5012, -3051, -2865,  1696,   493,
+    -5023,  4938, -5767, -1017,  -955, -3531, -3932,  2422,
+     1646,  2174,  -339,  3778, -1177, -5407, -3289,  4645,
+     4821,  -113, -2837,  3704,  2294,  3000, -2548,  1607,
+    -4134, -5042,  5331,  4861,  1000,  3247,  4632, -1378,
+    -5777,  1777, -2476, -3763, -3014,  1544,  3637, -6022,
+    -3504,  3271,  2842, -5101,  4611, -2884,  2089, -1168,
+    -3006, -3149,  2396,  1537,  3135, -3400,  3707, -1002,
+    -5146,  4895, -3584,  1045,  2963,  5332,  -334,  2381,
+     5728, -5291, -3748,  5084, -2319,  3985,  4890, -2187,
+    -5860,  2847,  5791,  -773, -2768,  1630,  -729,  2143,
+      949, -2166, -4354, -5019, -3553,  -243, -3382, -3780,
+     -722,  2645, -1673,  2912,   -81,  2969, -1260, -4337,
+     4978, -4654,  5067,   -27,  5086,  -420, -5542, -2437,
+     2545,  1689,    -9, -2401,  -140,  2249,  3284, -3248,
+      563,    -3,  3296, -4143,  4846,  5191, -5179,  4284,
+        1, -4080, -5195, -2925,  1381, -6118,  2481,  3656,
+     2366,  5874, -2370, -1843, -1428,  1254, -4096, -1360,
+    -5828,  -975, -3636,  2057,   827,  5315,  4885,  1958,
+     -790,  3482,  -476,   418,  2731,  3643, -6039,  -325,
+    -1212,  4782,  4372,  5868, -2468,  4749,  3833,  5257,
+    -4255, -3957, -3186, -2882, -2013,  3988,  -404,  1594,
+    -2639,  1956, -4919,  1583,  5374, -2344,  2678, -1319,
+    -1062, -5057,  -671, -2767, -4231, -3565, -4976,   652,
+    -5736,  4624, -2305,  3315,  4989, -4536,  -354, -5782,
+    -4320,  3174,  2686,  2908, -5755, -3879, -1912, -2555,
+     3328,  1105,  1663, -1512,  -118,  2169, -1440,  1058,
+    -3201, -3127,  2178, -1293,  3459, -4948, -2987, -3728,
+    -3542,  -504,  4057,   723,  -480,  4449, -1067,  3054,
+      726,  -431,  1153,  2447, -5092, -5339, -5277,  -168,
+    -2744,   241,  -160,  1483, -4452,  1018,   242, -4240,
+    -3712,  4912,  2399, -5876, -1759,   -56, -5011, -4016,
+     4043, -3602, -1484, -3757,  4177,  2683,  2859, -2459,
+     4896, -6055,  3510, -4115,  2426, -5435,  5444, -5297,
+    -4591,  2844, -2704, -3202,   953, -4916,  1632,  2078,
+     1170, -5468,  4905, -5908,  5911, -5862,  2566,   948,
+     3195,  3029,  4414, -5735,   544,  4789,   390, -5919,
+     1635,  2127, -2126, -1954, -3241,   316,  1065,  5106,
+    -2625, -6008, -3915, -2500,   130, -1973,   545,   709,
+    -4805,  3445,  3016, -3991,   355,  1702,  -875, -6099,
+    -1305,  3263, -4053, -4754,  4278, -3860, -5698, -2948,
+    -3091,  2766, -3978, -3529, -4388, -2033,  -435,  5184,
+    -1351, -5681,  1426, -5383,  2197, -5079,  3066,   922,
+    -1326,  2920, -5559, -4774,  -145,  1728,  3646, -5990,
+    -3621,  2302, -3364, -1693,  1022, -3789,  -442, -3123,
+    -1853,  2505,  4048,   576, -2881, -6093, -1207, -3329,
+     2975,  3532,  4437, -1263,  3949, -1041, -4714,   835,
+    -2747,   192,  3136, -2031,  3694, -5206,  5088, -2919,
+     1479,  -421, -2780,  -347,  2525, -3818, -5012,    64,
+    -3051,  -677, -2865,  2361,  1696,  -973,   493,  3956,
+    -5023, -4212,  4938, -5369, -5767, -4075, -1017, -4322,
+     -955,   787, -3531,  3772, -3932,  5415,  2422, -1404,
+     1646, -5886,  2174,  2738,  -339, -5537,  3778, -3834,
+    -1177, -2839, -5407,  1805, -3289,  -468,  4645, -1962,
+     4821,  5009,  -113, -5942, -2837, -1278,  3704,  3150,
+     2294,  4698,  3000,  -156, -2548,  -654,  1607,  5766,
+    -4134, -6077, -5042,  -426,  5331,  1050,  4861,  1566,
+     1000,   -52,  3247,  -218,  4632,  1922, -1378, -6122,
+    -5777,  -142,  1777,   350, -2476,   522, -3763,  4079,
+    -3014, -4169,  1544,  4737,  3637, -6137, -6022,  4049,
+    -3504,  4213,  3271,   174,  2842,  5456, -5101, -5486,
+     4611,  1579, -2884, -6142,  2089,  5446, -1168, -2692,
+    -3006,    58, -3149,  5915,  2396, -5925,  1537, -3570,
+     3135,  2049, -3400, -2281,  3707,  3199, -1002, -4077,
+    -5146,  6068,  4895, -1975, -3584, -1190,  1045,   683,
+     2963,  3336,  5332, -3030,  -334, -1359,  2381,  6119,
+     5728,  3438, -5291, -4493, -3748,  4324,  5084,  1112,
+    -2319, -1010,  3985,  -453,  4890,  6136, -2187,  1146,
+    -5860, -5594,  2847, -2655,  5791,  4467,  -773, -4433,
+    -2768,  -151,  1630, -2051,  -729,   382,  2143, -5961,
+      949,  -885, -2166,  1489, -4354, -5574, -5019,  4046,
+    -3553, -4780,  -243, -3969, -3382, -1987, -3780,  -295,
+     -722, -3600,  2645, -1858, -1673,  5445,  2912,  2503,
+      -81, -1323,  2969,  3434, -1260,  3998, -4337, -1200,
+     4978,  3477, -4654,  1815,  5067, -3262,   -27,  -441,
+     5086,  5241,  -420,  5429, -5542,  -400, -2437,  1159,
+     2545,   605,  1689,  3009,    -9,  -147, -2401,  1747,
+     -140,  5906,  2249,  3963,  3284, -3710, -3248,  4298,
+      563,  1003,    -3,   -49,  3296, -3514, -4143,  6065,
+     4846,  1321,  5191, -5333, -5179,  5529,  4284, -3762,
+    // Barrett companions
+         0,      3,      3,   3944,      3,  10780,   3944, -13722,
+         3, -15295,  10780,  -3480,   3944, -11023, -13722,  -1925,
+         3,  -3232, -15295,  -9445,  10780,   8519,  -3480,  -9655,
+      3944,   4389, -11023,  -9343, -13722, -15625,  -1925,   6786,
+         3, -15540,  -3232,  -7037, -15295,   8874,  -9445,  -7317,
+     10780, -12242,   8519,  -6999,  -3480,  -3602,  -9655,   7933,
+      3944, -13394,   4389,  12855, -11023, -15404,  -9343,  -8015,
+    -13722,  15273, -15625,   2530,  -1925,  13274,   6786,   1501,
+         3,   6309, -15540,  -2106,  -3232, -11346,  -7037,  -2832,
+    -15295, -11519,   8874,  -8535,  -9445,   1936,  -7317,  -9898,
+     10780,  13055, -12242,   3120,   8519,   4360,  -6999, -12812,
+     -3480,  -8242,  -3602,  -3536,  -9655,  -4941,   7933,  -7325,
+      3944,  -8135, -13394,  -2546,   4389,  -3138,  12855,   6117,
+    -11023,   2666, -15404,  -8037,  -9343,  12295,  -8015,   8359,
+    -13722,   7901,  15273,  -6183, -15625,  -7381,   2530,  -9474,
+     -1925,   -216,  13274,  13562,   6786,   -373,   1501,  12922,
+         3,   3682,   6309,  -3808, -15540,   2205,  -2106,   7282,
+     -3232,  -6581, -11346,  -5368,  -7037,  14330,  -2832, -11282,
+    -15295,  13303, -11519, -15345,   8874,   -315,  -8535,   9223,
+     -9445,  -1280,   1936, -13578,  -7317, -11871,  -9898,  -4690,
+     10780,  11138,  13055,   6469, -12242,   2541,   3120,  15761,
+      8519,   1451,   4360,  -8642,  -6999,    347, -12812,    947,
+     -3480,  11407,  -8242, -11700,  -3602,   5858,  -3536,   -387,
+     -9655,   2725,  -4941,  -7682,   7933,  10530,  -7325,   9850,
+      3944,   6733,  -8135,   4522, -13394, -15377,  -2546, -10484,
+      4389,   -904,  -3138,  -8770,  12855,  -7565,   6117,  -6794,
+    -11023,  14215,   2666,  12351, -15404,  -6602,  -8037,   9698,
+     -9343,   7578,  12295,   5570,  -8015,   6389,   8359,   9885,
+    -13722,  -9557,   7901,   -891,  15273,  -9994,  -6183,  13039,
+    -15625,  15441,  -7381,  -1944,   2530, -11610,  -9474,  -9018,
+     -1925,  -4461,   -216,  -3360,  13274,  13511,  13562, -14777,
+      6786,    -24,   -373,   8757,   1501,   8789,  12922, -13810,
+         3, -13852,   3682,   6615,   6309,  -6319,  -3808, -10922,
+    -15540,  -9695,   2205,  13026,  -2106,  -1269,   7282, -16103,
+     -3232,  11658,  -6581,  10221, -11346,  -8495,  -5368,  -1077,
+     -7037, -13116,  14330,   7141,  -2832,  -1789, -11282, -13268,
+    -15295,  -6146,  13303,   -944, -11519,   7162, -15345,  -5098,
+      8874,   4434,   -315,  -3840,  -8535,   5808,   9223,  -7965,
+     -9445,  10818,  -1280,  -2845,   1936,   3074, -13578, -14071,
+     -7317,   -427, -11871,    645,  -9898,   6397,  -4690, -13362,
+     10780,  -3957,  11138,   7623,  13055,   9359,   6469,  14516,
+    -12242,  -7210,   2541,   4352,   3120,  13079,  15761,   6842,
+      8519,  11770,   1451,   1040,   4360,  -5669,  -8642,   2840,
+     -6999, -10439,    347,   1453, -12812,   8042,    947,  -2333,
+     -3480, -10807,  11407, -15193,  -8242, -10607, -11700,  -1160,
+     -3602,   3802,   5858,   8175,  -3536, -14823,   -387,   9722,
+     -9655,  -8970,   2725,  -1179,  -4941,  10794,  -7682,  -3218,
+      7933,  11831,  10530, -12570,  -7325,   8362,   9850,  13567,
+      3944,  -7413,   6733, -13364,  -8135,  -7639,   4522,   1315,
+    -13394,  13167, -15377,  -2712,  -2546,  -9415, -10484,   6458,
+      4389,   5797,   -904,  10074,  -3138, -14417,  -8770,  12386,
+     12855,   -301,  -7565,   9877,   6117,   7999,  -6794,   4285,
+    -11023, -13444,  14215,  12962,   2666,   8658,  12351,  -3674,
+    -15404,   4738,  -6602, -10034,  -8037,   4117,   9698, -16057,
+     -9343,   8722,   7578, -13602,  12295,  -7690,   5570,  -3114,
+     -8015,  -8397,   6389,   4098,   8359,  -9066,   9885,  -2672,
+    -13722,  13052,  -9557,   2786,   7901,  14218,   -891,   6349,
+     15273, -14108,  -9994,  13556,  -6183,  10626,  13039,  -5832,
+    -15625,   7591,  15441,  -2061,  -7381,   4346,  -1944,   5714,
+      2530,  -5776, -11610, -13383,  -9474,   -648,  -9018, -10079,
+     -1925,   7053,  -4461,   7765,   -216,   7917,  -3360, -11564,
+     13274, -12410,  13511,    -72,  13562,  -1120, -14777,  -6498,
+      6786,   4504,    -24,  -6402,   -373,   5997,   8757,  -8661,
+      1501,     -8,   8789, -11047,  12922,  13842, -13810,  11423,
+         3, -10879, -13852,  -7799,   3682, -16313,   6615,   9749,
+      6309,  15663,  -6319,  -4914,  -3808,   3344, -10922,  -3626,
+    -15540,  -2600,  -9695,   5485,   2205,  14172,  13026,   5221,
+     -2106,   9285,  -1269,   1115,   7282,   9714, -16103,   -867,
+     -3232,  12751,  11658,  15647,  -6581,  12663,  10221,  14018,
+    -11346, -10551,  -8495,  -7685,  -5368,  10634,  -1077,   4250,
+     -7037,   5216, -13116,   4221,  14330,  -6250,   7141,  -3517,
+     -2832, -13484,  -1789,  -7378, -11282,  -9506, -13268,   1739,
+    -15295,  12330,  -6146,   8839,  13303, -12095,   -944, -15417,
+    -11519,   8463,   7162,   7754, -15345, -10343,  -5098,  -6813,
+      8874,   2946,   4434,  -4032,   -315,   5784,  -3840,   2821,
+     -8535,  -8338,   5808,  -3448,   9223, -13194,  -7965,  -9941,
+     -9445,  -1344,  10818,   1928,  -1280,  11863,  -2845,   8143,
+      1936,  -1149,   3074,   6525, -13578, -14236, -14071,   -448,
+     -7317,    643,   -427,   3954, -11871,   2714,    645, -11306,
+     -9898,  13098,   6397, -15668,  -4690,   -149, -13362, -10708,
+     10780,  -9605,  -3957, -10018,  11138,   7154,   7623,  -6557,
+     13055, -16145,   9359, -10972,   6469, -14492,  14516, -14124,
+    -12242,   7583,  -7210,  -8538,   2541, -13108,   4352,   5541,
+      3120, -14580,  13079, -15753,  15761, -15631,   6842,   2528,
+      8519,   8077,  11770, -15292,   1451,  12770,   1040, -15783,
+      4360,   5672,  -5669,  -5210,  -8642,    843,   2840,  13615,
+     -6999, -16020, -10439,  -6666,    347,  -5261,   1453,   1891,
+    -12812,   9186,   8042, -10642,    947,   4538,  -2333, -16263,
+     -3480,   8701, -10807, -12676,  11407, -10292, -15193,  -7861,
+     -8242,   7375, -10607,  -9410, -11700,  -5421,  -1160,  13823,
+     -3602, -15148,   3802, -14353,   5858, -13543,   8175,   2458,
+     -3536,   7786, -14823, -12730,   -387,   4608,   9722, -15972,
+     -9655,   6138,  -8970,  -4514,   2725, -10103,  -1179,  -8327,
+     -4941,   6679,  10794,   1536,  -7682, -16247,  -3218,  -8877,
+      7933,   9418,  11831,  -3368,  10530,  -2776, -12570,   2226,
+     -7325,    512,   8362,  -5416,   9850, -13882,  13567,  -7783,
+      3944,  -1123,  -7413,   -925,   6733, -10181, -13364,    171,
+     -8135,  -1805,  -7639,   6295,   4522,  -2594,   1315,  10548,
+    -13394, -11231,  13167, -14316, -15377, -10866,  -2712, -11524,
+     -2546,   2098,  -9415,  10058, -10484,  14439,   6458,  -3744,
+      4389, -15695,   5797,   7301,   -904, -14764,  10074, -10223,
+     -3138,  -7570, -14417,   4813,  -8770,  -1248,  12386,  -5232,
+     12855,  13356,   -301, -15844,  -7565,  -3408,   9877,   8399,
+      6117,  12527,   7999,   -416,  -6794,  -1744,   4285,  15375,
+    -11023, -16204, -13444,  -1136,  14215,   2800,  12962,   4176,
+      2666,   -139,   8658,   -581,  12351,   5125,  -3674, -16324,
+    -15404,   -379,   4738,    933,  -6602,   1392, -10034,  10876,
+     -8037, -11116,   4117,  12631,   9698, -16364, -16057,  10796,
+     -9343,  11234,   8722,    464,   7578,  14548, -13602, -14628,
+     12295,   4210,  -7690, -16377,   5570,  14521,  -3114,  -7178,
+     -8015,    155,  -8397,  15772,   6389, -15799,   4098,  -9519,
+      8359,   5464,  -9066,  -6082,   9885,   8530,  -2672, -10871,
+    -13722,  16180,  13052,  -5266,  -9557,  -3173,   2786,   1821,
+      7901,   8895,  14218,  -8079,   -891,  -3624,   6349,  16316,
+     15273,   9167, -14108, -11980,  -9994,  11530,  13556,   2965,
+     -6183,  -2693,  10626,  -1208,  13039,  16361,  -5832,   3056,
+    -15625, -14916,   7591,  -7079,  15441,  11911,  -2061, -11820,
+     -7381,   -403,   4346,  -5469,  -1944,   1019,   5714, -15895,
+      2530,  -2360,  -5776,   3970, -11610, -14863, -13383,  10788,
+     -9474, -12746,   -648, -10583,  -9018,  -5298, -10079,   -787,
+     -1925,  -9599,   7053,  -4954,  -4461,  14519,   7765,   6674,
+      -216,  -3528,   7917,   9157,  -3360,  10660, -11564,  -3200,
+     13274,   9271, -12410,   4840,  13511,  -8698,    -72,  -1176,
+     13562,  13975,  -1120,  14476, -14777,  -1067,  -6498,   3090,
+      6786,   1613,   4504,   8023,    -24,   -392,  -6402,   4658,
+      -373,  15748,   5997,  10567,   8757,  -9893,  -8661,  11460,
+      1501,   2674,     -8,   -131,   8789,  -9370, -11047,  16172,
+     12922,   3522,  13842, -14220, -13810,  14743,  11423, -10031,
+};
+
+const int16_t ntt_short1024_omega_powers_rev[2048] = {
+        0,     1,     1,  1479,     1,  1479,  4043, -5146,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+     2366, -3051,  4896,  2963, -4320,  1000, -3091,   -81,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+     2366, -3051,  4896,  2963, -4320,  1000, -3091,   -81,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+     1381,  2525,  4177, -3584,  4989,  5331,  4278, -1673,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -1428,  1696,  2426,  -334, -5755,  4632, -4388, -1260,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+     2366, -3051,  4896,  2963, -4320,  1000, -3091,   -81,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+     1381,  2525,  4177, -3584,  4989,  5331,  4278, -1673,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -1428,  1696,  2426,  -334, -5755,  4632, -4388, -1260,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -5195, -2780, -1484,  4895, -2305, -5042, -4053,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+    -2370, -2865,  3510,  5332,  2686,  3247, -3978,  2969,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+     2481, -5012,  2859,  1045,  -354,  4861, -5698,  2912,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+        1,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+     2366, -3051,  4896,  2963, -4320,  1000, -3091,   -81,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+     1381,  2525,  4177, -3584,  4989,  5331,  4278, -1673,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -1428,  1696,  2426,  -334, -5755,  4632, -4388, -1260,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -5195, -2780, -1484,  4895, -2305, -5042, -4053,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+    -2370, -2865,  3510,  5332,  2686,  3247, -3978,  2969,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+     2481, -5012,  2859,  1045,  -354,  4861, -5698,  2912,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4080,  -421, -3602,  6068,  4624, -6077,  3263, -3600,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     5874,  -677, -6055,  3336,  3174,   -52,  2766, -1323,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -6118, -3818,  2683, -1190, -4536,  1050, -3860,  5445,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     1254,  -973, -5435, -1359, -3879,  1922, -2033,  3998,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+    -2925,  -347, -3757, -1975,  3315,  -426, -4754, -1858,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+    -1843,  2361, -4115, -3030,  2908,  -218, -3529,  3434,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+     3656,    64, -2459,   683, -5782,  1566, -2948,  2503,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+    // Barrett companions
+         0,      3,      3,   3944,      3,   3944,  10780, -13722,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+      6309,  -8135,  13055,   7901, -11519,   2666,  -8242,   -216,
+    -11346,  -3138,   4360,  -7381,   1936,  12295,  -4941,   -373,
+     -2106,  -2546,   3120,  -6183,  -8535,  -8037,  -3536,  13562,
+     -2832,   6117, -12812,  -9474,  -9898,   8359,  -7325,  12922,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+      6309,  -8135,  13055,   7901, -11519,   2666,  -8242,   -216,
+    -11346,  -3138,   4360,  -7381,   1936,  12295,  -4941,   -373,
+     -2106,  -2546,   3120,  -6183,  -8535,  -8037,  -3536,  13562,
+     -2832,   6117, -12812,  -9474,  -9898,   8359,  -7325,  12922,
+      3682,   6733,  11138,  -9557,  13303,  14215,  11407,  -4461,
+     -6581,   -904,   1451,  15441,  -1280,   7578,   2725,    -24,
+      2205, -15377,   2541,  -9994,   -315,  -6602,   5858,  13511,
+     14330,  -7565,    347, -11610, -11871,   6389,  10530,   8789,
+     -3808,   4522,   6469,   -891, -15345,  12351, -11700,  -3360,
+     -5368,  -8770,  -8642,  -1944, -13578,   5570,  -7682,   8757,
+      7282, -10484,  15761,  13039,   9223,   9698,   -387, -14777,
+    -11282,  -6794,    947,  -9018,  -4690,   9885,   9850, -13810,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+      6309,  -8135,  13055,   7901, -11519,   2666,  -8242,   -216,
+    -11346,  -3138,   4360,  -7381,   1936,  12295,  -4941,   -373,
+     -2106,  -2546,   3120,  -6183,  -8535,  -8037,  -3536,  13562,
+     -2832,   6117, -12812,  -9474,  -9898,   8359,  -7325,  12922,
+      3682,   6733,  11138,  -9557,  13303,  14215,  11407,  -4461,
+     -6581,   -904,   1451,  15441,  -1280,   7578,   2725,    -24,
+      2205, -15377,   2541,  -9994,   -315,  -6602,   5858,  13511,
+     14330,  -7565,    347, -11610, -11871,   6389,  10530,   8789,
+     -3808,   4522,   6469,   -891, -15345,  12351, -11700,  -3360,
+     -5368,  -8770,  -8642,  -1944, -13578,   5570,  -7682,   8757,
+      7282, -10484,  15761,  13039,   9223,   9698,   -387, -14777,
+    -11282,  -6794,    947,  -9018,  -4690,   9885,   9850, -13810,
+    -13852,  -7413,  -3957,  13052,  -6146, -13444, -10807,   7053,
+     11658,   5797,  11770,   7591,  10818,   8722,  -8970,   4504,
+     -9695,  13167,  -7210, -14108,   4434,   4738,   3802, -12410,
+    -13116,   -301, -10439,  -5776,   -427,  -8397,  11831,     -8,
+     -6319,  -7639,   9359,  14218,   7162,   8658, -10607,   7917,
+     -8495, -14417,  -5669,   4346,   3074,  -7690,  10794,   5997,
+     -1269,  -9415,  13079,  10626,   5808,   4117, -14823,  -1120,
+     -1789,   7999,   8042,   -648,   6397,  -9066,   8362,  13842,
+      6615, -13364,   7623,   2786,   -944,  12962, -15193,   7765,
+     10221,  10074,   1040,  -2061,  -2845, -13602,  -1179,  -6402,
+     13026,  -2712,   4352,  13556,  -3840, -10034,   8175,    -72,
+      7141,   9877,   1453, -13383,    645,   4098, -12570, -11047,
+    -10922,   1315,  14516,   6349,  -5098,  -3674,  -1160, -11564,
+     -1077,  12386,   2840,   5714, -14071,  -3114,  -3218,  -8661,
+    -16103,   6458,   6842,  -5832,  -7965, -16057,   9722,  -6498,
+    -13268,   4285,  -2333, -10079, -13362,  -2672,  13567,  11423,
+         3,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+      6309,  -8135,  13055,   7901, -11519,   2666,  -8242,   -216,
+    -11346,  -3138,   4360,  -7381,   1936,  12295,  -4941,   -373,
+     -2106,  -2546,   3120,  -6183,  -8535,  -8037,  -3536,  13562,
+     -2832,   6117, -12812,  -9474,  -9898,   8359,  -7325,  12922,
+      3682,   6733,  11138,  -9557,  13303,  14215,  11407,  -4461,
+     -6581,   -904,   1451,  15441,  -1280,   7578,   2725,    -24,
+      2205, -15377,   2541,  -9994,   -315,  -6602,   5858,  13511,
+     14330,  -7565,    347, -11610, -11871,   6389,  10530,   8789,
+     -3808,   4522,   6469,   -891, -15345,  12351, -11700,  -3360,
+     -5368,  -8770,  -8642,  -1944, -13578,   5570,  -7682,   8757,
+      7282, -10484,  15761,  13039,   9223,   9698,   -387, -14777,
+    -11282,  -6794,    947,  -9018,  -4690,   9885,   9850, -13810,
+    -13852,  -7413,  -3957,  13052,  -6146, -13444, -10807,   7053,
+     11658,   5797,  11770,   7591,  10818,   8722,  -8970,   4504,
+     -9695,  13167,  -7210, -14108,   4434,   4738,   3802, -12410,
+    -13116,   -301, -10439,  -5776,   -427,  -8397,  11831,     -8,
+     -6319,  -7639,   9359,  14218,   7162,   8658, -10607,   7917,
+     -8495, -14417,  -5669,   4346,   3074,  -7690,  10794,   5997,
+     -1269,  -9415,  13079,  10626,   5808,   4117, -14823,  -1120,
+     -1789,   7999,   8042,   -648,   6397,  -9066,   8362,  13842,
+      6615, -13364,   7623,   2786,   -944,  12962, -15193,   7765,
+     10221,  10074,   1040,  -2061,  -2845, -13602,  -1179,  -6402,
+     13026,  -2712,   4352,  13556,  -3840, -10034,   8175,    -72,
+      7141,   9877,   1453, -13383,    645,   4098, -12570, -11047,
+    -10922,   1315,  14516,   6349,  -5098,  -3674,  -1160, -11564,
+     -1077,  12386,   2840,   5714, -14071,  -3114,  -3218,  -8661,
+    -16103,   6458,   6842,  -5832,  -7965, -16057,   9722,  -6498,
+    -13268,   4285,  -2333, -10079, -13362,  -2672,  13567,  11423,
+    -10879,  -1123,  -9605,  16180,  12330, -16204,   8701,  -9599,
+     12751, -15695,   8077, -14916,  -1344,  11234,   6138,   1613,
+     -2600, -11231,   7583,   9167,   2946,   -379, -15148,   9271,
+      5216,  13356, -16020,  -2360,    643,    155,   9418,   2674,
+     15663,  -1805, -16145,   8895,   8463,   -139,   7375,  -3528,
+    -10551,  -7570,   5672,   -403,  -1149,   4210,   6679,  15748,
+      9285,   2098, -14580,  -2693,  -8338, -11116,   7786,  13975,
+    -13484,  12527,   9186, -12746,  13098,   5464,    512,   3522,
+    -16313, -10181,   7154,  -3173, -12095,   2800, -10292,  14519,
+     12663, -14764,  12770,  11911,  11863,  14548, -10103,   -392,
+     14172, -10866, -13108,  11530,   5784,   1392, -13543,  -8698,
+     -6250,  -3408,  -5261, -14863,   2714, -15799,  -2776,  -9370,
+      3344,  -2594, -14492,  -3624, -10343,   5125,  -5421,  10660,
+     10634,  -1248,    843,   1019, -14236,  14521, -16247,  -9893,
+      9714,  14439, -15631,  16361, -13194, -16364,   4608,  -1067,
+     -9506,  -1744,   4538,  -5298,   -149,   8530, -13882,  14743,
+     -7799,   -925, -10018,  -5266,   8839,  -1136, -12676,  -4954,
+     15647,   7301, -15292,  -7079,   1928,    464,  -4514,   8023,
+      5485, -14316,  -8538, -11980,  -4032,    933, -14353,   4840,
+      4221, -15844,  -6666,   3970,   3954,  15772,  -3368,   -131,
+     -4914,   6295, -10972,  -8079,   7754,   -581,  -9410,   9157,
+     -7685,   4813,  -5210,  -5469,   6525, -16377,   1536,  10567,
+      1115,  10058, -15753,  -1208,  -3448,  12631, -12730,  14476,
+     -7378,   -416, -10642, -10583, -15668,  -6082,  -5416, -14220,
+      9749,    171,  -6557,   1821, -15417,   4176,  -7861,   6674,
+     14018, -10223, -15783, -11820,   8143, -14628,  -8327,   4658,
+      5221, -11524,   5541,   2965,   2821,  10876,   2458,  -1176,
+     -3517,   8399,   1891,  10788, -11306,  -9519,   2226,  16172,
+     -3626,  10548, -14124,  16316,  -6813, -16324,  13823,  -3200,
+      4250,  -5232,  13615, -15895,   -448,  -7178,  -8877,  11460,
+      -867,  -3744,   2528,   3056,  -9941,  10796, -15972,   3090,
+      1739,  15375, -16263,   -787, -10708, -10871,  -7783, -10031,
+};
+
+const int16_t ntt_short1024_inv_omega_powers[2048] = {
+        0,     1,     1, -1479,     1,  5146, -1479, -4043,
+        1,   722,  5146,  4134, -1479,  1305, -4043,  5736,
+        1, -2545,   722,  5860,  5146,  3504,  4134, -1646,
+    -1479,  3621,  1305, -3195, -4043,  3542,  5736,  1212,
+        1,  -563, -2545, -4978,   722,  -949,  5860, -5728,
+     5146,  3006,  3504,  5777,  4134, -4821, -1646,  5023,
+    -1479, -2975,  3621,  1351,  1305,  2625, -3195,  4591,
+    -4043,  2744,  3542, -3328,  5736,  2639,  1212,  5828,
+        1, -4846,  -563,   140, -2545, -5086, -4978,    81,
+      722,  3553,  -949,  2768,  5860,  2319, -5728, -2963,
+     5146, -3135,  3006, -4611,  3504,  3014,  5777, -1000,
+     4134, -2294, -4821,  1177, -1646,   955,  5023,  3051,
+    -1479,  2747, -2975,  1853,  3621,  1326,  1351,  3091,
+     1305,  4805,  2625, -1635, -3195, -1170,  4591, -4896,
+    -4043,  3712,  2744,  -726,  3542,  3201, -3328,  4320,
+     5736,  1062,  2639,  4255,  1212,   790,  5828, -2366,
+        1,  5179, -4846, -3296,  -563, -3284,   140,     9,
+    -2545,  5542, -5086, -5067, -4978,  1260,    81,  1673,
+      722,  3382,  3553,  4354,  -949,   729,  2768, -5791,
+     5860, -4890,  2319,  3748, -5728,   334, -2963,  3584,
+     5146, -3707, -3135, -2396,  3006, -2089, -4611, -2842,
+     3504, -3637,  3014,  2476,  5777, -4632, -1000, -5331,
+     4134,  2548, -2294,  2837, -4821,  3289,  1177,   339,
+    -1646,  3932,   955,  5767,  5023, -1696,  3051, -2525,
+    -1479, -3694,  2747, -3949, -2975,  2881,  1853, -1022,
+     3621,   145,  1326, -2197,  1351,  4388,  3091, -4278,
+     1305,  -355,  4805,  -130,  2625,  3241, -1635,  -544,
+    -3195, -5911, -1170,  -953,  4591, -2426, -4896, -4177,
+    -4043,  1759,  3712,  4452,  2744,  5092,  -726,   480,
+     3542, -3459,  3201,   118, -3328,  5755,  4320, -4989,
+     5736,  4231,  1062, -5374,  2639,  2013,  4255,  2468,
+     1212, -2731,   790,  -827,  5828,  1428, -2366, -1381,
+        1, -4284,  5179, -5191, -4846,  4143, -3296,     3,
+     -563,  3248, -3284, -2249,   140,  2401,     9, -1689,
+    -2545,  2437,  5542,   420, -5086,    27, -5067,  4654,
+    -4978,  4337,  1260, -2969,    81, -2912,  1673, -2645,
+      722,  3780,  3382,   243,  3553,  5019,  4354,  2166,
+     -949, -2143,   729, -1630,  2768,   773, -5791, -2847,
+     5860,  2187, -4890, -3985,  2319, -5084,  3748,  5291,
+    -5728, -2381,   334, -5332, -2963, -1045,  3584, -4895,
+     5146,  1002, -3707,  3400, -3135, -1537, -2396,  3149,
+     3006,  1168, -2089,  2884, -4611,  5101, -2842, -3271,
+     3504,  6022, -3637, -1544,  3014,  3763,  2476, -1777,
+     5777,  1378, -4632, -3247, -1000, -4861, -5331,  5042,
+     4134, -1607,  2548, -3000, -2294, -3704,  2837,   113,
+    -4821, -4645,  3289,  5407,  1177, -3778,   339, -2174,
+    -1646, -2422,  3932,  3531,   955,  1017,  5767, -4938,
+     5023,  -493, -1696,  2865,  3051,  5012, -2525,  2780,
+    -1479, -5088, -3694, -3136,  2747,  4714, -3949, -4437,
+    -2975,  1207,  2881, -4048,  1853,   442, -1022,  3364,
+     3621, -3646,   145,  5559,  1326, -3066, -2197, -1426,
+     1351,   435,  4388,  3978,  3091,  5698, -4278,  4053,
+     1305,   875,  -355, -3016,  4805,  -545,  -130,  3915,
+     2625, -1065,  3241,  2126, -1635,  -390,  -544, -4414,
+    -3195, -2566, -5911, -4905, -1170, -1632,  -953,  2704,
+     4591, -5444, -2426, -3510, -4896, -2859, -4177,  1484,
+    -4043,  5011,  1759, -2399,  3712,  -242,  4452,   160,
+     2744,  5277,  5092, -1153,  -726,  1067,   480, -4057,
+     3542,  2987, -3459, -2178,  3201,  1440,   118, -1663,
+    -3328,  1912,  5755, -2686,  4320,   354, -4989,  2305,
+     5736,  4976,  4231,   671,  1062, -2678, -5374,  4919,
+     2639,   404,  2013,  3186,  4255, -3833,  2468, -4372,
+     1212,  6039, -2731,   476,   790, -4885,  -827,  3636,
+     5828,  4096,  1428,  2370, -2366, -2481, -1381,  5195,
+        1,  3762, -4284, -5529,  5179,  5333, -5191, -1321,
+    -4846, -6065,  4143,  3514, -3296,    49,     3, -1003,
+     -563, -4298,  3248,  3710, -3284, -3963, -2249, -5906,
+      140, -1747,  2401,   147,     9, -3009, -1689,  -605,
+    -2545, -1159,  2437,   400,  5542, -5429,   420, -5241,
+    -5086,   441,    27,  3262, -5067, -1815,  4654, -3477,
+    -4978,  1200,  4337, -3998,  1260, -3434, -2969,  1323,
+       81, -2503, -2912, -5445,  1673,  1858, -2645,  3600,
+      722,   295,  3780,  1987,  3382,  3969,   243,  4780,
+     3553, -4046,  5019,  5574,  4354, -1489,  2166,   885,
+     -949,  5961, -2143,  -382,   729,  2051, -1630,   151,
+     2768,  4433,   773, -4467, -5791,  2655, -2847,  5594,
+     5860, -1146,  2187, -6136, -4890,   453, -3985,  1010,
+     2319, -1112, -5084, -4324,  3748,  4493,  5291, -3438,
+    -5728, -6119, -2381,  1359,   334,  3030, -5332, -3336,
+    -2963,  -683, -1045,  1190,  3584,  1975, -4895, -6068,
+     5146,  4077,  1002, -3199, -3707,  2281,  3400, -2049,
+    -3135,  3570, -1537,  5925, -2396, -5915,  3149,   -58,
+     3006,  2692,  1168, -5446, -2089,  6142,  2884, -1579,
+    -4611,  5486,  5101, -5456, -2842,  -174, -3271, -4213,
+     3504, -4049,  6022,  6137, -3637, -4737, -1544,  4169,
+     3014, -4079,  3763,  -522,  2476,  -350, -1777,   142,
+     5777,  6122,  1378, -1922, -4632,   218, -3247,    52,
+    -1000, -1566, -4861, -1050, -5331,   426,  5042,  6077,
+     4134, -5766, -1607,   654,  2548,   156, -3000, -4698,
+    -2294, -3150, -3704,  1278,  2837,  5942,   113, -5009,
+    -4821,  1962, -4645,   468,  3289, -1805,  5407,  2839,
+     1177,  3834, -3778,  5537,   339, -2738, -2174,  5886,
+    -1646,  1404, -2422, -5415,  3932, -3772,  3531,  -787,
+      955,  4322,  1017,  4075,  5767,  5369, -4938,  4212,
+     5023, -3956,  -493,   973, -1696, -2361,  2865,   677,
+     3051,   -64,  5012,  3818, -2525,   347,  2780,   421,
+    -1479,  2919, -5088,  5206, -3694,  2031, -3136,  -192,
+     2747,  -835,  4714,  1041, -3949,  1263, -4437, -3532,
+    -2975,  3329,  1207,  6093,  2881,  -576, -4048, -2505,
+     1853,  3123,   442,  3789, -1022,  1693,  3364, -2302,
+     3621,  5990, -3646, -1728,   145,  4774,  5559, -2920,
+     1326,  -922, -3066,  5079, -2197,  5383, -1426,  5681,
+     1351, -5184,   435,  2033,  4388,  3529,  3978, -2766,
+     3091,  2948,  5698,  3860, -4278,  4754,  4053, -3263,
+     1305,  6099,   875, -1702,  -355,  3991, -3016, -3445,
+     4805,  -709,  -545,  1973,  -130,  2500,  3915,  6008,
+     2625, -5106, -1065,  -316,  3241,  1954,  2126, -2127,
+    -1635,  5919,  -390, -4789,  -544,  5735, -4414, -3029,
+    -3195,  -948, -2566,  5862, -5911,  5908, -4905,  5468,
+    -1170, -2078, -1632,  4916,  -953,  3202,  2704, -2844,
+     4591,  5297, -5444,  5435, -2426,  4115, -3510,  6055,
+    -4896,  2459, -2859, -2683, -4177,  3757,  1484,  3602,
+    -4043,  4016,  5011,    56,  1759,  5876, -2399, -4912,
+     3712,  4240,  -242, -1018,  4452, -1483,   160,  -241,
+     2744,   168,  5277,  5339,  5092, -2447, -1153,   431,
+     -726, -3054,  1067, -4449,   480,  -723, -4057,   504,
+     3542,  3728,  2987,  4948, -3459,  1293, -2178,  3127,
+     3201, -1058,  1440, -2169,   118,  1512, -1663, -1105,
+    -3328,  2555,  1912,  3879,  5755, -2908, -2686, -3174,
+     4320,  5782,   354,  4536, -4989, -3315,  2305, -4624,
+     5736,  -652,  4976,  3565,  4231,  2767,   671,  5057,
+     1062,  1319, -2678,  2344, -5374, -1583,  4919, -1956,
+     2639, -1594,   404, -3988,  2013,  2882,  3186,  3957,
+     4255, -5257, -3833, -4749,  2468, -5868, -4372, -4782,
+     1212,   325,  6039, -3643, -2731,  -418,   476, -3482,
+      790, -1958, -4885, -5315,  -827, -2057,  3636,   975,
+     5828,  1360,  4096, -1254,  1428,  1843,  2370, -5874,
+    -2366, -3656, -2481,  6118, -1381,  2925,  5195,  4080,
+    // Barrett companions
+         0,      3,      3,  -3944,      3,  13722,  -3944, -10780,
+         3,   1925,  13722,  11023,  -3944,   3480, -10780,  15295,
+         3,  -6786,   1925,  15625,  13722,   9343,  11023,  -4389,
+     -3944,   9655,   3480,  -8519, -10780,   9445,  15295,   3232,
+         3,  -1501,  -6786, -13274,   1925,  -2530,  15625, -15273,
+     13722,   8015,   9343,  15404,  11023, -12855,  -4389,  13394,
+     -3944,  -7933,   9655,   3602,   3480,   6999,  -8519,  12242,
+    -10780,   7317,   9445,  -8874,  15295,   7037,   3232,  15540,
+         3, -12922,  -1501,    373,  -6786, -13562, -13274,    216,
+      1925,   9474,  -2530,   7381,  15625,   6183, -15273,  -7901,
+     13722,  -8359,   8015, -12295,   9343,   8037,  15404,  -2666,
+     11023,  -6117, -12855,   3138,  -4389,   2546,  13394,   8135,
+     -3944,   7325,  -7933,   4941,   9655,   3536,   3602,   8242,
+      3480,  12812,   6999,  -4360,  -8519,  -3120,  12242, -13055,
+    -10780,   9898,   7317,  -1936,   9445,   8535,  -8874,  11519,
+     15295,   2832,   7037,  11346,   3232,   2106,  15540,  -6309,
+         3,  13810, -12922,  -8789,  -1501,  -8757,    373,     24,
+     -6786,  14777, -13562, -13511, -13274,   3360,    216,   4461,
+      1925,   9018,   9474,  11610,  -2530,   1944,   7381, -15441,
+     15625, -13039,   6183,   9994, -15273,    891,  -7901,   9557,
+     13722,  -9885,  -8359,  -6389,   8015,  -5570, -12295,  -7578,
+      9343,  -9698,   8037,   6602,  15404, -12351,  -2666, -14215,
+     11023,   6794,  -6117,   7565, -12855,   8770,   3138,    904,
+     -4389,  10484,   2546,  15377,  13394,  -4522,   8135,  -6733,
+     -3944,  -9850,   7325, -10530,  -7933,   7682,   4941,  -2725,
+      9655,    387,   3536,  -5858,   3602,  11700,   8242, -11407,
+      3480,   -947,  12812,   -347,   6999,   8642,  -4360,  -1451,
+     -8519, -15761,  -3120,  -2541,  12242,  -6469, -13055, -11138,
+    -10780,   4690,   9898,  11871,   7317,  13578,  -1936,   1280,
+      9445,  -9223,   8535,    315,  -8874,  15345,  11519, -13303,
+     15295,  11282,   2832, -14330,   7037,   5368,  11346,   6581,
+      3232,  -7282,   2106,  -2205,  15540,   3808,  -6309,  -3682,
+         3, -11423,  13810, -13842, -12922,  11047,  -8789,      8,
+     -1501,   8661,  -8757,  -5997,    373,   6402,     24,  -4504,
+     -6786,   6498,  14777,   1120, -13562,     72, -13511,  12410,
+    -13274,  11564,   3360,  -7917,    216,  -7765,   4461,  -7053,
+      1925,  10079,   9018,    648,   9474,  13383,  11610,   5776,
+     -2530,  -5714,   1944,  -4346,   7381,   2061, -15441,  -7591,
+     15625,   5832, -13039, -10626,   6183, -13556,   9994,  14108,
+    -15273,  -6349,    891, -14218,  -7901,  -2786,   9557, -13052,
+     13722,   2672,  -9885,   9066,  -8359,  -4098,  -6389,   8397,
+      8015,   3114,  -5570,   7690, -12295,  13602,  -7578,  -8722,
+      9343,  16057,  -9698,  -4117,   8037,  10034,   6602,  -4738,
+     15404,   3674, -12351,  -8658,  -2666, -12962, -14215,  13444,
+     11023,  -4285,   6794,  -7999,  -6117,  -9877,   7565,    301,
+    -12855, -12386,   8770,  14417,   3138, -10074,    904,  -5797,
+     -4389,  -6458,  10484,   9415,   2546,   2712,  15377, -13167,
+     13394,  -1315,  -4522,   7639,   8135,  13364,  -6733,   7413,
+     -3944, -13567,  -9850,  -8362,   7325,  12570, -10530, -11831,
+     -7933,   3218,   7682, -10794,   4941,   1179,  -2725,   8970,
+      9655,  -9722,    387,  14823,   3536,  -8175,  -5858,  -3802,
+      3602,   1160,  11700,  10607,   8242,  15193, -11407,  10807,
+      3480,   2333,   -947,  -8042,  12812,  -1453,   -347,  10439,
+      6999,  -2840,   8642,   5669,  -4360,  -1040,  -1451, -11770,
+     -8519,  -6842, -15761, -13079,  -3120,  -4352,  -2541,   7210,
+     12242, -14516,  -6469,  -9359, -13055,  -7623, -11138,   3957,
+    -10780,  13362,   4690,  -6397,   9898,   -645,  11871,    427,
+      7317,  14071,  13578,  -3074,  -1936,   2845,   1280, -10818,
+      9445,   7965,  -9223,  -5808,   8535,   3840,    315,  -4434,
+     -8874,   5098,  15345,  -7162,  11519,    944, -13303,   6146,
+     15295,  13268,  11282,   1789,   2832,  -7141, -14330,  13116,
+      7037,   1077,   5368,   8495,  11346, -10221,   6581, -11658,
+      3232,  16103,  -7282,   1269,   2106, -13026,  -2205,   9695,
+     15540,  10922,   3808,   6319,  -6309,  -6615,  -3682,  13852,
+         3,  10031, -11423, -14743,  13810,  14220, -13842,  -3522,
+    -12922, -16172,  11047,   9370,  -8789,    131,      8,  -2674,
+     -1501, -11460,   8661,   9893,  -8757, -10567,  -5997, -15748,
+       373,  -4658,   6402,    392,     24,  -8023,  -4504,  -1613,
+     -6786,  -3090,   6498,   1067,  14777, -14476,   1120, -13975,
+    -13562,   1176,     72,   8698, -13511,  -4840,  12410,  -9271,
+    -13274,   3200,  11564, -10660,   3360,  -9157,  -7917,   3528,
+       216,  -6674,  -7765, -14519,   4461,   4954,  -7053,   9599,
+      1925,    787,  10079,   5298,   9018,  10583,    648,  12746,
+      9474, -10788,  13383,  14863,  11610,  -3970,   5776,   2360,
+     -2530,  15895,  -5714,  -1019,   1944,   5469,  -4346,    403,
+      7381,  11820,   2061, -11911, -15441,   7079,  -7591,  14916,
+     15625,  -3056,   5832, -16361, -13039,   1208, -10626,   2693,
+      6183,  -2965, -13556, -11530,   9994,  11980,  14108,  -9167,
+    -15273, -16316,  -6349,   3624,    891,   8079, -14218,  -8895,
+     -7901,  -1821,  -2786,   3173,   9557,   5266, -13052, -16180,
+     13722,  10871,   2672,  -8530,  -9885,   6082,   9066,  -5464,
+     -8359,   9519,  -4098,  15799,  -6389, -15772,   8397,   -155,
+      8015,   7178,   3114, -14521,  -5570,  16377,   7690,  -4210,
+    -12295,  14628,  13602, -14548,  -7578,   -464,  -8722, -11234,
+      9343, -10796,  16057,  16364,  -9698, -12631,  -4117,  11116,
+      8037, -10876,  10034,  -1392,   6602,   -933,  -4738,    379,
+     15404,  16324,   3674,  -5125, -12351,    581,  -8658,    139,
+     -2666,  -4176, -12962,  -2800, -14215,   1136,  13444,  16204,
+     11023, -15375,  -4285,   1744,   6794,    416,  -7999, -12527,
+     -6117,  -8399,  -9877,   3408,   7565,  15844,    301, -13356,
+    -12855,   5232, -12386,   1248,   8770,  -4813,  14417,   7570,
+      3138,  10223, -10074,  14764,    904,  -7301,  -5797,  15695,
+     -4389,   3744,  -6458, -14439,  10484, -10058,   9415,  -2098,
+      2546,  11524,   2712,  10866,  15377,  14316, -13167,  11231,
+     13394, -10548,  -1315,   2594,  -4522,  -6295,   7639,   1805,
+      8135,   -171,  13364,  10181,  -6733,    925,   7413,   1123,
+     -3944,   7783, -13567,  13882,  -9850,   5416,  -8362,   -512,
+      7325,  -2226,  12570,   2776, -10530,   3368, -11831,  -9418,
+     -7933,   8877,   3218,  16247,   7682,  -1536, -10794,  -6679,
+      4941,   8327,   1179,  10103,  -2725,   4514,   8970,  -6138,
+      9655,  15972,  -9722,  -4608,    387,  12730,  14823,  -7786,
+      3536,  -2458,  -8175,  13543,  -5858,  14353,  -3802,  15148,
+      3602, -13823,   1160,   5421,  11700,   9410,  10607,  -7375,
+      8242,   7861,  15193,  10292, -11407,  12676,  10807,  -8701,
+      3480,  16263,   2333,  -4538,   -947,  10642,  -8042,  -9186,
+     12812,  -1891,  -1453,   5261,   -347,   6666,  10439,  16020,
+      6999, -13615,  -2840,   -843,   8642,   5210,   5669,  -5672,
+     -4360,  15783,  -1040, -12770,  -1451,  15292, -11770,  -8077,
+     -8519,  -2528,  -6842,  15631, -15761,  15753, -13079,  14580,
+     -3120,  -5541,  -4352,  13108,  -2541,   8538,   7210,  -7583,
+     12242,  14124, -14516,  14492,  -6469,  10972,  -9359,  16145,
+    -13055,   6557,  -7623,  -7154, -11138,  10018,   3957,   9605,
+    -10780,  10708,  13362,    149,   4690,  15668,  -6397, -13098,
+      9898,  11306,   -645,  -2714,  11871,  -3954,    427,   -643,
+      7317,    448,  14071,  14236,  13578,  -6525,  -3074,   1149,
+     -1936,  -8143,   2845, -11863,   1280,  -1928, -10818,   1344,
+      9445,   9941,   7965,  13194,  -9223,   3448,  -5808,   8338,
+      8535,  -2821,   3840,  -5784,    315,   4032,  -4434,  -2946,
+     -8874,   6813,   5098,  10343,  15345,  -7754,  -7162,  -8463,
+     11519,  15417,    944,  12095, -13303,  -8839,   6146, -12330,
+     15295,  -1739,  13268,   9506,  11282,   7378,   1789,  13484,
+      2832,   3517,  -7141,   6250, -14330,  -4221,  13116,  -5216,
+      7037,  -4250,   1077, -10634,   5368,   7685,   8495,  10551,
+     11346, -14018, -10221, -12663,   6581, -15647, -11658, -12751,
+      3232,    867,  16103,  -9714,  -7282,  -1115,   1269,  -9285,
+      2106,  -5221, -13026, -14172,  -2205,  -5485,   9695,   2600,
+     15540,   3626,  10922,  -3344,   3808,   4914,   6319, -15663,
+     -6309,  -9749,  -6615,  16313,  -3682,   7799,  13852,  10879,
+};
+
+const int16_t ntt_short1024_inv_omega_powers_rev[2048] = {
+        0,     1,     1, -1479,     1, -1479,  5146, -4043,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+       81,  3091, -1000,  4320, -2963, -4896,  3051, -2366,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+       81,  3091, -1000,  4320, -2963, -4896,  3051, -2366,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     1260,  4388, -4632,  5755,   334, -2426, -1696,  1428,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+     1673, -4278, -5331, -4989,  3584, -4177, -2525, -1381,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+       81,  3091, -1000,  4320, -2963, -4896,  3051, -2366,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     1260,  4388, -4632,  5755,   334, -2426, -1696,  1428,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+     1673, -4278, -5331, -4989,  3584, -4177, -2525, -1381,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     4337,   435,  1378,  1912, -2381, -5444,  -493,  4096,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+    -2912,  5698, -4861,   354, -1045, -2859,  5012, -2481,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -2969,  3978, -3247, -2686, -5332, -3510,  2865,  2370,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+    -2645,  4053,  5042,  2305, -4895,  1484,  2780,  5195,
+        1, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+       81,  3091, -1000,  4320, -2963, -4896,  3051, -2366,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     1260,  4388, -4632,  5755,   334, -2426, -1696,  1428,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+     1673, -4278, -5331, -4989,  3584, -4177, -2525, -1381,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     4337,   435,  1378,  1912, -2381, -5444,  -493,  4096,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+    -2912,  5698, -4861,   354, -1045, -2859,  5012, -2481,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -2969,  3978, -3247, -2686, -5332, -3510,  2865,  2370,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+    -2645,  4053,  5042,  2305, -4895,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -2503,  2948, -1566,  5782,  -683,  2459,   -64, -3656,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+    -3434,  3529,   218, -2908,  3030,  4115, -2361,  1843,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+     1858,  4754,   426, -3315,  1975,  3757,   347,  2925,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -3998,  2033, -1922,  3879,  1359,  5435,   973, -1254,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+    -5445,  3860, -1050,  4536,  1190, -2683,  3818,  6118,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+     1323, -2766,    52, -3174, -3336,  6055,   677, -5874,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+     3600, -3263,  6077, -4624, -6068,  3602,   421,  4080,
+    // Barrett companions
+         0,      3,      3,  -3944,      3,  -3944,  13722, -10780,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+    -12922,   7325,  -8359,   9898,   9474,  12812,  -6117,   2832,
+    -13562,   3536,   8037,   8535,   6183,  -3120,   2546,   2106,
+       373,   4941, -12295,  -1936,   7381,  -4360,   3138,  11346,
+       216,   8242,  -2666,  11519,  -7901, -13055,   8135,  -6309,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+    -12922,   7325,  -8359,   9898,   9474,  12812,  -6117,   2832,
+    -13562,   3536,   8037,   8535,   6183,  -3120,   2546,   2106,
+       373,   4941, -12295,  -1936,   7381,  -4360,   3138,  11346,
+       216,   8242,  -2666,  11519,  -7901, -13055,   8135,  -6309,
+     13810,  -9850,  -9885,   4690,   9018,   -947,   6794,  11282,
+     14777,    387,  -9698,  -9223, -13039, -15761,  10484,  -7282,
+     -8757,   7682,  -5570,  13578,   1944,   8642,   8770,   5368,
+      3360,  11700, -12351,  15345,    891,  -6469,  -4522,   3808,
+     -8789, -10530,  -6389,  11871,  11610,   -347,   7565, -14330,
+    -13511,  -5858,   6602,    315,   9994,  -2541,  15377,  -2205,
+        24,  -2725,  -7578,   1280, -15441,  -1451,    904,   6581,
+      4461, -11407, -14215, -13303,   9557, -11138,  -6733,  -3682,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+    -12922,   7325,  -8359,   9898,   9474,  12812,  -6117,   2832,
+    -13562,   3536,   8037,   8535,   6183,  -3120,   2546,   2106,
+       373,   4941, -12295,  -1936,   7381,  -4360,   3138,  11346,
+       216,   8242,  -2666,  11519,  -7901, -13055,   8135,  -6309,
+     13810,  -9850,  -9885,   4690,   9018,   -947,   6794,  11282,
+     14777,    387,  -9698,  -9223, -13039, -15761,  10484,  -7282,
+     -8757,   7682,  -5570,  13578,   1944,   8642,   8770,   5368,
+      3360,  11700, -12351,  15345,    891,  -6469,  -4522,   3808,
+     -8789, -10530,  -6389,  11871,  11610,   -347,   7565, -14330,
+    -13511,  -5858,   6602,    315,   9994,  -2541,  15377,  -2205,
+        24,  -2725,  -7578,   1280, -15441,  -1451,    904,   6581,
+      4461, -11407, -14215, -13303,   9557, -11138,  -6733,  -3682,
+    -11423, -13567,   2672,  13362,  10079,   2333,  -4285,  13268,
+      6498,  -9722,  16057,   7965,   5832,  -6842,  -6458,  16103,
+      8661,   3218,   3114,  14071,  -5714,  -2840, -12386,   1077,
+     11564,   1160,   3674,   5098,  -6349, -14516,  -1315,  10922,
+     11047,  12570,  -4098,   -645,  13383,  -1453,  -9877,  -7141,
+        72,  -8175,  10034,   3840, -13556,  -4352,   2712, -13026,
+      6402,   1179,  13602,   2845,   2061,  -1040, -10074, -10221,
+     -7765,  15193, -12962,    944,  -2786,  -7623,  13364,  -6615,
+    -13842,  -8362,   9066,  -6397,    648,  -8042,  -7999,   1789,
+      1120,  14823,  -4117,  -5808, -10626, -13079,   9415,   1269,
+     -5997, -10794,   7690,  -3074,  -4346,   5669,  14417,   8495,
+     -7917,  10607,  -8658,  -7162, -14218,  -9359,   7639,   6319,
+         8, -11831,   8397,    427,   5776,  10439,    301,  13116,
+     12410,  -3802,  -4738,  -4434,  14108,   7210, -13167,   9695,
+     -4504,   8970,  -8722, -10818,  -7591, -11770,  -5797, -11658,
+     -7053,  10807,  13444,   6146, -13052,   3957,   7413,  13852,
+         3,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+    -12922,   7325,  -8359,   9898,   9474,  12812,  -6117,   2832,
+    -13562,   3536,   8037,   8535,   6183,  -3120,   2546,   2106,
+       373,   4941, -12295,  -1936,   7381,  -4360,   3138,  11346,
+       216,   8242,  -2666,  11519,  -7901, -13055,   8135,  -6309,
+     13810,  -9850,  -9885,   4690,   9018,   -947,   6794,  11282,
+     14777,    387,  -9698,  -9223, -13039, -15761,  10484,  -7282,
+     -8757,   7682,  -5570,  13578,   1944,   8642,   8770,   5368,
+      3360,  11700, -12351,  15345,    891,  -6469,  -4522,   3808,
+     -8789, -10530,  -6389,  11871,  11610,   -347,   7565, -14330,
+    -13511,  -5858,   6602,    315,   9994,  -2541,  15377,  -2205,
+        24,  -2725,  -7578,   1280, -15441,  -1451,    904,   6581,
+      4461, -11407, -14215, -13303,   9557, -11138,  -6733,  -3682,
+    -11423, -13567,   2672,  13362,  10079,   2333,  -4285,  13268,
+      6498,  -9722,  16057,   7965,   5832,  -6842,  -6458,  16103,
+      8661,   3218,   3114,  14071,  -5714,  -2840, -12386,   1077,
+     11564,   1160,   3674,   5098,  -6349, -14516,  -1315,  10922,
+     11047,  12570,  -4098,   -645,  13383,  -1453,  -9877,  -7141,
+        72,  -8175,  10034,   3840, -13556,  -4352,   2712, -13026,
+      6402,   1179,  13602,   2845,   2061,  -1040, -10074, -10221,
+     -7765,  15193, -12962,    944,  -2786,  -7623,  13364,  -6615,
+    -13842,  -8362,   9066,  -6397,    648,  -8042,  -7999,   1789,
+      1120,  14823,  -4117,  -5808, -10626, -13079,   9415,   1269,
+     -5997, -10794,   7690,  -3074,  -4346,   5669,  14417,   8495,
+     -7917,  10607,  -8658,  -7162, -14218,  -9359,   7639,   6319,
+         8, -11831,   8397,    427,   5776,  10439,    301,  13116,
+     12410,  -3802,  -4738,  -4434,  14108,   7210, -13167,   9695,
+     -4504,   8970,  -8722, -10818,  -7591, -11770,  -5797, -11658,
+     -7053,  10807,  13444,   6146, -13052,   3957,   7413,  13852,
+     10031,   7783,  10871,  10708,    787,  16263, -15375,  -1739,
+     -3090,  15972, -10796,   9941,  -3056,  -2528,   3744,    867,
+    -11460,   8877,   7178,    448,  15895, -13615,   5232,  -4250,
+      3200, -13823,  16324,   6813, -16316,  14124, -10548,   3626,
+    -16172,  -2226,   9519,  11306, -10788,  -1891,  -8399,   3517,
+      1176,  -2458, -10876,  -2821,  -2965,  -5541,  11524,  -5221,
+     -4658,   8327,  14628,  -8143,  11820,  15783,  10223, -14018,
+     -6674,   7861,  -4176,  15417,  -1821,   6557,   -171,  -9749,
+     14220,   5416,   6082,  15668,  10583,  10642,    416,   7378,
+    -14476,  12730, -12631,   3448,   1208,  15753, -10058,  -1115,
+    -10567,  -1536,  16377,  -6525,   5469,   5210,  -4813,   7685,
+     -9157,   9410,    581,  -7754,   8079,  10972,  -6295,   4914,
+       131,   3368, -15772,  -3954,  -3970,   6666,  15844,  -4221,
+     -4840,  14353,   -933,   4032,  11980,   8538,  14316,  -5485,
+     -8023,   4514,   -464,  -1928,   7079,  15292,  -7301, -15647,
+      4954,  12676,   1136,  -8839,   5266,  10018,    925,   7799,
+    -14743,  13882,  -8530,    149,   5298,  -4538,   1744,   9506,
+      1067,  -4608,  16364,  13194, -16361,  15631, -14439,  -9714,
+      9893,  16247, -14521,  14236,  -1019,   -843,   1248, -10634,
+    -10660,   5421,  -5125,  10343,   3624,  14492,   2594,  -3344,
+      9370,   2776,  15799,  -2714,  14863,   5261,   3408,   6250,
+      8698,  13543,  -1392,  -5784, -11530,  13108,  10866, -14172,
+       392,  10103, -14548, -11863, -11911, -12770,  14764, -12663,
+    -14519,  10292,  -2800,  12095,   3173,  -7154,  10181,  16313,
+     -3522,   -512,  -5464, -13098,  12746,  -9186, -12527,  13484,
+    -13975,  -7786,  11116,   8338,   2693,  14580,  -2098,  -9285,
+    -15748,  -6679,  -4210,   1149,    403,  -5672,   7570,  10551,
+      3528,  -7375,    139,  -8463,  -8895,  16145,   1805, -15663,
+     -2674,  -9418,   -155,   -643,   2360,  16020, -13356,  -5216,
+     -9271,  15148,    379,  -2946,  -9167,  -7583,  11231,   2600,
+     -1613,  -6138, -11234,   1344,  14916,  -8077,  15695, -12751,
+      9599,  -8701,  16204, -12330, -16180,   9605,   1123,  10879,
+};
+
+const int16_t ntt_short1024_mixed_powers[2048] = {
+        0,  1479,  4043, -5146, -5736, -1305, -4134,  -722,
+    -1212, -3542,  3195, -3621,  1646, -3504, -5860,  2545,
+    -5828, -2639,  3328, -2744, -4591, -2625, -1351,  2975,
+    -5023,  4821, -5777, -3006,  5728,   949,  4978,   563,
+     2366,  -790, -4255, -1062, -4320, -3201,   726, -3712,
+     4896,  1170,  1635, -4805, -3091, -1326, -1853, -2747,
+    -3051,  -955, -1177,  2294,  1000, -3014,  4611,  3135,
+     2963, -2319, -2768, -3553,   -81,  5086,  -140,  4846,
+     1381, -1428,   827,  2731, -2468, -2013,  5374, -4231,
+     4989, -5755,  -118,  3459,  -480, -5092, -4452, -1759,
+     4177,  2426,   953,  5911,   544, -3241,   130,   355,
+     4278, -4388,  2197,  -145,  1022, -2881,  3949,  3694,
+     2525,  1696, -5767, -3932,  -339, -3289, -2837, -2548,
+     5331,  4632, -2476,  3637,  2842,  2089,  2396,  3707,
+    -3584,  -334, -3748,  4890,  5791,  -729, -4354, -3382,
+    -1673, -1260,  5067, -5542,    -9,  3284,  3296, -5179,
+    -5195,  2481, -2370, -4096, -3636,  4885,  -476, -6039,
+     4372,  3833, -3186,  -404, -4919,  2678,  -671, -4976,
+    -2305,  -354,  2686, -1912,  1663, -1440,  2178, -2987,
+     4057, -1067,  1153, -5277,  -160,   242,  2399, -5011,
+    -1484,  2859,  3510,  5444, -2704,  1632,  4905,  2566,
+     4414,   390, -2126,  1065, -3915,   545,  3016,  -875,
+    -4053, -5698, -3978,  -435,  1426,  3066, -5559,  3646,
+    -3364,  -442,  4048, -1207,  4437, -4714,  3136,  5088,
+    -2780, -5012, -2865,   493,  4938, -1017, -3531,  2422,
+     2174,  3778, -5407,  4645,  -113,  3704,  3000,  1607,
+    -5042,  4861,  3247, -1378,  1777, -3763,  1544, -6022,
+     3271, -5101, -2884, -1168, -3149,  1537, -3400, -1002,
+     4895,  1045,  5332,  2381, -5291,  5084,  3985, -2187,
+     2847,  -773,  1630,  2143, -2166, -5019,  -243, -3780,
+     2645,  2912,  2969, -4337, -4654,   -27,  -420, -2437,
+     1689, -2401,  2249, -3248,    -3, -4143,  5191,  4284,
+    -4080, -2925, -6118,  3656,  5874, -1843,  1254, -1360,
+     -975,  2057,  5315,  1958,  3482,   418,  3643,  -325,
+     4782,  5868,  4749,  5257, -3957, -2882,  3988,  1594,
+     1956,  1583, -2344, -1319, -5057, -2767, -3565,   652,
+     4624,  3315, -4536, -5782,  3174,  2908, -3879, -2555,
+     1105, -1512,  2169,  1058, -3127, -1293, -4948, -3728,
+     -504,   723,  4449,  3054,  -431,  2447, -5339,  -168,
+      241,  1483,  1018, -4240,  4912, -5876,   -56, -4016,
+    -3602, -3757,  2683, -2459, -6055, -4115, -5435, -5297,
+     2844, -3202, -4916,  2078, -5468, -5908, -5862,   948,
+     3029, -5735,  4789, -5919,  2127, -1954,   316,  5106,
+    -6008, -2500, -1973,   709,  3445, -3991,  1702, -6099,
+     3263, -4754, -3860, -2948,  2766, -3529, -2033,  5184,
+    -5681, -5383, -5079,   922,  2920, -4774,  1728, -5990,
+     2302, -1693, -3789, -3123,  2505,   576, -6093, -3329,
+     3532, -1263, -1041,   835,   192, -2031, -5206, -2919,
+     -421,  -347, -3818,    64,  -677,  2361,  -973,  3956,
+    -4212, -5369, -4075, -4322,   787,  3772,  5415, -1404,
+    -5886,  2738, -5537, -3834, -2839,  1805,  -468, -1962,
+     5009, -5942, -1278,  3150,  4698,  -156,  -654,  5766,
+    -6077,  -426,  1050,  1566,   -52,  -218,  1922, -6122,
+     -142,   350,   522,  4079, -4169,  4737, -6137,  4049,
+     4213,   174,  5456, -5486,  1579, -6142,  5446, -2692,
+       58,  5915, -5925, -3570,  2049, -2281,  3199, -4077,
+     6068, -1975, -1190,   683,  3336, -3030, -1359,  6119,
+     3438, -4493,  4324,  1112, -1010,  -453,  6136,  1146,
+    -5594, -2655,  4467, -4433,  -151, -2051,   382, -5961,
+     -885,  1489, -5574,  4046, -4780, -3969, -1987,  -295,
+    -3600, -1858,  5445,  2503, -1323,  3434,  3998, -1200,
+     3477,  1815, -3262,  -441,  5241,  5429,  -400,  1159,
+      605,  3009,  -147,  1747,  5906,  3963, -3710,  4298,
+     1003,   -49, -3514,  6065,  1321, -5333,  5529, -3762,
+     1014,  4273,  4251, -4301,  -612,  2293, -3511, -4094,
+     2769, -3929,  5464,  -874,  2110,  5789,   338, -2672,
+     1417, -5530,  -204, -3332,  2926, -5461,   923, -5406,
+    -2275,  3805, -3393,  6026,  4209, -4987, -3624,  2253,
+      -68, -5207, -3121,  2276,  4404, -1802,  3338, -2828,
+    -1131,  6105,  1403,  2434, -1208,   751, -4119, -5832,
+     3056,  4855,  1468, -4697,  5209, -5039,  -377,  2035,
+     4564, -3285, -4499, -3846, -1373, -1944,  5115, -2478,
+    -3607, -5662, -2360, -5776, -4222, -3418, -2575, -1095,
+    -5596, -1282, -4554,  -648,  1705,  -826,  2894,  2209,
+    -4883,  2171,  2689,  2957,  3238,  -365,  2231,  3669,
+    -1518,  -216, -3528,  3821,  5061, -3360, -5724,  4820,
+    -3200,  5082, -3017, -4218,  4840,  1223,  -506,   -72,
+    -1176,  5370,  1687, -1120, -1908,  5703, -5163,  1694,
+    -5102, -1406, -2483,  4504, -4265,   -24,  -392,  1790,
+    -3534,  3723,  -636,  1901, -1721,  4661, -5797, -4565,
+    -4924, -2595, -5518,    -8, -4227,  4693, -1178,  1241,
+     -212,  4730, -4670,  5650,  2164, -5618,  2455,  -865,
+     2257, -4099, -1409, -2532, -4489,  4510, -4167,  5673,
+    -5653, -2213, -3375, -5969, -3278,  3808, -3344,  2730,
+    -4566,  -844,  2600, -2593, -1389,  1891,  2212, -4834,
+    -1125, -6086, -5189, -2827, -5211,   910, -1522,  3815,
+     4963,  3232,  -463, -3466, -3359,  2485,  -375, -6125,
+    -5826,  3154, -1737, -3793,  3589,  5368, -2442, -3019,
+     3942,  2941, -5216, -3268,  -125, -6138, -1942, -3045,
+     -579,  2832, -2900, -2307,  -814,  3090,  1314, -3116,
+    -5835,  3007, -4138, -2046,  3449, -1015,  -193,   944,
+    -5063,  -769,  3825,  1030,   438, -5135, -1945, -3094,
+     2717,  -682,  5246,  3758,  4032,  4411, -5784,  3840,
+     1275, -3753,   146, -5808,  3448,  3065,  5002,  3869,
+     5845,  5349,  1344, -2626, -1928,  1280,   425, -1251,
+     4145, -1936, -2947,  5118, -2429,  5386, -2148,  1783,
+      448,  3221, -4739,  4523,  4238,  -417,  5478,  3451,
+     3114,  1706, -4906, -2301,  -716, -3502, -3947,  5170,
+    -5676,  5604,  5509,  -139,  1826, -2946,  1038,  4665,
+     2461,  -767, -4335,  2929, -5412, -2373, -1892,  1868,
+    -2260,  4050,  4705,  -982,   346,  1555, -3276, -4352,
+    -1445, -3120, -1804,  -791, -4727,  4719,  3343,  1350,
+    -2528,  3769, -3981, -3578, -1092, -5547, -4578, -1040,
+     3495, -4360, -5672,  1573, -2982,   450, -4939, -2840,
+    -1327, -5289,  -364, -1849, -1526, -4443,  1165,  2643,
+    -5987, -3572,  -994,   150,  2450, -5043,  3654, -1763,
+     3975,  3480, -4605, -1481, -3708,   881, -6092, -5287,
+     3765,    50,  4913, -1681,  1218, -4684,  1325,  1160,
+    -1535, -4590, -1236,  4390, -6127,  2334,  1255,  4113,
+     5734,  3536,   406,  2535,  4538,  4483, -4608, -1530,
+     -412, -2633,  2054,   778, -3678,  1371, -2185,  5275,
+    -3961,   845,  5609, -2602, -1536,  -510,  3959, -4974,
+     4781, -3837, -1226,   457,  3368, -2338,  2776,  4378,
+     5966,  3229,  -512,  -170,  5416, -1658,  5690, -1279,
+    -4505, -3944,  5219,  3317, -3171, -2637,  6085, -3020,
+    -4267, -4153, -2291, -4649,  5993,  3670, -5598, -5411,
+     5836,  5202, -1057,  -879, -2068, -5103,  2674,  2712,
+    -4860, -5646,  6094, -2873, -1866, -5900, -2151,  1734,
+     3744,  -293,  3407, -1701, -3205,   904, -1620, -1882,
+    -2065, -5054,  -622, -6063,  -717,   578,  1248, -4194,
+     5232,  -567,  3028, -3795,  -540,  3469,  3408, -5781,
+     3889, -2021,  -239,  4289,   416, -1398,  1744,  -189,
+    -3087, -1265,  -180, -2940,  1136, -1927, -2800, -4770,
+    -4176,  5526,  4235,  -466, -3515,   -63, -1029, -4518,
+      -60,  -980,  4475,  3454,  3163, -1590, -1392,  1842,
+     5508,  3941, -5268,   -21,  -343, -1506,   -20, -4423,
+     5588, -2945, -3042,  -530,  -464,   614,  1836,  5410,
+    -1756,    -7,  3982,  -502, -4103,  2622,  5959, -5078,
+    // Barrett companions
+         0,   3944,  10780, -13722, -15295,  -3480, -11023,  -1925,
+     -3232,  -9445,   8519,  -9655,   4389,  -9343, -15625,   6786,
+    -15540,  -7037,   8874,  -7317, -12242,  -6999,  -3602,   7933,
+    -13394,  12855, -15404,  -8015,  15273,   2530,  13274,   1501,
+      6309,  -2106, -11346,  -2832, -11519,  -8535,   1936,  -9898,
+     13055,   3120,   4360, -12812,  -8242,  -3536,  -4941,  -7325,
+     -8135,  -2546,  -3138,   6117,   2666,  -8037,  12295,   8359,
+      7901,  -6183,  -7381,  -9474,   -216,  13562,   -373,  12922,
+      3682,  -3808,   2205,   7282,  -6581,  -5368,  14330, -11282,
+     13303, -15345,   -315,   9223,  -1280, -13578, -11871,  -4690,
+     11138,   6469,   2541,  15761,   1451,  -8642,    347,    947,
+     11407, -11700,   5858,   -387,   2725,  -7682,  10530,   9850,
+      6733,   4522, -15377, -10484,   -904,  -8770,  -7565,  -6794,
+     14215,  12351,  -6602,   9698,   7578,   5570,   6389,   9885,
+     -9557,   -891,  -9994,  13039,  15441,  -1944, -11610,  -9018,
+     -4461,  -3360,  13511, -14777,    -24,   8757,   8789, -13810,
+    -13852,   6615,  -6319, -10922,  -9695,  13026,  -1269, -16103,
+     11658,  10221,  -8495,  -1077, -13116,   7141,  -1789, -13268,
+     -6146,   -944,   7162,  -5098,   4434,  -3840,   5808,  -7965,
+     10818,  -2845,   3074, -14071,   -427,    645,   6397, -13362,
+     -3957,   7623,   9359,  14516,  -7210,   4352,  13079,   6842,
+     11770,   1040,  -5669,   2840, -10439,   1453,   8042,  -2333,
+    -10807, -15193, -10607,  -1160,   3802,   8175, -14823,   9722,
+     -8970,  -1179,  10794,  -3218,  11831, -12570,   8362,  13567,
+     -7413, -13364,  -7639,   1315,  13167,  -2712,  -9415,   6458,
+      5797,  10074, -14417,  12386,   -301,   9877,   7999,   4285,
+    -13444,  12962,   8658,  -3674,   4738, -10034,   4117, -16057,
+      8722, -13602,  -7690,  -3114,  -8397,   4098,  -9066,  -2672,
+     13052,   2786,  14218,   6349, -14108,  13556,  10626,  -5832,
+      7591,  -2061,   4346,   5714,  -5776, -13383,   -648, -10079,
+      7053,   7765,   7917, -11564, -12410,    -72,  -1120,  -6498,
+      4504,  -6402,   5997,  -8661,     -8, -11047,  13842,  11423,
+    -10879,  -7799, -16313,   9749,  15663,  -4914,   3344,  -3626,
+     -2600,   5485,  14172,   5221,   9285,   1115,   9714,   -867,
+     12751,  15647,  12663,  14018, -10551,  -7685,  10634,   4250,
+      5216,   4221,  -6250,  -3517, -13484,  -7378,  -9506,   1739,
+     12330,   8839, -12095, -15417,   8463,   7754, -10343,  -6813,
+      2946,  -4032,   5784,   2821,  -8338,  -3448, -13194,  -9941,
+     -1344,   1928,  11863,   8143,  -1149,   6525, -14236,   -448,
+       643,   3954,   2714, -11306,  13098, -15668,   -149, -10708,
+     -9605, -10018,   7154,  -6557, -16145, -10972, -14492, -14124,
+      7583,  -8538, -13108,   5541, -14580, -15753, -15631,   2528,
+      8077, -15292,  12770, -15783,   5672,  -5210,    843,  13615,
+    -16020,  -6666,  -5261,   1891,   9186, -10642,   4538, -16263,
+      8701, -12676, -10292,  -7861,   7375,  -9410,  -5421,  13823,
+    -15148, -14353, -13543,   2458,   7786, -12730,   4608, -15972,
+      6138,  -4514, -10103,  -8327,   6679,   1536, -16247,  -8877,
+      9418,  -3368,  -2776,   2226,    512,  -5416, -13882,  -7783,
+     -1123,   -925, -10181,    171,  -1805,   6295,  -2594,  10548,
+    -11231, -14316, -10866, -11524,   2098,  10058,  14439,  -3744,
+    -15695,   7301, -14764, -10223,  -7570,   4813,  -1248,  -5232,
+     13356, -15844,  -3408,   8399,  12527,   -416,  -1744,  15375,
+    -16204,  -1136,   2800,   4176,   -139,   -581,   5125, -16324,
+      -379,    933,   1392,  10876, -11116,  12631, -16364,  10796,
+     11234,    464,  14548, -14628,   4210, -16377,  14521,  -7178,
+       155,  15772, -15799,  -9519,   5464,  -6082,   8530, -10871,
+     16180,  -5266,  -3173,   1821,   8895,  -8079,  -3624,  16316,
+      9167, -11980,  11530,   2965,  -2693,  -1208,  16361,   3056,
+    -14916,  -7079,  11911, -11820,   -403,  -5469,   1019, -15895,
+     -2360,   3970, -14863,  10788, -12746, -10583,  -5298,   -787,
+     -9599,  -4954,  14519,   6674,  -3528,   9157,  10660,  -3200,
+      9271,   4840,  -8698,  -1176,  13975,  14476,  -1067,   3090,
+      1613,   8023,   -392,   4658,  15748,  10567,  -9893,  11460,
+      2674,   -131,  -9370,  16172,   3522, -14220,  14743, -10031,
+      2704,  11394,  11335, -11468,  -1632,   6114,  -9362, -10916,
+      7383, -10476,  14569,  -2330,   5626,  15436,    901,  -7125,
+      3778, -14745,   -544,  -8885,   7802, -14561,   2461, -14415,
+     -6066,  10146,  -9047,  16068,  11223, -13298,  -9663,   6008,
+      -181, -13884,  -8322,   6069,  11743,  -4805,   8901,  -7541,
+     -3016,  16279,   3741,   6490,  -3221,   2003, -10983, -15551,
+      8149,  12946,   3914, -12524,  13890, -13436,  -1005,   5426,
+     12170,  -8759, -11996, -10255,  -3661,  -5184,  13639,  -6607,
+     -9618, -15097,  -6293, -15401, -11258,  -9114,  -6866,  -2920,
+    -14921,  -3418, -12143,  -1728,   4546,  -2202,   7717,   5890,
+    -13020,   5789,   7170,   7885,   8634,   -973,   5949,   9783,
+     -4048,   -576,  -9407,  10189,  13495,  -8959, -15263,  12852,
+     -8533,  13551,  -8045, -11247,  12906,   3261,  -1349,   -192,
+     -3136,  14319,   4498,  -2986,  -5088,  15207, -13767,   4517,
+    -13604,  -3749,  -6621,  12010, -11372,    -64,  -1045,   4773,
+     -9423,   9927,  -1696,   5069,  -4589,  12428, -15457, -12172,
+    -13130,  -6919, -14713,    -21, -11271,  12514,  -3141,   3309,
+      -565,  12612, -12452,  15065,   5770, -14980,   6546,  -2306,
+      6018, -10930,  -3757,  -6751, -11970,  12026, -11111,  15127,
+    -15073,  -5901,  -8999, -15916,  -8741,  10154,  -8917,   7279,
+    -12175,  -2250,   6933,  -6914,  -3704,   5042,   5898, -12890,
+     -3000, -16228, -13836,  -7538, -13895,   2426,  -4058,  10173,
+     13234,   8618,  -1235,  -9242,  -8957,   6626,  -1000, -16332,
+    -15535,   8410,  -4632, -10114,   9570,  14314,  -6511,  -8050,
+     10511,   7842, -13908,  -8714,   -333, -16367,  -5178,  -8119,
+     -1544,   7551,  -7733,  -6151,  -2170,   8239,   3504,  -8309,
+    -15559,   8018, -11034,  -5456,   9197,  -2706,   -515,   2517,
+    -13500,  -2050,  10199,   2746,   1168, -13692,  -5186,  -8250,
+      7245,  -1819,  13988,  10021,  10751,  11762, -15423,  10239,
+      3400, -10007,    389, -15487,   9194,   8173,  13338,  10316,
+     15585,  14263,   3584,  -7002,  -5141,   3413,   1133,  -3336,
+     11052,  -5162,  -7858,  13647,  -6477,  14361,  -5728,   4754,
+      1195,   8589, -12636,  12060,  11300,  -1112,  14607,   9202,
+      8303,   4549, -13082,  -6136,  -1909,  -9338, -10524,  13786,
+    -15135,  14943,  14689,   -371,   4869,  -7855,   2768,  12439,
+      6562,  -2045, -11559,   7810, -14431,  -6327,  -5045,   4981,
+     -6026,  10799,  12546,  -2618,    923,   4146,  -8735, -11604,
+     -3853,  -8319,  -4810,  -2109, -12604,  12583,   8914,   3600,
+     -6741,  10050, -10615,  -9541,  -2912, -14791, -12207,  -2773,
+      9319, -11626, -15124,   4194,  -7951,   1200, -13170,  -7573,
+     -3538, -14103,   -971,  -4930,  -4069, -11847,   3106,   7047,
+    -15964,  -9525,  -2650,    400,   6533, -13447,   9743,  -4701,
+     10599,   9279, -12279,  -3949,  -9887,   2349, -16244, -14098,
+     10039,    133,  13100,  -4482,   3248, -12490,   3533,   3093,
+     -4093, -12239,  -3296,  11706, -16337,   6223,   3346,  10967,
+     15289,   9429,   1083,   6759,  12100,  11954, -12287,  -4080,
+     -1099,  -7021,   5477,   2074,  -9807,   3656,  -5826,  14066,
+    -10562,   2253,  14956,  -6938,  -4096,  -1360,  10556, -13263,
+     12748, -10231,  -3269,   1219,   8981,  -6234,   7402,  11674,
+     15908,   8610,  -1365,   -453,  14441,  -4421,  15172,  -3410,
+    -12012, -10516,  13916,   8845,  -8455,  -7031,  16225,  -8053,
+    -11378, -11074,  -6109, -12396,  15980,   9786, -14927, -14428,
+     15561,  13871,  -2818,  -2344,  -5514, -13607,   7130,   7231,
+    -12959, -15055,  16249,  -7661,  -4976, -15732,  -5736,   4624,
+      9983,   -781,   9085,  -4536,  -8546,   2410,  -4320,  -5018,
+     -5506, -13476,  -1659, -16167,  -1912,   1541,   3328, -11183,
+     13951,  -1512,   8074, -10119,  -1440,   9250,   9087, -15415,
+     10370,  -5389,   -637,  11436,   1109,  -3728,   4650,   -504,
+     -8231,  -3373,   -480,  -7839,   3029,  -5138,  -7466, -12719,
+    -11135,  14735,  11292,  -1243,  -9373,   -168,  -2744, -12047,
+      -160,  -2613,  11932,   9210,   8434,  -4240,  -3712,   4912,
+     14687,  10508, -14047,    -56,   -915,  -4016,    -53, -11794,
+     14900,  -7853,  -8111,  -1413,  -1237,   1637,   4896,  14425,
+     -4682,    -19,  10618,  -1339, -10940,   6991,  15889, -13540,
+};
+
+const int16_t ntt_short1024_mixed_powers_rev[2048] = {
+        0,  1479,  4043, -5146, -5736, -4134, -1305,  -722,
+    -1212,  1646,  3195, -5860, -3542, -3504, -3621,  2545,
+    -5828, -5023, -4591,  5728,  3328, -5777, -1351,  4978,
+    -2639,  4821, -2625,   949, -2744, -3006,  2975,   563,
+     2366, -3051,  4896,  2963, -4320,  1000, -3091,   -81,
+    -4255, -1177,  1635, -2768,   726,  4611, -1853,  -140,
+     -790,  -955,  1170, -2319, -3201, -3014, -1326,  5086,
+    -1062,  2294, -4805, -3553, -3712,  3135, -2747,  4846,
+     1381,  2525,  4177, -3584,  4989,  5331,  4278, -1673,
+    -2468,  -339,   544,  5791,  -480,  2842,  1022,    -9,
+      827, -5767,   953, -3748,  -118, -2476,  2197,  5067,
+     5374, -2837,   130, -4354, -4452,  2396,  3949,  3296,
+    -1428,  1696,  2426,  -334, -5755,  4632, -4388, -1260,
+    -2013, -3289, -3241,  -729, -5092,  2089, -2881,  3284,
+     2731, -3932,  5911,  4890,  3459,  3637,  -145, -5542,
+    -4231, -2548,   355, -3382, -1759,  3707,  3694, -5179,
+    -5195, -2780, -1484,  4895, -2305, -5042, -4053,  2645,
+     4372,  2174,  4414,  2847,  4057,  3271, -3364,  1689,
+    -3636,  4938, -2704, -5291,  1663,  1777,  1426, -4654,
+    -4919,  -113, -3915, -2166,  -160, -3149,  4437,    -3,
+    -2370, -2865,  3510,  5332,  2686,  3247, -3978,  2969,
+    -3186, -5407, -2126,  1630,  1153, -2884,  4048,  2249,
+     -476, -3531,  4905,  3985,  2178,  1544, -5559,  -420,
+     -671,  3000,  3016,  -243,  2399, -3400,  3136,  5191,
+     2481, -5012,  2859,  1045,  -354,  4861, -5698,  2912,
+     3833,  3778,   390,  -773, -1067, -5101,  -442, -2401,
+     4885, -1017,  1632,  5084, -1440, -3763,  3066,   -27,
+     2678,  3704,   545, -5019,   242,  1537, -4714, -4143,
+    -4096,   493,  5444,  2381, -1912, -1378,  -435, -4337,
+     -404,  4645,  1065,  2143, -5277, -1168, -1207, -3248,
+    -6039,  2422,  2566, -2187, -2987, -6022,  3646, -2437,
+    -4976,  1607,  -875, -3780, -5011, -1002,  5088,  4284,
+    -4080,  -421, -3602,  6068,  4624, -6077,  3263, -3600,
+     4782, -5886,  3029, -5594,  -504,  4213,  2302,   605,
+     -975, -4212,  2844,  3438,  1105,  -142, -5681,  3477,
+     1956,  5009, -6008,  -885,   241,    58,  3532,  1003,
+     5874,  -677, -6055,  3336,  3174,   -52,  2766, -1323,
+    -3957, -2839,  2127,  -151,  -431,  1579,  2505,  5906,
+     3482,   787, -5468, -1010, -3127, -4169,  2920,  5241,
+    -5057,  4698,  3445, -4780,  4912,  2049,   192,  1321,
+    -6118, -3818,  2683, -1190, -4536,  1050, -3860,  5445,
+     4749, -5537,  4789,  4467,  4449,  5456, -3789,  -147,
+     5315, -4075, -4916,  4324,  2169,   522, -5079, -3262,
+    -2344, -1278, -1973, -5574,  1018, -5925, -1041, -3514,
+     1254,  -973, -5435, -1359, -3879,  1922, -2033,  3998,
+     3988,  -468,   316,   382, -5339,  5446, -6093, -3710,
+     3643,  5415, -5862,  6136, -4948, -6137,  1728,  -400,
+    -3565,  -654,  1702, -1987,   -56,  3199, -5206,  5529,
+    -2925,  -347, -3757, -1975,  3315,  -426, -4754, -1858,
+     5868,  2738, -5735, -2655,   723,   174, -1693,  3009,
+     2057, -5369, -3202, -4493, -1512,   350, -5383,  1815,
+     1583, -5942, -2500,  1489,  1483,  5915, -1263,   -49,
+    -1843,  2361, -4115, -3030,  2908,  -218, -3529,  3434,
+    -2882,  1805, -1954, -2051,  2447, -6142,   576,  3963,
+      418,  3772, -5908,  -453, -1293,  4737, -4774,  5429,
+    -2767,  -156, -3991, -3969, -5876, -2281, -2031, -5333,
+     3656,    64, -2459,   683, -5782,  1566, -2948,  2503,
+     5257, -3834, -5919, -4433,  3054, -5486, -3123,  1747,
+     1958, -4322,  2078,  1112,  1058,  4079,   922,  -441,
+    -1319,  3150,   709,  4046, -4240, -3570,   835,  6065,
+    -1360,  3956, -5297,  6119, -2555, -6122,  5184, -1200,
+     1594, -1962,  5106, -5961,  -168, -2692, -3329,  4298,
+     -325, -1404,   948,  1146, -3728,  4049, -5990,  1159,
+      652,  5766, -6099,  -295, -4016, -4077, -2919, -3762,
+     1014,   448, -4924,  4781, -3607, -1327,  3942,  5232,
+      -68, -2260, -4566,  5836, -3200, -1535,  2717,   -60,
+     1417, -5676,  2257, -4505, -4883,  3975, -5835, -3087,
+     3056, -2528,  4963,  3744, -5102,  -412,  5845,  5588,
+     2769,  3114,  -212,  5966, -5596, -5987,  -579,  3889,
+    -1131, -1445, -1125, -4860, -1176,  5734,  1275,  5508,
+    -2275,  2461, -5653, -4267, -1518,  3765, -5063, -4176,
+     4564,  3495, -5826, -2065, -3534, -3961,  4145, -1756,
+     -612,  4238, -4227,  3368, -4222, -1526,  -125,  -540,
+     4404,   346, -1389, -2068,  4840, -6127,  4032,  3163,
+     2926,  1826, -4489, -3171,  3238, -3708,  3449,  1136,
+     5209, -1092, -3359, -3205, -4265, -3678, -1928,  -464,
+     2110,  -716,  2164,  5416,  1705,  2450,  -814,   416,
+    -1208, -4727, -5211, -1866, -1908,  4538,  3448,  -343,
+     4209, -5412, -3278,  5993,  5061,  1218,   438, -3515,
+    -1373, -2982,  3589,  -717, -1721, -1536, -2429, -4103,
+     4251, -4739, -5518, -1226, -2360,  -364, -5216,  3028,
+    -3121,  4705,  2600, -1057, -3017, -1236,  5246,  4475,
+     -204,  5509, -1409,  5219,  2689, -4605, -4138,  -180,
+     1468, -3981,  -463,  3407, -2483,  2054,  1344, -3042,
+     5464, -4906, -4670,  -512, -4554,  -994, -2900,  -239,
+     1403, -1804, -5189,  6094,  1687,   406,   146, -5268,
+    -3393, -4335, -3375, -2291, -3528,  4913,  3825,  4235,
+    -4499, -5672, -1737,  -622,  -636,  5609, -2947,  3982,
+    -3511,  5478, -1178,  2776, -2575,  1165, -1942,  3408,
+     3338, -3276,  2212,  2674,  -506,  1255, -5784, -1392,
+      923,  1038, -4167,  6085,  2231, -6092,  -193, -2800,
+     -377, -4578,  -375, -1620,  -392, -2185,   425,  1836,
+      338, -3947,  2455,  5690,  2894,  3654,  1314,  1744,
+    -4119,  3343, -1522, -2151, -5163, -4608,  5002,   -20,
+    -3624, -1892, -3344, -5598, -5724,  1325, -1945, -1029,
+     5115, -4939, -2442,  1248, -5797,  3959, -2148,  5959,
+     4273,  3221, -2595, -3837, -5662, -5289,  2941,  -567,
+    -5207,  4050,  -844,  5202,  5082, -4590,  -682,  -980,
+    -5530,  5604, -4099, -3944,  2171,  3480,  3007, -1265,
+     4855,  3769,  3232,  -293, -1406, -2633,  5349, -2945,
+    -3929,  1706,  4730,  3229, -1282, -3572,  2832, -2021,
+     6105, -3120, -6086, -5646,  5370,  3536, -3753,  3941,
+     3805,  -767, -2213, -4153,  -216,    50,  -769,  5526,
+    -3285, -4360,  3154, -5054,  3723,   845, -1936,    -7,
+     2293,  -417,  4693, -2338, -3418, -4443, -6138,  3469,
+    -1802,  1555,  1891, -5103,  1223,  2334,  4411, -1590,
+    -5461, -2946,  4510, -2637,  -365,   881, -1015, -1927,
+    -5039, -5547,  2485,   904,   -24,  1371,  1280,   614,
+     5789, -3502, -5618, -1658,  -826, -5043,  3090, -1398,
+      751,  4719,   910, -5900,  5703,  4483,  3065, -1506,
+    -4987, -2373,  3808,  3670, -3360, -4684, -5135,   -63,
+    -1944,   450,  5368,   578,  4661,  -510,  5386,  2622,
+    -4301,  4523,    -8,   457, -5776, -1849, -3268, -3795,
+     2276,  -982, -2593,  -879, -4218,  4390,  3758,  3454,
+    -3332,  -139, -2532,  3317,  2957, -1481, -2046, -2940,
+    -4697, -3578, -3466, -1701,  4504,   778, -2626,  -530,
+     -874, -2301,  5650,  -170,  -648,   150, -2307,  4289,
+     2434,  -791, -2827, -2873, -1120,  2535, -5808,   -21,
+     6026,  2929, -5969, -4649,  3821, -1681,  1030,  -466,
+    -3846,  1573, -3793, -6063,  1901, -2602,  5118,  -502,
+    -4094,  3451,  1241,  4378, -1095,  2643, -3045, -5781,
+    -2828, -4352, -4834,  2712,   -72,  4113,  3840,  1842,
+    -5406,  4665,  5673, -3020,  3669, -5287,   944, -4770,
+     2035, -1040, -6125, -1882,  1790,  5275, -1251,  5410,
+    -2672,  5170,  -865, -1279,  2209, -1763, -3116,  -189,
+    -5832,  1350,  3815,  1734,  1694, -1530,  3869, -4423,
+     2253,  1868,  2730, -5411,  4820,  1160, -3094, -4518,
+    -2478, -2840, -3019, -4194, -4565, -4974,  1783, -5078,
+    // Barrett companions
+         0,   3944,  10780, -13722, -15295, -11023,  -3480,  -1925,
+     -3232,   4389,   8519, -15625,  -9445,  -9343,  -9655,   6786,
+    -15540, -13394, -12242,  15273,   8874, -15404,  -3602,  13274,
+     -7037,  12855,  -6999,   2530,  -7317,  -8015,   7933,   1501,
+      6309,  -8135,  13055,   7901, -11519,   2666,  -8242,   -216,
+    -11346,  -3138,   4360,  -7381,   1936,  12295,  -4941,   -373,
+     -2106,  -2546,   3120,  -6183,  -8535,  -8037,  -3536,  13562,
+     -2832,   6117, -12812,  -9474,  -9898,   8359,  -7325,  12922,
+      3682,   6733,  11138,  -9557,  13303,  14215,  11407,  -4461,
+     -6581,   -904,   1451,  15441,  -1280,   7578,   2725,    -24,
+      2205, -15377,   2541,  -9994,   -315,  -6602,   5858,  13511,
+     14330,  -7565,    347, -11610, -11871,   6389,  10530,   8789,
+     -3808,   4522,   6469,   -891, -15345,  12351, -11700,  -3360,
+     -5368,  -8770,  -8642,  -1944, -13578,   5570,  -7682,   8757,
+      7282, -10484,  15761,  13039,   9223,   9698,   -387, -14777,
+    -11282,  -6794,    947,  -9018,  -4690,   9885,   9850, -13810,
+    -13852,  -7413,  -3957,  13052,  -6146, -13444, -10807,   7053,
+     11658,   5797,  11770,   7591,  10818,   8722,  -8970,   4504,
+     -9695,  13167,  -7210, -14108,   4434,   4738,   3802, -12410,
+    -13116,   -301, -10439,  -5776,   -427,  -8397,  11831,     -8,
+     -6319,  -7639,   9359,  14218,   7162,   8658, -10607,   7917,
+     -8495, -14417,  -5669,   4346,   3074,  -7690,  10794,   5997,
+     -1269,  -9415,  13079,  10626,   5808,   4117, -14823,  -1120,
+     -1789,   7999,   8042,   -648,   6397,  -9066,   8362,  13842,
+      6615, -13364,   7623,   2786,   -944,  12962, -15193,   7765,
+     10221,  10074,   1040,  -2061,  -2845, -13602,  -1179,  -6402,
+     13026,  -2712,   4352,  13556,  -3840, -10034,   8175,    -72,
+      7141,   9877,   1453, -13383,    645,   4098, -12570, -11047,
+    -10922,   1315,  14516,   6349,  -5098,  -3674,  -1160, -11564,
+     -1077,  12386,   2840,   5714, -14071,  -3114,  -3218,  -8661,
+    -16103,   6458,   6842,  -5832,  -7965, -16057,   9722,  -6498,
+    -13268,   4285,  -2333, -10079, -13362,  -2672,  13567,  11423,
+    -10879,  -1123,  -9605,  16180,  12330, -16204,   8701,  -9599,
+     12751, -15695,   8077, -14916,  -1344,  11234,   6138,   1613,
+     -2600, -11231,   7583,   9167,   2946,   -379, -15148,   9271,
+      5216,  13356, -16020,  -2360,    643,    155,   9418,   2674,
+     15663,  -1805, -16145,   8895,   8463,   -139,   7375,  -3528,
+    -10551,  -7570,   5672,   -403,  -1149,   4210,   6679,  15748,
+      9285,   2098, -14580,  -2693,  -8338, -11116,   7786,  13975,
+    -13484,  12527,   9186, -12746,  13098,   5464,    512,   3522,
+    -16313, -10181,   7154,  -3173, -12095,   2800, -10292,  14519,
+     12663, -14764,  12770,  11911,  11863,  14548, -10103,   -392,
+     14172, -10866, -13108,  11530,   5784,   1392, -13543,  -8698,
+     -6250,  -3408,  -5261, -14863,   2714, -15799,  -2776,  -9370,
+      3344,  -2594, -14492,  -3624, -10343,   5125,  -5421,  10660,
+     10634,  -1248,    843,   1019, -14236,  14521, -16247,  -9893,
+      9714,  14439, -15631,  16361, -13194, -16364,   4608,  -1067,
+     -9506,  -1744,   4538,  -5298,   -149,   8530, -13882,  14743,
+     -7799,   -925, -10018,  -5266,   8839,  -1136, -12676,  -4954,
+     15647,   7301, -15292,  -7079,   1928,    464,  -4514,   8023,
+      5485, -14316,  -8538, -11980,  -4032,    933, -14353,   4840,
+      4221, -15844,  -6666,   3970,   3954,  15772,  -3368,   -131,
+     -4914,   6295, -10972,  -8079,   7754,   -581,  -9410,   9157,
+     -7685,   4813,  -5210,  -5469,   6525, -16377,   1536,  10567,
+      1115,  10058, -15753,  -1208,  -3448,  12631, -12730,  14476,
+     -7378,   -416, -10642, -10583, -15668,  -6082,  -5416, -14220,
+      9749,    171,  -6557,   1821, -15417,   4176,  -7861,   6674,
+     14018, -10223, -15783, -11820,   8143, -14628,  -8327,   4658,
+      5221, -11524,   5541,   2965,   2821,  10876,   2458,  -1176,
+     -3517,   8399,   1891,  10788, -11306,  -9519,   2226,  16172,
+     -3626,  10548, -14124,  16316,  -6813, -16324,  13823,  -3200,
+      4250,  -5232,  13615, -15895,   -448,  -7178,  -8877,  11460,
+      -867,  -3744,   2528,   3056,  -9941,  10796, -15972,   3090,
+      1739,  15375, -16263,   -787, -10708, -10871,  -7783, -10031,
+      2704,   1195, -13130,  12748,  -9618,  -3538,  10511,  13951,
+      -181,  -6026, -12175,  15561,  -8533,  -4093,   7245,   -160,
+      3778, -15135,   6018, -12012, -13020,  10599, -15559,  -8231,
+      8149,  -6741,  13234,   9983, -13604,  -1099,  15585,  14900,
+      7383,   8303,   -565,  15908, -14921, -15964,  -1544,  10370,
+     -3016,  -3853,  -3000, -12959,  -3136,  15289,   3400,  14687,
+     -6066,   6562, -15073, -11378,  -4048,  10039, -13500, -11135,
+     12170,   9319, -15535,  -5506,  -9423, -10562,  11052,  -4682,
+     -1632,  11300, -11271,   8981, -11258,  -4069,   -333,  -1440,
+     11743,    923,  -3704,  -5514,  12906, -16337,  10751,   8434,
+      7802,   4869, -11970,  -8455,   8634,  -9887,   9197,   3029,
+     13890,  -2912,  -8957,  -8546, -11372,  -9807,  -5141,  -1237,
+      5626,  -1909,   5770,  14441,   4546,   6533,  -2170,   1109,
+     -3221, -12604, -13895,  -4976,  -5088,  12100,   9194,   -915,
+     11223, -14431,  -8741,  15980,  13495,   3248,   1168,  -9373,
+     -3661,  -7951,   9570,  -1912,  -4589,  -4096,  -6477, -10940,
+     11335, -12636, -14713,  -3269,  -6293,   -971, -13908,   8074,
+     -8322,  12546,   6933,  -2818,  -8045,  -3296,  13988,  11932,
+      -544,  14689,  -3757,  13916,   7170, -12279, -11034,   -480,
+      3914, -10615,  -1235,   9085,  -6621,   5477,   3584,  -8111,
+     14569, -13082, -12452,  -1365, -12143,  -2650,  -7733,   -637,
+      3741,  -4810, -13836,  16249,   4498,   1083,    389, -14047,
+     -9047, -11559,  -8999,  -6109,  -9407,  13100,  10199,  11292,
+    -11996, -15124,  -4632,  -1659,  -1696,  14956,  -7858,  10618,
+     -9362,  14607,  -3141,   7402,  -6866,   3106,  -5178,   9087,
+      8901,  -8735,   5898,   7130,  -1349,   3346, -15423,  -3712,
+      2461,   2768, -11111,  16225,   5949, -16244,   -515,  -7466,
+     -1005, -12207,  -1000,  -4320,  -1045,  -5826,   1133,   4896,
+       901, -10524,   6546,  15172,   7717,   9743,   3504,   4650,
+    -10983,   8914,  -4058,  -5736, -13767, -12287,  13338,    -53,
+     -9663,  -5045,  -8917, -14927, -15263,   3533,  -5186,  -2744,
+     13639, -13170,  -6511,   3328, -15457,  10556,  -5728,  15889,
+     11394,   8589,  -6919, -10231, -15097, -14103,   7842,  -1512,
+    -13884,  10799,  -2250,  13871,  13551, -12239,  -1819,  -2613,
+    -14745,  14943, -10930, -10516,   5789,   9279,   8018,  -3373,
+     12946,  10050,   8618,   -781,  -3749,  -7021,  14263,  -7853,
+    -10476,   4549,  12612,   8610,  -3418,  -9525,   7551,  -5389,
+     16279,  -8319, -16228, -15055,  14319,   9429, -10007,  10508,
+     10146,  -2045,  -5901, -11074,   -576,    133,  -2050,  14735,
+     -8759, -11626,   8410, -13476,   9927,   2253,  -5162,    -19,
+      6114,  -1112,  12514,  -6234,  -9114, -11847, -16367,   9250,
+     -4805,   4146,   5042, -13607,   3261,   6223,  11762,  -4240,
+    -14561,  -7855,  12026,  -7031,   -973,   2349,  -2706,  -5138,
+    -13436, -14791,   6626,   2410,    -64,   3656,   3413,   1637,
+     15436,  -9338, -14980,  -4421,  -2202, -13447,   8239,  -3728,
+      2003,  12583,   2426, -15732,  15207,  11954,   8173,  -4016,
+    -13298,  -6327,  10154,   9786,  -8959, -12490, -13692,   -168,
+     -5184,   1200,  14314,   1541,  12428,  -1360,  14361,   6991,
+    -11468,  12060,    -21,   1219, -15401,  -4930,  -8714, -10119,
+      6069,  -2618,  -6914,  -2344, -11247,  11706,  10021,   9210,
+     -8885,   -371,  -6751,   8845,   7885,  -3949,  -5456,  -7839,
+    -12524,  -9541,  -9242,  -4536,  12010,   2074,  -7002,  -1413,
+     -2330,  -6136,  15065,   -453,  -1728,    400,  -6151,  11436,
+      6490,  -2109,  -7538,  -7661,  -2986,   6759, -15487,    -56,
+     16068,   7810, -15916, -12396,  10189,  -4482,   2746,  -1243,
+    -10255,   4194, -10114, -16167,   5069,  -6938,  13647,  -1339,
+    -10916,   9202,   3309,  11674,  -2920,   7047,  -8119, -15415,
+     -7541, -11604, -12890,   7231,   -192,  10967,  10239,   4912,
+    -14415,  12439,  15127,  -8053,   9783, -14098,   2517, -12719,
+      5426,  -2773, -16332,  -5018,   4773,  14066,  -3336,  14425,
+     -7125,  13786,  -2306,  -3410,   5890,  -4701,  -8309,   -504,
+    -15551,   3600,  10173,   4624,   4517,  -4080,  10316, -11794,
+      6008,   4981,   7279, -14428,  12852,   3093,  -8250, -12047,
+     -6607,  -7573,  -8050, -11183, -12172, -13263,   4754, -13540,
+};
+
+const int16_t ntt_short1024_inv_mixed_powers[2048] = {
+        0, -1479,  5146, -4043,   722,  4134,  1305,  5736,
+    -2545,  5860,  3504, -1646,  3621, -3195,  3542,  1212,
+     -563, -4978,  -949, -5728,  3006,  5777, -4821,  5023,
+    -2975,  1351,  2625,  4591,  2744, -3328,  2639,  5828,
+    -4846,   140, -5086,    81,  3553,  2768,  2319, -2963,
+    -3135, -4611,  3014, -1000, -2294,  1177,   955,  3051,
+     2747,  1853,  1326,  3091,  4805, -1635, -1170, -4896,
+     3712,  -726,  3201,  4320,  1062,  4255,   790, -2366,
+     5179, -3296, -3284,     9,  5542, -5067,  1260,  1673,
+     3382,  4354,   729, -5791, -4890,  3748,   334,  3584,
+    -3707, -2396, -2089, -2842, -3637,  2476, -4632, -5331,
+     2548,  2837,  3289,   339,  3932,  5767, -1696, -2525,
+    -3694, -3949,  2881, -1022,   145, -2197,  4388, -4278,
+     -355,  -130,  3241,  -544, -5911,  -953, -2426, -4177,
+     1759,  4452,  5092,   480, -3459,   118,  5755, -4989,
+     4231, -5374,  2013,  2468, -2731,  -827,  1428, -1381,
+    -4284, -5191,  4143,     3,  3248, -2249,  2401, -1689,
+     2437,   420,    27,  4654,  4337, -2969, -2912, -2645,
+     3780,   243,  5019,  2166, -2143, -1630,   773, -2847,
+     2187, -3985, -5084,  5291, -2381, -5332, -1045, -4895,
+     1002,  3400, -1537,  3149,  1168,  2884,  5101, -3271,
+     6022, -1544,  3763, -1777,  1378, -3247, -4861,  5042,
+    -1607, -3000, -3704,   113, -4645,  5407, -3778, -2174,
+    -2422,  3531,  1017, -4938,  -493,  2865,  5012,  2780,
+    -5088, -3136,  4714, -4437,  1207, -4048,   442,  3364,
+    -3646,  5559, -3066, -1426,   435,  3978,  5698,  4053,
+      875, -3016,  -545,  3915, -1065,  2126,  -390, -4414,
+    -2566, -4905, -1632,  2704, -5444, -3510, -2859,  1484,
+     5011, -2399,  -242,   160,  5277, -1153,  1067, -4057,
+     2987, -2178,  1440, -1663,  1912, -2686,   354,  2305,
+     4976,   671, -2678,  4919,   404,  3186, -3833, -4372,
+     6039,   476, -4885,  3636,  4096,  2370, -2481,  5195,
+     3762, -5529,  5333, -1321, -6065,  3514,    49, -1003,
+    -4298,  3710, -3963, -5906, -1747,   147, -3009,  -605,
+    -1159,   400, -5429, -5241,   441,  3262, -1815, -3477,
+     1200, -3998, -3434,  1323, -2503, -5445,  1858,  3600,
+      295,  1987,  3969,  4780, -4046,  5574, -1489,   885,
+     5961,  -382,  2051,   151,  4433, -4467,  2655,  5594,
+    -1146, -6136,   453,  1010, -1112, -4324,  4493, -3438,
+    -6119,  1359,  3030, -3336,  -683,  1190,  1975, -6068,
+     4077, -3199,  2281, -2049,  3570,  5925, -5915,   -58,
+     2692, -5446,  6142, -1579,  5486, -5456,  -174, -4213,
+    -4049,  6137, -4737,  4169, -4079,  -522,  -350,   142,
+     6122, -1922,   218,    52, -1566, -1050,   426,  6077,
+    -5766,   654,   156, -4698, -3150,  1278,  5942, -5009,
+     1962,   468, -1805,  2839,  3834,  5537, -2738,  5886,
+     1404, -5415, -3772,  -787,  4322,  4075,  5369,  4212,
+    -3956,   973, -2361,   677,   -64,  3818,   347,   421,
+     2919,  5206,  2031,  -192,  -835,  1041,  1263, -3532,
+     3329,  6093,  -576, -2505,  3123,  3789,  1693, -2302,
+     5990, -1728,  4774, -2920,  -922,  5079,  5383,  5681,
+    -5184,  2033,  3529, -2766,  2948,  3860,  4754, -3263,
+     6099, -1702,  3991, -3445,  -709,  1973,  2500,  6008,
+    -5106,  -316,  1954, -2127,  5919, -4789,  5735, -3029,
+     -948,  5862,  5908,  5468, -2078,  4916,  3202, -2844,
+     5297,  5435,  4115,  6055,  2459, -2683,  3757,  3602,
+     4016,    56,  5876, -4912,  4240, -1018, -1483,  -241,
+      168,  5339, -2447,   431, -3054, -4449,  -723,   504,
+     3728,  4948,  1293,  3127, -1058, -2169,  1512, -1105,
+     2555,  3879, -2908, -3174,  5782,  4536, -3315, -4624,
+     -652,  3565,  2767,  5057,  1319,  2344, -1583, -1956,
+    -1594, -3988,  2882,  3957, -5257, -4749, -5868, -4782,
+      325, -3643,  -418, -3482, -1958, -5315, -2057,   975,
+     1360, -1254,  1843, -5874, -3656,  6118,  2925,  4080,
+     5078, -5959, -2622,  4103,   502, -3982,     7,  1756,
+    -5410, -1836,  -614,   464,   530,  3042,  2945, -5588,
+     4423,    20,  1506,   343,    21,  5268, -3941, -5508,
+    -1842,  1392,  1590, -3163, -3454, -4475,   980,    60,
+     4518,  1029,    63,  3515,   466, -4235, -5526,  4176,
+     4770,  2800,  1927, -1136,  2940,   180,  1265,  3087,
+      189, -1744,  1398,  -416, -4289,   239,  2021, -3889,
+     5781, -3408, -3469,   540,  3795, -3028,   567, -5232,
+     4194, -1248,  -578,   717,  6063,   622,  5054,  2065,
+     1882,  1620,  -904,  3205,  1701, -3407,   293, -3744,
+    -1734,  2151,  5900,  1866,  2873, -6094,  5646,  4860,
+    -2712, -2674,  5103,  2068,   879,  1057, -5202, -5836,
+     5411,  5598, -3670, -5993,  4649,  2291,  4153,  4267,
+     3020, -6085,  2637,  3171, -3317, -5219,  3944,  4505,
+     1279, -5690,  1658, -5416,   170,   512, -3229, -5966,
+    -4378, -2776,  2338, -3368,  -457,  1226,  3837, -4781,
+     4974, -3959,   510,  1536,  2602, -5609,  -845,  3961,
+    -5275,  2185, -1371,  3678,  -778, -2054,  2633,   412,
+     1530,  4608, -4483, -4538, -2535,  -406, -3536, -5734,
+    -4113, -1255, -2334,  6127, -4390,  1236,  4590,  1535,
+    -1160, -1325,  4684, -1218,  1681, -4913,   -50, -3765,
+     5287,  6092,  -881,  3708,  1481,  4605, -3480, -3975,
+     1763, -3654,  5043, -2450,  -150,   994,  3572,  5987,
+    -2643, -1165,  4443,  1526,  1849,   364,  5289,  1327,
+     2840,  4939,  -450,  2982, -1573,  5672,  4360, -3495,
+     1040,  4578,  5547,  1092,  3578,  3981, -3769,  2528,
+    -1350, -3343, -4719,  4727,   791,  1804,  3120,  1445,
+     4352,  3276, -1555,  -346,   982, -4705, -4050,  2260,
+    -1868,  1892,  2373,  5412, -2929,  4335,   767, -2461,
+    -4665, -1038,  2946, -1826,   139, -5509, -5604,  5676,
+    -5170,  3947,  3502,   716,  2301,  4906, -1706, -3114,
+    -3451, -5478,   417, -4238, -4523,  4739, -3221,  -448,
+    -1783,  2148, -5386,  2429, -5118,  2947,  1936, -4145,
+     1251,  -425, -1280,  1928,  2626, -1344, -5349, -5845,
+    -3869, -5002, -3065, -3448,  5808,  -146,  3753, -1275,
+    -3840,  5784, -4411, -4032, -3758, -5246,   682, -2717,
+     3094,  1945,  5135,  -438, -1030, -3825,   769,  5063,
+     -944,   193,  1015, -3449,  2046,  4138, -3007,  5835,
+     3116, -1314, -3090,   814,  2307,  2900, -2832,   579,
+     3045,  1942,  6138,   125,  3268,  5216, -2941, -3942,
+     3019,  2442, -5368, -3589,  3793,  1737, -3154,  5826,
+     6125,   375, -2485,  3359,  3466,   463, -3232, -4963,
+    -3815,  1522,  -910,  5211,  2827,  5189,  6086,  1125,
+     4834, -2212, -1891,  1389,  2593, -2600,   844,  4566,
+    -2730,  3344, -3808,  3278,  5969,  3375,  2213,  5653,
+    -5673,  4167, -4510,  4489,  2532,  1409,  4099, -2257,
+      865, -2455,  5618, -2164, -5650,  4670, -4730,   212,
+    -1241,  1178, -4693,  4227,     8,  5518,  2595,  4924,
+     4565,  5797, -4661,  1721, -1901,   636, -3723,  3534,
+    -1790,   392,    24,  4265, -4504,  2483,  1406,  5102,
+    -1694,  5163, -5703,  1908,  1120, -1687, -5370,  1176,
+       72,   506, -1223, -4840,  4218,  3017, -5082,  3200,
+    -4820,  5724,  3360, -5061, -3821,  3528,   216,  1518,
+    -3669, -2231,   365, -3238, -2957, -2689, -2171,  4883,
+    -2209, -2894,   826, -1705,   648,  4554,  1282,  5596,
+     1095,  2575,  3418,  4222,  5776,  2360,  5662,  3607,
+     2478, -5115,  1944,  1373,  3846,  4499,  3285, -4564,
+    -2035,   377,  5039, -5209,  4697, -1468, -4855, -3056,
+     5832,  4119,  -751,  1208, -2434, -1403, -6105,  1131,
+     2828, -3338,  1802, -4404, -2276,  3121,  5207,    68,
+    -2253,  3624,  4987, -4209, -6026,  3393, -3805,  2275,
+     5406,  -923,  5461, -2926,  3332,   204,  5530, -1417,
+     2672,  -338, -5789, -2110,   874, -5464,  3929, -2769,
+     4094,  3511, -2293,   612,  4301, -4251, -4273, -1014,
+    // Barrett companions
+         0,  -3944,  13722, -10780,   1925,  11023,   3480,  15295,
+     -6786,  15625,   9343,  -4389,   9655,  -8519,   9445,   3232,
+     -1501, -13274,  -2530, -15273,   8015,  15404, -12855,  13394,
+     -7933,   3602,   6999,  12242,   7317,  -8874,   7037,  15540,
+    -12922,    373, -13562,    216,   9474,   7381,   6183,  -7901,
+     -8359, -12295,   8037,  -2666,  -6117,   3138,   2546,   8135,
+      7325,   4941,   3536,   8242,  12812,  -4360,  -3120, -13055,
+      9898,  -1936,   8535,  11519,   2832,  11346,   2106,  -6309,
+     13810,  -8789,  -8757,     24,  14777, -13511,   3360,   4461,
+      9018,  11610,   1944, -15441, -13039,   9994,    891,   9557,
+     -9885,  -6389,  -5570,  -7578,  -9698,   6602, -12351, -14215,
+      6794,   7565,   8770,    904,  10484,  15377,  -4522,  -6733,
+     -9850, -10530,   7682,  -2725,    387,  -5858,  11700, -11407,
+      -947,   -347,   8642,  -1451, -15761,  -2541,  -6469, -11138,
+      4690,  11871,  13578,   1280,  -9223,    315,  15345, -13303,
+     11282, -14330,   5368,   6581,  -7282,  -2205,   3808,  -3682,
+    -11423, -13842,  11047,      8,   8661,  -5997,   6402,  -4504,
+      6498,   1120,     72,  12410,  11564,  -7917,  -7765,  -7053,
+     10079,    648,  13383,   5776,  -5714,  -4346,   2061,  -7591,
+      5832, -10626, -13556,  14108,  -6349, -14218,  -2786, -13052,
+      2672,   9066,  -4098,   8397,   3114,   7690,  13602,  -8722,
+     16057,  -4117,  10034,  -4738,   3674,  -8658, -12962,  13444,
+     -4285,  -7999,  -9877,    301, -12386,  14417, -10074,  -5797,
+     -6458,   9415,   2712, -13167,  -1315,   7639,  13364,   7413,
+    -13567,  -8362,  12570, -11831,   3218, -10794,   1179,   8970,
+     -9722,  14823,  -8175,  -3802,   1160,  10607,  15193,  10807,
+      2333,  -8042,  -1453,  10439,  -2840,   5669,  -1040, -11770,
+     -6842, -13079,  -4352,   7210, -14516,  -9359,  -7623,   3957,
+     13362,  -6397,   -645,    427,  14071,  -3074,   2845, -10818,
+      7965,  -5808,   3840,  -4434,   5098,  -7162,    944,   6146,
+     13268,   1789,  -7141,  13116,   1077,   8495, -10221, -11658,
+     16103,   1269, -13026,   9695,  10922,   6319,  -6615,  13852,
+     10031, -14743,  14220,  -3522, -16172,   9370,    131,  -2674,
+    -11460,   9893, -10567, -15748,  -4658,    392,  -8023,  -1613,
+     -3090,   1067, -14476, -13975,   1176,   8698,  -4840,  -9271,
+      3200, -10660,  -9157,   3528,  -6674, -14519,   4954,   9599,
+       787,   5298,  10583,  12746, -10788,  14863,  -3970,   2360,
+     15895,  -1019,   5469,    403,  11820, -11911,   7079,  14916,
+     -3056, -16361,   1208,   2693,  -2965, -11530,  11980,  -9167,
+    -16316,   3624,   8079,  -8895,  -1821,   3173,   5266, -16180,
+     10871,  -8530,   6082,  -5464,   9519,  15799, -15772,   -155,
+      7178, -14521,  16377,  -4210,  14628, -14548,   -464, -11234,
+    -10796,  16364, -12631,  11116, -10876,  -1392,   -933,    379,
+     16324,  -5125,    581,    139,  -4176,  -2800,   1136,  16204,
+    -15375,   1744,    416, -12527,  -8399,   3408,  15844, -13356,
+      5232,   1248,  -4813,   7570,  10223,  14764,  -7301,  15695,
+      3744, -14439, -10058,  -2098,  11524,  10866,  14316,  11231,
+    -10548,   2594,  -6295,   1805,   -171,  10181,    925,   1123,
+      7783,  13882,   5416,   -512,  -2226,   2776,   3368,  -9418,
+      8877,  16247,  -1536,  -6679,   8327,  10103,   4514,  -6138,
+     15972,  -4608,  12730,  -7786,  -2458,  13543,  14353,  15148,
+    -13823,   5421,   9410,  -7375,   7861,  10292,  12676,  -8701,
+     16263,  -4538,  10642,  -9186,  -1891,   5261,   6666,  16020,
+    -13615,   -843,   5210,  -5672,  15783, -12770,  15292,  -8077,
+     -2528,  15631,  15753,  14580,  -5541,  13108,   8538,  -7583,
+     14124,  14492,  10972,  16145,   6557,  -7154,  10018,   9605,
+     10708,    149,  15668, -13098,  11306,  -2714,  -3954,   -643,
+       448,  14236,  -6525,   1149,  -8143, -11863,  -1928,   1344,
+      9941,  13194,   3448,   8338,  -2821,  -5784,   4032,  -2946,
+      6813,  10343,  -7754,  -8463,  15417,  12095,  -8839, -12330,
+     -1739,   9506,   7378,  13484,   3517,   6250,  -4221,  -5216,
+     -4250, -10634,   7685,  10551, -14018, -12663, -15647, -12751,
+       867,  -9714,  -1115,  -9285,  -5221, -14172,  -5485,   2600,
+      3626,  -3344,   4914, -15663,  -9749,  16313,   7799,  10879,
+     13540, -15889,  -6991,  10940,   1339, -10618,     19,   4682,
+    -14425,  -4896,  -1637,   1237,   1413,   8111,   7853, -14900,
+     11794,     53,   4016,    915,     56,  14047, -10508, -14687,
+     -4912,   3712,   4240,  -8434,  -9210, -11932,   2613,    160,
+     12047,   2744,    168,   9373,   1243, -11292, -14735,  11135,
+     12719,   7466,   5138,  -3029,   7839,    480,   3373,   8231,
+       504,  -4650,   3728,  -1109, -11436,    637,   5389, -10370,
+     15415,  -9087,  -9250,   1440,  10119,  -8074,   1512, -13951,
+     11183,  -3328,  -1541,   1912,  16167,   1659,  13476,   5506,
+      5018,   4320,  -2410,   8546,   4536,  -9085,    781,  -9983,
+     -4624,   5736,  15732,   4976,   7661, -16249,  15055,  12959,
+     -7231,  -7130,  13607,   5514,   2344,   2818, -13871, -15561,
+     14428,  14927,  -9786, -15980,  12396,   6109,  11074,  11378,
+      8053, -16225,   7031,   8455,  -8845, -13916,  10516,  12012,
+      3410, -15172,   4421, -14441,    453,   1365,  -8610, -15908,
+    -11674,  -7402,   6234,  -8981,  -1219,   3269,  10231, -12748,
+     13263, -10556,   1360,   4096,   6938, -14956,  -2253,  10562,
+    -14066,   5826,  -3656,   9807,  -2074,  -5477,   7021,   1099,
+      4080,  12287, -11954, -12100,  -6759,  -1083,  -9429, -15289,
+    -10967,  -3346,  -6223,  16337, -11706,   3296,  12239,   4093,
+     -3093,  -3533,  12490,  -3248,   4482, -13100,   -133, -10039,
+     14098,  16244,  -2349,   9887,   3949,  12279,  -9279, -10599,
+      4701,  -9743,  13447,  -6533,   -400,   2650,   9525,  15964,
+     -7047,  -3106,  11847,   4069,   4930,    971,  14103,   3538,
+      7573,  13170,  -1200,   7951,  -4194,  15124,  11626,  -9319,
+      2773,  12207,  14791,   2912,   9541,  10615, -10050,   6741,
+     -3600,  -8914, -12583,  12604,   2109,   4810,   8319,   3853,
+     11604,   8735,  -4146,   -923,   2618, -12546, -10799,   6026,
+     -4981,   5045,   6327,  14431,  -7810,  11559,   2045,  -6562,
+    -12439,  -2768,   7855,  -4869,    371, -14689, -14943,  15135,
+    -13786,  10524,   9338,   1909,   6136,  13082,  -4549,  -8303,
+     -9202, -14607,   1112, -11300, -12060,  12636,  -8589,  -1195,
+     -4754,   5728, -14361,   6477, -13647,   7858,   5162, -11052,
+      3336,  -1133,  -3413,   5141,   7002,  -3584, -14263, -15585,
+    -10316, -13338,  -8173,  -9194,  15487,   -389,  10007,  -3400,
+    -10239,  15423, -11762, -10751, -10021, -13988,   1819,  -7245,
+      8250,   5186,  13692,  -1168,  -2746, -10199,   2050,  13500,
+     -2517,    515,   2706,  -9197,   5456,  11034,  -8018,  15559,
+      8309,  -3504,  -8239,   2170,   6151,   7733,  -7551,   1544,
+      8119,   5178,  16367,    333,   8714,  13908,  -7842, -10511,
+      8050,   6511, -14314,  -9570,  10114,   4632,  -8410,  15535,
+     16332,   1000,  -6626,   8957,   9242,   1235,  -8618, -13234,
+    -10173,   4058,  -2426,  13895,   7538,  13836,  16228,   3000,
+     12890,  -5898,  -5042,   3704,   6914,  -6933,   2250,  12175,
+     -7279,   8917, -10154,   8741,  15916,   8999,   5901,  15073,
+    -15127,  11111, -12026,  11970,   6751,   3757,  10930,  -6018,
+      2306,  -6546,  14980,  -5770, -15065,  12452, -12612,    565,
+     -3309,   3141, -12514,  11271,     21,  14713,   6919,  13130,
+     12172,  15457, -12428,   4589,  -5069,   1696,  -9927,   9423,
+     -4773,   1045,     64,  11372, -12010,   6621,   3749,  13604,
+     -4517,  13767, -15207,   5088,   2986,  -4498, -14319,   3136,
+       192,   1349,  -3261, -12906,  11247,   8045, -13551,   8533,
+    -12852,  15263,   8959, -13495, -10189,   9407,    576,   4048,
+     -9783,  -5949,    973,  -8634,  -7885,  -7170,  -5789,  13020,
+     -5890,  -7717,   2202,  -4546,   1728,  12143,   3418,  14921,
+      2920,   6866,   9114,  11258,  15401,   6293,  15097,   9618,
+      6607, -13639,   5184,   3661,  10255,  11996,   8759, -12170,
+     -5426,   1005,  13436, -13890,  12524,  -3914, -12946,  -8149,
+     15551,  10983,  -2003,   3221,  -6490,  -3741, -16279,   3016,
+      7541,  -8901,   4805, -11743,  -6069,   8322,  13884,    181,
+     -6008,   9663,  13298, -11223, -16068,   9047, -10146,   6066,
+     14415,  -2461,  14561,  -7802,   8885,    544,  14745,  -3778,
+      7125,   -901, -15436,  -5626,   2330, -14569,  10476,  -7383,
+     10916,   9362,  -6114,   1632,  11468, -11335, -11394,  -2704,
+};
+
+const int16_t ntt_short1024_inv_mixed_powers_rev[2048] = {
+        0, -1479,  5146, -4043,   722,  1305,  4134,  5736,
+    -2545,  3621,  3504,  3542,  5860, -3195, -1646,  1212,
+     -563, -2975,  3006,  2744,  -949,  2625, -4821,  2639,
+    -4978,  1351,  5777, -3328, -5728,  4591,  5023,  5828,
+    -4846,  2747, -3135,  3712,  3553,  4805, -2294,  1062,
+    -5086,  1326,  3014,  3201,  2319, -1170,   955,   790,
+      140,  1853, -4611,  -726,  2768, -1635,  1177,  4255,
+       81,  3091, -1000,  4320, -2963, -4896,  3051, -2366,
+     5179, -3694, -3707,  1759,  3382,  -355,  2548,  4231,
+     5542,   145, -3637, -3459, -4890, -5911,  3932, -2731,
+    -3284,  2881, -2089,  5092,   729,  3241,  3289,  2013,
+     1260,  4388, -4632,  5755,   334, -2426, -1696,  1428,
+    -3296, -3949, -2396,  4452,  4354,  -130,  2837, -5374,
+    -5067, -2197,  2476,   118,  3748,  -953,  5767,  -827,
+        9, -1022, -2842,   480, -5791,  -544,   339,  2468,
+     1673, -4278, -5331, -4989,  3584, -4177, -2525, -1381,
+    -4284, -5088,  1002,  5011,  3780,   875, -1607,  4976,
+     2437, -3646,  6022,  2987,  2187, -2566, -2422,  6039,
+     3248,  1207,  1168,  5277, -2143, -1065, -4645,   404,
+     4337,   435,  1378,  1912, -2381, -5444,  -493,  4096,
+     4143,  4714, -1537,  -242,  5019,  -545, -3704, -2678,
+       27, -3066,  3763,  1440, -5084, -1632,  1017, -4885,
+     2401,   442,  5101,  1067,   773,  -390, -3778, -3833,
+    -2912,  5698, -4861,   354, -1045, -2859,  5012, -2481,
+    -5191, -3136,  3400, -2399,   243, -3016, -3000,   671,
+      420,  5559, -1544, -2178, -3985, -4905,  3531,   476,
+    -2249, -4048,  2884, -1153, -1630,  2126,  5407,  3186,
+    -2969,  3978, -3247, -2686, -5332, -3510,  2865,  2370,
+        3, -4437,  3149,   160,  2166,  3915,   113,  4919,
+     4654, -1426, -1777, -1663,  5291,  2704, -4938,  3636,
+    -1689,  3364, -3271, -4057, -2847, -4414, -2174, -4372,
+    -2645,  4053,  5042,  2305, -4895,  1484,  2780,  5195,
+     3762,  2919,  4077,  4016,   295,  6099, -5766,  -652,
+    -1159,  5990, -4049,  3728, -1146,  -948,  1404,   325,
+    -4298,  3329,  2692,   168,  5961, -5106,  1962, -1594,
+     1200, -5184,  6122,  2555, -6119,  5297, -3956,  1360,
+    -6065,  -835,  3570,  4240, -4046,  -709, -3150,  1319,
+      441,  -922, -4079, -1058, -1112, -2078,  4322, -1958,
+    -1747,  3123,  5486, -3054,  4433,  5919,  3834, -5257,
+    -2503,  2948, -1566,  5782,  -683,  2459,   -64, -3656,
+     5333,  2031,  2281,  5876,  3969,  3991,   156,  2767,
+    -5429,  4774, -4737,  1293,   453,  5908, -3772,  -418,
+    -3963,  -576,  6142, -2447,  2051,  1954, -1805,  2882,
+    -3434,  3529,   218, -2908,  3030,  4115, -2361,  1843,
+       49,  1263, -5915, -1483, -1489,  2500,  5942, -1583,
+    -1815,  5383,  -350,  1512,  4493,  3202,  5369, -2057,
+    -3009,  1693,  -174,  -723,  2655,  5735, -2738, -5868,
+     1858,  4754,   426, -3315,  1975,  3757,   347,  2925,
+    -5529,  5206, -3199,    56,  1987, -1702,   654,  3565,
+      400, -1728,  6137,  4948, -6136,  5862, -5415, -3643,
+     3710,  6093, -5446,  5339,  -382,  -316,   468, -3988,
+    -3998,  2033, -1922,  3879,  1359,  5435,   973, -1254,
+     3514,  1041,  5925, -1018,  5574,  1973,  1278,  2344,
+     3262,  5079,  -522, -2169, -4324,  4916,  4075, -5315,
+      147,  3789, -5456, -4449, -4467, -4789,  5537, -4749,
+    -5445,  3860, -1050,  4536,  1190, -2683,  3818,  6118,
+    -1321,  -192, -2049, -4912,  4780, -3445, -4698,  5057,
+    -5241, -2920,  4169,  3127,  1010,  5468,  -787, -3482,
+    -5906, -2505, -1579,   431,   151, -2127,  2839,  3957,
+     1323, -2766,    52, -3174, -3336,  6055,   677, -5874,
+    -1003, -3532,   -58,  -241,   885,  6008, -5009, -1956,
+    -3477,  5681,   142, -1105, -3438, -2844,  4212,   975,
+     -605, -2302, -4213,   504,  5594, -3029,  5886, -4782,
+     3600, -3263,  6077, -4624, -6068,  3602,   421,  4080,
+     5078, -1783,  4974,  4565,  4194,  3019,  2840,  2478,
+     4518,  3094, -1160, -4820,  5411, -2730, -1868, -2253,
+     4423, -3869,  1530, -1694, -1734, -3815, -1350,  5832,
+      189,  3116,  1763, -2209,  1279,   865, -5170,  2672,
+    -5410,  1251, -5275, -1790,  1882,  6125,  1040, -2035,
+     4770,  -944,  5287, -3669,  3020, -5673, -4665,  5406,
+    -1842, -3840, -4113,    72, -2712,  4834,  4352,  2828,
+     5781,  3045, -2643,  1095, -4378, -1241, -3451,  4094,
+      502, -5118,  2602, -1901,  6063,  3793, -1573,  3846,
+      466, -1030,  1681, -3821,  4649,  5969, -2929, -6026,
+       21,  5808, -2535,  1120,  2873,  2827,   791, -2434,
+    -4289,  2307,  -150,   648,   170, -5650,  2301,   874,
+      530,  2626,  -778, -4504,  1701,  3466,  3578,  4697,
+     2940,  2046,  1481, -2957, -3317,  2532,   139,  3332,
+    -3454, -3758, -4390,  4218,   879,  2593,   982, -2276,
+     3795,  3268,  1849,  5776,  -457,     8, -4523,  4301,
+    -2622, -5386,   510, -4661,  -578, -5368,  -450,  1944,
+       63,  5135,  4684,  3360, -3670, -3808,  2373,  4987,
+     1506, -3065, -4483, -5703,  5900,  -910, -4719,  -751,
+     1398, -3090,  5043,   826,  1658,  5618,  3502, -5789,
+     -614, -1280, -1371,    24,  -904, -2485,  5547,  5039,
+     1927,  1015,  -881,   365,  2637, -4510,  2946,  5461,
+     1590, -4411, -2334, -1223,  5103, -1891, -1555,  1802,
+    -3469,  6138,  4443,  3418,  2338, -4693,   417, -2293,
+        7,  1936,  -845, -3723,  5054, -3154,  4360,  3285,
+    -5526,   769,   -50,   216,  4153,  2213,   767, -3805,
+    -3941,  3753, -3536, -5370,  5646,  6086,  3120, -6105,
+     2021, -2832,  3572,  1282, -3229, -4730, -1706,  3929,
+     2945, -5349,  2633,  1406,   293, -3232, -3769, -4855,
+     1265, -3007, -3480, -2171,  3944,  4099, -5604,  5530,
+      980,   682,  4590, -5082, -5202,   844, -4050,  5207,
+      567, -2941,  5289,  5662,  3837,  2595, -3221, -4273,
+    -5959,  2148, -3959,  5797, -1248,  2442,  4939, -5115,
+     1029,  1945, -1325,  5724,  5598,  3344,  1892,  3624,
+       20, -5002,  4608,  5163,  2151,  1522, -3343,  4119,
+    -1744, -1314, -3654, -2894, -5690, -2455,  3947,  -338,
+    -1836,  -425,  2185,   392,  1620,   375,  4578,   377,
+     2800,   193,  6092, -2231, -6085,  4167, -1038,  -923,
+     1392,  5784, -1255,   506, -2674, -2212,  3276, -3338,
+    -3408,  1942, -1165,  2575, -2776,  1178, -5478,  3511,
+    -3982,  2947, -5609,   636,   622,  1737,  5672,  4499,
+    -4235, -3825, -4913,  3528,  2291,  3375,  4335,  3393,
+     5268,  -146,  -406, -1687, -6094,  5189,  1804, -1403,
+      239,  2900,   994,  4554,   512,  4670,  4906, -5464,
+     3042, -1344, -2054,  2483, -3407,   463,  3981, -1468,
+      180,  4138,  4605, -2689, -5219,  1409, -5509,   204,
+    -4475, -5246,  1236,  3017,  1057, -2600, -4705,  3121,
+    -3028,  5216,   364,  2360,  1226,  5518,  4739, -4251,
+     4103,  2429,  1536,  1721,   717, -3589,  2982,  1373,
+     3515,  -438, -1218, -5061, -5993,  3278,  5412, -4209,
+      343, -3448, -4538,  1908,  1866,  5211,  4727,  1208,
+     -416,   814, -2450, -1705, -5416, -2164,   716, -2110,
+      464,  1928,  3678,  4265,  3205,  3359,  1092, -5209,
+    -1136, -3449,  3708, -3238,  3171,  4489, -1826, -2926,
+    -3163, -4032,  6127, -4840,  2068,  1389,  -346, -4404,
+      540,   125,  1526,  4222, -3368,  4227, -4238,   612,
+     1756, -4145,  3961,  3534,  2065,  5826, -3495, -4564,
+     4176,  5063, -3765,  1518,  4267,  5653, -2461,  2275,
+    -5508, -1275, -5734,  1176,  4860,  1125,  1445,  1131,
+    -3889,   579,  5987,  5596, -5966,   212, -3114, -2769,
+    -5588, -5845,   412,  5102, -3744, -4963,  2528, -3056,
+     3087,  5835, -3975,  4883,  4505, -2257,  5676, -1417,
+       60, -2717,  1535,  3200, -5836,  4566,  2260,    68,
+    -5232, -3942,  1327,  3607, -4781,  4924,  -448, -1014,
+    // Barrett companions
+         0,  -3944,  13722, -10780,   1925,   3480,  11023,  15295,
+     -6786,   9655,   9343,   9445,  15625,  -8519,  -4389,   3232,
+     -1501,  -7933,   8015,   7317,  -2530,   6999, -12855,   7037,
+    -13274,   3602,  15404,  -8874, -15273,  12242,  13394,  15540,
+    -12922,   7325,  -8359,   9898,   9474,  12812,  -6117,   2832,
+    -13562,   3536,   8037,   8535,   6183,  -3120,   2546,   2106,
+       373,   4941, -12295,  -1936,   7381,  -4360,   3138,  11346,
+       216,   8242,  -2666,  11519,  -7901, -13055,   8135,  -6309,
+     13810,  -9850,  -9885,   4690,   9018,   -947,   6794,  11282,
+     14777,    387,  -9698,  -9223, -13039, -15761,  10484,  -7282,
+     -8757,   7682,  -5570,  13578,   1944,   8642,   8770,   5368,
+      3360,  11700, -12351,  15345,    891,  -6469,  -4522,   3808,
+     -8789, -10530,  -6389,  11871,  11610,   -347,   7565, -14330,
+    -13511,  -5858,   6602,    315,   9994,  -2541,  15377,  -2205,
+        24,  -2725,  -7578,   1280, -15441,  -1451,    904,   6581,
+      4461, -11407, -14215, -13303,   9557, -11138,  -6733,  -3682,
+    -11423, -13567,   2672,  13362,  10079,   2333,  -4285,  13268,
+      6498,  -9722,  16057,   7965,   5832,  -6842,  -6458,  16103,
+      8661,   3218,   3114,  14071,  -5714,  -2840, -12386,   1077,
+     11564,   1160,   3674,   5098,  -6349, -14516,  -1315,  10922,
+     11047,  12570,  -4098,   -645,  13383,  -1453,  -9877,  -7141,
+        72,  -8175,  10034,   3840, -13556,  -4352,   2712, -13026,
+      6402,   1179,  13602,   2845,   2061,  -1040, -10074, -10221,
+     -7765,  15193, -12962,    944,  -2786,  -7623,  13364,  -6615,
+    -13842,  -8362,   9066,  -6397,    648,  -8042,  -7999,   1789,
+      1120,  14823,  -4117,  -5808, -10626, -13079,   9415,   1269,
+     -5997, -10794,   7690,  -3074,  -4346,   5669,  14417,   8495,
+     -7917,  10607,  -8658,  -7162, -14218,  -9359,   7639,   6319,
+         8, -11831,   8397,    427,   5776,  10439,    301,  13116,
+     12410,  -3802,  -4738,  -4434,  14108,   7210, -13167,   9695,
+     -4504,   8970,  -8722, -10818,  -7591, -11770,  -5797, -11658,
+     -7053,  10807,  13444,   6146, -13052,   3957,   7413,  13852,
+     10031,   7783,  10871,  10708,    787,  16263, -15375,  -1739,
+     -3090,  15972, -10796,   9941,  -3056,  -2528,   3744,    867,
+    -11460,   8877,   7178,    448,  15895, -13615,   5232,  -4250,
+      3200, -13823,  16324,   6813, -16316,  14124, -10548,   3626,
+    -16172,  -2226,   9519,  11306, -10788,  -1891,  -8399,   3517,
+      1176,  -2458, -10876,  -2821,  -2965,  -5541,  11524,  -5221,
+     -4658,   8327,  14628,  -8143,  11820,  15783,  10223, -14018,
+     -6674,   7861,  -4176,  15417,  -1821,   6557,   -171,  -9749,
+     14220,   5416,   6082,  15668,  10583,  10642,    416,   7378,
+    -14476,  12730, -12631,   3448,   1208,  15753, -10058,  -1115,
+    -10567,  -1536,  16377,  -6525,   5469,   5210,  -4813,   7685,
+     -9157,   9410,    581,  -7754,   8079,  10972,  -6295,   4914,
+       131,   3368, -15772,  -3954,  -3970,   6666,  15844,  -4221,
+     -4840,  14353,   -933,   4032,  11980,   8538,  14316,  -5485,
+     -8023,   4514,   -464,  -1928,   7079,  15292,  -7301, -15647,
+      4954,  12676,   1136,  -8839,   5266,  10018,    925,   7799,
+    -14743,  13882,  -8530,    149,   5298,  -4538,   1744,   9506,
+      1067,  -4608,  16364,  13194, -16361,  15631, -14439,  -9714,
+      9893,  16247, -14521,  14236,  -1019,   -843,   1248, -10634,
+    -10660,   5421,  -5125,  10343,   3624,  14492,   2594,  -3344,
+      9370,   2776,  15799,  -2714,  14863,   5261,   3408,   6250,
+      8698,  13543,  -1392,  -5784, -11530,  13108,  10866, -14172,
+       392,  10103, -14548, -11863, -11911, -12770,  14764, -12663,
+    -14519,  10292,  -2800,  12095,   3173,  -7154,  10181,  16313,
+     -3522,   -512,  -5464, -13098,  12746,  -9186, -12527,  13484,
+    -13975,  -7786,  11116,   8338,   2693,  14580,  -2098,  -9285,
+    -15748,  -6679,  -4210,   1149,    403,  -5672,   7570,  10551,
+      3528,  -7375,    139,  -8463,  -8895,  16145,   1805, -15663,
+     -2674,  -9418,   -155,   -643,   2360,  16020, -13356,  -5216,
+     -9271,  15148,    379,  -2946,  -9167,  -7583,  11231,   2600,
+     -1613,  -6138, -11234,   1344,  14916,  -8077,  15695, -12751,
+      9599,  -8701,  16204, -12330, -16180,   9605,   1123,  10879,
+     13540,  -4754,  13263,  12172,  11183,   8050,   7573,   6607,
+     12047,   8250,  -3093, -12852,  14428,  -7279,  -4981,  -6008,
+     11794, -10316,   4080,  -4517,  -4624, -10173,  -3600,  15551,
+       504,   8309,   4701,  -5890,   3410,   2306, -13786,   7125,
+    -14425,   3336, -14066,  -4773,   5018,  16332,   2773,  -5426,
+     12719,  -2517,  14098,  -9783,   8053, -15127, -12439,  14415,
+     -4912, -10239, -10967,    192,  -7231,  12890,  11604,   7541,
+     15415,   8119,  -7047,   2920, -11674,  -3309,  -9202,  10916,
+      1339, -13647,   6938,  -5069,  16167,  10114,  -4194,  10255,
+      1243,  -2746,   4482, -10189,  12396,  15916,  -7810, -16068,
+        56,  15487,  -6759,   2986,   7661,   7538,   2109,  -6490,
+    -11436,   6151,   -400,   1728,    453, -15065,   6136,   2330,
+      1413,   7002,  -2074, -12010,   4536,   9242,   9541,  12524,
+      7839,   5456,   3949,  -7885,  -8845,   6751,    371,   8885,
+     -9210, -10021, -11706,  11247,   2344,   6914,   2618,  -6069,
+     10119,   8714,   4930,  15401,  -1219,     21, -12060,  11468,
+     -6991, -14361,   1360, -12428,  -1541, -14314,  -1200,   5184,
+       168,  13692,  12490,   8959,  -9786, -10154,   6327,  13298,
+      4016,  -8173, -11954, -15207,  15732,  -2426, -12583,  -2003,
+      3728,  -8239,  13447,   2202,   4421,  14980,   9338, -15436,
+     -1637,  -3413,  -3656,     64,  -2410,  -6626,  14791,  13436,
+      5138,   2706,  -2349,    973,   7031, -12026,   7855,  14561,
+      4240, -11762,  -6223,  -3261,  13607,  -5042,  -4146,   4805,
+     -9250,  16367,  11847,   9114,   6234, -12514,   1112,  -6114,
+        19,   5162,  -2253,  -9927,  13476,  -8410,  11626,   8759,
+    -14735,   2050,   -133,    576,  11074,   5901,   2045, -10146,
+    -10508,  10007,  -9429, -14319,  15055,  16228,   8319, -16279,
+      5389,  -7551,   9525,   3418,  -8610, -12612,  -4549,  10476,
+      7853, -14263,   7021,   3749,    781,  -8618, -10050, -12946,
+      3373,  -8018,  -9279,  -5789,  10516,  10930, -14943,  14745,
+      2613,   1819,  12239, -13551, -13871,   2250, -10799,  13884,
+      1512,  -7842,  14103,  15097,  10231,   6919,  -8589, -11394,
+    -15889,   5728, -10556,  15457,  -3328,   6511,  13170, -13639,
+      2744,   5186,  -3533,  15263,  14927,   8917,   5045,   9663,
+        53, -13338,  12287,  13767,   5736,   4058,  -8914,  10983,
+     -4650,  -3504,  -9743,  -7717, -15172,  -6546,  10524,   -901,
+     -4896,  -1133,   5826,   1045,   4320,   1000,  12207,   1005,
+      7466,    515,  16244,  -5949, -16225,  11111,  -2768,  -2461,
+      3712,  15423,  -3346,   1349,  -7130,  -5898,   8735,  -8901,
+     -9087,   5178,  -3106,   6866,  -7402,   3141, -14607,   9362,
+    -10618,   7858, -14956,   1696,   1659,   4632,  15124,  11996,
+    -11292, -10199, -13100,   9407,   6109,   8999,  11559,   9047,
+     14047,   -389,  -1083,  -4498, -16249,  13836,   4810,  -3741,
+       637,   7733,   2650,  12143,   1365,  12452,  13082, -14569,
+      8111,  -3584,  -5477,   6621,  -9085,   1235,  10615,  -3914,
+       480,  11034,  12279,  -7170, -13916,   3757, -14689,    544,
+    -11932, -13988,   3296,   8045,   2818,  -6933, -12546,   8322,
+     -8074,  13908,    971,   6293,   3269,  14713,  12636, -11335,
+     10940,   6477,   4096,   4589,   1912,  -9570,   7951,   3661,
+      9373,  -1168,  -3248, -13495, -15980,   8741,  14431, -11223,
+       915,  -9194, -12100,   5088,   4976,  13895,  12604,   3221,
+     -1109,   2170,  -6533,  -4546, -14441,  -5770,   1909,  -5626,
+      1237,   5141,   9807,  11372,   8546,   8957,   2912, -13890,
+     -3029,  -9197,   9887,  -8634,   8455,  11970,  -4869,  -7802,
+     -8434, -10751,  16337, -12906,   5514,   3704,   -923, -11743,
+      1440,    333,   4069,  11258,  -8981,  11271, -11300,   1632,
+      4682, -11052,  10562,   9423,   5506,  15535,  -9319, -12170,
+     11135,  13500, -10039,   4048,  11378,  15073,  -6562,   6066,
+    -14687,  -3400, -15289,   3136,  12959,   3000,   3853,   3016,
+    -10370,   1544,  15964,  14921, -15908,    565,  -8303,  -7383,
+    -14900, -15585,   1099,  13604,  -9983, -13234,   6741,  -8149,
+      8231,  15559, -10599,  13020,  12012,  -6018,  15135,  -3778,
+       160,  -7245,   4093,   8533, -15561,  12175,   6026,    181,
+    -13951, -10511,   3538,   9618, -12748,  13130,  -1195,  -2704,
+};
+
@@ -0,0 +1,47 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - n = 1024
+ * - psi = 1014
+ * - omega = psi^2 = 8209
+ * - inverse of psi = 5078
+ * - inverse of omega = 3762
+ * - inverse of n = 12277
+ */
+
+#ifndef __NTT_SHORT1024_TABLES_H
+#define __NTT_SHORT1024_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int16_t ntt_short1024_psi = 1014;
+static const int16_t ntt_short1024_omega = -4080;
+static const int16_t ntt_short1024_inv_psi = 5078;
+static const int16_t ntt_short1024_inv_omega = 3762;
+static const int16_t ntt_short1024_inv_n = -12;
+static const int16_t ntt_short1024_rescale = 64;
+static const int16_t ntt_short1024_rescale_bar = 171;
+static const int16_t ntt_short1024_qinv = -12287;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_short1024_psi_powers[2048];
+extern const int16_t ntt_short1024_scaled_inv_psi_powers[2048];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_short1024_omega_powers[2048];
+extern const int16_t ntt_short1024_omega_powers_rev[2048];
+extern const int16_t ntt_short1024_inv_omega_powers[2048];
+extern const int16_t ntt_short1024_inv_omega_powers_rev[2048];
+extern const int16_t ntt_short1024_mixed_powers[2048];
+extern const int16_t ntt_short1024_mixed_powers_rev[2048];
+extern const int16_t ntt_short1024_inv_mixed_powers[2048];
+extern const int16_t ntt_short1024_inv_mixed_powers_rev[2048];
+
+#endif /* __NTT_SHORT1024_TABLES_H */
@@ -0,0 +1,105 @@
+/*
+ * BD: NTT with 16-bit coefficients
+ *
+ * All variants are specialized to Q=12289.
+ * - omega denotes a primitive n-th root of unity (mod Q).
+ * - psi denotes a square root of omega (mod Q).
+ *
+ * Assembly implementation of the functions in ntt_short.h, using
+ * AVX2 instructions on 16 coefficients at a time. The results are
+ * identical to the C functions.
+ *
+ * Tables of constants are generated by make_short_tables: they
+ * have 2n elements, the constants followed by their Barrett companions.
+ */
+
+#ifndef __NTT_SHORT_ASM_H
+#define __NTT_SHORT_ASM_H
+
+#include <stdint.h>
+
+
+/****************
+ *  REDUCTIONS  *
+ ***************/
+
+/*
+ * Reduce all elements of array a: a'[i] = red(a[i])
+ * - n must be positive and a multiple of 32
+ * - the result is in [-6145, 6145]
+ */
+extern void short_reduce_array_asm(int16_t *a, uint32_t n);
+
+/*
+ * Barrett multiplication by the constants in p:
+ *   a'[i] = mul_bar(a[i], p[i], p[n + i])
+ * - n must be positive and a multiple of 16
+ */
+extern void short_mul_array16_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * Montgomery product: c[i] = mul_mont(a[i], b[i]) == a[i] * b[i] * 2^-16
+ * - n must be positive and a multiple of 32
+ */
+extern void short_mul_array_asm(int16_t *c, uint32_t n, const int16_t *a, const int16_t *b);
+
+/*
+ * Final step of the product functions: Barrett multiplication by
+ * a constant then conversion to [0, Q-1].
+ * - short_mul_finalize_asm(a, n, p): a[i] = correct(mul_bar(a[i], p[i], p[n + i]))
+ * - short_scalar_mul_finalize_asm(a, n, c, c_bar): a[i] = correct(mul_bar(a[i], c, c_bar))
+ * - n must be positive and a multiple of 16
+ * - the input must satisfy -24577 <= a[i] <= 24577.
+ */
+extern void short_mul_finalize_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void short_scalar_mul_finalize_asm(int16_t *a, uint32_t n, int16_t c, int16_t c_bar);
+
+
+/****************
+ * NTT VARIANTS *
+ ***************/
+
+/*
+ * All variants require n to be a power of two and n >= 32.
+ *
+ * Input/output and bounds are as in ntt_short.h:
+ * - Cooley-Tukey variants: input in [-12289, 12289], output in [-13442, 13442]
+ * - Gentleman-Sande variants: input in [-16383, 16383], output in [-12288, 12288]
+ *
+ * The plain and combined versions are the same function: they
+ * differ only by the table p.
+ */
+
+/*
+ * COOLEY-TUKEY: BIT-REVERSE TO STANDARD ORDER
+ * - p[t + j] = omega^(n/2t)^j
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^j for mulntt
+ */
+extern void ntt_short_ct_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_short_ct_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * COOLEY-TUKEY: STANDARD TO BIT-REVERSE ORDER
+ * - p[t + j] = omega^(n/2t)^bitrev(j)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) for mulntt
+ */
+extern void ntt_short_ct_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_short_ct_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: BIT-REVERSE TO STANDARD ORDER
+ * - p[t + j] = omega^(n/2t)^bitrev(j)
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j) for nttmul
+ */
+extern void ntt_short_gs_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_short_gs_rev2std_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+/*
+ * GENTLEMAN-SANDE: STANDARD TO BIT-REVERSE ORDER
+ * - p[t + j] = omega^(n/2t)^j
+ *   or p[t + j] = psi^(n/2t) * omega^(n/2t)^j for nttmul
+ */
+extern void ntt_short_gs_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_short_gs_std2rev_asm(int16_t *a, uint32_t n, const int16_t *p);
+
+#endif /* __NTT_SHORT_ASM_H */
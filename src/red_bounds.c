@@ -1,28 +1,58 @@
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <inttypes.h>
 
 #include "red_bounds.h"
 
 /*
- * 12289 is 3 * 2^12 + 1
- * MASK = 2^12 - 1
+ * Reduction parameters: q = k * 2^m + 1 and mask = 2^m - 1
  */
-#define Q 12289
-#define K 3
-#define MASK 4095
+const red_param_t red_param_12289 = { 12289, 3, 12, 4095 };
 
+bool red_param_init(red_param_t *rp, int64_t q) {
+  int64_t k, m;
 
-static int64_t red(int64_t x) {
-  return (3 * (x & 4095)) - (x >> 12);
+  if (q < 3 || q >= ((int64_t) 1 << 31) || (q & 1) == 0) return false;
+
+  k = q - 1;
+  m = 0;
+  while ((k & 1) == 0) {
+    k >>= 1;
+    m ++;
+  }
+  rp->q = q;
+  rp->k = k;
+  rp->m = m;
+  rp->mask = ((int64_t) 1 << m) - 1;
+
+  return true;
+}
+
+/*
+ * (z >> m) must not overflow and red(z) must be in [-2^31, 2^31 - 1]
+ * for |z| <= max_mul_red(): this holds if (z >> m) is between
+ * -(2^31 - 1 - k * mask) and +(2^31 - 1 - k * mask).
+ */
+int64_t max_mul_red_q(const red_param_t *rp) {
+  return (INT32_MAX - rp->k * rp->mask) << rp->m;
+}
+
+int64_t max_mul_red(void) {
+  return max_mul_red_q(&red_param_12289);
+}
+
+
+static int64_t red(const red_param_t *rp, int64_t x) {
+  return (rp->k * (x & rp->mask)) - (x >> rp->m);
 }
 
-static int64_t divd(int64_t x) {
-  return x >> 12;
+static int64_t divd(const red_param_t *rp, int64_t x) {
+  return x >> rp->m;
 }
 
-static int64_t remd(int64_t x) {
-  return x & 4095;
+static int64_t remd(const red_param_t *rp, int64_t x) {
+  return x & rp->mask;
 }
 
 
@@ -34,34 +64,42 @@ static int64_t remd(int64_t x) {
  * Maximum of red(x) for a <= x <= b
  * - red(x) is returned, x is stored in *m
  */
-int64_t max_red(int64_t a, int64_t b, int64_t *m) {
+int64_t max_red_q(const red_param_t *rp, int64_t a, int64_t b, int64_t *m) {
   int64_t d, r;
   
   assert(a <= b);
 
-  d = a | 4095;
+  d = a | rp->mask;
   d = (d <= b) ? d : b;
-  r = red(d);
+  r = red(rp, d);
   *m = d;
 
   return r;
 }
 
+int64_t max_red(int64_t a, int64_t b, int64_t *m) {
+  return max_red_q(&red_param_12289, a, b, m);
+}
+
 /*
  * Minimum of red(x) for a <= x <= b
  */
-int64_t min_red(int64_t a, int64_t b, int64_t *m) {
+int64_t min_red_q(const red_param_t *rp, int64_t a, int64_t b, int64_t *m) {
   int64_t d, r;
 
   assert(a <= b);
 
-  d = b & ~4095;
+  d = b & ~rp->mask;
   d = (d >= a) ? d : a;
-  r = red(d);
+  r = red(rp, d);
   *m = d;
   return r;
 }
 
+int64_t min_red(int64_t a, int64_t b, int64_t *m) {
+  return min_red_q(&red_param_12289, a, b, m);
+}
+
 
 
 /*
@@ -69,9 +107,9 @@ int64_t min_red(int64_t a, int64_t b, int64_t *m) {
  */
 
 /*
- * GCD of w and 4096
+ * GCD of w and 2^m
  */
-static int64_t gcd4096(int64_t w) {
+static int64_t gcd_pow2(const red_param_t *rp, int64_t w) {
   int64_t g;
 
   g = 1;
@@ -80,20 +118,20 @@ static int64_t gcd4096(int64_t w) {
     w >>= 1;
   }
   // g is the largest power of two that divides w
-  return (g < 4096) ? g : 4096;
+  return (g <= rp->mask) ? g : rp->mask + 1;
 }
 
 /*
- * Largest y such that (w x)>>12 == (w y)>>12 are equal.
+ * Largest y such that (w x)>>m == (w y)>>m are equal.
  * So, for any z such that x <= z <= y, we have red(w y) >= red(w z).
  */
-static int64_t lmax(int64_t w, int64_t x) {
+static int64_t lmax(const red_param_t *rp, int64_t w, int64_t x) {
   int64_t y, k;
 
-  k = (4095 - ((w * x) & 4095))/w;  // floor((4096 - 1 - r0)/w) where r0 = (w * x) & 4095
+  k = (rp->mask - remd(rp, w * x))/w;  // floor((2^m - 1 - r0)/w) where r0 = (w * x) & mask
   y =  x + k;
-  assert((w * y) >> 12 == (w * x) >> 12);
-  assert((w * (y+1)) >> 12 > (w * x) >> 12);
+  assert(divd(rp, w * y) == divd(rp, w * x));
+  assert(divd(rp, w * (y+1)) > divd(rp, w * x));
 
   return y;
 }
@@ -102,7 +140,7 @@ static int64_t lmax(int64_t w, int64_t x) {
 /*
  * Maximum of red(w x) for a <= x <= b
  */
-int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
+int64_t max_red_mul_q(const red_param_t *rp, int64_t a, int64_t b, int64_t w, int64_t *m) {
   int64_t pw, g, h, x, r, x_max, r_max;
   
   assert(a <= b);
@@ -116,23 +154,23 @@ int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
   }
 
   x_max = b;
-  r_max = red(pw * b);
+  r_max = red(rp, pw * b);
 
-  // The remainder of (w * x) by 4096 is a multiple of gcd(4096, w)
-  // so it's at most h = 4096 - gcd(4096, w).
+  // The remainder of (w * x) by 2^m is a multiple of gcd(2^m, w)
+  // so it's at most h = 2^m - gcd(2^m, w).
   // We then have red(w * x) <= - divd(w * x) + g,
-  h = 4096 - gcd4096(w);
-  g = 3 * h;
+  h = rp->mask + 1 - gcd_pow2(rp, pw);
+  g = rp->k * h;
 
   x = a;
   for (;;) {
-    x = lmax(pw, x);
-    if (x >= b || - divd(pw * x) + g <= r_max) break;
-    r = red(pw * x);
+    x = lmax(rp, pw, x);
+    if (x >= b || - divd(rp, pw * x) + g <= r_max) break;
+    r = red(rp, pw * x);
     if (r > r_max) {
       x_max = x;
       r_max = r;
-      if (remd(pw * x) == h) {
+      if (remd(rp, pw * x) == h) {
 	// this is the largest possible remainder
 	// so r_max >= red(pw * y) when y >= x.
 	break;
@@ -147,18 +185,22 @@ int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
   return r_max;
 }
 
+int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
+  return max_red_mul_q(&red_param_12289, a, b, w, m);
+}
+
 
 /*
- * Smallest y such that (w x) >> 12 == (w y) >> 12.
+ * Smallest y such that (w x) >> m == (w y) >> m.
  * For any z such that y <= z <= x, we have red(w y) <= red(w z).
  */
-static int64_t lmin(int64_t w, int64_t x) {
+static int64_t lmin(const red_param_t *rp, int64_t w, int64_t x) {
   int64_t y, k;
 
-  k = ((w * x) & 4095)/w;
+  k = remd(rp, w * x)/w;
   y = x - k;
-  assert((w * y) >> 12 == (w * x) >> 12);
-  assert((w * (y - 1)) >> 12 < (w * x) >> 12);
+  assert(divd(rp, w * y) == divd(rp, w * x));
+  assert(divd(rp, w * (y - 1)) < divd(rp, w * x));
 
   return y;
 }
@@ -166,7 +208,7 @@ static int64_t lmin(int64_t w, int64_t x) {
 /*
  * Minimum of red(w*x) for a <= x <= b
  */
-int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
+int64_t min_red_mul_q(const red_param_t *rp, int64_t a, int64_t b, int64_t w, int64_t *m) {
   int64_t pw, x, r, x_min, r_min;
   
   assert(a <= b);
@@ -180,17 +222,17 @@ int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
   }
 
   x_min = a;
-  r_min = red(pw * a);
+  r_min = red(rp, pw * a);
 
   x = b;
   for (;;) {
-    x = lmin(pw, x);
-    if (x <= a || -divd(pw * x) >= r_min) break;
-    r = red(pw * x);
+    x = lmin(rp, pw, x);
+    if (x <= a || -divd(rp, pw * x) >= r_min) break;
+    r = red(rp, pw * x);
     if (r < r_min) {
       x_min = x;
       r_min = r;
-      if (remd(pw * x) == 0) {	
+      if (remd(rp, pw * x) == 0) {	
 	break;
       }
     }
@@ -203,12 +245,16 @@ int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
   return r_min;
 }
 
+int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
+  return min_red_mul_q(&red_param_12289, a, b, w, m);
+}
+
 
 
 /*
  * Maximum of red(w * x) for a <= x <= b and low <= w <= high.
  */
-int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *mw) {
+int64_t max_red_mul_interval_q(const red_param_t *rp, int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *mw) {
   int64_t r_max, x_max, w_max, r, x, w, d, l, h;
 
   assert(a <= b && low <= high);
@@ -224,13 +270,13 @@ int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
     assert(w < 0);
 
     // d = min (w*x)/2^m for |x| <= b
-    // so red(w*x) <= -d + 3*4095 for |x| <= b
+    // so red(w*x) <= -d + k*mask for |x| <= b
     // also for any w' such that w <= w' < 0
-    d = divd(w * b);
-    if ( -d + 3 * 4095 <= r_max) {
+    d = divd(rp, w * b);
+    if ( -d + rp->k * rp->mask <= r_max) {
       break;
     }
-    r = max_red_mul(a, b, w, &x);
+    r = max_red_mul_q(rp, a, b, w, &x);
     if (r > r_max) {
       r_max = r;
       x_max = x;
@@ -245,11 +291,11 @@ int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
     assert(w > 0);
 
     // min of (w*x)/2^m is -(w * b)/2^m
-    d = divd(- w * b);
-    if ( -d + 3 * 4095 <= r_max) {
+    d = divd(rp, - w * b);
+    if ( -d + rp->k * rp->mask <= r_max) {
       break;
     }
-    r = max_red_mul(a, b, w, &x);
+    r = max_red_mul_q(rp, a, b, w, &x);
     if (r > r_max) {
       r_max = r;
       x_max = x;
@@ -263,10 +309,14 @@ int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
   return r_max;
 }
 
+int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *mw) {
+  return max_red_mul_interval_q(&red_param_12289, a, b, low, high, m, mw);
+}
+
  /*
   * Minimum of red(x * w) for a <= x <= b and low <= w <= high
   */
-int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *wm) {
+int64_t min_red_mul_interval_q(const red_param_t *rp, int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *wm) {
    int64_t r_min, x_min, w_min, r, x, w, d, l, h;
 
    assert(a <= b && low <= high);
@@ -283,11 +333,11 @@ int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
      // d = max of (w * b)/2^m
      // -b <= x ==> w * x <= -b w ==> divd(w * x) <= divd(-w * b) ==> - div(w * x) >= - d
      // ==> red(wx) >= -d
-     d = divd(- w * b);
+     d = divd(rp, - w * b);
      if (-d >= r_min) {
        break;
      }
-     r = min_red_mul(a, b, w, &x);
+     r = min_red_mul_q(rp, a, b, w, &x);
      if (r < r_min) {
        r_min = r;
        x_min = x;
@@ -301,11 +351,11 @@ int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
    for (w=h; w>l; w--) {
      assert(w > 0);
 
-     d = divd(w * b); // max of (w * b)/2^m for |x| <= b
+     d = divd(rp, w * b); // max of (w * b)/2^m for |x| <= b
      if (-d >= r_min) {
        break;
      }
-     r = min_red_mul(a, b, w, &x);
+     r = min_red_mul_q(rp, a, b, w, &x);
      if (r < r_min) {
        r_min = r;
        x_min = x;
@@ -319,6 +369,10 @@ int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
    return r_min;
 }
 
+int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *wm) {
+  return min_red_mul_interval_q(&red_param_12289, a, b, low, high, m, wm);
+}
+
 
 /*
  * BOUND INCREASE IN NTT ALGORITHMS
@@ -377,14 +431,14 @@ int64_t gs_bound(int64_t b, int64_t low, int64_t high) {
 /*
  * Bounds after a CT step with a fixed w
  */
-int64_t ct_bound_fixed(int64_t b, int64_t w) {
+int64_t ct_bound_fixed_q(const red_param_t *rp, int64_t b, int64_t w) {
   int64_t min_r, max_r, min_y, max_y, b1, b2;
 
   assert(b >= 0);
 
   // min and max or red(w * y) for -b <= y <= b
-  min_r = min_red_mul(-b, b, w, &min_y);
-  max_r = max_red_mul(-b, b, w, &max_y);
+  min_r = min_red_mul_q(rp, -b, b, w, &min_y);
+  max_r = max_red_mul_q(rp, -b, b, w, &max_y);
 
   // we have -b + min_r <= x' <= b + max_r
   // and     -b - max_r <= y' <= b - min_r
@@ -396,18 +450,22 @@ int64_t ct_bound_fixed(int64_t b, int64_t w) {
   return (b1 < b2) ? b2 : b1;
 }
 
+int64_t ct_bound_fixed(int64_t b, int64_t w) {
+  return ct_bound_fixed_q(&red_param_12289, b, w);
+}
+
 
 /*
  * Bounds after a GS step with a fixed w
  */
-int64_t gs_bound_fixed(int64_t b, int64_t w) {
+int64_t gs_bound_fixed_q(const red_param_t *rp, int64_t b, int64_t w) {
   int64_t min_r, max_r, min_y, max_y, b1, b2;
 
   assert(b >= 0);
 
   // min and max or red(w * (x -y)) given |x - y| <= 2b
-  min_r = min_red_mul(-2*b, 2*b, w, &min_y);
-  max_r = max_red_mul(-2*b, 2*b, w, &max_y);
+  min_r = min_red_mul_q(rp, -2*b, 2*b, w, &min_y);
+  max_r = max_red_mul_q(rp, -2*b, 2*b, w, &max_y);
 
   // we have min_r <= y' <= max_r and -2b <= x <= 2b 
   // b1 = bound on |y'|, b2 = boud on |x'|
@@ -417,6 +475,10 @@ int64_t gs_bound_fixed(int64_t b, int64_t w) {
   return (b1 < b2) ? b2 : b1;
 }
 
+int64_t gs_bound_fixed(int64_t b, int64_t w) {
+  return gs_bound_fixed_q(&red_param_12289, b, w);
+}
+
 
 /*
  * Bounds after ntt computations based on Cooley Tukey
@@ -453,6 +515,50 @@ int64_t ntt_ct_bounds(int64_t b0, uint32_t n, const int16_t *p, int64_t *bound)
 }
 
 
+/*
+ * Bounds for the vpmulld variants of the Cooley-Tukey NTT:
+ * reduction after the rounds with step size d = 8, 128, 2048, ...
+ */
+int64_t ntt_ct_mulld_bounds(int64_t b0, uint32_t n, const int16_t *p, bool std2rev,
+                            int64_t *bound, int64_t *prod) {
+  uint32_t j, t, k, d;
+  int64_t b, c, e, w, v, m, x;
+
+  b = b0;
+  k = 0;
+  m = 0;
+  bound[k] = b0;
+  prod[k] = 0;
+  for (t=1; t<n; t<<=1) {
+    k ++;
+    c = ct_bound_fixed(b, p[t]);
+    w = (p[t] < 0) ? - p[t] : p[t];
+    for (j=1; j<t; j++) {
+      e = ct_bound_fixed(b, p[t + j]);
+      if (e > c) c = e;
+      v = (p[t + j] < 0) ? - p[t + j] : p[t + j];
+      if (v > w) w = v;
+    }
+    prod[k] = w * b;
+    if (prod[k] > m) m = prod[k];
+
+    d = std2rev ? n/(2 * t) : t;
+    if (d & 0x88888888) {
+      // reduction: c := max |red(x)| for -c <= x <= c
+      e = min_red(-c, c, &x);
+      v = max_red(-c, c, &x);
+      if (e < 0) e = -e;
+      if (v < 0) v = -v;
+      c = (e < v) ? v : e;
+    }
+    bound[k] = c;
+    b = c;
+  }
+
+  return m;
+}
+
+
 /*
  * Bounds after ntt computations based on Gentleman Sande
  * - b0 = bound on the input
@@ -480,3 +586,263 @@ int64_t ntt_gs_bounds(int64_t b0, uint32_t n, const int16_t *p, int64_t *bound)
 
   return b;
 }
+
+
+/*
+ * LAZY REDUCTION
+ */
+
+/*
+ * Maximum of |red(x)| for |x| <= b
+ */
+int64_t abs_red_bound_q(const red_param_t *rp, int64_t b) {
+  int64_t min, max, m;
+
+  assert(b >= 0);
+
+  min = min_red_q(rp, -b, b, &m);
+  max = max_red_q(rp, -b, b, &m);
+  if (min < 0) min = -min;
+  if (max < 0) max = -max;
+
+  return (min < max) ? max : min;
+}
+
+int64_t abs_red_bound(int64_t b) {
+  return abs_red_bound_q(&red_param_12289, b);
+}
+
+/*
+ * Maximum of |red(x * y)| for |x| <= a and |y| <= b
+ * - the interval functions enumerate the values of y so we
+ *   use the smallest interval for y.
+ */
+int64_t abs_mul_red_bound_q(const red_param_t *rp, int64_t a, int64_t b) {
+  int64_t min, max, m, w, c;
+
+  assert(a >= 0 && b >= 0);
+
+  if (b > a) {
+    c = a; a = b; b = c;
+  }
+  min = min_red_mul_interval_q(rp, -a, a, -b, b, &m, &w);
+  max = max_red_mul_interval_q(rp, -a, a, -b, b, &m, &w);
+  if (min < 0) min = -min;
+  if (max < 0) max = -max;
+
+  return (min < max) ? max : min;
+}
+
+int64_t abs_mul_red_bound(int64_t a, int64_t b) {
+  return abs_mul_red_bound_q(&red_param_12289, a, b);
+}
+
+/*
+ * Max of |p[t + j]| for j=0 ... t-1
+ */
+static int64_t max_abs_coeff(const int32_t *p, uint32_t t) {
+  uint32_t j;
+  int64_t w, v;
+
+  w = 0;
+  for (j=0; j<t; j++) {
+    v = (p[t + j] < 0) ? - (int64_t) p[t + j] : p[t + j];
+    if (v > w) w = v;
+  }
+  return w;
+}
+
+/*
+ * Bound after a CT round: max of ct_bound_fixed for j=0 ... t-1
+ */
+static int64_t ct_round_bound(const red_param_t *rp, int64_t b, const int32_t *p, uint32_t t) {
+  uint32_t j;
+  int64_t c, d;
+
+  c = ct_bound_fixed_q(rp, b, p[t]);
+  for (j=1; j<t; j++) {
+    d = ct_bound_fixed_q(rp, b, p[t + j]);
+    if (d > c) c = d;
+  }
+  return c;
+}
+
+/*
+ * Bound after a GS round
+ */
+static int64_t gs_round_bound(const red_param_t *rp, int64_t b, const int32_t *p, uint32_t t) {
+  uint32_t j;
+  int64_t c, d;
+
+  c = gs_bound_fixed_q(rp, b, p[t]);
+  for (j=1; j<t; j++) {
+    d = gs_bound_fixed_q(rp, b, p[t + j]);
+    if (d > c) c = d;
+  }
+  return c;
+}
+
+/*
+ * Copy of a 16bit table (the lazy functions work on 32bit tables)
+ */
+static int32_t *widen_table(const int16_t *p, uint32_t n) {
+  int32_t *a;
+  uint32_t i;
+
+  a = (int32_t *) malloc(n * sizeof(int32_t));
+  if (a == NULL) {
+    fprintf(stderr, "red_bounds: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i=0; i<n; i++) {
+    a[i] = p[i];
+  }
+  return a;
+}
+
+/*
+ * Bounds for the CT NTT with reductions after some rounds
+ */
+int64_t ntt_ct_lazy_bounds32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t rounds,
+                             int64_t *bound, int64_t *prod) {
+  uint32_t t, k;
+  int64_t b;
+
+  b = b0;
+  k = 0;
+  bound[k] = b0;
+  prod[k] = 0;
+  for (t=1; t<n; t<<=1) {
+    k ++;
+    prod[k] = max_abs_coeff(p, t) * b;
+    b = ct_round_bound(rp, b, p, t);
+    bound[k] = b;
+    if (rounds & ((uint32_t) 1 << k)) {
+      b = abs_red_bound_q(rp, b);
+    }
+  }
+
+  return b;
+}
+
+/*
+ * Same thing for GS: the products are w * (x - y) with |x - y| <= 2b
+ */
+int64_t ntt_gs_lazy_bounds32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t rounds,
+                             int64_t *bound, int64_t *prod) {
+  uint32_t t, k;
+  int64_t b;
+
+  b = b0;
+  k = 0;
+  bound[k] = b0;
+  prod[k] = 0;
+  for (t=n/2; t>0; t>>=1) {
+    k ++;
+    prod[k] = max_abs_coeff(p, t) * 2 * b;
+    b = gs_round_bound(rp, b, p, t);
+    bound[k] = b;
+    if (rounds & ((uint32_t) 1 << k)) {
+      b = abs_red_bound_q(rp, b);
+    }
+  }
+
+  return b;
+}
+
+/*
+ * Greedy schedules: when round k would overflow, we reduce the
+ * result of round k-1 and try again.
+ */
+int64_t ntt_ct_lazy_schedule32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t *rounds) {
+  uint32_t t, k, r;
+  int64_t b, c;
+
+  r = 0;
+  b = b0;
+  k = 0;
+  for (t=1; t<n; t<<=1) {
+    k ++;
+    c = ct_round_bound(rp, b, p, t);
+    if (c > INT32_MAX || max_abs_coeff(p, t) * b > max_mul_red_q(rp)) {
+      if (k == 1) return -1;
+      r |= (uint32_t) 1 << (k - 1);
+      b = abs_red_bound_q(rp, b);
+      c = ct_round_bound(rp, b, p, t);
+      if (c > INT32_MAX || max_abs_coeff(p, t) * b > max_mul_red_q(rp)) return -1;
+    }
+    b = c;
+  }
+  *rounds = r;
+
+  return b;
+}
+
+int64_t ntt_gs_lazy_schedule32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t *rounds) {
+  uint32_t t, k, r;
+  int64_t b, c;
+
+  r = 0;
+  b = b0;
+  k = 0;
+  for (t=n/2; t>0; t>>=1) {
+    k ++;
+    c = gs_round_bound(rp, b, p, t);
+    if (c > INT32_MAX || max_abs_coeff(p, t) * 2 * b > max_mul_red_q(rp)) {
+      if (k == 1) return -1;
+      r |= (uint32_t) 1 << (k - 1);
+      b = abs_red_bound_q(rp, b);
+      c = gs_round_bound(rp, b, p, t);
+      if (c > INT32_MAX || max_abs_coeff(p, t) * 2 * b > max_mul_red_q(rp)) return -1;
+    }
+    b = c;
+  }
+  *rounds = r;
+
+  return b;
+}
+
+/*
+ * 16bit tables
+ */
+int64_t ntt_ct_lazy_bounds(int64_t b0, uint32_t n, const int16_t *p, uint32_t rounds,
+                           int64_t *bound, int64_t *prod) {
+  int32_t *a;
+  int64_t b;
+
+  a = widen_table(p, n);
+  b = ntt_ct_lazy_bounds32(&red_param_12289, b0, n, a, rounds, bound, prod);
+  free(a);
+  return b;
+}
+
+int64_t ntt_gs_lazy_bounds(int64_t b0, uint32_t n, const int16_t *p, uint32_t rounds,
+                           int64_t *bound, int64_t *prod) {
+  int32_t *a;
+  int64_t b;
+
+  a = widen_table(p, n);
+  b = ntt_gs_lazy_bounds32(&red_param_12289, b0, n, a, rounds, bound, prod);
+  free(a);
+  return b;
+}
+
+int64_t ntt_ct_lazy_schedule(int64_t b0, uint32_t n, const int16_t *p, uint32_t *rounds) {
+  int32_t *a;
+  int64_t b;
+
+  a = widen_table(p, n);
+  b = ntt_ct_lazy_schedule32(&red_param_12289, b0, n, a, rounds);
+  free(a);
+  return b;
+}
+
+int64_t ntt_gs_lazy_schedule(int64_t b0, uint32_t n, const int16_t *p, uint32_t *rounds) {
+  int32_t *a;
+  int64_t b;
+
+  a = widen_table(p, n);
+  b = ntt_gs_lazy_schedule32(&red_param_12289, b0, n, a, rounds);
+  free(a);
+  return b;
+}
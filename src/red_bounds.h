@@ -1,32 +1,61 @@
 /*
  * Bounds on the reduction function
+ *
+ * The reduction is red(x) = k * (x & (2^m - 1)) - (x >> m) for
+ * a modulus q = k * 2^m + 1 (with k odd). The functions without
+ * a red_param_t argument are for q = 12289 (k = 3, m = 12). The
+ * _q variants take the modulus parameters explicitly.
  */
 
 #ifndef __RED_BOUNDS_H
 #define __RED_BOUNDS_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Modulus parameters: q = k * 2^m + 1 and mask = 2^m - 1
+ */
+typedef struct red_param_s {
+  int64_t q;
+  int64_t k;
+  int64_t m;
+  int64_t mask;
+} red_param_t;
+
+extern const red_param_t red_param_12289;
+
+/*
+ * Initialize *rp for modulus q: k and m are computed from q
+ * - q must be odd and between 3 and 2^31 - 1
+ * - return false if q is not valid (*rp is not changed)
+ */
+extern bool red_param_init(red_param_t *rp, int64_t q);
 
 /*
  * Maximum of red(x) for a <= x <= b
  * - red(x) is returned, x is stored in *m
  */
 extern int64_t max_red(int64_t a, int64_t b, int64_t *m);
+extern int64_t max_red_q(const red_param_t *rp, int64_t a, int64_t b, int64_t *m);
 
 /*
  * Minimum of red(x) for a <= x <= b
  */
 extern int64_t min_red(int64_t a, int64_t b, int64_t *m);
+extern int64_t min_red_q(const red_param_t *rp, int64_t a, int64_t b, int64_t *m);
 
 /*
  * Maximum of red(w x) for a <= x <= b
  */
 extern int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m);
+extern int64_t max_red_mul_q(const red_param_t *rp, int64_t a, int64_t b, int64_t w, int64_t *m);
 
 /*
  * Minimum of red(w*x) for a <= x <= b
  */
 extern int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m);
+extern int64_t min_red_mul_q(const red_param_t *rp, int64_t a, int64_t b, int64_t w, int64_t *m);
 
 /*
  * Maximum of red(w * x) for a <= x <= b and low <= w <= high.
@@ -34,11 +63,15 @@ extern int64_t min_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m);
  * *mw, respectively.
  */
 extern int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *mw);
+extern int64_t max_red_mul_interval_q(const red_param_t *rp, int64_t a, int64_t b, int64_t low, int64_t high,
+                                     int64_t *m, int64_t *mw);
 
 /*
  * Minimum of red(x * w) for a <= x <= b and low <= w <= high
  */
 extern int64_t min_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, int64_t *m, int64_t *wm);
+extern int64_t min_red_mul_interval_q(const red_param_t *rp, int64_t a, int64_t b, int64_t low, int64_t high,
+                                     int64_t *m, int64_t *wm);
 
 /*
  * Bounds after a CT step
@@ -64,6 +97,7 @@ extern int64_t gs_bound(int64_t b, int64_t low, int64_t high);
  *    |x + red(w, y)| <= b' and |x - red(w, y)| <= b'
  */
 extern int64_t ct_bound_fixed(int64_t b, int64_t w);
+extern int64_t ct_bound_fixed_q(const red_param_t *rp, int64_t b, int64_t w);
 
 /*
  * Bounds after a GS step with a fixed w
@@ -71,6 +105,7 @@ extern int64_t ct_bound_fixed(int64_t b, int64_t w);
  *    |x + y| <= b' and |(x - y) * w| <= b'
  */
 extern int64_t gs_bound_fixed(int64_t b, int64_t w);
+extern int64_t gs_bound_fixed_q(const red_param_t *rp, int64_t b, int64_t w);
 
 
 /*
@@ -97,4 +132,103 @@ extern int64_t ntt_ct_bounds(int64_t b0, uint32_t n, const int16_t *p, int64_t *
  */
 extern int64_t ntt_gs_bounds(int64_t b0, uint32_t n, const int16_t *p, int64_t *bound);
 
+/*
+ * Bounds for the vpmulld variants of the Cooley-Tukey NTT
+ * - same as ntt_ct_bounds but the result of the rounds with step
+ *   size d = 8, 128, 2048, ... is reduced.
+ * - the step size of round t is d = t if std2rev is false
+ *   and d = n/2t if std2rev is true.
+ * - bound[k] = bound on the coefficients after round k
+ * - prod[k] = bound on |w * x| for the products computed in round k
+ *   (prod[0] is set to 0)
+ * Both arrays must be of size log_2(n) + 1.
+ *
+ * The max of prod[k] is returned. vpmulld computes w * x modulo 2^32
+ * so the vpmulld variants are correct only if this is less than 2^31.
+ */
+extern int64_t ntt_ct_mulld_bounds(int64_t b0, uint32_t n, const int16_t *p, bool std2rev,
+                                   int64_t *bound, int64_t *prod);
+
+/*
+ * LAZY REDUCTION
+ */
+
+/*
+ * Largest |z| for which mul_red(x, y) = red(x * y) is safe: the
+ * result (z >> m) must fit in 32 bits. MAX_MUL_RED is the value
+ * for q = 12289.
+ */
+#define MAX_MUL_RED 8796042698752
+
+extern int64_t max_mul_red(void);
+extern int64_t max_mul_red_q(const red_param_t *rp);
+
+/*
+ * Maximum of |red(x)| for |x| <= b
+ */
+extern int64_t abs_red_bound(int64_t b);
+extern int64_t abs_red_bound_q(const red_param_t *rp, int64_t b);
+
+/*
+ * Maximum of |red(x * y)| for |x| <= a and |y| <= b
+ */
+extern int64_t abs_mul_red_bound(int64_t a, int64_t b);
+extern int64_t abs_mul_red_bound_q(const red_param_t *rp, int64_t a, int64_t b);
+
+/*
+ * Bounds for the Cooley-Tukey NTT with reductions after some rounds
+ * - same as ntt_ct_bounds but the result of round k is reduced
+ *   (i.e., replaced by red(x)) if bit k of rounds is set.
+ * - rounds are numbered from 1 to log_2(n) so bit 0 is ignored.
+ * - bound[k] = bound on the coefficients computed in round k
+ *   (before the reduction if round k is reduced)
+ * - prod[k] = bound on |w * x| for the products computed in round k
+ *   (bound[0] is set to b0 and prod[0] is set to 0)
+ * Both arrays must be of size log_2(n) + 1.
+ *
+ * The bound on the output is returned. The schedule is safe if all
+ * bound[k] are at most INT32_MAX and all prod[k] are at most max_mul_red().
+ */
+extern int64_t ntt_ct_lazy_bounds(int64_t b0, uint32_t n, const int16_t *p, uint32_t rounds,
+                                  int64_t *bound, int64_t *prod);
+
+/*
+ * Same thing for the Gentleman-Sande NTT: prod[k] is a bound on
+ * |w * (x - y)| in round k.
+ */
+extern int64_t ntt_gs_lazy_bounds(int64_t b0, uint32_t n, const int16_t *p, uint32_t rounds,
+                                  int64_t *bound, int64_t *prod);
+
+/*
+ * Variants for 32bit tables and any modulus (for moduli larger than 2^16):
+ * the limit on prod[k] is max_mul_red_q(rp).
+ */
+extern int64_t ntt_ct_lazy_bounds32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p,
+                                    uint32_t rounds, int64_t *bound, int64_t *prod);
+extern int64_t ntt_gs_lazy_bounds32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p,
+                                    uint32_t rounds, int64_t *bound, int64_t *prod);
+
+/*
+ * Smallest set of rounds to reduce for the CT NTT
+ * - b0 = bound on the input
+ * - a round is reduced only if the next round would overflow
+ *   (this greedy choice gives the fewest reductions since the
+ *   bounds are monotonic).
+ * - the schedule is stored in *rounds (same format as above) and the
+ *   final bound is returned.
+ * - return -1 if no schedule is safe (i.e., b0 is too large).
+ */
+extern int64_t ntt_ct_lazy_schedule(int64_t b0, uint32_t n, const int16_t *p, uint32_t *rounds);
+
+/*
+ * Same thing for the Gentleman-Sande NTT
+ */
+extern int64_t ntt_gs_lazy_schedule(int64_t b0, uint32_t n, const int16_t *p, uint32_t *rounds);
+
+/*
+ * Variants for 32bit tables and any modulus
+ */
+extern int64_t ntt_ct_lazy_schedule32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t *rounds);
+extern int64_t ntt_gs_lazy_schedule32(const red_param_t *rp, int64_t b0, uint32_t n, const int32_t *p, uint32_t *rounds);
+
 #endif /* __RED_BOUNDS_H */
@@ -0,0 +1,179 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_batch_asm1024.h"
+#include "ntt_red_asm1024.h"
+#include "ntt_short_asm1024.h"
+#include "sort.h"
+
+/*
+ * PERFORMANCE MEASUREMENTS
+ */
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 10240
+
+static uint64_t t[NTESTS];
+
+// Average run time
+static uint64_t average_time(void) {
+  uint64_t s;
+  uint32_t i;
+
+  s = 0;
+  for (i=0; i<NTESTS; i++) {
+    s += t[i];
+  }
+  return s/NTESTS;
+}
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+/*
+ * Each measurement computes k products: print the cost of one batch
+ * and the cost per product.
+ */
+static void print_results(const char *s, uint64_t c, uint32_t k) {
+  uint64_t med, avg;
+  uint32_t i;
+
+  for(i=0 ;i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c - t[i];
+
+  med = median_time();
+  avg = average_time();
+  printf("%s\n", s);
+  printf("median: %"PRIu64" (%"PRIu64" per product)\n", med, med/k);
+  printf("average: %"PRIu64" (%"PRIu64" per product)\n", avg, avg/k);
+  printf("\n");
+}
+
+static int32_t a32[16][1024] __attribute__ ((aligned(32)));
+static int32_t b32[16][1024] __attribute__ ((aligned(32)));
+static int32_t c32[16][1024] __attribute__ ((aligned(32)));
+static int32_t soa32[3][8 * 1024] __attribute__ ((aligned(32)));
+
+static int16_t a16[16][1024] __attribute__ ((aligned(32)));
+static int16_t b16[16][1024] __attribute__ ((aligned(32)));
+static int16_t c16[16][1024] __attribute__ ((aligned(32)));
+static int16_t soa16[3][16 * 1024] __attribute__ ((aligned(32)));
+
+static void init(void) {
+  uint32_t i, k;
+
+  for (k=0; k<16; k++) {
+    for (i=0; i<1024; i++) {
+      a32[k][i] = i;
+      b32[k][i] = i;
+      a16[k][i] = i;
+      b16[k][i] = i;
+    }
+  }
+}
+
+static void test_mul32(void) {
+  int32_t *a[8], *b[8], *c[8];
+  uint32_t i, k;
+
+  for (k=0; k<8; k++) {
+    a[k] = a32[k];
+    b[k] = b32[k];
+    c[k] = c32[k];
+  }
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    for (k=0; k<8; k++) {
+      ntt_red1024_product5_asm(c32[k], a32[k], b32[k]);
+    }
+  }
+  print_results("ntt_red1024_product5_asm x 8", cpucycles(), 8);
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_red1024_batch8_pack_asm(soa32[0], a);
+    ntt_red1024_batch8_pack_asm(soa32[1], b);
+    ntt_red1024_batch8_product5_asm(soa32[2], soa32[0], soa32[1]);
+    ntt_red1024_batch8_unpack_asm(c, soa32[2]);
+  }
+  print_results("ntt_red1024_batch8_product5_asm (with pack/unpack)", cpucycles(), 8);
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_red1024_batch8_product5_asm(soa32[2], soa32[0], soa32[1]);
+  }
+  print_results("ntt_red1024_batch8_product5_asm", cpucycles(), 8);
+}
+
+static void test_mul16(void) {
+  int16_t *a[16], *b[16], *c[16];
+  uint32_t i, k;
+
+  for (k=0; k<16; k++) {
+    a[k] = a16[k];
+    b[k] = b16[k];
+    c[k] = c16[k];
+  }
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    for (k=0; k<16; k++) {
+      ntt_short1024_product5_asm(c16[k], a16[k], b16[k]);
+    }
+  }
+  print_results("ntt_short1024_product5_asm x 16", cpucycles(), 16);
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_short1024_batch16_pack_asm(soa16[0], a);
+    ntt_short1024_batch16_pack_asm(soa16[1], b);
+    ntt_short1024_batch16_product5_asm(soa16[2], soa16[0], soa16[1]);
+    ntt_short1024_batch16_unpack_asm(c, soa16[2]);
+  }
+  print_results("ntt_short1024_batch16_product5_asm (with pack/unpack)", cpucycles(), 16);
+
+  init();
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_short1024_batch16_product5_asm(soa16[2], soa16[0], soa16[1]);
+  }
+  print_results("ntt_short1024_batch16_product5_asm", cpucycles(), 16);
+}
+
+int main(void) {
+  printf("Testing batched product functions: throughput\n\n");
+  test_mul32();
+  test_mul16();
+  return 0;
+}
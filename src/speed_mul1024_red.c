@@ -123,6 +123,17 @@ static void test_mul(void) {
     ntt_red1024_product5(c, a, b);
   }
   print_results("ntt_red1024_product5 ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+    b[i] = i;
+  }
+  
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_red1024_product_4step(c, a, b);
+  }
+  print_results("ntt_red1024_product_4step ", cpucycles());
 }
 
 int main(void){
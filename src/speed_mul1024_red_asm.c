@@ -123,10 +123,142 @@ static void test_mul(void) {
     ntt_red1024_product5_asm(c, a, b);
   }
   print_results("ntt_red1024_product5_asm ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+    b[i] = i;
+  }
+  
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_red1024_product6_asm(c, a, b);
+  }
+  print_results("ntt_red1024_product6_asm ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+    b[i] = i;
+  }
+  
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    ntt_red1024_product_4step_asm(c, a, b);
+  }
+  print_results("ntt_red1024_product_4step_asm ", cpucycles());
+}
+
+/*
+ * Second half of the products: pointwise product + inverse NTT,
+ * as separate passes or with the fused functions.
+ */
+static void test_pointwise(void) {
+  int32_t a[1024], b[1024], c[1024];
+  uint32_t i;
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+    b[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    mul_reduce_array_asm(c, 1024, a, b);
+    reduce_array_twice_asm(c, 1024);
+    intt_red1024_ct_rev2std_asm(c);
+  }
+  print_results("mul_reduce + intt_red1024_ct_rev2std_asm ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    pointwise_intt_red1024_ct_rev2std_asm(c, a, b);
+  }
+  print_results("pointwise_intt_red1024_ct_rev2std_asm ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    mul_reduce_array_asm(c, 1024, a, b);
+    reduce_array_twice_asm(c, 1024);
+    intt_red1024_gs_rev2std_asm(c);
+  }
+  print_results("mul_reduce + intt_red1024_gs_rev2std_asm ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    pointwise_intt_red1024_gs_rev2std_asm(c, a, b);
+  }
+  print_results("pointwise_intt_red1024_gs_rev2std_asm ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    mul_reduce_array_asm(c, 1024, a, b);
+    reduce_array_twice_asm(c, 1024);
+    inttmul_red1024_gs_rev2std_asm(c);
+  }
+  print_results("mul_reduce + inttmul_red1024_gs_rev2std_asm ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    pointwise_inttmul_red1024_gs_rev2std_asm(c, a, b);
+  }
+  print_results("pointwise_inttmul_red1024_gs_rev2std_asm ", cpucycles());
+}
+
+/*
+ * Final step of the products: rescale, reduce twice, correct
+ */
+static void test_finalize(void) {
+  int32_t a[1024];
+  uint32_t i;
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    mul_reduce_array16_asm(a, 1024, ntt_red1024_scaled_inv_psi_powers);
+    reduce_array_twice_asm(a, 1024);
+    correct_asm(a, 1024);
+  }
+  print_results("mul_reduce_array16 + reduce_array_twice + correct_asm ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    mul_reduce_finalize_asm(a, 1024, ntt_red1024_scaled_inv_psi_powers);
+  }
+  print_results("mul_reduce_finalize_asm ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    scalar_mul_reduce_array_asm(a, 1024, ntt_red1024_rescale8);
+    reduce_array_twice_asm(a, 1024);
+    correct_asm(a, 1024);
+  }
+  print_results("scalar_mul_reduce_array + reduce_array_twice + correct_asm ", cpucycles());
+
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    scalar_mul_reduce_finalize_asm(a, 1024, ntt_red1024_rescale8);
+  }
+  print_results("scalar_mul_reduce_finalize_asm ", cpucycles());
 }
 
 int main(void){
   printf("Testing ntt_red_asm1024 product functions\n\n");
   test_mul();
+  test_pointwise();
+  test_finalize();
   return 0;
 }
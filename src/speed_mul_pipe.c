@@ -0,0 +1,108 @@
+/*
+ * Throughput of the pipelined products for n=1024, compared with
+ * ntt_red1024_product5_asm called in a loop.
+ * The queue counters are printed for each depth.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "ntt_pipe.h"
+#include "ntt_red_asm1024.h"
+
+#define Q 12289
+
+// stream length and number of streams per measurement
+#define COUNT 4096
+#define NRUNS 20
+
+static int32_t a[COUNT][1024], b[COUNT][1024], c[COUNT][1024];
+static int32_t *pa[COUNT], *pb[COUNT], *pc[COUNT];
+static int32_t a_copy[1024], b_copy[1024];
+
+static double wall_time(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void speed_loop(void) {
+  double start, elapsed;
+  uint32_t i, j;
+
+  start = wall_time();
+  for (i=0; i<NRUNS; i++) {
+    for (j=0; j<COUNT; j++) {
+      memcpy(a_copy, a[j], sizeof(a_copy));
+      memcpy(b_copy, b[j], sizeof(b_copy));
+      ntt_red1024_product5_asm(c[j], a_copy, b_copy);
+    }
+  }
+  elapsed = wall_time() - start;
+  printf("ntt_red1024_product5_asm loop:       %10.0f products/s\n", (COUNT * NRUNS)/elapsed);
+}
+
+static void speed_pipe(uint32_t depth, bool pin) {
+  ntt_pipe_t *pipe;
+  ntt_pipe_stats_t stats;
+  double start, elapsed;
+  uint32_t i;
+
+  pipe = ntt_pipe_create(1024, depth, pin);
+  if (pipe == NULL) {
+    fprintf(stderr, "failed to create a pipeline of depth %"PRIu32"\n", depth);
+    exit(1);
+  }
+  // warm up
+  ntt_pipe_product(pipe, pc, pa, pb, COUNT);
+  ntt_pipe_reset_stats(pipe);
+
+  start = wall_time();
+  for (i=0; i<NRUNS; i++) {
+    ntt_pipe_product(pipe, pc, pa, pb, COUNT);
+  }
+  elapsed = wall_time() - start;
+  ntt_pipe_get_stats(pipe, &stats);
+  ntt_pipe_delete(pipe);
+
+  printf("pipeline depth %3"PRIu32"%s: %10.0f products/s\n", depth, pin ? " (pinned)" : "         ",
+	 (COUNT * NRUNS)/elapsed);
+  for (i=0; i<2; i++) {
+    printf("   queue %"PRIu32": full stalls = %8"PRIu64", empty stalls = %8"PRIu64", avg depth = %5.2f, max depth = %"PRIu32"\n",
+	   i, stats.queue[i].full_stalls, stats.queue[i].empty_stalls,
+	   (double) stats.queue[i].depth_sum / stats.queue[i].pushes, stats.queue[i].max_depth);
+  }
+}
+
+int main(void) {
+  uint32_t i, j;
+
+  if (! avx2_supported()) {
+    printf("AVX2 is not supported\n");
+    return 0;
+  }
+
+  for (j=0; j<COUNT; j++) {
+    pa[j] = a[j];
+    pb[j] = b[j];
+    pc[j] = c[j];
+    for (i=0; i<1024; i++) {
+      a[j][i] = random() % Q;
+      b[j][i] = random() % Q;
+    }
+  }
+
+  printf("Pipelined products: %d products of size 1024\n\n", COUNT);
+  speed_loop();
+  for (i=2; i<=64; i<<=1) {
+    speed_pipe(i, false);
+    speed_pipe(i, true);
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Throughput of the thread-pool batch products:
+ * products per second for 1 thread up to one thread per core.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "ntt_pool.h"
+#include "ntt_asm.h"
+
+#define Q 12289
+
+// batch size and number of batches per measurement
+#define COUNT 4096
+#define NRUNS 20
+
+static int32_t a[COUNT][1024], b[COUNT][1024], c[COUNT][1024];
+static int32_t *pa[COUNT], *pb[COUNT], *pc[COUNT];
+
+static const char * const backend_name[3] = {
+  "ntt1024_product5", "ntt_red1024_product5", "ntt_red1024_product5_asm",
+};
+
+static double wall_time(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void speed_test(ntt_pool_backend_t backend, uint32_t nthreads, bool pin) {
+  ntt_pool_t *pool;
+  double start, elapsed;
+  uint32_t i;
+
+  pool = ntt_pool_create(nthreads, pin);
+  if (pool == NULL) {
+    fprintf(stderr, "failed to create a pool of %"PRIu32" threads\n", nthreads);
+    exit(1);
+  }
+  // warm up
+  ntt_pool_product(pool, backend, 1024, pc, pa, pb, COUNT);
+
+  start = wall_time();
+  for (i=0; i<NRUNS; i++) {
+    ntt_pool_product(pool, backend, 1024, pc, pa, pb, COUNT);
+  }
+  elapsed = wall_time() - start;
+  ntt_pool_delete(pool);
+
+  printf("%-26s %3"PRIu32" threads%s: %10.0f products/s\n", backend_name[backend],
+	 nthreads, pin ? " (pinned)" : "         ", (COUNT * NRUNS)/elapsed);
+}
+
+int main(void) {
+  ntt_pool_backend_t backend, last;
+  uint32_t i, j, k;
+
+  for (j=0; j<COUNT; j++) {
+    pa[j] = a[j];
+    pb[j] = b[j];
+    pc[j] = c[j];
+    for (i=0; i<1024; i++) {
+      a[j][i] = random() % Q;
+      b[j][i] = random() % Q;
+    }
+  }
+
+  k = ntt_pool_num_cores();
+  printf("Batch products: %d products of size 1024, %"PRIu32" cores\n\n", COUNT, k);
+  last = avx2_supported() ? NTT_POOL_RED_ASM : NTT_POOL_RED;
+  for (backend=NTT_POOL_DEFAULT; backend<=last; backend++) {
+    for (i=1; i<=k; i<<=1) {
+      speed_test(backend, i, false);
+      speed_test(backend, i, true);
+    }
+    if ((k & (k - 1)) != 0) {
+      // k is not a power of two
+      speed_test(backend, k, false);
+      speed_test(backend, k, true);
+    }
+    printf("\n");
+  }
+
+  return 0;
+}
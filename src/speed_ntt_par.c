@@ -0,0 +1,105 @@
+/*
+ * Latency of the multi-threaded NTTs for n = 2^14 to 2^20:
+ * median time of one transform for 1 thread up to one thread per core.
+ *
+ * The running time doesn't depend on the data. We use a = 0 so that
+ * there's no overflow for n > 65536 and a synthetic table.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ntt_par.h"
+#include "ntt_red.h"
+#include "sort.h"
+
+#define MIN_N 16384
+#define MAX_N (1024 * 1024)
+
+#define NTESTS 201
+
+static uint64_t t[NTESTS];
+
+static int32_t a[MAX_N];
+static int16_t p[MAX_N];
+
+// time in nanoseconds
+static uint64_t wall_time(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * (uint64_t) 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+static uint64_t speed_test(ntt_par_t *par, uint32_t n, bool ct) {
+  uint32_t i;
+  uint64_t c;
+
+  for (i=0; i<NTESTS; i++) {
+    c = wall_time();
+    if (ct) {
+      ntt_par_ct_std2rev(par, a, n, p);
+    } else {
+      ntt_par_gs_rev2std(par, a, n, p);
+    }
+    t[i] = wall_time() - c;
+  }
+  return median_time();
+}
+
+static void speed_tests(uint32_t nthreads, bool pin, uint64_t *base) {
+  ntt_par_t *par;
+  uint64_t ct, gs;
+  uint32_t n, k;
+
+  par = ntt_par_create(nthreads, pin);
+  if (par == NULL) {
+    fprintf(stderr, "failed to create %"PRIu32" threads\n", nthreads);
+    exit(1);
+  }
+  for (n=MIN_N, k=0; n<=MAX_N; n <<= 1, k++) {
+    ct = speed_test(par, n, true);
+    gs = speed_test(par, n, false);
+    if (nthreads == 1 && !pin) {
+      base[k] = ct + gs;
+    }
+    printf("%3"PRIu32" threads%s n = %7"PRIu32" (%"PRIu32" levels): ct_std2rev %8"PRIu64" ns, gs_rev2std %8"PRIu64" ns, speedup %.2f\n",
+	   nthreads, pin ? " (pinned)" : "         ", n, ntt_par_levels(par, n), ct, gs,
+	   (double) base[k]/(ct + gs));
+  }
+  ntt_par_delete(par);
+  printf("\n");
+}
+
+int main(void) {
+  uint64_t base[7];
+  uint32_t i, k;
+
+  for (i=0; i<MAX_N; i++) {
+    p[i] = (random() & 1) ? 4096 : -4096;
+  }
+
+  k = (uint32_t) sysconf(_SC_NPROCESSORS_ONLN);
+  if (k < 1) k = 1;
+  printf("Single NTT latency: %"PRIu32" cores\n\n", k);
+  for (i=1; i<=k; i<<=1) {
+    speed_tests(i, false, base);
+    speed_tests(i, true, base);
+  }
+  if ((k & (k - 1)) != 0) {
+    // k is not a power of two
+    speed_tests(k, false, base);
+    speed_tests(k, true, base);
+  }
+
+  return 0;
+}
@@ -0,0 +1,727 @@
+/*
+ * Tests of the 64bit backend
+ * - the eight NTT variants (forward, inverse, mulntt, nttmul) compared
+ *   with a naive NTT, for n=1024 and n=4096
+ * - the AVX2 versions must give the same results as the C versions,
+ *   including with lazy inputs (in [0, 4q-1] or [0, 2q-1])
+ * - element-wise functions
+ * - products compared with a naive negacyclic product
+ * - four-step NTTs and product for n=16384, compared with the naive
+ *   NTT and product, and with the direct NTTs (tables built here)
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ntt64_1024.h"
+#include "ntt64_4096.h"
+#include "ntt64_16384.h"
+#include "ntt_asm.h"
+#include "sort.h"
+
+typedef unsigned __int128 uint128_t;
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 1000
+
+static uint64_t t[NTESTS];
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+#define MAXN 16384
+
+static uint64_t a[MAXN], b[MAXN], c[MAXN], d[MAXN], e[MAXN], pw[MAXN], tmp[MAXN];
+
+typedef void (*ntt64_fun_t)(uint64_t *a, uint32_t n, uint64_t q, const uint64_t *p);
+typedef void (*product_fun_t)(uint64_t *c, uint64_t *a, uint64_t *b);
+
+/*
+ * Variant: fun and fun_asm use table p
+ * - rev: input in bit-reverse order (otherwise output in bit-reverse order)
+ * - inverse: omega^-1 instead of omega
+ * - pre: multiply the input by powers of psi before the NTT
+ * - post: multiply the output by powers of psi^-1 after the NTT
+ * - gs: Gentleman-Sande (input in [0, 2q-1] instead of [0, 4q-1])
+ */
+typedef struct variant_s {
+  const char *name;
+  ntt64_fun_t fun;
+  ntt64_fun_t fun_asm;
+  const uint64_t *p;
+  bool rev, inverse, pre, post, gs;
+} variant_t;
+
+typedef struct size_s {
+  uint32_t n;
+  uint64_t q, psi, omega, inv_psi, inv_omega, qinv, rescale, rescale_shoup;
+  const uint64_t *psi_powers;
+  const variant_t *variant;
+  const product_fun_t *product;
+} size_info_t;
+
+#define NVARIANTS 12
+
+#define VARIANTS(N) {						\
+  { "ntt64_ct_rev2std", ntt64_ct_rev2std, ntt64_ct_rev2std_asm,		\
+    ntt64_##N##_omega_powers, true, false, false, false, false },	\
+  { "ntt64_gs_rev2std", ntt64_gs_rev2std, ntt64_gs_rev2std_asm,		\
+    ntt64_##N##_omega_powers_rev, true, false, false, false, true },	\
+  { "ntt64_ct_std2rev", ntt64_ct_std2rev, ntt64_ct_std2rev_asm,		\
+    ntt64_##N##_omega_powers_rev, false, false, false, false, false },	\
+  { "ntt64_gs_std2rev", ntt64_gs_std2rev, ntt64_gs_std2rev_asm,		\
+    ntt64_##N##_omega_powers, false, false, false, false, true },	\
+  { "intt64_ct_rev2std", ntt64_ct_rev2std, ntt64_ct_rev2std_asm,	\
+    ntt64_##N##_inv_omega_powers, true, true, false, false, false },	\
+  { "intt64_gs_rev2std", ntt64_gs_rev2std, ntt64_gs_rev2std_asm,	\
+    ntt64_##N##_inv_omega_powers_rev, true, true, false, false, true },	\
+  { "intt64_ct_std2rev", ntt64_ct_std2rev, ntt64_ct_std2rev_asm,	\
+    ntt64_##N##_inv_omega_powers_rev, false, true, false, false, false }, \
+  { "intt64_gs_std2rev", ntt64_gs_std2rev, ntt64_gs_std2rev_asm,	\
+    ntt64_##N##_inv_omega_powers, false, true, false, false, true },	\
+  { "mulntt64_ct_rev2std", mulntt64_ct_rev2std, mulntt64_ct_rev2std_asm, \
+    ntt64_##N##_mixed_powers, true, false, true, false, false },	\
+  { "mulntt64_ct_std2rev", mulntt64_ct_std2rev, mulntt64_ct_std2rev_asm, \
+    ntt64_##N##_mixed_powers_rev, false, false, true, false, false },	\
+  { "nttmul64_gs_rev2std", nttmul64_gs_rev2std, nttmul64_gs_rev2std_asm, \
+    ntt64_##N##_inv_mixed_powers_rev, true, true, false, true, true },	\
+  { "nttmul64_gs_std2rev", nttmul64_gs_std2rev, nttmul64_gs_std2rev_asm, \
+    ntt64_##N##_inv_mixed_powers, false, true, false, true, true },	\
+}
+
+static const variant_t variants1024[NVARIANTS] = VARIANTS(1024);
+static const variant_t variants4096[NVARIANTS] = VARIANTS(4096);
+
+#define NPRODUCTS 6
+
+static const product_fun_t products1024[NPRODUCTS] = {
+  ntt64_1024_product1, ntt64_1024_product2, ntt64_1024_product3,
+  ntt64_1024_product4, ntt64_1024_product5, ntt64_1024_product5_asm,
+};
+
+static const product_fun_t products4096[NPRODUCTS] = {
+  ntt64_4096_product1, ntt64_4096_product2, ntt64_4096_product3,
+  ntt64_4096_product4, ntt64_4096_product5, ntt64_4096_product5_asm,
+};
+
+static const char * const product_name[NPRODUCTS] = {
+  "product1", "product2", "product3", "product4", "product5", "product5_asm",
+};
+
+static const size_info_t size1024 = {
+  1024, ntt64_1024_q, ntt64_1024_psi, ntt64_1024_omega, ntt64_1024_inv_psi,
+  ntt64_1024_inv_omega, ntt64_1024_qinv, ntt64_1024_rescale, ntt64_1024_rescale_shoup,
+  ntt64_1024_psi_powers, variants1024, products1024,
+};
+
+static const size_info_t size4096 = {
+  4096, ntt64_4096_q, ntt64_4096_psi, ntt64_4096_omega, ntt64_4096_inv_psi,
+  ntt64_4096_inv_omega, ntt64_4096_qinv, ntt64_4096_rescale, ntt64_4096_rescale_shoup,
+  ntt64_4096_psi_powers, variants4096, products4096,
+};
+
+/*
+ * n=16384: only the four-step tables are available
+ */
+static const size_info_t size16384 = {
+  16384, ntt64_16384_q, ntt64_16384_psi, ntt64_16384_omega, ntt64_16384_inv_psi,
+  ntt64_16384_inv_omega, ntt64_16384_qinv, ntt64_16384_rescale, ntt64_16384_rescale_shoup,
+  NULL, NULL, NULL,
+};
+
+static const variant_t mulntt_4step = {
+  "mulntt64_16384_ct_std2rev_4step", NULL, NULL, NULL, false, false, true, false, false,
+};
+
+static const variant_t inttmul_4step = {
+  "inttmul64_16384_gs_rev2std_4step", NULL, NULL, NULL, true, true, false, true, true,
+};
+
+
+/*
+ * Arithmetic modulo q
+ */
+static uint64_t mulmod(uint64_t x, uint64_t y, uint64_t q) {
+  return (uint64_t) (((uint128_t) x * y) % q);
+}
+
+static uint64_t powmod(uint64_t x, uint64_t k, uint64_t q) {
+  uint64_t r;
+
+  r = 1;
+  while (k > 0) {
+    if (k & 1) r = mulmod(r, x, q);
+    x = mulmod(x, x, q);
+    k >>= 1;
+  }
+  return r;
+}
+
+/*
+ * Random 64bit integer in [0, bound-1]
+ */
+static uint64_t random_below(uint64_t bound) {
+  uint64_t r;
+
+  r = ((uint64_t) random() << 62) ^ ((uint64_t) random() << 31) ^ random();
+  return r % bound;
+}
+
+static uint32_t bitrev(uint32_t i, uint32_t n) {
+  uint32_t r;
+
+  for (r=0; n>1; n >>= 1) {
+    r = (r << 1) | (i & 1);
+    i >>= 1;
+  }
+  return r;
+}
+
+static void bitrev_copy(uint64_t *b, const uint64_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    b[bitrev(i, n)] = a[i];
+  }
+}
+
+/*
+ * Naive NTT: b[k] = sum a[i] * r^(i * k) modulo q (r must have order n)
+ */
+static void naive_ntt(uint64_t *b, const uint64_t *a, uint32_t n, uint64_t q, uint64_t r) {
+  uint128_t s;
+  uint32_t i, k;
+
+  pw[0] = 1;
+  for (i=1; i<n; i++) {
+    pw[i] = mulmod(pw[i-1], r, q);
+  }
+  for (k=0; k<n; k++) {
+    s = 0;
+    for (i=0; i<n; i++) {
+      s += (uint128_t) a[i] * pw[(i * k) & (n - 1)];
+      if (s >> 126) s %= q;
+    }
+    b[k] = (uint64_t) (s % q);
+  }
+}
+
+/*
+ * Naive product modulo (X^n + 1) and q
+ */
+static void naive_product(uint64_t *c, const uint64_t *a, const uint64_t *b, uint32_t n, uint64_t q) {
+  uint128_t s, m;
+  uint32_t i, j;
+
+  for (i=0; i<n; i++) {
+    s = 0;
+    m = 0;
+    for (j=0; j<=i; j++) {
+      s += (uint128_t) a[j] * b[i - j];
+      if (s >> 126) s %= q;
+    }
+    for (j=i+1; j<n; j++) {
+      m += (uint128_t) a[j] * b[n + i - j];
+      if (m >> 126) m %= q;
+    }
+    c[i] = (uint64_t) ((s % q + q - m % q) % q);
+  }
+}
+
+static void check_equal(const char *name, const uint64_t *a, const uint64_t *b, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] != b[i]) {
+      printf("failed: %s (n = %"PRIu32", i = %"PRIu32")\n", name, n, i);
+      exit(1);
+    }
+  }
+}
+
+/*
+ * Initialize x with elements in [0, q-1]
+ * - 0: random
+ * - 1: all equal to q-1
+ * - 2: all 0 except x[1] = 1
+ */
+static void init_array(uint64_t *x, uint32_t n, uint64_t q, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    switch (pattern) {
+    case 0: x[i] = random_below(q); break;
+    case 1: x[i] = q - 1; break;
+    default: x[i] = (i == 1); break;
+    }
+  }
+}
+
+/*
+ * Expected result of variant v for input x (standard order, in [0, q-1])
+ */
+static void expected(uint64_t *y, const uint64_t *x, const size_info_t *s, const variant_t *v) {
+  uint64_t q;
+  uint32_t i, n;
+
+  n = s->n;
+  q = s->q;
+  for (i=0; i<n; i++) {
+    e[i] = v->pre ? mulmod(x[i], powmod(s->psi, i, q), q) : x[i];
+  }
+  naive_ntt(d, e, n, q, v->inverse ? s->inv_omega : s->omega);
+  if (v->post) {
+    for (i=0; i<n; i++) {
+      d[i] = mulmod(d[i], powmod(s->inv_psi, i, q), q);
+    }
+  }
+  if (v->rev) {
+    memcpy(y, d, n * sizeof(uint64_t));
+  } else {
+    bitrev_copy(y, d, n);
+  }
+}
+
+/*
+ * Test variant v:
+ * - input x in [0, q-1] plus random multiples of q (lazy input)
+ * - C and assembly raw outputs must be equal and in range
+ * - corrected outputs must match the naive NTT
+ */
+static void test_variant(const size_info_t *s, const variant_t *v) {
+  uint64_t q, bound;
+  uint32_t i, k, n, pattern;
+
+  n = s->n;
+  q = s->q;
+  bound = v->gs ? 2 * q : 4 * q;
+  printf("Testing %s: n = %"PRIu32"\n", v->name, n);
+  for (k=0; k<4; k++) {
+    pattern = k < 2 ? 0 : k - 1;
+    init_array(a, n, q, pattern);
+    expected(c, a, s, v);
+    // lazy input in [0, bound-1]
+    if (v->rev) {
+      bitrev_copy(b, a, n);
+    } else {
+      memcpy(b, a, n * sizeof(uint64_t));
+    }
+    for (i=0; i<n; i++) {
+      if (k == 1) b[i] += q * random_below(bound/q);
+      if (pattern == 1) b[i] = bound - 1; // congruent to q - 1
+    }
+    memcpy(a, b, n * sizeof(uint64_t));
+
+    v->fun(b, n, q, v->p);
+    for (i=0; i<n; i++) {
+      if (b[i] >= bound) {
+	printf("failed: %s: output out of range\n", v->name);
+	exit(1);
+      }
+    }
+    if (avx2_supported()) {
+      v->fun_asm(a, n, q, v->p);
+      check_equal(v->name, b, a, n);
+    }
+    ntt64_correct(b, n, q);
+    check_equal(v->name, c, b, n);
+  }
+  printf("passed\n");
+}
+
+/*
+ * Element-wise functions: C and assembly versions
+ */
+static void test_element_wise(const size_info_t *s) {
+  uint64_t q, r64;
+  uint32_t i, k, n;
+
+  n = s->n;
+  q = s->q;
+  r64 = (uint64_t) (((uint128_t) 1 << 64) % q);
+  printf("Testing element-wise functions: n = %"PRIu32"\n", n);
+  for (k=0; k<10; k++) {
+    for (i=0; i<n; i++) {
+      a[i] = random_below(4 * q);
+      b[i] = random_below(q);
+    }
+    a[0] = 4 * q - 1;
+    b[0] = q - 1;
+    a[1] = 0;
+
+    // correct
+    memcpy(c, a, n * sizeof(uint64_t));
+    ntt64_correct(c, n, q);
+    for (i=0; i<n; i++) {
+      if (c[i] != a[i] % q) {
+	printf("failed: correct\n");
+	exit(1);
+      }
+    }
+    if (avx2_supported()) {
+      memcpy(d, a, n * sizeof(uint64_t));
+      ntt64_correct_asm(d, n, q);
+      check_equal("correct_asm", c, d, n);
+    }
+
+    // mul_powers
+    memcpy(c, a, n * sizeof(uint64_t));
+    ntt64_mul_powers(c, n, q, s->psi_powers);
+    for (i=0; i<n; i++) {
+      if (c[i] >= 2 * q || c[i] % q != mulmod(a[i], s->psi_powers[i], q)) {
+	printf("failed: mul_powers\n");
+	exit(1);
+      }
+    }
+    if (avx2_supported()) {
+      memcpy(d, a, n * sizeof(uint64_t));
+      ntt64_mul_powers_asm(d, n, q, s->psi_powers);
+      check_equal("mul_powers_asm", c, d, n);
+    }
+
+    // scalar_mul_array
+    memcpy(c, a, n * sizeof(uint64_t));
+    ntt64_scalar_mul_array(c, n, q, s->rescale, s->rescale_shoup);
+    for (i=0; i<n; i++) {
+      if (c[i] >= 2 * q || c[i] % q != mulmod(a[i], s->rescale, q)) {
+	printf("failed: scalar_mul_array\n");
+	exit(1);
+      }
+    }
+    if (avx2_supported()) {
+      memcpy(d, a, n * sizeof(uint64_t));
+      ntt64_scalar_mul_array_asm(d, n, q, s->rescale, s->rescale_shoup);
+      check_equal("scalar_mul_array_asm", c, d, n);
+    }
+
+    // mul_array: c[i] * 2^64 = a[i] * b[i] modulo q
+    ntt64_mul_array(c, n, q, s->qinv, a, b);
+    for (i=0; i<n; i++) {
+      if (c[i] >= q || mulmod(c[i], r64, q) != mulmod(a[i], b[i], q)) {
+	printf("failed: mul_array\n");
+	exit(1);
+      }
+    }
+    if (avx2_supported()) {
+      ntt64_mul_array_asm(d, n, q, s->qinv, a, b);
+      check_equal("mul_array_asm", c, d, n);
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Products
+ */
+static void test_products(const size_info_t *s) {
+  uint64_t q;
+  uint32_t i, k, n;
+
+  n = s->n;
+  q = s->q;
+  for (i=0; i<NPRODUCTS; i++) {
+    if (i == NPRODUCTS - 1 && !avx2_supported()) break;
+    printf("Testing %s: n = %"PRIu32"\n", product_name[i], n);
+    for (k=0; k<3; k++) {
+      init_array(a, n, q, k == 2 ? 1 : 0);
+      init_array(b, n, q, 0);
+      naive_product(d, a, b, n, q);
+      s->product[i](c, a, b);
+      check_equal(product_name[i], d, c, n);
+    }
+    printf("passed\n");
+  }
+}
+
+static void test_size(const size_info_t *s) {
+  uint32_t i;
+
+  for (i=0; i<NVARIANTS; i++) {
+    test_variant(s, s->variant + i);
+  }
+  test_element_wise(s);
+  test_products(s);
+}
+
+/*
+ * Four-step NTTs:
+ * - input in [0, q-1] plus random multiples of q (lazy input)
+ * - C and assembly outputs must be equal and in range
+ * - corrected outputs must match the naive NTT (multiplied by
+ *   rescale for the inverse NTT)
+ */
+static void test_4step_variant(const variant_t *v, uint32_t k) {
+  const size_info_t *s;
+  uint64_t q, bound;
+  uint32_t i, n, pattern;
+
+  s = &size16384;
+  n = s->n;
+  q = s->q;
+  bound = v->gs ? 2 * q : 4 * q;
+  pattern = k < 2 ? 0 : k - 1;
+  init_array(a, n, q, pattern);
+  expected(c, a, s, v);
+  if (v->gs) {
+    for (i=0; i<n; i++) {
+      c[i] = mulmod(c[i], s->rescale, q);
+    }
+  }
+  if (v->rev) {
+    bitrev_copy(b, a, n);
+  } else {
+    memcpy(b, a, n * sizeof(uint64_t));
+  }
+  for (i=0; i<n; i++) {
+    if (k == 1) b[i] += q * random_below(bound/q);
+    if (pattern == 1) b[i] = bound - 1; // congruent to q - 1
+  }
+  memcpy(a, b, n * sizeof(uint64_t));
+
+  if (v->gs) {
+    inttmul64_16384_gs_rev2std_4step(b, tmp);
+  } else {
+    mulntt64_16384_ct_std2rev_4step(b, tmp);
+  }
+  for (i=0; i<n; i++) {
+    if (b[i] >= bound) {
+      printf("failed: %s: output out of range\n", v->name);
+      exit(1);
+    }
+  }
+  if (avx2_supported()) {
+    if (v->gs) {
+      inttmul64_16384_gs_rev2std_4step_asm(a, tmp);
+    } else {
+      mulntt64_16384_ct_std2rev_4step_asm(a, tmp);
+    }
+    check_equal(v->name, b, a, n);
+  }
+  ntt64_correct(b, n, q);
+  check_equal(v->name, c, b, n);
+}
+
+/*
+ * Tables for the direct NTTs of size n=16384 (2n elements, as
+ * built by make_tables64): p[t + j] = x^(n/2t) * y^(n/2t)^bitrev(j)
+ */
+static uint64_t mixed_powers_rev[2 * MAXN], inv_mixed_powers_rev[2 * MAXN];
+
+static void build_rev_table(uint64_t *p, uint32_t n, uint64_t q, uint64_t x, uint64_t y) {
+  uint64_t u, w;
+  uint32_t t, j;
+
+  p[0] = 0;
+  for (t=1; t<n; t <<= 1) {
+    u = powmod(x, n/(2*t), q);
+    w = powmod(y, n/(2*t), q);
+    for (j=0; j<t; j++) {
+      p[t + bitrev(j, t)] = mulmod(u, powmod(w, j, q), q);
+    }
+  }
+  for (j=0; j<n; j++) {
+    p[n + j] = (uint64_t) (((uint128_t) p[j] << 64) / q);
+  }
+}
+
+static void init_direct_tables(void) {
+  const size_info_t *s;
+
+  s = &size16384;
+  build_rev_table(mixed_powers_rev, s->n, s->q, s->psi, s->omega);
+  build_rev_table(inv_mixed_powers_rev, s->n, s->q, s->inv_psi, s->inv_omega);
+}
+
+static void test_4step(void) {
+  const size_info_t *s;
+  uint64_t q;
+  uint32_t k, n;
+
+  s = &size16384;
+  n = s->n;
+  q = s->q;
+  init_direct_tables();
+
+  printf("Testing %s: n = %"PRIu32"\n", mulntt_4step.name, n);
+  for (k=0; k<4; k++) {
+    test_4step_variant(&mulntt_4step, k);
+  }
+  printf("passed\n");
+
+  printf("Testing %s: n = %"PRIu32"\n", inttmul_4step.name, n);
+  for (k=0; k<4; k++) {
+    test_4step_variant(&inttmul_4step, k);
+  }
+  printf("passed\n");
+
+  // same results as the direct NTTs (after correction)
+  printf("Testing four-step vs. direct NTTs: n = %"PRIu32"\n", n);
+  for (k=0; k<10; k++) {
+    init_array(a, n, q, 0);
+    memcpy(b, a, n * sizeof(uint64_t));
+    mulntt64_16384_ct_std2rev_4step(a, tmp);
+    mulntt64_ct_std2rev(b, n, q, mixed_powers_rev);
+    ntt64_correct(a, n, q);
+    ntt64_correct(b, n, q);
+    check_equal("mulntt64_ct_std2rev", b, a, n);
+
+    inttmul64_16384_gs_rev2std_4step(a, tmp);
+    nttmul64_gs_rev2std(b, n, q, inv_mixed_powers_rev);
+    ntt64_scalar_mul_array(b, n, q, s->rescale, s->rescale_shoup);
+    ntt64_correct(a, n, q);
+    ntt64_correct(b, n, q);
+    check_equal("nttmul64_gs_rev2std", b, a, n);
+  }
+  printf("passed\n");
+
+  printf("Testing product_4step: n = %"PRIu32"\n", n);
+  for (k=0; k<2; k++) {
+    init_array(a, n, q, k == 1 ? 1 : 0);
+    init_array(b, n, q, 0);
+    naive_product(d, a, b, n, q);
+    memcpy(e, a, n * sizeof(uint64_t));
+    memcpy(tmp, b, n * sizeof(uint64_t));
+    ntt64_16384_product_4step(c, a, b);
+    check_equal("product_4step", d, c, n);
+    if (avx2_supported()) {
+      ntt64_16384_product_4step_asm(c, e, tmp);
+      check_equal("product_4step_asm", d, c, n);
+    }
+  }
+  printf("passed\n");
+}
+
+static void speed_test(const size_info_t *s) {
+  const variant_t *v;
+  uint64_t q, x;
+  uint32_t i, j, n;
+
+  n = s->n;
+  q = s->q;
+  for (j=0; j<NVARIANTS; j++) {
+    v = s->variant + j;
+    init_array(a, n, q, 0);
+    for (i=0; i<NTESTS; i++) {
+      x = cpucycles();
+      v->fun(a, n, q, v->p);
+      t[i] = cpucycles() - x;
+      ntt64_correct(a, n, q);
+    }
+    printf("speed test %s (n = %"PRIu32"): median = %"PRIu64"\n", v->name, n, median_time());
+    if (avx2_supported()) {
+      for (i=0; i<NTESTS; i++) {
+	x = cpucycles();
+	v->fun_asm(a, n, q, v->p);
+	t[i] = cpucycles() - x;
+	ntt64_correct_asm(a, n, q);
+      }
+      printf("speed test %s_asm (n = %"PRIu32"): median = %"PRIu64"\n", v->name, n, median_time());
+    }
+  }
+
+  for (j=0; j<NPRODUCTS; j++) {
+    if (j == NPRODUCTS - 1 && !avx2_supported()) break;
+    init_array(a, n, q, 0);
+    init_array(b, n, q, 0);
+    for (i=0; i<NTESTS; i++) {
+      x = cpucycles();
+      s->product[j](c, a, b);
+      t[i] = cpucycles() - x;
+      ntt64_correct(a, n, q);
+      ntt64_correct(b, n, q);
+    }
+    printf("speed test %s (n = %"PRIu32"): median = %"PRIu64"\n", product_name[j], n, median_time());
+  }
+  printf("\n");
+}
+
+/*
+ * Four-step vs. direct NTTs and products for n=16384
+ */
+static void speed_test_4step(void) {
+  const size_info_t *s;
+  uint64_t q, x;
+  uint32_t i, n;
+
+  s = &size16384;
+  n = s->n;
+  q = s->q;
+  init_array(a, n, q, 0);
+  init_array(b, n, q, 0);
+
+  for (i=0; i<NTESTS; i++) {
+    x = cpucycles();
+    mulntt64_ct_std2rev(a, n, q, mixed_powers_rev);
+    t[i] = cpucycles() - x;
+    ntt64_correct(a, n, q);
+  }
+  printf("speed test mulntt64_ct_std2rev (n = %"PRIu32"): median = %"PRIu64"\n", n, median_time());
+  for (i=0; i<NTESTS; i++) {
+    x = cpucycles();
+    mulntt64_16384_ct_std2rev_4step(a, tmp);
+    t[i] = cpucycles() - x;
+    ntt64_correct(a, n, q);
+  }
+  printf("speed test %s (n = %"PRIu32"): median = %"PRIu64"\n", mulntt_4step.name, n, median_time());
+  for (i=0; i<NTESTS; i++) {
+    x = cpucycles();
+    ntt64_16384_product_4step(c, a, b);
+    t[i] = cpucycles() - x;
+    ntt64_correct(a, n, q);
+    ntt64_correct(b, n, q);
+  }
+  printf("speed test product_4step (n = %"PRIu32"): median = %"PRIu64"\n", n, median_time());
+
+  if (avx2_supported()) {
+    for (i=0; i<NTESTS; i++) {
+      x = cpucycles();
+      mulntt64_ct_std2rev_asm(a, n, q, mixed_powers_rev);
+      t[i] = cpucycles() - x;
+      ntt64_correct_asm(a, n, q);
+    }
+    printf("speed test mulntt64_ct_std2rev_asm (n = %"PRIu32"): median = %"PRIu64"\n", n, median_time());
+    for (i=0; i<NTESTS; i++) {
+      x = cpucycles();
+      mulntt64_16384_ct_std2rev_4step_asm(a, tmp);
+      t[i] = cpucycles() - x;
+      ntt64_correct_asm(a, n, q);
+    }
+    printf("speed test %s_asm (n = %"PRIu32"): median = %"PRIu64"\n", mulntt_4step.name, n, median_time());
+    for (i=0; i<NTESTS; i++) {
+      x = cpucycles();
+      ntt64_16384_product_4step_asm(c, a, b);
+      t[i] = cpucycles() - x;
+      ntt64_correct_asm(a, n, q);
+      ntt64_correct_asm(b, n, q);
+    }
+    printf("speed test product_4step_asm (n = %"PRIu32"): median = %"PRIu64"\n", n, median_time());
+  }
+  printf("\n");
+}
+
+int main(void) {
+  test_size(&size1024);
+  test_size(&size4096);
+  test_4step();
+  printf("\n");
+
+  speed_test(&size1024);
+  speed_test(&size4096);
+  speed_test_4step();
+
+  return 0;
+}
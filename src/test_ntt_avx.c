@@ -196,6 +196,7 @@ static void cross_check(const char *name, uint32_t n, void (*f)(int32_t *), void
 
 // global buffers used for speed tests. alignment matters (for speed)
 static int32_t a[2048] __attribute__ ((aligned(32)));
+static int32_t b[2048] __attribute__ ((aligned(32)));
 static int16_t p[2048] __attribute__ ((aligned(32)));
 
 #if 0
@@ -1008,6 +1009,373 @@ static void tests2048(void) {
 }
 
 
+/*
+ * FUSED FORWARD TRANSFORMS
+ */
+
+/*
+ * Reference versions: unfused sequences from ntt_red.h
+ */
+static void ntt_ct_std2rev_fused_base(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mul_reduce_array16(a, n, s);
+  ntt_red_ct_std2rev(a, n, p);
+  reduce_array(a, n);
+}
+
+static void ntt_gs_std2rev_fused_base(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mul_reduce_array16(a, n, s);
+  ntt_red_gs_std2rev(a, n, p);
+  reduce_array(a, n);
+}
+
+static void mulntt_ct_std2rev_fused_base(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mulntt_red_ct_std2rev(a, n, p);
+  reduce_array(a, n);
+}
+
+static void mulntt_ct_std2rev_fused_asm(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mulntt_red_ct_std2rev_fused_asm(a, n, p);
+}
+
+/*
+ * Cross check for functions of the form f(a, n, p, s)
+ * - p = table for the NTT
+ * - s = table for the product before the NTT
+ */
+static void cross_check_fused(const char *name, uint32_t n, const int16_t *p, const int16_t *s,
+			      void (*f)(int32_t *, uint32_t, const int16_t *, const int16_t *),
+			      void (*g)(int32_t *, uint32_t, const int16_t *, const int16_t *)) {
+  int32_t a[n], b[n], c[n];
+  uint32_t j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<10000; j++) {
+    random_array(a, n);
+    copy_array(b, a, n);
+    copy_array(c, a, n); // keep a copy in case of error
+    f(a, n, p, s);
+    g(b, n, p, s);
+    if (!equal_arrays(a, b, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, c, n);
+      printf("--> output:\n");
+      print_array(stdout, a, n);
+      printf("correct result:\n");
+      print_array(stdout, b, n);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_fused(uint32_t n, const int16_t *p, const int16_t *p_rev, const int16_t *mixed_rev) {
+  printf("===== Fused transforms: size %"PRIu32" =====\n", n);
+  cross_check_fused("ntt_red_ct_std2rev_fused_asm", n, p_rev, mixed_rev, ntt_red_ct_std2rev_fused_asm, ntt_ct_std2rev_fused_base);
+  cross_check_fused("ntt_red_gs_std2rev_fused_asm", n, p, mixed_rev, ntt_red_gs_std2rev_fused_asm, ntt_gs_std2rev_fused_base);
+  cross_check_fused("mulntt_red_ct_std2rev_fused_asm", n, mixed_rev, NULL, mulntt_ct_std2rev_fused_asm, mulntt_ct_std2rev_fused_base);
+  printf("\n");
+}
+
+/*
+ * Two-operand forward transform: must give the same result as
+ * mulntt_red_ct_std2rev_fused_asm on a then on b.
+ */
+static void cross_check_fused2(uint32_t n, const int16_t *mixed_rev) {
+  int32_t a1[n], b1[n], a2[n], b2[n];
+  uint32_t j;
+
+  printf("Testing mulntt_red_ct_std2rev_fused2_asm: n = %"PRIu32"\n", n);
+  for (j=0; j<10000; j++) {
+    random_array(a1, n);
+    random_array(b1, n);
+    copy_array(a2, a1, n);
+    copy_array(b2, b1, n);
+    mulntt_red_ct_std2rev_fused2_asm(a1, b1, n, mixed_rev);
+    mulntt_red_ct_std2rev_fused_asm(a2, n, mixed_rev);
+    mulntt_red_ct_std2rev_fused_asm(b2, n, mixed_rev);
+    if (!equal_arrays(a1, a2, n) || !equal_arrays(b1, b2, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n");
+}
+
+/*
+ * Time for transforming two arrays: two calls to the one-operand function
+ * or one call to the two-operand function.
+ */
+static void speed_test_fused2(uint32_t n, bool lockstep) {
+  uint32_t i;
+  uint64_t avg, med, c;
+
+  random_array(a, n);
+  random_array(b, n);
+  random_array16(p, n);
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    if (lockstep) {
+      mulntt_red_ct_std2rev_fused2_asm(a, b, n, p);
+    } else {
+      mulntt_red_ct_std2rev_fused_asm(a, n, p);
+      mulntt_red_ct_std2rev_fused_asm(b, n, p);
+    }
+  }
+  c = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i]; 
+  }
+  t[i] = c - t[i];
+
+  avg = average_time();
+  med = median_time();
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64", average = %"PRIu64"\n",
+         lockstep ? "mulntt_red_ct_std2rev_fused2_asm(a, b)" : "mulntt_red_ct_std2rev_fused_asm(a) + (b)", n, med, avg);
+}
+
+static void tests_fused2(uint32_t n, const int16_t *mixed_rev) {
+  printf("===== Two-operand fused transform: size %"PRIu32" =====\n", n);
+  cross_check_fused2(n, mixed_rev);
+  speed_test_fused2(n, false);
+  speed_test_fused2(n, true);
+  printf("\n");
+}
+
+/*
+ * REGISTER-RESIDENT FORWARD TRANSFORMS
+ */
+static void mulntt_ct_std2rev_reduce_base(int32_t *a, uint32_t n, const int16_t *p) {
+  mulntt_red_ct_std2rev(a, n, p);
+  reduce_array(a, n);
+}
+
+/*
+ * Cross check for functions of the form f(a, n, p)
+ */
+static void cross_check_reg(const char *name, uint32_t n, const int16_t *p,
+			    void (*f)(int32_t *, uint32_t, const int16_t *),
+			    void (*g)(int32_t *, uint32_t, const int16_t *)) {
+  int32_t a[n], b[n], c[n];
+  uint32_t j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<10000; j++) {
+    random_array(a, n);
+    copy_array(b, a, n);
+    copy_array(c, a, n); // keep a copy in case of error
+    f(a, n, p);
+    g(b, n, p);
+    if (!equal_arrays(a, b, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, c, n);
+      printf("--> output:\n");
+      print_array(stdout, a, n);
+      printf("correct result:\n");
+      print_array(stdout, b, n);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n");
+}
+
+/*
+ * p_rev = table for ntt_red_ct_std2rev or NULL if there's no table of size n.
+ * The mulntt variants are checked with a random table.
+ */
+static void tests_reg(uint32_t n, const int16_t *p_rev) {
+  int16_t r[n];
+
+  printf("===== Register-resident transforms: size %"PRIu32" =====\n", n);
+  if (p_rev != NULL) {
+    cross_check_reg("ntt_red_ct_std2rev_reg_asm", n, p_rev, ntt_red_ct_std2rev_reg_asm, ntt_red_ct_std2rev);
+  }
+  random_array16(r, n);
+  cross_check_reg("mulntt_red_ct_std2rev_reg_asm", n, r, mulntt_red_ct_std2rev_reg_asm, mulntt_red_ct_std2rev);
+  cross_check_reg("mulntt_red_ct_std2rev_reg_fused_asm", n, r, mulntt_red_ct_std2rev_reg_fused_asm, mulntt_ct_std2rev_reduce_base);
+  speed_test2("mulntt_red_ct_std2rev_asm", n, mulntt_red_ct_std2rev_asm);
+  speed_test2("mulntt_red_ct_std2rev_reg_asm", n, mulntt_red_ct_std2rev_reg_asm);
+  speed_test2("mulntt_red_ct_std2rev_fused_asm", n, mulntt_red_ct_std2rev_fused_asm);
+  speed_test2("mulntt_red_ct_std2rev_reg_fused_asm", n, mulntt_red_ct_std2rev_reg_fused_asm);
+  printf("\n");
+}
+
+/*
+ * FUSED POINTWISE PRODUCT + INVERSE TRANSFORMS
+ */
+static void pointwise_ct_rev2std_base(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p) {
+  mul_reduce_array(c, n, a, b);
+  reduce_array_twice(c, n);
+  ntt_red_ct_rev2std(c, n, p);
+}
+
+static void pointwise_gs_rev2std_base(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p) {
+  mul_reduce_array(c, n, a, b);
+  reduce_array_twice(c, n);
+  ntt_red_gs_rev2std(c, n, p);
+}
+
+static void pointwise_nttmul_gs_rev2std_base(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b, const int16_t *p) {
+  mul_reduce_array(c, n, a, b);
+  reduce_array_twice(c, n);
+  nttmul_red_gs_rev2std(c, n, p);
+}
+
+/*
+ * Cross check for functions of the form f(c, n, a, b, p)
+ */
+static void cross_check_pointwise(const char *name, uint32_t n, const int16_t *p,
+				  void (*f)(int32_t *, uint32_t, const int32_t *, const int32_t *, const int16_t *),
+				  void (*g)(int32_t *, uint32_t, const int32_t *, const int32_t *, const int16_t *)) {
+  int32_t a[n], b[n], c[n], d[n];
+  uint32_t j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<10000; j++) {
+    random_array(a, n);
+    random_array(b, n);
+    f(c, n, a, b, p);
+    g(d, n, a, b, p);
+    if (!equal_arrays(c, d, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input a:\n");
+      print_array(stdout, a, n);
+      printf("--> input b:\n");
+      print_array(stdout, b, n);
+      printf("--> output:\n");
+      print_array(stdout, c, n);
+      printf("correct result:\n");
+      print_array(stdout, d, n);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_pointwise(uint32_t n, const int16_t *p, const int16_t *p_rev, const int16_t *mixed_rev) {
+  printf("===== Fused pointwise product + inverse transforms: size %"PRIu32" =====\n", n);
+  cross_check_pointwise("pointwise_ntt_red_ct_rev2std_asm", n, p, pointwise_ntt_red_ct_rev2std_asm, pointwise_ct_rev2std_base);
+  cross_check_pointwise("pointwise_ntt_red_gs_rev2std_asm", n, p_rev, pointwise_ntt_red_gs_rev2std_asm, pointwise_gs_rev2std_base);
+  cross_check_pointwise("pointwise_nttmul_red_gs_rev2std_asm", n, mixed_rev, pointwise_nttmul_red_gs_rev2std_asm, pointwise_nttmul_gs_rev2std_base);
+  printf("\n");
+}
+
+/*
+ * FINALIZE FUNCTIONS
+ */
+static void mul_reduce_finalize_base(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mul_reduce_array16(a, n, p);
+  reduce_array_twice(a, n);
+  correct(a, n);
+}
+
+static void mul_reduce_finalize_c(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mul_reduce_finalize(a, n, p);
+}
+
+static void mul_reduce_finalize_avx(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  mul_reduce_finalize_asm(a, n, p);
+}
+
+static int32_t scalar;
+
+static void scalar_mul_reduce_finalize_base(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  scalar_mul_reduce_array(a, n, scalar);
+  reduce_array_twice(a, n);
+  correct(a, n);
+}
+
+static void scalar_mul_reduce_finalize_c(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  scalar_mul_reduce_finalize(a, n, scalar);
+}
+
+static void scalar_mul_reduce_finalize_avx(int32_t *a, uint32_t n, const int16_t *p, const int16_t *s) {
+  scalar_mul_reduce_finalize_asm(a, n, scalar);
+}
+
+static void tests_finalize(uint32_t n, const int16_t *p) {
+  static const int32_t scalars[6] = { 1, -1, 8193, 12288, -6144, 6144 };
+  uint32_t i;
+
+  printf("===== Finalize: size %"PRIu32" =====\n", n);
+  cross_check_fused("mul_reduce_finalize", n, p, NULL, mul_reduce_finalize_c, mul_reduce_finalize_base);
+  cross_check_fused("mul_reduce_finalize_asm", n, p, NULL, mul_reduce_finalize_avx, mul_reduce_finalize_base);
+  for (i=0; i<6; i++) {
+    scalar = scalars[i];
+    printf("scalar = %"PRId32"\n", scalar);
+    cross_check_fused("scalar_mul_reduce_finalize", n, NULL, NULL, scalar_mul_reduce_finalize_c, scalar_mul_reduce_finalize_base);
+    cross_check_fused("scalar_mul_reduce_finalize_asm", n, NULL, NULL, scalar_mul_reduce_finalize_avx, scalar_mul_reduce_finalize_base);
+  }
+  printf("\n");
+}
+
+/*
+ * vpmulld variants: the result is 3^k times the NTT computed by the oracle
+ * - the input must be in [-21499, 21499] to avoid overflow
+ */
+static void random_array_mulld(int32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = random_coeff(21499);
+  }
+}
+
+// check whether a[i] == c * b[i] modulo Q for i=0 ... n-1
+static bool equal_mod_q(const int32_t *a, const int32_t *b, int64_t c, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if ((a[i] - c * b[i]) % Q != 0) return false;
+  }
+  return true;
+}
+
+static void cross_check_mulld(const char *name, uint32_t n, const int16_t *p, int64_t c,
+                              void (*f)(int32_t *, uint32_t, const int16_t *),
+                              void (*g)(int32_t *, uint32_t, const int16_t *)) {
+  int32_t a[n], b[n], d[n];
+  uint32_t j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<10000; j++) {
+    random_array_mulld(a, n);
+    copy_array(b, a, n);
+    copy_array(d, a, n); // keep a copy in case of error
+    f(a, n, p);
+    g(b, n, p);
+    if (!equal_mod_q(a, b, c, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, d, n);
+      printf("--> output:\n");
+      print_array(stdout, a, n);
+      printf("correct result (before scaling by %"PRId64"):\n", c);
+      print_array(stdout, b, n);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_mulld(uint32_t n, const int16_t *p, const int16_t *p_rev) {
+  int64_t c;
+
+  // c = 3^k where k = number of reductions = 1 for n <= 128, 2 for n <= 2048
+  c = (n <= 128) ? 3 : 9;
+
+  printf("===== vpmulld variants: size %"PRIu32" =====\n", n);
+  cross_check_mulld("ntt_red_ct_rev2std_mulld_asm", n, p, c, ntt_red_ct_rev2std_mulld_asm, ntt_red_ct_rev2std);
+  speed_test2("ntt_red_ct_rev2std_asm", n, ntt_red_ct_rev2std_asm);
+  speed_test2("ntt_red_ct_rev2std_mulld_asm", n, ntt_red_ct_rev2std_mulld_asm);
+  cross_check_mulld("ntt_red_ct_std2rev_mulld_asm", n, p_rev, c, ntt_red_ct_std2rev_mulld_asm, ntt_red_ct_std2rev);
+  speed_test2("ntt_red_ct_std2rev_asm", n, ntt_red_ct_std2rev_asm);
+  speed_test2("ntt_red_ct_std2rev_mulld_asm", n, ntt_red_ct_std2rev_mulld_asm);
+  printf("\n");
+}
+
 static void run_tests(void) {
   tests16();
   tests128();
@@ -1015,6 +1383,50 @@ static void run_tests(void) {
   tests512();
   tests1024();
   tests2048();
+
+  tests_fused(16, shoup_sred_ntt16_12289, rev_shoup_sred_ntt16_12289, rev_shoup_sred_scaled_ntt16_12289);
+  tests_fused(128, shoup_sred_ntt128_12289, rev_shoup_sred_ntt128_12289, rev_shoup_sred_scaled_ntt128_12289);
+  tests_fused(256, shoup_sred_ntt256_12289, rev_shoup_sred_ntt256_12289, rev_shoup_sred_scaled_ntt256_12289);
+  tests_fused(512, shoup_sred_ntt512_12289, rev_shoup_sred_ntt512_12289, rev_shoup_sred_scaled_ntt512_12289);
+  tests_fused(1024, shoup_sred_ntt1024_12289, rev_shoup_sred_ntt1024_12289, rev_shoup_sred_scaled_ntt1024_12289);
+  tests_fused(2048, shoup_sred_ntt2048_12289, rev_shoup_sred_ntt2048_12289, rev_shoup_sred_scaled_ntt2048_12289);
+
+  tests_fused2(16, rev_shoup_sred_scaled_ntt16_12289);
+  tests_fused2(128, rev_shoup_sred_scaled_ntt128_12289);
+  tests_fused2(256, rev_shoup_sred_scaled_ntt256_12289);
+  tests_fused2(512, rev_shoup_sred_scaled_ntt512_12289);
+  tests_fused2(1024, rev_shoup_sred_scaled_ntt1024_12289);
+  tests_fused2(2048, rev_shoup_sred_scaled_ntt2048_12289);
+
+  tests_reg(16, rev_shoup_sred_ntt16_12289);
+  tests_reg(32, NULL);
+  tests_reg(64, NULL);
+  tests_reg(128, rev_shoup_sred_ntt128_12289);
+  tests_reg(256, rev_shoup_sred_ntt256_12289);
+  tests_reg(512, rev_shoup_sred_ntt512_12289);
+  tests_reg(1024, rev_shoup_sred_ntt1024_12289);
+  tests_reg(2048, rev_shoup_sred_ntt2048_12289);
+
+  tests_pointwise(16, shoup_sred_ntt16_12289, rev_shoup_sred_ntt16_12289, rev_shoup_sred_scaled_ntt16_12289);
+  tests_pointwise(128, shoup_sred_ntt128_12289, rev_shoup_sred_ntt128_12289, rev_shoup_sred_scaled_ntt128_12289);
+  tests_pointwise(256, shoup_sred_ntt256_12289, rev_shoup_sred_ntt256_12289, rev_shoup_sred_scaled_ntt256_12289);
+  tests_pointwise(512, shoup_sred_ntt512_12289, rev_shoup_sred_ntt512_12289, rev_shoup_sred_scaled_ntt512_12289);
+  tests_pointwise(1024, shoup_sred_ntt1024_12289, rev_shoup_sred_ntt1024_12289, rev_shoup_sred_scaled_ntt1024_12289);
+  tests_pointwise(2048, shoup_sred_ntt2048_12289, rev_shoup_sred_ntt2048_12289, rev_shoup_sred_scaled_ntt2048_12289);
+
+  tests_finalize(16, rev_shoup_sred_scaled_ntt16_12289);
+  tests_finalize(128, rev_shoup_sred_scaled_ntt128_12289);
+  tests_finalize(256, rev_shoup_sred_scaled_ntt256_12289);
+  tests_finalize(512, rev_shoup_sred_scaled_ntt512_12289);
+  tests_finalize(1024, rev_shoup_sred_scaled_ntt1024_12289);
+  tests_finalize(2048, rev_shoup_sred_scaled_ntt2048_12289);
+
+  tests_mulld(16, shoup_sred_ntt16_12289, rev_shoup_sred_ntt16_12289);
+  tests_mulld(128, shoup_sred_ntt128_12289, rev_shoup_sred_ntt128_12289);
+  tests_mulld(256, shoup_sred_ntt256_12289, rev_shoup_sred_ntt256_12289);
+  tests_mulld(512, shoup_sred_ntt512_12289, rev_shoup_sred_ntt512_12289);
+  tests_mulld(1024, shoup_sred_ntt1024_12289, rev_shoup_sred_ntt1024_12289);
+  tests_mulld(2048, shoup_sred_ntt2048_12289, rev_shoup_sred_ntt2048_12289);
 }
 
 int main(void) {
@@ -0,0 +1,321 @@
+/*
+ * Tests of the batched NTT functions
+ * - pack/unpack
+ * - each lane of the batched NTTs is checked against ntt_red.c or ntt_short.c
+ * - batched products are checked against the single-polynomial products
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_red.h"
+#include "ntt_short.h"
+#include "ntt_red16_tables.h"
+#include "ntt_red256_tables.h"
+#include "ntt_red512_tables.h"
+#include "ntt_red_asm1024.h"
+#include "ntt_short_asm1024.h"
+#include "ntt_batch_asm1024.h"
+
+#define Q 12289
+
+/*
+ * Random integer in the range [-n, n]
+ */
+static int32_t random_coeff(int32_t n) {
+  int32_t x;
+
+  assert(n > 0);
+
+  x = random() % (2 * n + 1);
+  x -= n;
+  assert(-n <= x && x <= n);
+  return x;
+}
+
+/*
+ * Barrett companion of w (for the 16-bit tables)
+ */
+static int16_t barrett_companion(int32_t w) {
+  int32_t x;
+
+  x = w * 32768;
+  return (x >= 0) ? (x + Q/2)/Q : - ((- x + Q/2)/Q);
+}
+
+/*
+ * Random table of 2n constants for the 16-bit functions
+ */
+static void random_table16(int16_t *p, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    p[i] = random_coeff(6144);
+    p[n + i] = barrett_companion(p[i]);
+  }
+}
+
+
+/*
+ * PACK/UNPACK
+ */
+static int32_t a32[16][2048] __attribute__ ((aligned(32)));
+static int32_t b32[16][2048] __attribute__ ((aligned(32)));
+static int32_t c32[16][2048] __attribute__ ((aligned(32)));
+static int32_t soa32[3][8 * 2048] __attribute__ ((aligned(32)));
+
+static int16_t a16[16][2048] __attribute__ ((aligned(32)));
+static int16_t b16[16][2048] __attribute__ ((aligned(32)));
+static int16_t c16[16][2048] __attribute__ ((aligned(32)));
+static int16_t soa16[3][16 * 2048] __attribute__ ((aligned(32)));
+
+static void test_pack8(uint32_t n) {
+  int32_t *a[8], *b[8];
+  uint32_t i, k;
+
+  printf("Testing ntt_red_batch8_pack/unpack: n = %"PRIu32"\n", n);
+  for (k=0; k<8; k++) {
+    a[k] = a32[k];
+    b[k] = b32[k];
+    for (i=0; i<n; i++) {
+      a32[k][i] = random();
+    }
+  }
+  ntt_red_batch8_pack_asm(soa32[0], a, n);
+  for (k=0; k<8; k++) {
+    for (i=0; i<n; i++) {
+      if (soa32[0][8 * i + k] != a32[k][i]) {
+	printf("failed: pack (polynomial %"PRIu32", index %"PRIu32")\n", k, i);
+	exit(1);
+      }
+    }
+  }
+  ntt_red_batch8_unpack_asm(b, soa32[0], n);
+  for (k=0; k<8; k++) {
+    for (i=0; i<n; i++) {
+      if (b32[k][i] != a32[k][i]) {
+	printf("failed: unpack (polynomial %"PRIu32", index %"PRIu32")\n", k, i);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void test_pack16(uint32_t n) {
+  int16_t *a[16], *b[16];
+  uint32_t i, k;
+
+  printf("Testing ntt_short_batch16_pack/unpack: n = %"PRIu32"\n", n);
+  for (k=0; k<16; k++) {
+    a[k] = a16[k];
+    b[k] = b16[k];
+    for (i=0; i<n; i++) {
+      a16[k][i] = random();
+    }
+  }
+  ntt_short_batch16_pack_asm(soa16[0], a, n);
+  for (k=0; k<16; k++) {
+    for (i=0; i<n; i++) {
+      if (soa16[0][16 * i + k] != a16[k][i]) {
+	printf("failed: pack (polynomial %"PRIu32", index %"PRIu32")\n", k, i);
+	exit(1);
+      }
+    }
+  }
+  ntt_short_batch16_unpack_asm(b, soa16[0], n);
+  for (k=0; k<16; k++) {
+    for (i=0; i<n; i++) {
+      if (b16[k][i] != a16[k][i]) {
+	printf("failed: unpack (polynomial %"PRIu32", index %"PRIu32")\n", k, i);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+
+/*
+ * BATCHED NTT: 32-BIT COEFFICIENTS
+ *
+ * f = batched function, g = reference function.
+ * The SoA array is built and read directly so that any n >= 2 can be tested.
+ */
+static void check_batch8(const char *name, uint32_t n, const int16_t *p, int32_t bound,
+			 void (*f)(int32_t *, uint32_t, const int16_t *),
+			 void (*g)(int32_t *, uint32_t, const int16_t *)) {
+  uint32_t i, j, k;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<1000; j++) {
+    for (k=0; k<8; k++) {
+      for (i=0; i<n; i++) {
+	a32[k][i] = (j == 0) ? bound : random_coeff(bound);
+	soa32[0][8 * i + k] = a32[k][i];
+      }
+      g(a32[k], n, p);
+    }
+    f(soa32[0], n, p);
+    for (k=0; k<8; k++) {
+      for (i=0; i<n; i++) {
+	if (soa32[0][8 * i + k] != a32[k][i]) {
+	  printf("failed on test %"PRIu32" (polynomial %"PRIu32", index %"PRIu32")\n", j, k, i);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_batch8(uint32_t n, const int16_t *omega_powers_rev, const int16_t *mixed_powers_rev,
+			 const int16_t *inv_mixed_powers_rev) {
+  printf("===== batch8: size %"PRIu32" =====\n", n);
+  check_batch8("ntt_red_batch8_ct_std2rev_asm", n, omega_powers_rev, 12288,
+	       ntt_red_batch8_ct_std2rev_asm, ntt_red_ct_std2rev);
+  check_batch8("mulntt_red_batch8_ct_std2rev_asm", n, mixed_powers_rev, 12288,
+	       mulntt_red_batch8_ct_std2rev_asm, mulntt_red_ct_std2rev);
+  check_batch8("ntt_red_batch8_gs_rev2std_asm", n, omega_powers_rev, 12288,
+	       ntt_red_batch8_gs_rev2std_asm, ntt_red_gs_rev2std);
+  check_batch8("nttmul_red_batch8_gs_rev2std_asm", n, inv_mixed_powers_rev, 12288,
+	       nttmul_red_batch8_gs_rev2std_asm, nttmul_red_gs_rev2std);
+  printf("\n");
+}
+
+
+/*
+ * BATCHED NTT: 16-BIT COEFFICIENTS
+ * - random tables
+ */
+static void check_batch16(const char *name, uint32_t n, int32_t bound,
+			  void (*f)(int16_t *, uint32_t, const int16_t *),
+			  void (*g)(int16_t *, uint32_t, const int16_t *)) {
+  int16_t p[2 * n];
+  uint32_t i, j, k;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<1000; j++) {
+    random_table16(p, n);
+    for (k=0; k<16; k++) {
+      for (i=0; i<n; i++) {
+	a16[k][i] = (j == 0) ? bound : random_coeff(bound);
+	soa16[0][16 * i + k] = a16[k][i];
+      }
+      g(a16[k], n, p);
+    }
+    f(soa16[0], n, p);
+    for (k=0; k<16; k++) {
+      for (i=0; i<n; i++) {
+	if (soa16[0][16 * i + k] != a16[k][i]) {
+	  printf("failed on test %"PRIu32" (polynomial %"PRIu32", index %"PRIu32")\n", j, k, i);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_batch16(uint32_t n) {
+  printf("===== batch16: size %"PRIu32" =====\n", n);
+  check_batch16("ntt_short_batch16_ct_std2rev_asm", n, 12289,
+		ntt_short_batch16_ct_std2rev_asm, ntt_short_ct_std2rev);
+  check_batch16("ntt_short_batch16_gs_rev2std_asm", n, 16383,
+		ntt_short_batch16_gs_rev2std_asm, ntt_short_gs_rev2std);
+  printf("\n");
+}
+
+
+/*
+ * PRODUCTS
+ */
+static void test_products(void) {
+  int32_t *a[8], *b[8];
+  int16_t *a_s[16], *b_s[16];
+  uint32_t i, j, k;
+
+  printf("Testing ntt_red1024_batch8_product5_asm\n");
+  for (k=0; k<8; k++) {
+    a[k] = a32[k];
+    b[k] = b32[k];
+  }
+  for (j=0; j<1000; j++) {
+    for (k=0; k<8; k++) {
+      for (i=0; i<1024; i++) {
+	a32[k][i] = random() % Q;
+	b32[k][i] = random() % Q;
+      }
+    }
+    ntt_red1024_batch8_pack_asm(soa32[0], a);
+    ntt_red1024_batch8_pack_asm(soa32[1], b);
+    ntt_red1024_batch8_product5_asm(soa32[2], soa32[0], soa32[1]);
+    for (k=0; k<8; k++) {
+      ntt_red1024_product5_asm(c32[k], a32[k], b32[k]);
+    }
+    ntt_red1024_batch8_unpack_asm(a, soa32[2]);
+    for (k=0; k<8; k++) {
+      for (i=0; i<1024; i++) {
+	if (a32[k][i] != c32[k][i]) {
+	  printf("failed on test %"PRIu32" (polynomial %"PRIu32", index %"PRIu32")\n", j, k, i);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n");
+
+  printf("Testing ntt_short1024_batch16_product5_asm\n");
+  for (k=0; k<16; k++) {
+    a_s[k] = a16[k];
+    b_s[k] = b16[k];
+  }
+  for (j=0; j<1000; j++) {
+    for (k=0; k<16; k++) {
+      for (i=0; i<1024; i++) {
+	a16[k][i] = random() % Q;
+	b16[k][i] = random() % Q;
+      }
+    }
+    ntt_short1024_batch16_pack_asm(soa16[0], a_s);
+    ntt_short1024_batch16_pack_asm(soa16[1], b_s);
+    ntt_short1024_batch16_product5_asm(soa16[2], soa16[0], soa16[1]);
+    for (k=0; k<16; k++) {
+      ntt_short1024_product5_asm(c16[k], a16[k], b16[k]);
+    }
+    ntt_short1024_batch16_unpack_asm(a_s, soa16[2]);
+    for (k=0; k<16; k++) {
+      for (i=0; i<1024; i++) {
+	if (a16[k][i] != c16[k][i]) {
+	  printf("failed on test %"PRIu32" (polynomial %"PRIu32", index %"PRIu32")\n", j, k, i);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+
+int main(void) {
+  uint32_t n;
+
+  if (avx2_supported()) {
+    printf("AVX2 is supported\n\n");
+    for (n=8; n<=2048; n<<=1) test_pack8(n);
+    for (n=16; n<=2048; n<<=1) test_pack16(n);
+    printf("\n");
+    tests_batch8(16, ntt_red16_omega_powers_rev, ntt_red16_mixed_powers_rev, ntt_red16_inv_mixed_powers_rev);
+    tests_batch8(256, ntt_red256_omega_powers_rev, ntt_red256_mixed_powers_rev, ntt_red256_inv_mixed_powers_rev);
+    tests_batch8(512, ntt_red512_omega_powers_rev, ntt_red512_mixed_powers_rev, ntt_red512_inv_mixed_powers_rev);
+    tests_batch8(1024, ntt_red1024_omega_powers_rev, ntt_red1024_mixed_powers_rev, ntt_red1024_inv_mixed_powers_rev);
+    for (n=2; n<=2048; n<<=1) tests_batch16(n);
+    test_products();
+  } else {
+    printf("AVX2 is not supported\n");
+  }
+  return 0;
+}
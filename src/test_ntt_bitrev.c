@@ -0,0 +1,169 @@
+/*
+ * Tests of the blocked bit-reverse permutations
+ * - bitrev_shuffle_cobra and bitrev_copy_cobra (and the AVX2 versions)
+ *   are compared with bitrev_shuffle for n = 1 to 2^20
+ * - speed comparison with bitrev_shuffle and shuffle_with_table
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt.h"
+#include "ntt_asm.h"
+#include "ntt_bitrev.h"
+#include "bitrev256_table.h"
+#include "bitrev512_table.h"
+#include "bitrev1024_table.h"
+#include "sort.h"
+
+#define MAX_N (1024 * 1024)
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 201
+
+static uint64_t t[NTESTS];
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+static int32_t a[MAX_N] __attribute__ ((aligned(32)));
+static int32_t b[MAX_N] __attribute__ ((aligned(32)));
+static int32_t c[MAX_N] __attribute__ ((aligned(32)));
+
+static void init_arrays(uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = random();
+    b[i] = a[i];
+    c[i] = -1;
+  }
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+static void test_shuffle(const char *name, void (*f)(int32_t *, uint32_t)) {
+  uint32_t n;
+
+  printf("Testing %s\n", name);
+  for (n=1; n<=MAX_N; n <<= 1) {
+    init_arrays(n);
+    bitrev_shuffle(a, n);
+    f(b, n);
+    if (! equal_arrays(a, b, n)) {
+      printf("failed: n = %"PRIu32"\n", n);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+static void test_copy(const char *name, void (*f)(int32_t *, const int32_t *, uint32_t)) {
+  uint32_t n;
+
+  printf("Testing %s\n", name);
+  for (n=1; n<=MAX_N; n <<= 1) {
+    init_arrays(n);
+    f(c, b, n);
+    if (! equal_arrays(a, b, n)) {
+      printf("failed: input modified (n = %"PRIu32")\n", n);
+      exit(1);
+    }
+    bitrev_shuffle(a, n);
+    if (! equal_arrays(a, c, n)) {
+      printf("failed: n = %"PRIu32"\n", n);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+
+/*
+ * Speed tests
+ */
+static void shuffle_table256(int32_t *x, uint32_t n) {
+  shuffle_with_table(x, bitrev256, BITREV256_NPAIRS);
+}
+
+static void shuffle_table512(int32_t *x, uint32_t n) {
+  shuffle_with_table(x, bitrev512, BITREV512_NPAIRS);
+}
+
+static void shuffle_table1024(int32_t *x, uint32_t n) {
+  shuffle_with_table(x, bitrev1024, BITREV1024_NPAIRS);
+}
+
+static void copy_cobra(int32_t *x, uint32_t n) {
+  bitrev_copy_cobra(c, x, n);
+}
+
+static void copy_cobra_asm(int32_t *x, uint32_t n) {
+  bitrev_copy_cobra_asm(c, x, n);
+}
+
+static void speed_test(const char *name, uint32_t n, void (*f)(int32_t *, uint32_t)) {
+  uint32_t i;
+  uint64_t c0;
+
+  init_arrays(n);
+  for (i=0; i<NTESTS; i++) {
+    c0 = cpucycles();
+    f(a, n);
+    t[i] = cpucycles() - c0;
+  }
+  printf("%-26s n = %7"PRIu32": median = %10"PRIu64"\n", name, n, median_time());
+}
+
+int main(void) {
+  bool avx2;
+  uint32_t n;
+
+  avx2 = avx2_supported();
+  test_shuffle("bitrev_shuffle_cobra", bitrev_shuffle_cobra);
+  test_copy("bitrev_copy_cobra", bitrev_copy_cobra);
+  if (avx2) {
+    test_shuffle("bitrev_shuffle_cobra_asm", bitrev_shuffle_cobra_asm);
+    test_copy("bitrev_copy_cobra_asm", bitrev_copy_cobra_asm);
+  } else {
+    printf("AVX2 is not supported\n\n");
+  }
+
+  for (n=256; n<=MAX_N; n <<= 1) {
+    speed_test("bitrev_shuffle", n, bitrev_shuffle);
+    switch (n) {
+    case 256: speed_test("shuffle_with_table", n, shuffle_table256); break;
+    case 512: speed_test("shuffle_with_table", n, shuffle_table512); break;
+    case 1024: speed_test("shuffle_with_table", n, shuffle_table1024); break;
+    }
+    speed_test("bitrev_shuffle_cobra", n, bitrev_shuffle_cobra);
+    speed_test("bitrev_copy_cobra", n, copy_cobra);
+    if (avx2) {
+      speed_test("bitrev_shuffle_cobra_asm", n, bitrev_shuffle_cobra_asm);
+      speed_test("bitrev_copy_cobra_asm", n, copy_cobra_asm);
+    }
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,777 @@
+/*
+ * Tests of the NTT functions with Shoup multiplication
+ * - tables: constants in [0, Q-1] with the right Shoup companions
+ * - lazy bounds: mul_shoup is in [0, 2Q-1] for any 32-bit input, the
+ *   Cooley-Tukey outputs stay in [0, 4Q-1] and the Gentleman-Sande
+ *   outputs in [0, 2Q-1], and these ranges are actually used
+ * - ntt_harvey.c: checked against the definition of NTT
+ * - ntt_harvey_asm.S: checked against ntt_harvey.c
+ * - speed comparison with the 16-bit and 32-bit AVX2 functions
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_harvey.h"
+#include "ntt_harvey_asm.h"
+#include "ntt_harvey1024_tables.h"
+#include "ntt_short_asm.h"
+#include "ntt_short1024_tables.h"
+#include "ntt_asm.h"
+#include "ntt_red1024_tables.h"
+#include "sort.h"
+
+#define Q 12289
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 102400
+
+static uint64_t t[NTESTS];
+
+// Average run time
+static uint64_t average_time(void) {
+  uint64_t s;
+  uint32_t i;
+
+  s = 0;
+  for (i=0; i<NTESTS; i++) {
+    s += t[i];
+  }
+  return s/NTESTS;
+}
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+
+/*
+ * Print array of size n
+ */
+static void print_array(FILE *f, const uint32_t *a, int32_t n) {
+  uint32_t i, k;
+
+  k = 0;
+  for (i=0; i<n; i++) {
+    if (k == 0) fprintf(f, "  ");
+    fprintf(f, "%6"PRIu32, a[i]);
+    k ++;
+    if (k == 16) {
+      fprintf(f, "\n");
+      k = 0;
+    } else {
+      fprintf(f, " ");
+    }
+  }
+  if (k > 0) {
+    fprintf(f, "\n");
+  }
+}
+
+/*
+ * Check equality between a and b: arrays of n elements
+ */
+static bool equal_arrays(const uint32_t *a, const uint32_t *b, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] != b[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Store random integers in [0, b-1] in a
+ * - n = number of elements
+ */
+static void random_array(uint32_t *a, uint32_t n, uint32_t b) {
+  uint32_t i;
+
+  assert(b > 0);
+  for (i=0; i<n; i++) {
+    a[i] = random() % b;
+  }
+}
+
+/*
+ * Random table of 2n constants: n random constants in [0, Q-1]
+ * followed by their Shoup companions.
+ */
+static uint32_t shoup_companion(uint32_t w) {
+  return (uint32_t) (((uint64_t) w << 32)/Q);
+}
+
+static void random_table(uint32_t *p, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    p[i] = random() % Q;
+    p[n + i] = shoup_companion(p[i]);
+  }
+}
+
+/*
+ * Copy a into b
+ */
+static void copy_array(uint32_t *b, const uint32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    b[i] = a[i];
+  }
+}
+
+
+/*
+ * ELEMENT-WISE OPERATIONS
+ */
+
+/*
+ * harvey_correct and harvey_mul_array32 are checked on all inputs in [0, 4Q-1]
+ */
+#define ALL_SIZE (4 * Q + 3) // multiple of 8
+
+static uint32_t all_x[ALL_SIZE] __attribute__ ((aligned(32)));
+static uint32_t all_y[ALL_SIZE] __attribute__ ((aligned(32)));
+static uint32_t all_y_asm[ALL_SIZE] __attribute__ ((aligned(32)));
+
+static void init_all_x(void) {
+  uint32_t i;
+
+  for (i=0; i<ALL_SIZE; i++) {
+    all_x[i] = i < 4 * Q ? i : 4 * Q - 1;
+  }
+}
+
+static void test_correct(void) {
+  uint32_t i;
+
+  printf("Testing harvey_correct: all integers in [0, 4Q-1]\n");
+  init_all_x();
+  copy_array(all_y, all_x, ALL_SIZE);
+  copy_array(all_y_asm, all_x, ALL_SIZE);
+  harvey_correct(all_y, ALL_SIZE);
+  harvey_correct_asm(all_y_asm, ALL_SIZE);
+  if (!equal_arrays(all_y, all_y_asm, ALL_SIZE)) {
+    printf("failed: harvey_correct_asm and harvey_correct differ\n");
+    exit(1);
+  }
+  for (i=0; i<ALL_SIZE; i++) {
+    if (all_y[i] != all_x[i] % Q) {
+      printf("failed: correct(%"PRIu32") = %"PRIu32"\n", all_x[i], all_y[i]);
+      exit(1);
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_mul_shoup(void) {
+  static uint32_t p[2 * ALL_SIZE];
+  uint32_t w[6] = { 0, 1, 2, 6144, 12288, 4091 };
+  uint32_t i, k;
+
+  printf("Testing harvey_mul_array32: all integers in [0, 4Q-1]\n");
+  for (k=0; k<6; k++) {
+    for (i=0; i<ALL_SIZE; i++) {
+      p[i] = w[k];
+      p[ALL_SIZE + i] = shoup_companion(w[k]);
+    }
+    init_all_x();
+    copy_array(all_y, all_x, ALL_SIZE);
+    copy_array(all_y_asm, all_x, ALL_SIZE);
+    harvey_mul_array32(all_y, ALL_SIZE, p);
+    harvey_mul_array32_asm(all_y_asm, ALL_SIZE, p);
+    if (!equal_arrays(all_y, all_y_asm, ALL_SIZE)) {
+      printf("failed: harvey_mul_array32_asm and harvey_mul_array32 differ\n");
+      exit(1);
+    }
+    for (i=0; i<ALL_SIZE; i++) {
+      if (all_y[i] >= 2 * Q || all_y[i] % Q != (all_x[i] * w[k]) % Q) {
+	printf("failed: mul_shoup(%"PRIu32", %"PRIu32") = %"PRIu32"\n", all_x[i], w[k], all_y[i]);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_mul_array(void) {
+  uint32_t a[1024], b[1024], c[1024], d[1024];
+  uint32_t i, j;
+
+  printf("Testing harvey_mul_array\n");
+  for (j=0; j<10000; j++) {
+    random_array(a, 1024, 4 * Q);
+    random_array(b, 1024, 4 * Q);
+    if (j == 0) {
+      for (i=0; i<1024; i++) a[i] = b[i] = 4 * Q - 1;
+    }
+    harvey_mul_array(c, 1024, a, b);
+    harvey_mul_array_asm(d, 1024, a, b);
+    if (!equal_arrays(c, d, 1024)) {
+      printf("failed: harvey_mul_array_asm and harvey_mul_array differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      if (c[i] >= 2 * Q || c[i] % Q != (a[i] * b[i]) % Q) {
+	printf("failed: red_shoup(%"PRIu32" * %"PRIu32") = %"PRIu32"\n", a[i], b[i], c[i]);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_finalize(void) {
+  uint32_t a[1024], b[1024], c[1024];
+  uint32_t p[2048];
+  uint32_t i, j;
+
+  printf("Testing harvey_mul_finalize and harvey_scalar_mul_finalize\n");
+  for (j=0; j<10000; j++) {
+    random_array(a, 1024, 4 * Q);
+    random_table(p, 1024);
+    copy_array(b, a, 1024);
+    copy_array(c, a, 1024);
+    harvey_mul_finalize(b, 1024, p);
+    harvey_mul_finalize_asm(c, 1024, p);
+    if (!equal_arrays(b, c, 1024)) {
+      printf("failed: harvey_mul_finalize_asm and harvey_mul_finalize differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      if (b[i] != (a[i] * p[i]) % Q) {
+	printf("failed: mul_finalize(%"PRIu32", %"PRIu32") = %"PRIu32"\n", a[i], p[i], b[i]);
+	exit(1);
+      }
+    }
+
+    copy_array(b, a, 1024);
+    copy_array(c, a, 1024);
+    harvey_scalar_mul_finalize(b, 1024, p[0], p[1024]);
+    harvey_scalar_mul_finalize_asm(c, 1024, p[0], p[1024]);
+    if (!equal_arrays(b, c, 1024)) {
+      printf("failed: harvey_scalar_mul_finalize_asm and harvey_scalar_mul_finalize differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      if (b[i] != (a[i] * p[0]) % Q) {
+	printf("failed: scalar_mul_finalize(%"PRIu32", %"PRIu32") = %"PRIu32"\n", a[i], p[0], b[i]);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+
+/*
+ * REFERENCE NTT
+ */
+
+/*
+ * x^k modulo Q
+ */
+static int32_t power(int32_t x, uint32_t k) {
+  int32_t y;
+
+  x %= Q;
+  if (x < 0) x += Q;
+  y = 1;
+  while (k != 0) {
+    if ((k & 1) != 0) {
+      y = (y * x) % Q;
+    }
+    k >>= 1;
+    x = (x * x) % Q;
+  }
+  return y;
+}
+
+static uint32_t bitrev(uint32_t i, uint32_t n) {
+  uint32_t x;
+
+  x = 0;
+  while (n > 1) {
+    x = (x << 1) | (i & 1);
+    i >>= 1;
+    n >>= 1;
+  }
+  return x;
+}
+
+/*
+ * Compute b[k] = sum_i a[i] * psi^i * omega^(i k) modulo Q, in [0, Q-1]
+ * - psi = 1 for the plain NTT
+ */
+static void naive_ntt(int32_t *b, const uint32_t *a, uint32_t n, int32_t omega, int32_t psi) {
+  int32_t c[n];
+  uint32_t i, k;
+  int32_t s, w, x;
+
+  x = 1;
+  for (i=0; i<n; i++) {
+    c[i] = ((int32_t) (a[i] % Q) * x) % Q;
+    x = (x * psi) % Q;
+  }
+  for (k=0; k<n; k++) {
+    w = power(omega, k);
+    x = 1;
+    s = 0;
+    for (i=0; i<n; i++) {
+      s = (s + c[i] * x) % Q;
+      x = (x * w) % Q;
+    }
+    if (s < 0) s += Q;
+    b[k] = s;
+  }
+}
+
+/*
+ * Check the C functions: f(a, n, p) with a in the given order
+ * - rev_in: true if f expects input in bit-reverse order
+ * - rev_out: true if f produces output in bit-reverse order
+ * - psi_in: multiply the input by powers of psi (mulntt)
+ * - psi_out: multiply the output by powers of psi (nttmul)
+ * - bound = input coefficients are in [0, bound-1]
+ */
+static void check_ntt(const char *name, void (*f)(uint32_t *, uint32_t, const uint32_t *), const uint32_t *p,
+		      int32_t omega, int32_t psi, bool rev_in, bool rev_out, bool psi_in, bool psi_out, uint32_t bound) {
+  uint32_t a[1024], b[1024], c[1024];
+  int32_t d[1024], x;
+  uint32_t i, j;
+
+  printf("Testing %s: n = 1024\n", name);
+  for (j=0; j<10; j++) {
+    random_array(a, 1024, bound);
+    if (j == 0) {
+      for (i=0; i<1024; i++) a[i] = bound - 1; // extreme input
+    }
+    // b = input in the order expected by f
+    for (i=0; i<1024; i++) {
+      b[rev_in ? bitrev(i, 1024) : i] = a[i];
+    }
+    copy_array(c, b, 1024);
+    f(b, 1024, p);
+    naive_ntt(d, a, 1024, omega, psi_in ? psi : 1);
+    for (i=0; i<1024; i++) {
+      x = b[rev_out ? bitrev(i, 1024) : i];
+      if (psi_out) {
+	d[i] = (d[i] * power(psi, i)) % Q;
+      }
+      if (x >= bound || (x - d[i]) % Q != 0) {
+	printf("failed on test %"PRIu32" (index %"PRIu32")\n", j, i);
+	printf("--> input:\n");
+	print_array(stdout, c, 1024);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+/*
+ * TABLES
+ */
+
+/*
+ * Check constant w with companion w_shoup:
+ * - w must be congruent to c modulo Q and in [0, Q-1]
+ * - w_shoup must be floor(w * 2^32/Q)
+ */
+static bool good_shoup_constant(uint32_t w, uint32_t w_shoup, int32_t c) {
+  return w < Q && w == c && w_shoup == shoup_companion(w);
+}
+
+/*
+ * Table of powers: p[i] = c * x^i for i=0 ... n-1
+ */
+static void check_power_table(const char *name, const uint32_t *p, uint32_t n, int32_t c, int32_t x) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (!good_shoup_constant(p[i], p[n + i], (c * power(x, i)) % Q)) {
+      printf("failed: %s[%"PRIu32"] = %"PRIu32" (companion %"PRIu32")\n", name, i, p[i], p[n + i]);
+      exit(1);
+    }
+  }
+}
+
+/*
+ * NTT table: p[t + j] = x^(n/2t) * y^(n/2t)^j for t=1, 2, ..., n/2
+ * and j=0 ... t-1 (bitrev(j) instead of j if rev is true).
+ */
+static void check_ntt_table(const char *name, const uint32_t *p, uint32_t n, int32_t x, int32_t y, bool rev) {
+  uint32_t t, j, e;
+  int32_t c;
+
+  for (t=1; t<n; t <<= 1) {
+    for (j=0; j<t; j++) {
+      e = rev ? bitrev(j, t) : j;
+      c = (power(x, n/(2*t)) * power(y, (n/(2*t)) * e)) % Q;
+      if (!good_shoup_constant(p[t + j], p[n + t + j], c)) {
+	printf("failed: %s[%"PRIu32"] = %"PRIu32" (companion %"PRIu32")\n", name, t + j, p[t + j], p[n + t + j]);
+	exit(1);
+      }
+    }
+  }
+}
+
+static void test_tables(void) {
+  int32_t psi, inv_psi, omega, inv_omega, inv_n;
+
+  printf("Testing ntt_harvey1024 tables: constants and Shoup companions\n");
+  psi = ntt_harvey1024_psi;
+  inv_psi = ntt_harvey1024_inv_psi;
+  omega = ntt_harvey1024_omega;
+  inv_omega = ntt_harvey1024_inv_omega;
+  inv_n = ntt_harvey1024_inv_n;
+  if ((psi * psi) % Q != omega || (psi * inv_psi) % Q != 1 || (omega * inv_omega) % Q != 1 ||
+      (1024 * inv_n) % Q != 1 || !good_shoup_constant(inv_n, ntt_harvey1024_inv_n_shoup, inv_n)) {
+    printf("failed: parameters\n");
+    exit(1);
+  }
+
+  check_power_table("psi_powers", ntt_harvey1024_psi_powers, 1024, 1, psi);
+  check_power_table("scaled_inv_psi_powers", ntt_harvey1024_scaled_inv_psi_powers, 1024, inv_n, inv_psi);
+
+  check_ntt_table("omega_powers", ntt_harvey1024_omega_powers, 1024, 1, omega, false);
+  check_ntt_table("omega_powers_rev", ntt_harvey1024_omega_powers_rev, 1024, 1, omega, true);
+  check_ntt_table("inv_omega_powers", ntt_harvey1024_inv_omega_powers, 1024, 1, inv_omega, false);
+  check_ntt_table("inv_omega_powers_rev", ntt_harvey1024_inv_omega_powers_rev, 1024, 1, inv_omega, true);
+  check_ntt_table("mixed_powers", ntt_harvey1024_mixed_powers, 1024, psi, omega, false);
+  check_ntt_table("mixed_powers_rev", ntt_harvey1024_mixed_powers_rev, 1024, psi, omega, true);
+  check_ntt_table("inv_mixed_powers", ntt_harvey1024_inv_mixed_powers, 1024, inv_psi, inv_omega, false);
+  check_ntt_table("inv_mixed_powers_rev", ntt_harvey1024_inv_mixed_powers_rev, 1024, inv_psi, inv_omega, true);
+  printf("all tests passed\n\n");
+}
+
+
+/*
+ * LAZY BOUNDS
+ */
+
+/*
+ * mul_shoup(x, w, w') is in [0, 2Q-1] for any 32-bit x:
+ * all x < 2^16 then random 32-bit x, for a few constants w.
+ */
+static void test_mul_shoup_bound(void) {
+  static uint32_t x[65536], y[65536], p[2 * 65536];
+  uint32_t w[5] = { 1, 2, 6144, 12288, 4091 };
+  uint32_t i, j, k;
+
+  printf("Testing the bound on mul_shoup: 32-bit inputs\n");
+  for (k=0; k<5; k++) {
+    for (i=0; i<65536; i++) {
+      p[i] = w[k];
+      p[65536 + i] = shoup_companion(w[k]);
+    }
+    for (j=0; j<20; j++) {
+      for (i=0; i<65536; i++) {
+	x[i] = (j == 0) ? i : ((uint32_t) random() << 1) ^ (uint32_t) random();
+      }
+      if (j == 1) x[0] = UINT32_MAX;
+      copy_array(y, x, 65536);
+      harvey_mul_array32(y, 65536, p);
+      for (i=0; i<65536; i++) {
+	if (y[i] >= 2 * Q || y[i] % Q != (uint32_t) (((uint64_t) x[i] * w[k]) % Q)) {
+	  printf("failed: mul_shoup(%"PRIu32", %"PRIu32") = %"PRIu32"\n", x[i], w[k], y[i]);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+/*
+ * Run f on random inputs in [0, bound-1] and record the output range.
+ * The output must be in [0, bound-1] and must exceed bound/2 for some
+ * inputs: the NTTs don't reduce more than the lazy bounds require.
+ * The C functions also check the bounds of each butterfly input
+ * (assertions in ntt_harvey.c).
+ */
+static void check_lazy_range(const char *name, void (*f)(uint32_t *, uint32_t, const uint32_t *), const uint32_t *p,
+			     uint32_t bound) {
+  uint32_t a[1024];
+  uint32_t i, j, max;
+
+  printf("Testing lazy range of %s: input in [0, %"PRIu32"]\n", name, bound - 1);
+  max = 0;
+  for (j=0; j<1000; j++) {
+    random_array(a, 1024, bound);
+    if (j == 0) {
+      for (i=0; i<1024; i++) a[i] = bound - 1;
+    }
+    if (j == 1) {
+      for (i=0; i<1024; i++) a[i] = (i & 1) ? bound - 1 : 0;
+    }
+    f(a, 1024, p);
+    for (i=0; i<1024; i++) {
+      if (a[i] >= bound) {
+	printf("failed on test %"PRIu32": output %"PRIu32" out of range\n", j, a[i]);
+	exit(1);
+      }
+      if (a[i] > max) max = a[i];
+    }
+  }
+  printf("largest output: %"PRIu32"\n", max);
+  if (max < bound/2) {
+    printf("failed: the output range is smaller than expected\n");
+    exit(1);
+  }
+  printf("all tests passed\n");
+}
+
+/*
+ * The pointwise product takes the Cooley-Tukey outputs directly:
+ * (4Q-1)^2 < 2^32 and its result in [0, 2Q-1] is a valid input for
+ * the Gentleman-Sande NTTs.
+ */
+static void test_lazy_bounds(void) {
+  uint32_t a[1024], b[1024], c[1024];
+  uint32_t i;
+
+  test_mul_shoup_bound();
+
+  check_lazy_range("ntt_harvey_ct_rev2std", ntt_harvey_ct_rev2std, ntt_harvey1024_omega_powers, 4 * Q);
+  check_lazy_range("ntt_harvey_ct_std2rev", ntt_harvey_ct_std2rev, ntt_harvey1024_omega_powers_rev, 4 * Q);
+  check_lazy_range("ntt_harvey_gs_rev2std", ntt_harvey_gs_rev2std, ntt_harvey1024_omega_powers_rev, 2 * Q);
+  check_lazy_range("ntt_harvey_gs_std2rev", ntt_harvey_gs_std2rev, ntt_harvey1024_omega_powers, 2 * Q);
+
+  printf("Testing the lazy chain: ct_std2rev, mul_array, gs_rev2std\n");
+  if ((uint64_t) (4 * Q - 1) * (4 * Q - 1) >= ((uint64_t) 1 << 32)) {
+    printf("failed: (4Q-1)^2 does not fit in 32 bits\n");
+    exit(1);
+  }
+  for (i=0; i<1024; i++) {
+    a[i] = 4 * Q - 1;
+    b[i] = random() % (4 * Q);
+  }
+  ntt_harvey_ct_std2rev(a, 1024, ntt_harvey1024_mixed_powers_rev);
+  ntt_harvey_ct_std2rev(b, 1024, ntt_harvey1024_mixed_powers_rev);
+  harvey_mul_array(c, 1024, a, b);
+  for (i=0; i<1024; i++) {
+    if (c[i] >= 2 * Q) {
+      printf("failed: mul_array output %"PRIu32" out of range\n", c[i]);
+      exit(1);
+    }
+  }
+  ntt_harvey_gs_rev2std(c, 1024, ntt_harvey1024_inv_mixed_powers_rev);
+  printf("all tests passed\n\n");
+}
+
+static void test_c_ntts(void) {
+  int32_t omega, inv_omega, psi, inv_psi;
+
+  omega = ntt_harvey1024_omega;
+  inv_omega = ntt_harvey1024_inv_omega;
+  psi = ntt_harvey1024_psi;
+  inv_psi = ntt_harvey1024_inv_psi;
+
+  check_ntt("ntt_harvey_ct_rev2std", ntt_harvey_ct_rev2std, ntt_harvey1024_omega_powers,
+	    omega, psi, true, false, false, false, 4 * Q);
+  check_ntt("mulntt_harvey_ct_rev2std", mulntt_harvey_ct_rev2std, ntt_harvey1024_mixed_powers,
+	    omega, psi, true, false, true, false, 4 * Q);
+  check_ntt("ntt_harvey_ct_std2rev", ntt_harvey_ct_std2rev, ntt_harvey1024_omega_powers_rev,
+	    omega, psi, false, true, false, false, 4 * Q);
+  check_ntt("mulntt_harvey_ct_std2rev", mulntt_harvey_ct_std2rev, ntt_harvey1024_mixed_powers_rev,
+	    omega, psi, false, true, true, false, 4 * Q);
+  check_ntt("ntt_harvey_gs_rev2std", ntt_harvey_gs_rev2std, ntt_harvey1024_omega_powers_rev,
+	    omega, psi, true, false, false, false, 2 * Q);
+  check_ntt("nttmul_harvey_gs_rev2std", nttmul_harvey_gs_rev2std, ntt_harvey1024_inv_mixed_powers_rev,
+	    inv_omega, inv_psi, true, false, false, true, 2 * Q);
+  check_ntt("ntt_harvey_gs_std2rev", ntt_harvey_gs_std2rev, ntt_harvey1024_omega_powers,
+	    omega, psi, false, true, false, false, 2 * Q);
+  check_ntt("nttmul_harvey_gs_std2rev", nttmul_harvey_gs_std2rev, ntt_harvey1024_inv_mixed_powers,
+	    inv_omega, inv_psi, false, true, false, true, 2 * Q);
+  printf("\n");
+}
+
+
+/*
+ * ASSEMBLY VERSIONS
+ */
+
+/*
+ * Cross check: apply f (assembly) and g (C) to the same input and random table
+ * - input coefficients are in [0, bound-1] and so must be the output
+ */
+static void cross_check(const char *name, uint32_t n, uint32_t bound,
+			void (*f)(uint32_t *, uint32_t, const uint32_t *),
+			void (*g)(uint32_t *, uint32_t, const uint32_t *)) {
+  uint32_t a[n], b[n], c[n], p[2 * n];
+  uint32_t i, j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<20000; j++) {
+    random_table(p, n);
+    random_array(a, n, bound);
+    if (j == 0) {
+      for (i=0; i<n; i++) a[i] = bound - 1;
+    }
+    copy_array(b, a, n);
+    copy_array(c, a, n); // keep a copy in case of error
+    f(a, n, p);
+    g(b, n, p);
+    if (!equal_arrays(a, b, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, c, n);
+      printf("--> output:\n");
+      print_array(stdout, a, n);
+      printf("correct result:\n");
+      print_array(stdout, b, n);
+      exit(1);
+    }
+    for (i=0; i<n; i++) {
+      if (b[i] >= bound) {
+	printf("failed on test %"PRIu32": output bound\n", j);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_asm(uint32_t n) {
+  printf("===== size %"PRIu32" =====\n", n);
+  cross_check("ntt_harvey_ct_rev2std_asm", n, 4 * Q, ntt_harvey_ct_rev2std_asm, ntt_harvey_ct_rev2std);
+  cross_check("ntt_harvey_ct_std2rev_asm", n, 4 * Q, ntt_harvey_ct_std2rev_asm, ntt_harvey_ct_std2rev);
+  cross_check("ntt_harvey_gs_rev2std_asm", n, 2 * Q, ntt_harvey_gs_rev2std_asm, ntt_harvey_gs_rev2std);
+  cross_check("ntt_harvey_gs_std2rev_asm", n, 2 * Q, ntt_harvey_gs_std2rev_asm, ntt_harvey_gs_std2rev);
+  printf("\n");
+}
+
+
+/*
+ * SPEED
+ */
+
+// global buffers used for speed tests. alignment matters (for speed)
+static uint32_t a32[2048] __attribute__ ((aligned(32)));
+static uint32_t p32[4096] __attribute__ ((aligned(32)));
+static int16_t a16[2048] __attribute__ ((aligned(32)));
+static int32_t r32[2048] __attribute__ ((aligned(32)));
+
+static void print_speed(const char *name, uint32_t n, uint64_t c) {
+  uint32_t i;
+  uint64_t avg, med;
+
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c - t[i];
+
+  avg = average_time();
+  med = median_time();
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64", average = %"PRIu64"\n", name, n, med, avg);
+}
+
+static void speed_test(const char *name, uint32_t n, void (*f)(uint32_t *, uint32_t, const uint32_t *)) {
+  uint32_t i;
+
+  random_array(a32, n, Q);
+  random_table(p32, n);
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a32, n, p32);
+  }
+  print_speed(name, n, cpucycles());
+}
+
+static void speed_test16(const char *name, uint32_t n, const int16_t *p, void (*f)(int16_t *, uint32_t, const int16_t *)) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a16[i] = random() % Q;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a16, n, p);
+  }
+  print_speed(name, n, cpucycles());
+}
+
+static void speed_test_red(const char *name, uint32_t n, const int16_t *p, void (*f)(int32_t *, uint32_t, const int16_t *)) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    r32[i] = random() % Q;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(r32, n, p);
+  }
+  print_speed(name, n, cpucycles());
+}
+
+static void speed_tests(void) {
+  printf("===== speed: Shoup vs. Barrett/Montgomery vs. Longa-Naehrig =====\n");
+  speed_test("ntt_harvey_ct_rev2std", 1024, ntt_harvey_ct_rev2std);
+  speed_test("ntt_harvey_ct_rev2std_asm", 1024, ntt_harvey_ct_rev2std_asm);
+  speed_test16("ntt_short_ct_rev2std_asm", 1024, ntt_short1024_omega_powers, ntt_short_ct_rev2std_asm);
+  speed_test_red("ntt_red_ct_rev2std_asm", 1024, ntt_red1024_omega_powers, ntt_red_ct_rev2std_asm);
+  speed_test("ntt_harvey_ct_std2rev_asm", 1024, ntt_harvey_ct_std2rev_asm);
+  speed_test16("ntt_short_ct_std2rev_asm", 1024, ntt_short1024_omega_powers_rev, ntt_short_ct_std2rev_asm);
+  speed_test_red("ntt_red_ct_std2rev_asm", 1024, ntt_red1024_omega_powers_rev, ntt_red_ct_std2rev_asm);
+  speed_test("ntt_harvey_gs_rev2std_asm", 1024, ntt_harvey_gs_rev2std_asm);
+  speed_test16("ntt_short_gs_rev2std_asm", 1024, ntt_short1024_omega_powers_rev, ntt_short_gs_rev2std_asm);
+  speed_test_red("ntt_red_gs_rev2std_asm", 1024, ntt_red1024_omega_powers_rev, ntt_red_gs_rev2std_asm);
+  speed_test("ntt_harvey_gs_std2rev_asm", 1024, ntt_harvey_gs_std2rev_asm);
+  speed_test16("ntt_short_gs_std2rev_asm", 1024, ntt_short1024_omega_powers, ntt_short_gs_std2rev_asm);
+  speed_test_red("ntt_red_gs_std2rev_asm", 1024, ntt_red1024_omega_powers, ntt_red_gs_std2rev_asm);
+  printf("\n");
+}
+
+
+int main(void) {
+  test_tables();
+  test_lazy_bounds();
+  test_c_ntts();
+  if (avx2_supported()) {
+    printf("AVX2 is supported\n\n");
+    test_correct();
+    test_mul_shoup();
+    test_mul_array();
+    test_finalize();
+    tests_asm(16);
+    tests_asm(32);
+    tests_asm(64);
+    tests_asm(128);
+    tests_asm(256);
+    tests_asm(512);
+    tests_asm(1024);
+    tests_asm(2048);
+    speed_tests();
+  } else {
+    printf("AVX2 is not supported\n");
+  }
+  return 0;
+}
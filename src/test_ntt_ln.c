@@ -0,0 +1,411 @@
+/*
+ * Tests of the multi-modulus Longa-Naehrig backend (ntt_ln.h)
+ * - the bounds of red_bounds.c are checked on random inputs for each q
+ * - the AVX2 kernels and NTTs must give the same results as the C versions
+ * - for q = 12289, the tables and NTTs must match ntt_red1024
+ * - the products are compared with a naive product modulo q
+ * - speed comparison
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_ln.h"
+#include "ntt_ln7681_tables.h"
+#include "ntt_ln12289_tables.h"
+#include "ntt_ln40961_tables.h"
+#include "ntt_ln65537_tables.h"
+#include "ntt_ln786433_tables.h"
+#include "ntt_red1024.h"
+#include "ntt_red_asm1024.h"
+#include "red_bounds.h"
+#include "sort.h"
+
+#define MAX_N 1024
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 10240
+
+static uint64_t t[NTESTS];
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+static int32_t a[MAX_N] __attribute__ ((aligned(32)));
+static int32_t b[MAX_N] __attribute__ ((aligned(32)));
+static int32_t c[MAX_N] __attribute__ ((aligned(32)));
+static int32_t d[MAX_N] __attribute__ ((aligned(32)));
+static int32_t a_copy[MAX_N] __attribute__ ((aligned(32)));
+static int32_t b_copy[MAX_N] __attribute__ ((aligned(32)));
+
+typedef void (*array_fun_t)(int32_t *a, uint32_t n);
+typedef void (*mul_fun_t)(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b);
+typedef void (*ntt_fun_t)(int32_t *a, uint32_t n, const int32_t *p, uint32_t rounds);
+typedef void (*product_fun_t)(int32_t *c, int32_t *a, int32_t *b);
+
+/*
+ * Functions and parameters for one modulus
+ */
+typedef struct backend_s {
+  uint32_t q;
+  uint32_t n;
+  const int32_t *fwd;
+  const int32_t *inv;
+  uint32_t fwd_rounds;
+  uint32_t inv_rounds;
+  array_fun_t reduce;
+  array_fun_t reduce_asm;
+  mul_fun_t mul_reduce;
+  mul_fun_t mul_reduce_asm;
+  ntt_fun_t ct;
+  ntt_fun_t ct_asm;
+  ntt_fun_t gs;
+  ntt_fun_t gs_asm;
+  product_fun_t product;
+  product_fun_t product_asm;
+} backend_t;
+
+#define BACKEND(q) {							\
+    q, ntt_ln##q##_n, ntt_ln##q##_mixed_powers_rev, ntt_ln##q##_inv_mixed_powers_rev, \
+    ntt_ln##q##_fwd_a_rounds, ntt_ln##q##_inv_rounds,			\
+    ntt_ln##q##_reduce_array, ntt_ln##q##_reduce_array_asm,		\
+    ntt_ln##q##_mul_reduce_array, ntt_ln##q##_mul_reduce_array_asm,	\
+    ntt_ln##q##_mulntt_ct_std2rev_lazy, ntt_ln##q##_mulntt_ct_std2rev_lazy_asm, \
+    ntt_ln##q##_nttmul_gs_rev2std_lazy, ntt_ln##q##_nttmul_gs_rev2std_lazy_asm, \
+    ntt_ln##q##_product, ntt_ln##q##_product_asm }
+
+#define NUM_BACKENDS 5
+
+static const backend_t backends[NUM_BACKENDS] = {
+  BACKEND(7681),
+  BACKEND(12289),
+  BACKEND(40961),
+  BACKEND(65537),
+  BACKEND(786433),
+};
+
+/*
+ * Random 32bit integer in [-b, b]
+ */
+static int32_t random_in(int64_t b) {
+  uint64_t x;
+
+  x = ((uint64_t) random() << 31) | random();
+  return (int32_t) ((int64_t) (x % (2 * b + 1)) - b);
+}
+
+/*
+ * Input patterns
+ * - 0: random in [0, q-1]
+ * - 1: all coefficients equal to q-1
+ * - 2: alternate 0 and q-1
+ * - 3: all coefficients equal to 0, except a[0] = q-1
+ */
+static void init_array(int32_t *x, uint32_t n, uint32_t q, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    switch (pattern) {
+    case 0: x[i] = random() % q; break;
+    case 1: x[i] = q-1; break;
+    case 2: x[i] = (i & 1) ? q-1 : 0; break;
+    default: x[i] = (i == 0) ? q-1 : 0; break;
+    }
+  }
+}
+
+static void copy_array(int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = y[i];
+  }
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Naive product modulo (X^n + 1) and q
+ */
+static void naive_product(int32_t *z, const int32_t *x, const int32_t *y, uint32_t n, uint32_t q) {
+  uint32_t i, j;
+  uint64_t s[MAX_N];
+  uint64_t u;
+
+  for (i=0; i<n; i++) {
+    s[i] = 0;
+  }
+  for (i=0; i<n; i++) {
+    for (j=0; j<n; j++) {
+      u = ((uint64_t) x[i] * y[j]) % q;
+      if (i + j < n) {
+	s[i + j] = (s[i + j] + u) % q;
+      } else {
+	s[i + j - n] = (s[i + j - n] + q - u) % q;
+      }
+    }
+  }
+  for (i=0; i<n; i++) {
+    z[i] = (int32_t) s[i];
+  }
+}
+
+
+/*
+ * Reductions: random inputs in [-2^31, 2^31 - 1] and products
+ * bounded by max_mul_red_q(). The results must be within the bounds
+ * of red_bounds.c and the AVX2 versions must agree with the C versions.
+ */
+static void test_reductions(const backend_t *f) {
+  red_param_t rp;
+  int64_t lo, hi, m, bound, w;
+  uint32_t i, k, n;
+
+  n = f->n;
+  printf("Testing reductions: q = %"PRIu32"\n", f->q);
+  if (!red_param_init(&rp, f->q)) {
+    printf("failed: red_param_init\n");
+    exit(1);
+  }
+  lo = min_red_q(&rp, INT32_MIN, INT32_MAX, &m);
+  hi = max_red_q(&rp, INT32_MIN, INT32_MAX, &m);
+  printf("  red(x) in [%"PRId64", %"PRId64"] for 32bit x\n", lo, hi);
+
+  for (k=0; k<100; k++) {
+    for (i=0; i<n; i++) {
+      a[i] = random_in(INT32_MAX);
+    }
+    copy_array(b, a, n);
+    f->reduce(a, n);
+    f->reduce_asm(b, n);
+    if (! equal_arrays(a, b, n)) {
+      printf("failed: reduce_array_asm\n");
+      exit(1);
+    }
+    for (i=0; i<n; i++) {
+      if (a[i] < lo || a[i] > hi) {
+	printf("failed: red(x) = %"PRId32" is out of bounds\n", a[i]);
+	exit(1);
+      }
+    }
+  }
+
+  // products: |a[i]| <= bound and |b[i]| <= w with bound * w <= max_mul_red_q()
+  w = f->q/2;
+  bound = max_mul_red_q(&rp)/w;
+  if (bound > INT32_MAX) bound = INT32_MAX;
+  hi = abs_mul_red_bound_q(&rp, bound, w);
+  printf("  |red(x * y)| <= %"PRId64" for |x| <= %"PRId64" and |y| <= %"PRId64"\n", hi, bound, w);
+  for (k=0; k<100; k++) {
+    for (i=0; i<n; i++) {
+      a[i] = random_in(bound);
+      b[i] = random_in(w);
+    }
+    f->mul_reduce(c, n, a, b);
+    f->mul_reduce_asm(d, n, a, b);
+    if (! equal_arrays(c, d, n)) {
+      printf("failed: mul_reduce_array_asm\n");
+      exit(1);
+    }
+    for (i=0; i<n; i++) {
+      if (c[i] < -hi || c[i] > hi) {
+	printf("failed: red(x * y) = %"PRId32" is out of bounds\n", c[i]);
+	exit(1);
+      }
+    }
+  }
+
+  printf("passed\n");
+}
+
+/*
+ * NTTs: C and AVX2 with the schedule of the product and with all
+ * rounds reduced.
+ */
+static void test_ntts(const backend_t *f) {
+  uint32_t i, k, n, all;
+
+  n = f->n;
+  all = ~(uint32_t) 0;
+  printf("Testing lazy NTTs: q = %"PRIu32", n = %"PRIu32"\n", f->q, n);
+  for (i=0; i<4; i++) {
+    for (k=0; k<(i == 0 ? 10 : 1); k++) {
+      init_array(a, n, f->q, i);
+      copy_array(b, a, n);
+      f->ct(a, n, f->fwd, f->fwd_rounds);
+      f->ct_asm(b, n, f->fwd, f->fwd_rounds);
+      if (! equal_arrays(a, b, n)) {
+	printf("failed: mulntt_ct_std2rev_lazy_asm, pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+
+      init_array(a, n, f->q, i);
+      copy_array(b, a, n);
+      f->ct(a, n, f->fwd, all);
+      f->ct_asm(b, n, f->fwd, all);
+      if (! equal_arrays(a, b, n)) {
+	printf("failed: mulntt_ct_std2rev_lazy_asm (all rounds reduced), pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+
+      init_array(a, n, f->q, i);
+      copy_array(b, a, n);
+      f->gs(a, n, f->inv, f->inv_rounds);
+      f->gs_asm(b, n, f->inv, f->inv_rounds);
+      if (! equal_arrays(a, b, n)) {
+	printf("failed: nttmul_gs_rev2std_lazy_asm, pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+
+      init_array(a, n, f->q, i);
+      copy_array(b, a, n);
+      f->gs(a, n, f->inv, all);
+      f->gs_asm(b, n, f->inv, all);
+      if (! equal_arrays(a, b, n)) {
+	printf("failed: nttmul_gs_rev2std_lazy_asm (all rounds reduced), pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * For q = 12289, the backend must match ntt_red1024
+ */
+static void test_same_as_ntt_red(void) {
+  uint32_t i, k;
+
+  printf("Testing ntt_ln12289 against ntt_red1024\n");
+  for (i=0; i<1024; i++) {
+    if (ntt_ln12289_mixed_powers_rev[i] != ntt_red1024_mixed_powers_rev[i] ||
+	ntt_ln12289_inv_mixed_powers_rev[i] != ntt_red1024_inv_mixed_powers_rev[i]) {
+      printf("failed: tables differ at index %"PRIu32"\n", i);
+      exit(1);
+    }
+  }
+  for (i=0; i<4; i++) {
+    for (k=0; k<(i == 0 ? 10 : 1); k++) {
+      init_array(a, 1024, 12289, i);
+      copy_array(b, a, 1024);
+      ntt_ln12289_mulntt_ct_std2rev_lazy(a, 1024, ntt_ln12289_mixed_powers_rev, 0);
+      mulntt_red1024_ct_std2rev(b);
+      if (! equal_arrays(a, b, 1024)) {
+	printf("failed: mulntt_ct_std2rev_lazy, pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+      init_array(a, 1024, 12289, i);
+      copy_array(b, a, 1024);
+      ntt_ln12289_nttmul_gs_rev2std_lazy(a, 1024, ntt_ln12289_inv_mixed_powers_rev, 0);
+      inttmul_red1024_gs_rev2std(b);
+      if (! equal_arrays(a, b, 1024)) {
+	printf("failed: nttmul_gs_rev2std_lazy, pattern %"PRIu32"\n", i);
+	exit(1);
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Products: compare with the naive product
+ */
+static void test_product(const char *name, const backend_t *f, product_fun_t product) {
+  uint32_t i, j, k, n;
+
+  n = f->n;
+  printf("Testing %s: q = %"PRIu32", n = %"PRIu32"\n", name, f->q, n);
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      for (k=0; k<((i == 0 || j == 0) ? 4 : 1); k++) {
+	init_array(a, n, f->q, i);
+	init_array(b, n, f->q, j);
+	copy_array(a_copy, a, n);
+	copy_array(b_copy, b, n);
+	naive_product(d, a, b, n, f->q);
+	product(c, a, b);
+	if (! equal_arrays(c, d, n)) {
+	  printf("failed: patterns %"PRIu32", %"PRIu32"\n", i, j);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+static void speed_test(const char *name, const backend_t *f, product_fun_t product) {
+  uint32_t i, n;
+  uint64_t s;
+
+  n = f->n;
+  init_array(a_copy, n, f->q, 0);
+  init_array(b_copy, n, f->q, 0);
+  for (i=0; i<NTESTS; i++) {
+    copy_array(a, a_copy, n);
+    copy_array(b, b_copy, n);
+    s = cpucycles();
+    product(c, a, b);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test %s (q=%"PRIu32", n=%"PRIu32"): median = %"PRIu64"\n", name, f->q, n, median_time());
+}
+
+static void speed_test_red(const char *name, product_fun_t product) {
+  uint32_t i;
+  uint64_t s;
+
+  init_array(a_copy, 1024, 12289, 0);
+  init_array(b_copy, 1024, 12289, 0);
+  for (i=0; i<NTESTS; i++) {
+    copy_array(a, a_copy, 1024);
+    copy_array(b, b_copy, 1024);
+    s = cpucycles();
+    product(c, a, b);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test %s (q=12289, n=1024): median = %"PRIu64"\n", name, median_time());
+}
+
+int main(void) {
+  uint32_t i;
+
+  for (i=0; i<NUM_BACKENDS; i++) {
+    test_reductions(backends + i);
+    test_ntts(backends + i);
+    test_product("product", backends + i, backends[i].product);
+    test_product("product_asm", backends + i, backends[i].product_asm);
+    printf("\n");
+  }
+  test_same_as_ntt_red();
+  printf("\n");
+
+  for (i=0; i<NUM_BACKENDS; i++) {
+    speed_test("ntt_ln_product", backends + i, backends[i].product);
+    speed_test("ntt_ln_product_asm", backends + i, backends[i].product_asm);
+  }
+  speed_test_red("ntt_red1024_product5", ntt_red1024_product5);
+  speed_test_red("ntt_red1024_product5_asm", ntt_red1024_product5_asm);
+
+  return 0;
+}
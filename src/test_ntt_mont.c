@@ -0,0 +1,759 @@
+/*
+ * Tests of the 16-bit NTT functions with Montgomery multiplication
+ * - tables: all constants are in Montgomery form (c * 2^16 modulo Q)
+ *   with the right companions, the final scaling constants include
+ *   an extra 2^16 to cancel the 2^-16 of the pointwise product
+ * - product steps: the 2^-16 factors cancel out as expected
+ * - ntt_mont.c: checked against the definition of NTT
+ * - ntt_mont_asm.S: checked against ntt_mont.c
+ * - speed comparison with Barrett multiplication (ntt_short_asm.S)
+ *   and with Longa-Naehrig reduction (ntt_asm.S)
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_mont.h"
+#include "ntt_mont_asm.h"
+#include "ntt_mont1024_tables.h"
+#include "ntt_short_asm.h"
+#include "ntt_short1024_tables.h"
+#include "ntt_asm.h"
+#include "ntt_red1024_tables.h"
+#include "sort.h"
+
+#define Q 12289
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 102400
+
+static uint64_t t[NTESTS];
+
+// Average run time
+static uint64_t average_time(void) {
+  uint64_t s;
+  uint32_t i;
+
+  s = 0;
+  for (i=0; i<NTESTS; i++) {
+    s += t[i];
+  }
+  return s/NTESTS;
+}
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+
+/*
+ * Print array of size n
+ */
+static void print_array(FILE *f, const int16_t *a, int32_t n) {
+  uint32_t i, k;
+
+  k = 0;
+  for (i=0; i<n; i++) {
+    if (k == 0) fprintf(f, "  ");
+    fprintf(f, "%6"PRId16, a[i]);
+    k ++;
+    if (k == 16) {
+      fprintf(f, "\n");
+      k = 0;
+    } else {
+      fprintf(f, " ");
+    }
+  }
+  if (k > 0) {
+    fprintf(f, "\n");
+  }
+}
+
+/*
+ * Check equality between a and b: arrays of n elements
+ */
+static bool equal_arrays(const int16_t *a, const int16_t *b, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] != b[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Random integer in the range [-n, n]
+ */
+static int32_t random_coeff(int32_t n) {
+  int32_t x;
+
+  assert(n > 0);
+
+  x = random() % (2 * n + 1);
+  x -= n;
+  assert(-n <= x && x <= n);
+  return x;
+}
+
+/*
+ * Store random integers in [-b, b] in a
+ * - n = number of elements
+ */
+static void random_array(int16_t *a, uint32_t n, int32_t b) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a[i] = random_coeff(b);
+  }
+}
+
+/*
+ * Random table of 2n constants: n random constants in [-6144, 6144]
+ * followed by their Montgomery companions.
+ * - the companion of w is w * Q^-1 modulo 2^16 (Q^-1 = -12287)
+ */
+static int16_t montgomery_companion(int32_t w) {
+  return (int16_t) (w * -12287);
+}
+
+static void random_table(int16_t *p, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    p[i] = random_coeff(6144);
+    p[n + i] = montgomery_companion(p[i]);
+  }
+}
+
+/*
+ * Copy a into b
+ */
+static void copy_array(int16_t *b, const int16_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    b[i] = a[i];
+  }
+}
+
+
+/*
+ * REDUCTIONS
+ */
+
+/*
+ * Check the bounds on reduction and Montgomery multiplication
+ * - red is checked for all 16-bit integers
+ * - mul_montc is checked for all 16-bit integers and a few constants
+ */
+static int16_t all_int16[65536] __attribute__ ((aligned(32)));
+static int16_t all_red[65536] __attribute__ ((aligned(32)));
+static int16_t all_red_asm[65536] __attribute__ ((aligned(32)));
+
+static void init_all_int16(void) {
+  uint32_t i;
+
+  for (i=0; i<65536; i++) {
+    all_int16[i] = (int16_t) (i - 32768);
+  }
+}
+
+static void test_reduce(void) {
+  uint32_t i;
+  int32_t x, y, min, max;
+
+  printf("Testing mont_reduce_array: all 16bit integers\n");
+  init_all_int16();
+  copy_array(all_red, all_int16, 65536);
+  copy_array(all_red_asm, all_int16, 65536);
+  mont_reduce_array(all_red, 65536);
+  mont_reduce_array_asm(all_red_asm, 65536);
+  if (!equal_arrays(all_red, all_red_asm, 65536)) {
+    printf("failed: mont_reduce_array_asm and mont_reduce_array differ\n");
+    exit(1);
+  }
+  min = 0;
+  max = 0;
+  for (i=0; i<65536; i++) {
+    x = all_int16[i];
+    y = all_red[i];
+    if ((x - y) % Q != 0) {
+      printf("failed: red(%"PRId32") = %"PRId32"\n", x, y);
+      exit(1);
+    }
+    if (y < min) min = y;
+    if (y > max) max = y;
+  }
+  printf("range: [%"PRId32", %"PRId32"]\n", min, max);
+  if (min < -6145 || max > 6145) {
+    printf("failed: bound\n");
+    exit(1);
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_mul_montc(void) {
+  static int16_t p[2 * 65536];
+  int16_t w[6] = { 1, -1, 6144, -6144, 4091, -12 };
+  uint32_t i, k;
+  int32_t x, y, bound;
+
+  printf("Testing mont_mul_array16: all 16bit integers\n");
+  for (k=0; k<6; k++) {
+    for (i=0; i<65536; i++) {
+      p[i] = w[k];
+      p[65536 + i] = montgomery_companion(w[k]);
+    }
+    init_all_int16();
+    copy_array(all_red, all_int16, 65536);
+    copy_array(all_red_asm, all_int16, 65536);
+    mont_mul_array16(all_red, 65536, p);
+    mont_mul_array16_asm(all_red_asm, 65536, p);
+    if (!equal_arrays(all_red, all_red_asm, 65536)) {
+      printf("failed: mont_mul_array16_asm and mont_mul_array16 differ\n");
+      exit(1);
+    }
+    for (i=0; i<65536; i++) {
+      x = all_int16[i];
+      y = all_red[i];
+      // y * 2^16 = x * w modulo Q and |y| <= |x * w|/2^16 + 6145
+      bound = abs(x * w[k])/65536 + 6145;
+      if ((x * w[k] - y * 65536) % Q != 0 || abs(y) > bound) {
+	printf("failed: mul_montc(%"PRId32", %"PRId16") = %"PRId32"\n", x, w[k], y);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_mul_mont(void) {
+  int16_t a[1024], b[1024], c[1024], d[1024];
+  uint32_t i, j;
+  int32_t x;
+
+  printf("Testing mont_mul_array\n");
+  for (j=0; j<10000; j++) {
+    random_array(a, 1024, 32767);
+    random_array(b, 1024, 32767);
+    mont_mul_array(c, 1024, a, b);
+    mont_mul_array_asm(d, 1024, a, b);
+    if (!equal_arrays(c, d, 1024)) {
+      printf("failed: mont_mul_array_asm and mont_mul_array differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      // c[i] * 2^16 = a[i] * b[i] modulo Q
+      x = ((int32_t) a[i] * b[i] - (int32_t) c[i] * 65536) % Q;
+      if (x != 0 || abs(c[i]) > abs((int32_t) a[i] * b[i])/65536 + 6145) {
+	printf("failed: mul_mont(%"PRId16", %"PRId16") = %"PRId16"\n", a[i], b[i], c[i]);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+static void test_finalize(void) {
+  int16_t a[1024], b[1024], c[1024];
+  int16_t p[2048];
+  uint32_t i, j;
+
+  printf("Testing mont_mul_finalize and mont_scalar_mul_finalize\n");
+  for (j=0; j<10000; j++) {
+    random_array(a, 1024, 32767);
+    random_table(p, 1024);
+    copy_array(b, a, 1024);
+    copy_array(c, a, 1024);
+    mont_mul_finalize(b, 1024, p);
+    mont_mul_finalize_asm(c, 1024, p);
+    if (!equal_arrays(b, c, 1024)) {
+      printf("failed: mont_mul_finalize_asm and mont_mul_finalize differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      // b[i] * 2^16 = a[i] * p[i] modulo Q
+      if (b[i] < 0 || b[i] >= Q || ((int32_t) a[i] * p[i] - (int32_t) b[i] * 65536) % Q != 0) {
+	printf("failed: mul_finalize(%"PRId16", %"PRId16") = %"PRId16"\n", a[i], p[i], b[i]);
+	exit(1);
+      }
+    }
+
+    copy_array(b, a, 1024);
+    copy_array(c, a, 1024);
+    mont_scalar_mul_finalize(b, 1024, p[0], p[1024]);
+    mont_scalar_mul_finalize_asm(c, 1024, p[0], p[1024]);
+    if (!equal_arrays(b, c, 1024)) {
+      printf("failed: mont_scalar_mul_finalize_asm and mont_scalar_mul_finalize differ\n");
+      exit(1);
+    }
+    for (i=0; i<1024; i++) {
+      if (b[i] < 0 || b[i] >= Q || ((int32_t) a[i] * p[0] - (int32_t) b[i] * 65536) % Q != 0) {
+	printf("failed: scalar_mul_finalize(%"PRId16", %"PRId16") = %"PRId16"\n", a[i], p[0], b[i]);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+
+/*
+ * REFERENCE NTT
+ */
+
+/*
+ * x^k modulo Q
+ */
+static int32_t power(int32_t x, uint32_t k) {
+  int32_t y;
+
+  x %= Q;
+  if (x < 0) x += Q;
+  y = 1;
+  while (k != 0) {
+    if ((k & 1) != 0) {
+      y = (y * x) % Q;
+    }
+    k >>= 1;
+    x = (x * x) % Q;
+  }
+  return y;
+}
+
+static uint32_t bitrev(uint32_t i, uint32_t n) {
+  uint32_t x;
+
+  x = 0;
+  while (n > 1) {
+    x = (x << 1) | (i & 1);
+    i >>= 1;
+    n >>= 1;
+  }
+  return x;
+}
+
+/*
+ * Compute b[k] = sum_i a[i] * psi^i * omega^(i k) modulo Q, in [0, Q-1]
+ * - psi = 1 for the plain NTT
+ */
+static void naive_ntt(int32_t *b, const int16_t *a, uint32_t n, int32_t omega, int32_t psi) {
+  int32_t c[n];
+  uint32_t i, k;
+  int32_t s, w, x;
+
+  x = 1;
+  for (i=0; i<n; i++) {
+    c[i] = (a[i] * x) % Q;
+    x = (x * psi) % Q;
+  }
+  for (k=0; k<n; k++) {
+    w = power(omega, k);
+    x = 1;
+    s = 0;
+    for (i=0; i<n; i++) {
+      s = (s + c[i] * x) % Q;
+      x = (x * w) % Q;
+    }
+    if (s < 0) s += Q;
+    b[k] = s;
+  }
+}
+
+/*
+ * Naive product modulo (X^n + 1) and Q: result in [0, Q-1]
+ */
+static void naive_product(int32_t *c, const int16_t *a, const int16_t *b, uint32_t n) {
+  uint32_t i, j;
+  int32_t s;
+
+  for (i=0; i<n; i++) {
+    s = 0;
+    for (j=0; j<=i; j++) {
+      s = (s + a[j] * b[i - j]) % Q;
+    }
+    for (j=i+1; j<n; j++) {
+      s = (s - a[j] * b[n + i - j]) % Q;
+    }
+    if (s < 0) s += Q;
+    c[i] = s;
+  }
+}
+
+
+/*
+ * MONTGOMERY FORM
+ */
+
+#define R 4091 // 2^16 modulo Q
+
+/*
+ * Check constant w with companion w_mont:
+ * - w must be congruent to c * 2^16 modulo Q and in [-(Q-1)/2, (Q-1)/2]
+ * - w_mont must be w * Q^-1 modulo 2^16
+ */
+static bool good_mont_constant(int16_t w, int16_t w_mont, int32_t c) {
+  return -6144 <= w && w <= 6144 && (w - c * R) % Q == 0 &&
+    (int16_t) (w * ntt_mont1024_qinv) == w_mont;
+}
+
+/*
+ * Table of powers: p[i] = x^i * c * 2^16 for i=0 ... n-1
+ */
+static void check_power_table(const char *name, const int16_t *p, uint32_t n, int32_t c, int32_t x) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (!good_mont_constant(p[i], p[n + i], (c * power(x, i)) % Q)) {
+      printf("failed: %s[%"PRIu32"] = %"PRId16" (companion %"PRId16")\n", name, i, p[i], p[n + i]);
+      exit(1);
+    }
+  }
+}
+
+/*
+ * NTT table: p[t + j] = x^(n/2t) * y^(n/2t)^j * 2^16 for t=1, 2, ..., n/2
+ * and j=0 ... t-1 (bitrev(j) instead of j if rev is true).
+ */
+static void check_ntt_table(const char *name, const int16_t *p, uint32_t n, int32_t x, int32_t y, bool rev) {
+  uint32_t t, j, e;
+  int32_t c;
+
+  for (t=1; t<n; t <<= 1) {
+    for (j=0; j<t; j++) {
+      e = rev ? bitrev(j, t) : j;
+      c = (power(x, n/(2*t)) * power(y, (n/(2*t)) * e)) % Q;
+      if (!good_mont_constant(p[t + j], p[n + t + j], c)) {
+	printf("failed: %s[%"PRIu32"] = %"PRId16" (companion %"PRId16")\n", name, t + j, p[t + j], p[n + t + j]);
+	exit(1);
+      }
+    }
+  }
+}
+
+static void test_tables(void) {
+  int32_t psi, inv_psi, omega, inv_omega, inv_n;
+
+  printf("Testing ntt_mont1024 tables: Montgomery form and companions\n");
+  psi = ntt_mont1024_psi;
+  inv_psi = ntt_mont1024_inv_psi;
+  omega = (psi * psi) % Q;
+  inv_omega = ntt_mont1024_inv_omega;
+  inv_n = ntt_mont1024_inv_n;
+  if (((ntt_mont1024_qinv * Q) & 0xFFFF) != 1 || (psi * inv_psi) % Q != 1 || (omega * inv_omega) % Q != 1 ||
+      (ntt_mont1024_omega - omega) % Q != 0 || ((1024 * inv_n) - 1) % Q != 0) {
+    printf("failed: parameters\n");
+    exit(1);
+  }
+
+  // rescale = inverse(n) * 2^16 in Montgomery form: the extra 2^16
+  // cancels the 2^-16 of mont_mul_array
+  if (!good_mont_constant(ntt_mont1024_rescale, ntt_mont1024_rescale_mont, (inv_n * R) % Q)) {
+    printf("failed: rescale\n");
+    exit(1);
+  }
+  check_power_table("psi_powers", ntt_mont1024_psi_powers, 1024, 1, psi);
+  check_power_table("scaled_inv_psi_powers", ntt_mont1024_scaled_inv_psi_powers, 1024, (inv_n * R) % Q, inv_psi);
+
+  check_ntt_table("omega_powers", ntt_mont1024_omega_powers, 1024, 1, omega, false);
+  check_ntt_table("omega_powers_rev", ntt_mont1024_omega_powers_rev, 1024, 1, omega, true);
+  check_ntt_table("inv_omega_powers", ntt_mont1024_inv_omega_powers, 1024, 1, inv_omega, false);
+  check_ntt_table("inv_omega_powers_rev", ntt_mont1024_inv_omega_powers_rev, 1024, 1, inv_omega, true);
+  check_ntt_table("mixed_powers", ntt_mont1024_mixed_powers, 1024, psi, omega, false);
+  check_ntt_table("mixed_powers_rev", ntt_mont1024_mixed_powers_rev, 1024, psi, omega, true);
+  check_ntt_table("inv_mixed_powers", ntt_mont1024_inv_mixed_powers, 1024, inv_psi, inv_omega, false);
+  check_ntt_table("inv_mixed_powers_rev", ntt_mont1024_inv_mixed_powers_rev, 1024, inv_psi, inv_omega, true);
+  printf("all tests passed\n\n");
+}
+
+/*
+ * Steps of product5 (mulntt, pointwise product, inttmul, rescaling):
+ * - after mont_mul_array: c[i] = NTT(a)[i] * NTT(b)[i] * 2^-16
+ * - after the inverse NTT: c[i] = n * (a * b)[i] * 2^-16
+ * - after mont_scalar_mul_finalize with rescale: c = a * b exactly
+ */
+static void test_folded_scaling(void) {
+  int16_t a[1024], b[1024], c[1024], a0[1024], b0[1024];
+  int32_t na[1024], nb[1024], d[1024];
+  uint32_t i, j, k;
+
+  printf("Testing the 2^-16 scaling in the product steps\n");
+  for (j=0; j<20; j++) {
+    for (i=0; i<1024; i++) {
+      a0[i] = random() % Q;
+      b0[i] = random() % Q;
+    }
+    copy_array(a, a0, 1024);
+    copy_array(b, b0, 1024);
+    mulntt_mont_ct_std2rev(a, 1024, ntt_mont1024_mixed_powers_rev);
+    mulntt_mont_ct_std2rev(b, 1024, ntt_mont1024_mixed_powers_rev);
+    mont_mul_array(c, 1024, a, b);
+    naive_ntt(na, a0, 1024, (ntt_mont1024_psi * ntt_mont1024_psi) % Q, ntt_mont1024_psi);
+    naive_ntt(nb, b0, 1024, (ntt_mont1024_psi * ntt_mont1024_psi) % Q, ntt_mont1024_psi);
+    for (i=0; i<1024; i++) {
+      k = bitrev(i, 1024);
+      if ((c[i] * R - (na[k] * nb[k]) % Q) % Q != 0) {
+	printf("failed: mont_mul_array (index %"PRIu32")\n", i);
+	exit(1);
+      }
+    }
+
+    nttmul_mont_gs_rev2std(c, 1024, ntt_mont1024_inv_mixed_powers_rev);
+    naive_product(d, a0, b0, 1024);
+    for (i=0; i<1024; i++) {
+      if ((c[i] * R - 1024 * d[i]) % Q != 0) {
+	printf("failed: inverse NTT (index %"PRIu32")\n", i);
+	exit(1);
+      }
+    }
+
+    mont_scalar_mul_finalize(c, 1024, ntt_mont1024_rescale, ntt_mont1024_rescale_mont);
+    for (i=0; i<1024; i++) {
+      if (c[i] != d[i]) {
+	printf("failed: final scaling (index %"PRIu32")\n", i);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n\n");
+}
+
+/*
+ * Check the C functions: f(a, n, p) with a in the given order
+ * - rev_in: true if f expects input in bit-reverse order
+ * - rev_out: true if f produces output in bit-reverse order
+ * - psi_in: multiply the input by powers of psi (mulntt)
+ * - psi_out: multiply the output by powers of psi (nttmul)
+ * - bound = bound on the input coefficients
+ */
+static void check_ntt(const char *name, void (*f)(int16_t *, uint32_t, const int16_t *), const int16_t *p,
+		      int32_t omega, int32_t psi, bool rev_in, bool rev_out, bool psi_in, bool psi_out, int32_t bound) {
+  int16_t a[1024], b[1024], c[1024];
+  int32_t d[1024], x;
+  uint32_t i, j;
+
+  printf("Testing %s: n = 1024\n", name);
+  for (j=0; j<10; j++) {
+    random_array(a, 1024, bound);
+    if (j == 0) {
+      for (i=0; i<1024; i++) a[i] = bound; // extreme input
+    }
+    // b = input in the order expected by f
+    for (i=0; i<1024; i++) {
+      b[rev_in ? bitrev(i, 1024) : i] = a[i];
+    }
+    copy_array(c, b, 1024);
+    f(b, 1024, p);
+    naive_ntt(d, a, 1024, omega, psi_in ? psi : 1);
+    for (i=0; i<1024; i++) {
+      x = b[rev_out ? bitrev(i, 1024) : i];
+      if (psi_out) {
+	d[i] = (d[i] * power(psi, i)) % Q;
+      }
+      if ((x - d[i]) % Q != 0) {
+	printf("failed on test %"PRIu32" (index %"PRIu32")\n", j, i);
+	printf("--> input:\n");
+	print_array(stdout, c, 1024);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void test_c_ntts(void) {
+  int32_t omega, inv_omega, psi, inv_psi;
+
+  omega = ntt_mont1024_omega;
+  inv_omega = ntt_mont1024_inv_omega;
+  psi = ntt_mont1024_psi;
+  inv_psi = ntt_mont1024_inv_psi;
+
+  check_ntt("ntt_mont_ct_rev2std", ntt_mont_ct_rev2std, ntt_mont1024_omega_powers,
+	    omega, psi, true, false, false, false, 12289);
+  check_ntt("mulntt_mont_ct_rev2std", mulntt_mont_ct_rev2std, ntt_mont1024_mixed_powers,
+	    omega, psi, true, false, true, false, 12289);
+  check_ntt("ntt_mont_ct_std2rev", ntt_mont_ct_std2rev, ntt_mont1024_omega_powers_rev,
+	    omega, psi, false, true, false, false, 12289);
+  check_ntt("mulntt_mont_ct_std2rev", mulntt_mont_ct_std2rev, ntt_mont1024_mixed_powers_rev,
+	    omega, psi, false, true, true, false, 12289);
+  check_ntt("ntt_mont_gs_rev2std", ntt_mont_gs_rev2std, ntt_mont1024_omega_powers_rev,
+	    omega, psi, true, false, false, false, 16383);
+  check_ntt("nttmul_mont_gs_rev2std", nttmul_mont_gs_rev2std, ntt_mont1024_inv_mixed_powers_rev,
+	    inv_omega, inv_psi, true, false, false, true, 16383);
+  check_ntt("ntt_mont_gs_std2rev", ntt_mont_gs_std2rev, ntt_mont1024_omega_powers,
+	    omega, psi, false, true, false, false, 16383);
+  check_ntt("nttmul_mont_gs_std2rev", nttmul_mont_gs_std2rev, ntt_mont1024_inv_mixed_powers,
+	    inv_omega, inv_psi, false, true, false, true, 16383);
+  printf("\n");
+}
+
+
+/*
+ * ASSEMBLY VERSIONS
+ */
+
+/*
+ * Cross check: apply f (assembly) and g (C) to the same input and random table
+ * - bound = bound on the input coefficients
+ * - check that the intermediate bounds hold: the output must be in [-out_bound, out_bound]
+ */
+static void cross_check(const char *name, uint32_t n, int32_t bound, int32_t out_bound,
+			void (*f)(int16_t *, uint32_t, const int16_t *),
+			void (*g)(int16_t *, uint32_t, const int16_t *)) {
+  int16_t a[n], b[n], c[n], p[2 * n];
+  uint32_t i, j;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (j=0; j<20000; j++) {
+    random_table(p, n);
+    random_array(a, n, bound);
+    if (j == 0) {
+      for (i=0; i<n; i++) a[i] = bound;
+    }
+    copy_array(b, a, n);
+    copy_array(c, a, n); // keep a copy in case of error
+    f(a, n, p);
+    g(b, n, p);
+    if (!equal_arrays(a, b, n)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, c, n);
+      printf("--> output:\n");
+      print_array(stdout, a, n);
+      printf("correct result:\n");
+      print_array(stdout, b, n);
+      exit(1);
+    }
+    for (i=0; i<n; i++) {
+      if (abs(b[i]) > out_bound) {
+	printf("failed on test %"PRIu32": output bound\n", j);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+static void tests_asm(uint32_t n) {
+  printf("===== size %"PRIu32" =====\n", n);
+  cross_check("ntt_mont_ct_rev2std_asm", n, 12289, 13442, ntt_mont_ct_rev2std_asm, ntt_mont_ct_rev2std);
+  cross_check("ntt_mont_ct_std2rev_asm", n, 12289, 13442, ntt_mont_ct_std2rev_asm, ntt_mont_ct_std2rev);
+  cross_check("ntt_mont_gs_rev2std_asm", n, 16383, 12288, ntt_mont_gs_rev2std_asm, ntt_mont_gs_rev2std);
+  cross_check("ntt_mont_gs_std2rev_asm", n, 16383, 12288, ntt_mont_gs_std2rev_asm, ntt_mont_gs_std2rev);
+  printf("\n");
+}
+
+
+/*
+ * SPEED
+ */
+
+// global buffers used for speed tests. alignment matters (for speed)
+static int16_t a16[2048] __attribute__ ((aligned(32)));
+static int32_t a32[2048] __attribute__ ((aligned(32)));
+
+static void print_speed(const char *name, uint32_t n, uint64_t c) {
+  uint32_t i;
+  uint64_t avg, med;
+
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c - t[i];
+
+  avg = average_time();
+  med = median_time();
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64", average = %"PRIu64"\n", name, n, med, avg);
+}
+
+static void speed_test16(const char *name, uint32_t n, const int16_t *p, void (*f)(int16_t *, uint32_t, const int16_t *)) {
+  uint32_t i;
+
+  random_array(a16, n, 6144);
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a16, n, p);
+  }
+  print_speed(name, n, cpucycles());
+}
+
+static void speed_test32(const char *name, uint32_t n, const int16_t *p, void (*f)(int32_t *, uint32_t, const int16_t *)) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    a32[i] = random_coeff(6144);
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a32, n, p);
+  }
+  print_speed(name, n, cpucycles());
+}
+
+static void speed_tests(void) {
+  printf("===== speed: Montgomery vs. Barrett vs. Longa-Naehrig =====\n");
+  speed_test16("ntt_mont_ct_rev2std", 1024, ntt_mont1024_omega_powers, ntt_mont_ct_rev2std);
+  speed_test16("ntt_mont_ct_rev2std_asm", 1024, ntt_mont1024_omega_powers, ntt_mont_ct_rev2std_asm);
+  speed_test16("ntt_short_ct_rev2std_asm", 1024, ntt_short1024_omega_powers, ntt_short_ct_rev2std_asm);
+  speed_test32("ntt_red_ct_rev2std_asm", 1024, ntt_red1024_omega_powers, ntt_red_ct_rev2std_asm);
+  speed_test16("ntt_mont_ct_std2rev_asm", 1024, ntt_mont1024_omega_powers_rev, ntt_mont_ct_std2rev_asm);
+  speed_test16("ntt_short_ct_std2rev_asm", 1024, ntt_short1024_omega_powers_rev, ntt_short_ct_std2rev_asm);
+  speed_test32("ntt_red_ct_std2rev_asm", 1024, ntt_red1024_omega_powers_rev, ntt_red_ct_std2rev_asm);
+  speed_test16("ntt_mont_gs_rev2std_asm", 1024, ntt_mont1024_omega_powers_rev, ntt_mont_gs_rev2std_asm);
+  speed_test16("ntt_short_gs_rev2std_asm", 1024, ntt_short1024_omega_powers_rev, ntt_short_gs_rev2std_asm);
+  speed_test32("ntt_red_gs_rev2std_asm", 1024, ntt_red1024_omega_powers_rev, ntt_red_gs_rev2std_asm);
+  speed_test16("ntt_mont_gs_std2rev_asm", 1024, ntt_mont1024_omega_powers, ntt_mont_gs_std2rev_asm);
+  speed_test16("ntt_short_gs_std2rev_asm", 1024, ntt_short1024_omega_powers, ntt_short_gs_std2rev_asm);
+  speed_test32("ntt_red_gs_std2rev_asm", 1024, ntt_red1024_omega_powers, ntt_red_gs_std2rev_asm);
+  printf("\n");
+}
+
+int main(void) {
+  test_tables();
+  test_folded_scaling();
+  test_c_ntts();
+  if (avx2_supported()) {
+    printf("AVX2 is supported\n\n");
+    test_reduce();
+    test_mul_montc();
+    test_mul_mont();
+    test_finalize();
+    tests_asm(32);
+    tests_asm(64);
+    tests_asm(128);
+    tests_asm(256);
+    tests_asm(512);
+    tests_asm(1024);
+    tests_asm(2048);
+    speed_tests();
+  } else {
+    printf("AVX2 is not supported\n");
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Tests of the multi-threaded NTTs
+ * - ntt_par_ct_std2rev and ntt_par_gs_rev2std are compared with
+ *   mulntt_red_ct_std2rev and nttmul_red_gs_rev2std
+ *
+ * As in test_ntt_red_rec, sizes above 1024 use synthetic tables
+ * where p[i] = +/-inverse(3) (Q=12289 has no primitive n-th roots of
+ * unity for large n).
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_par.h"
+#include "ntt_red.h"
+#include "ntt_red1024.h"
+
+#define Q 12289
+#define MAX_N 65536
+
+static int32_t a[MAX_N];
+static int32_t b[MAX_N];
+static int16_t p[MAX_N];
+
+/*
+ * Synthetic table: random +/- inverse(3)
+ */
+static void init_table(int16_t *x, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = (random() & 1) ? 4096 : -4096;
+  }
+}
+
+static void test_ntt(ntt_par_t *par, uint32_t n, const int16_t *tbl, bool ct) {
+  uint32_t i, k;
+
+  printf("Testing %s: %"PRIu32" threads, n = %"PRIu32", %"PRIu32" levels\n",
+	 ct ? "ntt_par_ct_std2rev" : "ntt_par_gs_rev2std",
+	 ntt_par_size(par), n, ntt_par_levels(par, n));
+  for (k=0; k<5; k++) {
+    for (i=0; i<n; i++) {
+      a[i] = random() % Q;
+      b[i] = a[i];
+    }
+    if (ct) {
+      ntt_par_ct_std2rev(par, a, n, tbl);
+      mulntt_red_ct_std2rev(b, n, tbl);
+    } else {
+      ntt_par_gs_rev2std(par, a, n, tbl);
+      nttmul_red_gs_rev2std(b, n, tbl);
+    }
+    for (i=0; i<n; i++) {
+      if (a[i] != b[i]) {
+	printf("failed: index %"PRIu32"\n", i);
+	exit(1);
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+int main(void) {
+  static const uint32_t nthreads[6] = { 1, 2, 3, 4, 5, 8 };
+  ntt_par_t *par;
+  uint32_t i, n;
+
+  for (i=0; i<6; i++) {
+    par = ntt_par_create(nthreads[i], i % 2 == 1);
+    if (par == NULL) {
+      printf("failed to create %"PRIu32" threads\n", nthreads[i]);
+      exit(1);
+    }
+    // real tables
+    test_ntt(par, 1024, ntt_red1024_mixed_powers_rev, true);
+    test_ntt(par, 1024, ntt_red1024_inv_mixed_powers_rev, false);
+    // synthetic tables
+    for (n=2048; n<=MAX_N; n <<= 1) {
+      init_table(p, n);
+      test_ntt(par, n, p, true);
+      test_ntt(par, n, p, false);
+    }
+    ntt_par_delete(par);
+    printf("\n");
+  }
+
+  return 0;
+}
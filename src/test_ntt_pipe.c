@@ -0,0 +1,148 @@
+/*
+ * Tests of the pipelined products
+ * - the results are compared with ntt_red<n>_product5_asm
+ * - the inputs must not be modified
+ * - the queue counters must be consistent
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_pipe.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+
+#define Q 12289
+
+#define MAX_COUNT 1000
+
+static int32_t a[MAX_COUNT][1024], b[MAX_COUNT][1024], c[MAX_COUNT][1024];
+static int32_t a_copy[1024], b_copy[1024], d[1024];
+static int32_t *pa[MAX_COUNT], *pb[MAX_COUNT], *pc[MAX_COUNT];
+
+/*
+ * Reference product function
+ */
+static void (*product_fun(uint32_t n))(int32_t *, int32_t *, int32_t *) {
+  return n == 16 ? ntt_red16_product5_asm : n == 256 ? ntt_red256_product5_asm :
+    n == 512 ? ntt_red512_product5_asm : ntt_red1024_product5_asm;
+}
+
+static void check_stats(ntt_pipe_t *pipe, uint32_t depth, uint32_t count) {
+  ntt_pipe_stats_t stats;
+  uint32_t i;
+
+  ntt_pipe_get_stats(pipe, &stats);
+  for (i=0; i<2; i++) {
+    if (stats.queue[i].pushes != count) {
+      printf("failed: queue %"PRIu32": %"PRIu64" pushes (expected %"PRIu32")\n", i, stats.queue[i].pushes, count);
+      exit(1);
+    }
+    if (stats.queue[i].max_depth > depth || (count > 0 && stats.queue[i].max_depth == 0)) {
+      printf("failed: queue %"PRIu32": max depth = %"PRIu32"\n", i, stats.queue[i].max_depth);
+      exit(1);
+    }
+    if (stats.queue[i].depth_sum < count || stats.queue[i].depth_sum > (uint64_t) depth * count) {
+      printf("failed: queue %"PRIu32": depth sum = %"PRIu64"\n", i, stats.queue[i].depth_sum);
+      exit(1);
+    }
+    if (stats.queue[i].full_stalls > count || stats.queue[i].empty_stalls > count) {
+      printf("failed: queue %"PRIu32": too many stalls\n", i);
+      exit(1);
+    }
+  }
+  ntt_pipe_reset_stats(pipe);
+}
+
+static void test_stream(ntt_pipe_t *pipe, uint32_t n, uint32_t depth, uint32_t count) {
+  void (*f)(int32_t *, int32_t *, int32_t *);
+  uint32_t i, j, k;
+
+  printf("Testing pipeline: n = %"PRIu32", depth = %"PRIu32", %"PRIu32" products\n", n, depth, count);
+  for (j=0; j<count; j++) {
+    for (i=0; i<n; i++) {
+      a[j][i] = random() % Q;
+      b[j][i] = random() % Q;
+    }
+  }
+
+  f = product_fun(n);
+  // second round: check that the inputs are unchanged
+  for (k=0; k<2; k++) {
+    for (j=0; j<count; j++) {
+      for (i=0; i<n; i++) {
+	c[j][i] = -1;
+      }
+    }
+    ntt_pipe_product(pipe, pc, pa, pb, count);
+    check_stats(pipe, depth, count);
+
+    for (j=0; j<count; j++) {
+      for (i=0; i<n; i++) {
+	a_copy[i] = a[j][i];
+	b_copy[i] = b[j][i];
+      }
+      f(d, a_copy, b_copy);
+      for (i=0; i<n; i++) {
+	if (c[j][i] != d[i]) {
+	  printf("failed: round %"PRIu32", product %"PRIu32", index %"PRIu32"\n", k, j, i);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+int main(void) {
+  static const uint32_t sizes[4] = { 16, 256, 512, 1024 };
+  static const uint32_t depths[4] = { 1, 2, 8, 64 };
+  static const uint32_t counts[5] = { 0, 1, 5, 67, MAX_COUNT };
+  ntt_pipe_t *pipe;
+  uint32_t i, j, k;
+
+  if (! avx2_supported()) {
+    printf("AVX2 is not supported\n");
+    if (ntt_pipe_create(1024, 0, false) != NULL) {
+      printf("failed: ntt_pipe_create should fail\n");
+      exit(1);
+    }
+    return 0;
+  }
+
+  for (i=0; i<MAX_COUNT; i++) {
+    pa[i] = a[i];
+    pb[i] = b[i];
+    pc[i] = c[i];
+  }
+
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      pipe = ntt_pipe_create(sizes[i], depths[j], j % 2 == 1);
+      if (pipe == NULL) {
+	printf("failed to create a pipeline (n = %"PRIu32", depth = %"PRIu32")\n", sizes[i], depths[j]);
+	exit(1);
+      }
+      for (k=0; k<5; k++) {
+	test_stream(pipe, sizes[i], depths[j], counts[k]);
+      }
+      ntt_pipe_delete(pipe);
+    }
+    printf("\n");
+  }
+
+  if (ntt_pipe_create(128, 0, false) != NULL) {
+    printf("failed: n = 128 should not be supported\n");
+    exit(1);
+  }
+  if (ntt_pipe_create(1024, 6, false) != NULL) {
+    printf("failed: depth = 6 should not be supported\n");
+    exit(1);
+  }
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Tests of the thread-pool batch products
+ * - the results are compared with direct calls to the product functions
+ * - the inputs must not be modified
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_pool.h"
+#include "ntt16.h"
+#include "ntt256.h"
+#include "ntt512.h"
+#include "ntt1024.h"
+#include "ntt_red16.h"
+#include "ntt_red256.h"
+#include "ntt_red512.h"
+#include "ntt_red1024.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+
+#define Q 12289
+
+#define MAX_COUNT 200
+
+static int32_t a[MAX_COUNT][1024], b[MAX_COUNT][1024], c[MAX_COUNT][1024];
+static int32_t a_copy[1024], b_copy[1024], d[1024];
+static int32_t *pa[MAX_COUNT], *pb[MAX_COUNT], *pc[MAX_COUNT];
+
+static const char * const backend_name[3] = {
+  "default", "red", "red_asm",
+};
+
+/*
+ * Reference product function
+ */
+static void (*product_fun(ntt_pool_backend_t backend, uint32_t n))(int32_t *, int32_t *, int32_t *) {
+  switch (backend) {
+  case NTT_POOL_DEFAULT:
+    return n == 16 ? ntt16_product5 : n == 256 ? ntt256_product5 : n == 512 ? ntt512_product5 : ntt1024_product5;
+  case NTT_POOL_RED:
+    return n == 16 ? ntt_red16_product5 : n == 256 ? ntt_red256_product5 : n == 512 ? ntt_red512_product5 : ntt_red1024_product5;
+  default:
+    return n == 16 ? ntt_red16_product5_asm : n == 256 ? ntt_red256_product5_asm :
+      n == 512 ? ntt_red512_product5_asm : ntt_red1024_product5_asm;
+  }
+}
+
+static void test_batch(ntt_pool_t *pool, ntt_pool_backend_t backend, uint32_t n, uint32_t count) {
+  void (*f)(int32_t *, int32_t *, int32_t *);
+  uint32_t i, j;
+
+  printf("Testing %s: %"PRIu32" threads, n = %"PRIu32", %"PRIu32" products\n",
+	 backend_name[backend], ntt_pool_size(pool), n, count);
+  for (j=0; j<count; j++) {
+    for (i=0; i<n; i++) {
+      a[j][i] = random() % Q;
+      b[j][i] = random() % Q;
+      c[j][i] = -1;
+    }
+  }
+  if (ntt_pool_product(pool, backend, n, pc, pa, pb, count) < 0) {
+    printf("failed: ntt_pool_product returned an error\n");
+    exit(1);
+  }
+
+  f = product_fun(backend, n);
+  for (j=0; j<count; j++) {
+    for (i=0; i<n; i++) {
+      a_copy[i] = a[j][i];
+      b_copy[i] = b[j][i];
+    }
+    f(d, a_copy, b_copy);
+    for (i=0; i<n; i++) {
+      if (c[j][i] != d[i]) {
+	printf("failed: product %"PRIu32", index %"PRIu32"\n", j, i);
+	exit(1);
+      }
+    }
+  }
+  // check that the inputs are unchanged: recompute with the pool
+  if (ntt_pool_product(pool, backend, n, pc, pa, pb, count) < 0) {
+    printf("failed: ntt_pool_product returned an error\n");
+    exit(1);
+  }
+  for (j=0; j<count; j++) {
+    for (i=0; i<n; i++) {
+      a_copy[i] = a[j][i];
+      b_copy[i] = b[j][i];
+    }
+    f(d, a_copy, b_copy);
+    for (i=0; i<n; i++) {
+      if (c[j][i] != d[i]) {
+	printf("failed: inputs modified (product %"PRIu32", index %"PRIu32")\n", j, i);
+	exit(1);
+      }
+    }
+  }
+  printf("all tests passed\n");
+}
+
+int main(void) {
+  static const uint32_t nthreads[5] = { 1, 2, 3, 4, 8 };
+  static const uint32_t sizes[4] = { 16, 256, 512, 1024 };
+  static const uint32_t counts[5] = { 0, 1, 5, 67, MAX_COUNT };
+  ntt_pool_t *pool;
+  ntt_pool_backend_t backend, last;
+  uint32_t i, j, k;
+
+  for (i=0; i<MAX_COUNT; i++) {
+    pa[i] = a[i];
+    pb[i] = b[i];
+    pc[i] = c[i];
+  }
+
+  printf("%"PRIu32" cores\n\n", ntt_pool_num_cores());
+  last = avx2_supported() ? NTT_POOL_RED_ASM : NTT_POOL_RED;
+  for (i=0; i<5; i++) {
+    pool = ntt_pool_create(nthreads[i], i % 2 == 1);
+    if (pool == NULL) {
+      printf("failed to create a pool of %"PRIu32" threads\n", nthreads[i]);
+      exit(1);
+    }
+    for (backend=NTT_POOL_DEFAULT; backend<=last; backend++) {
+      for (j=0; j<4; j++) {
+	for (k=0; k<5; k++) {
+	  test_batch(pool, backend, sizes[j], counts[k]);
+	}
+      }
+    }
+    if (ntt_pool_product(pool, NTT_POOL_RED, 128, pc, pa, pb, 1) >= 0) {
+      printf("failed: n = 128 should not be supported\n");
+      exit(1);
+    }
+    ntt_pool_delete(pool);
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -307,6 +307,92 @@ static void test_forward_inverse(const char *fname, const char *iname, void (*fo
 }
 
 
+/*
+ * Check that two NTT functions give the same result
+ * (e.g., radix-2 and radix-4 versions)
+ */
+static void test_same_ntt(const char *fname, const char *gname, void (*f)(int32_t *), void (*g)(int32_t *)) {
+  int32_t a[1024], b[1024];
+  uint32_t n, i;
+
+  printf("Testing %s against %s\n", gname, fname);
+  for (n=0; n<1000; n++) {
+    random_poly(a, 1024);
+    shift_array(a, 1024);
+    for (i=0; i<1024; i++) {
+      b[i] = a[i];
+    }
+    f(a);
+    g(b);
+    if (! equal_arrays(a, b, 1024)) {
+      printf("failed\n");
+      printf("%s:\n", fname);
+      print_array(stdout, a, 1024);
+      printf("%s:\n", gname);
+      print_array(stdout, b, 1024);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+
+// same thing for the constant-geometry versions
+static void test_same_ntt_cg(const char *fname, const char *gname, void (*f)(int32_t *), void (*g)(int32_t *, int32_t *)) {
+  int32_t a[1024], b[1024], tmp[1024];
+  uint32_t n, i;
+
+  printf("Testing %s against %s\n", gname, fname);
+  for (n=0; n<1000; n++) {
+    random_poly(a, 1024);
+    shift_array(a, 1024);
+    for (i=0; i<1024; i++) {
+      b[i] = a[i];
+    }
+    f(a);
+    g(b, tmp);
+    if (! equal_arrays(a, b, 1024)) {
+      printf("failed\n");
+      printf("%s:\n", fname);
+      print_array(stdout, a, 1024);
+      printf("%s:\n", gname);
+      print_array(stdout, b, 1024);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+
+// same thing for the four-step versions: the results are equal modulo Q
+static void test_same_ntt_4step(const char *fname, const char *gname, void (*f)(int32_t *), void (*g)(int32_t *, int32_t *)) {
+  int32_t a[1024], b[1024], tmp[1024];
+  uint32_t n, i;
+
+  printf("Testing %s against %s\n", gname, fname);
+  for (n=0; n<1000; n++) {
+    random_poly(a, 1024);
+    shift_array(a, 1024);
+    for (i=0; i<1024; i++) {
+      b[i] = a[i];
+    }
+    f(a);
+    g(b, tmp);
+    normalize(a, 1024);
+    normalize(b, 1024);
+    if (! equal_arrays(a, b, 1024)) {
+      printf("failed\n");
+      printf("%s:\n", fname);
+      print_array(stdout, a, 1024);
+      printf("%s:\n", gname);
+      print_array(stdout, b, 1024);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+
 /*
  * TEST PRODUCT
  */
@@ -392,6 +478,32 @@ static void speed_test(const char *name, void (*f)(int32_t *)) {
 }
 
 
+// variant for the constant-geometry NTTs
+static void speed_test_cg(const char *name, void (*f)(int32_t *, int32_t *)) {
+  int32_t a[1024], tmp[1024];
+  uint32_t i;
+  uint64_t avg, med, c;
+
+  printf("speed test for %s\n", name);
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a, tmp);
+  }
+  c = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i]; 
+  }
+  t[i] = c - t[i];
+
+  avg = average_time();
+  med = median_time();
+  printf("median = %"PRIu64", average = %"PRIu64"\n\n", med, avg);
+}
+
 // variant for products
 static void speed_test2(const char *name, void (*f)(int32_t *, int32_t *, int32_t *)) {
   int32_t a[1024], b[1024], d[1024];
@@ -433,6 +545,48 @@ int main(void) {
   test_simple_polys("intt_red1024_ct_std2rev", intt_red1024_ct_std2rev, ntt_red1024_inv_omega, true);
   test_simple_polys("intt_red1024_gs_std2rev", intt_red1024_gs_std2rev, ntt_red1024_inv_omega, true);
 
+  test_simple_polys("ntt_red1024_ct_rev2std_r4", ntt_red1024_ct_rev2std_r4, ntt_red1024_omega, false);
+  test_simple_polys("ntt_red1024_gs_rev2std_r4", ntt_red1024_gs_rev2std_r4, ntt_red1024_omega, false);
+  test_simple_polys("ntt_red1024_ct_std2rev_r4", ntt_red1024_ct_std2rev_r4, ntt_red1024_omega, true);
+  test_simple_polys("ntt_red1024_gs_std2rev_r4", ntt_red1024_gs_std2rev_r4, ntt_red1024_omega, true);
+  test_simple_polys("intt_red1024_ct_rev2std_r4", intt_red1024_ct_rev2std_r4, ntt_red1024_inv_omega, false);
+  test_simple_polys("intt_red1024_gs_rev2std_r4", intt_red1024_gs_rev2std_r4, ntt_red1024_inv_omega, false);
+  test_simple_polys("intt_red1024_ct_std2rev_r4", intt_red1024_ct_std2rev_r4, ntt_red1024_inv_omega, true);
+  test_simple_polys("intt_red1024_gs_std2rev_r4", intt_red1024_gs_std2rev_r4, ntt_red1024_inv_omega, true);
+
+  test_same_ntt("ntt_red1024_ct_rev2std", "ntt_red1024_ct_rev2std_r4", ntt_red1024_ct_rev2std, ntt_red1024_ct_rev2std_r4);
+  test_same_ntt("ntt_red1024_gs_rev2std", "ntt_red1024_gs_rev2std_r4", ntt_red1024_gs_rev2std, ntt_red1024_gs_rev2std_r4);
+  test_same_ntt("ntt_red1024_ct_std2rev", "ntt_red1024_ct_std2rev_r4", ntt_red1024_ct_std2rev, ntt_red1024_ct_std2rev_r4);
+  test_same_ntt("ntt_red1024_gs_std2rev", "ntt_red1024_gs_std2rev_r4", ntt_red1024_gs_std2rev, ntt_red1024_gs_std2rev_r4);
+  test_same_ntt("intt_red1024_ct_rev2std", "intt_red1024_ct_rev2std_r4", intt_red1024_ct_rev2std, intt_red1024_ct_rev2std_r4);
+  test_same_ntt("intt_red1024_gs_rev2std", "intt_red1024_gs_rev2std_r4", intt_red1024_gs_rev2std, intt_red1024_gs_rev2std_r4);
+  test_same_ntt("intt_red1024_ct_std2rev", "intt_red1024_ct_std2rev_r4", intt_red1024_ct_std2rev, intt_red1024_ct_std2rev_r4);
+  test_same_ntt("intt_red1024_gs_std2rev", "intt_red1024_gs_std2rev_r4", intt_red1024_gs_std2rev, intt_red1024_gs_std2rev_r4);
+  test_same_ntt("mulntt_red1024_ct_rev2std", "mulntt_red1024_ct_rev2std_r4", mulntt_red1024_ct_rev2std, mulntt_red1024_ct_rev2std_r4);
+  test_same_ntt("mulntt_red1024_ct_std2rev", "mulntt_red1024_ct_std2rev_r4", mulntt_red1024_ct_std2rev, mulntt_red1024_ct_std2rev_r4);
+  test_same_ntt("inttmul_red1024_gs_rev2std", "inttmul_red1024_gs_rev2std_r4", inttmul_red1024_gs_rev2std, inttmul_red1024_gs_rev2std_r4);
+  test_same_ntt("inttmul_red1024_gs_std2rev", "inttmul_red1024_gs_std2rev_r4", inttmul_red1024_gs_std2rev, inttmul_red1024_gs_std2rev_r4);
+
+  test_same_ntt_cg("ntt_red1024_ct_rev2std", "ntt_red1024_ct_rev2std_cg", ntt_red1024_ct_rev2std, ntt_red1024_ct_rev2std_cg);
+  test_same_ntt_cg("ntt_red1024_gs_rev2std", "ntt_red1024_gs_rev2std_cg", ntt_red1024_gs_rev2std, ntt_red1024_gs_rev2std_cg);
+  test_same_ntt_cg("ntt_red1024_ct_std2rev", "ntt_red1024_ct_std2rev_cg", ntt_red1024_ct_std2rev, ntt_red1024_ct_std2rev_cg);
+  test_same_ntt_cg("ntt_red1024_gs_std2rev", "ntt_red1024_gs_std2rev_cg", ntt_red1024_gs_std2rev, ntt_red1024_gs_std2rev_cg);
+  test_same_ntt_cg("intt_red1024_ct_rev2std", "intt_red1024_ct_rev2std_cg", intt_red1024_ct_rev2std, intt_red1024_ct_rev2std_cg);
+  test_same_ntt_cg("intt_red1024_gs_rev2std", "intt_red1024_gs_rev2std_cg", intt_red1024_gs_rev2std, intt_red1024_gs_rev2std_cg);
+  test_same_ntt_cg("intt_red1024_ct_std2rev", "intt_red1024_ct_std2rev_cg", intt_red1024_ct_std2rev, intt_red1024_ct_std2rev_cg);
+  test_same_ntt_cg("intt_red1024_gs_std2rev", "intt_red1024_gs_std2rev_cg", intt_red1024_gs_std2rev, intt_red1024_gs_std2rev_cg);
+  test_same_ntt_cg("mulntt_red1024_ct_rev2std", "mulntt_red1024_ct_rev2std_cg", mulntt_red1024_ct_rev2std, mulntt_red1024_ct_rev2std_cg);
+  test_same_ntt_cg("mulntt_red1024_ct_std2rev", "mulntt_red1024_ct_std2rev_cg", mulntt_red1024_ct_std2rev, mulntt_red1024_ct_std2rev_cg);
+  test_same_ntt_cg("inttmul_red1024_gs_rev2std", "inttmul_red1024_gs_rev2std_cg", inttmul_red1024_gs_rev2std, inttmul_red1024_gs_rev2std_cg);
+  test_same_ntt_cg("inttmul_red1024_gs_std2rev", "inttmul_red1024_gs_std2rev_cg", inttmul_red1024_gs_std2rev, inttmul_red1024_gs_std2rev_cg);
+
+  test_same_ntt_4step("ntt_red1024_ct_std2rev", "ntt_red1024_ct_std2rev_4step", ntt_red1024_ct_std2rev, ntt_red1024_ct_std2rev_4step);
+  test_same_ntt_4step("ntt_red1024_gs_rev2std", "ntt_red1024_gs_rev2std_4step", ntt_red1024_gs_rev2std, ntt_red1024_gs_rev2std_4step);
+  test_same_ntt_4step("intt_red1024_ct_std2rev", "intt_red1024_ct_std2rev_4step", intt_red1024_ct_std2rev, intt_red1024_ct_std2rev_4step);
+  test_same_ntt_4step("intt_red1024_gs_rev2std", "intt_red1024_gs_rev2std_4step", intt_red1024_gs_rev2std, intt_red1024_gs_rev2std_4step);
+  test_same_ntt_4step("mulntt_red1024_ct_std2rev", "mulntt_red1024_ct_std2rev_4step", mulntt_red1024_ct_std2rev, mulntt_red1024_ct_std2rev_4step);
+  test_same_ntt_4step("inttmul_red1024_gs_rev2std", "inttmul_red1024_gs_rev2std_4step", inttmul_red1024_gs_rev2std, inttmul_red1024_gs_rev2std_4step);
+
   test_forward_inverse("ntt_red1024_ct_std2rev", "intt_red1024_ct_rev2std", ntt_red1024_ct_std2rev, intt_red1024_ct_rev2std);
   test_forward_inverse("intt_red1024_ct_rev2std", "ntt_red1024_ct_std2rev", intt_red1024_ct_rev2std, ntt_red1024_ct_std2rev);
   test_forward_inverse("ntt_red1024_ct_std2rev", "intt_red1024_gs_rev2std", ntt_red1024_ct_std2rev, intt_red1024_gs_rev2std);
@@ -445,6 +599,9 @@ int main(void) {
   test_simple_products("ntt_red1024_product3", ntt_red1024_product3);
   test_simple_products("ntt_red1024_product4", ntt_red1024_product4);
   test_simple_products("ntt_red1024_product5", ntt_red1024_product5);
+  test_simple_products("ntt_red1024_product_r4", ntt_red1024_product_r4);
+  test_simple_products("ntt_red1024_product7", ntt_red1024_product7);
+  test_simple_products("ntt_red1024_product_4step", ntt_red1024_product_4step);
 
   speed_test("ntt_red1024_ct_rev2std", ntt_red1024_ct_rev2std);
   speed_test("ntt_red1024_gs_rev2std", ntt_red1024_gs_rev2std);
@@ -456,12 +613,38 @@ int main(void) {
   speed_test("intt_red1024_ct_std2rev", intt_red1024_ct_std2rev);
   speed_test("intt_red1024_gs_std2rev", intt_red1024_gs_std2rev);
   printf("\n");
+  speed_test("ntt_red1024_ct_rev2std_r4", ntt_red1024_ct_rev2std_r4);
+  speed_test("ntt_red1024_gs_rev2std_r4", ntt_red1024_gs_rev2std_r4);
+  speed_test("ntt_red1024_ct_std2rev_r4", ntt_red1024_ct_std2rev_r4);
+  speed_test("ntt_red1024_gs_std2rev_r4", ntt_red1024_gs_std2rev_r4);
+  printf("\n");
+  speed_test("intt_red1024_ct_rev2std_r4", intt_red1024_ct_rev2std_r4);
+  speed_test("intt_red1024_gs_rev2std_r4", intt_red1024_gs_rev2std_r4);
+  speed_test("intt_red1024_ct_std2rev_r4", intt_red1024_ct_std2rev_r4);
+  speed_test("intt_red1024_gs_std2rev_r4", intt_red1024_gs_std2rev_r4);
+  printf("\n");
+  speed_test_cg("ntt_red1024_ct_rev2std_cg", ntt_red1024_ct_rev2std_cg);
+  speed_test_cg("ntt_red1024_gs_rev2std_cg", ntt_red1024_gs_rev2std_cg);
+  speed_test_cg("ntt_red1024_ct_std2rev_cg", ntt_red1024_ct_std2rev_cg);
+  speed_test_cg("ntt_red1024_gs_std2rev_cg", ntt_red1024_gs_std2rev_cg);
+  printf("\n");
+  speed_test_cg("intt_red1024_ct_rev2std_cg", intt_red1024_ct_rev2std_cg);
+  speed_test_cg("intt_red1024_gs_rev2std_cg", intt_red1024_gs_rev2std_cg);
+  speed_test_cg("intt_red1024_ct_std2rev_cg", intt_red1024_ct_std2rev_cg);
+  speed_test_cg("intt_red1024_gs_std2rev_cg", intt_red1024_gs_std2rev_cg);
+  printf("\n");
+  speed_test_cg("ntt_red1024_ct_std2rev_4step", ntt_red1024_ct_std2rev_4step);
+  speed_test_cg("intt_red1024_gs_rev2std_4step", intt_red1024_gs_rev2std_4step);
+  printf("\n");
 
   speed_test2("ntt_red1024_product1", ntt_red1024_product1);
   speed_test2("ntt_red1024_product2", ntt_red1024_product2);
   speed_test2("ntt_red1024_product3", ntt_red1024_product3);
   speed_test2("ntt_red1024_product4", ntt_red1024_product4);
   speed_test2("ntt_red1024_product5", ntt_red1024_product5);
+  speed_test2("ntt_red1024_product_r4", ntt_red1024_product_r4);
+  speed_test2("ntt_red1024_product7", ntt_red1024_product7);
+  speed_test2("ntt_red1024_product_4step", ntt_red1024_product_4step);
   
   return 0;
 }
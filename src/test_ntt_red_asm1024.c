@@ -308,6 +308,84 @@ static void test_forward_inverse(const char *fname, const char *iname, void (*fo
 }
 
 
+/*
+ * FOUR-STEP NTTS
+ */
+// transpose_asm must give the same result as transpose
+static void test_transpose(void) {
+  int32_t a[1024], b[1024], c[1024];
+  uint32_t rows, cols;
+
+  printf("Testing transpose_asm\n");
+  for (rows=8; rows<=1024/8; rows += 8) {
+    for (cols=8; rows * cols <= 1024; cols += 8) {
+      random_poly(a, rows * cols);
+      transpose(b, a, rows, cols);
+      transpose_asm(c, a, rows, cols);
+      if (! equal_arrays(b, c, rows * cols)) {
+        printf("failed: rows = %"PRIu32", cols = %"PRIu32"\n", rows, cols);
+        exit(1);
+      }
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+// the four-step versions give the same results modulo Q as the full NTTs
+/*
+ * Check that f and g give the same result (bit for bit)
+ */
+static void test_same_ntt(const char *fname, const char *gname, void (*f)(int32_t *), void (*g)(int32_t *)) {
+  int32_t a[1024], b[1024];
+  uint32_t n, i;
+
+  printf("Testing %s against %s\n", gname, fname);
+  for (n=0; n<1000; n++) {
+    random_poly(a, 1024);
+    for (i=0; i<1024; i++) {
+      b[i] = a[i];
+    }
+    f(a);
+    g(b);
+    if (! equal_arrays(a, b, 1024)) {
+      printf("failed\n");
+      printf("%s:\n", fname);
+      print_array(stdout, a, 1024);
+      printf("%s:\n", gname);
+      print_array(stdout, b, 1024);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+static void test_same_ntt_4step(const char *fname, const char *gname, void (*f)(int32_t *), void (*g)(int32_t *, int32_t *)) {
+  int32_t a[1024], b[1024], tmp[1024];
+  uint32_t n, i;
+
+  printf("Testing %s against %s\n", gname, fname);
+  for (n=0; n<1000; n++) {
+    random_poly(a, 1024);
+    for (i=0; i<1024; i++) {
+      b[i] = a[i];
+    }
+    f(a);
+    g(b, tmp);
+    normalize(a, 1024);
+    normalize(b, 1024);
+    if (! equal_arrays(a, b, 1024)) {
+      printf("failed\n");
+      printf("%s:\n", fname);
+      print_array(stdout, a, 1024);
+      printf("%s:\n", gname);
+      print_array(stdout, b, 1024);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+
 /*
  * TEST PRODUCT
  */
@@ -393,6 +471,33 @@ static void speed_test(const char *name, void (*f)(int32_t *)) {
 }
 
 
+// variant for the four-step NTTs
+static void speed_test_4step(const char *name, void (*f)(int32_t *, int32_t *)) {
+  int32_t a[1024], tmp[1024];
+  uint32_t i;
+  uint64_t avg, med, c;
+
+  printf("speed test for %s\n", name);
+  for (i=0; i<1024; i++) {
+    a[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(a, tmp);
+  }
+  c = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i]; 
+  }
+  t[i] = c - t[i];
+
+  avg = average_time();
+  med = median_time();
+  printf("median = %"PRIu64", average = %"PRIu64"\n\n", med, avg);
+}
+
+
 // variant for products
 static void speed_test2(const char *name, void (*f)(int32_t *, int32_t *, int32_t *)) {
   int32_t a[1024], b[1024], d[1024];
@@ -447,11 +552,27 @@ int main(void) {
   test_forward_inverse("ntt_red1024_gs_std2rev_asm", "intt_red1024_gs_rev2std_asm", ntt_red1024_gs_std2rev_asm, intt_red1024_gs_rev2std_asm);
   test_forward_inverse("intt_red1024_gs_rev2std_asm", "ntt_red1024_gs_std2rev_asm", intt_red1024_gs_rev2std_asm, ntt_red1024_gs_std2rev_asm);
 
+  test_transpose();
+  test_same_ntt_4step("ntt_red1024_ct_std2rev_asm", "ntt_red1024_ct_std2rev_4step_asm", ntt_red1024_ct_std2rev_asm, ntt_red1024_ct_std2rev_4step_asm);
+  test_same_ntt_4step("ntt_red1024_gs_rev2std_asm", "ntt_red1024_gs_rev2std_4step_asm", ntt_red1024_gs_rev2std_asm, ntt_red1024_gs_rev2std_4step_asm);
+  test_same_ntt_4step("intt_red1024_ct_std2rev_asm", "intt_red1024_ct_std2rev_4step_asm", intt_red1024_ct_std2rev_asm, intt_red1024_ct_std2rev_4step_asm);
+  test_same_ntt_4step("intt_red1024_gs_rev2std_asm", "intt_red1024_gs_rev2std_4step_asm", intt_red1024_gs_rev2std_asm, intt_red1024_gs_rev2std_4step_asm);
+  test_same_ntt_4step("mulntt_red1024_ct_std2rev_asm", "mulntt_red1024_ct_std2rev_4step_asm", mulntt_red1024_ct_std2rev_asm, mulntt_red1024_ct_std2rev_4step_asm);
+  test_same_ntt_4step("inttmul_red1024_gs_rev2std_asm", "inttmul_red1024_gs_rev2std_4step_asm", inttmul_red1024_gs_rev2std_asm, inttmul_red1024_gs_rev2std_4step_asm);
+
+  test_same_ntt("mulntt_red1024_ct_std2rev_asm", "mulntt_red1024_ct_std2rev_simd_asm", mulntt_red1024_ct_std2rev_asm, mulntt_red1024_ct_std2rev_simd_asm);
+  test_same_ntt("mulntt_red1024_ct_std2rev_fused_asm", "mulntt_red1024_ct_std2rev_simd_fused_asm", mulntt_red1024_ct_std2rev_fused_asm, mulntt_red1024_ct_std2rev_simd_fused_asm);
+  test_same_ntt("inttmul_red1024_gs_rev2std_asm", "inttmul_red1024_gs_rev2std_simd_asm", inttmul_red1024_gs_rev2std_asm, inttmul_red1024_gs_rev2std_simd_asm);
+
   test_simple_products("ntt_red1024_product1_asm", ntt_red1024_product1_asm);
   test_simple_products("ntt_red1024_product2_asm", ntt_red1024_product2_asm);
   test_simple_products("ntt_red1024_product3_asm", ntt_red1024_product3_asm);
   test_simple_products("ntt_red1024_product4_asm", ntt_red1024_product4_asm);
   test_simple_products("ntt_red1024_product5_asm", ntt_red1024_product5_asm);
+  test_simple_products("ntt_red1024_product6_asm", ntt_red1024_product6_asm);
+  test_simple_products("ntt_red1024_product_4step_asm", ntt_red1024_product_4step_asm);
+  test_simple_products("ntt_red1024_product_simd_asm", ntt_red1024_product_simd_asm);
+  test_simple_products("ntt_red1024_product_mulld_asm", ntt_red1024_product_mulld_asm);
 
   speed_test("ntt_red1024_ct_rev2std_asm", ntt_red1024_ct_rev2std_asm);
   speed_test("ntt_red1024_gs_rev2std_asm", ntt_red1024_gs_rev2std_asm);
@@ -463,12 +584,24 @@ int main(void) {
   speed_test("intt_red1024_ct_std2rev_asm", intt_red1024_ct_std2rev_asm);
   speed_test("intt_red1024_gs_std2rev_asm", intt_red1024_gs_std2rev_asm);
   printf("\n");
+  speed_test_4step("ntt_red1024_ct_std2rev_4step_asm", ntt_red1024_ct_std2rev_4step_asm);
+  speed_test_4step("intt_red1024_gs_rev2std_4step_asm", intt_red1024_gs_rev2std_4step_asm);
+  printf("\n");
+  speed_test("mulntt_red1024_ct_std2rev_fused_asm", mulntt_red1024_ct_std2rev_fused_asm);
+  speed_test("mulntt_red1024_ct_std2rev_simd_fused_asm", mulntt_red1024_ct_std2rev_simd_fused_asm);
+  speed_test("inttmul_red1024_gs_rev2std_asm", inttmul_red1024_gs_rev2std_asm);
+  speed_test("inttmul_red1024_gs_rev2std_simd_asm", inttmul_red1024_gs_rev2std_simd_asm);
+  printf("\n");
 
   speed_test2("ntt_red1024_product1_asm", ntt_red1024_product1_asm);
   speed_test2("ntt_red1024_product2_asm", ntt_red1024_product2_asm);
   speed_test2("ntt_red1024_product3_asm", ntt_red1024_product3_asm);
   speed_test2("ntt_red1024_product4_asm", ntt_red1024_product4_asm);
   speed_test2("ntt_red1024_product5_asm", ntt_red1024_product5_asm);
+  speed_test2("ntt_red1024_product6_asm", ntt_red1024_product6_asm);
+  speed_test2("ntt_red1024_product_4step_asm", ntt_red1024_product_4step_asm);
+  speed_test2("ntt_red1024_product_simd_asm", ntt_red1024_product_simd_asm);
+  speed_test2("ntt_red1024_product_mulld_asm", ntt_red1024_product_mulld_asm);
   
   return 0;
 }
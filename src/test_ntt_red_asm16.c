@@ -10,6 +10,7 @@
 
 #include "ntt.h"
 #include "ntt_red.h"
+#include "ntt_red16.h"
 #include "bitrev16_table.h"
 #include "ntt_red_asm16.h"
 #include "sort.h"
@@ -367,6 +368,42 @@ static void test_simple_products(const char *name, void (*f)(int32_t *, int32_t
 /*
  * SPEED TESTS
  */
+/*
+ * Cross check: f is an assembly function, g is the C version from ntt_red16.h
+ */
+static void cross_check(const char *name, void (*f)(int32_t *), void (*g)(int32_t *)) {
+  int32_t a[16], b[16], c[16];
+  uint32_t i, j;
+
+  printf("Cross-checking %s\n", name);
+  for (j=0; j<100000; j++) {
+    for (i=0; i<16; i++) {
+      a[i] = random_coeff() - (Q-1)/2;
+      b[i] = a[i];
+      c[i] = a[i];
+    }
+    f(a);
+    g(b);
+    if (!equal_arrays(a, b, 16)) {
+      printf("failed on test %"PRIu32"\n", j);
+      printf("--> input:\n");
+      print_array(stdout, c, 16);
+      printf("--> output:\n");
+      print_array(stdout, a, 16);
+      printf("correct result:\n");
+      print_array(stdout, b, 16);
+      exit(1);
+    }
+  }
+  printf("all tests passed.\n\n");
+}
+
+// reference for the fused variant
+static void mulntt_red16_ct_std2rev_fused(int32_t *a) {
+  mulntt_red16_ct_std2rev(a);
+  reduce_array(a, 16);
+}
+
 static void speed_test(const char *name, void (*f)(int32_t *)) {
   int32_t a[16];
   uint32_t i;
@@ -440,6 +477,14 @@ int main(void) {
   test_simple_polys("intt_red16_ct_std2rev_asm", intt_red16_ct_std2rev_asm, ntt_red16_inv_omega, true);
   test_simple_polys("intt_red16_gs_std2rev_asm", intt_red16_gs_std2rev_asm, ntt_red16_inv_omega, true);
 
+  test_simple_polys("ntt_red16_ct_std2rev_reg_asm", ntt_red16_ct_std2rev_reg_asm, ntt_red16_omega, true);
+  cross_check("ntt_red16_ct_std2rev_reg_asm", ntt_red16_ct_std2rev_reg_asm, ntt_red16_ct_std2rev);
+  cross_check("mulntt_red16_ct_std2rev_reg_asm", mulntt_red16_ct_std2rev_reg_asm, mulntt_red16_ct_std2rev);
+  cross_check("mulntt_red16_ct_std2rev_reg_fused_asm", mulntt_red16_ct_std2rev_reg_fused_asm, mulntt_red16_ct_std2rev_fused);
+  cross_check("mulntt_red16_ct_std2rev_simd_asm", mulntt_red16_ct_std2rev_simd_asm, mulntt_red16_ct_std2rev);
+  cross_check("mulntt_red16_ct_std2rev_simd_fused_asm", mulntt_red16_ct_std2rev_simd_fused_asm, mulntt_red16_ct_std2rev_fused);
+  cross_check("inttmul_red16_gs_rev2std_simd_asm", inttmul_red16_gs_rev2std_simd_asm, inttmul_red16_gs_rev2std);
+
   test_forward_inverse("ntt_red16_ct_std2rev_asm", "intt_red16_ct_rev2std_asm", ntt_red16_ct_std2rev_asm, intt_red16_ct_rev2std_asm);
   test_forward_inverse("intt_red16_ct_rev2std_asm", "ntt_red16_ct_std2rev_asm", intt_red16_ct_rev2std_asm, ntt_red16_ct_std2rev_asm);
   test_forward_inverse("ntt_red16_ct_std2rev_asm", "intt_red16_gs_rev2std_asm", ntt_red16_ct_std2rev_asm, intt_red16_gs_rev2std_asm);
@@ -452,16 +497,26 @@ int main(void) {
   test_simple_products("ntt_red16_product3_asm", ntt_red16_product3_asm);
   test_simple_products("ntt_red16_product4_asm", ntt_red16_product4_asm);
   test_simple_products("ntt_red16_product5_asm", ntt_red16_product5_asm);
+  test_simple_products("ntt_red16_product6_asm", ntt_red16_product6_asm);
+  test_simple_products("ntt_red16_product_simd_asm", ntt_red16_product_simd_asm);
 
   speed_test("ntt_red16_ct_rev2std_asm", ntt_red16_ct_rev2std_asm);
   speed_test("ntt_red16_gs_rev2std_asm", ntt_red16_gs_rev2std_asm);
   speed_test("ntt_red16_ct_std2rev_asm", ntt_red16_ct_std2rev_asm);
   speed_test("ntt_red16_gs_std2rev_asm", ntt_red16_gs_std2rev_asm);
+  speed_test("ntt_red16_ct_std2rev_reg_asm", ntt_red16_ct_std2rev_reg_asm);
+  speed_test("mulntt_red16_ct_std2rev_asm", mulntt_red16_ct_std2rev_asm);
+  speed_test("mulntt_red16_ct_std2rev_reg_asm", mulntt_red16_ct_std2rev_reg_asm);
+  speed_test("mulntt_red16_ct_std2rev_fused_asm", mulntt_red16_ct_std2rev_fused_asm);
+  speed_test("mulntt_red16_ct_std2rev_reg_fused_asm", mulntt_red16_ct_std2rev_reg_fused_asm);
+  speed_test("mulntt_red16_ct_std2rev_simd_fused_asm", mulntt_red16_ct_std2rev_simd_fused_asm);
   printf("\n");
   speed_test("intt_red16_ct_rev2std_asm", intt_red16_ct_rev2std_asm);
   speed_test("intt_red16_gs_rev2std_asm", intt_red16_gs_rev2std_asm);
   speed_test("intt_red16_ct_std2rev_asm", intt_red16_ct_std2rev_asm);
   speed_test("intt_red16_gs_std2rev_asm", intt_red16_gs_std2rev_asm);
+  speed_test("inttmul_red16_gs_rev2std_asm", inttmul_red16_gs_rev2std_asm);
+  speed_test("inttmul_red16_gs_rev2std_simd_asm", inttmul_red16_gs_rev2std_simd_asm);
   printf("\n");
 
   speed_test2("ntt_red16_product1_asm", ntt_red16_product1_asm);
@@ -469,6 +524,8 @@ int main(void) {
   speed_test2("ntt_red16_product3_asm", ntt_red16_product3_asm);
   speed_test2("ntt_red16_product4_asm", ntt_red16_product4_asm);
   speed_test2("ntt_red16_product5_asm", ntt_red16_product5_asm);
+  speed_test2("ntt_red16_product6_asm", ntt_red16_product6_asm);
+  speed_test2("ntt_red16_product_simd_asm", ntt_red16_product_simd_asm);
   
   return 0;
 }
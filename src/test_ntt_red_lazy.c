@@ -0,0 +1,314 @@
+/*
+ * Tests of the lazy-reduction products (generated by make_lazy_schedule)
+ * - mulntt_red_ct_std2rev_lazy and nttmul_red_gs_rev2std_lazy are compared
+ *   with mulntt_red_ct_std2rev and nttmul_red_gs_rev2std
+ * - the products are compared with ntt_red<n>_product5 and ntt_red<n>_product5_asm
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "red_bounds.h"
+#include "ntt_red.h"
+#include "ntt_asm.h"
+#include "ntt_red16.h"
+#include "ntt_red256.h"
+#include "ntt_red512.h"
+#include "ntt_red1024.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+#include "ntt_red16_lazy.h"
+#include "ntt_red256_lazy.h"
+#include "ntt_red512_lazy.h"
+#include "ntt_red1024_lazy.h"
+#include "sort.h"
+
+#define Q 12289
+
+
+/*
+ * PERFORMANCE MEASUREMENTS
+ */
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 10240
+
+static uint64_t t[NTESTS];
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+
+/*
+ * Products for size n
+ */
+typedef void (*product_fun_t)(int32_t *c, int32_t *a, int32_t *b);
+
+typedef struct product_set_s {
+  uint32_t n;
+  const int16_t *fwd;
+  const int16_t *inv;
+  product_fun_t product5;
+  product_fun_t product5_asm;
+  product_fun_t lazy;
+  product_fun_t lazy_asm;
+} product_set_t;
+
+static const product_set_t products[4] = {
+  { 16, ntt_red16_mixed_powers_rev, ntt_red16_inv_mixed_powers_rev,
+    ntt_red16_product5, ntt_red16_product5_asm,
+    ntt_red16_lazy_product, ntt_red16_lazy_product_asm },
+  { 256, ntt_red256_mixed_powers_rev, ntt_red256_inv_mixed_powers_rev,
+    ntt_red256_product5, ntt_red256_product5_asm,
+    ntt_red256_lazy_product, ntt_red256_lazy_product_asm },
+  { 512, ntt_red512_mixed_powers_rev, ntt_red512_inv_mixed_powers_rev,
+    ntt_red512_product5, ntt_red512_product5_asm,
+    ntt_red512_lazy_product, ntt_red512_lazy_product_asm },
+  { 1024, ntt_red1024_mixed_powers_rev, ntt_red1024_inv_mixed_powers_rev,
+    ntt_red1024_product5, ntt_red1024_product5_asm,
+    ntt_red1024_lazy_product, ntt_red1024_lazy_product_asm },
+};
+
+
+static int32_t a[1024] __attribute__ ((aligned(32)));
+static int32_t b[1024] __attribute__ ((aligned(32)));
+static int32_t c[1024] __attribute__ ((aligned(32)));
+static int32_t d[1024] __attribute__ ((aligned(32)));
+static int32_t a_copy[1024] __attribute__ ((aligned(32)));
+static int32_t b_copy[1024] __attribute__ ((aligned(32)));
+
+/*
+ * Input patterns
+ * - 0: random in [0, Q-1]
+ * - 1: all coefficients equal to Q-1
+ * - 2: alternate 0 and Q-1
+ * - 3: all coefficients equal to 0, except a[0] = Q-1
+ */
+static void init_array(int32_t *x, uint32_t n, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    switch (pattern) {
+    case 0: x[i] = random() % Q; break;
+    case 1: x[i] = Q-1; break;
+    case 2: x[i] = (i & 1) ? Q-1 : 0; break;
+    default: x[i] = (i == 0) ? Q-1 : 0; break;
+    }
+  }
+}
+
+static void copy_array(int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = y[i];
+  }
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * x^k modulo Q
+ */
+static int32_t power3(uint32_t k) {
+  int32_t x;
+
+  x = 1;
+  while (k > 0) {
+    x = (3 * x) % Q;
+    k --;
+  }
+  return x;
+}
+
+static uint32_t popcount(uint32_t x) {
+  uint32_t c;
+
+  c = 0;
+  while (x != 0) {
+    c += x & 1;
+    x >>= 1;
+  }
+  return c;
+}
+
+/*
+ * Check that the schedule is safe for inputs in [0, Q-1]
+ */
+static bool safe_schedule(const product_set_t *s, uint32_t rounds, bool ct) {
+  int64_t bound[11], prod[11];
+  uint32_t k, log_n;
+
+  log_n = 0;
+  while ((1u << log_n) < s->n) log_n ++;
+  assert(log_n <= 10);
+
+  if (ct) {
+    ntt_ct_lazy_bounds(Q-1, s->n, s->fwd, rounds, bound, prod);
+  } else {
+    ntt_gs_lazy_bounds(Q-1, s->n, s->inv, rounds, bound, prod);
+  }
+  for (k=1; k<=log_n; k++) {
+    if (bound[k] > INT32_MAX || prod[k] > MAX_MUL_RED) return false;
+  }
+  return true;
+}
+
+/*
+ * Lazy NTTs with reduction mask rounds: the result must be
+ * equal to 3^popcount(rounds) * the result of the default NTT.
+ */
+static void test_lazy_ntt(const product_set_t *s, uint32_t rounds) {
+  uint32_t i, n, pattern;
+  int32_t k;
+  bool ct;
+
+  n = s->n;
+  k = power3(popcount(rounds));
+
+  for (ct = false; ; ct = true) {
+    printf("Testing %s_lazy: n = %"PRIu32", rounds = 0x%"PRIx32"\n",
+	   ct ? "mulntt_red_ct_std2rev" : "nttmul_red_gs_rev2std", n, rounds);
+    if (! safe_schedule(s, rounds, ct)) {
+      printf("unsafe schedule: skipped\n");
+    } else {
+      for (pattern=0; pattern<4; pattern++) {
+	init_array(a, n, pattern);
+	copy_array(b, a, n);
+	if (ct) {
+	  mulntt_red_ct_std2rev(a, n, s->fwd);
+	  mulntt_red_ct_std2rev_lazy(b, n, s->fwd, rounds);
+	} else {
+	  nttmul_red_gs_rev2std(a, n, s->inv);
+	  nttmul_red_gs_rev2std_lazy(b, n, s->inv, rounds);
+	}
+	normalize(a, n);
+	normalize(b, n);
+	for (i=0; i<n; i++) {
+	  if (b[i] != (k * a[i]) % Q) {
+	    printf("failed: pattern %"PRIu32", index %"PRIu32"\n", pattern, i);
+	    exit(1);
+	  }
+	}
+      }
+      printf("passed\n");
+    }
+    if (ct) break;
+  }
+}
+
+/*
+ * Products: compare with product5
+ */
+static void test_product(const char *name, uint32_t n, product_fun_t f, product_fun_t ref) {
+  uint32_t i, j, k;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      for (k=0; k<(i == 0 || j == 0 ? 100 : 1); k++) {
+	init_array(a, n, i);
+	init_array(b, n, j);
+	copy_array(a_copy, a, n);
+	copy_array(b_copy, b, n);
+	f(c, a, b);
+	ref(d, a_copy, b_copy);
+	if (! equal_arrays(c, d, n)) {
+	  printf("failed: patterns %"PRIu32" and %"PRIu32"\n", i, j);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+static void speed_test(const char *name, uint32_t n, product_fun_t f) {
+  uint32_t i;
+  uint64_t c0;
+
+  init_array(a, n, 0);
+  init_array(b, n, 0);
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(c, a, b);
+  }
+  c0 = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c0 - t[i];
+
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64"\n", name, n, median_time());
+}
+
+int main(void) {
+  const product_set_t *s;
+  uint32_t i, all;
+
+  for (i=0; i<4; i++) {
+    s = products + i;
+    all = (s->n << 1) - 2; // rounds 1 to log_2(n)
+    test_lazy_ntt(s, 0);
+    test_lazy_ntt(s, 0x2);
+    test_lazy_ntt(s, 0x54 & all);
+    test_lazy_ntt(s, all);
+    test_product("lazy_product", s->n, s->lazy, s->product5);
+    printf("\n");
+  }
+
+  if (! avx2_supported()) {
+    printf("AVX2 is not supported\n");
+    return 0;
+  }
+
+  for (i=0; i<4; i++) {
+    s = products + i;
+    test_product("lazy_product_asm", s->n, s->lazy_asm, s->product5_asm);
+  }
+  printf("\n");
+
+  for (i=0; i<4; i++) {
+    s = products + i;
+    speed_test("product5", s->n, s->product5);
+    speed_test("lazy_product", s->n, s->lazy);
+    speed_test("product5_asm", s->n, s->product5_asm);
+    speed_test("lazy_product_asm", s->n, s->lazy_asm);
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * Tests of the recursive (depth-first) NTTs
+ * - ntt_red_ct_std2rev_rec and ntt_red_gs_rev2std_rec are compared
+ *   with the breadth-first versions
+ * - speed comparison for n = 1024 to 65536
+ *
+ * Q=12289 has primitive n-th roots of unity only for n <= 4096.
+ * For larger n, we use synthetic tables where p[i] = +/-inverse(3):
+ * mul_red(x, -4096) = x and mul_red(x, 4096) = -x so the coefficients
+ * at most double in each round and there's no overflow for
+ * n <= 65536. The memory accesses are the same as for real tables.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_red.h"
+#include "ntt_red1024.h"
+#include "sort.h"
+
+#define Q 12289
+#define MAX_N 65536
+
+/*
+ * PERFORMANCE MEASUREMENTS
+ */
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 501
+
+static uint64_t t[NTESTS];
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+
+typedef void (*ntt_fun_t)(int32_t *a, uint32_t n, const int16_t *p);
+
+static int32_t a[MAX_N];
+static int32_t b[MAX_N];
+static int16_t p[MAX_N];
+
+/*
+ * Input patterns
+ * - 0: random in [0, Q-1]
+ * - 1: all coefficients equal to Q-1
+ * - 2: alternate 0 and Q-1
+ * - 3: all coefficients equal to 0, except a[0] = Q-1
+ */
+static void init_array(int32_t *x, uint32_t n, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    switch (pattern) {
+    case 0: x[i] = random() % Q; break;
+    case 1: x[i] = Q-1; break;
+    case 2: x[i] = (i & 1) ? Q-1 : 0; break;
+    default: x[i] = (i == 0) ? Q-1 : 0; break;
+    }
+  }
+}
+
+/*
+ * Synthetic table: random +/- inverse(3)
+ */
+static void init_table(int16_t *x, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = (random() & 1) ? 4096 : -4096;
+  }
+}
+
+static void copy_array(int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = y[i];
+  }
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Compare f(a, n, tbl) and g(a, n, tbl)
+ */
+static void test_same_ntt(const char *name, uint32_t n, const int16_t *tbl, ntt_fun_t f, ntt_fun_t g) {
+  uint32_t i, k;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (i=0; i<4; i++) {
+    for (k=0; k<(i == 0 ? 10 : 1); k++) {
+      init_array(a, n, i);
+      copy_array(b, a, n);
+      f(a, n, tbl);
+      g(b, n, tbl);
+      if (! equal_arrays(a, b, n)) {
+        printf("failed: pattern %"PRIu32"\n", i);
+        exit(1);
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+static void speed_test(const char *name, uint32_t n, ntt_fun_t f) {
+  uint32_t i;
+  uint64_t c;
+
+  init_table(p, n);
+  for (i=0; i<NTESTS; i++) {
+    init_array(a, n, 0);
+    c = cpucycles();
+    f(a, n, p);
+    t[i] = cpucycles() - c;
+  }
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64"\n", name, n, median_time());
+}
+
+int main(void) {
+  uint32_t n;
+
+  // real tables: leaf only
+  test_same_ntt("ntt_red_ct_std2rev_rec", 1024, ntt_red1024_omega_powers_rev,
+                ntt_red_ct_std2rev_rec, ntt_red_ct_std2rev);
+  test_same_ntt("ntt_red_ct_std2rev_rec", 1024, ntt_red1024_mixed_powers_rev,
+                ntt_red_ct_std2rev_rec, mulntt_red_ct_std2rev);
+  test_same_ntt("ntt_red_gs_rev2std_rec", 1024, ntt_red1024_inv_omega_powers_rev,
+                ntt_red_gs_rev2std_rec, ntt_red_gs_rev2std);
+  test_same_ntt("ntt_red_gs_rev2std_rec", 1024, ntt_red1024_inv_mixed_powers_rev,
+                ntt_red_gs_rev2std_rec, nttmul_red_gs_rev2std);
+  printf("\n");
+
+  // synthetic tables
+  for (n=16; n<=MAX_N; n <<= 1) {
+    init_table(p, n);
+    test_same_ntt("ntt_red_ct_std2rev_rec", n, p, ntt_red_ct_std2rev_rec, mulntt_red_ct_std2rev);
+    test_same_ntt("ntt_red_gs_rev2std_rec", n, p, ntt_red_gs_rev2std_rec, nttmul_red_gs_rev2std);
+  }
+  printf("\n");
+
+  for (n=1024; n<=MAX_N; n <<= 1) {
+    speed_test("mulntt_red_ct_std2rev", n, mulntt_red_ct_std2rev);
+    speed_test("ntt_red_ct_std2rev_rec", n, ntt_red_ct_std2rev_rec);
+    speed_test("nttmul_red_gs_rev2std", n, nttmul_red_gs_rev2std);
+    speed_test("ntt_red_gs_rev2std_rec", n, ntt_red_gs_rev2std_rec);
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * Tests of the shared tables (ntt_red_shared.h)
+ * - the tables for 1024 must be the same as ntt_red1024_tables
+ * - the products are compared with a naive product for n = 2 to 1024
+ *   and with ntt_red<n>_product5 for n = 16, 256, 512, 1024
+ * - report of the table sizes
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_red_shared.h"
+#include "ntt_red16.h"
+#include "ntt_red256.h"
+#include "ntt_red512.h"
+#include "ntt_red1024.h"
+#include "ntt_red_asm16.h"
+#include "ntt_red_asm256.h"
+#include "ntt_red_asm512.h"
+#include "ntt_red_asm1024.h"
+#include "sort.h"
+
+#define Q 12289
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 10240
+
+static uint64_t t[NTESTS];
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+static int32_t a[1024] __attribute__ ((aligned(32)));
+static int32_t b[1024] __attribute__ ((aligned(32)));
+static int32_t c[1024] __attribute__ ((aligned(32)));
+static int32_t d[1024] __attribute__ ((aligned(32)));
+static int32_t a_copy[1024] __attribute__ ((aligned(32)));
+static int32_t b_copy[1024] __attribute__ ((aligned(32)));
+
+typedef void (*product_fun_t)(int32_t *c, int32_t *a, int32_t *b);
+typedef void (*shared_product_fun_t)(int32_t *c, int32_t *a, int32_t *b, uint32_t n);
+
+/*
+ * Input patterns
+ * - 0: random in [0, Q-1]
+ * - 1: all coefficients equal to Q-1
+ * - 2: alternate 0 and Q-1
+ * - 3: all coefficients equal to 0, except a[0] = Q-1
+ */
+static void init_array(int32_t *x, uint32_t n, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    switch (pattern) {
+    case 0: x[i] = random() % Q; break;
+    case 1: x[i] = Q-1; break;
+    case 2: x[i] = (i & 1) ? Q-1 : 0; break;
+    default: x[i] = (i == 0) ? Q-1 : 0; break;
+    }
+  }
+}
+
+static void copy_array(int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    x[i] = y[i];
+  }
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+static bool equal_tables(const int16_t *x, const int16_t *y, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (x[i] != y[i]) return false;
+  }
+  return true;
+}
+
+/*
+ * Naive product modulo X^n + 1 and Q
+ */
+static void naive_product(int32_t *z, const int32_t *x, const int32_t *y, uint32_t n) {
+  uint32_t i, j;
+  int64_t s;
+
+  for (i=0; i<n; i++) {
+    s = 0;
+    for (j=0; j<=i; j++) {
+      s += (int64_t) x[j] * y[i - j];
+    }
+    for (j=i+1; j<n; j++) {
+      s -= (int64_t) x[j] * y[n + i - j];
+    }
+    s %= Q;
+    z[i] = (s < 0) ? s + Q : s;
+  }
+}
+
+static void test_tables(void) {
+  printf("Testing the shared tables against ntt_red1024_tables\n");
+  if (!equal_tables(ntt_red_shared_omega_powers_rev, ntt_red1024_omega_powers_rev, 1024) ||
+      !equal_tables(ntt_red_shared_inv_omega_powers_rev, ntt_red1024_inv_omega_powers_rev, 1024) ||
+      !equal_tables(ntt_red_shared_mixed_powers_rev, ntt_red1024_mixed_powers_rev, 1024) ||
+      !equal_tables(ntt_red_shared_inv_mixed_powers_rev, ntt_red1024_inv_mixed_powers_rev, 1024) ||
+      ntt_red_shared_rescale8[10] != ntt_red1024_rescale8) {
+    printf("failed\n");
+    exit(1);
+  }
+  printf("passed\n\n");
+}
+
+/*
+ * Compare f(c, a, b, n) with the naive product
+ */
+static void test_naive(const char *name, uint32_t n, shared_product_fun_t f) {
+  uint32_t i, j, k;
+
+  printf("Testing %s: n = %"PRIu32"\n", name, n);
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      for (k=0; k<(i == 0 || j == 0 ? 20 : 1); k++) {
+	init_array(a, n, i);
+	init_array(b, n, j);
+	naive_product(d, a, b, n);
+	f(c, a, b, n);
+	if (! equal_arrays(c, d, n)) {
+	  printf("failed: patterns %"PRIu32" and %"PRIu32"\n", i, j);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Compare f(c, a, b, n) with ref(c, a, b)
+ */
+static void test_product5(const char *name, uint32_t n, shared_product_fun_t f, product_fun_t ref) {
+  uint32_t i, j, k;
+
+  printf("Testing %s against product5: n = %"PRIu32"\n", name, n);
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      for (k=0; k<(i == 0 || j == 0 ? 100 : 1); k++) {
+	init_array(a, n, i);
+	init_array(b, n, j);
+	copy_array(a_copy, a, n);
+	copy_array(b_copy, b, n);
+	f(c, a, b, n);
+	ref(d, a_copy, b_copy);
+	if (! equal_arrays(c, d, n)) {
+	  printf("failed: patterns %"PRIu32" and %"PRIu32"\n", i, j);
+	  exit(1);
+	}
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+
+/*
+ * TABLE SIZES
+ */
+#define RED_TABLE_BYTES(n) \
+  (sizeof(ntt_red##n##_psi_powers) + sizeof(ntt_red##n##_inv_psi_powers) + \
+   sizeof(ntt_red##n##_scaled_inv_psi_powers) + sizeof(ntt_red##n##_scaled_inv_psi_powers_var) + \
+   sizeof(ntt_red##n##_omega_powers) + sizeof(ntt_red##n##_omega_powers_rev) + \
+   sizeof(ntt_red##n##_inv_omega_powers) + sizeof(ntt_red##n##_inv_omega_powers_rev) + \
+   sizeof(ntt_red##n##_mixed_powers) + sizeof(ntt_red##n##_mixed_powers_rev) + \
+   sizeof(ntt_red##n##_inv_mixed_powers) + sizeof(ntt_red##n##_inv_mixed_powers_rev) + \
+   sizeof(ntt_red##n##_omega_powers_ct_r4) + sizeof(ntt_red##n##_omega_powers_rev_ct_r4) + \
+   sizeof(ntt_red##n##_omega_powers_gs_r4) + sizeof(ntt_red##n##_omega_powers_rev_gs_r4) + \
+   sizeof(ntt_red##n##_inv_omega_powers_ct_r4) + sizeof(ntt_red##n##_inv_omega_powers_rev_ct_r4) + \
+   sizeof(ntt_red##n##_inv_omega_powers_gs_r4) + sizeof(ntt_red##n##_inv_omega_powers_rev_gs_r4) + \
+   sizeof(ntt_red##n##_mixed_powers_ct_r4) + sizeof(ntt_red##n##_mixed_powers_rev_ct_r4) + \
+   sizeof(ntt_red##n##_inv_mixed_powers_gs_r4) + sizeof(ntt_red##n##_inv_mixed_powers_rev_gs_r4) + \
+   sizeof(ntt_red##n##_omega_powers_ct_cg) + sizeof(ntt_red##n##_omega_powers_rev_ct_cg) + \
+   sizeof(ntt_red##n##_omega_powers_gs_cg) + sizeof(ntt_red##n##_omega_powers_rev_gs_cg) + \
+   sizeof(ntt_red##n##_inv_omega_powers_ct_cg) + sizeof(ntt_red##n##_inv_omega_powers_rev_ct_cg) + \
+   sizeof(ntt_red##n##_inv_omega_powers_gs_cg) + sizeof(ntt_red##n##_inv_omega_powers_rev_gs_cg) + \
+   sizeof(ntt_red##n##_mixed_powers_ct_cg) + sizeof(ntt_red##n##_mixed_powers_rev_ct_cg) + \
+   sizeof(ntt_red##n##_inv_mixed_powers_gs_cg) + sizeof(ntt_red##n##_inv_mixed_powers_rev_gs_cg) + \
+   sizeof(ntt_red##n##_twiddles_4step) + sizeof(ntt_red##n##_inv_twiddles_4step) + \
+   sizeof(ntt_red##n##_mixed_twiddles_4step) + sizeof(ntt_red##n##_inv_mixed_twiddles_4step))
+
+// tables used by product5 (C and asm)
+#define RED_PRODUCT5_BYTES(n) \
+  (sizeof(ntt_red##n##_mixed_powers_rev) + sizeof(ntt_red##n##_inv_mixed_powers_rev))
+
+static void report_sizes(void) {
+  size_t all, used, shared, shared_used;
+
+  all = RED_TABLE_BYTES(16) + RED_TABLE_BYTES(256) + RED_TABLE_BYTES(512) + RED_TABLE_BYTES(1024);
+  used = RED_PRODUCT5_BYTES(16) + RED_PRODUCT5_BYTES(256) + RED_PRODUCT5_BYTES(512) + RED_PRODUCT5_BYTES(1024);
+  shared = sizeof(ntt_red_shared_omega_powers_rev) + sizeof(ntt_red_shared_inv_omega_powers_rev) +
+    sizeof(ntt_red_shared_mixed_powers_rev) + sizeof(ntt_red_shared_inv_mixed_powers_rev) +
+    sizeof(ntt_red_shared_rescale8);
+  shared_used = sizeof(ntt_red_shared_mixed_powers_rev) + sizeof(ntt_red_shared_inv_mixed_powers_rev) +
+    sizeof(ntt_red_shared_rescale8);
+
+  printf("Table sizes for n = 16, 256, 512, 1024\n");
+  printf("  ntt_red<n>_tables, all tables:           %7zu bytes\n", all);
+  printf("  ntt_red<n>_tables, used by product5:     %7zu bytes\n", used);
+  printf("  ntt_red_shared_tables, all tables:       %7zu bytes (all n <= 1024)\n", shared);
+  printf("  ntt_red_shared_tables, used by products: %7zu bytes (all n <= 1024)\n\n", shared_used);
+}
+
+
+/*
+ * SPEED
+ */
+static void speed_test(const char *name, uint32_t n, product_fun_t f) {
+  uint32_t i;
+  uint64_t c0;
+
+  init_array(a, n, 0);
+  init_array(b, n, 0);
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(c, a, b);
+  }
+  c0 = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c0 - t[i];
+
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64"\n", name, n, median_time());
+}
+
+static void speed_test_shared(const char *name, uint32_t n, shared_product_fun_t f) {
+  uint32_t i;
+  uint64_t c0;
+
+  init_array(a, n, 0);
+  init_array(b, n, 0);
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    f(c, a, b, n);
+  }
+  c0 = cpucycles();
+  for (i=0; i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c0 - t[i];
+
+  printf("speed test %s (n=%"PRIu32"): median = %"PRIu64"\n", name, n, median_time());
+}
+
+int main(void) {
+  static const uint32_t sizes[4] = { 16, 256, 512, 1024 };
+  static const product_fun_t product5[4] = {
+    ntt_red16_product5, ntt_red256_product5, ntt_red512_product5, ntt_red1024_product5,
+  };
+  static const product_fun_t product5_asm[4] = {
+    ntt_red16_product5_asm, ntt_red256_product5_asm, ntt_red512_product5_asm, ntt_red1024_product5_asm,
+  };
+  bool avx2;
+  uint32_t i, n;
+
+  avx2 = avx2_supported();
+
+  report_sizes();
+  test_tables();
+
+  for (n=2; n<=1024; n <<= 1) {
+    test_naive("ntt_red_shared_product", n, ntt_red_shared_product);
+    if (avx2 && n >= 16) {
+      test_naive("ntt_red_shared_product_asm", n, ntt_red_shared_product_asm);
+    }
+  }
+  printf("\n");
+
+  for (i=0; i<4; i++) {
+    test_product5("ntt_red_shared_product", sizes[i], ntt_red_shared_product, product5[i]);
+    if (avx2) {
+      test_product5("ntt_red_shared_product_asm", sizes[i], ntt_red_shared_product_asm, product5_asm[i]);
+    }
+  }
+  printf("\n");
+
+  for (i=0; i<4; i++) {
+    speed_test("product5", sizes[i], product5[i]);
+    speed_test_shared("ntt_red_shared_product", sizes[i], ntt_red_shared_product);
+    if (avx2) {
+      speed_test("product5_asm", sizes[i], product5_asm[i]);
+      speed_test_shared("ntt_red_shared_product_asm", sizes[i], ntt_red_shared_product_asm);
+    }
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ * Tests of the RNS products
+ * - CRT reconstruction of 64bit integers
+ * - exact products compared with a naive negacyclic product
+ * - products modulo m
+ * - channel products on a thread pool
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ntt_rns.h"
+#include "ntt_pool.h"
+#include "ntt_asm.h"
+#include "sort.h"
+
+#define N NTT_RNS_N
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 1024
+
+static uint64_t t[NTESTS];
+
+static uint64_t median_time(void) {
+  sort(t, NTESTS);
+  return t[NTESTS/2];
+}
+
+static int64_t a[N], b[N], c[N], d[N];
+static uint64_t ua[N], ub[N], uc[N], ud[N];
+static ntt_rns_poly_t x, y, z, w, v;
+
+/*
+ * Random integer in [-bound, bound]
+ */
+static int64_t random_in(int64_t bound) {
+  uint64_t r;
+
+  r = ((uint64_t) random() << 62) ^ ((uint64_t) random() << 31) ^ random();
+  if (bound == INT64_MAX) return (int64_t) r;
+  return (int64_t) (r % (2 * (uint64_t) bound + 1)) - bound;
+}
+
+/*
+ * Naive product modulo X^N + 1 (no overflow if the result fits in 64 bits)
+ */
+static void naive_product(int64_t *c, const int64_t *a, const int64_t *b) {
+  uint32_t i, j;
+  int64_t s;
+
+  for (i=0; i<N; i++) {
+    s = 0;
+    for (j=0; j<=i; j++) {
+      s += a[j] * b[i - j];
+    }
+    for (j=i+1; j<N; j++) {
+      s -= a[j] * b[N + i - j];
+    }
+    c[i] = s;
+  }
+}
+
+static bool equal_arrays(const int64_t *a, const int64_t *b) {
+  uint32_t i;
+
+  for (i=0; i<N; i++) {
+    if (a[i] != b[i]) return false;
+  }
+  return true;
+}
+
+static void check(const char *name, const int64_t *a, const int64_t *b) {
+  if (!equal_arrays(a, b)) {
+    printf("failed: %s\n", name);
+    exit(1);
+  }
+}
+
+/*
+ * Initialize x with a pattern, coefficients in [-bound, bound]
+ * - 0: random
+ * - 1: all equal to bound
+ * - 2: all equal to -bound
+ * - 3: alternating bound and -bound
+ */
+static void init_array(int64_t *x, int64_t bound, uint32_t pattern) {
+  uint32_t i;
+
+  for (i=0; i<N; i++) {
+    switch (pattern) {
+    case 0: x[i] = random_in(bound); break;
+    case 1: x[i] = bound; break;
+    case 2: x[i] = -bound; break;
+    default: x[i] = (i & 1) ? -bound : bound; break;
+    }
+  }
+}
+
+/*
+ * CRT: conversion of 64bit integers and back
+ */
+static void test_crt(void) {
+  uint32_t i, k;
+
+  printf("Testing CRT reconstruction\n");
+  for (k=0; k<100; k++) {
+    for (i=0; i<N; i++) {
+      a[i] = random_in(INT64_MAX);
+    }
+    a[0] = INT64_MIN;
+    a[1] = INT64_MAX;
+    a[2] = 0;
+    a[3] = -1;
+    a[4] = 1;
+    a[5] = (int64_t) 1 << 62;
+    a[6] = - ((int64_t) 1 << 62);
+    ntt_rns_from_int64(&x, a);
+    w = x;
+    ntt_rns_to_int64(c, &x);
+    check("to_int64", a, c);
+    if (avx2_supported()) {
+      ntt_rns_to_int64_asm(d, &w);
+      check("to_int64_asm", a, d);
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Products with |a[i]| <= ba and |b[i]| <= bb
+ */
+static void test_product(int64_t ba, int64_t bb) {
+  uint32_t i, j, k;
+
+  printf("Testing products: |a[i]| <= %"PRId64", |b[i]| <= %"PRId64"\n", ba, bb);
+  for (i=0; i<4; i++) {
+    for (j=0; j<4; j++) {
+      for (k=0; k<(i == 0 || j == 0 ? 10 : 1); k++) {
+	init_array(a, ba, i);
+	init_array(b, bb, j);
+	naive_product(d, a, b);
+	ntt_rns_product(c, a, b);
+	check("product", d, c);
+	if (avx2_supported()) {
+	  ntt_rns_product_asm(c, a, b);
+	  check("product_asm", d, c);
+	}
+      }
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Products modulo m
+ */
+static void test_product_mod(uint64_t m) {
+  uint32_t i, j, k, l;
+
+  printf("Testing products modulo %"PRIu64"\n", m);
+  for (k=0; k<20; k++) {
+    for (i=0; i<N; i++) {
+      switch (k) {
+      case 0: ua[i] = m - 1; ub[i] = m - 1; break;
+      case 1: ua[i] = m/2; ub[i] = m/2 + 1; break;
+      default: ua[i] = random() % m; ub[i] = random() % m; break;
+      }
+    }
+    // reference: naive product of the residues in [0, m-1]
+    for (i=0; i<N; i++) {
+      ud[i] = 0;
+      for (j=0; j<N; j++) {
+	l = (i + N - j) % N;
+	if (j <= i) {
+	  ud[i] = (ud[i] + ua[j] * ub[l]) % m;
+	} else {
+	  ud[i] = (ud[i] + (m - ua[j]) * ub[l]) % m;
+	}
+      }
+    }
+    ntt_rns_product_mod(uc, ua, ub, m);
+    check("product_mod", (int64_t *) ud, (int64_t *) uc);
+    if (avx2_supported()) {
+      ntt_rns_product_mod_asm(uc, ua, ub, m);
+      check("product_mod_asm", (int64_t *) ud, (int64_t *) uc);
+    }
+  }
+  printf("passed\n");
+}
+
+/*
+ * Channel products on a pool: same result as ntt_rns_mul
+ */
+static void test_pool(uint32_t nthreads) {
+  ntt_pool_t *pool;
+  uint32_t k;
+
+  pool = ntt_pool_create(nthreads, false);
+  if (pool == NULL) {
+    printf("failed: can't create a pool of %"PRIu32" threads\n", nthreads);
+    exit(1);
+  }
+  printf("Testing channel products: %"PRIu32" threads\n", ntt_pool_size(pool));
+  for (k=0; k<20; k++) {
+    init_array(a, (int64_t) 1 << 26, 0);
+    init_array(b, (int64_t) 1 << 26, 0);
+    ntt_rns_from_int64(&x, a);
+    ntt_rns_from_int64(&y, b);
+    if (ntt_rns_mul_pool(pool, &w, &x, &y) < 0) {
+      printf("failed: ntt_rns_mul_pool returned an error\n");
+      exit(1);
+    }
+    ntt_rns_to_int64(c, &w);
+    ntt_rns_mul(&z, &x, &y);
+    ntt_rns_to_int64(d, &z);
+    check("mul_pool", d, c);
+  }
+  ntt_pool_delete(pool);
+  printf("passed\n");
+}
+
+static void speed_test(void) {
+  ntt_pool_t *pool;
+  uint32_t i;
+  uint64_t s;
+
+  init_array(a, (int64_t) 1 << 26, 0);
+  init_array(b, (int64_t) 1 << 26, 0);
+  for (i=0; i<NTESTS; i++) {
+    s = cpucycles();
+    ntt_rns_product(c, a, b);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_product: median = %"PRIu64"\n", median_time());
+
+  ntt_rns_from_int64(&z, a);
+  for (i=0; i<NTESTS; i++) {
+    x = z;
+    s = cpucycles();
+    ntt_rns_to_int64(c, &x);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_to_int64: median = %"PRIu64"\n", median_time());
+
+  if (!avx2_supported()) return;
+
+  for (i=0; i<NTESTS; i++) {
+    s = cpucycles();
+    ntt_rns_product_asm(c, a, b);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_product_asm: median = %"PRIu64"\n", median_time());
+
+  for (i=0; i<NTESTS; i++) {
+    x = z;
+    s = cpucycles();
+    ntt_rns_to_int64_asm(c, &x);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_to_int64_asm: median = %"PRIu64"\n", median_time());
+
+  pool = ntt_pool_create(NTT_RNS_CHANNELS, false);
+  if (pool == NULL) return;
+  ntt_rns_from_int64(&x, a);
+  ntt_rns_from_int64(&y, b);
+  for (i=0; i<NTESTS; i++) {
+    s = cpucycles();
+    ntt_rns_mul_pool(pool, &w, &x, &y);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_mul_pool (%"PRIu32" threads): median = %"PRIu64"\n",
+	 ntt_pool_size(pool), median_time());
+  for (i=0; i<NTESTS; i++) {
+    w = x;
+    z = y;
+    s = cpucycles();
+    ntt_rns_mul_asm(&v, &w, &z);
+    t[i] = cpucycles() - s;
+  }
+  printf("speed test ntt_rns_mul_asm: median = %"PRIu64"\n", median_time());
+  ntt_pool_delete(pool);
+}
+
+int main(void) {
+  test_crt();
+  test_product((int64_t) 1 << 26, (int64_t) 1 << 26);
+  test_product((int64_t) 1 << 40, (int64_t) 1 << 12);
+  test_product(INT32_MAX, 1 << 21);
+  test_product_mod(2);
+  test_product_mod(12289);
+  test_product_mod(111546435); // 3 * 5 * 7 * 11 * 13 * 17 * 19 * 23
+  test_product_mod(NTT_RNS_MAX_MODULUS);
+  test_pool(1);
+  test_pool(2);
+  test_pool(4);
+  printf("\n");
+
+  speed_test();
+
+  return 0;
+}
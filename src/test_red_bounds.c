@@ -273,6 +273,30 @@ static void show_ct_bounds(const char *name, uint32_t n, const int16_t *p) {
 }
 
 
+/*
+ * Bounds for the vpmulld variants of ntt_red_ct
+ * - the products computed by vpmulld must be less than 2^31 in absolute value
+ */
+static void show_mulld_bounds(const char *name, uint32_t n, const int16_t *p, bool std2rev) {
+  int64_t b0, m, bound[12], prod[12];
+  uint32_t k, t;
+
+  assert(n <= 2048);
+
+  printf("Bounds for function %s (vpmulld variant)\n\n", name);
+  b0 = 21499;
+  m = ntt_ct_mulld_bounds(b0, n, p, std2rev, bound, prod);
+  printf("bound on input = %"PRId64"\n", b0);
+  k = 0;
+  for (t=1; t<n; t<<=1) {
+    k ++;
+    printf("round %2"PRIu32": |w * x| <= %10"PRId64", |a[i]| <= %"PRId64"\n", k, prod[k], bound[k]);
+  }
+  printf("bound on products = %"PRId64"\n", m);
+  if (m > INT32_MAX) printf("--> overflow\n");
+  printf("\n");
+}
+
 int main(void) {
   int64_t min, max, min_x, max_x, min_y, max_y, b, nb, a, na;
 
@@ -430,6 +454,19 @@ int main(void) {
   show_ct_bounds("mulntt2048_red_ct_rev2std", 2048, shoup_sred_scaled_ntt2048_12289);
   show_ct_bounds("mulntt2048_red_ct_std2rev", 2048, rev_shoup_sred_scaled_ntt2048_12289);
 
+  show_mulld_bounds("ntt16_red_ct_rev2std", 16, shoup_sred_ntt16_12289, false);
+  show_mulld_bounds("ntt16_red_ct_std2rev", 16, rev_shoup_sred_ntt16_12289, true);
+  show_mulld_bounds("ntt128_red_ct_rev2std", 128, shoup_sred_ntt128_12289, false);
+  show_mulld_bounds("ntt128_red_ct_std2rev", 128, rev_shoup_sred_ntt128_12289, true);
+  show_mulld_bounds("ntt256_red_ct_rev2std", 256, shoup_sred_ntt256_12289, false);
+  show_mulld_bounds("ntt256_red_ct_std2rev", 256, rev_shoup_sred_ntt256_12289, true);
+  show_mulld_bounds("ntt512_red_ct_rev2std", 512, shoup_sred_ntt512_12289, false);
+  show_mulld_bounds("ntt512_red_ct_std2rev", 512, rev_shoup_sred_ntt512_12289, true);
+  show_mulld_bounds("ntt1024_red_ct_rev2std", 1024, shoup_sred_ntt1024_12289, false);
+  show_mulld_bounds("ntt1024_red_ct_std2rev", 1024, rev_shoup_sred_ntt1024_12289, true);
+  show_mulld_bounds("ntt2048_red_ct_rev2std", 2048, shoup_sred_ntt2048_12289, false);
+  show_mulld_bounds("ntt2048_red_ct_std2rev", 2048, rev_shoup_sred_ntt2048_12289, true);
+
   return 0;
 }
 